@@ -0,0 +1,121 @@
+#include "unicorn/collate.hpp"
+#include "unicorn/core.hpp"
+#include "unicorn/string.hpp"
+#include "unicorn/ucd-tables.hpp"
+#include "prion/unit-test.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+using namespace Unicorn;
+
+namespace {
+
+    void check_collation_keys() {
+
+        u8string key;
+
+        TRY(key = collation_key(u8""));                        TEST_EQUAL(key, "\0\0"s);
+        TRY(key = collation_key(u8"", collate_primary));       TEST_EQUAL(key, ""s);
+        TRY(key = collation_key(u8"", collate_quaternary));    TEST_EQUAL(key, "\0\0\0"s);
+        TRY(key = collation_key(u8"a"));                       TEST_EQUAL(key, "\x1f\xa2\0\x01\0\x02"s);
+        TRY(key = collation_key(u8"A"));                       TEST_EQUAL(key, "\x1f\xa2\0\x01\0\x08"s);
+        TRY(key = collation_key(u8"a", collate_primary));      TEST_EQUAL(key, "\x1f\xa2"s);
+        TRY(key = collation_key(u8"a", collate_secondary));    TEST_EQUAL(key, "\x1f\xa2\0\x01"s);
+        TRY(key = collation_key(u8"a", collate_quaternary));   TEST_EQUAL(key, "\x1f\xa2\0\x01\0\x02\0\xff\xff"s);
+        TRY(key = collation_key(u8" "));                       TEST_EQUAL(key, "\x02\x09\0\x01\0\x02"s);
+        TRY(key = collation_key(u8" ", collate_shifted));      TEST_EQUAL(key, "\0\0"s);
+        TRY(key = collation_key(u8" ", collate_quaternary));   TEST_EQUAL(key, "\0\0\0\x02\x09"s);
+        TRY(key = collation_key(u8"一"));                  TEST_EQUAL(key, "\xfb\x40\xce\x00\0\x01\0\x02"s);
+        TRY(key = collation_key(u8"\U0001f90c"));              TEST_EQUAL(key, "\xfb\xc3\xf9\x0c\0\x01\0\x02"s);
+
+        TEST_EQUAL(collation_key(u8"\u00e1"), collation_key(u8"a\u0301"));
+        TEST_EQUAL(collation_key(u8"\u0419"), collation_key(u8"\u0418\u0306"));
+        TEST_EQUAL(collation_key(u8"\u0419\u0323"), collation_key(u8"\u0418\u0306\u0323"));
+        TEST_EQUAL(collation_key(u8"\u0419\u0323"), collation_key(u8"\u0418\u0323\u0306"));
+        TEST_EQUAL(collation_key(u8"l\u00b7"), collation_key(u8"l\u0387"));
+        TEST_COMPARE(collation_key(u8"l\u00b7"), !=, collation_key(u8"l\u0301\u00b7"));
+
+        TEST_THROW(collation_key(u8"", collate_primary | collate_secondary), std::invalid_argument);
+        TEST_THROW(collation_key(u8"", collate_tertiary | collate_quaternary), std::invalid_argument);
+
+    }
+
+    void check_collation_order() {
+
+        std::vector<u8string> list = {
+            u8"", u8" ", u8"-", u8"!", u8"@", u8"\U0001f600", u8"1", u8"١", u8"½", u8"10", u8"2",
+            u8"\U000e0001a", u8"á", u8"á", u8"ab", u8"Ab", u8"äb", u8"ae", u8"AE", u8"Æ",
+            u8"co op", u8"co-op", u8"CO-OP", u8"coop", u8"cote", u8"Cote", u8"coté", u8"côte", u8"côté",
+            u8"dz", u8"Dz", u8"DZ", u8"ǅ", u8"fi", u8"ﬁ", u8"l·", u8"L·", u8"ll", u8"Ll",
+            u8"ol", u8"öl", u8"Öl", u8"resume", u8"Resume", u8"RESUME", u8"résumé", u8"ss", u8"SS", u8"ß",
+            u8"z", u8"Z", u8"ż", u8"α", u8"Α", u8"ά", u8"а", u8"가", u8"각", u8"て", u8"テ", u8"ﾃ", u8"一", u8"丁",
+        };
+
+        TEST(std::is_sorted(list.begin(), list.end(), CollateCompare()));
+        TEST(! std::is_sorted(list.begin(), list.end(), CollateCompare(collate_quaternary)));
+
+        std::swap(list[8], list[9]);
+        std::swap(list[22], list[23]);
+        TEST(std::is_sorted(list.begin(), list.end(), CollateCompare(collate_quaternary)));
+
+        TEST_EQUAL(collate_3way(u8"resume", u8"Résumé"), -1);
+        TEST_EQUAL(collate_3way(u8"Résumé", u8"resume"), 1);
+        TEST_EQUAL(collate_3way(u8"resume", u8"Résumé", collate_primary), 0);
+        TEST_EQUAL(collate_3way(u8"resume", u8"Résumé", collate_secondary), -1);
+        TEST_EQUAL(collate_3way(u8"resume", u8"Resume", collate_secondary), 0);
+        TEST_EQUAL(collate_3way(u8"resume", u8"Resume"), -1);
+        TEST_EQUAL(collate_3way(u8"co-op", u8"coop"), -1);
+        TEST_EQUAL(collate_3way(u8"co-op", u8"coop", collate_shifted), 0);
+        TEST_EQUAL(collate_3way(u8"co-op", u8"coop", collate_quaternary), -1);
+        TEST_EQUAL(collate_3way(u8"co-op", u8"co op", collate_shifted), 0);
+        TEST_EQUAL(collate_3way(u8"co-op", u8"co op", collate_quaternary), 1);
+
+        TEST(collate_compare(u8"a", u8"b"));
+        TEST(! collate_compare(u8"b", u8"a"));
+        TEST(! collate_compare(u8"a", u8"a"));
+        TEST(collate_compare(u8"B", u8"c"));
+        TEST(collate_compare(u8"file", u8"File"));
+        TEST(collate_compare(u8"zebra", u8"Ähnlich") == false);
+
+    }
+
+    void conformance_test(const u8string& name, Irange<char const* const*> table, uint32_t flags) {
+        size_t lnum = 0, failures = 0;
+        vector<u8string> hexcodes;
+        u8string text, key, prev_key;
+        for (u8string line: table) {
+            ++lnum;
+            str_split(line, overwrite(hexcodes));
+            text.clear();
+            for (auto&& hc: hexcodes)
+                str_append_char(text, char32_t(strtoul(hc.data(), nullptr, 16)));
+            TRY(key = collation_key(text, flags));
+            if (lnum > 1 && key < prev_key) {
+                FAIL(name + " " + dec(lnum) + ": " + line);
+                if (++failures == 10)
+                    break;
+            }
+            key.swap(prev_key);
+        }
+    }
+
+    void check_conformance() {
+
+        conformance_test("non-ignorable", UnicornDetail::collation_non_ignorable_test_table, 0);
+        conformance_test("shifted", UnicornDetail::collation_shifted_test_table, collate_quaternary);
+
+    }
+
+}
+
+TEST_MODULE(unicorn, collate) {
+
+    check_collation_keys();
+    check_collation_order();
+    check_conformance();
+
+}
@@ -0,0 +1,287 @@
+/*
+
+Unicode Collation Algorithm:
+
+References:
+Unicode Technical Standard #10, "Unicode Collation Algorithm"
+Default Unicode Collation Element Table (DUCET), allkeys.txt
+
+Step 1: Convert the string to NFD. A string consisting only of characters
+below U+0300 is left alone: none of them are non-starters, and the DUCET
+already gives any precomposed ones the same elements as their decompositions.
+
+Step 2: At each position, find the longest sequence of characters with an
+entry in the table. If the entry is a contraction, it can be extended with any
+following non-starter that is not blocked from it (i.e. that has a higher
+combining class than every character skipped so far), which is then removed
+from the string. Characters with no entry are given implicit weights, derived
+from the code point; characters that are unassigned in the UCD tables get the
+unassigned weights even if the DUCET is from a later version.
+
+Step 3: If variable weighting is shifted, variable elements (spaces,
+punctuation, and most symbols) have their primary weight moved to the
+quaternary level, and ignorable elements that follow them are dropped.
+
+Step 4: Build the sort key from the non-zero weights of each level in turn,
+with a zero byte separating the levels. Primary and quaternary weights take
+two bytes; secondary and tertiary weights take one byte each (the secondary
+range is shifted down to fit).
+
+*/
+
+#include "unicorn/collate.hpp"
+#include "unicorn/character.hpp"
+#include "unicorn/normal.hpp"
+#include "unicorn/ucd-tables.hpp"
+#include "unicorn/utf.hpp"
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+namespace Unicorn {
+
+    namespace {
+
+        using namespace UnicornDetail;
+
+        // Collation elements are packed as generated by make-tables:
+        // 16 bits primary weight, 10 bits secondary, 5 bits tertiary, and
+        // a flag for variable elements. Table entries hold the offset of
+        // the first element (shifted left by 5) and the element count.
+
+        using Element = uint32_t;
+
+        constexpr uint32_t primary_weight(Element e) noexcept { return e >> 16; }
+        constexpr uint32_t secondary_weight(Element e) noexcept { return (e >> 6) & 0x3ff; }
+        constexpr uint32_t tertiary_weight(Element e) noexcept { return (e >> 1) & 0x1f; }
+        constexpr bool is_variable(Element e) noexcept { return (e & 1) != 0; }
+        constexpr Element make_element(uint32_t p, uint32_t s, uint32_t t) noexcept { return (p << 16) | (s << 6) | (t << 1); }
+
+        constexpr char32_t removed_char = not_found;
+        constexpr uint32_t max_secondary_offset = 0x1f;
+        constexpr uint32_t shifted_quaternary = 0xffff;
+
+        char32_t single_entry(char32_t c) noexcept {
+            return table_lookup(collation_single_table, c, char32_t(0));
+        }
+
+        char32_t multiple_entry(const std::array<char32_t, 3>& key) noexcept {
+            return table_lookup(collation_multiple_table, key, char32_t(0));
+        }
+
+        bool starts_contraction(char32_t c) noexcept {
+            KeyValue<std::array<char32_t, 3>, char32_t> t;
+            t.key = {{c, 0, 0}};
+            auto it = std::upper_bound(collation_multiple_table.begin(), collation_multiple_table.end(), t);
+            return it != collation_multiple_table.end() && it->key[0] == c;
+        }
+
+        // Table lookups for the Latin range are cached, since they cover
+        // most text in practice
+
+        constexpr char32_t latin_limit = 0x300;
+
+        struct LatinEntry {
+            char32_t entry;
+            bool contraction;
+        };
+
+        const std::array<LatinEntry, latin_limit>& latin_entries() {
+            static const auto table = [] {
+                std::array<LatinEntry, latin_limit> t;
+                for (char32_t c = 0; c < latin_limit; ++c)
+                    t[c] = {single_entry(c), starts_contraction(c)};
+                return t;
+            }();
+            return table;
+        }
+
+        void append_implicit(char32_t c, vector<Element>& elements) {
+            uint32_t a = 0, b = 0;
+            bool assigned = char_general_category(c) != GC::Cn;
+            if (assigned) {
+                for (auto& row: collation_implicit_table) {
+                    if (c >= row[0] && c <= row[1]) {
+                        a = row[2];
+                        b = c - row[3];
+                        break;
+                    }
+                }
+            }
+            if (a == 0) {
+                if (! assigned || ! sparse_set_lookup(unified_ideograph_table, c))
+                    a = 0xfbc0;
+                else if ((c >= 0x4e00 && c <= 0x9fff) || (c >= 0xf900 && c <= 0xfaff))
+                    a = 0xfb40;
+                else
+                    a = 0xfb80;
+                a += c >> 15;
+                b = c & 0x7fff;
+            }
+            elements.push_back(make_element(a, 0x20, 2));
+            elements.push_back(make_element(b | 0x8000, 0, 0));
+        }
+
+        void append_entry(char32_t entry, vector<Element>& elements) {
+            auto first = collation_elements_table.begin() + (entry >> 5);
+            elements.insert(elements.end(), first, first + (entry & 0x1f));
+        }
+
+        void find_elements(u32string& text, vector<Element>& elements) {
+            auto& latin = latin_entries();
+            size_t n = text.size();
+            auto next = [&] (size_t i) {
+                do ++i; while (i < n && text[i] == removed_char);
+                return i;
+            };
+            for (size_t i = 0; i < n; i = next(i)) {
+                char32_t c = text[i];
+                char32_t entry = 0;
+                bool contraction;
+                if (c < latin_limit) {
+                    entry = latin[c].entry;
+                    contraction = latin[c].contraction;
+                } else {
+                    contraction = starts_contraction(c);
+                }
+                if (! contraction) {
+                    if (c >= latin_limit)
+                        entry = single_entry(c);
+                    if (entry)
+                        append_entry(entry, elements);
+                    else
+                        append_implicit(c, elements);
+                    continue;
+                }
+                // Longest contiguous match
+                std::array<char32_t, 3> key = {{c, 0, 0}};
+                size_t len = 1, last = i;
+                size_t j1 = next(i), j2 = j1 < n ? next(j1) : n;
+                if (j2 < n) {
+                    std::array<char32_t, 3> k3 = {{c, text[j1], text[j2]}};
+                    if (auto e = multiple_entry(k3)) {
+                        key = k3;
+                        entry = e;
+                        len = 3;
+                        last = j2;
+                    }
+                }
+                if (len == 1 && j1 < n) {
+                    std::array<char32_t, 3> k2 = {{c, text[j1], 0}};
+                    if (auto e = multiple_entry(k2)) {
+                        key = k2;
+                        entry = e;
+                        len = 2;
+                        last = j1;
+                    }
+                }
+                if (len == 1 && c >= latin_limit)
+                    entry = single_entry(c);
+                // Discontiguous extension by unblocked non-starters
+                int blocking = 0;
+                for (size_t k = next(last); k < n && len < 3; k = next(k)) {
+                    int cc = combining_class(text[k]);
+                    if (cc == 0)
+                        break;
+                    if (cc > blocking) {
+                        auto ext = key;
+                        ext[len] = text[k];
+                        if (auto e = multiple_entry(ext)) {
+                            key = ext;
+                            entry = e;
+                            ++len;
+                            text[k] = removed_char;
+                            continue;
+                        }
+                    }
+                    blocking = std::max(blocking, cc);
+                }
+                if (entry)
+                    append_entry(entry, elements);
+                else
+                    append_implicit(c, elements);
+                i = last;
+            }
+        }
+
+        void append_weight16(u8string& key, uint32_t w) {
+            key += char(w >> 8);
+            key += char(w & 0xff);
+        }
+
+    }
+
+    u8string collation_key(const u8string& str, uint32_t flags) {
+        if (bits_set(flags & (collate_primary | collate_secondary | collate_tertiary | collate_quaternary)) > 1)
+            throw std::invalid_argument("Inconsistent collation flags");
+        int strength = flags & collate_primary ? 1 : flags & collate_secondary ? 2 : flags & collate_quaternary ? 4 : 3;
+        bool shifted = (flags & collate_shifted) || strength == 4;
+        u32string text;
+        if (std::all_of(str.begin(), str.end(), [] (char c) { return uint8_t(c) < 0xcc; }))
+            text = to_utf32(str);
+        else
+            text = to_utf32(normalize(str, NFD));
+        vector<Element> elements;
+        elements.reserve(text.size() + 4);
+        find_elements(text, elements);
+        vector<uint32_t> quaternary;
+        if (shifted) {
+            quaternary.resize(elements.size());
+            bool after_variable = false;
+            for (size_t i = 0; i < elements.size(); ++i) {
+                auto& e = elements[i];
+                if (tertiary_weight(e) == 0) {
+                    // Completely ignorable, or the second half of an
+                    // implicit weight
+                    quaternary[i] = 0;
+                } else if (is_variable(e)) {
+                    quaternary[i] = primary_weight(e);
+                    e = 0;
+                    after_variable = true;
+                } else if (primary_weight(e) == 0 && after_variable) {
+                    quaternary[i] = 0;
+                    e = 0;
+                } else {
+                    quaternary[i] = shifted_quaternary;
+                    if (primary_weight(e) != 0)
+                        after_variable = false;
+                }
+            }
+        }
+        u8string key;
+        key.reserve(elements.size() * (strength + 2) + strength);
+        for (auto e: elements)
+            if (primary_weight(e))
+                append_weight16(key, primary_weight(e));
+        if (strength >= 2) {
+            key += '\0';
+            for (auto e: elements)
+                if (secondary_weight(e))
+                    key += char(secondary_weight(e) - max_secondary_offset);
+        }
+        if (strength >= 3) {
+            key += '\0';
+            for (auto e: elements)
+                if (tertiary_weight(e))
+                    key += char(tertiary_weight(e));
+        }
+        if (strength >= 4) {
+            key += '\0';
+            for (auto q: quaternary)
+                if (q)
+                    append_weight16(key, q);
+        }
+        return key;
+    }
+
+    int collate_3way(const u8string& lhs, const u8string& rhs, uint32_t flags) {
+        int rc = collation_key(lhs, flags).compare(collation_key(rhs, flags));
+        return rc < 0 ? -1 : rc == 0 ? 0 : 1;
+    }
+
+    bool collate_compare(const u8string& lhs, const u8string& rhs, uint32_t flags) {
+        return collate_3way(lhs, rhs, flags) < 0;
+    }
+
+}
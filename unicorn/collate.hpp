@@ -0,0 +1,29 @@
+#pragma once
+
+#include "unicorn/core.hpp"
+#include <string>
+
+namespace Unicorn {
+
+    // Collation flags
+
+    constexpr uint32_t collate_primary     = 1ul << 0;  // Compare base characters only
+    constexpr uint32_t collate_secondary   = 1ul << 1;  // Also compare accents
+    constexpr uint32_t collate_tertiary    = 1ul << 2;  // Also compare case and variant forms (default)
+    constexpr uint32_t collate_quaternary  = 1ul << 3;  // Also compare variable characters (implies collate_shifted)
+    constexpr uint32_t collate_shifted     = 1ul << 4;  // Ignore variable characters at the first three levels
+
+    // Collation functions
+
+    u8string collation_key(const u8string& str, uint32_t flags = 0);
+    int collate_3way(const u8string& lhs, const u8string& rhs, uint32_t flags = 0);
+    bool collate_compare(const u8string& lhs, const u8string& rhs, uint32_t flags = 0);
+
+    struct CollateCompare {
+        uint32_t flags = 0;
+        CollateCompare() = default;
+        explicit CollateCompare(uint32_t f) noexcept: flags(f) {}
+        bool operator()(const u8string& lhs, const u8string& rhs) const { return collate_compare(lhs, rhs, flags); }
+    };
+
+}
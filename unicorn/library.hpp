@@ -1,6 +1,7 @@
 #pragma once
 
 #include "unicorn/character.hpp"
+#include "unicorn/collate.hpp"
 #include "unicorn/core.hpp"
 #include "unicorn/environment.hpp"
 #include "unicorn/file.hpp"
@@ -93,6 +93,86 @@ namespace {
         }
     }
 
+    void check_nfkc_casefold() {
+
+        u8string s;
+
+        TEST_EQUAL(nfkc_casefold(u8""), u8"");
+
+        s = "Previous contents";
+        TRY(nfkc_casefold(u8"Ｈｅｌｌｏ Ⅻ", s));  TEST_EQUAL(s, u8"hello xii");
+        TRY(normalize(u8"A\u030a", s, NFC));   TEST_EQUAL(s, u8"\u00c5");
+        TRY(normalize(s, s, NFD));              TEST_EQUAL(s, u8"A\u030a");
+        TEST_EQUAL(nfkc_casefold(u8"Hello World"), u8"hello world");
+        TEST_EQUAL(nfkc_casefold(u8"\ufb03"), u8"ffi");
+        TEST_EQUAL(nfkc_casefold(u8"Stra\u00dfe"), u8"strasse");
+        TEST_EQUAL(nfkc_casefold(u8"\u1e9e"), u8"ss");
+        TEST_EQUAL(nfkc_casefold(u8"\u212b"), u8"\u00e5");
+        TEST_EQUAL(nfkc_casefold(u8"A\u030a"), u8"\u00e5");
+        TEST_EQUAL(nfkc_casefold(u8"\u01c5"), u8"d\u017e");
+        TEST_EQUAL(nfkc_casefold(u8"\uff21\uff22\uff23"), u8"abc");
+        TEST_EQUAL(nfkc_casefold(u8"\u03a3\u0391\u03a3"), u8"\u03c3\u03b1\u03c3");
+        TEST_EQUAL(nfkc_casefold(u8"x\u00b2"), u8"x2");
+        TEST_EQUAL(nfkc_casefold(u8"soft\u00adhyphen"), u8"softhyphen");
+        TEST_EQUAL(nfkc_casefold(u8"\ud55c\uad6d\uc5b4"), u8"\ud55c\uad6d\uc5b4");
+        TEST_EQUAL(nfkc_casefold(u8"\u1112\u1161\u11ab"), u8"\ud55c");
+
+        s = u8"Stra\u00dfe";  TRY(nfkc_casefold_in(s));  TEST_EQUAL(s, u8"strasse");
+
+        TEST(nfkc_casefold_equal(u8"", u8""));
+        TEST(nfkc_casefold_equal(u8"hello", u8"HELLO"));
+        TEST(nfkc_casefold_equal(u8"Stra\u00dfe", u8"STRASSE"));
+        TEST(nfkc_casefold_equal(u8"\ufb03", u8"FFI"));
+        TEST(nfkc_casefold_equal(u8"\u00e9", u8"E\u0301"));
+        TEST(nfkc_casefold_equal(u8"a\u0323\u0307", u8"a\u0307\u0323"));
+        TEST(nfkc_casefold_equal(u8"soft\u00adhyphen", u8"SOFTHYPHEN"));
+        TEST(nfkc_casefold_equal(u8"\ud55c", u8"\u1112\u1161\u11ab"));
+        TEST(! nfkc_casefold_equal(u8"", u8"a"));
+        TEST(! nfkc_casefold_equal(u8"a", u8""));
+        TEST(! nfkc_casefold_equal(u8"abc", u8"abd"));
+        TEST(! nfkc_casefold_equal(u8"e", u8"\u00e9"));
+        TEST(! nfkc_casefold_equal(u8"\u00e9", u8"e"));
+
+        for (auto&& row: normalization_test_table) {
+            vector<u8string> hexcodes;
+            u8string text;
+            str_split(u8string(row[0]), overwrite(hexcodes));
+            for (auto&& hc: hexcodes)
+                str_append_char(text, char32_t(strtoul(hc.data(), nullptr, 16)));
+            u8string folded;
+            TRY(folded = nfkc_casefold(text));
+            TEST_EQUAL(nfkc_casefold(folded), folded);
+            TEST(nfkc_casefold_equal(text, folded));
+        }
+
+    }
+
+    void do_parallel_tests() {
+        u8string text;
+        for (int i = 0; i < 2; ++i) {
+            for (auto&& row: normalization_test_table) {
+                vector<u8string> hexcodes;
+                for (auto&& field: row) {
+                    str_split(u8string(field), overwrite(hexcodes));
+                    for (auto&& hc: hexcodes)
+                        str_append_char(text, char32_t(strtoul(hc.data(), nullptr, 16)));
+                }
+                text += ' ';
+            }
+        }
+        for (auto form: {NFC, NFD, NFKC, NFKD}) {
+            u8string expect, result;
+            TRY(expect = normalize(text, form));
+            TRY(result = normalize_parallel(text, form, 4));
+            TEST(result == expect);
+            TRY(result = normalize_parallel(text, form, 1));
+            TEST(result == expect);
+            result = text;
+            TRY(normalize_parallel_in(result, form));
+            TEST(result == expect);
+        }
+    }
+
 }
 
 TEST_MODULE(unicorn, normal) {
@@ -127,4 +207,7 @@ TEST_MODULE(unicorn, normal) {
 
     #endif
 
+    do_parallel_tests();
+    check_nfkc_casefold();
+
 }
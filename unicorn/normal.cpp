@@ -26,8 +26,10 @@ compositions are possible.
 
 #include "unicorn/normal.hpp"
 #include "unicorn/character.hpp"
+#include "unicorn/ucd-tables.hpp"
 #include "unicorn/utf.hpp"
 #include <algorithm>
+#include <vector>
 
 using namespace std::literals;
 
@@ -35,13 +37,13 @@ namespace Unicorn {
 
     namespace {
 
-        void apply_decomposition(const u8string& src, u32string& dst, bool k) {
+        void apply_decomposition(const Irange<Utf8Iterator>& src, u32string& dst, bool k) {
             auto decompose = k ? compatibility_decomposition : canonical_decomposition;
             size_t max_decompose = k ? max_compatibility_decomposition : max_canonical_decomposition;
             char32_t buf[max_decompose];
-            dst.reserve(src.size());
+            dst.reserve(src.end().offset() - src.begin().offset());
             size_t pos = 0;
-            for (char32_t c: utf_range(src)) {
+            for (char32_t c: src) {
                 dst.resize(pos + max_decompose);
                 size_t len = decompose(c, &dst[pos]);
                 if (len == 0) {
@@ -60,8 +62,8 @@ namespace Unicorn {
             }
         }
 
-        void apply_ordering(u32string& str) {
-            auto i = str.begin(), j = i, e = str.end();
+        void apply_ordering(u32string::iterator begin, u32string::iterator end) {
+            auto i = begin, j = i, e = end;
             while (j != e) {
                 i = std::find_if(j, e, combining_class);
                 if (i == e)
@@ -72,6 +74,10 @@ namespace Unicorn {
             }
         }
 
+        void apply_ordering(u32string& str) {
+            apply_ordering(str.begin(), str.end());
+        }
+
         void apply_composition(u32string& str) {
             if (str.size() < 2)
                 return;
@@ -102,26 +108,300 @@ namespace Unicorn {
             }
         }
 
+        void normalize_helper(const Irange<Utf8Iterator>& src, u8string& dst, NormalizationForm form) {
+            u32string utf32;
+            apply_decomposition(src, utf32, form == NFKC || form == NFKD);
+            apply_ordering(utf32);
+            if (form == NFC || form == NFKC)
+                apply_composition(utf32);
+            dst.clear();
+            UnicornDetail::Recode<char32_t, char>()(utf32.data(), utf32.size(), dst, 0);
+        }
+
+        // A character is a safe place to split the text if it is a starter,
+        // has no decomposition, and can never be the second character of a
+        // canonical composition pair (this is a stricter condition than
+        // NFC_QC=Yes). Nothing on either side of it can be affected by
+        // anything on the other side.
+
+        class CompositionTrailers {
+        public:
+            CompositionTrailers() {
+                for (auto& kv: UnicornDetail::composition_table)
+                    chars.push_back(kv.key[1]);
+                std::sort(chars.begin(), chars.end());
+                chars.erase(std::unique(chars.begin(), chars.end()), chars.end());
+            }
+            bool contains(char32_t c) const noexcept { return std::binary_search(chars.begin(), chars.end(), c); }
+        private:
+            vector<char32_t> chars;
+        };
+
+        const CompositionTrailers& composition_trailers() {
+            static const CompositionTrailers ct;
+            return ct;
+        }
+
+        bool is_normalization_boundary(char32_t c, bool k) {
+            if (c <= last_ascii_char)
+                return true;
+            if (combining_class(c) != 0)
+                return false;
+            char32_t buf[max_compatibility_decomposition];
+            if ((k ? compatibility_decomposition : canonical_decomposition)(c, buf) != 0)
+                return false;
+            auto hst = hangul_syllable_type(c);
+            if (hst == Hangul_Syllable_Type::V || hst == Hangul_Syllable_Type::T)
+                return false;
+            return ! composition_trailers().contains(c);
+        }
+
+        void normalize_parallel_helper(const u8string& src, u8string& dst, NormalizationForm form, size_t threads) {
+            bool k = form == NFKC || form == NFKD;
+            auto e = utf_end(src);
+            auto cuts = UnicornDetail::find_parallel_cuts(src, threads, [&] (size_t pos) {
+                while (pos < src.size() && is_nonstart_unit(src[pos]))
+                    ++pos;
+                for (auto i = utf_iterator(src, pos); i != e; ++i)
+                    if (is_normalization_boundary(*i, k))
+                        return i.offset();
+                return npos;
+            });
+            if (cuts.size() == 2) {
+                normalize_helper(utf_range(src), dst, form);
+                return;
+            }
+            vector<u8string> results(cuts.size() - 1);
+            auto out = results.data();
+            UnicornDetail::for_each_parallel_chunk(src, cuts, [=] (size_t part, const Irange<Utf8Iterator>& range) {
+                normalize_helper(range, out[part], form);
+            });
+            size_t total = 0;
+            for (auto& r: results)
+                total += r.size();
+            dst.clear();
+            dst.reserve(total);
+            for (auto& r: results)
+                dst += r;
+        }
+
+        // NFKC_Casefold mapping table
+
+        // Each entry maps a character to the canonical decomposition of its
+        // NFKC_Casefold value. Characters not in the table map to themselves
+        // (apart from Hangul syllables, whose decomposition is algorithmic).
+        // The table is derived from the case folding, decomposition, and
+        // default ignorable tables, following the definition of the UCD
+        // NFKC_CF property: NFKC(toCasefold(NFKC(X))), with default ignorable
+        // characters removed, repeated until it reaches a fixed point.
+
+        class NfkcCasefoldTable {
+        public:
+            NfkcCasefoldTable();
+            void append(char32_t c, u32string& dst) const;
+        private:
+            struct entry {
+                char32_t key;
+                uint32_t offset;
+                uint32_t length;
+                bool operator<(const entry& rhs) const noexcept { return key < rhs.key; }
+            };
+            vector<entry> table;
+            u32string pool;
+            static u32string map_char(char32_t c);
+        };
+
+        NfkcCasefoldTable::NfkcCasefoldTable() {
+            using namespace UnicornDetail;
+            vector<char32_t> keys;
+            for (auto& kv: simple_lowercase_table)
+                keys.push_back(kv.key);
+            for (auto& kv: simple_casefold_table)
+                keys.push_back(kv.key);
+            for (auto& kv: full_casefold_table)
+                keys.push_back(kv.key);
+            for (auto& kv: canonical_table)
+                keys.push_back(kv.key);
+            for (auto& kv: short_compatibility_table)
+                keys.push_back(kv.key);
+            for (auto& kv: long_compatibility_table)
+                keys.push_back(kv.key);
+            for (auto& kv: default_ignorable_table)
+                for (char32_t c = kv.key; c <= kv.value; ++c)
+                    keys.push_back(c);
+            std::sort(keys.begin(), keys.end());
+            keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+            for (auto c: keys) {
+                auto mapped = map_char(c);
+                if (mapped.size() != 1 || mapped[0] != c) {
+                    table.push_back({c, uint32_t(pool.size()), uint32_t(mapped.size())});
+                    pool += mapped;
+                }
+            }
+        }
+
+        void NfkcCasefoldTable::append(char32_t c, u32string& dst) const {
+            if (c <= last_ascii_char) {
+                dst += c >= U'A' && c <= U'Z' ? c + 0x20 : c;
+                return;
+            }
+            entry key = {c, 0, 0};
+            auto it = std::lower_bound(table.begin(), table.end(), key);
+            if (it != table.end() && it->key == c) {
+                dst.append(pool, it->offset, it->length);
+                return;
+            }
+            // Only Hangul syllables can reach here with a decomposition
+            char32_t buf[max_canonical_decomposition];
+            if (canonical_decomposition(c, buf) == 0) {
+                dst += c;
+            } else {
+                append(buf[0], dst);
+                dst += buf[1];
+            }
+        }
+
+        u32string NfkcCasefoldTable::map_char(char32_t c) {
+            char32_t buf[max_case_decomposition];
+            u32string x(1, c), y;
+            u8string s;
+            for (;;) {
+                normalize_helper(utf_range(to_utf8(x)), s, NFKC);
+                y.clear();
+                for (char32_t u: utf_range(s)) {
+                    auto n = char_to_full_casefold(u, buf);
+                    for (size_t i = 0; i < n; ++i)
+                        if (! char_is_default_ignorable(buf[i]))
+                            y += buf[i];
+                }
+                normalize_helper(utf_range(to_utf8(y)), s, NFKC);
+                y = to_utf32(s);
+                if (y == x)
+                    break;
+                x.swap(y);
+            }
+            normalize_helper(utf_range(to_utf8(x)), s, NFD);
+            return to_utf32(s);
+        }
+
+        const NfkcCasefoldTable& nfkc_casefold_table() {
+            static const NfkcCasefoldTable table;
+            return table;
+        }
+
+        void nfkc_casefold_helper(const u8string& src, u8string& dst) {
+            auto& table = nfkc_casefold_table();
+            u32string utf32;
+            utf32.reserve(src.size());
+            for (char32_t c: utf_range(src))
+                table.append(c, utf32);
+            apply_ordering(utf32);
+            apply_composition(utf32);
+            dst.clear();
+            UnicornDetail::Recode<char32_t, char>()(utf32.data(), utf32.size(), dst, 0);
+        }
+
+        // Reads the canonically ordered NFD form of a string's NFKC_Casefold
+        // value, one character at a time. Only the characters back to the
+        // most recent starter need to be held in the buffer.
+
+        class NfkcCasefoldReader {
+        public:
+            explicit NfkcCasefoldReader(const u8string& src): table(nfkc_casefold_table()), in(utf_begin(src)), end(utf_end(src)) {}
+            bool next(char32_t& c);
+        private:
+            const NfkcCasefoldTable& table;
+            Utf8Iterator in, end;
+            u32string buf;
+            size_t pos = 0;
+            size_t ready = 0;
+        };
+
+        bool NfkcCasefoldReader::next(char32_t& c) {
+            if (pos == ready) {
+                buf.erase(0, pos);
+                pos = ready = 0;
+                size_t last_starter = 0, scanned = 1;
+                while (in != end && last_starter == 0) {
+                    table.append(*in, buf);
+                    ++in;
+                    for (; scanned < buf.size(); ++scanned)
+                        if (combining_class(buf[scanned]) == 0)
+                            last_starter = scanned;
+                }
+                ready = in == end ? buf.size() : last_starter;
+                apply_ordering(buf.begin(), buf.begin() + ready);
+                if (ready == 0)
+                    return false;
+            }
+            c = buf[pos++];
+            return true;
+        }
+
     }
 
     u8string normalize(const u8string& src, NormalizationForm form) {
-        using namespace UnicornDetail;
-        u32string utf32;
-        apply_decomposition(src, utf32, form == NFKC || form == NFKD);
-        apply_ordering(utf32);
-        if (form == NFC || form == NFKC)
-            apply_composition(utf32);
-        return to_utf8(utf32);
+        u8string dst;
+        normalize_helper(utf_range(src), dst, form);
+        return dst;
+    }
+
+    void normalize(const u8string& src, u8string& dst, NormalizationForm form) {
+        if (&src == &dst)
+            normalize_in(dst, form);
+        else
+            normalize_helper(utf_range(src), dst, form);
     }
 
     void normalize_in(u8string& src, NormalizationForm form) {
-        using namespace UnicornDetail;
-        u32string utf32;
-        apply_decomposition(src, utf32, form == NFKC || form == NFKD);
-        apply_ordering(utf32);
-        if (form == NFC || form == NFKC)
-            apply_composition(utf32);
-        recode(utf32, src);
+        u8string dst;
+        normalize_helper(utf_range(src), dst, form);
+        src.swap(dst);
+    }
+
+    u8string normalize_parallel(const u8string& src, NormalizationForm form, size_t threads) {
+        u8string dst;
+        normalize_parallel_helper(src, dst, form, threads);
+        return dst;
+    }
+
+    void normalize_parallel_in(u8string& src, NormalizationForm form, size_t threads) {
+        u8string dst;
+        normalize_parallel_helper(src, dst, form, threads);
+        src.swap(dst);
+    }
+
+    u8string nfkc_casefold(const u8string& src) {
+        u8string dst;
+        nfkc_casefold_helper(src, dst);
+        return dst;
+    }
+
+    void nfkc_casefold(const u8string& src, u8string& dst) {
+        if (&src == &dst)
+            nfkc_casefold_in(dst);
+        else
+            nfkc_casefold_helper(src, dst);
+    }
+
+    void nfkc_casefold_in(u8string& src) {
+        u8string dst;
+        nfkc_casefold_helper(src, dst);
+        src.swap(dst);
+    }
+
+    bool nfkc_casefold_equal(const u8string& lhs, const u8string& rhs) {
+        if (lhs == rhs)
+            return true;
+        NfkcCasefoldReader r1(lhs), r2(rhs);
+        char32_t c1 = 0, c2 = 0;
+        for (;;) {
+            bool more1 = r1.next(c1), more2 = r2.next(c2);
+            if (! more1 || ! more2)
+                return more1 == more2;
+            if (c1 != c2)
+                return false;
+        }
     }
 
 }
@@ -8,6 +8,13 @@ namespace Unicorn {
     PRI_ENUM(NormalizationForm, int, 1, NFC, NFD, NFKC, NFKD)
 
     u8string normalize(const u8string& src, NormalizationForm form);
+    void normalize(const u8string& src, u8string& dst, NormalizationForm form);
     void normalize_in(u8string& src, NormalizationForm form);
+    u8string normalize_parallel(const u8string& src, NormalizationForm form, size_t threads = 0);
+    void normalize_parallel_in(u8string& src, NormalizationForm form, size_t threads = 0);
+    u8string nfkc_casefold(const u8string& src);
+    void nfkc_casefold(const u8string& src, u8string& dst);
+    void nfkc_casefold_in(u8string& src);
+    bool nfkc_casefold_equal(const u8string& lhs, const u8string& rhs);
 
 }
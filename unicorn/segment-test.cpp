@@ -5,8 +5,10 @@
 #include "unicorn/ucd-tables.hpp"
 #include "unicorn/utf.hpp"
 #include "prion/unit-test.hpp"
+#include <algorithm>
 #include <cstdlib>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 using namespace std::literals;
@@ -49,6 +51,15 @@ namespace {
         }
     };
 
+    struct SplitLineBreaks {
+        template <typename String>
+        void operator()(const String& src, vector<String>& dst) const {
+            auto range = line_break_range(src);
+            for (auto& segment: range)
+                dst.push_back(u_str(segment));
+        }
+    };
+
     template <typename Split>
     void segmentation_test(const u8string& name, Irange<char const* const*> table) {
         size_t lnum = 0;
@@ -95,6 +106,60 @@ namespace {
         }
     }
 
+    struct GraphemeBoundaries {
+        template <typename String> static auto range(const String& s) { return grapheme_range(s); }
+        template <typename String> static size_t prev(const String& s, size_t ofs) { return prev_grapheme_boundary(s, ofs); }
+        template <typename String> static size_t next(const String& s, size_t ofs) { return next_grapheme_boundary(s, ofs); }
+    };
+
+    struct WordBoundaries {
+        template <typename String> static auto range(const String& s) { return word_range(s); }
+        template <typename String> static size_t prev(const String& s, size_t ofs) { return prev_word_boundary(s, ofs); }
+        template <typename String> static size_t next(const String& s, size_t ofs) { return next_word_boundary(s, ofs); }
+    };
+
+    struct SentenceBoundaries {
+        template <typename String> static auto range(const String& s) { return sentence_range(s); }
+        template <typename String> static size_t prev(const String& s, size_t ofs) { return prev_sentence_boundary(s, ofs); }
+        template <typename String> static size_t next(const String& s, size_t ofs) { return next_sentence_boundary(s, ofs); }
+    };
+
+    template <typename Bounds>
+    void boundary_test(const u8string& name, Irange<char const* const*> table) {
+        size_t lnum = 0;
+        for (u8string line: table) {
+            ++lnum;
+            size_t prev_failures = Test::test_failures();
+            auto source32 = decode_hex(line);
+            if (! valid_string(source32))
+                continue;
+            auto source8 = to_utf8(source32);
+            vector<size_t> marks = {0};
+            vector<u8string> forward, reverse;
+            auto range = Bounds::range(source8);
+            for (auto& segment: range) {
+                marks.push_back(segment.second.offset());
+                forward.push_back(u_str(segment));
+            }
+            for (auto i = range.end(); i != range.begin();) {
+                --i;
+                reverse.push_back(u_str(*i));
+            }
+            std::reverse(reverse.begin(), reverse.end());
+            TEST_EQUAL_RANGE(reverse, forward);
+            for (size_t ofs = 0; ofs <= source8.size(); ++ofs) {
+                auto it = std::lower_bound(marks.begin(), marks.end(), ofs);
+                size_t next = *it, prev = next == ofs ? next : it[-1];
+                TEST_EQUAL(Bounds::prev(source8, ofs), prev);
+                TEST_EQUAL(Bounds::next(source8, ofs), next);
+            }
+            if (Test::test_failures() > prev_failures) {
+                FAIL(name + " " + dec(lnum) + ": " + line);
+                break;
+            }
+        }
+    }
+
     #define WORD_SEGMENTATION_TEST(source, all, graphic, alpha) \
         do { \
             auto s = cstr(source); \
@@ -186,6 +251,50 @@ namespace {
 
         );
 
+        // Reverse iteration and boundary queries
+
+        u8string text = "Hello world. Goodbye!";
+        vector<u8string> words;
+        auto wrange = word_range(text, alpha_words);
+        for (auto i = wrange.end(); i != wrange.begin();) {
+            --i;
+            words.push_back(u_str(*i));
+        }
+        TEST_EQUAL(str_join(words, "/"), "Goodbye/world/Hello");
+        TEST_EQUAL(prev_word_boundary(text, 0), 0);
+        TEST_EQUAL(prev_word_boundary(text, 3), 0);
+        TEST_EQUAL(prev_word_boundary(text, 5), 5);
+        TEST_EQUAL(next_word_boundary(text, 3), 5);
+        TEST_EQUAL(next_word_boundary(text, 7), 11);
+        TEST_EQUAL(prev_sentence_boundary(text, 16), 13);
+        TEST_EQUAL(next_sentence_boundary(text, 1), 13);
+        TEST_EQUAL(next_sentence_boundary(text, 13), 13);
+        TEST_EQUAL(next_sentence_boundary(text, 100), text.size());
+        text = u8"e\u0301\u0302x";
+        TEST_EQUAL(prev_grapheme_boundary(text, 2), 0);
+        TEST_EQUAL(prev_grapheme_boundary(text, 5), 5);
+        TEST_EQUAL(next_grapheme_boundary(text, 1), 5);
+        TEST_EQUAL(next_grapheme_boundary(text, 2), 5);
+
+        // Segments longer than the inline lookahead buffer
+
+        u8string s, word(100, 'x'), cluster = "a" + str_repeat(u8string(u8"\u0301"), 100);
+        vector<u8string> v;
+
+        s = word + " " + word + " " + word;
+        TRY(SplitWords()(s, v));
+        TEST_EQUAL(v.size(), 5);
+        TEST_EQUAL(v[0], word);
+        TEST_EQUAL(v[2], word);
+        TEST_EQUAL(v[4], word);
+
+        s = cluster + cluster;
+        v.clear();
+        TRY(SplitGraphemes()(s, v));
+        TEST_EQUAL(v.size(), 2);
+        TEST_EQUAL(v[0], cluster);
+        TEST_EQUAL(v[1], cluster);
+
     }
 
     void check_line_segmentation() {
@@ -238,6 +347,78 @@ namespace {
 
     }
 
+    void check_parallel_words() {
+
+        u8string text;
+        vector<Irange<Utf8Iterator>> list;
+        std::unordered_map<u8string, size_t> freq;
+
+        TRY(list = word_list_parallel(text));
+        TEST(list.empty());
+        TRY(freq = word_frequency_parallel(text));
+        TEST(freq.empty());
+        TEST_THROW(word_list_parallel(text, graphic_words | alpha_words), std::invalid_argument);
+
+        const u8string sample =
+            u8"\"Don't panic!\" - Douglas Adams, 3.14159 and 1,234.5\r\n"
+            u8"Caf\u00e9 na\u0131\u0308ve r\u00e9sum\u00e9 e\u0301\u0302 \u65e5\u672c\u8a9e\u30c6\u30ad\u30b9\u30c8\n"
+            u8"\u05d0\u05d1\"\u05d2 foo_bar can't\u00a0stop \U0001f1e6\U0001f1e8\u2029";
+        while (text.size() < 300000)
+            text += sample;
+
+        for (uint32_t flags: {0u, graphic_words, alpha_words}) {
+            vector<u8string> serial, parallel;
+            std::unordered_map<u8string, size_t> counts;
+            for (auto& word: word_range(text, flags)) {
+                serial.push_back(u_str(word));
+                ++counts[serial.back()];
+            }
+            TRY(list = word_list_parallel(text, flags, 4));
+            for (auto& word: list)
+                parallel.push_back(u_str(word));
+            TEST_EQUAL(parallel.size(), serial.size());
+            TEST(parallel == serial);
+            TRY(freq = word_frequency_parallel(text, flags, 4));
+            TEST_EQUAL(freq.size(), counts.size());
+            TEST(freq == counts);
+        }
+
+    }
+
+    u8string line_break_test(const u8string& s) {
+        u8string result;
+        for (auto& subrange: line_break_range(s))
+            result += "[" + u_str(subrange) + "]";
+        return result;
+    }
+
+    void check_line_break_segmentation() {
+
+        TEST_EQUAL(line_break_test(""), "");
+        TEST_EQUAL(line_break_test("Hello"), "[Hello]");
+        TEST_EQUAL(line_break_test("Hello world"), "[Hello ][world]");
+        TEST_EQUAL(line_break_test("  Hello  world  "), "[  ][Hello  ][world  ]");
+        TEST_EQUAL(line_break_test("Hello\nworld\n"), "[Hello\n][world\n]");
+        TEST_EQUAL(line_break_test("Hello\r\nworld"), "[Hello\r\n][world]");
+        TEST_EQUAL(line_break_test("Hello\n\nworld"), "[Hello\n][\n][world]");
+        TEST_EQUAL(line_break_test("(Hello), world!"), "[(Hello), ][world!]");
+        TEST_EQUAL(line_break_test("\"Quoted\" text"), "[\"Quoted\" ][text]");
+        TEST_EQUAL(line_break_test("3.14 $100 100%"), "[3.14 ][$100 ][100%]");
+        TEST_EQUAL(line_break_test("well-known"), "[well-][known]");
+        TEST_EQUAL(line_break_test(u8"\u05d0-\u05d1"), u8"[\u05d0-\u05d1]");
+        TEST_EQUAL(line_break_test(u8"\u05d0-\ufffc"), u8"[\u05d0-][\ufffc]");
+        TEST_EQUAL(line_break_test(u8"a-\ufffc"), u8"[a-][\ufffc]");
+        TEST_EQUAL(line_break_test("http://example.com/path"), "[http://][example.com/][path]");
+        TEST_EQUAL(line_break_test(u8"100\u00a0km"), u8"[100\u00a0km]");
+        TEST_EQUAL(line_break_test(u8"ab\u200bcd"), u8"[ab\u200b][cd]");
+        TEST_EQUAL(line_break_test(u8"ab\u2060cd"), u8"[ab\u2060cd]");
+        TEST_EQUAL(line_break_test(u8"a\u0301 b\u0301"), u8"[a\u0301 ][b\u0301]");
+        TEST_EQUAL(line_break_test(u8"\u65e5\u672c\u8a9e"), u8"[\u65e5][\u672c][\u8a9e]");
+        TEST_EQUAL(line_break_test(u8"\u65e5\u672c\u3002\u30c6\u30b9\u30c8"), u8"[\u65e5][\u672c\u3002][\u30c6][\u30b9][\u30c8]");
+        TEST_EQUAL(line_break_test(u8"\u30c1\u30e3\u30c3\u30c8"), u8"[\u30c1\u30e3\u30c3][\u30c8]");
+
+    }
+
     void check_paragraph_segmentation() {
 
         BLOCK_SEGMENTATION_TEST(paragraph_range, 0, "", "", "");
@@ -281,8 +462,15 @@ TEST_MODULE(unicorn, segment) {
     segmentation_test<SplitGraphemes>("Grapheme break test", UnicornDetail::grapheme_break_test_table);
     segmentation_test<SplitWords>("Word break test", UnicornDetail::word_break_test_table);
     segmentation_test<SplitSentences>("Sentence break test", UnicornDetail::sentence_break_test_table);
+    segmentation_test<SplitLineBreaks>("Line break test", UnicornDetail::line_break_test_table);
+
+    boundary_test<GraphemeBoundaries>("Grapheme boundary test", UnicornDetail::grapheme_break_test_table);
+    boundary_test<WordBoundaries>("Word boundary test", UnicornDetail::word_break_test_table);
+    boundary_test<SentenceBoundaries>("Sentence boundary test", UnicornDetail::sentence_break_test_table);
 
     check_word_segmentation();
+    check_parallel_words();
+    check_line_break_segmentation();
     check_line_segmentation();
     check_paragraph_segmentation();
 
@@ -6,8 +6,35 @@ namespace Unicorn {
 
     namespace {
 
+        using WordSpans = vector<Irange<Utf8Iterator>>;
+        using WordFrequency = std::unordered_map<u8string, size_t>;
+
+        void check_word_flags(uint32_t flags) {
+            if (bits_set(flags & (unicode_words | graphic_words | alpha_words)) > 1)
+                throw std::invalid_argument("Inconsistent word breaking flags");
+        }
+
+        // Divide the text into chunks that can be segmented independently,
+        // cutting only where a word boundary is certain regardless of
+        // context (see is_restart_point()).
+
+        vector<size_t> find_word_cuts(const u8string& src, size_t threads) {
+            auto e = utf_end(src);
+            return UnicornDetail::find_parallel_cuts(src, threads, [&] (size_t pos) {
+                auto i = utf_iterator(src, UnicornDetail::align_utf_offset(src, pos));
+                auto prev = word_break(*std::prev(i));
+                for (; i != e; ++i) {
+                    auto next = word_break(*i);
+                    if (UnicornDetail::is_restart_point(prev, next))
+                        return i.offset();
+                    prev = next;
+                }
+                return npos;
+            });
+        }
+
         template <typename P>
-        inline P prop(const std::deque<P>& buf, ptrdiff_t i) {
+        inline P prop(const UnicornDetail::SegmentBuffer<P>& buf, ptrdiff_t i) {
             if (i < 0)
                 return P::SOT;
             else if (size_t(i) >= buf.size())
@@ -23,56 +50,94 @@ namespace Unicorn {
         // Unicode Standard Annex #29: Unicode Text Segmentation
         // http://www.unicode.org/reports/tr29
 
-        size_t find_grapheme_break(const std::deque<Grapheme_Cluster_Break>& buf, bool /*eof*/) {
-            using P = Grapheme_Cluster_Break;
-            if (buf.empty())
-                return 0;
-            ptrdiff_t size = buf.size();
-            for (ptrdiff_t i = 1; i < size; ++i) {
+        namespace {
+
+            // The grapheme cluster rules in this version of UAX29 only ever
+            // look at the pair of characters on either side of a potential
+            // break, so they can be compiled into a table indexed by the
+            // property values of the two characters. The table is built at
+            // compile time.
+
+            constexpr bool grapheme_pair_is_break(Grapheme_Cluster_Break prev, Grapheme_Cluster_Break next) noexcept {
+                using P = Grapheme_Cluster_Break;
                 // Break at the start and end of text.
                 // GB1. sot ÷
                 // GB2. ÷ eot
+                if (prev == P::SOT || next == P::EOT)
+                    return true;
                 // Do not break between a CR and LF. Otherwise, break before and after controls.
                 // GB3. CR × LF
                 // GB4. (Control | CR | LF) ÷
                 // GB5. ÷ (Control | CR | LF)
-                P prev(prop(buf, i - 1));
-                P next(prop(buf, i));
                 if (prev == P::CR && next == P::LF)
-                    continue;
+                    return false;
                 if (prev == P::Control || prev == P::CR || prev == P::LF
                         || next == P::Control || next == P::CR || next == P::LF)
-                    return i;
+                    return true;
                 // Do not break Hangul syllable sequences.
                 // GB6. L × (L | V | LV | LVT)
                 if (prev == P::L
                         && (next == P::L || next == P::V || next == P::LV || next == P::LVT))
-                    continue;
+                    return false;
                 // GB7. (LV | V) × (V | T)
                 if ((prev == P::LV || prev == P::V) && (next == P::V || next == P::T))
-                    continue;
+                    return false;
                 // GB8. (LVT | T) × T
                 if ((prev == P::LVT || prev == P::T) && next == P::T)
-                    continue;
+                    return false;
                 // Do not break between regional indicator symbols.
                 // GB8a. Regional_Indicator × Regional_Indicator
                 if (prev == P::Regional_Indicator && next == P::Regional_Indicator)
-                    continue;
+                    return false;
                 // Do not break before extending characters.
                 // GB9. × Extend
                 // Do not break before SpacingMarks, or after Prepend characters.
                 // GB9a. × SpacingMark
                 // GB9b. Prepend ×
                 if (prev == P::Prepend || next == P::Extend || next == P::SpacingMark)
-                    continue;
+                    return false;
                 // Otherwise, break everywhere.
                 // GB10. Any ÷ Any
-                return i;
+                return true;
+            }
+
+            class GraphemeBreakTable {
+            public:
+                constexpr GraphemeBreakTable() noexcept {
+                    for (int i = 0; i < n_props; ++i)
+                        for (int j = 0; j < n_props; ++j)
+                            table[i][j] = grapheme_pair_is_break(Grapheme_Cluster_Break(i), Grapheme_Cluster_Break(j));
+                }
+                constexpr bool operator()(Grapheme_Cluster_Break prev, Grapheme_Cluster_Break next) const noexcept
+                    { return table[int(prev)][int(next)]; }
+            private:
+                static constexpr int n_props = int(Grapheme_Cluster_Break::V) + 1;
+                bool table[n_props][n_props] = {};
+            };
+
+            constexpr GraphemeBreakTable grapheme_break_table;
+
+        }
+
+        size_t find_grapheme_break(const SegmentBuffer<Grapheme_Cluster_Break>& buf, bool /*eof*/) {
+            size_t size = buf.size();
+            if (size == 0)
+                return 0;
+            auto prev = buf[0];
+            for (size_t i = 1; i < size; ++i) {
+                auto next = buf[i];
+                if (grapheme_break_table(prev, next))
+                    return i;
+                prev = next;
             }
             return 0;
         }
 
-        size_t find_word_break(const std::deque<Word_Break>& buf, bool eof) {
+        bool is_restart_point(Grapheme_Cluster_Break prev, Grapheme_Cluster_Break next) noexcept {
+            return grapheme_break_table(prev, next);
+        }
+
+        size_t find_word_break(const SegmentBuffer<Word_Break>& buf, bool eof) {
             using P = Word_Break;
             if (buf.empty())
                 return 0;
@@ -189,7 +254,19 @@ namespace Unicorn {
             return 0;
         }
 
-        size_t find_sentence_break(const std::deque<Sentence_Break>& buf, bool eof) {
+        // No rule can join anything to an Other character, and nothing can
+        // be joined to a newline except CR+LF; none of the rules look back
+        // past either of these.
+
+        bool is_restart_point(Word_Break prev, Word_Break next) noexcept {
+            using P = Word_Break;
+            if (prev == P::CR)
+                return next != P::LF;
+            return prev == P::LF || prev == P::Newline
+                || next == P::CR || next == P::LF || next == P::Newline || next == P::Other;
+        }
+
+        size_t find_sentence_break(const SegmentBuffer<Sentence_Break>& buf, bool eof) {
             using P = Sentence_Break;
             if (buf.empty())
                 return 0;
@@ -288,6 +365,257 @@ namespace Unicorn {
             return 0;
         }
 
+        // A paragraph break always ends a sentence (SB4).
+
+        bool is_restart_point(Sentence_Break prev, Sentence_Break next) noexcept {
+            using P = Sentence_Break;
+            return prev == P::Sep || prev == P::LF || (prev == P::CR && next != P::LF);
+        }
+
+        // Unicode Standard Annex #14: Unicode Line Breaking Algorithm
+        // http://www.unicode.org/reports/tr14
+
+        namespace {
+
+            // Rules LB7-LB31 only need the class of the last non-space
+            // character before a candidate break, whether any spaces
+            // intervened, and the class of the character after it. The hard
+            // breaks, spaces, and combining marks (LB4-LB10) are handled in
+            // find_line_break(), and LB21a needs one extra character of
+            // context, so everything else compiles into a pair table.
+
+            constexpr bool line_pair_is_break(Line_Break b, Line_Break a, bool sp) noexcept {
+                using P = Line_Break;
+                // LB7. × ZW
+                if (a == P::ZW)
+                    return false;
+                // LB8. ZW SP* ÷
+                if (b == P::ZW)
+                    return true;
+                // LB11. × WJ, WJ ×
+                if (a == P::WJ || (b == P::WJ && ! sp))
+                    return false;
+                // LB12. GL ×
+                if (b == P::GL && ! sp)
+                    return false;
+                // LB12a. [^SP BA HY] × GL
+                if (a == P::GL && ! sp && b != P::BA && b != P::HY)
+                    return false;
+                // LB13. × CL, × CP, × EX, × IS, × SY
+                if (a == P::CL || a == P::CP || a == P::EX || a == P::IS || a == P::SY)
+                    return false;
+                // LB14. OP SP* ×
+                if (b == P::OP)
+                    return false;
+                // LB15. QU SP* × OP
+                if (b == P::QU && a == P::OP)
+                    return false;
+                // LB16. (CL | CP) SP* × NS
+                if ((b == P::CL || b == P::CP) && a == P::NS)
+                    return false;
+                // LB17. B2 SP* × B2
+                if (b == P::B2 && a == P::B2)
+                    return false;
+                // LB18. SP ÷
+                if (sp)
+                    return true;
+                // LB19. × QU, QU ×
+                if (a == P::QU || b == P::QU)
+                    return false;
+                // LB20. ÷ CB, CB ÷
+                if (a == P::CB || b == P::CB)
+                    return true;
+                // LB21. × BA, × HY, × NS, BB ×
+                if (a == P::BA || a == P::HY || a == P::NS || b == P::BB)
+                    return false;
+                // LB21b. SY × HL
+                if (b == P::SY && a == P::HL)
+                    return false;
+                // LB22. (AL | HL | EX | ID | IN | NU) × IN
+                if (a == P::IN && (b == P::AL || b == P::HL || b == P::EX || b == P::ID || b == P::IN || b == P::NU))
+                    return false;
+                // LB23. ID × PO, (AL | HL) × NU, NU × (AL | HL)
+                if (b == P::ID && a == P::PO)
+                    return false;
+                if ((b == P::AL || b == P::HL) && a == P::NU)
+                    return false;
+                if (b == P::NU && (a == P::AL || a == P::HL))
+                    return false;
+                // LB24. PR × ID, PR × (AL | HL), PO × (AL | HL)
+                if (b == P::PR && a == P::ID)
+                    return false;
+                if ((b == P::PR || b == P::PO) && (a == P::AL || a == P::HL))
+                    return false;
+                // LB25. (CL | CP | NU) × (PO | PR), (PO | PR) × (OP | NU), (HY | IS | NU | SY) × NU
+                if ((b == P::CL || b == P::CP || b == P::NU) && (a == P::PO || a == P::PR))
+                    return false;
+                if ((b == P::PO || b == P::PR) && (a == P::OP || a == P::NU))
+                    return false;
+                if ((b == P::HY || b == P::IS || b == P::NU || b == P::SY) && a == P::NU)
+                    return false;
+                // LB26. JL × (JL | JV | H2 | H3), (JV | H2) × (JV | JT), (JT | H3) × JT
+                if (b == P::JL && (a == P::JL || a == P::JV || a == P::H2 || a == P::H3))
+                    return false;
+                if ((b == P::JV || b == P::H2) && (a == P::JV || a == P::JT))
+                    return false;
+                if ((b == P::JT || b == P::H3) && a == P::JT)
+                    return false;
+                // LB27. (JL | JV | JT | H2 | H3) × (IN | PO), PR × (JL | JV | JT | H2 | H3)
+                bool korean_b = b == P::JL || b == P::JV || b == P::JT || b == P::H2 || b == P::H3;
+                bool korean_a = a == P::JL || a == P::JV || a == P::JT || a == P::H2 || a == P::H3;
+                if (korean_b && (a == P::IN || a == P::PO))
+                    return false;
+                if (b == P::PR && korean_a)
+                    return false;
+                // LB28. (AL | HL) × (AL | HL)
+                if ((b == P::AL || b == P::HL) && (a == P::AL || a == P::HL))
+                    return false;
+                // LB29. IS × (AL | HL)
+                if (b == P::IS && (a == P::AL || a == P::HL))
+                    return false;
+                // LB30. (AL | HL | NU) × OP, CP × (AL | HL | NU)
+                if ((b == P::AL || b == P::HL || b == P::NU) && a == P::OP)
+                    return false;
+                if (b == P::CP && (a == P::AL || a == P::HL || a == P::NU))
+                    return false;
+                // LB30a. RI × RI
+                if (b == P::RI && a == P::RI)
+                    return false;
+                // LB31. ALL ÷, ÷ ALL
+                return true;
+            }
+
+            class LineBreakTable {
+            public:
+                constexpr LineBreakTable() noexcept {
+                    for (int i = 0; i < n_props; ++i)
+                        for (int j = 0; j < n_props; ++j)
+                            for (int k = 0; k < 2; ++k)
+                                table[k][i][j] = line_pair_is_break(Line_Break(i), Line_Break(j), k != 0);
+                }
+                constexpr bool operator()(Line_Break prev, Line_Break next, bool sp) const noexcept
+                    { return table[sp][int(prev)][int(next)]; }
+            private:
+                static constexpr int n_props = int(Line_Break::ZW) + 1;
+                bool table[2][n_props][n_props] = {};
+            };
+
+            constexpr LineBreakTable line_break_table;
+
+        }
+
+        // LB1. Resolve AI, SG, XX, and SA to AL (or CM for combining SA),
+        // and CJ to NS.
+
+        Line_Break resolved_line_break(char32_t c) noexcept {
+            using P = Line_Break;
+            auto lb = line_break(c);
+            switch (lb) {
+                case P::AI:
+                case P::SG:
+                case P::XX:
+                    return P::AL;
+                case P::SA: {
+                    auto gc = char_general_category(c);
+                    return gc == GC::Mn || gc == GC::Mc ? P::CM : P::AL;
+                }
+                case P::CJ:
+                    return P::NS;
+                default:
+                    return lb;
+            }
+        }
+
+        size_t find_line_break(const SegmentBuffer<Line_Break>& buf, bool /*eof*/) {
+            using P = Line_Break;
+            size_t size = buf.size();
+            if (size == 0)
+                return 0;
+            // LB2. Never break at the start of text.
+            // LB10. Treat any remaining combining mark as AL.
+            P prev = buf[0], prev2 = P::XX;
+            if (prev == P::CM)
+                prev = P::AL;
+            bool sp = prev == P::SP;
+            for (size_t i = 1; i < size; ++i) {
+                P next = buf[i];
+                // LB4. BK !
+                // LB5. CR × LF, CR !, LF !, NL !
+                if (prev == P::BK || prev == P::LF || prev == P::NL || (prev == P::CR && next != P::LF))
+                    return i;
+                // LB6. × (BK | CR | LF | NL)
+                if (next == P::BK || next == P::CR || next == P::LF || next == P::NL) {
+                    prev2 = prev;
+                    prev = next;
+                    sp = false;
+                    continue;
+                }
+                // LB7. × SP
+                if (next == P::SP) {
+                    sp = true;
+                    continue;
+                }
+                // LB9. Treat X CM* as if it were X.
+                // LB10. Treat any remaining combining mark as AL.
+                if (next == P::CM) {
+                    if (! sp && prev != P::ZW)
+                        continue;
+                    next = P::AL;
+                }
+                // LB21a. HL (HY | BA) × (the only earlier rule that can
+                // break here is LB20, ÷ CB)
+                bool no_break = ! sp && next != P::CB && prev2 == P::HL && (prev == P::HY || prev == P::BA);
+                if (! no_break && line_break_table(prev, next, sp))
+                    return i;
+                prev2 = sp ? P::SP : prev;
+                prev = next;
+                sp = false;
+            }
+            return 0;
+        }
+
+        // Line breaking never looks back past a mandatory break (LB4, LB5).
+
+        bool is_restart_point(Line_Break prev, Line_Break next) noexcept {
+            using P = Line_Break;
+            return prev == P::BK || prev == P::LF || prev == P::NL || (prev == P::CR && next != P::LF);
+        }
+
+    }
+
+    WordSpans word_list_parallel(const u8string& src, uint32_t flags, size_t threads) {
+        check_word_flags(flags);
+        auto cuts = find_word_cuts(src, threads);
+        vector<WordSpans> results(cuts.size() - 1);
+        auto out = results.data();
+        UnicornDetail::for_each_parallel_chunk(src, cuts, [=] (size_t part, const Irange<Utf8Iterator>& range) {
+            for (auto& word: word_range(range, flags))
+                out[part].push_back(word);
+        });
+        size_t total = 0;
+        for (auto& r: results)
+            total += r.size();
+        WordSpans words;
+        words.reserve(total);
+        for (auto& r: results)
+            words.insert(words.end(), r.begin(), r.end());
+        return words;
+    }
+
+    WordFrequency word_frequency_parallel(const u8string& src, uint32_t flags, size_t threads) {
+        check_word_flags(flags);
+        auto cuts = find_word_cuts(src, threads);
+        vector<WordFrequency> results(cuts.size() - 1);
+        auto out = results.data();
+        UnicornDetail::for_each_parallel_chunk(src, cuts, [=] (size_t part, const Irange<Utf8Iterator>& range) {
+            for (auto& word: word_range(range, flags))
+                ++out[part][u_str(word)];
+        });
+        auto& freq = results[0];
+        for (size_t i = 1; i < results.size(); ++i)
+            for (auto& kv: results[i])
+                freq[kv.first] += kv.second;
+        return std::move(freq);
     }
 
 }
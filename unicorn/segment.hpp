@@ -4,9 +4,10 @@
 #include "unicorn/character.hpp"
 #include "unicorn/utf.hpp"
 #include <algorithm>
-#include <deque>
 #include <iterator>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace Unicorn {
 
@@ -25,37 +26,107 @@ namespace Unicorn {
 
     namespace UnicornDetail {
 
+        // Property lookahead buffer. This is a ring buffer held inline in
+        // the iterator; it only spills to the heap if a single segment needs
+        // more lookahead than the inline capacity (e.g. a very long run of
+        // combining marks).
+
+        template <typename Property>
+        class SegmentBuffer {
+        public:
+            Property operator[](size_t i) const noexcept { return data()[(head + i) & (capacity - 1)]; }
+            bool empty() const noexcept { return count == 0; }
+            bool full() const noexcept { return count == capacity; }
+            size_t size() const noexcept { return count; }
+            void pop_front(size_t n) noexcept { head = (head + n) & (capacity - 1); count -= n; }
+            void push_back(Property p) noexcept { data()[(head + count++) & (capacity - 1)] = p; }
+            void grow();
+        private:
+            static constexpr size_t fixed_size = 32; // Must be a power of 2
+            Property fixed[fixed_size] = {};
+            std::vector<Property> overflow;
+            size_t head = 0;
+            size_t count = 0;
+            size_t capacity = fixed_size;
+            Property* data() noexcept { return overflow.empty() ? fixed : overflow.data(); }
+            const Property* data() const noexcept { return overflow.empty() ? fixed : overflow.data(); }
+        };
+
+        template <typename Property>
+        void SegmentBuffer<Property>::grow() {
+            std::vector<Property> v(2 * capacity);
+            for (size_t i = 0; i < count; ++i)
+                v[i] = (*this)[i];
+            overflow.swap(v);
+            head = 0;
+            capacity *= 2;
+        }
+
         template <typename Property> using PropertyQuery = Property (*)(char32_t);
-        template <typename Property> using SegmentFunction = size_t (*)(const std::deque<Property>&, bool);
+        template <typename Property> using SegmentFunction = size_t (*)(const SegmentBuffer<Property>&, bool);
+
+        size_t find_grapheme_break(const SegmentBuffer<Grapheme_Cluster_Break>& buf, bool eof);
+        size_t find_word_break(const SegmentBuffer<Word_Break>& buf, bool eof);
+        size_t find_sentence_break(const SegmentBuffer<Sentence_Break>& buf, bool eof);
+        size_t find_line_break(const SegmentBuffer<Line_Break>& buf, bool eof);
+        Line_Break resolved_line_break(char32_t c) noexcept;
+
+        // These report true if there is always a boundary between two
+        // characters with the given properties, regardless of context, so
+        // segmentation can safely be restarted there.
+
+        bool is_restart_point(Grapheme_Cluster_Break prev, Grapheme_Cluster_Break next) noexcept;
+        bool is_restart_point(Word_Break prev, Word_Break next) noexcept;
+        bool is_restart_point(Sentence_Break prev, Sentence_Break next) noexcept;
+        bool is_restart_point(Line_Break prev, Line_Break next) noexcept;
 
-        size_t find_grapheme_break(const std::deque<Grapheme_Cluster_Break>& buf, bool eof);
-        size_t find_word_break(const std::deque<Word_Break>& buf, bool eof);
-        size_t find_sentence_break(const std::deque<Sentence_Break>& buf, bool eof);
+        // Move an offset back to the start of the encoded character that
+        // contains it.
+
+        template <typename C>
+        size_t align_utf_offset(const basic_string<C>& src, size_t offset) noexcept {
+            if (offset >= src.size())
+                return src.size();
+            if (sizeof(C) == 1) {
+                for (int n = 0; n < 3 && offset > 0 && (uint8_t(src[offset]) & 0xc0) == 0x80; ++n)
+                    --offset;
+            } else if (sizeof(C) == 2) {
+                if (offset > 0 && char32_t(src[offset]) >= first_low_surrogate_char && char32_t(src[offset]) <= last_low_surrogate_char
+                        && char32_t(src[offset - 1]) >= first_high_surrogate_char && char32_t(src[offset - 1]) <= last_high_surrogate_char)
+                    --offset;
+            }
+            return offset;
+        }
 
     }
 
     template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ,
         UnicornDetail::SegmentFunction<Property> SF>
     class BasicSegmentIterator:
-    public ForwardIterator<BasicSegmentIterator<C, Property, PQ, SF>, const Irange<UtfIterator<C>>> {
+    public BidirectionalIterator<BasicSegmentIterator<C, Property, PQ, SF>, const Irange<UtfIterator<C>>> {
     public:
         using utf_iterator = UtfIterator<C>;
         BasicSegmentIterator() noexcept {}
         BasicSegmentIterator(const utf_iterator& i, const utf_iterator& j, uint32_t flags):
-            seg{i, i}, ends(j), next(i), bufsize(initsize), mode(flags) { ++*this; }
+            BasicSegmentIterator(i, i, j, flags) {}
+        BasicSegmentIterator(const utf_iterator& b, const utf_iterator& i, const utf_iterator& j, uint32_t flags):
+            seg{i, i}, begins(b), ends(j), next(i), mode(flags) { ++*this; }
         const Irange<utf_iterator>& operator*() const noexcept { return seg; }
         BasicSegmentIterator& operator++() noexcept;
+        BasicSegmentIterator& operator--() noexcept;
         bool operator==(const BasicSegmentIterator& rhs) const noexcept { return seg.begin() == rhs.seg.begin(); }
+        static utf_iterator prev_boundary(const utf_iterator& b, const utf_iterator& e, const utf_iterator& pos) noexcept;
+        static utf_iterator next_boundary(const utf_iterator& b, const utf_iterator& e, const utf_iterator& pos) noexcept;
     private:
-        static constexpr size_t initsize = 16;
-        Irange<utf_iterator> seg;  // Iterator pair marking current segment
-        size_t len = 0;            // Length of segment
-        utf_iterator ends;         // End of source string
-        utf_iterator next;         // End of buffer contents
-        std::deque<Property> buf;  // Property lookahead buffer
-        size_t bufsize = 0;        // Current lookahead limit
-        uint32_t mode = 0;         // Mode flags
+        Irange<utf_iterator> seg;                   // Iterator pair marking current segment
+        size_t len = 0;                             // Length of segment
+        utf_iterator begins;                        // Start of source string
+        utf_iterator ends;                          // End of source string
+        utf_iterator next;                          // End of buffer contents
+        UnicornDetail::SegmentBuffer<Property> buf; // Property lookahead buffer
+        uint32_t mode = 0;                          // Mode flags
         bool select_segment() const noexcept;
+        static BasicSegmentIterator locate(const utf_iterator& b, const utf_iterator& e, const utf_iterator& pos) noexcept;
     };
 
     template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ,
@@ -66,14 +137,14 @@ namespace Unicorn {
             seg.first = seg.second;
             if (seg.first == ends)
                 break;
-            buf.erase(buf.begin(), buf.begin() + len);
+            buf.pop_front(len);
             for (;;) {
-                while (next != ends && buf.size() < bufsize)
+                while (next != ends && ! buf.full())
                     buf.push_back(PQ(*next++));
                 len = SF(buf, next == ends);
                 if (len || next == ends)
                     break;
-                bufsize += initsize;
+                buf.grow();
             }
             if (len == 0)
                 seg.second = ends;
@@ -83,6 +154,65 @@ namespace Unicorn {
         return *this;
     }
 
+    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ,
+        UnicornDetail::SegmentFunction<Property> SF>
+    BasicSegmentIterator<C, Property, PQ, SF>&
+    BasicSegmentIterator<C, Property, PQ, SF>::operator--() noexcept {
+        auto flags = mode;
+        while (seg.first != begins) {
+            *this = locate(begins, ends, std::prev(seg.first));
+            mode = flags;
+            if (select_segment())
+                break;
+        }
+        return *this;
+    }
+
+    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ,
+        UnicornDetail::SegmentFunction<Property> SF>
+    UtfIterator<C> BasicSegmentIterator<C, Property, PQ, SF>::prev_boundary(const utf_iterator& b,
+            const utf_iterator& e, const utf_iterator& pos) noexcept {
+        if (pos == e)
+            return e;
+        return locate(b, e, pos).seg.first;
+    }
+
+    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ,
+        UnicornDetail::SegmentFunction<Property> SF>
+    UtfIterator<C> BasicSegmentIterator<C, Property, PQ, SF>::next_boundary(const utf_iterator& b,
+            const utf_iterator& e, const utf_iterator& pos) noexcept {
+        if (pos == e)
+            return e;
+        auto range = locate(b, e, pos).seg;
+        return range.first == pos ? pos : range.second;
+    }
+
+    // Find the segment containing the character at pos, by backing up to
+    // the nearest point where segmentation can be restarted and scanning
+    // forward from there.
+
+    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ,
+        UnicornDetail::SegmentFunction<Property> SF>
+    BasicSegmentIterator<C, Property, PQ, SF>
+    BasicSegmentIterator<C, Property, PQ, SF>::locate(const utf_iterator& b, const utf_iterator& e,
+            const utf_iterator& pos) noexcept {
+        auto start = pos;
+        if (start != e) {
+            auto after = PQ(*start);
+            while (start != b) {
+                auto before = PQ(*std::prev(start));
+                if (UnicornDetail::is_restart_point(before, after))
+                    break;
+                --start;
+                after = before;
+            }
+        }
+        BasicSegmentIterator it(b, start, e, 0);
+        while (it.seg.second != e && it.seg.second.offset() <= pos.offset())
+            ++it;
+        return it;
+    }
+
     template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ,
         UnicornDetail::SegmentFunction<Property> SF>
     bool BasicSegmentIterator<C, Property, PQ, SF>::select_segment() const noexcept {
@@ -101,7 +231,7 @@ namespace Unicorn {
 
     template <typename C> Irange<GraphemeIterator<C>>
     grapheme_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
-        return {{i, j, {}}, {j, j, {}}};
+        return {{i, i, j, {}}, {i, j, j, {}}};
     }
 
     template <typename C> Irange<GraphemeIterator<C>>
@@ -114,6 +244,33 @@ namespace Unicorn {
         return grapheme_range(utf_range(source));
     }
 
+    template <typename C> UtfIterator<C>
+    prev_grapheme_boundary(const Irange<UtfIterator<C>>& source, const UtfIterator<C>& pos) {
+        return GraphemeIterator<C>::prev_boundary(source.begin(), source.end(), pos);
+    }
+
+    template <typename C> size_t
+    prev_grapheme_boundary(const basic_string<C>& source, size_t offset) {
+        auto range = utf_range(source);
+        auto pos = utf_iterator(source, UnicornDetail::align_utf_offset(source, offset));
+        return GraphemeIterator<C>::prev_boundary(range.begin(), range.end(), pos).offset();
+    }
+
+    template <typename C> UtfIterator<C>
+    next_grapheme_boundary(const Irange<UtfIterator<C>>& source, const UtfIterator<C>& pos) {
+        return GraphemeIterator<C>::next_boundary(source.begin(), source.end(), pos);
+    }
+
+    template <typename C> size_t
+    next_grapheme_boundary(const basic_string<C>& source, size_t offset) {
+        auto range = utf_range(source);
+        auto start = UnicornDetail::align_utf_offset(source, offset);
+        auto pos = utf_iterator(source, start);
+        if (start < offset)
+            ++pos;
+        return GraphemeIterator<C>::next_boundary(range.begin(), range.end(), pos).offset();
+    }
+
     // Word boundaries
 
     template <typename C> using WordIterator
@@ -123,7 +280,7 @@ namespace Unicorn {
     word_range(const UtfIterator<C>& i, const UtfIterator<C>& j, uint32_t flags = 0) {
         if (bits_set(flags & (unicode_words | graphic_words | alpha_words)) > 1)
             throw std::invalid_argument("Inconsistent word breaking flags");
-        return {{i, j, flags}, {j, j, flags}};
+        return {{i, i, j, flags}, {i, j, j, flags}};
     }
 
     template <typename C> Irange<WordIterator<C>>
@@ -136,6 +293,36 @@ namespace Unicorn {
         return word_range(utf_range(source), flags);
     }
 
+    template <typename C> UtfIterator<C>
+    prev_word_boundary(const Irange<UtfIterator<C>>& source, const UtfIterator<C>& pos) {
+        return WordIterator<C>::prev_boundary(source.begin(), source.end(), pos);
+    }
+
+    template <typename C> size_t
+    prev_word_boundary(const basic_string<C>& source, size_t offset) {
+        auto range = utf_range(source);
+        auto pos = utf_iterator(source, UnicornDetail::align_utf_offset(source, offset));
+        return WordIterator<C>::prev_boundary(range.begin(), range.end(), pos).offset();
+    }
+
+    template <typename C> UtfIterator<C>
+    next_word_boundary(const Irange<UtfIterator<C>>& source, const UtfIterator<C>& pos) {
+        return WordIterator<C>::next_boundary(source.begin(), source.end(), pos);
+    }
+
+    template <typename C> size_t
+    next_word_boundary(const basic_string<C>& source, size_t offset) {
+        auto range = utf_range(source);
+        auto start = UnicornDetail::align_utf_offset(source, offset);
+        auto pos = utf_iterator(source, start);
+        if (start < offset)
+            ++pos;
+        return WordIterator<C>::next_boundary(range.begin(), range.end(), pos).offset();
+    }
+
+    vector<Irange<Utf8Iterator>> word_list_parallel(const u8string& src, uint32_t flags = 0, size_t threads = 0);
+    std::unordered_map<u8string, size_t> word_frequency_parallel(const u8string& src, uint32_t flags = 0, size_t threads = 0);
+
     // Sentence boundaries
 
     template <typename C> using SentenceIterator
@@ -143,7 +330,7 @@ namespace Unicorn {
 
     template <typename C> Irange<SentenceIterator<C>>
     sentence_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
-        return {{i, j, {}}, {j, j, {}}};
+        return {{i, i, j, {}}, {i, j, j, {}}};
     }
 
     template <typename C> Irange<SentenceIterator<C>>
@@ -156,6 +343,53 @@ namespace Unicorn {
         return sentence_range(utf_range(source));
     }
 
+    template <typename C> UtfIterator<C>
+    prev_sentence_boundary(const Irange<UtfIterator<C>>& source, const UtfIterator<C>& pos) {
+        return SentenceIterator<C>::prev_boundary(source.begin(), source.end(), pos);
+    }
+
+    template <typename C> size_t
+    prev_sentence_boundary(const basic_string<C>& source, size_t offset) {
+        auto range = utf_range(source);
+        auto pos = utf_iterator(source, UnicornDetail::align_utf_offset(source, offset));
+        return SentenceIterator<C>::prev_boundary(range.begin(), range.end(), pos).offset();
+    }
+
+    template <typename C> UtfIterator<C>
+    next_sentence_boundary(const Irange<UtfIterator<C>>& source, const UtfIterator<C>& pos) {
+        return SentenceIterator<C>::next_boundary(source.begin(), source.end(), pos);
+    }
+
+    template <typename C> size_t
+    next_sentence_boundary(const basic_string<C>& source, size_t offset) {
+        auto range = utf_range(source);
+        auto start = UnicornDetail::align_utf_offset(source, offset);
+        auto pos = utf_iterator(source, start);
+        if (start < offset)
+            ++pos;
+        return SentenceIterator<C>::next_boundary(range.begin(), range.end(), pos).offset();
+    }
+
+    // Line break opportunities
+
+    template <typename C> using LineBreakIterator
+        = BasicSegmentIterator<C, Line_Break, UnicornDetail::resolved_line_break, UnicornDetail::find_line_break>;
+
+    template <typename C> Irange<LineBreakIterator<C>>
+    line_break_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
+        return {{i, i, j, {}}, {i, j, j, {}}};
+    }
+
+    template <typename C> Irange<LineBreakIterator<C>>
+    line_break_range(const Irange<UtfIterator<C>>& source) {
+        return line_break_range(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<LineBreakIterator<C>>
+    line_break_range(const basic_string<C>& source) {
+        return line_break_range(utf_range(source));
+    }
+
     // Common base template for line and paragraph iterators
 
     namespace UnicornDetail {
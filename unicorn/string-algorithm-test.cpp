@@ -3,15 +3,38 @@
 #include "unicorn/character.hpp"
 #include "unicorn/utf.hpp"
 #include "prion/unit-test.hpp"
+#include <algorithm>
 #include <iterator>
 #include <random>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace std::literals;
 using namespace Unicorn;
 
 namespace {
 
+    // Reproducible random strings built from a small set of pieces, for
+    // cross checking against simple reference implementations
+
+    class RandomStrings {
+    public:
+        explicit RandomStrings(const vector<u8string>& pieces): alphabet(pieces), piece(0, pieces.size() - 1) {}
+        u8string operator()(size_t n) {
+            u8string r;
+            for (size_t i = 0; i < n; ++i)
+                r += alphabet[piece(rng)];
+            return r;
+        }
+        size_t number(size_t min, size_t max) { return std::uniform_int_distribution<size_t>(min, max)(rng); }
+    private:
+        vector<u8string> alphabet;
+        std::uniform_int_distribution<size_t> piece;
+        std::mt19937 rng{42};
+    };
+
     void check_common() {
 
         u8string a, b = "Hello", c = "Hello world", d = "Hellfire", e = "Goodbye";
@@ -117,6 +140,139 @@ namespace {
 
     }
 
+    void check_fuzzy_search() {
+
+        FuzzySearch fs;
+        FuzzySearch::match m;
+        u8string s;
+
+        TEST_EQUAL(str_edit_distance(u8"", u8""), 0);
+        TEST_EQUAL(str_edit_distance(u8"", u8"abc"), 3);
+        TEST_EQUAL(str_edit_distance(u8"abc", u8""), 3);
+        TEST_EQUAL(str_edit_distance(u8"kitten", u8"sitting"), 3);
+        TEST_EQUAL(str_edit_distance(u8"flaw", u8"lawn"), 2);
+        TEST_EQUAL(str_edit_distance(u8"Hello", u8"hello"), 1);
+        TEST_EQUAL(str_edit_distance(u8"Hello", u8"hello", fuzzy_casefold), 0);
+        TEST_EQUAL(str_edit_distance(u8"straße", u8"STRASSE"), 7);
+        TEST_EQUAL(str_edit_distance(u8"straße", u8"STRASSE", fuzzy_casefold), 0);
+        TEST_EQUAL(str_edit_distance(u8"αβγδ", u8"αβδ"), 1);
+        TEST_EQUAL(str_edit_distance(u8"résumé", u8"resume"), 2);
+        TEST_EQUAL(str_edit_distance(u8"résumé", u8"resume", grapheme_units), 2);
+        TEST_EQUAL(str_edit_distance(u8"résumé", u8"rasumo", grapheme_units), 2);
+        TEST_EQUAL(str_edit_distance(u8"résumé", u8"rasumo"), 4);
+        TEST_EQUAL(str_edit_distance(u8"RÉSUMÉ", u8"résumé", grapheme_units | fuzzy_casefold), 0);
+        TEST_THROW(str_edit_distance(u8"", u8"", character_units | grapheme_units), std::invalid_argument);
+
+        TRY(fs = FuzzySearch(u8"necessary"));
+        TEST_EQUAL(fs.pattern(), u8"necessary");
+        TEST_EQUAL(fs.size(), 9);
+        TEST_EQUAL(fs.distance(u8"necessary"), 0);
+        TEST_EQUAL(fs.distance(u8"neccessary"), 1);
+        TEST_EQUAL(fs.distance(u8"nesesary"), 2);
+        TEST_EQUAL(fs.distance(u8"nesesary", 2), 2);
+        TEST_EQUAL(fs.distance(u8"nesesary", 1), npos);
+        TEST_EQUAL(fs.distance(u8"unnecessarily", 2), npos);
+        TEST_EQUAL(fs.distance(u8"xyz", 5), npos);
+
+        TRY(m = fs.find(u8"It is not neccessary to spell it right", 2));
+        TEST(m);
+        TEST_EQUAL(m.offset, 10);
+        TEST_EQUAL(m.length, 10);
+        TEST_EQUAL(m.distance, 1);
+        TRY(m = fs.find(u8"It is not neccessary to spell it right", 0));
+        TEST(! m);
+        TRY(m = fs.find(u8"necessary", 2, 1));
+        TEST(m);
+        TEST_EQUAL(m.offset, 1);
+        TEST_EQUAL(m.length, 8);
+        TEST_EQUAL(m.distance, 1);
+
+        TRY(fs = FuzzySearch(u8"ΟΔΟΣ", fuzzy_casefold));
+        TRY(m = fs.find(u8"Η οδός είναι μακριά", 1));
+        TEST(m);
+        TEST_EQUAL(m.offset, 3);
+        TEST_EQUAL(m.length, 8);
+        TEST_EQUAL(m.distance, 1);
+
+        TRY(fs = FuzzySearch());
+        TEST_EQUAL(fs.size(), 0);
+        TEST_EQUAL(fs.distance(u8"abc"), 3);
+        TEST_EQUAL(fs.distance(u8"abc", 2), npos);
+        TRY(m = fs.find(u8"abc", 0, 1));
+        TEST(m);
+        TEST_EQUAL(m.offset, 1);
+        TEST_EQUAL(m.length, 0);
+        TEST_EQUAL(m.distance, 0);
+
+        TRY(fs = FuzzySearch(u8"colour"));
+        s = u8"color, colour, and colur; not collar or cooler";
+        vector<u8string> words;
+        for (size_t pos = 0; (m = fs.find(s, 1, pos)); pos = m.offset + m.length)
+            words.push_back(s.substr(m.offset, m.length));
+        TEST_EQUAL(words.size(), 3);
+        TEST_EQUAL(str_join(words, "/"), "color/colour/colur");
+
+        // Cross check against the classic dynamic programming algorithm,
+        // with patterns long enough to span several blocks
+
+        RandomStrings random_string({u8"a", u8"b", u8"c", u8"α", u8"€"});
+        auto edit_distance = [] (const u32string& a, const u32string& b, bool anchored) {
+            vector<size_t> prev(a.size() + 1), next(a.size() + 1), last(b.size() + 1);
+            for (size_t i = 0; i <= a.size(); ++i)
+                prev[i] = i;
+            last[0] = a.size();
+            for (size_t j = 1; j <= b.size(); ++j) {
+                next[0] = anchored ? j : 0;
+                for (size_t i = 1; i <= a.size(); ++i)
+                    next[i] = std::min({prev[i] + 1, next[i - 1] + 1, prev[i - 1] + (a[i - 1] == b[j - 1] ? 0 : 1)});
+                prev.swap(next);
+                last[j] = prev[a.size()];
+            }
+            return last;
+        };
+
+        for (int i = 0; i < 300; ++i) {
+            auto pattern = random_string(random_string.number(0, 300)), text = random_string(random_string.number(0, 300));
+            auto p32 = to_utf32(pattern), t32 = to_utf32(text);
+            size_t expect = edit_distance(p32, t32, true).back();
+            TRY(fs = FuzzySearch(pattern));
+            TEST_EQUAL(fs.distance(text), expect);
+            TEST_EQUAL(fs.distance(text, expect), expect);
+            if (expect > 0)
+                TEST_EQUAL(fs.distance(text, expect - 1), npos);
+            size_t limit = p32.size() / 3;
+            auto scores = edit_distance(p32, t32, false);
+            size_t end = 0;
+            while (end < scores.size() && scores[end] > limit)
+                ++end;
+            TRY(m = fs.find(text, limit));
+            if (end == scores.size()) {
+                TEST(! m);
+            } else {
+                while (end + 1 < scores.size() && scores[end + 1] < scores[end])
+                    ++end;
+                TEST(m);
+                TEST_EQUAL(m.distance, scores[end]);
+                TEST_EQUAL(size_t(std::distance(utf_begin(text), utf_iterator(text, m.offset + m.length))), end);
+                auto found = edit_distance(p32, to_utf32(text.substr(m.offset, m.length)), true);
+                TEST_EQUAL(found.back(), m.distance);
+            }
+        }
+
+        RandomStrings random_folding({u8"a", u8"A", u8"s", u8"SS", u8"ß", u8"ΐ", u8"ι"});
+
+        for (int i = 0; i < 300; ++i) {
+            auto pattern = random_folding(random_folding.number(0, 40)), text = random_folding(random_folding.number(0, 40));
+            size_t expect = edit_distance(to_utf32(str_casefold(pattern)), to_utf32(str_casefold(text)), true).back();
+            TRY(fs = FuzzySearch(pattern, fuzzy_casefold));
+            TEST_EQUAL(fs.distance(text), expect);
+            TEST_EQUAL(fs.distance(text, expect), expect);
+            if (expect > 0)
+                TEST_EQUAL(fs.distance(text, expect - 1), npos);
+        }
+
+    }
+
     void check_line_column() {
 
         u8string s0 = "",
@@ -152,6 +308,174 @@ namespace {
 
     }
 
+    void check_line_index() {
+
+        u8string s;
+        LineIndex li;
+        size_t line = 0, col = 0;
+
+        TEST_EQUAL(li.lines(), 1);
+        TRY(li.line_column(0, line, col));  TEST_EQUAL(line, 1);  TEST_EQUAL(col, 1);
+        TEST_EQUAL(li.offset(1, 1), 0);
+        TEST_EQUAL(li.offset(1, 2), npos);
+        TEST_EQUAL(li.offset(2, 1), npos);
+
+        s = u8"Hello world\r\nGoodbye\nαβγ\u2028ΑΒΓ\r\r\n"
+            u8"The quick brown fox jumps over the lazy dog\f"
+            u8"日本語テキスト\v"
+            u8"a\u0301e\u0301i\u0301\u0085end";
+        TRY(li = LineIndex(s));
+        TEST_EQUAL(li.lines(), 9);
+        TEST_EQUAL(li.line_offset(0), npos);
+        TEST_EQUAL(li.line_offset(1), 0);
+        TEST_EQUAL(li.line_offset(2), 13);
+        TEST_EQUAL(li.line_offset(3), 21);
+        TEST_EQUAL(li.line_offset(10), npos);
+
+        for (uint32_t flags: {character_units, grapheme_units, narrow_context, wide_context}) {
+            size_t line1 = 0, col1 = 0, line2 = 0, col2 = 0;
+            for (size_t ofs = 0; ofs <= s.size() + 1; ++ofs) {
+                TRY(str_line_column(s, ofs, line1, col1, flags));
+                TRY(li.line_column(ofs, line2, col2, flags));
+                TEST_EQUAL(line2, line1);
+                TEST_EQUAL(col2, col1);
+            }
+        }
+
+        TRY(li.line_column(0, line, col));   TEST_EQUAL(line, 1);  TEST_EQUAL(col, 1);
+        TRY(li.line_column(12, line, col));  TEST_EQUAL(line, 1);  TEST_EQUAL(col, 13);
+        TRY(li.line_column(23, line, col));  TEST_EQUAL(line, 3);  TEST_EQUAL(col, 2);
+        TRY(li.line_column(24, line, col));  TEST_EQUAL(line, 3);  TEST_EQUAL(col, 2);
+
+        TEST_EQUAL(li.offset(1, 1), 0);
+        TEST_EQUAL(li.offset(1, 12), 11);
+        TEST_EQUAL(li.offset(1, 13), 12);
+        TEST_EQUAL(li.offset(1, 14), npos);
+        TEST_EQUAL(li.offset(2, 1), 13);
+        TEST_EQUAL(li.offset(3, 2), 23);
+        TEST_EQUAL(li.offset(3, 4), 27);
+        TEST_EQUAL(li.offset(3, 5), npos);
+        TEST_EQUAL(li.offset(0, 1), npos);
+        TEST_EQUAL(li.offset(1, 0), npos);
+        TEST_EQUAL(li.offset(10, 1), npos);
+
+        for (uint32_t flags: {character_units, grapheme_units, narrow_context, wide_context}) {
+            for (size_t ofs = 0; ofs <= s.size(); ++ofs) {
+                size_t line2 = 0, col2 = 0;
+                TRY(li.line_column(ofs, line, col, flags));
+                size_t ofs2 = li.offset(line, col, flags);
+                TRY(li.line_column(ofs2, line2, col2, flags));
+                TEST_EQUAL(line2, line);
+                TEST_EQUAL(col2, col);
+            }
+        }
+
+    }
+
+    void check_multi_search() {
+
+        MultiSearch ms;
+        MultiSearch::match m;
+        u8string s;
+        vector<MultiSearch::match> v;
+
+        TEST(ms.empty());
+        TEST_EQUAL(ms.size(), 0);
+        TRY(m = ms.find(u8"Hello world"));
+        TEST(! m);
+        TEST_EQUAL(ms.replace(u8"Hello world"), u8"Hello world");
+
+        TRY((ms = {{u8"he", u8"1"}, {u8"she", u8"2"}, {u8"his", u8"3"}, {u8"hers", u8"4"}}));
+        TEST_EQUAL(ms.size(), 4);
+        TEST_EQUAL(ms.target(1), u8"she");
+        TEST_EQUAL(ms.sub(1), u8"2");
+        TRY(m = ms.find(u8"ushers"));
+        TEST(m);
+        TEST_EQUAL(m.offset, 1);
+        TEST_EQUAL(m.length, 3);
+        TEST_EQUAL(m.index, 1);
+        TRY(m = ms.find(u8"ushers", 2));
+        TEST_EQUAL(m.offset, 2);
+        TEST_EQUAL(m.length, 4);
+        TEST_EQUAL(m.index, 3);
+        TRY(m = ms.find(u8"ushers", 3));
+        TEST(! m);
+        TEST_EQUAL(ms.count(u8"ushers"), 1);
+        TEST_EQUAL(ms.count(u8"she said his hat was hers"), 3);
+        TEST_EQUAL(ms.replace(u8"ushers"), u8"u2rs");
+        TEST_EQUAL(ms.replace(u8"she said his hat was hers"), u8"2 said 3 hat was 4");
+        TEST_EQUAL(ms.replace(u8"nothing to see"), u8"nothing to see");
+
+        TRY((ms = {{u8"a", u8"x"}, {u8"ab", u8"y"}, {u8"abc", u8"z"}, {u8"bcd", u8"w"}}));
+        TEST_EQUAL(ms.replace(u8"abcd"), u8"zd");
+        TEST_EQUAL(ms.replace(u8"abd"), u8"yd");
+        TEST_EQUAL(ms.replace(u8"aabcbcd"), u8"xzw");
+        TRY(v = ms.find_all(u8"aabcbcd"));
+        TEST_EQUAL(v.size(), 3);
+        TEST_EQUAL(v[0].offset, 0);  TEST_EQUAL(v[0].length, 1);
+        TEST_EQUAL(v[1].offset, 1);  TEST_EQUAL(v[1].length, 3);
+        TEST_EQUAL(v[2].offset, 4);  TEST_EQUAL(v[2].length, 3);
+
+        TRY((ms = {{u8"α", u8"alpha"}, {u8"αβ", u8"alpha-beta"}, {u8"€", u8"EUR"}, {u8"", u8"nothing"}}));
+        TEST_EQUAL(ms.replace(u8"αβγ €100 α"), u8"alpha-betaγ EUR100 alpha");
+        TRY(ms.add(u8"γ", u8"gamma"));
+        TEST_EQUAL(ms.size(), 5);
+        TEST_THROW(ms.replace(u8"αβγ €100 α"), std::logic_error);
+        TRY(ms.compile());
+        TEST_EQUAL(ms.replace(u8"αβγ €100 α"), u8"alpha-betagamma EUR100 alpha");
+        TRY(ms.add(u8"α", u8"A"));
+        TRY(ms.compile());
+        TEST_EQUAL(ms.replace(u8"αβγ €100 α"), u8"alpha-betagamma EUR100 A");
+        TRY(s = u8"αβγ");
+        TRY(ms.replace_in(s));
+        TEST_EQUAL(s, u8"alpha-betagamma");
+
+        TRY(ms = MultiSearch());
+        for (int i = 0; i < 1000; ++i)
+            TRY(ms.add("<" + dec(i) + ">", dec(i * i)));
+        TRY(ms.compile());
+        TEST_EQUAL(ms.size(), 1000);
+        TEST_EQUAL(ms.replace("<12><999>"), "144998001");
+
+        std::vector<u8string> words = {u8"cat", u8"category", u8"dog", u8"egory"};
+        TRY(ms = MultiSearch(words));
+        TEST_EQUAL(ms.size(), 4);
+        TEST_EQUAL(ms.count(u8"category dogcat gory"), 3);
+        TEST_EQUAL(ms.replace(u8"category dogcat gory"), u8"  gory");
+
+        // Cross check against brute force leftmost longest matching
+
+        RandomStrings random_string({"a", "b", "c", "d"});
+
+        for (int i = 0; i < 200; ++i) {
+            vector<std::pair<u8string, u8string>> pairs;
+            size_t npairs = random_string.number(1, 12);
+            for (size_t j = 0; j < npairs; ++j)
+                pairs.push_back({random_string(random_string.number(1, 4)), dec(j) + ";"});
+            TRY(ms = MultiSearch(pairs));
+            auto text = random_string(50);
+            u8string expect;
+            for (size_t pos = 0; pos < text.size();) {
+                size_t best = npos, blen = 0;
+                for (size_t j = 0; j < pairs.size(); ++j) {
+                    auto& t = pairs[j].first;
+                    if (t.size() >= blen && text.compare(pos, t.size(), t) == 0) {
+                        best = j;
+                        blen = t.size();
+                    }
+                }
+                if (best == npos) {
+                    expect += text[pos++];
+                } else {
+                    expect += pairs[best].second;
+                    pos += blen;
+                }
+            }
+            TEST_EQUAL(ms.replace(text), expect);
+        }
+
+    }
+
     void check_search() {
 
         u8string s;
@@ -166,6 +490,41 @@ namespace {
         TRY(i = str_search(utf_range(s), u8"€uro"));     TEST_EQUAL(std::distance(utf_begin(s), i), 0);
         TRY(i = str_search(utf_range(s), u8"∈lement"));  TEST_EQUAL(std::distance(utf_begin(s), i), 5);
         TRY(i = str_search(utf_range(s), u8"Hello"));    TEST_EQUAL(std::distance(utf_begin(s), i), 12);
+        TRY(i = str_search(std::next(utf_begin(s)), utf_end(s), u8"€uro"));              TEST_EQUAL(std::distance(utf_begin(s), i), 12);
+        TRY(i = str_search(utf_begin(s), std::next(utf_begin(s), 8), u8"∈lement"));      TEST_EQUAL(std::distance(utf_begin(s), i), 8);
+
+        StringSearch ss;
+        size_t ofs = 0;
+
+        TEST_EQUAL(ss.target(), u8"");
+        TEST_EQUAL(ss.find(s), 0);
+        TRY(ss = StringSearch(u8"∈lement"));
+        TEST_EQUAL(ss.target(), u8"∈lement");
+        TRY(ofs = ss.find(s));                  TEST_EQUAL(ofs, 7);
+        TRY(ofs = ss.find(s, 7));               TEST_EQUAL(ofs, 7);
+        TRY(ofs = ss.find(s, 8));               TEST_EQUAL(ofs, npos);
+        TRY(ofs = ss.find(s, 100));             TEST_EQUAL(ofs, npos);
+        TRY(i = ss.search(s));                  TEST_EQUAL(std::distance(utf_begin(s), i), 5);
+        TRY(i = ss.search(utf_range(s)));       TEST_EQUAL(std::distance(utf_begin(s), i), 5);
+        TRY(ss = StringSearch(u8"uro"));
+        TRY(i = ss.search(s));                  TEST_EQUAL(std::distance(utf_begin(s), i), 1);
+        TRY(i = ss.search(std::next(utf_begin(s), 2), utf_end(s)));  TEST_EQUAL(std::distance(utf_begin(s), i), 12);
+
+        // Cross check against std::string::find, using a small alphabet to
+        // produce plenty of periodic targets and partial matches
+
+        RandomStrings random_string({"a", "b", "c"});
+
+        for (int j = 0; j < 1000; ++j) {
+            auto target = random_string(random_string.number(1, 12));
+            auto text = random_string(200);
+            TRY(ss = StringSearch(target));
+            for (size_t pos = 0; pos <= text.size(); pos += 37)
+                TEST_EQUAL(ss.find(text, pos), text.find(target, pos));
+            TRY(i = str_search(text, target));
+            size_t expect = text.find(target);
+            TEST_EQUAL(i.offset(), expect == npos ? text.size() : expect);
+        }
 
     }
 
@@ -192,7 +551,10 @@ TEST_MODULE(unicorn, string_algorithm) {
     check_expect();
     check_find_char();
     check_find_first();
+    check_fuzzy_search();
     check_line_column();
+    check_line_index();
+    check_multi_search();
     check_search();
     check_skipws();
 
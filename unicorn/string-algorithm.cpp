@@ -2,6 +2,227 @@
 
 namespace Unicorn {
 
+    namespace {
+
+        // Two-way string matching (Crochemore and Perrin 1991), on bytes.
+        // UTF-8 is self-synchronizing, so a byte match of a valid target in
+        // valid text always starts on a character boundary. The needle is
+        // split at a critical factorization: the right half is matched
+        // forwards first, then the left half backwards, giving linear time
+        // with constant space.
+
+        struct Factorization {
+            size_t suffix = 0;
+            size_t period = 1;
+            bool periodic = false;
+            Factorization(const char* needle, size_t n) noexcept;
+            Factorization(size_t s, size_t p, bool per) noexcept: suffix(s), period(p), periodic(per) {}
+        };
+
+        size_t maximal_suffix(const uint8_t* x, size_t n, bool reverse, size_t& period) noexcept {
+            size_t ms = npos, j = 0, k = 1, p = 1;
+            while (j + k < n) {
+                uint8_t a = x[j + k], b = x[ms + k];
+                if (reverse ? a > b : a < b) {
+                    j += k;
+                    k = 1;
+                    p = j - ms;
+                } else if (a == b) {
+                    if (k == p) {
+                        j += p;
+                        k = 1;
+                    } else {
+                        ++k;
+                    }
+                } else {
+                    ms = j++;
+                    k = p = 1;
+                }
+            }
+            period = p;
+            return ms + 1;
+        }
+
+        Factorization::Factorization(const char* needle, size_t n) noexcept {
+            if (n < 3) {
+                suffix = n == 0 ? 0 : n - 1;
+                period = 1;
+            } else {
+                auto x = reinterpret_cast<const uint8_t*>(needle);
+                size_t p1 = 1, p2 = 1;
+                size_t s1 = maximal_suffix(x, n, false, p1), s2 = maximal_suffix(x, n, true, p2);
+                if (s2 < s1) {
+                    suffix = s1;
+                    period = p1;
+                } else {
+                    suffix = s2;
+                    period = p2;
+                }
+            }
+            periodic = suffix + period <= n && std::memcmp(needle, needle + period, suffix) == 0;
+            if (! periodic)
+                period = std::max(suffix, n - suffix) + 1;
+        }
+
+        size_t find_bytes(const char* hay, size_t hsize, const char* needle, size_t n, const Factorization& f) noexcept {
+            if (n == 0)
+                return 0;
+            if (n > hsize)
+                return npos;
+            if (n == 1) {
+                auto p = static_cast<const char*>(std::memchr(hay, needle[0], hsize));
+                return p ? p - hay : npos;
+            }
+            size_t last = hsize - n, j = 0, memory = 0;
+            while (j <= last) {
+                // Skip straight to the next occurrence of the first byte of
+                // the right half
+                if (memory == 0 && hay[j + f.suffix] != needle[f.suffix]) {
+                    auto p = static_cast<const char*>(std::memchr(hay + j + f.suffix + 1, needle[f.suffix], last - j));
+                    if (! p)
+                        return npos;
+                    j = p - hay - f.suffix;
+                }
+                size_t i = std::max(f.suffix, memory);
+                while (i < n && needle[i] == hay[i + j])
+                    ++i;
+                if (i < n) {
+                    j += i - f.suffix + 1;
+                    memory = 0;
+                    continue;
+                }
+                i = f.suffix;
+                while (i > memory && needle[i - 1] == hay[i - 1 + j])
+                    --i;
+                if (i <= memory)
+                    return j;
+                j += f.period;
+                if (f.periodic)
+                    memory = n - f.period;
+            }
+            return npos;
+        }
+
+        const u8string& empty_text() {
+            static const u8string text;
+            return text;
+        }
+
+        // Myers' bit-parallel edit distance (Myers 1999), in Hyyro's block
+        // formulation. Each 64 bit block holds the vertical score deltas for
+        // 64 pattern units as positive and negative bit vectors. The
+        // horizontal delta enters at the top of the block and the delta at
+        // the given row is returned; for all but the last block that is the
+        // top row, to be carried into the next block.
+
+        constexpr uint32_t no_symbol = ~ uint32_t(0);
+
+        int myers_step(uint64_t& pv, uint64_t& mv, uint64_t eq, int hin, unsigned row) noexcept {
+            uint64_t hneg = hin < 0 ? 1 : 0;
+            uint64_t xv = eq | mv;
+            eq |= hneg;
+            uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+            uint64_t ph = mv | ~ (xh | pv);
+            uint64_t mh = pv & xh;
+            int hout = int((ph >> row) & 1) - int((mh >> row) & 1);
+            ph = (ph << 1) | (hin > 0 ? 1 : 0);
+            mh = (mh << 1) | hneg;
+            pv = mh | ~ (xv | ph);
+            mv = ph & xv;
+            return hout;
+        }
+
+        // Score of the last pattern unit against a growing text. Anchored
+        // matching charges for text skipped at the start; unanchored
+        // matching lets the pattern start anywhere. Patterns of up to
+        // fixed_blocks blocks keep their bit vectors on the stack.
+
+        class MyersMatrix {
+        public:
+            MyersMatrix(const vector<uint64_t>& masks, size_t length, bool anchored);
+            MyersMatrix(const MyersMatrix&) = delete;
+            MyersMatrix& operator=(const MyersMatrix&) = delete;
+            size_t step(uint32_t symbol) noexcept;
+        private:
+            static constexpr size_t fixed_blocks = 4;
+            const uint64_t* peq;
+            size_t blocks;
+            uint64_t fixed[2 * fixed_blocks];
+            vector<uint64_t> heap;
+            uint64_t* pv;
+            uint64_t* mv;
+            unsigned last;
+            size_t score;
+            int top;
+        };
+
+        MyersMatrix::MyersMatrix(const vector<uint64_t>& masks, size_t length, bool anchored):
+        peq(masks.data()), blocks((length + 63) / 64), last((length - 1) % 64), score(length), top(anchored ? 1 : 0) {
+            if (blocks <= fixed_blocks) {
+                pv = fixed;
+            } else {
+                heap.resize(2 * blocks);
+                pv = heap.data();
+            }
+            mv = pv + blocks;
+            std::fill(pv, mv, ~ uint64_t(0));
+            std::fill(mv, mv + blocks, 0);
+        }
+
+        size_t MyersMatrix::step(uint32_t symbol) noexcept {
+            const uint64_t* eq = peq + symbol * blocks;
+            int h = top;
+            if (blocks == 1) {
+                h = myers_step(pv[0], mv[0], eq[0], h, last);
+            } else {
+                for (size_t b = 0; b < blocks; ++b)
+                    h = myers_step(pv[b], mv[b], eq[b], h, b + 1 < blocks ? 63 : last);
+            }
+            score = size_t(ptrdiff_t(score) + h);
+            return score;
+        }
+
+        // Calls f(key, n, offset, end) for each unit of comparison: a
+        // character or grapheme cluster, or with case folding each character
+        // of its full case folding, as a UTF-32 key of length n. Stops early
+        // if f returns false.
+
+        template <typename F>
+        void fuzzy_units(const u8string& str, size_t pos, uint32_t flags, F f) {
+            char32_t buf[max_case_decomposition];
+            auto b = utf_iterator(str, pos), e = utf_end(str);
+            if (flags & grapheme_units) {
+                u32string key;
+                for (auto g: grapheme_range(b, e)) {
+                    key.clear();
+                    for (auto c: g) {
+                        if (flags & fuzzy_casefold)
+                            key.append(buf, char_to_full_casefold(c, buf));
+                        else
+                            key += c;
+                    }
+                    if (! f(key.data(), key.size(), g.begin().offset(), g.end().offset()))
+                        return;
+                }
+            } else {
+                for (auto i = b; i != e; ++i) {
+                    size_t offset = i.offset(), end = offset + i.count();
+                    if (flags & fuzzy_casefold) {
+                        size_t n = char_to_full_casefold(*i, buf);
+                        for (size_t j = 0; j < n; ++j)
+                            if (! f(buf + j, 1, offset, end))
+                                return;
+                    } else {
+                        char32_t c = *i;
+                        if (! f(&c, 1, offset, end))
+                            return;
+                    }
+                }
+            }
+        }
+
+    }
+
     size_t str_common(const u8string& s1, const u8string& s2, size_t start) noexcept {
         if (start >= s1.size() || start >= s2.size())
             return 0;
@@ -167,8 +388,10 @@ namespace Unicorn {
     }
 
     Utf8Iterator str_search(const Utf8Iterator& b, const Utf8Iterator& e, const u8string& target) {
-        auto u_target = to_utf32(target);
-        return std::search(b, e, u_target.begin(), u_target.end());
+        auto& src = b.source();
+        size_t pos = b.offset(), size = e.offset() - pos;
+        size_t ofs = find_bytes(src.data() + pos, size, target.data(), target.size(), Factorization(target.data(), target.size()));
+        return ofs == npos ? e : utf_iterator(src, pos + ofs);
     }
 
     Utf8Iterator str_search(const Irange<Utf8Iterator>& range, const u8string& target) {
@@ -189,4 +412,405 @@ namespace Unicorn {
         return str_skipws(i, utf_end(i.source()));
     }
 
+    // Class StringSearch
+
+    StringSearch::StringSearch(const u8string& target):
+    pattern(target) {
+        Factorization f(pattern.data(), pattern.size());
+        suffix = f.suffix;
+        period = f.period;
+        periodic = f.periodic;
+    }
+
+    size_t StringSearch::find(const u8string& str, size_t pos) const noexcept {
+        if (pos > str.size())
+            return npos;
+        size_t ofs = find_bytes(str.data() + pos, str.size() - pos, pattern.data(), pattern.size(), {suffix, period, periodic});
+        return ofs == npos ? npos : pos + ofs;
+    }
+
+    Utf8Iterator StringSearch::search(const Utf8Iterator& b, const Utf8Iterator& e) const {
+        auto& src = b.source();
+        size_t pos = b.offset(), size = e.offset() - pos;
+        size_t ofs = find_bytes(src.data() + pos, size, pattern.data(), pattern.size(), {suffix, period, periodic});
+        return ofs == npos ? e : utf_iterator(src, pos + ofs);
+    }
+
+    // Class MultiSearch
+
+    // The patterns are compiled into an Aho-Corasick automaton over bytes.
+    // Since UTF-8 is self-synchronizing, byte matches of valid targets in
+    // valid text always fall on character boundaries. Bytes that appear in
+    // no target share a single input class, keeping the transition table
+    // small. Each state records the longest target that ends there, either
+    // directly or through its suffix links.
+
+    MultiSearch::MultiSearch(std::initializer_list<std::pair<u8string, u8string>> list) {
+        for (auto& p: list)
+            add_pattern(p);
+        build();
+    }
+
+    void MultiSearch::add(const u8string& target, const u8string& sub) {
+        targets.push_back(target);
+        subs.push_back(sub);
+        compiled = false;
+    }
+
+    void MultiSearch::compile() {
+        if (! compiled)
+            build();
+    }
+
+    size_t MultiSearch::count(const u8string& str) const {
+        size_t n = 0;
+        for (auto m = find(str); m; m = find(str, m.offset + m.length))
+            ++n;
+        return n;
+    }
+
+    MultiSearch::match MultiSearch::find(const u8string& str, size_t pos) const {
+        if (! compiled)
+            throw std::logic_error("MultiSearch patterns added without compile()");
+        match m;
+        if (depth.size() <= 1)
+            return m;
+        auto ptr = str.data();
+        size_t size = str.size();
+        uint32_t state = 0;
+        for (size_t i = pos; i < size; ++i) {
+            if (state == 0) {
+                i = skip(ptr, i, size);
+                if (i == size)
+                    break;
+            }
+            state = delta[state * nclasses + classes[uint8_t(ptr[i])]];
+            // No match starting at or before the current candidate can
+            // extend past this point
+            if (m && i + 1 - depth[state] > m.offset)
+                break;
+            if (out[state]) {
+                size_t index = out[state] - 1, length = targets[index].size(), offset = i + 1 - length;
+                if (! m || offset < m.offset || (offset == m.offset && length > m.length))
+                    m = {offset, length, index};
+            }
+        }
+        return m;
+    }
+
+    vector<MultiSearch::match> MultiSearch::find_all(const u8string& str) const {
+        vector<match> matches;
+        for (auto m = find(str); m; m = find(str, m.offset + m.length))
+            matches.push_back(m);
+        return matches;
+    }
+
+    u8string MultiSearch::replace(const u8string& str) const {
+        auto m = find(str);
+        if (! m)
+            return str;
+        u8string dst;
+        dst.reserve(str.size());
+        size_t pos = 0;
+        for (; m; m = find(str, pos)) {
+            dst.append(str, pos, m.offset - pos);
+            dst += subs[m.index];
+            pos = m.offset + m.length;
+        }
+        dst.append(str, pos, npos);
+        return dst;
+    }
+
+    void MultiSearch::replace_in(u8string& str) const {
+        auto result = replace(str);
+        str.swap(result);
+    }
+
+    void MultiSearch::build() {
+        classes.fill(0);
+        leads.fill(false);
+        nclasses = 1;
+        for (auto& t: targets) {
+            if (! t.empty())
+                leads[uint8_t(t[0])] = true;
+            for (char c: t)
+                if (classes[uint8_t(c)] == 0)
+                    classes[uint8_t(c)] = uint16_t(nclasses++);
+        }
+        lead = -1;
+        if (std::count(leads.begin(), leads.end(), true) == 1)
+            lead = int(std::find(leads.begin(), leads.end(), true) - leads.begin());
+        delta.assign(nclasses, 0);
+        depth.assign(1, 0);
+        out.assign(1, 0);
+        for (size_t i = 0; i < targets.size(); ++i) {
+            if (targets[i].empty())
+                continue;
+            uint32_t state = 0;
+            for (char c: targets[i]) {
+                size_t pos = state * nclasses + classes[uint8_t(c)];
+                if (delta[pos] == 0) {
+                    delta[pos] = uint32_t(depth.size());
+                    depth.push_back(depth[state] + 1);
+                    out.push_back(0);
+                    delta.resize(delta.size() + nclasses, 0);
+                }
+                state = delta[pos];
+            }
+            out[state] = uint32_t(i + 1);
+        }
+        vector<uint32_t> fail(depth.size(), 0), queue;
+        for (size_t c = 0; c < nclasses; ++c)
+            if (delta[c])
+                queue.push_back(delta[c]);
+        for (size_t q = 0; q < queue.size(); ++q) {
+            uint32_t u = queue[q];
+            for (size_t c = 0; c < nclasses; ++c) {
+                uint32_t v = delta[u * nclasses + c], f = delta[fail[u] * nclasses + c];
+                if (v) {
+                    fail[v] = f;
+                    if (out[v] == 0)
+                        out[v] = out[f];
+                    queue.push_back(v);
+                } else {
+                    delta[u * nclasses + c] = f;
+                }
+            }
+        }
+        compiled = true;
+    }
+
+    size_t MultiSearch::skip(const char* ptr, size_t pos, size_t size) const noexcept {
+        // From the initial state, skip directly to the next byte that can
+        // start a match
+        if (lead >= 0) {
+            auto p = static_cast<const char*>(std::memchr(ptr + pos, lead, size - pos));
+            return p ? p - ptr : size;
+        }
+        while (pos < size && ! leads[uint8_t(ptr[pos])])
+            ++pos;
+        return pos;
+    }
+
+    // Class LineIndex
+
+    // The index holds the offset of the start of each line. Line breaks are
+    // found in one pass, skipping ASCII blocks with no byte in the range
+    // LF-CR eight bytes at a time; non-ASCII characters are decoded, since
+    // NEL, LS, and PS are also line breaks. Lookups find the line by binary
+    // search, then measure the column from the start of that line only.
+
+    LineIndex::LineIndex():
+    LineIndex(empty_text()) {}
+
+    LineIndex::LineIndex(const u8string& str):
+    src(&str), starts{0} {
+        using namespace UnicornDetail;
+        const char* ptr = str.data();
+        size_t pos = 0, size = str.size();
+        while (pos < size) {
+            for (; pos + 8 <= size; pos += 8) {
+                auto w = swar_load(ptr + pos);
+                if (! swar_is_ascii(w) || swar_in_range(w, 0x0a, 0x0d))
+                    break;
+            }
+            if (pos == size)
+                break;
+            char32_t c = uint8_t(ptr[pos]);
+            if (c < 0x80) {
+                ++pos;
+            } else {
+                auto i = utf_iterator(str, pos);
+                c = *i;
+                pos += i.count();
+            }
+            if (char_is_line_break(c)) {
+                if (c == U'\r' && pos < size && ptr[pos] == '\n')
+                    ++pos;
+                starts.push_back(pos);
+            }
+        }
+    }
+
+    size_t LineIndex::line_offset(size_t line) const noexcept {
+        return line >= 1 && line <= starts.size() ? starts[line - 1] : npos;
+    }
+
+    void LineIndex::line_column(size_t offset, size_t& line, size_t& column, uint32_t flags) const {
+        offset = std::min(offset, src->size());
+        line = std::upper_bound(starts.begin(), starts.end(), offset) - starts.begin();
+        auto lstart = utf_iterator(*src, starts[line - 1]), i = lstart;
+        while (i.offset() < offset)
+            ++i;
+        if (i.offset() > offset)
+            --i;
+        column = str_length(lstart, i, flags) + 1;
+    }
+
+    size_t LineIndex::offset(size_t line, size_t column, uint32_t flags) const {
+        if (line < 1 || line > starts.size() || column < 1)
+            return npos;
+        bool last = line == starts.size();
+        size_t lstart = starts[line - 1], lend = last ? src->size() : starts[line];
+        auto b = utf_iterator(*src, lstart), e = utf_iterator(*src, lend);
+        auto rc = UnicornDetail::find_position(irange(b, e), column - 1, flags);
+        if (rc.second && (last || rc.first != e))
+            return rc.first.offset();
+        if (last)
+            return npos;
+        // Positions within the line break are measured as str_line_column()
+        // does, which for CR+LF is not on a grapheme boundary
+        auto i = std::prev(e);
+        if (*i == U'\n' && i != b && *std::prev(i) == U'\r')
+            --i;
+        for (; i != e; ++i)
+            if (str_length(b, i, flags) + 1 == column)
+                return i.offset();
+        return npos;
+    }
+
+    // Fuzzy matching
+
+    // The pattern is compiled into a bit mask for each distinct unit,
+    // marking where that unit occurs in the pattern; any unit that is not in
+    // the pattern matches nowhere and shares a single all-zero mask. ASCII
+    // characters are looked up in a direct table, other units in a sorted
+    // list. An approximate match is found by running the pattern unanchored
+    // until the score at the last pattern unit is within the limit, carrying
+    // on while the score keeps falling, then running the reversed pattern
+    // backwards from that point to find where the match starts.
+
+    size_t str_edit_distance(const u8string& s1, const u8string& s2, uint32_t flags) {
+        return FuzzySearch(s1, flags).distance(s2);
+    }
+
+    FuzzySearch::FuzzySearch(const u8string& pattern, uint32_t flags):
+    target(pattern), fuzzy_flags(flags) {
+        UnicornDetail::check_length_flags(flags);
+        ascii.fill(no_symbol);
+        vector<uint32_t> symbols;
+        uint32_t next = 0;
+        fuzzy_units(pattern, 0, fuzzy_flags, [&] (const char32_t* key, size_t n, size_t, size_t) {
+            if (n == 1 && key[0] < 0x80) {
+                if (ascii[key[0]] == no_symbol)
+                    ascii[key[0]] = next++;
+                symbols.push_back(ascii[key[0]]);
+            } else {
+                others.push_back({u32string(key, n), uint32_t(symbols.size())});
+                symbols.push_back(no_symbol);
+            }
+            return true;
+        });
+        length = symbols.size();
+        if (length == 0)
+            return;
+        // Other units are recorded by position until they have been sorted
+        std::stable_sort(others.begin(), others.end(),
+            [] (const std::pair<u32string, uint32_t>& a, const std::pair<u32string, uint32_t>& b) { return a.first < b.first; });
+        vector<std::pair<u32string, uint32_t>> distinct;
+        for (auto& o: others) {
+            if (distinct.empty() || distinct.back().first != o.first)
+                distinct.push_back({o.first, next++});
+            symbols[o.second] = distinct.back().second;
+        }
+        others.swap(distinct);
+        blocks = (length + 63) / 64;
+        forward.assign((next + 1) * blocks, 0);
+        backward.assign((next + 1) * blocks, 0);
+        for (size_t i = 0; i < length; ++i) {
+            size_t j = length - i - 1;
+            forward[symbols[i] * blocks + i / 64] |= uint64_t(1) << (i % 64);
+            backward[symbols[i] * blocks + j / 64] |= uint64_t(1) << (j % 64);
+        }
+    }
+
+    size_t FuzzySearch::distance(const u8string& str, size_t limit) const {
+        // A unit takes at least one byte, except that a two byte character
+        // can have a case folding three characters long
+        auto max_units = [=] (size_t bytes) { return fuzzy_flags & fuzzy_casefold ? bytes + bytes / 2 : bytes; };
+        if (length > limit && length - limit > max_units(str.size()))
+            return npos;
+        size_t count = 0, score = length;
+        if (length == 0) {
+            fuzzy_units(str, 0, fuzzy_flags, [&] (const char32_t*, size_t, size_t, size_t) {
+                return ++count <= limit;
+            });
+            return count <= limit ? count : npos;
+        }
+        MyersMatrix matrix(forward, length, true);
+        fuzzy_units(str, 0, fuzzy_flags, [&] (const char32_t* key, size_t n, size_t offset, size_t) {
+            score = matrix.step(symbol(key, n));
+            ++count;
+            // The score can fall by at most one for each unit left, and can
+            // never be less than the excess length of the text. Counting
+            // from the start of the current character allows for the rest
+            // of its case folding.
+            if ((count > length && count - length > limit)
+                    || (score > limit && score - limit > max_units(str.size() - offset))) {
+                score = npos;
+                return false;
+            }
+            return true;
+        });
+        return score <= limit ? score : npos;
+    }
+
+    FuzzySearch::match FuzzySearch::find(const u8string& str, size_t limit, size_t pos) const {
+        match m;
+        if (pos > str.size())
+            return m;
+        if (length == 0) {
+            m.offset = pos;
+            m.length = 0;
+            m.distance = 0;
+            return m;
+        }
+        // The match can be no longer than the pattern plus the distance,
+        // which is no more than the pattern length; the last units read are
+        // kept in a ring for the backward pass, with one to spare for the
+        // unit read after the end of the match
+        size_t best = length, count = 0, end = 0;
+        bool found = best <= limit;
+        vector<unit> ring(length + std::min(limit, length) + 1);
+        MyersMatrix matrix(forward, length, false);
+        fuzzy_units(str, pos, fuzzy_flags, [&] (const char32_t* key, size_t n, size_t offset, size_t e) {
+            uint32_t sym = symbol(key, n);
+            size_t score = matrix.step(sym);
+            ring[count++ % ring.size()] = {sym, offset, e};
+            if (found && score >= best)
+                return false;
+            if (found || score <= limit) {
+                found = true;
+                best = score;
+                end = count;
+            }
+            return true;
+        });
+        if (! found)
+            return m;
+        size_t start = end;
+        MyersMatrix back(backward, length, true);
+        size_t stop = end - std::min(end, length + best);
+        for (size_t j = end; j > stop; --j)
+            if (back.step(ring[(j - 1) % ring.size()].symbol) == best)
+                start = j - 1;
+        size_t last = end == 0 ? pos : ring[(end - 1) % ring.size()].end;
+        m.offset = start == end ? last : ring[start % ring.size()].offset;
+        m.length = last - m.offset;
+        m.distance = best;
+        return m;
+    }
+
+    uint32_t FuzzySearch::symbol(const char32_t* key, size_t n) const noexcept {
+        uint32_t other = uint32_t(forward.size() / blocks - 1);
+        if (n == 1 && key[0] < 0x80)
+            return ascii[key[0]] == no_symbol ? other : ascii[key[0]];
+        auto it = std::lower_bound(others.begin(), others.end(), std::make_pair(key, n),
+            [] (const std::pair<u32string, uint32_t>& a, const std::pair<const char32_t*, size_t>& b)
+                { return a.first.compare(0, npos, b.first, b.second) < 0; });
+        if (it != others.end() && it->first.compare(0, npos, key, n) == 0)
+            return it->second;
+        return other;
+    }
+
 }
@@ -3,6 +3,7 @@
 #include "unicorn/character.hpp"
 #include "unicorn/utf.hpp"
 #include "prion/unit-test.hpp"
+#include <algorithm>
 #include <string>
 
 using namespace std::literals;
@@ -64,10 +65,106 @@ namespace {
 
     }
 
+    u8string reference_casemap(const u8string& str, size_t (*f)(char32_t, char32_t*)) {
+        u8string dst;
+        char32_t buf[max_case_decomposition];
+        auto out = utf_writer(dst);
+        for (auto c: utf_range(str)) {
+            auto n = f(c, buf);
+            std::copy_n(buf, n, out);
+        }
+        return dst;
+    }
+
+    void check_in_place_conversions() {
+
+        u8string s, t;
+
+        TEST_EQUAL(str_uppercase(u8"Straße"s), u8"STRASSE");
+        TEST_EQUAL(str_uppercase(u8"abcdefghijklmnopqrstuvwxyz ßabcdefghijklmnopqrstuvwxyz"s),
+            u8"ABCDEFGHIJKLMNOPQRSTUVWXYZ SSABCDEFGHIJKLMNOPQRSTUVWXYZ");
+        TEST_EQUAL(str_uppercase(u8"@[`{ ÀÉÎõüÿ αβγ абв"s), u8"@[`{ ÀÉÎÕÜŸ ΑΒΓ АБВ");
+        TEST_EQUAL(str_lowercase(u8"ABCDEFGHIJKLMNOPQRSTUVWXYZ İABCDEFGHIJKLMNOPQRSTUVWXYZ"s),
+            u8"abcdefghijklmnopqrstuvwxyz i̇abcdefghijklmnopqrstuvwxyz");
+        TEST_EQUAL(str_lowercase(u8"@[`{ ÀÉÎõüŸ ΑΒΓ АБВ"s), u8"@[`{ àéîõüÿ αβγ абв");
+        TEST_EQUAL(str_casefold(u8"Straße ΜΆΪΟΣ µ"s), u8"strasse μάϊοσ μ");
+
+        TEST_EQUAL(str_lowercase(u8"ΟΔΟΣ"s), u8"οδος");
+        TEST_EQUAL(str_lowercase(u8"ΟΔΟΣ ΟΔΟΣ"s), u8"οδος οδος");
+        TEST_EQUAL(str_lowercase(u8"Σ ΑΣ. ΑΣΑ"s), u8"σ ας. ασα");
+        TEST_EQUAL(str_lowercase(u8"AΣ aΣ'b AΣ.. ZΣ"s), u8"aς aσ'b aς.. zς");
+        TEST_EQUAL(str_lowercase(u8"İΣ"s), u8"i̇ς");
+
+        s = u8"Straße";  TRY(str_uppercase_in(s));  TEST_EQUAL(s, u8"STRASSE");
+        s = u8"İstanbul ΟΔΟΣ";  TRY(str_lowercase_in(s));  TEST_EQUAL(s, u8"i̇stanbul οδος");
+        s = u8"ǅ Straße";  TRY(str_casefold_in(s));  TEST_EQUAL(s, u8"ǆ strasse");
+        s = "abc\xff\xc3" "DEF";  TRY(str_uppercase_in(s));  TEST_EQUAL(s, u8"ABC\ufffd\ufffdDEF");
+        s = "ABC\xe0\x80GHI";  TRY(str_lowercase_in(s));  TEST_EQUAL(s, u8"abc\ufffd\ufffdghi");
+
+        s = u8"already upper case?";
+        t = str_uppercase(s);
+        TRY(str_uppercase_in(t));
+        TEST_EQUAL(t, u8"ALREADY UPPER CASE?");
+        auto data = t.data();
+        TRY(str_uppercase_in(t));
+        TEST_EQUAL(t, u8"ALREADY UPPER CASE?");
+        TEST_EQUAL(static_cast<const void*>(t.data()), static_cast<const void*>(data));
+        TRY(str_lowercase_in(t));
+        TEST_EQUAL(t, u8"already upper case?");
+        TEST_EQUAL(static_cast<const void*>(t.data()), static_cast<const void*>(data));
+
+        TEST_EQUAL(str_titlecase(u8"ΟΔΟΣ ΟΔΟΣ.ΟΔΟΣ'Α"s), u8"Οδος Οδοσ.οδοσ'α");
+        TEST_EQUAL(str_titlecase(u8"aΣ\u0301 Σ\u0301b"s), u8"Aς\u0301 Σ\u0301b");
+
+        // Long runs of case ignorable characters after a sigma
+        const size_t n = 100000;
+        s = u8"AΣ" + str_chars(n, 0x301);
+        t = u8"aς" + str_chars(n, 0x301);
+        TEST_EQUAL(str_lowercase(s), t);
+        TRY(str_lowercase_in(s));
+        TEST_EQUAL(s, t);
+        s = u8"AΣ" + str_chars(n, 0x301) + u8"B";
+        t = u8"aσ" + str_chars(n, 0x301) + u8"b";
+        TEST_EQUAL(str_lowercase(s), t);
+        s = u8"İ" + s;
+        t = u8"i̇" + t;
+        TEST_EQUAL(str_lowercase(s), t);
+        s.clear();
+        t.clear();
+        for (size_t i = 0; i < n; ++i) {
+            s += u8"Σ'.";
+            t += i == n - 1 ? u8"ς'." : u8"σ'.";
+        }
+        TEST_EQUAL(str_lowercase(s), t);
+        s = u8"AΣ" + str_chars(n, U'.') + u8"ΣΣΣ";
+        t = u8"aσ" + str_chars(n, U'.') + u8"σσς";
+        TEST_EQUAL(str_lowercase(s), t);
+
+        for (char32_t c = 0x80; c < 0x3000; ++c) {
+            if (char_is_surrogate(c))
+                continue;
+            s = u8"Aa" + str_chars(5, c) + u8"Aa0123456789Aa";
+            TEST_EQUAL(str_uppercase(s), reference_casemap(s, char_to_full_uppercase));
+            TEST_EQUAL(str_casefold(s), reference_casemap(s, char_to_full_casefold));
+            TEST_EQUAL(str_lowercase(s), reference_casemap(s, char_to_full_lowercase));
+        }
+
+        s = u8"Straße ΟΔΟΣ";
+        t = "Previous contents";
+        TRY(str_uppercase(s, t));  TEST_EQUAL(t, u8"STRASSE ΟΔΟΣ");
+        TRY(str_lowercase(s, t));  TEST_EQUAL(t, u8"straße οδος");
+        TRY(str_titlecase(s, t));  TEST_EQUAL(t, u8"Straße Οδος");
+        TRY(str_casefold(s, t));   TEST_EQUAL(t, u8"strasse οδοσ");
+        TRY(str_titlecase(t, t));  TEST_EQUAL(t, u8"Strasse Οδος");
+        TRY(str_uppercase(t, t));  TEST_EQUAL(t, u8"STRASSE ΟΔΟΣ");
+
+    }
+
 }
 
 TEST_MODULE(unicorn, string_case) {
 
     check_case_conversions();
+    check_in_place_conversions();
 
 }
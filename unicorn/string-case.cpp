@@ -4,92 +4,264 @@ namespace Unicorn {
 
     namespace {
 
-        template <typename F>
-        const u8string casemap_helper(const u8string& src, F f) {
-            u8string dst;
-            char32_t buf[max_case_decomposition];
-            auto out = utf_writer(dst);
-            for (auto c: utf_range(src)) {
-                auto n = f(c, buf);
-                std::copy_n(buf, n, out);
-            }
-            return dst;
-        }
+        using namespace UnicornDetail;
 
-        template <typename FwdIter>
-        bool next_cased(FwdIter i, FwdIter e) {
-            if (i == e)
-                return false;
-            for (++i; i != e; ++i)
-                if (! char_is_case_ignorable(*i))
-                    return char_is_cased(*i);
-            return false;
-        }
+        // Case mappings for casemap_in(). Each one supplies the range of
+        // ASCII letters it changes, a hook that sees every ASCII run, the
+        // full mapping for other characters, and a hook called at the end
+        // of the string. The hooks are also given the output buffer (null
+        // if the output is only being measured) and the output offset.
+
+        struct UpperMap {
+            static constexpr char ascii_first = 'a', ascii_last = 'z';
+            void ascii(const char* /*ptr*/, size_t /*n*/, char* /*out*/) noexcept {}
+            size_t operator()(char32_t c, char32_t* dst, char* /*out*/, size_t /*pos*/) noexcept
+                { return char_to_full_uppercase(c, dst); }
+            void finish(char* /*out*/) noexcept {}
+        };
+
+        // The Final_Sigma condition depends on the characters on both sides
+        // of a sigma, skipping case ignorable characters. Rather than
+        // looking ahead, an undecided sigma is written in its normal form
+        // and patched to the final form if the next character that is not
+        // case ignorable turns out not to be cased. Both forms are the
+        // same length in UTF-8, differing only in the last byte.
 
-        struct LowerChar {
+        struct LowerMap {
+            static constexpr char ascii_first = 'A', ascii_last = 'Z';
             static constexpr char32_t sigma = 0x3c3;
-            static constexpr char32_t final_sigma = 0x3c2;
+            static constexpr char final_sigma_byte = '\x82';
             bool last_cased = false;
-            char32_t buf[max_case_decomposition];
-            template <typename FwdIter, typename OutIter> void convert(FwdIter i, FwdIter e, OutIter to) {
-                auto n = char_to_full_lowercase(*i, buf);
-                if (buf[0] == sigma && last_cased && ! next_cased(i, e))
-                    buf[0] = final_sigma;
-                std::copy_n(buf, n, to);
-                if (! char_is_case_ignorable(*i))
-                    last_cased = char_is_cased(*i);
+            size_t pending = npos; // Output offset of an undecided sigma
+            static bool ascii_case_ignorable(char c) noexcept
+                { return c == '\'' || c == '.' || c == ':' || c == '^' || c == '`'; }
+            void resolve(bool cased, char* out) noexcept {
+                if (pending != npos) {
+                    if (! cased && out)
+                        out[pending + 1] = final_sigma_byte;
+                    pending = npos;
+                }
+            }
+            void next(char32_t c, char* out) noexcept {
+                if (! char_is_case_ignorable(c)) {
+                    bool cased = char_is_cased(c);
+                    resolve(cased, out);
+                    last_cased = cased;
+                }
+            }
+            void ascii(const char* ptr, size_t n, char* out) noexcept {
+                size_t i = 0, j = n;
+                while (i < n && ascii_case_ignorable(ptr[i]))
+                    ++i;
+                if (i == n)
+                    return;
+                resolve(ascii_isalpha(ptr[i]), out);
+                while (ascii_case_ignorable(ptr[j - 1]))
+                    --j;
+                last_cased = ascii_isalpha(ptr[j - 1]);
             }
+            size_t operator()(char32_t c, char32_t* dst, char* out, size_t pos) noexcept {
+                auto n = char_to_full_lowercase(c, dst);
+                bool undecided = dst[0] == sigma && last_cased;
+                next(c, out);
+                if (undecided)
+                    pending = pos;
+                return n;
+            }
+            void finish(char* out) noexcept { resolve(false, out); }
+        };
+
+        struct FoldMap {
+            static constexpr char ascii_first = 'A', ascii_last = 'Z';
+            void ascii(const char* /*ptr*/, size_t /*n*/, char* /*out*/) noexcept {}
+            size_t operator()(char32_t c, char32_t* dst, char* /*out*/, size_t /*pos*/) noexcept
+                { return char_to_full_casefold(c, dst); }
+            void finish(char* /*out*/) noexcept {}
         };
 
+        constexpr size_t max_casemap_units = max_case_decomposition * UtfEncoding<char>::max_units;
+
+        size_t ascii_run_end(const char* ptr, size_t i, size_t n) noexcept {
+            for (; i + 8 <= n && swar_is_ascii(swar_load(ptr + i)); i += 8) {}
+            while (i < n && uint8_t(ptr[i]) < 0x80)
+                ++i;
+            return i;
+        }
+
+        template <typename Map>
+        void ascii_casemap(char* ptr, size_t n) noexcept {
+            // Every byte is ASCII here, so flipping bit 5 of each letter in
+            // the range converts it, and unchanged words are never written
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                auto w = swar_load(ptr + i);
+                auto mask = swar_in_range(w, Map::ascii_first, Map::ascii_last);
+                if (mask)
+                    swar_store(ptr + i, w ^ (mask >> 2));
+            }
+            for (; i < n; ++i)
+                if (ptr[i] >= Map::ascii_first && ptr[i] <= Map::ascii_last)
+                    ptr[i] ^= 0x20;
+        }
+
+        // Map the (non-ASCII) character at src[pos], writing its encoding
+        // to enc and the number of source bytes consumed to units, and
+        // return the number of bytes written
+
+        template <typename Map>
+        size_t casemap_char(const u8string& src, size_t pos, Map& map, char* out, size_t opos, char* enc, size_t& units) {
+            char32_t c, buf[max_case_decomposition];
+            units = UtfEncoding<char>::decode(src.data() + pos, src.size() - pos, c);
+            if (! char_is_unicode(c))
+                c = replacement_char;
+            auto n = map(c, buf, out, opos);
+            size_t len = 0;
+            for (size_t k = 0; k < n; ++k)
+                len += UtfEncoding<char>::encode(buf[k], enc + len);
+            return len;
+        }
+
+        template <typename Map>
+        void casemap_in(u8string& str, Map map) {
+            // Convert in place for as long as every mapped character has
+            // the same encoded length as the original, which covers most
+            // text; bytes that are already in the target case are left
+            // untouched.
+            auto ptr = &str[0];
+            size_t i = 0, n = str.size(), units = 0;
+            char enc[max_casemap_units];
+            while (i < n) {
+                auto j = ascii_run_end(ptr, i, n);
+                if (j > i) {
+                    ascii_casemap<Map>(ptr + i, j - i);
+                    map.ascii(ptr + i, j - i, ptr);
+                    i = j;
+                    if (i == n)
+                        break;
+                }
+                auto saved = map;
+                auto len = casemap_char(str, i, map, ptr, i, enc, units);
+                if (len != units) {
+                    map = saved;
+                    break;
+                }
+                if (std::memcmp(ptr + i, enc, len) != 0)
+                    std::memcpy(ptr + i, enc, len);
+                i += units;
+            }
+            if (i == n) {
+                map.finish(ptr);
+                return;
+            }
+            // Otherwise measure the rest of the output first, so the result
+            // needs only a single allocation
+            auto saved = map;
+            size_t size = i;
+            for (size_t k = i; k < n;) {
+                auto j = ascii_run_end(ptr, k, n);
+                size += j - k;
+                k = j;
+                if (k < n) {
+                    size += casemap_char(str, k, map, nullptr, size, enc, units);
+                    k += units;
+                }
+            }
+            map = saved;
+            u8string dst;
+            dst.reserve(size);
+            dst.append(str, 0, i);
+            for (size_t k = i; k < n;) {
+                auto j = ascii_run_end(ptr, k, n);
+                if (j > k) {
+                    auto m = dst.size();
+                    dst.append(ptr + k, j - k);
+                    ascii_casemap<Map>(&dst[m], j - k);
+                    map.ascii(ptr + k, j - k, &dst[0]);
+                    k = j;
+                }
+                if (k < n) {
+                    auto len = casemap_char(str, k, map, &dst[0], dst.size(), enc, units);
+                    dst.append(enc, len);
+                    k += units;
+                }
+            }
+            map.finish(&dst[0]);
+            str.swap(dst);
+        }
+
     }
 
     u8string str_uppercase(const u8string& str) {
-        return casemap_helper(str, char_to_full_uppercase);
+        u8string dst = str;
+        casemap_in(dst, UpperMap());
+        return dst;
     }
 
     u8string str_lowercase(const u8string& str) {
-        u8string dst;
-        LowerChar lc;
-        auto range = utf_range(str);
-        auto out = utf_writer(dst);
-        for (auto i = range.begin(), e = range.end(); i != e; ++i)
-            lc.convert(i, e, out);
+        u8string dst = str;
+        casemap_in(dst, LowerMap());
         return dst;
     }
 
     u8string str_titlecase(const u8string& str) {
         u8string dst;
-        LowerChar lc;
-        auto e = utf_end(str);
+        str_titlecase(str, dst);
+        return dst;
+    }
+
+    u8string str_casefold(const u8string& str) {
+        u8string dst = str;
+        casemap_in(dst, FoldMap());
+        return dst;
+    }
+
+    void str_uppercase(const u8string& str, u8string& dst) {
+        dst.assign(str);
+        casemap_in(dst, UpperMap());
+    }
+
+    void str_lowercase(const u8string& str, u8string& dst) {
+        dst.assign(str);
+        casemap_in(dst, LowerMap());
+    }
+
+    void str_titlecase(const u8string& str, u8string& dst) {
+        if (&str == &dst) {
+            str_titlecase_in(dst);
+            return;
+        }
+        dst.clear();
+        LowerMap lower;
+        char32_t buf[max_case_decomposition];
         auto out = utf_writer(dst);
         for (auto& w: word_range(str)) {
             bool initial = true;
-            for (auto i = w.begin(); i != w.end(); ++i) {
-                if (initial && char_is_cased(*i)) {
-                    auto n = char_to_full_titlecase(*i, lc.buf);
-                    std::copy_n(lc.buf, n, out);
-                    lc.last_cased = true;
+            for (auto c: w) {
+                size_t n;
+                if (initial && char_is_cased(c)) {
+                    n = char_to_full_titlecase(c, buf);
+                    lower.next(c, &dst[0]);
                     initial = false;
                 } else {
-                    lc.convert(i, e, out);
+                    n = lower(c, buf, &dst[0], dst.size());
                 }
+                std::copy_n(buf, n, out);
             }
         }
-        return dst;
+        lower.finish(&dst[0]);
     }
 
-    u8string str_casefold(const u8string& str) {
-        return casemap_helper(str, char_to_full_casefold);
+    void str_casefold(const u8string& str, u8string& dst) {
+        dst.assign(str);
+        casemap_in(dst, FoldMap());
     }
 
     void str_uppercase_in(u8string& str) {
-        auto result = str_uppercase(str);
-        str.swap(result);
+        casemap_in(str, UpperMap());
     }
 
     void str_lowercase_in(u8string& str) {
-        auto result = str_lowercase(str);
-        str.swap(result);
+        casemap_in(str, LowerMap());
     }
 
     void str_titlecase_in(u8string& str) {
@@ -98,8 +270,7 @@ namespace Unicorn {
     }
 
     void str_casefold_in(u8string& str) {
-        auto result = str_casefold(str);
-        str.swap(result);
+        casemap_in(str, FoldMap());
     }
 
 }
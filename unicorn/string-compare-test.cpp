@@ -1,7 +1,11 @@
 #include "unicorn/string.hpp"
 #include "unicorn/core.hpp"
 #include "prion/unit-test.hpp"
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 using namespace std::literals;
 using namespace Unicorn;
@@ -66,6 +70,63 @@ namespace {
 
     }
 
+    void check_icase_fast_path() {
+
+        std::vector<u8string> list = {
+            u8"", u8"a", u8"A", u8"b", u8"[", u8"_", u8"hello world", u8"HELLO WORLD", u8"Hello World!",
+            u8"the quick brown fox", u8"THE QUICK BROWN FOX", u8"The Quick Brown Fox Jumps",
+            u8"the quick brown foé", u8"THE QUICK BROWN FOÉ", u8"the quick brown féx",
+            u8"strasse", u8"STRASSE", u8"straße", u8"STRAßE", u8"straßa", u8"strasz",
+            u8"K", u8"k", u8"K", u8"ſ", u8"s", u8"S", u8"Σα", u8"σΑ",
+            u8"abcdefghé", u8"ABCDEFGHÉ", u8"ABCDEFGHÉi", u8"abcdefghijklmnop", u8"ABCDEFGHIJKLMNOp",
+        };
+
+        for (auto& x: list) {
+            for (auto& y: list) {
+                auto fx = str_casefold(x), fy = str_casefold(y);
+                TEST_EQUAL(str_icase_equal(x, y), fx == fy);
+                TEST_EQUAL(str_icase_compare(x, y), fx < fy);
+                if (fx == fy)
+                    TEST_EQUAL(str_icase_hash(x), str_icase_hash(y));
+                CaseFoldKey kx(x), ky(y);
+                TEST_EQUAL(kx == ky, fx == fy);
+                TEST_EQUAL(kx < ky, fx < fy);
+                TEST_EQUAL(CaseFoldLess()(kx, y), fx < fy);
+                TEST_EQUAL(CaseFoldLess()(x, ky), fx < fy);
+                TEST_EQUAL(CaseFoldEqual()(kx, y), fx == fy);
+            }
+        }
+
+        CaseFoldKey key;
+        TEST_EQUAL(key.str(), u8"");
+        TEST_EQUAL(key.key(), u8"");
+        TEST_EQUAL(key.hash(), str_icase_hash(u8""));
+        TRY(key = u8"Straße");
+        TEST_EQUAL(key.str(), u8"Straße");
+        TEST_EQUAL(key.key(), u8"strasse");
+        TEST_EQUAL(key.hash(), str_icase_hash(u8"STRASSE"));
+
+        std::unordered_map<CaseFoldKey, int, CaseFoldHash, CaseFoldEqual> hmap;
+        TRY((hmap["Content-Type"] = 1));
+        TRY((hmap["CONTENT-LENGTH"] = 2));
+        TRY((hmap["content-type"] = 3));
+        TEST_EQUAL(hmap.size(), 2);
+        TEST_EQUAL(hmap["CONTENT-TYPE"], 3);
+        TEST_EQUAL(hmap["content-length"], 2);
+
+        std::unordered_set<u8string, CaseFoldHash, CaseFoldEqual> hset = {u8"Alpha", u8"ALPHA", u8"Kelvin", u8"kelvin"};
+        TEST_EQUAL(hset.size(), 2);
+        TEST_EQUAL(hset.count(u8"alpha"), 1);
+        TEST_EQUAL(hset.count(u8"KELVIN"), 1);
+
+        std::set<CaseFoldKey, CaseFoldLess> tset = {"Zulu", "alpha", "BRAVO", "Alpha"};
+        TEST_EQUAL(tset.size(), 3);
+        TEST_EQUAL(tset.begin()->str(), u8"alpha");
+        TEST(tset.find(u8"bravo"s) != tset.end());
+        TEST(tset.find(u8"charlie"s) == tset.end());
+
+    }
+
     void check_natural_compare() {
 
         u8string s0 = "";
@@ -96,12 +157,36 @@ namespace {
 
     }
 
+    void check_natural_sort_key() {
+
+        std::vector<u8string> list = {
+            u8"", u8"abc 123", u8"abc 45", u8"ABC 67", u8"abc 000123", u8"abc 123 xyz", u8"abc 123 456", u8"+abc 123",
+            u8"0", u8"00", u8"000", u8"1", u8"01", u8"9", u8"10", u8"099", u8"100", u8"12345678901234567890",
+            u8"a", u8"A", u8"a1", u8"a01", u8"a1b", u8"a1b2", u8"a10b", u8"a 1", u8"a-1", u8"1a", u8"-", u8"--",
+            u8"file9.txt", u8"file10.txt", u8"File9.TXT", u8"file09.txt", u8"file9.txt.bak", u8"file9.tar.gz",
+            u8"Straße 5", u8"STRASSE 5", u8"strasse 05", u8"Ärger", u8"ärger", u8"zebra", u8"ZEBRA2",
+            u8"x" + u8string(300, '7'), u8"x" + u8string(299, '7'), u8"x" + u8string(256, '1'),
+        };
+
+        for (auto& x: list) {
+            auto kx = str_natural_sort_key(x);
+            for (auto& y: list) {
+                auto ky = str_natural_sort_key(y);
+                TEST_EQUAL(kx < ky, str_natural_compare(x, y));
+                TEST_EQUAL(kx == ky, x == y);
+            }
+        }
+
+    }
+
 }
 
 TEST_MODULE(unicorn, string_compare) {
 
     check_compare_3way();
     check_icase_compare();
+    check_icase_fast_path();
     check_natural_compare();
+    check_natural_sort_key();
 
 }
@@ -12,66 +12,98 @@ namespace Unicorn {
             return size1 < size2 ? -1 : size1 == size2 ? 0 : 1;
     }
 
-    bool str_icase_compare(const u8string& lhs, const u8string& rhs) noexcept {
-        if (lhs.empty() || rhs.empty())
-            return ! rhs.empty();
-        auto u1 = utf_range(lhs), u2 = utf_range(rhs);
-        auto i1 = u1.begin(), i2 = u2.begin();
-        char32_t buf1[max_case_decomposition], buf2[max_case_decomposition];
-        size_t p1 = 0, p2 = 0;
-        size_t n1 = char_to_full_casefold(*i1, buf1);
-        size_t n2 = char_to_full_casefold(*i2, buf2);
-        for (;;) {
-            if (p1 == n1) {
-                p1 = 0;
-                if (++i1 != u1.end())
-                    n1 = char_to_full_casefold(*i1, buf1);
+    namespace {
+
+        using namespace UnicornDetail;
+
+        uint64_t swar_ascii_fold(uint64_t w) noexcept {
+            return w | (swar_in_range(w, 'A', 'Z') >> 2);
+        }
+
+        // Length of the leading run that is ASCII in both strings and
+        // equal apart from case
+
+        size_t icase_ascii_prefix(const u8string& lhs, const u8string& rhs) noexcept {
+            auto p1 = lhs.data(), p2 = rhs.data();
+            size_t i = 0, n = std::min(lhs.size(), rhs.size());
+            for (; i + 8 <= n; i += 8) {
+                auto w1 = swar_load(p1 + i), w2 = swar_load(p2 + i);
+                if (! swar_is_ascii(w1 | w2) || swar_ascii_fold(w1) != swar_ascii_fold(w2))
+                    break;
             }
-            if (p2 == n2) {
-                p2 = 0;
-                if (++i2 != u2.end())
-                    n2 = char_to_full_casefold(*i2, buf2);
+            while (i < n && uint8_t(p1[i] | p2[i]) < 0x80 && ascii_tolower(p1[i]) == ascii_tolower(p2[i]))
+                ++i;
+            return i;
+        }
+
+        int icase_compare_3way(const u8string& lhs, const u8string& rhs) noexcept {
+            // No character case folds to an empty string, so a string that
+            // runs out first is the lesser
+            size_t k = icase_ascii_prefix(lhs, rhs);
+            if (k == lhs.size() || k == rhs.size())
+                return k < rhs.size() ? -1 : k < lhs.size() ? 1 : 0;
+            if (uint8_t(lhs[k] | rhs[k]) < 0x80)
+                return ascii_tolower(lhs[k]) < ascii_tolower(rhs[k]) ? -1 : 1;
+            auto i1 = Utf8Iterator(lhs, k), e1 = utf_end(lhs), i2 = Utf8Iterator(rhs, k), e2 = utf_end(rhs);
+            char32_t buf1[max_case_decomposition], buf2[max_case_decomposition];
+            size_t p1 = 0, p2 = 0;
+            size_t n1 = char_to_full_casefold(*i1, buf1);
+            size_t n2 = char_to_full_casefold(*i2, buf2);
+            for (;;) {
+                if (p1 == n1) {
+                    p1 = 0;
+                    if (++i1 != e1)
+                        n1 = char_to_full_casefold(*i1, buf1);
+                }
+                if (p2 == n2) {
+                    p2 = 0;
+                    if (++i2 != e2)
+                        n2 = char_to_full_casefold(*i2, buf2);
+                }
+                bool end1 = p1 == 0 && i1 == e1, end2 = p2 == 0 && i2 == e2;
+                if (end1 || end2)
+                    return end2 ? (end1 ? 0 : 1) : -1;
+                if (buf1[p1] != buf2[p2])
+                    return buf1[p1] < buf2[p2] ? -1 : 1;
+                ++p1;
+                ++p2;
             }
-            if ((p1 == 0 && i1 == u1.end()) || (p2 == 0 && i2 == u2.end()))
-                return i2 != u2.end();
-            if (buf1[p1] != buf2[p2])
-                return buf1[p1] < buf2[p2];
-            ++p1;
-            ++p2;
         }
+
+    }
+
+    bool str_icase_compare(const u8string& lhs, const u8string& rhs) noexcept {
+        return icase_compare_3way(lhs, rhs) < 0;
     }
 
     bool str_icase_equal(const u8string& lhs, const u8string& rhs) noexcept {
-        if (lhs.empty() && rhs.empty())
-            return true;
-        if (lhs.size() != rhs.size())
-            return false;
-        auto u1 = utf_range(lhs), u2 = utf_range(rhs);
-        auto i1 = u1.begin(), i2 = u2.begin();
-        char32_t buf1[max_case_decomposition], buf2[max_case_decomposition];
-        size_t p1 = 0, p2 = 0;
-        size_t n1 = char_to_full_casefold(*i1, buf1);
-        size_t n2 = char_to_full_casefold(*i2, buf2);
-        for (;;) {
-            if (p1 == n1) {
-                p1 = 0;
-                if (++i1 != u1.end())
-                    n1 = char_to_full_casefold(*i1, buf1);
-            }
-            if (p2 == n2) {
-                p2 = 0;
-                if (++i2 != u2.end())
-                    n2 = char_to_full_casefold(*i2, buf2);
+        return icase_compare_3way(lhs, rhs) == 0;
+    }
+
+    size_t str_icase_hash(const u8string& str) noexcept {
+        // FNV-1a over the case folded code points
+        constexpr uint64_t basis = 0xcbf29ce484222325ull, prime = 0x100000001b3ull;
+        auto ptr = str.data();
+        size_t i = 0, n = str.size();
+        uint64_t h = basis;
+        char32_t c, buf[max_case_decomposition];
+        while (i < n) {
+            if (uint8_t(ptr[i]) < 0x80) {
+                h = (h ^ uint8_t(ascii_tolower(ptr[i]))) * prime;
+                ++i;
+            } else {
+                i += UtfEncoding<char>::decode_fast(ptr + i, n - i, c);
+                auto k = char_to_full_casefold(c, buf);
+                for (size_t j = 0; j < k; ++j)
+                    h = (h ^ buf[j]) * prime;
             }
-            if ((p1 == 0 && i1 == u1.end()) || (p2 == 0 && i2 == u2.end()))
-                return i1 == u1.end() && i2 == u2.end();
-            if (buf1[p1] != buf2[p2])
-                return false;
-            ++p1;
-            ++p2;
         }
+        return size_t(h);
     }
 
+    CaseFoldKey::CaseFoldKey(const u8string& str):
+    text(str), fold(str_casefold(str)), code(str_icase_hash(str)) {}
+
     namespace {
 
         bool char_is_ascii_digit(char32_t c) noexcept {
@@ -165,4 +197,37 @@ namespace Unicorn {
             return lhs < rhs;
     }
 
+    u8string str_natural_sort_key(const u8string& str) {
+        // Each segment is a type byte (1 for a number, 2 for text) and its
+        // cooked form. Numbers are prefixed with their length (number of
+        // length bytes, then the big-endian length), so that longer
+        // numbers sort later; text is terminated with a null, which can't
+        // occur in the cooked text. A null then ends the segment list, and
+        // the original string follows as the tie breaker.
+        u8string key;
+        auto b = utf_begin(str), e = utf_end(str);
+        NaturalSegmentIterator i(b, e), end(e, e);
+        for (; i != end; ++i) {
+            auto& cooked = i->cooked;
+            if (i->is_number) {
+                key += '\1';
+                char len[sizeof(size_t)];
+                size_t n = 0;
+                for (size_t size = cooked.size(); size != 0; size >>= 8)
+                    len[n++] = char(size & 0xff);
+                key += char(n);
+                while (n != 0)
+                    key += len[--n];
+                key += cooked;
+            } else {
+                key += '\2';
+                key += cooked;
+                key += '\0';
+            }
+        }
+        key += '\0';
+        key += str;
+        return key;
+    }
+
 }
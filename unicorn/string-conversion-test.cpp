@@ -3,7 +3,10 @@
 #include "unicorn/character.hpp"
 #include "unicorn/utf.hpp"
 #include "prion/unit-test.hpp"
+#include <cmath>
+#include <cstdlib>
 #include <limits>
+#include <random>
 #include <stdexcept>
 #include <string>
 
@@ -105,6 +108,17 @@ namespace {
         TEST_EQUAL(str_to_int<uint64_t>("18446744073709551614"s), std::numeric_limits<uint64_t>::max() - 1);
         TEST_EQUAL(str_to_int<uint64_t>("18446744073709551615"s), std::numeric_limits<uint64_t>::max());
         TEST_EQUAL(str_to_int<uint64_t>("18446744073709551616"s), std::numeric_limits<uint64_t>::max());
+        TEST_EQUAL(str_to_int<int64_t>("99999999999999999999999"s), std::numeric_limits<int64_t>::max());
+        TEST_EQUAL(str_to_int<int64_t>("-99999999999999999999999"s), std::numeric_limits<int64_t>::min());
+        TEST_EQUAL(str_to_int<uint64_t>("99999999999999999999999"s), std::numeric_limits<uint64_t>::max());
+        TEST_EQUAL(str_to_int<uint64_t>("-1"s), std::numeric_limits<uint64_t>::max());
+        TEST_EQUAL(str_to_int<uint32_t>("-1"s), std::numeric_limits<uint32_t>::max());
+        TEST_EQUAL(str_to_int<int32_t>("-0"s), 0);
+        TEST_EQUAL(str_to_int<uint32_t>("-0"s), 0);
+        TEST_EQUAL(str_to_int<int32_t>("+-42"s), 0);
+        TEST_EQUAL(str_to_int<int32_t>("0042"s), 42);
+        s = "12-34";  TEST_EQUAL(str_to_int(i32, s), 2);  TEST_EQUAL(i32, 12);
+        s = "-";      TEST_EQUAL(str_to_int(i32, s), 0);  TEST_EQUAL(i32, 0);
 
         TEST_THROW(str_to_int<int8_t>(""s, err_throw), std::invalid_argument);
         TEST_THROW(str_to_int<int8_t>("hello"s, err_throw), std::invalid_argument);
@@ -258,6 +272,14 @@ namespace {
         TEST_THROW(hex_to_int<uint64_t>("10000000000000000"s, err_throw), std::range_error);
         TEST_THROW(hex_to_int<uint64_t>("42xyz"s, err_throw), std::invalid_argument);
 
+        int i = 0;
+        unsigned u = 0;
+
+        s = "0x1f";  TEST_EQUAL(hex_to_int(i, s), 1);  TEST_EQUAL(i, 0);
+        s = "+7F";   TEST_EQUAL(hex_to_int(i, s), 3);  TEST_EQUAL(i, 127);
+        s = "-7f";   TEST_EQUAL(hex_to_int(u, s), 3);  TEST_EQUAL(u, std::numeric_limits<unsigned>::max());
+        s = "fg";    TEST_EQUAL(hex_to_int(i, s), 1);  TEST_EQUAL(i, 15);
+
     }
 
     void check_floating_point_conversion() {
@@ -309,6 +331,49 @@ namespace {
         s = "123456.75";  TEST_EQUAL(str_to_float<double>(utf_iterator(s, 3)), 456.75);
         s = "answer 42";  TEST_EQUAL(str_to_float<double>(utf_iterator(s, 7)), 42);
 
+        TEST_EQUAL(str_to_float<double>("5."s), 5);
+        TEST_EQUAL(str_to_float<double>(".5"s), 0.5);
+        TEST_EQUAL(str_to_float<double>("5.e1"s), 50);
+        TEST_EQUAL(str_to_float<double>("5e"s), 5);
+        TEST_EQUAL(str_to_float<double>("5e+"s), 5);
+        TEST_EQUAL(str_to_float<double>("0.1"s), 0.1);
+        TEST_EQUAL(str_to_float<double>("0e9999"s), 0);
+        TEST_EQUAL(str_to_float<double>("9007199254740993"s), 9007199254740992.0);
+        TEST_EQUAL(str_to_float<double>("123456789012345678901234567890"s), 123456789012345678901234567890.0);
+        TEST_EQUAL(str_to_float<double>("0.000000000000000000000000000001"s), 1e-30);
+        TEST_EQUAL(str_to_float<double>("2.2250738585072014e-308"s), 2.2250738585072014e-308);
+        TEST_EQUAL(str_to_float<float>("16777217"s), 16777216.0f);
+        TEST_EQUAL(str_to_float<float>("3.4028235e38"s), 3.4028235e38f);
+        s = "-.";     TEST_EQUAL(str_to_float(d, s), 0);  TEST_EQUAL(d, 0);
+        s = "1.5.3";  TEST_EQUAL(str_to_float(d, s), 3);  TEST_EQUAL(d, 1.5);
+        s = "2e3e4";  TEST_EQUAL(str_to_float(d, s), 3);  TEST_EQUAL(d, 2000);
+
+        // Cross check against strtod() and strtof() in the C locale
+
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> digit(0, 9), length(1, 25), exp(-330, 330), form(0, 3);
+        for (int i = 0; i < 10000; ++i) {
+            u8string text;
+            if (form(rng) == 0)
+                text += '-';
+            int n = length(rng), point = std::uniform_int_distribution<int>(0, n)(rng);
+            for (int j = 0; j < n; ++j) {
+                if (j == point)
+                    text += '.';
+                text += char('0' + digit(rng));
+            }
+            if (form(rng) != 0)
+                text += 'e' + dec(form(rng) == 1 ? exp(rng) / 10 : exp(rng));
+            double expect_d = strtod(text.data(), nullptr);
+            float expect_f = strtof(text.data(), nullptr);
+            if (std::isinf(expect_d))
+                expect_d = expect_d > 0 ? std::numeric_limits<double>::max() : - std::numeric_limits<double>::max();
+            if (std::isinf(expect_f))
+                expect_f = expect_f > 0 ? std::numeric_limits<float>::max() : - std::numeric_limits<float>::max();
+            TEST_EQUAL(str_to_float<double>(text), expect_d);
+            TEST_EQUAL(str_to_float<float>(text), expect_f);
+        }
+
     }
 
 }
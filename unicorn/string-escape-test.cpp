@@ -1,13 +1,113 @@
 #include "unicorn/string.hpp"
 #include "unicorn/core.hpp"
 #include "prion/unit-test.hpp"
+#include <algorithm>
+#include <cstring>
+#include <random>
 #include <string>
+#include <vector>
 
 using namespace std::literals;
 using namespace Unicorn;
 
 namespace {
 
+    // The original one character at a time implementations, kept as a
+    // reference for the block scanning versions
+
+    namespace Reference {
+
+        constexpr const char* hexdigits = "0123456789abcdef";
+        constexpr const char* uri_comp_escaped = "!\"#$%&'()*+,/:;<=>?@[\\]^`{|}";
+        constexpr const char* uri_full_escaped = "\"%<>\\^`{|}";
+
+        void append_hex_digits(uint32_t x, u8string& dst) {
+            size_t pos = dst.size();
+            do {
+                dst += hexdigits[x % 16];
+                x /= 16;
+            } while (x != 0);
+            std::reverse(dst.begin() + pos, dst.end());
+        }
+
+        void append_hex_digits(uint32_t x, u8string& dst, size_t digits) {
+            size_t pos = dst.size();
+            dst.append(digits, '0');
+            for (auto i = ptrdiff_t(digits) - 1; i >= 0 && x != 0; --i, x /= 16)
+                dst[pos + i] = hexdigits[x % 16];
+        }
+
+        void append_escape_stdc(char32_t c, u8string& dst) {
+            switch (c) {
+                case 0:     dst += "\\0"; break;
+                case '\a':  dst += "\\a"; break;
+                case '\b':  dst += "\\b"; break;
+                case '\t':  dst += "\\t"; break;
+                case '\n':  dst += "\\n"; break;
+                case '\v':  dst += "\\v"; break;
+                case '\f':  dst += "\\f"; break;
+                case '\r':  dst += "\\r"; break;
+                default:    break;
+            }
+        }
+
+        void encode_uri_helper(const u8string& src, u8string& dst, const char* escaped) {
+            for (auto in = utf_begin(src), end = utf_end(src); in != end; ++in) {
+                if (*in >= 33 && *in <= 126 && ! std::strchr(escaped, char(*in))) {
+                    dst += char(*in);
+                } else {
+                    for (char c: in.range()) {
+                        dst += '%';
+                        append_hex_digits(uint8_t(c), dst, 2);
+                    }
+                }
+            }
+        }
+
+        void unencode_uri_helper(const u8string& src, u8string& dst) {
+            size_t i = 0, size = src.size();
+            while (i < size) {
+                if (src[i] == '%' && size - i >= 3 && ascii_isxdigit(src[i + 1]) && ascii_isxdigit(src[i + 2])) {
+                    dst += char(hexnum(src.substr(i + 1, 2)));
+                    i += 3;
+                } else {
+                    dst += src[i++];
+                }
+            }
+        }
+
+        void escape_helper(const u8string& src, u8string& dst, uint32_t flags, char32_t quote = 0xffffffff) {
+            const bool ascii = flags & (esc_ascii | esc_pcre);
+            const bool nostdc = flags & esc_nostdc;
+            const bool pcre = flags & esc_pcre;
+            const bool punct = flags & esc_punct;
+            for (char32_t c: utf_range(src)) {
+                if (! nostdc && (c == 0 || (c >= U'\a' && c <= U'\r'))) {
+                    append_escape_stdc(c, dst);
+                } else if (c <= 0x1f || c == 0x7f) {
+                    dst += "\\x";
+                    append_hex_digits(c, dst, 2);
+                } else if (c == U'\\' || c == quote || (punct && c < 0x80 && ascii_ispunct(char(c)))) {
+                    dst += '\\';
+                    dst += char(c);
+                } else if (c < 0x80 || ! ascii) {
+                    str_append_char(dst, c);
+                } else if (pcre) {
+                    dst += "\\x{";
+                    append_hex_digits(c, dst);
+                    dst += '}';
+                } else if (c <= 0xffff) {
+                    dst += "\\u";
+                    append_hex_digits(c, dst, 4);
+                } else {
+                    dst += "\\U";
+                    append_hex_digits(c, dst, 8);
+                }
+            }
+        }
+
+    }
+
     void check_encode_uri() {
 
         u8string s1, s2;
@@ -64,6 +164,12 @@ namespace {
         s1 = "-._~";                                                    TRY(str_unencode_uri_in(s1));  TEST_EQUAL(s1, "-._~");
         s1 = "%ce%b1%ce%b2%ce%b3%ce%b4%ce%b5";                          TRY(str_unencode_uri_in(s1));  TEST_EQUAL(s1, u8"αβγδε");
 
+        s1 = u8"http://www.example.com/path/to/some/resource?query=αβγ&long=value";
+        TRY(s2 = str_encode_uri(s1));            TEST_EQUAL(s2, "http://www.example.com/path/to/some/resource?query=%ce%b1%ce%b2%ce%b3&long=value");
+        TRY(s2 = str_unencode_uri(s2));          TEST_EQUAL(s2, s1);
+        TRY(s2 = str_encode_uri_component(s1));  TEST_EQUAL(s2, "http%3a%2f%2fwww.example.com%2fpath%2fto%2fsome%2fresource%3fquery%3d%ce%b1%ce%b2%ce%b3%26long%3dvalue");
+        TRY(s2 = str_unencode_uri(s2));          TEST_EQUAL(s2, s1);
+
     }
 
     void check_escape() {
@@ -110,6 +216,14 @@ namespace {
         s1 = u8"(\"\\x01\\x{80}\\x{a7}\\x{b6} \\\\ \\x{20ac}uro \\x{12000}\\n\")";  TRY(str_unescape_in(s1));  TEST_EQUAL(s1, u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")");
         s1 = u8"\\(\\\"\\x01\u0080§¶ \\\\ €uro \U00012000\\n\\\"\\)";               TRY(str_unescape_in(s1));  TEST_EQUAL(s1, u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")");
 
+        s1 = "The quick brown fox\tjumps over the lazy dog, \"twice\"\n";
+        TRY(s2 = str_escape(s1));             TEST_EQUAL(s2, "The quick brown fox\\tjumps over the lazy dog, \"twice\"\\n");
+        TRY(s2 = str_escape(s1, esc_punct));  TEST_EQUAL(s2, "The quick brown fox\\tjumps over the lazy dog\\, \\\"twice\\\"\\n");
+        TRY(s2 = str_unescape(s2));           TEST_EQUAL(s2, s1);
+        s1 = u8"Ünïcödé strings with long ASCII runs between them, and a \\ backslash";
+        TRY(s2 = str_escape(s1, esc_ascii));  TEST_EQUAL(s2, "\\u00dcn\\u00efc\\u00f6d\\u00e9 strings with long ASCII runs between them, and a \\\\ backslash");
+        TRY(s2 = str_unescape(s2));           TEST_EQUAL(s2, s1);
+
     }
 
     void check_quote() {
@@ -174,6 +288,79 @@ namespace {
 
     }
 
+    void check_reference() {
+
+        // Random strings mixing control characters, DEL, punctuation, quote
+        // characters, valid and invalid UTF-8, percent escapes, and ASCII
+        // runs long enough to fill whole eight byte blocks
+
+        static const std::vector<u8string> pieces = {
+            "\0"s, "\a", "\b", "\t", "\n", "\v", "\f", "\r", "\x01", "\x1b", "\x1f", "\x7f",
+            " ", "a", "Z", "9", "\\", "\"", "'", "`", "!", "%", "{", "~", "_",
+            "%4", "%41", "%zz", "%e2%82%ac", "%%20",
+            u8"é", u8"€", u8"«", u8"\uffff", u8"\U0001f600", u8"\U0010fffd",
+            "\x80", "\xbf", "\xc3", "\xe2\x82", "\xf0\x9f\x98", "\xed\xa0\x80", "\xc0\xaf", "\xfe", "\xff",
+            "abcdefgh", "Hello world, again", "0123456789abcdefghijklmnop",
+        };
+        static const std::vector<char32_t> quotes = {U'\"', U'\'', U'`', U'\\', U'«', U'€', U'\U0001f600'};
+
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<size_t> piece(0, pieces.size() - 1), length(0, 40);
+        u8string src, expect, s;
+
+        for (int i = 0; i < 1000; ++i) {
+            src.clear();
+            for (size_t j = length(rng); j > 0; --j)
+                src += pieces[piece(rng)];
+            expect.clear();
+            Reference::encode_uri_helper(src, expect, Reference::uri_full_escaped);
+            TRY(s = str_encode_uri(src));
+            TEST_EQUAL(s, expect);
+            expect.clear();
+            Reference::encode_uri_helper(src, expect, Reference::uri_comp_escaped);
+            TRY(s = str_encode_uri_component(src));
+            TEST_EQUAL(s, expect);
+            expect.clear();
+            Reference::unencode_uri_helper(src, expect);
+            TRY(s = str_unencode_uri(src));
+            TEST_EQUAL(s, expect);
+            for (uint32_t flags = 0; flags < 16; ++flags) {
+                uint32_t f = (flags & 1 ? esc_ascii : 0) | (flags & 2 ? esc_nostdc : 0)
+                    | (flags & 4 ? esc_pcre : 0) | (flags & 8 ? esc_punct : 0);
+                expect.clear();
+                Reference::escape_helper(src, expect, f);
+                TRY(s = str_escape(src, f));
+                TEST_EQUAL(s, expect);
+                for (char32_t q: quotes) {
+                    expect.clear();
+                    str_append_char(expect, q);
+                    Reference::escape_helper(src, expect, f, q);
+                    str_append_char(expect, q);
+                    TRY(s = str_quote(src, f, q));
+                    TEST_EQUAL(s, expect);
+                }
+            }
+        }
+
+    }
+
+    void check_output_strings() {
+
+        u8string s1 = u8"Hello \"€uro\"\n", s2 = "Previous contents";
+
+        TRY(str_encode_uri(s1, s2));             TEST_EQUAL(s2, "Hello%20%22%e2%82%acuro%22%0a");
+        TRY(str_unencode_uri(s2, s2));           TEST_EQUAL(s2, s1);
+        TRY(str_encode_uri_component(s1, s2));   TEST_EQUAL(s2, "Hello%20%22%e2%82%acuro%22%0a");
+        TRY(str_escape(s1, s2));                 TEST_EQUAL(s2, u8"Hello \"€uro\"\\n");
+        TRY(str_escape(s1, s2, esc_ascii));      TEST_EQUAL(s2, u8"Hello \"\\u20acuro\"\\n");
+        TRY(str_unescape(s2, s2));               TEST_EQUAL(s2, s1);
+        TRY(str_quote(s1, s2));                  TEST_EQUAL(s2, u8"\"Hello \\\"€uro\\\"\\n\"");
+        TRY(str_unquote(s2, s1));                TEST_EQUAL(s1, u8"Hello \"€uro\"\n");
+        TRY(str_quote(s1, s1, 0, U'\''));        TEST_EQUAL(s1, u8"'Hello \"€uro\"\\n'");
+        TRY(str_unquote(s1, s2, U'\''));         TEST_EQUAL(s2, u8"Hello \"€uro\"\n");
+
+    }
+
 }
 
 TEST_MODULE(unicorn, string_escape) {
@@ -181,5 +368,7 @@ TEST_MODULE(unicorn, string_escape) {
     check_encode_uri();
     check_escape();
     check_quote();
+    check_reference();
+    check_output_strings();
 
 }
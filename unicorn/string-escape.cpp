@@ -7,6 +7,7 @@ namespace Unicorn {
         constexpr const char* hexdigits = "0123456789abcdef";
         constexpr const char* uri_comp_escaped = "!\"#$%&'()*+,/:;<=>?@[\\]^`{|}";
         constexpr const char* uri_full_escaped = "\"%<>\\^`{|}";
+        constexpr const char* ascii_punctuation = "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
 
         void append_hex_digits(uint32_t x, u8string& dst) {
             size_t pos = dst.size();
@@ -59,24 +60,116 @@ namespace Unicorn {
             append_hex_digits(uint8_t(c), dst, 2);
         }
 
-        void encode_uri_helper(const u8string& src, u8string& dst, const char* escaped) {
-            for (auto in = utf_begin(src), end = utf_end(src); in != end; ++in) {
-                if (*in >= 33 && *in <= 126 && ! strchr(escaped, char(*in))) {
-                    dst += char(*in);
+        constexpr uint32_t decode_xdigit(char32_t c) {
+            return c >= U'0' && c <= U'9' ? c - U'0'
+                : c >= U'A' && c <= U'F' ? c - U'A' + 10
+                : c >= U'a' && c <= U'f' ? c - U'a' + 10 : 0;
+        }
+
+        // Classifies bytes as clean (copied through unchanged) or special
+        // (handled one at a time). Controls, DEL, and all non-ASCII bytes
+        // are always special, as are any listed printable characters. Runs
+        // of clean bytes are found eight at a time, with an unrolled table
+        // lookup that costs the same however many characters are special.
+
+        class SpecialBytes {
+        public:
+            SpecialBytes(const u8string& chars, unsigned limit) noexcept;
+            size_t find(const u8string& src, size_t pos) const noexcept;
+        private:
+            std::array<bool, 256> table;
+        };
+
+        SpecialBytes::SpecialBytes(const u8string& chars, unsigned limit) noexcept {
+            for (unsigned i = 0; i < 256; ++i)
+                table[i] = i < limit || i >= 0x7f;
+            for (char c: chars)
+                table[uint8_t(c)] = true;
+        }
+
+        size_t SpecialBytes::find(const u8string& src, size_t pos) const noexcept {
+            size_t n = src.size();
+            auto ptr = reinterpret_cast<const uint8_t*>(src.data());
+            for (; pos + 8 <= n; pos += 8) {
+                auto p = ptr + pos;
+                if (table[p[0]] | table[p[1]] | table[p[2]] | table[p[3]]
+                        | table[p[4]] | table[p[5]] | table[p[6]] | table[p[7]])
+                    break;
+            }
+            while (pos < n && ! table[ptr[pos]])
+                ++pos;
+            return pos;
+        }
+
+        // Returns the first backslash or quote at or after i. ASCII blocks
+        // with neither are skipped eight bytes at a time; other characters
+        // are decoded, so invalid sequences are stepped over exactly as the
+        // character iterator would.
+
+        Utf8Iterator find_escape_or_quote(const Utf8Iterator& i, const Utf8Iterator& end, char32_t quote) {
+            using namespace UnicornDetail;
+            auto& src = i.source();
+            const char* ptr = src.data();
+            size_t pos = i.offset(), stop = end.offset();
+            char q = quote < 0x80 ? char(quote) : '\\';
+            while (pos < stop) {
+                for (; pos + 8 <= stop; pos += 8) {
+                    auto w = swar_load(ptr + pos);
+                    if (! swar_is_ascii(w) || swar_any_equal(w, '\\') || swar_any_equal(w, uint8_t(q)))
+                        break;
+                }
+                if (pos == stop)
+                    break;
+                if (uint8_t(ptr[pos]) < 0x80) {
+                    if (ptr[pos] == '\\' || ptr[pos] == q)
+                        break;
+                    ++pos;
                 } else {
-                    for (char c: in.range()) {
-                        dst += '%';
-                        PrionDetail::append_hex_byte(uint8_t(c), dst);
-                    }
+                    auto j = utf_iterator(src, pos);
+                    if (*j == quote)
+                        break;
+                    pos += j.count();
+                }
+            }
+            return pos >= stop ? end : utf_iterator(src, pos);
+        }
+
+        // Percent encoding works on bytes, but the bytes of a non-ASCII
+        // character are taken from the character iterator, to keep the same
+        // treatment of invalid sequences.
+
+        void encode_uri_helper(const u8string& src, u8string& dst, const char* escaped) {
+            SpecialBytes special(escaped, 33);
+            size_t i = 0, n = src.size();
+            dst.reserve(dst.size() + n + n / 8);
+            while (i < n) {
+                size_t j = special.find(src, i);
+                dst.append(src, i, j - i);
+                if (j == n)
+                    break;
+                size_t len = 1;
+                if (uint8_t(src[j]) >= 0x80)
+                    len = utf_iterator(src, j).count();
+                for (i = j; i < j + len; ++i) {
+                    dst += '%';
+                    PrionDetail::append_hex_byte(uint8_t(src[i]), dst);
                 }
             }
         }
 
         void unencode_uri_helper(const u8string& src, u8string& dst) {
             size_t i = 0, size = src.size();
+            dst.reserve(dst.size() + size);
             while (i < size) {
-                if (src[i] == '%' && size - i >= 3 && ascii_isxdigit(src[i + 1]) && ascii_isxdigit(src[i + 2])) {
-                    dst += char(hexnum(src.substr(i + 1, 2)));
+                size_t j = src.find('%', i);
+                if (j == npos)
+                    j = size;
+                dst.append(src, i, j - i);
+                i = j;
+                if (i == size)
+                    break;
+                if (size - i >= 3 && ascii_isxdigit(src[i + 1]) && ascii_isxdigit(src[i + 2])) {
+                    dst += char((decode_xdigit(src[i + 1]) << 4) + decode_xdigit(src[i + 2]));
                     i += 3;
                 } else {
                     dst += src[i++];
@@ -89,7 +182,22 @@ namespace Unicorn {
             const bool nostdc = flags & esc_nostdc;
             const bool pcre = flags & esc_pcre;
             const bool punct = flags & esc_punct;
-            for (char32_t c: utf_range(src)) {
+            u8string marks = "\\";
+            if (quote < 0x80)
+                marks += char(quote);
+            if (punct)
+                marks += ascii_punctuation;
+            SpecialBytes special(marks, 0x20);
+            size_t i = 0, n = src.size();
+            dst.reserve(dst.size() + n + n / 8);
+            while (i < n) {
+                size_t j = special.find(src, i);
+                dst.append(src, i, j - i);
+                if (j == n)
+                    break;
+                auto it = utf_iterator(src, j);
+                char32_t c = *it;
+                i = j + it.count();
                 if (! nostdc && (c == 0 || (c >= U'\a' && c <= U'\r'))) {
                     append_escape_stdc(c, dst);
                 } else if (c <= 0x1f || c == 0x7f) {
@@ -109,12 +217,6 @@ namespace Unicorn {
             }
         }
 
-        constexpr uint32_t decode_xdigit(char32_t c) {
-            return c >= U'0' && c <= U'9' ? c - U'0'
-                : c >= U'A' && c <= U'F' ? c - U'A' + 10
-                : c >= U'a' && c <= U'f' ? c - U'a' + 10 : 0;
-        }
-
         void read_hex_char(Utf8Iterator& i, Utf8Iterator end, char32_t& c, size_t maxlen, bool varlen) {
             if (i == end)
                 return;
@@ -137,7 +239,7 @@ namespace Unicorn {
         Utf8Iterator unescape_helper(const Utf8Iterator& begin, const Utf8Iterator& end, u8string& dst, char32_t quote = 0xffffffff) {
             auto i = begin, j = begin;
             while (i != end) {
-                for (j = i; j != end && *j != U'\\' && *j != quote; ++j) {}
+                j = find_escape_or_quote(i, end, quote);
                 str_append(dst, i, j);
                 if (j == end || *j == quote)
                     return j;
@@ -188,6 +290,24 @@ namespace Unicorn {
         return result;
     }
 
+    void str_encode_uri(const u8string& str, u8string& dst) {
+        if (&str == &dst) {
+            str_encode_uri_in(dst);
+        } else {
+            dst.clear();
+            encode_uri_helper(str, dst, uri_full_escaped);
+        }
+    }
+
+    void str_encode_uri_component(const u8string& str, u8string& dst) {
+        if (&str == &dst) {
+            str_encode_uri_component_in(dst);
+        } else {
+            dst.clear();
+            encode_uri_helper(str, dst, uri_comp_escaped);
+        }
+    }
+
     void str_encode_uri_in(u8string& str) {
         u8string result;
         encode_uri_helper(str, result, uri_full_escaped);
@@ -206,6 +326,15 @@ namespace Unicorn {
         return result;
     }
 
+    void str_unencode_uri(const u8string& str, u8string& dst) {
+        if (&str == &dst) {
+            str_unencode_uri_in(dst);
+        } else {
+            dst.clear();
+            unencode_uri_helper(str, dst);
+        }
+    }
+
     void str_unencode_uri_in(u8string& str) {
         u8string result;
         unencode_uri_helper(str, result);
@@ -218,6 +347,15 @@ namespace Unicorn {
         return result;
     }
 
+    void str_escape(const u8string& str, u8string& dst, uint32_t flags) {
+        if (&str == &dst) {
+            str_escape_in(dst, flags);
+        } else {
+            dst.clear();
+            escape_helper(str, dst, flags);
+        }
+    }
+
     void str_escape_in(u8string& str, uint32_t flags) {
         u8string result;
         escape_helper(str, result, flags);
@@ -230,6 +368,15 @@ namespace Unicorn {
         return result;
     }
 
+    void str_unescape(const u8string& str, u8string& dst) {
+        if (&str == &dst) {
+            str_unescape_in(dst);
+        } else {
+            dst.clear();
+            unescape_helper(utf_begin(str), utf_end(str), dst);
+        }
+    }
+
     void str_unescape_in(u8string& str) {
         u8string result;
         unescape_helper(utf_begin(str), utf_end(str), result);
@@ -244,6 +391,17 @@ namespace Unicorn {
         return result;
     }
 
+    void str_quote(const u8string& str, u8string& dst, uint32_t flags, char32_t quote) {
+        if (&str == &dst) {
+            str_quote_in(dst, flags, quote);
+        } else {
+            dst.clear();
+            str_append_char(dst, quote);
+            escape_helper(str, dst, flags, quote);
+            str_append_char(dst, quote);
+        }
+    }
+
     void str_quote_in(u8string& str, uint32_t flags, char32_t quote) {
         u8string result;
         str_append_char(result, quote);
@@ -258,6 +416,15 @@ namespace Unicorn {
         return result;
     }
 
+    void str_unquote(const u8string& str, u8string& dst, char32_t quote) {
+        if (&str == &dst) {
+            str_unquote_in(dst, quote);
+        } else {
+            dst.clear();
+            unquote_helper(str, dst, quote);
+        }
+    }
+
     void str_unquote_in(u8string& str, char32_t quote) {
         u8string result;
         unquote_helper(str, result, quote);
@@ -3,6 +3,8 @@
 #include "unicorn/character.hpp"
 #include "unicorn/utf.hpp"
 #include "prion/unit-test.hpp"
+#include <iterator>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -213,6 +215,56 @@ namespace {
         v = {"Hello","world"};          TEST_EQUAL(str_join(v, "\n", true), "Hello\nworld\n");
         v = {"Hello","world","again"};  TEST_EQUAL(str_join(v, "\n", true), "Hello\nworld\nagain\n");
 
+        std::vector<const char*> cv = {"Hello","world","again"};
+        TEST_EQUAL(str_join(cv, "<*>"s), "Hello<*>world<*>again");
+        std::istringstream in("Hello world again");
+        TEST_EQUAL(str_join(irange(std::istream_iterator<u8string>(in), std::istream_iterator<u8string>()), "/"), "Hello/world/again");
+        u8string s;
+        v.assign(1000, "abc");
+        TRY(s = str_join(v, ","));
+        TEST_EQUAL(s.size(), 3999);
+
+    }
+
+    void check_builder() {
+
+        StrBuilder b;
+        u8string s, t;
+
+        TEST(b.empty());
+        TEST_EQUAL(b.size(), 0);
+        TEST_EQUAL(b.str(), "");
+
+        TRY(b += "Hello");
+        TRY(b += U' ');
+        TRY(b += u8"wörld"s);
+        TRY(b += U'€');
+        TRY(b += (const char*)nullptr);
+        TEST(! b.empty());
+        TEST_EQUAL(b.size(), 15);
+        TEST_EQUAL(b.str(), u8"Hello wörld€");
+
+        s = "Say ";
+        TRY(b.append_to(s));
+        TEST_EQUAL(s, u8"Say Hello wörld€");
+        TRY(b.clear());
+        TEST(b.empty());
+        TEST_EQUAL(b.str(), "");
+
+        for (int i = 0; i < 1000; ++i) {
+            TRY(b += "abc");
+            TRY(b += u8string(i % 5, 'x'));
+            t += "abc";
+            t += u8string(i % 5, 'x');
+        }
+        TRY(b += u8string(5000, 'y'));
+        TRY(b += "z");
+        t += u8string(5000, 'y');
+        t += "z";
+        TEST_EQUAL(b.size(), t.size());
+        TRY(s = b.str());
+        TEST_EQUAL(s, t);
+
     }
 
 }
@@ -223,5 +275,6 @@ TEST_MODULE(unicorn, string_manipulation_f_m) {
     check_fix_right();
     check_insert();
     check_join();
+    check_builder();
 
 }
@@ -12,7 +12,7 @@ namespace {
 
     void check_pad_left() {
 
-        u8string s;
+        u8string s, t;
 
         TEST_EQUAL(str_pad_left(""s, 0), "");
         TEST_EQUAL(str_pad_left(""s, 1), " ");
@@ -70,11 +70,16 @@ namespace {
         s = u8"∀∃∀∃∀";  TRY(str_pad_left_in(s, 5, U'√'));   TEST_EQUAL(s, u8"∀∃∀∃∀");
         s = u8"∀∃∀∃∀";  TRY(str_pad_left_in(s, 10, U'√'));  TEST_EQUAL(s, u8"√√√√√∀∃∀∃∀");
 
+        s = u8"∀∃∀∃∀";
+        t = "Previous contents";  TRY(str_pad_left(s, t, 5));         TEST_EQUAL(t, u8"∀∃∀∃∀");
+        t = "Previous contents";  TRY(str_pad_left(s, t, 10, U'√'));  TEST_EQUAL(t, u8"√√√√√∀∃∀∃∀");
+        TRY(str_pad_left(s, s, 10, U'*'));  TEST_EQUAL(s, u8"*****∀∃∀∃∀");
+
     }
 
     void check_pad_right() {
 
-        u8string s;
+        u8string s, t;
 
         TEST_EQUAL(str_pad_right(""s, 0), "");
         TEST_EQUAL(str_pad_right(""s, 1), " ");
@@ -132,6 +137,11 @@ namespace {
         s = u8"∀∃∀∃∀";  TRY(str_pad_right_in(s, 5, U'√'));   TEST_EQUAL(s, u8"∀∃∀∃∀");
         s = u8"∀∃∀∃∀";  TRY(str_pad_right_in(s, 10, U'√'));  TEST_EQUAL(s, u8"∀∃∀∃∀√√√√√");
 
+        s = u8"∀∃∀∃∀";
+        t = "Previous contents";  TRY(str_pad_right(s, t, 5));         TEST_EQUAL(t, u8"∀∃∀∃∀");
+        t = "Previous contents";  TRY(str_pad_right(s, t, 10, U'√'));  TEST_EQUAL(t, u8"∀∃∀∃∀√√√√√");
+        TRY(str_pad_right(s, s, 10, U'*'));  TEST_EQUAL(s, u8"∀∃∀∃∀*****");
+
     }
 
     void check_partition() {
@@ -180,6 +190,15 @@ namespace {
         s = u8"Hello world";  TRY(t = str_remove_if(s, [] (char32_t c) { return c < U'a'; }));      TEST_EQUAL(t, u8"elloworld");
         s = u8"";             TRY(t = str_remove_if_not(s, [] (char32_t c) { return c < U'a'; }));  TEST_EQUAL(t, u8"");
         s = u8"Hello world";  TRY(t = str_remove_if_not(s, [] (char32_t c) { return c < U'a'; }));  TEST_EQUAL(t, u8"H ");
+        s = u8"€1 α2 ∀3 €4";  TRY(t = str_remove(s, U'€'));                                         TEST_EQUAL(t, u8"1 α2 ∀3 4");
+        s = u8"€1 α2 ∀3 €4";  TRY(t = str_remove(s, u8"€α"));                                       TEST_EQUAL(t, u8"1 2 ∀3 4");
+        s = u8"€1 α2 ∀3 €4";  TRY(t = str_remove(s, u8"€α "));                                      TEST_EQUAL(t, u8"12∀34");
+        s = u8"€1 α2 ∀3 €4";  TRY(t = str_remove(s, u8"1234"));                                     TEST_EQUAL(t, u8"€ α ∀ €");
+        s = u8"€1 α2 ∀3 €4";  TRY(t = str_remove_if(s, [] (char32_t c) { return c >= 0x80; }));   TEST_EQUAL(t, u8"1 2 3 4");
+        s = u8"The quick brown fox jumps over the lazy dog";
+        TRY(t = str_remove(s, U'z'));      TEST_EQUAL(t, u8"The quick brown fox jumps over the lay dog");
+        TRY(t = str_remove(s, u8"aeiou"));  TEST_EQUAL(t, u8"Th qck brwn fx jmps vr th lzy dg");
+        TRY(t = str_remove(s, u8"!"));      TEST_EQUAL(t, s);
 
         s = u8"";             TRY(str_remove_in(s, U'o'));                                         TEST_EQUAL(s, u8"");
         s = u8"";             TRY(str_remove_in(s, u8"aeiou"));                                    TEST_EQUAL(s, u8"");
@@ -194,7 +213,7 @@ namespace {
 
     void check_repeat() {
 
-        u8string s;
+        u8string s, t;
 
         TEST_EQUAL(str_repeat("", 0), "");
         TEST_EQUAL(str_repeat("", 1), "");
@@ -223,12 +242,20 @@ namespace {
         s = "Hello";  TRY(str_repeat_in(s, 3));  TEST_EQUAL(s, "HelloHelloHello");
         s = "Hello";  TRY(str_repeat_in(s, 4));  TEST_EQUAL(s, "HelloHelloHelloHello");
         s = "Hello";  TRY(str_repeat_in(s, 5));  TEST_EQUAL(s, "HelloHelloHelloHelloHello");
+        s = "Hello";  TRY(str_repeat_in(s, 7));  TEST_EQUAL(s, "HelloHelloHelloHelloHelloHelloHello");
+
+        s = "Hello";
+        t = "Previous contents";  TRY(str_repeat(s, t, 0));  TEST_EQUAL(t, "");
+        t = "Previous contents";  TRY(str_repeat(s, t, 1));  TEST_EQUAL(t, "Hello");
+        t = "Previous contents";  TRY(str_repeat(s, t, 3));  TEST_EQUAL(t, "HelloHelloHello");
+        TRY(str_repeat(s, s, 3));  TEST_EQUAL(s, "HelloHelloHello");
+        s = "@";  TRY(str_repeat(s, s, 4));  TEST_EQUAL(s, "@@@@");
 
     }
 
     void check_replace() {
 
-        u8string s;
+        u8string s, t;
 
         TEST_EQUAL(str_replace(""s, "", ""), "");
         TEST_EQUAL(str_replace("(abc)"s, "", ""), "(abc)");
@@ -283,6 +310,17 @@ namespace {
         s = u8"(∀∃∇)(∀∃∇)(∀∃∇)";  TRY(str_replace_in(s, u8"∀∃∇", u8"xyz", 2));  TEST_EQUAL(s, u8"(xyz)(xyz)(∀∃∇)");
         s = u8"(∀∃∇)(∀∃∇)(∀∃∇)";  TRY(str_replace_in(s, u8"∀∃∇", u8"xyz", 3));  TEST_EQUAL(s, u8"(xyz)(xyz)(xyz)");
         s = u8"(∀∃∇)(∀∃∇)(∀∃∇)";  TRY(str_replace_in(s, u8"∀∃∇", u8"xyz", 4));  TEST_EQUAL(s, u8"(xyz)(xyz)(xyz)");
+        s = u8"∀∃∇(∀∃∇)∀∃∇";      TRY(str_replace_in(s, u8"∀∃∇", u8"x"));     TEST_EQUAL(s, u8"x(x)x");
+        s = u8"abcabc";           TRY(str_replace_in(s, u8"abc", u8"abc"));   TEST_EQUAL(s, u8"abcabc");
+
+        s = u8"(abc)(abc)(abc)";
+        t = "Previous contents";  TRY(str_replace(s, t, "abc", "xyz"));     TEST_EQUAL(t, u8"(xyz)(xyz)(xyz)");
+        t = "Previous contents";  TRY(str_replace(s, t, "abc", "∀∃∇", 2));  TEST_EQUAL(t, u8"(∀∃∇)(∀∃∇)(abc)");
+        t = "Previous contents";  TRY(str_replace(s, t, "xyz", "abc"));     TEST_EQUAL(t, u8"(abc)(abc)(abc)");
+        t = "Previous contents";  TRY(str_replace(s, t, "", "xyz"));        TEST_EQUAL(t, u8"(abc)(abc)(abc)");
+        t = "abc";                TRY(str_replace(s, t, t, "x"));           TEST_EQUAL(t, u8"(x)(x)(x)");
+        TRY(str_replace(s, s, "abc", "∀∃∇", 1));  TEST_EQUAL(s, u8"(∀∃∇)(abc)(abc)");
+        TRY(str_replace(s, s, "∀∃∇", ""));        TEST_EQUAL(s, u8"()(abc)(abc)");
 
     }
 
@@ -84,6 +84,61 @@ namespace {
 
     }
 
+    void check_split_range() {
+
+        u8string s;
+        StrSplitRange r;
+        vector<u8string> v;
+        auto collect = [&v] (const StrSplitRange& range) {
+            v.clear();
+            for (auto& field: range)
+                v.push_back(u_str(field));
+            return str_join(v, "/");
+        };
+
+        s = "";                         TRY(r = str_split_range(s));  TEST_EQUAL(range_count(r), 0);
+        s = "\t Hello \t world \t";     TRY(r = str_split_range(s));  TEST_EQUAL(range_count(r), 2);  TEST_EQUAL(collect(r), "Hello/world");
+        s = u8"€uro\u00a0∈lement\u2003"; TRY(r = str_split_range(s));  TEST_EQUAL(range_count(r), 2);  TEST_EQUAL(collect(r), u8"€uro/∈lement");
+
+        s = "";                TRY(r = str_split_at_range(s, ","));   TEST_EQUAL(range_count(r), 1);  TEST_EQUAL(collect(r), "");
+        s = "a,b,,c,";         TRY(r = str_split_at_range(s, ","));   TEST_EQUAL(range_count(r), 5);  TEST_EQUAL(collect(r), "a/b//c/");
+        s = "a,b,,c,";         TRY(r = str_split_at_range(s, ""));    TEST_EQUAL(range_count(r), 1);  TEST_EQUAL(collect(r), "a,b,,c,");
+        s = "<><>Hello<>";     TRY(r = str_split_at_range(s, "<>"));  TEST_EQUAL(range_count(r), 4);  TEST_EQUAL(collect(r), "//Hello/");
+        s = u8"α€β€€γ";        TRY(r = str_split_at_range(s, u8"€")); TEST_EQUAL(range_count(r), 4);  TEST_EQUAL(collect(r), u8"α/β//γ");
+
+        s = "**Hello**world**";                 TRY(r = str_split_by_range(s, "*"));     TEST_EQUAL(range_count(r), 2);  TEST_EQUAL(collect(r), "Hello/world");
+        s = "";                                 TRY(r = str_split_by_range(s, ""));      TEST_EQUAL(range_count(r), 1);  TEST_EQUAL(collect(r), "");
+        s = u8"“”,“€uro”,“∈lement”";            TRY(r = str_split_by_range(s, u8"“”,")); TEST_EQUAL(range_count(r), 2);  TEST_EQUAL(collect(r), u8"€uro/∈lement");
+
+        s = "";                                 TRY(r = str_split_lines_range(s));  TEST_EQUAL(range_count(r), 0);
+        s = "one\ntwo\r\n\rfour\n";           TRY(r = str_split_lines_range(s));  TEST_EQUAL(range_count(r), 4);  TEST_EQUAL(collect(r), "one/two//four");
+        s = u8"one\u2028two\u0085";             TRY(r = str_split_lines_range(s));  TEST_EQUAL(range_count(r), 2);  TEST_EQUAL(collect(r), "one/two");
+
+        s = "alpha,bravo,charlie";
+        TRY(r = str_split_at_range(s, ","));
+        auto i = r.begin();
+        TEST_EQUAL(i->begin().offset(), 0);   TEST_EQUAL(i->end().offset(), 5);
+        TRY(++i);
+        TEST_EQUAL(i->begin().offset(), 6);   TEST_EQUAL(i->end().offset(), 11);
+        TEST(&i->begin().source() == &s);
+        auto j = i;
+        TRY(++i);
+        TEST_EQUAL(i->begin().offset(), 12);  TEST_EQUAL(i->end().offset(), 19);
+        TRY(++i);
+        TEST(i == r.end());
+        TEST_EQUAL(j->begin().offset(), 6);   TEST_EQUAL(j->end().offset(), 11);
+        TRY(++j);
+        TEST_EQUAL(j->begin().offset(), 12);  TEST_EQUAL(j->end().offset(), 19);
+
+        s = u8"α β€γ,,δ";
+        TRY(r = str_split_by_range(s, u8", €"));
+        TEST_EQUAL(range_count(r), 4);
+        TEST_EQUAL(collect(r), u8"α/β/γ/δ");
+        std::vector<Irange<Utf8Iterator>> fields(r.begin(), r.end());
+        TEST_EQUAL(fields.size(), 4);
+
+    }
+
     void check_squeeze() {
 
         u8string s;
@@ -99,6 +154,9 @@ namespace {
         TEST_EQUAL(str_squeeze(u8"Hello world"s, u8"+-*/"s), u8"Hello world"s);
         TEST_EQUAL(str_squeeze(u8"/*-+Hello/*-+world/*-+"s, u8"+-*/"s), u8"+Hello+world+"s);
         TEST_EQUAL(str_squeeze(u8"∇∃∀€uro∇∃∀∈lement∇∃∀"s, u8"∀∃∇"s), u8"∀€uro∀∈lement∀"s);
+        TEST_EQUAL(str_squeeze(u8"a--b∀∀c-∀d"s, u8"-∀"s), u8"a-b-c-d"s);
+        TEST_EQUAL(str_squeeze(u8"a--b∀∀c-∀d"s, u8"∀-"s), u8"a∀b∀c∀d"s);
+        TEST_EQUAL(str_squeeze(u8"--a--"s, u8"∀-"s), u8"∀a∀"s);
 
         TEST_EQUAL(str_squeeze_trim(u8""s), u8""s);
         TEST_EQUAL(str_squeeze_trim(u8"\t\t\t"s), u8""s);
@@ -135,6 +193,8 @@ namespace {
         s = u8"Hello world"s;                                      TRY(str_squeeze_trim_in(s, u8"+-*/"s));  TEST_EQUAL(s, u8"Hello world"s);
         s = u8"/*-+Hello/*-+world/*-+"s;                           TRY(str_squeeze_trim_in(s, u8"+-*/"s));  TEST_EQUAL(s, u8"Hello+world"s);
         s = u8"∇∃∀€uro∇∃∀∈lement∇∃∀"s;                             TRY(str_squeeze_trim_in(s, u8"∀∃∇"s));   TEST_EQUAL(s, u8"€uro∀∈lement"s);
+        s = u8"--a--b∀∀c-∀d--"s;                                   TRY(str_squeeze_trim_in(s, u8"-∀"s));    TEST_EQUAL(s, u8"a-b-c-d"s);
+        s = u8"--a--b∀∀c-∀d--"s;                                   TRY(str_squeeze_trim_in(s, u8"∀-"s));    TEST_EQUAL(s, u8"a∀b∀c∀d"s);
 
     }
 
@@ -148,6 +208,7 @@ namespace {
         // 0010fffd  dbff dffd  f4 8f bf bd
 
         const u8string example {"\xd0\xb0\xe4\xba\x8c\xf0\x90\x8c\x82\xf4\x8f\xbf\xbd"};
+        u8string s, t;
 
         TEST_EQUAL(str_substring(""s, 0), "");
         TEST_EQUAL(str_substring(""s, 5), "");
@@ -167,6 +228,14 @@ namespace {
         TEST_EQUAL(str_substring("Hello world"s, 20, 0), "");
         TEST_EQUAL(str_substring("Hello world"s, 20, 20), "");
 
+        s = "Hello world";
+        t = "Previous contents";  TRY(str_substring(s, t, 6));      TEST_EQUAL(t, "world");
+        t = "Previous contents";  TRY(str_substring(s, t, 0, 5));   TEST_EQUAL(t, "Hello");
+        t = "Previous contents";  TRY(str_substring(s, t, 20, 5));  TEST_EQUAL(t, "");
+        TRY(str_substring(s, s, 3, 5));  TEST_EQUAL(s, "lo wo");
+        TRY(str_substring(s, s, 2));     TEST_EQUAL(s, " wo");
+        TRY(str_substring(s, s, 5));     TEST_EQUAL(s, "");
+
         TEST_EQUAL(utf_substring(""s, 0), "");
         TEST_EQUAL(utf_substring(""s, 5), "");
         TEST_EQUAL(utf_substring(""s, 0, 0), "");
@@ -256,6 +325,31 @@ namespace {
         s = u8"€uro ∈lement";  TRY(str_translate_in(s, u8"€∈", u8"*"));         TEST_EQUAL(s, u8"*uro *lement");
         s = u8"€uro ∈lement";  TRY(str_translate_in(s, u8"e", u8"∇√"));         TEST_EQUAL(s, u8"€uro ∈l∇m∇nt");
 
+        Translator t;
+
+        TRY(t = Translator(u8"aeiou", u8"AEIOU"));
+        TEST_EQUAL(t.translate(u8""s), u8"");
+        TEST_EQUAL(t.translate(u8"Hello world"s), u8"HEllO wOrld");
+        TEST_EQUAL(t.translate(u8"The quick brown fox jumps over the lazy dog"s), u8"ThE qUIck brOwn fOx jUmps OvEr thE lAzy dOg");
+        TEST_EQUAL(t.translate(u8"€uro ∈lement αβγ"s), u8"€UrO ∈lEmEnt αβγ");
+        s = u8"The quick brown fox jumps over the lazy dog";
+        TRY(t.translate_in(s));
+        TEST_EQUAL(s, u8"ThE qUIck brOwn fOx jUmps OvEr thE lAzy dOg");
+
+        TRY(t = Translator(u8"aαa€", u8"bβc"));
+        TEST_EQUAL(t.translate(u8"abc αβγ €uro"s), u8"bbc ββγ curo");
+        s = u8"abc αβγ €uro";
+        TRY(t.translate_in(s));
+        TEST_EQUAL(s, u8"bbc ββγ curo");
+
+        TRY(t = Translator(u8"xyz", u8"ξψζ"));
+        TEST_EQUAL(t.translate(u8"xyzzy plugh"s), u8"ξψζζψ plugh");
+
+        TRY(t = Translator());
+        TEST_EQUAL(t.translate(u8"Hello world"s), u8"Hello world");
+        TRY(t = Translator(u8"abc", u8"abc"));
+        TEST_EQUAL(t.translate(u8"Hello world"s), u8"Hello world");
+
     }
 
     void check_trim() {
@@ -380,6 +474,44 @@ namespace {
 
     }
 
+    void check_truncate() {
+
+        u8string s;
+
+        TEST_EQUAL(str_truncate_bytes("", 0), 0);
+        TEST_EQUAL(str_truncate_bytes("", 10), 0);
+        TEST_EQUAL(str_truncate_bytes("Hello world", 0), 0);
+        TEST_EQUAL(str_truncate_bytes("Hello world", 5), 5);
+        TEST_EQUAL(str_truncate_bytes("Hello world", 20), 11);
+        TEST_EQUAL(str_truncate_bytes("Hello\r\nworld", 6), 5);
+        TEST_EQUAL(str_truncate_bytes("Hello\r\nworld", 7), 7);
+        TEST_EQUAL(str_truncate_bytes(u8"A\u00e9B", 2), 1);
+        TEST_EQUAL(str_truncate_bytes(u8"A\u00e9B", 3), 3);
+        TEST_EQUAL(str_truncate_bytes(u8"Ae\u0301\u0302B", 3), 1);
+        TEST_EQUAL(str_truncate_bytes(u8"Ae\u0301\u0302B", 5), 1);
+        TEST_EQUAL(str_truncate_bytes(u8"Ae\u0301\u0302B", 6), 6);
+        TEST_EQUAL(str_truncate_bytes(u8"\u65e5\u672c\u8a9e", 8), 6);
+
+        TEST_EQUAL(str_truncate_width("", 0), 0);
+        TEST_EQUAL(str_truncate_width("Hello world", 0), 0);
+        TEST_EQUAL(str_truncate_width("Hello world", 5), 5);
+        TEST_EQUAL(str_truncate_width("Hello world", 20), 11);
+        TEST_EQUAL(str_truncate_width(u8"Ae\u0301\u0302B", 1), 1);
+        TEST_EQUAL(str_truncate_width(u8"Ae\u0301\u0302B", 2), 6);
+        TEST_EQUAL(str_truncate_width(u8"\u65e5\u672c\u8a9e", 3), 3);
+        TEST_EQUAL(str_truncate_width(u8"\u65e5\u672c\u8a9e", 4), 6);
+        TEST_EQUAL(str_truncate_width(u8"\u65e5\u672c\u8a9e", 6), 9);
+        TEST_EQUAL(str_truncate_width(u8"a\u00b1b", 2), 3);
+        TEST_EQUAL(str_truncate_width(u8"a\u00b1b", 2, wide_context), 1);
+        TEST_EQUAL(str_truncate_width(u8"a\u00b1b", 3, wide_context), 3);
+        TEST_THROW(str_truncate_width("Hello", 1, narrow_context | wide_context), std::invalid_argument);
+
+        s = u8"Ae\u0301\u0302B";  TRY(str_truncate_bytes_in(s, 4));  TEST_EQUAL(s, "A");
+        s = u8"Ae\u0301\u0302B";  TRY(str_truncate_width_in(s, 2));  TEST_EQUAL(s, u8"Ae\u0301\u0302");
+        s = u8"\u65e5\u672c\u8a9e";  TRY(str_truncate_width_in(s, 5));  TEST_EQUAL(s, u8"\u65e5\u672c");
+
+    }
+
     void check_unify() {
 
         u8string s;
@@ -407,7 +539,7 @@ namespace {
 
     void check_wrap() {
 
-        u8string s, t;
+        u8string s, t, u;
 
         TEST_EQUAL(str_wrap(""s), ""s);
         TEST_EQUAL(str_wrap("\r\n"s), ""s);
@@ -426,6 +558,12 @@ namespace {
             "nostrud exercitation ullamco laboris\n"
             "nisi ut aliquip ex ea commodo consequat.\n";
         TEST_EQUAL(str_wrap(s, 0, 40), t);
+        u = "Previous contents";
+        TRY(str_wrap(s, u, 0, 40));
+        TEST_EQUAL(u, t);
+        u = s;
+        TRY(str_wrap(u, u, 0, 40));
+        TEST_EQUAL(u, t);
         TRY(str_wrap_in(s, 0, 40));
         TEST_EQUAL(s, t);
         s =
@@ -527,6 +665,27 @@ namespace {
         TRY(str_wrap_in(s, wrap_preserve, 40));
         TEST_EQUAL(s, t);
 
+        s = "See http://example.com/some/long/path here";
+        t =
+            //...:....1....:....2
+            "See http://\n"
+            "example.com/some/\n"
+            "long/path here\n";
+        TEST_EQUAL(str_wrap(s, wrap_breaks, 20), t);
+        TRY(str_wrap_in(s, wrap_breaks, 20));
+        TEST_EQUAL(s, t);
+        s = "See http://example.com/some/long/path here";
+        TEST_EQUAL(str_wrap(s, 0, 20), "See\nhttp://example.com/some/long/path\nhere\n");
+
+        s = u8"\u65e5\u672c\u8a9e\u306e\u30c6\u30ad\u30b9\u30c8\u3092\u6298\u308a\u8fd4\u3057\u307e\u3059\u3002";
+        t =
+            u8"\u65e5\u672c\u8a9e\u306e\u30c6\n"
+            u8"\u30ad\u30b9\u30c8\u3092\u6298\n"
+            u8"\u308a\u8fd4\u3057\u307e\n"
+            u8"\u3059\u3002\n";
+        TEST_EQUAL(str_wrap(s, wrap_breaks, 10), t);
+        TEST_EQUAL(str_wrap(s, 0, 10), s + "\n");
+
     }
 
 }
@@ -534,11 +693,13 @@ namespace {
 TEST_MODULE(unicorn, string_manipulation_s_z) {
 
     check_split();
+    check_split_range();
     check_squeeze();
     check_substring();
     check_translate();
     check_trim();
     check_trim_if();
+    check_truncate();
     check_unify();
     check_wrap();
 
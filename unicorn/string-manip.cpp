@@ -4,14 +4,79 @@ namespace Unicorn {
 
     namespace {
 
+        // Tests for membership in a list of characters without decoding the
+        // list. In valid UTF-8 a character's encoding can only match at a
+        // character boundary.
+
         class CharIn {
         public:
-            CharIn(const u32string& chars) noexcept: x(&chars) {}
-            bool operator()(char32_t c) const noexcept { return x->find(c) != npos; }
+            CharIn(const u8string& chars) noexcept: x(&chars) {}
+            bool operator()(char32_t c) const noexcept {
+                if (c < 0x80)
+                    return x->find(char(c)) != npos;
+                char buf[4];
+                size_t n = UnicornDetail::UtfEncoding<char>::encode(c, buf);
+                return x->find(buf, 0, n) != npos;
+            }
         private:
-            const u32string* x;
+            const u8string* x;
         };
 
+        bool is_ascii(const u8string& str) noexcept {
+            return std::all_of(str.begin(), str.end(), [] (char c) { return uint8_t(c) < 0x80; });
+        }
+
+        // Removes bytes from an ASCII set. Leading blocks with nothing to
+        // remove are skipped eight bytes at a time; the zero byte test in
+        // swar_any_equal() is exact as to whether any byte matches, whatever
+        // the other bytes are.
+
+        void remove_ascii_in(u8string& str, const u8string& chars) {
+            std::array<bool, 256> table = {{}};
+            for (char c: chars)
+                table[uint8_t(c)] = true;
+            size_t n = str.size(), i = 0;
+            if (n == 0)
+                return;
+            char* ptr = &str[0];
+            if (chars.size() <= 4) {
+                for (; i + 8 <= n; i += 8) {
+                    auto w = UnicornDetail::swar_load(ptr + i);
+                    if (std::any_of(chars.begin(), chars.end(), [w] (char c) { return UnicornDetail::swar_any_equal(w, uint8_t(c)) != 0; }))
+                        break;
+                }
+            }
+            while (i < n && ! table[uint8_t(ptr[i])])
+                ++i;
+            size_t j = i;
+            for (; i < n; ++i)
+                if (! table[uint8_t(ptr[i])])
+                    ptr[j++] = ptr[i];
+            str.resize(j);
+        }
+
+        // Returns the offset of the first character at or after pos that
+        // satisfies the predicate, or the end of the string. ASCII
+        // characters are tested without decoding.
+
+        template <typename Pred>
+        size_t find_char_if(const u8string& str, size_t pos, Pred p) {
+            size_t n = str.size();
+            while (pos < n) {
+                if (uint8_t(str[pos]) < 0x80) {
+                    if (p(char32_t(str[pos])))
+                        break;
+                    ++pos;
+                } else {
+                    auto i = utf_iterator(str, pos);
+                    if (p(*i))
+                        break;
+                    pos += i.count();
+                }
+            }
+            return pos;
+        }
+
         void insert_padding(u8string& str, size_t old_length, size_t new_length, char32_t c, uint32_t flags, char side) {
             size_t pad_chars = new_length - old_length;
             if (flags & UnicornDetail::east_asian_flags) {
@@ -34,19 +99,45 @@ namespace Unicorn {
             }
         }
 
-        void squeeze_helper(const u8string& src, u8string& dst, bool trim) {
-            auto i = utf_begin(src), end = utf_end(src);
-            if (trim)
-                i = std::find_if_not(i, end, char_is_white_space);
-            while (i != end) {
-                auto j = std::find_if(i, end, char_is_white_space);
-                str_append(dst, i, j);
-                if (j == end)
-                    break;
-                i = std::find_if_not(j, end, char_is_white_space);
-                if (! trim || i != end)
-                    dst += ' ';
+        // Squeezing is done in place when the substitute is no longer than
+        // any of the characters it replaces, so the write position can never
+        // overtake the read position.
+
+        template <typename Pred>
+        void squeeze_in_helper(u8string& str, bool trim, Pred p, const char* sub, size_t sublen) {
+            size_t n = str.size(), r = 0, w = 0;
+            bool pending = false;
+            while (r < n) {
+                size_t len = 1;
+                char32_t c = uint8_t(str[r]);
+                if (c >= 0x80) {
+                    auto i = utf_iterator(str, r);
+                    c = *i;
+                    len = i.count();
+                }
+                if (p(c)) {
+                    pending = true;
+                } else {
+                    if (pending && (w > 0 || ! trim)) {
+                        std::memcpy(&str[w], sub, sublen);
+                        w += sublen;
+                    }
+                    pending = false;
+                    if (w != r)
+                        std::memmove(&str[w], &str[r], len);
+                    w += len;
+                }
+                r += len;
+            }
+            if (pending && ! trim) {
+                std::memcpy(&str[w], sub, sublen);
+                w += sublen;
             }
+            str.resize(w);
+        }
+
+        void squeeze_in_helper(u8string& str, bool trim) {
+            squeeze_in_helper(str, trim, char_is_white_space, " ", 1);
         }
 
         void squeeze_helper(const u8string& src, u8string& dst, bool trim, const u8string& chars) {
@@ -69,6 +160,23 @@ namespace Unicorn {
             }
         }
 
+        void squeeze_in_helper(u8string& str, bool trim, const u8string& chars) {
+            if (chars.empty())
+                return;
+            size_t sublen = utf_begin(chars).count(), minlen = 4;
+            for (auto i = utf_begin(chars), e = utf_end(chars); i != e; ++i)
+                minlen = std::min(minlen, i.count());
+            if (sublen <= minlen) {
+                squeeze_in_helper(str, trim, CharIn(chars), chars.data(), sublen);
+            } else {
+                u8string dst;
+                squeeze_helper(str, dst, trim, chars);
+                str.swap(dst);
+            }
+        }
+
+        constexpr size_t builder_chunk = 1024;
+
     }
 
     namespace UnicornDetail {
@@ -389,6 +497,12 @@ namespace Unicorn {
         }
     }
 
+    void str_pad_left(const u8string& str, u8string& dst, size_t length, char32_t c, uint32_t flags) {
+        if (&str != &dst)
+            dst.assign(str);
+        str_pad_left_in(dst, length, c, flags);
+    }
+
     void str_pad_left_in(u8string& str, size_t length, char32_t c, uint32_t flags) {
         size_t old_length = str_length(str, flags);
         if (length > old_length)
@@ -406,6 +520,12 @@ namespace Unicorn {
         }
     }
 
+    void str_pad_right(const u8string& str, u8string& dst, size_t length, char32_t c, uint32_t flags) {
+        if (&str != &dst)
+            dst.assign(str);
+        str_pad_right_in(dst, length, c, flags);
+    }
+
     void str_pad_right_in(u8string& str, size_t length, char32_t c, uint32_t flags) {
         size_t old_length = str_length(str, flags);
         if (length > old_length)
@@ -483,54 +603,84 @@ namespace Unicorn {
     }
 
     u8string str_remove(const u8string& str, char32_t c) {
-        u8string dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [c] (char32_t x) { return x != c; });
+        u8string dst = str;
+        str_remove_in(dst, c);
         return dst;
     }
 
     u8string str_remove(const u8string& str, const u8string& chars) {
-        u8string dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [&chars] (char32_t x) { return chars.find(x) == npos; });
+        u8string dst = str;
+        str_remove_in(dst, chars);
         return dst;
     }
 
     void str_remove_in(u8string& str, char32_t c) {
-        u8string dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [c] (char32_t x) { return x != c; });
-        str.swap(dst);
+        if (c < 0x80)
+            remove_ascii_in(str, u8string(1, char(c)));
+        else
+            UnicornDetail::remove_in_helper(str, [c] (char32_t x) { return x == c; });
     }
 
     void str_remove_in(u8string& str, const u8string& chars) {
-        u8string dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [&chars] (char32_t x) { return chars.find(x) == npos; });
-        str.swap(dst);
+        if (is_ascii(chars))
+            remove_ascii_in(str, chars);
+        else
+            UnicornDetail::remove_in_helper(str, CharIn(chars));
     }
 
     u8string str_repeat(const u8string& str, size_t n) {
-        if (n == 0 || str.empty())
-            return {};
-        if (n == 1)
-            return str;
-        if (str.size() == 1)
-            return u8string(n, str[0]);
-        size_t size = n * str.size();
-        auto dst = str;
-        dst.reserve(size);
-        while (dst.size() <= size / 2)
-            dst += dst;
-        dst += str_repeat(str, n - dst.size() / str.size());
+        u8string dst;
+        str_repeat(str, dst, n);
         return dst;
     }
 
+    void str_repeat(const u8string& str, u8string& dst, size_t n) {
+        if (&str != &dst) {
+            dst.clear();
+            if (n > 0) {
+                dst.reserve(n * str.size());
+                dst += str;
+            }
+        }
+        str_repeat_in(dst, n);
+    }
+
     void str_repeat_in(u8string& str, size_t n) {
-        auto dst = str_repeat(str, n);
-        str.swap(dst);
+        if (n == 0 || str.empty()) {
+            str.clear();
+            return;
+        }
+        if (str.size() == 1) {
+            str.assign(n, str[0]);
+            return;
+        }
+        size_t size = n * str.size();
+        str.reserve(size);
+        while (str.size() <= size / 2)
+            str.append(str);
+        str.append(str, 0, size - str.size());
     }
 
     u8string str_replace(const u8string& str, const u8string& target, const u8string& sub, size_t n) {
-        if (target.empty() || n == 0)
-            return str;
         u8string dst;
+        str_replace(str, dst, target, sub, n);
+        return dst;
+    }
+
+    void str_replace(const u8string& str, u8string& dst, const u8string& target, const u8string& sub, size_t n) {
+        if (&str == &dst) {
+            str_replace_in(dst, target, sub, n);
+            return;
+        }
+        if (&dst == &target || &dst == &sub) {
+            dst = str_replace(str, target, sub, n);
+            return;
+        }
+        if (target.empty() || n == 0) {
+            dst.assign(str);
+            return;
+        }
+        dst.clear();
         size_t i = 0, size = str.size(), tsize = target.size();
         for (size_t k = 0; k < n && i < size; ++k) {
             auto j = str.find(target, i);
@@ -545,60 +695,72 @@ namespace Unicorn {
         }
         if (i < size)
             dst.append(str, i, npos);
-        return dst;
     }
 
     void str_replace_in(u8string& str, const u8string& target, const u8string& sub, size_t n) {
-        auto result = str_replace(str, target, sub, n);
-        str.swap(result);
+        if (target.empty() || n == 0)
+            return;
+        if (sub.size() > target.size() || &str == &target || &str == &sub) {
+            u8string result;
+            str_replace(str, result, target, sub, n);
+            str.swap(result);
+            return;
+        }
+        // The result is no longer than the original, so each unchanged span
+        // and substitution can be copied down over text already consumed.
+        size_t i = 0, out = 0, tsize = target.size();
+        for (size_t k = 0; k < n; ++k) {
+            auto j = str.find(target, i);
+            if (j == npos)
+                break;
+            if (out < i)
+                std::copy(str.begin() + i, str.begin() + j, str.begin() + out);
+            out += j - i;
+            std::copy(sub.begin(), sub.end(), str.begin() + out);
+            out += sub.size();
+            i = j + tsize;
+        }
+        str.erase(out, i - out);
     }
 
     u8string str_squeeze(const u8string& str) {
-        u8string dst;
-        squeeze_helper(str, dst, false);
+        u8string dst = str;
+        squeeze_in_helper(dst, false);
         return dst;
     }
 
     u8string str_squeeze(const u8string& str, const u8string& chars) {
-        u8string dst;
-        squeeze_helper(str, dst, false, chars);
+        u8string dst = str;
+        squeeze_in_helper(dst, false, chars);
         return dst;
     }
 
     u8string str_squeeze_trim(const u8string& str) {
-        u8string dst;
-        squeeze_helper(str, dst, true);
+        u8string dst = str;
+        squeeze_in_helper(dst, true);
         return dst;
     }
 
     u8string str_squeeze_trim(const u8string& str, const u8string& chars) {
-        u8string dst;
-        squeeze_helper(str, dst, true, chars);
+        u8string dst = str;
+        squeeze_in_helper(dst, true, chars);
         return dst;
     }
 
     void str_squeeze_in(u8string& str) {
-        u8string dst;
-        squeeze_helper(str, dst, false);
-        str.swap(dst);
+        squeeze_in_helper(str, false);
     }
 
     void str_squeeze_in(u8string& str, const u8string& chars) {
-        u8string dst;
-        squeeze_helper(str, dst, false, chars);
-        str.swap(dst);
+        squeeze_in_helper(str, false, chars);
     }
 
     void str_squeeze_trim_in(u8string& str) {
-        u8string dst;
-        squeeze_helper(str, dst, true);
-        str.swap(dst);
+        squeeze_in_helper(str, true);
     }
 
     void str_squeeze_trim_in(u8string& str, const u8string& chars) {
-        u8string dst;
-        squeeze_helper(str, dst, true, chars);
-        str.swap(dst);
+        squeeze_in_helper(str, true, chars);
     }
 
     u8string str_substring(const u8string& str, size_t offset, size_t count) {
@@ -608,6 +770,18 @@ namespace Unicorn {
             return {};
     }
 
+    void str_substring(const u8string& str, u8string& dst, size_t offset, size_t count) {
+        if (offset >= str.size()) {
+            dst.clear();
+        } else if (&str == &dst) {
+            if (count < dst.size() - offset)
+                dst.resize(offset + count);
+            dst.erase(0, offset);
+        } else {
+            dst.assign(str, offset, count);
+        }
+    }
+
     u8string utf_substring(const u8string& str, size_t index, size_t length, uint32_t flags) {
         UnicornDetail::check_length_flags(flags);
         auto b = utf_begin(str), e = utf_end(str);
@@ -617,29 +791,15 @@ namespace Unicorn {
     }
 
     u8string str_translate(const u8string& str, const u8string& target, const u8string& sub) {
-        if (target.empty() || sub.empty())
-            return str;
-        auto t = to_utf32(target), s = to_utf32(sub);
-        if (s.size() < t.size())
-            s.resize(t.size(), s.back());
-        u8string dst;
-        dst.reserve(str.size());
-        for (auto c: utf_range(str)) {
-            size_t pos = t.find(c);
-            if (pos != npos)
-                c = s[pos];
-            str_append_char(dst, c);
-        }
-        return dst;
+        return Translator(target, sub).translate(str);
     }
 
     void str_translate_in(u8string& str, const u8string& target, const u8string& sub) {
-        auto result = str_translate(str, target, sub);
-        str.swap(result);
+        Translator(target, sub).translate_in(str);
     }
 
     u8string str_trim(const u8string& str, const u8string& chars) {
-        return str_trim_if(str, CharIn(to_utf32(chars)));
+        return str_trim_if(str, CharIn(chars));
     }
 
     u8string str_trim(const u8string& str) {
@@ -647,7 +807,7 @@ namespace Unicorn {
     }
 
     u8string str_trim_left(const u8string& str, const u8string& chars) {
-        return str_trim_left_if(str, CharIn(to_utf32(chars)));
+        return str_trim_left_if(str, CharIn(chars));
     }
 
     u8string str_trim_left(const u8string& str) {
@@ -655,7 +815,7 @@ namespace Unicorn {
     }
 
     u8string str_trim_right(const u8string& str, const u8string& chars) {
-        return str_trim_right_if(str, CharIn(to_utf32(chars)));
+        return str_trim_right_if(str, CharIn(chars));
     }
 
     u8string str_trim_right(const u8string& str) {
@@ -663,7 +823,7 @@ namespace Unicorn {
     }
 
     void str_trim_in(u8string& str, const u8string& chars) {
-        str_trim_in_if(str, CharIn(to_utf32(chars)));
+        str_trim_in_if(str, CharIn(chars));
     }
 
     void str_trim_in(u8string& str) {
@@ -671,7 +831,7 @@ namespace Unicorn {
     }
 
     void str_trim_left_in(u8string& str, const u8string& chars) {
-        str_trim_left_in_if(str, CharIn(to_utf32(chars)));
+        str_trim_left_in_if(str, CharIn(chars));
     }
 
     void str_trim_left_in(u8string& str) {
@@ -679,13 +839,66 @@ namespace Unicorn {
     }
 
     void str_trim_right_in(u8string& str, const u8string& chars) {
-        str_trim_right_in_if(str, CharIn(to_utf32(chars)));
+        str_trim_right_in_if(str, CharIn(chars));
     }
 
     void str_trim_right_in(u8string& str) {
         str_trim_right_in_if(str, char_is_white_space);
     }
 
+    size_t str_truncate_bytes(const u8string& str, size_t bytes) {
+        if (bytes >= str.size())
+            return str.size();
+        return prev_grapheme_boundary(str, bytes);
+    }
+
+    size_t str_truncate_width(const u8string& str, size_t width, uint32_t flags) {
+        using namespace UnicornDetail;
+        using GCB = Grapheme_Cluster_Break;
+        if (bits_set(flags & east_asian_flags) > 1)
+            throw std::invalid_argument("Inconsistent string length flags");
+        auto data = str.data();
+        size_t i = 0, n = str.size(), total = 0;
+        auto prev = GCB::SOT;
+        while (i < n) {
+            char32_t c;
+            size_t units;
+            GCB gcb;
+            auto b = uint8_t(data[i]);
+            if (b < 0x80) {
+                c = b;
+                units = 1;
+                if (b >= 0x20 && b < 0x7f)
+                    gcb = GCB::Other;
+                else if (b == '\r')
+                    gcb = GCB::CR;
+                else if (b == '\n')
+                    gcb = GCB::LF;
+                else
+                    gcb = GCB::Control;
+            } else {
+                units = UtfEncoding<char>::decode_fast(data + i, n - i, c);
+                gcb = grapheme_cluster_break(c);
+            }
+            if (is_restart_point(prev, gcb)) {
+                total += east_asian_char_width(c, flags);
+                if (total > width)
+                    return i;
+            }
+            prev = gcb;
+            i += units;
+        }
+        return n;
+    }
+
+    void str_truncate_bytes_in(u8string& str, size_t bytes) {
+        str.resize(str_truncate_bytes(str, bytes));
+    }
+
+    void str_truncate_width_in(u8string& str, size_t width, uint32_t flags) {
+        str.resize(str_truncate_width(str, width, flags));
+    }
+
     u8string str_unify_lines(const u8string& str, const u8string& newline) {
         auto i = utf_begin(str), e = utf_end(str);
         u8string result;
@@ -726,7 +939,17 @@ namespace Unicorn {
     }
 
     u8string str_wrap(const u8string& str, uint32_t flags, size_t width, size_t margin1, size_t margin2) {
+        u8string result;
+        str_wrap(str, result, flags, width, margin1, margin2);
+        return result;
+    }
+
+    void str_wrap(const u8string& str, u8string& dst, uint32_t flags, size_t width, size_t margin1, size_t margin2) {
         using namespace UnicornDetail;
+        if (&str == &dst) {
+            str_wrap_in(dst, flags, width, margin1, margin2);
+            return;
+        }
         if (width == 0 || width == npos) {
             auto columns = decnum(cstr(getenv("COLUMNS")));
             if (columns < 3)
@@ -738,7 +961,12 @@ namespace Unicorn {
         if (margin1 >= width || margin2 >= width)
             throw std::length_error("Word wrap width and margins are inconsistent");
         size_t spacing = flags & wide_context ? 2 : 1;
-        u8string newline, result;
+        uint32_t length_flags = flags & all_length_flags;
+        if ((flags & wrap_breaks) && length_flags == 0)
+            length_flags = narrow_context;
+        u8string newline;
+        auto& result = dst;
+        result.clear();
         if (flags & wrap_crlf)
             newline = "\r\n";
         else
@@ -746,6 +974,30 @@ namespace Unicorn {
         auto range = utf_range(str);
         auto i = range.begin(), e = range.end();
         size_t linewidth = 0, words = 0, linebreaks = 0, spaces = margin1, tailspaces = 0;
+        auto add_word = [&] (const Irange<Utf8Iterator>& range, bool spaced) {
+            auto word = u_str(range);
+            auto wordlen = str_length(word, length_flags);
+            if (words > 0) {
+                size_t gap = spaced ? spacing : 0;
+                if (linewidth + wordlen + gap > size_t(width)) {
+                    result += newline;
+                    words = linewidth = 0;
+                } else if (spaced) {
+                    result += ' ';
+                    linewidth += spacing;
+                }
+            }
+            if (words == 0) {
+                result.append(spaces, ' ');
+                linewidth = spaces * spacing;
+                spaces = margin2;
+            }
+            result += word;
+            ++words;
+            linewidth += wordlen;
+            if ((flags & wrap_enforce) && linewidth > size_t(width))
+                throw std::length_error("Word is too long for wrapping width");
+        };
         while (i != e) {
             auto j = std::find_if_not(i, e, char_is_white_space);
             if (j == e)
@@ -770,38 +1022,279 @@ namespace Unicorn {
                 words = linewidth = 0;
             } else {
                 j = std::find_if(i, e, char_is_white_space);
-                auto word = u_str(i, j);
-                auto wordlen = str_length(word, flags & all_length_flags);
-                if (words > 0) {
-                    if (linewidth + wordlen + spacing > size_t(width)) {
-                        result += newline;
-                        words = linewidth = 0;
-                    } else {
-                        result += ' ';
-                        linewidth += spacing;
+                if (flags & wrap_breaks) {
+                    bool first = true;
+                    for (auto& chunk: line_break_range(i, j)) {
+                        add_word(chunk, first);
+                        first = false;
                     }
+                } else {
+                    add_word({i, j}, true);
                 }
-                if (words == 0) {
-                    result.append(spaces, ' ');
-                    linewidth = spaces * spacing;
-                    spaces = margin2;
-                }
-                result += word;
-                ++words;
-                linewidth += wordlen;
-                if ((flags & wrap_enforce) && linewidth > size_t(width))
-                    throw std::length_error("Word is too long for wrapping width");
             }
             i = j;
         }
         if (words > 0)
             result += newline;
-        return result;
     }
 
     void str_wrap_in(u8string& str, uint32_t flags, size_t width, size_t margin1, size_t margin2) {
-        auto result = str_wrap(str, flags, width, margin1, margin2);
+        u8string result;
+        str_wrap(str, result, flags, width, margin1, margin2);
         str.swap(result);
     }
 
+    // Class StrSplitIterator
+
+    // The delimiter is prepared once per range and shared by every copy of
+    // the iterator, so copying one never allocates. A delimiter string is
+    // compiled into a StringSearch; a delimiter set is decoded into a table
+    // of ASCII characters and a sorted list of any others, with the original
+    // string kept for byte scanning when the set is all ASCII.
+
+    struct StrSplitIterator::delimiter {
+        StringSearch search;                    // Delimiter string (split_at)
+        u8string chars;                         // Delimiter characters (split_by)
+        std::array<bool, 128> ascii = {{}};     // ASCII delimiter characters (split_by)
+        u32string other;                        // Non-ASCII delimiter characters, sorted (split_by)
+        bool contains(char32_t c) const noexcept
+            { return c < 0x80 ? ascii[c] : std::binary_search(other.begin(), other.end(), c); }
+    };
+
+    StrSplitIterator::StrSplitIterator(const u8string& s, int k, const u8string& d):
+    src(&s), pos(0), kind(k) {
+        if (! d.empty()) {
+            auto dp = std::make_shared<delimiter>();
+            if (kind == split_at) {
+                dp->search = StringSearch(d);
+            } else {
+                dp->chars = d;
+                for (auto c: utf_range(d)) {
+                    if (c < 0x80)
+                        dp->ascii[c] = true;
+                    else
+                        dp->other += c;
+                }
+                std::sort(dp->other.begin(), dp->other.end());
+            }
+            delim = dp;
+        }
+        ++*this;
+    }
+
+    StrSplitRange str_split_range(const u8string& src) {
+        return {StrSplitIterator(src, StrSplitIterator::split_ws), {}};
+    }
+
+    StrSplitRange str_split_at_range(const u8string& src, const u8string& delim) {
+        return {StrSplitIterator(src, StrSplitIterator::split_at, delim), {}};
+    }
+
+    StrSplitRange str_split_by_range(const u8string& src, const u8string& delim) {
+        return {StrSplitIterator(src, StrSplitIterator::split_by, delim), {}};
+    }
+
+    StrSplitRange str_split_lines_range(const u8string& src) {
+        return {StrSplitIterator(src, StrSplitIterator::split_lines), {}};
+    }
+
+    StrSplitIterator& StrSplitIterator::operator++() {
+        auto& str = *src;
+        size_t size = str.size(), start = npos, stop = size;
+        auto not_space = [] (char32_t c) { return ! char_is_white_space(c); };
+        if ((kind == split_at || kind == split_by) && ! delim) {
+            if (pending)
+                start = 0;
+            pending = false;
+        } else if (kind == split_ws) {
+            start = find_char_if(str, next, not_space);
+            if (start < size)
+                next = stop = find_char_if(str, start, char_is_white_space);
+            else
+                start = npos;
+        } else if (kind == split_at) {
+            if (pending) {
+                start = next;
+                stop = delim->search.find(str, next);
+                if (stop == npos) {
+                    stop = size;
+                    pending = false;
+                } else {
+                    next = stop + delim->search.target().size();
+                }
+            }
+        } else if (kind == split_by) {
+            auto& d = *delim;
+            if (d.other.empty()) {
+                start = str.find_first_not_of(d.chars, next);
+                if (start != npos)
+                    stop = std::min(str.find_first_of(d.chars, start), size);
+            } else {
+                auto in_delim = [&d] (char32_t c) { return d.contains(c); };
+                auto not_in_delim = [&d] (char32_t c) { return ! d.contains(c); };
+                start = find_char_if(str, next, not_in_delim);
+                if (start < size)
+                    stop = find_char_if(str, start, in_delim);
+                else
+                    start = npos;
+            }
+            next = stop;
+        } else if (next < size) {
+            start = next;
+            stop = find_char_if(str, start, char_is_line_break);
+            next = stop;
+            if (stop < size) {
+                if (str[stop] == '\r' && stop + 1 < size && str[stop + 1] == '\n')
+                    next += 2;
+                else
+                    next += utf_iterator(str, stop).count();
+            }
+        }
+        pos = start;
+        if (start == npos)
+            field = {};
+        else
+            field = {utf_iterator(str, start), utf_iterator(str, stop)};
+        return *this;
+    }
+
+    // Class StrBuilder
+
+    // Text is accumulated in chunks that are never reallocated: a new chunk
+    // is started whenever the current one lacks the capacity for the next
+    // piece, and large strings passed by value are kept as chunks of their
+    // own. Each byte is copied once on the way in and once into the result.
+
+    StrBuilder& StrBuilder::operator+=(u8string&& str) {
+        if (str.size() < builder_chunk) {
+            append(str.data(), str.size());
+        } else {
+            len += str.size();
+            parts.push_back(std::move(str));
+        }
+        return *this;
+    }
+
+    StrBuilder& StrBuilder::operator+=(char32_t c) {
+        char buf[4];
+        size_t n = UnicornDetail::UtfEncoding<char>::encode(c, buf);
+        append(buf, n);
+        return *this;
+    }
+
+    void StrBuilder::append_to(u8string& dst) const {
+        dst.reserve(dst.size() + len);
+        for (auto& part: parts)
+            dst += part;
+    }
+
+    void StrBuilder::append(const char* ptr, size_t n) {
+        if (n == 0)
+            return;
+        if (parts.empty() || parts.back().size() + n > parts.back().capacity()) {
+            parts.emplace_back();
+            parts.back().reserve(std::max(n, builder_chunk));
+        }
+        parts.back().append(ptr, n);
+        len += n;
+    }
+
+    // Class Translator
+
+    // ASCII characters are looked up in a direct table, anything else in a
+    // sorted list. If only ASCII characters are mapped, and only to other
+    // ASCII characters, the string can be translated in place one byte at a
+    // time, and eight byte blocks with nothing in the range of mapped
+    // characters are skipped without being written.
+
+    Translator::Translator() {
+        for (char32_t c = 0; c < 0x80; ++c)
+            ascii[c] = c;
+    }
+
+    Translator::Translator(const u8string& target, const u8string& sub):
+    Translator() {
+        if (target.empty() || sub.empty())
+            return;
+        auto t = to_utf32(target), s = to_utf32(sub);
+        if (s.size() < t.size())
+            s.resize(t.size(), s.back());
+        std::array<bool, 128> seen = {{}};
+        for (size_t i = 0; i < t.size(); ++i) {
+            char32_t c = t[i];
+            if (c < 0x80) {
+                if (seen[c])
+                    continue;
+                seen[c] = true;
+                ascii[c] = s[i];
+                if (s[i] >= 0x80)
+                    bytewise = false;
+                if (s[i] != c) {
+                    first = std::min(first, uint8_t(c));
+                    last = std::max(last, uint8_t(c));
+                }
+            } else {
+                others.push_back({c, s[i]});
+                bytewise = false;
+            }
+        }
+        // Keep the first mapping for each character
+        std::stable_sort(others.begin(), others.end(),
+            [] (const std::pair<char32_t, char32_t>& a, const std::pair<char32_t, char32_t>& b) { return a.first < b.first; });
+        others.erase(std::unique(others.begin(), others.end(),
+            [] (const std::pair<char32_t, char32_t>& a, const std::pair<char32_t, char32_t>& b) { return a.first == b.first; }),
+            others.end());
+    }
+
+    u8string Translator::translate(const u8string& str) const {
+        if (bytewise) {
+            u8string dst = str;
+            translate_in(dst);
+            return dst;
+        }
+        u8string dst;
+        dst.reserve(str.size());
+        size_t pos = 0, size = str.size();
+        while (pos < size) {
+            auto b = uint8_t(str[pos]);
+            if (b < 0x80) {
+                str_append_char(dst, ascii[b]);
+                ++pos;
+            } else {
+                auto i = utf_iterator(str, pos);
+                auto it = std::lower_bound(others.begin(), others.end(), std::make_pair(*i, char32_t(0)));
+                if (it != others.end() && it->first == *i)
+                    str_append_char(dst, it->second);
+                else
+                    dst.append(str, pos, i.count());
+                pos += i.count();
+            }
+        }
+        return dst;
+    }
+
+    void Translator::translate_in(u8string& str) const {
+        using namespace UnicornDetail;
+        if (! bytewise) {
+            auto result = translate(str);
+            str.swap(result);
+            return;
+        }
+        if (first > last || str.empty())
+            return;
+        char* ptr = &str[0];
+        size_t pos = 0, size = str.size();
+        for (; pos + 8 <= size; pos += 8) {
+            auto w = swar_load(ptr + pos);
+            if (swar_is_ascii(w) && ! swar_in_range(w, first, last))
+                continue;
+            for (size_t i = pos; i < pos + 8; ++i)
+                if (uint8_t(ptr[i]) < 0x80)
+                    ptr[i] = char(ascii[uint8_t(ptr[i])]);
+        }
+        for (; pos < size; ++pos)
+            if (uint8_t(ptr[pos]) < 0x80)
+                ptr[pos] = char(ascii[uint8_t(ptr[pos])]);
+    }
+
 }
@@ -2,6 +2,67 @@
 
 namespace Unicorn {
 
+    namespace UnicornDetail {
+
+        size_t count_length(const Irange<Utf8Iterator>& range, uint32_t flags) noexcept {
+            using GCB = Grapheme_Cluster_Break;
+            auto ptr = range.begin().source().data() + range.begin().offset();
+            size_t i = 0, n = range.end().offset() - range.begin().offset(), total = 0;
+            auto prev = GCB::SOT;
+            while (i < n) {
+                // Every printable ASCII character is a separate grapheme,
+                // advancing, and narrow, unless it follows a prepend
+                // character; skip over them a word at a time.
+                if (prev != GCB::Prepend) {
+                    size_t start = i;
+                    for (; i + 8 <= n; i += 8) {
+                        auto w = swar_load(ptr + i);
+                        if (! swar_is_ascii(w) || swar_any_less(w, 0x20) || swar_any_equal(w, 0x7f))
+                            break;
+                    }
+                    if (i > start) {
+                        total += i - start;
+                        prev = GCB::Other;
+                        if (i == n)
+                            break;
+                    }
+                }
+                char32_t c;
+                size_t units;
+                GCB gcb;
+                auto b = uint8_t(ptr[i]);
+                if (b < 0x80) {
+                    c = b;
+                    units = 1;
+                    if (b >= 0x20 && b < 0x7f)
+                        gcb = GCB::Other;
+                    else if (b == '\r')
+                        gcb = GCB::CR;
+                    else if (b == '\n')
+                        gcb = GCB::LF;
+                    else
+                        gcb = GCB::Control;
+                } else {
+                    units = UtfEncoding<char>::decode_fast(ptr + i, n - i, c);
+                    gcb = flags & grapheme_units ? grapheme_cluster_break(c) : GCB::Other;
+                }
+                i += units;
+                if (flags & grapheme_units) {
+                    bool start = is_restart_point(prev, gcb);
+                    prev = gcb;
+                    if (! start)
+                        continue;
+                }
+                if (flags & east_asian_flags)
+                    total += east_asian_char_width(c, flags);
+                else if (c < 0x80 || char_is_advancing(c))
+                    ++total;
+            }
+            return total;
+        }
+
+    }
+
     bool str_is_east_asian(const u8string& str) {
         auto range = utf_range(str);
         for (char32_t c: range) {
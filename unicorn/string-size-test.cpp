@@ -4,6 +4,7 @@
 #include "unicorn/utf.hpp"
 #include "prion/unit-test.hpp"
 #include <string>
+#include <vector>
 
 using namespace std::literals;
 using namespace Unicorn;
@@ -236,6 +237,46 @@ namespace {
         TRY(s8 = u8"ààà\u3000\u3000\u3000");                TEST_EQUAL(str_length(utf_range(s8), narrow_context), 9);    TEST_EQUAL(str_length(utf_begin(s8), utf_end(s8), narrow_context), 9);
         TRY(s8 = u8"ààà\u3000\u3000\u3000");                TEST_EQUAL(str_length(utf_range(s8), wide_context), 12);     TEST_EQUAL(str_length(utf_begin(s8), utf_end(s8), wide_context), 12);
 
+        // Long mixed strings exercise the word-at-a-time ASCII path
+
+        const vector<u8string> mixed = {
+            u8"The quick brown fox jumps over the lazy dog",
+            u8"The quick brown fox\r\njumps over\tthe lazy dog\x7f",
+            u8"Quick brown fox e\u0301\u0302 jumps over the lazy dog a\u0301",
+            u8"\u0600abcdefghijklmnop\u0600\u0600qrstuvwxyz",
+            u8"abcdefgh\u65e5\u672c\u8a9eijklmnop\u00e0\u00e0\u00e0qrstuvwxyz\u3000",
+            u8"\u1100\u1161\u11a8abcdefghij\U0001f1e6\U0001f1e8klmnopqrst\ufe00",
+        };
+        const vector<uint32_t> modes = {
+            grapheme_units, narrow_context, wide_context,
+            grapheme_units | narrow_context, grapheme_units | wide_context,
+        };
+
+        for (auto& text: mixed) {
+            auto text32 = to_utf32(text);
+            for (auto mode: modes) {
+                size_t expect = 0;
+                UnicornDetail::EastAsianCount eac(mode);
+                if (mode & grapheme_units) {
+                    for (auto& g: grapheme_range(text32)) {
+                        eac.add(*g.begin());
+                        if (UnicornDetail::grapheme_is_advancing(g))
+                            ++expect;
+                    }
+                } else {
+                    for (auto c: text32)
+                        eac.add(c);
+                }
+                if (mode & (narrow_context | wide_context))
+                    expect = eac.get();
+                TEST_EQUAL(str_length(text, mode), expect);
+                TEST_EQUAL(str_length(text32, mode), expect);
+            }
+            auto range = utf_range(text);
+            auto sub = irange(std::next(range.begin(), 2), std::prev(range.end(), 2));
+            TEST_EQUAL(str_length(sub, grapheme_units | narrow_context), str_length(u_str(sub), grapheme_units | narrow_context));
+        }
+
     }
 
     void check_find_offset() {
@@ -5,8 +5,11 @@
 #include "unicorn/segment.hpp"
 #include "unicorn/utf.hpp"
 #include <algorithm>
+#include <array>
 #include <cerrno>
+#include <clocale>
 #include <cmath>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
 #include <initializer_list>
@@ -31,6 +34,7 @@ namespace Unicorn {
     u8string str_char(char32_t c);
     u8string str_chars(size_t n, char32_t c);
     u8string str_repeat(const u8string& str, size_t n);
+    void str_repeat(const u8string& str, u8string& dst, size_t n);
     void str_repeat_in(u8string& str, size_t n);
 
     template <typename C>
@@ -71,6 +75,32 @@ namespace Unicorn {
         str_append_char(dst, c2, chars...);
     }
 
+    namespace UnicornDetail {
+
+        // Word-at-a-time helpers for scanning UTF-8 eight bytes at once.
+        // Apart from swar_is_ascii(), these assume all bytes are ASCII.
+
+        constexpr uint64_t swar_low_bytes = 0x0101010101010101ull;
+        constexpr uint64_t swar_high_bits = 0x8080808080808080ull;
+
+        inline uint64_t swar_load(const char* ptr) noexcept { uint64_t w; std::memcpy(&w, ptr, 8); return w; }
+        inline void swar_store(char* ptr, uint64_t w) noexcept { std::memcpy(ptr, &w, 8); }
+        inline bool swar_is_ascii(uint64_t w) noexcept { return (w & swar_high_bits) == 0; }
+
+        // Nonzero if any byte is less than n (n <= 0x80)
+        inline uint64_t swar_any_less(uint64_t w, unsigned n) noexcept
+            { return (w - n * swar_low_bytes) & ~w & swar_high_bits; }
+
+        // Nonzero if any byte is equal to c
+        inline uint64_t swar_any_equal(uint64_t w, unsigned c) noexcept
+            { w ^= c * swar_low_bytes; return (w - swar_low_bytes) & ~w & swar_high_bits; }
+
+        // High bit set in exactly the bytes in the range [first,last]
+        inline uint64_t swar_in_range(uint64_t w, unsigned first, unsigned last) noexcept
+            { return (w + (0x80 - first) * swar_low_bytes) & ~(w + (0x7f - last) * swar_low_bytes) & swar_high_bits; }
+
+    }
+
     // String size functions
 
     // Remember that any other set of flags that might be combined with these
@@ -128,6 +158,46 @@ namespace Unicorn {
             uint32_t fset;
         };
 
+        inline size_t east_asian_char_width(char32_t c, uint32_t flags) noexcept {
+            if (c < 0x80)
+                return 1;
+            if (! char_is_advancing(c))
+                return 0;
+            switch (east_asian_width(c)) {
+                case East_Asian_Width::F:
+                case East_Asian_Width::W:  return 2;
+                case East_Asian_Width::A:  return flags & wide_context ? 2 : 1;
+                default:                   return 1;
+            }
+        }
+
+        // Fused counting for grapheme and East Asian width lengths, without
+        // constructing segment ranges. The UTF-8 version is defined in
+        // string-property.cpp.
+
+        size_t count_length(const Irange<Utf8Iterator>& range, uint32_t flags) noexcept;
+
+        template <typename C>
+        size_t count_length(const Irange<UtfIterator<C>>& range, uint32_t flags) noexcept {
+            using GCB = Grapheme_Cluster_Break;
+            auto prev = GCB::SOT;
+            size_t total = 0;
+            for (char32_t c: range) {
+                if (flags & grapheme_units) {
+                    auto gcb = grapheme_cluster_break(c);
+                    bool start = is_restart_point(prev, gcb);
+                    prev = gcb;
+                    if (! start)
+                        continue;
+                }
+                if (flags & east_asian_flags)
+                    total += east_asian_char_width(c, flags);
+                else if (char_is_advancing(c))
+                    ++total;
+            }
+            return total;
+        }
+
         template <typename C>
         pair<UtfIterator<C>, bool> find_position(const Irange<UtfIterator<C>>& range, size_t pos, uint32_t flags = 0) {
             check_length_flags(flags);
@@ -179,22 +249,10 @@ namespace Unicorn {
     size_t str_length(const Irange<UtfIterator<C>>& range, uint32_t flags = 0) {
         using namespace UnicornDetail;
         check_length_flags(flags);
-        if (flags & character_units) {
+        if (flags & character_units)
             return range_count(range);
-        } else if (flags & east_asian_flags) {
-            EastAsianCount eac(flags);
-            if (flags & grapheme_units) {
-                for (auto g: grapheme_range(range))
-                    eac.add(*g.begin());
-            } else {
-                for (auto c: range)
-                    eac.add(c);
-            }
-            return eac.get();
-        } else {
-            auto gr = grapheme_range(range);
-            return std::count_if(gr.begin(), gr.end(), grapheme_is_advancing<C>);
-        }
+        else
+            return count_length(range, flags);
     }
 
     template <typename C>
@@ -260,7 +318,49 @@ namespace Unicorn {
     int str_compare_3way(const u8string& lhs, const u8string& rhs);
     bool str_icase_compare(const u8string& lhs, const u8string& rhs) noexcept;
     bool str_icase_equal(const u8string& lhs, const u8string& rhs) noexcept;
+    size_t str_icase_hash(const u8string& str) noexcept;
     bool str_natural_compare(const u8string& lhs, const u8string& rhs) noexcept;
+    u8string str_natural_sort_key(const u8string& str);
+
+    class CaseFoldKey {
+    public:
+        CaseFoldKey(): CaseFoldKey(u8string()) {}
+        CaseFoldKey(const u8string& str);
+        CaseFoldKey(const char* str): CaseFoldKey(cstr(str)) {}
+        const u8string& str() const noexcept { return text; }
+        const u8string& key() const noexcept { return fold; }
+        size_t hash() const noexcept { return code; }
+        friend bool operator==(const CaseFoldKey& lhs, const CaseFoldKey& rhs) noexcept { return lhs.fold == rhs.fold; }
+        friend bool operator!=(const CaseFoldKey& lhs, const CaseFoldKey& rhs) noexcept { return lhs.fold != rhs.fold; }
+        friend bool operator<(const CaseFoldKey& lhs, const CaseFoldKey& rhs) noexcept { return lhs.fold < rhs.fold; }
+        friend bool operator>(const CaseFoldKey& lhs, const CaseFoldKey& rhs) noexcept { return lhs.fold > rhs.fold; }
+        friend bool operator<=(const CaseFoldKey& lhs, const CaseFoldKey& rhs) noexcept { return lhs.fold <= rhs.fold; }
+        friend bool operator>=(const CaseFoldKey& lhs, const CaseFoldKey& rhs) noexcept { return lhs.fold >= rhs.fold; }
+    private:
+        u8string text;
+        u8string fold;
+        size_t code;
+    };
+
+    struct CaseFoldHash {
+        size_t operator()(const u8string& str) const noexcept { return str_icase_hash(str); }
+        size_t operator()(const CaseFoldKey& key) const noexcept { return key.hash(); }
+    };
+
+    struct CaseFoldEqual {
+        bool operator()(const u8string& lhs, const u8string& rhs) const noexcept { return str_icase_equal(lhs, rhs); }
+        bool operator()(const CaseFoldKey& lhs, const CaseFoldKey& rhs) const noexcept { return lhs == rhs; }
+        bool operator()(const CaseFoldKey& lhs, const u8string& rhs) const noexcept { return str_icase_equal(lhs.key(), rhs); }
+        bool operator()(const u8string& lhs, const CaseFoldKey& rhs) const noexcept { return str_icase_equal(lhs, rhs.key()); }
+    };
+
+    struct CaseFoldLess {
+        using is_transparent = void;
+        bool operator()(const u8string& lhs, const u8string& rhs) const noexcept { return str_icase_compare(lhs, rhs); }
+        bool operator()(const CaseFoldKey& lhs, const CaseFoldKey& rhs) const noexcept { return lhs < rhs; }
+        bool operator()(const CaseFoldKey& lhs, const u8string& rhs) const noexcept { return str_icase_compare(lhs.key(), rhs); }
+        bool operator()(const u8string& lhs, const CaseFoldKey& rhs) const noexcept { return str_icase_compare(lhs, rhs.key()); }
+    };
 
     // Other string algorithms
     // Defined in string-algorithm.cpp
@@ -294,12 +394,124 @@ namespace Unicorn {
     size_t str_skipws(Utf8Iterator& i, const Utf8Iterator& end);
     size_t str_skipws(Utf8Iterator& i);
 
+    class MultiSearch {
+    public:
+        struct match {
+            size_t offset = npos;
+            size_t length = 0;
+            size_t index = npos;
+            explicit operator bool() const noexcept { return offset != npos; }
+        };
+        MultiSearch() = default;
+        MultiSearch(std::initializer_list<std::pair<u8string, u8string>> list);
+        template <typename FwdRange> explicit MultiSearch(const FwdRange& patterns);
+        void add(const u8string& target, const u8string& sub = {});
+        void compile();
+        bool empty() const noexcept { return targets.empty(); }
+        size_t size() const noexcept { return targets.size(); }
+        const u8string& target(size_t i) const { return targets[i]; }
+        const u8string& sub(size_t i) const { return subs[i]; }
+        size_t count(const u8string& str) const;
+        match find(const u8string& str, size_t pos = 0) const;
+        vector<match> find_all(const u8string& str) const;
+        u8string replace(const u8string& str) const;
+        void replace_in(u8string& str) const;
+    private:
+        vector<u8string> targets;
+        vector<u8string> subs;
+        std::array<uint16_t, 256> classes = {{}};
+        std::array<bool, 256> leads = {{}};
+        int lead = -1;
+        size_t nclasses = 0;
+        vector<uint32_t> delta;
+        vector<uint32_t> depth;
+        vector<uint32_t> out;
+        bool compiled = true;
+        void add_pattern(const u8string& target) { targets.push_back(target); subs.push_back({}); }
+        void add_pattern(const std::pair<u8string, u8string>& pair) { targets.push_back(pair.first); subs.push_back(pair.second); }
+        void build();
+        size_t skip(const char* ptr, size_t pos, size_t size) const noexcept;
+    };
+
+    template <typename FwdRange>
+    MultiSearch::MultiSearch(const FwdRange& patterns) {
+        for (auto& p: patterns)
+            add_pattern(p);
+        build();
+    }
+
+    class StringSearch {
+    public:
+        StringSearch() = default;
+        explicit StringSearch(const u8string& target);
+        const u8string& target() const noexcept { return pattern; }
+        size_t find(const u8string& str, size_t pos = 0) const noexcept;
+        Utf8Iterator search(const Utf8Iterator& b, const Utf8Iterator& e) const;
+        Utf8Iterator search(const Irange<Utf8Iterator>& range) const { return search(range.begin(), range.end()); }
+        Utf8Iterator search(const u8string& str) const { return search(utf_begin(str), utf_end(str)); }
+    private:
+        u8string pattern;
+        size_t suffix = 0;
+        size_t period = 1;
+        bool periodic = false;
+    };
+
+    class LineIndex {
+    public:
+        LineIndex();
+        explicit LineIndex(const u8string& str);
+        LineIndex(u8string&&) = delete;
+        size_t lines() const noexcept { return starts.size(); }
+        size_t line_offset(size_t line) const noexcept;
+        void line_column(size_t offset, size_t& line, size_t& column, uint32_t flags = 0) const;
+        size_t offset(size_t line, size_t column, uint32_t flags = 0) const;
+    private:
+        const u8string* src;
+        vector<size_t> starts;
+    };
+
+    constexpr uint32_t fuzzy_casefold = 1ul << 30;  // Compare strings after full case folding
+
+    size_t str_edit_distance(const u8string& s1, const u8string& s2, uint32_t flags = 0);
+
+    class FuzzySearch {
+    public:
+        struct match {
+            size_t offset = npos;
+            size_t length = 0;
+            size_t distance = npos;
+            explicit operator bool() const noexcept { return offset != npos; }
+        };
+        FuzzySearch() = default;
+        explicit FuzzySearch(const u8string& pattern, uint32_t flags = 0);
+        const u8string& pattern() const noexcept { return target; }
+        size_t size() const noexcept { return length; }
+        size_t distance(const u8string& str, size_t limit = npos) const;
+        match find(const u8string& str, size_t limit, size_t pos = 0) const;
+    private:
+        struct unit {
+            uint32_t symbol;
+            size_t offset;
+            size_t end;
+        };
+        u8string target;
+        uint32_t fuzzy_flags = 0;
+        size_t length = 0;
+        size_t blocks = 0;
+        std::array<uint32_t, 128> ascii;
+        vector<std::pair<u32string, uint32_t>> others;
+        vector<uint64_t> forward;
+        vector<uint64_t> backward;
+        uint32_t symbol(const char32_t* key, size_t n) const noexcept;
+    };
+
     // String manipulation functions
     // Defined in string-manip.cpp
 
     constexpr uint32_t wrap_crlf      = 1ul << 26;  // Use CR+LF for line breaks (default LF)
     constexpr uint32_t wrap_enforce   = 1ul << 27;  // Enforce right margin strictly
     constexpr uint32_t wrap_preserve  = 1ul << 28;  // Preserve layout on already indented lines
+    constexpr uint32_t wrap_breaks    = 1ul << 29;  // Break at UAX14 line break opportunities
 
     namespace UnicornDetail {
 
@@ -307,6 +519,32 @@ namespace Unicorn {
 
         u8string expand_tabs(const u8string& str, const vector<size_t>& tabs, uint32_t flags);
 
+        template <typename T>
+        auto join_size(const T& t, int) -> decltype(size_t(t.size())) { return t.size(); }
+        inline size_t join_size(const char* t, int) { return t ? std::strlen(t) : 0; }
+        template <typename T>
+        size_t join_size(const T&, long) { return 0; }
+
+        // Forward ranges are measured first so the result can be allocated
+        // once; input ranges can only be traversed once.
+
+        template <typename FwdRange>
+        size_t joined_size(const FwdRange& r, size_t delim, bool term, std::forward_iterator_tag) {
+            size_t count = 0, size = 0;
+            for (auto& s: r) {
+                size += join_size(s, 0);
+                ++count;
+            }
+            if (count > 0 && ! term)
+                --count;
+            return size + count * delim;
+        }
+
+        template <typename Range>
+        size_t joined_size(const Range&, size_t, bool, std::input_iterator_tag) {
+            return 0;
+        }
+
         template <typename DS>
         void concat_helper(u8string&, const DS&) {}
 
@@ -338,6 +576,36 @@ namespace Unicorn {
             return u_str(i, j);
         }
 
+        // Removal never makes a UTF-8 string longer, so the characters to
+        // keep are compacted in place, one run at a time, behind the read
+        // position. ASCII characters are tested without decoding.
+
+        template <typename Pred>
+        void remove_in_helper(u8string& src, Pred p) {
+            size_t n = src.size(), r = 0, w = 0, run = 0;
+            auto flush = [&] {
+                if (w != run)
+                    std::memmove(&src[w], &src[run], r - run);
+                w += r - run;
+            };
+            while (r < n) {
+                size_t len = 1;
+                char32_t c = uint8_t(src[r]);
+                if (c >= 0x80) {
+                    auto i = utf_iterator(src, r);
+                    c = *i;
+                    len = i.count();
+                }
+                if (p(c)) {
+                    flush();
+                    run = r + len;
+                }
+                r += len;
+            }
+            flush();
+            src.resize(w);
+        }
+
         template <typename Pred>
         void trim_in_helper(u8string& src, int mode, Pred p) {
             auto range = utf_range(src);
@@ -395,8 +663,10 @@ namespace Unicorn {
             const u8string& src);
     Irange<Utf8Iterator> str_insert_in(u8string& dst, const Irange<Utf8Iterator>& range, const u8string& src);
     u8string str_pad_left(const u8string& str, size_t length, char32_t c = U' ', uint32_t flags = 0);
+    void str_pad_left(const u8string& str, u8string& dst, size_t length, char32_t c = U' ', uint32_t flags = 0);
     void str_pad_left_in(u8string& str, size_t length, char32_t c = U' ', uint32_t flags = 0);
     u8string str_pad_right(const u8string& str, size_t length, char32_t c = U' ', uint32_t flags = 0);
+    void str_pad_right(const u8string& str, u8string& dst, size_t length, char32_t c = U' ', uint32_t flags = 0);
     void str_pad_right_in(u8string& str, size_t length, char32_t c = U' ', uint32_t flags = 0);
     bool str_partition(const u8string& str, u8string& prefix, u8string& suffix);
     bool str_partition_at(const u8string& str, u8string& prefix, u8string& suffix, const u8string& delim);
@@ -406,6 +676,7 @@ namespace Unicorn {
     void str_remove_in(u8string& str, char32_t c);
     void str_remove_in(u8string& str, const u8string& chars);
     u8string str_replace(const u8string& str, const u8string& target, const u8string& sub, size_t n = npos);
+    void str_replace(const u8string& str, u8string& dst, const u8string& target, const u8string& sub, size_t n = npos);
     void str_replace_in(u8string& str, const u8string& target, const u8string& sub, size_t n = npos);
     u8string str_squeeze(const u8string& str);
     u8string str_squeeze(const u8string& str, const u8string& chars);
@@ -416,6 +687,7 @@ namespace Unicorn {
     void str_squeeze_trim_in(u8string& str);
     void str_squeeze_trim_in(u8string& str, const u8string& chars);
     u8string str_substring(const u8string& str, size_t offset, size_t count = npos);
+    void str_substring(const u8string& str, u8string& dst, size_t offset, size_t count = npos);
     u8string utf_substring(const u8string& str, size_t index, size_t length = npos, uint32_t flags = 0);
     u8string str_translate(const u8string& str, const u8string& target, const u8string& sub);
     void str_translate_in(u8string& str, const u8string& target, const u8string& sub);
@@ -431,6 +703,10 @@ namespace Unicorn {
     void str_trim_left_in(u8string& str);
     void str_trim_right_in(u8string& str, const u8string& chars);
     void str_trim_right_in(u8string& str);
+    size_t str_truncate_bytes(const u8string& str, size_t bytes);
+    size_t str_truncate_width(const u8string& str, size_t width, uint32_t flags = 0);
+    void str_truncate_bytes_in(u8string& str, size_t bytes);
+    void str_truncate_width_in(u8string& str, size_t width, uint32_t flags = 0);
     u8string str_unify_lines(const u8string& str, const u8string& newline);
     u8string str_unify_lines(const u8string& str, char32_t newline);
     u8string str_unify_lines(const u8string& str);
@@ -438,8 +714,72 @@ namespace Unicorn {
     void str_unify_lines_in(u8string& str, char32_t newline);
     void str_unify_lines_in(u8string& str);
     u8string str_wrap(const u8string& str, uint32_t flags = 0, size_t width = 0, size_t margin1 = 0, size_t margin2 = npos);
+    void str_wrap(const u8string& str, u8string& dst, uint32_t flags = 0, size_t width = 0, size_t margin1 = 0, size_t margin2 = npos);
     void str_wrap_in(u8string& str, uint32_t flags = 0, size_t width = 0, size_t margin1 = 0, size_t margin2 = npos);
 
+    class StrSplitIterator;
+    using StrSplitRange = Irange<StrSplitIterator>;
+
+    StrSplitRange str_split_range(const u8string& src);
+    StrSplitRange str_split_at_range(const u8string& src, const u8string& delim);
+    StrSplitRange str_split_by_range(const u8string& src, const u8string& delim);
+    StrSplitRange str_split_lines_range(const u8string& src);
+
+    class StrSplitIterator:
+    public ForwardIterator<StrSplitIterator, const Irange<Utf8Iterator>> {
+    public:
+        StrSplitIterator() = default;
+        const Irange<Utf8Iterator>& operator*() const noexcept { return field; }
+        StrSplitIterator& operator++();
+        bool operator==(const StrSplitIterator& rhs) const noexcept { return pos == rhs.pos; }
+    private:
+        friend StrSplitRange str_split_range(const u8string& src);
+        friend StrSplitRange str_split_at_range(const u8string& src, const u8string& delim);
+        friend StrSplitRange str_split_by_range(const u8string& src, const u8string& delim);
+        friend StrSplitRange str_split_lines_range(const u8string& src);
+        static constexpr int split_ws = 0, split_at = 1, split_by = 2, split_lines = 3;
+        struct delimiter;
+        const u8string* src = nullptr;      // Source string
+        shared_ptr<const delimiter> delim;  // Shared by all iterators on a range (null if none)
+        Irange<Utf8Iterator> field;         // Current field
+        size_t pos = npos;                  // Offset of current field (npos at end)
+        size_t next = 0;                    // Offset to resume scanning
+        int kind = split_ws;                // Splitting rule
+        bool pending = true;                // A field may start at the end of the string
+        StrSplitIterator(const u8string& s, int k, const u8string& d = {});
+    };
+
+    class StrBuilder {
+    public:
+        StrBuilder() = default;
+        StrBuilder& operator+=(const u8string& str) { append(str.data(), str.size()); return *this; }
+        StrBuilder& operator+=(u8string&& str);
+        StrBuilder& operator+=(const char* str) { if (str) append(str, std::strlen(str)); return *this; }
+        StrBuilder& operator+=(char32_t c);
+        bool empty() const noexcept { return len == 0; }
+        size_t size() const noexcept { return len; }
+        void clear() noexcept { parts.clear(); len = 0; }
+        void append_to(u8string& dst) const;
+        u8string str() const { u8string dst; append_to(dst); return dst; }
+    private:
+        vector<u8string> parts;
+        size_t len = 0;
+        void append(const char* ptr, size_t n);
+    };
+
+    class Translator {
+    public:
+        Translator();
+        Translator(const u8string& target, const u8string& sub);
+        u8string translate(const u8string& str) const;
+        void translate_in(u8string& str) const;
+    private:
+        std::array<char32_t, 128> ascii;                 // Substitutes for ASCII characters
+        vector<std::pair<char32_t, char32_t>> others;    // Sorted substitutes for other characters
+        bool bytewise = true;                            // Only ASCII to ASCII mappings
+        uint8_t first = 0x7f, last = 0;                  // Range of mapped ASCII characters
+    };
+
     template <typename C, typename... Strings>
     u8string str_concat(const basic_string<C>& s, const Strings&... ss) {
         u8string result;
@@ -520,13 +860,18 @@ namespace Unicorn {
     u8string str_join(const FwdRange& r, const u8string& delim, bool term = false) {
         using std::begin;
         using std::end;
+        using category = typename std::iterator_traits<decltype(begin(r))>::iterator_category;
         u8string dst;
+        dst.reserve(UnicornDetail::joined_size(r, delim.size(), term, category()));
+        bool first = true;
         for (auto& s: r) {
+            if (! first)
+                dst += delim;
             dst += s;
-            dst += delim;
+            first = false;
         }
-        if (! term && ! dst.empty() && ! delim.empty())
-            dst.resize(dst.size() - delim.size());
+        if (term && ! first)
+            dst += delim;
         return dst;
     }
 
@@ -537,110 +882,50 @@ namespace Unicorn {
 
     template <typename Pred>
     u8string str_remove_if(const u8string& str, Pred p) {
-        u8string dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [p] (char32_t x) { return ! p(x); });
+        u8string dst = str;
+        UnicornDetail::remove_in_helper(dst, p);
         return dst;
     }
 
     template <typename Pred>
     u8string str_remove_if_not(const u8string& str, Pred p) {
-        u8string dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), p);
+        u8string dst = str;
+        UnicornDetail::remove_in_helper(dst, [p] (char32_t x) { return ! p(x); });
         return dst;
     }
 
     template <typename Pred>
     void str_remove_in_if(u8string& str, Pred p) {
-        u8string dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [p] (char32_t x) { return ! p(x); });
-        str.swap(dst);
+        UnicornDetail::remove_in_helper(str, p);
     }
 
     template <typename Pred>
     void str_remove_in_if_not(u8string& str, Pred p) {
-        u8string dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), p);
-        str.swap(dst);
+        UnicornDetail::remove_in_helper(str, [p] (char32_t x) { return ! p(x); });
     }
 
     template <typename OutIter>
     void str_split(const u8string& src, OutIter dst) {
-        auto range = utf_range(src);
-        auto i = range.begin(), j = i;
-        while (i != range.end()) {
-            j = std::find_if_not(i, range.end(), char_is_white_space);
-            if (j == range.end())
-                break;
-            i = std::find_if(j, range.end(), char_is_white_space);
-            *dst++ = u_str(j, i);
-        }
+        for (auto& field: str_split_range(src))
+            *dst++ = u_str(field);
     }
 
     template <typename OutIter>
     void str_split_at(const u8string& src, OutIter dst, const u8string& delim) {
-        if (delim.empty()) {
-            *dst++ = src;
-            return;
-        }
-        size_t i = 0, dsize = delim.size();
-        for (;;) {
-            auto j = src.find(delim, i);
-            if (j == npos) {
-                *dst++ = src.substr(i);
-                break;
-            }
-            *dst++ = src.substr(i, j - i);
-            i = j + dsize;
-        }
+        for (auto& field: str_split_at_range(src, delim))
+            *dst++ = u_str(field);
     }
 
     template <typename OutIter>
     void str_split_by(const u8string& src, OutIter dst, const u8string& delim) {
-        if (delim.empty()) {
-            *dst++ = src;
-            return;
-        }
-        auto u_delim = to_utf32(delim);
-        if (delim.size() == u_delim.size()) {
-            size_t i = 0, n = src.size();
-            while (i < n) {
-                auto j = src.find_first_not_of(delim, i);
-                if (j == npos)
-                    break;
-                i = src.find_first_of(delim, j);
-                if (i == npos)
-                    i = n;
-                *dst++ = src.substr(j, i - j);
-            }
-        } else {
-            auto match = [&] (char32_t c) { return u_delim.find(c) != npos; };
-            auto range = utf_range(src);
-            auto i = range.begin(), j = i;
-            while (i != range.end()) {
-                j = std::find_if_not(i, range.end(), match);
-                if (j == range.end())
-                    break;
-                i = std::find_if(j, range.end(), match);
-                *dst++ = u_str(j, i);
-            }
-        }
+        for (auto& field: str_split_by_range(src, delim))
+            *dst++ = u_str(field);
     }
 
     template <typename OutIter>
     void str_split_lines(const u8string& src, OutIter dst) {
-        auto i = utf_begin(src), j = i, e = utf_end(src);
-        while (i != e) {
-            j = std::find_if(i, e, char_is_line_break);
-            *dst++ = u_str(i, j);
-            if (j == e)
-                break;
-            char32_t c = *j;
-            if (++j == e)
-                break;
-            if (c == U'\r' && *j == U'\n')
-                ++j;
-            i = j;
-        }
+        for (auto& field: str_split_lines_range(src))
+            *dst++ = u_str(field);
     }
 
     template <typename Pred>
@@ -722,6 +1007,10 @@ namespace Unicorn {
     u8string str_lowercase(const u8string& str);
     u8string str_titlecase(const u8string& str);
     u8string str_casefold(const u8string& str);
+    void str_uppercase(const u8string& str, u8string& dst);
+    void str_lowercase(const u8string& str, u8string& dst);
+    void str_titlecase(const u8string& str, u8string& dst);
+    void str_casefold(const u8string& str, u8string& dst);
     void str_uppercase_in(u8string& str);
     void str_lowercase_in(u8string& str);
     void str_titlecase_in(u8string& str);
@@ -737,23 +1026,196 @@ namespace Unicorn {
 
     u8string str_encode_uri(const u8string& str);
     u8string str_encode_uri_component(const u8string& str);
+    void str_encode_uri(const u8string& str, u8string& dst);
+    void str_encode_uri_component(const u8string& str, u8string& dst);
     void str_encode_uri_in(u8string& str);
     void str_encode_uri_component_in(u8string& str);
     u8string str_unencode_uri(const u8string& str);
+    void str_unencode_uri(const u8string& str, u8string& dst);
     void str_unencode_uri_in(u8string& str);
     u8string str_escape(const u8string& str, uint32_t flags = 0);
+    void str_escape(const u8string& str, u8string& dst, uint32_t flags = 0);
     void str_escape_in(u8string& str, uint32_t flags = 0);
     u8string str_unescape(const u8string& str);
+    void str_unescape(const u8string& str, u8string& dst);
     void str_unescape_in(u8string& str);
     u8string str_quote(const u8string& str, uint32_t flags = 0, char32_t quote = U'\"');
+    void str_quote(const u8string& str, u8string& dst, uint32_t flags = 0, char32_t quote = U'\"');
     void str_quote_in(u8string& str, uint32_t flags = 0, char32_t quote = U'\"');
     u8string str_unquote(const u8string& str, char32_t quote = U'\"');
+    void str_unquote(const u8string& str, u8string& dst, char32_t quote = U'\"');
     void str_unquote_in(u8string& str, char32_t quote = U'\"');
 
     // Type conversion functions
 
     namespace UnicornDetail {
 
+        // The parsers below accept the same syntax as strtoull() and
+        // strtod() (restricted to the characters the callers allow), and
+        // work directly on the source string, without copying it or
+        // depending on the current locale. Each returns the number of bytes
+        // consumed, or zero if no number was found. Only a decimal number
+        // that cannot be converted exactly falls back on the C library,
+        // which needs a copy using the current locale's decimal point.
+
+        inline int digit_value(char c, int base) noexcept {
+            int d = c >= '0' && c <= '9' ? c - '0' : c >= 'A' && c <= 'Z' ? c - 'A' + 10 : c >= 'a' && c <= 'z' ? c - 'a' + 10 : base;
+            return d < base ? d : -1;
+        }
+
+        inline size_t parse_integer(const char* ptr, const char* end, int base,
+                unsigned long long& value, bool& negative, bool& overflow) noexcept {
+            static constexpr auto max_value = std::numeric_limits<unsigned long long>::max();
+            auto p = ptr;
+            value = 0;
+            negative = overflow = false;
+            if (p != end && (*p == '+' || *p == '-'))
+                negative = *p++ == '-';
+            auto digits = p;
+            for (int d; p != end && (d = digit_value(*p, base)) >= 0; ++p) {
+                if (value > (max_value - d) / base)
+                    overflow = true;
+                else
+                    value = value * base + d;
+            }
+            if (p == digits) {
+                negative = overflow = false;
+                return 0;
+            }
+            return p - ptr;
+        }
+
+        // A decimal number is parsed into up to 19 significant digits and a
+        // power of 10. If the mantissa and the power of 10 are both exactly
+        // representable, a single multiplication or division gives the
+        // correctly rounded result (Clinger's fast path); otherwise the
+        // digits are handed to strtod(), with the decimal point adjusted to
+        // suit the current locale.
+
+        inline size_t parse_decimal(const char* ptr, const char* end, uint64_t& mantissa, int& exponent, bool& negative, bool& exact) noexcept {
+            auto p = ptr;
+            int digits = 0, exp10 = 0;
+            mantissa = 0;
+            negative = false;
+            exact = true;
+            auto add_digit = [&] (int d, int int_part) {
+                if (digits < 19) {
+                    mantissa = 10 * mantissa + d;
+                    if (mantissa)
+                        ++digits;
+                    exp10 -= 1 - int_part;
+                } else {
+                    if (d)
+                        exact = false;
+                    exp10 += int_part;
+                }
+            };
+            if (p != end && (*p == '+' || *p == '-'))
+                negative = *p++ == '-';
+            auto int_begin = p;
+            for (; p != end && *p >= '0' && *p <= '9'; ++p)
+                add_digit(*p - '0', 1);
+            bool any_digits = p != int_begin;
+            if (p != end && *p == '.') {
+                auto q = p + 1;
+                for (; q != end && *q >= '0' && *q <= '9'; ++q)
+                    add_digit(*q - '0', 0);
+                if (q != p + 1)
+                    any_digits = true;
+                if (any_digits)
+                    p = q;
+            }
+            if (! any_digits) {
+                negative = false;
+                return 0;
+            }
+            if (p != end && (*p == 'E' || *p == 'e')) {
+                auto q = p + 1;
+                bool neg_exp = false;
+                if (q != end && (*q == '+' || *q == '-'))
+                    neg_exp = *q++ == '-';
+                auto exp_begin = q;
+                int e = 0;
+                for (; q != end && *q >= '0' && *q <= '9'; ++q)
+                    if (e < 100000)
+                        e = 10 * e + *q - '0';
+                if (q != exp_begin) {
+                    exp10 += neg_exp ? - e : e;
+                    p = q;
+                }
+            }
+            exponent = exp10;
+            return p - ptr;
+        }
+
+        inline double exact_power_of_10(int n) noexcept {
+            static constexpr double powers[] = {
+                1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+            };
+            return powers[n];
+        }
+
+        template <typename T>
+        struct FloatConversionTraits {
+            static constexpr long double huge_val = HUGE_VALL;
+            static constexpr uint64_t max_exact_mantissa = 1ull << 53;
+            static constexpr int max_exact_exponent = 22;
+            static long double str_to_t(const char* p, char** ep) noexcept { return strtold(p, ep); }
+        };
+
+        template <>
+        struct FloatConversionTraits<float> {
+            static constexpr float huge_val = HUGE_VALF;
+            static constexpr uint64_t max_exact_mantissa = 1ull << 24;
+            static constexpr int max_exact_exponent = 10;
+            static float str_to_t(const char* p, char** ep) noexcept { return strtof(p, ep); }
+        };
+
+        template <>
+        struct FloatConversionTraits<double> {
+            static constexpr double huge_val = HUGE_VAL;
+            static constexpr uint64_t max_exact_mantissa = 1ull << 53;
+            static constexpr int max_exact_exponent = 22;
+            static double str_to_t(const char* p, char** ep) noexcept { return strtod(p, ep); }
+        };
+
+        template <typename T>
+        T convert_decimal(const char* ptr, size_t len, uint64_t mantissa, int exponent, bool negative, bool exact) {
+            using traits = FloatConversionTraits<T>;
+            if (mantissa == 0)
+                return negative ? - T(0) : T(0);
+            if (exact && mantissa <= traits::max_exact_mantissa && std::abs(exponent) <= traits::max_exact_exponent) {
+                T value = T(mantissa);
+                if (exponent > 0)
+                    value *= T(exact_power_of_10(exponent));
+                else if (exponent < 0)
+                    value /= T(exact_power_of_10(- exponent));
+                return negative ? - value : value;
+            }
+            // The locale's decimal point may be more than one byte
+            const char* point = std::localeconv()->decimal_point;
+            size_t plen = std::strlen(point);
+            char buf[64];
+            u8string spill;
+            char* text = buf;
+            if (len + plen >= sizeof(buf)) {
+                spill.assign(len + plen + 1, '\0');
+                text = &spill[0];
+            }
+            char* out = text;
+            for (size_t i = 0; i < len; ++i) {
+                if (ptr[i] == '.') {
+                    std::memcpy(out, point, plen);
+                    out += plen;
+                } else {
+                    *out++ = ptr[i];
+                }
+            }
+            *out = '\0';
+            return traits::str_to_t(text, nullptr);
+        }
+
         template <typename T>
         Utf8Iterator convert_str_to_int(T& t, const Utf8Iterator& start, uint32_t flags, int base) {
             static const u8string dec_chars = "+-0123456789";
@@ -766,82 +1228,51 @@ namespace Unicorn {
                 t = T(0);
                 return utf_end(src);
             }
-            size_t endpos = src.find_first_not_of(base == 16 ? hex_chars : dec_chars, offset);
-            if (endpos == offset) {
+            auto fragment = [&] { return src.substr(offset, src.find_first_not_of(base == 16 ? hex_chars : dec_chars, offset) - offset); };
+            char c = src[offset];
+            if (c != '+' && c != '-' && digit_value(c, base) < 0) {
                 if (flags & err_throw)
                     throw std::invalid_argument("Invalid integer: " + uquote(to_utf8(start.str())));
                 t = T(0);
                 return start;
             }
-            if (endpos == npos)
-                endpos = src.size();
-            u8string fragment(src, offset, endpos - offset);
-            Utf8Iterator stop;
-            if (std::is_signed<T>::value) {
-                static constexpr auto min_value = static_cast<long long>(std::numeric_limits<T>::min());
-                static constexpr auto max_value = static_cast<long long>(std::numeric_limits<T>::max());
-                char* endptr = nullptr;
-                errno = 0;
-                long long value = strtoll(fragment.data(), &endptr, base);
-                int err = errno;
-                size_t len = endptr - fragment.data();
-                stop = utf_iterator(src, offset + len);
-                if ((flags & err_throw) && stop != utf_end(src))
-                    throw std::invalid_argument("Invalid integer: " + uquote(fragment));
-                if (len == 0) {
-                    if (flags & err_throw)
-                        throw std::invalid_argument("Invalid integer: " + uquote(u_str(start, utf_end(src))));
-                    t = T(0);
-                } else if (err == ERANGE || value < min_value || value > max_value) {
+            unsigned long long value = 0;
+            bool negative = false, overflow = false;
+            size_t len = parse_integer(src.data() + offset, src.data() + src.size(), base, value, negative, overflow);
+            auto stop = utf_iterator(src, offset + len);
+            if ((flags & err_throw) && stop != utf_end(src))
+                throw std::invalid_argument("Invalid integer: " + uquote(u_str(start, utf_end(src))));
+            if (len == 0) {
+                if (flags & err_throw)
+                    throw std::invalid_argument("Invalid integer: " + uquote(fragment()));
+                t = T(0);
+            } else if (std::is_signed<T>::value) {
+                static constexpr auto max_value = static_cast<unsigned long long>(std::numeric_limits<T>::max());
+                if (overflow || value > max_value + negative) {
                     if (flags & err_throw)
-                        throw std::range_error("Integer out of range: " + uquote(fragment));
-                    t = sign_of(value) == 1 ? max_value : min_value;
+                        throw std::range_error("Integer out of range: " + uquote(fragment()));
+                    t = negative ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+                } else if (negative) {
+                    t = static_cast<T>(- static_cast<long long>(value - 1) - 1);
                 } else {
-                    t = value;
+                    t = static_cast<T>(value);
                 }
             } else {
+                // Like strtoull(), a negative value wraps around
                 static constexpr auto max_value = static_cast<unsigned long long>(std::numeric_limits<T>::max());
-                char* endptr = nullptr;
-                errno = 0;
-                unsigned long long value = strtoull(fragment.data(), &endptr, base);
-                int err = errno;
-                size_t len = endptr - fragment.data();
-                stop = utf_iterator(src, offset + len);
-                if ((flags & err_throw) && stop != utf_end(src))
-                        throw std::invalid_argument("Invalid integer: " + uquote(u_str(start, utf_end(src))));
-                if (len == 0) {
-                    if (flags & err_throw)
-                        throw std::invalid_argument("Invalid integer: " + uquote(fragment));
-                    t = T(0);
-                } else if (err == ERANGE || value > max_value) {
+                if (negative && ! overflow)
+                    value = 0ull - value;
+                if (overflow || value > max_value) {
                     if (flags & err_throw)
-                        throw std::range_error("Integer out of range: " + uquote(fragment));
-                    t = max_value;
+                        throw std::range_error("Integer out of range: " + uquote(fragment()));
+                    t = std::numeric_limits<T>::max();
                 } else {
-                    t = value;
+                    t = static_cast<T>(value);
                 }
             }
             return stop;
         }
 
-        template <typename T>
-        struct FloatConversionTraits {
-            static constexpr long double huge_val = HUGE_VALL;
-            static long double str_to_t(const char* p, char** ep) noexcept { return strtold(p, ep); }
-        };
-
-        template <>
-        struct FloatConversionTraits<float> {
-            static constexpr float huge_val = HUGE_VALF;
-            static float str_to_t(const char* p, char** ep) noexcept { return strtof(p, ep); }
-        };
-
-        template <>
-        struct FloatConversionTraits<double> {
-            static constexpr double huge_val = HUGE_VAL;
-            static double str_to_t(const char* p, char** ep) noexcept { return strtod(p, ep); }
-        };
-
     }
 
     template <typename T>
@@ -904,29 +1335,32 @@ namespace Unicorn {
             t = T(0);
             return utf_end(src);
         }
-        size_t endpos = src.find_first_not_of("+-.0123456789Ee", offset);
-        if (endpos == offset) {
+        static const u8string float_chars = "+-.0123456789Ee";
+        auto fragment = [&] { return src.substr(offset, src.find_first_not_of(float_chars, offset) - offset); };
+        if (float_chars.find(src[offset]) == npos) {
             if (flags & err_throw)
                 throw std::invalid_argument("Invalid number: " + uquote(start.str()));
             t = T(0);
             return start;
         }
-        if (endpos == npos)
-            endpos = src.size();
-        u8string fragment(src, offset, endpos - offset);
-        char* endptr = nullptr;
-        T value = traits::str_to_t(fragment.data(), &endptr);
-        size_t len = endptr - fragment.data();
+        uint64_t mantissa = 0;
+        int exponent = 0;
+        bool negative = false, exact = true;
+        auto ptr = src.data() + offset;
+        size_t len = UnicornDetail::parse_decimal(ptr, src.data() + src.size(), mantissa, exponent, negative, exact);
         auto stop = utf_iterator(src, offset + len);
         if ((flags & err_throw) && stop != utf_end(src))
             throw std::invalid_argument("Invalid number: " + uquote(u_str(start, utf_end(src))));
         if (len == 0) {
             if (flags & err_throw)
-                throw std::invalid_argument("Invalid number: " + uquote(fragment));
+                throw std::invalid_argument("Invalid number: " + uquote(fragment()));
             t = T(0);
-        } else if (value == traits::huge_val || value == - traits::huge_val) {
+            return stop;
+        }
+        T value = UnicornDetail::convert_decimal<T>(ptr, len, mantissa, exponent, negative, exact);
+        if (value == traits::huge_val || value == - traits::huge_val) {
             if (flags & err_throw)
-                throw std::range_error("Number out of range: " + uquote(fragment));
+                throw std::range_error("Number out of range: " + uquote(fragment()));
             t = value > T(0) ? max_value : - max_value;
         } else {
             t = value;
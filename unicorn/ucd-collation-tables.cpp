@@ -0,0 +1,62631 @@
+#include "unicorn/ucd-tables.hpp"
+
+namespace Unicorn {
+namespace UnicornDetail {
+
+char32_t const collation_elements_array[] {
+0x0,
+0x2010805,
+0x2020805,
+0x2030805,
+0x2040805,
+0x2050805,
+0x2090805,
+0x2670805,
+0x31d0805,
+0x3ac0805,
+0x3ad0805,
+0x3a90805,
+0x3160805,
+0x3280805,
+0x3290805,
+0x3a10805,
+0x6660805,
+0x2230805,
+0x20d0805,
+0x27e0805,
+0x3a60805,
+0x2400805,
+0x23a0805,
+0x66a0805,
+0x66b0805,
+0x66c0805,
+0x26d0805,
+0x3a00805,
+0x32a0805,
+0x3a70805,
+0x32b0805,
+0x4b70805,
+0x20b0805,
+0x4b40805,
+0x32c0805,
+0x66e0805,
+0x32d0805,
+0x6700805,
+0x2060805,
+0x2090837,
+0x2680805,
+0x66f0805,
+0x39a0805,
+0x4bb0805,
+0x5d20805,
+0x3260805,
+0x66d0805,
+0x5d40805,
+0x4b80805,
+0x52a0805,
+0x6670805,
+0x4b50805,
+0x39c0805,
+0x2930805,
+0x4be0805,
+0x3270805,
+0x26e0805,
+0x6690805,
+0x6680805,
+0x4c50805,
+0x4c70805,
+0x4c80805,
+0x4c90805,
+0x4ca0805,
+0x4cb0805,
+0x4cc0805,
+0x4cd0805,
+0x4ce0805,
+0x4cf0805,
+0x4d00805,
+0x4d10805,
+0x4d20805,
+0x4d30805,
+0x4d40805,
+0x4d50805,
+0x4d60805,
+0x4d70805,
+0x4d80805,
+0x4d90805,
+0x4dc0805,
+0x4dd0805,
+0x4b90805,
+0x4ba0805,
+0x4bc0805,
+0x4bf0805,
+0x4b60805,
+0x4bd0805,
+0x4de0805,
+0x4df0805,
+0x4e00805,
+0x4e10805,
+0x4e20805,
+0x4e30805,
+0x4e40805,
+0x4e50805,
+0x4e60805,
+0x4e70805,
+0x4e80805,
+0x4e90805,
+0x4ea0805,
+0x4eb0805,
+0x4ec0805,
+0x4ed0805,
+0x4ee0805,
+0x4ef0805,
+0x4f00805,
+0x4f10805,
+0x4f20805,
+0x4f30805,
+0x4f40805,
+0x4f50805,
+0x4f60805,
+0x4f70805,
+0x4f80805,
+0x4f90805,
+0x4c60805,
+0x4bb0805,
+0x904,
+0x6610805,
+0x52b0805,
+0x3e40805,
+0x3e50805,
+0x2690805,
+0x22a0805,
+0x2700805,
+0x3e60805,
+0x2410805,
+0x20e0805,
+0x52c0805,
+0x52d0805,
+0x3e70805,
+0x3e80805,
+0x3e90805,
+0x3ea0805,
+0x3eb0805,
+0x3ec0805,
+0x67d0805,
+0x67f0805,
+0x52e0805,
+0x3b00805,
+0x3b20805,
+0x22b0805,
+0x22c0805,
+0x5310805,
+0x5320805,
+0x23b0805,
+0x2420805,
+0x2710805,
+0x3ae0805,
+0x22d0805,
+0x22e0805,
+0x3a40805,
+0x2800805,
+0x5330805,
+0x5340805,
+0x2cd0805,
+0x2810805,
+0x2820805,
+0x2430805,
+0x2440805,
+0x2450805,
+0x2460805,
+0x2470805,
+0x2480805,
+0x2720805,
+0x3ed0805,
+0x3ee0805,
+0x3ef0805,
+0x3f00805,
+0x5460805,
+0x2ce0805,
+0x22f0805,
+0x26a0805,
+0x2490805,
+0x24a0805,
+0x24b0805,
+0x24c0805,
+0x24d0805,
+0x24e0805,
+0x24f0805,
+0x2500805,
+0x2510805,
+0x2520805,
+0x2530805,
+0x2540805,
+0x2550805,
+0x2560805,
+0x2570805,
+0x3f10805,
+0x2960805,
+0x2970805,
+0x4000805,
+0x1d560805,
+0x1d570805,
+0x1d580805,
+0x1d590805,
+0x1d5a0805,
+0x1d5b0805,
+0x5470805,
+0x4070805,
+0x5480805,
+0x1d5c0805,
+0x1d5d0805,
+0x1d5e0805,
+0x1d5f0805,
+0x1d600805,
+0x1d610805,
+0x1d680805,
+0x1d690805,
+0x1d6a0805,
+0x5490805,
+0x54a0805,
+0x54b0805,
+0x54c0805,
+0x54d0805,
+0x54e0805,
+0x54f0805,
+0x5690805,
+0x1d870805,
+0x1d880805,
+0x1d890805,
+0x1d8a0805,
+0x1d8b0805,
+0x1d8c0805,
+0x56b0805,
+0x40a0805,
+0x40b0805,
+0x40c0805,
+0x40d0805,
+0x5730805,
+0x5740805,
+0x5750805,
+0x4100805,
+0x4110805,
+0x4120805,
+0x4130805,
+0x4140805,
+0x4150805,
+0x4160805,
+0x4190805,
+0x4190837,
+0x41a0805,
+0x41b0805,
+0x41c0805,
+0x41d0805,
+0x41e0805,
+0x41f0805,
+0x5760805,
+0x25f0805,
+0x5770805,
+0x5780805,
+0x5790805,
+0x57a0805,
+0x57b0805,
+0x57c0805,
+0x57d0805,
+0x57e0805,
+0x57f0805,
+0x5800805,
+0x5810805,
+0x5820805,
+0x32e0805,
+0x32f0805,
+0x3300805,
+0x3310805,
+0x4200805,
+0x5830805,
+0x5840805,
+0x5850805,
+0x5860805,
+0x5870805,
+0x5880805,
+0x5890805,
+0x58a0805,
+0x58b0805,
+0x58c0805,
+0x58d0805,
+0x58e0805,
+0x58f0805,
+0x5900805,
+0x5910805,
+0x5920805,
+0x4170805,
+0x4180805,
+0x4210805,
+0x4220805,
+0x4230805,
+0x5930805,
+0x5940805,
+0x5950805,
+0x5960805,
+0x4240805,
+0x4250805,
+0x2a10805,
+0x2a20805,
+0x43b0805,
+0x43c0805,
+0x43d0805,
+0x43e0805,
+0x5990805,
+0x59a0805,
+0x2cf0805,
+0x2d00805,
+0x2580805,
+0x2830805,
+0x2590805,
+0x25a0805,
+0x25b0805,
+0x25c0805,
+0x2730805,
+0x2d10805,
+0x1d900805,
+0x1d910805,
+0x1d920805,
+0x1d930805,
+0x1d940805,
+0x1d950805,
+0x1d960805,
+0x1d970805,
+0x1d980805,
+0x1d990805,
+0x1d9a0805,
+0x4fa0805,
+0x4fb0805,
+0x4fc0805,
+0x4fd0805,
+0x4fe0805,
+0x4ff0805,
+0x5000805,
+0x5010805,
+0x5020805,
+0x5030805,
+0x20f0805,
+0x5970805,
+0x2860805,
+0x2090809,
+0x3320805,
+0x3330805,
+0x2630805,
+0x2640805,
+0x2650805,
+0x29e0805,
+0x29f0805,
+0x2a30805,
+0x2a40805,
+0x2600805,
+0x43f0805,
+0x4400805,
+0x4410805,
+0x3f20805,
+0x27f0805,
+0x2300805,
+0x2840805,
+0x25d0805,
+0x25e0805,
+0x2110805,
+0x2120805,
+0x2310805,
+0x2850805,
+0x5980805,
+0x26b0805,
+0x2740805,
+0x59f0805,
+0x5a00805,
+0x5a10805,
+0x5a20805,
+0x5a30805,
+0x5a40805,
+0x5a50805,
+0x5a60805,
+0x5a70805,
+0x5a80805,
+0x5a90805,
+0x5aa0805,
+0x5ab0805,
+0x5ac0805,
+0x5ad0805,
+0x5ae0805,
+0x5af0805,
+0x5b00805,
+0x5b10805,
+0x5b20805,
+0x5b30805,
+0x5b40805,
+0x5b50805,
+0x5b60805,
+0x5b70805,
+0x5b80805,
+0x5b90805,
+0x5ba0805,
+0x5bb0805,
+0x5bc0805,
+0x5bd0805,
+0x5be0805,
+0x2d20805,
+0x2d30805,
+0x4420805,
+0x4430805,
+0x4440805,
+0x4450805,
+0x4460805,
+0x4470805,
+0x4480805,
+0x2a50805,
+0x2a60805,
+0x2a70805,
+0x2a80805,
+0x4490805,
+0x44a0805,
+0x2d40805,
+0x2d50805,
+0x2870805,
+0x2610805,
+0x2a90805,
+0x2aa0805,
+0x2100805,
+0x5bf0805,
+0x5c00805,
+0x5c10805,
+0x5c20805,
+0x5c30805,
+0x5c40805,
+0x5c50805,
+0x5c60805,
+0x5c70805,
+0x5c80805,
+0x5c90805,
+0x5ca0805,
+0x5cb0805,
+0x5cc0805,
+0x5cd0805,
+0x5ce0805,
+0x5cf0805,
+0x5d00805,
+0x5d10805,
+0x4560805,
+0x4570805,
+0x4580805,
+0x4590805,
+0x29a0805,
+0x29b0805,
+0x4380805,
+0x4390805,
+0x43a0805,
+0x2cb0805,
+0x2cc0805,
+0x44b0805,
+0x44c0805,
+0x44d0805,
+0x44e0805,
+0x44f0805,
+0x4500805,
+0x4510805,
+0x4520805,
+0x4c00805,
+0x4c20805,
+0x4bb0805,
+0xa84,
+0x4c00805,
+0x944,
+0x4c00805,
+0x904,
+0x4c00805,
+0xa84,
+0x4c10805,
+0x944,
+0x4c10805,
+0x904,
+0x4c10805,
+0xa84,
+0x4bb0805,
+0x944,
+0x4c10805,
+0x2130805,
+0x2130837,
+0x2140805,
+0x2150805,
+0x2160805,
+0x2170805,
+0x3940805,
+0x20c0805,
+0x3170805,
+0x3180805,
+0x3190805,
+0x31a0805,
+0x31e0805,
+0x31f0805,
+0x3200805,
+0x3210805,
+0x3b30805,
+0x3b40805,
+0x3b90805,
+0x3ba0805,
+0x27e0809,
+0x27e0809,
+0x27e0809,
+0x27e0809,
+0x27e0809,
+0x27e0809,
+0x3bb0805,
+0x2070805,
+0x2080805,
+0x3af0805,
+0x3b10805,
+0x3bf0805,
+0x3bf0809,
+0x3bf0809,
+0x3bf0809,
+0x3bf0809,
+0x3bf0809,
+0x3c00805,
+0x3c00809,
+0x3c00809,
+0x3c00809,
+0x3c00809,
+0x3c00809,
+0x3c30805,
+0x31b0805,
+0x31c0805,
+0x3c40805,
+0x2670809,
+0x2670809,
+0x27c0805,
+0x20a0805,
+0x3c50805,
+0x3c70805,
+0x3c90805,
+0x3ca0805,
+0x3bc0805,
+0x6760805,
+0x3340805,
+0x3350805,
+0x26d0809,
+0x26d0809,
+0x26d0809,
+0x2670809,
+0x2670809,
+0x26d0809,
+0x3aa0805,
+0x39d0805,
+0x3bd0805,
+0x3be0805,
+0x3a20805,
+0x23c0805,
+0x3c80805,
+0x3a30805,
+0x6720805,
+0x21a0805,
+0x3c60805,
+0x2f90805,
+0x2fa0805,
+0x3bf0809,
+0x3bf0809,
+0x3bf0809,
+0x3bf0809,
+0x2fb0805,
+0x2fc0805,
+0x2fd0805,
+0x2fe0805,
+0x2ff0805,
+0x3000805,
+0x3010805,
+0x6660829,
+0x6710829,
+0x66b0829,
+0x3280829,
+0x3290829,
+0x666082b,
+0x671082b,
+0x66b082b,
+0x328082b,
+0x329082b,
+0x5d60805,
+0x5d70805,
+0x5d80805,
+0x5d90805,
+0x5da0805,
+0x5db0805,
+0x5dc0805,
+0x5dd0805,
+0x5de0805,
+0x5df0805,
+0x5e00805,
+0x5e10805,
+0x5e20805,
+0x665080b,
+0x5e30805,
+0x5e40805,
+0x5e50805,
+0x5e60805,
+0x5e70805,
+0x7010805,
+0x5e80805,
+0x5e90805,
+0x1d9b0805,
+0x1d9c0805,
+0x1d9d0805,
+0x1d9e0805,
+0x1d9f0805,
+0x1da00805,
+0x5ea0805,
+0x5eb0805,
+0x5ec0805,
+0x5ee0805,
+0x5ed0805,
+0x5ef0805,
+0x5f00805,
+0x5f10805,
+0x5f20805,
+0x5f30805,
+0x5f40805,
+0x5f50805,
+0x5ec0805,
+0xbc4,
+0x5ed0805,
+0xbc4,
+0x5f60805,
+0x5f70805,
+0x5f80805,
+0x5f90805,
+0x5fa0805,
+0x5fb0805,
+0x5fc0805,
+0x5fd0805,
+0x5fe0805,
+0x5ff0805,
+0x6000805,
+0x6010805,
+0x6020805,
+0x6030805,
+0x6040805,
+0x6050805,
+0x6060805,
+0x6070805,
+0x5f00805,
+0xbc4,
+0x6080805,
+0x6090805,
+0x60a0805,
+0x60b0805,
+0x60c0805,
+0x60d0805,
+0x60e0805,
+0x60f0805,
+0x6100805,
+0x6110805,
+0x6120805,
+0x6130805,
+0x6140805,
+0x6150805,
+0x6160805,
+0x6170805,
+0x6180805,
+0x6190805,
+0x61a0805,
+0x61b0805,
+0x61c0805,
+0x61d0805,
+0x61e0805,
+0x61f0805,
+0x6200805,
+0x6210805,
+0x6220805,
+0x6230805,
+0x6240805,
+0x6250805,
+0x6260805,
+0xbc4,
+0x62a0805,
+0xbc4,
+0x6280805,
+0xbc4,
+0x6260805,
+0x6270805,
+0x6280805,
+0x6290805,
+0x62a0805,
+0x62b0805,
+0x62c0805,
+0x62d0805,
+0x62e0805,
+0x62f0805,
+0x6300805,
+0x6310805,
+0x6320805,
+0x6330805,
+0x6340805,
+0x6350805,
+0x6360805,
+0x6370805,
+0x6380805,
+0x6390805,
+0x63a0805,
+0x63b0805,
+0x63c0805,
+0x63d0805,
+0x63e0805,
+0x63f0805,
+0x6400805,
+0x6410805,
+0x6420805,
+0x6430805,
+0x6440805,
+0x6450805,
+0x6460805,
+0x6470805,
+0x6480805,
+0x6490805,
+0x64a0805,
+0x64b0805,
+0x64c0805,
+0x64d0805,
+0x64e0805,
+0x64f0805,
+0x6500805,
+0x6510805,
+0x6520805,
+0x6530805,
+0x6540805,
+0x6550805,
+0x6560805,
+0x6570805,
+0x6580805,
+0x6590805,
+0x6590805,
+0xbc4,
+0x65a0805,
+0x65b0805,
+0x65c0805,
+0x65d0805,
+0x65d0805,
+0xbc4,
+0x65e0805,
+0x65f0805,
+0x65f0805,
+0xbc4,
+0x6600805,
+0x6620805,
+0x6630805,
+0x6640805,
+0x6650805,
+0x6710805,
+0x6730805,
+0x6740805,
+0x6750805,
+0x6770805,
+0x6780805,
+0x6790805,
+0x67a0805,
+0x67b0805,
+0x67c0805,
+0x67e0805,
+0x6800805,
+0x6810805,
+0x6820805,
+0x6830805,
+0x6840805,
+0x6850805,
+0x6860805,
+0x6860805,
+0xbc4,
+0x6870805,
+0x6870805,
+0xbc4,
+0x6880805,
+0x6890805,
+0x68a0805,
+0x68b0805,
+0x68c0805,
+0x68c0809,
+0x68c0809,
+0x68c0809,
+0x68c0809,
+0x68c0809,
+0x68d0805,
+0x68d0809,
+0x68d0809,
+0x68d0809,
+0x68d0809,
+0x68d0809,
+0x68e0805,
+0x68f0805,
+0x6900805,
+0x6910805,
+0x6920805,
+0x6930805,
+0x6940805,
+0x6950805,
+0x6960805,
+0x6970805,
+0x6980805,
+0x6990805,
+0x69a0805,
+0x69b0805,
+0x69c0805,
+0x69d0805,
+0x6990805,
+0xbc4,
+0x69e0805,
+0x69f0805,
+0x69f0805,
+0xbc4,
+0x6a00805,
+0x6a10805,
+0x6a00805,
+0xbc4,
+0x6a20805,
+0x6a20805,
+0xbc4,
+0x6a30805,
+0x6a40805,
+0x6a50805,
+0x6a60805,
+0x6a70805,
+0x6a80805,
+0x6a90805,
+0x6aa0805,
+0x6ab0805,
+0x6ac0805,
+0x6ad0805,
+0x6ae0805,
+0x6af0805,
+0x6b00805,
+0x6b10805,
+0x6b20805,
+0x6b30805,
+0x6b40805,
+0x6b50805,
+0x6b60805,
+0x6b70805,
+0x6b80805,
+0x66b0805,
+0xbc4,
+0x6b90805,
+0x6b90805,
+0xbc4,
+0x6ba0805,
+0x6bb0805,
+0x6bc0805,
+0x6bd0805,
+0x6be0805,
+0x6bf0805,
+0x6c00805,
+0x6c10805,
+0x6c20805,
+0x6c30805,
+0x6a60805,
+0xbc4,
+0x66a0805,
+0xbc4,
+0x66c0805,
+0xbc4,
+0x6bb0805,
+0xbc4,
+0x6bc0805,
+0xbc4,
+0x6c40805,
+0x6c50805,
+0x6c40805,
+0xbc4,
+0x6c50805,
+0xbc4,
+0x6c60805,
+0x6c70805,
+0x6c60805,
+0xbc4,
+0x6c70805,
+0xbc4,
+0x6c80805,
+0x6c90805,
+0x6ca0805,
+0x6cb0805,
+0x6cc0805,
+0x6cd0805,
+0x6c80805,
+0xbc4,
+0x6c90805,
+0xbc4,
+0x6ce0805,
+0x6cf0805,
+0x6ce0805,
+0xbc4,
+0x6cf0805,
+0xbc4,
+0x6d00805,
+0x6d10805,
+0x6d00805,
+0xbc4,
+0x6d10805,
+0xbc4,
+0x6d20805,
+0x6d30805,
+0x6d40805,
+0x6d50805,
+0x6d60805,
+0x6d70805,
+0x6d80805,
+0x6d90805,
+0x6da0805,
+0x6db0805,
+0x6dc0805,
+0x6dd0805,
+0x6de0805,
+0x6df0805,
+0x6e00805,
+0x6e10805,
+0x6e20805,
+0x6e30805,
+0x6e40805,
+0x6e50805,
+0x6e60805,
+0x6e70805,
+0x6e80805,
+0x6e90805,
+0x6ea0805,
+0x6eb0805,
+0x6ec0805,
+0x6ed0805,
+0x6ee0805,
+0x6ef0805,
+0x6f00805,
+0x6f10805,
+0x6f20805,
+0x6f30805,
+0x6ea0805,
+0xbc4,
+0x6f00805,
+0xbc4,
+0x6f10805,
+0xbc4,
+0x6f30805,
+0xbc4,
+0x6f40805,
+0x6f50805,
+0x6f60805,
+0x6f70805,
+0x6f80805,
+0x6f90805,
+0x6fa0805,
+0x6fb0805,
+0x6fc0805,
+0x6fd0805,
+0x6fe0805,
+0x6ff0805,
+0x7000805,
+0x7020805,
+0x7030805,
+0x7040805,
+0x7050805,
+0x7060805,
+0x7070805,
+0x7080805,
+0x7090805,
+0x70a0805,
+0x70b0805,
+0x70c0805,
+0x70d0805,
+0x70e0805,
+0x70f0805,
+0x7100805,
+0x7110805,
+0x7120805,
+0x7130805,
+0x7140805,
+0x7150805,
+0x7160805,
+0x7170805,
+0x7180805,
+0x7190805,
+0x71a0805,
+0x71b0805,
+0x71c0805,
+0x71d0805,
+0x71e0805,
+0x71f0805,
+0x7200805,
+0x7210805,
+0x7220805,
+0x7230805,
+0x7240805,
+0x6ca0805,
+0xbc4,
+0x6cb0805,
+0xbc4,
+0x6d90805,
+0xbc4,
+0x6da0805,
+0xbc4,
+0x7250805,
+0x7260805,
+0x7270805,
+0x7280805,
+0x7290805,
+0x72a0805,
+0x6f60805,
+0xbc4,
+0x6f70805,
+0xbc4,
+0x6f80805,
+0xbc4,
+0x6f90805,
+0xbc4,
+0x72b0805,
+0x72c0805,
+0x72d0805,
+0x72e0805,
+0x72f0805,
+0x7300805,
+0x7310805,
+0x7320805,
+0x7330805,
+0x7340805,
+0x7350805,
+0x7360805,
+0x7370805,
+0x7380805,
+0x7390805,
+0x73a0805,
+0x73b0805,
+0x73c0805,
+0x73d0805,
+0x73e0805,
+0x73f0805,
+0x7400805,
+0x7410805,
+0x7420805,
+0x7430805,
+0x7440805,
+0x3360805,
+0x3370805,
+0x3380805,
+0x3390805,
+0x7450805,
+0x7460805,
+0x7470805,
+0x7480805,
+0x7490805,
+0x74a0805,
+0x74b0805,
+0x74c0805,
+0x74d0805,
+0x74e0805,
+0x74f0805,
+0x7500805,
+0x7510805,
+0x7520805,
+0x7530805,
+0x7540805,
+0x7550805,
+0x7560805,
+0x7570805,
+0x7580805,
+0x7590805,
+0x75a0805,
+0x75b0805,
+0x75c0805,
+0x75d0805,
+0x75e0805,
+0x75f0805,
+0x7600805,
+0x7610805,
+0x3800805,
+0x3810805,
+0x7620805,
+0x7630805,
+0x7640805,
+0x7650805,
+0x7660805,
+0x7670805,
+0x7680805,
+0x7690805,
+0x76a0805,
+0x76b0805,
+0x76c0805,
+0x76d0805,
+0x76e0805,
+0x76f0805,
+0x7700805,
+0x7710805,
+0x7720805,
+0x7730805,
+0x7740805,
+0x7750805,
+0x7760805,
+0x7770805,
+0x7780805,
+0x7790805,
+0x77a0805,
+0x77b0805,
+0x77c0805,
+0x77d0805,
+0x77e0805,
+0x77f0805,
+0x7800805,
+0x7810805,
+0x7820805,
+0x7830805,
+0x7840805,
+0x7850805,
+0x7860805,
+0x7870805,
+0x7880805,
+0x7890805,
+0x78a0805,
+0x78b0805,
+0x78c0805,
+0x78d0805,
+0x78e0805,
+0x78f0805,
+0x7900805,
+0x7910805,
+0x7920805,
+0x7930805,
+0x7940805,
+0x7950805,
+0x7960805,
+0x7970805,
+0x7980805,
+0x7990805,
+0x79a0805,
+0x79b0805,
+0x79c0805,
+0x79d0805,
+0x79e0805,
+0x79f0805,
+0x7a00805,
+0x7a10805,
+0x7a20805,
+0x7a30805,
+0x7a40805,
+0x7a50805,
+0x7a60805,
+0x7a70805,
+0x7a80805,
+0x7a90805,
+0x7aa0805,
+0x7ab0805,
+0x7ac0805,
+0x7ad0805,
+0x7ae0805,
+0x7af0805,
+0x7b00805,
+0x7b10805,
+0x7b20805,
+0x7b30805,
+0x7b40805,
+0x7b50805,
+0x7b60805,
+0x7b70805,
+0x7b80805,
+0x7b90805,
+0x7ba0805,
+0x7bb0805,
+0x7bc0805,
+0x7bd0805,
+0x7be0805,
+0x7bf0805,
+0x7c00805,
+0x7c10805,
+0x7c20805,
+0x7c30805,
+0x7c40805,
+0x7c50805,
+0x7c60805,
+0x7c70805,
+0x7c80805,
+0x7c90805,
+0x7ca0805,
+0x7cb0805,
+0x7cc0805,
+0x7cd0805,
+0x7ce0805,
+0x7cf0805,
+0x7d00805,
+0x7d10805,
+0x7d20805,
+0x7d30805,
+0x7d40805,
+0x7d50805,
+0x7d60805,
+0x7d70805,
+0x7d80805,
+0x7d90805,
+0x7da0805,
+0x7db0805,
+0x7dc0805,
+0x7dd0805,
+0x7de0805,
+0x7df0805,
+0x7e00805,
+0x7e10805,
+0x7e20805,
+0x7e30805,
+0x7e40805,
+0x7e50805,
+0x7e60805,
+0x7e70805,
+0x7e80805,
+0x7e90805,
+0x7ea0805,
+0x7eb0805,
+0x7ec0805,
+0x7ed0805,
+0x7ee0805,
+0x7ef0805,
+0x7f00805,
+0x7f10805,
+0x7f20805,
+0x7f30805,
+0x7f40805,
+0x7f50805,
+0x7f60805,
+0x7f70805,
+0x7f80805,
+0x7f90805,
+0x7fa0805,
+0x7fb0805,
+0x7fc0805,
+0x7fd0805,
+0x7fe0805,
+0x7ff0805,
+0x8000805,
+0x8010805,
+0x8020805,
+0x8030805,
+0x8040805,
+0x8050805,
+0x8060805,
+0x8070805,
+0x8080805,
+0x8090805,
+0x80a0805,
+0x80b0805,
+0x80c0805,
+0x80d0805,
+0x80e0805,
+0x80f0805,
+0x8100805,
+0x8110805,
+0x8120805,
+0x8130805,
+0x8140805,
+0x8150805,
+0x8160805,
+0x8170805,
+0x8180805,
+0x8190805,
+0x81a0805,
+0x81b0805,
+0x81c0805,
+0x81d0805,
+0x81e0805,
+0x81f0805,
+0x8200805,
+0x8210805,
+0x8220805,
+0x8230805,
+0x8240805,
+0x8250805,
+0x8260805,
+0x8270805,
+0x8280805,
+0x8290805,
+0x82a0805,
+0x82b0805,
+0x82c0805,
+0x82d0805,
+0x82e0805,
+0x82f0805,
+0x8300805,
+0x8310805,
+0x8370805,
+0x8380805,
+0x8390805,
+0x83a0805,
+0x83b0805,
+0x83c0805,
+0x83d0805,
+0x83e0805,
+0x83f0805,
+0x8400805,
+0x8410805,
+0x8420805,
+0x8430805,
+0x8440805,
+0x8450805,
+0x8460805,
+0x8470805,
+0x8480805,
+0x8490805,
+0x84a0805,
+0x84b0805,
+0x84c0805,
+0x84d0805,
+0x84e0805,
+0x84f0805,
+0x8500805,
+0x8510805,
+0x8520805,
+0x8530805,
+0x8540805,
+0x8550805,
+0x8560805,
+0x8570805,
+0x8580805,
+0x8590805,
+0x85a0805,
+0x85b0805,
+0x85c0805,
+0x85d0805,
+0x85e0805,
+0x85f0805,
+0x8600805,
+0x8610805,
+0x8620805,
+0x8630805,
+0x8640805,
+0x8650805,
+0x8660805,
+0x8670805,
+0x8680805,
+0x8690805,
+0x86a0805,
+0x86b0805,
+0x86c0805,
+0x86d0805,
+0x86e0805,
+0x86f0805,
+0x8700805,
+0x8710805,
+0x8720805,
+0x8730805,
+0x8740805,
+0x8750805,
+0x8760805,
+0x8770805,
+0x8780805,
+0x8790805,
+0x87a0805,
+0x87b0805,
+0x87c0805,
+0x87d0805,
+0x87e0805,
+0x87f0805,
+0x8800805,
+0x8810805,
+0x8820805,
+0x8830805,
+0x8840805,
+0x8850805,
+0x8860805,
+0x8870805,
+0x8880805,
+0x8890805,
+0x88a0805,
+0x88b0805,
+0x88c0805,
+0x88d0805,
+0x88e0805,
+0x88f0805,
+0x8900805,
+0x8910805,
+0x8920805,
+0x8930805,
+0x8940805,
+0x8950805,
+0x8960805,
+0x8970805,
+0x8980805,
+0x8990805,
+0x89a0805,
+0x89b0805,
+0x89c0805,
+0x89d0805,
+0x89e0805,
+0x89f0805,
+0x8a00805,
+0x8a10805,
+0x8a20805,
+0x8a30805,
+0x8a40805,
+0x8a50805,
+0x8a60805,
+0x8a70805,
+0x8a80805,
+0x8a90805,
+0x8aa0805,
+0x8ab0805,
+0x8ac0805,
+0x8ad0805,
+0x8ae0805,
+0x8af0805,
+0x8b00805,
+0x8b10805,
+0x8b20805,
+0x8b30805,
+0x8b40805,
+0x8b50805,
+0x8b60805,
+0x8b70805,
+0x8b80805,
+0x8b90805,
+0x8ba0805,
+0x8bb0805,
+0x8bc0805,
+0x8bd0805,
+0x8be0805,
+0x8bf0805,
+0x8c00805,
+0x8c10805,
+0x8c20805,
+0x8c30805,
+0x8c40805,
+0x8c50805,
+0x8c60805,
+0x8c70805,
+0x8c80805,
+0x8c90805,
+0x8ca0805,
+0x8cb0805,
+0x8cc0805,
+0x8cd0805,
+0x8ce0805,
+0x8cf0805,
+0x8d00805,
+0x8d10805,
+0x8d20805,
+0x8d30805,
+0x8d40805,
+0x8d50805,
+0x8d60805,
+0x8d70805,
+0x8d80805,
+0x8d90805,
+0x8da0805,
+0x8db0805,
+0x8dc0805,
+0x8dd0805,
+0x8de0805,
+0x8df0805,
+0x8e00805,
+0x8e10805,
+0x8e20805,
+0x8e30805,
+0x8e40805,
+0x8e50805,
+0x8e60805,
+0x8e70805,
+0x8e80805,
+0x8e90805,
+0x8ea0805,
+0x8eb0805,
+0x8ec0805,
+0x8ed0805,
+0x8ee0805,
+0x8ef0805,
+0x8f00805,
+0x8f10805,
+0x8f20805,
+0x8f30805,
+0x8f40805,
+0x8f50805,
+0x8f60805,
+0x8f70805,
+0x8f80805,
+0x8f90805,
+0x8fa0805,
+0x8fb0805,
+0x8fc0805,
+0x8fd0805,
+0x8fe0805,
+0x8ff0805,
+0x9000805,
+0x9010805,
+0x9020805,
+0x9030805,
+0x9040805,
+0x9050805,
+0x9060805,
+0x9070805,
+0x9080805,
+0x9090805,
+0x90a0805,
+0x90b0805,
+0x90c0805,
+0x90d0805,
+0x90e0805,
+0x90f0805,
+0x9100805,
+0x9110805,
+0x9120805,
+0x9130805,
+0x9140805,
+0x9150805,
+0x9160805,
+0x9170805,
+0x9180805,
+0x9190805,
+0x91a0805,
+0x91b0805,
+0x91c0805,
+0x91d0805,
+0x91e0805,
+0x91f0805,
+0x9200805,
+0x9210805,
+0x9220805,
+0x9230805,
+0x9240805,
+0x9250805,
+0x9260805,
+0x9270805,
+0x9280805,
+0x9290805,
+0x92a0805,
+0x92b0805,
+0x92c0805,
+0x92d0805,
+0x92e0805,
+0x92f0805,
+0x9300805,
+0x9310805,
+0x9320805,
+0x9330805,
+0x9340805,
+0x9350805,
+0x9360805,
+0x9370805,
+0x9380805,
+0x9390805,
+0x93a0805,
+0x93b0805,
+0x93c0805,
+0x93d0805,
+0x93e0805,
+0x93f0805,
+0x9400805,
+0x9410805,
+0x9420805,
+0x9430805,
+0x9440805,
+0x9450805,
+0x9460805,
+0x9470805,
+0x9480805,
+0x9490805,
+0x94a0805,
+0x94b0805,
+0x94c0805,
+0x94d0805,
+0x94e0805,
+0x94f0805,
+0x9500805,
+0x9510805,
+0x9520805,
+0x9530805,
+0x9540805,
+0x9550805,
+0x9560805,
+0x9570805,
+0x9580805,
+0x9590805,
+0x95a0805,
+0x95b0805,
+0x95c0805,
+0x95d0805,
+0x95e0805,
+0x95f0805,
+0x9600805,
+0x9610805,
+0x9620805,
+0x9630805,
+0x9640805,
+0x9650805,
+0x9660805,
+0x9670805,
+0x9680805,
+0xa330805,
+0xa340805,
+0xa350805,
+0xa360805,
+0xa370805,
+0xa380805,
+0xa390805,
+0xa3a0805,
+0xa3b0805,
+0xa3c0805,
+0xa3d0805,
+0xa3e0805,
+0xa3f0805,
+0xa400805,
+0xa410805,
+0xa420805,
+0xa430805,
+0xa440805,
+0xa450805,
+0xa460805,
+0xa470805,
+0xa480805,
+0xa490805,
+0xa4a0805,
+0xa4b0805,
+0xa4c0805,
+0xa4d0805,
+0xa4e0805,
+0xa4f0805,
+0xa500805,
+0xa510805,
+0xa520805,
+0xa530805,
+0xa540805,
+0xa550805,
+0xa560805,
+0xa570805,
+0xa580805,
+0xa590805,
+0xa5a0805,
+0xa5b0805,
+0xa5c0805,
+0xa5d0805,
+0xa5e0805,
+0xa5f0805,
+0xa600805,
+0xa610805,
+0xa620805,
+0xfee0805,
+0xfef0805,
+0xff00805,
+0xff10805,
+0xff20805,
+0xff30805,
+0xff40805,
+0xff50805,
+0xa630805,
+0xa640805,
+0xa650805,
+0xa660805,
+0xa670805,
+0xa680805,
+0xa690805,
+0xa6a0805,
+0xa6b0805,
+0xa6c0805,
+0xa6d0805,
+0xa6e0805,
+0xa6f0805,
+0xa700805,
+0xa710805,
+0xa720805,
+0xa730805,
+0xa740805,
+0xa750805,
+0xa760805,
+0xa770805,
+0xa780805,
+0xa790805,
+0xa7a0805,
+0xa7b0805,
+0xa7c0805,
+0xa7d0805,
+0xa7e0805,
+0xa7f0805,
+0xa800805,
+0xa810805,
+0xa820805,
+0xa830805,
+0xa840805,
+0xa850805,
+0xa860805,
+0xa870805,
+0xa880805,
+0xa890805,
+0xa8a0805,
+0xa8b0805,
+0xa8c0805,
+0xa8d0805,
+0xa8e0805,
+0xa8f0805,
+0xa900805,
+0xa910805,
+0xa920805,
+0xa930805,
+0xa940805,
+0xa950805,
+0xa960805,
+0xa970805,
+0x12410805,
+0x12420805,
+0x12430805,
+0xa980805,
+0xa990805,
+0xa9a0805,
+0xa9b0805,
+0xa9c0805,
+0xa9d0805,
+0xa9e0805,
+0xa9f0805,
+0xaa00805,
+0xaa10805,
+0xaa20805,
+0xaa30805,
+0xaa40805,
+0xaa50805,
+0xaa60805,
+0xaa70805,
+0xaa80805,
+0xaa90805,
+0xaaa0805,
+0xaab0805,
+0xaac0805,
+0xaad0805,
+0xaae0805,
+0xaaf0805,
+0xab00805,
+0xab10805,
+0xfe80805,
+0xfe90805,
+0xfea0805,
+0xfeb0805,
+0xfec0805,
+0xfed0805,
+0xab20805,
+0xab30805,
+0xab40805,
+0xab50805,
+0xab60805,
+0xab70805,
+0xab80805,
+0xab90805,
+0xaba0805,
+0xabb0805,
+0xabc0805,
+0xabd0805,
+0xabe0805,
+0xabf0805,
+0xac00805,
+0xac10805,
+0xac20805,
+0xac30805,
+0xac40805,
+0xac50805,
+0xac60805,
+0xac70805,
+0xac80805,
+0xac90805,
+0xaca0805,
+0xacb0805,
+0xacc0805,
+0xacd0805,
+0xace0805,
+0xacf0805,
+0xad00805,
+0xad10805,
+0xad20805,
+0xad30805,
+0xad40805,
+0xad50805,
+0xad60805,
+0xad70805,
+0xad80805,
+0xad90805,
+0xada0805,
+0xadb0805,
+0xadc0805,
+0xadd0805,
+0xade0805,
+0xadf0805,
+0xae00805,
+0xae10805,
+0xae20805,
+0xae30805,
+0xae40805,
+0xae50805,
+0xae60805,
+0xae70805,
+0xae80805,
+0xae90805,
+0xaea0805,
+0xaeb0805,
+0xaec0805,
+0xaed0805,
+0xaee0805,
+0xaef0805,
+0xaf00805,
+0xaf10805,
+0xaf20805,
+0xaf30805,
+0xaf40805,
+0xaf50805,
+0xaf60805,
+0xaf70805,
+0xaf80805,
+0xaf90805,
+0xafa0805,
+0xafb0805,
+0xafc0805,
+0xafd0805,
+0xafe0805,
+0xaff0805,
+0xb000805,
+0xb010805,
+0xb020805,
+0xb030805,
+0xb040805,
+0xb050805,
+0xb060805,
+0xb070805,
+0xb080805,
+0xb090805,
+0xb0a0805,
+0xb0b0805,
+0xb0c0805,
+0xb0d0805,
+0xb0e0805,
+0xb0f0805,
+0xb100805,
+0xb110805,
+0xb120805,
+0xb130805,
+0xb140805,
+0xb150805,
+0xb160805,
+0xb170805,
+0xb180805,
+0xb190805,
+0xb1a0805,
+0xb1b0805,
+0xb1c0805,
+0xb1d0805,
+0xb1e0805,
+0xb1f0805,
+0xb200805,
+0xb210805,
+0xb3c0805,
+0xb3d0805,
+0xb3e0805,
+0xb3f0805,
+0xb400805,
+0xb410805,
+0xb420805,
+0xb430805,
+0xb440805,
+0xb450805,
+0xb460805,
+0xb470805,
+0xb480805,
+0xb490805,
+0xb4a0805,
+0xb4b0805,
+0xb4c0805,
+0xb4d0805,
+0xb4e0805,
+0xb4f0805,
+0xb500805,
+0xb510805,
+0xb520805,
+0xb530805,
+0xb540805,
+0xb550805,
+0xb560805,
+0xb570805,
+0xb580805,
+0xb590805,
+0xb5a0805,
+0xb5b0805,
+0xb5c0805,
+0xb5f0805,
+0xb600805,
+0xb610805,
+0xb620805,
+0xb630805,
+0xb640805,
+0xb650805,
+0xb660805,
+0xb670805,
+0xb680805,
+0xb690805,
+0xb6a0805,
+0xb6b0805,
+0xb6c0805,
+0xb6d0805,
+0xb6e0805,
+0xb6f0805,
+0xb700805,
+0xb710805,
+0xb720805,
+0xb730805,
+0xb740805,
+0xb750805,
+0xb760805,
+0xb770805,
+0xb780805,
+0xb790805,
+0xb7a0805,
+0xb7b0805,
+0xb7c0805,
+0xb7d0805,
+0xb7e0805,
+0xb7f0805,
+0xb800805,
+0xb810805,
+0xb820805,
+0xb830805,
+0xb840805,
+0xb850805,
+0xb860805,
+0xb870805,
+0xb880805,
+0xb890805,
+0xb8a0805,
+0xb8b0805,
+0xb8c0805,
+0xb8d0805,
+0xb8e0805,
+0xb8f0805,
+0xb900805,
+0xb910805,
+0xb920805,
+0xb930805,
+0xb940805,
+0xb950805,
+0xb960805,
+0xb970805,
+0xb980805,
+0xb990805,
+0xb9a0805,
+0xb9b0805,
+0xb9c0805,
+0xb9d0805,
+0xb9e0805,
+0xb9f0805,
+0xba00805,
+0xba10805,
+0xba20805,
+0xba30805,
+0xba40805,
+0xba50805,
+0x35e0805,
+0x35f0805,
+0x3600805,
+0x3610805,
+0x3620805,
+0x3630805,
+0x3640805,
+0x3650805,
+0x3660805,
+0x3670805,
+0x3680805,
+0x3690805,
+0x36a0805,
+0x36b0805,
+0xba60805,
+0xba70805,
+0xba80805,
+0xba90805,
+0xbaa0805,
+0xbab0805,
+0xbac0805,
+0xbad0805,
+0xbae0805,
+0xbaf0805,
+0xbb00805,
+0xbb10805,
+0xbb20805,
+0xbb30805,
+0xbb40805,
+0xbb50805,
+0xbb60805,
+0xbb70805,
+0xbb80805,
+0xbb90805,
+0xbba0805,
+0xbbb0805,
+0xbbc0805,
+0xbbd0805,
+0xbbe0805,
+0xbbf0805,
+0xbc00805,
+0xbc10805,
+0xbc20805,
+0xbc30805,
+0xbc40805,
+0xbc50805,
+0xbc60805,
+0xbc70805,
+0xbc80805,
+0xbc90805,
+0xbca0805,
+0xbcb0805,
+0xbcc0805,
+0xbcd0805,
+0xbce0805,
+0xbcf0805,
+0xbd00805,
+0xbd10805,
+0xbd20805,
+0xbd30805,
+0xbd40805,
+0xbd50805,
+0xbd60805,
+0x3520805,
+0x3530805,
+0xbd70805,
+0xbd80805,
+0xbd90805,
+0xbda0805,
+0xbdb0805,
+0xbdc0805,
+0xbdd0805,
+0xbde0805,
+0xbdf0805,
+0xbe00805,
+0xbe10805,
+0xbe20805,
+0xbe30805,
+0xbe40805,
+0xbe50805,
+0xbe60805,
+0xbe70805,
+0xbe80805,
+0xbe90805,
+0xbea0805,
+0xbeb0805,
+0xbec0805,
+0xbed0805,
+0xbee0805,
+0xbef0805,
+0xbf00805,
+0xbf10805,
+0xbf20805,
+0xbf30805,
+0xbf40805,
+0xbf50805,
+0x3540805,
+0x3550805,
+0x3560805,
+0x3570805,
+0x3580805,
+0x3590805,
+0x35a0805,
+0x35b0805,
+0x35c0805,
+0x35d0805,
+0xbf60805,
+0xbf70805,
+0xbf80805,
+0xbf90805,
+0xbfa0805,
+0xbfb0805,
+0xbfc0805,
+0xbfd0805,
+0xbfe0805,
+0xbff0805,
+0xc000805,
+0xc010805,
+0xc020805,
+0xc030805,
+0xc040805,
+0xc050805,
+0xee80805,
+0xee90805,
+0xeea0805,
+0xeeb0805,
+0xeec0805,
+0xeed0805,
+0xeee0805,
+0xeef0805,
+0xef00805,
+0xef10805,
+0xef20805,
+0xef30805,
+0xef40805,
+0xef50805,
+0xef60805,
+0xef70805,
+0xef80805,
+0xef90805,
+0xefa0805,
+0xefb0805,
+0xefc0805,
+0xefd0805,
+0xefe0805,
+0xeff0805,
+0xf000805,
+0xf010805,
+0xf020805,
+0xf030805,
+0xf040805,
+0xf050805,
+0xf060805,
+0xf070805,
+0xf080805,
+0xf090805,
+0xf0a0805,
+0xf0b0805,
+0xf0c0805,
+0xf0d0805,
+0xf0e0805,
+0xf0f0805,
+0xf100805,
+0xf110805,
+0xf120805,
+0xf130805,
+0xf140805,
+0xf150805,
+0xf160805,
+0xf170805,
+0xf180805,
+0xf190805,
+0xf1a0805,
+0xf1b0805,
+0xf1c0805,
+0xf1d0805,
+0xf1e0805,
+0xf1f0805,
+0xf200805,
+0xf210805,
+0xf220805,
+0xf230805,
+0xf240805,
+0xf250805,
+0xf260805,
+0xf270805,
+0xf280805,
+0xf290805,
+0xf2a0805,
+0xf2b0805,
+0xf2c0805,
+0xf2d0805,
+0xf2e0805,
+0xf2f0805,
+0xf300805,
+0xf310805,
+0xf320805,
+0xf330805,
+0xf340805,
+0xf350805,
+0xf360805,
+0xf370805,
+0xf380805,
+0xf390805,
+0xf3a0805,
+0xf3b0805,
+0xf3c0805,
+0xf3d0805,
+0xf3e0805,
+0xf3f0805,
+0xf400805,
+0xf410805,
+0xf420805,
+0xf430805,
+0xf440805,
+0xf450805,
+0xf460805,
+0xf470805,
+0xf480805,
+0xf490805,
+0xf4a0805,
+0xf4b0805,
+0xf4c0805,
+0xf4d0805,
+0xf4e0805,
+0xf4f0805,
+0xf500805,
+0xf510805,
+0xf520805,
+0xf530805,
+0xf540805,
+0xf550805,
+0xf560805,
+0xf570805,
+0xf580805,
+0xf590805,
+0xf5a0805,
+0xf5b0805,
+0xf5c0805,
+0xf5d0805,
+0xf5e0805,
+0xf5f0805,
+0xf600805,
+0xf610805,
+0xf620805,
+0xf630805,
+0xf640805,
+0xf650805,
+0xf660805,
+0xf670805,
+0xf680805,
+0xf690805,
+0xf6a0805,
+0xf6b0805,
+0xf6c0805,
+0xf6d0805,
+0xf6e0805,
+0xf6f0805,
+0xf700805,
+0xf710805,
+0xf720805,
+0xf730805,
+0xf740805,
+0xf750805,
+0xf760805,
+0xf770805,
+0xf780805,
+0xf790805,
+0xf7a0805,
+0xf7b0805,
+0xf7c0805,
+0xf7d0805,
+0xf7e0805,
+0xf7f0805,
+0xf800805,
+0xf810805,
+0xf820805,
+0xf830805,
+0xf840805,
+0xf850805,
+0xf860805,
+0xf870805,
+0xf880805,
+0xf890805,
+0xf8a0805,
+0xf8b0805,
+0xf8c0805,
+0xf8d0805,
+0xf8e0805,
+0xf8f0805,
+0xf900805,
+0xf910805,
+0xf920805,
+0xf930805,
+0xf940805,
+0xf950805,
+0xf960805,
+0xf970805,
+0xf980805,
+0xf990805,
+0xf9a0805,
+0xf9b0805,
+0xf9c0805,
+0xf9d0805,
+0xf9e0805,
+0xf9f0805,
+0xfa00805,
+0xfa10805,
+0xfa20805,
+0xfa30805,
+0xfa40805,
+0xfa50805,
+0xfa60805,
+0xfa70805,
+0xfa80805,
+0xfa90805,
+0xfaa0805,
+0xfab0805,
+0xfac0805,
+0xfad0805,
+0xfae0805,
+0xfaf0805,
+0xfb00805,
+0xfb10805,
+0xfb20805,
+0xfb30805,
+0xfb40805,
+0xfb50805,
+0xfb60805,
+0xfb70805,
+0xfb80805,
+0xfb90805,
+0xfba0805,
+0xfbb0805,
+0xfbc0805,
+0xfbd0805,
+0xfbe0805,
+0xfbf0805,
+0xfc00805,
+0xfc10805,
+0xfc20805,
+0xfc30805,
+0xfc40805,
+0xfc50805,
+0xfc60805,
+0xfc70805,
+0xfc80805,
+0xfc90805,
+0xfca0805,
+0xfcb0805,
+0xfcc0805,
+0xfcd0805,
+0xfce0805,
+0xfcf0805,
+0xfd00805,
+0xfd10805,
+0xfd20805,
+0xfd30805,
+0xfd40805,
+0xfd50805,
+0xfd60805,
+0xfd70805,
+0xfd80805,
+0xfd90805,
+0xfda0805,
+0xfdb0805,
+0xfdc0805,
+0xfdd0805,
+0xfde0805,
+0xfdf0805,
+0xfe00805,
+0xfe10805,
+0xfe20805,
+0xfe30805,
+0xfe40805,
+0xfe50805,
+0xfe60805,
+0xfe70805,
+0xc060805,
+0xc070805,
+0xc080805,
+0xc090805,
+0xc0a0805,
+0xc0b0805,
+0xc0c0805,
+0xc0d0805,
+0xc0e0805,
+0xc0f0805,
+0xc100805,
+0xc110805,
+0xc120805,
+0xc130805,
+0xc140805,
+0xc150805,
+0xc160805,
+0xc170805,
+0xc180805,
+0xc190805,
+0xc1a0805,
+0xc1b0805,
+0xc1c0805,
+0xc1d0805,
+0xc1e0805,
+0xc1f0805,
+0xc200805,
+0xc210805,
+0xc220805,
+0xc230805,
+0xc240805,
+0xc250805,
+0xc260805,
+0xc270805,
+0xc280805,
+0xc290805,
+0xc2a0805,
+0xc2b0805,
+0xc2c0805,
+0xc2d0805,
+0xc2e0805,
+0xc2f0805,
+0xc300805,
+0xc310805,
+0xc320805,
+0xc330805,
+0xc340805,
+0xc350805,
+0xc360805,
+0xc370805,
+0xc380805,
+0xc390805,
+0xc3a0805,
+0xc3b0805,
+0xc3c0805,
+0xc3d0805,
+0xc3e0805,
+0xc3f0805,
+0xc400805,
+0xc410805,
+0xc420805,
+0xc430805,
+0xc440805,
+0xc450805,
+0xc460805,
+0xc470805,
+0xc480805,
+0xc490805,
+0xc4a0805,
+0xc4b0805,
+0xc4c0805,
+0xc4d0805,
+0xc4e0805,
+0xc4f0805,
+0xc500805,
+0xc510805,
+0xc520805,
+0xc530805,
+0xc540805,
+0xc550805,
+0xc560805,
+0xc570805,
+0xc580805,
+0xc590805,
+0xc5a0805,
+0xc5b0805,
+0xc5c0805,
+0xc5d0805,
+0xc5e0805,
+0xc5f0805,
+0xc600805,
+0xc610805,
+0xc620805,
+0xc630805,
+0xc640805,
+0xc650805,
+0xc660805,
+0xc670805,
+0xc680805,
+0xc690805,
+0xc6a0805,
+0xc6b0805,
+0xc6c0805,
+0xc6d0805,
+0xc6e0805,
+0xc6f0805,
+0xc700805,
+0xc710805,
+0xc720805,
+0xc730805,
+0xc740805,
+0xc750805,
+0xc760805,
+0xc770805,
+0xc780805,
+0xc790805,
+0xc7a0805,
+0xc7b0805,
+0xc7c0805,
+0xc7d0805,
+0xc7e0805,
+0xc7f0805,
+0xc800805,
+0xc810805,
+0xc820805,
+0xc830805,
+0xc840805,
+0xc850805,
+0xc860805,
+0xc870805,
+0xc880805,
+0x33c0805,
+0x33d0805,
+0x33e0805,
+0x33f0805,
+0x3400805,
+0x3410805,
+0x3420805,
+0x3430805,
+0x3440805,
+0x3450805,
+0x3460805,
+0x3470805,
+0x3480805,
+0x3490805,
+0x34a0805,
+0x34b0805,
+0x34c0805,
+0x34d0805,
+0x34e0805,
+0x34f0805,
+0x3500805,
+0x3510805,
+0xc890805,
+0xc8a0805,
+0xc8b0805,
+0xc8c0805,
+0xc8d0805,
+0xc8e0805,
+0xc8f0805,
+0xc900805,
+0xc910805,
+0xc920805,
+0xc930805,
+0xc940805,
+0xc950805,
+0xc960805,
+0xc970805,
+0xc980805,
+0xc990805,
+0xc9a0805,
+0xc9b0805,
+0xc9c0805,
+0xc9d0805,
+0xc9e0805,
+0xc9f0805,
+0xca00805,
+0xca10805,
+0xca20805,
+0xca30805,
+0xca40805,
+0xca50805,
+0xca60805,
+0xca70805,
+0xca80805,
+0xca90805,
+0xcaa0805,
+0xcab0805,
+0xcac0805,
+0xcad0805,
+0xcae0805,
+0xcaf0805,
+0xcb00805,
+0xcb10805,
+0xcb20805,
+0xcb30805,
+0xcb40805,
+0xcb50805,
+0xcb60805,
+0xcb70805,
+0xcb80805,
+0xcb90805,
+0xcba0805,
+0xcbb0805,
+0xcbc0805,
+0xcbd0805,
+0xcbe0805,
+0xcbf0805,
+0xcc00805,
+0xcc10805,
+0xcc20805,
+0xcc30805,
+0xcc40805,
+0xcc50805,
+0xcc60805,
+0xcc70805,
+0x3960805,
+0x3970805,
+0x3980805,
+0x3990805,
+0xcc80805,
+0xcc90805,
+0xcca0805,
+0xccb0805,
+0xccc0805,
+0xccd0805,
+0xcce0805,
+0xccf0805,
+0xcd00805,
+0xcd10805,
+0xcd20805,
+0xcd30805,
+0xcd40805,
+0xcd50805,
+0xcd60805,
+0xcd70805,
+0xcd80805,
+0xcd90805,
+0xcda0805,
+0xcdb0805,
+0xcdc0805,
+0xcdd0805,
+0xcde0805,
+0xcdf0805,
+0xce00805,
+0xce10805,
+0xce20805,
+0xce30805,
+0xce40805,
+0xce50805,
+0xce60805,
+0xce70805,
+0x33a0805,
+0x33b0805,
+0xce80805,
+0xce90805,
+0xcea0805,
+0xceb0805,
+0xcec0805,
+0xced0805,
+0xcee0805,
+0xcef0805,
+0xcf00805,
+0xcf10805,
+0xcf20805,
+0xcf30805,
+0xcf40805,
+0xcf50805,
+0x68c0809,
+0x68c0809,
+0x68c0809,
+0x68c0809,
+0xcf60805,
+0xcf70805,
+0xcf80805,
+0xcf90805,
+0xcfa0805,
+0xcfb0805,
+0xcfc0805,
+0xcfd0805,
+0xcfe0805,
+0xcff0805,
+0xd000805,
+0xd010805,
+0xd020805,
+0xd030805,
+0xd040805,
+0xd050805,
+0xd060805,
+0xd070805,
+0xd080805,
+0xd090805,
+0xd0a0805,
+0xd0b0805,
+0xd0c0805,
+0xd0d0805,
+0xd0e0805,
+0xd0f0805,
+0xd100805,
+0xd110805,
+0xd120805,
+0xd130805,
+0xd140805,
+0xd150805,
+0xd160805,
+0xd170805,
+0xd180805,
+0xd190805,
+0xd1a0805,
+0xd1b0805,
+0xd1c0805,
+0xd1d0805,
+0xd1e0805,
+0xd1f0805,
+0xd200805,
+0xd210805,
+0xd220805,
+0xd230805,
+0xd240805,
+0xd250805,
+0xd260805,
+0xd270805,
+0xd280805,
+0xd290805,
+0xd2a0805,
+0xd2b0805,
+0xd2c0805,
+0xd2d0805,
+0xd2e0805,
+0xd2f0805,
+0xd300805,
+0xd310805,
+0xd320805,
+0xd330805,
+0xd340805,
+0xd350805,
+0xd360805,
+0xd370805,
+0xd380805,
+0xd390805,
+0xd3a0805,
+0xd3b0805,
+0xd3c0805,
+0xd3d0805,
+0xd3e0805,
+0xd3f0805,
+0xd400805,
+0xd410805,
+0xd420805,
+0xd430805,
+0xd440805,
+0xd450805,
+0xd460805,
+0xd470805,
+0xd480805,
+0xd490805,
+0xd4a0805,
+0xd4b0805,
+0xd4c0805,
+0xd4d0805,
+0xd4e0805,
+0xd4f0805,
+0xd500805,
+0xd510805,
+0xd520805,
+0xd530805,
+0xd540805,
+0xd550805,
+0xd560805,
+0xd570805,
+0xd580805,
+0xd590805,
+0xd5a0805,
+0xd5b0805,
+0xd5c0805,
+0x2400809,
+0x2400809,
+0x66b0809,
+0x66b0809,
+0x66b0809,
+0x66b0809,
+0x66b0809,
+0x66b0809,
+0xd5d0805,
+0xd5e0805,
+0xd5f0805,
+0xd600805,
+0xd610805,
+0xd620805,
+0xd630805,
+0xd640805,
+0xd650805,
+0xd660805,
+0xd670805,
+0xd680805,
+0xd690805,
+0xd6a0805,
+0xd6b0805,
+0xd6c0805,
+0xd6d0805,
+0xd6e0805,
+0xd6f0805,
+0xd700805,
+0xd710805,
+0xd720805,
+0xd730805,
+0xd740805,
+0xd750805,
+0xd760805,
+0xd770805,
+0xd780805,
+0xd790805,
+0xd7a0805,
+0xd7b0805,
+0xd7c0805,
+0xd7d0805,
+0xd7e0805,
+0xd7f0805,
+0xd800805,
+0xd810805,
+0xd820805,
+0xd830805,
+0xd840805,
+0xd850805,
+0xd860805,
+0xd870805,
+0xd880805,
+0xd890805,
+0xd8a0805,
+0xd8b0805,
+0xd8c0805,
+0xd8d0805,
+0xd8e0805,
+0xd8f0805,
+0xd900805,
+0xd910805,
+0xd920805,
+0xd930805,
+0xd940805,
+0xd950805,
+0xd960805,
+0xd970805,
+0xd980805,
+0xd990805,
+0xd9a0805,
+0xd9b0805,
+0xd9c0805,
+0xd9d0805,
+0xd9e0805,
+0xd9f0805,
+0xda00805,
+0xda10805,
+0xda20805,
+0xda30805,
+0xda40805,
+0xda50805,
+0xda60805,
+0xda70805,
+0xda80805,
+0xda90805,
+0xdaa0805,
+0xdab0805,
+0xdac0805,
+0xdad0805,
+0xdae0805,
+0xdaf0805,
+0xdb00805,
+0xdb10805,
+0xdb20805,
+0xdb30805,
+0xdb40805,
+0xdb50805,
+0xdb60805,
+0xdb70805,
+0xdb80805,
+0xdb90805,
+0xdba0805,
+0xdbb0805,
+0xdbc0805,
+0xdbd0805,
+0xdbe0805,
+0xdbf0805,
+0xdc00805,
+0xdc10805,
+0xdc20805,
+0xbc4,
+0xdc20805,
+0xdc30805,
+0xdc40805,
+0xdc50805,
+0xdc60805,
+0xdc70805,
+0xdc80805,
+0xdc90805,
+0xdca0805,
+0xdcb0805,
+0xdcc0805,
+0xdcd0805,
+0xdce0805,
+0xdcf0805,
+0xdd00805,
+0xdd10805,
+0xdd20805,
+0xdd30805,
+0xdd40805,
+0xdd50805,
+0xdd60805,
+0xdd70805,
+0xdd80805,
+0xdd90805,
+0xdda0805,
+0xddb0805,
+0xddc0805,
+0xddd0805,
+0xdde0805,
+0xddf0805,
+0xde00805,
+0xde10805,
+0xde20805,
+0xde30805,
+0xde40805,
+0xde50805,
+0xde60805,
+0xde70805,
+0xde80805,
+0xde90805,
+0xdea0805,
+0xdeb0805,
+0xdec0805,
+0xded0805,
+0xdee0805,
+0xdef0805,
+0xdf00805,
+0xdf10805,
+0xdf20805,
+0xdf30805,
+0xdf40805,
+0xdf50805,
+0xdf60805,
+0xdf70805,
+0xdf80805,
+0xdf90805,
+0xdfa0805,
+0xdfb0805,
+0xdfc0805,
+0xdfd0805,
+0xdfe0805,
+0xdff0805,
+0xe000805,
+0xe010805,
+0xe020805,
+0xe030805,
+0xe040805,
+0xe050805,
+0xe060805,
+0xe070805,
+0xe080805,
+0xe090805,
+0xe0a0805,
+0xe0b0805,
+0xe0c0805,
+0xe0d0805,
+0xe0e0805,
+0xe0f0805,
+0xe100805,
+0xe110805,
+0xe120805,
+0xe130805,
+0xe140805,
+0xe150805,
+0xe160805,
+0xe170805,
+0xe180805,
+0xe190805,
+0xe1a0805,
+0xe1b0805,
+0xe1c0805,
+0xe1d0805,
+0xe1e0805,
+0xe1f0805,
+0xe200805,
+0xe210805,
+0xe220805,
+0xe230805,
+0xe240805,
+0xe250805,
+0xe260805,
+0xe270805,
+0xe280805,
+0xe290805,
+0xe2a0805,
+0xe2b0805,
+0xe2c0805,
+0xe2d0805,
+0xe2e0805,
+0xe2f0805,
+0xe300805,
+0xe310805,
+0xe320805,
+0xe330805,
+0xe340805,
+0xe350805,
+0xe360805,
+0xe370805,
+0xe380805,
+0xe390805,
+0xe3a0805,
+0xe3b0805,
+0xe3c0805,
+0xe3d0805,
+0xe3e0805,
+0xe3f0805,
+0xe400805,
+0xe410805,
+0xe420805,
+0xe430805,
+0xe440805,
+0xe450805,
+0xe460805,
+0xe470805,
+0xe480805,
+0xe490805,
+0xe4a0805,
+0xe4b0805,
+0xe4c0805,
+0xe4d0805,
+0xe4e0805,
+0xe4f0805,
+0xe500805,
+0xe510805,
+0xe520805,
+0xe530805,
+0xe540805,
+0xe550805,
+0xe560805,
+0xe570805,
+0xe580805,
+0xe590805,
+0xe5a0805,
+0xe5b0805,
+0xe5c0805,
+0xe5d0805,
+0xe5e0805,
+0xe5f0805,
+0xe600805,
+0xe610805,
+0xe620805,
+0xe630805,
+0xe640805,
+0xe650805,
+0xe660805,
+0xe670805,
+0xe680805,
+0xe690805,
+0xe6a0805,
+0xe6b0805,
+0xe6c0805,
+0xe6d0805,
+0xe6e0805,
+0xe6f0805,
+0xe700805,
+0xe710805,
+0xe720805,
+0xe730805,
+0xe740805,
+0xe750805,
+0xe760805,
+0xe770805,
+0xe780805,
+0xe7a0805,
+0xe7b0805,
+0xe7c0805,
+0xe7d0805,
+0xe7e0805,
+0xe7f0805,
+0xe800805,
+0xe810805,
+0xe820805,
+0xe830805,
+0xe840805,
+0xe850805,
+0xe860805,
+0xe870805,
+0xe880805,
+0xe890805,
+0xe8a0805,
+0xe8b0805,
+0xe8c0805,
+0xe8d0805,
+0xe8e0805,
+0xe8f0805,
+0xe900805,
+0xe910805,
+0xe920805,
+0xe930805,
+0xe940805,
+0xe950805,
+0xe960805,
+0xe970805,
+0xe980805,
+0xe990805,
+0xe9a0805,
+0xe9b0805,
+0xe9f0805,
+0xea00805,
+0xea10805,
+0xea20805,
+0xea30805,
+0xea40805,
+0xea50805,
+0xea60805,
+0xea70805,
+0xea80805,
+0xea90805,
+0xeaa0805,
+0xeac0805,
+0xead0805,
+0xeae0805,
+0xeaf0805,
+0xeb00805,
+0xeb10805,
+0xeb20805,
+0xeb30805,
+0xece0805,
+0xecf0805,
+0xed00805,
+0xed10805,
+0xee20805,
+0xee30805,
+0xee40805,
+0xee50805,
+0xee60805,
+0xee70805,
+0x2880805,
+0x2750805,
+0x2760805,
+0x3070805,
+0x1db70805,
+0x2890805,
+0x3080805,
+0x4530805,
+0x3cb0805,
+0x3cc0805,
+0x36c0805,
+0x36d0805,
+0x36e0805,
+0x36f0805,
+0x3cd0805,
+0x3ce0805,
+0x3cf0805,
+0x3700805,
+0x3710805,
+0x3d00805,
+0x3720805,
+0x3730805,
+0x3d10805,
+0x3d20805,
+0x3d30805,
+0x3d40805,
+0x3d50805,
+0x3d60805,
+0x3d70805,
+0x3d80805,
+0x3d90805,
+0x21c0805,
+0x27d0805,
+0x3090805,
+0x3da0805,
+0x3db0805,
+0x3740805,
+0x3750805,
+0x3dc0805,
+0x3dd0805,
+0x3760805,
+0x3770805,
+0x3780805,
+0x3790805,
+0x37a0805,
+0x37b0805,
+0x37c0805,
+0x37d0805,
+0x37e0805,
+0x37f0805,
+0x3020805,
+0x3030805,
+0x3040805,
+0x3050805,
+0x26f0805,
+0x28a0805,
+0x2940805,
+0x2250805,
+0x2950805,
+0x2240805,
+0x23d0805,
+0x3b50805,
+0x3b60805,
+0x3b70805,
+0x39b0805,
+0x2180805,
+0x2190805,
+0x28b0805,
+0x3060805,
+0x3950805,
+0x39f0805,
+0x21d0805,
+0x2260805,
+0x3220805,
+0x1d1b0805,
+0x1d1c0805,
+0x1d1d0805,
+0x1d1e0805,
+0x1d1f0805,
+0x1d200805,
+0x1d210805,
+0x1d220805,
+0x1d230805,
+0x1d240805,
+0x1d250805,
+0x1d260805,
+0x2090807,
+0x2360805,
+0x2920805,
+0x3c10805,
+0x1d4b0805,
+0x3820805,
+0x3830805,
+0x3840805,
+0x3850805,
+0x3860805,
+0x3870805,
+0x3880805,
+0x3890805,
+0x1d4c0805,
+0x1d4d0805,
+0x38a0805,
+0x38b0805,
+0x38c0805,
+0x38d0805,
+0x38e0805,
+0x38f0805,
+0x3900805,
+0x3910805,
+0x21e0805,
+0x3230805,
+0x3240805,
+0x3250805,
+0x1d4e0805,
+0x21f0805,
+0x1d4c0809,
+0x1d4f0805,
+0x3c20805,
+0x1d500805,
+0x1d510805,
+0x4c30805,
+0x4c40805,
+0x2200805,
+0x2210805,
+0x1d520805,
+0x1d530805,
+0x1d270805,
+0x1d280805,
+0x1d290805,
+0x1d2a0805,
+0x1d2b0805,
+0x1d2c0805,
+0x1d2d0805,
+0x1d2e0805,
+0x1d2f0805,
+0x1d300805,
+0x1d310805,
+0x1d320805,
+0x1d330805,
+0x1d340805,
+0x1d350805,
+0x1d360805,
+0x1d370805,
+0x1d380805,
+0x1d390805,
+0x1d3a0805,
+0x1d3b0805,
+0x1d3c0805,
+0x1d3d0805,
+0x1d3e0805,
+0x1d3f0805,
+0x1d400805,
+0x1d410805,
+0x1d420805,
+0x1d430805,
+0x1d440805,
+0x1d450805,
+0x1d460805,
+0x1d470805,
+0x1d480805,
+0x1d490805,
+0x1d4a0805,
+0x1d540805,
+0xff60805,
+0xff70805,
+0xff80805,
+0xff90805,
+0xffa0805,
+0xffb0805,
+0xffc0805,
+0xffd0805,
+0xffe0805,
+0xfff0805,
+0x10000805,
+0x10010805,
+0x10020805,
+0x10030805,
+0x10040805,
+0x10050805,
+0x10060805,
+0x10070805,
+0x10080805,
+0x10090805,
+0x100a0805,
+0x100b0805,
+0x100c0805,
+0x100d0805,
+0x100e0805,
+0x100f0805,
+0x10100805,
+0x10110805,
+0x10120805,
+0x10130805,
+0x10140805,
+0x10150805,
+0x10160805,
+0x10170805,
+0x10180805,
+0x10190805,
+0x101a0805,
+0x101b0805,
+0x101c0805,
+0x101d0805,
+0x101e0805,
+0x101f0805,
+0x10200805,
+0x10210805,
+0x10220805,
+0x10230805,
+0x10240805,
+0x10250805,
+0x10260805,
+0x10270805,
+0x10280805,
+0x10290805,
+0x102a0805,
+0x102b0805,
+0x102c0805,
+0x102d0805,
+0x102e0805,
+0x102f0805,
+0x10300805,
+0x10310805,
+0x10320805,
+0x10330805,
+0x10340805,
+0x10350805,
+0x108d0805,
+0x108e0805,
+0x108f0805,
+0x10900805,
+0x10910805,
+0x10920805,
+0x10930805,
+0x10940805,
+0x10950805,
+0x10960805,
+0x10970805,
+0x10980805,
+0x10990805,
+0x109a0805,
+0x109b0805,
+0x109c0805,
+0x109d0805,
+0x109e0805,
+0x109f0805,
+0x10a00805,
+0x10a10805,
+0x10a20805,
+0x10a30805,
+0x10a40805,
+0x10a50805,
+0x10a60805,
+0x10a70805,
+0x10a80805,
+0x10a90805,
+0x10aa0805,
+0x10ab0805,
+0x10ac0805,
+0x10ad0805,
+0x10ae0805,
+0x10af0805,
+0x10b00805,
+0x10b10805,
+0x10b20805,
+0x10b30805,
+0x10b40805,
+0x10b50805,
+0x10b60805,
+0x10b70805,
+0x10b80805,
+0x10b90805,
+0x10ba0805,
+0x10bb0805,
+0x10bc0805,
+0x10bd0805,
+0x10be0805,
+0x10bf0805,
+0x10c00805,
+0x10c10805,
+0x10c20805,
+0x10c30805,
+0x2320805,
+0x28c0805,
+0x2330805,
+0x28d0805,
+0x2770805,
+0x3a50805,
+0x3e30805,
+0x2e00805,
+0x28e0805,
+0x2660805,
+0x2340805,
+0x23e0805,
+0x2780805,
+0x5040805,
+0x5050805,
+0x5060805,
+0x5070805,
+0x5080805,
+0x5090805,
+0x50a0805,
+0x50b0805,
+0x50c0805,
+0x50d0805,
+0x50e0805,
+0x50f0805,
+0x5100805,
+0x5110805,
+0x5120805,
+0x5130805,
+0x5140805,
+0x5150805,
+0x5160805,
+0x5170805,
+0x5180805,
+0x5190805,
+0x51a0805,
+0x51b0805,
+0x51c0805,
+0x51d0805,
+0x51e0805,
+0x51f0805,
+0x5200805,
+0x5210805,
+0x5220805,
+0x5230805,
+0x5240805,
+0x5250805,
+0x5260805,
+0x5270805,
+0x5280805,
+0x56c0805,
+0x56d0805,
+0x56e0805,
+0x56f0805,
+0x1d620805,
+0x1d630805,
+0x1d640805,
+0x1d650805,
+0x1d660805,
+0x1d670805,
+0x5700805,
+0x5710805,
+0x5720805,
+0x4540805,
+0x4550805,
+0x29c0805,
+0x29d0805,
+0x2980805,
+0x2990805,
+0x4010805,
+0x4020805,
+0x4030805,
+0x4040805,
+0x45a0805,
+0x2a00805,
+0x2e10805,
+0x2d60805,
+0x2d70805,
+0x2d80805,
+0x2d90805,
+0x2da0805,
+0x2db0805,
+0x2620805,
+0x2ab0805,
+0x2ac0805,
+0x2dc0805,
+0x2dd0805,
+0x2de0805,
+0x2df0805,
+0x45b0805,
+0x45c0805,
+0x45d0805,
+0x2ad0805,
+0x2ae0805,
+0x2af0805,
+0x59b0805,
+0x59c0805,
+0x59d0805,
+0x40e0805,
+0x40f0805,
+0x2b00805,
+0x2790805,
+0x5290805,
+0x2b10805,
+0x666080b,
+0x5360805,
+0x5370805,
+0x5380805,
+0x5390805,
+0x53a0805,
+0x53b0805,
+0x53c0805,
+0x53d0805,
+0x53e0805,
+0x53f0805,
+0x5400805,
+0x5410805,
+0x5420805,
+0x5430805,
+0x5440805,
+0x5450805,
+0x3920805,
+0x3930805,
+0x5350805,
+0x223082d,
+0x236082d,
+0x292082d,
+0x240082d,
+0x23a082d,
+0x267082d,
+0x26d082d,
+0x38c082d,
+0x38d082d,
+0x27e082d,
+0x27e082d,
+0x27e082d,
+0x27e082d,
+0x27e082d,
+0x216082d,
+0x215082d,
+0x20b082d,
+0x328082d,
+0x329082d,
+0x32c082d,
+0x32d082d,
+0x38a082d,
+0x38b082d,
+0x388082d,
+0x389082d,
+0x382082d,
+0x383082d,
+0x380082d,
+0x381082d,
+0x384082d,
+0x385082d,
+0x386082d,
+0x387082d,
+0x2370805,
+0x2380805,
+0x32a082d,
+0x32b082d,
+0x20a0809,
+0x20b0809,
+0x223081f,
+0x236081f,
+0x27e081f,
+0x23a081f,
+0x240081f,
+0x26d081f,
+0x267081f,
+0x216081f,
+0x328081f,
+0x329081f,
+0x32c081f,
+0x32d081f,
+0x38a081f,
+0x38b081f,
+0x3ac081f,
+0x3a9081f,
+0x3a1081f,
+0x666081f,
+0x20d081f,
+0x66a081f,
+0x66c081f,
+0x66b081f,
+0x3a7081f,
+0x3ad081f,
+0x3a0081f,
+0x2670807,
+0x31d0807,
+0x3ac0807,
+0x3ad0807,
+0x3a90807,
+0x3160807,
+0x3280807,
+0x3290807,
+0x3a10807,
+0x6660807,
+0x2230807,
+0x20d0807,
+0x27e0807,
+0x3a60807,
+0x2400807,
+0x23a0807,
+0x66a0807,
+0x66b0807,
+0x66c0807,
+0x26d0807,
+0x3a00807,
+0x32a0807,
+0x3a70807,
+0x32b0807,
+0x4b70807,
+0x20b0807,
+0x4b40807,
+0x32c0807,
+0x66e0807,
+0x32d0807,
+0x6700807,
+0x33e0807,
+0x33f0807,
+0x2920825,
+0x3840825,
+0x3850825,
+0x2360825,
+0x2210825,
+0x66d0807,
+0x4b80807,
+0x66f0807,
+0x86b0825,
+0x5ec0825,
+0x5ee0825,
+0x5ed0825,
+0x5ef0825,
+0x9090825,
+0x9340825,
+0x1d550805,
+0x30b0805,
+0x30c0805,
+0x30d0805,
+0x1dbe0805,
+0x1dbf0805,
+0x1dc00805,
+0x1dc10805,
+0x1dc20805,
+0x1dc30805,
+0x1dc40805,
+0x1dc50805,
+0x1dc60805,
+0x1dc70805,
+0x1dc80805,
+0x1dc90805,
+0x1dca0805,
+0x1dcb0805,
+0x1dcc0805,
+0x1dcd0805,
+0x1dce0805,
+0x1dcf0805,
+0x1dd00805,
+0x1dd10805,
+0x1dd20805,
+0x1dd30805,
+0x1dd40805,
+0x1dd50805,
+0x1dd60805,
+0x1dd70805,
+0x1dd80805,
+0x1dd90805,
+0x1dda0805,
+0x1ddb0805,
+0x1ddc0805,
+0x1ddd0805,
+0x1dde0805,
+0x1ddf0805,
+0x1de00805,
+0x1de10805,
+0x10c40805,
+0x10c50805,
+0x10c60805,
+0x10c70805,
+0x10c80805,
+0x10c90805,
+0x10ca0805,
+0x10cb0805,
+0x10cc0805,
+0x1de20805,
+0x1de30805,
+0x1de40805,
+0x1de50805,
+0x1de60805,
+0x1de70805,
+0x1de80805,
+0x1de90805,
+0x1dea0805,
+0x1deb0805,
+0x1dec0805,
+0x1ded0805,
+0x1dee0805,
+0x1def0805,
+0x1df00805,
+0x1df10805,
+0x1df20805,
+0x1df30805,
+0x1df40805,
+0x1df50805,
+0x1df60805,
+0x1df70805,
+0x1df80805,
+0x1df90805,
+0x1dfa0805,
+0x1dfb0805,
+0x1dfc0805,
+0x1dfd0805,
+0x1dfe0805,
+0x1dff0805,
+0x1e000805,
+0x1e010805,
+0x1e020805,
+0x1e030805,
+0x1e040805,
+0x1e050805,
+0x1e060805,
+0x1e070805,
+0x1e080805,
+0x1e090805,
+0x1e0a0805,
+0x1e0b0805,
+0x1e0c0805,
+0x1e0d0805,
+0x10cd0805,
+0x10ce0805,
+0x10cf0805,
+0x10d00805,
+0x10d10805,
+0x10d20805,
+0x10d30805,
+0x10d40805,
+0x10d50805,
+0x10d60805,
+0x10d70805,
+0x10d80805,
+0x10d90805,
+0x10da0805,
+0x10db0805,
+0x10dc0805,
+0x10dd0805,
+0x1e0e0805,
+0x10de0805,
+0x10e10805,
+0x10e20805,
+0x10e30805,
+0x10e40805,
+0x10e50805,
+0x10e60805,
+0x10e70805,
+0x10e80805,
+0x10e90805,
+0x10ea0805,
+0x10eb0805,
+0x10ec0805,
+0x10ee0805,
+0x10ef0805,
+0x10f00805,
+0x10f10805,
+0x10f20805,
+0x10f30805,
+0x10f40805,
+0x10f50805,
+0x10f60805,
+0x10f70805,
+0x10f80805,
+0x10f90805,
+0x10fa0805,
+0x10fb0805,
+0x10fc0805,
+0x10fd0805,
+0x10fe0805,
+0x10ff0805,
+0x11000805,
+0x11010805,
+0x11020805,
+0x11030805,
+0x11040805,
+0x11050805,
+0x11060805,
+0x11070805,
+0x11080805,
+0x11090805,
+0x110a0805,
+0x110b0805,
+0x110c0805,
+0x110d0805,
+0x110e0805,
+0x110f0805,
+0x11100805,
+0x11110805,
+0x11120805,
+0x11130805,
+0x11140805,
+0x11150805,
+0x11160805,
+0x11170805,
+0x11180805,
+0x11190805,
+0x111a0805,
+0x111b0805,
+0x1e0f0805,
+0x1e100805,
+0x1e110805,
+0x1e120805,
+0x1e130805,
+0x1e140805,
+0x1e150805,
+0x1e160805,
+0x1e170805,
+0x1e180805,
+0x1e190805,
+0x1e1a0805,
+0x1e1b0805,
+0x1e1c0805,
+0x1e1d0805,
+0x1e1e0805,
+0x1e1f0805,
+0x1e200805,
+0x1db80805,
+0x1db90805,
+0x30e0805,
+0x30f0805,
+0x1e210805,
+0x1e220805,
+0x1e230805,
+0x45e0805,
+0x2e20805,
+0x1e330805,
+0x1e340805,
+0x1e350805,
+0x1e360805,
+0x1e370805,
+0x111c0805,
+0x111d0805,
+0x1e240805,
+0x1e250805,
+0x1e260805,
+0x1e270805,
+0x1e280805,
+0x1e290805,
+0x1e2a0805,
+0x1e2b0805,
+0x1e300805,
+0x1e310805,
+0x1e320805,
+0x3100805,
+0x30a0805,
+0x1f2b0805,
+0x1f200805,
+0x1ef50805,
+0x1ef60805,
+0x1ef70805,
+0x1ef80805,
+0x1ef90805,
+0x1efa0805,
+0x1efb0805,
+0x1efc0805,
+0x1efd0805,
+0x1efe0805,
+0x1eff0805,
+0x1f000805,
+0x1f010805,
+0x1f020805,
+0x1f030805,
+0x1f040805,
+0x1f050805,
+0x1f060805,
+0x1f070805,
+0x1f080805,
+0x1f090805,
+0x1f0a0805,
+0x1f0b0805,
+0x1f0c0805,
+0x1f0d0805,
+0x1f0e0805,
+0x1f0f0805,
+0x1f100805,
+0x1f110805,
+0x1f120805,
+0x1f130805,
+0x1f140805,
+0x1f150805,
+0x1f160805,
+0x1f170805,
+0x1f180805,
+0x1f190805,
+0x1f1a0805,
+0x1f1b0805,
+0x1f1c0805,
+0x1f1d0805,
+0x1f1e0805,
+0x1f1f0805,
+0x1f210805,
+0x1f220805,
+0x1f230805,
+0x1f240805,
+0x1f250805,
+0x1f260805,
+0x1f270805,
+0x1f280805,
+0x1f290805,
+0x1f2a0805,
+0x1e5e0805,
+0x1e5f0805,
+0x1e600805,
+0x1e610805,
+0x4640805,
+0x4650805,
+0x4660805,
+0x4670805,
+0x4680805,
+0x4690805,
+0x2b20805,
+0x2b30805,
+0x46a0805,
+0x1e2c0805,
+0x1e2d0805,
+0x1e2e0805,
+0x1e2f0805,
+0x1e380805,
+0x1e390805,
+0x1e3a0805,
+0x46f0805,
+0x4700805,
+0x4710805,
+0x4720805,
+0x4730805,
+0x4740805,
+0x4750805,
+0x46e0805,
+0x2e30805,
+0x2e40805,
+0x2e50805,
+0x2e60805,
+0x2e70805,
+0x2e80805,
+0x1e3b0805,
+0x1e3c0805,
+0x1e3d0805,
+0x1e3e0805,
+0x1e3f0805,
+0x1e400805,
+0x1e410805,
+0x1e420805,
+0x4760805,
+0x4770805,
+0x4780805,
+0x4790805,
+0x1e430805,
+0x1e440805,
+0x1e450805,
+0x1dba0805,
+0x1dbb0805,
+0x1dbc0805,
+0x1dbd0805,
+0x1da10805,
+0x1da20805,
+0x1da30805,
+0x1da40805,
+0x1da50805,
+0x1da60805,
+0x1da70805,
+0x1da80805,
+0x1da90805,
+0x1daa0805,
+0x1dab0805,
+0x1dac0805,
+0x1dad0805,
+0x1dae0805,
+0x1daf0805,
+0x1db00805,
+0x1db10805,
+0x1db20805,
+0x1db30805,
+0x1db40805,
+0x1db50805,
+0x1db60805,
+0x2b40805,
+0x2b50805,
+0x45f0805,
+0x4600805,
+0x4610805,
+0x4620805,
+0x4630805,
+0x1e530805,
+0x1e540805,
+0x1e550805,
+0x1e560805,
+0x1e570805,
+0x1e580805,
+0x1e590805,
+0x1e5a0805,
+0x1e5b0805,
+0x1e5c0805,
+0x1e5d0805,
+0x47a0805,
+0x47b0805,
+0x2ee0805,
+0x2ef0805,
+0x2b60805,
+0x2b70805,
+0x2f00805,
+0x2b80805,
+0x2b90805,
+0x27a0805,
+0x47c0805,
+0x47d0805,
+0x2ba0805,
+0x2bb0805,
+0x47f0805,
+0x2f10805,
+0x47e0805,
+0x4800805,
+0x4810805,
+0x2f20805,
+0x2f30805,
+0x1e6d0805,
+0x1e6e0805,
+0x1e6f0805,
+0x1e700805,
+0x1e710805,
+0x1e720805,
+0x1e730805,
+0x1e740805,
+0x1e750805,
+0x1e760805,
+0x1e770805,
+0x2bc0805,
+0x2bd0805,
+0x4820805,
+0x4830805,
+0x4840805,
+0x4850805,
+0x2f40805,
+0x48c0805,
+0x48d0805,
+0x2c00805,
+0x2c10805,
+0x48e0805,
+0x48f0805,
+0x4900805,
+0x4910805,
+0x4920805,
+0x4930805,
+0x4940805,
+0x4950805,
+0x4960805,
+0x4970805,
+0x4980805,
+0x4990805,
+0x49a0805,
+0x49b0805,
+0x49c0805,
+0x49d0805,
+0x49e0805,
+0x49f0805,
+0x4a00805,
+0x4a10805,
+0x2c20805,
+0x2c30805,
+0x4a20805,
+0x1e510805,
+0x1e520805,
+0x2c40805,
+0x2c50805,
+0x2f50805,
+0x59e0805,
+0x1e780805,
+0x1e790805,
+0x1e7a0805,
+0x1e7b0805,
+0x1e7c0805,
+0x1e7d0805,
+0x1e7e0805,
+0x1e7f0805,
+0x1e800805,
+0x1f2c0805,
+0x1f2d0805,
+0x1f2e0805,
+0x1f2f0805,
+0x1f300805,
+0x1f310805,
+0x1f320805,
+0x1f330805,
+0x1f340805,
+0x1f350805,
+0x1f360805,
+0x1f370805,
+0x1f380805,
+0x1f390805,
+0x1f3a0805,
+0x1f3b0805,
+0x1f3c0805,
+0x3110805,
+0x3120805,
+0x3130805,
+0x3140805,
+0x3150805,
+0x2c90805,
+0x2ca0805,
+0x28f0805,
+0x4a70805,
+0x4a80805,
+0x4a90805,
+0x4aa0805,
+0x4ab0805,
+0x111e0805,
+0x111f0805,
+0x11200805,
+0x11210805,
+0x4ac0805,
+0x11220805,
+0x1e810805,
+0x1e820805,
+0x1e830805,
+0x1e840805,
+0x1e850805,
+0x1e860805,
+0x1e870805,
+0x13140805,
+0x2910805,
+0x11240805,
+0x11250805,
+0x11260805,
+0x11270805,
+0x11280805,
+0x11290805,
+0x112a0805,
+0x112b0805,
+0x112c0805,
+0x112d0805,
+0x112e0805,
+0x112f0805,
+0x11300805,
+0x11310805,
+0x11320805,
+0x11330805,
+0x11340805,
+0x11350805,
+0x11360805,
+0x11370805,
+0x11380805,
+0x11390805,
+0x113a0805,
+0x113b0805,
+0x113c0805,
+0x113d0805,
+0x113e0805,
+0x113f0805,
+0x11400805,
+0x11410805,
+0x11420805,
+0x11430805,
+0x11440805,
+0x11450805,
+0x11460805,
+0x11470805,
+0x11480805,
+0x11490805,
+0x114a0805,
+0x114b0805,
+0x114c0805,
+0x114d0805,
+0x114e0805,
+0x114f0805,
+0x11500805,
+0x11510805,
+0x11520805,
+0x11530805,
+0x11540805,
+0x11550805,
+0x11560805,
+0x11570805,
+0x11580805,
+0x11590805,
+0x115a0805,
+0x115b0805,
+0x115c0805,
+0x115d0805,
+0x115e0805,
+0x115f0805,
+0x11600805,
+0x11610805,
+0x11620805,
+0x11630805,
+0x11640805,
+0x11650805,
+0x11660805,
+0x11670805,
+0x11680805,
+0x11690805,
+0x116a0805,
+0x116b0805,
+0x116c0805,
+0x116d0805,
+0x116e0805,
+0x116f0805,
+0x11700805,
+0x11710805,
+0x11720805,
+0x11730805,
+0x11740805,
+0x11750805,
+0x11760805,
+0x11770805,
+0x11780805,
+0x11790805,
+0x117a0805,
+0x117b0805,
+0x117c0805,
+0x117d0805,
+0x117e0805,
+0x117f0805,
+0x11800805,
+0x11810805,
+0x11820805,
+0x11830805,
+0x11840805,
+0x11850805,
+0x11860805,
+0x11870805,
+0x11880805,
+0x11890805,
+0x118a0805,
+0x118b0805,
+0x118c0805,
+0x118d0805,
+0x118e0805,
+0x118f0805,
+0x11900805,
+0x11910805,
+0x11920805,
+0x11930805,
+0x11940805,
+0x11950805,
+0x11960805,
+0x11970805,
+0x11980805,
+0x11990805,
+0x119a0805,
+0x119b0805,
+0x119c0805,
+0x119d0805,
+0x119e0805,
+0x119f0805,
+0x11a00805,
+0x11a10805,
+0x11a20805,
+0x11a30805,
+0x11a40805,
+0x11a50805,
+0x11a60805,
+0x11a70805,
+0x11a80805,
+0x11a90805,
+0x11aa0805,
+0x11ab0805,
+0x11ac0805,
+0x11ad0805,
+0x11ae0805,
+0x11af0805,
+0x11b00805,
+0x11b10805,
+0x11b20805,
+0x11b30805,
+0x11b40805,
+0x11b50805,
+0x11b60805,
+0x11b70805,
+0x11b80805,
+0x11b90805,
+0x11ba0805,
+0x11bb0805,
+0x11bc0805,
+0x11bd0805,
+0x11be0805,
+0x11bf0805,
+0x11c00805,
+0x11c10805,
+0x11c20805,
+0x11c30805,
+0x11c40805,
+0x11c50805,
+0x11c60805,
+0x11c70805,
+0x11c80805,
+0x11c90805,
+0x11ca0805,
+0x11cb0805,
+0x11cc0805,
+0x11cd0805,
+0x11ce0805,
+0x11cf0805,
+0x11d00805,
+0x11d10805,
+0x11d20805,
+0x11d30805,
+0x11d40805,
+0x11d50805,
+0x11d60805,
+0x11d70805,
+0x11d80805,
+0x11d90805,
+0x11da0805,
+0x11db0805,
+0x11dc0805,
+0x11dd0805,
+0x11de0805,
+0x11df0805,
+0x11e00805,
+0x11e10805,
+0x11e20805,
+0x11e30805,
+0x11e40805,
+0x11e50805,
+0x11e60805,
+0x11e70805,
+0x11e80805,
+0x11e90805,
+0x11ea0805,
+0x11eb0805,
+0x11ec0805,
+0x11ed0805,
+0x11ee0805,
+0x11ef0805,
+0x11f00805,
+0x11f10805,
+0x11f20805,
+0x11f30805,
+0x11f40805,
+0x11f50805,
+0x11f60805,
+0x11f70805,
+0x11f80805,
+0x11f90805,
+0x11fa0805,
+0x11fb0805,
+0x11fc0805,
+0x11fd0805,
+0x11fe0805,
+0x11ff0805,
+0x12000805,
+0x12010805,
+0x12020805,
+0x12030805,
+0x12040805,
+0x12050805,
+0x12060805,
+0x12070805,
+0x12080805,
+0x12090805,
+0x120a0805,
+0x120b0805,
+0x120c0805,
+0x120d0805,
+0x120e0805,
+0x120f0805,
+0x12100805,
+0x12110805,
+0x12120805,
+0x12130805,
+0x12140805,
+0x12150805,
+0x12160805,
+0x12170805,
+0x12180805,
+0x12190805,
+0x121a0805,
+0x121b0805,
+0x121c0805,
+0x121d0805,
+0x121e0805,
+0x121f0805,
+0x12200805,
+0x12210805,
+0x12220805,
+0x12230805,
+0x12240805,
+0x12250805,
+0x12260805,
+0x12270805,
+0x12280805,
+0x12290805,
+0x122a0805,
+0x122b0805,
+0x122c0805,
+0x122d0805,
+0x122e0805,
+0x122f0805,
+0x12300805,
+0x12310805,
+0x12320805,
+0x12330805,
+0x12340805,
+0x12350805,
+0x12360805,
+0x12370805,
+0x12380805,
+0x12390805,
+0x123a0805,
+0x123b0805,
+0x123c0805,
+0x123d0805,
+0x123e0805,
+0x123f0805,
+0x12400805,
+0x12540805,
+0x12440805,
+0x12450805,
+0x12460805,
+0x12470805,
+0x12480805,
+0x12490805,
+0x124a0805,
+0x124b0805,
+0x124c0805,
+0x124d0805,
+0x124e0805,
+0x124f0805,
+0x12500805,
+0x12510805,
+0x12520805,
+0x12530805,
+0x12550805,
+0x12560805,
+0x12570805,
+0x12580805,
+0x12590805,
+0x125a0805,
+0x125b0805,
+0x125c0805,
+0x125d0805,
+0x125e0805,
+0x125f0805,
+0x12600805,
+0x12610805,
+0x12620805,
+0x12630805,
+0x12640805,
+0x12650805,
+0x12660805,
+0x12670805,
+0x12680805,
+0x12690805,
+0x126a0805,
+0x126b0805,
+0x126c0805,
+0x126d0805,
+0x126e0805,
+0x126f0805,
+0x12700805,
+0x12710805,
+0x12720805,
+0x12730805,
+0x12740805,
+0x12750805,
+0x12760805,
+0x12770805,
+0x12780805,
+0x12720805,
+0x0,
+0x12730805,
+0x0,
+0x12730805,
+0x0,
+0x0,
+0x12790805,
+0x127a0805,
+0x127b0805,
+0x127c0805,
+0x127d0805,
+0x127e0805,
+0x127f0805,
+0x12800805,
+0x12810805,
+0x12820805,
+0x12830805,
+0x12840805,
+0x12850805,
+0x12860805,
+0x12870805,
+0x12880805,
+0x12890805,
+0x128a0805,
+0x128b0805,
+0x128c0805,
+0x128d0805,
+0x128e0805,
+0x128f0805,
+0x12900805,
+0x12910805,
+0x12920805,
+0x12930805,
+0x12940805,
+0x12950805,
+0x12960805,
+0x12970805,
+0x12980805,
+0x12990805,
+0x129a0805,
+0x129b0805,
+0x129c0805,
+0x129d0805,
+0x129e0805,
+0x129f0805,
+0x12a00805,
+0x12a10805,
+0x12a20805,
+0x12a30805,
+0x12a40805,
+0x12a50805,
+0x12a60805,
+0x12a70805,
+0x12a80805,
+0x12a70805,
+0x0,
+0x12a80805,
+0x0,
+0x12a70805,
+0x0,
+0x0,
+0x12a80805,
+0x0,
+0x0,
+0x12a90805,
+0x12aa0805,
+0x12ab0805,
+0x12ac0805,
+0x12ad0805,
+0x12ae0805,
+0x12af0805,
+0x12b00805,
+0x12b10805,
+0x12b20805,
+0x12b30805,
+0x12b40805,
+0x12b50805,
+0x12b60805,
+0x12b70805,
+0x12b80805,
+0x12b90805,
+0x12ba0805,
+0x12bb0805,
+0x12bc0805,
+0x12bd0805,
+0x12be0805,
+0x12bf0805,
+0x12c00805,
+0x12c10805,
+0x12c20805,
+0x12c30805,
+0x12c40805,
+0x12c50805,
+0x12c60805,
+0x12c70805,
+0x12c80805,
+0x12c90805,
+0x12ca0805,
+0x12cb0805,
+0x12cc0805,
+0x12cd0805,
+0x12ce0805,
+0x12cf0805,
+0x12d00805,
+0x12d10805,
+0x12d20805,
+0x12d30805,
+0x12d40805,
+0x12d50805,
+0x12d60805,
+0x12d70805,
+0x12d80805,
+0x12d90805,
+0x12da0805,
+0x12db0805,
+0x12dc0805,
+0x12dd0805,
+0x12de0805,
+0x12df0805,
+0x12e00805,
+0x12e10805,
+0x12e20805,
+0x12e30805,
+0x12e40805,
+0x12e50805,
+0x12e60805,
+0x12e70805,
+0x12e80805,
+0x12e90805,
+0x12ea0805,
+0x12eb0805,
+0x12ec0805,
+0x12ed0805,
+0x12ee0805,
+0x12ef0805,
+0x12f00805,
+0x12f10805,
+0x12f20805,
+0x12f30805,
+0x12f40805,
+0x12f50805,
+0x12f60805,
+0x12f70805,
+0x12f80805,
+0x12f90805,
+0x12fa0805,
+0x12fb0805,
+0x12fc0805,
+0x12fd0805,
+0x12fe0805,
+0x12ff0805,
+0x13000805,
+0x13010805,
+0x13020805,
+0x13030805,
+0x13040805,
+0x13050805,
+0x13060805,
+0x13070805,
+0x13080805,
+0x13090805,
+0x130a0805,
+0x130b0805,
+0x130c0805,
+0x130d0805,
+0x130e0805,
+0x130f0805,
+0x13100805,
+0x13110805,
+0x13120805,
+0x13130805,
+0x10360805,
+0x10370805,
+0x10380805,
+0x10390805,
+0x103a0805,
+0x103b0805,
+0x103c0805,
+0x103d0805,
+0x103e0805,
+0x103f0805,
+0x10400805,
+0x10410805,
+0x10420805,
+0x10430805,
+0x10440805,
+0x10450805,
+0x10460805,
+0x10470805,
+0x10480805,
+0x10490805,
+0x104a0805,
+0x104b0805,
+0x104c0805,
+0x104d0805,
+0x104e0805,
+0x104f0805,
+0x10500805,
+0x10510805,
+0x10520805,
+0x10530805,
+0x10540805,
+0x10550805,
+0x10560805,
+0x10570805,
+0x10580805,
+0x10590805,
+0x105a0805,
+0x105b0805,
+0x105c0805,
+0x105d0805,
+0x105e0805,
+0x105f0805,
+0x10600805,
+0x10610805,
+0x10620805,
+0x10630805,
+0x10640805,
+0x10650805,
+0x10660805,
+0x10670805,
+0x10680805,
+0x10690805,
+0x106a0805,
+0x106b0805,
+0x106c0805,
+0x106d0805,
+0x106e0805,
+0x106f0805,
+0x10700805,
+0x10710805,
+0x10720805,
+0x10730805,
+0x10740805,
+0x10750805,
+0x10760805,
+0x10770805,
+0x10780805,
+0x10790805,
+0x107a0805,
+0x107b0805,
+0x107c0805,
+0x107d0805,
+0x107e0805,
+0x107f0805,
+0x10800805,
+0x10810805,
+0x10820805,
+0x10830805,
+0x10840805,
+0x10850805,
+0x10860805,
+0x10870805,
+0x10880805,
+0x10890805,
+0x108a0805,
+0x108b0805,
+0x108c0805,
+0x1f3d0805,
+0x1f3e0805,
+0x1f3f0805,
+0x1f400805,
+0x1f410805,
+0x1f420805,
+0x1f430805,
+0x1f440805,
+0x1f450805,
+0x65c080b,
+0x658080b,
+0x1aff0805,
+0x1b000805,
+0x1b010805,
+0x1b020805,
+0x1b030805,
+0x1b040805,
+0x1b050805,
+0x1b060805,
+0x1b070805,
+0x1b080805,
+0x1b090805,
+0x1b0a0805,
+0x1b0b0805,
+0x1b0c0805,
+0x1b0d0805,
+0x1b0e0805,
+0x1b0f0805,
+0x1b100805,
+0x1b110805,
+0x1b120805,
+0x1b130805,
+0x1b140805,
+0x1b150805,
+0x1b160805,
+0x1b170805,
+0x1b180805,
+0x1b190805,
+0x1b1a0805,
+0x1b1b0805,
+0x1b1c0805,
+0x1b1d0805,
+0x1b1e0805,
+0x1b1f0805,
+0x1b200805,
+0x1b210805,
+0x1b220805,
+0x1b230805,
+0x1b240805,
+0x1b250805,
+0x1b260805,
+0x1b270805,
+0x1b280805,
+0x1b290805,
+0x1b2a0805,
+0x1b2b0805,
+0x1b2c0805,
+0x1b2d0805,
+0x1b2e0805,
+0x1b2f0805,
+0x1b300805,
+0x1b310805,
+0x1b320805,
+0x1b330805,
+0x1b340805,
+0x1b350805,
+0x1b360805,
+0x1b370805,
+0x1b380805,
+0x1b390805,
+0x1b3a0805,
+0x1b3b0805,
+0x1b3c0805,
+0x1b3d0805,
+0x1b3e0805,
+0x1b3f0805,
+0x1b400805,
+0x1b410805,
+0x1b420805,
+0x1b430805,
+0x1b440805,
+0x1b450805,
+0x1b460805,
+0x1b470805,
+0x1b480805,
+0x1b490805,
+0x1b4a0805,
+0x1b4b0805,
+0x1b4c0805,
+0x1b4d0805,
+0x1b4e0805,
+0x1b4f0805,
+0x1b500805,
+0x1b510805,
+0x1b520805,
+0x1b530805,
+0x1b540805,
+0x1b550805,
+0x1b560805,
+0x1b570805,
+0x1b580805,
+0x1b590805,
+0x1b5a0805,
+0x1b5b0805,
+0x1b5c0805,
+0x1b5d0805,
+0x1b5e0805,
+0x1b5f0805,
+0x1b600805,
+0x1b610805,
+0x1b620805,
+0x1b630805,
+0x1b640805,
+0x1b650805,
+0x1b660805,
+0x1b670805,
+0x1b680805,
+0x1b690805,
+0x1b6a0805,
+0x1b6b0805,
+0x1b6c0805,
+0x1b6d0805,
+0x1b6e0805,
+0x1b6f0805,
+0x1b700805,
+0x1b710805,
+0x1b720805,
+0x1b730805,
+0x1b740805,
+0x1b750805,
+0x1b760805,
+0x1b770805,
+0x1b780805,
+0x1b790805,
+0x1b7a0805,
+0x1b7b0805,
+0x1b7c0805,
+0x1b7d0805,
+0x1b7e0805,
+0x1b7f0805,
+0x1b800805,
+0x1b810805,
+0x1b820805,
+0x1b830805,
+0x1b840805,
+0x1b850805,
+0x1b860805,
+0x1b870805,
+0x1b880805,
+0x1b890805,
+0x1b8a0805,
+0x1b8b0805,
+0x1b8c0805,
+0x1b8d0805,
+0x1b8e0805,
+0x1b8f0805,
+0x1b900805,
+0x1b910805,
+0x1b920805,
+0x1b930805,
+0x1b940805,
+0x1b950805,
+0x1b960805,
+0x1b970805,
+0x1b980805,
+0x1b990805,
+0x1b9a0805,
+0x1b9b0805,
+0x1b9c0805,
+0x1b9d0805,
+0x1b9e0805,
+0x1b9f0805,
+0x1ba00805,
+0x1ba10805,
+0x1ba20805,
+0x1ba30805,
+0x1ba40805,
+0x1ba50805,
+0x1ba60805,
+0x1ba70805,
+0x1ba80805,
+0x1ba90805,
+0x1baa0805,
+0x1bab0805,
+0x1bac0805,
+0x1bad0805,
+0x1bae0805,
+0x1baf0805,
+0x1bb00805,
+0x1bb10805,
+0x1bb20805,
+0x1bb30805,
+0x1bb40805,
+0x1bb50805,
+0x1bb60805,
+0x1bb70805,
+0x1bb80805,
+0x1bb90805,
+0x1bba0805,
+0x1bbb0805,
+0x1bbc0805,
+0x1bbd0805,
+0x1bbe0805,
+0x1bbf0805,
+0x1bc00805,
+0x1bc10805,
+0x1bc20805,
+0x1bc30805,
+0x1bc40805,
+0x1bc50805,
+0x1bc60805,
+0x1bc70805,
+0x1bc80805,
+0x1bc90805,
+0x1bca0805,
+0x1bcb0805,
+0x1bcc0805,
+0x1bcd0805,
+0x1bce0805,
+0x1bcf0805,
+0x1bd00805,
+0x1bd10805,
+0x1bd20805,
+0x1bd30805,
+0x1bd40805,
+0x1bd50805,
+0x1bd60805,
+0x1bd70805,
+0x1bd80805,
+0x1bd90805,
+0x1bda0805,
+0x1bdb0805,
+0x1bdc0805,
+0x1bdd0805,
+0x1bde0805,
+0x1bdf0805,
+0x1be00805,
+0x1be10805,
+0x1be20805,
+0x1be30805,
+0x1be40805,
+0x1be50805,
+0x1be60805,
+0x1be70805,
+0x1be80805,
+0x1be90805,
+0x1bea0805,
+0x1beb0805,
+0x1bec0805,
+0x1bed0805,
+0x1bee0805,
+0x1bef0805,
+0x1bf00805,
+0x1bf10805,
+0x1bf20805,
+0x1bf30805,
+0x1bf40805,
+0x1bf50805,
+0x1bf60805,
+0x1bf70805,
+0x1bf80805,
+0x1bf90805,
+0x1bfa0805,
+0x1bfb0805,
+0x1bfc0805,
+0x1bfd0805,
+0x1bfe0805,
+0x1bff0805,
+0x1c000805,
+0x1c010805,
+0x1c020805,
+0x1c030805,
+0x1c040805,
+0x1c050805,
+0x1c060805,
+0x1c070805,
+0x1c080805,
+0x1c090805,
+0x1c0a0805,
+0x1c0b0805,
+0x1c0c0805,
+0x1c0d0805,
+0x1c0e0805,
+0x1c0f0805,
+0x1c100805,
+0x1c110805,
+0x1c120805,
+0x1c130805,
+0x1c140805,
+0x1c150805,
+0x1c160805,
+0x1c170805,
+0x1c180805,
+0x1c190805,
+0x1c1a0805,
+0x1c1b0805,
+0x1c1c0805,
+0x1c1d0805,
+0x1c1e0805,
+0x1c1f0805,
+0x1c200805,
+0x1c210805,
+0x1c220805,
+0x1c230805,
+0x1c240805,
+0x1c250805,
+0x1c260805,
+0x1c270805,
+0x1c280805,
+0x1c290805,
+0x1c2a0805,
+0x1c2b0805,
+0x1c2c0805,
+0x1c2d0805,
+0x1c2e0805,
+0x1c2f0805,
+0x1c300805,
+0x1c310805,
+0x1c320805,
+0x1c330805,
+0x1c340805,
+0x1c350805,
+0x1c360805,
+0x1c370805,
+0x1c380805,
+0x1c390805,
+0x1c3a0805,
+0x1c3b0805,
+0x1c3c0805,
+0x1c3d0805,
+0x1c3e0805,
+0x1c3f0805,
+0x1c400805,
+0x1c410805,
+0x1c420805,
+0x1c430805,
+0x1c440805,
+0x1c450805,
+0x1c460805,
+0x1c470805,
+0x1c480805,
+0x1c490805,
+0x1c4a0805,
+0x1c4b0805,
+0x1c4c0805,
+0x1c4d0805,
+0x1c4e0805,
+0x1c4f0805,
+0x1c500805,
+0x1c510805,
+0x1c520805,
+0x1c530805,
+0x1c540805,
+0x1c550805,
+0x1c560805,
+0x1c570805,
+0x1c580805,
+0x1c590805,
+0x1c5a0805,
+0x1c5b0805,
+0x1c5c0805,
+0x1c5d0805,
+0x1c5e0805,
+0x1c5f0805,
+0x1c600805,
+0x1c610805,
+0x1c620805,
+0x1c630805,
+0x1c640805,
+0x1c650805,
+0x1c660805,
+0x1c670805,
+0x1c680805,
+0x1c690805,
+0x1c6a0805,
+0x1c6b0805,
+0x1c6c0805,
+0x1c6d0805,
+0x1c6e0805,
+0x1c6f0805,
+0x1c700805,
+0x1c710805,
+0x1c720805,
+0x1c730805,
+0x1c740805,
+0x1c750805,
+0x1c760805,
+0x1c770805,
+0x1c780805,
+0x1c790805,
+0x1c7a0805,
+0x1c7b0805,
+0x1c7c0805,
+0x1c7d0805,
+0x1c7e0805,
+0x1c7f0805,
+0x1c800805,
+0x1c810805,
+0x1c820805,
+0x1c830805,
+0x1c840805,
+0x1c850805,
+0x1c860805,
+0x1c870805,
+0x1c880805,
+0x1c890805,
+0x1c8a0805,
+0x1c8b0805,
+0x1c8c0805,
+0x1c8d0805,
+0x1c8e0805,
+0x1c8f0805,
+0x1c900805,
+0x1c910805,
+0x1c920805,
+0x1c930805,
+0x1c940805,
+0x1c950805,
+0x1c960805,
+0x1c970805,
+0x1c980805,
+0x1c990805,
+0x1c9a0805,
+0x1c9b0805,
+0x1c9c0805,
+0x1c9d0805,
+0x1c9e0805,
+0x1c9f0805,
+0x1ca00805,
+0x1ca10805,
+0x1ca20805,
+0x1ca30805,
+0x1ca40805,
+0x1ca50805,
+0x1ca60805,
+0x1ca70805,
+0x1ca80805,
+0x1ca90805,
+0x1caa0805,
+0x1cab0805,
+0x1cac0805,
+0x1cad0805,
+0x1cae0805,
+0x1caf0805,
+0x1cb00805,
+0x1cb10805,
+0x1cb20805,
+0x1cb30805,
+0x1cb40805,
+0x1cb50805,
+0x1cb60805,
+0x1cb70805,
+0x1cb80805,
+0x1cb90805,
+0x1cba0805,
+0x1cbb0805,
+0x1cbc0805,
+0x1cbd0805,
+0x1cbe0805,
+0x1cbf0805,
+0x1cc00805,
+0x1cc10805,
+0x1cc20805,
+0x1cc30805,
+0x1cc40805,
+0x1cc50805,
+0x1cc60805,
+0x1cc70805,
+0x1cc80805,
+0x1cc90805,
+0x1cca0805,
+0x1ccb0805,
+0x1ccc0805,
+0x1ccd0805,
+0x1cce0805,
+0x1ccf0805,
+0x1cd00805,
+0x1cd10805,
+0x1cd20805,
+0x1cd30805,
+0x1cd40805,
+0x1cd50805,
+0x1cd60805,
+0x1cd70805,
+0x1cd80805,
+0x1cd90805,
+0x1cda0805,
+0x1cdb0805,
+0x1cdc0805,
+0x1cdd0805,
+0x1cde0805,
+0x1cdf0805,
+0x1ce00805,
+0x1ce10805,
+0x1ce20805,
+0x1ce30805,
+0x1ce40805,
+0x1ce50805,
+0x1ce60805,
+0x1ce70805,
+0x1ce80805,
+0x1ce90805,
+0x1cea0805,
+0x1ceb0805,
+0x1cec0805,
+0x1ced0805,
+0x1cee0805,
+0x1cef0805,
+0x1cf00805,
+0x1cf10805,
+0x1cf20805,
+0x1cf30805,
+0x1cf40805,
+0x1cf50805,
+0x1cf60805,
+0x1cf70805,
+0x1cf80805,
+0x1cf90805,
+0x1cfa0805,
+0x1cfb0805,
+0x1cfc0805,
+0x1cfd0805,
+0x1cfe0805,
+0x1cff0805,
+0x1d000805,
+0x1d010805,
+0x1d020805,
+0x1d030805,
+0x1d040805,
+0x1d050805,
+0x1d060805,
+0x1d070805,
+0x1d080805,
+0x1d090805,
+0x1d0a0805,
+0x1d0b0805,
+0x1d0c0805,
+0x1d0d0805,
+0x1d0e0805,
+0x1d0f0805,
+0x1d100805,
+0x1d110805,
+0x1d120805,
+0x1d130805,
+0x1d140805,
+0x1d150805,
+0x1d160805,
+0x1d170805,
+0x1d180805,
+0x1d190805,
+0x1d1a0805,
+0x4af0805,
+0x4b00805,
+0x4b10805,
+0x4b20805,
+0x4b30805,
+0x52f0805,
+0x5300805,
+0x13170805,
+0x13180805,
+0x13190805,
+0x131a0805,
+0x131b0805,
+0x131c0805,
+0x131d0805,
+0x131e0805,
+0x131f0805,
+0x13200805,
+0x13210805,
+0x13220805,
+0x13230805,
+0x13240805,
+0x13250805,
+0x13260805,
+0x13270805,
+0x13280805,
+0x13290805,
+0x132a0805,
+0x132b0805,
+0x132c0805,
+0x132d0805,
+0x132e0805,
+0x132f0805,
+0x13300805,
+0x13310805,
+0x13320805,
+0x13330805,
+0x13340805,
+0x13350805,
+0x13360805,
+0x13370805,
+0x13380805,
+0x13390805,
+0x133a0805,
+0x133b0805,
+0x133c0805,
+0x133d0805,
+0x133e0805,
+0x133f0805,
+0x13400805,
+0x13410805,
+0x13420805,
+0x13430805,
+0x13440805,
+0x13450805,
+0x13460805,
+0x13470805,
+0x13480805,
+0x13490805,
+0x134a0805,
+0x134b0805,
+0x134c0805,
+0x134d0805,
+0x134e0805,
+0x134f0805,
+0x13500805,
+0x13510805,
+0x13520805,
+0x13530805,
+0x13540805,
+0x13550805,
+0x13560805,
+0x13570805,
+0x13580805,
+0x13590805,
+0x135a0805,
+0x135b0805,
+0x135c0805,
+0x135d0805,
+0x135e0805,
+0x135f0805,
+0x13600805,
+0x13610805,
+0x13620805,
+0x13630805,
+0x13640805,
+0x13650805,
+0x13660805,
+0x13670805,
+0x13680805,
+0x13690805,
+0x136a0805,
+0x136b0805,
+0x136c0805,
+0x136d0805,
+0x136e0805,
+0x136f0805,
+0x13700805,
+0x13710805,
+0x13720805,
+0x13730805,
+0x13740805,
+0x13750805,
+0x13760805,
+0x13770805,
+0x13780805,
+0x13790805,
+0x137a0805,
+0x137b0805,
+0x137c0805,
+0x137d0805,
+0x137e0805,
+0x137f0805,
+0x13800805,
+0x13810805,
+0x13820805,
+0x13830805,
+0x13840805,
+0x13850805,
+0x13860805,
+0x13870805,
+0x13880805,
+0x13890805,
+0x138a0805,
+0x138b0805,
+0x138c0805,
+0x138d0805,
+0x138e0805,
+0x138f0805,
+0x13900805,
+0x13910805,
+0x13920805,
+0x13930805,
+0x13940805,
+0x13950805,
+0x13960805,
+0x13970805,
+0x13980805,
+0x13990805,
+0x139a0805,
+0x139b0805,
+0x139c0805,
+0x139d0805,
+0x139e0805,
+0x139f0805,
+0x13a00805,
+0x13a10805,
+0x13a20805,
+0x13a30805,
+0x13a40805,
+0x13a50805,
+0x13a60805,
+0x13a70805,
+0x13a80805,
+0x13a90805,
+0x13aa0805,
+0x13ab0805,
+0x13ac0805,
+0x13ad0805,
+0x13ae0805,
+0x13af0805,
+0x13b00805,
+0x13b10805,
+0x13b20805,
+0x13b30805,
+0x13b40805,
+0x13b50805,
+0x13b60805,
+0x13b70805,
+0x13b80805,
+0x13b90805,
+0x13ba0805,
+0x13bb0805,
+0x13bc0805,
+0x13bd0805,
+0x13be0805,
+0x13bf0805,
+0x13c00805,
+0x13c10805,
+0x13c20805,
+0x13c30805,
+0x13c40805,
+0x13c50805,
+0x13c60805,
+0x13c70805,
+0x13c80805,
+0x13c90805,
+0x13ca0805,
+0x13cb0805,
+0x13cc0805,
+0x13cd0805,
+0x13ce0805,
+0x13cf0805,
+0x13d00805,
+0x13d10805,
+0x13d20805,
+0x13d30805,
+0x13d40805,
+0x13d50805,
+0x13d60805,
+0x13d70805,
+0x13d80805,
+0x13d90805,
+0x13da0805,
+0x13db0805,
+0x13dc0805,
+0x13dd0805,
+0x13de0805,
+0x13df0805,
+0x13e00805,
+0x13e10805,
+0x13e20805,
+0x13e30805,
+0x13e40805,
+0x13e50805,
+0x13e60805,
+0x13e70805,
+0x13e80805,
+0x13e90805,
+0x13ea0805,
+0x13eb0805,
+0x13ec0805,
+0x13ed0805,
+0x13ee0805,
+0x13ef0805,
+0x13f00805,
+0x13f10805,
+0x13f20805,
+0x13f30805,
+0x13f40805,
+0x13f50805,
+0x13f60805,
+0x13f70805,
+0x13f80805,
+0xb220805,
+0xb230805,
+0xb240805,
+0xb250805,
+0xb260805,
+0xb270805,
+0xb280805,
+0xb290805,
+0xb2a0805,
+0xb2b0805,
+0xb2c0805,
+0xb2d0805,
+0xb2e0805,
+0xb2f0805,
+0xb300805,
+0xb310805,
+0xb320805,
+0xb330805,
+0xb340805,
+0xb350805,
+0xb360805,
+0xb370805,
+0xb380805,
+0xb390805,
+0xb3a0805,
+0xb3b0805,
+0x14670805,
+0x14680805,
+0x14690805,
+0x146a0805,
+0x146b0805,
+0x146c0805,
+0x146d0805,
+0x146e0805,
+0x146f0805,
+0x14700805,
+0x14710805,
+0x14720805,
+0x14730805,
+0x14740805,
+0x14750805,
+0x14760805,
+0x14770805,
+0x14780805,
+0x14790805,
+0x147a0805,
+0x147b0805,
+0x147c0805,
+0x147d0805,
+0x147e0805,
+0x147f0805,
+0x14800805,
+0x14810805,
+0x14820805,
+0x14830805,
+0x14840805,
+0x14850805,
+0x14860805,
+0x14870805,
+0x14880805,
+0x14890805,
+0x148a0805,
+0x148b0805,
+0x148c0805,
+0x148d0805,
+0x148e0805,
+0x148f0805,
+0x14900805,
+0x14910805,
+0x14920805,
+0x14930805,
+0x14940805,
+0x14950805,
+0x14960805,
+0x14970805,
+0x14980805,
+0x14990805,
+0x149a0805,
+0x149b0805,
+0x149c0805,
+0x149d0805,
+0x149e0805,
+0x149f0805,
+0x14a00805,
+0x14a10805,
+0x14a20805,
+0x14a30805,
+0x14a40805,
+0x14a50805,
+0x14a60805,
+0x14a70805,
+0x14a80805,
+0x14a90805,
+0x14aa0805,
+0x14ab0805,
+0x14ac0805,
+0x14ad0805,
+0x14ae0805,
+0x14af0805,
+0x14b00805,
+0x14b10805,
+0x14b20805,
+0x14b30805,
+0x14b40805,
+0x14b50805,
+0x14b60805,
+0x14b70805,
+0x14b80805,
+0x14b90805,
+0x14ba0805,
+0x14bb0805,
+0x14bc0805,
+0x14bd0805,
+0x14be0805,
+0x14bf0805,
+0x14c00805,
+0x14c10805,
+0x14c20805,
+0x14c30805,
+0x14c40805,
+0x14c50805,
+0x14c60805,
+0x14c70805,
+0x14c80805,
+0x14c90805,
+0x14ca0805,
+0x14cb0805,
+0x14cc0805,
+0x14cd0805,
+0x14ce0805,
+0x14cf0805,
+0x14d00805,
+0x14d10805,
+0x14d20805,
+0x14d30805,
+0x14d40805,
+0x14d50805,
+0x14d60805,
+0x14d70805,
+0x14d80805,
+0x14d90805,
+0x14da0805,
+0x14db0805,
+0x14dc0805,
+0x14dd0805,
+0x14de0805,
+0x14df0805,
+0x14e00805,
+0x14e10805,
+0x14e20805,
+0x14e30805,
+0x14e40805,
+0x14e50805,
+0x14e60805,
+0x14e70805,
+0x14e80805,
+0x14e90805,
+0x14ea0805,
+0x14eb0805,
+0x14ec0805,
+0x14ed0805,
+0x14ee0805,
+0x14ef0805,
+0x14f00805,
+0x14f10805,
+0x14f20805,
+0x14f30805,
+0x14f40805,
+0x14f50805,
+0x14f60805,
+0x14f70805,
+0x14f80805,
+0x14f90805,
+0x14fa0805,
+0x14fb0805,
+0x14fc0805,
+0x14fd0805,
+0x14fe0805,
+0x14ff0805,
+0x15000805,
+0x15010805,
+0x15020805,
+0x15030805,
+0x15040805,
+0x15050805,
+0x15060805,
+0x15070805,
+0x15080805,
+0x15090805,
+0x150a0805,
+0x150b0805,
+0x150c0805,
+0x150d0805,
+0x150e0805,
+0x150f0805,
+0x15100805,
+0x15110805,
+0x15120805,
+0x15130805,
+0x15140805,
+0x15150805,
+0x15160805,
+0x15170805,
+0x15180805,
+0x15190805,
+0x151a0805,
+0x151b0805,
+0x151c0805,
+0x151d0805,
+0x151e0805,
+0x151f0805,
+0x15200805,
+0x15210805,
+0x15220805,
+0x15230805,
+0x15240805,
+0x15250805,
+0x15260805,
+0x15270805,
+0x15280805,
+0x15290805,
+0x152a0805,
+0x152b0805,
+0x152c0805,
+0x152d0805,
+0x152e0805,
+0x152f0805,
+0x15300805,
+0x15310805,
+0x15320805,
+0x15330805,
+0x15340805,
+0x15350805,
+0x15360805,
+0x15370805,
+0x15380805,
+0x15390805,
+0x153a0805,
+0x153b0805,
+0x153c0805,
+0x153d0805,
+0x153e0805,
+0x153f0805,
+0x15400805,
+0x15410805,
+0x15420805,
+0x15430805,
+0x15440805,
+0x15450805,
+0x15460805,
+0x15470805,
+0x15480805,
+0x15490805,
+0x154a0805,
+0x154b0805,
+0x154c0805,
+0x154d0805,
+0x154e0805,
+0x154f0805,
+0x15500805,
+0x15510805,
+0x15520805,
+0x15530805,
+0x15540805,
+0x15550805,
+0x15560805,
+0x15570805,
+0x15580805,
+0x15590805,
+0x155a0805,
+0x155b0805,
+0x155c0805,
+0x155d0805,
+0x155e0805,
+0x155f0805,
+0x15600805,
+0x15610805,
+0x15620805,
+0x15630805,
+0x15640805,
+0x15650805,
+0x15660805,
+0x15670805,
+0x15680805,
+0x15690805,
+0x156a0805,
+0x156b0805,
+0x156c0805,
+0x156d0805,
+0x156e0805,
+0x156f0805,
+0x15700805,
+0x15710805,
+0x15720805,
+0x15730805,
+0x15740805,
+0x15750805,
+0x15760805,
+0x15770805,
+0x15780805,
+0x15790805,
+0x157a0805,
+0x157b0805,
+0x157c0805,
+0x157d0805,
+0x157e0805,
+0x157f0805,
+0x15800805,
+0x15810805,
+0x15820805,
+0x15830805,
+0x15840805,
+0x15850805,
+0x15860805,
+0x15870805,
+0x15880805,
+0x15890805,
+0x158a0805,
+0x158b0805,
+0x158c0805,
+0x158d0805,
+0x158e0805,
+0x158f0805,
+0x15900805,
+0x15910805,
+0x15920805,
+0x15930805,
+0x15940805,
+0x15950805,
+0x15960805,
+0x15970805,
+0x15980805,
+0x15990805,
+0x159a0805,
+0x159b0805,
+0x159c0805,
+0x159d0805,
+0x159e0805,
+0x159f0805,
+0x15a00805,
+0x15a10805,
+0x15a20805,
+0x15a30805,
+0x15a40805,
+0x15a50805,
+0x15a60805,
+0x15a70805,
+0x15a80805,
+0x15a90805,
+0x15aa0805,
+0x15ab0805,
+0x15ac0805,
+0x15ad0805,
+0x15ae0805,
+0x15af0805,
+0x15b00805,
+0x15b10805,
+0x15b20805,
+0x15b30805,
+0x15b40805,
+0x15b50805,
+0x15b60805,
+0x15b70805,
+0x15b80805,
+0x15b90805,
+0x15ba0805,
+0x15bb0805,
+0x15bc0805,
+0x15bd0805,
+0x15be0805,
+0x15bf0805,
+0x15c00805,
+0x15c10805,
+0x15c20805,
+0x15c30805,
+0x15c40805,
+0x15c50805,
+0x15c60805,
+0x15c70805,
+0x15c80805,
+0x15c90805,
+0x15ca0805,
+0x15cb0805,
+0x15cc0805,
+0x15cd0805,
+0x15ce0805,
+0x15cf0805,
+0x15d00805,
+0x15d10805,
+0x15d20805,
+0x15d30805,
+0x15d40805,
+0x15d50805,
+0x15d60805,
+0x15d70805,
+0x15d80805,
+0x15d90805,
+0x15da0805,
+0x15db0805,
+0x15dc0805,
+0x15dd0805,
+0x15de0805,
+0x15df0805,
+0x15e00805,
+0x15e10805,
+0x15e20805,
+0x15e30805,
+0x15e40805,
+0x15e50805,
+0x15e60805,
+0x15e70805,
+0x15e80805,
+0x15e90805,
+0x15ea0805,
+0x15eb0805,
+0x15ec0805,
+0x15ed0805,
+0x15ee0805,
+0x15ef0805,
+0x15f00805,
+0x15f10805,
+0x15f20805,
+0x15f30805,
+0x15f40805,
+0x15f50805,
+0x15f60805,
+0x15f70805,
+0x15f80805,
+0x15f90805,
+0x15fa0805,
+0x15fb0805,
+0x15fc0805,
+0x15fd0805,
+0x15fe0805,
+0x15ff0805,
+0x16000805,
+0x16010805,
+0x16020805,
+0x16030805,
+0x16040805,
+0x16050805,
+0x16060805,
+0x16070805,
+0x16080805,
+0x16090805,
+0x160a0805,
+0x160b0805,
+0x160c0805,
+0x160d0805,
+0x160e0805,
+0x160f0805,
+0x16100805,
+0x16110805,
+0x16120805,
+0x16130805,
+0x16140805,
+0x16150805,
+0x16160805,
+0x16170805,
+0x16180805,
+0x16190805,
+0x161a0805,
+0x161b0805,
+0x161c0805,
+0x161d0805,
+0x161e0805,
+0x161f0805,
+0x16200805,
+0x16210805,
+0x16220805,
+0x16230805,
+0x16240805,
+0x16250805,
+0x16260805,
+0x16270805,
+0x16280805,
+0x16290805,
+0x162a0805,
+0x162b0805,
+0x162c0805,
+0x162d0805,
+0x162e0805,
+0x162f0805,
+0x16300805,
+0x16310805,
+0x16320805,
+0x16330805,
+0x16340805,
+0x16350805,
+0x16360805,
+0x16370805,
+0x16380805,
+0x16390805,
+0x163a0805,
+0x163b0805,
+0x163c0805,
+0x163d0805,
+0x163e0805,
+0x163f0805,
+0x16400805,
+0x16410805,
+0x16420805,
+0x16430805,
+0x16440805,
+0x16450805,
+0x16460805,
+0x16470805,
+0x16480805,
+0x16490805,
+0x164a0805,
+0x164b0805,
+0x164c0805,
+0x164d0805,
+0x164e0805,
+0x164f0805,
+0x16500805,
+0x16510805,
+0x16520805,
+0x16530805,
+0x16540805,
+0x16550805,
+0x16560805,
+0x16570805,
+0x16580805,
+0x16590805,
+0x165a0805,
+0x165b0805,
+0x165c0805,
+0x165d0805,
+0x165e0805,
+0x165f0805,
+0x16600805,
+0x16610805,
+0x16620805,
+0x16630805,
+0x16640805,
+0x16650805,
+0x16660805,
+0x16670805,
+0x16680805,
+0x16690805,
+0x166a0805,
+0x166b0805,
+0x166c0805,
+0x166d0805,
+0x166e0805,
+0x166f0805,
+0x16700805,
+0x16710805,
+0x16720805,
+0x16730805,
+0x16740805,
+0x16750805,
+0x16760805,
+0x16770805,
+0x16780805,
+0x16790805,
+0x167a0805,
+0x167b0805,
+0x167c0805,
+0x167d0805,
+0x167e0805,
+0x167f0805,
+0x16800805,
+0x16810805,
+0x16820805,
+0x16830805,
+0x16840805,
+0x16850805,
+0x16860805,
+0x16870805,
+0x16880805,
+0x16890805,
+0x168a0805,
+0x168b0805,
+0x168c0805,
+0x168d0805,
+0x168e0805,
+0x168f0805,
+0x16900805,
+0x16910805,
+0x16920805,
+0x16930805,
+0x16940805,
+0x16950805,
+0x16960805,
+0x16970805,
+0x16980805,
+0x16990805,
+0x169a0805,
+0x169b0805,
+0x169c0805,
+0x169d0805,
+0x169e0805,
+0x169f0805,
+0x16a00805,
+0x16a10805,
+0x16a20805,
+0x16a30805,
+0x16a40805,
+0x16a50805,
+0x16a60805,
+0x16a70805,
+0x16a80805,
+0x16a90805,
+0x16aa0805,
+0x16ab0805,
+0x16ac0805,
+0x16ad0805,
+0x16ae0805,
+0x16af0805,
+0x16b00805,
+0x16b10805,
+0x16b20805,
+0x16b30805,
+0x16b40805,
+0x16b50805,
+0x16b60805,
+0x16b70805,
+0x16b80805,
+0x16b90805,
+0x16ba0805,
+0x16bb0805,
+0x16bc0805,
+0x16bd0805,
+0x16be0805,
+0x16bf0805,
+0x16c00805,
+0x16c10805,
+0x16c20805,
+0x16c30805,
+0x16c40805,
+0x16c50805,
+0x16c60805,
+0x16c70805,
+0x16c80805,
+0x16c90805,
+0x16ca0805,
+0x16cb0805,
+0x16cc0805,
+0x16cd0805,
+0x16ce0805,
+0x16cf0805,
+0x16d00805,
+0x16d10805,
+0x16d20805,
+0x16d30805,
+0x16d40805,
+0x16d50805,
+0x16d60805,
+0x16d70805,
+0x16d80805,
+0x16d90805,
+0x16da0805,
+0x16db0805,
+0x16dc0805,
+0x16dd0805,
+0x16de0805,
+0x16df0805,
+0x16e00805,
+0x16e20805,
+0x16e30805,
+0x16e40805,
+0x16e50805,
+0x16e60805,
+0x16e70805,
+0x16e80805,
+0x16e90805,
+0x16ea0805,
+0x16eb0805,
+0x16ec0805,
+0x16ed0805,
+0x16ee0805,
+0x16ef0805,
+0x16f00805,
+0x16f10805,
+0x16f20805,
+0x16f30805,
+0x16f40805,
+0x16f50805,
+0x16f60805,
+0x16f70805,
+0x16f80805,
+0x16f90805,
+0x16fa0805,
+0x16fb0805,
+0x16fc0805,
+0x16fd0805,
+0x16fe0805,
+0x16ff0805,
+0x17000805,
+0x17010805,
+0x17020805,
+0x17030805,
+0x17040805,
+0x17050805,
+0x17060805,
+0x17070805,
+0x17080805,
+0x17090805,
+0x170a0805,
+0x170c0805,
+0x170d0805,
+0x170e0805,
+0x170f0805,
+0x17100805,
+0x17110805,
+0x17120805,
+0x17130805,
+0x17140805,
+0x17150805,
+0x17160805,
+0x17170805,
+0x17180805,
+0x17190805,
+0x171a0805,
+0x171b0805,
+0x171c0805,
+0x171d0805,
+0x171e0805,
+0x171f0805,
+0x17200805,
+0x17210805,
+0x17220805,
+0x17230805,
+0x17240805,
+0x17250805,
+0x17260805,
+0x17270805,
+0x17280805,
+0x17290805,
+0x172a0805,
+0x172b0805,
+0x172c0805,
+0x172d0805,
+0x172e0805,
+0x172f0805,
+0x17300805,
+0x17310805,
+0x17320805,
+0x17330805,
+0x17340805,
+0x17350805,
+0x17360805,
+0x17370805,
+0x17380805,
+0x17390805,
+0x173a0805,
+0x173b0805,
+0x173c0805,
+0x173d0805,
+0x173e0805,
+0x173f0805,
+0x17400805,
+0x17410805,
+0x17420805,
+0x17430805,
+0x17440805,
+0x17450805,
+0x17460805,
+0x17470805,
+0x17480805,
+0x17490805,
+0x174a0805,
+0x174b0805,
+0x174c0805,
+0x174d0805,
+0x174e0805,
+0x174f0805,
+0x17500805,
+0x17510805,
+0x17520805,
+0x17530805,
+0x17540805,
+0x17550805,
+0x17560805,
+0x17570805,
+0x17580805,
+0x17590805,
+0x175a0805,
+0x175b0805,
+0x175c0805,
+0x175d0805,
+0x175e0805,
+0x175f0805,
+0x17600805,
+0x17610805,
+0x17620805,
+0x17630805,
+0x17640805,
+0x17650805,
+0x17660805,
+0x189e0805,
+0x189f0805,
+0x18a00805,
+0x18a10805,
+0x18a20805,
+0x18a30805,
+0x18a40805,
+0x18a50805,
+0x18a60805,
+0x18a70805,
+0x18a80805,
+0x18a90805,
+0x18aa0805,
+0x18ab0805,
+0x18ac0805,
+0x18ad0805,
+0x18ae0805,
+0x18af0805,
+0x18b00805,
+0x18b10805,
+0x18b20805,
+0x18b30805,
+0x18b40805,
+0x18b50805,
+0x18b60805,
+0x18b70805,
+0x18b80805,
+0x18b90805,
+0x18ba0805,
+0x18bb0805,
+0x18bc0805,
+0x18bd0805,
+0x18be0805,
+0x18bf0805,
+0x18c00805,
+0x18c10805,
+0x18c20805,
+0x18c30805,
+0x18c40805,
+0x18c50805,
+0x18c60805,
+0x18c70805,
+0x18c80805,
+0x18c90805,
+0x18ca0805,
+0x18cb0805,
+0x18cc0805,
+0x18cd0805,
+0x18ce0805,
+0x18cf0805,
+0x18d00805,
+0x18d10805,
+0x18d20805,
+0x18d30805,
+0x18d40805,
+0x18d50805,
+0x18d60805,
+0x18d70805,
+0x18d80805,
+0x18d90805,
+0x18da0805,
+0x18db0805,
+0x18dc0805,
+0x18dd0805,
+0x18de0805,
+0x18df0805,
+0x18e00805,
+0x18e10805,
+0x18e20805,
+0x18e30805,
+0x18e40805,
+0x18e50805,
+0x18e60805,
+0x18e70805,
+0x18e80805,
+0x18e90805,
+0x18ea0805,
+0x18eb0805,
+0x18ec0805,
+0x18ed0805,
+0x18ee0805,
+0x18ef0805,
+0x18f00805,
+0x18f10805,
+0x18f20805,
+0x18f30805,
+0x18f40805,
+0x18f50805,
+0x18f60805,
+0x18f70805,
+0x18f80805,
+0x18f90805,
+0x18fa0805,
+0x18fb0805,
+0x18fc0805,
+0x18fd0805,
+0x18fe0805,
+0x18ff0805,
+0x19000805,
+0x19010805,
+0x19020805,
+0x19030805,
+0x19040805,
+0x19050805,
+0x19060805,
+0x19070805,
+0x19080805,
+0x19090805,
+0x190a0805,
+0x190b0805,
+0x190c0805,
+0x190d0805,
+0x190e0805,
+0x190f0805,
+0x19100805,
+0x19110805,
+0x19120805,
+0x19130805,
+0x19140805,
+0x19150805,
+0x19160805,
+0x19170805,
+0x19180805,
+0x19190805,
+0x191a0805,
+0x191b0805,
+0x191c0805,
+0x191d0805,
+0x191e0805,
+0x191f0805,
+0x19200805,
+0x19210805,
+0x19220805,
+0x19230805,
+0x19240805,
+0x19250805,
+0x19260805,
+0x19270805,
+0x19280805,
+0x19290805,
+0x192a0805,
+0x192b0805,
+0x192c0805,
+0x192d0805,
+0x192e0805,
+0x192f0805,
+0x19300805,
+0x19310805,
+0x19320805,
+0x19330805,
+0x19340805,
+0x19350805,
+0x19360805,
+0x19370805,
+0x19380805,
+0x19390805,
+0x193a0805,
+0x193b0805,
+0x193c0805,
+0x193d0805,
+0x193e0805,
+0x193f0805,
+0x19400805,
+0x19410805,
+0x19420805,
+0x19430805,
+0x19440805,
+0x19450805,
+0x19460805,
+0x19470805,
+0x19480805,
+0x19490805,
+0x194a0805,
+0x194b0805,
+0x194c0805,
+0x194d0805,
+0x194e0805,
+0x194f0805,
+0x19500805,
+0x19510805,
+0x19520805,
+0x19530805,
+0x19540805,
+0x19550805,
+0x19560805,
+0x19570805,
+0x19580805,
+0x19590805,
+0x195a0805,
+0x195b0805,
+0x195c0805,
+0x195d0805,
+0x195e0805,
+0x195f0805,
+0x19600805,
+0x19610805,
+0x19620805,
+0x19630805,
+0x19640805,
+0x19650805,
+0x19660805,
+0x19670805,
+0x19680805,
+0x19690805,
+0x196a0805,
+0x196b0805,
+0x196c0805,
+0x196d0805,
+0x196e0805,
+0x19760805,
+0x19770805,
+0x19780805,
+0x19790805,
+0x197a0805,
+0x197b0805,
+0x197c0805,
+0x197d0805,
+0x197e0805,
+0x197f0805,
+0x19800805,
+0x19810805,
+0x19820805,
+0x19830805,
+0x19840805,
+0x19850805,
+0x19860805,
+0x19900805,
+0x19910805,
+0x19920805,
+0x19930805,
+0x19940805,
+0x19950805,
+0x19960805,
+0x19970805,
+0x19980805,
+0x19990805,
+0x199a0805,
+0x199b0805,
+0x199c0805,
+0x199d0805,
+0x199e0805,
+0x199f0805,
+0x19a00805,
+0x19a10805,
+0x19a20805,
+0x19a30805,
+0x19a40805,
+0x19a50805,
+0x19a60805,
+0x19a70805,
+0x19a80805,
+0x19a90805,
+0x19aa0805,
+0x19ab0805,
+0x19ac0805,
+0x19ad0805,
+0x19ae0805,
+0x19af0805,
+0x19b00805,
+0x19b10805,
+0x19b20805,
+0x19b30805,
+0x19b40805,
+0x19b50805,
+0x19b60805,
+0x19b70805,
+0x19b80805,
+0x19b90805,
+0x19ba0805,
+0x19bb0805,
+0x19bc0805,
+0x19bd0805,
+0x19be0805,
+0x19bf0805,
+0x19c00805,
+0x19c10805,
+0x19c20805,
+0x19c30805,
+0x19c40805,
+0x19c50805,
+0x19c60805,
+0x19c70805,
+0x19c80805,
+0x19c90805,
+0x19ca0805,
+0x19cb0805,
+0x19cc0805,
+0x19cd0805,
+0x19ce0805,
+0x19cf0805,
+0x19d00805,
+0x19d10805,
+0x19d20805,
+0x19d30805,
+0x19d40805,
+0x19d50805,
+0x19d60805,
+0x19d70805,
+0x19d80805,
+0x19d90805,
+0x19da0805,
+0x19db0805,
+0x19dc0805,
+0x19dd0805,
+0x19de0805,
+0x19df0805,
+0x19e00805,
+0x19e10805,
+0x19e20805,
+0x19e30805,
+0x19e40805,
+0x19e50805,
+0x19e60805,
+0x19e70805,
+0x19e80805,
+0x19e90805,
+0x19ea0805,
+0x19eb0805,
+0x19ec0805,
+0x19ed0805,
+0x19ee0805,
+0x19ef0805,
+0x19f00805,
+0x19f10805,
+0x19f20805,
+0x19f30805,
+0x19f40805,
+0x19f50805,
+0x19f60805,
+0x19f70805,
+0x19f80805,
+0x19f90805,
+0x19fa0805,
+0x19fb0805,
+0x19fc0805,
+0x19fd0805,
+0x19fe0805,
+0x19ff0805,
+0x1a000805,
+0x1a010805,
+0x1a020805,
+0x1a030805,
+0x1a040805,
+0x1a050805,
+0x1a060805,
+0x1a070805,
+0x1a080805,
+0x1a090805,
+0x1a0a0805,
+0x1a0b0805,
+0x1a0c0805,
+0x1a0d0805,
+0x1a0e0805,
+0x1a0f0805,
+0x1a100805,
+0x1a110805,
+0x1a120805,
+0x1a130805,
+0x1a140805,
+0x1a150805,
+0x1a160805,
+0x1a170805,
+0x1a180805,
+0x1a190805,
+0x1a1a0805,
+0x1a1b0805,
+0x1a1c0805,
+0x1a1d0805,
+0x1a1e0805,
+0x1a1f0805,
+0x1a200805,
+0x1a210805,
+0x1a220805,
+0x1a230805,
+0x1a240805,
+0x1a250805,
+0x1a260805,
+0x1a270805,
+0x1a280805,
+0x1a290805,
+0x1a2a0805,
+0x1a2b0805,
+0x1a2c0805,
+0x1a2d0805,
+0x1a2e0805,
+0x1a2f0805,
+0x1a300805,
+0x1a310805,
+0x1a320805,
+0x1a330805,
+0x1a340805,
+0x1a350805,
+0x1a360805,
+0x1a370805,
+0x1a380805,
+0x1a390805,
+0x1a3a0805,
+0x1a3b0805,
+0x1a3c0805,
+0x1a3d0805,
+0x1a3e0805,
+0x1a3f0805,
+0x1a400805,
+0x1a410805,
+0x1a420805,
+0x1a430805,
+0x1a440805,
+0x1a450805,
+0x1a460805,
+0x1a470805,
+0x1a480805,
+0x1a490805,
+0x1a4a0805,
+0x1a4b0805,
+0x1a4c0805,
+0x1a4d0805,
+0x1a4e0805,
+0x1a4f0805,
+0x1a500805,
+0x1a510805,
+0x1a520805,
+0x1a530805,
+0x1a540805,
+0x1a550805,
+0x1a560805,
+0x1a570805,
+0x1a580805,
+0x1a690805,
+0x1a6a0805,
+0x1a6b0805,
+0x1a6c0805,
+0x1a6d0805,
+0x1a6e0805,
+0x1a6f0805,
+0x1a700805,
+0x1a710805,
+0x1a720805,
+0x1a730805,
+0x1a740805,
+0x1a750805,
+0x1a760805,
+0x1a770805,
+0x1a780805,
+0x1a790805,
+0x1a7a0805,
+0x1a7b0805,
+0x1a7c0805,
+0x1a7d0805,
+0x1a7e0805,
+0x1a7f0805,
+0x1a800805,
+0x1a810805,
+0x1a820805,
+0x1a830805,
+0x1a840805,
+0x1a850805,
+0x1a860805,
+0x1a870805,
+0x1a880805,
+0x1a890805,
+0x1a8a0805,
+0x1a8b0805,
+0x1a8c0805,
+0x1a8d0805,
+0x1a8e0805,
+0x1a8f0805,
+0x1a900805,
+0x1a910805,
+0x1a920805,
+0x1a930805,
+0x1a940805,
+0x1a950805,
+0x1a960805,
+0x1a970805,
+0x1a980805,
+0x1a990805,
+0x1a9a0805,
+0x1a9b0805,
+0x1a9c0805,
+0x1a9d0805,
+0x1a9e0805,
+0x1a9f0805,
+0x1aa00805,
+0x1aa10805,
+0x1aa20805,
+0x1aa30805,
+0x1aa40805,
+0x1aa50805,
+0x1aa60805,
+0x1aa70805,
+0x1aa80805,
+0x1aa90805,
+0x1aaa0805,
+0x1aab0805,
+0x1aac0805,
+0x1aad0805,
+0x1aae0805,
+0x1aaf0805,
+0x1ab00805,
+0x1ab10805,
+0x1ab20805,
+0x1ab30805,
+0x1ab40805,
+0x1ab50805,
+0x1ab60805,
+0x1ab70805,
+0x1ab80805,
+0x1ab90805,
+0x1aba0805,
+0x1abb0805,
+0x1abc0805,
+0x1abd0805,
+0x1abe0805,
+0x1abf0805,
+0x1ac00805,
+0x1ac10805,
+0x1ac20805,
+0x1ac30805,
+0x1ac40805,
+0x1ac50805,
+0x1ac60805,
+0x1ac70805,
+0x1ac80805,
+0x1ac90805,
+0x1aca0805,
+0x1acb0805,
+0x1acc0805,
+0x1acd0805,
+0x1ace0805,
+0x1acf0805,
+0x1ad00805,
+0x1ad10805,
+0x1ad20805,
+0x1ad30805,
+0x1ad40805,
+0x1ad50805,
+0x1ad60805,
+0x1ad70805,
+0x1ad80805,
+0x1ad90805,
+0x1ada0805,
+0x1adb0805,
+0x1adc0805,
+0x1add0805,
+0x1ade0805,
+0x1adf0805,
+0x1ae00805,
+0x1ae10805,
+0x1ae20805,
+0x1ae30805,
+0x1ae40805,
+0x1ae50805,
+0x1ae60805,
+0x1ae70805,
+0x1ae80805,
+0x1ae90805,
+0x1aea0805,
+0x1aeb0805,
+0x1aec0805,
+0x1aed0805,
+0x1aee0805,
+0x1aef0805,
+0x1af00805,
+0x1af10805,
+0x1af20805,
+0x1af30805,
+0x1af40805,
+0x1af50805,
+0x1af60805,
+0x1af70805,
+0x1af80805,
+0x1af90805,
+0x1afa0805,
+0x1afb0805,
+0x1afc0805,
+0x17770805,
+0x17780805,
+0x17790805,
+0x177a0805,
+0x177b0805,
+0x177c0805,
+0x177d0805,
+0x177e0805,
+0x177f0805,
+0x17e60805,
+0x17e70805,
+0x17e80805,
+0x17e90805,
+0x17ea0805,
+0x18260805,
+0x844,
+0x884,
+0x8c4,
+0x904,
+0x944,
+0x984,
+0x9c4,
+0xa04,
+0xa44,
+0xa84,
+0xac4,
+0xac4,
+0x904,
+0xb04,
+0xb44,
+0xb84,
+0xbc4,
+0xc04,
+0xc44,
+0xc84,
+0xcc4,
+0xd04,
+0xd44,
+0xd84,
+0xdc4,
+0xde4,
+0xe04,
+0xe24,
+0xe44,
+0xe84,
+0xec4,
+0xf04,
+0xf44,
+0xf84,
+0xfc4,
+0x1004,
+0x1044,
+0x1084,
+0x10c4,
+0x1104,
+0x1144,
+0x1184,
+0x11c4,
+0x1204,
+0x1244,
+0x1284,
+0x12c4,
+0x1304,
+0x1344,
+0x1384,
+0x13c4,
+0x1404,
+0x1444,
+0x1484,
+0x14c4,
+0x1504,
+0x1544,
+0x1584,
+0x15c4,
+0x1604,
+0x1644,
+0x1684,
+0x16c4,
+0x1704,
+0x1744,
+0x1784,
+0x17c4,
+0x1804,
+0x1844,
+0x1884,
+0x18c4,
+0x1904,
+0x1944,
+0x1984,
+0x19c4,
+0x1a04,
+0x1a44,
+0x1a84,
+0x1ac4,
+0x1b04,
+0x1b44,
+0x1b70,
+0x1b74,
+0x1b84,
+0x1bc4,
+0x1c04,
+0x1c34,
+0x1c34,
+0x2034,
+0x1c44,
+0x1c84,
+0x1cc4,
+0x1cf4,
+0x1cf4,
+0x2034,
+0x1d04,
+0x1d44,
+0x1d84,
+0x1db0,
+0x1db4,
+0x1db0,
+0x2030,
+0x1db4,
+0x2034,
+0x1dc4,
+0x1e04,
+0x1e44,
+0x1e84,
+0x1eb0,
+0x1eb4,
+0x1eb0,
+0x2030,
+0x1eb4,
+0x2034,
+0x1ec4,
+0x1f04,
+0x1f44,
+0x1f70,
+0x1f74,
+0x1f70,
+0x2030,
+0x1f74,
+0x2034,
+0x1f84,
+0x1fc4,
+0x2004,
+0x2030,
+0x2034,
+0x2034,
+0x2634,
+0x2044,
+0x2070,
+0x2074,
+0x2084,
+0x20c4,
+0x2104,
+0x2144,
+0x2184,
+0x21c4,
+0x2204,
+0x2244,
+0x2284,
+0x22c4,
+0x2304,
+0x2344,
+0x2384,
+0x23c4,
+0x2404,
+0x2444,
+0x2484,
+0x24c4,
+0x2504,
+0x2544,
+0x2584,
+0x25c4,
+0x2604,
+0x2644,
+0x2684,
+0x26c4,
+0x2704,
+0x2744,
+0x2784,
+0x27c4,
+0x2804,
+0x2844,
+0x2884,
+0x28c4,
+0x2904,
+0x2944,
+0x2984,
+0x29c4,
+0x2a04,
+0x2a44,
+0x2a84,
+0x2ac4,
+0x2b04,
+0x2b44,
+0x2b84,
+0x2bc4,
+0x2c04,
+0x2c44,
+0x2c84,
+0x2cc4,
+0x2d04,
+0x2d44,
+0x2d84,
+0x2dc4,
+0x2e04,
+0x2e44,
+0x2e84,
+0x2ec4,
+0x2f04,
+0x3084,
+0x30c4,
+0x3104,
+0x3144,
+0x3184,
+0x31c4,
+0x3204,
+0x3244,
+0x3284,
+0x32c4,
+0x3304,
+0x3344,
+0x3384,
+0x33c4,
+0x3404,
+0x3444,
+0x34c4,
+0x3504,
+0x3544,
+0x3584,
+0x35c4,
+0x3604,
+0x3644,
+0x3684,
+0x36c4,
+0x3704,
+0x3744,
+0x3784,
+0x37c4,
+0x3804,
+0x3844,
+0x3884,
+0x38c4,
+0x3904,
+0x3944,
+0x3984,
+0x39c4,
+0x3a04,
+0x3a44,
+0x3a84,
+0x3ac4,
+0x3b04,
+0x3b44,
+0x3b84,
+0x3bc4,
+0x3c04,
+0x3c44,
+0x3c84,
+0x3cc4,
+0x3d04,
+0x3d44,
+0x3d84,
+0x3dc4,
+0x3e04,
+0x3e44,
+0x3e84,
+0x3ec4,
+0x3f04,
+0x4044,
+0x4084,
+0x40c4,
+0x4104,
+0x4144,
+0x4184,
+0x4244,
+0x4284,
+0x42c4,
+0x4304,
+0x4344,
+0x4384,
+0x43c4,
+0x4404,
+0x4444,
+0x4484,
+0x44c4,
+0x4504,
+0x4544,
+0x4584,
+0x45c4,
+0x1f460804,
+0x1f470804,
+0x1f480804,
+0x1f490804,
+0x1f4a0804,
+0x1f4b0804,
+0x1f4c0804,
+0x1f4d0804,
+0x1f4e0804,
+0x1f4f0804,
+0x1f500804,
+0x1f510804,
+0x1f520804,
+0x1f530804,
+0x1f540804,
+0x1f570804,
+0x1f580804,
+0x1f5c0804,
+0x1f5c0804,
+0xdc4,
+0x1f5d0804,
+0x1f5d0804,
+0xdc4,
+0x1f5e0804,
+0x1f5f0804,
+0x1f5f0804,
+0xdc4,
+0x1f600804,
+0x1f600824,
+0x1f610804,
+0x1f610804,
+0xdc4,
+0x1f620804,
+0x1f630804,
+0x1f630806,
+0x1f640804,
+0x1f640806,
+0x1f64081e,
+0x1f650804,
+0x1f650806,
+0x1f660804,
+0x1f660806,
+0x1f670804,
+0x1f680804,
+0x1f6b0804,
+0x1f6c0804,
+0x1f6d0804,
+0x1f6e0804,
+0x1f6f0804,
+0x1f700804,
+0x1f750804,
+0x1f760804,
+0x1f780804,
+0x1f790804,
+0x1f7a0804,
+0x1f7b0804,
+0x1f7c0804,
+0x1f7d0804,
+0x1f7e0804,
+0x1f7f0804,
+0x1f800804,
+0x1f800806,
+0x1f810804,
+0x1f820804,
+0x1f830804,
+0x1f840804,
+0x1f850804,
+0x1f860804,
+0x1f870804,
+0x1f880804,
+0x1f890804,
+0x1f8a0804,
+0x1f8b0804,
+0x1f8c0804,
+0x1f8d0804,
+0x1f8e0804,
+0x1f8f0804,
+0x1f900804,
+0x1f920804,
+0x1f930804,
+0x1f940804,
+0x1f950804,
+0x1f960804,
+0x1f980804,
+0x1f980806,
+0x1f980808,
+0x1f980808,
+0x27e0809,
+0x1f980808,
+0x2230809,
+0x1f98080a,
+0x1f98080c,
+0x1f980828,
+0x1f98082a,
+0x1f98083c,
+0x676083d,
+0x1f9b083c,
+0x1f980808,
+0xfb400808,
+0xf0b90000,
+0x1f990804,
+0x1f990806,
+0x1f990808,
+0x3280809,
+0x1f990808,
+0x3290809,
+0x1f990808,
+0x27e0809,
+0x1f990808,
+0x2230809,
+0x1f99080a,
+0x1f99080c,
+0x1f990828,
+0x1f99082a,
+0x1f99083c,
+0x676083d,
+0x3280809,
+0x1f990808,
+0x1f980808,
+0x3290809,
+0x1f990808,
+0x1f980808,
+0x27e0809,
+0x1f99080c,
+0x1f98080c,
+0x1f990808,
+0x1f980808,
+0xfb400808,
+0xe5e50000,
+0x1f990808,
+0x1f980808,
+0xfb400808,
+0xe7080000,
+0x1f990808,
+0x1f980808,
+0xfb400808,
+0xf0b90000,
+0x3280809,
+0x1f990808,
+0x1f990808,
+0x3290809,
+0x1f990808,
+0x1f990808,
+0x27e0809,
+0x1f99080c,
+0x1f99080c,
+0x1f99083c,
+0x676083d,
+0x1f99083c,
+0x1f98083c,
+0x1f990808,
+0x1f990808,
+0xfb400808,
+0xe5e50000,
+0x1f990808,
+0x1f990808,
+0xfb400808,
+0xe7080000,
+0x1f990808,
+0x1f990808,
+0xfb400808,
+0xf0b90000,
+0x3280809,
+0x1f990808,
+0x1f9a0808,
+0x3290809,
+0x1f990808,
+0x1f9a0808,
+0x27e0809,
+0x1f99080c,
+0x1f9a080c,
+0x1f99083c,
+0x676083d,
+0x1f9a083c,
+0x1f990808,
+0x1f9a0808,
+0xfb400808,
+0xe5e50000,
+0x1f990808,
+0x1f9a0808,
+0xfb400808,
+0xe7080000,
+0x1f990808,
+0x1f9a0808,
+0xfb400808,
+0xf0b90000,
+0x3280809,
+0x1f990808,
+0x1f9b0808,
+0x3290809,
+0x1f990808,
+0x1f9b0808,
+0x27e0809,
+0x1f99080c,
+0x1f9b080c,
+0x1f99083c,
+0x676083d,
+0x1f9b083c,
+0x1f990808,
+0x1f9b0808,
+0xfb400808,
+0xe5e50000,
+0x1f990808,
+0x1f9b0808,
+0xfb400808,
+0xf0b90000,
+0x3280809,
+0x1f990808,
+0x1f9c0808,
+0x3290809,
+0x1f990808,
+0x1f9c0808,
+0x27e0809,
+0x1f99080c,
+0x1f9c080c,
+0x1f99083c,
+0x676083d,
+0x1f9c083c,
+0x1f990808,
+0x1f9c0808,
+0xfb400808,
+0xe5e50000,
+0x1f990808,
+0x1f9c0808,
+0xfb400808,
+0xf0b90000,
+0x3280809,
+0x1f990808,
+0x1f9d0808,
+0x3290809,
+0x1f990808,
+0x1f9d0808,
+0x27e0809,
+0x1f99080c,
+0x1f9d080c,
+0x1f99083c,
+0x676083d,
+0x1f9d083c,
+0x1f990808,
+0x1f9d0808,
+0xfb400808,
+0xe5e50000,
+0x1f990808,
+0x1f9d0808,
+0xfb400808,
+0xf0b90000,
+0x3280809,
+0x1f990808,
+0x1f9e0808,
+0x3290809,
+0x1f990808,
+0x1f9e0808,
+0x27e0809,
+0x1f99080c,
+0x1f9e080c,
+0x1f99083c,
+0x676083d,
+0x1f9e083c,
+0x1f990808,
+0x1f9e0808,
+0xfb400808,
+0xe5e50000,
+0x1f990808,
+0x1f9e0808,
+0xfb400808,
+0xf0b90000,
+0x3280809,
+0x1f990808,
+0x1f9f0808,
+0x3290809,
+0x1f990808,
+0x1f9f0808,
+0x27e0809,
+0x1f99080c,
+0x1f9f080c,
+0x1f99083c,
+0x676083d,
+0x1f9f083c,
+0x1f990808,
+0x1f9f0808,
+0xfb400808,
+0xe5e50000,
+0x1f990808,
+0x1f9f0808,
+0xfb400808,
+0xf0b90000,
+0x3280809,
+0x1f990808,
+0x1fa00808,
+0x3290809,
+0x1f990808,
+0x1fa00808,
+0x27e0809,
+0x1f99080c,
+0x1fa0080c,
+0x1f99083c,
+0x676083d,
+0x1fa0083c,
+0x1f990808,
+0x1fa00808,
+0xfb400808,
+0xe5e50000,
+0x1f990808,
+0x1fa00808,
+0xfb400808,
+0xf0b90000,
+0x3280809,
+0x1f990808,
+0x1fa10808,
+0x3290809,
+0x1f990808,
+0x1fa10808,
+0x27e0809,
+0x1f99080c,
+0x1fa1080c,
+0x1f99083c,
+0x676083d,
+0x1fa1083c,
+0x1f990808,
+0x1fa10808,
+0xfb400808,
+0xe5e50000,
+0x1f990808,
+0x1fa10808,
+0xfb400808,
+0xf0b90000,
+0x1f990808,
+0xfb400808,
+0xe5e50000,
+0x1f990808,
+0xfb400808,
+0xe7080000,
+0x1f990808,
+0xfb400808,
+0xf0b90000,
+0x1f9a0804,
+0x1f9a0806,
+0x1f9a0808,
+0x3280809,
+0x1f9a0808,
+0x3290809,
+0x1f9a0808,
+0x27e0809,
+0x1f9a0808,
+0x2230809,
+0x1f9a080a,
+0x1f9a080c,
+0x1f9a0828,
+0x1f9a082a,
+0x3280809,
+0x1f9a0808,
+0x1f980808,
+0x3290809,
+0x1f9a0808,
+0x1f980808,
+0x27e0809,
+0x1f9a080c,
+0x1f98080c,
+0x1f9a0808,
+0x1f980808,
+0xfb400808,
+0xe5e50000,
+0x1f9a0808,
+0x1f980808,
+0xfb400808,
+0xf0b90000,
+0x1f9a080c,
+0x1f99080c,
+0x1f9a0808,
+0x1f990808,
+0xfb400808,
+0xe5e50000,
+0x1f9a0808,
+0x1f990808,
+0xfb400808,
+0xf0b90000,
+0x1f9a080c,
+0x1f9a080c,
+0x1f9a0808,
+0x1f9a0808,
+0xfb400808,
+0xe5e50000,
+0x1f9a0808,
+0x1f9a0808,
+0xfb400808,
+0xf0b90000,
+0x1f9a080c,
+0x1f9b080c,
+0x1f9a083c,
+0x676083d,
+0x1f9b083c,
+0x1f9a0808,
+0x1f9b0808,
+0xfb400808,
+0xe5e50000,
+0x1f9a0808,
+0x1f9b0808,
+0xfb400808,
+0xf0b90000,
+0x1f9a080c,
+0x1f9c080c,
+0x1f9a0808,
+0x1f9c0808,
+0xfb400808,
+0xe5e50000,
+0x1f9a0808,
+0x1f9c0808,
+0xfb400808,
+0xf0b90000,
+0x1f9a080c,
+0x1f9d080c,
+0x1f9a083c,
+0x676083d,
+0x1f9d083c,
+0x1f9a0808,
+0x1f9d0808,
+0xfb400808,
+0xe5e50000,
+0x1f9a080c,
+0x1f9e080c,
+0x1f9a0808,
+0x1f9e0808,
+0xfb400808,
+0xe5e50000,
+0x1f9a080c,
+0x1f9f080c,
+0x1f9a0808,
+0x1f9f0808,
+0xfb400808,
+0xe5e50000,
+0x1f9a080c,
+0x1fa0080c,
+0x1f9a0808,
+0x1fa00808,
+0xfb400808,
+0xe5e50000,
+0x1f9a080c,
+0x1fa1080c,
+0x1f9a0808,
+0x1fa10808,
+0xfb400808,
+0xe5e50000,
+0x1f9a0808,
+0xfb400808,
+0xe5e50000,
+0x1f9a0808,
+0xfb400808,
+0xe7080000,
+0x1f9a0808,
+0xfb400808,
+0xf0b90000,
+0x1f9b0804,
+0x1f9b0806,
+0x1f9b0808,
+0x3280809,
+0x1f9b0808,
+0x3290809,
+0x1f9b0808,
+0x27e0809,
+0x1f9b0808,
+0x2230809,
+0x1f9b080a,
+0x1f9b080c,
+0x1f9b0828,
+0x1f9b082a,
+0x1f9b080c,
+0x1f98080c,
+0x1f9b0808,
+0x1f980808,
+0xfb400808,
+0xe5e50000,
+0x1f9b080c,
+0x1f99080c,
+0x1f9b0808,
+0x1f990808,
+0xfb400808,
+0xe5e50000,
+0x1f9b080c,
+0x1f9a080c,
+0x1f9b080c,
+0x1f9b080c,
+0x1f9b080c,
+0x1f9c080c,
+0x1f9b083c,
+0x676083d,
+0x1f9c083c,
+0x1f9b080c,
+0x1f9d080c,
+0x1f9b083c,
+0x676083d,
+0x1f9d083c,
+0x1f9b080c,
+0x1f9e080c,
+0x1f9b080c,
+0x1f9f080c,
+0x1f9b080c,
+0x1fa0080c,
+0x1f9b083c,
+0x676083d,
+0x1fa0083c,
+0x1f9b080c,
+0x1fa1080c,
+0x1f9b0808,
+0xfb400808,
+0xe5e50000,
+0x1f9b0808,
+0xfb400808,
+0xe7080000,
+0x1f9b0808,
+0xfb400808,
+0xf0b90000,
+0x1f9c0804,
+0x1f9c0806,
+0x1f9c0808,
+0x3280809,
+0x1f9c0808,
+0x3290809,
+0x1f9c0808,
+0x27e0809,
+0x1f9c0808,
+0x2230809,
+0x1f9c080a,
+0x1f9c080c,
+0x1f9c0828,
+0x1f9c082a,
+0x1f9c080c,
+0x1f98080c,
+0x1f9c080c,
+0x1f99080c,
+0x1f9c080c,
+0x1f9a080c,
+0x1f9c080c,
+0x1f9b080c,
+0x1f9c080c,
+0x1f9c080c,
+0x1f9c080c,
+0x1f9d080c,
+0x1f9c083c,
+0x676083d,
+0x1f9d083c,
+0x1f9c080c,
+0x1f9e080c,
+0x1f9c080c,
+0x1f9f080c,
+0x1f9c080c,
+0x1fa0080c,
+0x1f9c080c,
+0x1fa1080c,
+0x1f9c0808,
+0xfb400808,
+0xe5e50000,
+0x1f9c0808,
+0xfb400808,
+0xe7080000,
+0x1f9c0808,
+0xfb400808,
+0xf0b90000,
+0x1f9d0804,
+0x1f9d0806,
+0x1f9d0808,
+0x3280809,
+0x1f9d0808,
+0x3290809,
+0x1f9d0808,
+0x27e0809,
+0x1f9d0808,
+0x2230809,
+0x1f9d080a,
+0x1f9d080c,
+0x1f9d0828,
+0x1f9d082a,
+0x1f9d080c,
+0x1f98080c,
+0x1f9d083c,
+0x676083d,
+0x1f9e083c,
+0x1f9d083c,
+0x676083d,
+0x1fa0083c,
+0x1f9d0808,
+0xfb400808,
+0xe5e50000,
+0x1f9d0808,
+0xfb400808,
+0xe7080000,
+0x1f9d0808,
+0xfb400808,
+0xf0b90000,
+0x1f9e0804,
+0x1f9e0806,
+0x1f9e0808,
+0x3280809,
+0x1f9e0808,
+0x3290809,
+0x1f9e0808,
+0x27e0809,
+0x1f9e0808,
+0x2230809,
+0x1f9e080a,
+0x1f9e080c,
+0x1f9e0828,
+0x1f9e082a,
+0x1f9e080c,
+0x1f98080c,
+0x1f9e0808,
+0xfb400808,
+0xe5e50000,
+0x1f9e0808,
+0xfb400808,
+0xe7080000,
+0x1f9e0808,
+0xfb400808,
+0xf0b90000,
+0x1f9f0804,
+0x1f9f0806,
+0x1f9f0808,
+0x3280809,
+0x1f9f0808,
+0x3290809,
+0x1f9f0808,
+0x27e0809,
+0x1f9f0808,
+0x2230809,
+0x1f9f080a,
+0x1f9f080c,
+0x1f9f0828,
+0x1f9f082a,
+0x1f9f080c,
+0x1f98080c,
+0x1f9f083c,
+0x676083d,
+0x1fa0083c,
+0x1f9f0808,
+0xfb400808,
+0xe5e50000,
+0x1f9f0808,
+0xfb400808,
+0xe7080000,
+0x1f9f0808,
+0xfb400808,
+0xf0b90000,
+0x1fa00804,
+0x1fa00806,
+0x1fa00808,
+0x3280809,
+0x1fa00808,
+0x3290809,
+0x1fa00808,
+0x27e0809,
+0x1fa00808,
+0x2230809,
+0x1fa0080a,
+0x1fa0080c,
+0x1fa00828,
+0x1fa0082a,
+0x1fa0080c,
+0x1f98080c,
+0x1fa00808,
+0xfb400808,
+0xe5e50000,
+0x1fa00808,
+0xfb400808,
+0xe7080000,
+0x1fa00808,
+0xfb400808,
+0xf0b90000,
+0x1fa10804,
+0x1fa10806,
+0x1fa10808,
+0x3280809,
+0x1fa10808,
+0x3290809,
+0x1fa10808,
+0x27e0809,
+0x1fa10808,
+0x2230809,
+0x1fa1080a,
+0x1fa1080c,
+0x1fa10828,
+0x1fa1082a,
+0x1fa10808,
+0xfb400808,
+0xe5e50000,
+0x1fa10808,
+0xfb400808,
+0xe7080000,
+0x1fa10808,
+0xfb400808,
+0xf0b90000,
+0x1fa20804,
+0x1fa20806,
+0x1fa20808,
+0x3280809,
+0x1fa20808,
+0x3290809,
+0x1fa2080a,
+0x1fa2080c,
+0x1fa20810,
+0x1fa20812,
+0x3280809,
+0x1fa20814,
+0x3290809,
+0x1fa20816,
+0x1fa20818,
+0x1fa20828,
+0x1fa2082a,
+0x1fa2083a,
+0x1fa20804,
+0x904,
+0x1fa20810,
+0x904,
+0x1fa20804,
+0x944,
+0x1fa20810,
+0x944,
+0x1fa20804,
+0x984,
+0x1fa20810,
+0x984,
+0x1fa20804,
+0x984,
+0x904,
+0x1fa20810,
+0x984,
+0x904,
+0x1fa20804,
+0x984,
+0x944,
+0x1fa20810,
+0x984,
+0x944,
+0x1fa20804,
+0x984,
+0xb44,
+0x1fa20810,
+0x984,
+0xb44,
+0x1fa20804,
+0x984,
+0xec4,
+0x1fa20810,
+0x984,
+0xec4,
+0x1fa20804,
+0x9c4,
+0x1fa20810,
+0x9c4,
+0x1fa20804,
+0x9c4,
+0x904,
+0x1fa20810,
+0x9c4,
+0x904,
+0x1fa20804,
+0x9c4,
+0x944,
+0x1fa20810,
+0x9c4,
+0x944,
+0x1fa20804,
+0x9c4,
+0xb44,
+0x1fa20810,
+0x9c4,
+0xb44,
+0x1fa20804,
+0x9c4,
+0xec4,
+0x1fa20810,
+0x9c4,
+0xec4,
+0x1fa20804,
+0xa04,
+0x1fa20810,
+0xa04,
+0x1fa20804,
+0xa44,
+0x1fa20810,
+0xa44,
+0x1fa20804,
+0xa44,
+0x904,
+0x1fa20810,
+0xa44,
+0x904,
+0x1fa20804,
+0xac4,
+0x1fa20808,
+0xac8,
+0x1fa20810,
+0xac4,
+0x1fa20814,
+0xac8,
+0x1fa20804,
+0xac4,
+0xc84,
+0x1fa20810,
+0xac4,
+0xc84,
+0x1fa20804,
+0xb44,
+0x1fa20810,
+0xb44,
+0x1fa20804,
+0xb84,
+0x1fa20810,
+0xb84,
+0x1fa20804,
+0xb84,
+0xc84,
+0x1fa20810,
+0xb84,
+0xc84,
+0x1fa20804,
+0xc44,
+0x1fa20810,
+0xc44,
+0x1fa20804,
+0xc84,
+0x1fa20810,
+0xc84,
+0x1fa20804,
+0xec4,
+0x1fa20810,
+0xec4,
+0x1fa20804,
+0xf04,
+0x1fa20810,
+0xf04,
+0x1fa20804,
+0xf84,
+0x1fa20810,
+0xf84,
+0x1fa20804,
+0x1084,
+0x1fa20810,
+0x1084,
+0x1fa20804,
+0x1084,
+0x984,
+0x1fa20810,
+0x1084,
+0x984,
+0x1fa20804,
+0x1084,
+0x9c4,
+0x1fa20810,
+0x1084,
+0x9c4,
+0x1fa20804,
+0x1104,
+0x1fa20810,
+0x1104,
+0x1fa20808,
+0x4608,
+0x1fa20808,
+0x1fa20808,
+0x1fa20814,
+0x1fa20814,
+0x1fa2083a,
+0x1fbc083a,
+0x1fa20808,
+0x3a60809,
+0x1fd60808,
+0x1fa20808,
+0x4608,
+0x20070808,
+0x1fa20814,
+0x4608,
+0x20070814,
+0x1fa20828,
+0x4628,
+0x20070828,
+0x1fa20808,
+0x4608,
+0x20070808,
+0x904,
+0x1fa20814,
+0x4608,
+0x20070814,
+0x904,
+0x1fa20808,
+0x4608,
+0x20070808,
+0xc84,
+0x1fa20814,
+0x4608,
+0x20070814,
+0xc84,
+0x1fa20838,
+0x27e0839,
+0x21090838,
+0x27e0839,
+0x1fa2083a,
+0x6750839,
+0x21090838,
+0x1fa20808,
+0x213c0808,
+0x1fa20814,
+0x213c0814,
+0x1fa20808,
+0x3a60809,
+0x21d20808,
+0x1fa20814,
+0x3a60809,
+0x21d20814,
+0x1fa20808,
+0x22170808,
+0x1fa20814,
+0x22170814,
+0x1fa2083a,
+0x2217083a,
+0x1fa20808,
+0x22470808,
+0x1fa20814,
+0x22470814,
+0x1fa20808,
+0x4608,
+0x22470808,
+0x1fa20814,
+0x4608,
+0x22470814,
+0x1fa20808,
+0x22700808,
+0x1fa20814,
+0x22700814,
+0x1fa20808,
+0x22e50808,
+0x1fa60804,
+0x1fa70804,
+0x1fa70810,
+0x1fa80804,
+0x1faa0804,
+0x1fab0804,
+0x1fab0828,
+0x1fac0804,
+0x1fad0804,
+0x1fad0810,
+0x1fad0828,
+0x1fb10804,
+0x1fb10808,
+0x1fb10810,
+0x1fb10828,
+0x1fb50804,
+0x1fb60804,
+0x1fb70804,
+0x1fb70810,
+0x1fb70828,
+0x1fbb0804,
+0x1fbc0804,
+0x1fbc0806,
+0x1fbc0808,
+0x3280809,
+0x1fbc0808,
+0x3290809,
+0x1fbc080a,
+0x1fbc080c,
+0x1fbc0810,
+0x1fbc0812,
+0x3280809,
+0x1fbc0814,
+0x3290809,
+0x1fbc0816,
+0x1fbc0818,
+0x1fbc0828,
+0x1fbc083a,
+0x1fbc0804,
+0xb84,
+0x1fbc0810,
+0xb84,
+0x1fbc0804,
+0x1084,
+0x1fbc0810,
+0x1084,
+0x1fbc0804,
+0x1244,
+0x1fbc0810,
+0x1244,
+0x1fbc0838,
+0x1fa20838,
+0x21930838,
+0x1fbc083a,
+0x21800838,
+0x1fc00804,
+0x1fc40804,
+0x1fc40810,
+0x1fc80804,
+0x1fc90804,
+0x1fca0804,
+0x1fcb0804,
+0x1fcb0810,
+0x1fcc0804,
+0x1fcd0804,
+0x1fcd0810,
+0x1fd10804,
+0x1fd10810,
+0x1fd50804,
+0x1fd50808,
+0x1fd50810,
+0x1fd60804,
+0x1fd60806,
+0x1fd60808,
+0x3280809,
+0x1fd60808,
+0x3290809,
+0x1fd6080a,
+0x1fd6080c,
+0x1fd60810,
+0x1fd60812,
+0x52a0809,
+0x1fd60814,
+0x1fd60814,
+0x3280809,
+0x1fd60814,
+0x3290809,
+0x1fd60816,
+0x1fd60818,
+0x1fd60828,
+0x1fd6083a,
+0x1fd60804,
+0x904,
+0x1fd60810,
+0x904,
+0x1fd60804,
+0x9c4,
+0x1fd60810,
+0x9c4,
+0x1fd60804,
+0xa04,
+0x1fd60810,
+0xa04,
+0x1fd60804,
+0xb84,
+0x1fd60810,
+0xb84,
+0x1fd60804,
+0xc04,
+0x1fd60808,
+0xc08,
+0x1fd60810,
+0xc04,
+0x1fd60804,
+0xc04,
+0x904,
+0x1fd60810,
+0xc04,
+0x904,
+0x1fd60838,
+0x1fa20838,
+0x20d60838,
+0x1fd60838,
+0x1fd60838,
+0x1fd60818,
+0x1feb0818,
+0x1fd60838,
+0x1feb0838,
+0x1fd6083a,
+0x6750839,
+0x20c40838,
+0x20510838,
+0x1fd6083a,
+0x20d6083a,
+0x1fd60838,
+0x21090838,
+0x1fd60838,
+0x21090838,
+0x1f9a0838,
+0x1fd60838,
+0x21090838,
+0x1f9b0838,
+0x1fd60808,
+0x3a60809,
+0x213c0808,
+0x1fd6083a,
+0x213c0838,
+0x27e0839,
+0x1fd6083a,
+0x213c083a,
+0x213c083a,
+0x20d6083a,
+0x1fd60808,
+0x3a60809,
+0x22170808,
+0x1fda0804,
+0x1fdb0804,
+0x1fdb0810,
+0x1fdf0804,
+0x1fdf0810,
+0x1fe00804,
+0x1fe10804,
+0x1fe10810,
+0x1fe50804,
+0x1fe50828,
+0x1fe90804,
+0x1fe90810,
+0x1fea0804,
+0x1fea0810,
+0x1feb0804,
+0x1feb0806,
+0x1feb0808,
+0x3280809,
+0x1feb0808,
+0x3290809,
+0x1feb080a,
+0x1feb080c,
+0x1feb0810,
+0x1feb0812,
+0x1feb0814,
+0x3280809,
+0x1feb0814,
+0x3290809,
+0x1feb0816,
+0x1feb0818,
+0x1feb0828,
+0x1feb083a,
+0x1feb0804,
+0xa04,
+0x1feb0810,
+0xa04,
+0x1feb0804,
+0xb84,
+0x1feb0810,
+0xb84,
+0x1feb0804,
+0xc04,
+0x1feb0810,
+0xc04,
+0x1feb0804,
+0xe44,
+0x1feb0810,
+0xe44,
+0x1feb0804,
+0x1084,
+0x1feb0810,
+0x1084,
+0x1feb0804,
+0x1184,
+0x1feb0810,
+0x1184,
+0x1feb0804,
+0x1244,
+0x1feb0810,
+0x1244,
+0x1feb0808,
+0x4608,
+0x1feb0814,
+0x4608,
+0x1feb0828,
+0x4628,
+0x1feb0808,
+0x4648,
+0x1feb0814,
+0x4648,
+0x1feb0838,
+0x1fa20838,
+0x1feb0808,
+0x1fbc0808,
+0x1feb0838,
+0x1fbc083a,
+0x1feb083a,
+0x20ab083a,
+0x1feb0838,
+0x20d60838,
+0x1feb0838,
+0x21090838,
+0x1feb0838,
+0x21090838,
+0x1f9a0838,
+0x1feb0838,
+0x21090838,
+0x1f9b0838,
+0x1feb0808,
+0x22860808,
+0x1feb0814,
+0x22860808,
+0x1feb0814,
+0x22860814,
+0x1feb0808,
+0x22860808,
+0xa08,
+0x1feb0814,
+0x22860808,
+0xa08,
+0x1feb0814,
+0x22860814,
+0xa08,
+0x1feb0808,
+0x22990808,
+0x1feb0808,
+0x22a30808,
+0x1fef0804,
+0x1ff00804,
+0x1ff20804,
+0x1ff30804,
+0x1ff40804,
+0x1ff40810,
+0x1ff80804,
+0x1ff80810,
+0x1ffc0804,
+0x1ffd0804,
+0x1ffd0810,
+0x20010804,
+0x20050804,
+0x20060804,
+0x20070804,
+0x20070806,
+0x20070808,
+0x3280809,
+0x20070808,
+0x3290809,
+0x2007080a,
+0x2007080c,
+0x20070810,
+0x20070812,
+0x3280809,
+0x20070814,
+0x3290809,
+0x20070816,
+0x20070818,
+0x20070828,
+0x2007082a,
+0x2007083a,
+0x20070804,
+0x904,
+0x20070810,
+0x904,
+0x20070804,
+0x944,
+0x20070810,
+0x944,
+0x20070804,
+0x984,
+0x20070810,
+0x984,
+0x20070804,
+0x9c4,
+0x20070810,
+0x9c4,
+0x20070804,
+0x9c4,
+0x904,
+0x20070810,
+0x9c4,
+0x904,
+0x20070804,
+0x9c4,
+0x944,
+0x20070810,
+0x9c4,
+0x944,
+0x20070804,
+0x9c4,
+0xb44,
+0x20070810,
+0x9c4,
+0xb44,
+0x20070804,
+0x9c4,
+0xec4,
+0x20070810,
+0x9c4,
+0xec4,
+0x20070804,
+0xa04,
+0x20070810,
+0xa04,
+0x20070804,
+0xac4,
+0x20070810,
+0xac4,
+0x20070804,
+0xb44,
+0x20070810,
+0xb44,
+0x20070804,
+0xb84,
+0x20070810,
+0xb84,
+0x20070804,
+0xc04,
+0x20070810,
+0xc04,
+0x20070804,
+0xc04,
+0x984,
+0x20070810,
+0xc04,
+0x984,
+0x20070804,
+0xc44,
+0x20070810,
+0xc44,
+0x20070804,
+0xc84,
+0x20070810,
+0xc84,
+0x20070804,
+0xc84,
+0x904,
+0x20070810,
+0xc84,
+0x904,
+0x20070804,
+0xc84,
+0x944,
+0x20070810,
+0xc84,
+0x944,
+0x20070804,
+0xec4,
+0x20070810,
+0xec4,
+0x20070804,
+0xf04,
+0x20070810,
+0xf04,
+0x20070804,
+0xf84,
+0x20070810,
+0xf84,
+0x20070804,
+0x1084,
+0x20070810,
+0x1084,
+0x20070804,
+0x1084,
+0x9c4,
+0x20070810,
+0x1084,
+0x9c4,
+0x20070804,
+0x1184,
+0x20070810,
+0x1184,
+0x20070804,
+0x1204,
+0x20070810,
+0x1204,
+0x20070838,
+0x21930838,
+0x20510838,
+0x20070838,
+0x2247083a,
+0x200b0804,
+0x200c0804,
+0x200d0804,
+0x200e0804,
+0x200e0810,
+0x20120804,
+0x20130804,
+0x20140804,
+0x20150804,
+0x20150810,
+0x2015083a,
+0x20190804,
+0x201a0804,
+0x201a0808,
+0x201a0810,
+0x201a0828,
+0x201a082a,
+0x201e0804,
+0x201f0804,
+0x201f0810,
+0x201f0814,
+0x201f0828,
+0x20230804,
+0x20240804,
+0x20280804,
+0x202c0804,
+0x202c0810,
+0x202c0828,
+0x20300804,
+0x20310804,
+0x20310828,
+0x20320804,
+0x20360804,
+0x203a0804,
+0x203e0804,
+0x20420804,
+0x20420806,
+0x20420808,
+0x3280809,
+0x20420808,
+0x3290809,
+0x2042080a,
+0x2042080c,
+0x20420810,
+0x20420812,
+0x52a0809,
+0x20420814,
+0x3280809,
+0x20420814,
+0x3290809,
+0x20420816,
+0x20420818,
+0x20420828,
+0x2042083a,
+0x20420804,
+0xb84,
+0x20420810,
+0xb84,
+0x20420808,
+0x4648,
+0x20420814,
+0x4648,
+0x20420814,
+0x1fa20814,
+0x22640814,
+0x20420808,
+0x20420808,
+0x20420808,
+0x20420808,
+0x20900808,
+0x20420808,
+0x20420808,
+0x20d60808,
+0x20420808,
+0x20900808,
+0x20420808,
+0x20d60808,
+0x20420838,
+0x21090838,
+0x20420808,
+0x21370808,
+0x2042083a,
+0x2193083a,
+0x2007083a,
+0x2007083a,
+0x20460804,
+0x20470804,
+0x20480804,
+0x20480810,
+0x20490804,
+0x204a0804,
+0x204b0804,
+0x204b0810,
+0x204f0804,
+0x204f0810,
+0x20500804,
+0x20510804,
+0x20510806,
+0x20510808,
+0x3280809,
+0x20510808,
+0x3290809,
+0x2051080a,
+0x2051080c,
+0x20510810,
+0x20510812,
+0x3280809,
+0x20510814,
+0x3290809,
+0x20510816,
+0x20510818,
+0x20510828,
+0x2051083a,
+0x20510804,
+0x904,
+0x20510810,
+0x904,
+0x20510804,
+0x984,
+0x20510810,
+0x984,
+0x20510804,
+0x9c4,
+0x20510810,
+0x9c4,
+0x20510804,
+0xa04,
+0x20510810,
+0xa04,
+0x20510804,
+0xb84,
+0x20510810,
+0xb84,
+0x20510804,
+0xc04,
+0x20510810,
+0xc04,
+0x20510804,
+0xc84,
+0x20510810,
+0xc84,
+0x20510808,
+0xd48,
+0x20510814,
+0xd48,
+0x20510808,
+0x4648,
+0x20510814,
+0x4648,
+0x20510838,
+0x1fa20838,
+0x20d60838,
+0x2051083a,
+0x1fbc083a,
+0x2051083a,
+0x2075083a,
+0x22860838,
+0x2051083a,
+0x216b083a,
+0x1fa20838,
+0x2051083a,
+0x22700838,
+0x20550804,
+0x20550810,
+0x20550828,
+0x20590804,
+0x205a0804,
+0x205a0808,
+0x205e0804,
+0x205e0810,
+0x20620804,
+0x20630804,
+0x20630810,
+0x20670804,
+0x206b0804,
+0x206c0804,
+0x206c0810,
+0x206d0804,
+0x206d0810,
+0x206d0828,
+0x20710804,
+0x20710810,
+0x20750804,
+0x20750806,
+0x20750808,
+0x3280809,
+0x20750808,
+0x3290809,
+0x2075080a,
+0x2075080c,
+0x20750810,
+0x20750812,
+0x3280809,
+0x20750814,
+0x3290809,
+0x20750816,
+0x20750818,
+0x20750828,
+0x2075082a,
+0x2075083a,
+0x20750804,
+0x9c4,
+0x20750810,
+0x9c4,
+0x20750804,
+0xa04,
+0x20750810,
+0xa04,
+0x20750804,
+0xac4,
+0x20750810,
+0xac4,
+0x20750804,
+0xb84,
+0x20750810,
+0xb84,
+0x20750804,
+0xc04,
+0x20750810,
+0xc04,
+0x20750804,
+0xe44,
+0x20750810,
+0xe44,
+0x20750828,
+0xe68,
+0x20750804,
+0x1084,
+0x20750810,
+0x1084,
+0x20750804,
+0x11c4,
+0x20750810,
+0x11c4,
+0x20750804,
+0x1244,
+0x20750838,
+0x1fa20838,
+0x2075083a,
+0x20510838,
+0x2075083a,
+0x216b083a,
+0x20750838,
+0x216b083a,
+0x1fa20838,
+0x2075083a,
+0x2247083a,
+0x2075083a,
+0x22860838,
+0x20790804,
+0x207d0804,
+0x207d0810,
+0x20810804,
+0x20820804,
+0x20820810,
+0x20820828,
+0x20860804,
+0x20860810,
+0x20870804,
+0x20870810,
+0x20890804,
+0x20890810,
+0x20890828,
+0x208a0804,
+0x208e0804,
+0x208f0804,
+0x20900804,
+0x20900806,
+0x20900808,
+0x3280809,
+0x20900808,
+0x3290809,
+0x2090080a,
+0x2090080c,
+0x20900810,
+0x20900812,
+0x20900814,
+0x3280809,
+0x20900814,
+0x3290809,
+0x20900816,
+0x20900818,
+0x20900828,
+0x2090082a,
+0x2090083a,
+0x20900804,
+0x904,
+0x20900810,
+0x904,
+0x20900804,
+0x944,
+0x20900810,
+0x944,
+0x20900804,
+0x984,
+0x20900810,
+0x984,
+0x20900804,
+0x9c4,
+0x20900810,
+0x9c4,
+0x20900804,
+0xa04,
+0x20900810,
+0xa04,
+0x20900804,
+0xac4,
+0x20900810,
+0xac4,
+0x20900804,
+0xac4,
+0x904,
+0x20900810,
+0xac4,
+0x904,
+0x20900804,
+0xb44,
+0x20900810,
+0xb44,
+0x20900810,
+0xb84,
+0x20900804,
+0xc44,
+0x20900810,
+0xc44,
+0x20900804,
+0xc84,
+0x20900810,
+0xc84,
+0x20900804,
+0xec4,
+0x20900810,
+0xec4,
+0x20900804,
+0xf04,
+0x20900810,
+0xf04,
+0x20900804,
+0xf84,
+0x20900810,
+0xf84,
+0x20900804,
+0x1084,
+0x20900810,
+0x1084,
+0x20900804,
+0x1204,
+0x20900810,
+0x1204,
+0x2090083a,
+0x1fd6083a,
+0x2090083a,
+0x1feb083a,
+0x20900808,
+0x20900808,
+0x20900814,
+0x20900814,
+0x20900808,
+0x20900808,
+0x20900808,
+0x20900814,
+0x20900814,
+0x20900814,
+0x20900808,
+0x20ab0808,
+0x20900814,
+0x20ab0814,
+0x20900838,
+0x21180838,
+0x2090083a,
+0x2217083a,
+0x20900808,
+0x22470808,
+0x20900814,
+0x22470814,
+0x20900808,
+0x22640808,
+0x20900814,
+0x22640814,
+0x20940804,
+0x2094080a,
+0x20980804,
+0x20980828,
+0x209c0804,
+0x209d0804,
+0x209e0804,
+0x209e0828,
+0x209f0804,
+0x209f0810,
+0x209f0828,
+0x20a30804,
+0x20a30828,
+0x20a40804,
+0x20a60804,
+0x20a60810,
+0x20a60828,
+0x20aa0804,
+0x20ab0804,
+0x20ab0806,
+0x3280809,
+0x20ab0808,
+0x3290809,
+0x20ab080a,
+0x20ab080c,
+0x20ab0810,
+0x20ab0812,
+0x3280809,
+0x20ab0814,
+0x3290809,
+0x20ab0816,
+0x20ab0818,
+0x20ab0828,
+0x20ab082a,
+0x20ab083a,
+0x20ab0804,
+0x9c4,
+0x20ab0810,
+0x9c4,
+0x20ab0804,
+0xa04,
+0x20af0804,
+0x20af080a,
+0x20b30804,
+0x20b40804,
+0x20b40810,
+0x20b80804,
+0x20b80810,
+0x20b80828,
+0x20bc0804,
+0x20bc0828,
+0x20c00804,
+0x20c40804,
+0x20c40806,
+0x20c40808,
+0x3280809,
+0x20c40808,
+0x3290809,
+0x20c4080a,
+0x20c4080c,
+0x20c40810,
+0x20c40812,
+0x3280809,
+0x20c40814,
+0x3290809,
+0x20c40816,
+0x20c40818,
+0x20c40828,
+0x20c4082a,
+0x20c4083a,
+0x20c40804,
+0x904,
+0x20c40810,
+0x904,
+0x20c40804,
+0xa04,
+0x20c40810,
+0xa04,
+0x20c40804,
+0xc04,
+0x20c40810,
+0xc04,
+0x20c40808,
+0xd48,
+0x20c40814,
+0xd48,
+0x20c40804,
+0x1084,
+0x20c40810,
+0x1084,
+0x20c40804,
+0x1244,
+0x20c40810,
+0x1244,
+0x20c40838,
+0x1fa2083a,
+0x20c4083a,
+0x1fbc083a,
+0x20c40838,
+0x1fd60838,
+0x1fa20838,
+0x20d60838,
+0x20c40838,
+0x20510838,
+0x20c40838,
+0x2075083a,
+0x22860838,
+0x20c4083a,
+0x20c4083a,
+0x20c40838,
+0x20d60838,
+0x20c40838,
+0x21090838,
+0x20c4083a,
+0x2109083a,
+0x20c40838,
+0x21090838,
+0x1f9a0838,
+0x20c40838,
+0x21090838,
+0x1f9b0838,
+0x20c40838,
+0x216b083a,
+0x1fa20838,
+0x20c40838,
+0x21f70838,
+0x20c40838,
+0x2247083a,
+0x20c40838,
+0x2259083a,
+0x20c40838,
+0x2346083a,
+0x20c80804,
+0x20c90804,
+0x20ca0804,
+0x20ca0810,
+0x20ce0804,
+0x20ce0810,
+0x20cf0804,
+0x20cf0810,
+0x20d00804,
+0x20d00810,
+0x20d10804,
+0x20d10810,
+0x20d20804,
+0x20d20810,
+0x20d60804,
+0x20d60806,
+0x20d60808,
+0x3280809,
+0x20d60808,
+0x3290809,
+0x20d6080a,
+0x20d6080c,
+0x20d60810,
+0x20d60812,
+0x20d60814,
+0x3280809,
+0x20d60814,
+0x3290809,
+0x20d60816,
+0x20d60818,
+0x20d60828,
+0x20d6082a,
+0x20d6083a,
+0x20d60804,
+0x904,
+0x20d60810,
+0x904,
+0x20d60804,
+0xa04,
+0x20d60810,
+0xa04,
+0x20d60804,
+0xc04,
+0x20d60810,
+0xc04,
+0x20d60804,
+0xe44,
+0x20d60810,
+0xe44,
+0x20d60804,
+0x1084,
+0x20d60810,
+0x1084,
+0x20d60804,
+0x1084,
+0xc84,
+0x20d60810,
+0x1084,
+0xc84,
+0x20d60804,
+0x1184,
+0x20d60810,
+0x1184,
+0x20d60804,
+0x1244,
+0x20d60810,
+0x1244,
+0x20d60804,
+0x4604,
+0x20d60810,
+0x4604,
+0x20d60808,
+0x20ab0808,
+0x20d60814,
+0x20ab0808,
+0x20d60814,
+0x20ab0814,
+0x20d60808,
+0x20d60808,
+0x20d60814,
+0x20d60814,
+0x20d60838,
+0x21090838,
+0x20d60838,
+0x21180838,
+0x20d60838,
+0x213c0838,
+0x20510838,
+0x20d60808,
+0x21d20808,
+0x20d6083a,
+0x21f7083a,
+0x1feb083a,
+0x20d60838,
+0x22640838,
+0x20d60808,
+0x22860808,
+0x20da0804,
+0x20da0808,
+0x20da0828,
+0x20de0804,
+0x20de0810,
+0x20df0804,
+0x20e00804,
+0x20e00810,
+0x20e10804,
+0x20e10810,
+0x20e50804,
+0x20e50810,
+0x20e60804,
+0x20e60810,
+0x20e60828,
+0x20ea0804,
+0x20ea0808,
+0x20eb0804,
+0x20ec0804,
+0x20ec0810,
+0x20f00804,
+0x20f00828,
+0x20f10804,
+0x20f10828,
+0x20f20804,
+0x20f20828,
+0x20f60804,
+0x20f70804,
+0x20fb0804,
+0x20fc0804,
+0x21000804,
+0x21000810,
+0x21010804,
+0x21050804,
+0x21090804,
+0x21090806,
+0x21090808,
+0x3280809,
+0x21090808,
+0x3290809,
+0x2109080a,
+0x2109080c,
+0x21090810,
+0x21090812,
+0x21090814,
+0x3280809,
+0x21090814,
+0x3290809,
+0x21090816,
+0x21090818,
+0x21090828,
+0x2109082a,
+0x2109083a,
+0x21090804,
+0x904,
+0x21090810,
+0x904,
+0x21090804,
+0xb84,
+0x21090810,
+0xb84,
+0x21090804,
+0x1084,
+0x21090810,
+0x1084,
+0x21090838,
+0x1f9a0838,
+0x21090838,
+0x1f9b0838,
+0x21090838,
+0x1fa2083a,
+0x21090838,
+0x1fbc0838,
+0x2109083a,
+0x1fbc083a,
+0x21090828,
+0x1fd60828,
+0x21090828,
+0x1feb0828,
+0x21090838,
+0x20510838,
+0x2109083a,
+0x2075083a,
+0x22860838,
+0x21090838,
+0x20900838,
+0x20d60838,
+0x21090838,
+0x20d60838,
+0x21090838,
+0x21090838,
+0x21090838,
+0x21090838,
+0x1f9a0838,
+0x21090838,
+0x21090838,
+0x1f9b0838,
+0x21090838,
+0x213c0838,
+0x20d60838,
+0x2109083a,
+0x216b083a,
+0x1fa20838,
+0x21090838,
+0x6750839,
+0x21d20838,
+0x21090838,
+0x21d20838,
+0x21090838,
+0x6750839,
+0x21d20838,
+0x1f9a0838,
+0x21090838,
+0x2247083a,
+0x2109083a,
+0x2247083a,
+0x21090838,
+0x2259083a,
+0x2109083a,
+0x2259083a,
+0x2109083a,
+0x2346083a,
+0x210d0804,
+0x210d0808,
+0x210e0804,
+0x210f0804,
+0x21100804,
+0x21100810,
+0x21100828,
+0x21140804,
+0x21150804,
+0x21160804,
+0x21170804,
+0x21180804,
+0x21180806,
+0x21180808,
+0x3280809,
+0x21180808,
+0x3290809,
+0x2118080a,
+0x2118080c,
+0x21180810,
+0x21180812,
+0x3280809,
+0x21180814,
+0x3290809,
+0x21180816,
+0x21180818,
+0x21180828,
+0x2118082a,
+0x2118083a,
+0x21180804,
+0x904,
+0x21180810,
+0x904,
+0x21180804,
+0x944,
+0x21180810,
+0x944,
+0x21180804,
+0xa04,
+0x21180810,
+0xa04,
+0x21180804,
+0xb44,
+0x21180810,
+0xb44,
+0x21180804,
+0xb84,
+0x21180810,
+0xb84,
+0x21180804,
+0xc04,
+0x21180810,
+0xc04,
+0x21180808,
+0xd48,
+0x21180814,
+0xd48,
+0x21180804,
+0x1084,
+0x21180810,
+0x1084,
+0x21180804,
+0x1184,
+0x21180810,
+0x1184,
+0x21180804,
+0x1244,
+0x21180810,
+0x1244,
+0x21180838,
+0x1fa2083a,
+0x2118083a,
+0x2007083a,
+0x2259083a,
+0x21180838,
+0x2042083a,
+0x2118083a,
+0x2051083a,
+0x21180808,
+0x20ab0808,
+0x21180814,
+0x20ab0808,
+0x21180814,
+0x20ab0814,
+0x21180838,
+0x21090838,
+0x21180814,
+0x213c0808,
+0x21180838,
+0x21d20838,
+0x21180838,
+0x2247083a,
+0x21180838,
+0x2259083a,
+0x211c0804,
+0x211c0808,
+0x211c0828,
+0x21200804,
+0x21210804,
+0x21220804,
+0x21230804,
+0x21230810,
+0x21230828,
+0x21270804,
+0x21270810,
+0x212b0804,
+0x212b0810,
+0x212c0804,
+0x212d0804,
+0x212d0828,
+0x21310804,
+0x21350804,
+0x21360804,
+0x21370804,
+0x21370810,
+0x21370828,
+0x213b0804,
+0x213c0804,
+0x213c0806,
+0x213c0808,
+0x3280809,
+0x213c0808,
+0x3290809,
+0x213c080a,
+0x213c080c,
+0x213c0810,
+0x213c0812,
+0x3280809,
+0x213c0814,
+0x3290809,
+0x213c0816,
+0x213c0818,
+0x213c0828,
+0x213c082a,
+0x213c083a,
+0x213c0804,
+0x904,
+0x213c0810,
+0x904,
+0x213c0804,
+0x944,
+0x213c0810,
+0x944,
+0x213c0804,
+0x984,
+0x213c0810,
+0x984,
+0x213c0804,
+0x9c4,
+0x213c0810,
+0x9c4,
+0x213c0804,
+0x9c4,
+0x904,
+0x213c0810,
+0x9c4,
+0x904,
+0x213c0804,
+0x9c4,
+0x944,
+0x213c0810,
+0x9c4,
+0x944,
+0x213c0804,
+0x9c4,
+0xb44,
+0x213c0810,
+0x9c4,
+0xb44,
+0x213c0804,
+0x9c4,
+0xec4,
+0x213c0810,
+0x9c4,
+0xec4,
+0x213c0804,
+0xa04,
+0x213c0810,
+0xa04,
+0x213c0804,
+0xac4,
+0x213c0808,
+0xac8,
+0x213c0810,
+0xac4,
+0x213c0814,
+0xac8,
+0x213c0804,
+0xac4,
+0xc84,
+0x213c0810,
+0xac4,
+0xc84,
+0x213c0804,
+0xb04,
+0x213c0810,
+0xb04,
+0x213c0804,
+0xb44,
+0x213c0810,
+0xb44,
+0x213c0804,
+0xb44,
+0x904,
+0x213c0810,
+0xb44,
+0x904,
+0x213c0804,
+0xb44,
+0xac4,
+0x213c0810,
+0xb44,
+0xac4,
+0x213c0804,
+0xb44,
+0xc84,
+0x213c0810,
+0xb44,
+0xc84,
+0x213c0804,
+0xb84,
+0x213c0810,
+0xb84,
+0x213c0804,
+0xb84,
+0xc84,
+0x213c0810,
+0xb84,
+0xc84,
+0x213c0804,
+0xbc4,
+0x213c0810,
+0xbc4,
+0x213c0804,
+0xbc4,
+0x904,
+0x213c0810,
+0xbc4,
+0x904,
+0x213c0804,
+0xc44,
+0x213c0810,
+0xc44,
+0x213c0804,
+0xc44,
+0xc84,
+0x213c0810,
+0xc44,
+0xc84,
+0x213c0804,
+0xc84,
+0x213c0810,
+0xc84,
+0x213c0804,
+0xc84,
+0x904,
+0x213c0810,
+0xc84,
+0x904,
+0x213c0804,
+0xc84,
+0x944,
+0x213c0810,
+0xc84,
+0x944,
+0x213c0808,
+0xd08,
+0x213c0804,
+0xec4,
+0x213c0810,
+0xec4,
+0x213c0804,
+0xf04,
+0x213c0810,
+0xf04,
+0x213c0804,
+0xf84,
+0x213c0810,
+0xf84,
+0x213c0804,
+0xfc4,
+0x213c0810,
+0xfc4,
+0x213c0804,
+0xfc4,
+0x904,
+0x213c0810,
+0xfc4,
+0x904,
+0x213c0804,
+0xfc4,
+0x944,
+0x213c0810,
+0xfc4,
+0x944,
+0x213c0804,
+0xfc4,
+0xb44,
+0x213c0810,
+0xfc4,
+0xb44,
+0x213c0804,
+0xfc4,
+0xec4,
+0x213c0810,
+0xfc4,
+0xec4,
+0x213c0804,
+0xfc4,
+0x1084,
+0x213c0810,
+0xfc4,
+0x1084,
+0x213c0804,
+0x1084,
+0x213c0810,
+0x1084,
+0x213c0804,
+0x1084,
+0x9c4,
+0x213c0810,
+0x1084,
+0x9c4,
+0x213c0808,
+0x4608,
+0x20070808,
+0x213c0814,
+0x4608,
+0x20070814,
+0x213c0828,
+0x4628,
+0x20070828,
+0x213c083a,
+0x20c4083a,
+0x213c0808,
+0x213c0808,
+0x213c0814,
+0x213c0814,
+0x213c0838,
+0x2247083a,
+0x21400804,
+0x21410804,
+0x21420804,
+0x21430804,
+0x21470804,
+0x21480804,
+0x21490804,
+0x214a0804,
+0x214b0804,
+0x214c0804,
+0x214d0804,
+0x214e0804,
+0x214f0804,
+0x214f0810,
+0x214f0828,
+0x21530804,
+0x21540804,
+0x21550804,
+0x21560804,
+0x21570804,
+0x21580804,
+0x21580810,
+0x21590804,
+0x21590828,
+0x215a0804,
+0x215a0828,
+0x215b0804,
+0x215c0804,
+0x215c0810,
+0x215c0828,
+0x21600804,
+0x21600810,
+0x21610804,
+0x21650804,
+0x21650810,
+0x21660804,
+0x21660810,
+0x2166083a,
+0x216a0804,
+0x216b0804,
+0x216b0806,
+0x216b0808,
+0x3280809,
+0x216b0808,
+0x3290809,
+0x216b080a,
+0x216b080c,
+0x216b0810,
+0x216b0812,
+0x3280809,
+0x216b0814,
+0x3290809,
+0x216b0816,
+0x216b0818,
+0x216b0828,
+0x216b082a,
+0x216b083a,
+0x216b0804,
+0x904,
+0x216b0810,
+0x904,
+0x216b0804,
+0xb84,
+0x216b0810,
+0xb84,
+0x216b0838,
+0x1fa2083a,
+0x216b083a,
+0x1fa20838,
+0x216b083a,
+0x1fa2083a,
+0x216b0838,
+0x1fd60838,
+0x216b0838,
+0x2042083a,
+0x216b083a,
+0x2075083a,
+0x216b0838,
+0x27e0839,
+0x21090838,
+0x27e0839,
+0x216b083a,
+0x216b083a,
+0x2109083a,
+0x216b083a,
+0x216b083a,
+0x2247083a,
+0x216b083a,
+0x2193083a,
+0x216b0838,
+0x21d20838,
+0x216b083a,
+0x21f7083a,
+0x2007083a,
+0x216b0838,
+0x2247083a,
+0x216b0838,
+0x2259083a,
+0x216f0804,
+0x21700804,
+0x21700810,
+0x21710804,
+0x21710810,
+0x21720804,
+0x21730804,
+0x21740804,
+0x21740810,
+0x21780804,
+0x21780810,
+0x21790804,
+0x21790810,
+0x217a0804,
+0x217b0804,
+0x217b0828,
+0x217f0804,
+0x21800804,
+0x21800806,
+0x3280809,
+0x21800808,
+0x3290809,
+0x2180080a,
+0x2180080c,
+0x21800810,
+0x21800812,
+0x3280809,
+0x21800814,
+0x3290809,
+0x21800816,
+0x21800818,
+0x2180083a,
+0x21800808,
+0x216b0808,
+0x21850804,
+0x21850810,
+0x21860804,
+0x21860810,
+0x21870804,
+0x218b0804,
+0x218b0810,
+0x218f0804,
+0x21930804,
+0x21930806,
+0x21930808,
+0x3280809,
+0x21930808,
+0x3290809,
+0x2193080a,
+0x2193080c,
+0x21930810,
+0x21930812,
+0x3280809,
+0x21930814,
+0x3290809,
+0x21930816,
+0x21930818,
+0x21930828,
+0x2193082a,
+0x2193083a,
+0x21930804,
+0x904,
+0x21930810,
+0x904,
+0x21930804,
+0xa04,
+0x21930810,
+0xa04,
+0x21930804,
+0xb84,
+0x21930810,
+0xb84,
+0x21930804,
+0xc04,
+0x21930810,
+0xc04,
+0x21930808,
+0xd48,
+0x21930814,
+0xd48,
+0x21930804,
+0xf04,
+0x21930810,
+0xf04,
+0x21930804,
+0xf84,
+0x21930810,
+0xf84,
+0x21930804,
+0x1084,
+0x21930810,
+0x1084,
+0x21930804,
+0x1084,
+0xc84,
+0x21930810,
+0x1084,
+0xc84,
+0x21930804,
+0x1244,
+0x21930810,
+0x1244,
+0x21930808,
+0x4648,
+0x21930814,
+0x4648,
+0x21930838,
+0x1fa20838,
+0x1feb0838,
+0x21930838,
+0x1fa20838,
+0x1feb0838,
+0x6750839,
+0x21d20838,
+0x21930838,
+0x1fa20838,
+0x1feb0838,
+0x6750839,
+0x21d20838,
+0x1f9a0838,
+0x21930814,
+0x21d20808,
+0x21970804,
+0x21980804,
+0x21980808,
+0x21980810,
+0x219c0804,
+0x219d0804,
+0x219d0808,
+0x219d0810,
+0x219e0804,
+0x219f0804,
+0x219f0810,
+0x21a30804,
+0x21a40804,
+0x21a40828,
+0x21a80804,
+0x21a90804,
+0x21ad0804,
+0x21ae0804,
+0x21ae0828,
+0x21b20804,
+0x21b30804,
+0x21b70804,
+0x21b70810,
+0x21bb0804,
+0x21bc0804,
+0x21c00804,
+0x21c10804,
+0x21c50804,
+0x21c60804,
+0x21c70804,
+0x21c80804,
+0x21c90804,
+0x21ca0804,
+0x21ca0828,
+0x21cf0804,
+0x21d00804,
+0x21d10804,
+0x21d10810,
+0x21d20804,
+0x21d20806,
+0x21d20808,
+0x3280809,
+0x21d20808,
+0x3290809,
+0x21d2080a,
+0x21d2080c,
+0x21d20810,
+0x21d20812,
+0x3280809,
+0x21d20814,
+0x3290809,
+0x38a0809,
+0x21d20814,
+0x38b0809,
+0x21d20816,
+0x21d20818,
+0x21d20828,
+0x21d2082a,
+0x21d2083a,
+0x21d20804,
+0x904,
+0x21d20810,
+0x904,
+0x21d20804,
+0x904,
+0xb84,
+0x21d20810,
+0x904,
+0xb84,
+0x21d20804,
+0x9c4,
+0x21d20810,
+0x9c4,
+0x21d20804,
+0xa04,
+0x21d20810,
+0xa04,
+0x21d20804,
+0xa04,
+0xb84,
+0x21d20810,
+0xa04,
+0xb84,
+0x21d20804,
+0xb84,
+0x21d20810,
+0xb84,
+0x21d20804,
+0xc04,
+0x21d20810,
+0xc04,
+0x21d20808,
+0xd48,
+0x21d20814,
+0xd48,
+0x21d20804,
+0x1084,
+0x21d20810,
+0x1084,
+0x21d20804,
+0x1084,
+0xb84,
+0x21d20810,
+0x1084,
+0xb84,
+0x21d20804,
+0x1144,
+0x21d20810,
+0x1144,
+0x21d20808,
+0x4648,
+0x21d20814,
+0x4648,
+0x21d20808,
+0x4648,
+0xb84,
+0x21d2083a,
+0x1fa2083a,
+0x21d2083a,
+0x1feb083a,
+0x21d20828,
+0x21090828,
+0x21d2083a,
+0x213c083a,
+0x21d2083a,
+0x21d20838,
+0x21930838,
+0x21d2083a,
+0x21d2083a,
+0x21d20808,
+0x4608,
+0x21d20808,
+0x21d20814,
+0x4608,
+0x21d20814,
+0x21d20808,
+0x21f70808,
+0x21d20808,
+0x4648,
+0x21f70808,
+0x21d2083a,
+0x22470838,
+0x21d60804,
+0x21d80804,
+0x21d90804,
+0x21da0804,
+0x21da0828,
+0x21de0804,
+0x21de0810,
+0x21e20804,
+0x21e30804,
+0x21e40804,
+0x21e40808,
+0x21e40810,
+0x21e40828,
+0x21e80804,
+0x21e90804,
+0x21ea0804,
+0x21ee0804,
+0x21f20804,
+0x21f30804,
+0x21f70804,
+0x21f70806,
+0x21f70808,
+0x3280809,
+0x21f70808,
+0x3290809,
+0x21f7080a,
+0x21f7080c,
+0x21f70810,
+0x21f70812,
+0x3280809,
+0x21f70814,
+0x3290809,
+0x21f70816,
+0x21f70818,
+0x21f70828,
+0x21f7082a,
+0x21f7083a,
+0x21f70804,
+0xa04,
+0x21f70810,
+0xa04,
+0x21f70804,
+0xac4,
+0x21f70804,
+0xb84,
+0x21f70810,
+0xb84,
+0x21f70804,
+0xc04,
+0x21f70810,
+0xc04,
+0x21f70804,
+0x1084,
+0x21f70810,
+0x1084,
+0x21f70804,
+0x1144,
+0x21f70810,
+0x1144,
+0x21f70804,
+0x1184,
+0x21f70810,
+0x1184,
+0x21f70804,
+0x1244,
+0x21f70810,
+0x1244,
+0x21f70808,
+0x4648,
+0x21f70814,
+0x4648,
+0x21f70808,
+0x1fe50808,
+0x21f70814,
+0x20070814,
+0x20d60814,
+0x21f70808,
+0x4608,
+0x20750808,
+0x21f7083a,
+0x2075083a,
+0x22860838,
+0x21f70828,
+0x21090828,
+0x21f70808,
+0x21d20808,
+0x21f70808,
+0x21e40808,
+0x21f70808,
+0x22860808,
+0x21f70814,
+0x22860808,
+0x21fb0804,
+0x21fc0804,
+0x21fc0810,
+0x22000804,
+0x22000810,
+0x22010804,
+0x22020804,
+0x22020828,
+0x22060804,
+0x22060810,
+0x220a0804,
+0x220a0810,
+0x220e0804,
+0x22120804,
+0x22130804,
+0x22130810,
+0x22170804,
+0x22170806,
+0x22170808,
+0x3280809,
+0x22170808,
+0x3290809,
+0x2217080a,
+0x2217080c,
+0x22170810,
+0x22170812,
+0x3280809,
+0x22170814,
+0x3290809,
+0x22170816,
+0x22170818,
+0x22170828,
+0x2217082a,
+0x2217083a,
+0x22170804,
+0x904,
+0x22170810,
+0x904,
+0x22170804,
+0x944,
+0x22170810,
+0x944,
+0x22170804,
+0x984,
+0x22170810,
+0x984,
+0x22170804,
+0x9c4,
+0x22170810,
+0x9c4,
+0x22170804,
+0xa04,
+0x22170810,
+0xa04,
+0x22170804,
+0xa44,
+0x22170810,
+0xa44,
+0x22170804,
+0xac4,
+0x22170808,
+0xac8,
+0x22170810,
+0xac4,
+0x22170814,
+0xac8,
+0x22170804,
+0xac4,
+0x904,
+0x22170810,
+0xac4,
+0x904,
+0x22170804,
+0xac4,
+0x944,
+0x22170810,
+0xac4,
+0x944,
+0x22170804,
+0xac4,
+0xa04,
+0x22170810,
+0xac4,
+0xa04,
+0x22170804,
+0xac4,
+0xc84,
+0x22170810,
+0xac4,
+0xc84,
+0x22170804,
+0xb04,
+0x22170810,
+0xb04,
+0x22170804,
+0xb44,
+0x22170810,
+0xb44,
+0x22170804,
+0xb44,
+0x904,
+0x22170810,
+0xb44,
+0x904,
+0x22170804,
+0xc44,
+0x22170810,
+0xc44,
+0x22170804,
+0xc84,
+0x22170810,
+0xc84,
+0x22170804,
+0xc84,
+0xac4,
+0x22170810,
+0xc84,
+0xac4,
+0x22170808,
+0xd08,
+0x22170804,
+0xec4,
+0x22170810,
+0xec4,
+0x22170804,
+0xf04,
+0x22170810,
+0xf04,
+0x22170804,
+0xf84,
+0x22170810,
+0xf84,
+0x22170804,
+0xfc4,
+0x22170810,
+0xfc4,
+0x22170804,
+0xfc4,
+0x904,
+0x22170810,
+0xfc4,
+0x904,
+0x22170804,
+0xfc4,
+0x944,
+0x22170810,
+0xfc4,
+0x944,
+0x22170804,
+0xfc4,
+0xb44,
+0x22170810,
+0xfc4,
+0xb44,
+0x22170804,
+0xfc4,
+0xec4,
+0x22170810,
+0xfc4,
+0xec4,
+0x22170804,
+0xfc4,
+0x1084,
+0x22170810,
+0xfc4,
+0x1084,
+0x22170804,
+0x1084,
+0x22170810,
+0x1084,
+0x22170804,
+0x10c4,
+0x22170810,
+0x10c4,
+0x22170804,
+0x1184,
+0x22170810,
+0x1184,
+0x22170804,
+0x1204,
+0x22170810,
+0x1204,
+0x2217083a,
+0x216b083a,
+0x2670839,
+0x221b0804,
+0x221b0828,
+0x221c0804,
+0x221d0804,
+0x221d0828,
+0x221e0804,
+0x221f0804,
+0x22200804,
+0x22210804,
+0x22220804,
+0x22220810,
+0x22220828,
+0x22260804,
+0x22280804,
+0x22290804,
+0x222a0804,
+0x222a0828,
+0x222c0804,
+0x222c0810,
+0x222c0828,
+0x22300804,
+0x22340804,
+0x22380804,
+0x22380810,
+0x22380828,
+0x223c0804,
+0x223d0804,
+0x223e0804,
+0x223e0828,
+0x22420804,
+0x22420810,
+0x22420828,
+0x22460804,
+0x22470804,
+0x22470806,
+0x22470808,
+0x3280809,
+0x22470808,
+0x3290809,
+0x2247080a,
+0x2247080c,
+0x22470810,
+0x22470812,
+0x22470814,
+0x3280809,
+0x22470814,
+0x3290809,
+0x22470816,
+0x22470818,
+0x22470828,
+0x2247082a,
+0x2247083a,
+0x22470804,
+0xb44,
+0x22470810,
+0xb44,
+0x22470804,
+0x1084,
+0x22470810,
+0x1084,
+0x22470808,
+0x20900808,
+0x22470814,
+0x20900814,
+0x22470808,
+0x20900808,
+0x20900808,
+0x22470814,
+0x20900814,
+0x20900814,
+0x22470808,
+0x20900808,
+0x20900808,
+0x20900808,
+0x22470814,
+0x20900814,
+0x20900814,
+0x20900814,
+0x2247083a,
+0x6750839,
+0x21090838,
+0x2247083a,
+0x21d2083a,
+0x22470808,
+0x22700808,
+0x22470814,
+0x22700814,
+0x224b0804,
+0x224c0804,
+0x224c0810,
+0x224d0804,
+0x224e0804,
+0x224e0810,
+0x224e0828,
+0x22520804,
+0x22530804,
+0x22540804,
+0x22540810,
+0x22550804,
+0x22550810,
+0x22550828,
+0x22590804,
+0x22590806,
+0x22590808,
+0x3280809,
+0x22590808,
+0x3290809,
+0x2259080a,
+0x2259080c,
+0x22590810,
+0x22590812,
+0x3280809,
+0x22590814,
+0x3290809,
+0x22590816,
+0x22590818,
+0x22590828,
+0x2259083a,
+0x22590804,
+0x904,
+0x22590810,
+0x904,
+0x22590804,
+0x944,
+0x22590810,
+0x944,
+0x22590804,
+0x9c4,
+0x22590810,
+0x9c4,
+0x22590804,
+0xa44,
+0x22590804,
+0xac4,
+0x22590810,
+0xac4,
+0x22590804,
+0xb84,
+0x22590810,
+0xb84,
+0x22590804,
+0x1084,
+0x22590810,
+0x1084,
+0x2259083a,
+0x1fbc0838,
+0x2259083a,
+0x1fd6083a,
+0x22590818,
+0x22860818,
+0x225d0804,
+0x225f0804,
+0x225f0810,
+0x22600804,
+0x22640804,
+0x22640806,
+0x22640808,
+0x3280809,
+0x22640808,
+0x3290809,
+0x2264080a,
+0x2264080c,
+0x22640810,
+0x22640812,
+0x22640814,
+0x3280809,
+0x22640814,
+0x3290809,
+0x22640816,
+0x22640818,
+0x22640828,
+0x2264082a,
+0x2264083a,
+0x22640804,
+0xac4,
+0x22640810,
+0xac4,
+0x22640804,
+0xb84,
+0x22640810,
+0xb84,
+0x22640808,
+0x20900808,
+0x22640814,
+0x20900814,
+0x22640808,
+0x20900808,
+0x20900808,
+0x22640814,
+0x20900814,
+0x20900814,
+0x22680804,
+0x22690804,
+0x226a0804,
+0x226b0804,
+0x226c0804,
+0x226d0804,
+0x226d0810,
+0x226e0804,
+0x226f0804,
+0x22700804,
+0x22700806,
+0x3280809,
+0x22700808,
+0x3290809,
+0x2270080a,
+0x2270080c,
+0x22700810,
+0x22700812,
+0x3280809,
+0x22700814,
+0x3290809,
+0x22700816,
+0x22700818,
+0x22700828,
+0x2270083a,
+0x22700804,
+0x904,
+0x22700810,
+0x904,
+0x22700804,
+0x944,
+0x22700810,
+0x944,
+0x22700804,
+0x9c4,
+0x22700810,
+0x9c4,
+0x22700804,
+0xa44,
+0x22700804,
+0xac4,
+0x22700810,
+0xac4,
+0x22700804,
+0xb44,
+0x22700810,
+0xb44,
+0x22700804,
+0xb84,
+0x22700810,
+0xb84,
+0x22700804,
+0xc84,
+0x22700810,
+0xc84,
+0x22700804,
+0xec4,
+0x22700810,
+0xec4,
+0x22700804,
+0x1084,
+0x22700810,
+0x1084,
+0x22740804,
+0x22780804,
+0x22780810,
+0x227c0804,
+0x227c0810,
+0x22800804,
+0x22800810,
+0x22810804,
+0x22820804,
+0x22820810,
+0x22860804,
+0x22860806,
+0x22860808,
+0x3280809,
+0x22860808,
+0x3290809,
+0x2286080a,
+0x2286080c,
+0x22860810,
+0x22860812,
+0x3280809,
+0x22860814,
+0x3290809,
+0x22860816,
+0x22860818,
+0x22860828,
+0x2286083a,
+0x22860804,
+0x904,
+0x22860810,
+0x904,
+0x22860804,
+0x9c4,
+0x22860810,
+0x9c4,
+0x22860804,
+0xa04,
+0x22860810,
+0xa04,
+0x22860804,
+0xb84,
+0x22860810,
+0xb84,
+0x22860804,
+0x1084,
+0x22860810,
+0x1084,
+0x22860804,
+0x1244,
+0x22860810,
+0x1244,
+0x22860808,
+0x22590808,
+0x228a0804,
+0x228b0804,
+0x228b0810,
+0x228f0804,
+0x22900804,
+0x22910804,
+0x22910810,
+0x22950804,
+0x22950828,
+0x22990804,
+0x22990828,
+0x229d0804,
+0x229d0810,
+0x22a10804,
+0x22a10810,
+0x22a20804,
+0x22a20810,
+0x22a30804,
+0x22a30810,
+0x22a30828,
+0x22a30804,
+0xa04,
+0x22a30810,
+0xa04,
+0x22a70804,
+0x22a80804,
+0x22a80810,
+0x22ac0804,
+0x22ad0804,
+0x22b10804,
+0x22b50804,
+0x22b50810,
+0x22b90804,
+0x22b90810,
+0x22ba0804,
+0x22ba0810,
+0x22bb0804,
+0x22bb0810,
+0x22bf0804,
+0x22bf0810,
+0x22c00804,
+0x22c10804,
+0x22c20804,
+0x22c30804,
+0x22c30810,
+0x22c40804,
+0x22c40810,
+0x22c50804,
+0x22c50808,
+0x22c50810,
+0x22c50828,
+0x22c60804,
+0x22c70804,
+0x22cb0804,
+0x22cb0810,
+0x22cc0804,
+0x22cc0810,
+0x22cd0804,
+0x22cd0810,
+0x22ce0804,
+0x22ce0810,
+0x22d20804,
+0x22d20810,
+0x22d60804,
+0x22d60810,
+0x22da0804,
+0x22de0804,
+0x22de0810,
+0x22e20804,
+0x22e30804,
+0x22e30808,
+0x21180808,
+0x22e40804,
+0x22e50804,
+0x22e60804,
+0x22e60810,
+0x22e70804,
+0x22e70810,
+0x22e80804,
+0x22e90804,
+0x22e90828,
+0x22ed0804,
+0x22ee0804,
+0x22ef0804,
+0x22f00804,
+0x22f00828,
+0x22f10804,
+0x22f10810,
+0x22f20804,
+0x22f60804,
+0x22fa0804,
+0x22fe0804,
+0x23020804,
+0x23060804,
+0x230a0804,
+0x230e0804,
+0x23120804,
+0x23160804,
+0x231a0804,
+0x231e0804,
+0x231e080a,
+0x231e0810,
+0x231e0816,
+0x231e0804,
+0x884,
+0x231e0810,
+0x884,
+0x231e0804,
+0x884,
+0x904,
+0x231e0810,
+0x884,
+0x904,
+0x231e0804,
+0x884,
+0x904,
+0x1304,
+0x231e0810,
+0x884,
+0x904,
+0x1304,
+0x231e0804,
+0x884,
+0x944,
+0x231e0810,
+0x884,
+0x944,
+0x231e0804,
+0x884,
+0x944,
+0x1304,
+0x231e0810,
+0x884,
+0x944,
+0x1304,
+0x231e0804,
+0x884,
+0xa84,
+0x231e0810,
+0x884,
+0xa84,
+0x231e0804,
+0x884,
+0xa84,
+0x1304,
+0x231e0810,
+0x884,
+0xa84,
+0x1304,
+0x231e0804,
+0x884,
+0x1304,
+0x231e0810,
+0x884,
+0x1304,
+0x231e0804,
+0x8c4,
+0x231e0810,
+0x8c4,
+0x231e0804,
+0x8c4,
+0x904,
+0x231e0810,
+0x8c4,
+0x904,
+0x231e0804,
+0x8c4,
+0x904,
+0x1304,
+0x231e0810,
+0x8c4,
+0x904,
+0x1304,
+0x231e0804,
+0x8c4,
+0x944,
+0x231e0810,
+0x8c4,
+0x944,
+0x231e0804,
+0x8c4,
+0x944,
+0x1304,
+0x231e0810,
+0x8c4,
+0x944,
+0x1304,
+0x231e0804,
+0x8c4,
+0xa84,
+0x231e0810,
+0x8c4,
+0xa84,
+0x231e0804,
+0x8c4,
+0xa84,
+0x1304,
+0x231e0810,
+0x8c4,
+0xa84,
+0x1304,
+0x231e0804,
+0x8c4,
+0x1304,
+0x231e0810,
+0x8c4,
+0x1304,
+0x231e0804,
+0x904,
+0x231e0810,
+0x904,
+0x231e0804,
+0x904,
+0x1304,
+0x231e0804,
+0x944,
+0x231e0810,
+0x944,
+0x231e0804,
+0x944,
+0x1304,
+0x231e0804,
+0x984,
+0x231e0810,
+0x984,
+0x231e0804,
+0xa84,
+0x231e0804,
+0xa84,
+0x1304,
+0x231e0804,
+0xc84,
+0x231e0810,
+0xc84,
+0x231e0804,
+0x1304,
+0x231e0810,
+0x1304,
+0x231f0804,
+0x231f0808,
+0x231f080a,
+0x231f0810,
+0x231f0816,
+0x231f0828,
+0x231f082a,
+0x23200804,
+0x2320080a,
+0x23200810,
+0x23200816,
+0x23200828,
+0x2320082a,
+0x23210804,
+0x23220804,
+0x2322080a,
+0x23220810,
+0x23220816,
+0x23220828,
+0x23230804,
+0x23230808,
+0x2323080a,
+0x23230810,
+0x23230816,
+0x23230804,
+0x884,
+0x23230810,
+0x884,
+0x23230804,
+0x884,
+0x904,
+0x23230810,
+0x884,
+0x904,
+0x23230804,
+0x884,
+0x944,
+0x23230810,
+0x884,
+0x944,
+0x23230804,
+0x8c4,
+0x23230810,
+0x8c4,
+0x23230804,
+0x8c4,
+0x904,
+0x23230810,
+0x8c4,
+0x904,
+0x23230804,
+0x8c4,
+0x944,
+0x23230810,
+0x8c4,
+0x944,
+0x23230804,
+0x904,
+0x23230810,
+0x904,
+0x23230804,
+0x944,
+0x23230810,
+0x944,
+0x23240804,
+0x2324080a,
+0x23240810,
+0x23240816,
+0x23250804,
+0x23250810,
+0x23260804,
+0x23260810,
+0x23270804,
+0x2327080a,
+0x23270810,
+0x23270816,
+0x23280804,
+0x23280810,
+0x23290804,
+0x2329080a,
+0x23290810,
+0x23290816,
+0x23290804,
+0x884,
+0x23290810,
+0x884,
+0x23290804,
+0x884,
+0x904,
+0x23290810,
+0x884,
+0x904,
+0x23290804,
+0x884,
+0x904,
+0x1304,
+0x23290810,
+0x884,
+0x904,
+0x1304,
+0x23290804,
+0x884,
+0x944,
+0x23290810,
+0x884,
+0x944,
+0x23290804,
+0x884,
+0x944,
+0x1304,
+0x23290810,
+0x884,
+0x944,
+0x1304,
+0x23290804,
+0x884,
+0xa84,
+0x23290810,
+0x884,
+0xa84,
+0x23290804,
+0x884,
+0xa84,
+0x1304,
+0x23290810,
+0x884,
+0xa84,
+0x1304,
+0x23290804,
+0x884,
+0x1304,
+0x23290810,
+0x884,
+0x1304,
+0x23290804,
+0x8c4,
+0x23290810,
+0x8c4,
+0x23290804,
+0x8c4,
+0x904,
+0x23290810,
+0x8c4,
+0x904,
+0x23290804,
+0x8c4,
+0x904,
+0x1304,
+0x23290810,
+0x8c4,
+0x904,
+0x1304,
+0x23290804,
+0x8c4,
+0x944,
+0x23290810,
+0x8c4,
+0x944,
+0x23290804,
+0x8c4,
+0x944,
+0x1304,
+0x23290810,
+0x8c4,
+0x944,
+0x1304,
+0x23290804,
+0x8c4,
+0xa84,
+0x23290810,
+0x8c4,
+0xa84,
+0x23290804,
+0x8c4,
+0xa84,
+0x1304,
+0x23290810,
+0x8c4,
+0xa84,
+0x1304,
+0x23290804,
+0x8c4,
+0x1304,
+0x23290810,
+0x8c4,
+0x1304,
+0x23290804,
+0x904,
+0x23290810,
+0x904,
+0x23290804,
+0x904,
+0x1304,
+0x23290804,
+0x944,
+0x23290810,
+0x944,
+0x23290804,
+0x944,
+0x1304,
+0x23290804,
+0xa84,
+0x23290804,
+0xa84,
+0x1304,
+0x23290804,
+0x1304,
+0x23290810,
+0x1304,
+0x232a0804,
+0x232a0808,
+0x232a080a,
+0x232a0810,
+0x232a0814,
+0x232a0816,
+0x232a0828,
+0x232b0804,
+0x232b0808,
+0x232b080a,
+0x232b0810,
+0x232b0816,
+0x232b0804,
+0x884,
+0x232b0810,
+0x884,
+0x232b0804,
+0x884,
+0x904,
+0x232b0810,
+0x884,
+0x904,
+0x232b0804,
+0x884,
+0x944,
+0x232b0810,
+0x884,
+0x944,
+0x232b0804,
+0x884,
+0xa84,
+0x232b0810,
+0x884,
+0xa84,
+0x232b0804,
+0x8c4,
+0x232b0810,
+0x8c4,
+0x232b0804,
+0x8c4,
+0x904,
+0x232b0810,
+0x8c4,
+0x904,
+0x232b0804,
+0x8c4,
+0x944,
+0x232b0810,
+0x8c4,
+0x944,
+0x232b0804,
+0x8c4,
+0xa84,
+0x232b0810,
+0x8c4,
+0xa84,
+0x232b0804,
+0x904,
+0x232b0810,
+0x904,
+0x232b0804,
+0x944,
+0x232b0810,
+0x944,
+0x232b0804,
+0x984,
+0x232b0810,
+0x984,
+0x232b0804,
+0xa84,
+0x232b0804,
+0xac4,
+0x232b0810,
+0xac4,
+0x232b0804,
+0xac4,
+0x904,
+0x232b0804,
+0xac4,
+0x944,
+0x232b0804,
+0xac4,
+0xa84,
+0x232b0804,
+0xc84,
+0x232b0810,
+0xc84,
+0x232c0804,
+0x232c0810,
+0x232d0804,
+0x232d0808,
+0x232d080a,
+0x232d0810,
+0x232d0816,
+0x232d0808,
+0x231e0808,
+0x232b0808,
+0x232d0814,
+0x231e0808,
+0x232b0808,
+0x232e0804,
+0x232e080a,
+0x232e0810,
+0x232e0816,
+0x232f0804,
+0x23300804,
+0x23300808,
+0x2330080a,
+0x23300810,
+0x23300816,
+0x23300838,
+0x1fa2083a,
+0x23300838,
+0x2042083a,
+0x23300838,
+0x20510838,
+0x23300838,
+0x20d60838,
+0x23300838,
+0x21090838,
+0x23300838,
+0x21d20838,
+0x23300838,
+0x2247083a,
+0x23300838,
+0x2259083a,
+0x23310804,
+0x2331080a,
+0x23310810,
+0x23310816,
+0x23320804,
+0x2332080a,
+0x23320810,
+0x23320816,
+0x23330804,
+0x2333080a,
+0x23330810,
+0x23330816,
+0x23330804,
+0x884,
+0x23330810,
+0x884,
+0x23330804,
+0x884,
+0x904,
+0x23330810,
+0x884,
+0x904,
+0x23330804,
+0x884,
+0x944,
+0x23330810,
+0x884,
+0x944,
+0x23330804,
+0x8c4,
+0x23330810,
+0x8c4,
+0x23330804,
+0x8c4,
+0x904,
+0x23330810,
+0x8c4,
+0x904,
+0x23330804,
+0x8c4,
+0x944,
+0x23330810,
+0x8c4,
+0x944,
+0x23330804,
+0x904,
+0x23330810,
+0x904,
+0x23330804,
+0x944,
+0x23330810,
+0x944,
+0x23340804,
+0x23340808,
+0x2334080a,
+0x23340810,
+0x23340816,
+0x23350804,
+0x23360804,
+0x23360810,
+0x23370804,
+0x23370810,
+0x23380804,
+0x23380810,
+0x23390804,
+0x23390808,
+0x2339080a,
+0x23390810,
+0x23390816,
+0x2339082a,
+0x23390804,
+0x884,
+0x23390804,
+0x8c4,
+0x23390810,
+0x8c4,
+0x233a0804,
+0x233b0804,
+0x233c0804,
+0x233c0808,
+0x233c080a,
+0x233c0810,
+0x233c0814,
+0x233c0816,
+0x233c0832,
+0x233d0804,
+0x233d0810,
+0x233e0804,
+0x233e0810,
+0x233f0804,
+0x233f0810,
+0x23400804,
+0x2340080a,
+0x23400810,
+0x23400816,
+0x23410804,
+0x2341080a,
+0x23410810,
+0x23410814,
+0x23410816,
+0x23410804,
+0x884,
+0x23410804,
+0x884,
+0x904,
+0x23410804,
+0x884,
+0x944,
+0x23410804,
+0x884,
+0xa84,
+0x23410804,
+0x8c4,
+0x23410810,
+0x8c4,
+0x23410804,
+0x8c4,
+0x904,
+0x23410810,
+0x8c4,
+0x904,
+0x23410804,
+0x8c4,
+0x944,
+0x23410810,
+0x8c4,
+0x944,
+0x23410804,
+0x8c4,
+0xa84,
+0x23410810,
+0x8c4,
+0xa84,
+0x23410804,
+0x904,
+0x23410810,
+0x904,
+0x23410814,
+0x904,
+0x23410804,
+0x944,
+0x23410810,
+0x944,
+0x23410804,
+0x984,
+0x23410810,
+0x984,
+0x23410804,
+0xa84,
+0x23410804,
+0xac4,
+0x23410810,
+0xac4,
+0x23410814,
+0xac4,
+0x23410804,
+0xac4,
+0x904,
+0x23410804,
+0xac4,
+0x944,
+0x23410804,
+0xac4,
+0xa84,
+0x23410804,
+0xc84,
+0x23410810,
+0xc84,
+0x23420804,
+0x23420808,
+0x2342080a,
+0x23420810,
+0x23420816,
+0x23420828,
+0x2342082a,
+0x23430804,
+0x2343080a,
+0x23430810,
+0x23430816,
+0x23430828,
+0x2343082a,
+0x23440804,
+0x2344080a,
+0x23440810,
+0x23440816,
+0x23450804,
+0x23460804,
+0x2346080a,
+0x23460810,
+0x23460816,
+0x23460804,
+0x884,
+0x23460810,
+0x884,
+0x23460804,
+0x884,
+0x904,
+0x23460810,
+0x884,
+0x904,
+0x23460804,
+0x884,
+0x904,
+0x1304,
+0x23460810,
+0x884,
+0x904,
+0x1304,
+0x23460804,
+0x884,
+0x944,
+0x23460810,
+0x884,
+0x944,
+0x23460804,
+0x884,
+0x944,
+0x1304,
+0x23460810,
+0x884,
+0x944,
+0x1304,
+0x23460804,
+0x884,
+0xa84,
+0x23460810,
+0x884,
+0xa84,
+0x23460804,
+0x884,
+0xa84,
+0x1304,
+0x23460810,
+0x884,
+0xa84,
+0x1304,
+0x23460804,
+0x884,
+0x1304,
+0x23460810,
+0x884,
+0x1304,
+0x23460804,
+0x8c4,
+0x23460810,
+0x8c4,
+0x23460804,
+0x8c4,
+0x904,
+0x23460810,
+0x8c4,
+0x904,
+0x23460804,
+0x8c4,
+0x904,
+0x1304,
+0x23460810,
+0x8c4,
+0x904,
+0x1304,
+0x23460804,
+0x8c4,
+0x944,
+0x23460810,
+0x8c4,
+0x944,
+0x23460804,
+0x8c4,
+0x944,
+0x1304,
+0x23460810,
+0x8c4,
+0x944,
+0x1304,
+0x23460804,
+0x8c4,
+0xa84,
+0x23460810,
+0x8c4,
+0xa84,
+0x23460804,
+0x8c4,
+0xa84,
+0x1304,
+0x23460810,
+0x8c4,
+0xa84,
+0x1304,
+0x23460804,
+0x8c4,
+0x1304,
+0x23460810,
+0x8c4,
+0x1304,
+0x23460804,
+0x904,
+0x23460810,
+0x904,
+0x23460804,
+0x904,
+0x1304,
+0x23460804,
+0x944,
+0x23460810,
+0x944,
+0x23460804,
+0x944,
+0x1304,
+0x23460804,
+0xa84,
+0x23460804,
+0xa84,
+0x1304,
+0x23460804,
+0x1304,
+0x23460810,
+0x1304,
+0x23470804,
+0x23480804,
+0x23480810,
+0x23490804,
+0x23490810,
+0x234a0804,
+0x234a0810,
+0x234b0804,
+0x234b0810,
+0x234c0804,
+0x234c0810,
+0x234d0804,
+0x234d0810,
+0x234e0804,
+0x234e0810,
+0x234f0804,
+0x234f0810,
+0x23500804,
+0x23500810,
+0x23510804,
+0x23510810,
+0x23520804,
+0x23520810,
+0x23530804,
+0x23530810,
+0x23540804,
+0x23540810,
+0x23550804,
+0x23550810,
+0x23560804,
+0x23560810,
+0x23560808,
+0x234b0808,
+0x23550808,
+0x23570804,
+0x23570810,
+0x23580804,
+0x23580810,
+0x23590804,
+0x23590810,
+0x235a0804,
+0x235a0810,
+0x235b0804,
+0x235b0810,
+0x235c0804,
+0x235c0810,
+0x235d0804,
+0x235d0810,
+0x235e0804,
+0x235e0810,
+0x235f0804,
+0x235f0810,
+0x23600804,
+0x23600810,
+0x23610804,
+0x23610810,
+0x23620804,
+0x23620810,
+0x23630804,
+0x23630810,
+0x23640804,
+0x23640810,
+0x23650804,
+0x23650810,
+0x23660804,
+0x23660810,
+0x23670804,
+0x23670810,
+0x23680804,
+0x23680810,
+0x23690804,
+0x23690810,
+0x236a0804,
+0x236a0810,
+0x236b0804,
+0x236b0810,
+0x236c0804,
+0x236c0810,
+0x236d0804,
+0x236d0810,
+0x236e0804,
+0x236e0810,
+0x236f0804,
+0x236f0810,
+0x23700804,
+0x23700810,
+0x23710804,
+0x23710810,
+0x23720804,
+0x23720810,
+0x23730804,
+0x23730810,
+0x23740804,
+0x23740810,
+0x23750804,
+0x23750810,
+0x23760804,
+0x23760810,
+0x23770804,
+0x23770810,
+0x23780804,
+0x23780810,
+0x23790804,
+0x23790810,
+0x237a0804,
+0x237a0810,
+0x237b0804,
+0x237b0810,
+0x237c0804,
+0x237c0810,
+0x237d0804,
+0x237d0810,
+0x237e0804,
+0x237e0810,
+0x237f0804,
+0x237f0810,
+0x23800804,
+0x23800810,
+0x23810804,
+0x23810810,
+0x23820804,
+0x23820810,
+0x23830804,
+0x23830810,
+0x23840804,
+0x23840810,
+0x23850804,
+0x23850810,
+0x23860804,
+0x23860810,
+0x23870804,
+0x23870808,
+0x23870810,
+0x23870804,
+0x984,
+0x23870810,
+0x984,
+0x23870804,
+0xac4,
+0x23870810,
+0xac4,
+0x238b0804,
+0x238b0810,
+0x238b0804,
+0xac4,
+0x238b0810,
+0xac4,
+0x238f0804,
+0x238f0810,
+0x23930804,
+0x23930808,
+0x23930810,
+0x23970804,
+0x23970808,
+0x23970810,
+0x239b0804,
+0x239b0808,
+0x239b0810,
+0x239b0804,
+0x904,
+0x239b0810,
+0x904,
+0x239b0808,
+0x4648,
+0x239b0814,
+0x4648,
+0x239f0804,
+0x239f0810,
+0x23a30804,
+0x23a30810,
+0x23a70804,
+0x23a70810,
+0x23ab0804,
+0x23ab0810,
+0x23af0804,
+0x23af0808,
+0x23af0810,
+0x23b30804,
+0x23b30810,
+0x23b40804,
+0x23b40810,
+0x23b50804,
+0x23b50810,
+0x23b90804,
+0x23b90810,
+0x23ba0804,
+0x23ba0810,
+0x23bb0804,
+0x23bb0810,
+0x23bf0804,
+0x23bf0808,
+0x23bf0810,
+0x23bf0804,
+0x944,
+0x23bf0810,
+0x944,
+0x23bf0804,
+0x984,
+0x23bf0810,
+0x984,
+0x23bf0804,
+0xac4,
+0x23bf0810,
+0xac4,
+0x23c30804,
+0x23c30808,
+0x23c30810,
+0x23c70804,
+0x23c70808,
+0x23c70810,
+0x23c70804,
+0x984,
+0x23c70810,
+0x984,
+0x23c70804,
+0xac4,
+0x23c70810,
+0xac4,
+0x23cb0804,
+0x23cb0810,
+0x23cc0804,
+0x23cc0810,
+0x23cd0804,
+0x23cd0810,
+0x23d10804,
+0x23d10808,
+0x23d10810,
+0x23d10804,
+0xac4,
+0x23d10810,
+0xac4,
+0x23d50804,
+0x23d50810,
+0x23d60804,
+0x23d60810,
+0x23d70804,
+0x23d70810,
+0x23d80804,
+0x23d80810,
+0x23d90804,
+0x23d90810,
+0x23dd0804,
+0x23dd0810,
+0x23de0804,
+0x23de0810,
+0x23e20804,
+0x23e20810,
+0x23e30804,
+0x23e30810,
+0x23e40804,
+0x23e40810,
+0x23e50804,
+0x23e50808,
+0x23e50810,
+0x23e50804,
+0x944,
+0x23e50810,
+0x944,
+0x23e50804,
+0xac4,
+0x23e50810,
+0xac4,
+0x23e50804,
+0xc84,
+0x23e50810,
+0xc84,
+0x23e90804,
+0x23e90810,
+0x23ed0804,
+0x23ed0810,
+0x23ed0804,
+0xac4,
+0x23ed0808,
+0xac8,
+0x23ed0810,
+0xac4,
+0x23f10804,
+0x23f10810,
+0x23f20804,
+0x23f20810,
+0x23f60804,
+0x23f60810,
+0x23fa0804,
+0x23fa0808,
+0x23fa0810,
+0x23fb0804,
+0x23fb0808,
+0x23fb0810,
+0x23fb0804,
+0x904,
+0x23fb0810,
+0x904,
+0x23ff0804,
+0x23ff0810,
+0x24030804,
+0x24030810,
+0x24070804,
+0x24070810,
+0x240b0804,
+0x240b0810,
+0x240f0804,
+0x240f0810,
+0x24130804,
+0x24130810,
+0x24140804,
+0x24140810,
+0x24150804,
+0x24150808,
+0x24150810,
+0x24190804,
+0x241a0804,
+0x241a0810,
+0x241e0804,
+0x241e0810,
+0x241f0804,
+0x241f0810,
+0x24200804,
+0x24200810,
+0x24210804,
+0x24210810,
+0x24250804,
+0x24250810,
+0x24260804,
+0x24260810,
+0x24270804,
+0x24270810,
+0x24280804,
+0x24280808,
+0x24280810,
+0x242c0804,
+0x242c0810,
+0x24300804,
+0x24300810,
+0x24310804,
+0x24310808,
+0x24310810,
+0x24310828,
+0x24350804,
+0x24350810,
+0x24360804,
+0x24360810,
+0x243a0804,
+0x243a0810,
+0x243e0804,
+0x243e0810,
+0x24420804,
+0x24420810,
+0x24430804,
+0x24430810,
+0x24470804,
+0x24470810,
+0x244b0804,
+0x244b0810,
+0x244c0804,
+0x244c0808,
+0x244c0810,
+0x244c0814,
+0x244c0804,
+0xac4,
+0x244c0810,
+0xac4,
+0x24500804,
+0x24500810,
+0x24500804,
+0xac4,
+0x24500810,
+0xac4,
+0x24540804,
+0x24540808,
+0x24540810,
+0x24580804,
+0x24580810,
+0x24590804,
+0x24590810,
+0x245d0804,
+0x245d0810,
+0x24610804,
+0x24610808,
+0x24610810,
+0x24650804,
+0x24650810,
+0x24690804,
+0x24690810,
+0x246a0804,
+0x246a0808,
+0x246a0810,
+0x246a0808,
+0x24730808,
+0x246e0804,
+0x246e0810,
+0x246f0804,
+0x246f0810,
+0x24730804,
+0x24730808,
+0x24730810,
+0x24770804,
+0x24770810,
+0x24780804,
+0x24780810,
+0x24790804,
+0x24790810,
+0x247d0804,
+0x247d0810,
+0x247e0804,
+0x247e0810,
+0x24820804,
+0x24820808,
+0x24820810,
+0x24820804,
+0x984,
+0x24820810,
+0x984,
+0x24820804,
+0xac4,
+0x24820810,
+0xac4,
+0x24820804,
+0xb04,
+0x24820810,
+0xb04,
+0x24820804,
+0xc84,
+0x24820810,
+0xc84,
+0x24860804,
+0x24860810,
+0x248a0804,
+0x248a0810,
+0x248e0804,
+0x248e0808,
+0x248e0810,
+0x248f0804,
+0x248f0810,
+0x24930804,
+0x24930808,
+0x24930810,
+0x24970804,
+0x24970808,
+0x24970810,
+0x249b0804,
+0x249b0810,
+0x249f0804,
+0x249f0810,
+0x24a30804,
+0x24a30810,
+0x24a70804,
+0x24a70810,
+0x24ab0804,
+0x24ab0810,
+0x24ac0804,
+0x24ac0810,
+0x24ad0804,
+0x24ad0808,
+0x24ad0810,
+0x24b10804,
+0x24b10810,
+0x24b50804,
+0x24b50810,
+0x24b60804,
+0x24b60810,
+0x24ba0804,
+0x24ba0810,
+0x24be0804,
+0x24be0808,
+0x24be0810,
+0x24c20804,
+0x24c20810,
+0x24c30804,
+0x24c30810,
+0x24c40804,
+0x24c40810,
+0x24c80804,
+0x24c80810,
+0x24c90804,
+0x24c90808,
+0x24c90810,
+0x24c90804,
+0xac4,
+0x24c90810,
+0xac4,
+0x24cd0804,
+0x24cd0810,
+0x24ce0804,
+0x24ce0810,
+0x24cf0804,
+0x24cf0810,
+0x24d30804,
+0x24d30810,
+0x24d70804,
+0x24d70810,
+0x24db0804,
+0x24db0810,
+0x24dc0804,
+0x24dc0810,
+0x24e00804,
+0x24e00810,
+0x24e40804,
+0x24e40810,
+0x24e80804,
+0x24e80808,
+0x24e80810,
+0x24ec0804,
+0x24ec0810,
+0x24ed0804,
+0x24ed0808,
+0x24ed0810,
+0x24f10804,
+0x24f10810,
+0x24f20804,
+0x24f30804,
+0x24f40804,
+0x24f40808,
+0x24f40810,
+0x24f40828,
+0x24f80804,
+0x24f80810,
+0x24f90804,
+0x24f90808,
+0x24f90810,
+0x24f90804,
+0xac4,
+0x24f90810,
+0xac4,
+0x24fd0804,
+0x24fd0808,
+0x24fd0810,
+0x24fd0828,
+0x25010804,
+0x25010810,
+0x25050804,
+0x25050808,
+0x25050810,
+0x25090804,
+0x25090810,
+0x250a0804,
+0x250a0810,
+0x250a0804,
+0xac4,
+0x250a0810,
+0xac4,
+0x250e0804,
+0x250e0808,
+0x250e0810,
+0x25120804,
+0x25120810,
+0x25130804,
+0x25130808,
+0x25130810,
+0x25140804,
+0x25140810,
+0x25180804,
+0x25180810,
+0x25190804,
+0x25190808,
+0x25190810,
+0x251d0804,
+0x251d0808,
+0x251d0810,
+0x25210804,
+0x25210810,
+0x25220804,
+0x25220808,
+0x25220810,
+0x25260804,
+0x25260810,
+0x25270804,
+0x25270810,
+0x252b0804,
+0x252b0810,
+0x252c0804,
+0x252c0808,
+0x252c0810,
+0x25300804,
+0x25300810,
+0x25340804,
+0x25340810,
+0x25380804,
+0x25380808,
+0x25380810,
+0x253c0804,
+0x253c0810,
+0x253c0804,
+0xf04,
+0x253c0810,
+0xf04,
+0x25400804,
+0x25400810,
+0x25410804,
+0x25410810,
+0x25450804,
+0x25450810,
+0x25460804,
+0x25460810,
+0x254a0804,
+0x254a0810,
+0x254b0804,
+0x254b0810,
+0x254c0804,
+0x254c0810,
+0x254d0804,
+0x254d0810,
+0x254e0804,
+0x254e0810,
+0x254f0804,
+0x254f0810,
+0x25500804,
+0x25500810,
+0x25510804,
+0x25510810,
+0x25520804,
+0x25520810,
+0x25530804,
+0x25530810,
+0x25540804,
+0x25540810,
+0x25550804,
+0x25550810,
+0x25560804,
+0x25560810,
+0x25570804,
+0x25570810,
+0x25580804,
+0x25580810,
+0x25590804,
+0x25590810,
+0x255a0804,
+0x255a0810,
+0x255b0804,
+0x255b0810,
+0x255c0804,
+0x255c0810,
+0x255d0804,
+0x255d0810,
+0x255e0804,
+0x255e0810,
+0x255f0804,
+0x255f0810,
+0x25600804,
+0x25600810,
+0x25610804,
+0x25610810,
+0x25620804,
+0x25620810,
+0x25630804,
+0x25630810,
+0x25640804,
+0x25640810,
+0x25650804,
+0x25650810,
+0x25660804,
+0x25660810,
+0x25670804,
+0x25670810,
+0x25680804,
+0x25680810,
+0x25690804,
+0x25690810,
+0x256a0804,
+0x256a0810,
+0x256b0804,
+0x256b0810,
+0x256c0804,
+0x256c0810,
+0x256d0804,
+0x256d0810,
+0x256e0804,
+0x256e0810,
+0x256f0804,
+0x256f0810,
+0x25700804,
+0x25700810,
+0x25710804,
+0x25710810,
+0x25720804,
+0x25720810,
+0x25730804,
+0x25730810,
+0x25740804,
+0x25740810,
+0x25750804,
+0x25750810,
+0x25760804,
+0x25760810,
+0x25770804,
+0x25770810,
+0x25780804,
+0x25780810,
+0x25790804,
+0x25790808,
+0x257a0804,
+0x257b0804,
+0x257c0804,
+0x257c0808,
+0x257d0804,
+0x257e0804,
+0x257f0804,
+0x25800804,
+0x25800808,
+0x25810804,
+0x25820804,
+0x25830804,
+0x25840804,
+0x25850804,
+0x25860804,
+0x25860808,
+0x25870804,
+0x25880804,
+0x25890804,
+0x258a0804,
+0x258a0808,
+0x258b0804,
+0x258c0804,
+0x258d0804,
+0x258e0804,
+0x258f0804,
+0x25900804,
+0x25910804,
+0x25920804,
+0x25930804,
+0x25940804,
+0x25950804,
+0x25960804,
+0x25970804,
+0x25980804,
+0x25990804,
+0x259a0804,
+0x259b0804,
+0x259c0804,
+0x259d0804,
+0x259e0804,
+0x259f0804,
+0x25a00804,
+0x25a00810,
+0x25a10804,
+0x25a20804,
+0x25a20810,
+0x25a30804,
+0x25a40804,
+0x25a40810,
+0x25a50804,
+0x25a60804,
+0x25a60810,
+0x25a70804,
+0x25a80804,
+0x25a80810,
+0x25a90804,
+0x25aa0804,
+0x25aa0810,
+0x25ab0804,
+0x25ac0804,
+0x25ac0810,
+0x25ad0804,
+0x25ae0804,
+0x25ae0810,
+0x25af0804,
+0x25b00804,
+0x25b00810,
+0x25b10804,
+0x25b20804,
+0x25b20810,
+0x25b30804,
+0x25b40804,
+0x25b40810,
+0x25b50804,
+0x25b60804,
+0x25b60810,
+0x25b70804,
+0x25b80804,
+0x25b80810,
+0x25b90804,
+0x25b90828,
+0x25ba0804,
+0x25ba0810,
+0x25bb0804,
+0x25bc0804,
+0x25bc0810,
+0x25bd0804,
+0x25be0804,
+0x25be0810,
+0x25bf0804,
+0x25c00804,
+0x25c00810,
+0x25c10804,
+0x25c20804,
+0x25c20810,
+0x25c30804,
+0x25c40804,
+0x25c40810,
+0x25c50804,
+0x25c60804,
+0x25c60810,
+0x25c70804,
+0x25c80804,
+0x25c80810,
+0x25c90804,
+0x25ca0804,
+0x25ca0810,
+0x25cb0804,
+0x25cc0804,
+0x25cc0810,
+0x25cd0804,
+0x25ce0804,
+0x25ce0810,
+0x25cf0804,
+0x25d00804,
+0x25d00810,
+0x25d10804,
+0x25d20804,
+0x25d20810,
+0x25d30804,
+0x25d40804,
+0x25d40810,
+0x25d50804,
+0x25d60804,
+0x25d60810,
+0x25d70804,
+0x25d80804,
+0x25d80810,
+0x25d90804,
+0x25da0804,
+0x25da0810,
+0x25db0804,
+0x25dc0804,
+0x25dc0810,
+0x25dd0804,
+0x25de0804,
+0x25de0810,
+0x25df0804,
+0x25e00804,
+0x25e00810,
+0x25e10804,
+0x25e20804,
+0x25e20810,
+0x25e30804,
+0x25e40804,
+0x25e40810,
+0x25e50804,
+0x25e60804,
+0x25e60810,
+0x25e70804,
+0x25e80804,
+0x25e80810,
+0x25e90804,
+0x25ea0804,
+0x25ea0810,
+0x25eb0804,
+0x25ec0804,
+0x25ed0804,
+0x25ed0810,
+0x25ee0804,
+0x25ef0804,
+0x25f00804,
+0x25f10804,
+0x25f20804,
+0x25f20810,
+0x25f30804,
+0x25f40804,
+0x25f50804,
+0x25f50810,
+0x25f70804,
+0x25f70810,
+0x25f80804,
+0x25f80810,
+0x25f90804,
+0x25f90810,
+0x25fa0804,
+0x25fa0810,
+0x25fa0808,
+0x26180808,
+0x25fb0804,
+0x25fb0810,
+0x25fc0804,
+0x25fc0810,
+0x25fd0804,
+0x25fd0810,
+0x25fe0804,
+0x25fe0810,
+0x25ff0804,
+0x25ff0810,
+0x26000804,
+0x26000810,
+0x26010804,
+0x26010810,
+0x26020804,
+0x26020810,
+0x26030804,
+0x26030810,
+0x26040804,
+0x26040810,
+0x26050804,
+0x26050810,
+0x26060804,
+0x26060810,
+0x26070804,
+0x26070810,
+0x26080804,
+0x26080810,
+0x26090804,
+0x26090810,
+0x26090808,
+0x25fa0808,
+0x26090808,
+0x26000808,
+0x26090808,
+0x26020808,
+0x26090808,
+0x260c0808,
+0x260a0804,
+0x260a0810,
+0x260c0804,
+0x260c0810,
+0x260d0804,
+0x260d0810,
+0x260e0804,
+0x260e0810,
+0x260f0804,
+0x260f0810,
+0x26100804,
+0x26100810,
+0x26110804,
+0x26110810,
+0x26120804,
+0x26120810,
+0x26130804,
+0x26130810,
+0x26140804,
+0x26140810,
+0x26140808,
+0x260c0808,
+0x26150804,
+0x26150810,
+0x26160804,
+0x26160810,
+0x26170804,
+0x26170810,
+0x26180804,
+0x26180810,
+0x26190804,
+0x26190810,
+0x261a0804,
+0x261a0810,
+0x261b0804,
+0x261b0810,
+0x261c0804,
+0x261c0810,
+0x261d0804,
+0x261e0804,
+0x261e0808,
+0x261e080a,
+0x261e0804,
+0x1644,
+0x261e0804,
+0x1684,
+0x261e0804,
+0x17c4,
+0x261e0808,
+0x26290808,
+0x261f0804,
+0x261f0808,
+0x261f0804,
+0x17c4,
+0x261f0804,
+0x1804,
+0x26200804,
+0x26200808,
+0x26200804,
+0x17c4,
+0x26210804,
+0x26210808,
+0x2621080a,
+0x26210804,
+0x17c4,
+0x26220804,
+0x2622080a,
+0x26220804,
+0x17c4,
+0x26230804,
+0x26230804,
+0x16c4,
+0x26230804,
+0x17c4,
+0x26230808,
+0x26230808,
+0x26230808,
+0x26270808,
+0x26240804,
+0x26240804,
+0x17c4,
+0x26250804,
+0x26260804,
+0x26260804,
+0x17c4,
+0x26270804,
+0x26270804,
+0x1584,
+0x26270804,
+0x17c4,
+0x26270808,
+0x26270808,
+0x26270808,
+0x26270808,
+0x1644,
+0x26280804,
+0x2628080a,
+0x26280832,
+0x26280804,
+0x17c4,
+0x26280832,
+0x17c4,
+0x26280804,
+0x1804,
+0x26290804,
+0x2629080a,
+0x26290804,
+0x17c4,
+0x262a0804,
+0x262a080a,
+0x262a0832,
+0x262a0804,
+0x17c4,
+0x262b0804,
+0x262b0832,
+0x262b0804,
+0x17c4,
+0x262c0804,
+0x262c0804,
+0x17c4,
+0x262d0804,
+0x262d080a,
+0x262e0804,
+0x262e0832,
+0x262e0804,
+0x17c4,
+0x262e0832,
+0x17c4,
+0x262e0804,
+0x1804,
+0x262f0804,
+0x262f0832,
+0x262f0804,
+0x17c4,
+0x26300804,
+0x26300804,
+0x17c4,
+0x26310804,
+0x2631080a,
+0x26310804,
+0x17c4,
+0x26320804,
+0x26320804,
+0x1744,
+0x26320804,
+0x1784,
+0x26320804,
+0x17c4,
+0x26320804,
+0x17c4,
+0x1744,
+0x26320804,
+0x17c4,
+0x1784,
+0x26330804,
+0x2633080a,
+0x26330804,
+0x17c4,
+0x26340804,
+0x26350804,
+0x26360804,
+0x26370804,
+0x26380804,
+0x26390804,
+0x263a0804,
+0x263b0804,
+0x263c0804,
+0x263d0804,
+0x263e0804,
+0x263f0804,
+0x26400804,
+0x26410804,
+0x26420804,
+0x26430804,
+0x26440804,
+0x26450804,
+0x26460804,
+0x26470804,
+0x26480804,
+0x26490804,
+0x264a0804,
+0x264b0804,
+0x264c0804,
+0x264d0804,
+0x264e0804,
+0x264f0804,
+0x26500804,
+0x26510804,
+0x26520804,
+0x26530804,
+0x26540804,
+0x26550804,
+0x26560804,
+0x26570804,
+0x26580804,
+0x26590804,
+0x265a0804,
+0x265b0804,
+0x265c0804,
+0x265d0804,
+0x265e0804,
+0x265f0804,
+0x26600804,
+0x26610804,
+0x26620804,
+0x26630804,
+0x26640804,
+0x26640808,
+0x26640834,
+0x26640808,
+0x4648,
+0x26650804,
+0x26650832,
+0x26650834,
+0x26660804,
+0x26660832,
+0x26660834,
+0x26670804,
+0x26680804,
+0x26680832,
+0x26680834,
+0x26690804,
+0x26690832,
+0x26690834,
+0x266a0804,
+0x266a0832,
+0x266a0834,
+0x266b0804,
+0x266c0804,
+0x266d0804,
+0x266e0804,
+0x266e082e,
+0x266e0830,
+0x266e0832,
+0x266e0834,
+0x266e0832,
+0x26720832,
+0x266e0834,
+0x26720834,
+0x266e082e,
+0x268f082e,
+0x266e0834,
+0x268f0834,
+0x266e082e,
+0x2699082e,
+0x266e0834,
+0x26990834,
+0x266e082e,
+0x269a082e,
+0x266e0832,
+0x26b30832,
+0x266e0832,
+0x26b40832,
+0x266e082e,
+0x2714082e,
+0x266e0830,
+0x27140830,
+0x266e0832,
+0x27140832,
+0x266e0834,
+0x27140834,
+0x266e0832,
+0x27180832,
+0x266e082e,
+0x2722082e,
+0x266e0830,
+0x27220830,
+0x266e0832,
+0x27270832,
+0x266e0834,
+0x27270834,
+0x266e0832,
+0x27280832,
+0x266e0834,
+0x27280834,
+0x266e0832,
+0x272b0832,
+0x266e0834,
+0x272b0834,
+0x266e0832,
+0x272c0832,
+0x266e0834,
+0x272c0834,
+0x266e0832,
+0x272d0832,
+0x266e0834,
+0x272d0834,
+0x266e082e,
+0x2736082e,
+0x266e0832,
+0x27360832,
+0x266e0834,
+0x27360834,
+0x266e0832,
+0x27370832,
+0x266e0834,
+0x27370834,
+0x266e082e,
+0x273b082e,
+0x266e0832,
+0x273b0832,
+0x266e0834,
+0x273b0834,
+0x266f0804,
+0x26700804,
+0x26710804,
+0x26720804,
+0x26720808,
+0x2672080a,
+0x26720832,
+0x26720834,
+0x26720832,
+0x1b72,
+0x26720834,
+0x1b74,
+0x26720808,
+0x26640808,
+0x26720834,
+0x26f60834,
+0x26740834,
+0x26b30834,
+0x26720834,
+0x270c0834,
+0x270c0834,
+0x27220834,
+0x26730804,
+0x2673080a,
+0x26740804,
+0x2674080a,
+0x2674082e,
+0x26740830,
+0x26740832,
+0x26740834,
+0x2674082e,
+0x268f082e,
+0x26740834,
+0x268f0834,
+0x2674082e,
+0x2699082e,
+0x26740834,
+0x26990834,
+0x26740832,
+0x26990832,
+0x27370832,
+0x2674082e,
+0x269a082e,
+0x26740834,
+0x269a0834,
+0x26740832,
+0x269a0832,
+0x27370832,
+0x26740832,
+0x26b30832,
+0x26740832,
+0x26b40832,
+0x2674082e,
+0x2714082e,
+0x26740830,
+0x27140830,
+0x26740832,
+0x27140832,
+0x26740834,
+0x27140834,
+0x26740832,
+0x27180832,
+0x2674082e,
+0x2722082e,
+0x26740830,
+0x27220830,
+0x26740832,
+0x27360832,
+0x26740834,
+0x27360834,
+0x26740832,
+0x27370832,
+0x26740834,
+0x27370834,
+0x26750804,
+0x2675082e,
+0x26750830,
+0x26750832,
+0x26750834,
+0x26760804,
+0x2676082e,
+0x26760830,
+0x26760832,
+0x26760834,
+0x26770804,
+0x2677082e,
+0x26770830,
+0x26770832,
+0x26770834,
+0x26780804,
+0x26790804,
+0x267a0804,
+0x267b0804,
+0x267c0804,
+0x267d0804,
+0x267e0804,
+0x267f0804,
+0x26810804,
+0x26840804,
+0x26840832,
+0x26840834,
+0x26850804,
+0x2685080a,
+0x2685082e,
+0x26850830,
+0x26850832,
+0x26850834,
+0x2685082e,
+0x268f082e,
+0x26850834,
+0x268f0834,
+0x2685082e,
+0x268f082e,
+0x2714082e,
+0x26850832,
+0x268f0832,
+0x27360832,
+0x26850832,
+0x268f0832,
+0x27370832,
+0x2685082e,
+0x2699082e,
+0x26850834,
+0x26990834,
+0x2685082e,
+0x2699082e,
+0x268f082e,
+0x26850832,
+0x26990832,
+0x268f0832,
+0x2685082e,
+0x2699082e,
+0x2714082e,
+0x2685082e,
+0x269a082e,
+0x26850834,
+0x269a0834,
+0x2685082e,
+0x269a082e,
+0x2714082e,
+0x26850832,
+0x269a0832,
+0x27360832,
+0x26850832,
+0x269a0832,
+0x27370832,
+0x26850832,
+0x26b30832,
+0x26850832,
+0x26b40832,
+0x2685082e,
+0x2714082e,
+0x26850830,
+0x27140830,
+0x26850832,
+0x27140832,
+0x26850834,
+0x27140834,
+0x2685082e,
+0x2714082e,
+0x268f082e,
+0x2685082e,
+0x2714082e,
+0x2699082e,
+0x2685082e,
+0x2714082e,
+0x269a082e,
+0x26850832,
+0x27140832,
+0x27360832,
+0x26850832,
+0x27140832,
+0x27370832,
+0x26850832,
+0x27180832,
+0x2685082e,
+0x2722082e,
+0x26850830,
+0x27220830,
+0x26850832,
+0x27360832,
+0x26850834,
+0x27360834,
+0x26850832,
+0x27370832,
+0x26850834,
+0x27370834,
+0x26860804,
+0x2686080a,
+0x2686082e,
+0x26860830,
+0x26860832,
+0x26860834,
+0x26860834,
+0x268f0834,
+0x26860832,
+0x26b30832,
+0x26860832,
+0x26b40832,
+0x2686082e,
+0x2714082e,
+0x26860830,
+0x27140830,
+0x26860832,
+0x27140832,
+0x26860834,
+0x27140834,
+0x26860832,
+0x27180832,
+0x26860830,
+0x27220830,
+0x26860832,
+0x27360832,
+0x26860834,
+0x27360834,
+0x26860832,
+0x27370832,
+0x26860834,
+0x27370834,
+0x26870804,
+0x2687082e,
+0x26870830,
+0x26870832,
+0x26870834,
+0x26880804,
+0x2688082e,
+0x26880830,
+0x26880832,
+0x26880834,
+0x26890804,
+0x268a0804,
+0x268b0804,
+0x268b082e,
+0x268b0830,
+0x268b0832,
+0x268b0834,
+0x268f0804,
+0x268f080a,
+0x268f082e,
+0x268f0830,
+0x268f0832,
+0x268f0834,
+0x268f082e,
+0x2699082e,
+0x268f0834,
+0x26990834,
+0x268f0832,
+0x26990832,
+0x27360832,
+0x268f0832,
+0x26990832,
+0x27370832,
+0x268f0834,
+0x270c0834,
+0x2090835,
+0x268f0834,
+0x270c0834,
+0x26720834,
+0x270c0834,
+0x27220834,
+0x268f082e,
+0x2714082e,
+0x268f0834,
+0x27140834,
+0x268f082e,
+0x2714082e,
+0x2699082e,
+0x268f0832,
+0x27140832,
+0x26990832,
+0x268f0832,
+0x27140832,
+0x27360832,
+0x268f0832,
+0x27140832,
+0x27370832,
+0x268f0832,
+0x27360832,
+0x268f0834,
+0x27360834,
+0x268f0832,
+0x27370832,
+0x268f0834,
+0x27370834,
+0x26900804,
+0x2690082e,
+0x26900830,
+0x26900832,
+0x26900834,
+0x26910804,
+0x2691082e,
+0x26910830,
+0x26910832,
+0x26910834,
+0x26920804,
+0x2692082e,
+0x26920830,
+0x26920832,
+0x26920834,
+0x26930804,
+0x26940804,
+0x2694082e,
+0x26940830,
+0x26940832,
+0x26940834,
+0x26950804,
+0x26990804,
+0x2699080a,
+0x2699082e,
+0x26990830,
+0x26990832,
+0x26990834,
+0x2699082e,
+0x268f082e,
+0x26990834,
+0x268f0834,
+0x26990832,
+0x268f0832,
+0x27370832,
+0x2699082e,
+0x2714082e,
+0x26990834,
+0x27140834,
+0x26990832,
+0x27140832,
+0x27360832,
+0x26990832,
+0x27140832,
+0x27370832,
+0x26990832,
+0x27360832,
+0x26990834,
+0x27360834,
+0x26990832,
+0x27370832,
+0x26990834,
+0x27370834,
+0x269a0804,
+0x269a080a,
+0x269a082e,
+0x269a0830,
+0x269a0832,
+0x269a0834,
+0x269a082e,
+0x268f082e,
+0x269a0834,
+0x268f0834,
+0x269a0834,
+0x26990834,
+0x269a082e,
+0x2714082e,
+0x269a0834,
+0x27140834,
+0x269a0832,
+0x27360832,
+0x269a0834,
+0x27360834,
+0x269a0832,
+0x27370832,
+0x269a0834,
+0x27370834,
+0x269b0804,
+0x269c0804,
+0x269d0804,
+0x269e0804,
+0x269f0804,
+0x26a00804,
+0x26a10804,
+0x26a20804,
+0x26a30804,
+0x26a40804,
+0x26a4080a,
+0x26a40832,
+0x26a40834,
+0x26a50804,
+0x26a5080a,
+0x26a50832,
+0x26a50834,
+0x26a50834,
+0x2634,
+0x26a60804,
+0x26a60832,
+0x26a60834,
+0x26a70804,
+0x26a80804,
+0x26a90804,
+0x26aa0804,
+0x26aa0832,
+0x26aa0834,
+0x26ab0804,
+0x26ab0832,
+0x26ab0834,
+0x26ac0804,
+0x26ad0804,
+0x26ad0832,
+0x26ad0834,
+0x26ae0804,
+0x26af0804,
+0x26b00804,
+0x26b10804,
+0x26b20804,
+0x26b30804,
+0x26b3080a,
+0x26b30832,
+0x26b30834,
+0x26b30834,
+0x2634,
+0x26b30834,
+0x26c60834,
+0x27280834,
+0x270c0834,
+0x26b30834,
+0x27380834,
+0x26720834,
+0x270c0834,
+0x26b40804,
+0x26b4080a,
+0x26b40832,
+0x26b40834,
+0x26b50804,
+0x26b50832,
+0x26b50834,
+0x26b60804,
+0x26b70804,
+0x26b80804,
+0x26b90804,
+0x26ba0804,
+0x26bb0804,
+0x26bc0804,
+0x26bc0832,
+0x26bc0834,
+0x26bd0804,
+0x26be0804,
+0x26bf0804,
+0x26c00804,
+0x26c10804,
+0x26c20804,
+0x26c30804,
+0x26c40804,
+0x26c60804,
+0x26c6080a,
+0x26c6082e,
+0x26c60830,
+0x26c60832,
+0x26c60834,
+0x26c6082e,
+0x268f082e,
+0x26c60830,
+0x268f0830,
+0x26c60834,
+0x268f0834,
+0x26c6082e,
+0x268f082e,
+0x2699082e,
+0x26c60832,
+0x268f0832,
+0x27360832,
+0x26c6082e,
+0x2699082e,
+0x26c60830,
+0x26990830,
+0x26c60834,
+0x26990834,
+0x26c6082e,
+0x2699082e,
+0x268f082e,
+0x26c6082e,
+0x269a082e,
+0x26c60830,
+0x269a0830,
+0x26c60834,
+0x269a0834,
+0x26c60832,
+0x269a0832,
+0x27360832,
+0x26c60832,
+0x269a0832,
+0x27370832,
+0x26c60832,
+0x26b30832,
+0x26c60834,
+0x26b30834,
+0x26c6082e,
+0x2714082e,
+0x26c60830,
+0x27140830,
+0x26c60834,
+0x27140834,
+0x26c6082e,
+0x2714082e,
+0x268f082e,
+0x26c6082e,
+0x2714082e,
+0x2699082e,
+0x26c60832,
+0x27140832,
+0x26990832,
+0x26c6082e,
+0x2714082e,
+0x2714082e,
+0x26c60832,
+0x27140832,
+0x27140832,
+0x26c6082e,
+0x2722082e,
+0x26c60830,
+0x27220830,
+0x26c60832,
+0x27360832,
+0x26c60834,
+0x27360834,
+0x26c60832,
+0x27370832,
+0x26c60834,
+0x27370834,
+0x26c70804,
+0x26c7080a,
+0x26c7082e,
+0x26c70830,
+0x26c70832,
+0x26c70834,
+0x26c7082e,
+0x268f082e,
+0x26c70830,
+0x268f0830,
+0x26c70832,
+0x268f0832,
+0x26c70834,
+0x268f0834,
+0x26c70832,
+0x268f0832,
+0x27370832,
+0x26c7082e,
+0x2699082e,
+0x26c70830,
+0x26990830,
+0x26c70832,
+0x26990832,
+0x26c70834,
+0x26990834,
+0x26c7082e,
+0x2699082e,
+0x2714082e,
+0x26c70832,
+0x26990832,
+0x27140832,
+0x26c70832,
+0x26990832,
+0x27370832,
+0x26c7082e,
+0x269a082e,
+0x26c70830,
+0x269a0830,
+0x26c70832,
+0x269a0832,
+0x26c70834,
+0x269a0834,
+0x26c70832,
+0x26b30832,
+0x26c70834,
+0x26b30834,
+0x26c7082e,
+0x2714082e,
+0x26c70830,
+0x27140830,
+0x26c70832,
+0x27140832,
+0x26c70834,
+0x27140834,
+0x26c7082e,
+0x2714082e,
+0x269a082e,
+0x26c70832,
+0x27140832,
+0x269a0832,
+0x26c7082e,
+0x2714082e,
+0x2714082e,
+0x26c70832,
+0x27140832,
+0x27140832,
+0x26c7082e,
+0x2722082e,
+0x26c70830,
+0x27220830,
+0x26c70832,
+0x27360832,
+0x26c70834,
+0x27360834,
+0x26c70832,
+0x27370832,
+0x26c70834,
+0x27370834,
+0x26c80804,
+0x26c90804,
+0x26ca0804,
+0x26cb0804,
+0x26cc0804,
+0x26cd0804,
+0x26ce0804,
+0x26cf0804,
+0x26d00804,
+0x26d10804,
+0x26d1080a,
+0x26d1082e,
+0x26d10830,
+0x26d10832,
+0x26d10834,
+0x26d1082e,
+0x2699082e,
+0x26d10834,
+0x26990834,
+0x26d1082e,
+0x2699082e,
+0x2699082e,
+0x26d10832,
+0x26990832,
+0x26990832,
+0x26d10832,
+0x26990832,
+0x27370832,
+0x26d1082e,
+0x269a082e,
+0x26d10832,
+0x26b30832,
+0x26d10834,
+0x26b30834,
+0x26d10834,
+0x270c0834,
+0x26db0834,
+0x27140834,
+0x26d10834,
+0x270c0834,
+0x27360834,
+0x26d10834,
+0x270c0834,
+0x27360834,
+0x2090835,
+0x26720834,
+0x270c0834,
+0x270c0834,
+0x27220834,
+0x2090835,
+0x26db0834,
+0x270c0834,
+0x27370834,
+0x27220834,
+0x2090835,
+0x27280834,
+0x26c60834,
+0x270c0834,
+0x27140834,
+0x26d10834,
+0x270c0834,
+0x27450834,
+0x26d1082e,
+0x2714082e,
+0x26d10834,
+0x27140834,
+0x26d1082e,
+0x2714082e,
+0x2714082e,
+0x26d10832,
+0x27140832,
+0x27140832,
+0x26d10832,
+0x27360832,
+0x26d10834,
+0x27360834,
+0x26d10832,
+0x27370832,
+0x26d10834,
+0x27370834,
+0x26d20804,
+0x26d2080a,
+0x26d2082e,
+0x26d20830,
+0x26d20832,
+0x26d20834,
+0x26d2082e,
+0x268f082e,
+0x26d20834,
+0x268f0834,
+0x26d2082e,
+0x2699082e,
+0x26d20834,
+0x26990834,
+0x26d20832,
+0x26990832,
+0x27360832,
+0x26d20832,
+0x26990832,
+0x27370832,
+0x26d2082e,
+0x269a082e,
+0x26d20834,
+0x269a0834,
+0x26d2082e,
+0x269a082e,
+0x2714082e,
+0x26d20832,
+0x269a0832,
+0x27140832,
+0x26d20832,
+0x26b30832,
+0x26d20834,
+0x26b30834,
+0x26d2082e,
+0x2714082e,
+0x26d20834,
+0x27140834,
+0x26d20832,
+0x27360832,
+0x26d20834,
+0x27360834,
+0x26d20832,
+0x27370832,
+0x26d20834,
+0x27370834,
+0x26d30804,
+0x26d40804,
+0x26d50804,
+0x26d60804,
+0x26d70804,
+0x26d7080a,
+0x26d7082e,
+0x26d70830,
+0x26d70832,
+0x26d70834,
+0x26d7082e,
+0x2699082e,
+0x26d70834,
+0x26990834,
+0x26d7082e,
+0x2714082e,
+0x26d70830,
+0x27140830,
+0x26d70834,
+0x27140834,
+0x26d7082e,
+0x2714082e,
+0x2699082e,
+0x26d70832,
+0x27140832,
+0x26990832,
+0x26d7082e,
+0x2714082e,
+0x2714082e,
+0x26d70832,
+0x27140832,
+0x27370832,
+0x26d70832,
+0x27360832,
+0x26d70834,
+0x27360834,
+0x26d70832,
+0x27370832,
+0x26d70834,
+0x27370834,
+0x26d80804,
+0x26d8080a,
+0x26d8082e,
+0x26d80830,
+0x26d80832,
+0x26d80834,
+0x26d8082e,
+0x2714082e,
+0x26d80830,
+0x27140830,
+0x26d80834,
+0x27140834,
+0x26d90804,
+0x26da0804,
+0x26db0804,
+0x26db080a,
+0x26db082e,
+0x26db0830,
+0x26db0832,
+0x26db0834,
+0x26db082e,
+0x268f082e,
+0x26db0834,
+0x268f0834,
+0x26db082e,
+0x268f082e,
+0x2714082e,
+0x26db0832,
+0x268f0832,
+0x27140832,
+0x26db0834,
+0x270c0834,
+0x27370834,
+0x27220834,
+0x26db082e,
+0x2714082e,
+0x26db0834,
+0x27140834,
+0x26db082e,
+0x2714082e,
+0x2714082e,
+0x26db0832,
+0x27140832,
+0x27140832,
+0x26db0832,
+0x27140832,
+0x27360832,
+0x26db0832,
+0x27140832,
+0x27370832,
+0x26db0832,
+0x27360832,
+0x26db0834,
+0x27360834,
+0x26db0832,
+0x27370832,
+0x26db0834,
+0x27370834,
+0x26dc0804,
+0x26dc080a,
+0x26dc082e,
+0x26dc0830,
+0x26dc0832,
+0x26dc0834,
+0x26dc082e,
+0x268f082e,
+0x26dc0834,
+0x268f0834,
+0x26dc082e,
+0x2714082e,
+0x26dc0834,
+0x27140834,
+0x26dc0832,
+0x27140832,
+0x27140832,
+0x26dc0832,
+0x27140832,
+0x27360832,
+0x26dc0832,
+0x27140832,
+0x27370832,
+0x26dc0832,
+0x27360832,
+0x26dc0834,
+0x27360834,
+0x26dc0832,
+0x27370832,
+0x26dc0834,
+0x27370834,
+0x26dd0804,
+0x26df0804,
+0x26e00804,
+0x26e10804,
+0x26e20804,
+0x26e30804,
+0x26e40804,
+0x26e4080a,
+0x26e4082e,
+0x26e40830,
+0x26e40832,
+0x26e40834,
+0x26e4082e,
+0x268f082e,
+0x26e40834,
+0x268f0834,
+0x26e4082e,
+0x2699082e,
+0x26e40834,
+0x26990834,
+0x26e4082e,
+0x269a082e,
+0x26e40834,
+0x269a0834,
+0x26e4082e,
+0x269a082e,
+0x2714082e,
+0x26e40832,
+0x269a0832,
+0x27140832,
+0x26e4082e,
+0x2714082e,
+0x26e40834,
+0x27140834,
+0x26e40832,
+0x27140832,
+0x27370832,
+0x26e40832,
+0x27360832,
+0x26e40834,
+0x27360834,
+0x26e40832,
+0x27370832,
+0x26e40834,
+0x27370834,
+0x26e50804,
+0x26e5080a,
+0x26e60804,
+0x26e80804,
+0x26e90804,
+0x26e9082e,
+0x26e90830,
+0x26e90832,
+0x26e90834,
+0x26ea0804,
+0x26eb0804,
+0x26ec0804,
+0x26ec082e,
+0x26ec0830,
+0x26ec0832,
+0x26ec0834,
+0x26ed0804,
+0x26ee0804,
+0x26ef0804,
+0x26ef080a,
+0x26f00804,
+0x26f0080a,
+0x26f0082e,
+0x26f00830,
+0x26f00832,
+0x26f00834,
+0x26f0082e,
+0x2699082e,
+0x26f00834,
+0x26990834,
+0x26f00834,
+0x270c0834,
+0x27450834,
+0x26f0082e,
+0x2714082e,
+0x26f00834,
+0x27140834,
+0x26f0082e,
+0x2714082e,
+0x2699082e,
+0x26f00832,
+0x27140832,
+0x26990832,
+0x26f00832,
+0x27140832,
+0x27140832,
+0x26f00832,
+0x27140832,
+0x27370832,
+0x26f00832,
+0x27360832,
+0x26f00834,
+0x27360834,
+0x26f00832,
+0x27370832,
+0x26f00834,
+0x27370834,
+0x26f10804,
+0x26f30804,
+0x26f50804,
+0x26f60804,
+0x26f6080a,
+0x26f6082e,
+0x26f60830,
+0x26f60832,
+0x26f60834,
+0x26f60832,
+0x26720832,
+0x26f60834,
+0x26720834,
+0x26f6082e,
+0x268f082e,
+0x26f60834,
+0x268f0834,
+0x26f6082e,
+0x2699082e,
+0x26f60834,
+0x26990834,
+0x26f6082e,
+0x269a082e,
+0x26f60834,
+0x269a0834,
+0x26f6082e,
+0x270c082e,
+0x26f60830,
+0x270c0830,
+0x26f60832,
+0x270c0832,
+0x26f60834,
+0x270c0834,
+0x26f6082e,
+0x2714082e,
+0x26f60830,
+0x27140830,
+0x26f60832,
+0x27140832,
+0x26f60834,
+0x27140834,
+0x26f6082e,
+0x2714082e,
+0x2714082e,
+0x26f60832,
+0x27140832,
+0x27140832,
+0x26f60832,
+0x27140832,
+0x27370832,
+0x26f60832,
+0x27360832,
+0x26f60834,
+0x27360834,
+0x26f60832,
+0x27370832,
+0x26f60834,
+0x27370834,
+0x26f70804,
+0x26f7082e,
+0x26f70830,
+0x26f70832,
+0x26f70834,
+0x26f80804,
+0x26f90804,
+0x26fa0804,
+0x26fb0804,
+0x26fc0804,
+0x26fc082e,
+0x26fc0830,
+0x26fc0832,
+0x26fc0834,
+0x26fd0804,
+0x26fe0804,
+0x26ff0804,
+0x26ff082e,
+0x26ff0830,
+0x26ff0832,
+0x26ff0834,
+0x27000804,
+0x27010804,
+0x27020804,
+0x2702082e,
+0x27020830,
+0x27020832,
+0x27020834,
+0x27030804,
+0x27040804,
+0x2704082e,
+0x27040830,
+0x27040832,
+0x27040834,
+0x27050804,
+0x27060804,
+0x27070804,
+0x27080804,
+0x27090804,
+0x270a0804,
+0x270c0804,
+0x270c080a,
+0x270c082e,
+0x270c0830,
+0x270c0832,
+0x270c0834,
+0x270c0832,
+0x26650832,
+0x270c0834,
+0x26650834,
+0x270c0832,
+0x26660832,
+0x270c0834,
+0x26660834,
+0x270c0832,
+0x266a0832,
+0x270c0834,
+0x266a0834,
+0x270c0832,
+0x26720832,
+0x270c0834,
+0x26720834,
+0x270c082e,
+0x268f082e,
+0x270c0834,
+0x268f0834,
+0x270c082e,
+0x268f082e,
+0x268f082e,
+0x270c0832,
+0x268f0832,
+0x268f0832,
+0x270c082e,
+0x268f082e,
+0x2714082e,
+0x270c0832,
+0x268f0832,
+0x27140832,
+0x270c0832,
+0x268f0832,
+0x27370832,
+0x270c082e,
+0x2699082e,
+0x270c0834,
+0x26990834,
+0x270c082e,
+0x2699082e,
+0x2714082e,
+0x270c0832,
+0x26990832,
+0x27140832,
+0x270c0832,
+0x26990832,
+0x27360832,
+0x270c0832,
+0x26990832,
+0x27370832,
+0x270c082e,
+0x269a082e,
+0x270c0834,
+0x269a0834,
+0x270c082e,
+0x269a082e,
+0x2714082e,
+0x270c0832,
+0x269a0832,
+0x27140832,
+0x270c082e,
+0x2714082e,
+0x270c0830,
+0x27140830,
+0x270c0832,
+0x27140832,
+0x270c0834,
+0x27140834,
+0x270c082e,
+0x2714082e,
+0x2699082e,
+0x270c0832,
+0x27140832,
+0x26990832,
+0x270c0832,
+0x27140832,
+0x27370832,
+0x270c082e,
+0x2722082e,
+0x270c0832,
+0x27360832,
+0x270c0834,
+0x27360834,
+0x270c0832,
+0x27370832,
+0x270c0834,
+0x27370834,
+0x270d0804,
+0x270e0804,
+0x270f0804,
+0x27100804,
+0x27110804,
+0x27120804,
+0x27140804,
+0x2714080a,
+0x2714082e,
+0x27140830,
+0x27140832,
+0x27140834,
+0x27140808,
+0x4648,
+0x27140832,
+0x26720832,
+0x2714082e,
+0x268f082e,
+0x27140834,
+0x268f0834,
+0x2714082e,
+0x268f082e,
+0x2699082e,
+0x2714082e,
+0x268f082e,
+0x269a082e,
+0x2714082e,
+0x268f082e,
+0x2714082e,
+0x27140832,
+0x268f0832,
+0x27370832,
+0x2714082e,
+0x2699082e,
+0x27140834,
+0x26990834,
+0x2714082e,
+0x2699082e,
+0x268f082e,
+0x2714082e,
+0x2699082e,
+0x2714082e,
+0x27140834,
+0x26990834,
+0x27140834,
+0x26a40834,
+0x27140832,
+0x26990832,
+0x27370832,
+0x2714082e,
+0x269a082e,
+0x27140834,
+0x269a0834,
+0x2714082e,
+0x269a082e,
+0x268f082e,
+0x2714082e,
+0x269a082e,
+0x2714082e,
+0x27140832,
+0x269a0832,
+0x27370832,
+0x2714082e,
+0x2714082e,
+0x27140832,
+0x27140832,
+0x27140834,
+0x27140834,
+0x27140832,
+0x27140832,
+0x27370832,
+0x27140834,
+0x27360834,
+0x27140834,
+0x27370834,
+0x27150804,
+0x27160804,
+0x27170804,
+0x27180804,
+0x2718080a,
+0x2718082e,
+0x27180830,
+0x27180832,
+0x27180834,
+0x2718082e,
+0x268f082e,
+0x27180834,
+0x268f0834,
+0x2718082e,
+0x268f082e,
+0x2699082e,
+0x27180832,
+0x268f0832,
+0x26990832,
+0x2718082e,
+0x268f082e,
+0x2714082e,
+0x27180832,
+0x268f0832,
+0x27140832,
+0x27180832,
+0x268f0832,
+0x27360832,
+0x27180832,
+0x268f0832,
+0x27370832,
+0x2718082e,
+0x2699082e,
+0x27180834,
+0x26990834,
+0x2718082e,
+0x2699082e,
+0x2714082e,
+0x27180832,
+0x26990832,
+0x27360832,
+0x27180832,
+0x26990832,
+0x27370832,
+0x2718082e,
+0x269a082e,
+0x27180834,
+0x269a0834,
+0x27180832,
+0x26b30832,
+0x27180832,
+0x26b40832,
+0x2718082e,
+0x2714082e,
+0x27180830,
+0x27140830,
+0x27180832,
+0x27140832,
+0x27180834,
+0x27140834,
+0x27180832,
+0x27140832,
+0x27360832,
+0x27180832,
+0x27140832,
+0x27370832,
+0x27180832,
+0x27180832,
+0x2718082e,
+0x2722082e,
+0x27180830,
+0x27220830,
+0x27180832,
+0x27360832,
+0x27180834,
+0x27360834,
+0x27180832,
+0x27370832,
+0x27180834,
+0x27370834,
+0x27190804,
+0x2719080a,
+0x27190832,
+0x27190834,
+0x271b0804,
+0x271b082e,
+0x271b0830,
+0x271b0832,
+0x271b0834,
+0x271c0804,
+0x271d0804,
+0x271e0804,
+0x271f0804,
+0x27200804,
+0x27210804,
+0x27220804,
+0x2722080a,
+0x2722082e,
+0x27220830,
+0x27220832,
+0x27220834,
+0x2722082e,
+0x262e,
+0x2722082e,
+0x268f082e,
+0x27220834,
+0x268f0834,
+0x2722082e,
+0x2714082e,
+0x27220834,
+0x27140834,
+0x2722082e,
+0x2714082e,
+0x268f082e,
+0x2722082e,
+0x2714082e,
+0x2714082e,
+0x27220834,
+0x27360834,
+0x27220834,
+0x27370834,
+0x27230804,
+0x2723082e,
+0x27230830,
+0x27230832,
+0x27230834,
+0x27240804,
+0x2724082e,
+0x27240830,
+0x27240832,
+0x27240834,
+0x27240804,
+0x20c4,
+0x27250804,
+0x27260804,
+0x27270804,
+0x27270804,
+0x20c4,
+0x27270832,
+0x20f2,
+0x27270834,
+0x20f4,
+0x27280804,
+0x27280808,
+0x2728080a,
+0x27280832,
+0x27280834,
+0x27280808,
+0x26640808,
+0x27280834,
+0x26c60834,
+0x270c0834,
+0x27140834,
+0x27290804,
+0x272a0804,
+0x272a0832,
+0x272a0834,
+0x272b0804,
+0x272b0832,
+0x272b0834,
+0x272c0804,
+0x272c0832,
+0x272c0834,
+0x272c0808,
+0x26640808,
+0x272c0834,
+0x26640834,
+0x272d0804,
+0x272d0832,
+0x272d0834,
+0x272e0804,
+0x272e0832,
+0x272e0834,
+0x272f0804,
+0x27300804,
+0x27300832,
+0x27300834,
+0x27310804,
+0x27320804,
+0x27330804,
+0x27340804,
+0x27350804,
+0x27360804,
+0x2736082e,
+0x27360830,
+0x27360832,
+0x27360834,
+0x27360832,
+0x2632,
+0x27360834,
+0x2634,
+0x27370804,
+0x27370808,
+0x2737080a,
+0x2737082e,
+0x27370830,
+0x27370832,
+0x27370834,
+0x27370808,
+0x26640808,
+0x2737082e,
+0x268f082e,
+0x27370834,
+0x268f0834,
+0x27370832,
+0x268f0832,
+0x27370832,
+0x2737082e,
+0x2699082e,
+0x27370834,
+0x26990834,
+0x27370832,
+0x26990832,
+0x27370832,
+0x2737082e,
+0x269a082e,
+0x27370834,
+0x269a0834,
+0x27370832,
+0x26b30832,
+0x27370832,
+0x26b40832,
+0x2737082e,
+0x2714082e,
+0x27370830,
+0x27140830,
+0x27370832,
+0x27140832,
+0x27370834,
+0x27140834,
+0x2737082e,
+0x2714082e,
+0x2714082e,
+0x27370832,
+0x27140832,
+0x27140832,
+0x27370832,
+0x27140832,
+0x27370832,
+0x27370832,
+0x27180832,
+0x2737082e,
+0x2722082e,
+0x27370830,
+0x27220830,
+0x27370832,
+0x27360832,
+0x27370834,
+0x27360834,
+0x27370832,
+0x27370832,
+0x27370834,
+0x27370834,
+0x27380804,
+0x2738082e,
+0x27380830,
+0x27380832,
+0x27380834,
+0x27390804,
+0x273a0804,
+0x273b0804,
+0x273b082e,
+0x273b0830,
+0x273b0832,
+0x273b0834,
+0x273c0804,
+0x273d0804,
+0x273e0804,
+0x273f0804,
+0x27400804,
+0x27410804,
+0x27420804,
+0x27430804,
+0x27450804,
+0x27450832,
+0x27450834,
+0x27450804,
+0x20c4,
+0x27450832,
+0x20f2,
+0x27450834,
+0x20f4,
+0x27460804,
+0x27470804,
+0x27480804,
+0x27490804,
+0x27490808,
+0x4688,
+0x274a0804,
+0x274a0808,
+0x4648,
+0x274a0808,
+0x4688,
+0x274b0804,
+0x274c0804,
+0x274c0808,
+0x4688,
+0x274d0804,
+0x274e0804,
+0x274f0804,
+0x27500804,
+0x27510804,
+0x27520804,
+0x27520808,
+0x4648,
+0x27530804,
+0x27540804,
+0x27550804,
+0x27560804,
+0x27570804,
+0x27580804,
+0x27590804,
+0x275a0804,
+0x275a0832,
+0x275b0804,
+0x275c0804,
+0x275c0808,
+0x4648,
+0x275d0804,
+0x275e0804,
+0x275f0804,
+0x27600804,
+0x27610804,
+0x27620804,
+0x276e0804,
+0x276f0804,
+0x27700804,
+0x27710804,
+0x27720804,
+0x27730804,
+0x27740804,
+0x27750804,
+0x27760804,
+0x27770804,
+0x27780804,
+0x27790804,
+0x277a0804,
+0x277b0804,
+0x277c0804,
+0x277d0804,
+0x277e0804,
+0x277f0804,
+0x27800804,
+0x27810804,
+0x27820804,
+0x27830804,
+0x27840804,
+0x27850804,
+0x27860804,
+0x27870804,
+0x27880804,
+0x27890804,
+0x278a0804,
+0x278b0804,
+0x278c0804,
+0x278d0804,
+0x278e0804,
+0x278f0804,
+0x27900804,
+0x27910804,
+0x27920804,
+0x27930804,
+0x27940804,
+0x27950804,
+0x27960804,
+0x27970804,
+0x27980804,
+0x27990804,
+0x279a0804,
+0x279b0804,
+0x279c0804,
+0x279d0804,
+0x279e0804,
+0x279f0804,
+0x27a00804,
+0x27a10804,
+0x27a20804,
+0x27a30804,
+0x27a40804,
+0x27a50804,
+0x27a60804,
+0x27a70804,
+0x27a80804,
+0x27a90804,
+0x27aa0804,
+0x27ab0804,
+0x27ac0804,
+0x27ad0804,
+0x27ae0804,
+0x27af0804,
+0x27b00804,
+0x27b10804,
+0x27b20804,
+0x27b30804,
+0x27b40804,
+0x27b50804,
+0x27b60804,
+0x27b70804,
+0x27b80804,
+0x27b90804,
+0x27ba0804,
+0x27bb0804,
+0x27bc0804,
+0x27bd0804,
+0x27be0804,
+0x27bf0804,
+0x27c00804,
+0x27c10804,
+0x27c20804,
+0x27c30804,
+0x27c40804,
+0x27c50804,
+0x27c50808,
+0x4608,
+0x27c60804,
+0x27c60808,
+0x4608,
+0x27c70804,
+0x27c80804,
+0x27c80808,
+0x4608,
+0x27c90804,
+0x27ca0804,
+0x27cb0804,
+0x27cc0804,
+0x27cd0804,
+0x27ce0804,
+0x27cf0804,
+0x27d00804,
+0x27d10804,
+0x27d20804,
+0x27d30804,
+0x27d40804,
+0x27d50804,
+0x27d60804,
+0x27d70804,
+0x27d80804,
+0x27d90804,
+0x27da0804,
+0x27db0804,
+0x27dc0804,
+0x27dd0804,
+0x27de0804,
+0x27df0804,
+0x27e00804,
+0x27e10804,
+0x27e20804,
+0x27e30804,
+0x27e40804,
+0x27e50804,
+0x27e60804,
+0x27e70804,
+0x27e80804,
+0x27e90804,
+0x27ea0804,
+0x27eb0804,
+0x27ec0804,
+0x27ed0804,
+0x27ee0804,
+0x27ef0804,
+0x27f00804,
+0x27f10804,
+0x27f20804,
+0x27f30804,
+0x27f40804,
+0x27f50804,
+0x27f60804,
+0x27f70804,
+0x27f80804,
+0x27f90804,
+0x27fa0804,
+0x27fb0804,
+0x27fc0804,
+0x27fd0804,
+0x27fe0804,
+0x27ff0804,
+0x28000804,
+0x28010804,
+0x28020804,
+0x28030804,
+0x28040804,
+0x28050804,
+0x28060804,
+0x28070804,
+0x28080804,
+0x28090804,
+0x280a0804,
+0x280b0804,
+0x280c0804,
+0x280d0804,
+0x280e0804,
+0x280f0804,
+0x28100804,
+0x28110804,
+0x28120804,
+0x28130804,
+0x28140804,
+0x28150804,
+0x28160804,
+0x28170804,
+0x28180804,
+0x28190804,
+0x281a0804,
+0x281b0804,
+0x281c0804,
+0x281d0804,
+0x281e0804,
+0x281f0804,
+0x28200804,
+0x28210804,
+0x28220804,
+0x28230804,
+0x28240804,
+0x28250804,
+0x28260804,
+0x28270804,
+0x28280804,
+0x28290804,
+0x282a0804,
+0x282b0804,
+0x282c0804,
+0x282d0804,
+0x282e0804,
+0x282f0804,
+0x28300804,
+0x28310804,
+0x28320804,
+0x28330804,
+0x28340804,
+0x28350804,
+0x28360804,
+0x28370804,
+0x28380804,
+0x28390804,
+0x283a0804,
+0x283b0804,
+0x283c0804,
+0x283d0804,
+0x283e0804,
+0x283f0804,
+0x28400804,
+0x28410804,
+0x28420804,
+0x28430804,
+0x28440804,
+0x28450804,
+0x28460804,
+0x28470804,
+0x28480804,
+0x28490804,
+0x284a0804,
+0x284b0804,
+0x284c0804,
+0x284d0804,
+0x284e0804,
+0x284f0804,
+0x28500804,
+0x28510804,
+0x28520804,
+0x28530804,
+0x28540804,
+0x28550804,
+0x28560804,
+0x28570804,
+0x28580804,
+0x28590804,
+0x285a0804,
+0x285b0804,
+0x285c0804,
+0x285d0804,
+0x285e0804,
+0x285f0804,
+0x28600804,
+0x28610804,
+0x28620804,
+0x28630804,
+0x28640804,
+0x28650804,
+0x28660804,
+0x28670804,
+0x28680804,
+0x28690804,
+0x286a0804,
+0x286b0804,
+0x286c0804,
+0x286d0804,
+0x286e0804,
+0x286f0804,
+0x28700804,
+0x28710804,
+0x28720804,
+0x28730804,
+0x28740804,
+0x28750804,
+0x28760804,
+0x28770804,
+0x28780804,
+0x28790804,
+0x287a0804,
+0x287b0804,
+0x287c0804,
+0x287d0804,
+0x287e0804,
+0x287f0804,
+0x28800804,
+0x28810804,
+0x28820804,
+0x28830804,
+0x28840804,
+0x28850804,
+0x28860804,
+0x28870804,
+0x28880804,
+0x28890804,
+0x288a0804,
+0x288b0804,
+0x288c0804,
+0x288d0804,
+0x288e0804,
+0x288f0804,
+0x28900804,
+0x28910804,
+0x28920804,
+0x28930804,
+0x28940804,
+0x28950804,
+0x28960804,
+0x28970804,
+0x28980804,
+0x28990804,
+0x289a0804,
+0x289b0804,
+0x289c0804,
+0x289d0804,
+0x289e0804,
+0x289f0804,
+0x28a00804,
+0x28a10804,
+0x28a20804,
+0x28a30804,
+0x28a40804,
+0x28a50804,
+0x28a60804,
+0x28a70804,
+0x28a80804,
+0x28a90804,
+0x28aa0804,
+0x28ab0804,
+0x28ac0804,
+0x28ad0804,
+0x28ae0804,
+0x28af0804,
+0x28b00804,
+0x28b10804,
+0x28b20804,
+0x28b30804,
+0x28b40804,
+0x28b50804,
+0x28b60804,
+0x28b70804,
+0x28b80804,
+0x28b90804,
+0x28ba0804,
+0x28bb0804,
+0x28bc0804,
+0x28bd0804,
+0x28be0804,
+0x28bf0804,
+0x28c00804,
+0x28c10804,
+0x28c20804,
+0x28c30804,
+0x28c40804,
+0x28c50804,
+0x28c60804,
+0x28c70804,
+0x28c80804,
+0x28c90804,
+0x28ca0804,
+0x28cb0804,
+0x28cc0804,
+0x28cd0804,
+0x28ce0804,
+0x28cf0804,
+0x28d00804,
+0x28d10804,
+0x28d20804,
+0x28d30804,
+0x28d40804,
+0x28d50804,
+0x28d60804,
+0x28d70804,
+0x28d80804,
+0x28d90804,
+0x28da0804,
+0x28db0804,
+0x28dc0804,
+0x28dd0804,
+0x28de0804,
+0x28df0804,
+0x28e00804,
+0x28e10804,
+0x28e20804,
+0x28e30804,
+0x28e40804,
+0x28e50804,
+0x28e60804,
+0x28e70804,
+0x28e80804,
+0x28e90804,
+0x28ea0804,
+0x28eb0804,
+0x28ec0804,
+0x28ed0804,
+0x28ee0804,
+0x28ef0804,
+0x28f00804,
+0x28f10804,
+0x28f20804,
+0x28f30804,
+0x28f40804,
+0x28f50804,
+0x28f60804,
+0x28f70804,
+0x28f80804,
+0x28f90804,
+0x28fa0804,
+0x28fb0804,
+0x28fc0804,
+0x28fd0804,
+0x28fe0804,
+0x28ff0804,
+0x29000804,
+0x29010804,
+0x29020804,
+0x29030804,
+0x29040804,
+0x29050804,
+0x29060804,
+0x29070804,
+0x29080804,
+0x29090804,
+0x290a0804,
+0x290b0804,
+0x290c0804,
+0x290d0804,
+0x290e0804,
+0x290f0804,
+0x29100804,
+0x29110804,
+0x29120804,
+0x29130804,
+0x29140804,
+0x29150804,
+0x29160804,
+0x29170804,
+0x29180804,
+0x29190804,
+0x291a0804,
+0x291b0804,
+0x291c0804,
+0x291d0804,
+0x291e0804,
+0x291f0804,
+0x29200804,
+0x29210804,
+0x29220804,
+0x29230804,
+0x29240804,
+0x29250804,
+0x29260804,
+0x29270804,
+0x29280804,
+0x29290804,
+0x292a0804,
+0x292b0804,
+0x292c0804,
+0x292d0804,
+0x292e0804,
+0x292f0804,
+0x29300804,
+0x29310804,
+0x29320804,
+0x29330804,
+0x29340804,
+0x29350804,
+0x29360804,
+0x29370804,
+0x29380804,
+0x29390804,
+0x293a0804,
+0x293b0804,
+0x293c0804,
+0x293d0804,
+0x293e0804,
+0x293f0804,
+0x29400804,
+0x29410804,
+0x29420804,
+0x29430804,
+0x29440804,
+0x29450804,
+0x29460804,
+0x29470804,
+0x29480804,
+0x29490804,
+0x294a0804,
+0x294b0804,
+0x294c0804,
+0x294d0804,
+0x294e0804,
+0x294f0804,
+0x29500804,
+0x29510804,
+0x29520804,
+0x29530804,
+0x29540804,
+0x29550804,
+0x29560804,
+0x29570804,
+0x29580804,
+0x29590804,
+0x295a0804,
+0x295b0804,
+0x295c0804,
+0x295d0804,
+0x295e0804,
+0x295f0804,
+0x29600804,
+0x29610804,
+0x29620804,
+0x29630804,
+0x29640804,
+0x29650804,
+0x29660804,
+0x29670804,
+0x29680804,
+0x29690804,
+0x296a0804,
+0x296b0804,
+0x296c0804,
+0x296d0804,
+0x296e0804,
+0x296f0804,
+0x29700804,
+0x29710804,
+0x29720804,
+0x29730804,
+0x29740804,
+0x29750804,
+0x29760804,
+0x29770804,
+0x29780804,
+0x29790804,
+0x297a0804,
+0x297b0804,
+0x297c0804,
+0x297d0804,
+0x297e0804,
+0x297f0804,
+0x29800804,
+0x29810804,
+0x29820804,
+0x29830804,
+0x29840804,
+0x29850804,
+0x29860804,
+0x29870804,
+0x29880804,
+0x29890804,
+0x298a0804,
+0x298b0804,
+0x298c0804,
+0x298d0804,
+0x298e0804,
+0x298f0804,
+0x29900804,
+0x29910804,
+0x29920804,
+0x29930804,
+0x29940804,
+0x29950804,
+0x29960804,
+0x29970804,
+0x29980804,
+0x29990804,
+0x299a0804,
+0x299b0804,
+0x299c0804,
+0x299d0804,
+0x299e0804,
+0x299f0804,
+0x29a00804,
+0x29a10804,
+0x29a20804,
+0x29a30804,
+0x29a40804,
+0x29a50804,
+0x29a60804,
+0x29a70804,
+0x29a80804,
+0x29a90804,
+0x29aa0804,
+0x29ab0804,
+0x29ac0804,
+0x29ad0804,
+0x29ae0804,
+0x29af0804,
+0x29b00804,
+0x29b10804,
+0x29b20804,
+0x29b30804,
+0x29b40804,
+0x29b50804,
+0x29b60804,
+0x29b70804,
+0x29b80804,
+0x29b90804,
+0x29ba0804,
+0x29bb0804,
+0x29bc0804,
+0x29bd0804,
+0x29be0804,
+0x29bf0804,
+0x29c00804,
+0x29c10804,
+0x29c20804,
+0x29c30804,
+0x29c40804,
+0x29c50804,
+0x29c60804,
+0x29c70804,
+0x29c80804,
+0x29c90804,
+0x29ca0804,
+0x29cb0804,
+0x29cc0804,
+0x29cd0804,
+0x29ce0804,
+0x29cf0804,
+0x29d00804,
+0x29d10804,
+0x29d20804,
+0x29d30804,
+0x29d40804,
+0x29d50804,
+0x29d60804,
+0x29d70804,
+0x29d80804,
+0x29d90804,
+0x29da0804,
+0x29db0804,
+0x29dc0804,
+0x29dd0804,
+0x29de0804,
+0x29df0804,
+0x29e00804,
+0x29e10804,
+0x29e20804,
+0x29e30804,
+0x29e40804,
+0x29e50804,
+0x29e60804,
+0x29e70804,
+0x29e80804,
+0x29e90804,
+0x29ea0804,
+0x29eb0804,
+0x29ec0804,
+0x29ed0804,
+0x29ef0804,
+0x29f00804,
+0x29f10804,
+0x29f20804,
+0x29f30804,
+0x29f30804,
+0x3084,
+0x29f40804,
+0x29f40804,
+0x3084,
+0x29f50804,
+0x29f50804,
+0x3084,
+0x29f60804,
+0x29f70804,
+0x29f80804,
+0x29f90804,
+0x29fa0804,
+0x29fb0804,
+0x29fb0804,
+0x3084,
+0x29fc0804,
+0x29fd0804,
+0x29fe0804,
+0x29ff0804,
+0x2a000804,
+0x2a010804,
+0x2a020804,
+0x2a030804,
+0x2a030804,
+0x3084,
+0x2a040804,
+0x2a050804,
+0x2a050804,
+0x3084,
+0x2a060804,
+0x2a070804,
+0x2a080804,
+0x2a090804,
+0x2a0a0804,
+0x2a0b0804,
+0x2a0b0804,
+0x3084,
+0x2a0c0804,
+0x2a0d0804,
+0x2a0d0804,
+0x3084,
+0x2a0e0804,
+0x2a0f0804,
+0x2a100804,
+0x2a110804,
+0x2a120804,
+0x2a120804,
+0x3084,
+0x2a130804,
+0x2a140804,
+0x2a140804,
+0x3084,
+0x2a150804,
+0x2a160804,
+0x2a160804,
+0x3084,
+0x2a170804,
+0x2a180804,
+0x2a190804,
+0x2a1a0804,
+0x2a1b0804,
+0x2a1c0804,
+0x2a1d0804,
+0x2a1e0804,
+0x2a1e0808,
+0x2a1f0804,
+0x2a200804,
+0x2a210804,
+0x2a210808,
+0x2a220804,
+0x2a230804,
+0x2a240804,
+0x2a250804,
+0x2a260804,
+0x2a270804,
+0x2a280804,
+0x2a290804,
+0x2a2a0804,
+0x2a2b0804,
+0x2a2c0804,
+0x2a2d0804,
+0x2a2e0804,
+0x2a2f0804,
+0x2a300804,
+0x2a310804,
+0x2a320804,
+0x2a330804,
+0x2a340804,
+0x2a350804,
+0x2a360804,
+0x2a380804,
+0x2a390804,
+0x2a3a0804,
+0x2a3b0804,
+0x2a3c0804,
+0x2a3d0804,
+0x2a3e0804,
+0x2a3f0804,
+0x2a400804,
+0x2a410804,
+0x2a420804,
+0x2a430804,
+0x2a440804,
+0x2a450804,
+0x2a460804,
+0x2a470804,
+0x2a480804,
+0x2a490804,
+0x2a4a0804,
+0x2a4b0804,
+0x2a4c0804,
+0x2a4d0804,
+0x2a4e0804,
+0x2a4f0804,
+0x2a500804,
+0x2a510804,
+0x2a520804,
+0x2a530804,
+0x2a540804,
+0x2a550804,
+0x2a560804,
+0x2a570804,
+0x2a580804,
+0x2a580804,
+0x3084,
+0x2a590804,
+0x2a590804,
+0x3084,
+0x2a5a0804,
+0x2a5b0804,
+0x2a5b0808,
+0x2a7c0808,
+0x2a5c0804,
+0x2a5d0804,
+0x2a5e0804,
+0x2a5f0804,
+0x2a600804,
+0x2a610804,
+0x2a620804,
+0x2a630804,
+0x2a640804,
+0x2a650804,
+0x2a650804,
+0x3084,
+0x2a660804,
+0x2a670804,
+0x2a680804,
+0x2a690804,
+0x2a6a0804,
+0x2a6b0804,
+0x2a6c0804,
+0x2a6d0804,
+0x2a6e0804,
+0x2a6f0804,
+0x2a700804,
+0x2a710804,
+0x2a720804,
+0x2a730804,
+0x2a740804,
+0x2a750804,
+0x2a760804,
+0x2a770804,
+0x2a780804,
+0x2a790804,
+0x2a7a0804,
+0x2a7b0804,
+0x2a7c0804,
+0x2a7d0804,
+0x2a7f0804,
+0x2a800804,
+0x2a810804,
+0x2a820804,
+0x2a830804,
+0x2a840804,
+0x2a850804,
+0x2a860804,
+0x2a870804,
+0x2a880804,
+0x2a890804,
+0x2a8a0804,
+0x2a8b0804,
+0x2a8c0804,
+0x2a8c0804,
+0x3084,
+0x2a8d0804,
+0x2a8e0804,
+0x2a8f0804,
+0x2a900804,
+0x2a900804,
+0x3084,
+0x2a910804,
+0x2a910804,
+0x3084,
+0x2a920804,
+0x2a930804,
+0x2a940804,
+0x2a950804,
+0x2a960804,
+0x2a960804,
+0x3084,
+0x2a970804,
+0x2a980804,
+0x2a990804,
+0x2a9a0804,
+0x2a9b0804,
+0x2a9c0804,
+0x2a9d0804,
+0x2a9e0804,
+0x2a9f0804,
+0x2aa00804,
+0x2aa10804,
+0x2aa20804,
+0x2aa30804,
+0x2aa40804,
+0x2aa40804,
+0x3084,
+0x2aa50804,
+0x2aa60804,
+0x2aa70804,
+0x2aa80804,
+0x2aa90804,
+0x2aaa0804,
+0x2aab0804,
+0x2aab0804,
+0x3084,
+0x2aac0804,
+0x2aad0804,
+0x2aae0804,
+0x2aaf0804,
+0x2ab00804,
+0x2ab10804,
+0x2ab20804,
+0x2ab30804,
+0x2ab40804,
+0x2ab50804,
+0x2ab60804,
+0x2ab70804,
+0x2ab80804,
+0x2ab90804,
+0x2aba0804,
+0x2abb0804,
+0x2abc0804,
+0x2abd0804,
+0x2abe0804,
+0x2abf0804,
+0x2ac00804,
+0x2ac10804,
+0x2ac20804,
+0x2ac30804,
+0x2ac40804,
+0x2ac50804,
+0x2ac60804,
+0x2ac70804,
+0x2ac80804,
+0x2ac90804,
+0x2aca0804,
+0x2acb0804,
+0x2acc0804,
+0x2acd0804,
+0x2ace0804,
+0x2acf0804,
+0x2ad00804,
+0x2ad10804,
+0x2ad20804,
+0x2ad30804,
+0x2ad40804,
+0x2ad50804,
+0x2ad60804,
+0x2ad70804,
+0x2ad80804,
+0x2ad90804,
+0x2ada0804,
+0x2adb0804,
+0x2adc0804,
+0x2add0804,
+0x2ade0804,
+0x2adf0804,
+0x2ae00804,
+0x2ae10804,
+0x2ae20804,
+0x2ae30804,
+0x2ae40804,
+0x2ae50804,
+0x2ae60804,
+0x2ae70804,
+0x2ae80804,
+0x2ae90804,
+0x2aea0804,
+0x2aeb0804,
+0x2aec0804,
+0x2aed0804,
+0x2aee0804,
+0x2aef0804,
+0x2af00804,
+0x2af10804,
+0x2af20804,
+0x2af30804,
+0x2af40804,
+0x2af50804,
+0x2af60804,
+0x2af70804,
+0x2af80804,
+0x2af90804,
+0x2afa0804,
+0x2afb0804,
+0x2afc0804,
+0x2afd0804,
+0x2afe0804,
+0x2aff0804,
+0x2b000804,
+0x2b010804,
+0x2b020804,
+0x2b030804,
+0x2b040804,
+0x2b050804,
+0x2b060804,
+0x2b070804,
+0x2b080804,
+0x2b090804,
+0x2b0a0804,
+0x2b0b0804,
+0x2b0c0804,
+0x2b0d0804,
+0x2b0e0804,
+0x2b0f0804,
+0x2b100804,
+0x2b110804,
+0x2b120804,
+0x2b130804,
+0x2b140804,
+0x2b150804,
+0x2b160804,
+0x2b170804,
+0x2b170804,
+0x3084,
+0x2b180804,
+0x2b180804,
+0x3084,
+0x2b190804,
+0x2b1a0804,
+0x2b1b0804,
+0x2b1c0804,
+0x2b1d0804,
+0x2b1e0804,
+0x2b1f0804,
+0x2b200804,
+0x2b210804,
+0x2b220804,
+0x2b230804,
+0x2b240804,
+0x2b250804,
+0x2b260804,
+0x2b270804,
+0x2b280804,
+0x2b290804,
+0x2b2a0804,
+0x2b2b0804,
+0x2b2c0804,
+0x2b2d0804,
+0x2b2e0804,
+0x2b2f0804,
+0x2b300804,
+0x2b310804,
+0x2b320804,
+0x2b330804,
+0x2b340804,
+0x2b350804,
+0x2b360804,
+0x2b370804,
+0x2b380804,
+0x2b390804,
+0x2b3a0804,
+0x2b3b0804,
+0x2b3c0804,
+0x2b3d0804,
+0x2b3e0804,
+0x2b3f0804,
+0x2b400804,
+0x2b410804,
+0x2b420804,
+0x2b430804,
+0x2b440804,
+0x2b450804,
+0x2b460804,
+0x2b470804,
+0x2b480804,
+0x2b490804,
+0x2b4a0804,
+0x2b4b0804,
+0x2b4c0804,
+0x2b4d0804,
+0x2b4e0804,
+0x2b4f0804,
+0x2b500804,
+0x2b510804,
+0x2b520804,
+0x2b530804,
+0x2b540804,
+0x2b550804,
+0x2b560804,
+0x2b570804,
+0x2b580804,
+0x2b590804,
+0x2b5a0804,
+0x2b5b0804,
+0x2b5c0804,
+0x2b5d0804,
+0x2b5e0804,
+0x2b5f0804,
+0x2b600804,
+0x2b610804,
+0x2b620804,
+0x2b630804,
+0x2b640804,
+0x2b650804,
+0x2b660804,
+0x2b670804,
+0x2b680804,
+0x2b690804,
+0x2b6a0804,
+0x2b6b0804,
+0x2b6c0804,
+0x2b6d0804,
+0x2b6e0804,
+0x2b6f0804,
+0x2b700804,
+0x2b710804,
+0x2b720804,
+0x2b730804,
+0x2b740804,
+0x2b750804,
+0x2b760804,
+0x2b770804,
+0x2b780804,
+0x2b790804,
+0x2b7a0804,
+0x2b7b0804,
+0x2b7c0804,
+0x2b7d0804,
+0x2b7e0804,
+0x2b7f0804,
+0x2b800804,
+0x2b810804,
+0x2b820804,
+0x2b830804,
+0x2b840804,
+0x2b850804,
+0x2b860804,
+0x2b870804,
+0x2b880804,
+0x2b890804,
+0x2b8a0804,
+0x2b8b0804,
+0x2b8c0804,
+0x2b8d0804,
+0x2b8e0804,
+0x2b8f0804,
+0x2b900804,
+0x2b910804,
+0x2b920804,
+0x2b930804,
+0x2b940804,
+0x2b950804,
+0x2b960804,
+0x2b970804,
+0x2b980804,
+0x2b990804,
+0x2b9a0804,
+0x2b9b0804,
+0x2b9c0804,
+0x2b9d0804,
+0x2b9e0804,
+0x2b9f0804,
+0x2ba00804,
+0x2ba10804,
+0x2ba20804,
+0x2ba30804,
+0x2ba40804,
+0x2ba50804,
+0x2ba60804,
+0x2ba70804,
+0x2ba80804,
+0x2ba90804,
+0x2baa0804,
+0x2bab0804,
+0x2bac0804,
+0x2bad0804,
+0x2bae0804,
+0x2baf0804,
+0x2bb00804,
+0x2bb10804,
+0x2bb20804,
+0x2bb30804,
+0x2bb40804,
+0x2bb50804,
+0x2bb60804,
+0x2bb70804,
+0x2bb80804,
+0x2bb90804,
+0x2bba0804,
+0x2bbb0804,
+0x2bbc0804,
+0x2bbd0804,
+0x2bbe0804,
+0x2bbf0804,
+0x2bc00804,
+0x2bc10804,
+0x2bc20804,
+0x2bc30804,
+0x2bc40804,
+0x2bc50804,
+0x2bc60804,
+0x2bc70804,
+0x2bc80804,
+0x2bc90804,
+0x2bca0804,
+0x2bcb0804,
+0x2bcc0804,
+0x2bcd0804,
+0x2bce0804,
+0x2bcf0804,
+0x2bd00804,
+0x2bd10804,
+0x2bd20804,
+0x2bd30804,
+0x2bd40804,
+0x2bd50804,
+0x2bd60804,
+0x2bd70804,
+0x2bd80804,
+0x2bd90804,
+0x2bda0804,
+0x2bdb0804,
+0x2bdc0804,
+0x2bdd0804,
+0x2bde0804,
+0x2bdf0804,
+0x2be00804,
+0x2be10804,
+0x2be20804,
+0x2be30804,
+0x2be40804,
+0x2be50804,
+0x2be60804,
+0x2be70804,
+0x2be80804,
+0x2be90804,
+0x2bea0804,
+0x2beb0804,
+0x2bec0804,
+0x2bed0804,
+0x2bee0804,
+0x2bef0804,
+0x2bf00804,
+0x2bf10804,
+0x2bf20804,
+0x2bf40804,
+0x2bf50804,
+0x2bf60804,
+0x2bf70804,
+0x2bf80804,
+0x2bf90804,
+0x2bfa0804,
+0x2bfb0804,
+0x2bfc0804,
+0x2bfd0804,
+0x2bfe0804,
+0x2bff0804,
+0x2c000804,
+0x2c010804,
+0x2c020804,
+0x2c030804,
+0x2c040804,
+0x2c050804,
+0x2c060804,
+0x2c070804,
+0x2c080804,
+0x2c090804,
+0x2c0a0804,
+0x2c0b0804,
+0x2c0c0804,
+0x2c0d0804,
+0x2c0e0804,
+0x2c0f0804,
+0x2c100804,
+0x2c110804,
+0x2c120804,
+0x2c130804,
+0x2c140804,
+0x2c150804,
+0x2c160804,
+0x2c170804,
+0x2c170808,
+0x2c4f0808,
+0x2c180804,
+0x2c190804,
+0x2c1a0804,
+0x2c1b0804,
+0x2c1c0804,
+0x2c1d0804,
+0x2c1e0804,
+0x2c1f0804,
+0x2c200804,
+0x2c210804,
+0x2c220804,
+0x2c230804,
+0x2c240804,
+0x2c250804,
+0x2c250808,
+0x2c4f0808,
+0x2c260804,
+0x2c270804,
+0x2c280804,
+0x2c290804,
+0x2c2a0804,
+0x2c2a0808,
+0x2c4f0808,
+0x2c2b0804,
+0x2c2c0804,
+0x2c2d0804,
+0x2c2e0804,
+0x2c2f0804,
+0x2c300804,
+0x2c310804,
+0x2c320804,
+0x2c320808,
+0x2c4f0808,
+0x2c330804,
+0x2c330808,
+0x2c4f0808,
+0x2c340804,
+0x2c350804,
+0x2c360804,
+0x2c370804,
+0x2c380804,
+0x2c390804,
+0x2c390808,
+0x2c4f0808,
+0x2c3a0804,
+0x2c3b0804,
+0x2c3c0804,
+0x2c3d0804,
+0x2c3f0804,
+0x2c400804,
+0x2c410804,
+0x2c420804,
+0x2c430804,
+0x2c440804,
+0x2c450804,
+0x2c460804,
+0x2c470804,
+0x2c480804,
+0x2c490804,
+0x2c4a0804,
+0x2c4b0804,
+0x2c4c0804,
+0x2c4d0804,
+0x2c4e0804,
+0x2c4f0804,
+0x2c500804,
+0x2c510804,
+0x2c520804,
+0x2c530804,
+0x2c540804,
+0x2c550804,
+0x2c560804,
+0x2c570804,
+0x2c580804,
+0x2c590804,
+0x2c5a0804,
+0x2c5b0804,
+0x2c5c0804,
+0x2c5d0804,
+0x2c5e0804,
+0x2c5f0804,
+0x2c600804,
+0x2c610804,
+0x2c620804,
+0x2c630804,
+0x2c640804,
+0x2c650804,
+0x2c660804,
+0x2c670804,
+0x2c680804,
+0x2c690804,
+0x2c6a0804,
+0x2c6b0804,
+0x2c6c0804,
+0x2c6d0804,
+0x2c6e0804,
+0x2c6f0804,
+0x2c700804,
+0x2c710804,
+0x2c720804,
+0x2c730804,
+0x2c740804,
+0x2c750804,
+0x2c760804,
+0x2c770804,
+0x2c780804,
+0x2c790804,
+0x2c7a0804,
+0x2c7b0804,
+0x2c7c0804,
+0x2c7d0804,
+0x2c7e0804,
+0x2c7f0804,
+0x2c800804,
+0x2c810804,
+0x2c820804,
+0x2c830804,
+0x2c840804,
+0x2c850804,
+0x2c860804,
+0x2c870804,
+0x2c880804,
+0x2c890804,
+0x2c8a0804,
+0x2c8b0804,
+0x2c8c0804,
+0x2c8d0804,
+0x2c8e0804,
+0x2c8f0804,
+0x2c900804,
+0x2c910804,
+0x2c920804,
+0x2c930804,
+0x2c940804,
+0x2c950804,
+0x2c960804,
+0x2c970804,
+0x2c980804,
+0x2c990804,
+0x2c9a0804,
+0x2c9b0804,
+0x2c9c0804,
+0x2c9d0804,
+0x2c9e0804,
+0x2c9f0804,
+0x2ca00804,
+0x2ca10804,
+0x2ca20804,
+0x2ca30804,
+0x2ca40804,
+0x2ca50804,
+0x2ca60804,
+0x2ca70804,
+0x2ca80804,
+0x2ca90804,
+0x2caa0804,
+0x2cab0804,
+0x2cac0804,
+0x2cad0804,
+0x2cae0804,
+0x2caf0804,
+0x2cb00804,
+0x2cb10804,
+0x2cb20804,
+0x2cb30804,
+0x2cb40804,
+0x2cb50804,
+0x2cb60804,
+0x2cb70804,
+0x2cb80804,
+0x2cb90804,
+0x2cba0804,
+0x2cbb0804,
+0x2cbc0804,
+0x2cbd0804,
+0x2cbe0804,
+0x2cbf0804,
+0x2cc00804,
+0x2cc10804,
+0x2cc20804,
+0x2cc30804,
+0x2cc40804,
+0x2cc50804,
+0x2cc60804,
+0x2cc70804,
+0x2cc80804,
+0x2cc90804,
+0x2cca0804,
+0x2ccb0804,
+0x2ccc0804,
+0x2ccd0804,
+0x2cce0804,
+0x2ccf0804,
+0x2cd00804,
+0x2cd10804,
+0x2cd20804,
+0x2cd30804,
+0x2cd40804,
+0x2cd50804,
+0x2cd60804,
+0x2cd70804,
+0x2cd80804,
+0x2cd90804,
+0x2cda0804,
+0x2cdb0804,
+0x2cdc0804,
+0x2cdd0804,
+0x2cde0804,
+0x2cdf0804,
+0x2ce00804,
+0x2ce10804,
+0x2ce20804,
+0x2ce40804,
+0x2ce50804,
+0x2ce60804,
+0x2ce70804,
+0x2ce80804,
+0x2ce90804,
+0x2cea0804,
+0x2ceb0804,
+0x2cec0804,
+0x2ced0804,
+0x2cee0804,
+0x2cef0804,
+0x2cf00804,
+0x2cf10804,
+0x2cf20804,
+0x2cf30804,
+0x2cf40804,
+0x2cf50804,
+0x2cf60804,
+0x2cf70804,
+0x2cf80804,
+0x2cf90804,
+0x2cfa0804,
+0x2cfb0804,
+0x2cfc0804,
+0x2cfd0804,
+0x2cfe0804,
+0x2cff0804,
+0x2d000804,
+0x2d010804,
+0x2d020804,
+0x2d030804,
+0x2d040804,
+0x2d050804,
+0x2d060804,
+0x2d070804,
+0x2d080804,
+0x2d090804,
+0x2d0a0804,
+0x2d0b0804,
+0x2d0c0804,
+0x2d0d0804,
+0x2d0e0804,
+0x2d0f0804,
+0x2d100804,
+0x2d110804,
+0x2d120804,
+0x2d130804,
+0x2d140804,
+0x2d150804,
+0x2d160804,
+0x2d170804,
+0x2d180804,
+0x2d190804,
+0x2d1a0804,
+0x2d1b0804,
+0x2d1c0804,
+0x2d1d0804,
+0x2d1e0804,
+0x2d1f0804,
+0x2d200804,
+0x2d210804,
+0x2d220804,
+0x2d230804,
+0x2d240804,
+0x2d250804,
+0x2d260804,
+0x2d270804,
+0x2d280804,
+0x2d290804,
+0x2d2a0804,
+0x2d2b0804,
+0x2d2c0804,
+0x2d2d0804,
+0x2d2e0804,
+0x2d2f0804,
+0x2d300804,
+0x2d310804,
+0x2d320804,
+0x2d330804,
+0x2d340804,
+0x2d350804,
+0x2d360804,
+0x2d370804,
+0x2d380804,
+0x2d390804,
+0x2d3a0804,
+0x2d3b0804,
+0x2d3c0804,
+0x2d3d0804,
+0x2d3e0804,
+0x2d3f0804,
+0x2d400804,
+0x2d410804,
+0x2d420804,
+0x2d430804,
+0x2d440804,
+0x2d450804,
+0x2d460804,
+0x2d470804,
+0x2d480804,
+0x2d490804,
+0x2d4a0804,
+0x2d4b0804,
+0x2d4c0804,
+0x2d4d0804,
+0x2d4e0804,
+0x2d4f0804,
+0x2d500804,
+0x2d510804,
+0x2d520804,
+0x2d530804,
+0x2d540804,
+0x2d550804,
+0x2d560804,
+0x2d570804,
+0x2d580804,
+0x2d590804,
+0x2d5a0804,
+0x2d5b0804,
+0x2d5c0804,
+0x2d5d0804,
+0x2d5d0804,
+0x3084,
+0x2d5e0804,
+0x2d5e0804,
+0x3084,
+0x2d5f0804,
+0x2d600804,
+0x2d610804,
+0x2d620804,
+0x2d630804,
+0x2d640804,
+0x2d650804,
+0x2d660804,
+0x2d670804,
+0x2d670804,
+0x3084,
+0x2d680804,
+0x2d690804,
+0x2d6a0804,
+0x2d6b0804,
+0x2d6c0804,
+0x2d6d0804,
+0x2d6e0804,
+0x2d6f0804,
+0x2d700804,
+0x2d710804,
+0x2d720804,
+0x2d730804,
+0x2d740804,
+0x2d750804,
+0x2d760804,
+0x2d770804,
+0x2d780804,
+0x2d790804,
+0x2d7a0804,
+0x2d7b0804,
+0x2d7c0804,
+0x2d7d0804,
+0x2d7e0804,
+0x2d7f0804,
+0x2d800804,
+0x2d810804,
+0x2d820804,
+0x2d830804,
+0x2d840804,
+0x2d850804,
+0x2d860804,
+0x2d870804,
+0x2d880804,
+0x2d890804,
+0x2d8a0804,
+0x2d8b0804,
+0x2d8c0804,
+0x2d8d0804,
+0x2d8e0804,
+0x2d8f0804,
+0x2d900804,
+0x2d910804,
+0x2d920804,
+0x2d930804,
+0x2d940804,
+0x2d950804,
+0x2d960804,
+0x2d970804,
+0x2d980804,
+0x2d990804,
+0x2d9a0804,
+0x2d9b0804,
+0x2d9c0804,
+0x2d9d0804,
+0x2d9e0804,
+0x2d9f0804,
+0x2da00804,
+0x2da10804,
+0x2da20804,
+0x2da30804,
+0x2da40804,
+0x2da50804,
+0x2da60804,
+0x2da70804,
+0x2da80804,
+0x2da90804,
+0x2daa0804,
+0x2dab0804,
+0x2dac0804,
+0x2dad0804,
+0x2dae0804,
+0x2daf0804,
+0x2db00804,
+0x2db10804,
+0x2db20804,
+0x2db30804,
+0x2db40804,
+0x2db50804,
+0x2db60804,
+0x2db70804,
+0x2db80804,
+0x2db90804,
+0x2dba0804,
+0x2dbb0804,
+0x2dbc0804,
+0x2dbd0804,
+0x2dbe0804,
+0x2dbf0804,
+0x2dc00804,
+0x2dc10804,
+0x2dc20804,
+0x2dc30804,
+0x2dc40804,
+0x2dc50804,
+0x2dc60804,
+0x2dc70804,
+0x2dc80804,
+0x2dc90804,
+0x2dca0804,
+0x2dcb0804,
+0x2dcc0804,
+0x2dcd0804,
+0x2dce0804,
+0x2dcf0804,
+0x2dd00804,
+0x2dd10804,
+0x2dd20804,
+0x2dd30804,
+0x2dd40804,
+0x2dd50804,
+0x2dd60804,
+0x2dd70804,
+0x2dd80804,
+0x2dd90804,
+0x2dda0804,
+0x2ddb0804,
+0x2ddc0804,
+0x2ddd0804,
+0x2dde0804,
+0x2de00804,
+0x2de10804,
+0x2de20804,
+0x2de30804,
+0x2de40804,
+0x2de50804,
+0x2de60804,
+0x2de70804,
+0x2de80804,
+0x2de90804,
+0x2dea0804,
+0x2deb0804,
+0x2dec0804,
+0x2ded0804,
+0x2dee0804,
+0x2def0804,
+0x2df00804,
+0x2df10804,
+0x2df20804,
+0x2df30804,
+0x2df40804,
+0x2df50804,
+0x2df60804,
+0x2df70804,
+0x2df80804,
+0x2df90804,
+0x2dfa0804,
+0x2dfb0804,
+0x2dfc0804,
+0x2dfd0804,
+0x2dfe0804,
+0x2dff0804,
+0x2e000804,
+0x2e010804,
+0x2e020804,
+0x2e030804,
+0x2e040804,
+0x2e050804,
+0x2e060804,
+0x2e070804,
+0x2e080804,
+0x2e090804,
+0x2e0a0804,
+0x2e0b0804,
+0x2e0c0804,
+0x2e0d0804,
+0x2e0e0804,
+0x2e0f0804,
+0x2e100804,
+0x2e110804,
+0x2e120804,
+0x2e130804,
+0x2e140804,
+0x2e150804,
+0x2e160804,
+0x2e170804,
+0x2e180804,
+0x2e190804,
+0x2e1a0804,
+0x2e1b0804,
+0x2e1c0804,
+0x2e1d0804,
+0x2e1e0804,
+0x2e1f0804,
+0x2e200804,
+0x2e210804,
+0x2e220804,
+0x2e230804,
+0x2e240804,
+0x2e250804,
+0x2e260804,
+0x2e270804,
+0x2e280804,
+0x2e290804,
+0x2e2a0804,
+0x2e2b0804,
+0x2e2c0804,
+0x2e2d0804,
+0x2e2e0804,
+0x2e2f0804,
+0x2e300804,
+0x2e310804,
+0x2e320804,
+0x2e330804,
+0x2e340804,
+0x2e350804,
+0x2e360804,
+0x2e370804,
+0x2e380804,
+0x2e390804,
+0x2e3a0804,
+0x2e3b0804,
+0x2e3c0804,
+0x2e3d0804,
+0x2e3e0804,
+0x2e3f0804,
+0x2e400804,
+0x2e410804,
+0x2e420804,
+0x2e430804,
+0x2e440804,
+0x2e450804,
+0x2e460804,
+0x2e470804,
+0x2e480804,
+0x2e490804,
+0x2e4a0804,
+0x2e4b0804,
+0x2e4c0804,
+0x2e4d0804,
+0x2e4e0804,
+0x2e4f0804,
+0x2e500804,
+0x2e510804,
+0x2e520804,
+0x2e530804,
+0x2e540804,
+0x2e550804,
+0x2e560804,
+0x2e570804,
+0x2e580804,
+0x2e590804,
+0x2e5a0804,
+0x2e5b0804,
+0x2e5c0804,
+0x2e5d0804,
+0x2e5e0804,
+0x2e5f0804,
+0x2e600804,
+0x2e610804,
+0x2e620804,
+0x2e630804,
+0x2e640804,
+0x2e650804,
+0x2e660804,
+0x2e670804,
+0x2e680804,
+0x2e690804,
+0x2e6a0804,
+0x2e6b0804,
+0x2e6c0804,
+0x2e6d0804,
+0x2e6e0804,
+0x2e6f0804,
+0x2e700804,
+0x2e710804,
+0x2e720804,
+0x2e730804,
+0x2e740804,
+0x2e750804,
+0x2e760804,
+0x2e770804,
+0x2e780804,
+0x2e790804,
+0x2e7a0804,
+0x2e7b0804,
+0x2e7c0804,
+0x2e7d0804,
+0x2e7e0804,
+0x2e7f0804,
+0x2e800804,
+0x2e810804,
+0x2e820804,
+0x2e830804,
+0x2e840804,
+0x2e850804,
+0x2e860804,
+0x2e870804,
+0x2e880804,
+0x2e890804,
+0x2e8a0804,
+0x2e8b0804,
+0x2e8c0804,
+0x2e8d0804,
+0x2e8e0804,
+0x2e8f0804,
+0x2e900804,
+0x2e910804,
+0x2e920804,
+0x2e930804,
+0x2e940804,
+0x2e950804,
+0x2e960804,
+0x2e970804,
+0x2e980804,
+0x2e990804,
+0x2e9a0804,
+0x2e9b0804,
+0x2e9c0804,
+0x2e9d0804,
+0x2e9e0804,
+0x2e9f0804,
+0x2ea00804,
+0x2ea10804,
+0x2ea20804,
+0x2ea30804,
+0x2ea40804,
+0x2ea50804,
+0x2ea60804,
+0x2ea70804,
+0x2ea80804,
+0x2ea90804,
+0x2eaa0804,
+0x2eab0804,
+0x2eac0804,
+0x2ead0804,
+0x2eae0804,
+0x2eaf0804,
+0x2eb00804,
+0x2eb10804,
+0x2eb20804,
+0x2eb30804,
+0x2eb40804,
+0x2eb50804,
+0x2eb60804,
+0x2eb70804,
+0x2eb80804,
+0x2eb90804,
+0x2f040804,
+0x2f050804,
+0x2f060804,
+0x2f070804,
+0x2f080804,
+0x2f090804,
+0x2f0a0804,
+0x2f0b0804,
+0x2f0c0804,
+0x2f0d0804,
+0x2f0e0804,
+0x2f0f0804,
+0x2f100804,
+0x2f110804,
+0x2f120804,
+0x2f130804,
+0x2f140804,
+0x2f150804,
+0x2f160804,
+0x2f170804,
+0x2f180804,
+0x2f190804,
+0x2f1a0804,
+0x2f1b0804,
+0x2f1c0804,
+0x2f1d0804,
+0x2f1e0804,
+0x2f1f0804,
+0x2f200804,
+0x2f210804,
+0x2f220804,
+0x2f230804,
+0x2f240804,
+0x2f250804,
+0x2f260804,
+0x2f270804,
+0x2f280804,
+0x2f290804,
+0x2f2a0804,
+0x2f2b0804,
+0x2f2c0804,
+0x2f2d0804,
+0x2f2e0804,
+0x2f2f0804,
+0x2f300804,
+0x2f310804,
+0x2f320804,
+0x2f330804,
+0x2f340804,
+0x2f350804,
+0x2f360804,
+0x2f370804,
+0x2f380804,
+0x2f390804,
+0x2f3a0804,
+0x2f3b0804,
+0x2f3c0804,
+0x2f3d0804,
+0x2f3e0804,
+0x2f3f0804,
+0x2f400804,
+0x2f410804,
+0x2f420804,
+0x2f430804,
+0x2f440804,
+0x2f450804,
+0x2f460804,
+0x2f470804,
+0x2f480804,
+0x2f490804,
+0x2f490808,
+0x4608,
+0x2f490808,
+0x4648,
+0x2f4a0804,
+0x2f4a0808,
+0x4608,
+0x2f4b0804,
+0x2f4b0808,
+0x4608,
+0x2f4c0804,
+0x2f4d0804,
+0x2f4e0804,
+0x2f4f0804,
+0x2f500804,
+0x2f510804,
+0x2f520804,
+0x2f530804,
+0x2f540804,
+0x2f550804,
+0x2f560804,
+0x2f570804,
+0x2f580804,
+0x2f590804,
+0x2f5a0804,
+0x2f5b0804,
+0x2f5c0804,
+0x2f5d0804,
+0x2f5e0804,
+0x2f5f0804,
+0x2f600804,
+0x2f610804,
+0x2f620804,
+0x2f630804,
+0x2f640804,
+0x2f650804,
+0x2f660804,
+0x2f670804,
+0x2f680804,
+0x2f690804,
+0x2f6a0804,
+0x2f6b0804,
+0x2f6c0804,
+0x2f6d0804,
+0x2f6e0804,
+0x2f6f0804,
+0x2f700804,
+0x2f710804,
+0x2f720804,
+0x2f730804,
+0x2f740804,
+0x2f750804,
+0x2f760804,
+0x2f770804,
+0x2f780804,
+0x2f790804,
+0x2f790808,
+0x4608,
+0x2f7a0804,
+0x2f7a0808,
+0x4608,
+0x2f7b0804,
+0x2f7c0804,
+0x2f7d0804,
+0x2f7e0804,
+0x2f7f0804,
+0x2f800804,
+0x2f810804,
+0x2f820804,
+0x2f830804,
+0x2f840804,
+0x2f850804,
+0x2f860804,
+0x2f870804,
+0x2f880804,
+0x2f890804,
+0x2f8a0804,
+0x2f8b0804,
+0x2f8c0804,
+0x2f8d0804,
+0x2f8e0804,
+0x2f8f0804,
+0x2f900804,
+0x2f910804,
+0x2f920804,
+0x2f930804,
+0x2f940804,
+0x2f950804,
+0x2f960804,
+0x2f970804,
+0x2f980804,
+0x2f990804,
+0x2f9a0804,
+0x2f9b0804,
+0x2f9c0804,
+0x2f9d0804,
+0x2f9e0804,
+0x2f9f0804,
+0x2fa00804,
+0x2fa10804,
+0x2fa20804,
+0x2fa30804,
+0x2fa40804,
+0x2fa50804,
+0x2fa60804,
+0x2fa70804,
+0x2fa80804,
+0x2fa90804,
+0x2faa0804,
+0x2fab0804,
+0x2fac0804,
+0x2fad0804,
+0x2fae0804,
+0x2faf0804,
+0x2fb00804,
+0x2fb10804,
+0x2fb20804,
+0x2fb30804,
+0x2fb40804,
+0x2fb50804,
+0x2fb60804,
+0x2fb70804,
+0x2fb80804,
+0x2fb90804,
+0x2fba0804,
+0x2fbb0804,
+0x2fbc0804,
+0x2fbd0804,
+0x2fbe0804,
+0x2fbf0804,
+0x2fc00804,
+0x2fc10804,
+0x2fc20804,
+0x2fc30804,
+0x2fc40804,
+0x2fc50804,
+0x2fc60804,
+0x2fc70804,
+0x2fc80804,
+0x2fc90804,
+0x2fca0804,
+0x2fcb0804,
+0x2fcc0804,
+0x2fcd0804,
+0x2fce0804,
+0x2fcf0804,
+0x2fd10804,
+0x2fd20804,
+0x2fd30804,
+0x2fd40804,
+0x2fd50804,
+0x2fd60804,
+0x2fd70804,
+0x2fd80804,
+0x2fd90804,
+0x2fda0804,
+0x2fdb0804,
+0x2fdc0804,
+0x2fdd0804,
+0x2fde0804,
+0x2fdf0804,
+0x2fe00804,
+0x2fe10804,
+0x2fe20804,
+0x2fe30804,
+0x2fe40804,
+0x2fe50804,
+0x2fe60804,
+0x2fe70804,
+0x2fe80804,
+0x2fe90804,
+0x2fea0804,
+0x2feb0804,
+0x2fec0804,
+0x2fed0804,
+0x2fee0804,
+0x2fef0804,
+0x2ff00804,
+0x2ff10804,
+0x2ff20804,
+0x2ff30804,
+0x2ff40804,
+0x2ff50804,
+0x2ff60804,
+0x30a50804,
+0x30a60804,
+0x30a70804,
+0x30a80804,
+0x30a90804,
+0x30a90808,
+0x4608,
+0x30aa0804,
+0x30ab0804,
+0x30ac0804,
+0x30ad0804,
+0x30ae0804,
+0x30af0804,
+0x30b00804,
+0x30b10804,
+0x30b20804,
+0x30b30804,
+0x30b40804,
+0x30b50804,
+0x30b60804,
+0x30b70804,
+0x30b80804,
+0x30b90804,
+0x30b90808,
+0x4608,
+0x30ba0804,
+0x30bb0804,
+0x30bc0804,
+0x30bd0804,
+0x30be0804,
+0x30bf0804,
+0x30c00804,
+0x30c10804,
+0x30c20804,
+0x30c30804,
+0x30c40804,
+0x30c50804,
+0x30c60804,
+0x30c70804,
+0x30c80804,
+0x30c90804,
+0x30ca0804,
+0x30cb0804,
+0x313a0804,
+0x313a0808,
+0x313b0804,
+0x313c0804,
+0x313d0804,
+0x313e0804,
+0x313f0804,
+0x31400804,
+0x31410804,
+0x31410832,
+0x31420804,
+0x31430804,
+0x31440804,
+0x31450804,
+0x31460804,
+0x31470804,
+0x31480804,
+0x31490804,
+0x314a0804,
+0x314b0804,
+0x314c0804,
+0x314d0804,
+0x314e0804,
+0x314f0804,
+0x31500804,
+0x31510804,
+0x31520804,
+0x31520832,
+0x31530804,
+0x31540804,
+0x31550804,
+0x31560804,
+0x31570804,
+0x31580804,
+0x31590804,
+0x315a0804,
+0x315b0804,
+0x315c0804,
+0x315d0804,
+0x315e0804,
+0x315f0804,
+0x31600804,
+0x31610804,
+0x31620804,
+0x31630804,
+0x31640804,
+0x31650804,
+0x31660804,
+0x31670804,
+0x31680804,
+0x31690804,
+0x316a0804,
+0x316b0804,
+0x316c0804,
+0x316d0804,
+0x316e0804,
+0x316f0804,
+0x31700804,
+0x31710804,
+0x31720804,
+0x31730804,
+0x31740804,
+0x31750804,
+0x31760804,
+0x31770804,
+0x31780804,
+0x31790804,
+0x317a0804,
+0x317b0804,
+0x317c0804,
+0x317d0804,
+0x317e0804,
+0x317f0804,
+0x31800804,
+0x31810804,
+0x31820804,
+0x31830804,
+0x31840804,
+0x31850804,
+0x31860804,
+0x31870804,
+0x31880804,
+0x31890804,
+0x318a0804,
+0x318b0804,
+0x318c0804,
+0x318d0804,
+0x318e0804,
+0x318f0804,
+0x31900804,
+0x31910804,
+0x31920804,
+0x31930804,
+0x31940804,
+0x31950804,
+0x31960804,
+0x31970804,
+0x31980804,
+0x31990804,
+0x319a0804,
+0x319b0804,
+0x319c0804,
+0x319d0804,
+0x319e0804,
+0x319f0804,
+0x31a00804,
+0x31a10804,
+0x31a20804,
+0x31a30804,
+0x31a40804,
+0x31a50804,
+0x31a60804,
+0x31a70804,
+0x31a80804,
+0x31a90804,
+0x31aa0804,
+0x31ab0804,
+0x31ac0804,
+0x31ad0804,
+0x31ae0804,
+0x31af0804,
+0x31b00804,
+0x31b10804,
+0x31b20804,
+0x31b30804,
+0x31b40804,
+0x31b50804,
+0x31b60804,
+0x31b70804,
+0x31b80804,
+0x31b90804,
+0x31ba0804,
+0x31bb0804,
+0x31bc0804,
+0x31bd0804,
+0x31be0804,
+0x31bf0804,
+0x31c10804,
+0x31c20804,
+0x31c30804,
+0x31c40804,
+0x31c50804,
+0x31c60804,
+0x31c70804,
+0x31c80804,
+0x31c90804,
+0x31ca0804,
+0x31cb0804,
+0x31cc0804,
+0x31cd0804,
+0x31ce0804,
+0x31cf0804,
+0x31d00804,
+0x31d10804,
+0x31d20804,
+0x31d30804,
+0x31d50804,
+0x31d60804,
+0x31d70804,
+0x31d80804,
+0x31d90804,
+0x31da0804,
+0x32170804,
+0x32170804,
+0x32510804,
+0x32170804,
+0x32520804,
+0x32170804,
+0x32530804,
+0x32170804,
+0x32540804,
+0x32170804,
+0x32550804,
+0x32180804,
+0x32180804,
+0x32510804,
+0x32180804,
+0x32520804,
+0x32180804,
+0x32530804,
+0x32180804,
+0x32540804,
+0x32180804,
+0x32550804,
+0x32190804,
+0x32190804,
+0x32510804,
+0x32190804,
+0x32520804,
+0x32190804,
+0x32530804,
+0x32190804,
+0x32540804,
+0x32190804,
+0x32550804,
+0x321a0804,
+0x321a0804,
+0x32510804,
+0x321a0804,
+0x32520804,
+0x321a0804,
+0x32530804,
+0x321a0804,
+0x32540804,
+0x321a0804,
+0x32550804,
+0x321b0804,
+0x321b0804,
+0x32510804,
+0x321b0804,
+0x32520804,
+0x321b0804,
+0x32530804,
+0x321b0804,
+0x32540804,
+0x321b0804,
+0x32550804,
+0x321c0804,
+0x321c0804,
+0x32510804,
+0x321c0804,
+0x32520804,
+0x321c0804,
+0x32530804,
+0x321c0804,
+0x32540804,
+0x321c0804,
+0x32550804,
+0x321d0804,
+0x321d0804,
+0x32510804,
+0x321d0804,
+0x32520804,
+0x321d0804,
+0x32530804,
+0x321d0804,
+0x32540804,
+0x321d0804,
+0x32550804,
+0x321e0804,
+0x321e0804,
+0x32510804,
+0x321e0804,
+0x32520804,
+0x321e0804,
+0x32530804,
+0x321e0804,
+0x32540804,
+0x321e0804,
+0x32550804,
+0x321f0804,
+0x321f0804,
+0x32510804,
+0x321f0804,
+0x32520804,
+0x321f0804,
+0x32530804,
+0x321f0804,
+0x32540804,
+0x321f0804,
+0x32550804,
+0x32200804,
+0x32200804,
+0x32510804,
+0x32200804,
+0x32520804,
+0x32200804,
+0x32530804,
+0x32200804,
+0x32540804,
+0x32200804,
+0x32550804,
+0x32210804,
+0x32210804,
+0x32510804,
+0x32210804,
+0x32520804,
+0x32210804,
+0x32530804,
+0x32210804,
+0x32540804,
+0x32210804,
+0x32550804,
+0x32220804,
+0x32220804,
+0x32510804,
+0x32220804,
+0x32520804,
+0x32220804,
+0x32530804,
+0x32220804,
+0x32540804,
+0x32220804,
+0x32550804,
+0x32230804,
+0x32230804,
+0x32510804,
+0x32230804,
+0x32520804,
+0x32230804,
+0x32530804,
+0x32230804,
+0x32540804,
+0x32230804,
+0x32550804,
+0x32240804,
+0x32240804,
+0x32510804,
+0x32240804,
+0x32520804,
+0x32240804,
+0x32530804,
+0x32240804,
+0x32540804,
+0x32240804,
+0x32550804,
+0x32250804,
+0x32250804,
+0x32510804,
+0x32250804,
+0x32520804,
+0x32250804,
+0x32530804,
+0x32250804,
+0x32540804,
+0x32250804,
+0x32550804,
+0x32260804,
+0x32260804,
+0x32510804,
+0x32260804,
+0x32520804,
+0x32260804,
+0x32530804,
+0x32260804,
+0x32540804,
+0x32260804,
+0x32550804,
+0x32270804,
+0x32270804,
+0x32510804,
+0x32270804,
+0x32520804,
+0x32270804,
+0x32530804,
+0x32270804,
+0x32540804,
+0x32270804,
+0x32550804,
+0x32280804,
+0x32280804,
+0x32510804,
+0x32280804,
+0x32520804,
+0x32280804,
+0x32530804,
+0x32280804,
+0x32540804,
+0x32280804,
+0x32550804,
+0x32290804,
+0x32290804,
+0x32510804,
+0x32290804,
+0x32520804,
+0x32290804,
+0x32530804,
+0x32290804,
+0x32540804,
+0x32290804,
+0x32550804,
+0x322a0804,
+0x322a0804,
+0x32510804,
+0x322a0804,
+0x32520804,
+0x322a0804,
+0x32530804,
+0x322a0804,
+0x32540804,
+0x322a0804,
+0x32550804,
+0x322b0804,
+0x322b0804,
+0x32510804,
+0x322b0804,
+0x32520804,
+0x322b0804,
+0x32530804,
+0x322b0804,
+0x32540804,
+0x322b0804,
+0x32550804,
+0x322c0804,
+0x322c0804,
+0x32510804,
+0x322c0804,
+0x32520804,
+0x322c0804,
+0x32530804,
+0x322c0804,
+0x32540804,
+0x322c0804,
+0x32550804,
+0x322d0804,
+0x322d0804,
+0x32510804,
+0x322d0804,
+0x32520804,
+0x322d0804,
+0x32530804,
+0x322d0804,
+0x32540804,
+0x322d0804,
+0x32550804,
+0x322e0804,
+0x322e0804,
+0x32510804,
+0x322e0804,
+0x32520804,
+0x322e0804,
+0x32530804,
+0x322e0804,
+0x32540804,
+0x322e0804,
+0x32550804,
+0x322f0804,
+0x322f0804,
+0x32510804,
+0x322f0804,
+0x32520804,
+0x322f0804,
+0x32530804,
+0x322f0804,
+0x32540804,
+0x322f0804,
+0x32550804,
+0x32300804,
+0x32300804,
+0x32510804,
+0x32300804,
+0x32520804,
+0x32300804,
+0x32530804,
+0x32300804,
+0x32540804,
+0x32300804,
+0x32550804,
+0x32310804,
+0x32310804,
+0x32510804,
+0x32310804,
+0x32520804,
+0x32310804,
+0x32530804,
+0x32310804,
+0x32540804,
+0x32310804,
+0x32550804,
+0x32320804,
+0x32320804,
+0x32510804,
+0x32320804,
+0x32520804,
+0x32320804,
+0x32530804,
+0x32320804,
+0x32540804,
+0x32320804,
+0x32550804,
+0x32330804,
+0x32330804,
+0x32510804,
+0x32330804,
+0x32520804,
+0x32330804,
+0x32530804,
+0x32330804,
+0x32540804,
+0x32330804,
+0x32550804,
+0x32340804,
+0x32340804,
+0x32510804,
+0x32340804,
+0x32520804,
+0x32340804,
+0x32530804,
+0x32340804,
+0x32540804,
+0x32340804,
+0x32550804,
+0x32350804,
+0x32350804,
+0x32510804,
+0x32350804,
+0x32520804,
+0x32350804,
+0x32530804,
+0x32350804,
+0x32540804,
+0x32350804,
+0x32550804,
+0x32360804,
+0x32360804,
+0x32510804,
+0x32360804,
+0x32520804,
+0x32360804,
+0x32530804,
+0x32360804,
+0x32540804,
+0x32360804,
+0x32550804,
+0x32370804,
+0x32370804,
+0x32510804,
+0x32370804,
+0x32520804,
+0x32370804,
+0x32530804,
+0x32370804,
+0x32540804,
+0x32370804,
+0x32550804,
+0x32380804,
+0x32380804,
+0x32510804,
+0x32380804,
+0x32520804,
+0x32380804,
+0x32530804,
+0x32380804,
+0x32540804,
+0x32380804,
+0x32550804,
+0x32390804,
+0x32390804,
+0x32510804,
+0x32390804,
+0x32520804,
+0x32390804,
+0x32530804,
+0x32390804,
+0x32540804,
+0x32390804,
+0x32550804,
+0x323a0804,
+0x323a0804,
+0x32510804,
+0x323a0804,
+0x32520804,
+0x323a0804,
+0x32530804,
+0x323a0804,
+0x32540804,
+0x323a0804,
+0x32550804,
+0x323b0804,
+0x323b0804,
+0x32510804,
+0x323b0804,
+0x32520804,
+0x323b0804,
+0x32530804,
+0x323b0804,
+0x32540804,
+0x323b0804,
+0x32550804,
+0x323c0804,
+0x323c0804,
+0x32510804,
+0x323c0804,
+0x32520804,
+0x323c0804,
+0x32530804,
+0x323c0804,
+0x32540804,
+0x323c0804,
+0x32550804,
+0x323d0804,
+0x323d0804,
+0x32510804,
+0x323d0804,
+0x32520804,
+0x323d0804,
+0x32530804,
+0x323d0804,
+0x32540804,
+0x323d0804,
+0x32550804,
+0x323e0804,
+0x323e0804,
+0x32510804,
+0x323e0804,
+0x32520804,
+0x323e0804,
+0x32530804,
+0x323e0804,
+0x32540804,
+0x323e0804,
+0x32550804,
+0x323f0804,
+0x323f0804,
+0x32510804,
+0x323f0804,
+0x32520804,
+0x323f0804,
+0x32530804,
+0x323f0804,
+0x32540804,
+0x323f0804,
+0x32550804,
+0x32400804,
+0x32400804,
+0x32510804,
+0x32400804,
+0x32520804,
+0x32400804,
+0x32530804,
+0x32400804,
+0x32540804,
+0x32400804,
+0x32550804,
+0x32410804,
+0x32410804,
+0x32510804,
+0x32410804,
+0x32520804,
+0x32410804,
+0x32530804,
+0x32410804,
+0x32540804,
+0x32410804,
+0x32550804,
+0x32420804,
+0x32420804,
+0x32510804,
+0x32420804,
+0x32520804,
+0x32420804,
+0x32530804,
+0x32420804,
+0x32540804,
+0x32420804,
+0x32550804,
+0x32430804,
+0x32430804,
+0x32510804,
+0x32430804,
+0x32520804,
+0x32430804,
+0x32530804,
+0x32430804,
+0x32540804,
+0x32430804,
+0x32550804,
+0x32440804,
+0x32440804,
+0x32510804,
+0x32440804,
+0x32520804,
+0x32440804,
+0x32530804,
+0x32440804,
+0x32540804,
+0x32440804,
+0x32550804,
+0x32450804,
+0x32460804,
+0x32470804,
+0x32480804,
+0x32490804,
+0x324a0804,
+0x324b0804,
+0x324c0804,
+0x324d0804,
+0x324e0804,
+0x324f0804,
+0x32500804,
+0x32510804,
+0x32520804,
+0x32530804,
+0x32540804,
+0x32550804,
+0x32560804,
+0x32570804,
+0x32570804,
+0x32910804,
+0x32570804,
+0x32920804,
+0x32570804,
+0x32930804,
+0x32570804,
+0x32940804,
+0x32570804,
+0x32950804,
+0x32580804,
+0x32580804,
+0x32910804,
+0x32580804,
+0x32920804,
+0x32580804,
+0x32930804,
+0x32580804,
+0x32940804,
+0x32580804,
+0x32950804,
+0x32590804,
+0x32590804,
+0x32910804,
+0x32590804,
+0x32920804,
+0x32590804,
+0x32930804,
+0x32590804,
+0x32940804,
+0x32590804,
+0x32950804,
+0x325a0804,
+0x325a0804,
+0x32910804,
+0x325a0804,
+0x32920804,
+0x325a0804,
+0x32930804,
+0x325a0804,
+0x32940804,
+0x325a0804,
+0x32950804,
+0x325c0804,
+0x325c0804,
+0x32910804,
+0x325c0804,
+0x32920804,
+0x325c0804,
+0x32930804,
+0x325c0804,
+0x32940804,
+0x325c0804,
+0x32950804,
+0x325d0804,
+0x325d0804,
+0x32910804,
+0x325d0804,
+0x32920804,
+0x325d0804,
+0x32930804,
+0x325d0804,
+0x32940804,
+0x325d0804,
+0x32950804,
+0x325f0804,
+0x325f0804,
+0x32910804,
+0x325f0804,
+0x32920804,
+0x325f0804,
+0x32930804,
+0x325f0804,
+0x32940804,
+0x325f0804,
+0x32950804,
+0x32600804,
+0x32600804,
+0x32910804,
+0x32600804,
+0x32920804,
+0x32600804,
+0x32930804,
+0x32600804,
+0x32940804,
+0x32600804,
+0x32950804,
+0x32630804,
+0x32630804,
+0x32910804,
+0x32630804,
+0x32920804,
+0x32630804,
+0x32930804,
+0x32630804,
+0x32940804,
+0x32630804,
+0x32950804,
+0x32640804,
+0x32640804,
+0x32910804,
+0x32640804,
+0x32920804,
+0x32640804,
+0x32930804,
+0x32640804,
+0x32940804,
+0x32640804,
+0x32950804,
+0x326a0804,
+0x326a0804,
+0x32910804,
+0x326a0804,
+0x32920804,
+0x326a0804,
+0x32930804,
+0x326a0804,
+0x32940804,
+0x326a0804,
+0x32950804,
+0x326b0804,
+0x326b0804,
+0x32910804,
+0x326b0804,
+0x32920804,
+0x326b0804,
+0x32930804,
+0x326b0804,
+0x32940804,
+0x326b0804,
+0x32950804,
+0x326c0804,
+0x326c0804,
+0x32910804,
+0x326c0804,
+0x32920804,
+0x326c0804,
+0x32930804,
+0x326c0804,
+0x32940804,
+0x326c0804,
+0x32950804,
+0x326d0804,
+0x326d0804,
+0x32910804,
+0x326d0804,
+0x32920804,
+0x326d0804,
+0x32930804,
+0x326d0804,
+0x32940804,
+0x326d0804,
+0x32950804,
+0x326f0804,
+0x326f0804,
+0x32910804,
+0x326f0804,
+0x32920804,
+0x326f0804,
+0x32930804,
+0x326f0804,
+0x32940804,
+0x326f0804,
+0x32950804,
+0x32700804,
+0x32700804,
+0x32910804,
+0x32700804,
+0x32920804,
+0x32700804,
+0x32930804,
+0x32700804,
+0x32940804,
+0x32700804,
+0x32950804,
+0x32710804,
+0x32710804,
+0x32910804,
+0x32710804,
+0x32920804,
+0x32710804,
+0x32930804,
+0x32710804,
+0x32940804,
+0x32710804,
+0x32950804,
+0x32720804,
+0x32720804,
+0x32910804,
+0x32720804,
+0x32920804,
+0x32720804,
+0x32930804,
+0x32720804,
+0x32940804,
+0x32720804,
+0x32950804,
+0x32730804,
+0x32730804,
+0x32910804,
+0x32730804,
+0x32920804,
+0x32730804,
+0x32930804,
+0x32730804,
+0x32940804,
+0x32730804,
+0x32950804,
+0x32740804,
+0x32740804,
+0x32910804,
+0x32740804,
+0x32920804,
+0x32740804,
+0x32930804,
+0x32740804,
+0x32940804,
+0x32740804,
+0x32950804,
+0x32750804,
+0x32750804,
+0x32910804,
+0x32750804,
+0x32920804,
+0x32750804,
+0x32930804,
+0x32750804,
+0x32940804,
+0x32750804,
+0x32950804,
+0x32770804,
+0x32770804,
+0x32910804,
+0x32770804,
+0x32920804,
+0x32770804,
+0x32930804,
+0x32770804,
+0x32940804,
+0x32770804,
+0x32950804,
+0x32780804,
+0x32780804,
+0x32910804,
+0x32780804,
+0x32920804,
+0x32780804,
+0x32930804,
+0x32780804,
+0x32940804,
+0x32780804,
+0x32950804,
+0x32790804,
+0x32790804,
+0x32910804,
+0x32790804,
+0x32920804,
+0x32790804,
+0x32930804,
+0x32790804,
+0x32940804,
+0x32790804,
+0x32950804,
+0x327a0804,
+0x327a0804,
+0x32910804,
+0x327a0804,
+0x32920804,
+0x327a0804,
+0x32930804,
+0x327a0804,
+0x32940804,
+0x327a0804,
+0x32950804,
+0x327b0804,
+0x327b0804,
+0x32910804,
+0x327b0804,
+0x32920804,
+0x327b0804,
+0x32930804,
+0x327b0804,
+0x32940804,
+0x327b0804,
+0x32950804,
+0x327e0804,
+0x327e0808,
+0x326f0808,
+0x327e0808,
+0x326f0808,
+0x32910804,
+0x327e0808,
+0x326f0808,
+0x32920804,
+0x327e0808,
+0x326f0808,
+0x32930804,
+0x327e0808,
+0x326f0808,
+0x32940804,
+0x327e0808,
+0x326f0808,
+0x32950804,
+0x327e0808,
+0x32770808,
+0x327e0808,
+0x32770808,
+0x32910804,
+0x327e0808,
+0x32770808,
+0x32920804,
+0x327e0808,
+0x32770808,
+0x32930804,
+0x327e0808,
+0x32770808,
+0x32940804,
+0x327e0808,
+0x32770808,
+0x32950804,
+0x327e0804,
+0x32910804,
+0x327e0804,
+0x32920804,
+0x327e0804,
+0x32930804,
+0x327e0804,
+0x32940804,
+0x327e0804,
+0x32950804,
+0x32800804,
+0x32800804,
+0x32910804,
+0x32800804,
+0x32920804,
+0x32800804,
+0x32930804,
+0x32800804,
+0x32940804,
+0x32800804,
+0x32950804,
+0x32810804,
+0x32810804,
+0x32910804,
+0x32810804,
+0x32920804,
+0x32810804,
+0x32930804,
+0x32810804,
+0x32940804,
+0x32810804,
+0x32950804,
+0x32820804,
+0x32830804,
+0x32840804,
+0x32850804,
+0x32860804,
+0x32870804,
+0x32880804,
+0x32890804,
+0x328a0804,
+0x328b0804,
+0x328c0804,
+0x328e0804,
+0x328f0804,
+0x32900804,
+0x32910804,
+0x32920804,
+0x32930804,
+0x32940804,
+0x32950804,
+0x32960804,
+0x32960804,
+0x32cb0804,
+0x32960804,
+0x32cc0804,
+0x32960804,
+0x32cf0804,
+0x32960804,
+0x32d10804,
+0x32960804,
+0x32d20804,
+0x32970804,
+0x32970804,
+0x32cb0804,
+0x32970804,
+0x32cc0804,
+0x32970804,
+0x32cf0804,
+0x32970804,
+0x32d10804,
+0x32970804,
+0x32d20804,
+0x32980804,
+0x32980804,
+0x32cb0804,
+0x32980804,
+0x32cc0804,
+0x32980804,
+0x32cf0804,
+0x32980804,
+0x32d10804,
+0x32980804,
+0x32d20804,
+0x32990804,
+0x32990804,
+0x32cb0804,
+0x32990804,
+0x32cc0804,
+0x32990804,
+0x32cf0804,
+0x32990804,
+0x32d10804,
+0x32990804,
+0x32d20804,
+0x329a0804,
+0x329a0804,
+0x32cb0804,
+0x329a0804,
+0x32cc0804,
+0x329a0804,
+0x32cf0804,
+0x329a0804,
+0x32d10804,
+0x329a0804,
+0x32d20804,
+0x329b0804,
+0x329b0804,
+0x32cb0804,
+0x329b0804,
+0x32cc0804,
+0x329b0804,
+0x32cf0804,
+0x329b0804,
+0x32d10804,
+0x329b0804,
+0x32d20804,
+0x329c0804,
+0x329c0804,
+0x32cb0804,
+0x329c0804,
+0x32cc0804,
+0x329c0804,
+0x32cf0804,
+0x329c0804,
+0x32d10804,
+0x329c0804,
+0x32d20804,
+0x329d0804,
+0x329d0804,
+0x32cb0804,
+0x329d0804,
+0x32cc0804,
+0x329d0804,
+0x32cf0804,
+0x329d0804,
+0x32d10804,
+0x329d0804,
+0x32d20804,
+0x329e0804,
+0x329e0804,
+0x32cb0804,
+0x329e0804,
+0x32cc0804,
+0x329e0804,
+0x32cf0804,
+0x329e0804,
+0x32d10804,
+0x329e0804,
+0x32d20804,
+0x329f0804,
+0x329f0804,
+0x32cb0804,
+0x329f0804,
+0x32cc0804,
+0x329f0804,
+0x32cf0804,
+0x329f0804,
+0x32d10804,
+0x329f0804,
+0x32d20804,
+0x32a00804,
+0x32a00804,
+0x32cb0804,
+0x32a00804,
+0x32cc0804,
+0x32a00804,
+0x32cf0804,
+0x32a00804,
+0x32d10804,
+0x32a00804,
+0x32d20804,
+0x32a10804,
+0x32a10804,
+0x32cb0804,
+0x32a10804,
+0x32cc0804,
+0x32a10804,
+0x32cf0804,
+0x32a10804,
+0x32d10804,
+0x32a10804,
+0x32d20804,
+0x32a20804,
+0x32a20804,
+0x32cb0804,
+0x32a20804,
+0x32cc0804,
+0x32a20804,
+0x32cf0804,
+0x32a20804,
+0x32d10804,
+0x32a20804,
+0x32d20804,
+0x32a30804,
+0x32a30804,
+0x32cb0804,
+0x32a30804,
+0x32cc0804,
+0x32a30804,
+0x32cf0804,
+0x32a30804,
+0x32d10804,
+0x32a30804,
+0x32d20804,
+0x32a40804,
+0x32a40804,
+0x32cb0804,
+0x32a40804,
+0x32cc0804,
+0x32a40804,
+0x32cf0804,
+0x32a40804,
+0x32d10804,
+0x32a40804,
+0x32d20804,
+0x32a50804,
+0x32a50804,
+0x32cb0804,
+0x32a50804,
+0x32cc0804,
+0x32a50804,
+0x32cf0804,
+0x32a50804,
+0x32d10804,
+0x32a50804,
+0x32d20804,
+0x32a60804,
+0x32a60804,
+0x32cb0804,
+0x32a60804,
+0x32cc0804,
+0x32a60804,
+0x32cf0804,
+0x32a60804,
+0x32d10804,
+0x32a60804,
+0x32d20804,
+0x32a70804,
+0x32a70804,
+0x32cb0804,
+0x32a70804,
+0x32cc0804,
+0x32a70804,
+0x32cf0804,
+0x32a70804,
+0x32d10804,
+0x32a70804,
+0x32d20804,
+0x32a80804,
+0x32a80804,
+0x32cb0804,
+0x32a80804,
+0x32cc0804,
+0x32a80804,
+0x32cf0804,
+0x32a80804,
+0x32d10804,
+0x32a80804,
+0x32d20804,
+0x32a90804,
+0x32a90804,
+0x32cb0804,
+0x32a90804,
+0x32cc0804,
+0x32a90804,
+0x32cf0804,
+0x32a90804,
+0x32d10804,
+0x32a90804,
+0x32d20804,
+0x32aa0804,
+0x32aa0804,
+0x32cb0804,
+0x32aa0804,
+0x32cc0804,
+0x32aa0804,
+0x32cf0804,
+0x32aa0804,
+0x32d10804,
+0x32aa0804,
+0x32d20804,
+0x32ab0804,
+0x32ab0804,
+0x32cb0804,
+0x32ab0804,
+0x32cc0804,
+0x32ab0804,
+0x32cf0804,
+0x32ab0804,
+0x32d10804,
+0x32ab0804,
+0x32d20804,
+0x32ac0804,
+0x32ac0804,
+0x32cb0804,
+0x32ac0804,
+0x32cc0804,
+0x32ac0804,
+0x32cf0804,
+0x32ac0804,
+0x32d10804,
+0x32ac0804,
+0x32d20804,
+0x32ad0804,
+0x32ad0804,
+0x32cb0804,
+0x32ad0804,
+0x32cc0804,
+0x32ad0804,
+0x32cf0804,
+0x32ad0804,
+0x32d10804,
+0x32ad0804,
+0x32d20804,
+0x32ae0804,
+0x32ae0804,
+0x32cb0804,
+0x32ae0804,
+0x32cc0804,
+0x32ae0804,
+0x32cf0804,
+0x32ae0804,
+0x32d10804,
+0x32ae0804,
+0x32d20804,
+0x32af0804,
+0x32af0804,
+0x32cb0804,
+0x32af0804,
+0x32cc0804,
+0x32af0804,
+0x32cf0804,
+0x32af0804,
+0x32d10804,
+0x32af0804,
+0x32d20804,
+0x32b00804,
+0x32b00804,
+0x32cb0804,
+0x32b00804,
+0x32cc0804,
+0x32b00804,
+0x32cf0804,
+0x32b00804,
+0x32d10804,
+0x32b00804,
+0x32d20804,
+0x32b10804,
+0x32b10804,
+0x32cb0804,
+0x32b10804,
+0x32cc0804,
+0x32b10804,
+0x32cf0804,
+0x32b10804,
+0x32d10804,
+0x32b10804,
+0x32d20804,
+0x32b20804,
+0x32b20804,
+0x32cb0804,
+0x32b20804,
+0x32cc0804,
+0x32b20804,
+0x32cf0804,
+0x32b20804,
+0x32d10804,
+0x32b20804,
+0x32d20804,
+0x32b30804,
+0x32b30804,
+0x32cb0804,
+0x32b30804,
+0x32cc0804,
+0x32b30804,
+0x32cf0804,
+0x32b30804,
+0x32d10804,
+0x32b30804,
+0x32d20804,
+0x32b40804,
+0x32b40804,
+0x32cb0804,
+0x32b40804,
+0x32cc0804,
+0x32b40804,
+0x32cf0804,
+0x32b40804,
+0x32d10804,
+0x32b40804,
+0x32d20804,
+0x32b50804,
+0x32b50804,
+0x32cb0804,
+0x32b50804,
+0x32cc0804,
+0x32b50804,
+0x32cf0804,
+0x32b50804,
+0x32d10804,
+0x32b50804,
+0x32d20804,
+0x32b60804,
+0x32b60804,
+0x32cb0804,
+0x32b60804,
+0x32cc0804,
+0x32b60804,
+0x32cf0804,
+0x32b60804,
+0x32d10804,
+0x32b60804,
+0x32d20804,
+0x32b70804,
+0x32b70804,
+0x32cb0804,
+0x32b70804,
+0x32cc0804,
+0x32b70804,
+0x32cf0804,
+0x32b70804,
+0x32d10804,
+0x32b70804,
+0x32d20804,
+0x32b80804,
+0x32b80804,
+0x32cb0804,
+0x32b80804,
+0x32cc0804,
+0x32b80804,
+0x32cf0804,
+0x32b80804,
+0x32d10804,
+0x32b80804,
+0x32d20804,
+0x32b90804,
+0x32b90804,
+0x32cb0804,
+0x32b90804,
+0x32cc0804,
+0x32b90804,
+0x32cf0804,
+0x32b90804,
+0x32d10804,
+0x32b90804,
+0x32d20804,
+0x32ba0804,
+0x32ba0804,
+0x32cb0804,
+0x32ba0804,
+0x32cc0804,
+0x32ba0804,
+0x32cf0804,
+0x32ba0804,
+0x32d10804,
+0x32ba0804,
+0x32d20804,
+0x32bb0804,
+0x32bb0804,
+0x32cb0804,
+0x32bb0804,
+0x32cc0804,
+0x32bb0804,
+0x32cf0804,
+0x32bb0804,
+0x32d10804,
+0x32bb0804,
+0x32d20804,
+0x32bc0804,
+0x32bc0804,
+0x32cb0804,
+0x32bc0804,
+0x32cc0804,
+0x32bc0804,
+0x32cf0804,
+0x32bc0804,
+0x32d10804,
+0x32bc0804,
+0x32d20804,
+0x32bd0804,
+0x32bd0804,
+0x32cb0804,
+0x32bd0804,
+0x32cc0804,
+0x32bd0804,
+0x32cf0804,
+0x32bd0804,
+0x32d10804,
+0x32bd0804,
+0x32d20804,
+0x32be0804,
+0x32be0804,
+0x32cb0804,
+0x32be0804,
+0x32cc0804,
+0x32be0804,
+0x32cf0804,
+0x32be0804,
+0x32d10804,
+0x32be0804,
+0x32d20804,
+0x32bf0804,
+0x32bf0804,
+0x32cb0804,
+0x32bf0804,
+0x32cc0804,
+0x32bf0804,
+0x32cf0804,
+0x32bf0804,
+0x32d10804,
+0x32bf0804,
+0x32d20804,
+0x32c00804,
+0x32c00804,
+0x32cb0804,
+0x32c00804,
+0x32cc0804,
+0x32c00804,
+0x32cf0804,
+0x32c00804,
+0x32d10804,
+0x32c00804,
+0x32d20804,
+0x32c10804,
+0x32c10804,
+0x32cb0804,
+0x32c10804,
+0x32cc0804,
+0x32c10804,
+0x32cf0804,
+0x32c10804,
+0x32d10804,
+0x32c10804,
+0x32d20804,
+0x32c20804,
+0x32c20804,
+0x32cb0804,
+0x32c20804,
+0x32cc0804,
+0x32c20804,
+0x32cf0804,
+0x32c20804,
+0x32d10804,
+0x32c20804,
+0x32d20804,
+0x32c30804,
+0x32c30804,
+0x32cb0804,
+0x32c30804,
+0x32cc0804,
+0x32c30804,
+0x32cf0804,
+0x32c30804,
+0x32d10804,
+0x32c30804,
+0x32d20804,
+0x32c40804,
+0x32c40804,
+0x32cb0804,
+0x32c40804,
+0x32cc0804,
+0x32c40804,
+0x32cf0804,
+0x32c40804,
+0x32d10804,
+0x32c40804,
+0x32d20804,
+0x32c50804,
+0x32c50804,
+0x32cb0804,
+0x32c50804,
+0x32cc0804,
+0x32c50804,
+0x32cf0804,
+0x32c50804,
+0x32d10804,
+0x32c50804,
+0x32d20804,
+0x32c60804,
+0x32c70804,
+0x32c80804,
+0x32c90804,
+0x32ca0804,
+0x32cb0804,
+0x32cc0804,
+0x32cd0804,
+0x32ce0804,
+0x32cf0804,
+0x32d00804,
+0x32d10804,
+0x32d20804,
+0x32d30804,
+0x32d40804,
+0x32d50804,
+0x32d60804,
+0x32d70804,
+0x32d80804,
+0x32d90804,
+0x32d90804,
+0x331a0804,
+0x32da0804,
+0x32da0804,
+0x331a0804,
+0x32db0804,
+0x32dc0804,
+0x32dd0804,
+0x32de0804,
+0x32de0804,
+0x331e0804,
+0x32df0804,
+0x32df0804,
+0x331e0804,
+0x32e00804,
+0x32e10804,
+0x32e20804,
+0x32e30804,
+0x32e40804,
+0x32e50804,
+0x32e60804,
+0x32e70804,
+0x32e80804,
+0x32e90804,
+0x32ea0804,
+0x32eb0804,
+0x32ec0804,
+0x32ed0804,
+0x32ee0804,
+0x32ee0804,
+0x331e0804,
+0x32ef0804,
+0x32ef0804,
+0x331e0804,
+0x32f00804,
+0x32f10804,
+0x32f20804,
+0x32f30804,
+0x32f40804,
+0x32f50804,
+0x32f60804,
+0x32f60804,
+0x331e0804,
+0x32f70804,
+0x32f70804,
+0x331e0804,
+0x32f80804,
+0x32f90804,
+0x32fa0804,
+0x32fb0804,
+0x32fc0804,
+0x32fd0804,
+0x32fe0804,
+0x32fe0804,
+0x331e0804,
+0x32ff0804,
+0x32ff0804,
+0x331e0804,
+0x33000804,
+0x33010804,
+0x33020804,
+0x33030804,
+0x33040804,
+0x33050804,
+0x33060804,
+0x33060804,
+0x331e0804,
+0x33070804,
+0x33070804,
+0x331e0804,
+0x33080804,
+0x33090804,
+0x33090808,
+0x4648,
+0x330a0804,
+0x330b0804,
+0x330c0804,
+0x330d0804,
+0x330e0804,
+0x330f0804,
+0x33100804,
+0x33110804,
+0x33110808,
+0x4648,
+0x33120804,
+0x33120808,
+0x4648,
+0x33130804,
+0x33130808,
+0x4648,
+0x33140804,
+0x33150804,
+0x33160804,
+0x33170804,
+0x33180804,
+0x33190804,
+0x331a0804,
+0x331b0804,
+0x331c0804,
+0x331d0804,
+0x331e0804,
+0x331f0804,
+0x331f0808,
+0x33360808,
+0x3108,
+0x33200804,
+0x33210804,
+0x33220804,
+0x33230804,
+0x33240804,
+0x33250804,
+0x33260804,
+0x33270804,
+0x33280804,
+0x33290804,
+0x332a0804,
+0x332b0804,
+0x332c0804,
+0x332d0804,
+0x332e0804,
+0x332f0804,
+0x33300804,
+0x33310804,
+0x33320804,
+0x33330804,
+0x33340804,
+0x33350804,
+0x33360804,
+0x33370804,
+0x33380804,
+0x33e60804,
+0x33e70804,
+0x33e80804,
+0x33e90804,
+0x33ea0804,
+0x33eb0804,
+0x33ec0804,
+0x33ed0804,
+0x33ee0804,
+0x33ef0804,
+0x33f00804,
+0x33f10804,
+0x33f20804,
+0x33f30804,
+0x33f40804,
+0x33f50804,
+0x33f60804,
+0x33f70804,
+0x33f80804,
+0x33f90804,
+0x33fa0804,
+0x33fb0804,
+0x33fc0804,
+0x33fd0804,
+0x33fe0804,
+0x33ff0804,
+0x34000804,
+0x34010804,
+0x34020804,
+0x34030804,
+0x34040804,
+0x34050804,
+0x34060804,
+0x34070804,
+0x34080804,
+0x34090804,
+0x340a0804,
+0x340b0804,
+0x340c0804,
+0x340d0804,
+0x340e0804,
+0x340f0804,
+0x34100804,
+0x34110804,
+0x34120804,
+0x34130804,
+0x34140804,
+0x34150804,
+0x34160804,
+0x34170804,
+0x34180804,
+0x34190804,
+0x341a0804,
+0x341b0804,
+0x341c0804,
+0x341d0804,
+0x341e0804,
+0x341f0804,
+0x34200804,
+0x34210804,
+0x34220804,
+0x34230804,
+0x34240804,
+0x34250804,
+0x34260804,
+0x34270804,
+0x34280804,
+0x34290804,
+0x342a0804,
+0x342b0804,
+0x342c0804,
+0x342d0804,
+0x342e0804,
+0x342f0804,
+0x34300804,
+0x34310804,
+0x34320804,
+0x34330804,
+0x34340804,
+0x34350804,
+0x34360804,
+0x34370804,
+0x34380804,
+0x34390804,
+0x343a0804,
+0x343b0804,
+0x343c0804,
+0x343d0804,
+0x343e0804,
+0x343f0804,
+0x34400804,
+0x34410804,
+0x34420804,
+0x34430804,
+0x34440804,
+0x34450804,
+0x34460804,
+0x34470804,
+0x34480804,
+0x34490804,
+0x344a0804,
+0x344b0804,
+0x344c0804,
+0x344d0804,
+0x344e0804,
+0x344f0804,
+0x34500804,
+0x34510804,
+0x34520804,
+0x34530804,
+0x34540804,
+0x34550804,
+0x34560804,
+0x34570804,
+0x34580804,
+0x34590804,
+0x345a0804,
+0x345b0804,
+0x345c0804,
+0x345c0808,
+0x347a0808,
+0x345d0804,
+0x345e0804,
+0x345f0804,
+0x345f0808,
+0x347b0808,
+0x34600804,
+0x34610804,
+0x34620804,
+0x34630804,
+0x34640804,
+0x34650804,
+0x34660804,
+0x34670804,
+0x34680804,
+0x34690804,
+0x346a0804,
+0x346b0804,
+0x346c0804,
+0x346d0804,
+0x346e0804,
+0x346f0804,
+0x34700804,
+0x34710804,
+0x34720804,
+0x34730804,
+0x34740804,
+0x34750804,
+0x34760804,
+0x34770804,
+0x34780804,
+0x34790804,
+0x347a0804,
+0x347b0804,
+0x347c0804,
+0x347d0804,
+0x347e0804,
+0x347f0804,
+0x34800804,
+0x34810804,
+0x34820804,
+0x34830804,
+0x34840804,
+0x34850804,
+0x34860804,
+0x34870804,
+0x34880804,
+0x34890804,
+0x348a0804,
+0x348b0804,
+0x348c0804,
+0x348d0804,
+0x348e0804,
+0x348f0804,
+0x34900804,
+0x34910804,
+0x34920804,
+0x34930804,
+0x34940804,
+0x34950804,
+0x34960804,
+0x34970804,
+0x34980804,
+0x34990804,
+0x349a0804,
+0x349b0804,
+0x349c0804,
+0x349d0804,
+0x349e0804,
+0x349f0804,
+0x34a00804,
+0x34a10804,
+0x34a20804,
+0x34a30804,
+0x34a40804,
+0x34a50804,
+0x34a60804,
+0x34a70804,
+0x34a80804,
+0x34a90804,
+0x34aa0804,
+0x34ab0804,
+0x34ac0804,
+0x34ad0804,
+0x34ae0804,
+0x34af0804,
+0x34b00804,
+0x34b10804,
+0x34b20804,
+0x34b30804,
+0x34b40804,
+0x34b50804,
+0x34b60804,
+0x34b70804,
+0x34b80804,
+0x34b90804,
+0x34ba0804,
+0x34bb0804,
+0x34bc0804,
+0x34bd0804,
+0x34be0804,
+0x34bf0804,
+0x34c00804,
+0x34c10804,
+0x34c20804,
+0x34c30804,
+0x34c40804,
+0x34c50804,
+0x34c60804,
+0x34c70804,
+0x34c80804,
+0x34c90804,
+0x34ca0804,
+0x34cb0804,
+0x34cc0804,
+0x34cd0804,
+0x34ce0804,
+0x34cf0804,
+0x34d00804,
+0x34d10804,
+0x34d20804,
+0x34d30804,
+0x34d40804,
+0x34d50804,
+0x34d60804,
+0x34d70804,
+0x34d80804,
+0x34d90804,
+0x34da0804,
+0x34db0804,
+0x34dc0804,
+0x34dd0804,
+0x34de0804,
+0x34df0804,
+0x34e00804,
+0x34e10804,
+0x34e20804,
+0x34e30804,
+0x34e40804,
+0x34e50804,
+0x34e60804,
+0x34e70804,
+0x34e80804,
+0x34e90804,
+0x34ea0804,
+0x34eb0804,
+0x34ec0804,
+0x34ed0804,
+0x34ee0804,
+0x34ef0804,
+0x34f00804,
+0x35080804,
+0x35080808,
+0x35090804,
+0x35090808,
+0x350a0804,
+0x350a0808,
+0x350b0804,
+0x350b0808,
+0x350c0804,
+0x350c0808,
+0x350d0804,
+0x350d0808,
+0x350e0804,
+0x350e0808,
+0x350f0804,
+0x35100804,
+0x35110804,
+0x35110808,
+0x35120804,
+0x35120808,
+0x35130804,
+0x35130808,
+0x35140804,
+0x35140808,
+0x35150804,
+0x35150808,
+0x35160804,
+0x35170804,
+0x35170808,
+0x35180804,
+0x35190804,
+0x351a0804,
+0x351b0804,
+0x351c0804,
+0x351d0804,
+0x351e0804,
+0x351e0808,
+0x351f0804,
+0x35200804,
+0x35200808,
+0x35210804,
+0x35210808,
+0x35220804,
+0x35220808,
+0x35230804,
+0x35240804,
+0x35250804,
+0x35260804,
+0x35270804,
+0x35280804,
+0x35290804,
+0x352a0804,
+0x352b0804,
+0x352c0804,
+0x352d0804,
+0x352e0804,
+0x352f0804,
+0x35300804,
+0x35310804,
+0x35320804,
+0x35330804,
+0x35340804,
+0x35350804,
+0x35360804,
+0x35370804,
+0x35380804,
+0x35390804,
+0x353a0804,
+0x353b0804,
+0x353c0804,
+0x353d0804,
+0x353e0804,
+0x353f0804,
+0x35400804,
+0x35410804,
+0x35420804,
+0x35430804,
+0x35440804,
+0x35450804,
+0x35460804,
+0x35470804,
+0x35480804,
+0x35490804,
+0x354a0804,
+0x354b0804,
+0x354c0804,
+0x354d0804,
+0x354e0804,
+0x354f0804,
+0x35500804,
+0x35510804,
+0x35520804,
+0x35530804,
+0x35540804,
+0x35550804,
+0x35560804,
+0x35570804,
+0x35580804,
+0x35590804,
+0x355a0804,
+0x355b0804,
+0x355c0804,
+0x355d0804,
+0x355e0804,
+0x355f0804,
+0x35600804,
+0x35610804,
+0x35620804,
+0x35630804,
+0x35640804,
+0x35650804,
+0x35660804,
+0x35670804,
+0x35680804,
+0x35690804,
+0x356a0804,
+0x356b0804,
+0x356c0804,
+0x356d0804,
+0x356e0804,
+0x356f0804,
+0x35700804,
+0x35710804,
+0x35720804,
+0x35730804,
+0x35740804,
+0x35750804,
+0x35760804,
+0x35770804,
+0x35780804,
+0x35790804,
+0x357a0804,
+0x357b0804,
+0x357c0804,
+0x357d0804,
+0x357e0804,
+0x357f0804,
+0x35800804,
+0x35810804,
+0x35820804,
+0x35830804,
+0x35840804,
+0x35850804,
+0x35860804,
+0x35870804,
+0x35880804,
+0x35890804,
+0x358a0804,
+0x358b0804,
+0x358c0804,
+0x358d0804,
+0x358e0804,
+0x358f0804,
+0x35900804,
+0x35910804,
+0x35920804,
+0x35930804,
+0x35940804,
+0x35950804,
+0x35960804,
+0x35970804,
+0x35980804,
+0x35990804,
+0x359a0804,
+0x359b0804,
+0x359c0804,
+0x359d0804,
+0x359e0804,
+0x359f0804,
+0x35a00804,
+0x35a10804,
+0x35a20804,
+0x35a30804,
+0x35a40804,
+0x35a50804,
+0x35a60804,
+0x35a70804,
+0x35a80804,
+0x35a90804,
+0x35aa0804,
+0x35ab0804,
+0x35ac0804,
+0x35ad0804,
+0x35ae0804,
+0x35af0804,
+0x35b00804,
+0x35b10804,
+0x35b20804,
+0x35b30804,
+0x35b40804,
+0x35b50804,
+0x35b60804,
+0x35b70804,
+0x35b80804,
+0x35b90804,
+0x35ba0804,
+0x35bb0804,
+0x35bc0804,
+0x35bd0804,
+0x35be0804,
+0x35bf0804,
+0x35c00804,
+0x35c10804,
+0x35c20804,
+0x35c30804,
+0x35c40804,
+0x35c50804,
+0x35c60804,
+0x35c70804,
+0x35c80804,
+0x35c90804,
+0x35c90808,
+0x36020808,
+0x35c90808,
+0x35ca0804,
+0x35cb0804,
+0x35cc0804,
+0x35cd0804,
+0x35ce0804,
+0x35cf0804,
+0x35d00804,
+0x35d10804,
+0x35d20804,
+0x35d30804,
+0x35d40804,
+0x35d50804,
+0x35d60804,
+0x35d70804,
+0x35d80804,
+0x35d90804,
+0x35da0804,
+0x35db0804,
+0x35dc0804,
+0x35dd0804,
+0x35de0804,
+0x35df0804,
+0x35e00804,
+0x35e10804,
+0x35e20804,
+0x35e30804,
+0x35e40804,
+0x35e50804,
+0x35e60804,
+0x35e60808,
+0x35e70804,
+0x35e80804,
+0x35e90804,
+0x35ea0804,
+0x35eb0804,
+0x35ec0804,
+0x35ed0804,
+0x35ee0804,
+0x35ef0804,
+0x35f00804,
+0x35f10804,
+0x35f20804,
+0x35f30804,
+0x35f40804,
+0x35f50804,
+0x35f60804,
+0x35f70804,
+0x35f80804,
+0x35f90804,
+0x35fa0804,
+0x35fb0804,
+0x35fc0804,
+0x35fd0804,
+0x35fe0804,
+0x35ff0804,
+0x36000804,
+0x36010804,
+0x36020804,
+0x36030804,
+0x36040804,
+0x36050804,
+0x36060804,
+0x36070804,
+0x36080804,
+0x36090804,
+0x360a0804,
+0x360b0804,
+0x360c0804,
+0x360d0804,
+0x360e0804,
+0x360f0804,
+0x36100804,
+0x36110804,
+0x36120804,
+0x36130804,
+0x36140804,
+0x36150804,
+0x36160804,
+0x36170804,
+0x36180804,
+0x36190804,
+0x361a0804,
+0x363f0804,
+0x36400804,
+0x36410804,
+0x36420804,
+0x36430804,
+0x36440804,
+0x36450804,
+0x36460804,
+0x36470804,
+0x36480804,
+0x36490804,
+0x364a0804,
+0x364b0804,
+0x364c0804,
+0x364d0804,
+0x364e0804,
+0x364f0804,
+0x36500804,
+0x36510804,
+0x36520804,
+0x36530804,
+0x36540804,
+0x36550804,
+0x36560804,
+0x36570804,
+0x36580804,
+0x36590804,
+0x365a0804,
+0x365b0804,
+0x365c0804,
+0x365d0804,
+0x365e0804,
+0x365f0804,
+0x36610804,
+0x36620804,
+0x36630804,
+0x36650804,
+0x36660804,
+0x36670804,
+0x36680804,
+0x36690804,
+0x366a0804,
+0x366b0804,
+0x366c0804,
+0x366d0804,
+0x366e0804,
+0x366f0804,
+0x36700804,
+0x36730804,
+0x36740804,
+0x36750804,
+0x36760804,
+0x36770804,
+0x36780804,
+0x36790804,
+0x367a0804,
+0x367b0804,
+0x367c0804,
+0x367d0804,
+0x367e0804,
+0x367f0804,
+0x36800804,
+0x36810804,
+0x36820804,
+0x36830804,
+0x36840804,
+0x36850804,
+0x36860804,
+0x36870804,
+0x36880804,
+0x36890804,
+0x368a0804,
+0x368b0804,
+0x368c0804,
+0x368d0804,
+0x368e0804,
+0x368f0804,
+0x36900804,
+0x36910804,
+0x36920804,
+0x36930804,
+0x36940804,
+0x36950804,
+0x36960804,
+0x36970804,
+0x36980804,
+0x36990804,
+0x369a0804,
+0x369b0804,
+0x369c0804,
+0x369d0804,
+0x369e0804,
+0x369f0804,
+0x36a00804,
+0x36a10804,
+0x36a20804,
+0x36a30804,
+0x36a40804,
+0x36a50804,
+0x36a60804,
+0x36a70804,
+0x36a80804,
+0x36a90804,
+0x36aa0804,
+0x36ab0804,
+0x36ac0804,
+0x36ad0804,
+0x36ae0804,
+0x36af0804,
+0x36b00804,
+0x36b10804,
+0x36b20804,
+0x36b30804,
+0x36b40804,
+0x36b50804,
+0x36b60804,
+0x36b70804,
+0x36b80804,
+0x36b90804,
+0x36ba0804,
+0x36bb0804,
+0x36bc0804,
+0x36bd0804,
+0x36be0804,
+0x36bf0804,
+0x36c00804,
+0x36c10804,
+0x36c20804,
+0x36c30804,
+0x36c40804,
+0x36c50804,
+0x36c60804,
+0x36c70804,
+0x36c80804,
+0x36c90804,
+0x36ca0804,
+0x36cb0804,
+0x36cc0804,
+0x36cd0804,
+0x36ce0804,
+0x36cf0804,
+0x36d00804,
+0x36d10804,
+0x36d20804,
+0x36d30804,
+0x36d40804,
+0x36d50804,
+0x36d60804,
+0x36d70804,
+0x36d80804,
+0x36d90804,
+0x36da0804,
+0x36db0804,
+0x36dc0804,
+0x36dd0804,
+0x36de0804,
+0x36de0804,
+0x370f0804,
+0x36de0804,
+0x37100804,
+0x36de0804,
+0x37110804,
+0x36de0804,
+0x37140804,
+0x36df0804,
+0x36df0804,
+0x370f0804,
+0x36df0804,
+0x37100804,
+0x36df0804,
+0x37110804,
+0x36df0804,
+0x37140804,
+0x36e00804,
+0x36e00804,
+0x370f0804,
+0x36e00804,
+0x37100804,
+0x36e00804,
+0x37110804,
+0x36e00804,
+0x37140804,
+0x36e10804,
+0x36e10804,
+0x370f0804,
+0x36e10804,
+0x37100804,
+0x36e10804,
+0x37110804,
+0x36e10804,
+0x37140804,
+0x36e20804,
+0x36e20804,
+0x370f0804,
+0x36e20804,
+0x37100804,
+0x36e20804,
+0x37110804,
+0x36e20804,
+0x37140804,
+0x36e30804,
+0x36e30804,
+0x370f0804,
+0x36e30804,
+0x37100804,
+0x36e30804,
+0x37110804,
+0x36e30804,
+0x37140804,
+0x36e40804,
+0x36e40804,
+0x370f0804,
+0x36e40804,
+0x37100804,
+0x36e40804,
+0x37110804,
+0x36e40804,
+0x37140804,
+0x36e50804,
+0x36e50804,
+0x370f0804,
+0x36e50804,
+0x37100804,
+0x36e50804,
+0x37110804,
+0x36e50804,
+0x37140804,
+0x36e60804,
+0x36e60804,
+0x370f0804,
+0x36e60804,
+0x37100804,
+0x36e60804,
+0x37110804,
+0x36e60804,
+0x37140804,
+0x36e70804,
+0x36e70804,
+0x370f0804,
+0x36e70804,
+0x37100804,
+0x36e70804,
+0x37110804,
+0x36e70804,
+0x37140804,
+0x36e80804,
+0x36e80804,
+0x370f0804,
+0x36e80804,
+0x37100804,
+0x36e80804,
+0x37110804,
+0x36e80804,
+0x37140804,
+0x36e90804,
+0x36e90804,
+0x370f0804,
+0x36e90804,
+0x37100804,
+0x36e90804,
+0x37110804,
+0x36e90804,
+0x37140804,
+0x36ea0804,
+0x36ea0804,
+0x370f0804,
+0x36ea0804,
+0x37100804,
+0x36ea0804,
+0x37110804,
+0x36ea0804,
+0x37140804,
+0x36eb0804,
+0x36eb0804,
+0x370f0804,
+0x36eb0804,
+0x37100804,
+0x36eb0804,
+0x37110804,
+0x36eb0804,
+0x37140804,
+0x36ec0804,
+0x36ec0804,
+0x370f0804,
+0x36ec0804,
+0x37100804,
+0x36ec0804,
+0x37110804,
+0x36ec0804,
+0x37140804,
+0x36ed0804,
+0x36ed0804,
+0x370f0804,
+0x36ed0804,
+0x37100804,
+0x36ed0804,
+0x37110804,
+0x36ed0804,
+0x37140804,
+0x36ee0804,
+0x36ee0804,
+0x370f0804,
+0x36ee0804,
+0x37100804,
+0x36ee0804,
+0x37110804,
+0x36ee0804,
+0x37140804,
+0x36ef0804,
+0x36ef0804,
+0x370f0804,
+0x36ef0804,
+0x37100804,
+0x36ef0804,
+0x37110804,
+0x36ef0804,
+0x37140804,
+0x36f00804,
+0x36f00804,
+0x370f0804,
+0x36f00804,
+0x37100804,
+0x36f00804,
+0x37110804,
+0x36f00804,
+0x37140804,
+0x36f10804,
+0x36f10804,
+0x370f0804,
+0x36f10804,
+0x37100804,
+0x36f10804,
+0x37110804,
+0x36f10804,
+0x37140804,
+0x36f20804,
+0x36f20804,
+0x370f0804,
+0x36f20804,
+0x37100804,
+0x36f20804,
+0x37110804,
+0x36f20804,
+0x37140804,
+0x36f30804,
+0x36f30804,
+0x370f0804,
+0x36f30804,
+0x37100804,
+0x36f30804,
+0x37110804,
+0x36f30804,
+0x37140804,
+0x36f40804,
+0x36f40804,
+0x370f0804,
+0x36f40804,
+0x37100804,
+0x36f40804,
+0x37110804,
+0x36f40804,
+0x37140804,
+0x36f50804,
+0x36f50804,
+0x370f0804,
+0x36f50804,
+0x37100804,
+0x36f50804,
+0x37110804,
+0x36f50804,
+0x37140804,
+0x36f60804,
+0x36f60804,
+0x370f0804,
+0x36f60804,
+0x37100804,
+0x36f60804,
+0x37110804,
+0x36f60804,
+0x37140804,
+0x36f70804,
+0x36f70804,
+0x370f0804,
+0x36f70804,
+0x37100804,
+0x36f70804,
+0x37110804,
+0x36f70804,
+0x37140804,
+0x36f80804,
+0x36f80804,
+0x370f0804,
+0x36f80804,
+0x37100804,
+0x36f80804,
+0x37110804,
+0x36f80804,
+0x37140804,
+0x36f90804,
+0x36f90804,
+0x370f0804,
+0x36f90804,
+0x37100804,
+0x36f90804,
+0x37110804,
+0x36f90804,
+0x37140804,
+0x36fa0804,
+0x36fa0804,
+0x370f0804,
+0x36fa0804,
+0x37100804,
+0x36fa0808,
+0x37100808,
+0x36fa0808,
+0x37100808,
+0x371b0808,
+0x36fa0804,
+0x37110804,
+0x36fa0804,
+0x37140804,
+0x36fb0804,
+0x36fb0804,
+0x370f0804,
+0x36fb0804,
+0x37100804,
+0x36fb0804,
+0x37110804,
+0x36fb0804,
+0x37140804,
+0x36fc0804,
+0x36fc0804,
+0x370f0804,
+0x36fc0804,
+0x37100804,
+0x36fc0804,
+0x37110804,
+0x36fc0804,
+0x37140804,
+0x36fd0804,
+0x36fd0804,
+0x370f0804,
+0x36fd0804,
+0x37100804,
+0x36fd0804,
+0x37110804,
+0x36fd0804,
+0x37140804,
+0x36fe0804,
+0x36fe0804,
+0x370f0804,
+0x36fe0804,
+0x37100804,
+0x36fe0804,
+0x37110804,
+0x36fe0804,
+0x37140804,
+0x36ff0804,
+0x36ff0804,
+0x370f0804,
+0x36ff0804,
+0x37100804,
+0x36ff0804,
+0x37110804,
+0x36ff0804,
+0x37140804,
+0x37000804,
+0x37000804,
+0x370f0804,
+0x37000804,
+0x37100804,
+0x37000804,
+0x37110804,
+0x37000804,
+0x37140804,
+0x37010804,
+0x37010804,
+0x370f0804,
+0x37010804,
+0x37100804,
+0x37010804,
+0x37110804,
+0x37010804,
+0x37140804,
+0x37020804,
+0x37020804,
+0x370f0804,
+0x37020804,
+0x37100804,
+0x37020804,
+0x37110804,
+0x37020804,
+0x37140804,
+0x37030804,
+0x37030804,
+0x370f0804,
+0x37030804,
+0x37100804,
+0x37030804,
+0x37110804,
+0x37030804,
+0x37140804,
+0x37040804,
+0x37040804,
+0x370f0804,
+0x37040804,
+0x37100804,
+0x37040804,
+0x37110804,
+0x37040804,
+0x37140804,
+0x37050804,
+0x37050804,
+0x370f0804,
+0x37050804,
+0x37100804,
+0x37050804,
+0x37110804,
+0x37050804,
+0x37140804,
+0x37060804,
+0x37060804,
+0x370f0804,
+0x37060804,
+0x37100804,
+0x37060804,
+0x37110804,
+0x37060804,
+0x37140804,
+0x37070804,
+0x37070804,
+0x370f0804,
+0x37070804,
+0x37100804,
+0x37070804,
+0x37110804,
+0x37070804,
+0x37140804,
+0x37080804,
+0x37080804,
+0x370f0804,
+0x37080804,
+0x37100804,
+0x37080804,
+0x37110804,
+0x37080804,
+0x37140804,
+0x37090804,
+0x37090804,
+0x370f0804,
+0x37090804,
+0x37100804,
+0x37090804,
+0x37110804,
+0x37090804,
+0x37140804,
+0x370a0804,
+0x370b0804,
+0x370c0804,
+0x370d0804,
+0x370e0804,
+0x370f0804,
+0x37100804,
+0x37110804,
+0x37120804,
+0x37130804,
+0x37140804,
+0x37150804,
+0x37160804,
+0x37170804,
+0x37180804,
+0x37190804,
+0x371a0804,
+0x371b0804,
+0x371c0804,
+0x371d0804,
+0x371e0804,
+0x371f0804,
+0x37200804,
+0x37210804,
+0x37220804,
+0x37230804,
+0x37240804,
+0x37250804,
+0x37260804,
+0x37270804,
+0x37280804,
+0x37290804,
+0x372a0804,
+0x372a0808,
+0x372b0804,
+0x372c0804,
+0x372d0804,
+0x372e0804,
+0x372f0804,
+0x37300804,
+0x37310804,
+0x37320804,
+0x37330804,
+0x37340804,
+0x37350804,
+0x37360804,
+0x37370804,
+0x37380804,
+0x37390804,
+0x373a0804,
+0x373b0804,
+0x373c0804,
+0x373d0804,
+0x373e0804,
+0x373f0804,
+0x373f0808,
+0x37400804,
+0x37410804,
+0x37420804,
+0x37430804,
+0x37440804,
+0x37450804,
+0x37460804,
+0x37470804,
+0x37480804,
+0x37490804,
+0x374a0804,
+0x374a0808,
+0x37700808,
+0x374a0808,
+0x374b0804,
+0x374c0804,
+0x374d0804,
+0x374e0804,
+0x374f0804,
+0x37500804,
+0x37510804,
+0x37520804,
+0x37530804,
+0x37540804,
+0x37550804,
+0x37560804,
+0x37570804,
+0x37580804,
+0x37590804,
+0x375a0804,
+0x375b0804,
+0x375c0804,
+0x375d0804,
+0x375e0804,
+0x375f0804,
+0x37600804,
+0x37610804,
+0x37620804,
+0x37620808,
+0x37630804,
+0x37640804,
+0x37650804,
+0x37660804,
+0x37670804,
+0x37680804,
+0x37690804,
+0x376a0804,
+0x376b0804,
+0x376c0804,
+0x376d0804,
+0x376e0804,
+0x376f0804,
+0x37700804,
+0x37710804,
+0x37720804,
+0x37730804,
+0x37740804,
+0x37750804,
+0x37760804,
+0x37770804,
+0x37780804,
+0x37790804,
+0x377a0804,
+0x377b0804,
+0x377c0804,
+0x377d0804,
+0x377e0804,
+0x377f0804,
+0x37800804,
+0x37810804,
+0x37820804,
+0x37830804,
+0x37840804,
+0x37850804,
+0x37860804,
+0x37870804,
+0x37880804,
+0x37890804,
+0x378a0804,
+0x378b0804,
+0x378c0804,
+0x378d0804,
+0x378e0804,
+0x378f0804,
+0x37900804,
+0x37910804,
+0x37920804,
+0x37930804,
+0x37940804,
+0x37950804,
+0x37960804,
+0x37970804,
+0x37980804,
+0x37990804,
+0x379a0804,
+0x379b0804,
+0x379c0804,
+0x379d0804,
+0x379e0804,
+0x379f0804,
+0x37a00804,
+0x37a10804,
+0x37a20804,
+0x37a30804,
+0x37a40804,
+0x37a50804,
+0x37a60804,
+0x37a70804,
+0x37a80804,
+0x37a90804,
+0x37aa0804,
+0x37ab0804,
+0x37ac0804,
+0x37ad0804,
+0x37ae0804,
+0x37af0804,
+0x37b00804,
+0x37b10804,
+0x37b20804,
+0x37b30804,
+0x37b40804,
+0x37b50804,
+0x37b60804,
+0x37b70804,
+0x37b80804,
+0x37b90804,
+0x37ba0804,
+0x37bb0804,
+0x37bc0804,
+0x37bd0804,
+0x37be0804,
+0x37bf0804,
+0x37c00804,
+0x37c10804,
+0x37c20804,
+0x37c30804,
+0x37c40804,
+0x37c50804,
+0x37c60804,
+0x37c70804,
+0x37c80804,
+0x37c90804,
+0x37ca0804,
+0x37cb0804,
+0x37cc0804,
+0x37cd0804,
+0x37ce0804,
+0x37cf0804,
+0x37d00804,
+0x37d10804,
+0x37d20804,
+0x37d30804,
+0x37d40804,
+0x37d50804,
+0x37d60804,
+0x37d70804,
+0x37d80804,
+0x37d90804,
+0x37da0804,
+0x37db0804,
+0x37dc0804,
+0x37dd0804,
+0x37de0804,
+0x37df0804,
+0x37e00804,
+0x37e10804,
+0x37e20804,
+0x37e30804,
+0x37e40804,
+0x37e50804,
+0x37e60804,
+0x37e70804,
+0x37e80804,
+0x37e90804,
+0x37ea0804,
+0x37eb0804,
+0x37ec0804,
+0x37ed0804,
+0x37ee0804,
+0x37ef0804,
+0x37f00804,
+0x37f10804,
+0x37f20804,
+0x37f30804,
+0x37f40804,
+0x37f50804,
+0x37f60804,
+0x37f70804,
+0x37f80804,
+0x37f90804,
+0x37fa0804,
+0x37fb0804,
+0x37fc0804,
+0x37fd0804,
+0x37fe0804,
+0x37ff0804,
+0x38000804,
+0x38010804,
+0x38020804,
+0x38030804,
+0x38040804,
+0x38050804,
+0x38060804,
+0x38070804,
+0x38080804,
+0x38090804,
+0x380a0804,
+0x380b0804,
+0x380c0804,
+0x380d0804,
+0x380e0804,
+0x380f0804,
+0x38100804,
+0x38110804,
+0x38120804,
+0x38130804,
+0x38140804,
+0x38150804,
+0x38160804,
+0x38170804,
+0x38180804,
+0x38190804,
+0x381a0804,
+0x381b0804,
+0x381c0804,
+0x381d0804,
+0x381e0804,
+0x381f0804,
+0x38200804,
+0x38210804,
+0x38220804,
+0x38230804,
+0x38240804,
+0x38240808,
+0x38250804,
+0x38260804,
+0x38270804,
+0x38280804,
+0x38290804,
+0x382a0804,
+0x382b0804,
+0x382c0804,
+0x382c0808,
+0x382d0804,
+0x382e0804,
+0x382f0804,
+0x38300804,
+0x38310804,
+0x38320804,
+0x38330804,
+0x38340804,
+0x38350804,
+0x38360804,
+0x38370804,
+0x38380804,
+0x38390804,
+0x383a0804,
+0x383b0804,
+0x383c0804,
+0x383d0804,
+0x383e0804,
+0x383f0804,
+0x38400804,
+0x38410804,
+0x38420804,
+0x38430804,
+0x38440804,
+0x38450804,
+0x38460804,
+0x38470804,
+0x38480804,
+0x38490804,
+0x384a0804,
+0x384b0804,
+0x384c0804,
+0x384d0804,
+0x384e0804,
+0x384f0804,
+0x38500804,
+0x38510804,
+0x38520804,
+0x38530804,
+0x38540804,
+0x38550804,
+0x38560804,
+0x38570804,
+0x38580804,
+0x38590804,
+0x385a0804,
+0x385b0804,
+0x385c0804,
+0x385d0804,
+0x385e0804,
+0x385f0804,
+0x38600804,
+0x38610804,
+0x38620804,
+0x38630804,
+0x38640804,
+0x38650804,
+0x38660804,
+0x38670804,
+0x38680804,
+0x38690804,
+0x386a0804,
+0x386b0804,
+0x386c0804,
+0x386d0804,
+0x386e0804,
+0x386f0804,
+0x38700804,
+0x38710804,
+0x38720804,
+0x38730804,
+0x38740804,
+0x38750804,
+0x38760804,
+0x38770804,
+0x38780804,
+0x38790804,
+0x387b0804,
+0x387c0804,
+0x387d0804,
+0x387e0804,
+0x387f0804,
+0x38800804,
+0x38810804,
+0x38820804,
+0x38830804,
+0x38840804,
+0x38850804,
+0x38860804,
+0x38870804,
+0x38880804,
+0x38890804,
+0x388a0804,
+0x388b0804,
+0x388c0804,
+0x388d0804,
+0x388e0804,
+0x388f0804,
+0x38900804,
+0x38910804,
+0x38920804,
+0x38930804,
+0x38940804,
+0x38950804,
+0x38960804,
+0x38970804,
+0x38980804,
+0x38990804,
+0x389a0804,
+0x389b0804,
+0x389c0804,
+0x389d0804,
+0x389e0804,
+0x389f0804,
+0x38a00804,
+0x38a10804,
+0x38a20804,
+0x38a30804,
+0x38a40804,
+0x38a50804,
+0x38a60804,
+0x38a70804,
+0x38a80804,
+0x38a90804,
+0x38aa0804,
+0x38ab0804,
+0x38ac0804,
+0x38ad0804,
+0x38ae0804,
+0x38af0804,
+0x38b00804,
+0x38b10804,
+0x38b20804,
+0x38b30804,
+0x38b40804,
+0x38b50804,
+0x38b60804,
+0x38b70804,
+0x38b80804,
+0x38b90804,
+0x38ba0804,
+0x38bb0804,
+0x38bc0804,
+0x38bd0804,
+0x38be0804,
+0x38bf0804,
+0x38c00804,
+0x38c10804,
+0x38c20804,
+0x38c30804,
+0x38c40804,
+0x38c50804,
+0x38c60804,
+0x38c70804,
+0x38c80804,
+0x38c90804,
+0x38ca0804,
+0x38cb0804,
+0x38cc0804,
+0x38cd0804,
+0x38ce0804,
+0x38cf0804,
+0x38d00804,
+0x38d10804,
+0x38d20804,
+0x38d30804,
+0x38d40804,
+0x38d50804,
+0x38d60804,
+0x38d70804,
+0x38d80804,
+0x38d90804,
+0x38da0804,
+0x38db0804,
+0x38dc0804,
+0x38dd0804,
+0x38de0804,
+0x38de0810,
+0x38df0804,
+0x38df0810,
+0x38e00804,
+0x38e00810,
+0x38e10804,
+0x38e10810,
+0x38e20804,
+0x38e20810,
+0x38e30804,
+0x38e30810,
+0x38e40804,
+0x38e40810,
+0x38e50804,
+0x38e50810,
+0x38e60804,
+0x38e60810,
+0x38e70804,
+0x38e70810,
+0x38e80804,
+0x38e80810,
+0x38e90804,
+0x38e90810,
+0x38ea0804,
+0x38ea0810,
+0x38eb0804,
+0x38eb0810,
+0x38ec0804,
+0x38ec0810,
+0x38ed0804,
+0x38ed0810,
+0x38ee0804,
+0x38ee0810,
+0x38ef0804,
+0x38ef0810,
+0x38f00804,
+0x38f00810,
+0x38f10804,
+0x38f10810,
+0x38f20804,
+0x38f20810,
+0x38f30804,
+0x38f30810,
+0x38f40804,
+0x38f40810,
+0x38f50804,
+0x38f50810,
+0x38f60804,
+0x38f60810,
+0x38f70804,
+0x38f70810,
+0x38f80804,
+0x38f80810,
+0x38f90804,
+0x38f90810,
+0x38fa0804,
+0x38fa0810,
+0x38fb0804,
+0x38fb0810,
+0x38fc0804,
+0x38fc0810,
+0x38fd0804,
+0x38fd0810,
+0x38fe0804,
+0x38fe0810,
+0x38ff0804,
+0x38ff0810,
+0x39000804,
+0x39000810,
+0x39010804,
+0x39010810,
+0x39020804,
+0x39020810,
+0x39030804,
+0x39030810,
+0x39040804,
+0x39040810,
+0x39050804,
+0x39050810,
+0x39060804,
+0x39060810,
+0x39070804,
+0x39070810,
+0x39080804,
+0x39080810,
+0x39090804,
+0x39090810,
+0x390a0804,
+0x390a0810,
+0x390b0804,
+0x390b0810,
+0x390c0804,
+0x390c0810,
+0x390d0804,
+0x390d0810,
+0x390e0804,
+0x390e0810,
+0x390f0804,
+0x390f0810,
+0x39100804,
+0x39100810,
+0x39110804,
+0x39110810,
+0x39120804,
+0x39120810,
+0x39130804,
+0x39130810,
+0x39140804,
+0x39140810,
+0x39150804,
+0x39150810,
+0x39160804,
+0x39160810,
+0x39170804,
+0x39170810,
+0x39180804,
+0x39180810,
+0x39190804,
+0x39190810,
+0x391a0804,
+0x391a0810,
+0x391b0804,
+0x391b0810,
+0x391c0804,
+0x391c0810,
+0x391d0804,
+0x391d0810,
+0x391e0804,
+0x391e0810,
+0x391f0804,
+0x391f0810,
+0x39200804,
+0x39200810,
+0x39210804,
+0x39210810,
+0x39220804,
+0x39220810,
+0x39230804,
+0x39230810,
+0x39240804,
+0x39240810,
+0x39250804,
+0x39250810,
+0x39260804,
+0x39260810,
+0x39270804,
+0x39270810,
+0x39280804,
+0x39280810,
+0x39290804,
+0x39290810,
+0x392a0804,
+0x392a0810,
+0x392b0804,
+0x392b0810,
+0x392c0804,
+0x392c0810,
+0x392d0804,
+0x392d0810,
+0x392e0804,
+0x392e0810,
+0x392f0804,
+0x392f0810,
+0x39300804,
+0x39300810,
+0x39310804,
+0x39310810,
+0x39320804,
+0x39320810,
+0x39330804,
+0x39330810,
+0x39580804,
+0x39590804,
+0x395a0804,
+0x395b0804,
+0x395c0804,
+0x395d0804,
+0x395e0804,
+0x395f0804,
+0x39600804,
+0x39610804,
+0x39620804,
+0x39630804,
+0x39640804,
+0x39650804,
+0x39660804,
+0x39670804,
+0x39680804,
+0x39690804,
+0x396a0804,
+0x396b0804,
+0x396c0804,
+0x396d0804,
+0x396e0804,
+0x396f0804,
+0x39700804,
+0x39710804,
+0x39720804,
+0x39730804,
+0x39740804,
+0x39750804,
+0x39760804,
+0x39770804,
+0x39780804,
+0x39790804,
+0x397a0804,
+0x397b0804,
+0x397c0804,
+0x397d0804,
+0x397e0804,
+0x397f0804,
+0x39800804,
+0x39810804,
+0x39820804,
+0x39830804,
+0x39840804,
+0x39850804,
+0x39860804,
+0x39870804,
+0x39880804,
+0x39890804,
+0x398a0804,
+0x398b0804,
+0x398c0804,
+0x398d0804,
+0x398e0804,
+0x398f0804,
+0x39900804,
+0x39910804,
+0x39920804,
+0x39930804,
+0x39940804,
+0x39950804,
+0x39960804,
+0x39970804,
+0x39980804,
+0x39990804,
+0x399a0804,
+0x399b0804,
+0x399c0804,
+0x399d0804,
+0x399e0804,
+0x399f0804,
+0x39a00804,
+0x39a10804,
+0x39a20804,
+0x39a30804,
+0x39a40804,
+0x39a50804,
+0x39a60804,
+0x39a70804,
+0x39a80804,
+0x39a90804,
+0x39aa0804,
+0x39ab0804,
+0x39ac0804,
+0x39ad0804,
+0x39ae0804,
+0x39af0804,
+0x39b00804,
+0x39b10804,
+0x39b20804,
+0x39b30804,
+0x39b40804,
+0x39b50804,
+0x39b60804,
+0x39b70804,
+0x39b80804,
+0x39b90804,
+0x39ba0804,
+0x39bb0804,
+0x39bc0804,
+0x39bd0804,
+0x39be0804,
+0x39bf0804,
+0x39c00804,
+0x39c10804,
+0x39c20804,
+0x39c30804,
+0x39c40804,
+0x39c50804,
+0x39c60804,
+0x39c70804,
+0x39c80804,
+0x39c90804,
+0x39ca0804,
+0x39cb0804,
+0x39cc0804,
+0x39cd0804,
+0x39ce0804,
+0x39cf0804,
+0x39d00804,
+0x39d10804,
+0x39d20804,
+0x39d30804,
+0x39d40804,
+0x39d50804,
+0x39d60804,
+0x39d70804,
+0x39d80804,
+0x39d90804,
+0x39da0804,
+0x39db0804,
+0x39dc0804,
+0x39dd0804,
+0x39de0804,
+0x39df0804,
+0x39e00804,
+0x39e10804,
+0x39e20804,
+0x39e30804,
+0x39e40804,
+0x39e50804,
+0x39e60804,
+0x39e70804,
+0x39e80804,
+0x39e90804,
+0x39ea0804,
+0x39eb0804,
+0x39ec0804,
+0x39ed0804,
+0x39ee0804,
+0x39ef0804,
+0x39f00804,
+0x39f10804,
+0x39f20804,
+0x39f30804,
+0x39f40804,
+0x39f50804,
+0x39f60804,
+0x39f70804,
+0x39f80804,
+0x39f90804,
+0x39fa0804,
+0x39fb0804,
+0x39fc0804,
+0x39fd0804,
+0x39fe0804,
+0x39ff0804,
+0x3a000804,
+0x3a010804,
+0x3a020804,
+0x3a030804,
+0x3a040804,
+0x3a050804,
+0x3a060804,
+0x3a070804,
+0x3a080804,
+0x3a090804,
+0x3a0a0804,
+0x3a0b0804,
+0x3a0c0804,
+0x3a0d0804,
+0x3a0e0804,
+0x3a0f0804,
+0x3a100804,
+0x3a110804,
+0x3a120804,
+0x3a130804,
+0x3a140804,
+0x3a150804,
+0x3a160804,
+0x3a170804,
+0x3a180804,
+0x3a190804,
+0x3a1a0804,
+0x3a1b0804,
+0x3a1c0804,
+0x3a1d0804,
+0x3a1e0804,
+0x3a1f0804,
+0x3a200804,
+0x3a210804,
+0x3a220804,
+0x3a230804,
+0x3a240804,
+0x3a250804,
+0x3a260804,
+0x3a270804,
+0x3a280804,
+0x3a290804,
+0x3a2a0804,
+0x3a2b0804,
+0x3a2c0804,
+0x3a2d0804,
+0x3a2e0804,
+0x3a2f0804,
+0x3a300804,
+0x3a310804,
+0x3a320804,
+0x3a330804,
+0x3a340804,
+0x3a350804,
+0x3a360804,
+0x3a370804,
+0x3a380804,
+0x3a390804,
+0x3a3a0804,
+0x3a3b0804,
+0x3a3c0804,
+0x3a3d0804,
+0x3a3e0804,
+0x3a3f0804,
+0x3a400804,
+0x3a410804,
+0x3a420804,
+0x3a430804,
+0x3a440804,
+0x3a450804,
+0x3a460804,
+0x3a470804,
+0x3a480804,
+0x3a490804,
+0x3a4a0804,
+0x3a4b0804,
+0x3a4c0804,
+0x3a4d0804,
+0x3a4e0804,
+0x3a4f0804,
+0x3a500804,
+0x3a510804,
+0x3a520804,
+0x3a530804,
+0x3a540804,
+0x3a550804,
+0x3a560804,
+0x3a570804,
+0x3a580804,
+0x3a590804,
+0x3a5a0804,
+0x3a5b0804,
+0x3a5c0804,
+0x3a5d0804,
+0x3a5e0804,
+0x3a5f0804,
+0x3a600804,
+0x3a610804,
+0x3a620804,
+0x3a630804,
+0x3a640804,
+0x3a650804,
+0x3a660804,
+0x3a670804,
+0x3a680804,
+0x3a690804,
+0x3a6a0804,
+0x3a6b0804,
+0x3a6c0804,
+0x3a6d0804,
+0x3a6e0804,
+0x3a6f0804,
+0x3a700804,
+0x3a710804,
+0x3a720804,
+0x3a730804,
+0x3a740804,
+0x3a750804,
+0x3a760804,
+0x3a770804,
+0x3a780804,
+0x3a790804,
+0x3a7a0804,
+0x3a7b0804,
+0x3a7c0804,
+0x3a7d0804,
+0x3a7e0804,
+0x3a7f0804,
+0x3a800804,
+0x3a810804,
+0x3a820804,
+0x3a830804,
+0x3a840804,
+0x3a850804,
+0x3a860804,
+0x3a870804,
+0x3a880804,
+0x3a890804,
+0x3a8a0804,
+0x3a8b0804,
+0x3a8c0804,
+0x3a8d0804,
+0x3a8e0804,
+0x3a8f0804,
+0x3a900804,
+0x3a910804,
+0x3a920804,
+0x3a930804,
+0x3a940804,
+0x3a950804,
+0x3a960804,
+0x3a970804,
+0x3a980804,
+0x3a990804,
+0x3a9a0804,
+0x3a9b0804,
+0x3a9c0804,
+0x3a9d0804,
+0x3a9e0804,
+0x3a9f0804,
+0x3aa00804,
+0x3aa10804,
+0x3aa20804,
+0x3aa30804,
+0x3aa40804,
+0x3aa50804,
+0x3aa60804,
+0x3aa70804,
+0x3aa80804,
+0x3aa90804,
+0x3aaa0804,
+0x3aab0804,
+0x3aac0804,
+0x3aad0804,
+0x3aae0804,
+0x3aaf0804,
+0x3ab00804,
+0x3ab10804,
+0x3ab20804,
+0x3ab30804,
+0x3ab40804,
+0x3ab50804,
+0x3ab60804,
+0x3ab70804,
+0x3ab80804,
+0x3ab90804,
+0x3aba0804,
+0x3abb0804,
+0x3abc0804,
+0x3abd0804,
+0x3abe0804,
+0x3abf0804,
+0x3ac00804,
+0x3ac10804,
+0x3ac20804,
+0x3ac30804,
+0x3ac40804,
+0x3ac50804,
+0x3ac60804,
+0x3ac70804,
+0x3ac80804,
+0x3ac90804,
+0x3aca0804,
+0x3acb0804,
+0x3acc0804,
+0x3acd0804,
+0x3ace0804,
+0x3acf0804,
+0x3ad00804,
+0x3ad10804,
+0x3ad20804,
+0x3ad30804,
+0x3ad40804,
+0x3ad50804,
+0x3ad60804,
+0x3ad70804,
+0x3ad80804,
+0x3ad90804,
+0x3ada0804,
+0x3adb0804,
+0x3adc0804,
+0x3add0804,
+0x3ade0804,
+0x3adf0804,
+0x3ae00804,
+0x3ae10804,
+0x3ae20804,
+0x3ae30804,
+0x3ae40804,
+0x3ae50804,
+0x3ae60804,
+0x3ae70804,
+0x3ae80804,
+0x3ae90804,
+0x3aea0804,
+0x3aeb0804,
+0x3aec0804,
+0x3aed0804,
+0x3aee0804,
+0x3aef0804,
+0x3af00804,
+0x3af10804,
+0x3af20804,
+0x3af30804,
+0x3af40804,
+0x3af50804,
+0x3af60804,
+0x3af70804,
+0x3af80804,
+0x3af90804,
+0x3afa0804,
+0x3afb0804,
+0x3afc0804,
+0x3afd0804,
+0x3afe0804,
+0x3aff0804,
+0x3b000804,
+0x3b010804,
+0x3b020804,
+0x3b030804,
+0x3b040804,
+0x3b050804,
+0x3b060804,
+0x3b070804,
+0x3b080804,
+0x3b090804,
+0x3b0a0804,
+0x3b0b0804,
+0x3b0c0804,
+0x3b0d0804,
+0x3b0e0804,
+0x3b0f0804,
+0x3b100804,
+0x3b110804,
+0x3b120804,
+0x3b130804,
+0x3b140804,
+0x3b150804,
+0x3b160804,
+0x3b170804,
+0x3b180804,
+0x3b190804,
+0x3b1a0804,
+0x3b1b0804,
+0x3b1c0804,
+0x3b1d0804,
+0x3b1e0804,
+0x3b1f0804,
+0x3b200804,
+0x3b210804,
+0x3b220804,
+0x3b230804,
+0x3b240804,
+0x3b250804,
+0x3b260804,
+0x3b270804,
+0x3b280804,
+0x3b290804,
+0x3b2a0804,
+0x3b2b0804,
+0x3b2c0804,
+0x3b2d0804,
+0x3b2e0804,
+0x3b2f0804,
+0x3b300804,
+0x3b310804,
+0x3b320804,
+0x3b330804,
+0x3b340804,
+0x3b350804,
+0x3b360804,
+0x3b370804,
+0x3b380804,
+0x3b390804,
+0x3b3a0804,
+0x3b3b0804,
+0x3b3c0804,
+0x3b3d0804,
+0x3b3e0804,
+0x3b3f0804,
+0x3b400804,
+0x3b410804,
+0x3b420804,
+0x3b430804,
+0x3b440804,
+0x3b450804,
+0x3b460804,
+0x3b470804,
+0x3b480804,
+0x3b490804,
+0x3b4a0804,
+0x3b4b0804,
+0x3b4c0804,
+0x3b4d0804,
+0x3b4e0804,
+0x3b4f0804,
+0x3b500804,
+0x3b510804,
+0x3b520804,
+0x3b530804,
+0x3b540804,
+0x3b550804,
+0x3b560804,
+0x3b570804,
+0x3b580804,
+0x3b590804,
+0x3b5a0804,
+0x3b5b0804,
+0x3b5c0804,
+0x3b5d0804,
+0x3b5e0804,
+0x3b5f0804,
+0x3b600804,
+0x3b610804,
+0x3b620804,
+0x3b630804,
+0x3b640804,
+0x3b650804,
+0x3b660804,
+0x3b670804,
+0x3b680804,
+0x3b690804,
+0x3b6a0804,
+0x3b6b0804,
+0x3b6c0804,
+0x3b6d0804,
+0x3b6e0804,
+0x3b6f0804,
+0x3b700804,
+0x3b710804,
+0x3b720804,
+0x3b730804,
+0x3b740804,
+0x3b750804,
+0x3b760804,
+0x3b770804,
+0x3b780804,
+0x3b790804,
+0x3b7a0804,
+0x3b7b0804,
+0x3b7c0804,
+0x3b7d0804,
+0x3b7e0804,
+0x3b7f0804,
+0x3b800804,
+0x3b810804,
+0x3b820804,
+0x3b830804,
+0x3b840804,
+0x3b850804,
+0x3b860804,
+0x3b870804,
+0x3b880804,
+0x3b890804,
+0x3b8a0804,
+0x3b8b0804,
+0x3b8c0804,
+0x3b8d0804,
+0x3b8e0804,
+0x3b8f0804,
+0x3b900804,
+0x3b910804,
+0x3b920804,
+0x3b930804,
+0x3b940804,
+0x3b950804,
+0x3b960804,
+0x3b970804,
+0x3b980804,
+0x3b990804,
+0x3b9a0804,
+0x3b9b0804,
+0x3b9c0804,
+0x3b9d0804,
+0x3b9e0804,
+0x3b9f0804,
+0x3ba00804,
+0x3ba10804,
+0x3ba20804,
+0x3ba30804,
+0x3ba40804,
+0x3ba50804,
+0x3ba60804,
+0x3ba70804,
+0x3ba80804,
+0x3ba90804,
+0x3baa0804,
+0x3bab0804,
+0x3bac0804,
+0x3bad0804,
+0x3bae0804,
+0x3baf0804,
+0x3bb00804,
+0x3bb10804,
+0x3bb20804,
+0x3bb30804,
+0x3bb40804,
+0x3bb50804,
+0x3bb60804,
+0x3bb70804,
+0x3bb80804,
+0x3bb90804,
+0x3bba0804,
+0x3bbb0804,
+0x3bbc0804,
+0x3bbd0804,
+0x3bbe0804,
+0x3bbf0804,
+0x3bc00804,
+0x3bc10804,
+0x3bc20804,
+0x3bc30804,
+0x3bc40804,
+0x3bc50804,
+0x3bc60804,
+0x3bc70804,
+0x3bc80804,
+0x3bc90804,
+0x3bca0804,
+0x3bcb0804,
+0x3bcc0804,
+0x3bcd0804,
+0x3bce0804,
+0x3bcf0804,
+0x3bd00804,
+0x3bd10804,
+0x3bd20804,
+0x3bd30804,
+0x3bd40804,
+0x3bd50804,
+0x3bd60804,
+0x3bd70804,
+0x3bd80804,
+0x3bd90804,
+0x3bda0804,
+0x3bdb0804,
+0x3bdc0804,
+0x3bdd0804,
+0x3bde0804,
+0x3bdf0804,
+0x3be00804,
+0x3be10804,
+0x3be20804,
+0x3be30804,
+0x3be40804,
+0x3be50804,
+0x3be60804,
+0x3be70804,
+0x3be80804,
+0x3be90804,
+0x3bea0804,
+0x3beb0804,
+0x3bec0804,
+0x3bed0804,
+0x3bee0804,
+0x3bef0804,
+0x3bf00804,
+0x3bf10804,
+0x3bf20804,
+0x3bf30804,
+0x3bf40804,
+0x3bf50804,
+0x3bf60804,
+0x3bf70804,
+0x3bf80804,
+0x3bf90804,
+0x3bfa0804,
+0x3bfb0804,
+0x3bfc0804,
+0x3bfd0804,
+0x3bfe0804,
+0x3bff0804,
+0x3c000804,
+0x3c010804,
+0x3c020804,
+0x3c030804,
+0x3c040804,
+0x3c050804,
+0x3c060804,
+0x3c070804,
+0x3c080804,
+0x3c090804,
+0x3c0a0804,
+0x3c0b0804,
+0x3c0c0804,
+0x3c0d0804,
+0x3c0e0804,
+0x3c0f0804,
+0x3c100804,
+0x3c110804,
+0x3c120804,
+0x3c130804,
+0x3c140804,
+0x3c150804,
+0x3c160804,
+0x3c170804,
+0x3c180804,
+0x3c190804,
+0x3c1a0804,
+0x3c1b0804,
+0x3c1c0804,
+0x3c1d0804,
+0x3c1e0804,
+0x3c1f0804,
+0x3c200804,
+0x3c210804,
+0x3c220804,
+0x3c230804,
+0x3c240804,
+0x3c250804,
+0x3c260804,
+0x3c270804,
+0x3c280804,
+0x3c290804,
+0x3c2a0804,
+0x3c2b0804,
+0x3c2c0804,
+0x3c2d0804,
+0x3c2e0804,
+0x3c2f0804,
+0x3c300804,
+0x3c310804,
+0x3c320804,
+0x3c330804,
+0x3c340804,
+0x3c350804,
+0x3c350808,
+0x4608,
+0x3c360804,
+0x3c360808,
+0x4608,
+0x3c360808,
+0x4648,
+0x3c370804,
+0x3c370808,
+0x4608,
+0x3c370808,
+0x3c370808,
+0x3c380804,
+0x3c380808,
+0x4608,
+0x3c380808,
+0x4648,
+0x3c380808,
+0x4688,
+0x3c380808,
+0x46c8,
+0x3c390804,
+0x3c3a0804,
+0x3c3b0804,
+0x3c3c0804,
+0x3c3d0804,
+0x3c3d0808,
+0x4608,
+0x3c3d0808,
+0x4648,
+0x3c3d0808,
+0x4688,
+0x3c3d0808,
+0x46c8,
+0x3c3e0804,
+0x3c3f0804,
+0x3c400804,
+0x3c400808,
+0x4608,
+0x3c410804,
+0x3c410808,
+0x4608,
+0x3c410808,
+0x4648,
+0x3c410808,
+0x4688,
+0x3c420804,
+0x3c420808,
+0x4608,
+0x3c420808,
+0x4648,
+0x3c430804,
+0x3c430808,
+0x4608,
+0x3c440804,
+0x3c450804,
+0x3c450808,
+0x4608,
+0x3c460804,
+0x3c460808,
+0x4608,
+0x3c460808,
+0x3c510808,
+0x3c470804,
+0x3c480804,
+0x3c480808,
+0x4608,
+0x3c490804,
+0x3c4a0804,
+0x3c4a0808,
+0x4608,
+0x3c4a0808,
+0x4648,
+0x3c4a0808,
+0x4688,
+0x3c4a0808,
+0x46c8,
+0x3c4a0808,
+0x4708,
+0x3c4b0804,
+0x3c4c0804,
+0x3c4c0808,
+0x4608,
+0x3c4c0808,
+0x4648,
+0x3c4d0804,
+0x3c4d0808,
+0x4608,
+0x3c4d0808,
+0x4648,
+0x3c4e0804,
+0x3c4f0804,
+0x3c500804,
+0x3c500808,
+0x4608,
+0x3c500808,
+0x4648,
+0x3c500808,
+0x4608,
+0x3c500808,
+0x4608,
+0x3c510804,
+0x3c510808,
+0x4608,
+0x3c520804,
+0x3c520808,
+0x4608,
+0x3c530804,
+0x3c540804,
+0x3c550804,
+0x3c560804,
+0x3c570804,
+0x3c580804,
+0x3c590804,
+0x3c5a0804,
+0x3c5b0804,
+0x3c5c0804,
+0x3c5d0804,
+0x3c5e0804,
+0x3c5f0804,
+0x3c600804,
+0x3c610804,
+0x3c620804,
+0x3c620808,
+0x4608,
+0x3c620808,
+0x4648,
+0x3c630804,
+0x3c630810,
+0x3c630808,
+0x4608,
+0x3c630814,
+0x4608,
+0x3c640804,
+0x3c640810,
+0x3c650804,
+0x3c650810,
+0x3c660804,
+0x3c660810,
+0x3c670804,
+0x3c670810,
+0x3c680804,
+0x3c680810,
+0x3c690804,
+0x3c690810,
+0x3c6a0804,
+0x3c6a0810,
+0x3c6b0804,
+0x3c6b0810,
+0x3c6b0808,
+0x4608,
+0x3c6b0814,
+0x4608,
+0x3c6b0808,
+0x4648,
+0x3c6b0814,
+0x4648,
+0x3c6c0804,
+0x3c6c0810,
+0x3c6d0804,
+0x3c6d0810,
+0x3c6e0804,
+0x3c6e0810,
+0x3c6f0804,
+0x3c6f0810,
+0x3c700804,
+0x3c700810,
+0x3c700808,
+0x4608,
+0x3c700814,
+0x4608,
+0x3c710804,
+0x3c710810,
+0x3c720804,
+0x3c720810,
+0x3c730804,
+0x3c730810,
+0x3c740804,
+0x3c740810,
+0x3c750804,
+0x3c750810,
+0x3c760804,
+0x3c760810,
+0x3c770804,
+0x3c770810,
+0x3c780804,
+0x3c780810,
+0x3c790804,
+0x3c790810,
+0x3c7a0804,
+0x3c7a0810,
+0x3c7a0808,
+0x4608,
+0x3c7a0814,
+0x4608,
+0x3c7b0804,
+0x3c7b0810,
+0x3c7b0808,
+0x4608,
+0x3c7b0814,
+0x4608,
+0x3c7b0808,
+0x4648,
+0x3c7b0814,
+0x4648,
+0x3c7c0804,
+0x3c7c0810,
+0x3c7d0804,
+0x3c7d0810,
+0x3c7e0804,
+0x3c7e0810,
+0x3c7e0808,
+0x4608,
+0x3c7e0814,
+0x4608,
+0x3c7f0804,
+0x3c7f0810,
+0x3c800804,
+0x3c800810,
+0x3c810804,
+0x3c810810,
+0x3c820804,
+0x3c820810,
+0x3c830804,
+0x3c830810,
+0x3c840804,
+0x3c840810,
+0x3c850804,
+0x3c850810,
+0x3c850808,
+0x4608,
+0x3c850814,
+0x4608,
+0x3c860804,
+0x3c860810,
+0x3c860808,
+0x4608,
+0x3c860814,
+0x4608,
+0x3c870804,
+0x3c870810,
+0x3c880804,
+0x3c880810,
+0x3c890804,
+0x3c890810,
+0x3c8a0804,
+0x3c8a0810,
+0x3c8b0804,
+0x3c8b0810,
+0x3c8c0804,
+0x3c8c0808,
+0x4608,
+0x3c8d0804,
+0x3c8e0804,
+0x3c8e0808,
+0x4608,
+0x3c8f0804,
+0x3c900804,
+0x3c910804,
+0x3c910808,
+0x4608,
+0x3c920804,
+0x3c920808,
+0x4608,
+0x3c930804,
+0x3c930808,
+0x4608,
+0x3c940804,
+0x3c940808,
+0x4608,
+0x3c950804,
+0x3c950808,
+0x4608,
+0x3c960804,
+0x3c960808,
+0x4608,
+0x3c970804,
+0x3c980804,
+0x3c980808,
+0x4608,
+0x3c990804,
+0x3c990808,
+0x4608,
+0x3c9a0804,
+0x3c9a0808,
+0x4608,
+0x3c9b0804,
+0x3c9b0808,
+0x4608,
+0x3c9c0804,
+0x3c9c0808,
+0x4608,
+0x3c9d0804,
+0x3c9d0808,
+0x4608,
+0x3c9e0804,
+0x3c9f0804,
+0x3ca00804,
+0x3ca10804,
+0x3ca20804,
+0x3ca20808,
+0x4608,
+0x3ca30804,
+0x3ca30808,
+0x4608,
+0x3ca40804,
+0x3ca40808,
+0x4608,
+0x3ca50804,
+0x3ca50808,
+0x4608,
+0x3ca60804,
+0x3ca70804,
+0x3ca70808,
+0x4608,
+0x3ca80804,
+0x3ca90804,
+0x3caa0804,
+0x3cab0804,
+0x3cab0808,
+0x4608,
+0x3cac0804,
+0x3cac0808,
+0x4608,
+0x3cad0804,
+0x3cad0808,
+0x4608,
+0x3cae0804,
+0x3cae0808,
+0x4608,
+0x3caf0804,
+0x3caf0808,
+0x4608,
+0x3cb00804,
+0x3cb10804,
+0x3cb20804,
+0x3cb30804,
+0x3cb30808,
+0x4608,
+0x3cb40804,
+0x3cb40808,
+0x4608,
+0x3cb50804,
+0x3cb50808,
+0x4608,
+0x3cb60804,
+0x3cb60808,
+0x4608,
+0x3cb70804,
+0x3cb80804,
+0x3cb90804,
+0x3cba0804,
+0x3cbb0804,
+0x3cbc0804,
+0x3cbd0804,
+0x3cbe0804,
+0x3cbf0804,
+0x3cc00804,
+0x3cc10804,
+0x3cc20804,
+0x3cc30804,
+0x3cc40804,
+0x3cc50804,
+0x3cc50808,
+0x3dc40808,
+0x3cc60804,
+0x3cc70804,
+0x3cc80804,
+0x3cc90804,
+0x3cca0804,
+0x3ccb0804,
+0x3ccc0804,
+0x3ccd0804,
+0x3cce0804,
+0x3ccf0804,
+0x3cd00804,
+0x3cd10804,
+0x3cd20804,
+0x3cd30804,
+0x3cd40804,
+0x3cd50804,
+0x3cd60804,
+0x3cd70804,
+0x3cd70808,
+0x3dc40808,
+0x3cd80804,
+0x3cd90804,
+0x3cda0804,
+0x3cdb0804,
+0x3cdc0804,
+0x3cdd0804,
+0x3cde0804,
+0x3cdf0804,
+0x3ce00804,
+0x3ce10804,
+0x3ce20804,
+0x3ce30804,
+0x3ce40804,
+0x3ce50804,
+0x3ce60804,
+0x3ce70804,
+0x3ce80804,
+0x3ce90804,
+0x3cea0804,
+0x3ceb0804,
+0x3cec0804,
+0x3cec0808,
+0x3dc40808,
+0x3ced0804,
+0x3cee0804,
+0x3cef0804,
+0x3cf00804,
+0x3cf10804,
+0x3cf20804,
+0x3cf30804,
+0x3cf40804,
+0x3cf50804,
+0x3cf60804,
+0x3cf70804,
+0x3cf80804,
+0x3cf90804,
+0x3cfa0804,
+0x3cfb0804,
+0x3cfc0804,
+0x3cfd0804,
+0x3cfe0804,
+0x3cff0804,
+0x3d000804,
+0x3d000808,
+0x3dc50808,
+0x3d010804,
+0x3d020804,
+0x3d030804,
+0x3d040804,
+0x3d050804,
+0x3d060804,
+0x3d070804,
+0x3d080804,
+0x3d090804,
+0x3d0a0804,
+0x3d0b0804,
+0x3d0b0808,
+0x3dc40808,
+0x3d0c0804,
+0x3d0d0804,
+0x3d0e0804,
+0x3d0f0804,
+0x3d100804,
+0x3d110804,
+0x3d110808,
+0x3d110808,
+0x3dc50808,
+0x3d120804,
+0x3d130804,
+0x3d130808,
+0x3dc50808,
+0x3d140804,
+0x3d150804,
+0x3d160804,
+0x3d170804,
+0x3d180804,
+0x3d190804,
+0x3d190808,
+0x3dc40808,
+0x3d1a0804,
+0x3d1b0804,
+0x3d1c0804,
+0x3d1d0804,
+0x3d1e0804,
+0x3d1f0804,
+0x3d200804,
+0x3d210804,
+0x3d220804,
+0x3d230804,
+0x3d230808,
+0x3d240804,
+0x3d250804,
+0x3d260804,
+0x3d270804,
+0x3d270808,
+0x3d280804,
+0x3d290804,
+0x3d2a0804,
+0x3d2b0804,
+0x3d2c0804,
+0x3d2d0804,
+0x3d2e0804,
+0x3d2f0804,
+0x3d300804,
+0x3d310804,
+0x3d320804,
+0x3d330804,
+0x3d340804,
+0x3d350804,
+0x3d360804,
+0x3d370804,
+0x3d380804,
+0x3d390804,
+0x3d3a0804,
+0x3d3b0804,
+0x3d3c0804,
+0x3d3d0804,
+0x3d3e0804,
+0x3d3e0808,
+0x3dc40808,
+0x3d3f0804,
+0x3d400804,
+0x3d400808,
+0x3d410804,
+0x3d420804,
+0x3d430804,
+0x3d440804,
+0x3d450804,
+0x3d460804,
+0x3d470804,
+0x3d480804,
+0x3d490804,
+0x3d4a0804,
+0x3d4b0804,
+0x3d4c0804,
+0x3d4d0804,
+0x3d4e0804,
+0x3d4f0804,
+0x3d500804,
+0x3d510804,
+0x3d520804,
+0x3d530804,
+0x3d540804,
+0x3d550804,
+0x3d560804,
+0x3d570804,
+0x3d580804,
+0x3d590804,
+0x3d5a0804,
+0x3d5b0804,
+0x3d5c0804,
+0x3d5d0804,
+0x3d5e0804,
+0x3d5f0804,
+0x3d600804,
+0x3d610804,
+0x3d620804,
+0x3d630804,
+0x3d640804,
+0x3d650804,
+0x3d660804,
+0x3d670804,
+0x3d680804,
+0x3d690804,
+0x3d6a0804,
+0x3d6b0804,
+0x3d6c0804,
+0x3d6d0804,
+0x3d6d0808,
+0x3dc40808,
+0x3d6e0804,
+0x3d6f0804,
+0x3d700804,
+0x3d710804,
+0x3d720804,
+0x3d730804,
+0x3d740804,
+0x3d750804,
+0x3d760804,
+0x3d770804,
+0x3d780804,
+0x3d790804,
+0x3d7a0804,
+0x3d7b0804,
+0x3d7c0804,
+0x3d7d0804,
+0x3d7e0804,
+0x3d7f0804,
+0x3d800804,
+0x3d810804,
+0x3d820804,
+0x3d830804,
+0x3d840804,
+0x3d840808,
+0x3dc40808,
+0x3d850804,
+0x3d860804,
+0x3d870804,
+0x3d880804,
+0x3d890804,
+0x3d8a0804,
+0x3d8a0808,
+0x3d8a0808,
+0x3dc50808,
+0x3d8b0804,
+0x3d8c0804,
+0x3d8d0804,
+0x3d8e0804,
+0x3d8f0804,
+0x3d900804,
+0x3d910804,
+0x3d910808,
+0x3dc40808,
+0x3d920804,
+0x3d930804,
+0x3d940804,
+0x3d950804,
+0x3d960804,
+0x3d970804,
+0x3d980804,
+0x3d990804,
+0x3d9a0804,
+0x3d9b0804,
+0x3d9c0804,
+0x3d9d0804,
+0x3d9e0804,
+0x3d9f0804,
+0x3da00804,
+0x3da10804,
+0x3da20804,
+0x3da30804,
+0x3da40804,
+0x3da50804,
+0x3da60804,
+0x3da70804,
+0x3da80804,
+0x3da90804,
+0x3daa0804,
+0x3dab0804,
+0x3dac0804,
+0x3dad0804,
+0x3dae0804,
+0x3daf0804,
+0x3db00804,
+0x3db10804,
+0x3db20804,
+0x3db30804,
+0x3db40804,
+0x3db50804,
+0x3db60804,
+0x3db70804,
+0x3db80804,
+0x3db90804,
+0x3dba0804,
+0x3dbb0804,
+0x3dbc0804,
+0x3dbd0804,
+0x3dbe0804,
+0x3dbf0804,
+0x3dc00804,
+0x3dc10804,
+0x3dc20804,
+0x3dc30804,
+0x3dc40804,
+0x3dc50804,
+0x3dc60804,
+0x3dc70804,
+0x3dc80804,
+0x3dc90804,
+0x3dca0804,
+0x3dcb0804,
+0x3dcc0804,
+0x3dcd0804,
+0x3dce0804,
+0x3dcf0804,
+0x3dd00804,
+0x3dd10804,
+0x3dd20804,
+0x3dd30804,
+0x3dd40804,
+0x3dd50804,
+0x3dd60804,
+0x3dd70804,
+0x3dd80804,
+0x3dd90804,
+0x3dda0804,
+0x3ddb0804,
+0x3ddc0804,
+0x3ddd0804,
+0x3dde0804,
+0x3ddf0804,
+0x3de00804,
+0x3de10804,
+0x3de20804,
+0x3de30804,
+0x3de40804,
+0x3de50804,
+0x3de60804,
+0x3de70804,
+0x3de80804,
+0x3de90804,
+0x3dea0804,
+0x3deb0804,
+0x3dec0804,
+0x3ded0804,
+0x3dee0804,
+0x3def0804,
+0x3df00804,
+0x3df10804,
+0x3df20804,
+0x3df30804,
+0x3df40804,
+0x3df50804,
+0x3df60804,
+0x3df70804,
+0x3df80804,
+0x3df90804,
+0x3dfa0804,
+0x3dfb0804,
+0x3dfc0804,
+0x3dfd0804,
+0x3dfe0804,
+0x3dff0804,
+0x3e000804,
+0x3e010804,
+0x3e020804,
+0x3e030804,
+0x3e040804,
+0x3e050804,
+0x3e060804,
+0x3e070804,
+0x3e080804,
+0x3e090804,
+0x3e0a0804,
+0x3e0b0804,
+0x3e0c0804,
+0x3e0d0804,
+0x3e0e0804,
+0x3e0f0804,
+0x3e100804,
+0x3e110804,
+0x3e120804,
+0x3e130804,
+0x3e140804,
+0x3e150804,
+0x3e160804,
+0x3e170804,
+0x3e180804,
+0x3e190804,
+0x3e1a0804,
+0x3e1b0804,
+0x3e1c0804,
+0x3e1d0804,
+0x3e1e0804,
+0x3e1f0804,
+0x3e200804,
+0x3e210804,
+0x3e220804,
+0x3e230804,
+0x3e240804,
+0x3e250804,
+0x3e260804,
+0x3e270804,
+0x3e280804,
+0x3e290804,
+0x3e2a0804,
+0x3e2b0804,
+0x3e2c0804,
+0x3e2d0804,
+0x3e2e0804,
+0x3e2f0804,
+0x3e300804,
+0x3e310804,
+0x3e320804,
+0x3e330804,
+0x3e340804,
+0x3e350804,
+0x3e360804,
+0x3e370804,
+0x3e380804,
+0x3e390804,
+0x3e3a0804,
+0x3e3b0804,
+0x3e3c0804,
+0x3e3d0804,
+0x3e3e0804,
+0x3e3f0804,
+0x3e400804,
+0x3e410804,
+0x3e420804,
+0x3e430804,
+0x3e440804,
+0x3e450804,
+0x3e460804,
+0x3e470804,
+0x3e480804,
+0x3e490804,
+0x3e4a0804,
+0x3e4b0804,
+0x3e4c0804,
+0x3e4d0804,
+0x3e4e0804,
+0x3e4f0804,
+0x3e500804,
+0x3e510804,
+0x3e520804,
+0x3e530804,
+0x3e540804,
+0x3e550804,
+0x3e560804,
+0x3e570804,
+0x3e580804,
+0x3e590804,
+0x3e5a0804,
+0x3e5b0804,
+0x3e5c0804,
+0x3e5d0804,
+0x3e5e0804,
+0x3e5f0804,
+0x3e600804,
+0x3e610804,
+0x3e620804,
+0x3e630804,
+0x3e640804,
+0x3e650804,
+0x3e660804,
+0x3e670804,
+0x3e680804,
+0x3e690804,
+0x3e6a0804,
+0x3e6b0804,
+0x3e6c0804,
+0x3e6d0804,
+0x3e6e0804,
+0x3e6f0804,
+0x3e700804,
+0x3e710804,
+0x3e720804,
+0x3e730804,
+0x3e740804,
+0x3e750804,
+0x3e760804,
+0x3e770804,
+0x3e780804,
+0x3e790804,
+0x3e7a0804,
+0x3e7b0804,
+0x3e7c0804,
+0x3e7d0804,
+0x3e7e0804,
+0x3e7f0804,
+0x3e800804,
+0x3e810804,
+0x3e820804,
+0x3e830804,
+0x3e840804,
+0x3e850804,
+0x3e860804,
+0x3e870804,
+0x3e880804,
+0x3e890804,
+0x3e8a0804,
+0x3e8b0804,
+0x3e8c0804,
+0x3e8d0804,
+0x3e8e0804,
+0x3e8f0804,
+0x3e900804,
+0x3e910804,
+0x3e920804,
+0x3e930804,
+0x3e940804,
+0x3e950804,
+0x3e960804,
+0x3e970804,
+0x3e980804,
+0x3e990804,
+0x3e9a0804,
+0x3e9b0804,
+0x3e9c0804,
+0x3e9d0804,
+0x3e9e0804,
+0x3e9f0804,
+0x3ea00804,
+0x3ea10804,
+0x3ea20804,
+0x3ea30804,
+0x3ea40804,
+0x3ea50804,
+0x3ea60804,
+0x3ea70804,
+0x3ea80804,
+0x3ea90804,
+0x3eaa0804,
+0x3eab0804,
+0x3eac0804,
+0x3ead0804,
+0x3eae0804,
+0x3eaf0804,
+0x3eb00804,
+0x3eb10804,
+0x3eb20804,
+0x3eb30804,
+0x3eb40804,
+0x3eb50804,
+0x3eb60804,
+0x3eb70804,
+0x3eb80804,
+0x3eb90804,
+0x3eba0804,
+0x3ebb0804,
+0x3ebc0804,
+0x3ebd0804,
+0x3ebe0804,
+0x3ebf0804,
+0x3ec00804,
+0x3ec10804,
+0x3ec20804,
+0x3ec30804,
+0x3ec40804,
+0x3ec50804,
+0x3ec60804,
+0x3ec70804,
+0x3ec80804,
+0x3ec90804,
+0x3eca0804,
+0x3ecb0804,
+0x3ecc0804,
+0x3ecd0804,
+0x3ece0804,
+0x3ecf0804,
+0x3ed00804,
+0x3ed10804,
+0x3ed20804,
+0x3ed30804,
+0x3ed40804,
+0x3ed50804,
+0x3ed60804,
+0x3ed70804,
+0x3ed80804,
+0x3ed90804,
+0x3eda0804,
+0x3edb0804,
+0x3edc0804,
+0x3edd0804,
+0x3ede0804,
+0x3edf0804,
+0x3ee00804,
+0x3ee10804,
+0x3ee20804,
+0x3ee30804,
+0x3ee40804,
+0x3ee50804,
+0x3ee60804,
+0x3ee70804,
+0x3ee80804,
+0x3ee90804,
+0x3eea0804,
+0x3eeb0804,
+0x3eec0804,
+0x3eed0804,
+0x3eee0804,
+0x3eef0804,
+0x3ef00804,
+0x3ef10804,
+0x3ef20804,
+0x3ef30804,
+0x3ef40804,
+0x3ef50804,
+0x3ef60804,
+0x3ef70804,
+0x3ef80804,
+0x3ef90804,
+0x3efa0804,
+0x3efb0804,
+0x3efc0804,
+0x3efd0804,
+0x3efe0804,
+0x3eff0804,
+0x3f000804,
+0x3f010804,
+0x3f020804,
+0x3f030804,
+0x3f040804,
+0x3f050804,
+0x3f060804,
+0x3f070804,
+0x3f080804,
+0x3f090804,
+0x3f0a0804,
+0x3f0b0804,
+0x3f0c0804,
+0x3f0d0804,
+0x3f0e0804,
+0x3f0f0804,
+0x3f100804,
+0x3f110804,
+0x3f120804,
+0x3f130804,
+0x3f140804,
+0x3f150804,
+0x3f160804,
+0x3f170804,
+0x3f180804,
+0x3f190804,
+0x3f1a0804,
+0x3f1b0804,
+0x3f1c0804,
+0x3f1d0804,
+0x3f1e0804,
+0x3f1f0804,
+0x3f200804,
+0x3f210804,
+0x3f220804,
+0x3f230804,
+0x3f240804,
+0x3f250804,
+0x3f260804,
+0x3f270804,
+0x3f280804,
+0x3f290804,
+0x3f2a0804,
+0x3f2b0804,
+0x3f2c0804,
+0x3f2d0804,
+0x3f2e0804,
+0x3f2f0804,
+0x3f300804,
+0x3f310804,
+0x3f320804,
+0x3f330804,
+0x3f340804,
+0x3f350804,
+0x3f360804,
+0x3f370804,
+0x3f380804,
+0x3f390804,
+0x3f3a0804,
+0x3f3b0804,
+0x3f3c0804,
+0x3f3d0804,
+0x3f3e0804,
+0x3f3f0804,
+0x3f400804,
+0x3f410804,
+0x3f420804,
+0x3f430804,
+0x3f440804,
+0x3f450804,
+0x3f460804,
+0x3f470804,
+0x3f480804,
+0x3f490804,
+0x3f4a0804,
+0x3f4b0804,
+0x3f4c0804,
+0x3f4d0804,
+0x3f4e0804,
+0x3f4f0804,
+0x3f500804,
+0x3f510804,
+0x3f520804,
+0x3f530804,
+0x3f540804,
+0x3f550804,
+0x3f560804,
+0x3f570804,
+0x3f580804,
+0x3f590804,
+0x3f5a0804,
+0x3f5b0804,
+0x3f5c0804,
+0x3f5d0804,
+0x3f5e0804,
+0x3f5f0804,
+0x3f600804,
+0x3f610804,
+0x3f620804,
+0x3f630804,
+0x3f640804,
+0x3f650804,
+0x3f660804,
+0x3f670804,
+0x3f680804,
+0x3f690804,
+0x3f6a0804,
+0x3f6b0804,
+0x3f6c0804,
+0x3f6d0804,
+0x3f6e0804,
+0x3f6f0804,
+0x3f700804,
+0x3f710804,
+0x3f720804,
+0x3f730804,
+0x3f740804,
+0x3f750804,
+0x3f760804,
+0x3f770804,
+0x3f780804,
+0x3f790804,
+0x3f7a0804,
+0x3f7b0804,
+0x3f7c0804,
+0x3f7d0804,
+0x3f7e0804,
+0x3f7f0804,
+0x3f800804,
+0x3f810804,
+0x3f820804,
+0x3f830804,
+0x3f840804,
+0x3f850804,
+0x3f860804,
+0x3f870804,
+0x3f880804,
+0x3f890804,
+0x3f8a0804,
+0x3f8b0804,
+0x3f8c0804,
+0x3f8d0804,
+0x3f8e0804,
+0x3f8f0804,
+0x3f900804,
+0x3f910804,
+0x3f920804,
+0x3f930804,
+0x3f940804,
+0x3f950804,
+0x3f960804,
+0x3f970804,
+0x3f980804,
+0x3f990804,
+0x3f9a0804,
+0x3f9b0804,
+0x3f9c0804,
+0x3f9d0804,
+0x3f9e0804,
+0x3f9f0804,
+0x3fa00804,
+0x3fa10804,
+0x3fa20804,
+0x3fa30804,
+0x3fa40804,
+0x3fa50804,
+0x3fa60804,
+0x3fa70804,
+0x3fa80804,
+0x3fa90804,
+0x3faa0804,
+0x3fab0804,
+0x3fac0804,
+0x3fad0804,
+0x3fae0804,
+0x3faf0804,
+0x3fb00804,
+0x3fb10804,
+0x3fb20804,
+0x3fb30804,
+0x3fb40804,
+0x3fb50804,
+0x3fb60804,
+0x3fb70804,
+0x3fb80804,
+0x3fb90804,
+0x3fba0804,
+0x3fbb0804,
+0x3fbc0804,
+0x3fbd0804,
+0x3fbe0804,
+0x3fbf0804,
+0x3fc00804,
+0x3fc10804,
+0x3fc20804,
+0x3fc30804,
+0x3fc40804,
+0x3fc50804,
+0x3fc60804,
+0x3fc70804,
+0x3fc80804,
+0x3fc90804,
+0x3fca0804,
+0x3fcb0804,
+0x3fcc0804,
+0x3fcd0804,
+0x3fce0804,
+0x3fcf0804,
+0x3fd00804,
+0x3fd10804,
+0x3fd20804,
+0x3fd30804,
+0x3fd40804,
+0x3fd50804,
+0x3fd60804,
+0x3fd70804,
+0x3fd80804,
+0x3fd90804,
+0x3fda0804,
+0x3fdb0804,
+0x3fdc0804,
+0x3fdd0804,
+0x3fde0804,
+0x3fdf0804,
+0x3fe00804,
+0x3fe10804,
+0x3fe20804,
+0x3fe30804,
+0x3fe40804,
+0x3fe50804,
+0x3fe60804,
+0x3fe70804,
+0x3fe80804,
+0x3fe90804,
+0x3fea0804,
+0x3feb0804,
+0x3fec0804,
+0x3fed0804,
+0x3fee0804,
+0x3fef0804,
+0x3ff00804,
+0x3ff10804,
+0x3ff20804,
+0x3ff30804,
+0x3ff40804,
+0x3ff50804,
+0x3ff60804,
+0x3ff70804,
+0x3ff80804,
+0x3ff90804,
+0x3ffa0804,
+0x3ffb0804,
+0x3ffc0804,
+0x3ffd0804,
+0x3ffe0804,
+0x3fff0804,
+0x40000804,
+0x40010804,
+0x40020804,
+0x40030804,
+0x40040804,
+0x40050804,
+0x40060804,
+0x40070804,
+0x40080804,
+0x40090804,
+0x400a0804,
+0x400b0804,
+0x400c0804,
+0x400d0804,
+0x400e0804,
+0x400f0804,
+0x40100804,
+0x40110804,
+0x40120804,
+0x40130804,
+0x40140804,
+0x40150804,
+0x40160804,
+0x40170804,
+0x40180804,
+0x40190804,
+0x401a0804,
+0x401b0804,
+0x401c0804,
+0x401d0804,
+0x401e0804,
+0x401f0804,
+0x40200804,
+0x40210804,
+0x40220804,
+0x40230804,
+0x40240804,
+0x40250804,
+0x40260804,
+0x40270804,
+0x40280804,
+0x40290804,
+0x402a0804,
+0x402b0804,
+0x402c0804,
+0x402d0804,
+0x402e0804,
+0x402f0804,
+0x40300804,
+0x40310804,
+0x40320804,
+0x40330804,
+0x40340804,
+0x40350804,
+0x40360804,
+0x40370804,
+0x40380804,
+0x40390804,
+0x403a0804,
+0x403b0804,
+0x403c0804,
+0x403d0804,
+0x403e0804,
+0x403f0804,
+0x40400804,
+0x40410804,
+0x40420804,
+0x40430804,
+0x40440804,
+0x40450804,
+0x40460804,
+0x40470804,
+0x40480804,
+0x40490804,
+0x404a0804,
+0x404b0804,
+0x404c0804,
+0x404d0804,
+0x404e0804,
+0x404f0804,
+0x40500804,
+0x40510804,
+0x40520804,
+0x40530804,
+0x40540804,
+0x40550804,
+0x40560804,
+0x40570804,
+0x40580804,
+0x40590804,
+0x405a0804,
+0x405b0804,
+0x405c0804,
+0x405d0804,
+0x405e0804,
+0x405f0804,
+0x40600804,
+0x40610804,
+0x40620804,
+0x40630804,
+0x40640804,
+0x40650804,
+0x40660804,
+0x40670804,
+0x40680804,
+0x40690804,
+0x406a0804,
+0x406b0804,
+0x406c0804,
+0x406d0804,
+0x406e0804,
+0x406f0804,
+0x40700804,
+0x40710804,
+0x40720804,
+0x40730804,
+0x40740804,
+0x40750804,
+0x40760804,
+0x40770804,
+0x40780804,
+0x40790804,
+0x407a0804,
+0x407b0804,
+0x407c0804,
+0x407d0804,
+0x407e0804,
+0x407f0804,
+0x40800804,
+0x40810804,
+0x40820804,
+0x40830804,
+0x40840804,
+0x40850804,
+0x40860804,
+0x40870804,
+0x40880804,
+0x40890804,
+0x408a0804,
+0x408b0804,
+0x408c0804,
+0x408d0804,
+0x408e0804,
+0x408f0804,
+0x40900804,
+0x40910804,
+0x40920804,
+0x40930804,
+0x40940804,
+0x40950804,
+0x40960804,
+0x40970804,
+0x40980804,
+0x40990804,
+0x409a0804,
+0x409b0804,
+0x409c0804,
+0x409d0804,
+0x409e0804,
+0x409f0804,
+0x40a00804,
+0x40a10804,
+0x40a20804,
+0x40a30804,
+0x40a40804,
+0x40a50804,
+0x40a60804,
+0x40a70804,
+0x40a80804,
+0x40a90804,
+0x40aa0804,
+0x40ab0804,
+0x40ac0804,
+0x40ad0804,
+0x40ae0804,
+0x40af0804,
+0x40b00804,
+0x40b10804,
+0x40b20804,
+0x40b30804,
+0x40b40804,
+0x40b50804,
+0x40b60804,
+0x40b70804,
+0x40b80804,
+0x40b90804,
+0x40ba0804,
+0x40bb0804,
+0x40bc0804,
+0x40bd0804,
+0x40be0804,
+0x40bf0804,
+0x40c00804,
+0x40c10804,
+0x40c20804,
+0x40c30804,
+0x40c40804,
+0x40c50804,
+0x40c60804,
+0x40c70804,
+0x40c80804,
+0x40c90804,
+0x40ca0804,
+0x40cb0804,
+0x40cc0804,
+0x40cd0804,
+0x40ce0804,
+0x40cf0804,
+0x40d00804,
+0x40d10804,
+0x40d20804,
+0x40d30804,
+0x40d40804,
+0x40d50804,
+0x40d60804,
+0x40d70804,
+0x40d80804,
+0x40d90804,
+0x40da0804,
+0x40db0804,
+0x40dc0804,
+0x40dd0804,
+0x40de0804,
+0x40df0804,
+0x40e00804,
+0x40e10804,
+0x40e20804,
+0x40e30804,
+0x40e40804,
+0x40e50804,
+0x40e60804,
+0x40e70804,
+0x40e80804,
+0x40e90804,
+0x40ea0804,
+0x40eb0804,
+0x40ec0804,
+0x40ed0804,
+0x40ee0804,
+0x40ef0804,
+0x40f00804,
+0x40f10804,
+0x40f20804,
+0x40f30804,
+0x40f40804,
+0x40f50804,
+0x40f60804,
+0x40f70804,
+0x40f80804,
+0x40f90804,
+0x40fa0804,
+0x40fb0804,
+0x40fc0804,
+0x40fd0804,
+0x40fe0804,
+0x40ff0804,
+0x41000804,
+0x41010804,
+0x41020804,
+0x41030804,
+0x41040804,
+0x41050804,
+0x41060804,
+0x41070804,
+0x41080804,
+0x41090804,
+0x410a0804,
+0x410b0804,
+0x410c0804,
+0x410d0804,
+0x410e0804,
+0x410f0804,
+0x41100804,
+0x41110804,
+0x41120804,
+0x41130804,
+0x41140804,
+0x41150804,
+0x41160804,
+0x41170804,
+0x41180804,
+0x41190804,
+0x411a0804,
+0x411b0804,
+0x411c0804,
+0x411d0804,
+0x411e0804,
+0x411f0804,
+0x41200804,
+0x41210804,
+0x41220804,
+0x41230804,
+0x41240804,
+0x41250804,
+0x41260804,
+0x41270804,
+0x41280804,
+0x41290804,
+0x412a0804,
+0x412b0804,
+0x412c0804,
+0x412d0804,
+0x412e0804,
+0x412f0804,
+0x41300804,
+0x41310804,
+0x41750804,
+0x41750808,
+0x3280809,
+0x41750808,
+0x3290809,
+0x4175080c,
+0x41750824,
+0x3280809,
+0x41750808,
+0x41f30808,
+0x3290809,
+0x4175080c,
+0x41f3080c,
+0x41760804,
+0x41760808,
+0x41760824,
+0x41770804,
+0x41770808,
+0x3280809,
+0x41770808,
+0x3290809,
+0x4177080c,
+0x41770824,
+0x3280809,
+0x41770808,
+0x41f30808,
+0x3290809,
+0x4177080c,
+0x41f3080c,
+0x41780804,
+0x41780808,
+0x3280809,
+0x41780808,
+0x3290809,
+0x4178080c,
+0x41780824,
+0x3280809,
+0x41780808,
+0x41f30808,
+0x3290809,
+0x4178080c,
+0x41f3080c,
+0x41790804,
+0x41790808,
+0x41790824,
+0x417a0804,
+0x417a0808,
+0x3280809,
+0x417a0808,
+0x3290809,
+0x417a080c,
+0x417a0824,
+0x3280809,
+0x417a0808,
+0x41f30808,
+0x3290809,
+0x417a080c,
+0x41f3080c,
+0x417b0804,
+0x417b0808,
+0x3280809,
+0x417b0808,
+0x3290809,
+0x417b080c,
+0x417b0824,
+0x3280809,
+0x417b0808,
+0x41f30808,
+0x3290809,
+0x417b080c,
+0x41f3080c,
+0x417c0804,
+0x417c0808,
+0x3280809,
+0x417c0808,
+0x3290809,
+0x417c080c,
+0x417c0824,
+0x3280809,
+0x417c0808,
+0x41f30808,
+0x3290809,
+0x417c080c,
+0x41f3080c,
+0x417d0804,
+0x417d0808,
+0x417d0824,
+0x417e0804,
+0x417e0808,
+0x3280809,
+0x417e0808,
+0x3290809,
+0x417e080c,
+0x417e0824,
+0x3280809,
+0x417e0808,
+0x41f30808,
+0x3290809,
+0x417e080c,
+0x41f3080c,
+0x417f0804,
+0x417f0808,
+0x417f0824,
+0x41800804,
+0x41800808,
+0x3280809,
+0x41800808,
+0x3290809,
+0x4180080c,
+0x41800824,
+0x3280809,
+0x41800808,
+0x41f30808,
+0x3290809,
+0x4180080c,
+0x41f3080c,
+0x3280809,
+0x41800808,
+0x41fb0808,
+0x41810808,
+0x41f70808,
+0x42540808,
+0x3290809,
+0x3280809,
+0x41800808,
+0x41fb0808,
+0x41870808,
+0x42000808,
+0x3290809,
+0x4180080c,
+0x4200080c,
+0x41810804,
+0x41810808,
+0x3280809,
+0x41810808,
+0x3290809,
+0x4181080c,
+0x41810824,
+0x3280809,
+0x41810808,
+0x41f30808,
+0x3290809,
+0x4181080c,
+0x41f3080c,
+0x3280809,
+0x41810808,
+0x42000808,
+0x3290809,
+0x4181080c,
+0x4200080c,
+0x4180080c,
+0x4206080c,
+0x41820804,
+0x41820808,
+0x41820824,
+0x41830804,
+0x41830808,
+0x3280809,
+0x41830808,
+0x3290809,
+0x4183080c,
+0x41830824,
+0x3280809,
+0x41830808,
+0x41f30808,
+0x3290809,
+0x4183080c,
+0x41f3080c,
+0x4183080c,
+0x41f3080c,
+0x4260080c,
+0x4175080c,
+0x41fb080c,
+0x41840804,
+0x41840808,
+0x3280809,
+0x41840808,
+0x3290809,
+0x4184080c,
+0x41840824,
+0x3280809,
+0x41840808,
+0x41f30808,
+0x3290809,
+0x4184080c,
+0x41f3080c,
+0x41850804,
+0x41850808,
+0x3280809,
+0x41850808,
+0x3290809,
+0x4185080c,
+0x41850824,
+0x3280809,
+0x41850808,
+0x41f30808,
+0x3290809,
+0x4185080c,
+0x41f3080c,
+0x41860804,
+0x41860808,
+0x3280809,
+0x41860808,
+0x3290809,
+0x4186080c,
+0x41860824,
+0x3280809,
+0x41860808,
+0x41f30808,
+0x3290809,
+0x4186080c,
+0x41f3080c,
+0x41870804,
+0x41870808,
+0x3280809,
+0x41870808,
+0x3290809,
+0x4187080c,
+0x41870824,
+0x3280809,
+0x41870808,
+0x41f30808,
+0x3290809,
+0x4187080c,
+0x41f3080c,
+0x41880804,
+0x41890804,
+0x41890808,
+0x418a0804,
+0x418a0808,
+0x418b0804,
+0x418c0804,
+0x418d0804,
+0x418e0804,
+0x418f0804,
+0x418f0808,
+0x418f0824,
+0x41900804,
+0x41910804,
+0x41910808,
+0x41920804,
+0x41920808,
+0x41930804,
+0x41930808,
+0x41940804,
+0x41950804,
+0x41950808,
+0x41960804,
+0x41960808,
+0x41960824,
+0x41970804,
+0x41970808,
+0x41980804,
+0x41980808,
+0x41990804,
+0x419a0804,
+0x419b0804,
+0x419c0804,
+0x419c0808,
+0x419d0804,
+0x419e0804,
+0x419e0808,
+0x419f0804,
+0x41a00804,
+0x41a00808,
+0x41a10804,
+0x41a10808,
+0x41a20804,
+0x41a20808,
+0x41a30804,
+0x41a30808,
+0x41a40804,
+0x41a40808,
+0x41a50804,
+0x41a60804,
+0x41a70804,
+0x41a70808,
+0x41a80804,
+0x41a90804,
+0x41aa0804,
+0x41ab0804,
+0x41ab0808,
+0x41ac0804,
+0x41ad0804,
+0x41ae0804,
+0x41af0804,
+0x41b00804,
+0x41b10804,
+0x41b20804,
+0x41b30804,
+0x41b40804,
+0x41b50804,
+0x41b50808,
+0x41b60804,
+0x41b70804,
+0x41b80804,
+0x41b90804,
+0x41ba0804,
+0x41bb0804,
+0x41bc0804,
+0x41bc0808,
+0x41bd0804,
+0x41be0804,
+0x41bf0804,
+0x41c00804,
+0x41c10804,
+0x41c10808,
+0x41c20804,
+0x41c30804,
+0x41c40804,
+0x41c50804,
+0x41c60804,
+0x41c70804,
+0x41c80804,
+0x41c90804,
+0x41ca0804,
+0x41cb0804,
+0x41cc0804,
+0x41cc0808,
+0x41cd0804,
+0x41cd0808,
+0x41ce0804,
+0x41ce0808,
+0x41cf0804,
+0x41d00804,
+0x41d10804,
+0x41d20804,
+0x41d30804,
+0x41d40804,
+0x41d50804,
+0x41d60804,
+0x41d70804,
+0x41d80804,
+0x41d90804,
+0x41da0804,
+0x41db0804,
+0x41dc0804,
+0x41dd0804,
+0x41de0804,
+0x41df0804,
+0x41e00804,
+0x41e10804,
+0x41e20804,
+0x41e30804,
+0x41e40804,
+0x41e50804,
+0x41e60804,
+0x41e70804,
+0x41e80804,
+0x41e90804,
+0x41ea0804,
+0x41eb0804,
+0x41ec0804,
+0x41ed0804,
+0x41ee0804,
+0x41ef0804,
+0x41f00804,
+0x41f10804,
+0x41f20804,
+0x41f20808,
+0x41f20824,
+0x41f30804,
+0x41f30808,
+0x41f30824,
+0x41f40804,
+0x41f40808,
+0x41f40824,
+0x41f50804,
+0x41f50808,
+0x41f50824,
+0x41f60804,
+0x41f60808,
+0x41f60824,
+0x41f70804,
+0x41f70808,
+0x41f70824,
+0x41f80804,
+0x41f80808,
+0x41f80824,
+0x41f90804,
+0x41f90808,
+0x41f90824,
+0x41fa0804,
+0x41fa0808,
+0x41fa0824,
+0x41fb0804,
+0x41fb0808,
+0x41fb0824,
+0x41fc0804,
+0x41fc0808,
+0x41fc0824,
+0x41fd0804,
+0x41fd0808,
+0x41fd0824,
+0x41fe0804,
+0x41fe0808,
+0x41fe0824,
+0x41ff0804,
+0x41ff0808,
+0x41ff0824,
+0x42000804,
+0x42000808,
+0x42000824,
+0x42010804,
+0x42010808,
+0x42010824,
+0x42020804,
+0x42020808,
+0x42020824,
+0x42030804,
+0x42030808,
+0x42030824,
+0x42040804,
+0x42040808,
+0x42040824,
+0x42050804,
+0x42050808,
+0x42050824,
+0x42060804,
+0x42060808,
+0x42060824,
+0x42070804,
+0x42070808,
+0x42070824,
+0x42080804,
+0x42090804,
+0x420a0804,
+0x420b0804,
+0x420c0804,
+0x420d0804,
+0x420e0804,
+0x420f0804,
+0x42100804,
+0x42110804,
+0x42120804,
+0x42130804,
+0x42140804,
+0x42150804,
+0x42160804,
+0x42160808,
+0x42170804,
+0x42170808,
+0x42180804,
+0x42190804,
+0x421a0804,
+0x421a0808,
+0x421b0804,
+0x421c0804,
+0x421d0804,
+0x421e0804,
+0x421f0804,
+0x42200804,
+0x42210804,
+0x42220804,
+0x42230804,
+0x42230808,
+0x42240804,
+0x42240808,
+0x42250804,
+0x42260804,
+0x42260808,
+0x42270804,
+0x42280804,
+0x42290804,
+0x422a0804,
+0x422b0804,
+0x422c0804,
+0x422d0804,
+0x422e0804,
+0x422f0804,
+0x42300804,
+0x42300808,
+0x42310804,
+0x42320804,
+0x42330804,
+0x42330808,
+0x42340804,
+0x42350804,
+0x42360804,
+0x42370804,
+0x42380804,
+0x42390804,
+0x423a0804,
+0x423b0804,
+0x423c0804,
+0x423d0804,
+0x423e0804,
+0x423f0804,
+0x42400804,
+0x42410804,
+0x42420804,
+0x42430804,
+0x42440804,
+0x42450804,
+0x42460804,
+0x42470804,
+0x42480804,
+0x42490804,
+0x424a0804,
+0x424b0804,
+0x424c0804,
+0x424d0804,
+0x424e0804,
+0x424f0804,
+0x42500804,
+0x42510804,
+0x42520804,
+0x42530804,
+0x42530808,
+0x42530824,
+0x42540804,
+0x42550804,
+0x42550808,
+0x42550824,
+0x42560804,
+0x42560808,
+0x42560824,
+0x42570804,
+0x42580804,
+0x42590804,
+0x42590808,
+0x42590824,
+0x425a0804,
+0x425a0808,
+0x425a0824,
+0x425b0804,
+0x425b0808,
+0x425b0824,
+0x425c0804,
+0x425c0808,
+0x425c0824,
+0x425d0804,
+0x425d0808,
+0x425d0824,
+0x425e0804,
+0x425e0808,
+0x425e0824,
+0x425f0804,
+0x42600804,
+0x42610804,
+0x42620804,
+0x42630804,
+0x42640804,
+0x42650804,
+0x42660804,
+0x42670804,
+0x42680804,
+0x42690804,
+0x426a0804,
+0x426b0804,
+0x426c0804,
+0x426d0804,
+0x426e0804,
+0x426f0804,
+0x42700804,
+0x42700808,
+0x42710804,
+0x42710808,
+0x42720804,
+0x42730804,
+0x42740804,
+0x42750804,
+0x42750808,
+0x42760804,
+0x42770804,
+0x42770808,
+0x42780804,
+0x42790804,
+0x427a0804,
+0x427b0804,
+0x427c0804,
+0x427c0808,
+0x427d0804,
+0x427e0804,
+0x427f0804,
+0x42800804,
+0x42800808,
+0x42810804,
+0x42820804,
+0x42820808,
+0x42830804,
+0x42840804,
+0x42850804,
+0x42860804,
+0x42860808,
+0x42870804,
+0x42880804,
+0x42880808,
+0x42890804,
+0x428a0804,
+0x428b0804,
+0x428c0804,
+0x428d0804,
+0x428e0804,
+0x428f0804,
+0x42900804,
+0x42910804,
+0x42920804,
+0x42930804,
+0x42940804,
+0x42950804,
+0x42960804,
+0x42970804,
+0x42980804,
+0x42990804,
+0x429a0804,
+0x429a0808,
+0x429b0804,
+0x429b0808,
+0x429c0804,
+0x429d0804,
+0x429e0804,
+0x429f0804,
+0x42a00804,
+0x42a10804,
+0x42a20804,
+0x42a30804,
+0x42a40804,
+0x42a50804,
+0x42a60804,
+0x42a70804,
+0x42a80804,
+0x42a90804,
+0x42aa0804,
+0x42ab0804,
+0x42ac0804,
+0x42ad0804,
+0x42ae0804,
+0x42af0804,
+0x42b00804,
+0x42b10804,
+0x42b20804,
+0x42b30804,
+0x42b40804,
+0x42b50804,
+0x42b60804,
+0x42b70804,
+0x42b80804,
+0x42b90804,
+0x42ba0804,
+0x42bb0804,
+0x42bc0804,
+0x42bd0804,
+0x42be0804,
+0x42bf0804,
+0x42c00804,
+0x42c10804,
+0x42c20804,
+0x42c30804,
+0x42c40804,
+0x42c50804,
+0x42c60804,
+0x42c70804,
+0x42c80804,
+0x42c90804,
+0x42ca0804,
+0x42cb0804,
+0x42cc0804,
+0x42cd0804,
+0x42ce0804,
+0x42cf0804,
+0x42d00804,
+0x42d10804,
+0x42d20804,
+0x42d30804,
+0x42d40804,
+0x42d50804,
+0x42d60804,
+0x42d70804,
+0x42d80804,
+0x42d90804,
+0x42da081a,
+0x42da081c,
+0x42da081e,
+0x42da0820,
+0x42da0822,
+0x42da0824,
+0x42da0826,
+0x42da0838,
+0x1f600838,
+0x43030838,
+0x42da0838,
+0x42f40838,
+0xe38,
+0x1f600838,
+0x42ee0838,
+0x42da0838,
+0x43030838,
+0x42f60838,
+0x42da0838,
+0x42da0838,
+0x430a0838,
+0x42f70838,
+0xe38,
+0x42da0838,
+0x42db081a,
+0x42db081c,
+0x42db081e,
+0x42db0820,
+0x42db0822,
+0x42db0824,
+0x42db0826,
+0x42db0838,
+0x42f00838,
+0x430a0838,
+0x42e20838,
+0xdf8,
+0x42db0838,
+0x430a0838,
+0x42eb0838,
+0x42dc081a,
+0x42dc081c,
+0x42dc081e,
+0x42dc0820,
+0x42dc0822,
+0x42dc0824,
+0x42dc0826,
+0x42dc081c,
+0xdc4,
+0x42dc0822,
+0xdc4,
+0x42dc0838,
+0x42df0838,
+0x430a0838,
+0x42dd0822,
+0x42de081a,
+0x42de081c,
+0x42de081e,
+0x42de0820,
+0x42de0822,
+0x42de0824,
+0x42de0826,
+0x42de0838,
+0x1f600838,
+0x42e00838,
+0x1f600838,
+0x42de0838,
+0x42e70838,
+0x42e20838,
+0x1f600838,
+0x42ee0838,
+0xdf8,
+0x42df081a,
+0x42df081c,
+0x42df081e,
+0x42df0820,
+0x42df0822,
+0x42df0824,
+0x42df0826,
+0x42df0838,
+0x1f600838,
+0x42fb0838,
+0x42df0838,
+0x430a0838,
+0x42e70838,
+0x42e0081a,
+0x42e0081c,
+0x42e0081e,
+0x42e00822,
+0x42e00824,
+0x42e00826,
+0x42e0081c,
+0xdc4,
+0x42e00822,
+0xdc4,
+0x42e00838,
+0x42db0838,
+0x43020838,
+0x42e00838,
+0x43010838,
+0x42ec0838,
+0x42ee0838,
+0x42e00838,
+0x43050838,
+0x43020838,
+0x1f600838,
+0x42e00838,
+0xdf8,
+0x43050838,
+0x430a0838,
+0x42e00838,
+0xdf8,
+0x430a0838,
+0x42f90838,
+0x42e1081c,
+0x42e10822,
+0x42e10824,
+0x42e10826,
+0x42e1081c,
+0xdc4,
+0x42e10822,
+0xdc4,
+0x42e10838,
+0xdf8,
+0x42e00838,
+0xdf8,
+0x42e10838,
+0xdf8,
+0x42f00838,
+0x1f600838,
+0x42e10838,
+0x42ff0838,
+0x43020838,
+0x1f600838,
+0x42e10838,
+0xdf8,
+0x43030838,
+0x42ea0838,
+0xdf8,
+0x1f600838,
+0x42e10838,
+0x43050838,
+0x42e10838,
+0x43050838,
+0x42e20838,
+0xdf8,
+0x43010838,
+0x42fb0838,
+0x42e10838,
+0x43050838,
+0x42fc0838,
+0x1f600838,
+0x42ee0838,
+0x43030838,
+0x42e10838,
+0x43050838,
+0x43060838,
+0x42ec0838,
+0x42ee0838,
+0x42e2081c,
+0x42e2081e,
+0x42e20822,
+0x42e20824,
+0x42e20826,
+0x42e2081c,
+0xdc4,
+0x42e20822,
+0xdc4,
+0x42e20838,
+0xdf8,
+0x43010838,
+0x42fb0838,
+0x42e20838,
+0xdf8,
+0x43010838,
+0x42fb0838,
+0x42ee0838,
+0x430a0838,
+0x42e20838,
+0x43030838,
+0x42e80838,
+0xdf8,
+0x42db0838,
+0x43050838,
+0x42e20838,
+0x43050838,
+0x1f600838,
+0x42f20838,
+0x42e3081a,
+0x42e3081c,
+0x42e3081e,
+0x42e30822,
+0x42e30824,
+0x42e30826,
+0x42e3081c,
+0xdc4,
+0x42e30822,
+0xdc4,
+0x42e30838,
+0x1f600838,
+0x42e70838,
+0x42e4081c,
+0x42e40822,
+0x42e40824,
+0x42e40826,
+0x42e4081c,
+0xdc4,
+0x42e40822,
+0xdc4,
+0x42e40838,
+0x1f600838,
+0x42f80838,
+0xe38,
+0x42e40838,
+0x42e40838,
+0x42e4082c,
+0x42ee082c,
+0x42e40838,
+0x43030838,
+0x42ef0838,
+0x42e5081c,
+0x42e50822,
+0x42e50824,
+0x42e50826,
+0x42e50838,
+0x42e5081c,
+0xdc4,
+0x42e50822,
+0xdc4,
+0x42e50838,
+0x42db0838,
+0x42e20838,
+0x43030838,
+0x42e50838,
+0x430a0838,
+0x42eb0838,
+0x1f600838,
+0x42fb0838,
+0x42e6081c,
+0x42e6081e,
+0x42e60822,
+0x42e60824,
+0x42e60826,
+0x42e6081c,
+0xdc4,
+0x42e60822,
+0xdc4,
+0x42e60808,
+0x42fc0808,
+0x42e60838,
+0x43020838,
+0x430a0838,
+0x42e20838,
+0xdf8,
+0x42e7081c,
+0x42e7081e,
+0x42e70822,
+0x42e70824,
+0x42e70826,
+0x42e7081c,
+0xdc4,
+0x42e70822,
+0xdc4,
+0x42e8081c,
+0x42e80822,
+0x42e80824,
+0x42e80826,
+0x42e8081c,
+0xdc4,
+0x42e80822,
+0xdc4,
+0x42e80838,
+0x430a0838,
+0x42eb0838,
+0x42e80838,
+0x430a0838,
+0x42ee0838,
+0x42e9081c,
+0x42e90822,
+0x42e90824,
+0x42e90826,
+0x42e9081c,
+0xdc4,
+0x42e90822,
+0xdc4,
+0x42ea081c,
+0x42ea0822,
+0x42ea0824,
+0x42ea0826,
+0x42ea081c,
+0xdc4,
+0x42ea0822,
+0xdc4,
+0x42ea0838,
+0xdf8,
+0x1f600838,
+0x42e70838,
+0x42eb081c,
+0x42eb0822,
+0x42eb0824,
+0x42eb0826,
+0x42eb081c,
+0xdc4,
+0x42eb0822,
+0xdc4,
+0x42ec081a,
+0x42ec081c,
+0x42ec081e,
+0x42ec0820,
+0x42ec0822,
+0x42ec0824,
+0x42ec0826,
+0x42ec081c,
+0xdc4,
+0x42ec0822,
+0xdc4,
+0x42ed081c,
+0x42ed0822,
+0x42ed0824,
+0x42ed0826,
+0x42ed081c,
+0xdc4,
+0x42ed0822,
+0xdc4,
+0x42ed0838,
+0xdf8,
+0x42ed0838,
+0xdf8,
+0x42e60838,
+0x42ee081c,
+0x42ee081e,
+0x42ee0822,
+0x42ee0824,
+0x42ee0826,
+0x42ee081c,
+0xdc4,
+0x42ee0822,
+0xdc4,
+0x42ee0838,
+0xdf8,
+0x43030838,
+0x42ee0838,
+0x430a0838,
+0x42ef081c,
+0x42ef0822,
+0x42ef0824,
+0x42ef0826,
+0x42ef0838,
+0x42f30838,
+0x42f0081c,
+0x42f00822,
+0x42f00824,
+0x42f00826,
+0x42f1081c,
+0x42f1081e,
+0x42f10822,
+0x42f10824,
+0x42f10826,
+0x42f2081c,
+0x42f20822,
+0x42f20824,
+0x42f20826,
+0x42f3081c,
+0x42f30822,
+0x42f30824,
+0x42f30826,
+0x42f30838,
+0x42ec0838,
+0x42ee0838,
+0x42f4081c,
+0x42f4081e,
+0x42f40822,
+0x42f40824,
+0x42f40826,
+0x42f4081c,
+0xdc4,
+0x42f40822,
+0xdc4,
+0x42f4081c,
+0xe04,
+0x42f40822,
+0xe04,
+0x42f40838,
+0xe38,
+0x1f600838,
+0x42e80838,
+0x430a0838,
+0x42ee0838,
+0x42f40838,
+0xe38,
+0x1f600838,
+0x42ec0838,
+0x42f40838,
+0xdf8,
+0x1f600838,
+0x43040838,
+0x43030838,
+0x42f40838,
+0x42db0838,
+0x42ec0838,
+0x42f5081c,
+0x42f5081e,
+0x42f50822,
+0x42f50824,
+0x42f50826,
+0x42f5081c,
+0xdc4,
+0x42f50822,
+0xdc4,
+0x42f5081c,
+0xe04,
+0x42f50822,
+0xe04,
+0x42f50838,
+0xe38,
+0x42da0838,
+0x42e70838,
+0x42ee0838,
+0x43030838,
+0x42f50838,
+0xe38,
+0x42e20838,
+0x43030838,
+0x42f50838,
+0xe38,
+0x42e40838,
+0x42f50838,
+0xdf8,
+0x43030838,
+0x42f6081c,
+0x42f6081e,
+0x42f60822,
+0x42f60824,
+0x42f60826,
+0x42f6081c,
+0xdc4,
+0x42f60822,
+0xdc4,
+0x42f6081c,
+0xe04,
+0x42f60822,
+0xe04,
+0x42f60838,
+0x42da0838,
+0x43010838,
+0x42ec0838,
+0x42ee0838,
+0xdf8,
+0x42f60838,
+0x42db0838,
+0x1f600838,
+0x42ee0838,
+0x42f60838,
+0xdf8,
+0x42ec0838,
+0x42e60838,
+0x42de0838,
+0x43030838,
+0x42f60838,
+0x43010838,
+0x430a0838,
+0x42f7081c,
+0x42f7081e,
+0x42f70822,
+0x42f70824,
+0x42f70826,
+0x42f7081c,
+0xdc4,
+0x42f70822,
+0xdc4,
+0x42f7081c,
+0xe04,
+0x42f70822,
+0xe04,
+0x42f70838,
+0xe38,
+0x1f600838,
+0x42e60838,
+0xdf8,
+0x42f70838,
+0xdf8,
+0x1f600838,
+0x42ea0838,
+0x42f70838,
+0x42e20838,
+0x42ea0838,
+0x1f600838,
+0x43030838,
+0x42f70838,
+0xe38,
+0x42e90838,
+0x42f70838,
+0xe38,
+0x42f00838,
+0x42f50838,
+0x42f70838,
+0x43030838,
+0x42ec0838,
+0x42f70838,
+0xe38,
+0x430a0838,
+0x42e70838,
+0x42f8081c,
+0x42f8081e,
+0x42f80822,
+0x42f80824,
+0x42f80826,
+0x42f8081c,
+0xdc4,
+0x42f80822,
+0xdc4,
+0x42f8081c,
+0xe04,
+0x42f80822,
+0xe04,
+0x42f80838,
+0x1f600838,
+0x43030838,
+0x42f80838,
+0x1f600838,
+0x430a0838,
+0x42f80838,
+0xe38,
+0x42db0838,
+0x430a0838,
+0x42ee0838,
+0x42f80838,
+0x42e00838,
+0x42f80838,
+0xdf8,
+0x43030838,
+0x42ee0838,
+0x42f80838,
+0x430a0838,
+0x42f80838,
+0xe38,
+0x430a0838,
+0x42ee0838,
+0xdf8,
+0x42f9081c,
+0x42f90822,
+0x42f90824,
+0x42f90826,
+0x42f90838,
+0x42db0838,
+0x42e20838,
+0x43050838,
+0x42f90838,
+0x42db0838,
+0x43030838,
+0x42f90808,
+0x42e70808,
+0x42f90838,
+0x42ec0838,
+0x42f40838,
+0x42f90838,
+0x43030838,
+0x42e20838,
+0x42f90838,
+0x430a0838,
+0x42e60838,
+0x43000838,
+0x430a0838,
+0x42fa081c,
+0x42fa0822,
+0x42fa0824,
+0x42fa0826,
+0x42fa0838,
+0x42e20838,
+0x43050838,
+0x430a0838,
+0x42fa0838,
+0x43020838,
+0x42fa0838,
+0x43020838,
+0x42f40838,
+0xdf8,
+0x1f600838,
+0x43030838,
+0x42fb081c,
+0x42fb081e,
+0x42fb0822,
+0x42fb0824,
+0x42fb0826,
+0x42fc081c,
+0x42fc0822,
+0x42fc0824,
+0x42fc0826,
+0x42fc0838,
+0x1f600838,
+0x42ee0838,
+0x43030838,
+0x42fc0838,
+0x42e00838,
+0xdf8,
+0x42fc0838,
+0x42e00838,
+0xdf8,
+0x42ee0838,
+0x430a0838,
+0x42fd081c,
+0x42fd0822,
+0x42fd0824,
+0x42fd0826,
+0x42fe081a,
+0x42fe081c,
+0x42fe081e,
+0x42fe0820,
+0x42fe0822,
+0x42fe0824,
+0x42fe0826,
+0x42fe0838,
+0x1f600838,
+0x42ee0838,
+0xdf8,
+0x42fe0838,
+0x1f600838,
+0x43030838,
+0x42ff081a,
+0x42ff081c,
+0x42ff081e,
+0x42ff0820,
+0x42ff0822,
+0x42ff0824,
+0x42ff0826,
+0x42ff0838,
+0x42da0838,
+0x430a0838,
+0x4300081a,
+0x4300081c,
+0x4300081e,
+0x43000820,
+0x43000822,
+0x43000824,
+0x43000826,
+0x4300082c,
+0x4302082c,
+0x4301081c,
+0x4301081e,
+0x43010822,
+0x43010824,
+0x43010826,
+0x4302081c,
+0x4302081e,
+0x43020822,
+0x43020824,
+0x43020826,
+0x43020838,
+0x42ec0838,
+0x42ee0838,
+0x43030838,
+0x43020838,
+0x43010838,
+0x4303081c,
+0x4303081e,
+0x43030822,
+0x43030824,
+0x43030826,
+0x43030838,
+0x1f600838,
+0x42f60838,
+0xdf8,
+0x43030838,
+0x43030838,
+0x42f50838,
+0xe38,
+0x1f600838,
+0x4304081c,
+0x4304081e,
+0x43040822,
+0x43040824,
+0x43040826,
+0x43040838,
+0x42fb0838,
+0x43040838,
+0x430a0838,
+0x42ee0838,
+0x42e30838,
+0xdf8,
+0x430a0838,
+0x4305081c,
+0x4305081e,
+0x43050822,
+0x43050824,
+0x43050826,
+0x4306081a,
+0x4306081c,
+0x4306081e,
+0x43060822,
+0x43060824,
+0x43060826,
+0x43060822,
+0xdc4,
+0x43060838,
+0x42ec0838,
+0x42ee0838,
+0x4307081c,
+0x43070822,
+0x43070826,
+0x43070822,
+0xdc4,
+0x4308081c,
+0x43080822,
+0x43080826,
+0x43080822,
+0xdc4,
+0x4309081c,
+0x43090822,
+0x43090824,
+0x43090826,
+0x43090822,
+0xdc4,
+0x430a081c,
+0x430a0822,
+0x430a0824,
+0x43180804,
+0x44290804,
+0x44290808,
+0x4648,
+0x442a0804,
+0x442a0832,
+0x442b0804,
+0x442c0804,
+0x442d0804,
+0x442e0804,
+0x442f0804,
+0x44300804,
+0x44300832,
+0x44310804,
+0x44330804,
+0x44340804,
+0x44340808,
+0x4648,
+0x44350804,
+0x44350832,
+0x44360804,
+0x44370804,
+0x44380804,
+0x44380832,
+0x44390804,
+0x44390808,
+0x4648,
+0x443a0804,
+0x443b0804,
+0x443c0804,
+0x443f0804,
+0x44400804,
+0x44410804,
+0x44420804,
+0x44430804,
+0x44430808,
+0x4648,
+0x44440804,
+0x44450804,
+0x44460804,
+0x44470804,
+0x44480804,
+0x44490804,
+0x44490808,
+0x4648,
+0x444a0804,
+0x444a0808,
+0x4648,
+0x444b0804,
+0x444c0804,
+0x444d0804,
+0x444e0804,
+0x444e0808,
+0x4648,
+0x444f0804,
+0x444f0808,
+0x4648,
+0x44500804,
+0x44510804,
+0x44510808,
+0x4648,
+0x44520804,
+0x44530804,
+0x44540804,
+0x44550804,
+0x44560804,
+0x44570804,
+0x44580804,
+0x44590804,
+0x445a0804,
+0x445b0804,
+0x445b0808,
+0x4648,
+0x445b082c,
+0x466c,
+0x445c0804,
+0x445c0808,
+0x4648,
+0x445c0808,
+0x4688,
+0x445d0804,
+0x445e0804,
+0x44610804,
+0x44620804,
+0x44630804,
+0x44640804,
+0x44650804,
+0x44660804,
+0x44670804,
+0x44680804,
+0x44690804,
+0x446a0804,
+0x446b0804,
+0x446c0804,
+0x446d0804,
+0x446e0804,
+0x446f0804,
+0x44700804,
+0x44710804,
+0x44720804,
+0x44730804,
+0x44740804,
+0x44750804,
+0x44760804,
+0x44770804,
+0x44780804,
+0x44790804,
+0x447a0804,
+0x447b0804,
+0x447c0804,
+0x447d0804,
+0x447e0804,
+0x447f0804,
+0x44800804,
+0x44810804,
+0x44820804,
+0x44830804,
+0x44840804,
+0x44850804,
+0x44860804,
+0x44870804,
+0x44880804,
+0x44890804,
+0x448a0804,
+0x448b0804,
+0x448c0804,
+0x448d0804,
+0x448e0804,
+0x448f0804,
+0x44900804,
+0x44910804,
+0x44920804,
+0x44930804,
+0x44940804,
+0x44950804,
+0x44960804,
+0x44970804,
+0x44980804,
+0x44990804,
+0x449a0804,
+0x449b0804,
+0x449c0804,
+0x449d0804,
+0x449e0804,
+0x449f0804,
+0x44a00804,
+0x44a10804,
+0x44a20804,
+0x44a30804,
+0x44a40804,
+0x44a50804,
+0x44a60804,
+0x44a70804,
+0x44a80804,
+0x44a90804,
+0x44aa0804,
+0x44ab0804,
+0x44ac0804,
+0x44ad0804,
+0x44ae0804,
+0x44af0804,
+0x44b00804,
+0x44b10804,
+0x44b20804,
+0x44b30804,
+0x44b40804,
+0x44b50804,
+0x44b60804,
+0x44b70804,
+0x44b80804,
+0x44b90804,
+0x44ba0804,
+0x44bb0804,
+0x44bc0804,
+0x44bd0804,
+0x44be0804,
+0x44bf0804,
+0x44c00804,
+0x44c10804,
+0x44c20804,
+0x44c30804,
+0x44c40804,
+0x44c50804,
+0x44c60804,
+0x44c70804,
+0x44c80804,
+0x44c90804,
+0x44ca0804,
+0x44cb0804,
+0x44cc0804,
+0x44cd0804,
+0x44ce0804,
+0x44cf0804,
+0x44d00804,
+0x44d10804,
+0x44d20804,
+0x44d30804,
+0x44d40804,
+0x44d50804,
+0x44d60804,
+0x44d70804,
+0x44d80804,
+0x44d90804,
+0x44da0804,
+0x44db0804,
+0x44dc0804,
+0x44dd0804,
+0x44de0804,
+0x44df0804,
+0x44e00804,
+0x44e10804,
+0x44e20804,
+0x44e30804,
+0x44e40804,
+0x44e50804,
+0x44e60804,
+0x44e70804,
+0x44e80804,
+0x44e90804,
+0x44ea0804,
+0x44eb0804,
+0x44ec0804,
+0x44ed0804,
+0x44ee0804,
+0x44ef0804,
+0x44f00804,
+0x44f10804,
+0x44f20804,
+0x44f30804,
+0x44f40804,
+0x44f50804,
+0x44f60804,
+0x44f70804,
+0x44f80804,
+0x44f90804,
+0x44fa0804,
+0x44fb0804,
+0x44fc0804,
+0x44fd0804,
+0x44fe0804,
+0x44ff0804,
+0x45000804,
+0x45010804,
+0x45020804,
+0x45030804,
+0x45040804,
+0x45050804,
+0x45060804,
+0x45070804,
+0x45080804,
+0x45090804,
+0x450a0804,
+0x450b0804,
+0x450c0804,
+0x450d0804,
+0x450e0804,
+0x450f0804,
+0x45100804,
+0x45110804,
+0x45120804,
+0x45130804,
+0x45140804,
+0x45150804,
+0x45160804,
+0x45170804,
+0x45180804,
+0x45190804,
+0x451a0804,
+0x451b0804,
+0x451c0804,
+0x451d0804,
+0x451e0804,
+0x451f0804,
+0x45200804,
+0x45210804,
+0x45220804,
+0x45230804,
+0x45240804,
+0x45250804,
+0x45260804,
+0x45270804,
+0x45280804,
+0x45290804,
+0x452a0804,
+0x452b0804,
+0x452c0804,
+0x452d0804,
+0x452e0804,
+0x452f0804,
+0x45300804,
+0x45310804,
+0x45320804,
+0x45330804,
+0x45340804,
+0x45350804,
+0x45360804,
+0x45370804,
+0x45380804,
+0x45390804,
+0x453a0804,
+0x453b0804,
+0x453c0804,
+0x453d0804,
+0x453e0804,
+0x453f0804,
+0x45400804,
+0x45410804,
+0x45420804,
+0x45430804,
+0x45440804,
+0x45450804,
+0x45460804,
+0x45470804,
+0x45480804,
+0x45490804,
+0x454a0804,
+0x454b0804,
+0x454c0804,
+0x454d0804,
+0x454e0804,
+0x454f0804,
+0x45500804,
+0x45510804,
+0x45520804,
+0x45530804,
+0x45540804,
+0x45550804,
+0x45560804,
+0x45570804,
+0x45580804,
+0x45590804,
+0x455a0804,
+0x455b0804,
+0x455c0804,
+0x455d0804,
+0x455e0804,
+0x455f0804,
+0x45600804,
+0x45610804,
+0x45620804,
+0x45630804,
+0x45640804,
+0x45650804,
+0x45660804,
+0x45670804,
+0x45680804,
+0x45690804,
+0x456a0804,
+0x456b0804,
+0x456c0804,
+0x456d0804,
+0x456e0804,
+0x456f0804,
+0x45700804,
+0x45710804,
+0x45720804,
+0x45730804,
+0x45740804,
+0x45750804,
+0x45760804,
+0x45770804,
+0x45780804,
+0x45790804,
+0x457a0804,
+0x457b0804,
+0x457c0804,
+0x457d0804,
+0x457e0804,
+0x457f0804,
+0x45800804,
+0x45810804,
+0x45820804,
+0x45830804,
+0x45840804,
+0x45850804,
+0x45860804,
+0x45870804,
+0x45880804,
+0x45890804,
+0x458a0804,
+0x458b0804,
+0x458c0804,
+0x458d0804,
+0x458e0804,
+0x458f0804,
+0x45900804,
+0x45910804,
+0x45920804,
+0x45930804,
+0x45940804,
+0x45950804,
+0x45960804,
+0x45970804,
+0x45980804,
+0x45990804,
+0x459a0804,
+0x459b0804,
+0x459c0804,
+0x459d0804,
+0x459e0804,
+0x459f0804,
+0x45a00804,
+0x45a10804,
+0x45a20804,
+0x45a30804,
+0x45a40804,
+0x45a50804,
+0x45a60804,
+0x45a70804,
+0x45a80804,
+0x45a90804,
+0x45aa0804,
+0x45ab0804,
+0x45ac0804,
+0x45ad0804,
+0x45ae0804,
+0x45af0804,
+0x45b00804,
+0x45b10804,
+0x45b20804,
+0x45b30804,
+0x45b40804,
+0x45b50804,
+0x45b60804,
+0x45b70804,
+0x45b80804,
+0x45b90804,
+0x45ba0804,
+0x45bb0804,
+0x45bc0804,
+0x45bd0804,
+0x45be0804,
+0x45bf0804,
+0x45c00804,
+0x45c10804,
+0x45c20804,
+0x45c30804,
+0x45c40804,
+0x45c50804,
+0x45c60804,
+0x45c70804,
+0x45c80804,
+0x45c90804,
+0x45ca0804,
+0x45cb0804,
+0x45cc0804,
+0x45cd0804,
+0x45ce0804,
+0x45cf0804,
+0x45d00804,
+0x45d10804,
+0x45d20804,
+0x45d30804,
+0x45d40804,
+0x45d50804,
+0x45d60804,
+0x45d70804,
+0x45d80804,
+0x45d90804,
+0x45da0804,
+0x45db0804,
+0x45dc0804,
+0x45dd0804,
+0x45de0804,
+0x45df0804,
+0x45e00804,
+0x45e10804,
+0x45e20804,
+0x45e30804,
+0x45e40804,
+0x45e50804,
+0x45e60804,
+0x45e70804,
+0x45e80804,
+0x45e90804,
+0x45ea0804,
+0x45eb0804,
+0x45ec0804,
+0x45ed0804,
+0x45ee0804,
+0x45ef0804,
+0x45f00804,
+0x45f10804,
+0x45f20804,
+0x45f30804,
+0x45f40804,
+0x45f50804,
+0x45f60804,
+0x45f70804,
+0x45f80804,
+0x45f90804,
+0x45fa0804,
+0x45fb0804,
+0x45fc0804,
+0x45fd0804,
+0x45fe0804,
+0x45ff0804,
+0x46000804,
+0x46010804,
+0x46020804,
+0x46030804,
+0x46040804,
+0x46050804,
+0x46060804,
+0x46070804,
+0x46080804,
+0x46090804,
+0x460a0804,
+0x460b0804,
+0x460c0804,
+0x460d0804,
+0x460e0804,
+0x460f0804,
+0x46100804,
+0x46110804,
+0x46120804,
+0x46130804,
+0x46140804,
+0x46150804,
+0x46160804,
+0x46170804,
+0x46180804,
+0x46190804,
+0x461a0804,
+0x461b0804,
+0x461c0804,
+0x461d0804,
+0x461e0804,
+0x461f0804,
+0x46200804,
+0x46210804,
+0x46220804,
+0x46230804,
+0x46240804,
+0x46250804,
+0x46260804,
+0x46270804,
+0x46280804,
+0x46290804,
+0x462a0804,
+0x462b0804,
+0x462c0804,
+0x462d0804,
+0x462e0804,
+0x462f0804,
+0x46300804,
+0x46310804,
+0x46320804,
+0x46330804,
+0x46340804,
+0x46350804,
+0x46360804,
+0x46370804,
+0x46380804,
+0x46390804,
+0x463a0804,
+0x463b0804,
+0x463c0804,
+0x463d0804,
+0x463e0804,
+0x463f0804,
+0x46400804,
+0x46410804,
+0x46420804,
+0x46430804,
+0x46440804,
+0x46450804,
+0x46460804,
+0x46470804,
+0x46480804,
+0x46490804,
+0x464a0804,
+0x464b0804,
+0x464c0804,
+0x464d0804,
+0x464e0804,
+0x464f0804,
+0x46500804,
+0x46510804,
+0x46520804,
+0x46530804,
+0x46540804,
+0x46550804,
+0x46560804,
+0x46570804,
+0x46580804,
+0x46590804,
+0x465a0804,
+0x465b0804,
+0x465c0804,
+0x465d0804,
+0x465e0804,
+0x465f0804,
+0x46600804,
+0x46610804,
+0x46620804,
+0x46630804,
+0x46640804,
+0x46650804,
+0x46660804,
+0x46670804,
+0x46680804,
+0x46690804,
+0x466a0804,
+0x466b0804,
+0x466c0804,
+0x466d0804,
+0x466e0804,
+0x466f0804,
+0x46700804,
+0x46710804,
+0x46720804,
+0x46730804,
+0x46740804,
+0x46750804,
+0x46760804,
+0x46770804,
+0x46780804,
+0x46790804,
+0x467a0804,
+0x467b0804,
+0x467c0804,
+0x467d0804,
+0x467e0804,
+0x467f0804,
+0x46800804,
+0x46810804,
+0x46820804,
+0x46830804,
+0x46840804,
+0x46850804,
+0x46860804,
+0x46870804,
+0x46880804,
+0x46890804,
+0x468a0804,
+0x468b0804,
+0x468c0804,
+0x468d0804,
+0x468e0804,
+0x468f0804,
+0x46900804,
+0x46910804,
+0x46920804,
+0x46930804,
+0x46940804,
+0x46950804,
+0x46960804,
+0x46970804,
+0x46980804,
+0x46990804,
+0x469a0804,
+0x469b0804,
+0x469c0804,
+0x469d0804,
+0x469e0804,
+0x469f0804,
+0x46a00804,
+0x46a10804,
+0x46a20804,
+0x46a30804,
+0x46a40804,
+0x46a50804,
+0x46a60804,
+0x46a70804,
+0x46a80804,
+0x46a90804,
+0x46aa0804,
+0x46ab0804,
+0x46ac0804,
+0x46ad0804,
+0x46ae0804,
+0x46af0804,
+0x46b00804,
+0x46b10804,
+0x46b20804,
+0x46b30804,
+0x46b40804,
+0x46b50804,
+0x46b60804,
+0x46b70804,
+0x46b80804,
+0x46b90804,
+0x46ba0804,
+0x46bb0804,
+0x46bc0804,
+0x46bd0804,
+0x46be0804,
+0x46bf0804,
+0x46c00804,
+0x46c10804,
+0x46c20804,
+0x46c30804,
+0x46c40804,
+0x46c50804,
+0x46c60804,
+0x46c70804,
+0x46c80804,
+0x46c90804,
+0x46ca0804,
+0x46cb0804,
+0x46cc0804,
+0x46cd0804,
+0x46ce0804,
+0x46cf0804,
+0x46d00804,
+0x46d10804,
+0x46d20804,
+0x46d30804,
+0x46d40804,
+0x46d50804,
+0x46d60804,
+0x46d70804,
+0x46d80804,
+0x46d90804,
+0x46da0804,
+0x46db0804,
+0x46dc0804,
+0x46dd0804,
+0x46de0804,
+0x46df0804,
+0x46e00804,
+0x46e10804,
+0x46e20804,
+0x46e30804,
+0x46e40804,
+0x46e50804,
+0x46e60804,
+0x46e70804,
+0x46e80804,
+0x46e90804,
+0x46ea0804,
+0x46eb0804,
+0x46ec0804,
+0x46ed0804,
+0x46ee0804,
+0x46ef0804,
+0x46f00804,
+0x46f10804,
+0x46f20804,
+0x46f30804,
+0x46f40804,
+0x46f50804,
+0x46f60804,
+0x46f70804,
+0x46f80804,
+0x46f90804,
+0x46fa0804,
+0x46fb0804,
+0x46fc0804,
+0x46fd0804,
+0x46fe0804,
+0x46ff0804,
+0x47000804,
+0x47010804,
+0x47020804,
+0x47030804,
+0x47040804,
+0x47050804,
+0x47060804,
+0x47070804,
+0x47080804,
+0x47090804,
+0x470a0804,
+0x470b0804,
+0x470c0804,
+0x470d0804,
+0x470e0804,
+0x470f0804,
+0x47100804,
+0x47110804,
+0x47120804,
+0x47130804,
+0x47140804,
+0x47150804,
+0x47160804,
+0x47170804,
+0x47180804,
+0x47190804,
+0x471a0804,
+0x471b0804,
+0x471c0804,
+0x471d0804,
+0x471e0804,
+0x471f0804,
+0x47200804,
+0x47210804,
+0x47220804,
+0x47230804,
+0x47240804,
+0x47250804,
+0x47260804,
+0x47270804,
+0x47280804,
+0x47290804,
+0x472a0804,
+0x472b0804,
+0x472c0804,
+0x472d0804,
+0x472e0804,
+0x472f0804,
+0x47300804,
+0x47310804,
+0x47320804,
+0x47330804,
+0x47340804,
+0x47350804,
+0x47360804,
+0x47370804,
+0x47380804,
+0x47390804,
+0x473a0804,
+0x473b0804,
+0x473c0804,
+0x473d0804,
+0x473e0804,
+0x473f0804,
+0x47400804,
+0x47410804,
+0x47420804,
+0x47430804,
+0x47440804,
+0x47450804,
+0x47460804,
+0x47470804,
+0x47480804,
+0x47490804,
+0x474a0804,
+0x474b0804,
+0x474c0804,
+0x474d0804,
+0x474e0804,
+0x474f0804,
+0x47500804,
+0x47510804,
+0x47520804,
+0x47530804,
+0x47540804,
+0x47550804,
+0x47560804,
+0x47570804,
+0x47580804,
+0x47590804,
+0x475a0804,
+0x475b0804,
+0x475c0804,
+0x475d0804,
+0x475e0804,
+0x475f0804,
+0x47600804,
+0x47610804,
+0x47620804,
+0x47630804,
+0x47640804,
+0x47650804,
+0x47660804,
+0x47670804,
+0x47680804,
+0x47690804,
+0x476a0804,
+0x476b0804,
+0x476c0804,
+0x476d0804,
+0x476e0804,
+0x476f0804,
+0x47700804,
+0x47710804,
+0x47720804,
+0x47730804,
+0x47740804,
+0x47750804,
+0x47760804,
+0x47770804,
+0x47780804,
+0x47790804,
+0x477a0804,
+0x477b0804,
+0x477c0804,
+0x477d0804,
+0x477e0804,
+0x477f0804,
+0x47800804,
+0x47810804,
+0x47820804,
+0x47830804,
+0x47840804,
+0x47850804,
+0x47860804,
+0x47870804,
+0x47880804,
+0x47890804,
+0x478a0804,
+0x478b0804,
+0x478c0804,
+0x478d0804,
+0x478e0804,
+0x478f0804,
+0x47900804,
+0x47910804,
+0x47920804,
+0x47930804,
+0x47940804,
+0x47950804,
+0x47960804,
+0x47970804,
+0x47980804,
+0x47990804,
+0x479a0804,
+0x479b0804,
+0x479c0804,
+0x479d0804,
+0x479e0804,
+0x479f0804,
+0x47a00804,
+0x47a10804,
+0x47a20804,
+0x47a30804,
+0x47a40804,
+0x47a50804,
+0x47a60804,
+0x47a70804,
+0x47a80804,
+0x47a90804,
+0x47aa0804,
+0x47ab0804,
+0x47ac0804,
+0x47ad0804,
+0x47ae0804,
+0x47af0804,
+0x47b00804,
+0x47b10804,
+0x47b20804,
+0x47b30804,
+0x47b40804,
+0x47b50804,
+0x47b60804,
+0x47b70804,
+0x47b80804,
+0x47b90804,
+0x47ba0804,
+0x47bb0804,
+0x47bc0804,
+0x47bd0804,
+0x47be0804,
+0x47bf0804,
+0x47c00804,
+0x47c10804,
+0x47c20804,
+0x47c30804,
+0x47c40804,
+0x47c50804,
+0x47c60804,
+0x47c70804,
+0x47c80804,
+0x47c90804,
+0x47ca0804,
+0x47cb0804,
+0x47cc0804,
+0x47cd0804,
+0x47ce0804,
+0x47cf0804,
+0x47d00804,
+0x47d10804,
+0x47d20804,
+0x47d30804,
+0x47d40804,
+0x47d50804,
+0x47d60804,
+0x47d70804,
+0x47d80804,
+0x47d90804,
+0x47da0804,
+0x47db0804,
+0x47dc0804,
+0x47dd0804,
+0x47de0804,
+0x47df0804,
+0x47e00804,
+0x47e10804,
+0x47e20804,
+0x47e30804,
+0x47e40804,
+0x47e50804,
+0x47e60804,
+0x47e70804,
+0x47e80804,
+0x47e90804,
+0x47ea0804,
+0x47eb0804,
+0x47ec0804,
+0x47ed0804,
+0x47ee0804,
+0x47ef0804,
+0x47f00804,
+0x47f10804,
+0x47f20804,
+0x47f30804,
+0x47f40804,
+0x47f50804,
+0x47f60804,
+0x47f70804,
+0x47f80804,
+0x47f90804,
+0x47fa0804,
+0x47fb0804,
+0x47fc0804,
+0x47fd0804,
+0x47fe0804,
+0x47ff0804,
+0x48000804,
+0x48010804,
+0x48020804,
+0x48030804,
+0x48040804,
+0x48050804,
+0x48060804,
+0x48070804,
+0x48080804,
+0x48090804,
+0x480a0804,
+0x480b0804,
+0x480c0804,
+0x480d0804,
+0x480e0804,
+0x480f0804,
+0x48100804,
+0x48110804,
+0x48120804,
+0x48130804,
+0x48140804,
+0x48150804,
+0x48160804,
+0x48170804,
+0x48180804,
+0x48190804,
+0x481a0804,
+0x481b0804,
+0x481c0804,
+0x481d0804,
+0x481e0804,
+0x481f0804,
+0x48200804,
+0x48210804,
+0x48220804,
+0x48230804,
+0x48240804,
+0x48250804,
+0x48260804,
+0x48270804,
+0x48280804,
+0x48290804,
+0x482a0804,
+0x482b0804,
+0x482c0804,
+0x482d0804,
+0x482e0804,
+0x482f0804,
+0x48300804,
+0x48310804,
+0x48320804,
+0x48330804,
+0x48340804,
+0x48350804,
+0x48360804,
+0x48370804,
+0x48380804,
+0x48390804,
+0x483a0804,
+0x483b0804,
+0x483c0804,
+0x483d0804,
+0x483e0804,
+0x483f0804,
+0x48400804,
+0x48410804,
+0x48420804,
+0x48430804,
+0x48440804,
+0x48450804,
+0x48460804,
+0x48470804,
+0x48480804,
+0x48490804,
+0x484a0804,
+0x484b0804,
+0x484c0804,
+0x484d0804,
+0x484e0804,
+0x484f0804,
+0x48500804,
+0x48510804,
+0x48520804,
+0x48530804,
+0x48540804,
+0x48550804,
+0x48560804,
+0x48570804,
+0x48580804,
+0x48590804,
+0x485a0804,
+0x485b0804,
+0x485c0804,
+0x485d0804,
+0x485e0804,
+0x485f0804,
+0x48600804,
+0x48610804,
+0x48620804,
+0x48630804,
+0x48640804,
+0x48650804,
+0x48660804,
+0x48670804,
+0x48680804,
+0x48690804,
+0x486a0804,
+0x486b0804,
+0x486c0804,
+0x486d0804,
+0x486e0804,
+0x486f0804,
+0x48700804,
+0x48710804,
+0x48720804,
+0x48730804,
+0x48740804,
+0x48750804,
+0x48760804,
+0x48770804,
+0x48780804,
+0x48790804,
+0x487a0804,
+0x487b0804,
+0x487c0804,
+0x487d0804,
+0x487e0804,
+0x487f0804,
+0x48800804,
+0x48810804,
+0x48820804,
+0x48830804,
+0x48840804,
+0x48850804,
+0x48860804,
+0x48870804,
+0x48880804,
+0x48890804,
+0x488a0804,
+0x488b0804,
+0x488c0804,
+0x488d0804,
+0x488e0804,
+0x488f0804,
+0x48900804,
+0x48910804,
+0x48920804,
+0x48930804,
+0x48940804,
+0x48950804,
+0x48960804,
+0x48970804,
+0x48980804,
+0x48990804,
+0x489a0804,
+0x489b0804,
+0x489c0804,
+0x489d0804,
+0x489e0804,
+0x489f0804,
+0x48a00804,
+0x48a10804,
+0x48a20804,
+0x48a30804,
+0x48a40804,
+0x48a50804,
+0x48a60804,
+0x48a70804,
+0x48a80804,
+0x48a90804,
+0x48aa0804,
+0x48ab0804,
+0x48ac0804,
+0x48ad0804,
+0x48ae0804,
+0x48af0804,
+0x48b00804,
+0x48b10804,
+0x48b20804,
+0x48b30804,
+0x48b40804,
+0x48b50804,
+0x48b60804,
+0x48b70804,
+0x48b80804,
+0x48b90804,
+0x48ba0804,
+0x48bb0804,
+0x48bc0804,
+0x48bd0804,
+0x48be0804,
+0x48bf0804,
+0x48c00804,
+0x48c10804,
+0x48c20804,
+0x48c30804,
+0x48c40804,
+0x48c50804,
+0x48c60804,
+0x48c70804,
+0x48c80804,
+0x48c90804,
+0x48ca0804,
+0x48cb0804,
+0x48cc0804,
+0x48cd0804,
+0x48ce0804,
+0x48cf0804,
+0x48d00804,
+0x48d10804,
+0x48d20804,
+0x48d30804,
+0x48d40804,
+0x48d50804,
+0x48d60804,
+0x48d70804,
+0x48d80804,
+0x48d90804,
+0x48da0804,
+0x48db0804,
+0x48dc0804,
+0x48dd0804,
+0x48de0804,
+0x48df0804,
+0x48e00804,
+0x48e10804,
+0x48e20804,
+0x48e30804,
+0x48e40804,
+0x48e50804,
+0x48e60804,
+0x48e70804,
+0x48e80804,
+0x48e90804,
+0x48ea0804,
+0x48eb0804,
+0x48ec0804,
+0x48ed0804,
+0x48ee0804,
+0x48ef0804,
+0x48f00804,
+0x48f10804,
+0x48f20804,
+0x48f30804,
+0x48f40804,
+0x48f50804,
+0x48f60804,
+0x48f70804,
+0x48f80804,
+0x48f90804,
+0x48fa0804,
+0x48fb0804,
+0x48fc0804,
+0x48fd0804,
+0x48fe0804,
+0x48ff0804,
+0x49000804,
+0x49010804,
+0x49020804,
+0x49030804,
+0x49040804,
+0x49050804,
+0x49060804,
+0x49070804,
+0x49080804,
+0x49090804,
+0x490a0804,
+0x490b0804,
+0x490c0804,
+0x490d0804,
+0x490e0804,
+0x490f0804,
+0x49100804,
+0x49110804,
+0x49130804,
+0x49140804,
+0x49150804,
+0x49160804,
+0x49170804,
+0x49180804,
+0x49190804,
+0x491a0804,
+0x491b0804,
+0x491c0804,
+0x491d0804,
+0x491e0804,
+0x491f0804,
+0x49200804,
+0x49220804,
+0x49220808,
+0x49230804,
+0x49240804,
+0x49250804,
+0x49260804,
+0x49270804,
+0x49280804,
+0x49290804,
+0x492a0804,
+0x492c0804,
+0x492d0804,
+0x492f0804,
+0x492f0808,
+0x49300804,
+0x49310804,
+0x49320804,
+0x49330804,
+0x49340804,
+0x49350804,
+0x49360804,
+0x49370804,
+0x49380804,
+0x49390804,
+0x493a0804,
+0x493b0804,
+0x493c0804,
+0x493d0804,
+0x493e0804,
+0x493f0804,
+0x49400804,
+0x49410804,
+0x49410808,
+0x49420804,
+0x49430804,
+0x49440804,
+0x49450804,
+0x49460804,
+0x49470804,
+0x49480804,
+0x49490804,
+0x494a0804,
+0x494b0804,
+0x494c0804,
+0x494d0804,
+0x494e0804,
+0x494f0804,
+0x49510804,
+0x49530804,
+0x49540804,
+0x49550804,
+0x49560804,
+0x49570804,
+0x49580804,
+0x495a0804,
+0x495b0804,
+0x495c0804,
+0x495d0804,
+0x495d0808,
+0x495e0804,
+0x495f0804,
+0x49600804,
+0x49610804,
+0x49620804,
+0x49630804,
+0x49640804,
+0x49650804,
+0x49660804,
+0x49670804,
+0x49690804,
+0x496a0804,
+0x496b0804,
+0x496c0804,
+0x496d0804,
+0x496f0804,
+0x49700804,
+0x49710804,
+0x49720804,
+0x49740804,
+0x49750804,
+0x49760804,
+0x49770804,
+0x49790804,
+0x497a0804,
+0x497b0804,
+0x497c0804,
+0x497d0804,
+0x497f0804,
+0x49800804,
+0x49810804,
+0x49820804,
+0x49830804,
+0x49840804,
+0x49850804,
+0x49860804,
+0x49890804,
+0x498a0804,
+0x498b0804,
+0x498c0804,
+0x498d0804,
+0x498f0804,
+0x49900804,
+0x49930804,
+0x49940804,
+0x49950804,
+0x49960804,
+0x49970804,
+0x49980804,
+0x49990804,
+0x499a0804,
+0x499b0804,
+0x499c0804,
+0x499d0804,
+0x499e0804,
+0x499f0804,
+0x49a00804,
+0x49a10804,
+0x49a20804,
+0x49a30804,
+0x49a40804,
+0x49a50804,
+0x49a60804,
+0x49a70804,
+0x49a80804,
+0x49a90804,
+0x49aa0804,
+0x49ab0804,
+0x49ac0804,
+0x49ad0804,
+0x49ae0804,
+0x49af0804,
+0x49af0810,
+0x49b00804,
+0x49b00810,
+0x49b10804,
+0x49b10810,
+0x49b20804,
+0x49b20810,
+0x49b30804,
+0x49b30810,
+0x49b40804,
+0x49b40810,
+0x49b50804,
+0x49b50810,
+0x49b60804,
+0x49b60810,
+0x49b70804,
+0x49b70810,
+0x49b80804,
+0x49b80810,
+0x49b90804,
+0x49b90810,
+0x49ba0804,
+0x49ba0810,
+0x49bb0804,
+0x49bb0810,
+0x49bc0804,
+0x49bc0810,
+0x49bd0804,
+0x49bd0810,
+0x49be0804,
+0x49be0810,
+0x49bf0804,
+0x49bf0810,
+0x49c00804,
+0x49c00810,
+0x49c10804,
+0x49c10810,
+0x49c20804,
+0x49c20810,
+0x49c30804,
+0x49c30810,
+0x49c40804,
+0x49c40810,
+0x49c50804,
+0x49c50810,
+0x49c60804,
+0x49c60810,
+0x49c70804,
+0x49c70810,
+0x49c80804,
+0x49c80810,
+0x49c90804,
+0x49c90810,
+0x49ca0804,
+0x49ca0810,
+0x49cb0804,
+0x49cb0810,
+0x49cc0804,
+0x49cc0810,
+0x49cd0804,
+0x49cd0810,
+0x49ce0804,
+0x49ce0810,
+0x49cf0804,
+0x49d00804,
+0x49d10804,
+0x49d20804,
+0x49d30804,
+0x49d40804,
+0x49d50804,
+0x49d60804,
+0x49d70804,
+0x49d80804,
+0x49d90804,
+0x49da0804,
+0x49db0804,
+0x49dc0804,
+0x49dd0804,
+0x49de0804,
+0x49df0804,
+0x49e00804,
+0x49e10804,
+0x49e20804,
+0x49e30804,
+0x49e40804,
+0x49e50804,
+0x49e60804,
+0x49e70804,
+0x49e80804,
+0x49e90804,
+0x49ea0804,
+0x49eb0804,
+0x49ec0804,
+0x49ed0804,
+0x49ee0804,
+0x49ef0804,
+0x49f00804,
+0x49f10804,
+0x49f20804,
+0x49f30804,
+0x49f40804,
+0x49f50804,
+0x49f60804,
+0x49f70804,
+0x49f80804,
+0x49f90804,
+0x49fa0804,
+0x49fb0804,
+0x49fc0804,
+0x49fd0804,
+0x49fe0804,
+0x49ff0804,
+0x4a000804,
+0x4a010804,
+0x4a020804,
+0x4a030804,
+0x4a040804,
+0x4a050804,
+0x4a060804,
+0x4a070804,
+0x4a080804,
+0x4a090804,
+0x4a0a0804,
+0x4a0b0804,
+0x4a0c0804,
+0x4a0d0804,
+0x4a0e0804,
+0x4a0f0804,
+0x4a100804,
+0x4a110804,
+0x4a120804,
+0x4a130804,
+0x4a140804,
+0x4a150804,
+0x4a160804,
+0x4a170804,
+0x4a180804,
+0x4a190804,
+0x4a1a0804,
+0x4a1b0804,
+0x4a1c0804,
+0x4a1d0804,
+0x4a1e0804,
+0x4a1f0804,
+0x4a200804,
+0x4a210804,
+0x4a220804,
+0x4a230804,
+0x4a240804,
+0x4a250804,
+0x4a260804,
+0x4a270804,
+0x4a280804,
+0x4a290804,
+0x4a2a0804,
+0x4a2b0804,
+0x4a2c0804,
+0x4a2d0804,
+0x4a2e0804,
+0x4a2f0804,
+0x4a300804,
+0x4a310804,
+0x4a320804,
+0x4a330804,
+0x4a340804,
+0x4a350804,
+0x4a360804,
+0x4a370804,
+0x4a380804,
+0x4a390804,
+0x4a3a0804,
+0x4a3b0804,
+0x4a3c0804,
+0x4a3d0804,
+0x4a3e0804,
+0x4a3f0804,
+0x4a400804,
+0x4a410804,
+0x4a420804,
+0x4a430804,
+0x4a440804,
+0x4a450804,
+0x4a460804,
+0x4a470804,
+0x4a480804,
+0x4a490804,
+0x4a4a0804,
+0x4a4b0804,
+0x4a4c0804,
+0x4a4d0804,
+0x4a4e0804,
+0x4a4f0804,
+0x4a500804,
+0x4a510804,
+0x4a520804,
+0x4a530804,
+0x4a540804,
+0x4a550804,
+0x4a560804,
+0x4a570804,
+0x4a580804,
+0x4a590804,
+0x4a5a0804,
+0x4a5b0804,
+0x4a5c0804,
+0x4a5d0804,
+0x4a5e0804,
+0x4a5f0804,
+0x4a600804,
+0x4a610804,
+0x4ac10804,
+0x4ac20804,
+0x4ac30804,
+0x4ac40804,
+0x4ac50804,
+0x4ac60804,
+0x4ac70804,
+0x4ac80804,
+0x4ac90804,
+0x4aca0804,
+0x4acb0804,
+0x4acc0804,
+0x4acd0804,
+0x4ace0804,
+0x4acf0804,
+0x4ad00804,
+0x4ad10804,
+0x4ad20804,
+0x4ad30804,
+0x4ad40804,
+0x4ad50804,
+0x4ad60804,
+0x4ad70804,
+0x4ad80804,
+0x4ad90804,
+0x4ada0804,
+0x4adb0804,
+0x4adc0804,
+0x4add0804,
+0x4ade0804,
+0x4adf0804,
+0x4ae00804,
+0x4ae10804,
+0x4ae20804,
+0x4ae30804,
+0x4ae40804,
+0x4ae50804,
+0x4ae60804,
+0x4ae70804,
+0x4ae80804,
+0x4ae90804,
+0x4aea0804,
+0x4aeb0804,
+0x4aec0804,
+0x4aed0804,
+0x4aee0804,
+0x4aef0804,
+0x4af00804,
+0x4af10804,
+0x4af20804,
+0x4af30804,
+0x4af40804,
+0x4af50804,
+0x4af60804,
+0x4af70804,
+0x4af80804,
+0x4af90804,
+0x4afa0804,
+0x4afb0804,
+0x4afc0804,
+0x4afd0804,
+0x4afe0804,
+0x4aff0804,
+0x4b000804,
+0x4b010804,
+0x4b020804,
+0x4b030804,
+0x4b040804,
+0x4b050804,
+0x4b060804,
+0x4b070804,
+0x4b080804,
+0x4b090804,
+0x4b0a0804,
+0x4b0b0804,
+0x4b0c0804,
+0x4b0d0804,
+0x4b0e0804,
+0x4b0f0804,
+0x4b100804,
+0x4b110804,
+0x4b120804,
+0x4b130804,
+0x4b140804,
+0x4b150804,
+0x4b160804,
+0x4b170804,
+0x4b180804,
+0x4b190804,
+0x4b1a0804,
+0x4b1b0804,
+0x4b1c0804,
+0x4b1d0804,
+0x4b1e0804,
+0x4b1f0804,
+0x4b200804,
+0x4b210804,
+0x4b220804,
+0x4b230804,
+0x4b240804,
+0x4b250804,
+0x4b260804,
+0x4b270804,
+0x4b280804,
+0x4b290804,
+0x4b2a0804,
+0x4b2b0804,
+0x4b2c0804,
+0x4b2d0804,
+0x4b2e0804,
+0x4b2f0804,
+0x4b300804,
+0x4b310804,
+0x4b320804,
+0x4b330804,
+0x4b340804,
+0x4b350804,
+0x4b360804,
+0x4b370804,
+0x4b380804,
+0x4b390804,
+0x4b3a0804,
+0x4b3b0804,
+0x4b3c0804,
+0x4b3d0804,
+0x4b3e0804,
+0x4b3f0804,
+0x4b400804,
+0x4b410804,
+0x4b420804,
+0x4b430804,
+0x4b440804,
+0x4b450804,
+0x4b460804,
+0x4b470804,
+0x4b480804,
+0x4b4c0804,
+0x4b4d0804,
+0x4b4e0804,
+0x4b4f0804,
+0x4b500804,
+0x4b510804,
+0x4b520804,
+0x4b530804,
+0x4b540804,
+0x4b550804,
+0x4b560804,
+0x4b570804,
+0x4b580804,
+0x4b590804,
+0x4b5a0804,
+0x4b5b0804,
+0x4b5c0804,
+0x4b5d0804,
+0x4b5e0804,
+0x4b5f0804,
+0x4b600804,
+0x4b610804,
+0x4b620804,
+0x4b630804,
+0x4b640804,
+0x4b650804,
+0x4b660804,
+0x4b670804,
+0x4b670810,
+0x4b680804,
+0x4b680810,
+0x4b690804,
+0x4b690810,
+0x4b6a0804,
+0x4b6a0810,
+0x4b6b0804,
+0x4b6b0810,
+0x4b6c0804,
+0x4b6c0810,
+0x4b6d0804,
+0x4b6d0810,
+0x4b6e0804,
+0x4b6e0810,
+0x4b6f0804,
+0x4b6f0810,
+0x4b700804,
+0x4b700810,
+0x4b710804,
+0x4b710810,
+0x4b720804,
+0x4b720810,
+0x4b730804,
+0x4b730810,
+0x4b740804,
+0x4b740810,
+0x4b750804,
+0x4b750810,
+0x4b760804,
+0x4b760810,
+0x4b770804,
+0x4b770810,
+0x4b780804,
+0x4b780810,
+0x4b790804,
+0x4b790810,
+0x4b7a0804,
+0x4b7a0810,
+0x4b7b0804,
+0x4b7b0810,
+0x4b7c0804,
+0x4b7c0810,
+0x4b7d0804,
+0x4b7d0810,
+0x4b7e0804,
+0x4b7e0810,
+0x4b7f0804,
+0x4b7f0810,
+0x4b800804,
+0x4b800810,
+0x4b810804,
+0x4b810810,
+0x4b820804,
+0x4b820810,
+0x4b830804,
+0x4b830810,
+0x4b840804,
+0x4b840810,
+0x4b850804,
+0x4b850810,
+0x4b860804,
+0x4b860810,
+0x4b870804,
+0x4b870810,
+0x4b880804,
+0x4b880810,
+0x4b890804,
+0x4b890810,
+0x4b8a0804,
+0x4b8a0810,
+0x4b8b0804,
+0x4b8b0810,
+0x4b8c0804,
+0x4b8c0810,
+0x4b8d0804,
+0x4b8d0810,
+0x4b8e0804,
+0x4b8e0810,
+0x4b8f0804,
+0x4b900804,
+0x4b910804,
+0x4b920804,
+0x4b930804,
+0x4b940804,
+0x4b950804,
+0x4b960804,
+0x4b970804,
+0x4b980804,
+0x4b990804,
+0x4b9a0804,
+0x4b9b0804,
+0x4b9c0804,
+0x4b9d0804,
+0x4b9e0804,
+0x4b9f0804,
+0x4ba00804,
+0x4ba10804,
+0x4ba20804,
+0x4ba30804,
+0x4ba40804,
+0x4ba50804,
+0x4ba60804,
+0x4ba70804,
+0x4ba80804,
+0x4ba90804,
+0x4baa0804,
+0x4bab0804,
+0x4bac0804,
+0x4bad0804,
+0x4bae0804,
+0x4baf0804,
+0x4bb00804,
+0x4bb10804,
+0x4bb20804,
+0x4bb30804,
+0x4bb40804,
+0x4bb50804,
+0x4bb60804,
+0x4bb70804,
+0x4bb80804,
+0x4bb90804,
+0x4bba0804,
+0x4bbb0804,
+0x4bbc0804,
+0x4bbd0804,
+0x4bbe0804,
+0x4bbf0804,
+0x4bc00804,
+0x4bc10804,
+0x4bc20804,
+0x4bc30804,
+0x4bc40804,
+0x4bc50804,
+0x4bc60804,
+0x4bc70804,
+0x4bc80804,
+0x4bc90804,
+0x4bca0804,
+0x4bcb0804,
+0x4bcc0804,
+0x4bcd0804,
+0x4bce0804,
+0x4bcf0804,
+0x4bd00804,
+0x4bd10804,
+0x4bd20804,
+0x4bd30804,
+0x4bd40804,
+0x4bd50804,
+0x4bd60804,
+0x4bd70804,
+0x4bd80804,
+0x4bd90804,
+0x4bda0804,
+0x4bdb0804,
+0x4bdc0804,
+0x4bdd0804,
+0x4bde0804,
+0x4bdf0804,
+0x4be00804,
+0x4be10804,
+0x4be20804,
+0x4be30804,
+0x4be40804,
+0x4be50804,
+0x4be60804,
+0x4be70804,
+0x4be80804,
+0x4be90804,
+0x4bea0804,
+0x4beb0804,
+0x4bec0804,
+0x4bed0804,
+0x4bee0804,
+0x4bef0804,
+0x4bf00804,
+0x4bf10804,
+0x4bf20804,
+0x4bf30804,
+0x4bf40804,
+0x4bf50804,
+0x4bf60804,
+0x4bf70804,
+0x4bf80804,
+0x4bf90804,
+0x4bfa0804,
+0x4bfb0804,
+0x4bfc0804,
+0x4bfd0804,
+0x4bfe0804,
+0x4bff0804,
+0x4c000804,
+0x4c010804,
+0x4c020804,
+0x4c030804,
+0x4c040804,
+0x4c050804,
+0x4c060804,
+0x4c070804,
+0x4c080804,
+0x4c090804,
+0x4c0a0804,
+0x4c0b0804,
+0x4c0c0804,
+0x4c0d0804,
+0x4c0e0804,
+0x4c0f0804,
+0x4c100804,
+0x4c110804,
+0x4c120804,
+0x4c130804,
+0x4c140804,
+0x4c150804,
+0x4c160804,
+0x4c170804,
+0x4c180804,
+0x4c190804,
+0x4c1a0804,
+0x4c1b0804,
+0x4c1c0804,
+0x4c1d0804,
+0x4c1e0804,
+0x4c1f0804,
+0x4c200804,
+0x4c210804,
+0x4c220804,
+0x4c230804,
+0x4c240804,
+0x4c250804,
+0x4c260804,
+0x4c270804,
+0x4c280804,
+0x4c290804,
+0x4c2a0804,
+0x4c2b0804,
+0x4c2c0804,
+0x4c2d0804,
+0x4c2e0804,
+0x4c2f0804,
+0x4c300804,
+0x4c310804,
+0x4c320804,
+0x4c330804,
+0x4c340804,
+0x4c350804,
+0x4c360804,
+0x4c370804,
+0x4c380804,
+0x4c390804,
+0x4c3a0804,
+0x4c3b0804,
+0x4c3c0804,
+0x4c3d0804,
+0x4c3e0804,
+0x4c3f0804,
+0x4c400804,
+0x4c410804,
+0x4c420804,
+0x4c430804,
+0x4c440804,
+0x4c450804,
+0x4c460804,
+0x4c470804,
+0x4c480804,
+0x4c490804,
+0x4c4a0804,
+0x4c4b0804,
+0x4c4c0804,
+0x4c4d0804,
+0x4c4e0804,
+0x4c4f0804,
+0x4c500804,
+0x4c510804,
+0x4c520804,
+0x4c530804,
+0x4c540804,
+0x4c550804,
+0x4c560804,
+0x4c570804,
+0x4c580804,
+0x4c590804,
+0x4c5a0804,
+0x4c5b0804,
+0x4c5c0804,
+0x4c5d0804,
+0x4c5e0804,
+0x4c5f0804,
+0x4c600804,
+0x4c610804,
+0x4c620804,
+0x4c630804,
+0x4c640804,
+0x4c650804,
+0x4c660804,
+0x4c670804,
+0x4c680804,
+0x4c690804,
+0x4c6a0804,
+0x4c6b0804,
+0x4c6c0804,
+0x4c6d0804,
+0x4c6e0804,
+0x4c6f0804,
+0x4c700804,
+0x4c710804,
+0x4c720804,
+0x4c730804,
+0x4c740804,
+0x4c750804,
+0x4c760804,
+0x4c770804,
+0x4c780804,
+0x4c790804,
+0x4c7a0804,
+0x4c7b0804,
+0x4c7c0804,
+0x4c7d0804,
+0x4c7e0804,
+0x4c7f0804,
+0x4c800804,
+0x4c810804,
+0x4c820804,
+0x4c830804,
+0x4c840804,
+0x4c850804,
+0x4c860804,
+0x4c870804,
+0x4c880804,
+0x4c890804,
+0x4c8a0804,
+0x4c8b0804,
+0x4c8c0804,
+0x4c8d0804,
+0x4c8e0804,
+0x4c8f0804,
+0x4c900804,
+0x4c910804,
+0x4c920804,
+0x4c930804,
+0x4c940804,
+0x4c950804,
+0x4c960804,
+0x4c970804,
+0x4c980804,
+0x4c990804,
+0x4c9a0804,
+0x4c9b0804,
+0x4c9c0804,
+0x4c9d0804,
+0x4c9e0804,
+0x4c9f0804,
+0x4ca00804,
+0x4ca10804,
+0x4ca20804,
+0x4ca30804,
+0x4ca40804,
+0x4ca50804,
+0x4ca60804,
+0x4ca70804,
+0x4ca80804,
+0x4ca90804,
+0x4caa0804,
+0x4cab0804,
+0x4cac0804,
+0x4cad0804,
+0x4cae0804,
+0x4caf0804,
+0x4cb00804,
+0x4cb10804,
+0x4cb20804,
+0x4cb30804,
+0x4cb40804,
+0x4cb50804,
+0x4cb60804,
+0x4cb70804,
+0x4cb80804,
+0x4cb90804,
+0x4cba0804,
+0x4cbb0804,
+0x4cbc0804,
+0x4cbd0804,
+0x4cbe0804,
+0x4cbf0804,
+0x4cc00804,
+0x4cc10804,
+0x4cc20804,
+0x4cc30804,
+0x4cc40804,
+0x4cc50804,
+0x4cc60804,
+0x4cc70804,
+0x4cc80804,
+0x4cc90804,
+0x4cca0804,
+0x4ccb0804,
+0x4ccc0804,
+0x4ccd0804,
+0x4cce0804,
+0x4ccf0804,
+0x4cd00804,
+0x4cd10804,
+0x4cd20804,
+0x4cd30804,
+0x4cd40804,
+0x4cd50804,
+0x4cd60804,
+0x4cd70804,
+0x4cd80804,
+0x4cd90804,
+0x4cda0804,
+0x4cdb0804,
+0x4cdc0804,
+0x4cdd0804,
+0x4cde0804,
+0x4cdf0804,
+0x4ce00804,
+0x4ce10804,
+0x4ce20804,
+0x4ce30804,
+0x4ce40804,
+0x4ce50804,
+0x4ce60804,
+0x4ce70804,
+0x4ce80804,
+0x4ce90804,
+0x4cea0804,
+0x4ceb0804,
+0x4cec0804,
+0x4ced0804,
+0x4cee0804,
+0x4cef0804,
+0x4cf00804,
+0x4cf10804,
+0x4cf20804,
+0x4cf30804,
+0x4cf40804,
+0x4cf50804,
+0x4cf60804,
+0x4cf70804,
+0x4cf80804,
+0x4cf90804,
+0x4cfa0804,
+0x4cfb0804,
+0x4cfc0804,
+0x4cfd0804,
+0x4cfe0804,
+0x4cff0804,
+0x4d000804,
+0x4d010804,
+0x4d020804,
+0x4d030804,
+0x4d040804,
+0x4d050804,
+0x4d060804,
+0x4d070804,
+0x4d080804,
+0x4d090804,
+0x4d0a0804,
+0x4d0b0804,
+0x4d0c0804,
+0x4d0d0804,
+0x4d0e0804,
+0x4d0f0804,
+0x4d100804,
+0x4d110804,
+0x4d120804,
+0x4d130804,
+0x4d140804,
+0x4d150804,
+0x4d160804,
+0x4d170804,
+0x4d180804,
+0x4d190804,
+0x4d1a0804,
+0x4d1b0804,
+0x4d1c0804,
+0x4d1d0804,
+0x4d1e0804,
+0x4d1f0804,
+0x4d200804,
+0x4d210804,
+0x4d220804,
+0x4d230804,
+0x4d240804,
+0x4d250804,
+0x4d260804,
+0x4d270804,
+0x4d280804,
+0x4d290804,
+0x4d2a0804,
+0x4d2b0804,
+0x4d2c0804,
+0x4d2d0804,
+0x4d2e0804,
+0x4d2f0804,
+0x4d300804,
+0x4d310804,
+0x4d320804,
+0x4d330804,
+0x4d340804,
+0x4d350804,
+0x4d360804,
+0x4d370804,
+0x4d380804,
+0x4d390804,
+0x4d3a0804,
+0x4d3b0804,
+0x4d3c0804,
+0x4d3d0804,
+0x4d3e0804,
+0x4d3f0804,
+0x4d400804,
+0x4d410804,
+0x4d420804,
+0x4d430804,
+0x4d440804,
+0x4d450804,
+0x4d460804,
+0x4d470804,
+0x4d480804,
+0x4d490804,
+0x4d4a0804,
+0x4d4b0804,
+0x4d4c0804,
+0x4d4d0804,
+0x4d4e0804,
+0x4d4f0804,
+0x4d500804,
+0x4d510804,
+0x4d520804,
+0x4d530804,
+0x4d540804,
+0x4d550804,
+0x4d560804,
+0x4d570804,
+0x4d580804,
+0x4d590804,
+0x4d5a0804,
+0x4d5b0804,
+0x4d5c0804,
+0x4d5d0804,
+0x4d5e0804,
+0x4d5f0804,
+0x4d600804,
+0x4d610804,
+0x4d620804,
+0x4d630804,
+0x4d640804,
+0x4d650804,
+0x4d660804,
+0x4d670804,
+0x4d680804,
+0x4d690804,
+0x4d6a0804,
+0x4d6b0804,
+0x4d6c0804,
+0x4d6d0804,
+0x4d6e0804,
+0x4d6f0804,
+0x4d700804,
+0x4d710804,
+0x4d720804,
+0x4d730804,
+0x4d740804,
+0x4d750804,
+0x4d760804,
+0x4d770804,
+0x4d780804,
+0x4d790804,
+0x4d7a0804,
+0x4d7b0804,
+0x4d7c0804,
+0x4d7d0804,
+0x4d7e0804,
+0x4d7f0804,
+0x4d800804,
+0x4d810804,
+0x4d820804,
+0x4d830804,
+0x4d840804,
+0x4d850804,
+0x4d860804,
+0x4d870804,
+0x4d880804,
+0x4d890804,
+0x4d8a0804,
+0x4d8b0804,
+0x4d8c0804,
+0x4d8d0804,
+0x4d8e0804,
+0x4d8f0804,
+0x4d900804,
+0x4d910804,
+0x4d920804,
+0x4d930804,
+0x4d940804,
+0x4d950804,
+0x4d960804,
+0x4d970804,
+0x4d980804,
+0x4d990804,
+0x4d9a0804,
+0x4d9b0804,
+0x4d9c0804,
+0x4d9d0804,
+0x4d9e0804,
+0x4d9f0804,
+0x4da00804,
+0x4da10804,
+0x4da20804,
+0x4da30804,
+0x4da40804,
+0x4da50804,
+0x4da60804,
+0x4da70804,
+0x4da80804,
+0x4da90804,
+0x4daa0804,
+0x4dab0804,
+0x4dac0804,
+0x4dad0804,
+0x4dae0804,
+0x4daf0804,
+0x4db00804,
+0x4db10804,
+0x4db20804,
+0x4db30804,
+0x4db40804,
+0x4db50804,
+0x4db60804,
+0x4db70804,
+0x4db80804,
+0x4db90804,
+0x4dba0804,
+0x4dbb0804,
+0x4dbc0804,
+0x4dbd0804,
+0x4dbe0804,
+0x4dbf0804,
+0x4dc00804,
+0x4dc10804,
+0x4dc20804,
+0x4dc30804,
+0x4dc40804,
+0x4dc50804,
+0x4dc60804,
+0x4dc70804,
+0x4dc80804,
+0x4dc90804,
+0x4dca0804,
+0x4dcb0804,
+0x4dcc0804,
+0x4dcd0804,
+0x4dce0804,
+0x4dcf0804,
+0x4dd00804,
+0x4dd10804,
+0x4dd20804,
+0x4dd30804,
+0x4dd40804,
+0x4dd50804,
+0x4dd60804,
+0x4dd70804,
+0x4dd80804,
+0x4dd90804,
+0x4dda0804,
+0x4ddb0804,
+0x4ddc0804,
+0x4ddd0804,
+0x4dde0804,
+0x4ddf0804,
+0x4de00804,
+0x4de10804,
+0x4de20804,
+0x4de30804,
+0x4de40804,
+0x4de50804,
+0x4de60804,
+0x4de70804,
+0x4de80804,
+0x4de90804,
+0x4dea0804,
+0x4deb0804,
+0x4dec0804,
+0x4ded0804,
+0x4dee0804,
+0x4def0804,
+0x4df00804,
+0x4df10804,
+0x4df20804,
+0x4df30804,
+0x4df40804,
+0x4df50804,
+0x4df60804,
+0x4df70804,
+0x4df80804,
+0x4df90804,
+0x4dfa0804,
+0x4dfb0804,
+0x4dfc0804,
+0x4dfd0804,
+0x4dfe0804,
+0x4dff0804,
+0x4e000804,
+0x4e010804,
+0x4e020804,
+0x4e030804,
+0x4e040804,
+0x4e050804,
+0x4e060804,
+0x4e070804,
+0x4e080804,
+0x4e090804,
+0x4e0a0804,
+0x4e0b0804,
+0x4e0c0804,
+0x4e0d0804,
+0x4e0e0804,
+0x4e0f0804,
+0x4e100804,
+0x4e110804,
+0x4e120804,
+0x4e130804,
+0x4e140804,
+0x4e150804,
+0x4e160804,
+0x4e170804,
+0x4e180804,
+0x4e190804,
+0x4e1a0804,
+0x4e1b0804,
+0x4e1c0804,
+0x4e1d0804,
+0x4e1e0804,
+0x4e1f0804,
+0x4e200804,
+0x4e210804,
+0x4e220804,
+0x4e230804,
+0x4e240804,
+0x4e250804,
+0x4e260804,
+0x4e270804,
+0x4e280804,
+0x4e290804,
+0x4e2a0804,
+0x4e2b0804,
+0x4e2c0804,
+0x4e2d0804,
+0x4e2e0804,
+0x4e2f0804,
+0x4e300804,
+0x4e310804,
+0x4e320804,
+0x4e330804,
+0x4e340804,
+0x4e350804,
+0x4e360804,
+0x4e370804,
+0x4e380804,
+0x4e390804,
+0x4e3a0804,
+0x4e3b0804,
+0x4e3c0804,
+0x4e3d0804,
+0x4e3e0804,
+0x4e3f0804,
+0x4e400804,
+0x4e410804,
+0x4e420804,
+0x4e430804,
+0x4e440804,
+0x4e450804,
+0x4e460804,
+0x4e470804,
+0x4e480804,
+0x4e490804,
+0x4e4a0804,
+0x4e4b0804,
+0x4e4c0804,
+0x4e4d0804,
+0x4e4e0804,
+0x4e4f0804,
+0x4e500804,
+0x4e510804,
+0x4e520804,
+0x4e530804,
+0x4e540804,
+0x4e550804,
+0x4e560804,
+0x4e570804,
+0x4e580804,
+0x4e590804,
+0x4e5a0804,
+0x4e5b0804,
+0x4e5c0804,
+0x4e5d0804,
+0x4e5e0804,
+0x4e5f0804,
+0x4e600804,
+0x4e610804,
+0x4e620804,
+0x4e630804,
+0x4e640804,
+0x4e650804,
+0x4e660804,
+0x4e670804,
+0x4e680804,
+0x4e690804,
+0x4e6a0804,
+0x4e6b0804,
+0x4e6c0804,
+0x4e6d0804,
+0x4e6e0804,
+0x4e6f0804,
+0x4e700804,
+0x4e710804,
+0x4e720804,
+0x4e730804,
+0x4e740804,
+0x4e750804,
+0x4e760804,
+0x4e770804,
+0x4e780804,
+0x4e790804,
+0x4e7a0804,
+0x4e7b0804,
+0x4e7c0804,
+0x4e7d0804,
+0x4e7e0804,
+0x4e7f0804,
+0x4e800804,
+0x4e810804,
+0x4e820804,
+0x4e830804,
+0x4e840804,
+0x4e850804,
+0x4e860804,
+0x4e870804,
+0x4e880804,
+0x4e890804,
+0x4e8a0804,
+0x4e8b0804,
+0x4e8c0804,
+0x4e8d0804,
+0x4e8e0804,
+0x4e8f0804,
+0x4e900804,
+0x4e910804,
+0x4e920804,
+0x4e930804,
+0x4e940804,
+0x4e950804,
+0x4e960804,
+0x4e970804,
+0x4e980804,
+0x4e990804,
+0x4e9a0804,
+0x4e9b0804,
+0x4e9c0804,
+0x4e9d0804,
+0x4e9e0804,
+0x4e9f0804,
+0x4ea00804,
+0x4ea10804,
+0x4ea20804,
+0x4ea30804,
+0x4ea40804,
+0x4ea50804,
+0x4ea60804,
+0x4ea70804,
+0x4ea80804,
+0x4ea90804,
+0x4eaa0804,
+0x4eab0804,
+0x4eac0804,
+0x4ead0804,
+0x4eae0804,
+0x4eaf0804,
+0x4eb00804,
+0x4eb10804,
+0x4eb20804,
+0x4eb30804,
+0x4eb40804,
+0x4eb50804,
+0x4eb60804,
+0x4eb70804,
+0x4eb80804,
+0x4eb90804,
+0x4eba0804,
+0x4ebb0804,
+0x4ebc0804,
+0x4ebd0804,
+0x4ebe0804,
+0x4ebf0804,
+0x4ec00804,
+0x4ec10804,
+0x4ec20804,
+0x4ec30804,
+0x4ec40804,
+0x4ec50804,
+0x4ec60804,
+0x4ec70804,
+0x4ec80804,
+0x4ec90804,
+0x4eca0804,
+0x4ecb0804,
+0x4ecc0804,
+0x4ecd0804,
+0x4ece0804,
+0x4ecf0804,
+0x4ed00804,
+0x4ed10804,
+0x4ed20804,
+0x4ed30804,
+0x4ed40804,
+0x4ed50804,
+0x4ed60804,
+0x4ed70804,
+0x4ed80804,
+0x4ed90804,
+0x4eda0804,
+0x4edb0804,
+0x4edc0804,
+0x4edd0804,
+0x4ede0804,
+0x4edf0804,
+0x4ee00804,
+0x4ee10804,
+0x4ee20804,
+0x4ee30804,
+0x4ee40804,
+0x4ee50804,
+0x4ee60804,
+0x4ee70804,
+0x4ee80804,
+0x4ee90804,
+0x4eea0804,
+0x4eeb0804,
+0x4eec0804,
+0x4eed0804,
+0x4eee0804,
+0x4eef0804,
+0x4ef00804,
+0x4ef10804,
+0x4ef20804,
+0x4ef30804,
+0x4ef40804,
+0x4ef50804,
+0x4ef60804,
+0x4ef70804,
+0x4ef80804,
+0x4ef90804,
+0x4efa0804,
+0x4efb0804,
+0x4efc0804,
+0x4efd0804,
+0x4efe0804,
+0x4eff0804,
+0x4f000804,
+0x4f010804,
+0x4f020804,
+0x4f030804,
+0x4f040804,
+0x4f050804,
+0x4f060804,
+0x4f070804,
+0x4f080804,
+0x4f090804,
+0x4f0a0804,
+0x4f0b0804,
+0x4f0c0804,
+0x4f0d0804,
+0x4f0e0804,
+0x4f0f0804,
+0x4f100804,
+0x4f110804,
+0x4f120804,
+0x4f130804,
+0x4f140804,
+0x4f150804,
+0x4f160804,
+0x4f170804,
+0x4f180804,
+0x4f190804,
+0x4f1a0804,
+0x4f1b0804,
+0x4f1c0804,
+0x4f1d0804,
+0x4f1e0804,
+0x4f1f0804,
+0x4f200804,
+0x4f210804,
+0x4f220804,
+0x4f230804,
+0x4f240804,
+0x4f250804,
+0x4f260804,
+0x4f270804,
+0x4f280804,
+0x4f290804,
+0x4f2a0804,
+0x4f2b0804,
+0x4f2c0804,
+0x4f2d0804,
+0x4f2e0804,
+0x4f2f0804,
+0x4f300804,
+0x4f310804,
+0x4f320804,
+0x4f330804,
+0x4f340804,
+0x4f350804,
+0x4f360804,
+0x4f370804,
+0x4f380804,
+0x4f390804,
+0x4f3a0804,
+0x4f3b0804,
+0x4f3c0804,
+0x4f3d0804,
+0x4f3e0804,
+0x4f3f0804,
+0x4f400804,
+0x4f410804,
+0x4f420804,
+0x4f430804,
+0x4f440804,
+0x4f450804,
+0x4f460804,
+0x4f470804,
+0x4f480804,
+0x4f490804,
+0x4f4a0804,
+0x4f4b0804,
+0x4f4c0804,
+0x4f4d0804,
+0x4f4e0804,
+0x4f4f0804,
+0x4f500804,
+0x4f510804,
+0x4f520804,
+0x4f530804,
+0x4f540804,
+0x4f550804,
+0x4f560804,
+0x4f570804,
+0x4f580804,
+0x4f590804,
+0x4f5a0804,
+0x4f5b0804,
+0x4f5c0804,
+0x4f5d0804,
+0x4f5e0804,
+0x4f5f0804,
+0x4f600804,
+0x4f610804,
+0x4f620804,
+0x4f630804,
+0x4f640804,
+0x4f650804,
+0x4f660804,
+0x4f670804,
+0x4f680804,
+0x4f690804,
+0x4f6a0804,
+0x4f6b0804,
+0x4f6c0804,
+0x4f6d0804,
+0x4f6e0804,
+0x4f6f0804,
+0x4f700804,
+0x4f710804,
+0x4f720804,
+0x4f730804,
+0x4f740804,
+0x4f750804,
+0x4f760804,
+0x4f770804,
+0x4f780804,
+0x4f790804,
+0x4f7a0804,
+0x4f7b0804,
+0x4f7c0804,
+0x4f7d0804,
+0x4f7e0804,
+0x4f7f0804,
+0x4f800804,
+0x4f810804,
+0x4f820804,
+0x4f830804,
+0x4f840804,
+0x4f850804,
+0x4f860804,
+0x4f870804,
+0x4f880804,
+0x4f890804,
+0x4f8a0804,
+0x4f8b0804,
+0x4f8c0804,
+0x4f8d0804,
+0x4f8e0804,
+0x4f8f0804,
+0x4f900804,
+0x4f910804,
+0x4f920804,
+0x4f930804,
+0x4f940804,
+0x4f950804,
+0x4f960804,
+0x4f970804,
+0x4f980804,
+0x4f990804,
+0x4f9a0804,
+0x4f9b0804,
+0x4f9c0804,
+0x4f9d0804,
+0x4f9e0804,
+0x4f9f0804,
+0x4fa00804,
+0x4fa10804,
+0x4fa20804,
+0x4fa30804,
+0x4fa40804,
+0x4fa50804,
+0x4fa60804,
+0x4fa70804,
+0x4fa80804,
+0x4fa90804,
+0x4faa0804,
+0x4fab0804,
+0x4fac0804,
+0x4fad0804,
+0x4fae0804,
+0x4faf0804,
+0x4fb00804,
+0x4fb10804,
+0x4fb20804,
+0x4fb30804,
+0x4fb40804,
+0x4fb50804,
+0x4fb60804,
+0x4fb70804,
+0x4fb80804,
+0x4fb90804,
+0x4fba0804,
+0x4fbb0804,
+0x4fbc0804,
+0x4fbd0804,
+0x4fbe0804,
+0x4fbf0804,
+0x4fc00804,
+0x4fc10804,
+0x4fc20804,
+0x4fc20808,
+0x4608,
+0x4fc30804,
+0x4fc40804,
+0x4fc50804,
+0x4fc60804,
+0x4fc70804,
+0x4fc80804,
+0x4fc90804,
+0x4fca0804,
+0x4fcb0804,
+0x4fcc0804,
+0x4fcd0804,
+0x4fce0804,
+0x4fcf0804,
+0x4fd00804,
+0x4fd10804,
+0x4fd20804,
+0x4fd30804,
+0x4fd40804,
+0x4fd50804,
+0x4fd60804,
+0x4fd70804,
+0x4fd70832,
+0x4fd80804,
+0x4fd90804,
+0x4fda0804,
+0x4fdb0804,
+0x4fdc0804,
+0x4fdd0804,
+0x4fde0804,
+0x4fdf0804,
+0x4fe00804,
+0x4fe00832,
+0x4fe10804,
+0x4fe10832,
+0x4fe20804,
+0x4fe30804,
+0x4fe40804,
+0x4fe40832,
+0x4fe50804,
+0x4fe60804,
+0x4fe70804,
+0x4fe80804,
+0x4fe90804,
+0x4fe90832,
+0x4fea0804,
+0x4fea0832,
+0x4feb0804,
+0x4feb0832,
+0x4fec0804,
+0x4fec0832,
+0x4fed0804,
+0x4fed0832,
+0x4fee0804,
+0x4fef0804,
+0x4ff00804,
+0x4ff10804,
+0x4ff20804,
+0x4ff30804,
+0x4ff40804,
+0x4ff40832,
+0x4ff50804,
+0x4ff60804,
+0x4ff70804,
+0x4ff80804,
+0x4ff90804,
+0x4ffa0804,
+0x4ffb0804,
+0x4ffc0804,
+0x4ffd0804,
+0x4ffe0804,
+0x4fff0804,
+0x50000804,
+0x50010804,
+0x50020804,
+0x50030804,
+0x50040804,
+0x50050804,
+0x50060804,
+0x50070804,
+0x50080804,
+0x50090804,
+0x500a0804,
+0x500b0804,
+0x500c0804,
+0x500d0804,
+0x500e0804,
+0x500f0804,
+0x50100804,
+0x50110804,
+0x50120804,
+0x50130804,
+0x50140804,
+0x50150804,
+0x50160804,
+0x50170804,
+0x50180804,
+0x50190804,
+0x501a0804,
+0x501b0804,
+0x501c0804,
+0x501d0804,
+0x501e0804,
+0x501f0804,
+0x50200804,
+0x50210804,
+0x50220804,
+0x50230804,
+0x50240804,
+0x50250804,
+0x50260804,
+0x50270804,
+0x50280804,
+0x50290804,
+0x502a0804,
+0x502b0804,
+0x502c0804,
+0x502d0804,
+0x502e0804,
+0x502f0804,
+0x50300804,
+0x50310804,
+0x50320804,
+0x50330804,
+0x50340804,
+0x50350804,
+0x50360804,
+0x50370804,
+0x50380804,
+0x50390804,
+0x503a0804,
+0x503b0804,
+0x503c0804,
+0x503d0804,
+0x503e0804,
+0x503f0804,
+0x50400804,
+0x50410804,
+0x50420804,
+0x50430804,
+0x50440804,
+0x50450804,
+0x50460804,
+0x50470804,
+0x50480804,
+0x50490804,
+0x504a0804,
+0x504b0804,
+0x504c0804,
+0x504d0804,
+0x504e0804,
+0x504f0804,
+0x50500804,
+0x50510804,
+0x50520804,
+0x50530804,
+0x50540804,
+0x50550804,
+0x50560804,
+0x50570804,
+0x50580804,
+0x50590804,
+0x505a0804,
+0x505b0804,
+0x50720804,
+0x50730804,
+0x50740804,
+0x50750804,
+0x50760804,
+0x50770804,
+0x50780804,
+0x50790804,
+0x50790808,
+0x4648,
+0x507a0804,
+0x507b0804,
+0x507c0804,
+0x507d0804,
+0x507e0804,
+0x507f0804,
+0x50800804,
+0x50810804,
+0x50820804,
+0x50830804,
+0x50840804,
+0x50850804,
+0x50860804,
+0x50870804,
+0x50880804,
+0x50890804,
+0x508a0804,
+0x508b0804,
+0x508c0804,
+0x508d0804,
+0x508e0804,
+0x508f0804,
+0x50900804,
+0x50910804,
+0x50920804,
+0x50930804,
+0x50940804,
+0x50950804,
+0x50ff0804,
+0x51000804,
+0x51010804,
+0x51020804,
+0x51030804,
+0x51040804,
+0x51050804,
+0x51060804,
+0x51070804,
+0x51080804,
+0x51090804,
+0x510a0804,
+0x510b0804,
+0x510c0804,
+0x510d0804,
+0x510e0804,
+0x510f0804,
+0x51100804,
+0x51110804,
+0x51120804,
+0x51130804,
+0x51140804,
+0x51150804,
+0x51160804,
+0x51170804,
+0x51180804,
+0x51190804,
+0x511a0804,
+0x511b0804,
+0x511c0804,
+0x511d0804,
+0x511e0804,
+0x511f0804,
+0x51200804,
+0x51210804,
+0x51220804,
+0x51230804,
+0x51240804,
+0x51250804,
+0x51260804,
+0x51270804,
+0x51280804,
+0x51290804,
+0x512a0804,
+0x512b0804,
+0x512c0804,
+0x512d0804,
+0x512e0804,
+0x512f0804,
+0x51300804,
+0x51310804,
+0x51320804,
+0x51330804,
+0x51340804,
+0x51350804,
+0x51360804,
+0x51370804,
+0x51380804,
+0x51390804,
+0x513a0804,
+0x513b0804,
+0x513c0804,
+0x513d0804,
+0x513e0804,
+0x513f0804,
+0x51400804,
+0x51410804,
+0x51420804,
+0x51430804,
+0x51440804,
+0x51450804,
+0x51460804,
+0x51470804,
+0x51480804,
+0x51490804,
+0x514a0804,
+0x514b0804,
+0x514c0804,
+0x514d0804,
+0x514e0804,
+0x514f0804,
+0x51500804,
+0x51510804,
+0x51520804,
+0x51530804,
+0x51540804,
+0x51550804,
+0x51560804,
+0x51570804,
+0x51580804,
+0x51590804,
+0x515a0804,
+0x515b0804,
+0x515c0804,
+0x515d0804,
+0x515e0804,
+0x515f0804,
+0x51600804,
+0x51610804,
+0x51620804,
+0x51630804,
+0x51640804,
+0x51650804,
+0x51660804,
+0x51670804,
+0x51680804,
+0x51690804,
+0x516a0804,
+0x516b0804,
+0x516c0804,
+0x516d0804,
+0x516e0804,
+0x516f0804,
+0x51700804,
+0x51710804,
+0x51720804,
+0x51730804,
+0x51740804,
+0x51750804,
+0x51760804,
+0x51770804,
+0x51780804,
+0x51790804,
+0x517a0804,
+0x517b0804,
+0x517c0804,
+0x517d0804,
+0x517e0804,
+0x517f0804,
+0x51800804,
+0x51810804,
+0x51820804,
+0x51830804,
+0x51840804,
+0x51850804,
+0x51860804,
+0x51870804,
+0x51880804,
+0x51890804,
+0x518a0804,
+0x518b0804,
+0x518c0804,
+0x518d0804,
+0x518e0804,
+0x518f0804,
+0x51900804,
+0x51910804,
+0x51920804,
+0x51930804,
+0x51940804,
+0x51950804,
+0x51960804,
+0x51970804,
+0x51980804,
+0x51990804,
+0x519a0804,
+0x519b0804,
+0x519c0804,
+0x519d0804,
+0x519e0804,
+0x519f0804,
+0x51a00804,
+0x51a10804,
+0x51a20804,
+0x51a30804,
+0x51a40804,
+0x51a50804,
+0x51a60804,
+0x51a70804,
+0x51a80804,
+0x51a90804,
+0x51aa0804,
+0x51ab0804,
+0x51ac0804,
+0x51ad0804,
+0x51ae0804,
+0x51af0804,
+0x51b00804,
+0x51b10804,
+0x51b20804,
+0x51b30804,
+0x51b40804,
+0x51b50804,
+0x51b60804,
+0x51b70804,
+0x51b80804,
+0x51b90804,
+0x51ba0804,
+0x51bb0804,
+0x51bc0804,
+0x51bd0804,
+0x51be0804,
+0x51bf0804,
+0x51c00804,
+0x51c10804,
+0x51c20804,
+0x51c30804,
+0x51c40804,
+0x51c50804,
+0x51c60804,
+0x51c70804,
+0x51c80804,
+0x51c90804,
+0x51ca0804,
+0x51cb0804,
+0x51cc0804,
+0x51cd0804,
+0x51ce0804,
+0x51cf0804,
+0x51d00804,
+0x51d10804,
+0x51d20804,
+0x51d30804,
+0x51d40804,
+0x51d50804,
+0x51d60804,
+0x51d70804,
+0x51d80804,
+0x51d90804,
+0x51da0804,
+0x51db0804,
+0x51dc0804,
+0x51dd0804,
+0x51de0804,
+0x51df0804,
+0x51e00804,
+0x51e10804,
+0x51e20804,
+0x51e30804,
+0x51e40804,
+0x51e50804,
+0x51e60804,
+0x51e70804,
+0x51e80804,
+0x51e90804,
+0x51ea0804,
+0x51eb0804,
+0x51ec0804,
+0x51ed0804,
+0x51ee0804,
+0x51ef0804,
+0x51f00804,
+0x51f10804,
+0x51f20804,
+0x51f30804,
+0x51f40804,
+0x51f50804,
+0x51f60804,
+0x51f70804,
+0x51f80804,
+0x51f90804,
+0x51fa0804,
+0x51fb0804,
+0x51fc0804,
+0x51fd0804,
+0x51fe0804,
+0x51ff0804,
+0x52000804,
+0x52010804,
+0x52020804,
+0x52030804,
+0x52040804,
+0x52050804,
+0x52060804,
+0x52070804,
+0x52080804,
+0x52090804,
+0x520a0804,
+0x520b0804,
+0x520c0804,
+0x520d0804,
+0x520e0804,
+0x520f0804,
+0x52100804,
+0x52110804,
+0x52120804,
+0x52130804,
+0x52140804,
+0x52150804,
+0x52160804,
+0x52170804,
+0x52180804,
+0x52190804,
+0x521a0804,
+0x521b0804,
+0x521c0804,
+0x521d0804,
+0x521e0804,
+0x521f0804,
+0x52200804,
+0x52210804,
+0x52220804,
+0x52230804,
+0x52240804,
+0x52250804,
+0x52260804,
+0x52270804,
+0x52280804,
+0x52290804,
+0x522a0804,
+0x522b0804,
+0x522c0804,
+0x522d0804,
+0x522e0804,
+0x522f0804,
+0x52300804,
+0x52310804,
+0x52320804,
+0x52330804,
+0x52340804,
+0x52350804,
+0x52360804,
+0x52370804,
+0x52380804,
+0x52390804,
+0x523a0804,
+0x523b0804,
+0x523c0804,
+0x523d0804,
+0x523e0804,
+0x523f0804,
+0x52400804,
+0x52410804,
+0x52420804,
+0x52430804,
+0x52440804,
+0x52450804,
+0x52460804,
+0x52470804,
+0x52480804,
+0x52490804,
+0x524a0804,
+0x524b0804,
+0x524c0804,
+0x524d0804,
+0x524e0804,
+0x524f0804,
+0x52500804,
+0x52510804,
+0x52520804,
+0x52530804,
+0x52540804,
+0x52550804,
+0x52560804,
+0x52570804,
+0x52580804,
+0x52590804,
+0x525a0804,
+0x525b0804,
+0x525c0804,
+0x525d0804,
+0x525e0804,
+0x525f0804,
+0x52600804,
+0x52610804,
+0x52620804,
+0x52630804,
+0x52640804,
+0x52650804,
+0x52660804,
+0x52670804,
+0x52680804,
+0x52690804,
+0x526a0804,
+0x526b0804,
+0x526c0804,
+0x526d0804,
+0x526e0804,
+0x526f0804,
+0x52700804,
+0x52710804,
+0x52720804,
+0x52730804,
+0x52740804,
+0x52750804,
+0x52760804,
+0x52770804,
+0x52780804,
+0x52790804,
+0x527a0804,
+0x527b0804,
+0x527c0804,
+0x527d0804,
+0x527e0804,
+0x527f0804,
+0x52800804,
+0x52810804,
+0x52820804,
+0x52830804,
+0x52840804,
+0x52850804,
+0x52860804,
+0x52870804,
+0x52880804,
+0x52890804,
+0x528a0804,
+0x528b0804,
+0x528c0804,
+0x528d0804,
+0x528e0804,
+0x528f0804,
+0x52900804,
+0x52910804,
+0x52920804,
+0x52930804,
+0x52940804,
+0x52950804,
+0x52960804,
+0x52970804,
+0x52980804,
+0x52990804,
+0x529a0804,
+0x529b0804,
+0x529c0804,
+0x529d0804,
+0x529e0804,
+0x529f0804,
+0x52a00804,
+0x52a10804,
+0x52a20804,
+0x52a30804,
+0x52a40804,
+0x52a50804,
+0x52a60804,
+0x52a70804,
+0x52a80804,
+0x52a90804,
+0x52aa0804,
+0x52ab0804,
+0x52ac0804,
+0x52ad0804,
+0x52ae0804,
+0x52af0804,
+0x52b00804,
+0x52b10804,
+0x52b20804,
+0x52b30804,
+0x52b40804,
+0x52b50804,
+0x52b60804,
+0x52b70804,
+0x52b80804,
+0x52b90804,
+0x52ba0804,
+0x52bb0804,
+0x52bc0804,
+0x52bd0804,
+0x52be0804,
+0x52bf0804,
+0x52c00804,
+0x52c10804,
+0x52c20804,
+0x52c30804,
+0x52c40804,
+0x52c50804,
+0x52c60804,
+0x52c70804,
+0x52c80804,
+0x52c90804,
+0x52ca0804,
+0x52cb0804,
+0x52cc0804,
+0x52cd0804,
+0x52ce0804,
+0x52cf0804,
+0x52d00804,
+0x52d10804,
+0x52d20804,
+0x52d30804,
+0x52d40804,
+0x52d50804,
+0x52d60804,
+0x52d70804,
+0x52d80804,
+0x52d90804,
+0x52da0804,
+0x52db0804,
+0x52dc0804,
+0x52dd0804,
+0x52de0804,
+0x52df0804,
+0x52e00804,
+0x52e10804,
+0x52e20804,
+0x52e30804,
+0x52e40804,
+0x52e50804,
+0x52e60804,
+0x52e70804,
+0x52e80804,
+0x52e90804,
+0x52ea0804,
+0x52eb0804,
+0x52ec0804,
+0x52ed0804,
+0x52ee0804,
+0x52ef0804,
+0x52f00804,
+0x52f10804,
+0x52f20804,
+0x52f30804,
+0x52f40804,
+0x52f50804,
+0x52f60804,
+0x52f70804,
+0x52f80804,
+0x52f90804,
+0x52fa0804,
+0x52fb0804,
+0x52fc0804,
+0x52fd0804,
+0x52fe0804,
+0x52ff0804,
+0x53000804,
+0x53010804,
+0x53020804,
+0x53030804,
+0x53040804,
+0x53050804,
+0x53060804,
+0x53070804,
+0x53080804,
+0x53090804,
+0x530a0804,
+0x530b0804,
+0x530c0804,
+0x530d0804,
+0x530e0804,
+0x530f0804,
+0x53100804,
+0x53110804,
+0x53120804,
+0x53130804,
+0x53140804,
+0x53150804,
+0x53160804,
+0x53170804,
+0x53180804,
+0x53190804,
+0x531a0804,
+0x531b0804,
+0x531c0804,
+0x531d0804,
+0x531e0804,
+0x531f0804,
+0x53200804,
+0x53210804,
+0x53220804,
+0x53230804,
+0x53240804,
+0x53250804,
+0x53260804,
+0x53270804,
+0x53280804,
+0x53290804,
+0x532a0804,
+0x532b0804,
+0x532c0804,
+0x532d0804,
+0x532e0804,
+0x532f0804,
+0x53300804,
+0x53310804,
+0x53320804,
+0x53330804,
+0x53340804,
+0x53350804,
+0x53360804,
+0x53370804,
+0x53380804,
+0x53390804,
+0x533a0804,
+0x533b0804,
+0x533c0804,
+0x533d0804,
+0x533e0804,
+0x533f0804,
+0x53400804,
+0x53410804,
+0x53420804,
+0x53430804,
+0x53440804,
+0x53450804,
+0x53460804,
+0x53470804,
+0x53480804,
+0x53490804,
+0x534a0804,
+0x534b0804,
+0x534c0804,
+0x534d0804,
+0x534e0804,
+0x534f0804,
+0x53500804,
+0x53510804,
+0x53520804,
+0x53530804,
+0x53540804,
+0x53550804,
+0x53560804,
+0x53570804,
+0x53580804,
+0x53590804,
+0x535a0804,
+0x535b0804,
+0x535c0804,
+0x535d0804,
+0x535e0804,
+0x535f0804,
+0x53600804,
+0x53610804,
+0x53620804,
+0x53630804,
+0x53640804,
+0x53650804,
+0x53660804,
+0x53670804,
+0x53680804,
+0x53690804,
+0x536a0804,
+0x536b0804,
+0x536c0804,
+0x536d0804,
+0x536e0804,
+0x536f0804,
+0x53700804,
+0x53710804,
+0x53720804,
+0x53730804,
+0x53740804,
+0x53750804,
+0x53760804,
+0x53770804,
+0x53780804,
+0x53790804,
+0x537a0804,
+0x537b0804,
+0x537c0804,
+0x537d0804,
+0x537e0804,
+0x537f0804,
+0x53800804,
+0x53810804,
+0x53820804,
+0x53830804,
+0x53840804,
+0x53850804,
+0x53860804,
+0x53870804,
+0x53880804,
+0x53890804,
+0x538a0804,
+0x538b0804,
+0x538c0804,
+0x538d0804,
+0x538e0804,
+0x538f0804,
+0x53900804,
+0x53910804,
+0x53920804,
+0x53930804,
+0x53940804,
+0x53950804,
+0x53960804,
+0x53970804,
+0x53980804,
+0x53990804,
+0x539a0804,
+0x539b0804,
+0x539c0804,
+0x539d0804,
+0x539e0804,
+0x539f0804,
+0x53a00804,
+0x53a10804,
+0x53a20804,
+0x53a30804,
+0x53a40804,
+0x53a50804,
+0x53a60804,
+0x53a70804,
+0x53a80804,
+0x53a90804,
+0x53aa0804,
+0x53ab0804,
+0x53ac0804,
+0x53ad0804,
+0x53ae0804,
+0x53af0804,
+0x53b00804,
+0x53b10804,
+0x53b20804,
+0x53b30804,
+0x53b40804,
+0x53b50804,
+0x53b60804,
+0x53b70804,
+0x53b80804,
+0x53b90804,
+0x53ba0804,
+0x53bb0804,
+0x53bc0804,
+0x53bd0804,
+0x53be0804,
+0x53bf0804,
+0x53c00804,
+0x53c10804,
+0x53c20804,
+0x53c30804,
+0x53c40804,
+0x53c50804,
+0x53c60804,
+0x53c70804,
+0x53c80804,
+0x53c90804,
+0x53ca0804,
+0x53cb0804,
+0x53cc0804,
+0x53cd0804,
+0x53ce0804,
+0x53cf0804,
+0x53d00804,
+0x53d10804,
+0x53d20804,
+0x53d30804,
+0x53d40804,
+0x53d50804,
+0x53d60804,
+0x53d70804,
+0x53d80804,
+0x53d90804,
+0x53da0804,
+0x53db0804,
+0x53dc0804,
+0x53dd0804,
+0x53de0804,
+0x53df0804,
+0x53e00804,
+0x53e10804,
+0x53e20804,
+0x53e30804,
+0x53e40804,
+0x53e50804,
+0x53e60804,
+0x53e70804,
+0x53e80804,
+0x53e90804,
+0x53ea0804,
+0x53eb0804,
+0x53ec0804,
+0x53ed0804,
+0x53ee0804,
+0x53ef0804,
+0x53f00804,
+0x53f10804,
+0x53f20804,
+0x53f30804,
+0x53f40804,
+0x53f50804,
+0x53f60804,
+0x53f70804,
+0x53f80804,
+0x53f90804,
+0x53fa0804,
+0x53fb0804,
+0x53fc0804,
+0x53fd0804,
+0x53fe0804,
+0x53ff0804,
+0x54000804,
+0x54010804,
+0x54020804,
+0x54030804,
+0x54040804,
+0x54050804,
+0x54060804,
+0x54070804,
+0x54080804,
+0x54090804,
+0x540a0804,
+0x540b0804,
+0x540c0804,
+0x540d0804,
+0x540e0804,
+0x540f0804,
+0x54100804,
+0x54110804,
+0x54120804,
+0x54130804,
+0x54140804,
+0x54150804,
+0x54160804,
+0x54170804,
+0x54180804,
+0x54190804,
+0x541a0804,
+0x541b0804,
+0x541c0804,
+0x541d0804,
+0x541e0804,
+0x541f0804,
+0x54200804,
+0x54210804,
+0x54220804,
+0x54230804,
+0x54240804,
+0x54250804,
+0x54260804,
+0x54270804,
+0x54280804,
+0x54290804,
+0x542a0804,
+0x542b0804,
+0x542c0804,
+0x542d0804,
+0x542e0804,
+0x542f0804,
+0x54300804,
+0x54310804,
+0x54320804,
+0x54330804,
+0x54340804,
+0x54350804,
+0x54360804,
+0x54370804,
+0x54380804,
+0x54390804,
+0x543a0804,
+0x543b0804,
+0x543c0804,
+0x543d0804,
+0x543e0804,
+0x543f0804,
+0x54400804,
+0x54410804,
+0x54420804,
+0x54430804,
+0x54440804,
+0x54450804,
+0x54460804,
+0x54470804,
+0x54480804,
+0x54490804,
+0x544a0804,
+0x544b0804,
+0x544c0804,
+0x544d0804,
+0x544e0804,
+0x544f0804,
+0x54500804,
+0x54510804,
+0x54520804,
+0x54530804,
+0x54540804,
+0x54550804,
+0x54560804,
+0x54570804,
+0x54580804,
+0x54590804,
+0x545a0804,
+0x545b0804,
+0x545c0804,
+0x545d0804,
+0x545e0804,
+0x545f0804,
+0x54600804,
+0x54610804,
+0x54620804,
+0x54630804,
+0x54640804,
+0x54650804,
+0x54660804,
+0x54670804,
+0x54680804,
+0x54690804,
+0x546a0804,
+0x546b0804,
+0x546c0804,
+0x546d0804,
+0x546e0804,
+0x546f0804,
+0x54700804,
+0x54710804,
+0x54720804,
+0x54730804,
+0x54740804,
+0x54750804,
+0x54760804,
+0x54770804,
+0x54780804,
+0x54790804,
+0x547a0804,
+0x547b0804,
+0x547c0804,
+0x547d0804,
+0x547e0804,
+0x547f0804,
+0x54800804,
+0x54810804,
+0x54820804,
+0x54830804,
+0x54840804,
+0x54850804,
+0x54860804,
+0x54870804,
+0x54880804,
+0x54890804,
+0x548a0804,
+0x548b0804,
+0x548c0804,
+0x548d0804,
+0x548e0804,
+0x548f0804,
+0x54900804,
+0x54910804,
+0x54920804,
+0x54930804,
+0x54940804,
+0x54950804,
+0x54960804,
+0x54970804,
+0x54980804,
+0x54990804,
+0x549a0804,
+0x549b0804,
+0x549c0804,
+0x549d0804,
+0x549e0804,
+0x549f0804,
+0x54a00804,
+0x54a10804,
+0x54a20804,
+0x54a30804,
+0x54a40804,
+0x54a50804,
+0x54a60804,
+0x54a70804,
+0x54a80804,
+0x54a90804,
+0x54aa0804,
+0x54ab0804,
+0x54ac0804,
+0x54ad0804,
+0x54ae0804,
+0x54af0804,
+0x54b00804,
+0x54b10804,
+0x54b20804,
+0x54b30804,
+0x54b40804,
+0x54b50804,
+0x54b60804,
+0x54b70804,
+0x54b80804,
+0x54b90804,
+0x54ba0804,
+0x54bb0804,
+0x54bc0804,
+0x54bd0804,
+0x54be0804,
+0x54bf0804,
+0x54c00804,
+0x54c10804,
+0x54c20804,
+0x54c30804,
+0x54c40804,
+0x54c50804,
+0x54c60804,
+0x54c70804,
+0x54c80804,
+0x54c90804,
+0x54ca0804,
+0x54cb0804,
+0x54cc0804,
+0x54cd0804,
+0x54ce0804,
+0x54cf0804,
+0x54d00804,
+0x54d10804,
+0x54d20804,
+0x54d30804,
+0x54d40804,
+0x54d50804,
+0x54d60804,
+0x54d70804,
+0x54d80804,
+0x54d90804,
+0x54da0804,
+0x54db0804,
+0x54dc0804,
+0x54dd0804,
+0x54de0804,
+0x54df0804,
+0x54e00804,
+0x54e10804,
+0x54e20804,
+0x54e30804,
+0x54e40804,
+0x54e50804,
+0x54e60804,
+0x54e70804,
+0x54e80804,
+0x54e90804,
+0x54ea0804,
+0x54eb0804,
+0x54ec0804,
+0x54ed0804,
+0x54ee0804,
+0x54ef0804,
+0x54f00804,
+0x54f10804,
+0x54f20804,
+0x54f30804,
+0x54f40804,
+0x54f50804,
+0x54f60804,
+0x54f70804,
+0x54f80804,
+0x54f90804,
+0x54fa0804,
+0x54fb0804,
+0x54fc0804,
+0x54fd0804,
+0x54fe0804,
+0x54ff0804,
+0x55000804,
+0x55010804,
+0x55020804,
+0x55030804,
+0x55040804,
+0x55050804,
+0x55060804,
+0x55070804,
+0x55080804,
+0x55090804,
+0x550a0804,
+0x550b0804,
+0x550c0804,
+0x550d0804,
+0x550e0804,
+0x550f0804,
+0x55100804,
+0x55110804,
+0x55120804,
+0x55130804,
+0x55140804,
+0x55150804,
+0x55160804,
+0x55170804,
+0x55180804,
+0x55190804,
+0x551a0804,
+0x551b0804,
+0x551c0804,
+0x551d0804,
+0x551e0804,
+0x551f0804,
+0x55200804,
+0x55210804,
+0x55220804,
+0x55230804,
+0x55240804,
+0x55250804,
+0x55260804,
+0x55270804,
+0x55280804,
+0x55290804,
+0x552a0804,
+0x552b0804,
+0x552c0804,
+0x552d0804,
+0x552e0804,
+0x552f0804,
+0x55300804,
+0x55310804,
+0x55320804,
+0x55330804,
+0x55340804,
+0x55350804,
+0x55360804,
+0x55370804,
+0x55380804,
+0x55390804,
+0x553a0804,
+0x553b0804,
+0x553c0804,
+0x553d0804,
+0x553e0804,
+0x553f0804,
+0x55400804,
+0x55410804,
+0x55420804,
+0x55430804,
+0x55440804,
+0x55450804,
+0x55460804,
+0x55470804,
+0x55480804,
+0x55490804,
+0x554a0804,
+0x554b0804,
+0x554c0804,
+0x554d0804,
+0x554e0804,
+0x554f0804,
+0x55500804,
+0x55510804,
+0x55520804,
+0x55530804,
+0x55540804,
+0x55550804,
+0x55560804,
+0x55570804,
+0x55580804,
+0x55590804,
+0x555a0804,
+0x555b0804,
+0x555c0804,
+0x555d0804,
+0x555e0804,
+0x555f0804,
+0x55600804,
+0x55610804,
+0x55620804,
+0x55630804,
+0x55640804,
+0x55650804,
+0x55660804,
+0x55670804,
+0x55680804,
+0x55690804,
+0x556a0804,
+0x556b0804,
+0x556c0804,
+0x556d0804,
+0x556e0804,
+0x556f0804,
+0x55700804,
+0x55710804,
+0x55720804,
+0x55730804,
+0x55740804,
+0x55750804,
+0x55760804,
+0x55770804,
+0x55780804,
+0x55790804,
+0x557a0804,
+0x557b0804,
+0x557c0804,
+0x557d0804,
+0x557e0804,
+0x557f0804,
+0x55800804,
+0x55810804,
+0x55820804,
+0x55830804,
+0x55840804,
+0x55850804,
+0x55860804,
+0x55870804,
+0x55880804,
+0x55890804,
+0x558a0804,
+0x558b0804,
+0x558c0804,
+0x558d0804,
+0x558e0804,
+0x558f0804,
+0x55900804,
+0x55910804,
+0x55920804,
+0x55930804,
+0x55940804,
+0x55950804,
+0x55960804,
+0x55970804,
+0x55980804,
+0x55990804,
+0x559a0804,
+0x559b0804,
+0x559c0804,
+0x559d0804,
+0x559e0804,
+0x559f0804,
+0x55a00804,
+0x55a10804,
+0x55a20804,
+0x55a30804,
+0x55a40804,
+0x55a50804,
+0x55a60804,
+0x55a70804,
+0x55a80804,
+0x55a90804,
+0x55aa0804,
+0x55ab0804,
+0x55ac0804,
+0x55ad0804,
+0x55ae0804,
+0x55af0804,
+0x55b00804,
+0x55b10804,
+0x55b20804,
+0x55b30804,
+0x55b40804,
+0x55b50804,
+0x55b60804,
+0x55b70804,
+0x55b80804,
+0x55b90804,
+0x55ba0804,
+0x55bb0804,
+0x55bc0804,
+0x55bd0804,
+0x55be0804,
+0x55bf0804,
+0x55c00804,
+0x55c10804,
+0x55c20804,
+0x55c30804,
+0x55c40804,
+0x55c50804,
+0x55c60804,
+0x55c70804,
+0x55c80804,
+0x55c90804,
+0x55ca0804,
+0x55cb0804,
+0x55cc0804,
+0x55cd0804,
+0x55ce0804,
+0x55cf0804,
+0x55d00804,
+0x55d10804,
+0x55d20804,
+0x55d30804,
+0x55d40804,
+0x55d50804,
+0x55d60804,
+0x55d70804,
+0x55d80804,
+0x55d90804,
+0x55da0804,
+0x55db0804,
+0x55dc0804,
+0x55dd0804,
+0x55de0804,
+0x55df0804,
+0x55e00804,
+0x55e10804,
+0x55e20804,
+0x55e30804,
+0x55e40804,
+0x55e50804,
+0x55e60804,
+0x55e70804,
+0x55e80804,
+0x55e90804,
+0x55ea0804,
+0x55eb0804,
+0x55ec0804,
+0x55ed0804,
+0x55ee0804,
+0x55ef0804,
+0x55f00804,
+0x55f10804,
+0x55f20804,
+0x55f30804,
+0x55f40804,
+0x55f50804,
+0x55f60804,
+0x55f70804,
+0x55f80804,
+0x55f90804,
+0x55fa0804,
+0x55fb0804,
+0x55fc0804,
+0x55fd0804,
+0x55fe0804,
+0x55ff0804,
+0x56000804,
+0x56010804,
+0x56020804,
+0x56030804,
+0x56040804,
+0x56050804,
+0x56060804,
+0x56070804,
+0x56080804,
+0x56090804,
+0x560a0804,
+0x560b0804,
+0x560c0804,
+0x560d0804,
+0x560e0804,
+0x560f0804,
+0x56100804,
+0x56110804,
+0x56120804,
+0x56130804,
+0x56140804,
+0x56150804,
+0x56160804,
+0x56170804,
+0x56180804,
+0x56190804,
+0x561a0804,
+0x561b0804,
+0x561c0804,
+0x561d0804,
+0x561e0804,
+0x561f0804,
+0x56200804,
+0x56210804,
+0x56220804,
+0x56230804,
+0x56240804,
+0x56250804,
+0x56260804,
+0x56270804,
+0x56280804,
+0x56290804,
+0x562a0804,
+0x562b0804,
+0x562c0804,
+0x562d0804,
+0x562e0804,
+0x562f0804,
+0x56300804,
+0x56310804,
+0x56320804,
+0x56330804,
+0x56340804,
+0x56350804,
+0x56360804,
+0x56370804,
+0x56380804,
+0x56390804,
+0x563a0804,
+0x563b0804,
+0x563c0804,
+0x563d0804,
+0x563e0804,
+0x563f0804,
+0x56400804,
+0x56410804,
+0x56420804,
+0x56430804,
+0x56440804,
+0x56450804,
+0x56460804,
+0x56470804,
+0x56480804,
+0x56490804,
+0x564a0804,
+0x564b0804,
+0x564c0804,
+0x564d0804,
+0x564e0804,
+0x564f0804,
+0x56500804,
+0x56510804,
+0x56520804,
+0x56530804,
+0x56540804,
+0x56550804,
+0x56560804,
+0x56570804,
+0x56580804,
+0x56590804,
+0x565a0804,
+0x565b0804,
+0x565c0804,
+0x565d0804,
+0x565e0804,
+0x565f0804,
+0x56600804,
+0x56610804,
+0x56620804,
+0x56630804,
+0x56640804,
+0x56650804,
+0x56660804,
+0x56670804,
+0x56680804,
+0x56690804,
+0x566a0804,
+0x566b0804,
+0x566c0804,
+0x566d0804,
+0x566e0804,
+0x566f0804,
+0x56700804,
+0x56710804,
+0x56720804,
+0x56730804,
+0x56740804,
+0x56750804,
+0x56760804,
+0x56770804,
+0x56780804,
+0x56790804,
+0x567a0804,
+0x567b0804,
+0x567c0804,
+0x567d0804,
+0x567e0804,
+0x567f0804,
+0x56800804,
+0x56810804,
+0x56820804,
+0x56830804,
+0x56840804,
+0x56850804,
+0x56860804,
+0x56870804,
+0x56880804,
+0x56890804,
+0x568a0804,
+0x568b0804,
+0x568c0804,
+0x568d0804,
+0x568e0804,
+0x568f0804,
+0x56900804,
+0x56910804,
+0x56920804,
+0x56930804,
+0x56940804,
+0x56950804,
+0x56960804,
+0x56970804,
+0x56980804,
+0x56990804,
+0x569a0804,
+0x569b0804,
+0x569c0804,
+0x569d0804,
+0x569e0804,
+0x569f0804,
+0x56a00804,
+0x56a10804,
+0x56a20804,
+0x56a30804,
+0x56a40804,
+0x56a50804,
+0x56a60804,
+0x56a70804,
+0x56a80804,
+0x56a90804,
+0x56aa0804,
+0x56ab0804,
+0x56ac0804,
+0x56ad0804,
+0x56ae0804,
+0x56af0804,
+0x56b00804,
+0x56b10804,
+0x56b20804,
+0x56b30804,
+0x56b40804,
+0x56b50804,
+0x56b60804,
+0x56b70804,
+0x56b80804,
+0x56b90804,
+0x56ba0804,
+0x56bb0804,
+0x56bc0804,
+0x56bd0804,
+0x56be0804,
+0x56bf0804,
+0x56c00804,
+0x56c10804,
+0x56c20804,
+0x56c30804,
+0x56c40804,
+0x56c50804,
+0x56c60804,
+0x56c70804,
+0x56c80804,
+0x56c90804,
+0x56ca0804,
+0x56cb0804,
+0x56cc0804,
+0x56cd0804,
+0x56ce0804,
+0x56cf0804,
+0x56d00804,
+0x56d10804,
+0x56d20804,
+0x56d30804,
+0x56d40804,
+0x56d50804,
+0x56d60804,
+0x56d70804,
+0x56d80804,
+0x56d90804,
+0x56da0804,
+0x56db0804,
+0x56dc0804,
+0x56dd0804,
+0x56de0804,
+0x56df0804,
+0x56e00804,
+0x56e10804,
+0x56e20804,
+0x56e30804,
+0x56e40804,
+0x56e50804,
+0x56e60804,
+0x56e70804,
+0x56e80804,
+0x56e90804,
+0x56ea0804,
+0x56eb0804,
+0x56ec0804,
+0x56ed0804,
+0x56ee0804,
+0x56ef0804,
+0x56f00804,
+0x56f10804,
+0x56f20804,
+0x56f30804,
+0x56f40804,
+0x56f50804,
+0x56f60804,
+0x56f70804,
+0x56f80804,
+0x56f90804,
+0x56fa0804,
+0x56fb0804,
+0x56fc0804,
+0x56fd0804,
+0x56fe0804,
+0x56ff0804,
+0x57000804,
+0x57010804,
+0x57020804,
+0x57030804,
+0x57040804,
+0x57050804,
+0x57060804,
+0x57070804,
+0x57080804,
+0x57090804,
+0x570a0804,
+0x570b0804,
+0x570c0804,
+0x570d0804,
+0x570e0804,
+0x570f0804,
+0x57100804,
+0x57110804,
+0x57120804,
+0x57130804,
+0x57140804,
+0x57150804,
+0x57160804,
+0x57170804,
+0x57180804,
+0x57190804,
+0x571a0804,
+0x571b0804,
+0x571c0804,
+0x571d0804,
+0x571e0804,
+0x571f0804,
+0x57200804,
+0x57210804,
+0x57220804,
+0x57230804,
+0x57240804,
+0x57250804,
+0x57260804,
+0x57270804,
+0x57280804,
+0x57290804,
+0x572a0804,
+0x572b0804,
+0x572c0804,
+0x572d0804,
+0x572e0804,
+0x572f0804,
+0x57300804,
+0x57310804,
+0x57320804,
+0x57330804,
+0x57340804,
+0x57350804,
+0x57360804,
+0x57370804,
+0x57380804,
+0x57390804,
+0x573a0804,
+0x573b0804,
+0x573c0804,
+0x573d0804,
+0x573e0804,
+0x573f0804,
+0x57400804,
+0x57410804,
+0x57420804,
+0x57430804,
+0x57440804,
+0x57450804,
+0x57460804,
+0x57470804,
+0x57480804,
+0x57490804,
+0x574a0804,
+0x574b0804,
+0x574c0804,
+0x574d0804,
+0x574e0804,
+0x574f0804,
+0x57500804,
+0x57510804,
+0x57520804,
+0x57530804,
+0x57540804,
+0x57550804,
+0x57560804,
+0x57570804,
+0x57580804,
+0x57590804,
+0x575a0804,
+0x575b0804,
+0x575c0804,
+0x575d0804,
+0x575e0804,
+0x575f0804,
+0x57600804,
+0x57610804,
+0x57620804,
+0x57630804,
+0x57640804,
+0x57650804,
+0x57660804,
+0x57670804,
+0x57680804,
+0x57690804,
+0x576a0804,
+0x576b0804,
+0x576c0804,
+0x576d0804,
+0x576e0804,
+0x576f0804,
+0x57700804,
+0x57710804,
+0x57720804,
+0x57730804,
+0x57740804,
+0x57750804,
+0x57760804,
+0x57770804,
+0x57780804,
+0x57790804,
+0x577a0804,
+0x577b0804,
+0x577c0804,
+0x577d0804,
+0x577e0804,
+0x577f0804,
+0x57800804,
+0x57810804,
+0x57820804,
+0x57830804,
+0x57840804,
+0x57850804,
+0x57860804,
+0x57870804,
+0x57880804,
+0x57890804,
+0x578a0804,
+0x578b0804,
+0x578c0804,
+0x578d0804,
+0x578e0804,
+0x578f0804,
+0x57900804,
+0x57910804,
+0x57920804,
+0x57930804,
+0x57940804,
+0x57950804,
+0x57960804,
+0x57970804,
+0x57980804,
+0x57990804,
+0x579a0804,
+0x579b0804,
+0x579c0804,
+0x579d0804,
+0x579e0804,
+0x579f0804,
+0x57a00804,
+0x57a10804,
+0x57a20804,
+0x57a30804,
+0x57a40804,
+0x57a50804,
+0x57a60804,
+0x57a70804,
+0x57a80804,
+0x57a90804,
+0x57aa0804,
+0x57ab0804,
+0x57ac0804,
+0x57ad0804,
+0x57ae0804,
+0x57af0804,
+0x57b00804,
+0x57b10804,
+0x57b20804,
+0x57b30804,
+0x57b40804,
+0x57b50804,
+0x57b60804,
+0x57b70804,
+0x57b80804,
+0x57b90804,
+0x57ba0804,
+0x57bb0804,
+0x57bc0804,
+0x57bd0804,
+0x57be0804,
+0x57bf0804,
+0x57c00804,
+0x57c10804,
+0x57c20804,
+0x57c30804,
+0x57c40804,
+0x57c50804,
+0x57c60804,
+0x57c70804,
+0x57c80804,
+0x57c90804,
+0x57ca0804,
+0x57cb0804,
+0x57cc0804,
+0x57cd0804,
+0x57ce0804,
+0x57cf0804,
+0x57d00804,
+0x57d10804,
+0x57d20804,
+0x57d30804,
+0x57d40804,
+0x57d50804,
+0x57d60804,
+0x57d70804,
+0x57d80804,
+0x57d90804,
+0x57da0804,
+0x57db0804,
+0x57dc0804,
+0x57dd0804,
+0x57de0804,
+0x57df0804,
+0x57e00804,
+0x57e10804,
+0x57e20804,
+0x57e30804,
+0x57e40804,
+0x57e50804,
+0x57e60804,
+0x57e70804,
+0x57e80804,
+0x57e90804,
+0x57ea0804,
+0x57eb0804,
+0x57ec0804,
+0x57ed0804,
+0x57ee0804,
+0x57ef0804,
+0x57f00804,
+0x57f10804,
+0x57f20804,
+0x57f30804,
+0x57f40804,
+0x57f50804,
+0x57f60804,
+0x57f70804,
+0x57f80804,
+0x57f90804,
+0x57fa0804,
+0x57fb0804,
+0x57fc0804,
+0x57fd0804,
+0x57fe0804,
+0x57ff0804,
+0x58000804,
+0x58010804,
+0x58020804,
+0x58030804,
+0x58040804,
+0x58050804,
+0x58060804,
+0x58070804,
+0x58080804,
+0x58090804,
+0x580a0804,
+0x580b0804,
+0x580c0804,
+0x580d0804,
+0x580e0804,
+0x580f0804,
+0x58100804,
+0x58110804,
+0x58120804,
+0x58130804,
+0x58140804,
+0x58150804,
+0x58160804,
+0x58170804,
+0x58180804,
+0x58190804,
+0x581a0804,
+0x581b0804,
+0x581c0804,
+0x581d0804,
+0x581e0804,
+0x581f0804,
+0x58200804,
+0x58210804,
+0x58220804,
+0x58230804,
+0x58240804,
+0x58250804,
+0x58260804,
+0x58270804,
+0x58280804,
+0x58290804,
+0x582a0804,
+0x582b0804,
+0x582c0804,
+0x582d0804,
+0x582e0804,
+0x582f0804,
+0x58300804,
+0x58310804,
+0x58320804,
+0x58330804,
+0x58340804,
+0x58350804,
+0x58360804,
+0x58370804,
+0x58380804,
+0x58390804,
+0x583a0804,
+0x583b0804,
+0x583c0804,
+0x583d0804,
+0x583e0804,
+0x583f0804,
+0x58400804,
+0x58410804,
+0x58420804,
+0x58430804,
+0x58440804,
+0x58450804,
+0x58460804,
+0x58470804,
+0x58480804,
+0x58490804,
+0x584a0804,
+0x584b0804,
+0x584c0804,
+0x584d0804,
+0x584e0804,
+0x584f0804,
+0x58500804,
+0x58510804,
+0x58520804,
+0x58530804,
+0x58540804,
+0x58550804,
+0x58560804,
+0x58570804,
+0x58580804,
+0x58590804,
+0x585a0804,
+0x585b0804,
+0x585c0804,
+0x585d0804,
+0x585e0804,
+0x585f0804,
+0x58600804,
+0x58610804,
+0x58620804,
+0x58630804,
+0x58640804,
+0x58650804,
+0x58660804,
+0x58670804,
+0x58680804,
+0x58690804,
+0x586a0804,
+0x586b0804,
+0x586c0804,
+0x586d0804,
+0x586e0804,
+0x586f0804,
+0x58700804,
+0x58710804,
+0x58720804,
+0x58730804,
+0x58740804,
+0x58750804,
+0x58760804,
+0x58770804,
+0x58780804,
+0x58790804,
+0x587a0804,
+0x587b0804,
+0x587c0804,
+0x587d0804,
+0x587e0804,
+0x587f0804,
+0x58800804,
+0x58810804,
+0x58820804,
+0x58830804,
+0x58840804,
+0x58850804,
+0x58860804,
+0x58870804,
+0x58880804,
+0x58890804,
+0x588a0804,
+0x588b0804,
+0x588c0804,
+0x588d0804,
+0x588e0804,
+0x588f0804,
+0x58900804,
+0x58910804,
+0x58920804,
+0x58930804,
+0x58940804,
+0x58950804,
+0x58960804,
+0x58970804,
+0x58980804,
+0x58990804,
+0x589a0804,
+0x589b0804,
+0x589c0804,
+0x589d0804,
+0x589e0804,
+0x589f0804,
+0x58a00804,
+0x58a10804,
+0x58a20804,
+0x58a30804,
+0x58a40804,
+0x58a50804,
+0x58a60804,
+0x58a70804,
+0x58a80804,
+0x58a90804,
+0x58aa0804,
+0x58ab0804,
+0x58ac0804,
+0x58ad0804,
+0x58ae0804,
+0x58af0804,
+0x58b00804,
+0x58b10804,
+0x58b20804,
+0x58b30804,
+0x58b40804,
+0x58b50804,
+0x58b60804,
+0x58b70804,
+0x58b80804,
+0x58b90804,
+0x58ba0804,
+0x58bb0804,
+0x58bc0804,
+0x58bd0804,
+0x58be0804,
+0x58bf0804,
+0x58c00804,
+0x58c10804,
+0x58c20804,
+0x58c30804,
+0x58c40804,
+0x58c50804,
+0x58c60804,
+0x58c70804,
+0x58c80804,
+0x58c90804,
+0x58ca0804,
+0x58cb0804,
+0x58cc0804,
+0x58cd0804,
+0x58ce0804,
+0x58cf0804,
+0x58d00804,
+0x58d10804,
+0x58d20804,
+0x58d30804,
+0x58d40804,
+0x58d50804,
+0x58d60804,
+0x58d70804,
+0x58d80804,
+0x58d90804,
+0x58da0804,
+0x58db0804,
+0x58dc0804,
+0x58dd0804,
+0x58de0804,
+0x58df0804,
+0x58e00804,
+0x58e10804,
+0x58e20804,
+0x58e30804,
+0x58e40804,
+0x58e50804,
+0x58e60804,
+0x58e70804,
+0x58e80804,
+0x58e90804,
+0x58ea0804,
+0x58eb0804,
+0x58ec0804,
+0x58ed0804,
+0x58ee0804,
+0x58ef0804,
+0x58f00804,
+0x58f10804,
+0x58f20804,
+0x58f30804,
+0x58f40804,
+0x58f50804,
+0x58f60804,
+0x58f70804,
+0x58f80804,
+0x58f90804,
+0x58fa0804,
+0x58fb0804,
+0x58fc0804,
+0x58fd0804,
+0x58fe0804,
+0x58ff0804,
+0x59000804,
+0x59010804,
+0x59020804,
+0x59030804,
+0x59040804,
+0x59050804,
+0x59060804,
+0x59070804,
+0x59080804,
+0x59090804,
+0x590a0804,
+0x590b0804,
+0x590c0804,
+0x590d0804,
+0x590e0804,
+0x590f0804,
+0x59100804,
+0x59110804,
+0x59120804,
+0x59130804,
+0x59140804,
+0x59150804,
+0x59160804,
+0x59170804,
+0x59180804,
+0x59190804,
+0x591a0804,
+0x591b0804,
+0x591c0804,
+0x591d0804,
+0x591e0804,
+0x591f0804,
+0x59200804,
+0x59210804,
+0x59220804,
+0x59230804,
+0x59240804,
+0x59250804,
+0x59260804,
+0x59270804,
+0x59280804,
+0x59290804,
+0x592a0804,
+0x592b0804,
+0x592c0804,
+0x592d0804,
+0x592e0804,
+0x592f0804,
+0x59300804,
+0x59310804,
+0x59320804,
+0x59330804,
+0x59340804,
+0x59350804,
+0x59360804,
+0x59370804,
+0x59380804,
+0x59390804,
+0x593a0804,
+0x593b0804,
+0x593c0804,
+0x593d0804,
+0x593e0804,
+0x593f0804,
+0x59400804,
+0x59410804,
+0x59420804,
+0x59430804,
+0x59440804,
+0x59450804,
+0x59460804,
+0x59470804,
+0x59480804,
+0x59490804,
+0x594a0804,
+0x594b0804,
+0x594c0804,
+0x594d0804,
+0x594e0804,
+0x594f0804,
+0x59500804,
+0x59510804,
+0x59520804,
+0x59530804,
+0x59540804,
+0x59550804,
+0x59560804,
+0x59570804,
+0x59580804,
+0x59590804,
+0x595a0804,
+0x595b0804,
+0x595c0804,
+0x595d0804,
+0x595e0804,
+0x595f0804,
+0x59600804,
+0x59610804,
+0x59620804,
+0x59630804,
+0x59640804,
+0x59650804,
+0x59660804,
+0x59670804,
+0x59680804,
+0x59690804,
+0x596a0804,
+0x596b0804,
+0x596c0804,
+0x596d0804,
+0x596e0804,
+0x596f0804,
+0x59700804,
+0x59710804,
+0x59720804,
+0x59730804,
+0x59740804,
+0x59750804,
+0x59760804,
+0x59770804,
+0x59780804,
+0x59790804,
+0x597a0804,
+0x597b0804,
+0x597c0804,
+0x597d0804,
+0x597e0804,
+0x597f0804,
+0x59800804,
+0x59810804,
+0x59820804,
+0x59830804,
+0x59840804,
+0x59850804,
+0x59860804,
+0x59870804,
+0x59880804,
+0x59890804,
+0x598a0804,
+0x598b0804,
+0x598c0804,
+0x598d0804,
+0x598e0804,
+0x598f0804,
+0x59900804,
+0x59910804,
+0x59920804,
+0x59930804,
+0x59940804,
+0x59950804,
+0x59960804,
+0x59970804,
+0x59980804,
+0x59990804,
+0x599a0804,
+0x599b0804,
+0x599c0804,
+0x599d0804,
+0x599e0804,
+0x599f0804,
+0x59a00804,
+0x59a10804,
+0x59a20804,
+0x59a30804,
+0x59a40804,
+0x59a50804,
+0x59a60804,
+0x59a70804,
+0x59a80804,
+0x59a90804,
+0x59aa0804,
+0x59ab0804,
+0x59ac0804,
+0x59ad0804,
+0x59ae0804,
+0x59af0804,
+0x59b00804,
+0x59b10804,
+0x59b20804,
+0x59b30804,
+0x59b40804,
+0x59b50804,
+0x59b60804,
+0x59b70804,
+0x59b80804,
+0x59b90804,
+0x59ba0804,
+0x59bb0804,
+0x59bc0804,
+0x59bd0804,
+0x59be0804,
+0x59bf0804,
+0x59c00804,
+0x59c10804,
+0x59c20804,
+0x59c30804,
+0x59c40804,
+0x59c50804,
+0x59c60804,
+0x59c70804,
+0x59c80804,
+0x59c90804,
+0x59ca0804,
+0x59cb0804,
+0x59cc0804,
+0x59cd0804,
+0x59ce0804,
+0x59cf0804,
+0x59d00804,
+0x59d10804,
+0x59d20804,
+0x59d30804,
+0x59d40804,
+0x59d50804,
+0x59d60804,
+0x59d60808,
+0x4608,
+0x59d70804,
+0x59d70808,
+0x4608,
+0x59d80804,
+0x59d80808,
+0x4608,
+0x59d90804,
+0x59d90808,
+0x4608,
+0x59da0804,
+0x59da0808,
+0x4608,
+0x59db0804,
+0x59db0808,
+0x4608,
+0x59dc0804,
+0x59dc0808,
+0x4608,
+0x59dc0808,
+0x4648,
+0x59dd0804,
+0x59dd0808,
+0x4608,
+0x59de0804,
+0x59de0808,
+0x4608,
+0x59df0804,
+0x59df0808,
+0x4608,
+0x59df0808,
+0x4648,
+0x59e00804,
+0x59e00808,
+0x4608,
+0x59e00808,
+0x4648,
+0x59e10804,
+0x59e10808,
+0x4608,
+0x59e10808,
+0x4648,
+0x59e20804,
+0x59e20808,
+0x4608,
+0x59e30804,
+0x59e30808,
+0x4608,
+0x59e40804,
+0x59e40808,
+0x4608,
+0x59e50804,
+0x59e50808,
+0x4608,
+0x59e50808,
+0x4648,
+0x59e50808,
+0x4688,
+0x59e60804,
+0x59e60808,
+0x4608,
+0x59e70804,
+0x59e70808,
+0x4608,
+0x59e80804,
+0x59e80808,
+0x4608,
+0x59e90804,
+0x59e90808,
+0x4608,
+0x59e90808,
+0x4648,
+0x59ea0804,
+0x59ea0808,
+0x4608,
+0x59ea0808,
+0x4648,
+0x59eb0804,
+0x59eb0808,
+0x4608,
+0x59ec0804,
+0x59ec0808,
+0x4608,
+0x59ed0804,
+0x59ee0804,
+0x59ef0804,
+0x59f00804,
+0x59f10804,
+0x59f20804,
+0x59f30804,
+0x59f40804,
+0x59f50804,
+0x59f60804,
+0x59f70804,
+0x59f80804,
+0x59f90804,
+0x59fa0804,
+0x59fb0804,
+0x59fc0804,
+0x59fd0804,
+0x59fe0804,
+0x59ff0804,
+0x5a000804,
+0x5a010804,
+0x5a020804,
+0x5a030804,
+0x5a040804,
+0x5a050804,
+0x5a060804,
+0x5a070804,
+0x5a080804,
+0x5a090804,
+0x5a0a0804,
+0x5a0b0804,
+0x5a0c0804,
+0x5a0d0804,
+0x5a0e0804,
+0x5a0f0804,
+0x5a100804,
+0x5a110804,
+0x5a120804,
+0x5a130804,
+0x5a140804,
+0x5a150804,
+0x5a160804,
+0x5a170804,
+0x5a180804,
+0x5a190804,
+0x5a1a0804,
+0x5a1b0804,
+0x5a1c0804,
+0x5a1d0804,
+0x5a1e0804,
+0x5a1f0804,
+0x5a200804,
+0x5a210804,
+0x5a220804,
+0x5a230804,
+0x5a240804,
+0x5a250804,
+0x5a260804,
+0x5a270804,
+0x5a280804,
+0x5a290804,
+0x5a2a0804,
+0x5a2b0804,
+0x5a2c0804,
+0x5a2d0804,
+0x5a2e0804,
+0x5a2f0804,
+0x5a300804,
+0x5a310804,
+0x5a320804,
+0x5a330804,
+0x5a340804,
+0x5a350804,
+0x5a360804,
+0x5a370804,
+0x5a380804,
+0x5a390804,
+0x5a3a0804,
+0x5a3b0804,
+0x5a3c0804,
+0x5a3d0804,
+0x5a3e0804,
+0x5a3f0804,
+0x5a400804,
+0x5a410804,
+0x5a420804,
+0x5a430804,
+0x5a440804,
+0x5a450804,
+0x5a460804,
+0x5a470804,
+0x5a480804,
+0x5a490804,
+0x5a4a0804,
+0x5a4b0804,
+0x5a4c0804,
+0x5a4d0804,
+0x5a4e0804,
+0x5a4f0804,
+0x5a500804,
+0x5a510804,
+0x5a520804,
+0x5a530804,
+0x5a540804,
+0x5a550804,
+0x5a560804,
+0x5a570804,
+0x5a580804,
+0x5a590804,
+0x5a5a0804,
+0x5a5b0804,
+0x5a5c0804,
+0x5a5d0804,
+0x5a5e0804,
+0x5a5f0804,
+0x5a600804,
+0x5a610804,
+0x5a620804,
+0x5a630804,
+0x5a640804,
+0x5a650804,
+0x5a660804,
+0x5a670804,
+0x5a680804,
+0x5a690804,
+0x5a6a0804,
+0x5a6b0804,
+0x5a6c0804,
+0x5a6d0804,
+0x5a6e0804,
+0x5a6f0804,
+0x5a700804,
+0x5a710804,
+0x5a720804,
+0x5a730804,
+0x5a740804,
+0x5a750804,
+0x5a760804,
+0x5a770804,
+0x5a780804,
+0x5a790804,
+0x5a7a0804,
+0x5a7b0804,
+0x5a7c0804,
+0x5a7d0804,
+0x5a7e0804,
+0x5a7f0804,
+0x5a800804,
+0x5a810804,
+0x5a820804,
+0x5a830804,
+0x5a840804,
+0x5a850804,
+0x5a860804,
+0x5a870804,
+0x5a880804,
+0x5a890804,
+0x5a8a0804,
+0x5a8b0804,
+0x5a8c0804,
+0x5a8d0804,
+0x5a8e0804,
+0x5a8f0804,
+0x5a900804,
+0x5a910804,
+0x5a920804,
+0x5a930804,
+0x5a940804,
+0x5a950804,
+0x5a960804,
+0x5a970804,
+0x5a980804,
+0x5a990804,
+0x5a9a0804,
+0x5a9b0804,
+0x5a9c0804,
+0x5a9d0804,
+0x5a9e0804,
+0x5a9f0804,
+0x5aa00804,
+0x5aa10804,
+0x5aa20804,
+0x5aa30804,
+0x5aa40804,
+0x5aa50804,
+0x5aa60804,
+0x5aa70804,
+0x5aa80804,
+0x5aa90804,
+0x5aaa0804,
+0x5aab0804,
+0x5aac0804,
+0x5aad0804,
+0x5aae0804,
+0x5aaf0804,
+0x5ab00804,
+0x5ab10804,
+0x5ab20804,
+0x5ab30804,
+0x5ab40804,
+0x5ab50804,
+0x5ab60804,
+0x5ab70804,
+0x5ab80804,
+0x5ab90804,
+0x5aba0804,
+0x5abb0804,
+0x5abc0804,
+0x5abd0804,
+0x5abe0804,
+0x5abf0804,
+0x5ac00804,
+0x5ac10804,
+0x5ac20804,
+0x5ac30804,
+0x5ac40804,
+0x5ac50804,
+0x5ac60804,
+0x5ac70804,
+0x5ac80804,
+0x5ac90804,
+0x5aca0804,
+0x5acb0804,
+0x5acc0804,
+0x5acd0804,
+0x5ace0804,
+0x5acf0804,
+0x5ad00804,
+0x5ad10804,
+0x5ad20804,
+0x5ad30804,
+0x5ad40804,
+0x5ad50804,
+0x5ad60804,
+0x5ad70804,
+0x5ad80804,
+0x5ad90804,
+0x5ada0804,
+0x5adb0804,
+0x5adc0804,
+0x5add0804,
+0x5ade0804,
+0x5adf0804,
+0x5ae00804,
+0x5ae10804,
+0x5ae20804,
+0x5ae30804,
+0x5ae40804,
+0x5ae50804,
+0x5ae60804,
+0x5ae70804,
+0x5ae80804,
+0x5ae90804,
+0x5aea0804,
+0x5aeb0804,
+0x5aec0804,
+0x5aed0804,
+0x5aee0804,
+0x5aef0804,
+0x5af00804,
+0x5af10804,
+0x5af20804,
+0x5af30804,
+0x5af40804,
+0x5af50804,
+0x5af60804,
+0x5af70804,
+0x5af80804,
+0x5af90804,
+0x5afa0804,
+0x5afb0804,
+0x5afc0804,
+0x5afd0804,
+0x5afe0804,
+0x5aff0804,
+0x5b000804,
+0x5b010804,
+0x5b020804,
+0x5b030804,
+0x5b040804,
+0x5b050804,
+0x5b060804,
+0x5b070804,
+0x5b080804,
+0x5b090804,
+0x5b0a0804,
+0x5b0b0804,
+0x5b0c0804,
+0x5b0d0804,
+0x5b0e0804,
+0x5b0f0804,
+0x5b100804,
+0x5b110804,
+0x5b120804,
+0x5b130804,
+0x5b140804,
+0x5b150804,
+0x5b160804,
+0x5b170804,
+0x5b180804,
+0x5b190804,
+0x5b1a0804,
+0x5b1b0804,
+0x5b1c0804,
+0x5b1d0804,
+0x5b1e0804,
+0x5b1f0804,
+0x5b200804,
+0x5b210804,
+0x5b220804,
+0x5b230804,
+0x5b240804,
+0x5b250804,
+0x5b260804,
+0x5b270804,
+0x5b280804,
+0x5b290804,
+0x5b2a0804,
+0x5b2b0804,
+0x5b2c0804,
+0x5b2d0804,
+0x5b2e0804,
+0x5b2f0804,
+0x5b300804,
+0x5b310804,
+0x5b320804,
+0x5b330804,
+0x5b340804,
+0x5b350804,
+0x5b360804,
+0x5b370804,
+0x5b380804,
+0x5b390804,
+0x5b3a0804,
+0x5b3b0804,
+0x5b3c0804,
+0x5b3d0804,
+0x5b3e0804,
+0x5b3f0804,
+0x5b400804,
+0x5b410804,
+0x5b420804,
+0x5b430804,
+0x5b440804,
+0x5b450804,
+0x5b460804,
+0x5b470804,
+0x5b480804,
+0x5b490804,
+0x5b4a0804,
+0x5b4b0804,
+0x5b4c0804,
+0x5b4d0804,
+0x5b4e0804,
+0x5b4f0804,
+0x5b500804,
+0x5b510804,
+0x5b520804,
+0x5b530804,
+0x5b540804,
+0x5b550804,
+0x5b560804,
+0x5b570804,
+0x5b580804,
+0x5b590804,
+0x5b5a0804,
+0x5b5b0804,
+0x5b5c0804,
+0x5b5d0804,
+0x5b5e0804,
+0x5b5f0804,
+0x5b600804,
+0x5b610804,
+0x5b620804,
+0x5b630804,
+0x5b640804,
+0x5b650804,
+0x5b660804,
+0x5b670804,
+0x5b680804,
+0x5b690804,
+0x5b6a0804,
+0x5b6b0804,
+0x5b6c0804,
+0x5b6d0804,
+0x5b6e0804,
+0x5b6f0804,
+0x5b700804,
+0x5b710804,
+0x5b720804,
+0x5b730804,
+0x5b740804,
+0x5b750804,
+0x5b760804,
+0x5b770804,
+0x5b780804,
+0x5b790804,
+0x5b7a0804,
+0x5b7b0804,
+0x5b7c0804,
+0x5b7d0804,
+0x5b7e0804,
+0x5b7f0804,
+0x5b800804,
+0x5b810804,
+0x5b820804,
+0x5b830804,
+0x5b840804,
+0x5b850804,
+0x5b860804,
+0x5b870804,
+0x5b880804,
+0x5b890804,
+0x5b8a0804,
+0x5b8b0804,
+0x5b8c0804,
+0x5b8d0804,
+0x5b8e0804,
+0x5b8f0804,
+0x5b900804,
+0x5b910804,
+0x5b920804,
+0x5b930804,
+0x5b940804,
+0x5b950804,
+0x5b960804,
+0x5b970804,
+0x5b980804,
+0x5b990804,
+0x5b9a0804,
+0x5b9b0804,
+0x5b9c0804,
+0x5b9d0804,
+0x5b9e0804,
+0x5b9f0804,
+0x5ba00804,
+0x5ba10804,
+0x5ba20804,
+0x5ba30804,
+0x5ba40804,
+0x5ba50804,
+0x5ba60804,
+0x5ba70804,
+0x5ba80804,
+0x5ba90804,
+0x5baa0804,
+0x5bab0804,
+0x5bac0804,
+0x5bad0804,
+0x5bae0804,
+0x5baf0804,
+0x5bb00804,
+0x5bb10804,
+0x5bb20804,
+0x5bb30804,
+0x5bb40804,
+0x5bb50804,
+0x5bb60804,
+0x5bb70804,
+0x5bb80804,
+0x5bb90804,
+0x5bba0804,
+0x5bbb0804,
+0x5bbc0804,
+0x5bbd0804,
+0x5bbe0804,
+0x5bbf0804,
+0x5bc00804,
+0x5bc10804,
+0x5bc20804,
+0x5bc30804,
+0x5bc40804,
+0x5bc50804,
+0x5bc60804,
+0x5bc70804,
+0x5bc80804,
+0x5bc90804,
+0x5bca0804,
+0x5bcb0804,
+0x5bcc0804,
+0x5bcd0804,
+0x5bce0804,
+0x5bcf0804,
+0x5bd00804,
+0x5bd10804,
+0x5bd20804,
+0x5bd30804,
+0x5bd40804,
+0x5bd50804,
+0x5bd60804,
+0x5bd70804,
+0x5bd80804,
+0x5bd90804,
+0x5bda0804,
+0x5bdb0804,
+0x5bdc0804,
+0x5bdd0804,
+0x5bde0804,
+0x5bdf0804,
+0x5be00804,
+0x5be10804,
+0x5be20804,
+0x5be30804,
+0x5be40804,
+0x5be50804,
+0x5be60804,
+0x5be70804,
+0x5be80804,
+0x5be90804,
+0x5bea0804,
+0x5beb0804,
+0x5bec0804,
+0x5bed0804,
+0x5bee0804,
+0x5bef0804,
+0x5bf00804,
+0x5bf10804,
+0x5bf20804,
+0x5bf30804,
+0x5bf40804,
+0x5bf50804,
+0x5bf60804,
+0x5bf70804,
+0x5bf80804,
+0x5bf90804,
+0x5bfa0804,
+0x5bfb0804,
+0x5bfc0804,
+0x5bfd0804,
+0x5bfe0804,
+0x5bff0804,
+0x5c000804,
+0x5c010804,
+0x5c020804,
+0x5c030804,
+0x5c040804,
+0x5c050804,
+0x5c060804,
+0x5c070804,
+0x5c080804,
+0x5c090804,
+0x5c0a0804,
+0x5c0b0804,
+0x5c0c0804,
+0x5c0d0804,
+0x5c0e0804,
+0x5c0f0804,
+0x5c100804,
+0x5c110804,
+0x5c120804,
+0x5c130804,
+0x5c140804,
+0x5c150804,
+0x5c160804,
+0x5c170804,
+0x5c180804,
+0x5c190804,
+0x5c1a0804,
+0x5c1b0804,
+0x5c1c0804,
+0x5c1d0804,
+0x5c1e0804,
+0x5c1f0804,
+0x5c200804,
+0x5c210804,
+0x5c220804,
+0x5c230804,
+0x5c240804,
+0x5c250804,
+0x5c260804,
+0x5c270804,
+0x5c280804,
+0x5c290804,
+0x5c2a0804,
+0x5c2b0804,
+0x5c2c0804,
+0x5c2d0804,
+0x5c2e0804,
+0x5c2f0804,
+0x5c300804,
+0x5c310804,
+0x5c320804,
+0x5c330804,
+0x5c340804,
+0x5c350804,
+0x5c360804,
+0x5c370804,
+0xfb400808,
+0xce000000,
+0x3280809,
+0xfb400808,
+0xce000000,
+0x3290809,
+0xfb40080c,
+0xce000000,
+0xfb400828,
+0xce000000,
+0xfb400838,
+0xce000000,
+0xfb400828,
+0xce010000,
+0x3280809,
+0xfb400808,
+0xce030000,
+0x3290809,
+0xfb40080c,
+0xce030000,
+0x3280809,
+0xfb400808,
+0xce090000,
+0x3290809,
+0x38a0809,
+0xfb400808,
+0xce090000,
+0x38b0809,
+0xfb40080c,
+0xce090000,
+0xfb400828,
+0xce090000,
+0xfb400838,
+0xce090000,
+0xfb40080c,
+0xce0a0000,
+0xfb400828,
+0xce0a0000,
+0xfb40080c,
+0xce0b0000,
+0xfb400828,
+0xce0b0000,
+0xfb400804,
+0xce0d0000,
+0xfb400828,
+0xce190000,
+0xfb400804,
+0xce260000,
+0xfb400808,
+0xce280000,
+0xfb400808,
+0xce2c0000,
+0xfb40080c,
+0xce2d0000,
+0xfb400828,
+0xce2d0000,
+0xfb400838,
+0xce2d0000,
+0xfb400804,
+0xce320000,
+0xfb400808,
+0xce360000,
+0xfb400808,
+0xce360000,
+0x4608,
+0xfb400804,
+0xce380000,
+0xfb400804,
+0xce390000,
+0xfb400804,
+0xce3d0000,
+0xfb400808,
+0xce3f0000,
+0xfb400804,
+0xce410000,
+0xfb400808,
+0xce590000,
+0xfb400828,
+0xce590000,
+0xfb400808,
+0xce590000,
+0x4608,
+0xfb400808,
+0xce5a0000,
+0xfb400808,
+0xce5b0000,
+0x3280809,
+0xfb400808,
+0xce5d0000,
+0x3290809,
+0xfb40080c,
+0xce5d0000,
+0xfb400804,
+0xce820000,
+0xfb400808,
+0xce850000,
+0xfb400804,
+0xce860000,
+0xfb400808,
+0xce8c0000,
+0x3280809,
+0xfb400808,
+0xce8c0000,
+0x3290809,
+0x38a0809,
+0xfb400808,
+0xce8c0000,
+0x38b0809,
+0xfb40080c,
+0xce8c0000,
+0xfb400828,
+0xce8c0000,
+0xfb400838,
+0xce8c0000,
+0x3280809,
+0xfb400808,
+0xce940000,
+0x3290809,
+0xfb40080c,
+0xce940000,
+0xfb400808,
+0xcea00000,
+0xfb400838,
+0xcea40000,
+0xfb400804,
+0xceae0000,
+0xfb400808,
+0xceba0000,
+0xfb400828,
+0xceba0000,
+0xfb400808,
+0xcebb0000,
+0xfb400804,
+0xcec00000,
+0xfb400804,
+0xcecc0000,
+0x3280809,
+0xfb400808,
+0xcee30000,
+0x3290809,
+0xfb400804,
+0xcee40000,
+0x3280809,
+0xfb400808,
+0xcf010000,
+0x3290809,
+0xfb40080c,
+0xcf010000,
+0x3280809,
+0xfb400808,
+0xcf110000,
+0x3290809,
+0xfb40080c,
+0xcf110000,
+0xfb400804,
+0xcf600000,
+0xfb400804,
+0xcf800000,
+0xfb400804,
+0xcf860000,
+0xfb400804,
+0xcf8b0000,
+0xfb400804,
+0xcfae0000,
+0xfb400804,
+0xcfbb0000,
+0xfb400804,
+0xcfbf0000,
+0xfb400804,
+0xd0020000,
+0xfb400804,
+0xd02b0000,
+0xfb400804,
+0xd07a0000,
+0xfb400804,
+0xd0990000,
+0xfb400804,
+0xd0cf0000,
+0xfb400804,
+0xd0da0000,
+0xfb400804,
+0xd0e70000,
+0xfb40080c,
+0xd12a0000,
+0xfb400808,
+0xd13f0000,
+0xfb400804,
+0xd1400000,
+0xfb400804,
+0xd1450000,
+0xfb400804,
+0xd14d0000,
+0xfb400804,
+0xd1540000,
+0xfb400804,
+0xd1640000,
+0xfb400808,
+0xd1650000,
+0xfb400804,
+0xd1670000,
+0xfb400804,
+0xd1680000,
+0xfb400804,
+0xd1690000,
+0xfb400808,
+0xd16b0000,
+0x3280809,
+0xfb400808,
+0xd16b0000,
+0x3290809,
+0xfb40080c,
+0xd16b0000,
+0xfb400804,
+0xd16d0000,
+0x3280809,
+0xfb400808,
+0xd16d0000,
+0x3290809,
+0xfb40080c,
+0xd16d0000,
+0xfb400804,
+0xd1770000,
+0xfb400804,
+0xd1800000,
+0xfb400808,
+0xd1820000,
+0xfb400808,
+0xd1820000,
+0x4608,
+0xfb400804,
+0xd18d0000,
+0xfb400838,
+0xd18d0000,
+0xfb400804,
+0xd1920000,
+0xfb400804,
+0xd1950000,
+0xfb400808,
+0xd1960000,
+0xfb400804,
+0xd1970000,
+0xfb40080c,
+0xd1990000,
+0xfb400804,
+0xd1a40000,
+0xfb400808,
+0xd1ab0000,
+0xfb400804,
+0xd1ac0000,
+0xfb400804,
+0xd1b50000,
+0xfb400804,
+0xd1b70000,
+0xfb400804,
+0xd1c90000,
+0xfb400804,
+0xd1cc0000,
+0xfb400804,
+0xd1dc0000,
+0xfb400804,
+0xd1de0000,
+0xfb400808,
+0xd1e00000,
+0xfb400808,
+0xd1e00000,
+0x4608,
+0xfb400804,
+0xd1f50000,
+0xfb400808,
+0xd1f50000,
+0xfb400808,
+0xd2000000,
+0xfb400808,
+0xd2000000,
+0x4608,
+0xfb400808,
+0xd2020000,
+0xfb400804,
+0xd2030000,
+0xfb400804,
+0xd2070000,
+0xfb400804,
+0xd2170000,
+0xfb400838,
+0xd21d0000,
+0xfb400804,
+0xd2290000,
+0xfb400804,
+0xd23a0000,
+0xfb400804,
+0xd23b0000,
+0xfb400804,
+0xd2460000,
+0xfb400838,
+0xd24d0000,
+0xfb400804,
+0xd2720000,
+0xfb400838,
+0xd2720000,
+0xfb400804,
+0xd2770000,
+0xfb400804,
+0xd2890000,
+0xfb400804,
+0xd29b0000,
+0xfb400808,
+0xd29b0000,
+0xfb400804,
+0xd2a30000,
+0xfb400804,
+0xd2b30000,
+0x3280809,
+0xfb400808,
+0xd2b40000,
+0x3290809,
+0xfb40080c,
+0xd2b40000,
+0xfb400804,
+0xd2c70000,
+0xfb400804,
+0xd2c90000,
+0xfb400804,
+0xd2d20000,
+0x38a0809,
+0xfb400808,
+0xd2dd0000,
+0x38b0809,
+0xfb400804,
+0xd2de0000,
+0xfb400804,
+0xd2e40000,
+0xfb400804,
+0xd2f50000,
+0xfb400808,
+0xd2f90000,
+0xfb400804,
+0xd2fa0000,
+0xfb400804,
+0xd3050000,
+0xfb400804,
+0xd3060000,
+0xfb400808,
+0xd3150000,
+0xfb400804,
+0xd3170000,
+0xfb400808,
+0xd31a0000,
+0xfb400808,
+0xd3380000,
+0xfb40080c,
+0xd33b0000,
+0xfb400804,
+0xd33f0000,
+0xfb400808,
+0xd3410000,
+0x3280809,
+0xfb400808,
+0xd3410000,
+0x3290809,
+0xfb40080c,
+0xd3410000,
+0xfb400808,
+0xd3440000,
+0xfb400808,
+0xd3450000,
+0xfb400804,
+0xd3490000,
+0xfb400804,
+0xd3510000,
+0x3280809,
+0xfb400808,
+0xd3540000,
+0x3290809,
+0xfb40080c,
+0xd3540000,
+0xfb400804,
+0xd35a0000,
+0xfb400808,
+0xd35c0000,
+0xfb400808,
+0xd35c0000,
+0x4608,
+0xfb400808,
+0xd3690000,
+0xfb400808,
+0xd3690000,
+0x4608,
+0xfb40080c,
+0xd3700000,
+0xfb400804,
+0xd3730000,
+0xfb400804,
+0xd3750000,
+0xfb400804,
+0xd37d0000,
+0xfb400804,
+0xd37f0000,
+0xfb400808,
+0xd3820000,
+0xfb400808,
+0xd3820000,
+0x4608,
+0xfb400808,
+0xd3b60000,
+0xfb400804,
+0xd3c30000,
+0xfb400808,
+0xd3c80000,
+0xfb400804,
+0xd3ca0000,
+0xfb400838,
+0xd3cc0000,
+0xfb400804,
+0xd3df0000,
+0xfb400808,
+0xd3e30000,
+0xfb400804,
+0xd3e50000,
+0xfb400804,
+0xd3eb0000,
+0xfb40080c,
+0xd3ef0000,
+0xfb400804,
+0xd3f10000,
+0xfb40080c,
+0xd3f30000,
+0xfb400838,
+0xd3f30000,
+0xfb400804,
+0xd4060000,
+0xfb400838,
+0xd4080000,
+0x3280809,
+0xfb400808,
+0xd40d0000,
+0x3290809,
+0xfb40080c,
+0xd40d0000,
+0xfb400804,
+0xd40f0000,
+0xfb400804,
+0xd41d0000,
+0xfb400804,
+0xd4380000,
+0xfb400838,
+0xd4390000,
+0xfb400804,
+0xd4420000,
+0xfb400804,
+0xd4480000,
+0xfb400804,
+0xd4680000,
+0x3280809,
+0xfb400808,
+0xd47c0000,
+0x3290809,
+0xfb400804,
+0xd49e0000,
+0xfb400804,
+0xd4a20000,
+0xfb400804,
+0xd4bd0000,
+0xfb400804,
+0xd4f60000,
+0xfb400804,
+0xd5100000,
+0xfb40080c,
+0xd54f0000,
+0xfb400804,
+0xd5530000,
+0xfb400804,
+0xd5550000,
+0xfb400804,
+0xd5630000,
+0xfb400804,
+0xd5840000,
+0xfb400804,
+0xd5870000,
+0xfb400804,
+0xd5990000,
+0xfb400804,
+0xd59d0000,
+0xfb400804,
+0xd5ab0000,
+0xfb400804,
+0xd5b30000,
+0xfb400838,
+0xd5b60000,
+0xfb400804,
+0xd5c00000,
+0xfb400804,
+0xd5c20000,
+0xfb400804,
+0xd5e20000,
+0xfb400804,
+0xd6060000,
+0xfb400804,
+0xd6510000,
+0xfb400804,
+0xd6680000,
+0xfb400804,
+0xd6740000,
+0xfb400808,
+0xd6d70000,
+0x3280809,
+0xfb400808,
+0xd6db0000,
+0x3290809,
+0xfb40080c,
+0xd6db0000,
+0xfb400828,
+0xd6db0000,
+0xfb400804,
+0xd6f90000,
+0xfb400804,
+0xd7160000,
+0xfb400804,
+0xd7170000,
+0xfb400808,
+0xd71f0000,
+0x3280809,
+0xfb400808,
+0xd71f0000,
+0x3290809,
+0xfb40080c,
+0xd71f0000,
+0xfb400828,
+0xd7300000,
+0xfb400804,
+0xd78b0000,
+0xfb400804,
+0xd7ce0000,
+0xfb400804,
+0xd7f40000,
+0xfb400804,
+0xd80d0000,
+0xfb400804,
+0xd8310000,
+0xfb400804,
+0xd8320000,
+0xfb400804,
+0xd8400000,
+0xfb400804,
+0xd85a0000,
+0xfb400804,
+0xd85e0000,
+0xfb400804,
+0xd8a80000,
+0xfb400804,
+0xd8ac0000,
+0xfb400804,
+0xd8b30000,
+0xfb400804,
+0xd8d80000,
+0xfb400804,
+0xd8df0000,
+0xfb400808,
+0xd8eb0000,
+0xfb400804,
+0xd8ee0000,
+0xfb400838,
+0xd8f00000,
+0xfb400804,
+0xd8f20000,
+0xfb400804,
+0xd8f70000,
+0xfb400808,
+0xd9020000,
+0xfb400804,
+0xd9060000,
+0xfb400808,
+0xd90a0000,
+0xfb400808,
+0xd9150000,
+0xfb400804,
+0xd91a0000,
+0xfb400838,
+0xd91a0000,
+0xfb40080c,
+0xd91c0000,
+0xfb400804,
+0xd9220000,
+0xfb400808,
+0xd9270000,
+0xfb400838,
+0xd9270000,
+0xfb400838,
+0xeb630000,
+0xfb400828,
+0xd9290000,
+0xfb400838,
+0xd9290000,
+0xfb400804,
+0xd9440000,
+0xfb400804,
+0xd9480000,
+0xfb400804,
+0xd9510000,
+0xfb400804,
+0xd9540000,
+0xfb400804,
+0xd9620000,
+0xfb400804,
+0xd9730000,
+0xfb400808,
+0xd9730000,
+0xfb40080c,
+0xd9730000,
+0xfb400804,
+0xd9d80000,
+0xfb400804,
+0xd9ec0000,
+0xfb400804,
+0xda1b0000,
+0xfb400804,
+0xda270000,
+0xfb400804,
+0xda620000,
+0xfb400804,
+0xda660000,
+0xfb400804,
+0xdab50000,
+0xfb400804,
+0xdb080000,
+0xfb400804,
+0xdb280000,
+0xfb400804,
+0xdb3e0000,
+0xfb400808,
+0xdb500000,
+0xfb400838,
+0xdb570000,
+0x3280809,
+0xfb400808,
+0xdb660000,
+0x3290809,
+0xfb40080c,
+0xdb660000,
+0xfb400808,
+0xdb800000,
+0xfb400804,
+0xdb850000,
+0x38a0809,
+0xfb400808,
+0xdb890000,
+0x38b0809,
+0xfb40080c,
+0xdb970000,
+0xfb400804,
+0xdbc30000,
+0xfb400804,
+0xdbd80000,
+0xfb400804,
+0xdbe70000,
+0xfb400804,
+0xdbee0000,
+0xfb400804,
+0xdbf30000,
+0xfb400808,
+0xdbf80000,
+0xfb400804,
+0xdbff0000,
+0xfb400804,
+0xdc060000,
+0xfb400808,
+0xdc0f0000,
+0xfb400808,
+0xdc0f0000,
+0x4608,
+0xfb400808,
+0xdc0f0000,
+0x4648,
+0xfb400804,
+0xdc220000,
+0xfb400808,
+0xdc220000,
+0xfb400808,
+0xdc220000,
+0x4608,
+0xfb400808,
+0xdc230000,
+0xfb400808,
+0xdc230000,
+0x4608,
+0xfb400808,
+0xdc380000,
+0xfb400804,
+0xdc3f0000,
+0xfb400804,
+0xdc600000,
+0xfb400804,
+0xdc620000,
+0xfb400804,
+0xdc640000,
+0xfb400804,
+0xdc650000,
+0xfb400804,
+0xdc6e0000,
+0xfb400808,
+0xdc6e0000,
+0xfb400808,
+0xdc710000,
+0xfb400804,
+0xdc8d0000,
+0xfb400804,
+0xdcc00000,
+0xfb400804,
+0xdd190000,
+0xfb400804,
+0xdd430000,
+0xfb400804,
+0xdd500000,
+0xfb400804,
+0xdd6b0000,
+0xfb400804,
+0xdd6e0000,
+0xfb400804,
+0xdd7c0000,
+0xfb400804,
+0xddb20000,
+0xfb400804,
+0xddba0000,
+0xfb400808,
+0xdddb0000,
+0xfb400804,
+0xdde10000,
+0xfb400804,
+0xdde20000,
+0xfb400808,
+0xdde50000,
+0xfb40080c,
+0xdde60000,
+0xfb400838,
+0xdde60000,
+0xfb400808,
+0xddf10000,
+0xfb400808,
+0xddf30000,
+0xfb400804,
+0xddfd0000,
+0xfb400808,
+0xddfe0000,
+0xfb400804,
+0xde280000,
+0xfb400804,
+0xde3d0000,
+0xfb400804,
+0xde690000,
+0xfb400808,
+0xde720000,
+0xfb400838,
+0xde730000,
+0xfb400838,
+0xe2100000,
+0xfb400804,
+0xde740000,
+0xfb400808,
+0xde7a0000,
+0xfb40080c,
+0xde7c0000,
+0xfb400808,
+0xde7f0000,
+0xfb400804,
+0xdea60000,
+0xfb400804,
+0xdeb00000,
+0xfb400804,
+0xdeb30000,
+0xfb400804,
+0xdeb60000,
+0xfb400804,
+0xdec90000,
+0xfb400804,
+0xdeca0000,
+0xfb400804,
+0xded20000,
+0xfb400804,
+0xded30000,
+0xfb400804,
+0xded90000,
+0xfb400804,
+0xdeec0000,
+0xfb400808,
+0xdef40000,
+0xfb400804,
+0xdefe0000,
+0xfb400808,
+0xdefe0000,
+0xfb400804,
+0xdf040000,
+0xfb400808,
+0xdf0b0000,
+0xfb400808,
+0xdf130000,
+0xfb400804,
+0xdf220000,
+0xfb400808,
+0xdf500000,
+0xfb400808,
+0xdf500000,
+0x4608,
+0xfb400808,
+0xdf510000,
+0xfb400804,
+0xdf530000,
+0xfb400808,
+0xdf610000,
+0xfb400804,
+0xdf620000,
+0xfb400804,
+0xdf690000,
+0xfb400804,
+0xdf6b0000,
+0xfb400808,
+0xdf730000,
+0xfb400804,
+0xdf8b0000,
+0xfb400838,
+0xdf8c0000,
+0xfb40080c,
+0xdf970000,
+0xfb400804,
+0xdf9a0000,
+0xfb400804,
+0xdfa90000,
+0xfb400804,
+0xdfad0000,
+0xfb400808,
+0xdfc30000,
+0xfb400808,
+0xdfc30000,
+0x4608,
+0xfb400808,
+0xdfc40000,
+0xfb400804,
+0xdfcd0000,
+0xfb400804,
+0xdfd70000,
+0xfb400804,
+0xdff50000,
+0xfb400804,
+0xdff90000,
+0xfb400804,
+0xe0120000,
+0xfb400804,
+0xe01c0000,
+0xfb400804,
+0xe0750000,
+0xfb400804,
+0xe0810000,
+0xfb400804,
+0xe0940000,
+0xfb400804,
+0xe0c70000,
+0xfb400804,
+0xe0d80000,
+0xfb400804,
+0xe0e10000,
+0xfb400804,
+0xe1080000,
+0xfb400804,
+0xe1440000,
+0xfb400804,
+0xe1480000,
+0xfb400804,
+0xe14c0000,
+0xfb400804,
+0xe14e0000,
+0xfb400804,
+0xe1600000,
+0xfb400804,
+0xe1680000,
+0xfb400804,
+0xe17a0000,
+0xfb400804,
+0xe18e0000,
+0xfb400804,
+0xe1900000,
+0xfb400804,
+0xe1a40000,
+0xfb400804,
+0xe1af0000,
+0xfb400804,
+0xe1b20000,
+0xfb400804,
+0xe1de0000,
+0xfb400804,
+0xe1f20000,
+0xfb400804,
+0xe1f60000,
+0xfb400804,
+0xe2000000,
+0xfb400808,
+0xe2080000,
+0xfb400804,
+0xe2100000,
+0xfb400804,
+0xe21b0000,
+0xfb400804,
+0xe22e0000,
+0xfb400804,
+0xe2340000,
+0xfb400808,
+0xe2360000,
+0xfb400808,
+0xe24b0000,
+0xfb400838,
+0xe24b0000,
+0xfb400808,
+0xe24c0000,
+0x38a0809,
+0xfb400808,
+0xe2530000,
+0x38b0809,
+0xfb400838,
+0xe2530000,
+0xfb400804,
+0xe25d0000,
+0xfb400838,
+0xe2950000,
+0xfb400804,
+0xe2b10000,
+0xfb400804,
+0xe2c90000,
+0xfb400804,
+0xe2cf0000,
+0xfb400804,
+0xe2d30000,
+0xfb400804,
+0xe2d40000,
+0xfb400804,
+0xe2fc0000,
+0xfb400804,
+0xe2fe0000,
+0xfb400838,
+0xe3070000,
+0xfb400804,
+0xe33d0000,
+0xfb400804,
+0xe3500000,
+0xfb400838,
+0xe3550000,
+0xfb400804,
+0xe3680000,
+0xfb400804,
+0xe37b0000,
+0xfb400804,
+0xe3830000,
+0xfb400804,
+0xe3a00000,
+0xfb400804,
+0xe3a90000,
+0xfb400804,
+0xe3c40000,
+0xfb400804,
+0xe3c50000,
+0xfb400804,
+0xe3e40000,
+0xfb400804,
+0xe41c0000,
+0xfb400804,
+0xe4220000,
+0xfb400804,
+0xe4520000,
+0xfb400804,
+0xe4690000,
+0xfb400804,
+0xe4770000,
+0xfb400804,
+0xe47e0000,
+0xfb400804,
+0xe49a0000,
+0xfb400804,
+0xe49d0000,
+0xfb400804,
+0xe4c40000,
+0xfb400808,
+0xe52f0000,
+0xfb400808,
+0xe5340000,
+0xfb400808,
+0xe5350000,
+0xfb400804,
+0xe54f0000,
+0xfb400804,
+0xe5560000,
+0x38a0809,
+0xfb400808,
+0xe5570000,
+0x38b0809,
+0xfb400804,
+0xe56c0000,
+0xfb400804,
+0xe5780000,
+0xfb400808,
+0xe5870000,
+0xfb40080c,
+0xe5870000,
+0xfb400808,
+0xe5970000,
+0xfb400804,
+0xe5990000,
+0xfb400838,
+0xe5990000,
+0xfb400808,
+0xe5a40000,
+0xfb400838,
+0xe5b00000,
+0xfb400808,
+0xe5b90000,
+0xfb400804,
+0xe5c50000,
+0xfb400808,
+0xe5e00000,
+0xfb400808,
+0xe5e10000,
+0xfb400804,
+0xe5e20000,
+0xfb400804,
+0xe5e30000,
+0xfb400808,
+0xe5e50000,
+0x3280809,
+0xfb400808,
+0xe5e50000,
+0x3290809,
+0xfb40080c,
+0xe5e50000,
+0xfb400808,
+0xe5e50000,
+0x4608,
+0xfb400838,
+0xe60e0000,
+0xfb400838,
+0xecbb0000,
+0xfb400804,
+0xe6130000,
+0xfb400838,
+0xe6200000,
+0xfb400838,
+0xe62d0000,
+0xfb400838,
+0xd48c0000,
+0xfb400804,
+0xe6490000,
+0xfb400804,
+0xe6740000,
+0xfb400804,
+0xe6880000,
+0xfb400804,
+0xe6910000,
+0xfb400804,
+0xe69c0000,
+0xfb400804,
+0xe6b40000,
+0xfb400804,
+0xe6c60000,
+0xfb400808,
+0xe6f00000,
+0xfb400804,
+0xe6f40000,
+0xfb400804,
+0xe6f80000,
+0xfb400804,
+0xe7000000,
+0xfb400808,
+0xe7080000,
+0x3280809,
+0xfb400808,
+0xe7080000,
+0x3290809,
+0xfb40080c,
+0xe7080000,
+0xfb400838,
+0xe7080000,
+0xfb400808,
+0xe7080000,
+0x4608,
+0x3280809,
+0xfb400808,
+0xe7090000,
+0x3290809,
+0xfb40080c,
+0xe7090000,
+0xfb400838,
+0xe7090000,
+0xfb400804,
+0xe7170000,
+0xfb400804,
+0xe71b0000,
+0xfb400804,
+0xe7210000,
+0xfb400808,
+0xe7280000,
+0x3280809,
+0xfb400808,
+0xe7280000,
+0x3290809,
+0xfb40080c,
+0xe7280000,
+0x38a0809,
+0xfb400808,
+0xe72c0000,
+0x38b0809,
+0xfb400804,
+0xe74e0000,
+0xfb400804,
+0xe7530000,
+0xfb400804,
+0xe7560000,
+0xfb400804,
+0xe75e0000,
+0xfb400804,
+0xe77b0000,
+0xfb400804,
+0xe7850000,
+0xfb400804,
+0xe7970000,
+0xfb400804,
+0xe7f30000,
+0xfb400804,
+0xe7fa0000,
+0xfb400804,
+0xe8170000,
+0xfb400804,
+0xe81f0000,
+0x3280809,
+0xfb400808,
+0xe82a0000,
+0x3290809,
+0xfb40080c,
+0xe82a0000,
+0xfb400838,
+0xe82a0000,
+0xfb400838,
+0xdf0f0000,
+0xfb400838,
+0xcf1a0000,
+0xfb400838,
+0xf93e0000,
+0xfb400804,
+0xe8520000,
+0xfb400804,
+0xe8810000,
+0xfb400804,
+0xe8850000,
+0xfb400804,
+0xe88e0000,
+0xfb400804,
+0xe8a80000,
+0xfb400804,
+0xe9140000,
+0xfb400804,
+0xe9420000,
+0xfb400804,
+0xe9a30000,
+0xfb400804,
+0xe9ea0000,
+0xfb400804,
+0xea020000,
+0xfb400804,
+0xea130000,
+0xfb400804,
+0xeaa80000,
+0xfb400804,
+0xead30000,
+0xfb400804,
+0xeadb0000,
+0xfb400804,
+0xeb040000,
+0xfb400808,
+0xeb200000,
+0xfb400804,
+0xeb210000,
+0xfb400804,
+0xeb540000,
+0xfb400808,
+0xeb620000,
+0xfb40080c,
+0xeb630000,
+0xfb400804,
+0xeb720000,
+0xfb400804,
+0xeb770000,
+0xfb400804,
+0xeb790000,
+0xfb400808,
+0xeb790000,
+0xfb400808,
+0xeb7a0000,
+0x4608,
+0xfb400804,
+0xeb9f0000,
+0xfb400804,
+0xebae0000,
+0xfb400808,
+0xebb30000,
+0xfb400804,
+0xebba0000,
+0xfb400804,
+0xebbb0000,
+0xfb400808,
+0xebcb0000,
+0xfb400808,
+0xebcd0000,
+0xfb400808,
+0xebd40000,
+0xfb400808,
+0xebdb0000,
+0xfb400808,
+0xec0f0000,
+0xfb400808,
+0xec110000,
+0xfb400808,
+0xec140000,
+0xfb400808,
+0xec340000,
+0x3280809,
+0xfb400808,
+0xec340000,
+0x3290809,
+0xfb40080c,
+0xec340000,
+0xfb400808,
+0xec350000,
+0xfb400808,
+0xec3a0000,
+0xfb400804,
+0xec4e0000,
+0xfb400804,
+0xec670000,
+0xfb400804,
+0xec880000,
+0xfb400804,
+0xecbf0000,
+0xfb400804,
+0xeccc0000,
+0xfb400804,
+0xeccd0000,
+0xfb400804,
+0xece50000,
+0xfb40080c,
+0xece80000,
+0xfb400804,
+0xed160000,
+0xfb400804,
+0xed1b0000,
+0xfb400804,
+0xed1e0000,
+0xfb400804,
+0xed340000,
+0xfb400804,
+0xed3e0000,
+0xfb400804,
+0xed410000,
+0xfb400804,
+0xed690000,
+0xfb400804,
+0xed6a0000,
+0xfb400804,
+0xed770000,
+0xfb400804,
+0xed780000,
+0xfb400804,
+0xed850000,
+0xfb400804,
+0xedcb0000,
+0xfb400804,
+0xedda0000,
+0xfb400804,
+0xedea0000,
+0xfb400804,
+0xedf90000,
+0xfb400804,
+0xee1a0000,
+0xfb400804,
+0xee2f0000,
+0xfb400804,
+0xee6e0000,
+0xfb400838,
+0xee800000,
+0xfb400804,
+0xee9c0000,
+0xfb400804,
+0xeeba0000,
+0xfb400804,
+0xeec70000,
+0xfb400804,
+0xeecb0000,
+0xfb400804,
+0xeed10000,
+0xfb400804,
+0xeedb0000,
+0xfb400804,
+0xef0f0000,
+0xfb400838,
+0xef140000,
+0xfb400804,
+0xef220000,
+0xfb400804,
+0xef230000,
+0xfb400804,
+0xef6e0000,
+0xfb400804,
+0xefc60000,
+0xfb400804,
+0xefeb0000,
+0xfb400804,
+0xeffe0000,
+0xfb400804,
+0xf01b0000,
+0xfb400804,
+0xf01e0000,
+0xfb400804,
+0xf0390000,
+0xfb400804,
+0xf04a0000,
+0xfb400808,
+0xf06b0000,
+0x3280809,
+0xfb400808,
+0xf06b0000,
+0x3290809,
+0xfb40080c,
+0xf06b0000,
+0xfb400808,
+0xf06c0000,
+0xfb400804,
+0xf0700000,
+0xfb400804,
+0xf0770000,
+0xfb400804,
+0xf07d0000,
+0xfb400804,
+0xf0990000,
+0xfb400804,
+0xf0ad0000,
+0x38a0809,
+0xfb400808,
+0xf0b90000,
+0x38b0809,
+0xfb400804,
+0xf0c80000,
+0xfb400804,
+0xf0d90000,
+0xfb400838,
+0xf1210000,
+0xfb400804,
+0xf1450000,
+0xfb400804,
+0xf1490000,
+0xfb400804,
+0xf16e0000,
+0xfb400804,
+0xf19c0000,
+0xfb400804,
+0xf1ce0000,
+0xfb400804,
+0xf1d00000,
+0xfb400804,
+0xf2100000,
+0xfb400804,
+0xf21b0000,
+0xfb400804,
+0xf2280000,
+0xfb400808,
+0xf22a0000,
+0xfb400804,
+0xf22b0000,
+0xfb400808,
+0xf22b0000,
+0xfb400808,
+0xf22b0000,
+0x4608,
+0xfb400804,
+0xf2350000,
+0xfb400808,
+0xf2360000,
+0xfb400808,
+0xf23b0000,
+0xfb400808,
+0xf23f0000,
+0xfb400808,
+0xf2470000,
+0xfb400804,
+0xf2500000,
+0xfb400808,
+0xf2590000,
+0xfb400808,
+0xf25b0000,
+0xfb400808,
+0xf25b0000,
+0x4608,
+0xfb400804,
+0xf2620000,
+0x3280809,
+0xfb400808,
+0xf2790000,
+0x3290809,
+0xfb40080c,
+0xf2790000,
+0xfb400804,
+0xf2800000,
+0xfb400804,
+0xf2950000,
+0xfb400808,
+0xf2ac0000,
+0xfb400808,
+0xf2ad0000,
+0xfb400804,
+0xf2af0000,
+0xfb400804,
+0xf2c00000,
+0xfb400804,
+0xf2fc0000,
+0xfb400804,
+0xf32a0000,
+0xfb400804,
+0xf3750000,
+0xfb400804,
+0xf37a0000,
+0xfb400808,
+0xf3840000,
+0xfb400804,
+0xf3870000,
+0xfb400808,
+0xf3890000,
+0xfb400804,
+0xf38b0000,
+0xfb400808,
+0xf38b0000,
+0x4608,
+0xfb400804,
+0xf3a50000,
+0xfb400804,
+0xf3b20000,
+0xfb400804,
+0xf3de0000,
+0xfb400804,
+0xf4060000,
+0xfb400804,
+0xf4090000,
+0xfb400804,
+0xf4220000,
+0xfb400804,
+0xf4470000,
+0xfb400804,
+0xf45c0000,
+0xfb400804,
+0xf4690000,
+0xfb400804,
+0xf4710000,
+0xfb400804,
+0xf4850000,
+0xfb400804,
+0xf4890000,
+0xfb400804,
+0xf4980000,
+0xfb400804,
+0xf4ca0000,
+0xfb400808,
+0xf4dc0000,
+0xfb400808,
+0xf4e60000,
+0xfb400804,
+0xf5060000,
+0xfb400808,
+0xf5180000,
+0xfb400808,
+0xf51f0000,
+0xfb400838,
+0xf51f0000,
+0xfb400804,
+0xf5240000,
+0xfb400808,
+0xf5280000,
+0xfb400808,
+0xf5300000,
+0xfb400828,
+0xf5320000,
+0xfb400838,
+0xf5330000,
+0xfb40080c,
+0xf5370000,
+0xfb400804,
+0xf53b0000,
+0xfb400804,
+0xf53e0000,
+0xfb400804,
+0xf5590000,
+0xfb400804,
+0xf5650000,
+0xfb400804,
+0xf5700000,
+0xfb400808,
+0xf58b0000,
+0xfb400808,
+0xf58b0000,
+0x4608,
+0xfb400808,
+0xf5920000,
+0xfb400804,
+0xf5e20000,
+0xfb400804,
+0xf6100000,
+0xfb400804,
+0xf61d0000,
+0xfb400804,
+0xf61f0000,
+0xfb400804,
+0xf6420000,
+0xfb400804,
+0xf6690000,
+0xfb400808,
+0xf6760000,
+0xfb400808,
+0xf67d0000,
+0xfb400808,
+0xf6ae0000,
+0xfb400808,
+0xf6bf0000,
+0xfb400804,
+0xf6ca0000,
+0x38a0809,
+0xfb400808,
+0xf6d70000,
+0x38b0809,
+0xfb400804,
+0xf6db0000,
+0x3280809,
+0xfb400808,
+0xf6e30000,
+0x3290809,
+0xfb40080c,
+0xf6e30000,
+0xfb400804,
+0xf6e70000,
+0xfb400808,
+0xf6ee0000,
+0xfb400808,
+0xf6ee0000,
+0x4608,
+0xfb400804,
+0xf6f40000,
+0xfb400804,
+0xf7010000,
+0xfb400804,
+0xf71e0000,
+0xfb400804,
+0xf71f0000,
+0xfb400804,
+0xf7400000,
+0xfb400804,
+0xf74a0000,
+0xfb400804,
+0xf78b0000,
+0xfb400804,
+0xf7a70000,
+0xfb400808,
+0xf7db0000,
+0xfb400808,
+0xf7e20000,
+0xfb400808,
+0xf7f30000,
+0xfb400804,
+0xf84e0000,
+0xfb400804,
+0xf86b0000,
+0xfb400804,
+0xf88c0000,
+0xfb400804,
+0xf8910000,
+0xfb400804,
+0xf8ca0000,
+0xfb400804,
+0xf8cc0000,
+0xfb400804,
+0xf8fb0000,
+0xfb400804,
+0xf92a0000,
+0xfb400808,
+0xf93a0000,
+0xfb400808,
+0xf93a0000,
+0x4608,
+0xfb400808,
+0xf93b0000,
+0xfb400804,
+0xf93c0000,
+0xfb400804,
+0xf93e0000,
+0x3280809,
+0xfb400808,
+0xf93e0000,
+0x3290809,
+0xfb40080c,
+0xf93e0000,
+0xfb400804,
+0xf9480000,
+0xfb400804,
+0xf9490000,
+0xfb400804,
+0xf9500000,
+0xfb400804,
+0xf9560000,
+0xfb400804,
+0xf95d0000,
+0x3280809,
+0xfb400808,
+0xf95d0000,
+0x3290809,
+0xfb40080c,
+0xf95d0000,
+0xfb400804,
+0xf95e0000,
+0xfb400804,
+0xf9650000,
+0x3280809,
+0xfb400808,
+0xf96d0000,
+0x3290809,
+0xfb400804,
+0xf97f0000,
+0xfb400838,
+0xf9810000,
+0xfb400804,
+0xf98d0000,
+0xfb400804,
+0xf98e0000,
+0xfb400804,
+0xf98f0000,
+0xfb400804,
+0xf9ae0000,
+0xfb400808,
+0xf9b80000,
+0xfb400808,
+0xf9be0000,
+0xfb400804,
+0xf9ca0000,
+0xfb40080c,
+0xf9d80000,
+0xfb400804,
+0xf9eb0000,
+0xfb400804,
+0xfa1c0000,
+0xfb400804,
+0xfa400000,
+0xfb400804,
+0xfa4a0000,
+0xfb400804,
+0xfa4f0000,
+0xfb400808,
+0xfa740000,
+0xfb400838,
+0xfa7a0000,
+0xfb400804,
+0xfa810000,
+0xfb400804,
+0xfab10000,
+0xfb400804,
+0xfacb0000,
+0xfb400808,
+0xfacb0000,
+0xfb400804,
+0xfaee0000,
+0xfb400808,
+0xfaf90000,
+0xfb400808,
+0xfaf90000,
+0x4608,
+0xfb400804,
+0xfb200000,
+0xfb40080c,
+0xfb8f0000,
+0xfb400804,
+0xfbc00000,
+0xfb400804,
+0xfbc60000,
+0xfb400804,
+0xfbc90000,
+0xfb400804,
+0xfc3e0000,
+0xfb400804,
+0xfc600000,
+0xfb400808,
+0xfc730000,
+0xfb400804,
+0xfc7b0000,
+0xfb400804,
+0xfc920000,
+0xfb400804,
+0xfcbe0000,
+0xfb400804,
+0xfcd20000,
+0xfb400804,
+0xfcd60000,
+0xfb400804,
+0xfce30000,
+0xfb400804,
+0xfce70000,
+0xfb400804,
+0xfce80000,
+0xfb400808,
+0xfcf80000,
+0xfb400808,
+0xfcf90000,
+0xfb400804,
+0xfd000000,
+0xfb400804,
+0xfd100000,
+0xfb400804,
+0xfd220000,
+0xfb400804,
+0xfd2f0000,
+0xfb400838,
+0xfd420000,
+0xfb400804,
+0xfd5b0000,
+0xfb400804,
+0xfd630000,
+0xfb400804,
+0xfda00000,
+0xfb400804,
+0xfdbe0000,
+0xfb400804,
+0xfdc70000,
+0xfb400804,
+0xfdf40000,
+0xfb400804,
+0xfe020000,
+0xfb400804,
+0xfe090000,
+0xfb400804,
+0xfe370000,
+0xfb400804,
+0xfe410000,
+0xfb400804,
+0xfe450000,
+0xfb400808,
+0xfe9f0000,
+0xfb400808,
+0xff360000,
+0xfb400804,
+0xff3e0000,
+0xfb400808,
+0xff510000,
+0xfb400808,
+0xff520000,
+0xfb400808,
+0xff520000,
+0x4608,
+0xfb400808,
+0xff530000,
+0xfb400808,
+0xff530000,
+0x4608,
+0xfb400808,
+0xff530000,
+0x4648,
+0xfb400804,
+0xff720000,
+0xfb400804,
+0xff790000,
+0xfb400804,
+0xff7a0000,
+0xfb400804,
+0xff850000,
+0xfb400808,
+0xff8a0000,
+0xfb400808,
+0xff8a0000,
+0x4608,
+0xfb400808,
+0xff8a0000,
+0x4648,
+0xfb400808,
+0xff8b0000,
+0xfb400804,
+0xff950000,
+0xfb400804,
+0xff9a0000,
+0xfb400804,
+0xffbd0000,
+0xfb400808,
+0xffbd0000,
+0xfb400804,
+0xfffa0000,
+0xfb410804,
+0x80010000,
+0xfb410808,
+0x80010000,
+0xfb410808,
+0x80020000,
+0xfb410804,
+0x80050000,
+0xfb410808,
+0x800c0000,
+0xfb410808,
+0x80120000,
+0xfb410808,
+0x80330000,
+0xfb410804,
+0x80460000,
+0xfb410804,
+0x80600000,
+0xfb410804,
+0x806f0000,
+0xfb410804,
+0x80700000,
+0xfb410804,
+0x807e0000,
+0xfb410808,
+0x807f0000,
+0xfb410808,
+0x807f0000,
+0x4608,
+0xfb410808,
+0x80800000,
+0xfb410808,
+0x80890000,
+0xfb410808,
+0x80890000,
+0x4608,
+0xfb410804,
+0x808b0000,
+0xfb410804,
+0x80ad0000,
+0xfb410804,
+0x80b20000,
+0xfb410804,
+0x81030000,
+0xfb410804,
+0x813e0000,
+0xfb410804,
+0x81d80000,
+0xfb410808,
+0x81e30000,
+0xfb410804,
+0x81e80000,
+0xfb410808,
+0x81ea0000,
+0x3280809,
+0xfb410808,
+0x81ea0000,
+0x3290809,
+0xfb410804,
+0x81ed0000,
+0xfb410808,
+0x81f30000,
+0x3280809,
+0xfb410808,
+0x81f30000,
+0x3290809,
+0xfb410808,
+0x81fc0000,
+0xfb410808,
+0x81fc0000,
+0x4608,
+0xfb410804,
+0x82010000,
+0xfb410804,
+0x82040000,
+0xfb410808,
+0x820c0000,
+0xfb410804,
+0x82180000,
+0xfb410808,
+0x821b0000,
+0xfb410808,
+0x821f0000,
+0xfb410808,
+0x826e0000,
+0xfb410804,
+0x826f0000,
+0xfb410808,
+0x82720000,
+0xfb410808,
+0x82780000,
+0xfb410804,
+0x82790000,
+0xfb410808,
+0x82790000,
+0xfb410808,
+0x82790000,
+0x4608,
+0xfb410808,
+0x82790000,
+0x4648,
+0xfb410804,
+0x828b0000,
+0xfb410804,
+0x82910000,
+0xfb410804,
+0x829d0000,
+0xfb410804,
+0x82b10000,
+0xfb410804,
+0x82b30000,
+0xfb410804,
+0x82bd0000,
+0xfb410804,
+0x82e50000,
+0xfb410804,
+0x82e60000,
+0xfb410804,
+0x831d0000,
+0xfb410804,
+0x83230000,
+0xfb410804,
+0x83360000,
+0xfb410804,
+0x83520000,
+0xfb410804,
+0x83530000,
+0xfb410804,
+0x83630000,
+0xfb410804,
+0x83ad0000,
+0xfb410804,
+0x83bd0000,
+0xfb410804,
+0x83c90000,
+0xfb410804,
+0x83ca0000,
+0xfb410804,
+0x83cc0000,
+0xfb410804,
+0x83dc0000,
+0xfb410804,
+0x83e70000,
+0xfb410804,
+0x83ef0000,
+0xfb410804,
+0x83f10000,
+0xfb410804,
+0x843d0000,
+0xfb410804,
+0x84490000,
+0xfb410804,
+0x84570000,
+0xfb410804,
+0x84ee0000,
+0xfb410804,
+0x84f10000,
+0xfb410804,
+0x84f30000,
+0xfb410804,
+0x84fc0000,
+0xfb410804,
+0x85160000,
+0xfb410804,
+0x85640000,
+0xfb410804,
+0x85cd0000,
+0xfb410804,
+0x85fa0000,
+0xfb410804,
+0x86060000,
+0xfb410804,
+0x86120000,
+0xfb410804,
+0x862d0000,
+0xfb410804,
+0x863f0000,
+0xfb410808,
+0x864d0000,
+0xfb410808,
+0x864e0000,
+0xfb410804,
+0x86500000,
+0xfb410804,
+0x865c0000,
+0xfb410804,
+0x86670000,
+0xfb410804,
+0x86690000,
+0xfb410808,
+0x866b0000,
+0xfb410804,
+0x86880000,
+0xfb410804,
+0x86a90000,
+0xfb410804,
+0x86e20000,
+0xfb410804,
+0x870e0000,
+0xfb410804,
+0x87280000,
+0xfb410804,
+0x876b0000,
+0xfb410804,
+0x87790000,
+0xfb410804,
+0x87860000,
+0xfb410804,
+0x87ba0000,
+0xfb410804,
+0x87e10000,
+0xfb410804,
+0x88010000,
+0xfb410804,
+0x881f0000,
+0xfb410808,
+0x88400000,
+0xfb410804,
+0x884c0000,
+0xfb410808,
+0x884c0000,
+0xfb410804,
+0x88600000,
+0xfb410804,
+0x88630000,
+0xfb410808,
+0x88630000,
+0xfb410808,
+0x88640000,
+0xfb410804,
+0x88c20000,
+0xfb410804,
+0x88cf0000,
+0xfb410804,
+0x88d70000,
+0xfb410804,
+0x88de0000,
+0xfb410804,
+0x88e10000,
+0xfb410804,
+0x88f80000,
+0xfb410804,
+0x88fa0000,
+0xfb410804,
+0x89100000,
+0xfb410804,
+0x89410000,
+0xfb410804,
+0x89640000,
+0xfb410808,
+0x897e0000,
+0xfb410808,
+0x897f0000,
+0xfb410808,
+0x89800000,
+0xfb410804,
+0x89860000,
+0xfb410804,
+0x898b0000,
+0xfb410808,
+0x898b0000,
+0xfb410804,
+0x89960000,
+0xfb410808,
+0x89c10000,
+0xfb410808,
+0x89d20000,
+0xfb410808,
+0x89d20000,
+0x4608,
+0xfb410838,
+0x89e30000,
+0xfb410808,
+0x8a000000,
+0xfb410804,
+0x8aa00000,
+0xfb410804,
+0x8aaa0000,
+0xfb410804,
+0x8abf0000,
+0xfb410804,
+0x8acb0000,
+0xfb410804,
+0x8ad20000,
+0xfb410804,
+0x8ad60000,
+0xfb410804,
+0x8aed0000,
+0xfb410804,
+0x8af80000,
+0xfb410804,
+0x8afe0000,
+0xfb410804,
+0x8b010000,
+0xfb410804,
+0x8b390000,
+0xfb410804,
+0x8b580000,
+0xfb410804,
+0x8b800000,
+0xfb410804,
+0x8b8a0000,
+0xfb410808,
+0x8ba00000,
+0xfb410808,
+0x8c370000,
+0xfb410808,
+0x8c460000,
+0xfb410804,
+0x8c480000,
+0xfb410804,
+0x8c550000,
+0xfb410808,
+0x8c550000,
+0xfb410808,
+0x8c780000,
+0xfb410808,
+0x8c9d0000,
+0x3280809,
+0xfb410808,
+0x8ca10000,
+0x3290809,
+0xfb41080c,
+0x8ca10000,
+0xfb410838,
+0x8ca90000,
+0xfb410804,
+0x8cab0000,
+0xfb410804,
+0x8cc10000,
+0xfb410804,
+0x8cc20000,
+0x3280809,
+0xfb410808,
+0x8cc70000,
+0x3290809,
+0xfb41080c,
+0x8cc70000,
+0xfb410804,
+0x8cc80000,
+0xfb410804,
+0x8cd30000,
+0xfb410804,
+0x8d080000,
+0xfb410804,
+0x8d1b0000,
+0xfb410808,
+0x8d1d0000,
+0xfb410808,
+0x8d640000,
+0xfb410808,
+0x8d700000,
+0xfb410838,
+0x8d700000,
+0xfb410804,
+0x8d770000,
+0xfb410808,
+0x8db30000,
+0xfb410808,
+0x8db30000,
+0x4608,
+0xfb410804,
+0x8dbc0000,
+0xfb410804,
+0x8dcb0000,
+0xfb410804,
+0x8def0000,
+0xfb410804,
+0x8df00000,
+0xfb410808,
+0x8eab0000,
+0xfb410804,
+0x8eca0000,
+0xfb410808,
+0x8eca0000,
+0xfb410804,
+0x8ed40000,
+0xfb410804,
+0x8f260000,
+0xfb410804,
+0x8f2a0000,
+0xfb410804,
+0x8f380000,
+0xfb410804,
+0x8f3b0000,
+0xfb410804,
+0x8f620000,
+0xfb410808,
+0x8f660000,
+0xfb410808,
+0x8f9b0000,
+0xfb410804,
+0x8f9e0000,
+0xfb410804,
+0x8fb00000,
+0xfb410808,
+0x8fb00000,
+0xfb410808,
+0x8fb50000,
+0xfb410804,
+0x8fb60000,
+0xfb410808,
+0x8fb60000,
+0xfb410808,
+0x8fb60000,
+0x4608,
+0xfb410808,
+0x8fb60000,
+0x4648,
+0xfb410804,
+0x90230000,
+0xfb410804,
+0x90380000,
+0xfb410838,
+0x904a0000,
+0xfb41080c,
+0x90690000,
+0xfb410804,
+0x90720000,
+0xfb410804,
+0x907c0000,
+0xfb410804,
+0x908f0000,
+0xfb410808,
+0x90910000,
+0xfb410808,
+0x90910000,
+0x4608,
+0xfb410804,
+0x90940000,
+0xfb410804,
+0x90ce0000,
+0xfb410804,
+0x90de0000,
+0xfb410804,
+0x90f10000,
+0xfb410804,
+0x90fd0000,
+0xfb410804,
+0x91110000,
+0xfb410804,
+0x911b0000,
+0xfb410808,
+0x91490000,
+0xfb410804,
+0x916a0000,
+0xfb410804,
+0x91990000,
+0xfb410804,
+0x91b40000,
+0xfb410808,
+0x91c60000,
+0xfb410804,
+0x91cc0000,
+0xfb410808,
+0x91cc0000,
+0xfb410804,
+0x91cf0000,
+0xfb410804,
+0x91d10000,
+0xfb410808,
+0x91d10000,
+0x3280809,
+0xfb410808,
+0x91d10000,
+0x3290809,
+0xfb41080c,
+0x91d10000,
+0xfb410804,
+0x92340000,
+0xfb410804,
+0x92380000,
+0xfb410804,
+0x92760000,
+0xfb410804,
+0x927c0000,
+0xfb410804,
+0x92d70000,
+0xfb410804,
+0x92d80000,
+0xfb410804,
+0x93040000,
+0xfb410804,
+0x934a0000,
+0xfb410804,
+0x93f90000,
+0xfb410804,
+0x94150000,
+0xfb410808,
+0x94850000,
+0xfb410808,
+0x95770000,
+0xfb410808,
+0x95780000,
+0xfb410808,
+0x957f0000,
+0xfb410808,
+0x95800000,
+0xfb410804,
+0x958b0000,
+0xfb410804,
+0x95ad0000,
+0xfb410804,
+0x95b70000,
+0xfb410808,
+0x95e80000,
+0xfb410808,
+0x961c0000,
+0xfb410808,
+0x961c0000,
+0x4608,
+0xfb410808,
+0x961d0000,
+0xfb410804,
+0x962e0000,
+0xfb410804,
+0x964b0000,
+0xfb410804,
+0x964d0000,
+0xfb410804,
+0x96750000,
+0xfb410804,
+0x96780000,
+0xfb410804,
+0x967c0000,
+0xfb410804,
+0x96860000,
+0xfb410804,
+0x96a30000,
+0xfb410808,
+0x96b60000,
+0xfb410804,
+0x96b70000,
+0xfb410804,
+0x96b80000,
+0xfb410808,
+0x96b90000,
+0xfb410804,
+0x96c30000,
+0xfb410804,
+0x96e20000,
+0xfb410804,
+0x96e30000,
+0xfb410808,
+0x96e80000,
+0xfb410808,
+0x96e80000,
+0x4608,
+0xfb410804,
+0x96f60000,
+0xfb410804,
+0x96f70000,
+0xfb410804,
+0x97230000,
+0xfb410804,
+0x97320000,
+0xfb410804,
+0x97480000,
+0xfb410808,
+0x97510000,
+0xfb410808,
+0x97520000,
+0xfb410804,
+0x97560000,
+0xfb410808,
+0x975e0000,
+0xfb410808,
+0x97620000,
+0xfb410808,
+0x97690000,
+0xfb410808,
+0x97cb0000,
+0xfb410804,
+0x97db0000,
+0xfb410804,
+0x97e00000,
+0xfb410808,
+0x97e60000,
+0xfb410808,
+0x97ed0000,
+0xfb410808,
+0x97f30000,
+0xfb410804,
+0x97ff0000,
+0xfb410808,
+0x98010000,
+0xfb41080c,
+0x98050000,
+0xfb410804,
+0x980b0000,
+0xfb410804,
+0x98180000,
+0xfb410804,
+0x98290000,
+0xfb410804,
+0x983b0000,
+0xfb410804,
+0x985e0000,
+0xfb410808,
+0x98750000,
+0xfb410808,
+0x98a80000,
+0xfb410808,
+0x98ce0000,
+0xfb410808,
+0x98db0000,
+0xfb410808,
+0x98de0000,
+0xfb410808,
+0x98df0000,
+0xfb410808,
+0x98e00000,
+0xfb410808,
+0x98e00000,
+0x4608,
+0xfb410804,
+0x98e20000,
+0xfb410804,
+0x98ef0000,
+0xfb410804,
+0x98fc0000,
+0xfb410804,
+0x99280000,
+0xfb410804,
+0x99290000,
+0xfb410808,
+0x99630000,
+0xfb410808,
+0x99960000,
+0xfb410808,
+0x99960000,
+0x4608,
+0xfb410808,
+0x99990000,
+0xfb410804,
+0x99a70000,
+0xfb410808,
+0x99ac0000,
+0xfb410804,
+0x99c20000,
+0xfb410804,
+0x99f10000,
+0xfb410804,
+0x99fe0000,
+0xfb410804,
+0x9a6a0000,
+0xfb410808,
+0x9a6c0000,
+0xfb410808,
+0x9aa80000,
+0xfb410808,
+0x9aa80000,
+0x4608,
+0xfb410808,
+0x9ad80000,
+0xfb410808,
+0x9adf0000,
+0xfb410804,
+0x9b120000,
+0xfb410808,
+0x9b250000,
+0xfb410808,
+0x9b2f0000,
+0xfb410808,
+0x9b320000,
+0xfb410808,
+0x9b3c0000,
+0xfb410808,
+0x9b3c0000,
+0x4608,
+0xfb410808,
+0x9b5a0000,
+0xfb410804,
+0x9b6f0000,
+0xfb410804,
+0x9c400000,
+0xfb410804,
+0x9c570000,
+0xfb410808,
+0x9c7c0000,
+0xfb410808,
+0x9ce50000,
+0xfb410804,
+0x9cfd0000,
+0xfb410804,
+0x9d670000,
+0xfb410804,
+0x9db40000,
+0xfb410804,
+0x9dfa0000,
+0xfb410804,
+0x9e1e0000,
+0xfb410808,
+0x9e1f0000,
+0xfb410808,
+0x9e750000,
+0xfb410808,
+0x9e750000,
+0x4608,
+0xfb410804,
+0x9e7f0000,
+0xfb410808,
+0x9e7f0000,
+0xfb410804,
+0x9e970000,
+0xfb410804,
+0x9e9f0000,
+0xfb410808,
+0x9ea50000,
+0xfb410808,
+0x9ea60000,
+0xfb410804,
+0x9ebb0000,
+0xfb410808,
+0x9ebb0000,
+0xfb410808,
+0x9ec30000,
+0xfb410808,
+0x9ec40000,
+0xfb410808,
+0x9ecd0000,
+0xfb410804,
+0x9ece0000,
+0xfb410808,
+0x9ed10000,
+0xfb410804,
+0x9ef90000,
+0xfb410808,
+0x9ef90000,
+0xfb410808,
+0x9efd0000,
+0xfb410804,
+0x9efe0000,
+0xfb410808,
+0x9efe0000,
+0xfb410804,
+0x9f050000,
+0xfb410808,
+0x9f0e0000,
+0xfb410804,
+0x9f0f0000,
+0xfb410808,
+0x9f130000,
+0xfb410804,
+0x9f160000,
+0xfb410808,
+0x9f200000,
+0xfb410804,
+0x9f3b0000,
+0xfb410808,
+0x9f3b0000,
+0xfb410804,
+0x9f430000,
+0xfb410808,
+0x9f4a0000,
+0xfb410808,
+0x9f4a0000,
+0x4608,
+0xfb410808,
+0x9f500000,
+0xfb410808,
+0x9f520000,
+0xfb410808,
+0x9f520000,
+0x4608,
+0xfb410808,
+0x9f7f0000,
+0xfb410804,
+0x9f8d0000,
+0xfb410808,
+0x9f8d0000,
+0xfb410808,
+0x9f8d0000,
+0x4608,
+0xfb410804,
+0x9f8e0000,
+0xfb410808,
+0x9f990000,
+0xfb410804,
+0x9f9c0000,
+0xfb410808,
+0x9f9c0000,
+0xfb410808,
+0x9f9c0000,
+0x4608,
+0xfb410808,
+0x9f9c0000,
+0x4648,
+0xfb410808,
+0x9f9f0000,
+0xfb410808,
+0x9fa00000,
+0xfb410804,
+0xfa0e0000,
+0xfb410804,
+0xfa0f0000,
+0xfb410804,
+0xfa110000,
+0xfb410804,
+0xfa130000,
+0xfb410804,
+0xfa140000,
+0xfb410804,
+0xfa1f0000,
+0xfb410804,
+0xfa210000,
+0xfb410804,
+0xfa230000,
+0xfb410804,
+0xfa240000,
+0xfb410804,
+0xfa270000,
+0xfb410804,
+0xfa280000,
+0xfb410804,
+0xfa290000,
+0xfb800804,
+0xb49e0000,
+0xfb800804,
+0xb4b90000,
+0xfb800804,
+0xb4bb0000,
+0xfb800804,
+0xb4df0000,
+0xfb800804,
+0xb5150000,
+0xfb800804,
+0xb6ee0000,
+0xfb800804,
+0xb6fc0000,
+0xfb800804,
+0xb7810000,
+0xfb800804,
+0xb82f0000,
+0xfb800804,
+0xb8620000,
+0xfb800804,
+0xb87c0000,
+0xfb800804,
+0xb8c70000,
+0xfb800804,
+0xb8e30000,
+0xfb800804,
+0xb91c0000,
+0xfb800804,
+0xb93a0000,
+0xfb800804,
+0xba2e0000,
+0xfb800804,
+0xba6c0000,
+0xfb800804,
+0xbae40000,
+0xfb800804,
+0xbb080000,
+0xfb800804,
+0xbb190000,
+0xfb800804,
+0xbb490000,
+0xfb800804,
+0xbb9d0000,
+0xfb800804,
+0xbc180000,
+0xfb800804,
+0xbc4e0000,
+0xfb800804,
+0xbd330000,
+0xfb800804,
+0xbd960000,
+0xfb800804,
+0xbeac0000,
+0xfb800804,
+0xbeb80000,
+0xfb800804,
+0xbf1b0000,
+0xfb800804,
+0xbffc0000,
+0xfb800804,
+0xc0080000,
+0xfb800804,
+0xc0180000,
+0xfb800804,
+0xc0390000,
+0xfb800804,
+0xc0460000,
+0xfb800804,
+0xc0960000,
+0xfb800804,
+0xc0e30000,
+0xfb800804,
+0xc12f0000,
+0xfb800804,
+0xc2020000,
+0xfb800804,
+0xc2270000,
+0xfb800804,
+0xc2a00000,
+0xfb800804,
+0xc3010000,
+0xfb800804,
+0xc3340000,
+0xfb800804,
+0xc3590000,
+0xfb800804,
+0xc3d50000,
+0xfb800804,
+0xc3d90000,
+0xfb800804,
+0xc40b0000,
+0xfb800804,
+0xc46b0000,
+0xfb800804,
+0xc52b0000,
+0xfb800804,
+0xc55d0000,
+0xfb800804,
+0xc5610000,
+0xfb800804,
+0xc56b0000,
+0xfb800804,
+0xc5d70000,
+0xfb800804,
+0xc5f90000,
+0xfb800804,
+0xc6350000,
+0xfb800804,
+0xc6be0000,
+0xfb800804,
+0xc6c70000,
+0xfb800804,
+0xc9950000,
+0xfb800804,
+0xc9e60000,
+0xfb800804,
+0xca6e0000,
+0xfb800804,
+0xca760000,
+0xfb800804,
+0xcab20000,
+0xfb800804,
+0xcb330000,
+0xfb800804,
+0xcbce0000,
+0xfb800804,
+0xccce0000,
+0xfb800804,
+0xcced0000,
+0xfb800804,
+0xccf80000,
+0xfb800804,
+0xcd560000,
+0xfb840804,
+0x81220000,
+0xfb840804,
+0x851c0000,
+0xfb840804,
+0x85250000,
+0xfb840804,
+0x854b0000,
+0xfb840804,
+0x863a0000,
+0xfb840804,
+0x88040000,
+0xfb840804,
+0x88de0000,
+0xfb840804,
+0x8a2c0000,
+0xfb840804,
+0x8b630000,
+0xfb840804,
+0x94e40000,
+0xfb840804,
+0x96a80000,
+0xfb840804,
+0x96ea0000,
+0xfb840804,
+0x99c80000,
+0xfb840804,
+0x9b180000,
+0xfb840804,
+0x9d0b0000,
+0xfb840804,
+0x9de40000,
+0xfb840804,
+0x9de60000,
+0xfb840804,
+0xa1830000,
+0xfb840804,
+0xa19f0000,
+0xfb840804,
+0xa3310000,
+0xfb840804,
+0xa6d40000,
+0xfb840804,
+0xa8440000,
+0xfb840804,
+0xa84a0000,
+0xfb840804,
+0xab0c0000,
+0xfb840804,
+0xabf10000,
+0xfb840804,
+0xb00a0000,
+0xfb840804,
+0xb2b80000,
+0xfb840804,
+0xb35f0000,
+0xfb840804,
+0xb3930000,
+0xfb840804,
+0xb39c0000,
+0xfb840804,
+0xb3c30000,
+0xfb840804,
+0xb3d50000,
+0xfb840804,
+0xb46d0000,
+0xfb840804,
+0xb6a30000,
+0xfb840804,
+0xb8a70000,
+0xfb840804,
+0xba8d0000,
+0xfb840804,
+0xbafa0000,
+0xfb840804,
+0xbcbc0000,
+0xfb840804,
+0xbd1e0000,
+0xfb840804,
+0xbed10000,
+0xfb840804,
+0xbf5e0000,
+0xfb840804,
+0xbf8e0000,
+0xfb840804,
+0xc2630000,
+0xfb840804,
+0xc2ee0000,
+0xfb840804,
+0xc3ab0000,
+0xfb840804,
+0xc6080000,
+0xfb840804,
+0xc7350000,
+0xfb840804,
+0xc8140000,
+0xfb840804,
+0xcc360000,
+0xfb840804,
+0xcc920000,
+0xfb840804,
+0xcfa10000,
+0xfb840804,
+0xcfb80000,
+0xfb840804,
+0xd0440000,
+0xfb840804,
+0xd0f20000,
+0xfb840804,
+0xd0f30000,
+0xfb840804,
+0xd1190000,
+0xfb840804,
+0xd1330000,
+0xfb840804,
+0xd2490000,
+0xfb840804,
+0xd41d0000,
+0xfb840804,
+0xd6260000,
+0xfb840804,
+0xd69a0000,
+0xfb840804,
+0xd6c50000,
+0xfb840804,
+0xd97c0000,
+0xfb840804,
+0xdaa70000,
+0xfb840804,
+0xdbab0000,
+0xfb840804,
+0xdc800000,
+0xfb840804,
+0xdcd00000,
+0xfb840804,
+0xdf860000,
+0xfb840804,
+0xe1da0000,
+0xfb840804,
+0xe2280000,
+0xfb840804,
+0xe2470000,
+0xfb840804,
+0xe2d90000,
+0xfb840804,
+0xe33e0000,
+0xfb840804,
+0xe4da0000,
+0xfb840804,
+0xe5230000,
+0xfb840804,
+0xe5a80000,
+0xfb840804,
+0xe7a70000,
+0xfb840804,
+0xe7b50000,
+0xfb840804,
+0xeb3c0000,
+0xfb840804,
+0xec360000,
+0xfb840804,
+0xecd50000,
+0xfb840804,
+0xed6b0000,
+0xfb840804,
+0xef2c0000,
+0xfb840804,
+0xefb10000,
+0xfb840804,
+0xf0d20000,
+0xfb840804,
+0xf3ca0000,
+0xfb840804,
+0xf6670000,
+0xfb840804,
+0xf8ae0000,
+0xfb840804,
+0xf9660000,
+0xfb840804,
+0xfca80000,
+0xfb840804,
+0xfed30000,
+0xfb840804,
+0xff2f0000,
+0xfb850804,
+0x85d20000,
+0xfb850804,
+0x85ed0000,
+0xfb850804,
+0x872e0000,
+0xfb850804,
+0x8bfa0000,
+0xfb850804,
+0x8d770000,
+0xfb850804,
+0x91450000,
+0xfb850804,
+0x91df0000,
+0xfb850804,
+0x921a0000,
+0xfb850804,
+0x940a0000,
+0xfb850804,
+0x94960000,
+0xfb850804,
+0x95b60000,
+0xfb850804,
+0x9b300000,
+0xfb850804,
+0xa0ce0000,
+0xfb850804,
+0xa1050000,
+0xfb850804,
+0xa20e0000,
+0xfb850804,
+0xa2910000,
+0xfb850804,
+0xa3920000,
+0xfb850804,
+0xa6000000,
+0xfffd0804,
+};
+
+const Irange<char32_t const*> collation_elements_table {std::begin(collation_elements_array), std::end(collation_elements_array)};
+
+const KeyValue<char32_t, char32_t> collation_single_array[] {
+{0x0,0x1},
+{0x1,0x1},
+{0x2,0x1},
+{0x3,0x1},
+{0x4,0x1},
+{0x5,0x1},
+{0x6,0x1},
+{0x7,0x1},
+{0x8,0x1},
+{0x9,0x21},
+{0xa,0x41},
+{0xb,0x61},
+{0xc,0x81},
+{0xd,0xa1},
+{0xe,0x1},
+{0xf,0x1},
+{0x10,0x1},
+{0x11,0x1},
+{0x12,0x1},
+{0x13,0x1},
+{0x14,0x1},
+{0x15,0x1},
+{0x16,0x1},
+{0x17,0x1},
+{0x18,0x1},
+{0x19,0x1},
+{0x1a,0x1},
+{0x1b,0x1},
+{0x1c,0x1},
+{0x1d,0x1},
+{0x1e,0x1},
+{0x1f,0x1},
+{0x20,0xc1},
+{0x21,0xe1},
+{0x22,0x101},
+{0x23,0x121},
+{0x24,0x37ac1},
+{0x25,0x141},
+{0x26,0x161},
+{0x27,0x181},
+{0x28,0x1a1},
+{0x29,0x1c1},
+{0x2a,0x1e1},
+{0x2b,0x201},
+{0x2c,0x221},
+{0x2d,0x241},
+{0x2e,0x261},
+{0x2f,0x281},
+{0x30,0x380c1},
+{0x31,0x382e1},
+{0x32,0x3a041},
+{0x33,0x3aec1},
+{0x34,0x3b641},
+{0x35,0x3bc01},
+{0x36,0x3bfe1},
+{0x37,0x3c301},
+{0x38,0x3c681},
+{0x39,0x3c9a1},
+{0x3a,0x2a1},
+{0x3b,0x2c1},
+{0x3c,0x2e1},
+{0x3d,0x301},
+{0x3e,0x321},
+{0x3f,0x341},
+{0x40,0x361},
+{0x41,0x3cd81},
+{0x42,0x3ee01},
+{0x43,0x3f441},
+{0x44,0x40081},
+{0x45,0x40de1},
+{0x46,0x423a1},
+{0x47,0x42b41},
+{0x48,0x43601},
+{0x49,0x44081},
+{0x4a,0x450c1},
+{0x4b,0x45521},
+{0x4c,0x460e1},
+{0x4d,0x46f81},
+{0x4e,0x47be1},
+{0x4f,0x48921},
+{0x50,0x4a9e1},
+{0x51,0x4b341},
+{0x52,0x4b681},
+{0x53,0x4c541},
+{0x54,0x4d4a1},
+{0x55,0x4dfc1},
+{0x56,0x4f901},
+{0x57,0x50181},
+{0x58,0x50821},
+{0x59,0x50dc1},
+{0x5a,0x515e1},
+{0x5b,0x381},
+{0x5c,0x3a1},
+{0x5d,0x3c1},
+{0x5e,0x3e1},
+{0x5f,0x401},
+{0x60,0x421},
+{0x61,0x3cc81},
+{0x62,0x3ed01},
+{0x63,0x3f341},
+{0x64,0x3ff81},
+{0x65,0x40ce1},
+{0x66,0x422a1},
+{0x67,0x42a41},
+{0x68,0x43501},
+{0x69,0x43f81},
+{0x6a,0x44fe1},
+{0x6b,0x45421},
+{0x6c,0x45fe1},
+{0x6d,0x46e81},
+{0x6e,0x47ae1},
+{0x6f,0x48821},
+{0x70,0x4a8e1},
+{0x71,0x4b261},
+{0x72,0x4b581},
+{0x73,0x4c441},
+{0x74,0x4d3a1},
+{0x75,0x4dec1},
+{0x76,0x4f801},
+{0x77,0x50081},
+{0x78,0x50721},
+{0x79,0x50ce1},
+{0x7a,0x514e1},
+{0x7b,0x441},
+{0x7c,0x461},
+{0x7d,0x481},
+{0x7e,0x4a1},
+{0x7f,0x1},
+{0x80,0x1},
+{0x81,0x1},
+{0x82,0x1},
+{0x83,0x1},
+{0x84,0x1},
+{0x85,0x4c1},
+{0x86,0x1},
+{0x87,0x1},
+{0x88,0x1},
+{0x89,0x1},
+{0x8a,0x1},
+{0x8b,0x1},
+{0x8c,0x1},
+{0x8d,0x1},
+{0x8e,0x1},
+{0x8f,0x1},
+{0x90,0x1},
+{0x91,0x1},
+{0x92,0x1},
+{0x93,0x1},
+{0x94,0x1},
+{0x95,0x1},
+{0x96,0x1},
+{0x97,0x1},
+{0x98,0x1},
+{0x99,0x1},
+{0x9a,0x1},
+{0x9b,0x1},
+{0x9c,0x1},
+{0x9d,0x1},
+{0x9e,0x1},
+{0x9f,0x1},
+{0xa0,0x4e1},
+{0xa1,0x501},
+{0xa2,0x37a81},
+{0xa3,0x37b21},
+{0xa4,0x37a61},
+{0xa5,0x37b61},
+{0xa6,0x521},
+{0xa7,0x541},
+{0xa8,0x561},
+{0xa9,0x581},
+{0xaa,0x3ce61},
+{0xab,0x5a1},
+{0xac,0x5c1},
+{0xad,0x1},
+{0xae,0x5e1},
+{0xaf,0x601},
+{0xb0,0x621},
+{0xb1,0x641},
+{0xb2,0x3a1c1},
+{0xb3,0x3b041},
+{0xb4,0x661},
+{0xb5,0x55f61},
+{0xb6,0x681},
+{0xb7,0x6a1},
+{0xb8,0x6c1},
+{0xb9,0x38461},
+{0xba,0x48a01},
+{0xbb,0x6e1},
+{0xbc,0x39143},
+{0xbd,0x38bc3},
+{0xbe,0x3b2c3},
+{0xbf,0x701},
+{0xc0,0x3cf82},
+{0xc1,0x3cf02},
+{0xc2,0x3d382},
+{0xc3,0x3da82},
+{0xc4,0x3d902},
+{0xc5,0x3d782},
+{0xc6,0x3e2c3},
+{0xc7,0x3f842},
+{0xc8,0x40fe2},
+{0xc9,0x40f62},
+{0xca,0x410e2},
+{0xcb,0x414e2},
+{0xcc,0x442a2},
+{0xcd,0x44222},
+{0xce,0x443a2},
+{0xcf,0x444a2},
+{0xd0,0x40582},
+{0xd1,0x47ee2},
+{0xd2,0x48b22},
+{0xd3,0x48aa2},
+{0xd4,0x48c22},
+{0xd5,0x49262},
+{0xd6,0x49062},
+{0xd7,0x721},
+{0xd8,0x49662},
+{0xd9,0x4e1c2},
+{0xda,0x4e142},
+{0xdb,0x4e2c2},
+{0xdc,0x4e482},
+{0xdd,0x50f22},
+{0xde,0x51e21},
+{0xdf,0x4cfa3},
+{0xe0,0x3cf42},
+{0xe1,0x3cec2},
+{0xe2,0x3d342},
+{0xe3,0x3da42},
+{0xe4,0x3d882},
+{0xe5,0x3d742},
+{0xe6,0x3e263},
+{0xe7,0x3f7c2},
+{0xe8,0x40fa2},
+{0xe9,0x40f22},
+{0xea,0x410a2},
+{0xeb,0x414a2},
+{0xec,0x44262},
+{0xed,0x441e2},
+{0xee,0x44362},
+{0xef,0x44462},
+{0xf0,0x40542},
+{0xf1,0x47ea2},
+{0xf2,0x48ae2},
+{0xf3,0x48a62},
+{0xf4,0x48be2},
+{0xf5,0x49222},
+{0xf6,0x48fe2},
+{0xf7,0x741},
+{0xf8,0x49622},
+{0xf9,0x4e182},
+{0xfa,0x4e102},
+{0xfb,0x4e282},
+{0xfc,0x4e402},
+{0xfd,0x50ee2},
+{0xfe,0x51e01},
+{0xff,0x510a2},
+{0x100,0x3dcc2},
+{0x101,0x3dc82},
+{0x102,0x3d002},
+{0x103,0x3cfc2},
+{0x104,0x3dc42},
+{0x105,0x3dc02},
+{0x106,0x3f602},
+{0x107,0x3f5c2},
+{0x108,0x3f682},
+{0x109,0x3f642},
+{0x10a,0x3f782},
+{0x10b,0x3f742},
+{0x10c,0x3f702},
+{0x10d,0x3f6c2},
+{0x10e,0x40202},
+{0x10f,0x401c2},
+{0x110,0x40382},
+{0x111,0x40342},
+{0x112,0x41822},
+{0x113,0x417e2},
+{0x114,0x41062},
+{0x115,0x41022},
+{0x116,0x415e2},
+{0x117,0x415a2},
+{0x118,0x417a2},
+{0x119,0x41762},
+{0x11a,0x41462},
+{0x11b,0x41422},
+{0x11c,0x42da2},
+{0x11d,0x42d62},
+{0x11e,0x42d22},
+{0x11f,0x42ce2},
+{0x120,0x42ea2},
+{0x121,0x42e62},
+{0x122,0x42f22},
+{0x123,0x42ee2},
+{0x124,0x43782},
+{0x125,0x43742},
+{0x126,0x43a02},
+{0x127,0x439c2},
+{0x128,0x445e2},
+{0x129,0x445a2},
+{0x12a,0x44722},
+{0x12b,0x446e2},
+{0x12c,0x44322},
+{0x12d,0x442e2},
+{0x12e,0x446a2},
+{0x12f,0x44662},
+{0x130,0x44622},
+{0x131,0x44da1},
+{0x132,0x44be2},
+{0x133,0x44ba2},
+{0x134,0x45242},
+{0x135,0x45202},
+{0x136,0x457a2},
+{0x137,0x45762},
+{0x138,0x4b561},
+{0x139,0x46282},
+{0x13a,0x46242},
+{0x13b,0x46382},
+{0x13c,0x46342},
+{0x13d,0x46302},
+{0x13e,0x462c2},
+{0x13f,0x466c2},
+{0x140,0x46682},
+{0x141,0x46402},
+{0x142,0x463c2},
+{0x143,0x47d62},
+{0x144,0x47d22},
+{0x145,0x47fe2},
+{0x146,0x47fa2},
+{0x147,0x47e62},
+{0x148,0x47e22},
+{0x149,0x52302},
+{0x14a,0x487c1},
+{0x14b,0x487a1},
+{0x14c,0x498e2},
+{0x14d,0x498a2},
+{0x14e,0x48ba2},
+{0x14f,0x48b62},
+{0x150,0x491e2},
+{0x151,0x491a2},
+{0x152,0x4a243},
+{0x153,0x4a1e3},
+{0x154,0x4b802},
+{0x155,0x4b7c2},
+{0x156,0x4b982},
+{0x157,0x4b942},
+{0x158,0x4b882},
+{0x159,0x4b842},
+{0x15a,0x4c722},
+{0x15b,0x4c6e2},
+{0x15c,0x4c862},
+{0x15d,0x4c822},
+{0x15e,0x4caa2},
+{0x15f,0x4ca62},
+{0x160,0x4c8e2},
+{0x161,0x4c8a2},
+{0x162,0x4d762},
+{0x163,0x4d722},
+{0x164,0x4d622},
+{0x165,0x4d5e2},
+{0x166,0x4dd01},
+{0x167,0x4dce1},
+{0x168,0x4e8c2},
+{0x169,0x4e882},
+{0x16a,0x4ea82},
+{0x16b,0x4ea42},
+{0x16c,0x4e242},
+{0x16d,0x4e202},
+{0x16e,0x4e3c2},
+{0x16f,0x4e382},
+{0x170,0x4e842},
+{0x171,0x4e802},
+{0x172,0x4ea02},
+{0x173,0x4e9c2},
+{0x174,0x503e2},
+{0x175,0x503a2},
+{0x176,0x51022},
+{0x177,0x50fe2},
+{0x178,0x510e2},
+{0x179,0x51742},
+{0x17a,0x51702},
+{0x17b,0x518c2},
+{0x17c,0x51882},
+{0x17d,0x51842},
+{0x17e,0x51802},
+{0x17f,0x4cd22},
+{0x180,0x3f161},
+{0x181,0x3f281},
+{0x182,0x3f2c1},
+{0x183,0x3f2a1},
+{0x184,0x52241},
+{0x185,0x52221},
+{0x186,0x4a5a1},
+{0x187,0x3fea1},
+{0x188,0x3fe81},
+{0x189,0x40bc1},
+{0x18a,0x40c01},
+{0x18b,0x40c61},
+{0x18c,0x40c41},
+{0x18d,0x51a02},
+{0x18e,0x41f61},
+{0x18f,0x42001},
+{0x190,0x420a1},
+{0x191,0x429c1},
+{0x192,0x429a1},
+{0x193,0x433c1},
+{0x194,0x43481},
+{0x195,0x43d81},
+{0x196,0x44f81},
+{0x197,0x44ec1},
+{0x198,0x45e81},
+{0x199,0x45e61},
+{0x19a,0x46b41},
+{0x19b,0x46e41},
+{0x19c,0x4f6c1},
+{0x19d,0x48621},
+{0x19e,0x48661},
+{0x19f,0x4a781},
+{0x1a0,0x49ca2},
+{0x1a1,0x49c62},
+{0x1a2,0x434e1},
+{0x1a3,0x434c1},
+{0x1a4,0x4b141},
+{0x1a5,0x4b121},
+{0x1a6,0x4bfe1},
+{0x1a7,0x521c1},
+{0x1a8,0x521a1},
+{0x1a9,0x4d2a1},
+{0x1aa,0x4d321},
+{0x1ab,0x4dd81},
+{0x1ac,0x4dde1},
+{0x1ad,0x4ddc1},
+{0x1ae,0x4de21},
+{0x1af,0x4ed82},
+{0x1b0,0x4ed42},
+{0x1b1,0x4f7a1},
+{0x1b2,0x4ff61},
+{0x1b3,0x51421},
+{0x1b4,0x51401},
+{0x1b5,0x51a81},
+{0x1b6,0x51a61},
+{0x1b7,0x51c81},
+{0x1b8,0x51d81},
+{0x1b9,0x51d61},
+{0x1ba,0x51dc1},
+{0x1bb,0x520c1},
+{0x1bc,0x52201},
+{0x1bd,0x521e1},
+{0x1be,0x4dbc2},
+{0x1bf,0x51ec1},
+{0x1c0,0x525a1},
+{0x1c1,0x525c1},
+{0x1c2,0x525e1},
+{0x1c3,0x52601},
+{0x1c4,0x40a43},
+{0x1c5,0x409e3},
+{0x1c6,0x40983},
+{0x1c7,0x46782},
+{0x1c8,0x46742},
+{0x1c9,0x46702},
+{0x1ca,0x483c2},
+{0x1cb,0x48382},
+{0x1cc,0x48342},
+{0x1cd,0x3d702},
+{0x1ce,0x3d6c2},
+{0x1cf,0x44422},
+{0x1d0,0x443e2},
+{0x1d1,0x48fa2},
+{0x1d2,0x48f62},
+{0x1d3,0x4e342},
+{0x1d4,0x4e302},
+{0x1d5,0x4e7a3},
+{0x1d6,0x4e743},
+{0x1d7,0x4e563},
+{0x1d8,0x4e503},
+{0x1d9,0x4e6e3},
+{0x1da,0x4e683},
+{0x1db,0x4e623},
+{0x1dc,0x4e5c3},
+{0x1dd,0x41f41},
+{0x1de,0x3d9e3},
+{0x1df,0x3d983},
+{0x1e0,0x3dba3},
+{0x1e1,0x3db43},
+{0x1e2,0x3e504},
+{0x1e3,0x3e484},
+{0x1e4,0x43361},
+{0x1e5,0x43341},
+{0x1e6,0x42e22},
+{0x1e7,0x42de2},
+{0x1e8,0x45722},
+{0x1e9,0x456e2},
+{0x1ea,0x497a2},
+{0x1eb,0x49762},
+{0x1ec,0x49843},
+{0x1ed,0x497e3},
+{0x1ee,0x51d02},
+{0x1ef,0x51cc2},
+{0x1f0,0x45282},
+{0x1f1,0x40942},
+{0x1f2,0x40902},
+{0x1f3,0x408c2},
+{0x1f4,0x42ca2},
+{0x1f5,0x42c62},
+{0x1f6,0x43da1},
+{0x1f7,0x51ee1},
+{0x1f8,0x47de2},
+{0x1f9,0x47da2},
+{0x1fa,0x3d823},
+{0x1fb,0x3d7c3},
+{0x1fc,0x3e404},
+{0x1fd,0x3e384},
+{0x1fe,0x49703},
+{0x1ff,0x496a3},
+{0x200,0x3ddc2},
+{0x201,0x3dd82},
+{0x202,0x3de42},
+{0x203,0x3de02},
+{0x204,0x41aa2},
+{0x205,0x41a62},
+{0x206,0x41b22},
+{0x207,0x41ae2},
+{0x208,0x44822},
+{0x209,0x447e2},
+{0x20a,0x448a2},
+{0x20b,0x44862},
+{0x20c,0x49ba2},
+{0x20d,0x49b62},
+{0x20e,0x49c22},
+{0x20f,0x49be2},
+{0x210,0x4ba82},
+{0x211,0x4ba42},
+{0x212,0x4bb02},
+{0x213,0x4bac2},
+{0x214,0x4ec82},
+{0x215,0x4ec42},
+{0x216,0x4ed02},
+{0x217,0x4ecc2},
+{0x218,0x4cce2},
+{0x219,0x4cca2},
+{0x21a,0x4d862},
+{0x21b,0x4d822},
+{0x21c,0x514c1},
+{0x21d,0x514a1},
+{0x21e,0x43802},
+{0x21f,0x437c2},
+{0x220,0x48681},
+{0x221,0x40c81},
+{0x222,0x4a881},
+{0x223,0x4a861},
+{0x224,0x51b01},
+{0x225,0x51ae1},
+{0x226,0x3db02},
+{0x227,0x3dac2},
+{0x228,0x41662},
+{0x229,0x41622},
+{0x22a,0x49143},
+{0x22b,0x490e3},
+{0x22c,0x49483},
+{0x22d,0x49423},
+{0x22e,0x49522},
+{0x22f,0x494e2},
+{0x230,0x495c3},
+{0x231,0x49563},
+{0x232,0x51262},
+{0x233,0x51222},
+{0x234,0x46da1},
+{0x235,0x48741},
+{0x236,0x4de41},
+{0x237,0x452c1},
+{0x238,0x406c2},
+{0x239,0x4b442},
+{0x23a,0x3eaa1},
+{0x23b,0x3fe01},
+{0x23c,0x3fde1},
+{0x23d,0x46b61},
+{0x23e,0x4dd41},
+{0x23f,0x4d1e1},
+{0x240,0x51ba1},
+{0x241,0x522a1},
+{0x242,0x52281},
+{0x243,0x3f181},
+{0x244,0x4f521},
+{0x245,0x50041},
+{0x246,0x41ec1},
+{0x247,0x41ea1},
+{0x248,0x45341},
+{0x249,0x45321},
+{0x24a,0x4b541},
+{0x24b,0x4b521},
+{0x24c,0x4c0c1},
+{0x24d,0x4c0a1},
+{0x24e,0x513e1},
+{0x24f,0x513c1},
+{0x250,0x3eb61},
+{0x251,0x3ebc1},
+{0x252,0x3ec81},
+{0x253,0x3f261},
+{0x254,0x4a581},
+{0x255,0x3fec1},
+{0x256,0x40ba1},
+{0x257,0x40be1},
+{0x258,0x42121},
+{0x259,0x41fc1},
+{0x25a,0x42141},
+{0x25b,0x42081},
+{0x25c,0x42161},
+{0x25d,0x42221},
+{0x25e,0x42241},
+{0x25f,0x453c1},
+{0x260,0x433a1},
+{0x261,0x43281},
+{0x262,0x43301},
+{0x263,0x43461},
+{0x264,0x42281},
+{0x265,0x4f601},
+{0x266,0x43de1},
+{0x267,0x43f21},
+{0x268,0x44ea1},
+{0x269,0x44f61},
+{0x26a,0x44de1},
+{0x26b,0x46bc1},
+{0x26c,0x46c81},
+{0x26d,0x46d41},
+{0x26e,0x46de1},
+{0x26f,0x4f6a1},
+{0x270,0x4f741},
+{0x271,0x47a01},
+{0x272,0x48601},
+{0x273,0x48701},
+{0x274,0x48541},
+{0x275,0x4a761},
+{0x276,0x4a461},
+{0x277,0x4a801},
+{0x278,0x4b201},
+{0x279,0x4c101},
+{0x27a,0x4c161},
+{0x27b,0x4c1a1},
+{0x27c,0x4c201},
+{0x27d,0x4c221},
+{0x27e,0x4c281},
+{0x27f,0x4c2c1},
+{0x280,0x4bfa1},
+{0x281,0x4c381},
+{0x282,0x4d1a1},
+{0x283,0x4d261},
+{0x284,0x45401},
+{0x285,0x4d341},
+{0x286,0x4d381},
+{0x287,0x4de81},
+{0x288,0x4de01},
+{0x289,0x4f501},
+{0x28a,0x4f781},
+{0x28b,0x4ff41},
+{0x28c,0x50021},
+{0x28d,0x50701},
+{0x28e,0x46e61},
+{0x28f,0x513a1},
+{0x290,0x51b21},
+{0x291,0x51b61},
+{0x292,0x51c61},
+{0x293,0x51de1},
+{0x294,0x52261},
+{0x295,0x52421},
+{0x296,0x52581},
+{0x297,0x52621},
+{0x298,0x52641},
+{0x299,0x3f141},
+{0x29a,0x42261},
+{0x29b,0x433e1},
+{0x29c,0x43d61},
+{0x29d,0x45361},
+{0x29e,0x45fa1},
+{0x29f,0x46a41},
+{0x2a0,0x4b501},
+{0x2a1,0x52541},
+{0x2a2,0x52561},
+{0x2a3,0x408c2},
+{0x2a4,0x40ae2},
+{0x2a5,0x40aa2},
+{0x2a6,0x4dbc2},
+{0x2a7,0x4dc02},
+{0x2a8,0x4da22},
+{0x2a9,0x42822},
+{0x2aa,0x46922},
+{0x2ab,0x46a02},
+{0x2ac,0x52661},
+{0x2ad,0x52681},
+{0x2ae,0x4f661},
+{0x2af,0x4f681},
+{0x2b0,0x436e1},
+{0x2b1,0x43e21},
+{0x2b2,0x451a1},
+{0x2b3,0x4b761},
+{0x2b4,0x4c121},
+{0x2b5,0x4c1c1},
+{0x2b6,0x4c3a1},
+{0x2b7,0x50261},
+{0x2b8,0x50ea1},
+{0x2b9,0x761},
+{0x2ba,0x781},
+{0x2bb,0x43f41},
+{0x2bc,0x522e1},
+{0x2bd,0x43f61},
+{0x2be,0x52361},
+{0x2bf,0x52461},
+{0x2c0,0x522c1},
+{0x2c1,0x52481},
+{0x2c2,0x7a1},
+{0x2c3,0x7c1},
+{0x2c4,0x7e1},
+{0x2c5,0x801},
+{0x2c6,0x821},
+{0x2c7,0x841},
+{0x2c8,0x861},
+{0x2c9,0x881},
+{0x2ca,0x8a1},
+{0x2cb,0x8c1},
+{0x2cc,0x8e1},
+{0x2cd,0x901},
+{0x2ce,0x921},
+{0x2cf,0x941},
+{0x2d0,0x37661},
+{0x2d1,0x37681},
+{0x2d2,0x961},
+{0x2d3,0x981},
+{0x2d4,0x9a1},
+{0x2d5,0x9c1},
+{0x2d6,0x9e1},
+{0x2d7,0xa01},
+{0x2d8,0xa21},
+{0x2d9,0xa41},
+{0x2da,0xa61},
+{0x2db,0xa81},
+{0x2dc,0xaa1},
+{0x2dd,0xac1},
+{0x2de,0xae1},
+{0x2df,0xb01},
+{0x2e0,0x434a1},
+{0x2e1,0x461e1},
+{0x2e2,0x4c681},
+{0x2e3,0x50921},
+{0x2e4,0x52441},
+{0x2e5,0xb21},
+{0x2e6,0xb41},
+{0x2e7,0xb61},
+{0x2e8,0xb81},
+{0x2e9,0xba1},
+{0x2ea,0xbc1},
+{0x2eb,0xbe1},
+{0x2ec,0xc01},
+{0x2ed,0xc21},
+{0x2ee,0x52341},
+{0x2ef,0xc41},
+{0x2f0,0xc61},
+{0x2f1,0xc81},
+{0x2f2,0xca1},
+{0x2f3,0xcc1},
+{0x2f4,0xce1},
+{0x2f5,0xd01},
+{0x2f6,0xd21},
+{0x2f7,0xd41},
+{0x2f8,0xd61},
+{0x2f9,0xd81},
+{0x2fa,0xda1},
+{0x2fb,0xdc1},
+{0x2fc,0xde1},
+{0x2fd,0xe01},
+{0x2fe,0xe21},
+{0x2ff,0xe41},
+{0x300,0x35501},
+{0x301,0x354e1},
+{0x302,0x35541},
+{0x303,0x35641},
+{0x304,0x356e1},
+{0x305,0x35821},
+{0x306,0x35521},
+{0x307,0x35661},
+{0x308,0x355c1},
+{0x309,0x35841},
+{0x30a,0x35581},
+{0x30b,0x35621},
+{0x30c,0x35561},
+{0x30d,0x35701},
+{0x30e,0x35701},
+{0x30f,0x35861},
+{0x310,0x35881},
+{0x311,0x358a1},
+{0x312,0x35701},
+{0x313,0x354a1},
+{0x314,0x354c1},
+{0x315,0x35701},
+{0x316,0x35721},
+{0x317,0x35721},
+{0x318,0x35721},
+{0x319,0x35721},
+{0x31a,0x35701},
+{0x31b,0x358c1},
+{0x31c,0x35721},
+{0x31d,0x35721},
+{0x31e,0x35721},
+{0x31f,0x35721},
+{0x320,0x35721},
+{0x321,0x358e1},
+{0x322,0x35901},
+{0x323,0x35921},
+{0x324,0x35941},
+{0x325,0x35961},
+{0x326,0x35981},
+{0x327,0x356a1},
+{0x328,0x356c1},
+{0x329,0x35721},
+{0x32a,0x35721},
+{0x32b,0x35721},
+{0x32c,0x35721},
+{0x32d,0x359a1},
+{0x32e,0x359c1},
+{0x32f,0x35721},
+{0x330,0x359e1},
+{0x331,0x35a01},
+{0x332,0x35481},
+{0x333,0x35721},
+{0x334,0x35a21},
+{0x335,0x35801},
+{0x336,0x35741},
+{0x337,0x35741},
+{0x338,0x35681},
+{0x339,0x35a41},
+{0x33a,0x35721},
+{0x33b,0x35721},
+{0x33c,0x35721},
+{0x33d,0x35701},
+{0x33e,0x35701},
+{0x33f,0x35701},
+{0x340,0x35501},
+{0x341,0x354e1},
+{0x342,0x355a1},
+{0x343,0x354a1},
+{0x344,0x355e2},
+{0x345,0x35a61},
+{0x346,0x35701},
+{0x347,0x35721},
+{0x348,0x35721},
+{0x349,0x35721},
+{0x34a,0x35701},
+{0x34b,0x35701},
+{0x34c,0x35701},
+{0x34d,0x35721},
+{0x34e,0x35721},
+{0x34f,0x1},
+{0x350,0x35701},
+{0x351,0x35701},
+{0x352,0x35701},
+{0x353,0x35721},
+{0x354,0x35721},
+{0x355,0x35721},
+{0x356,0x35721},
+{0x357,0x35701},
+{0x358,0x35a81},
+{0x359,0x35721},
+{0x35a,0x35721},
+{0x35b,0x35701},
+{0x35c,0x35721},
+{0x35d,0x35701},
+{0x35e,0x35701},
+{0x35f,0x35721},
+{0x360,0x35aa1},
+{0x361,0x35ac1},
+{0x362,0x35721},
+{0x363,0x3ccc1},
+{0x364,0x40d21},
+{0x365,0x43fc1},
+{0x366,0x48861},
+{0x367,0x4df01},
+{0x368,0x3f381},
+{0x369,0x3ffc1},
+{0x36a,0x43541},
+{0x36b,0x46ec1},
+{0x36c,0x4b5c1},
+{0x36d,0x4d3e1},
+{0x36e,0x4f841},
+{0x36f,0x50761},
+{0x370,0x541a1},
+{0x371,0x54181},
+{0x372,0x58a01},
+{0x373,0x589e1},
+{0x374,0x761},
+{0x375,0xe61},
+{0x376,0x540a1},
+{0x377,0x54081},
+{0x37a,0x55321},
+{0x37b,0x56cc1},
+{0x37c,0x56c81},
+{0x37d,0x56d01},
+{0x37e,0x2c1},
+{0x37f,0x55d21},
+{0x384,0x661},
+{0x385,0xe82},
+{0x386,0x53462},
+{0x387,0x6a1},
+{0x388,0x53f42},
+{0x389,0x54f82},
+{0x38a,0x55962},
+{0x38c,0x567a2},
+{0x38e,0x572c2},
+{0x38f,0x586e2},
+{0x390,0x55b63},
+{0x391,0x526e1},
+{0x392,0x53861},
+{0x393,0x53921},
+{0x394,0x53a01},
+{0x395,0x53ac1},
+{0x396,0x54141},
+{0x397,0x54201},
+{0x398,0x55281},
+{0x399,0x55361},
+{0x39a,0x55da1},
+{0x39b,0x55ee1},
+{0x39c,0x55fa1},
+{0x39d,0x56221},
+{0x39e,0x562a1},
+{0x39f,0x56321},
+{0x3a0,0x568c1},
+{0x3a1,0x56a41},
+{0x3a3,0x56c01},
+{0x3a4,0x56d81},
+{0x3a5,0x56e01},
+{0x3a6,0x57741},
+{0x3a7,0x57801},
+{0x3a8,0x578c1},
+{0x3a9,0x57961},
+{0x3aa,0x55b22},
+{0x3ab,0x574c2},
+{0x3ac,0x53422},
+{0x3ad,0x53f02},
+{0x3ae,0x54f42},
+{0x3af,0x55922},
+{0x3b0,0x57543},
+{0x3b1,0x526a1},
+{0x3b2,0x53801},
+{0x3b3,0x538e1},
+{0x3b4,0x539c1},
+{0x3b5,0x53a61},
+{0x3b6,0x54101},
+{0x3b7,0x541c1},
+{0x3b8,0x55221},
+{0x3b9,0x55301},
+{0x3ba,0x55d41},
+{0x3bb,0x55ea1},
+{0x3bc,0x55f41},
+{0x3bd,0x561e1},
+{0x3be,0x56261},
+{0x3bf,0x562e1},
+{0x3c0,0x56861},
+{0x3c1,0x569e1},
+{0x3c2,0x56c61},
+{0x3c3,0x56ba1},
+{0x3c4,0x56d41},
+{0x3c5,0x56dc1},
+{0x3c6,0x576e1},
+{0x3c7,0x577c1},
+{0x3c8,0x57881},
+{0x3c9,0x57921},
+{0x3ca,0x55ae2},
+{0x3cb,0x57482},
+{0x3cc,0x56762},
+{0x3cd,0x57282},
+{0x3ce,0x586a2},
+{0x3cf,0x55e43},
+{0x3d0,0x53821},
+{0x3d1,0x55241},
+{0x3d2,0x56e21},
+{0x3d3,0x57302},
+{0x3d4,0x57502},
+{0x3d5,0x57701},
+{0x3d6,0x56881},
+{0x3d7,0x55de3},
+{0x3d8,0x569c1},
+{0x3d9,0x569a1},
+{0x3da,0x540e1},
+{0x3db,0x540c1},
+{0x3dc,0x54041},
+{0x3dd,0x54001},
+{0x3de,0x56981},
+{0x3df,0x56961},
+{0x3e0,0x589c1},
+{0x3e1,0x589a1},
+{0x3e2,0x592a1},
+{0x3e3,0x59281},
+{0x3e4,0x593e1},
+{0x3e5,0x593c1},
+{0x3e6,0x59421},
+{0x3e7,0x59401},
+{0x3e8,0x594e1},
+{0x3e9,0x594c1},
+{0x3ea,0x596a1},
+{0x3eb,0x59681},
+{0x3ec,0x59761},
+{0x3ed,0x59741},
+{0x3ee,0x59861},
+{0x3ef,0x59841},
+{0x3f0,0x55d61},
+{0x3f1,0x56a01},
+{0x3f2,0x56bc1},
+{0x3f3,0x55d01},
+{0x3f4,0x552a1},
+{0x3f5,0x53a81},
+{0x3f6,0xec1},
+{0x3f7,0x58a41},
+{0x3f8,0x58a21},
+{0x3f9,0x56c21},
+{0x3fa,0x56941},
+{0x3fb,0x56921},
+{0x3fc,0x56b81},
+{0x3fd,0x56ce1},
+{0x3fe,0x56ca1},
+{0x3ff,0x56d21},
+{0x400,0x5a1c2},
+{0x401,0x5a2c2},
+{0x402,0x5a041},
+{0x403,0x59d82},
+{0x404,0x5a341},
+{0x405,0x5a781},
+{0x406,0x5ab21},
+{0x407,0x5abc2},
+{0x408,0x5aca1},
+{0x409,0x5b161},
+{0x40a,0x5b541},
+{0x40b,0x5bc01},
+{0x40c,0x5adc2},
+{0x40d,0x5a982},
+{0x40e,0x5bcc2},
+{0x40f,0x5c7a1},
+{0x410,0x59a01},
+{0x411,0x59c61},
+{0x412,0x59cc1},
+{0x413,0x59d21},
+{0x414,0x59f81},
+{0x415,0x5a161},
+{0x416,0x5a3a1},
+{0x417,0x5a5c1},
+{0x418,0x5a921},
+{0x419,0x5ac61},
+{0x41a,0x5ad61},
+{0x41b,0x5b001},
+{0x41c,0x5b281},
+{0x41d,0x5b361},
+{0x41e,0x5b5e1},
+{0x41f,0x5b7a1},
+{0x420,0x5b8c1},
+{0x421,0x5b9a1},
+{0x422,0x5bac1},
+{0x423,0x5bc61},
+{0x424,0x5bfe1},
+{0x425,0x5c041},
+{0x426,0x5c381},
+{0x427,0x5c4e1},
+{0x428,0x5c801},
+{0x429,0x5c8a1},
+{0x42a,0x5c981},
+{0x42b,0x5ca41},
+{0x42c,0x5cb21},
+{0x42d,0x5cc61},
+{0x42e,0x5cd41},
+{0x42f,0x5ce21},
+{0x430,0x599c1},
+{0x431,0x59c21},
+{0x432,0x59c81},
+{0x433,0x59ce1},
+{0x434,0x59f41},
+{0x435,0x5a121},
+{0x436,0x5a361},
+{0x437,0x5a581},
+{0x438,0x5a8e1},
+{0x439,0x5ac41},
+{0x43a,0x5ad21},
+{0x43b,0x5afc1},
+{0x43c,0x5b241},
+{0x43d,0x5b321},
+{0x43e,0x5b5a1},
+{0x43f,0x5b761},
+{0x440,0x5b881},
+{0x441,0x5b961},
+{0x442,0x5ba81},
+{0x443,0x5bc21},
+{0x444,0x5bfa1},
+{0x445,0x5c001},
+{0x446,0x5c341},
+{0x447,0x5c4a1},
+{0x448,0x5c7c1},
+{0x449,0x5c861},
+{0x44a,0x5c941},
+{0x44b,0x5ca01},
+{0x44c,0x5cae1},
+{0x44d,0x5cc41},
+{0x44e,0x5cd01},
+{0x44f,0x5ce01},
+{0x450,0x5a182},
+{0x451,0x5a282},
+{0x452,0x5a021},
+{0x453,0x59d42},
+{0x454,0x5a301},
+{0x455,0x5a761},
+{0x456,0x5ab01},
+{0x457,0x5ab42},
+{0x458,0x5ac81},
+{0x459,0x5b141},
+{0x45a,0x5b521},
+{0x45b,0x5bbe1},
+{0x45c,0x5ad82},
+{0x45d,0x5a942},
+{0x45e,0x5bc82},
+{0x45f,0x5c781},
+{0x460,0x5c221},
+{0x461,0x5c1e1},
+{0x462,0x5cbe1},
+{0x463,0x5cba1},
+{0x464,0x5cec1},
+{0x465,0x5ce81},
+{0x466,0x5cf21},
+{0x467,0x5cee1},
+{0x468,0x5d041},
+{0x469,0x5d021},
+{0x46a,0x5cfc1},
+{0x46b,0x5cf81},
+{0x46c,0x5d0e1},
+{0x46d,0x5d0a1},
+{0x46e,0x5d121},
+{0x46f,0x5d101},
+{0x470,0x5d161},
+{0x471,0x5d141},
+{0x472,0x5d1c1},
+{0x473,0x5d181},
+{0x474,0x5d201},
+{0x475,0x5d1e1},
+{0x476,0x5d262},
+{0x477,0x5d222},
+{0x478,0x5bf81},
+{0x479,0x5bf61},
+{0x47a,0x5c321},
+{0x47b,0x5c301},
+{0x47c,0x5c2e1},
+{0x47d,0x5c2c1},
+{0x47e,0x5c261},
+{0x47f,0x5c241},
+{0x480,0x5b861},
+{0x481,0x5b841},
+{0x482,0xee1},
+{0x483,0x35ae1},
+{0x484,0x35701},
+{0x485,0x354c1},
+{0x486,0x354a1},
+{0x487,0x35701},
+{0x488,0x1},
+{0x489,0x1},
+{0x48a,0x5aae1},
+{0x48b,0x5aac1},
+{0x48c,0x5cb81},
+{0x48d,0x5cb61},
+{0x48e,0x5b901},
+{0x48f,0x5b8e1},
+{0x490,0x59e02},
+{0x491,0x59dc2},
+{0x492,0x59e61},
+{0x493,0x59e41},
+{0x494,0x59ee1},
+{0x495,0x59ec1},
+{0x496,0x5a561},
+{0x497,0x5a541},
+{0x498,0x5a101},
+{0x499,0x5a0e1},
+{0x49a,0x5ae21},
+{0x49b,0x5ae01},
+{0x49c,0x5af21},
+{0x49d,0x5af01},
+{0x49e,0x5aee1},
+{0x49f,0x5aec1},
+{0x4a0,0x5aea1},
+{0x4a1,0x5ae81},
+{0x4a2,0x5b441},
+{0x4a3,0x5b421},
+{0x4a4,0x5b501},
+{0x4a5,0x5b4e1},
+{0x4a6,0x5b821},
+{0x4a7,0x5b801},
+{0x4a8,0x5d301},
+{0x4a9,0x5d2e1},
+{0x4aa,0x5ba61},
+{0x4ab,0x5ba41},
+{0x4ac,0x5bb81},
+{0x4ad,0x5bb61},
+{0x4ae,0x5bea1},
+{0x4af,0x5be81},
+{0x4b0,0x5bee1},
+{0x4b1,0x5bec1},
+{0x4b2,0x5c101},
+{0x4b3,0x5c0e1},
+{0x4b4,0x5c441},
+{0x4b5,0x5c421},
+{0x4b6,0x5c621},
+{0x4b7,0x5c601},
+{0x4b8,0x5c6a1},
+{0x4b9,0x5c681},
+{0x4ba,0x5c141},
+{0x4bb,0x5c121},
+{0x4bc,0x5c721},
+{0x4bd,0x5c701},
+{0x4be,0x5c761},
+{0x4bf,0x5c741},
+{0x4c0,0x5d381},
+{0x4c1,0x5a402},
+{0x4c2,0x5a3c2},
+{0x4c3,0x5ae61},
+{0x4c4,0x5ae41},
+{0x4c5,0x5b061},
+{0x4c6,0x5b041},
+{0x4c7,0x5b481},
+{0x4c8,0x5b461},
+{0x4c9,0x5b401},
+{0x4ca,0x5b3e1},
+{0x4cb,0x5c661},
+{0x4cc,0x5c641},
+{0x4cd,0x5b2c1},
+{0x4ce,0x5b2a1},
+{0x4cf,0x5d361},
+{0x4d0,0x59a62},
+{0x4d1,0x59a22},
+{0x4d2,0x59ae2},
+{0x4d3,0x59aa2},
+{0x4d4,0x59c01},
+{0x4d5,0x59be1},
+{0x4d6,0x5a242},
+{0x4d7,0x5a202},
+{0x4d8,0x59b41},
+{0x4d9,0x59b21},
+{0x4da,0x59ba2},
+{0x4db,0x59b62},
+{0x4dc,0x5a482},
+{0x4dd,0x5a442},
+{0x4de,0x5a622},
+{0x4df,0x5a5e2},
+{0x4e0,0x5a801},
+{0x4e1,0x5a7e1},
+{0x4e2,0x5aa82},
+{0x4e3,0x5aa42},
+{0x4e4,0x5aa02},
+{0x4e5,0x5a9c2},
+{0x4e6,0x5b662},
+{0x4e7,0x5b622},
+{0x4e8,0x5b6c1},
+{0x4e9,0x5b6a1},
+{0x4ea,0x5b722},
+{0x4eb,0x5b6e2},
+{0x4ec,0x5ccc2},
+{0x4ed,0x5cc82},
+{0x4ee,0x5be42},
+{0x4ef,0x5be02},
+{0x4f0,0x5bd42},
+{0x4f1,0x5bd02},
+{0x4f2,0x5bdc2},
+{0x4f3,0x5bd82},
+{0x4f4,0x5c542},
+{0x4f5,0x5c502},
+{0x4f6,0x59f21},
+{0x4f7,0x59f01},
+{0x4f8,0x5caa2},
+{0x4f9,0x5ca62},
+{0x4fa,0x59ea1},
+{0x4fb,0x59e81},
+{0x4fc,0x5c081},
+{0x4fd,0x5c061},
+{0x4fe,0x5c0c1},
+{0x4ff,0x5c0a1},
+{0x500,0x59fc1},
+{0x501,0x59fa1},
+{0x502,0x5a0c1},
+{0x503,0x5a0a1},
+{0x504,0x5a6c1},
+{0x505,0x5a6a1},
+{0x506,0x5a881},
+{0x507,0x5a861},
+{0x508,0x5b1e1},
+{0x509,0x5b1c1},
+{0x50a,0x5b581},
+{0x50b,0x5b561},
+{0x50c,0x5ba21},
+{0x50d,0x5ba01},
+{0x50e,0x5bb41},
+{0x50f,0x5bb21},
+{0x510,0x5a701},
+{0x511,0x5a6e1},
+{0x512,0x5b0e1},
+{0x513,0x5b0c1},
+{0x514,0x5b221},
+{0x515,0x5b201},
+{0x516,0x5b941},
+{0x517,0x5b921},
+{0x518,0x5ce61},
+{0x519,0x5ce41},
+{0x51a,0x5afa1},
+{0x51b,0x5af81},
+{0x51c,0x5d341},
+{0x51d,0x5d321},
+{0x51e,0x5af61},
+{0x51f,0x5af41},
+{0x520,0x5b121},
+{0x521,0x5b101},
+{0x522,0x5b4c1},
+{0x523,0x5b4a1},
+{0x524,0x5b7e1},
+{0x525,0x5b7c1},
+{0x526,0x5c181},
+{0x527,0x5c161},
+{0x528,0x5b3c1},
+{0x529,0x5b3a1},
+{0x52a,0x5a4e1},
+{0x52b,0x5a4c1},
+{0x52c,0x5c5a1},
+{0x52d,0x5c581},
+{0x52e,0x5b0a1},
+{0x52f,0x5b081},
+{0x531,0x5f4c1},
+{0x532,0x5f501},
+{0x533,0x5f541},
+{0x534,0x5f581},
+{0x535,0x5f5c1},
+{0x536,0x5f641},
+{0x537,0x5f681},
+{0x538,0x5f6c1},
+{0x539,0x5f701},
+{0x53a,0x5f741},
+{0x53b,0x5f781},
+{0x53c,0x5f7c1},
+{0x53d,0x5f801},
+{0x53e,0x5f841},
+{0x53f,0x5f881},
+{0x540,0x5f8c1},
+{0x541,0x5f901},
+{0x542,0x5f941},
+{0x543,0x5f981},
+{0x544,0x5f9c1},
+{0x545,0x5fb01},
+{0x546,0x5fb41},
+{0x547,0x5fb81},
+{0x548,0x5fbc1},
+{0x549,0x5fc01},
+{0x54a,0x5fc41},
+{0x54b,0x5fc81},
+{0x54c,0x5fcc1},
+{0x54d,0x5fd01},
+{0x54e,0x5fd41},
+{0x54f,0x5fdc1},
+{0x550,0x5fe01},
+{0x551,0x5fe41},
+{0x552,0x5fe81},
+{0x553,0x5fec1},
+{0x554,0x5ff01},
+{0x555,0x5ff41},
+{0x556,0x5ff81},
+{0x559,0x5ffa1},
+{0x55a,0xf01},
+{0x55b,0xf21},
+{0x55c,0xf41},
+{0x55d,0xf61},
+{0x55e,0xf81},
+{0x55f,0xfa1},
+{0x561,0x5f4a1},
+{0x562,0x5f4e1},
+{0x563,0x5f521},
+{0x564,0x5f561},
+{0x565,0x5f5a1},
+{0x566,0x5f621},
+{0x567,0x5f661},
+{0x568,0x5f6a1},
+{0x569,0x5f6e1},
+{0x56a,0x5f721},
+{0x56b,0x5f761},
+{0x56c,0x5f7a1},
+{0x56d,0x5f7e1},
+{0x56e,0x5f821},
+{0x56f,0x5f861},
+{0x570,0x5f8a1},
+{0x571,0x5f8e1},
+{0x572,0x5f921},
+{0x573,0x5f961},
+{0x574,0x5f9a1},
+{0x575,0x5fae1},
+{0x576,0x5fb21},
+{0x577,0x5fb61},
+{0x578,0x5fba1},
+{0x579,0x5fbe1},
+{0x57a,0x5fc21},
+{0x57b,0x5fc61},
+{0x57c,0x5fca1},
+{0x57d,0x5fce1},
+{0x57e,0x5fd21},
+{0x57f,0x5fda1},
+{0x580,0x5fde1},
+{0x581,0x5fe21},
+{0x582,0x5fe61},
+{0x583,0x5fea1},
+{0x584,0x5fee1},
+{0x585,0x5ff21},
+{0x586,0x5ff61},
+{0x587,0x5f5e2},
+{0x589,0xfc1},
+{0x58a,0xfe1},
+{0x58d,0x1001},
+{0x58e,0x1021},
+{0x58f,0x37ba1},
+{0x591,0x1},
+{0x592,0x1},
+{0x593,0x1},
+{0x594,0x1},
+{0x595,0x1},
+{0x596,0x1},
+{0x597,0x1},
+{0x598,0x1},
+{0x599,0x1},
+{0x59a,0x1},
+{0x59b,0x1},
+{0x59c,0x1},
+{0x59d,0x1},
+{0x59e,0x1},
+{0x59f,0x1},
+{0x5a0,0x1},
+{0x5a1,0x1},
+{0x5a2,0x1},
+{0x5a3,0x1},
+{0x5a4,0x1},
+{0x5a5,0x1},
+{0x5a6,0x1},
+{0x5a7,0x1},
+{0x5a8,0x1},
+{0x5a9,0x1},
+{0x5aa,0x1},
+{0x5ab,0x1},
+{0x5ac,0x1},
+{0x5ad,0x1},
+{0x5ae,0x1},
+{0x5af,0x1},
+{0x5b0,0x35b21},
+{0x5b1,0x35b41},
+{0x5b2,0x35b61},
+{0x5b3,0x35b81},
+{0x5b4,0x35ba1},
+{0x5b5,0x35bc1},
+{0x5b6,0x35be1},
+{0x5b7,0x35c01},
+{0x5b8,0x35c21},
+{0x5b9,0x35c41},
+{0x5ba,0x35c41},
+{0x5bb,0x35c61},
+{0x5bc,0x35cc1},
+{0x5bd,0x1},
+{0x5be,0x1041},
+{0x5bf,0x35ce1},
+{0x5c0,0x1061},
+{0x5c1,0x35ca1},
+{0x5c2,0x35c81},
+{0x5c3,0x1081},
+{0x5c4,0x1},
+{0x5c5,0x1},
+{0x5c6,0x10a1},
+{0x5c7,0x35c21},
+{0x5d0,0x5ffc1},
+{0x5d1,0x60121},
+{0x5d2,0x601e1},
+{0x5d3,0x60261},
+{0x5d4,0x60301},
+{0x5d5,0x60381},
+{0x5d6,0x604a1},
+{0x5d7,0x60501},
+{0x5d8,0x60521},
+{0x5d9,0x60581},
+{0x5da,0x60701},
+{0x5db,0x606c1},
+{0x5dc,0x607e1},
+{0x5dd,0x608a1},
+{0x5de,0x60861},
+{0x5df,0x60921},
+{0x5e0,0x60901},
+{0x5e1,0x60981},
+{0x5e2,0x609e1},
+{0x5e3,0x60a41},
+{0x5e4,0x60a21},
+{0x5e5,0x60b41},
+{0x5e6,0x60b21},
+{0x5e7,0x60ba1},
+{0x5e8,0x60c01},
+{0x5e9,0x60c81},
+{0x5ea,0x60e21},
+{0x5f0,0x60422},
+{0x5f1,0x60462},
+{0x5f2,0x60622},
+{0x5f3,0x10c1},
+{0x5f4,0x10e1},
+{0x600,0x1},
+{0x601,0x1},
+{0x602,0x1},
+{0x603,0x1},
+{0x604,0x1},
+{0x605,0x1},
+{0x606,0x1101},
+{0x607,0x1121},
+{0x608,0x1141},
+{0x609,0x1161},
+{0x60a,0x1181},
+{0x60b,0x37bc1},
+{0x60c,0x11a1},
+{0x60d,0x11c1},
+{0x60e,0x11e1},
+{0x60f,0x1201},
+{0x610,0x1},
+{0x611,0x1},
+{0x612,0x1},
+{0x613,0x1},
+{0x614,0x1},
+{0x615,0x1},
+{0x616,0x1},
+{0x617,0x1},
+{0x618,0x1},
+{0x619,0x1},
+{0x61a,0x1},
+{0x61b,0x1221},
+{0x61c,0x1},
+{0x61e,0x1241},
+{0x61f,0x1261},
+{0x620,0x6da81},
+{0x621,0x614a1},
+{0x622,0x61541},
+{0x623,0x615a1},
+{0x624,0x61681},
+{0x625,0x616e1},
+{0x626,0x617a1},
+{0x627,0x62121},
+{0x628,0x623c1},
+{0x629,0x62d01},
+{0x62a,0x62d61},
+{0x62b,0x63821},
+{0x62c,0x63e41},
+{0x62d,0x64701},
+{0x62e,0x64ae1},
+{0x62f,0x64f01},
+{0x630,0x64f81},
+{0x631,0x652e1},
+{0x632,0x654a1},
+{0x633,0x657a1},
+{0x634,0x66121},
+{0x635,0x66c01},
+{0x636,0x674e1},
+{0x637,0x67b21},
+{0x638,0x67fa1},
+{0x639,0x68161},
+{0x63a,0x686e1},
+{0x63b,0x6a341},
+{0x63c,0x6a361},
+{0x63d,0x6da21},
+{0x63e,0x6da41},
+{0x63f,0x6da61},
+{0x640,0x1},
+{0x641,0x68b81},
+{0x642,0x692e1},
+{0x643,0x697e1},
+{0x644,0x6a3c1},
+{0x645,0x6b041},
+{0x646,0x6b941},
+{0x647,0x6c4c1},
+{0x648,0x6caa1},
+{0x649,0x6cfa1},
+{0x64a,0x6d0c1},
+{0x64b,0x35e81},
+{0x64c,0x35f21},
+{0x64d,0x35fe1},
+{0x64e,0x360a1},
+{0x64f,0x361e1},
+{0x650,0x36301},
+{0x651,0x36421},
+{0x652,0x364c1},
+{0x653,0x36521},
+{0x654,0x36541},
+{0x655,0x36561},
+{0x656,0x365a1},
+{0x657,0x365c1},
+{0x658,0x365e1},
+{0x659,0x36621},
+{0x65a,0x36641},
+{0x65b,0x36661},
+{0x65c,0x36681},
+{0x65d,0x366a1},
+{0x65e,0x366c1},
+{0x65f,0x36581},
+{0x660,0x380c1},
+{0x661,0x382e1},
+{0x662,0x3a041},
+{0x663,0x3aec1},
+{0x664,0x3b641},
+{0x665,0x3bc01},
+{0x666,0x3bfe1},
+{0x667,0x3c301},
+{0x668,0x3c681},
+{0x669,0x3c9a1},
+{0x66a,0x1281},
+{0x66b,0x12a1},
+{0x66c,0x12c1},
+{0x66d,0x12e1},
+{0x66e,0x62381},
+{0x66f,0x692a1},
+{0x670,0x367e1},
+{0x671,0x61621},
+{0x672,0x61601},
+{0x673,0x61741},
+{0x674,0x614c1},
+{0x675,0x62242},
+{0x676,0x6cb42},
+{0x677,0x6cd42},
+{0x678,0x6d1a2},
+{0x679,0x63c21},
+{0x67a,0x63cc1},
+{0x67b,0x62a01},
+{0x67c,0x63d61},
+{0x67d,0x63d81},
+{0x67e,0x62aa1},
+{0x67f,0x63da1},
+{0x680,0x62b41},
+{0x681,0x64de1},
+{0x682,0x64e01},
+{0x683,0x64441},
+{0x684,0x644e1},
+{0x685,0x64e21},
+{0x686,0x64581},
+{0x687,0x64641},
+{0x688,0x65041},
+{0x689,0x650a1},
+{0x68a,0x650c1},
+{0x68b,0x650e1},
+{0x68c,0x65101},
+{0x68d,0x65161},
+{0x68e,0x651e1},
+{0x68f,0x65241},
+{0x690,0x65261},
+{0x691,0x65521},
+{0x692,0x65581},
+{0x693,0x655a1},
+{0x694,0x655c1},
+{0x695,0x655e1},
+{0x696,0x65601},
+{0x697,0x65621},
+{0x698,0x65641},
+{0x699,0x656a1},
+{0x69a,0x66ae1},
+{0x69b,0x66b01},
+{0x69c,0x66b21},
+{0x69d,0x67aa1},
+{0x69e,0x67ae1},
+{0x69f,0x68121},
+{0x6a0,0x68ac1},
+{0x6a1,0x69061},
+{0x6a2,0x690a1},
+{0x6a3,0x690c1},
+{0x6a4,0x690e1},
+{0x6a5,0x691a1},
+{0x6a6,0x691c1},
+{0x6a7,0x69781},
+{0x6a8,0x697a1},
+{0x6a9,0x69ec1},
+{0x6aa,0x69f61},
+{0x6ab,0x69f81},
+{0x6ac,0x69fa1},
+{0x6ad,0x69fe1},
+{0x6ae,0x6a081},
+{0x6af,0x6a0c1},
+{0x6b0,0x6a181},
+{0x6b1,0x6a1a1},
+{0x6b2,0x6a241},
+{0x6b3,0x6a261},
+{0x6b4,0x6a301},
+{0x6b5,0x6af81},
+{0x6b6,0x6afa1},
+{0x6b7,0x6afc1},
+{0x6b8,0x6afe1},
+{0x6b9,0x6c441},
+{0x6ba,0x6c2e1},
+{0x6bb,0x6c361},
+{0x6bc,0x6c401},
+{0x6bd,0x6c421},
+{0x6be,0x6c801},
+{0x6bf,0x64621},
+{0x6c0,0x6c9e2},
+{0x6c1,0x6c8a1},
+{0x6c2,0x6c942},
+{0x6c3,0x6c981},
+{0x6c4,0x6cc01},
+{0x6c5,0x6cc21},
+{0x6c6,0x6cc81},
+{0x6c7,0x6cce1},
+{0x6c8,0x6cdc1},
+{0x6c9,0x6ce21},
+{0x6ca,0x6ce81},
+{0x6cb,0x6cea1},
+{0x6cc,0x6d881},
+{0x6cd,0x6d921},
+{0x6ce,0x6d941},
+{0x6cf,0x6cf21},
+{0x6d0,0x6d961},
+{0x6d1,0x6da01},
+{0x6d2,0x6db01},
+{0x6d3,0x6db62},
+{0x6d4,0x1301},
+{0x6d5,0x6c9c1},
+{0x6d6,0x1},
+{0x6d7,0x1},
+{0x6d8,0x1},
+{0x6d9,0x1},
+{0x6da,0x1},
+{0x6db,0x1},
+{0x6dc,0x1},
+{0x6dd,0x1},
+{0x6de,0x1321},
+{0x6df,0x1},
+{0x6e0,0x1},
+{0x6e1,0x1},
+{0x6e2,0x1},
+{0x6e3,0x1},
+{0x6e4,0x1},
+{0x6e5,0x6cac1},
+{0x6e6,0x6d0e1},
+{0x6e7,0x1},
+{0x6e8,0x1},
+{0x6e9,0x1341},
+{0x6ea,0x1},
+{0x6eb,0x1},
+{0x6ec,0x1},
+{0x6ed,0x1},
+{0x6ee,0x65281},
+{0x6ef,0x656c1},
+{0x6f0,0x380c1},
+{0x6f1,0x382e1},
+{0x6f2,0x3a041},
+{0x6f3,0x3aec1},
+{0x6f4,0x3b641},
+{0x6f5,0x3bc01},
+{0x6f6,0x3bfe1},
+{0x6f7,0x3c301},
+{0x6f8,0x3c681},
+{0x6f9,0x3c9a1},
+{0x6fa,0x66b41},
+{0x6fb,0x67b01},
+{0x6fc,0x68ae1},
+{0x6fd,0x61502},
+{0x6fe,0x6b102},
+{0x6ff,0x6c9a1},
+{0x700,0x1361},
+{0x701,0x1381},
+{0x702,0x13a1},
+{0x703,0x13c1},
+{0x704,0x13e1},
+{0x705,0x1401},
+{0x706,0x1421},
+{0x707,0x1441},
+{0x708,0x1461},
+{0x709,0x1481},
+{0x70a,0x14a1},
+{0x70b,0x14c1},
+{0x70c,0x14e1},
+{0x70d,0x1501},
+{0x70f,0x1},
+{0x710,0x6dc61},
+{0x711,0x36801},
+{0x712,0x6dc81},
+{0x713,0x6dce1},
+{0x714,0x6dd02},
+{0x715,0x6dda1},
+{0x716,0x6dd81},
+{0x717,0x6de01},
+{0x718,0x6de21},
+{0x719,0x6de41},
+{0x71a,0x6de81},
+{0x71b,0x6dea1},
+{0x71c,0x6dec2},
+{0x71d,0x6df01},
+{0x71e,0x6df21},
+{0x71f,0x6df41},
+{0x720,0x6df81},
+{0x721,0x6dfa1},
+{0x722,0x6dfc1},
+{0x723,0x6dfe1},
+{0x724,0x6e001},
+{0x725,0x6e021},
+{0x726,0x6e041},
+{0x727,0x6e062},
+{0x728,0x6e0c1},
+{0x729,0x6e0e1},
+{0x72a,0x6e101},
+{0x72b,0x6e121},
+{0x72c,0x6e141},
+{0x72d,0x6dca2},
+{0x72e,0x6dd42},
+{0x72f,0x6ddc2},
+{0x730,0x36821},
+{0x731,0x36841},
+{0x732,0x36861},
+{0x733,0x36881},
+{0x734,0x368a1},
+{0x735,0x368c1},
+{0x736,0x368e1},
+{0x737,0x36901},
+{0x738,0x36921},
+{0x739,0x36941},
+{0x73a,0x36961},
+{0x73b,0x36981},
+{0x73c,0x369a1},
+{0x73d,0x369c1},
+{0x73e,0x369e1},
+{0x73f,0x36a01},
+{0x740,0x1},
+{0x741,0x35701},
+{0x742,0x35721},
+{0x743,0x1},
+{0x744,0x1},
+{0x745,0x35701},
+{0x746,0x35721},
+{0x747,0x1},
+{0x748,0x1},
+{0x749,0x1},
+{0x74a,0x1},
+{0x74d,0x6de61},
+{0x74e,0x6df61},
+{0x74f,0x6e0a1},
+{0x750,0x62be1},
+{0x751,0x62c01},
+{0x752,0x62c21},
+{0x753,0x62c41},
+{0x754,0x62c61},
+{0x755,0x62c81},
+{0x756,0x62cc1},
+{0x757,0x64e41},
+{0x758,0x64e61},
+{0x759,0x652a1},
+{0x75a,0x652c1},
+{0x75b,0x656e1},
+{0x75c,0x66b61},
+{0x75d,0x68b01},
+{0x75e,0x68b21},
+{0x75f,0x68b41},
+{0x760,0x69261},
+{0x761,0x69281},
+{0x762,0x6a321},
+{0x763,0x6a381},
+{0x764,0x6a3a1},
+{0x765,0x6b8e1},
+{0x766,0x6b901},
+{0x767,0x6c461},
+{0x768,0x6c481},
+{0x769,0x6c4a1},
+{0x76a,0x6b001},
+{0x76b,0x65701},
+{0x76c,0x65721},
+{0x76d,0x66b81},
+{0x76e,0x64e81},
+{0x76f,0x64ea1},
+{0x770,0x66ba1},
+{0x771,0x65741},
+{0x772,0x64ec1},
+{0x773,0x61761},
+{0x774,0x61781},
+{0x775,0x6daa1},
+{0x776,0x6dac1},
+{0x777,0x6dae1},
+{0x778,0x6cf41},
+{0x779,0x6cf61},
+{0x77a,0x6dc21},
+{0x77b,0x6dc41},
+{0x77c,0x64ee1},
+{0x77d,0x66bc1},
+{0x77e,0x66be1},
+{0x77f,0x69fc1},
+{0x780,0x6e481},
+{0x781,0x6e4e1},
+{0x782,0x6e501},
+{0x783,0x6e521},
+{0x784,0x6e561},
+{0x785,0x6e581},
+{0x786,0x6e5a1},
+{0x787,0x6e5c1},
+{0x788,0x6e621},
+{0x789,0x6e661},
+{0x78a,0x6e681},
+{0x78b,0x6e6a1},
+{0x78c,0x6e6e1},
+{0x78d,0x6e761},
+{0x78e,0x6e781},
+{0x78f,0x6e7c1},
+{0x790,0x6e7e1},
+{0x791,0x6e861},
+{0x792,0x6e881},
+{0x793,0x6e8a1},
+{0x794,0x6e8c1},
+{0x795,0x6e8e1},
+{0x796,0x6e901},
+{0x797,0x6e921},
+{0x798,0x6e701},
+{0x799,0x6e4a1},
+{0x79a,0x6e4c1},
+{0x79b,0x6e6c1},
+{0x79c,0x6e541},
+{0x79d,0x6e801},
+{0x79e,0x6e821},
+{0x79f,0x6e841},
+{0x7a0,0x6e721},
+{0x7a1,0x6e741},
+{0x7a2,0x6e5e1},
+{0x7a3,0x6e601},
+{0x7a4,0x6e7a1},
+{0x7a5,0x6e641},
+{0x7a6,0x6e961},
+{0x7a7,0x6e981},
+{0x7a8,0x6e9a1},
+{0x7a9,0x6e9c1},
+{0x7aa,0x6e9e1},
+{0x7ab,0x6ea01},
+{0x7ac,0x6ea21},
+{0x7ad,0x6ea41},
+{0x7ae,0x6ea61},
+{0x7af,0x6ea81},
+{0x7b0,0x6eaa1},
+{0x7b1,0x6e941},
+{0x7c0,0x380c1},
+{0x7c1,0x382e1},
+{0x7c2,0x3a041},
+{0x7c3,0x3aec1},
+{0x7c4,0x3b641},
+{0x7c5,0x3bc01},
+{0x7c6,0x3bfe1},
+{0x7c7,0x3c301},
+{0x7c8,0x3c681},
+{0x7c9,0x3c9a1},
+{0x7ca,0x6eac1},
+{0x7cb,0x6eae1},
+{0x7cc,0x6eb01},
+{0x7cd,0x6eb21},
+{0x7ce,0x6eb41},
+{0x7cf,0x6eb61},
+{0x7d0,0x6eb81},
+{0x7d1,0x6eba1},
+{0x7d2,0x6ebc1},
+{0x7d3,0x6ebe1},
+{0x7d4,0x6ec01},
+{0x7d5,0x6ec21},
+{0x7d6,0x6ec41},
+{0x7d7,0x6eca1},
+{0x7d8,0x6ed01},
+{0x7d9,0x6ed21},
+{0x7da,0x6ed81},
+{0x7db,0x6eda1},
+{0x7dc,0x6edc1},
+{0x7dd,0x6ede1},
+{0x7de,0x6ee01},
+{0x7df,0x6ee21},
+{0x7e0,0x6ee41},
+{0x7e1,0x6ee61},
+{0x7e2,0x6ee81},
+{0x7e3,0x6eea1},
+{0x7e4,0x6eec1},
+{0x7e5,0x6eee1},
+{0x7e6,0x6ef01},
+{0x7e7,0x6ef21},
+{0x7e8,0x6ec62},
+{0x7e9,0x6ecc2},
+{0x7ea,0x6ed42},
+{0x7eb,0x36a21},
+{0x7ec,0x36a41},
+{0x7ed,0x36a61},
+{0x7ee,0x36a81},
+{0x7ef,0x36aa1},
+{0x7f0,0x36ac1},
+{0x7f1,0x36ae1},
+{0x7f2,0x36b01},
+{0x7f3,0x36b21},
+{0x7f4,0x6ef41},
+{0x7f5,0x6ef61},
+{0x7f6,0x1521},
+{0x7f7,0x1541},
+{0x7f8,0x1561},
+{0x7f9,0x1581},
+{0x7fa,0x1},
+{0x800,0x61161},
+{0x801,0x61181},
+{0x802,0x611a1},
+{0x803,0x611c1},
+{0x804,0x611e1},
+{0x805,0x61201},
+{0x806,0x61221},
+{0x807,0x61241},
+{0x808,0x61261},
+{0x809,0x61281},
+{0x80a,0x612a1},
+{0x80b,0x612c1},
+{0x80c,0x612e1},
+{0x80d,0x61301},
+{0x80e,0x61321},
+{0x80f,0x61341},
+{0x810,0x61361},
+{0x811,0x61381},
+{0x812,0x613a1},
+{0x813,0x613c1},
+{0x814,0x613e1},
+{0x815,0x61401},
+{0x816,0x61421},
+{0x817,0x61441},
+{0x818,0x35e21},
+{0x819,0x35e41},
+{0x81a,0x61461},
+{0x81b,0x61481},
+{0x81c,0x35d21},
+{0x81d,0x35d21},
+{0x81e,0x35d41},
+{0x81f,0x35d41},
+{0x820,0x35d41},
+{0x821,0x35d61},
+{0x822,0x35d61},
+{0x823,0x35d61},
+{0x824,0x35d81},
+{0x825,0x35d81},
+{0x826,0x35da1},
+{0x827,0x35da1},
+{0x828,0x35dc1},
+{0x829,0x35dc1},
+{0x82a,0x35dc1},
+{0x82b,0x35de1},
+{0x82c,0x35e01},
+{0x82d,0x35e61},
+{0x830,0x15a1},
+{0x831,0x15c1},
+{0x832,0x15e1},
+{0x833,0x1601},
+{0x834,0x1621},
+{0x835,0x1641},
+{0x836,0x1661},
+{0x837,0x1681},
+{0x838,0x16a1},
+{0x839,0x16c1},
+{0x83a,0x16e1},
+{0x83b,0x1701},
+{0x83c,0x1721},
+{0x83d,0x1741},
+{0x83e,0x1761},
+{0x840,0x6e161},
+{0x841,0x6e181},
+{0x842,0x6e1a1},
+{0x843,0x6e1c1},
+{0x844,0x6e1e1},
+{0x845,0x6e201},
+{0x846,0x6e221},
+{0x847,0x6e241},
+{0x848,0x6e261},
+{0x849,0x6e281},
+{0x84a,0x6e2a1},
+{0x84b,0x6e2c1},
+{0x84c,0x6e2e1},
+{0x84d,0x6e301},
+{0x84e,0x6e321},
+{0x84f,0x6e341},
+{0x850,0x6e361},
+{0x851,0x6e381},
+{0x852,0x6e3a1},
+{0x853,0x6e3c1},
+{0x854,0x6e3e1},
+{0x855,0x6e401},
+{0x856,0x6e421},
+{0x857,0x6e441},
+{0x858,0x6e461},
+{0x859,0x35721},
+{0x85a,0x35721},
+{0x85b,0x35721},
+{0x85e,0x1781},
+{0x8a0,0x62ca1},
+{0x8a1,0x62ce1},
+{0x8a2,0x646e1},
+{0x8a3,0x68141},
+{0x8a4,0x69181},
+{0x8a5,0x697c1},
+{0x8a6,0x6b021},
+{0x8a7,0x6b921},
+{0x8a8,0x620c1},
+{0x8a9,0x620e1},
+{0x8aa,0x65761},
+{0x8ab,0x6cf81},
+{0x8ac,0x62101},
+{0x8ad,0x62141},
+{0x8ae,0x651c1},
+{0x8af,0x67ac1},
+{0x8b0,0x6a161},
+{0x8b1,0x6cf01},
+{0x8b2,0x65781},
+{0x8b3,0x68b61},
+{0x8b4,0x6a0a1},
+{0x8e3,0x366e1},
+{0x8e4,0x36181},
+{0x8e5,0x362c1},
+{0x8e6,0x363e1},
+{0x8e7,0x35f01},
+{0x8e8,0x35fc1},
+{0x8e9,0x36081},
+{0x8ea,0x1},
+{0x8eb,0x1},
+{0x8ec,0x1},
+{0x8ed,0x1},
+{0x8ee,0x1},
+{0x8ef,0x1},
+{0x8f0,0x35ee1},
+{0x8f1,0x35fa1},
+{0x8f2,0x36061},
+{0x8f3,0x1},
+{0x8f4,0x361a1},
+{0x8f5,0x361c1},
+{0x8f6,0x36401},
+{0x8f7,0x36701},
+{0x8f8,0x36721},
+{0x8f9,0x367a1},
+{0x8fa,0x367c1},
+{0x8fb,0x36761},
+{0x8fc,0x36781},
+{0x8fd,0x36741},
+{0x8fe,0x362e1},
+{0x8ff,0x36601},
+{0x900,0x36ca1},
+{0x901,0x36ca1},
+{0x902,0x36cc1},
+{0x903,0x36ce1},
+{0x904,0x72fa1},
+{0x905,0x72fc1},
+{0x906,0x72fe1},
+{0x907,0x730a1},
+{0x908,0x730c1},
+{0x909,0x730e1},
+{0x90a,0x73101},
+{0x90b,0x73121},
+{0x90c,0x73161},
+{0x90d,0x731a1},
+{0x90e,0x731c1},
+{0x90f,0x731e1},
+{0x910,0x73201},
+{0x911,0x73221},
+{0x912,0x73241},
+{0x913,0x73261},
+{0x914,0x73281},
+{0x915,0x732a1},
+{0x916,0x73301},
+{0x917,0x73361},
+{0x918,0x733e1},
+{0x919,0x73401},
+{0x91a,0x73421},
+{0x91b,0x73441},
+{0x91c,0x73461},
+{0x91d,0x73501},
+{0x91e,0x73521},
+{0x91f,0x73541},
+{0x920,0x73561},
+{0x921,0x735a1},
+{0x922,0x73621},
+{0x923,0x73681},
+{0x924,0x736a1},
+{0x925,0x736c1},
+{0x926,0x736e1},
+{0x927,0x73701},
+{0x928,0x73721},
+{0x929,0x73742},
+{0x92a,0x73781},
+{0x92b,0x737a1},
+{0x92c,0x73801},
+{0x92d,0x73841},
+{0x92e,0x73861},
+{0x92f,0x73881},
+{0x930,0x73901},
+{0x931,0x73922},
+{0x932,0x73961},
+{0x933,0x73981},
+{0x934,0x739a2},
+{0x935,0x739e1},
+{0x936,0x73a01},
+{0x937,0x73a21},
+{0x938,0x73a41},
+{0x939,0x73a61},
+{0x93a,0x73bc1},
+{0x93b,0x73be1},
+{0x93c,0x36c81},
+{0x93d,0x73a81},
+{0x93e,0x73ba1},
+{0x93f,0x73c61},
+{0x940,0x73c81},
+{0x941,0x73ca1},
+{0x942,0x73cc1},
+{0x943,0x73ce1},
+{0x944,0x73d01},
+{0x945,0x73d61},
+{0x946,0x73da1},
+{0x947,0x73dc1},
+{0x948,0x73e01},
+{0x949,0x73e21},
+{0x94a,0x73e41},
+{0x94b,0x73e61},
+{0x94c,0x73e81},
+{0x94d,0x73ea1},
+{0x94e,0x73de1},
+{0x94f,0x73c01},
+{0x950,0x72f41},
+{0x951,0x1},
+{0x952,0x1},
+{0x953,0x35501},
+{0x954,0x354e1},
+{0x955,0x73d81},
+{0x956,0x73c21},
+{0x957,0x73c41},
+{0x958,0x732c2},
+{0x959,0x73322},
+{0x95a,0x73382},
+{0x95b,0x73482},
+{0x95c,0x735c2},
+{0x95d,0x73642},
+{0x95e,0x737c2},
+{0x95f,0x738a2},
+{0x960,0x73141},
+{0x961,0x73181},
+{0x962,0x73d21},
+{0x963,0x73d41},
+{0x964,0x17a1},
+{0x965,0x17c1},
+{0x966,0x380c1},
+{0x967,0x382e1},
+{0x968,0x3a041},
+{0x969,0x3aec1},
+{0x96a,0x3b641},
+{0x96b,0x3bc01},
+{0x96c,0x3bfe1},
+{0x96d,0x3c301},
+{0x96e,0x3c681},
+{0x96f,0x3c9a1},
+{0x970,0x17e1},
+{0x971,0x376a1},
+{0x972,0x72f81},
+{0x973,0x73001},
+{0x974,0x73021},
+{0x975,0x73041},
+{0x976,0x73061},
+{0x977,0x73081},
+{0x978,0x73581},
+{0x979,0x734c1},
+{0x97a,0x738e1},
+{0x97b,0x733c1},
+{0x97c,0x734e1},
+{0x97d,0x73aa1},
+{0x97e,0x73601},
+{0x97f,0x73821},
+{0x980,0x73ec1},
+{0x981,0x36ca1},
+{0x982,0x36cc1},
+{0x983,0x36ce1},
+{0x985,0x73ee1},
+{0x986,0x73f01},
+{0x987,0x73f21},
+{0x988,0x73f41},
+{0x989,0x73f61},
+{0x98a,0x73f81},
+{0x98b,0x73fa1},
+{0x98c,0x73fe1},
+{0x98f,0x74021},
+{0x990,0x74041},
+{0x993,0x74061},
+{0x994,0x74081},
+{0x995,0x740a1},
+{0x996,0x740c1},
+{0x997,0x740e1},
+{0x998,0x74101},
+{0x999,0x74121},
+{0x99a,0x74141},
+{0x99b,0x74161},
+{0x99c,0x74181},
+{0x99d,0x741a1},
+{0x99e,0x741c1},
+{0x99f,0x741e1},
+{0x9a0,0x74201},
+{0x9a1,0x74221},
+{0x9a2,0x74281},
+{0x9a3,0x742e1},
+{0x9a4,0x74301},
+{0x9a5,0x74361},
+{0x9a6,0x74381},
+{0x9a7,0x743a1},
+{0x9a8,0x743c1},
+{0x9aa,0x743e1},
+{0x9ab,0x74401},
+{0x9ac,0x74421},
+{0x9ad,0x74441},
+{0x9ae,0x74461},
+{0x9af,0x74481},
+{0x9b0,0x744e1},
+{0x9b2,0x74521},
+{0x9b6,0x74561},
+{0x9b7,0x74581},
+{0x9b8,0x745a1},
+{0x9b9,0x745c1},
+{0x9bc,0x36c81},
+{0x9bd,0x745e1},
+{0x9be,0x74601},
+{0x9bf,0x74621},
+{0x9c0,0x74641},
+{0x9c1,0x74661},
+{0x9c2,0x74681},
+{0x9c3,0x746a1},
+{0x9c4,0x746c1},
+{0x9c7,0x74721},
+{0x9c8,0x74741},
+{0x9cb,0x74761},
+{0x9cc,0x74781},
+{0x9cd,0x747a1},
+{0x9ce,0x74322},
+{0x9d7,0x747c1},
+{0x9dc,0x74242},
+{0x9dd,0x742a2},
+{0x9df,0x744a2},
+{0x9e0,0x73fc1},
+{0x9e1,0x74001},
+{0x9e2,0x746e1},
+{0x9e3,0x74701},
+{0x9e6,0x380c1},
+{0x9e7,0x382e1},
+{0x9e8,0x3a041},
+{0x9e9,0x3aec1},
+{0x9ea,0x3b641},
+{0x9eb,0x3bc01},
+{0x9ec,0x3bfe1},
+{0x9ed,0x3c301},
+{0x9ee,0x3c681},
+{0x9ef,0x3c9a1},
+{0x9f0,0x74501},
+{0x9f1,0x74541},
+{0x9f2,0x37be1},
+{0x9f3,0x37c01},
+{0x9f4,0x1801},
+{0x9f5,0x1821},
+{0x9f6,0x1841},
+{0x9f7,0x1861},
+{0x9f8,0x1881},
+{0x9f9,0x18a1},
+{0x9fa,0x18c1},
+{0x9fb,0x37c21},
+{0xa01,0x36ca1},
+{0xa02,0x36cc1},
+{0xa03,0x36ce1},
+{0xa05,0x74881},
+{0xa06,0x748a1},
+{0xa07,0x74921},
+{0xa08,0x74941},
+{0xa09,0x74821},
+{0xa0a,0x74841},
+{0xa0f,0x74961},
+{0xa10,0x748c1},
+{0xa13,0x74861},
+{0xa14,0x748e1},
+{0xa15,0x74a21},
+{0xa16,0x74a41},
+{0xa17,0x74aa1},
+{0xa18,0x74b01},
+{0xa19,0x74b21},
+{0xa1a,0x74b41},
+{0xa1b,0x74b61},
+{0xa1c,0x74b81},
+{0xa1d,0x74be1},
+{0xa1e,0x74c01},
+{0xa1f,0x74c21},
+{0xa20,0x74c41},
+{0xa21,0x74c61},
+{0xa22,0x74c81},
+{0xa23,0x74ca1},
+{0xa24,0x74cc1},
+{0xa25,0x74ce1},
+{0xa26,0x74d01},
+{0xa27,0x74d21},
+{0xa28,0x74d41},
+{0xa2a,0x74d61},
+{0xa2b,0x74d81},
+{0xa2c,0x74de1},
+{0xa2d,0x74e01},
+{0xa2e,0x74e21},
+{0xa2f,0x74e41},
+{0xa30,0x74e81},
+{0xa32,0x74ea1},
+{0xa33,0x74ec2},
+{0xa35,0x74f01},
+{0xa36,0x749a2},
+{0xa38,0x74981},
+{0xa39,0x749e1},
+{0xa3c,0x36c81},
+{0xa3e,0x74f41},
+{0xa3f,0x74f61},
+{0xa40,0x74f81},
+{0xa41,0x74fa1},
+{0xa42,0x74fc1},
+{0xa47,0x74fe1},
+{0xa48,0x75001},
+{0xa4b,0x75021},
+{0xa4c,0x75041},
+{0xa4d,0x75061},
+{0xa51,0x74a01},
+{0xa59,0x74a62},
+{0xa5a,0x74ac2},
+{0xa5b,0x74ba2},
+{0xa5c,0x74f21},
+{0xa5e,0x74da2},
+{0xa66,0x380c1},
+{0xa67,0x382e1},
+{0xa68,0x3a041},
+{0xa69,0x3aec1},
+{0xa6a,0x3b641},
+{0xa6b,0x3bc01},
+{0xa6c,0x3bfe1},
+{0xa6d,0x3c301},
+{0xa6e,0x3c681},
+{0xa6f,0x3c9a1},
+{0xa70,0x36d21},
+{0xa71,0x36d41},
+{0xa72,0x74901},
+{0xa73,0x74801},
+{0xa74,0x747e1},
+{0xa75,0x74e61},
+{0xa81,0x36ca1},
+{0xa82,0x36cc1},
+{0xa83,0x36ce1},
+{0xa85,0x750a1},
+{0xa86,0x750c1},
+{0xa87,0x750e1},
+{0xa88,0x75101},
+{0xa89,0x75121},
+{0xa8a,0x75141},
+{0xa8b,0x75161},
+{0xa8c,0x751a1},
+{0xa8d,0x751e1},
+{0xa8f,0x75201},
+{0xa90,0x75221},
+{0xa91,0x75241},
+{0xa93,0x75261},
+{0xa94,0x75281},
+{0xa95,0x752a1},
+{0xa96,0x752c1},
+{0xa97,0x752e1},
+{0xa98,0x75301},
+{0xa99,0x75321},
+{0xa9a,0x75341},
+{0xa9b,0x75361},
+{0xa9c,0x75381},
+{0xa9d,0x753c1},
+{0xa9e,0x753e1},
+{0xa9f,0x75401},
+{0xaa0,0x75421},
+{0xaa1,0x75441},
+{0xaa2,0x75461},
+{0xaa3,0x75481},
+{0xaa4,0x754a1},
+{0xaa5,0x754c1},
+{0xaa6,0x754e1},
+{0xaa7,0x75501},
+{0xaa8,0x75521},
+{0xaaa,0x75541},
+{0xaab,0x75561},
+{0xaac,0x75581},
+{0xaad,0x755a1},
+{0xaae,0x755c1},
+{0xaaf,0x755e1},
+{0xab0,0x75601},
+{0xab2,0x75621},
+{0xab3,0x756e1},
+{0xab5,0x75641},
+{0xab6,0x75661},
+{0xab7,0x75681},
+{0xab8,0x756a1},
+{0xab9,0x756c1},
+{0xabc,0x36c81},
+{0xabd,0x75701},
+{0xabe,0x75721},
+{0xabf,0x75741},
+{0xac0,0x75761},
+{0xac1,0x75781},
+{0xac2,0x757a1},
+{0xac3,0x757c1},
+{0xac4,0x757e1},
+{0xac5,0x75841},
+{0xac7,0x75861},
+{0xac8,0x75881},
+{0xac9,0x758a1},
+{0xacb,0x758c1},
+{0xacc,0x758e1},
+{0xacd,0x75901},
+{0xad0,0x75081},
+{0xae0,0x75181},
+{0xae1,0x751c1},
+{0xae2,0x75801},
+{0xae3,0x75821},
+{0xae6,0x380c1},
+{0xae7,0x382e1},
+{0xae8,0x3a041},
+{0xae9,0x3aec1},
+{0xaea,0x3b641},
+{0xaeb,0x3bc01},
+{0xaec,0x3bfe1},
+{0xaed,0x3c301},
+{0xaee,0x3c681},
+{0xaef,0x3c9a1},
+{0xaf0,0x18e1},
+{0xaf1,0x37c41},
+{0xaf9,0x753a1},
+{0xb01,0x36ca1},
+{0xb02,0x36cc1},
+{0xb03,0x36ce1},
+{0xb05,0x75921},
+{0xb06,0x75941},
+{0xb07,0x75961},
+{0xb08,0x75981},
+{0xb09,0x759a1},
+{0xb0a,0x759c1},
+{0xb0b,0x759e1},
+{0xb0c,0x75a21},
+{0xb0f,0x75a61},
+{0xb10,0x75a81},
+{0xb13,0x75aa1},
+{0xb14,0x75ac1},
+{0xb15,0x75ae1},
+{0xb16,0x75b01},
+{0xb17,0x75b21},
+{0xb18,0x75b41},
+{0xb19,0x75b61},
+{0xb1a,0x75b81},
+{0xb1b,0x75ba1},
+{0xb1c,0x75bc1},
+{0xb1d,0x75be1},
+{0xb1e,0x75c01},
+{0xb1f,0x75c21},
+{0xb20,0x75c41},
+{0xb21,0x75c61},
+{0xb22,0x75cc1},
+{0xb23,0x75d21},
+{0xb24,0x75d41},
+{0xb25,0x75d61},
+{0xb26,0x75d81},
+{0xb27,0x75da1},
+{0xb28,0x75dc1},
+{0xb2a,0x75de1},
+{0xb2b,0x75e01},
+{0xb2c,0x75e21},
+{0xb2d,0x75e41},
+{0xb2e,0x75e61},
+{0xb2f,0x75e81},
+{0xb30,0x75ec1},
+{0xb32,0x75ee1},
+{0xb33,0x75f01},
+{0xb35,0x75f21},
+{0xb36,0x75f61},
+{0xb37,0x75f81},
+{0xb38,0x75fa1},
+{0xb39,0x75fc1},
+{0xb3c,0x36c81},
+{0xb3d,0x75fe1},
+{0xb3e,0x76001},
+{0xb3f,0x76021},
+{0xb40,0x76041},
+{0xb41,0x76061},
+{0xb42,0x76081},
+{0xb43,0x760a1},
+{0xb44,0x760c1},
+{0xb47,0x76121},
+{0xb48,0x76141},
+{0xb4b,0x76161},
+{0xb4c,0x76181},
+{0xb4d,0x761a1},
+{0xb56,0x761c1},
+{0xb57,0x761e1},
+{0xb5c,0x75c82},
+{0xb5d,0x75ce2},
+{0xb5f,0x75ea1},
+{0xb60,0x75a01},
+{0xb61,0x75a41},
+{0xb62,0x760e1},
+{0xb63,0x76101},
+{0xb66,0x380c1},
+{0xb67,0x382e1},
+{0xb68,0x3a041},
+{0xb69,0x3aec1},
+{0xb6a,0x3b641},
+{0xb6b,0x3bc01},
+{0xb6c,0x3bfe1},
+{0xb6d,0x3c301},
+{0xb6e,0x3c681},
+{0xb6f,0x3c9a1},
+{0xb70,0x1901},
+{0xb71,0x75f41},
+{0xb72,0x1921},
+{0xb73,0x1941},
+{0xb74,0x1961},
+{0xb75,0x1981},
+{0xb76,0x19a1},
+{0xb77,0x19c1},
+{0xb82,0x36cc1},
+{0xb83,0x763a1},
+{0xb85,0x76221},
+{0xb86,0x76241},
+{0xb87,0x76261},
+{0xb88,0x76281},
+{0xb89,0x762a1},
+{0xb8a,0x762c1},
+{0xb8e,0x762e1},
+{0xb8f,0x76301},
+{0xb90,0x76321},
+{0xb92,0x76341},
+{0xb93,0x76361},
+{0xb94,0x76381},
+{0xb95,0x763c1},
+{0xb99,0x763e1},
+{0xb9a,0x76401},
+{0xb9c,0x76601},
+{0xb9e,0x76421},
+{0xb9f,0x76441},
+{0xba3,0x76461},
+{0xba4,0x76481},
+{0xba8,0x764a1},
+{0xba9,0x765e1},
+{0xbaa,0x764c1},
+{0xbae,0x764e1},
+{0xbaf,0x76501},
+{0xbb0,0x76521},
+{0xbb1,0x765c1},
+{0xbb2,0x76541},
+{0xbb3,0x765a1},
+{0xbb4,0x76581},
+{0xbb5,0x76561},
+{0xbb6,0x76621},
+{0xbb7,0x76641},
+{0xbb8,0x76661},
+{0xbb9,0x76681},
+{0xbbe,0x766a1},
+{0xbbf,0x766c1},
+{0xbc0,0x766e1},
+{0xbc1,0x76701},
+{0xbc2,0x76721},
+{0xbc6,0x76741},
+{0xbc7,0x76761},
+{0xbc8,0x76781},
+{0xbca,0x767a1},
+{0xbcb,0x767c1},
+{0xbcc,0x767e1},
+{0xbcd,0x76801},
+{0xbd0,0x76201},
+{0xbd7,0x76821},
+{0xbe6,0x380c1},
+{0xbe7,0x382e1},
+{0xbe8,0x3a041},
+{0xbe9,0x3aec1},
+{0xbea,0x3b641},
+{0xbeb,0x3bc01},
+{0xbec,0x3bfe1},
+{0xbed,0x3c301},
+{0xbee,0x3c681},
+{0xbef,0x3c9a1},
+{0xbf0,0x19e1},
+{0xbf1,0x1a01},
+{0xbf2,0x1a21},
+{0xbf3,0x1a41},
+{0xbf4,0x1a61},
+{0xbf5,0x1a81},
+{0xbf6,0x1aa1},
+{0xbf7,0x1ac1},
+{0xbf8,0x1ae1},
+{0xbf9,0x37c81},
+{0xbfa,0x1b01},
+{0xc00,0x36ca1},
+{0xc01,0x36ca1},
+{0xc02,0x36cc1},
+{0xc03,0x36ce1},
+{0xc05,0x76841},
+{0xc06,0x76861},
+{0xc07,0x76881},
+{0xc08,0x768a1},
+{0xc09,0x768c1},
+{0xc0a,0x768e1},
+{0xc0b,0x76901},
+{0xc0c,0x76941},
+{0xc0e,0x76981},
+{0xc0f,0x769a1},
+{0xc10,0x769c1},
+{0xc12,0x769e1},
+{0xc13,0x76a01},
+{0xc14,0x76a21},
+{0xc15,0x76a41},
+{0xc16,0x76a61},
+{0xc17,0x76a81},
+{0xc18,0x76aa1},
+{0xc19,0x76ac1},
+{0xc1a,0x76ae1},
+{0xc1b,0x76b21},
+{0xc1c,0x76b41},
+{0xc1d,0x76b81},
+{0xc1e,0x76ba1},
+{0xc1f,0x76bc1},
+{0xc20,0x76be1},
+{0xc21,0x76c01},
+{0xc22,0x76c21},
+{0xc23,0x76c41},
+{0xc24,0x76c61},
+{0xc25,0x76c81},
+{0xc26,0x76ca1},
+{0xc27,0x76cc1},
+{0xc28,0x76ce1},
+{0xc2a,0x76d01},
+{0xc2b,0x76d21},
+{0xc2c,0x76d41},
+{0xc2d,0x76d61},
+{0xc2e,0x76d81},
+{0xc2f,0x76da1},
+{0xc30,0x76dc1},
+{0xc31,0x76de1},
+{0xc32,0x76e01},
+{0xc33,0x76ec1},
+{0xc34,0x76ee1},
+{0xc35,0x76e21},
+{0xc36,0x76e41},
+{0xc37,0x76e61},
+{0xc38,0x76e81},
+{0xc39,0x76ea1},
+{0xc3d,0x76f21},
+{0xc3e,0x76f41},
+{0xc3f,0x76f61},
+{0xc40,0x76f81},
+{0xc41,0x76fa1},
+{0xc42,0x76fc1},
+{0xc43,0x76fe1},
+{0xc44,0x77001},
+{0xc46,0x77061},
+{0xc47,0x77081},
+{0xc48,0x770a1},
+{0xc4a,0x770c1},
+{0xc4b,0x770e1},
+{0xc4c,0x77101},
+{0xc4d,0x77121},
+{0xc55,0x77141},
+{0xc56,0x77161},
+{0xc58,0x76b01},
+{0xc59,0x76b61},
+{0xc5a,0x76f01},
+{0xc60,0x76921},
+{0xc61,0x76961},
+{0xc62,0x77021},
+{0xc63,0x77041},
+{0xc66,0x380c1},
+{0xc67,0x382e1},
+{0xc68,0x3a041},
+{0xc69,0x3aec1},
+{0xc6a,0x3b641},
+{0xc6b,0x3bc01},
+{0xc6c,0x3bfe1},
+{0xc6d,0x3c301},
+{0xc6e,0x3c681},
+{0xc6f,0x3c9a1},
+{0xc78,0x380c1},
+{0xc79,0x382e1},
+{0xc7a,0x3a041},
+{0xc7b,0x3aec1},
+{0xc7c,0x382e1},
+{0xc7d,0x3a041},
+{0xc7e,0x3aec1},
+{0xc7f,0x1b21},
+{0xc81,0x36ca1},
+{0xc82,0x36cc1},
+{0xc83,0x36ce1},
+{0xc85,0x77181},
+{0xc86,0x771a1},
+{0xc87,0x771c1},
+{0xc88,0x771e1},
+{0xc89,0x77201},
+{0xc8a,0x77221},
+{0xc8b,0x77241},
+{0xc8c,0x77281},
+{0xc8e,0x772c1},
+{0xc8f,0x772e1},
+{0xc90,0x77301},
+{0xc92,0x77321},
+{0xc93,0x77341},
+{0xc94,0x77361},
+{0xc95,0x77381},
+{0xc96,0x773a1},
+{0xc97,0x773c1},
+{0xc98,0x773e1},
+{0xc99,0x77401},
+{0xc9a,0x77421},
+{0xc9b,0x77441},
+{0xc9c,0x77461},
+{0xc9d,0x77481},
+{0xc9e,0x774a1},
+{0xc9f,0x774c1},
+{0xca0,0x774e1},
+{0xca1,0x77501},
+{0xca2,0x77521},
+{0xca3,0x77541},
+{0xca4,0x77561},
+{0xca5,0x77581},
+{0xca6,0x775a1},
+{0xca7,0x775c1},
+{0xca8,0x775e1},
+{0xcaa,0x77601},
+{0xcab,0x77621},
+{0xcac,0x77641},
+{0xcad,0x77661},
+{0xcae,0x77681},
+{0xcaf,0x776a1},
+{0xcb0,0x776c1},
+{0xcb1,0x776e1},
+{0xcb2,0x77701},
+{0xcb3,0x777c1},
+{0xcb5,0x77721},
+{0xcb6,0x77741},
+{0xcb7,0x77761},
+{0xcb8,0x77781},
+{0xcb9,0x777a1},
+{0xcbc,0x36c81},
+{0xcbd,0x77801},
+{0xcbe,0x77861},
+{0xcbf,0x77881},
+{0xcc0,0x778a1},
+{0xcc1,0x778c1},
+{0xcc2,0x778e1},
+{0xcc3,0x77901},
+{0xcc4,0x77921},
+{0xcc6,0x77981},
+{0xcc7,0x779a1},
+{0xcc8,0x779c1},
+{0xcca,0x779e1},
+{0xccb,0x77a01},
+{0xccc,0x77a21},
+{0xccd,0x77a41},
+{0xcd5,0x77a61},
+{0xcd6,0x77a81},
+{0xcde,0x777e1},
+{0xce0,0x77261},
+{0xce1,0x772a1},
+{0xce2,0x77941},
+{0xce3,0x77961},
+{0xce6,0x380c1},
+{0xce7,0x382e1},
+{0xce8,0x3a041},
+{0xce9,0x3aec1},
+{0xcea,0x3b641},
+{0xceb,0x3bc01},
+{0xcec,0x3bfe1},
+{0xced,0x3c301},
+{0xcee,0x3c681},
+{0xcef,0x3c9a1},
+{0xcf1,0x77821},
+{0xcf2,0x77841},
+{0xd01,0x36ca1},
+{0xd02,0x36cc1},
+{0xd03,0x36ce1},
+{0xd05,0x77aa1},
+{0xd06,0x77ac1},
+{0xd07,0x77ae1},
+{0xd08,0x77b01},
+{0xd09,0x77b41},
+{0xd0a,0x77b61},
+{0xd0b,0x77b81},
+{0xd0c,0x77bc1},
+{0xd0e,0x77c01},
+{0xd0f,0x77c21},
+{0xd10,0x77c41},
+{0xd12,0x77c61},
+{0xd13,0x77c81},
+{0xd14,0x77ca1},
+{0xd15,0x77cc1},
+{0xd16,0x77d21},
+{0xd17,0x77d41},
+{0xd18,0x77d61},
+{0xd19,0x77d81},
+{0xd1a,0x77da1},
+{0xd1b,0x77dc1},
+{0xd1c,0x77de1},
+{0xd1d,0x77e01},
+{0xd1e,0x77e21},
+{0xd1f,0x77e41},
+{0xd20,0x77e61},
+{0xd21,0x77e81},
+{0xd22,0x77ea1},
+{0xd23,0x77ec1},
+{0xd24,0x77f21},
+{0xd25,0x77f41},
+{0xd26,0x77f61},
+{0xd27,0x77f81},
+{0xd28,0x77fa1},
+{0xd29,0x78001},
+{0xd2a,0x78021},
+{0xd2b,0x78041},
+{0xd2c,0x78061},
+{0xd2d,0x78081},
+{0xd2e,0x780a1},
+{0xd2f,0x780c1},
+{0xd30,0x780e1},
+{0xd31,0x782c1},
+{0xd32,0x78141},
+{0xd33,0x78241},
+{0xd34,0x782a1},
+{0xd35,0x781a1},
+{0xd36,0x781c1},
+{0xd37,0x781e1},
+{0xd38,0x78201},
+{0xd39,0x78221},
+{0xd3a,0x782e1},
+{0xd3d,0x78301},
+{0xd3e,0x78321},
+{0xd3f,0x78341},
+{0xd40,0x78361},
+{0xd41,0x78381},
+{0xd42,0x783a1},
+{0xd43,0x783c1},
+{0xd44,0x783e1},
+{0xd46,0x78441},
+{0xd47,0x78461},
+{0xd48,0x78481},
+{0xd4a,0x784a1},
+{0xd4b,0x784c1},
+{0xd4c,0x784e1},
+{0xd4d,0x78521},
+{0xd4e,0x78102},
+{0xd57,0x78501},
+{0xd5f,0x77b21},
+{0xd60,0x77ba1},
+{0xd61,0x77be1},
+{0xd62,0x78401},
+{0xd63,0x78421},
+{0xd66,0x380c1},
+{0xd67,0x382e1},
+{0xd68,0x3a041},
+{0xd69,0x3aec1},
+{0xd6a,0x3b641},
+{0xd6b,0x3bc01},
+{0xd6c,0x3bfe1},
+{0xd6d,0x3c301},
+{0xd6e,0x3c681},
+{0xd6f,0x3c9a1},
+{0xd70,0x1b41},
+{0xd71,0x1b61},
+{0xd72,0x1b81},
+{0xd73,0x1ba1},
+{0xd74,0x1bc1},
+{0xd75,0x1be1},
+{0xd79,0x1c01},
+{0xd7a,0x77ee2},
+{0xd7b,0x77fc2},
+{0xd7c,0x78102},
+{0xd7d,0x78162},
+{0xd7e,0x78262},
+{0xd7f,0x77ce2},
+{0xd82,0x36cc1},
+{0xd83,0x36ce1},
+{0xd85,0x78541},
+{0xd86,0x78561},
+{0xd87,0x78581},
+{0xd88,0x785a1},
+{0xd89,0x785c1},
+{0xd8a,0x785e1},
+{0xd8b,0x78601},
+{0xd8c,0x78621},
+{0xd8d,0x78641},
+{0xd8e,0x78661},
+{0xd8f,0x78681},
+{0xd90,0x786a1},
+{0xd91,0x786c1},
+{0xd92,0x786e1},
+{0xd93,0x78701},
+{0xd94,0x78721},
+{0xd95,0x78741},
+{0xd96,0x78761},
+{0xd9a,0x78781},
+{0xd9b,0x787a1},
+{0xd9c,0x787c1},
+{0xd9d,0x787e1},
+{0xd9e,0x78801},
+{0xd9f,0x78821},
+{0xda0,0x78841},
+{0xda1,0x78861},
+{0xda2,0x78881},
+{0xda3,0x788a1},
+{0xda4,0x788c1},
+{0xda5,0x788e1},
+{0xda6,0x78901},
+{0xda7,0x78921},
+{0xda8,0x78941},
+{0xda9,0x78961},
+{0xdaa,0x78981},
+{0xdab,0x789a1},
+{0xdac,0x789c1},
+{0xdad,0x789e1},
+{0xdae,0x78a01},
+{0xdaf,0x78a21},
+{0xdb0,0x78a41},
+{0xdb1,0x78a61},
+{0xdb3,0x78a81},
+{0xdb4,0x78aa1},
+{0xdb5,0x78ac1},
+{0xdb6,0x78ae1},
+{0xdb7,0x78b01},
+{0xdb8,0x78b21},
+{0xdb9,0x78b41},
+{0xdba,0x78b61},
+{0xdbb,0x78b81},
+{0xdbd,0x78ba1},
+{0xdc0,0x78bc1},
+{0xdc1,0x78be1},
+{0xdc2,0x78c01},
+{0xdc3,0x78c21},
+{0xdc4,0x78c41},
+{0xdc5,0x78c61},
+{0xdc6,0x78c81},
+{0xdca,0x78ec1},
+{0xdcf,0x78ca1},
+{0xdd0,0x78cc1},
+{0xdd1,0x78ce1},
+{0xdd2,0x78d01},
+{0xdd3,0x78d21},
+{0xdd4,0x78d41},
+{0xdd6,0x78d61},
+{0xdd8,0x78d81},
+{0xdd9,0x78e01},
+{0xdda,0x78e21},
+{0xddb,0x78e41},
+{0xddc,0x78e61},
+{0xddd,0x78e81},
+{0xdde,0x78ea1},
+{0xddf,0x78dc1},
+{0xde6,0x380c1},
+{0xde7,0x382e1},
+{0xde8,0x3a041},
+{0xde9,0x3aec1},
+{0xdea,0x3b641},
+{0xdeb,0x3bc01},
+{0xdec,0x3bfe1},
+{0xded,0x3c301},
+{0xdee,0x3c681},
+{0xdef,0x3c9a1},
+{0xdf2,0x78da1},
+{0xdf3,0x78de1},
+{0xdf4,0x1c21},
+{0xe01,0x80c61},
+{0xe02,0x80dc1},
+{0xe03,0x80f21},
+{0xe04,0x81081},
+{0xe05,0x811e1},
+{0xe06,0x81341},
+{0xe07,0x814a1},
+{0xe08,0x81601},
+{0xe09,0x81761},
+{0xe0a,0x818c1},
+{0xe0b,0x81a21},
+{0xe0c,0x81b81},
+{0xe0d,0x81ce1},
+{0xe0e,0x81e41},
+{0xe0f,0x81fa1},
+{0xe10,0x82101},
+{0xe11,0x82261},
+{0xe12,0x823c1},
+{0xe13,0x82521},
+{0xe14,0x82681},
+{0xe15,0x827e1},
+{0xe16,0x82941},
+{0xe17,0x82aa1},
+{0xe18,0x82c01},
+{0xe19,0x82d61},
+{0xe1a,0x82ec1},
+{0xe1b,0x83021},
+{0xe1c,0x83181},
+{0xe1d,0x832e1},
+{0xe1e,0x83441},
+{0xe1f,0x835a1},
+{0xe20,0x83701},
+{0xe21,0x83861},
+{0xe22,0x839c1},
+{0xe23,0x83b21},
+{0xe24,0x83c81},
+{0xe25,0x83de1},
+{0xe26,0x83f41},
+{0xe27,0x840a1},
+{0xe28,0x84201},
+{0xe29,0x84361},
+{0xe2a,0x844c1},
+{0xe2b,0x84621},
+{0xe2c,0x84781},
+{0xe2d,0x848e1},
+{0xe2e,0x84a41},
+{0xe2f,0x84ba1},
+{0xe30,0x84bc1},
+{0xe31,0x84be1},
+{0xe32,0x84c01},
+{0xe33,0x84c21},
+{0xe34,0x84c41},
+{0xe35,0x84c61},
+{0xe36,0x84c81},
+{0xe37,0x84ca1},
+{0xe38,0x84cc1},
+{0xe39,0x84ce1},
+{0xe3a,0x84d01},
+{0xe3f,0x37ca1},
+{0xe40,0x84d21},
+{0xe41,0x84d41},
+{0xe42,0x84d61},
+{0xe43,0x84d81},
+{0xe44,0x84da1},
+{0xe45,0x84dc1},
+{0xe46,0x376c1},
+{0xe47,0x36ea1},
+{0xe48,0x36ec1},
+{0xe49,0x36ee1},
+{0xe4a,0x36f01},
+{0xe4b,0x36f21},
+{0xe4c,0x36f41},
+{0xe4d,0x36f61},
+{0xe4e,0x36e81},
+{0xe4f,0x1c41},
+{0xe50,0x380c1},
+{0xe51,0x382e1},
+{0xe52,0x3a041},
+{0xe53,0x3aec1},
+{0xe54,0x3b641},
+{0xe55,0x3bc01},
+{0xe56,0x3bfe1},
+{0xe57,0x3c301},
+{0xe58,0x3c681},
+{0xe59,0x3c9a1},
+{0xe5a,0x1c61},
+{0xe5b,0x1c81},
+{0xe81,0x84f41},
+{0xe82,0x850a1},
+{0xe84,0x85201},
+{0xe87,0x85361},
+{0xe88,0x854c1},
+{0xe8a,0x85781},
+{0xe8d,0x85a41},
+{0xe94,0x85ba1},
+{0xe95,0x85d01},
+{0xe96,0x85e61},
+{0xe97,0x85fc1},
+{0xe99,0x86121},
+{0xe9a,0x86281},
+{0xe9b,0x863e1},
+{0xe9c,0x86541},
+{0xe9d,0x866a1},
+{0xe9e,0x86801},
+{0xe9f,0x86961},
+{0xea1,0x86ac1},
+{0xea2,0x86c21},
+{0xea3,0x86d81},
+{0xea5,0x86ee1},
+{0xea7,0x87041},
+{0xeaa,0x85621},
+{0xeab,0x871a1},
+{0xead,0x87741},
+{0xeae,0x878a1},
+{0xeaf,0x87a01},
+{0xeb0,0x87a21},
+{0xeb1,0x87a41},
+{0xeb2,0x87a61},
+{0xeb3,0x87a81},
+{0xeb4,0x87aa1},
+{0xeb5,0x87ac1},
+{0xeb6,0x87ae1},
+{0xeb7,0x87b01},
+{0xeb8,0x87b21},
+{0xeb9,0x87b41},
+{0xebb,0x87b61},
+{0xebc,0x87b81},
+{0xebd,0x87ba1},
+{0xec0,0x87bc1},
+{0xec1,0x87be1},
+{0xec2,0x87c01},
+{0xec3,0x87c21},
+{0xec4,0x87c41},
+{0xec6,0x376e1},
+{0xec8,0x36f81},
+{0xec9,0x36fa1},
+{0xeca,0x36fc1},
+{0xecb,0x36fe1},
+{0xecc,0x37001},
+{0xecd,0x37021},
+{0xed0,0x380c1},
+{0xed1,0x382e1},
+{0xed2,0x3a041},
+{0xed3,0x3aec1},
+{0xed4,0x3b641},
+{0xed5,0x3bc01},
+{0xed6,0x3bfe1},
+{0xed7,0x3c301},
+{0xed8,0x3c681},
+{0xed9,0x3c9a1},
+{0xedc,0x871c2},
+{0xedd,0x873e2},
+{0xede,0x84de1},
+{0xedf,0x858e1},
+{0xf00,0x8cda3},
+{0xf01,0x1ca1},
+{0xf02,0x1cc1},
+{0xf03,0x1ce1},
+{0xf04,0x1d01},
+{0xf05,0x1d21},
+{0xf06,0x1d41},
+{0xf07,0x1d61},
+{0xf08,0x1d81},
+{0xf09,0x1da1},
+{0xf0a,0x1dc1},
+{0xf0b,0x1de1},
+{0xf0c,0x1e01},
+{0xf0d,0x1e21},
+{0xf0e,0x1e41},
+{0xf0f,0x1e61},
+{0xf10,0x1e81},
+{0xf11,0x1ea1},
+{0xf12,0x1ec1},
+{0xf13,0x1ee1},
+{0xf14,0x1f01},
+{0xf15,0x1f21},
+{0xf16,0x1f41},
+{0xf17,0x1f61},
+{0xf18,0x1},
+{0xf19,0x1},
+{0xf1a,0x1f81},
+{0xf1b,0x1fa1},
+{0xf1c,0x1fc1},
+{0xf1d,0x1fe1},
+{0xf1e,0x2001},
+{0xf1f,0x2021},
+{0xf20,0x380c1},
+{0xf21,0x382e1},
+{0xf22,0x3a041},
+{0xf23,0x3aec1},
+{0xf24,0x3b641},
+{0xf25,0x3bc01},
+{0xf26,0x3bfe1},
+{0xf27,0x3c301},
+{0xf28,0x3c681},
+{0xf29,0x3c9a1},
+{0xf2a,0x38321},
+{0xf2b,0x3a081},
+{0xf2c,0x3af01},
+{0xf2d,0x3b681},
+{0xf2e,0x3bc41},
+{0xf2f,0x3c021},
+{0xf30,0x3c341},
+{0xf31,0x3c6c1},
+{0xf32,0x3c9e1},
+{0xf33,0x38101},
+{0xf34,0x2041},
+{0xf35,0x1},
+{0xf36,0x2061},
+{0xf37,0x1},
+{0xf38,0x2081},
+{0xf39,0x37081},
+{0xf3a,0x20a1},
+{0xf3b,0x20c1},
+{0xf3c,0x20e1},
+{0xf3d,0x2101},
+{0xf3e,0x1},
+{0xf3f,0x1},
+{0xf40,0x8c0c1},
+{0xf41,0x8c1a1},
+{0xf42,0x8c1e1},
+{0xf43,0x8c202},
+{0xf44,0x8c2a1},
+{0xf45,0x8c2e1},
+{0xf46,0x8c321},
+{0xf47,0x8c361},
+{0xf49,0x8c3a1},
+{0xf4a,0x8c3e1},
+{0xf4b,0x8c421},
+{0xf4c,0x8c461},
+{0xf4d,0x8c482},
+{0xf4e,0x8c521},
+{0xf4f,0x8c561},
+{0xf50,0x8c5a1},
+{0xf51,0x8c5e1},
+{0xf52,0x8c602},
+{0xf53,0x8c6a1},
+{0xf54,0x8c6e1},
+{0xf55,0x8c721},
+{0xf56,0x8c761},
+{0xf57,0x8c782},
+{0xf58,0x8c821},
+{0xf59,0x8c861},
+{0xf5a,0x8c8a1},
+{0xf5b,0x8c8e1},
+{0xf5c,0x8c902},
+{0xf5d,0x8c9a1},
+{0xf5e,0x8ca21},
+{0xf5f,0x8ca61},
+{0xf60,0x8caa1},
+{0xf61,0x8cae1},
+{0xf62,0x8cb61},
+{0xf63,0x8cc41},
+{0xf64,0x8cc81},
+{0xf65,0x8ccc1},
+{0xf66,0x8cd01},
+{0xf67,0x8cd41},
+{0xf68,0x8cd81},
+{0xf69,0x8c0e2},
+{0xf6a,0x8cb82},
+{0xf6b,0x8c181},
+{0xf6c,0x8cc21},
+{0xf71,0x8cf21},
+{0xf72,0x8cf41},
+{0xf73,0x8cf61},
+{0xf74,0x8cfc1},
+{0xf75,0x8cfe1},
+{0xf76,0x8d001},
+{0xf77,0x8d021},
+{0xf78,0x8d041},
+{0xf79,0x8d061},
+{0xf7a,0x8d081},
+{0xf7b,0x8d0a1},
+{0xf7c,0x8d0c1},
+{0xf7d,0x8d0e1},
+{0xf7e,0x36cc1},
+{0xf7f,0x36ce1},
+{0xf80,0x8cf81},
+{0xf81,0x8cfa1},
+{0xf82,0x1},
+{0xf83,0x1},
+{0xf84,0x8d101},
+{0xf85,0x2121},
+{0xf86,0x1},
+{0xf87,0x1},
+{0xf88,0x8ce21},
+{0xf89,0x8ce61},
+{0xf8a,0x8cee1},
+{0xf8b,0x8cf01},
+{0xf8c,0x8cea1},
+{0xf8d,0x8ce41},
+{0xf8e,0x8ce81},
+{0xf8f,0x8cec1},
+{0xf90,0x8c121},
+{0xf91,0x8c1c1},
+{0xf92,0x8c241},
+{0xf93,0x8c262},
+{0xf94,0x8c2c1},
+{0xf95,0x8c301},
+{0xf96,0x8c341},
+{0xf97,0x8c381},
+{0xf99,0x8c3c1},
+{0xf9a,0x8c401},
+{0xf9b,0x8c441},
+{0xf9c,0x8c4c1},
+{0xf9d,0x8c4e2},
+{0xf9e,0x8c541},
+{0xf9f,0x8c581},
+{0xfa0,0x8c5c1},
+{0xfa1,0x8c641},
+{0xfa2,0x8c662},
+{0xfa3,0x8c6c1},
+{0xfa4,0x8c701},
+{0xfa5,0x8c741},
+{0xfa6,0x8c7c1},
+{0xfa7,0x8c7e2},
+{0xfa8,0x8c841},
+{0xfa9,0x8c881},
+{0xfaa,0x8c8c1},
+{0xfab,0x8c941},
+{0xfac,0x8c962},
+{0xfad,0x8c9c1},
+{0xfae,0x8ca41},
+{0xfaf,0x8ca81},
+{0xfb0,0x8cac1},
+{0xfb1,0x8cb01},
+{0xfb2,0x8cbc1},
+{0xfb3,0x8cc61},
+{0xfb4,0x8cca1},
+{0xfb5,0x8cce1},
+{0xfb6,0x8cd21},
+{0xfb7,0x8cd61},
+{0xfb8,0x8ce01},
+{0xfb9,0x8c142},
+{0xfba,0x8c9e2},
+{0xfbb,0x8cb22},
+{0xfbc,0x8cbe2},
+{0xfbe,0x2141},
+{0xfbf,0x2161},
+{0xfc0,0x2181},
+{0xfc1,0x21a1},
+{0xfc2,0x21c1},
+{0xfc3,0x21e1},
+{0xfc4,0x2201},
+{0xfc5,0x2221},
+{0xfc6,0x1},
+{0xfc7,0x2241},
+{0xfc8,0x2261},
+{0xfc9,0x2281},
+{0xfca,0x22a1},
+{0xfcb,0x22c1},
+{0xfcc,0x22e1},
+{0xfce,0x2301},
+{0xfcf,0x2321},
+{0xfd0,0x2341},
+{0xfd1,0x2361},
+{0xfd2,0x2381},
+{0xfd3,0x23a1},
+{0xfd4,0x23c1},
+{0xfd5,0x23e1},
+{0xfd6,0x2401},
+{0xfd7,0x2421},
+{0xfd8,0x2441},
+{0xfd9,0x2461},
+{0xfda,0x2481},
+{0x1000,0x901a1},
+{0x1001,0x901e1},
+{0x1002,0x90221},
+{0x1003,0x902a1},
+{0x1004,0x90301},
+{0x1005,0x90341},
+{0x1006,0x903a1},
+{0x1007,0x90421},
+{0x1008,0x904c1},
+{0x1009,0x905a1},
+{0x100a,0x90621},
+{0x100b,0x90641},
+{0x100c,0x90681},
+{0x100d,0x906c1},
+{0x100e,0x90721},
+{0x100f,0x90781},
+{0x1010,0x90801},
+{0x1011,0x90821},
+{0x1012,0x90841},
+{0x1013,0x908a1},
+{0x1014,0x90901},
+{0x1015,0x90981},
+{0x1016,0x909a1},
+{0x1017,0x90a61},
+{0x1018,0x90ac1},
+{0x1019,0x90b21},
+{0x101a,0x90b61},
+{0x101b,0x90ba1},
+{0x101c,0x90c21},
+{0x101d,0x90c61},
+{0x101e,0x90d41},
+{0x101f,0x90de1},
+{0x1020,0x90ea1},
+{0x1021,0x90f81},
+{0x1022,0x90fa1},
+{0x1023,0x90fc1},
+{0x1024,0x90fe1},
+{0x1025,0x91001},
+{0x1026,0x91021},
+{0x1027,0x910c1},
+{0x1028,0x910e1},
+{0x1029,0x91101},
+{0x102a,0x91121},
+{0x102b,0x91161},
+{0x102c,0x91141},
+{0x102d,0x911e1},
+{0x102e,0x91221},
+{0x102f,0x91261},
+{0x1030,0x912c1},
+{0x1031,0x91361},
+{0x1032,0x913e1},
+{0x1033,0x91241},
+{0x1034,0x91421},
+{0x1035,0x913a1},
+{0x1036,0x36cc1},
+{0x1037,0x37101},
+{0x1038,0x36ce1},
+{0x1039,0x914e1},
+{0x103a,0x91501},
+{0x103b,0x90b81},
+{0x103c,0x90c01},
+{0x103d,0x90c81},
+{0x103e,0x90e41},
+{0x103f,0x90d63},
+{0x1040,0x380c1},
+{0x1041,0x382e1},
+{0x1042,0x3a041},
+{0x1043,0x3aec1},
+{0x1044,0x3b641},
+{0x1045,0x3bc01},
+{0x1046,0x3bfe1},
+{0x1047,0x3c301},
+{0x1048,0x3c681},
+{0x1049,0x3c9a1},
+{0x104a,0x24a1},
+{0x104b,0x24c1},
+{0x104c,0x24e1},
+{0x104d,0x2501},
+{0x104e,0x2521},
+{0x104f,0x2541},
+{0x1050,0x90ce1},
+{0x1051,0x90d01},
+{0x1052,0x91041},
+{0x1053,0x91061},
+{0x1054,0x91081},
+{0x1055,0x910a1},
+{0x1056,0x912e1},
+{0x1057,0x91301},
+{0x1058,0x91321},
+{0x1059,0x91341},
+{0x105a,0x90321},
+{0x105b,0x904e1},
+{0x105c,0x90ee1},
+{0x105d,0x90f01},
+{0x105e,0x90961},
+{0x105f,0x90b41},
+{0x1060,0x90c41},
+{0x1061,0x90561},
+{0x1062,0x91441},
+{0x1063,0x91521},
+{0x1064,0x91541},
+{0x1065,0x90d21},
+{0x1066,0x90f61},
+{0x1067,0x91461},
+{0x1068,0x91481},
+{0x1069,0x91561},
+{0x106a,0x91581},
+{0x106b,0x915a1},
+{0x106c,0x915c1},
+{0x106d,0x915e1},
+{0x106e,0x907a1},
+{0x106f,0x90f21},
+{0x1070,0x90f41},
+{0x1071,0x91201},
+{0x1072,0x911a1},
+{0x1073,0x91281},
+{0x1074,0x912a1},
+{0x1075,0x901c1},
+{0x1076,0x90201},
+{0x1077,0x90241},
+{0x1078,0x90361},
+{0x1079,0x90481},
+{0x107a,0x905c1},
+{0x107b,0x90861},
+{0x107c,0x90921},
+{0x107d,0x909c1},
+{0x107e,0x909e1},
+{0x107f,0x90a81},
+{0x1080,0x90cc1},
+{0x1081,0x90e01},
+{0x1082,0x90ca1},
+{0x1083,0x91181},
+{0x1084,0x91381},
+{0x1085,0x913c1},
+{0x1086,0x914c1},
+{0x1087,0x91601},
+{0x1088,0x91641},
+{0x1089,0x916a1},
+{0x108a,0x916c1},
+{0x108b,0x91621},
+{0x108c,0x91661},
+{0x108d,0x91681},
+{0x108e,0x90a21},
+{0x108f,0x916e1},
+{0x1090,0x380c1},
+{0x1091,0x382e1},
+{0x1092,0x3a041},
+{0x1093,0x3aec1},
+{0x1094,0x3b641},
+{0x1095,0x3bc01},
+{0x1096,0x3bfe1},
+{0x1097,0x3c301},
+{0x1098,0x3c681},
+{0x1099,0x3c9a1},
+{0x109a,0x91701},
+{0x109b,0x91721},
+{0x109c,0x911c1},
+{0x109d,0x91401},
+{0x109e,0x2561},
+{0x109f,0x2581},
+{0x10a0,0x5e501},
+{0x10a1,0x5e561},
+{0x10a2,0x5e5c1},
+{0x10a3,0x5e621},
+{0x10a4,0x5e681},
+{0x10a5,0x5e6e1},
+{0x10a6,0x5e741},
+{0x10a7,0x5e801},
+{0x10a8,0x5e861},
+{0x10a9,0x5e8c1},
+{0x10aa,0x5e921},
+{0x10ab,0x5e981},
+{0x10ac,0x5ea01},
+{0x10ad,0x5eac1},
+{0x10ae,0x5eb21},
+{0x10af,0x5eb81},
+{0x10b0,0x5ebe1},
+{0x10b1,0x5ec41},
+{0x10b2,0x5eca1},
+{0x10b3,0x5ed61},
+{0x10b4,0x5edc1},
+{0x10b5,0x5ee21},
+{0x10b6,0x5ee81},
+{0x10b7,0x5eee1},
+{0x10b8,0x5ef41},
+{0x10b9,0x5efa1},
+{0x10ba,0x5f001},
+{0x10bb,0x5f061},
+{0x10bc,0x5f0c1},
+{0x10bd,0x5f121},
+{0x10be,0x5f181},
+{0x10bf,0x5f241},
+{0x10c0,0x5f2a1},
+{0x10c1,0x5e7a1},
+{0x10c2,0x5ea61},
+{0x10c3,0x5ed01},
+{0x10c4,0x5f1e1},
+{0x10c5,0x5f301},
+{0x10c7,0x5f381},
+{0x10cd,0x5f441},
+{0x10d0,0x5e4c1},
+{0x10d1,0x5e521},
+{0x10d2,0x5e581},
+{0x10d3,0x5e5e1},
+{0x10d4,0x5e641},
+{0x10d5,0x5e6a1},
+{0x10d6,0x5e701},
+{0x10d7,0x5e7c1},
+{0x10d8,0x5e821},
+{0x10d9,0x5e881},
+{0x10da,0x5e8e1},
+{0x10db,0x5e941},
+{0x10dc,0x5e9a1},
+{0x10dd,0x5ea81},
+{0x10de,0x5eae1},
+{0x10df,0x5eb41},
+{0x10e0,0x5eba1},
+{0x10e1,0x5ec01},
+{0x10e2,0x5ec61},
+{0x10e3,0x5ed21},
+{0x10e4,0x5ed81},
+{0x10e5,0x5ede1},
+{0x10e6,0x5ee41},
+{0x10e7,0x5eea1},
+{0x10e8,0x5ef01},
+{0x10e9,0x5ef61},
+{0x10ea,0x5efc1},
+{0x10eb,0x5f021},
+{0x10ec,0x5f081},
+{0x10ed,0x5f0e1},
+{0x10ee,0x5f141},
+{0x10ef,0x5f201},
+{0x10f0,0x5f261},
+{0x10f1,0x5e761},
+{0x10f2,0x5ea21},
+{0x10f3,0x5ecc1},
+{0x10f4,0x5f1a1},
+{0x10f5,0x5f2c1},
+{0x10f6,0x5f321},
+{0x10f7,0x5f341},
+{0x10f8,0x5f3a1},
+{0x10f9,0x5f3c1},
+{0x10fa,0x5f3e1},
+{0x10fb,0x25a1},
+{0x10fc,0x5e9c1},
+{0x10fd,0x5f401},
+{0x10fe,0x5f461},
+{0x10ff,0x5f481},
+{0x1100,0xac8e1},
+{0x1101,0xaca81},
+{0x1102,0xacae1},
+{0x1103,0xacc81},
+{0x1104,0xace21},
+{0x1105,0xace81},
+{0x1106,0xad021},
+{0x1107,0xad1c1},
+{0x1108,0xad361},
+{0x1109,0xad3c1},
+{0x110a,0xad561},
+{0x110b,0xad5c1},
+{0x110c,0xad941},
+{0x110d,0xadbe1},
+{0x110e,0xadc41},
+{0x110f,0xade81},
+{0x1110,0xae021},
+{0x1111,0xae1c1},
+{0x1112,0xae361},
+{0x1113,0xae501},
+{0x1114,0xae521},
+{0x1115,0xae561},
+{0x1116,0xae5a1},
+{0x1117,0xae5c1},
+{0x1118,0xae5e1},
+{0x1119,0xae601},
+{0x111a,0xae621},
+{0x111b,0xae681},
+{0x111c,0xae6a1},
+{0x111d,0xae6e1},
+{0x111e,0xae721},
+{0x111f,0xae761},
+{0x1120,0xae781},
+{0x1121,0xae7c1},
+{0x1122,0xae821},
+{0x1123,0xae861},
+{0x1124,0xae8a1},
+{0x1125,0xae8c1},
+{0x1126,0xae8e1},
+{0x1127,0xae901},
+{0x1128,0xae941},
+{0x1129,0xae961},
+{0x112a,0xae9a1},
+{0x112b,0xae9c1},
+{0x112c,0xaea01},
+{0x112d,0xaea41},
+{0x112e,0xaea81},
+{0x112f,0xaeac1},
+{0x1130,0xaeb01},
+{0x1131,0xaeb21},
+{0x1132,0xaeb41},
+{0x1133,0xaeb81},
+{0x1134,0xaeba1},
+{0x1135,0xaebc1},
+{0x1136,0xaebe1},
+{0x1137,0xaec21},
+{0x1138,0xaec41},
+{0x1139,0xaec61},
+{0x113a,0xaec81},
+{0x113b,0xaeca1},
+{0x113c,0xaecc1},
+{0x113d,0xaece1},
+{0x113e,0xaed01},
+{0x113f,0xaed21},
+{0x1140,0xaed41},
+{0x1141,0xaed81},
+{0x1142,0xaeda1},
+{0x1143,0xaedc1},
+{0x1144,0xaede1},
+{0x1145,0xaee01},
+{0x1146,0xaee21},
+{0x1147,0xaee41},
+{0x1148,0xaee81},
+{0x1149,0xaeea1},
+{0x114a,0xaeec1},
+{0x114b,0xaeee1},
+{0x114c,0xaef01},
+{0x114d,0xaef41},
+{0x114e,0xaef61},
+{0x114f,0xaef81},
+{0x1150,0xaefa1},
+{0x1151,0xaefc1},
+{0x1152,0xaefe1},
+{0x1153,0xaf001},
+{0x1154,0xaf021},
+{0x1155,0xaf041},
+{0x1156,0xaf061},
+{0x1157,0xaf081},
+{0x1158,0xaf0c1},
+{0x1159,0xaf101},
+{0x115a,0xaf141},
+{0x115b,0xaf161},
+{0x115c,0xaf181},
+{0x115d,0xaf1a1},
+{0x115e,0xaf1c1},
+{0x115f,0xaf581},
+{0x1160,0xaf5a1},
+{0x1161,0xaf601},
+{0x1162,0xaf661},
+{0x1163,0xaf6c1},
+{0x1164,0xaf721},
+{0x1165,0xaf781},
+{0x1166,0xaf7e1},
+{0x1167,0xaf841},
+{0x1168,0xaf8a1},
+{0x1169,0xaf901},
+{0x116a,0xaf961},
+{0x116b,0xaf9c1},
+{0x116c,0xafa21},
+{0x116d,0xafa81},
+{0x116e,0xafae1},
+{0x116f,0xafb41},
+{0x1170,0xafba1},
+{0x1171,0xafc01},
+{0x1172,0xafc61},
+{0x1173,0xafcc1},
+{0x1174,0xafd21},
+{0x1175,0xafd81},
+{0x1176,0xafde1},
+{0x1177,0xafe01},
+{0x1178,0xafe21},
+{0x1179,0xafe41},
+{0x117a,0xafe61},
+{0x117b,0xafe81},
+{0x117c,0xafea1},
+{0x117d,0xafec1},
+{0x117e,0xafee1},
+{0x117f,0xaff01},
+{0x1180,0xaff21},
+{0x1181,0xaff41},
+{0x1182,0xaff61},
+{0x1183,0xaff81},
+{0x1184,0xaffa1},
+{0x1185,0xaffe1},
+{0x1186,0xb0021},
+{0x1187,0xb0041},
+{0x1188,0xb0061},
+{0x1189,0xb00a1},
+{0x118a,0xb00c1},
+{0x118b,0xb00e1},
+{0x118c,0xb0101},
+{0x118d,0xb0121},
+{0x118e,0xb0141},
+{0x118f,0xb0161},
+{0x1190,0xb0181},
+{0x1191,0xb01a1},
+{0x1192,0xb01e1},
+{0x1193,0xb0221},
+{0x1194,0xb0241},
+{0x1195,0xb0281},
+{0x1196,0xb02a1},
+{0x1197,0xb02c1},
+{0x1198,0xb02e1},
+{0x1199,0xb0301},
+{0x119a,0xb0321},
+{0x119b,0xb0341},
+{0x119c,0xb0361},
+{0x119d,0xb0381},
+{0x119e,0xb03a1},
+{0x119f,0xb03e1},
+{0x11a0,0xb0401},
+{0x11a1,0xb0421},
+{0x11a2,0xb0461},
+{0x11a3,0xb0481},
+{0x11a4,0xb04a1},
+{0x11a5,0xb04c1},
+{0x11a6,0xb04e1},
+{0x11a7,0xb0501},
+{0x11a8,0xb0801},
+{0x11a9,0xb0821},
+{0x11aa,0xb0841},
+{0x11ab,0xb08a1},
+{0x11ac,0xb08c1},
+{0x11ad,0xb0921},
+{0x11ae,0xb0981},
+{0x11af,0xb09a1},
+{0x11b0,0xb09c1},
+{0x11b1,0xb0a21},
+{0x11b2,0xb0a81},
+{0x11b3,0xb0ae1},
+{0x11b4,0xb0b41},
+{0x11b5,0xb0ba1},
+{0x11b6,0xb0c01},
+{0x11b7,0xb0c21},
+{0x11b8,0xb0c41},
+{0x11b9,0xb0c61},
+{0x11ba,0xb0c81},
+{0x11bb,0xb0ca1},
+{0x11bc,0xb0cc1},
+{0x11bd,0xb0ce1},
+{0x11be,0xb0d01},
+{0x11bf,0xb0d21},
+{0x11c0,0xb0d41},
+{0x11c1,0xb0d61},
+{0x11c2,0xb0d81},
+{0x11c3,0xb0da1},
+{0x11c4,0xb0dc1},
+{0x11c5,0xb0de1},
+{0x11c6,0xb0e01},
+{0x11c7,0xb0e21},
+{0x11c8,0xb0e61},
+{0x11c9,0xb0ea1},
+{0x11ca,0xb0ec1},
+{0x11cb,0xb0ee1},
+{0x11cc,0xb0f01},
+{0x11cd,0xb0f41},
+{0x11ce,0xb0f61},
+{0x11cf,0xb0fa1},
+{0x11d0,0xb0fc1},
+{0x11d1,0xb0fe1},
+{0x11d2,0xb1001},
+{0x11d3,0xb1021},
+{0x11d4,0xb1061},
+{0x11d5,0xb1081},
+{0x11d6,0xb10a1},
+{0x11d7,0xb10c1},
+{0x11d8,0xb1101},
+{0x11d9,0xb1121},
+{0x11da,0xb1161},
+{0x11db,0xb1181},
+{0x11dc,0xb11a1},
+{0x11dd,0xb11c1},
+{0x11de,0xb1201},
+{0x11df,0xb1221},
+{0x11e0,0xb1261},
+{0x11e1,0xb1281},
+{0x11e2,0xb12a1},
+{0x11e3,0xb12c1},
+{0x11e4,0xb12e1},
+{0x11e5,0xb1301},
+{0x11e6,0xb1321},
+{0x11e7,0xb1341},
+{0x11e8,0xb1361},
+{0x11e9,0xb1381},
+{0x11ea,0xb13a1},
+{0x11eb,0xb13c1},
+{0x11ec,0xb13e1},
+{0x11ed,0xb1401},
+{0x11ee,0xb1421},
+{0x11ef,0xb1441},
+{0x11f0,0xb1461},
+{0x11f1,0xb1481},
+{0x11f2,0xb14c1},
+{0x11f3,0xb1501},
+{0x11f4,0xb1521},
+{0x11f5,0xb1541},
+{0x11f6,0xb1561},
+{0x11f7,0xb1581},
+{0x11f8,0xb15a1},
+{0x11f9,0xb15c1},
+{0x11fa,0xb15e1},
+{0x11fb,0xb1601},
+{0x11fc,0xb1621},
+{0x11fd,0xb1641},
+{0x11fe,0xb1661},
+{0x11ff,0xb1681},
+{0x1200,0x6f6a1},
+{0x1201,0x6f6c1},
+{0x1202,0x6f6e1},
+{0x1203,0x6f701},
+{0x1204,0x6f721},
+{0x1205,0x6f741},
+{0x1206,0x6f761},
+{0x1207,0x6f781},
+{0x1208,0x6f7a1},
+{0x1209,0x6f7c1},
+{0x120a,0x6f7e1},
+{0x120b,0x6f801},
+{0x120c,0x6f821},
+{0x120d,0x6f841},
+{0x120e,0x6f861},
+{0x120f,0x6f881},
+{0x1210,0x6f8c1},
+{0x1211,0x6f8e1},
+{0x1212,0x6f901},
+{0x1213,0x6f921},
+{0x1214,0x6f941},
+{0x1215,0x6f961},
+{0x1216,0x6f981},
+{0x1217,0x6f9a1},
+{0x1218,0x6f9c1},
+{0x1219,0x6f9e1},
+{0x121a,0x6fa01},
+{0x121b,0x6fa21},
+{0x121c,0x6fa41},
+{0x121d,0x6fa61},
+{0x121e,0x6fa81},
+{0x121f,0x6faa1},
+{0x1220,0x6fb61},
+{0x1221,0x6fb81},
+{0x1222,0x6fba1},
+{0x1223,0x6fbc1},
+{0x1224,0x6fbe1},
+{0x1225,0x6fc01},
+{0x1226,0x6fc21},
+{0x1227,0x6fc41},
+{0x1228,0x6fc61},
+{0x1229,0x6fc81},
+{0x122a,0x6fca1},
+{0x122b,0x6fcc1},
+{0x122c,0x6fce1},
+{0x122d,0x6fd01},
+{0x122e,0x6fd21},
+{0x122f,0x6fd41},
+{0x1230,0x6fd81},
+{0x1231,0x6fda1},
+{0x1232,0x6fdc1},
+{0x1233,0x6fde1},
+{0x1234,0x6fe01},
+{0x1235,0x6fe21},
+{0x1236,0x6fe41},
+{0x1237,0x6fe61},
+{0x1238,0x6ff61},
+{0x1239,0x6ff81},
+{0x123a,0x6ffa1},
+{0x123b,0x6ffc1},
+{0x123c,0x6ffe1},
+{0x123d,0x70001},
+{0x123e,0x70021},
+{0x123f,0x70041},
+{0x1240,0x70081},
+{0x1241,0x700a1},
+{0x1242,0x700c1},
+{0x1243,0x700e1},
+{0x1244,0x70101},
+{0x1245,0x70121},
+{0x1246,0x70141},
+{0x1247,0x70161},
+{0x1248,0x70181},
+{0x124a,0x701a1},
+{0x124b,0x701c1},
+{0x124c,0x701e1},
+{0x124d,0x70201},
+{0x1250,0x70221},
+{0x1251,0x70241},
+{0x1252,0x70261},
+{0x1253,0x70281},
+{0x1254,0x702a1},
+{0x1255,0x702c1},
+{0x1256,0x702e1},
+{0x1258,0x70301},
+{0x125a,0x70321},
+{0x125b,0x70341},
+{0x125c,0x70361},
+{0x125d,0x70381},
+{0x1260,0x703a1},
+{0x1261,0x703c1},
+{0x1262,0x703e1},
+{0x1263,0x70401},
+{0x1264,0x70421},
+{0x1265,0x70441},
+{0x1266,0x70461},
+{0x1267,0x70481},
+{0x1268,0x70541},
+{0x1269,0x70561},
+{0x126a,0x70581},
+{0x126b,0x705a1},
+{0x126c,0x705c1},
+{0x126d,0x705e1},
+{0x126e,0x70601},
+{0x126f,0x70621},
+{0x1270,0x70641},
+{0x1271,0x70661},
+{0x1272,0x70681},
+{0x1273,0x706a1},
+{0x1274,0x706c1},
+{0x1275,0x706e1},
+{0x1276,0x70701},
+{0x1277,0x70721},
+{0x1278,0x70761},
+{0x1279,0x70781},
+{0x127a,0x707a1},
+{0x127b,0x707c1},
+{0x127c,0x707e1},
+{0x127d,0x70801},
+{0x127e,0x70821},
+{0x127f,0x70841},
+{0x1280,0x70881},
+{0x1281,0x708a1},
+{0x1282,0x708c1},
+{0x1283,0x708e1},
+{0x1284,0x70901},
+{0x1285,0x70921},
+{0x1286,0x70941},
+{0x1287,0x70961},
+{0x1288,0x70981},
+{0x128a,0x709a1},
+{0x128b,0x709c1},
+{0x128c,0x709e1},
+{0x128d,0x70a01},
+{0x1290,0x70a21},
+{0x1291,0x70a41},
+{0x1292,0x70a61},
+{0x1293,0x70a81},
+{0x1294,0x70aa1},
+{0x1295,0x70ac1},
+{0x1296,0x70ae1},
+{0x1297,0x70b01},
+{0x1298,0x70b41},
+{0x1299,0x70b61},
+{0x129a,0x70b81},
+{0x129b,0x70ba1},
+{0x129c,0x70bc1},
+{0x129d,0x70be1},
+{0x129e,0x70c01},
+{0x129f,0x70c21},
+{0x12a0,0x70c61},
+{0x12a1,0x70c81},
+{0x12a2,0x70ca1},
+{0x12a3,0x70cc1},
+{0x12a4,0x70ce1},
+{0x12a5,0x70d01},
+{0x12a6,0x70d21},
+{0x12a7,0x70d41},
+{0x12a8,0x70d81},
+{0x12a9,0x70da1},
+{0x12aa,0x70dc1},
+{0x12ab,0x70de1},
+{0x12ac,0x70e01},
+{0x12ad,0x70e21},
+{0x12ae,0x70e41},
+{0x12af,0x70e61},
+{0x12b0,0x70e81},
+{0x12b2,0x70ea1},
+{0x12b3,0x70ec1},
+{0x12b4,0x70ee1},
+{0x12b5,0x70f01},
+{0x12b8,0x70f21},
+{0x12b9,0x70f41},
+{0x12ba,0x70f61},
+{0x12bb,0x70f81},
+{0x12bc,0x70fa1},
+{0x12bd,0x70fc1},
+{0x12be,0x70fe1},
+{0x12c0,0x71001},
+{0x12c2,0x71021},
+{0x12c3,0x71041},
+{0x12c4,0x71061},
+{0x12c5,0x71081},
+{0x12c8,0x710a1},
+{0x12c9,0x710c1},
+{0x12ca,0x710e1},
+{0x12cb,0x71101},
+{0x12cc,0x71121},
+{0x12cd,0x71141},
+{0x12ce,0x71161},
+{0x12cf,0x71181},
+{0x12d0,0x711a1},
+{0x12d1,0x711c1},
+{0x12d2,0x711e1},
+{0x12d3,0x71201},
+{0x12d4,0x71221},
+{0x12d5,0x71241},
+{0x12d6,0x71261},
+{0x12d8,0x71281},
+{0x12d9,0x712a1},
+{0x12da,0x712c1},
+{0x12db,0x712e1},
+{0x12dc,0x71301},
+{0x12dd,0x71321},
+{0x12de,0x71341},
+{0x12df,0x71361},
+{0x12e0,0x71461},
+{0x12e1,0x71481},
+{0x12e2,0x714a1},
+{0x12e3,0x714c1},
+{0x12e4,0x714e1},
+{0x12e5,0x71501},
+{0x12e6,0x71521},
+{0x12e7,0x71541},
+{0x12e8,0x71561},
+{0x12e9,0x71581},
+{0x12ea,0x715a1},
+{0x12eb,0x715c1},
+{0x12ec,0x715e1},
+{0x12ed,0x71601},
+{0x12ee,0x71621},
+{0x12ef,0x71641},
+{0x12f0,0x71661},
+{0x12f1,0x71681},
+{0x12f2,0x716a1},
+{0x12f3,0x716c1},
+{0x12f4,0x716e1},
+{0x12f5,0x71701},
+{0x12f6,0x71721},
+{0x12f7,0x71741},
+{0x12f8,0x71841},
+{0x12f9,0x71861},
+{0x12fa,0x71881},
+{0x12fb,0x718a1},
+{0x12fc,0x718c1},
+{0x12fd,0x718e1},
+{0x12fe,0x71901},
+{0x12ff,0x71921},
+{0x1300,0x71961},
+{0x1301,0x71981},
+{0x1302,0x719a1},
+{0x1303,0x719c1},
+{0x1304,0x719e1},
+{0x1305,0x71a01},
+{0x1306,0x71a21},
+{0x1307,0x71a41},
+{0x1308,0x71a81},
+{0x1309,0x71aa1},
+{0x130a,0x71ac1},
+{0x130b,0x71ae1},
+{0x130c,0x71b01},
+{0x130d,0x71b21},
+{0x130e,0x71b41},
+{0x130f,0x71b61},
+{0x1310,0x71b81},
+{0x1312,0x71ba1},
+{0x1313,0x71bc1},
+{0x1314,0x71be1},
+{0x1315,0x71c01},
+{0x1318,0x71c21},
+{0x1319,0x71c41},
+{0x131a,0x71c61},
+{0x131b,0x71c81},
+{0x131c,0x71ca1},
+{0x131d,0x71cc1},
+{0x131e,0x71ce1},
+{0x131f,0x71d01},
+{0x1320,0x71da1},
+{0x1321,0x71dc1},
+{0x1322,0x71de1},
+{0x1323,0x71e01},
+{0x1324,0x71e21},
+{0x1325,0x71e41},
+{0x1326,0x71e61},
+{0x1327,0x71e81},
+{0x1328,0x71ec1},
+{0x1329,0x71ee1},
+{0x132a,0x71f01},
+{0x132b,0x71f21},
+{0x132c,0x71f41},
+{0x132d,0x71f61},
+{0x132e,0x71f81},
+{0x132f,0x71fa1},
+{0x1330,0x720c1},
+{0x1331,0x720e1},
+{0x1332,0x72101},
+{0x1333,0x72121},
+{0x1334,0x72141},
+{0x1335,0x72161},
+{0x1336,0x72181},
+{0x1337,0x721a1},
+{0x1338,0x721e1},
+{0x1339,0x72201},
+{0x133a,0x72221},
+{0x133b,0x72241},
+{0x133c,0x72261},
+{0x133d,0x72281},
+{0x133e,0x722a1},
+{0x133f,0x722c1},
+{0x1340,0x723c1},
+{0x1341,0x723e1},
+{0x1342,0x72401},
+{0x1343,0x72421},
+{0x1344,0x72441},
+{0x1345,0x72461},
+{0x1346,0x72481},
+{0x1347,0x724a1},
+{0x1348,0x724c1},
+{0x1349,0x724e1},
+{0x134a,0x72501},
+{0x134b,0x72521},
+{0x134c,0x72541},
+{0x134d,0x72561},
+{0x134e,0x72581},
+{0x134f,0x725a1},
+{0x1350,0x72641},
+{0x1351,0x72661},
+{0x1352,0x72681},
+{0x1353,0x726a1},
+{0x1354,0x726c1},
+{0x1355,0x726e1},
+{0x1356,0x72701},
+{0x1357,0x72721},
+{0x1358,0x727e1},
+{0x1359,0x72801},
+{0x135a,0x72821},
+{0x135d,0x36b81},
+{0x135e,0x36b61},
+{0x135f,0x36b41},
+{0x1360,0x25c1},
+{0x1361,0x25e1},
+{0x1362,0x2601},
+{0x1363,0x2621},
+{0x1364,0x2641},
+{0x1365,0x2661},
+{0x1366,0x2681},
+{0x1367,0x26a1},
+{0x1368,0x26c1},
+{0x1369,0x382e1},
+{0x136a,0x3a041},
+{0x136b,0x3aec1},
+{0x136c,0x3b641},
+{0x136d,0x3bc01},
+{0x136e,0x3bfe1},
+{0x136f,0x3c301},
+{0x1370,0x3c681},
+{0x1371,0x3c9a1},
+{0x1372,0x26e1},
+{0x1373,0x2701},
+{0x1374,0x2721},
+{0x1375,0x2741},
+{0x1376,0x2761},
+{0x1377,0x2781},
+{0x1378,0x27a1},
+{0x1379,0x27c1},
+{0x137a,0x27e1},
+{0x137b,0x2801},
+{0x137c,0x2821},
+{0x1380,0x6fac1},
+{0x1381,0x6fae1},
+{0x1382,0x6fb01},
+{0x1383,0x6fb21},
+{0x1384,0x704a1},
+{0x1385,0x704c1},
+{0x1386,0x704e1},
+{0x1387,0x70501},
+{0x1388,0x725c1},
+{0x1389,0x725e1},
+{0x138a,0x72601},
+{0x138b,0x72621},
+{0x138c,0x72741},
+{0x138d,0x72761},
+{0x138e,0x72781},
+{0x138f,0x727a1},
+{0x1390,0x2841},
+{0x1391,0x2861},
+{0x1392,0x2881},
+{0x1393,0x28a1},
+{0x1394,0x28c1},
+{0x1395,0x28e1},
+{0x1396,0x2901},
+{0x1397,0x2921},
+{0x1398,0x2941},
+{0x1399,0x2961},
+{0x13a0,0x99901},
+{0x13a1,0x99941},
+{0x13a2,0x99981},
+{0x13a3,0x999c1},
+{0x13a4,0x99a01},
+{0x13a5,0x99a41},
+{0x13a6,0x99a81},
+{0x13a7,0x99ac1},
+{0x13a8,0x99b01},
+{0x13a9,0x99b41},
+{0x13aa,0x99b81},
+{0x13ab,0x99bc1},
+{0x13ac,0x99c01},
+{0x13ad,0x99c41},
+{0x13ae,0x99c81},
+{0x13af,0x99cc1},
+{0x13b0,0x99d01},
+{0x13b1,0x99d41},
+{0x13b2,0x99d81},
+{0x13b3,0x99dc1},
+{0x13b4,0x99e01},
+{0x13b5,0x99e41},
+{0x13b6,0x99e81},
+{0x13b7,0x99ec1},
+{0x13b8,0x99f01},
+{0x13b9,0x99f41},
+{0x13ba,0x99f81},
+{0x13bb,0x99fc1},
+{0x13bc,0x9a001},
+{0x13bd,0x9a041},
+{0x13be,0x9a081},
+{0x13bf,0x9a0c1},
+{0x13c0,0x9a101},
+{0x13c1,0x9a141},
+{0x13c2,0x9a181},
+{0x13c3,0x9a1c1},
+{0x13c4,0x9a201},
+{0x13c5,0x9a241},
+{0x13c6,0x9a281},
+{0x13c7,0x9a2c1},
+{0x13c8,0x9a301},
+{0x13c9,0x9a341},
+{0x13ca,0x9a381},
+{0x13cb,0x9a3c1},
+{0x13cc,0x9a401},
+{0x13cd,0x9a441},
+{0x13ce,0x9a481},
+{0x13cf,0x9a4c1},
+{0x13d0,0x9a501},
+{0x13d1,0x9a541},
+{0x13d2,0x9a581},
+{0x13d3,0x9a5c1},
+{0x13d4,0x9a601},
+{0x13d5,0x9a641},
+{0x13d6,0x9a681},
+{0x13d7,0x9a6c1},
+{0x13d8,0x9a701},
+{0x13d9,0x9a741},
+{0x13da,0x9a781},
+{0x13db,0x9a7c1},
+{0x13dc,0x9a801},
+{0x13dd,0x9a841},
+{0x13de,0x9a881},
+{0x13df,0x9a8c1},
+{0x13e0,0x9a901},
+{0x13e1,0x9a941},
+{0x13e2,0x9a981},
+{0x13e3,0x9a9c1},
+{0x13e4,0x9aa01},
+{0x13e5,0x9aa41},
+{0x13e6,0x9aa81},
+{0x13e7,0x9aac1},
+{0x13e8,0x9ab01},
+{0x13e9,0x9ab41},
+{0x13ea,0x9ab81},
+{0x13eb,0x9abc1},
+{0x13ec,0x9ac01},
+{0x13ed,0x9ac41},
+{0x13ee,0x9ac81},
+{0x13ef,0x9acc1},
+{0x13f0,0x9ad01},
+{0x13f1,0x9ad41},
+{0x13f2,0x9ad81},
+{0x13f3,0x9adc1},
+{0x13f4,0x9ae01},
+{0x13f5,0x9ae41},
+{0x13f8,0x9ace1},
+{0x13f9,0x9ad21},
+{0x13fa,0x9ad61},
+{0x13fb,0x9ada1},
+{0x13fc,0x9ade1},
+{0x13fd,0x9ae21},
+{0x1400,0x2981},
+{0x1401,0x9ae61},
+{0x1402,0x9ae81},
+{0x1403,0x9aea1},
+{0x1404,0x9aec1},
+{0x1405,0x9aee1},
+{0x1406,0x9af01},
+{0x1407,0x9af21},
+{0x1408,0x9af41},
+{0x1409,0x9af61},
+{0x140a,0x9af81},
+{0x140b,0x9afa1},
+{0x140c,0x9afc1},
+{0x140d,0x9afe1},
+{0x140e,0x9b001},
+{0x140f,0x9b021},
+{0x1410,0x9b041},
+{0x1411,0x9b061},
+{0x1412,0x9b081},
+{0x1413,0x9b0a1},
+{0x1414,0x9b0c1},
+{0x1415,0x9b0e1},
+{0x1416,0x9b101},
+{0x1417,0x9b121},
+{0x1418,0x9b141},
+{0x1419,0x9b161},
+{0x141a,0x9b181},
+{0x141b,0x9b1a1},
+{0x141c,0x9b1c1},
+{0x141d,0x9b1e1},
+{0x141e,0x9b201},
+{0x141f,0x9b221},
+{0x1420,0x9b241},
+{0x1421,0x9b261},
+{0x1422,0x9b281},
+{0x1423,0x9b2a1},
+{0x1424,0x9b2c1},
+{0x1425,0x9b2e1},
+{0x1426,0x9b301},
+{0x1427,0x9b321},
+{0x1428,0x9b341},
+{0x1429,0x9b361},
+{0x142a,0x9b381},
+{0x142b,0x9b3a1},
+{0x142c,0x9b3c1},
+{0x142d,0x9b3e1},
+{0x142e,0x9b401},
+{0x142f,0x9b421},
+{0x1430,0x9b441},
+{0x1431,0x9b461},
+{0x1432,0x9b481},
+{0x1433,0x9b4a1},
+{0x1434,0x9b4c1},
+{0x1435,0x9b4e1},
+{0x1436,0x9b501},
+{0x1437,0x9b521},
+{0x1438,0x9b541},
+{0x1439,0x9b561},
+{0x143a,0x9b581},
+{0x143b,0x9b5a1},
+{0x143c,0x9b5c1},
+{0x143d,0x9b5e1},
+{0x143e,0x9b601},
+{0x143f,0x9b621},
+{0x1440,0x9b641},
+{0x1441,0x9b661},
+{0x1442,0x9b681},
+{0x1443,0x9b6a1},
+{0x1444,0x9b6c1},
+{0x1445,0x9b6e1},
+{0x1446,0x9b701},
+{0x1447,0x9b721},
+{0x1448,0x9b741},
+{0x1449,0x9b761},
+{0x144a,0x9b781},
+{0x144b,0x9b7a1},
+{0x144c,0x9b7c1},
+{0x144d,0x9b7e1},
+{0x144e,0x9b801},
+{0x144f,0x9b821},
+{0x1450,0x9b841},
+{0x1451,0x9b861},
+{0x1452,0x9b881},
+{0x1453,0x9b8a1},
+{0x1454,0x9b8c1},
+{0x1455,0x9b8e1},
+{0x1456,0x9b901},
+{0x1457,0x9b921},
+{0x1458,0x9b941},
+{0x1459,0x9b961},
+{0x145a,0x9b981},
+{0x145b,0x9b9a1},
+{0x145c,0x9b9c1},
+{0x145d,0x9b9e1},
+{0x145e,0x9ba01},
+{0x145f,0x9ba21},
+{0x1460,0x9ba41},
+{0x1461,0x9ba61},
+{0x1462,0x9ba81},
+{0x1463,0x9baa1},
+{0x1464,0x9bac1},
+{0x1465,0x9bae1},
+{0x1466,0x9bb01},
+{0x1467,0x9bb21},
+{0x1468,0x9bb41},
+{0x1469,0x9bb61},
+{0x146a,0x9bb81},
+{0x146b,0x9bba1},
+{0x146c,0x9bbc1},
+{0x146d,0x9bbe1},
+{0x146e,0x9bc01},
+{0x146f,0x9bc21},
+{0x1470,0x9bc41},
+{0x1471,0x9bc61},
+{0x1472,0x9bc81},
+{0x1473,0x9bca1},
+{0x1474,0x9bcc1},
+{0x1475,0x9bce1},
+{0x1476,0x9bd01},
+{0x1477,0x9bd21},
+{0x1478,0x9bd41},
+{0x1479,0x9bd61},
+{0x147a,0x9bd81},
+{0x147b,0x9bda1},
+{0x147c,0x9bdc1},
+{0x147d,0x9bde1},
+{0x147e,0x9be01},
+{0x147f,0x9be21},
+{0x1480,0x9be41},
+{0x1481,0x9be61},
+{0x1482,0x9be81},
+{0x1483,0x9bea1},
+{0x1484,0x9bec1},
+{0x1485,0x9bee1},
+{0x1486,0x9bf01},
+{0x1487,0x9bf21},
+{0x1488,0x9bf41},
+{0x1489,0x9bf61},
+{0x148a,0x9bf81},
+{0x148b,0x9bfa1},
+{0x148c,0x9bfc1},
+{0x148d,0x9bfe1},
+{0x148e,0x9c001},
+{0x148f,0x9c021},
+{0x1490,0x9c041},
+{0x1491,0x9c061},
+{0x1492,0x9c081},
+{0x1493,0x9c0a1},
+{0x1494,0x9c0c1},
+{0x1495,0x9c0e1},
+{0x1496,0x9c101},
+{0x1497,0x9c121},
+{0x1498,0x9c141},
+{0x1499,0x9c161},
+{0x149a,0x9c181},
+{0x149b,0x9c1a1},
+{0x149c,0x9c1c1},
+{0x149d,0x9c1e1},
+{0x149e,0x9c201},
+{0x149f,0x9c221},
+{0x14a0,0x9c241},
+{0x14a1,0x9c261},
+{0x14a2,0x9c281},
+{0x14a3,0x9c2a1},
+{0x14a4,0x9c2c1},
+{0x14a5,0x9c2e1},
+{0x14a6,0x9c301},
+{0x14a7,0x9c321},
+{0x14a8,0x9c341},
+{0x14a9,0x9c361},
+{0x14aa,0x9c381},
+{0x14ab,0x9c3a1},
+{0x14ac,0x9c3c1},
+{0x14ad,0x9c3e1},
+{0x14ae,0x9c401},
+{0x14af,0x9c421},
+{0x14b0,0x9c441},
+{0x14b1,0x9c461},
+{0x14b2,0x9c481},
+{0x14b3,0x9c4a1},
+{0x14b4,0x9c4c1},
+{0x14b5,0x9c4e1},
+{0x14b6,0x9c501},
+{0x14b7,0x9c521},
+{0x14b8,0x9c541},
+{0x14b9,0x9c561},
+{0x14ba,0x9c581},
+{0x14bb,0x9c5a1},
+{0x14bc,0x9c5c1},
+{0x14bd,0x9c5e1},
+{0x14be,0x9c601},
+{0x14bf,0x9c621},
+{0x14c0,0x9c641},
+{0x14c1,0x9c661},
+{0x14c2,0x9c681},
+{0x14c3,0x9c6a1},
+{0x14c4,0x9c6c1},
+{0x14c5,0x9c6e1},
+{0x14c6,0x9c701},
+{0x14c7,0x9c721},
+{0x14c8,0x9c741},
+{0x14c9,0x9c761},
+{0x14ca,0x9c781},
+{0x14cb,0x9c7a1},
+{0x14cc,0x9c7c1},
+{0x14cd,0x9c7e1},
+{0x14ce,0x9c801},
+{0x14cf,0x9c821},
+{0x14d0,0x9c841},
+{0x14d1,0x9c861},
+{0x14d2,0x9c881},
+{0x14d3,0x9c8a1},
+{0x14d4,0x9c8c1},
+{0x14d5,0x9c8e1},
+{0x14d6,0x9c901},
+{0x14d7,0x9c921},
+{0x14d8,0x9c941},
+{0x14d9,0x9c961},
+{0x14da,0x9c981},
+{0x14db,0x9c9a1},
+{0x14dc,0x9c9c1},
+{0x14dd,0x9c9e1},
+{0x14de,0x9ca01},
+{0x14df,0x9ca21},
+{0x14e0,0x9ca41},
+{0x14e1,0x9ca61},
+{0x14e2,0x9ca81},
+{0x14e3,0x9caa1},
+{0x14e4,0x9cac1},
+{0x14e5,0x9cae1},
+{0x14e6,0x9cb01},
+{0x14e7,0x9cb21},
+{0x14e8,0x9cb41},
+{0x14e9,0x9cb61},
+{0x14ea,0x9cb81},
+{0x14eb,0x9cba1},
+{0x14ec,0x9cbc1},
+{0x14ed,0x9cbe1},
+{0x14ee,0x9cc01},
+{0x14ef,0x9cc21},
+{0x14f0,0x9cc41},
+{0x14f1,0x9cc61},
+{0x14f2,0x9cc81},
+{0x14f3,0x9cca1},
+{0x14f4,0x9ccc1},
+{0x14f5,0x9cce1},
+{0x14f6,0x9cd01},
+{0x14f7,0x9cd21},
+{0x14f8,0x9cd41},
+{0x14f9,0x9cd61},
+{0x14fa,0x9cd81},
+{0x14fb,0x9cda1},
+{0x14fc,0x9cdc1},
+{0x14fd,0x9cde1},
+{0x14fe,0x9ce01},
+{0x14ff,0x9ce21},
+{0x1500,0x9ce41},
+{0x1501,0x9ce61},
+{0x1502,0x9ce81},
+{0x1503,0x9cea1},
+{0x1504,0x9cec1},
+{0x1505,0x9cee1},
+{0x1506,0x9cf01},
+{0x1507,0x9cf21},
+{0x1508,0x9cf41},
+{0x1509,0x9cf61},
+{0x150a,0x9cf81},
+{0x150b,0x9cfa1},
+{0x150c,0x9cfc1},
+{0x150d,0x9cfe1},
+{0x150e,0x9d001},
+{0x150f,0x9d021},
+{0x1510,0x9d041},
+{0x1511,0x9d061},
+{0x1512,0x9d081},
+{0x1513,0x9d0a1},
+{0x1514,0x9d0c1},
+{0x1515,0x9d0e1},
+{0x1516,0x9d101},
+{0x1517,0x9d121},
+{0x1518,0x9d141},
+{0x1519,0x9d161},
+{0x151a,0x9d181},
+{0x151b,0x9d1a1},
+{0x151c,0x9d1c1},
+{0x151d,0x9d1e1},
+{0x151e,0x9d201},
+{0x151f,0x9d221},
+{0x1520,0x9d241},
+{0x1521,0x9d261},
+{0x1522,0x9d281},
+{0x1523,0x9d2a1},
+{0x1524,0x9d2c1},
+{0x1525,0x9d2e1},
+{0x1526,0x9d301},
+{0x1527,0x9d321},
+{0x1528,0x9d341},
+{0x1529,0x9d361},
+{0x152a,0x9d381},
+{0x152b,0x9d3a1},
+{0x152c,0x9d3c1},
+{0x152d,0x9d3e1},
+{0x152e,0x9d401},
+{0x152f,0x9d421},
+{0x1530,0x9d441},
+{0x1531,0x9d461},
+{0x1532,0x9d481},
+{0x1533,0x9d4a1},
+{0x1534,0x9d4c1},
+{0x1535,0x9d4e1},
+{0x1536,0x9d501},
+{0x1537,0x9d521},
+{0x1538,0x9d541},
+{0x1539,0x9d561},
+{0x153a,0x9d581},
+{0x153b,0x9d5a1},
+{0x153c,0x9d5c1},
+{0x153d,0x9d5e1},
+{0x153e,0x9d601},
+{0x153f,0x9d621},
+{0x1540,0x9d641},
+{0x1541,0x9d661},
+{0x1542,0x9d681},
+{0x1543,0x9d6a1},
+{0x1544,0x9d6c1},
+{0x1545,0x9d6e1},
+{0x1546,0x9d701},
+{0x1547,0x9d721},
+{0x1548,0x9d741},
+{0x1549,0x9d761},
+{0x154a,0x9d781},
+{0x154b,0x9d7a1},
+{0x154c,0x9d7c1},
+{0x154d,0x9d7e1},
+{0x154e,0x9d801},
+{0x154f,0x9d821},
+{0x1550,0x9d841},
+{0x1551,0x9d861},
+{0x1552,0x9d881},
+{0x1553,0x9d8a1},
+{0x1554,0x9d8c1},
+{0x1555,0x9d8e1},
+{0x1556,0x9d901},
+{0x1557,0x9d921},
+{0x1558,0x9d941},
+{0x1559,0x9d961},
+{0x155a,0x9d981},
+{0x155b,0x9d9a1},
+{0x155c,0x9d9c1},
+{0x155d,0x9d9e1},
+{0x155e,0x9da01},
+{0x155f,0x9da21},
+{0x1560,0x9da41},
+{0x1561,0x9da61},
+{0x1562,0x9da81},
+{0x1563,0x9daa1},
+{0x1564,0x9dac1},
+{0x1565,0x9dae1},
+{0x1566,0x9db01},
+{0x1567,0x9db21},
+{0x1568,0x9db41},
+{0x1569,0x9db61},
+{0x156a,0x9db81},
+{0x156b,0x9dba1},
+{0x156c,0x9dbc1},
+{0x156d,0x9dbe1},
+{0x156e,0x9dc01},
+{0x156f,0x9dc21},
+{0x1570,0x9dc41},
+{0x1571,0x9dc61},
+{0x1572,0x9dc81},
+{0x1573,0x9dca1},
+{0x1574,0x9dcc1},
+{0x1575,0x9dce1},
+{0x1576,0x9dd01},
+{0x1577,0x9dd21},
+{0x1578,0x9dd41},
+{0x1579,0x9dd61},
+{0x157a,0x9dd81},
+{0x157b,0x9dda1},
+{0x157c,0x9e401},
+{0x157d,0x9ddc1},
+{0x157e,0x9de01},
+{0x157f,0x9de21},
+{0x1580,0x9de41},
+{0x1581,0x9de61},
+{0x1582,0x9de81},
+{0x1583,0x9dea1},
+{0x1584,0x9dec1},
+{0x1585,0x9dee1},
+{0x1586,0x9df01},
+{0x1587,0x9df21},
+{0x1588,0x9df41},
+{0x1589,0x9df61},
+{0x158a,0x9df81},
+{0x158b,0x9dfa1},
+{0x158c,0x9dfc1},
+{0x158d,0x9dfe1},
+{0x158e,0x9e021},
+{0x158f,0x9e041},
+{0x1590,0x9e061},
+{0x1591,0x9e081},
+{0x1592,0x9e0a1},
+{0x1593,0x9e0c1},
+{0x1594,0x9e0e1},
+{0x1595,0x9e101},
+{0x1596,0x9e1e1},
+{0x1597,0x9e201},
+{0x1598,0x9e221},
+{0x1599,0x9e241},
+{0x159a,0x9e261},
+{0x159b,0x9e281},
+{0x159c,0x9e2a1},
+{0x159d,0x9e2c1},
+{0x159e,0x9e2e1},
+{0x159f,0x9e301},
+{0x15a0,0x9e321},
+{0x15a1,0x9e341},
+{0x15a2,0x9e361},
+{0x15a3,0x9e381},
+{0x15a4,0x9e3a1},
+{0x15a5,0x9e3c1},
+{0x15a6,0x9e3e1},
+{0x15a7,0x9e421},
+{0x15a8,0x9e441},
+{0x15a9,0x9e461},
+{0x15aa,0x9e481},
+{0x15ab,0x9e4a1},
+{0x15ac,0x9e4c1},
+{0x15ad,0x9e4e1},
+{0x15ae,0x9e501},
+{0x15af,0x9e521},
+{0x15b0,0x9e541},
+{0x15b1,0x9e561},
+{0x15b2,0x9e581},
+{0x15b3,0x9e5a1},
+{0x15b4,0x9e5c1},
+{0x15b5,0x9e5e1},
+{0x15b6,0x9e601},
+{0x15b7,0x9e621},
+{0x15b8,0x9e641},
+{0x15b9,0x9e661},
+{0x15ba,0x9e681},
+{0x15bb,0x9e6a1},
+{0x15bc,0x9e6c1},
+{0x15bd,0x9e6e1},
+{0x15be,0x9e701},
+{0x15bf,0x9e721},
+{0x15c0,0x9e741},
+{0x15c1,0x9e761},
+{0x15c2,0x9e781},
+{0x15c3,0x9e7a1},
+{0x15c4,0x9e7c1},
+{0x15c5,0x9e7e1},
+{0x15c6,0x9e801},
+{0x15c7,0x9e821},
+{0x15c8,0x9e841},
+{0x15c9,0x9e861},
+{0x15ca,0x9e881},
+{0x15cb,0x9e8a1},
+{0x15cc,0x9e8c1},
+{0x15cd,0x9e8e1},
+{0x15ce,0x9e901},
+{0x15cf,0x9e921},
+{0x15d0,0x9e941},
+{0x15d1,0x9e961},
+{0x15d2,0x9e981},
+{0x15d3,0x9e9a1},
+{0x15d4,0x9e9c1},
+{0x15d5,0x9e9e1},
+{0x15d6,0x9ea01},
+{0x15d7,0x9ea21},
+{0x15d8,0x9ea41},
+{0x15d9,0x9ea61},
+{0x15da,0x9ea81},
+{0x15db,0x9eaa1},
+{0x15dc,0x9eac1},
+{0x15dd,0x9eae1},
+{0x15de,0x9eb01},
+{0x15df,0x9eb21},
+{0x15e0,0x9eb41},
+{0x15e1,0x9eb61},
+{0x15e2,0x9eb81},
+{0x15e3,0x9eba1},
+{0x15e4,0x9ebc1},
+{0x15e5,0x9ebe1},
+{0x15e6,0x9ec01},
+{0x15e7,0x9ec21},
+{0x15e8,0x9ec41},
+{0x15e9,0x9ec61},
+{0x15ea,0x9ec81},
+{0x15eb,0x9eca1},
+{0x15ec,0x9ecc1},
+{0x15ed,0x9ece1},
+{0x15ee,0x9ed01},
+{0x15ef,0x9ed21},
+{0x15f0,0x9ed41},
+{0x15f1,0x9ed61},
+{0x15f2,0x9ed81},
+{0x15f3,0x9eda1},
+{0x15f4,0x9edc1},
+{0x15f5,0x9ede1},
+{0x15f6,0x9ee01},
+{0x15f7,0x9ee21},
+{0x15f8,0x9ee41},
+{0x15f9,0x9ee61},
+{0x15fa,0x9ee81},
+{0x15fb,0x9eea1},
+{0x15fc,0x9eec1},
+{0x15fd,0x9eee1},
+{0x15fe,0x9ef01},
+{0x15ff,0x9ef21},
+{0x1600,0x9ef41},
+{0x1601,0x9ef61},
+{0x1602,0x9ef81},
+{0x1603,0x9efa1},
+{0x1604,0x9efc1},
+{0x1605,0x9efe1},
+{0x1606,0x9f001},
+{0x1607,0x9f021},
+{0x1608,0x9f041},
+{0x1609,0x9f061},
+{0x160a,0x9f081},
+{0x160b,0x9f0a1},
+{0x160c,0x9f0c1},
+{0x160d,0x9f0e1},
+{0x160e,0x9f101},
+{0x160f,0x9f121},
+{0x1610,0x9f141},
+{0x1611,0x9f161},
+{0x1612,0x9f181},
+{0x1613,0x9f1a1},
+{0x1614,0x9f1c1},
+{0x1615,0x9f1e1},
+{0x1616,0x9f201},
+{0x1617,0x9f221},
+{0x1618,0x9f241},
+{0x1619,0x9f261},
+{0x161a,0x9f281},
+{0x161b,0x9f2a1},
+{0x161c,0x9f2c1},
+{0x161d,0x9f2e1},
+{0x161e,0x9f301},
+{0x161f,0x9f321},
+{0x1620,0x9f341},
+{0x1621,0x9f361},
+{0x1622,0x9f381},
+{0x1623,0x9f3a1},
+{0x1624,0x9f3c1},
+{0x1625,0x9f3e1},
+{0x1626,0x9f401},
+{0x1627,0x9f421},
+{0x1628,0x9f441},
+{0x1629,0x9f461},
+{0x162a,0x9f481},
+{0x162b,0x9f4a1},
+{0x162c,0x9f4c1},
+{0x162d,0x9f4e1},
+{0x162e,0x9f501},
+{0x162f,0x9f521},
+{0x1630,0x9f541},
+{0x1631,0x9f561},
+{0x1632,0x9f581},
+{0x1633,0x9f5a1},
+{0x1634,0x9f5c1},
+{0x1635,0x9f5e1},
+{0x1636,0x9f601},
+{0x1637,0x9f621},
+{0x1638,0x9f641},
+{0x1639,0x9f661},
+{0x163a,0x9f681},
+{0x163b,0x9f6a1},
+{0x163c,0x9f6c1},
+{0x163d,0x9f6e1},
+{0x163e,0x9f701},
+{0x163f,0x9f721},
+{0x1640,0x9f741},
+{0x1641,0x9f761},
+{0x1642,0x9f781},
+{0x1643,0x9f7a1},
+{0x1644,0x9f7c1},
+{0x1645,0x9f7e1},
+{0x1646,0x9f801},
+{0x1647,0x9f821},
+{0x1648,0x9f841},
+{0x1649,0x9f861},
+{0x164a,0x9f881},
+{0x164b,0x9f8a1},
+{0x164c,0x9f8c1},
+{0x164d,0x9f8e1},
+{0x164e,0x9f901},
+{0x164f,0x9f921},
+{0x1650,0x9f941},
+{0x1651,0x9f961},
+{0x1652,0x9f981},
+{0x1653,0x9f9a1},
+{0x1654,0x9f9c1},
+{0x1655,0x9f9e1},
+{0x1656,0x9fa01},
+{0x1657,0x9fa21},
+{0x1658,0x9fa41},
+{0x1659,0x9fa61},
+{0x165a,0x9fa81},
+{0x165b,0x9faa1},
+{0x165c,0x9fac1},
+{0x165d,0x9fae1},
+{0x165e,0x9fb01},
+{0x165f,0x9fb21},
+{0x1660,0x9fb41},
+{0x1661,0x9fb61},
+{0x1662,0x9fb81},
+{0x1663,0x9fba1},
+{0x1664,0x9fbc1},
+{0x1665,0x9fbe1},
+{0x1666,0x9fc01},
+{0x1667,0x9fc21},
+{0x1668,0x9fc41},
+{0x1669,0x9fc61},
+{0x166a,0x9fc81},
+{0x166b,0x9fca1},
+{0x166c,0x9fcc1},
+{0x166d,0x29a1},
+{0x166e,0x29c1},
+{0x166f,0x9dde1},
+{0x1670,0x9e001},
+{0x1671,0x9e121},
+{0x1672,0x9e141},
+{0x1673,0x9e161},
+{0x1674,0x9e181},
+{0x1675,0x9e1a1},
+{0x1676,0x9e1c1},
+{0x1677,0x9fce1},
+{0x1678,0x9fd01},
+{0x1679,0x9fd21},
+{0x167a,0x9fd41},
+{0x167b,0x9fd61},
+{0x167c,0x9fd81},
+{0x167d,0x9fda1},
+{0x167e,0x9fdc1},
+{0x167f,0x9fde1},
+{0x1680,0x29e1},
+{0x1681,0xa06c1},
+{0x1682,0xa06e1},
+{0x1683,0xa0701},
+{0x1684,0xa0721},
+{0x1685,0xa0741},
+{0x1686,0xa0761},
+{0x1687,0xa0781},
+{0x1688,0xa07a1},
+{0x1689,0xa07c1},
+{0x168a,0xa07e1},
+{0x168b,0xa0801},
+{0x168c,0xa0821},
+{0x168d,0xa0841},
+{0x168e,0xa0861},
+{0x168f,0xa0881},
+{0x1690,0xa08a1},
+{0x1691,0xa08c1},
+{0x1692,0xa08e1},
+{0x1693,0xa0901},
+{0x1694,0xa0921},
+{0x1695,0xa0941},
+{0x1696,0xa0961},
+{0x1697,0xa0981},
+{0x1698,0xa09a1},
+{0x1699,0xa09c1},
+{0x169a,0xa09e1},
+{0x169b,0x2a01},
+{0x169c,0x2a21},
+{0x16a0,0xa0a01},
+{0x16a1,0xa0a22},
+{0x16a2,0xa0a61},
+{0x16a3,0xa1861},
+{0x16a4,0xa0a82},
+{0x16a5,0xa0ac2},
+{0x16a6,0xa0b01},
+{0x16a7,0xa0b22},
+{0x16a8,0xa0ba1},
+{0x16a9,0xa0bc2},
+{0x16aa,0xa17e1},
+{0x16ab,0xa1821},
+{0x16ac,0xa0c02},
+{0x16ad,0xa0c42},
+{0x16ae,0xa0c82},
+{0x16af,0xa0ce1},
+{0x16b0,0xa0d01},
+{0x16b1,0xa0d21},
+{0x16b2,0xa0d41},
+{0x16b3,0xa0d62},
+{0x16b4,0xa0da2},
+{0x16b5,0xa0de2},
+{0x16b6,0xa0e22},
+{0x16b7,0xa0e81},
+{0x16b8,0xa18c1},
+{0x16b9,0xa0ea1},
+{0x16ba,0xa0f01},
+{0x16bb,0xa0f22},
+{0x16bc,0xa0f62},
+{0x16bd,0xa0fa2},
+{0x16be,0xa0fe1},
+{0x16bf,0xa1002},
+{0x16c0,0xa1042},
+{0x16c1,0xa1081},
+{0x16c2,0xa10a2},
+{0x16c3,0xa1101},
+{0x16c4,0xa1122},
+{0x16c5,0xa1161},
+{0x16c6,0xa1182},
+{0x16c7,0xa1201},
+{0x16c8,0xa1221},
+{0x16c9,0xa1281},
+{0x16ca,0xa12a1},
+{0x16cb,0xa12c2},
+{0x16cc,0xa1342},
+{0x16cd,0xa1382},
+{0x16ce,0xa13c2},
+{0x16cf,0xa1421},
+{0x16d0,0xa1442},
+{0x16d1,0xa1482},
+{0x16d2,0xa14c1},
+{0x16d3,0xa14e2},
+{0x16d4,0xa1522},
+{0x16d5,0xa1242},
+{0x16d6,0xa1561},
+{0x16d7,0xa15a1},
+{0x16d8,0xa15c2},
+{0x16d9,0xa1602},
+{0x16da,0xa16c1},
+{0x16db,0xa16e2},
+{0x16dc,0xa1721},
+{0x16dd,0xa1742},
+{0x16de,0xa1781},
+{0x16df,0xa17a1},
+{0x16e0,0xa1881},
+{0x16e1,0xa1901},
+{0x16e2,0xa1921},
+{0x16e3,0xa18a1},
+{0x16e4,0xa18e1},
+{0x16e5,0xa1941},
+{0x16e6,0xa1961},
+{0x16e7,0xa1982},
+{0x16e8,0xa19c2},
+{0x16e9,0xa0ec2},
+{0x16ea,0xa1302},
+{0x16eb,0x2a41},
+{0x16ec,0x2a61},
+{0x16ed,0x2a81},
+{0x16ee,0xa11c2},
+{0x16ef,0xa1644},
+{0x16f0,0xa0b62},
+{0x16f1,0xa0e61},
+{0x16f2,0xa1401},
+{0x16f3,0xa17c1},
+{0x16f4,0xa0cc1},
+{0x16f5,0xa10e1},
+{0x16f6,0xa1581},
+{0x16f7,0xa1801},
+{0x16f8,0xa1841},
+{0x1700,0x8e5a1},
+{0x1701,0x8e5c1},
+{0x1702,0x8e5e1},
+{0x1703,0x8e601},
+{0x1704,0x8e621},
+{0x1705,0x8e641},
+{0x1706,0x8e661},
+{0x1707,0x8e681},
+{0x1708,0x8e6a1},
+{0x1709,0x8e6c1},
+{0x170a,0x8e6e1},
+{0x170b,0x8e701},
+{0x170c,0x8e721},
+{0x170e,0x8e741},
+{0x170f,0x8e761},
+{0x1710,0x8e781},
+{0x1711,0x8e7a1},
+{0x1712,0x8e7c1},
+{0x1713,0x8e7e1},
+{0x1714,0x8e801},
+{0x1720,0x8e821},
+{0x1721,0x8e841},
+{0x1722,0x8e861},
+{0x1723,0x8e881},
+{0x1724,0x8e8a1},
+{0x1725,0x8e8c1},
+{0x1726,0x8e8e1},
+{0x1727,0x8e901},
+{0x1728,0x8e921},
+{0x1729,0x8e941},
+{0x172a,0x8e961},
+{0x172b,0x8e981},
+{0x172c,0x8e9a1},
+{0x172d,0x8e9c1},
+{0x172e,0x8e9e1},
+{0x172f,0x8ea01},
+{0x1730,0x8ea21},
+{0x1731,0x8ea41},
+{0x1732,0x8ea61},
+{0x1733,0x8ea81},
+{0x1734,0x8eaa1},
+{0x1735,0x2aa1},
+{0x1736,0x2ac1},
+{0x1740,0x8eac1},
+{0x1741,0x8eae1},
+{0x1742,0x8eb01},
+{0x1743,0x8eb21},
+{0x1744,0x8eb41},
+{0x1745,0x8eb61},
+{0x1746,0x8eb81},
+{0x1747,0x8eba1},
+{0x1748,0x8ebc1},
+{0x1749,0x8ebe1},
+{0x174a,0x8ec01},
+{0x174b,0x8ec21},
+{0x174c,0x8ec41},
+{0x174d,0x8ec61},
+{0x174e,0x8ec81},
+{0x174f,0x8eca1},
+{0x1750,0x8ecc1},
+{0x1751,0x8ece1},
+{0x1752,0x8ed01},
+{0x1753,0x8ed21},
+{0x1760,0x8ed41},
+{0x1761,0x8ed61},
+{0x1762,0x8ed81},
+{0x1763,0x8eda1},
+{0x1764,0x8edc1},
+{0x1765,0x8ede1},
+{0x1766,0x8ee01},
+{0x1767,0x8ee21},
+{0x1768,0x8ee41},
+{0x1769,0x8ee61},
+{0x176a,0x8ee81},
+{0x176b,0x8eea1},
+{0x176c,0x8eec1},
+{0x176e,0x8eee1},
+{0x176f,0x8ef01},
+{0x1770,0x8ef21},
+{0x1772,0x8ef41},
+{0x1773,0x8ef61},
+{0x1780,0x91e41},
+{0x1781,0x91e61},
+{0x1782,0x91e81},
+{0x1783,0x91ea1},
+{0x1784,0x91ec1},
+{0x1785,0x91ee1},
+{0x1786,0x91f01},
+{0x1787,0x91f21},
+{0x1788,0x91f41},
+{0x1789,0x91f61},
+{0x178a,0x91f81},
+{0x178b,0x91fa1},
+{0x178c,0x91fc1},
+{0x178d,0x91fe1},
+{0x178e,0x92001},
+{0x178f,0x92021},
+{0x1790,0x92041},
+{0x1791,0x92061},
+{0x1792,0x92081},
+{0x1793,0x920a1},
+{0x1794,0x920c1},
+{0x1795,0x920e1},
+{0x1796,0x92101},
+{0x1797,0x92121},
+{0x1798,0x92141},
+{0x1799,0x92161},
+{0x179a,0x92181},
+{0x179b,0x921a1},
+{0x179c,0x921c1},
+{0x179d,0x921e1},
+{0x179e,0x92201},
+{0x179f,0x92221},
+{0x17a0,0x92241},
+{0x17a1,0x92261},
+{0x17a2,0x92281},
+{0x17a3,0x922c1},
+{0x17a4,0x922e1},
+{0x17a5,0x92301},
+{0x17a6,0x92321},
+{0x17a7,0x92341},
+{0x17a8,0x92361},
+{0x17a9,0x92381},
+{0x17aa,0x923a1},
+{0x17ab,0x923c1},
+{0x17ac,0x923e1},
+{0x17ad,0x92401},
+{0x17ae,0x92421},
+{0x17af,0x92441},
+{0x17b0,0x92461},
+{0x17b1,0x92481},
+{0x17b2,0x924a1},
+{0x17b3,0x924c1},
+{0x17b4,0x1},
+{0x17b5,0x1},
+{0x17b6,0x924e1},
+{0x17b7,0x92501},
+{0x17b8,0x92521},
+{0x17b9,0x92541},
+{0x17ba,0x92561},
+{0x17bb,0x92581},
+{0x17bc,0x925a1},
+{0x17bd,0x925c1},
+{0x17be,0x925e1},
+{0x17bf,0x92601},
+{0x17c0,0x92621},
+{0x17c1,0x92641},
+{0x17c2,0x92661},
+{0x17c3,0x92681},
+{0x17c4,0x926a1},
+{0x17c5,0x926c1},
+{0x17c6,0x36cc1},
+{0x17c7,0x36ce1},
+{0x17c8,0x37121},
+{0x17c9,0x37141},
+{0x17ca,0x37161},
+{0x17cb,0x35701},
+{0x17cc,0x35701},
+{0x17cd,0x35701},
+{0x17ce,0x35701},
+{0x17cf,0x35701},
+{0x17d0,0x35701},
+{0x17d1,0x35701},
+{0x17d2,0x926e1},
+{0x17d3,0x1},
+{0x17d4,0x2ae1},
+{0x17d5,0x2b01},
+{0x17d6,0x2b21},
+{0x17d7,0x37701},
+{0x17d8,0x2b41},
+{0x17d9,0x2b61},
+{0x17da,0x2b81},
+{0x17db,0x37cc1},
+{0x17dc,0x922a1},
+{0x17dd,0x35701},
+{0x17e0,0x380c1},
+{0x17e1,0x382e1},
+{0x17e2,0x3a041},
+{0x17e3,0x3aec1},
+{0x17e4,0x3b641},
+{0x17e5,0x3bc01},
+{0x17e6,0x3bfe1},
+{0x17e7,0x3c301},
+{0x17e8,0x3c681},
+{0x17e9,0x3c9a1},
+{0x17f0,0x380c1},
+{0x17f1,0x382e1},
+{0x17f2,0x3a041},
+{0x17f3,0x3aec1},
+{0x17f4,0x3b641},
+{0x17f5,0x3bc01},
+{0x17f6,0x3bfe1},
+{0x17f7,0x3c301},
+{0x17f8,0x3c681},
+{0x17f9,0x3c9a1},
+{0x1800,0x2ba1},
+{0x1801,0x2bc1},
+{0x1802,0x2be1},
+{0x1803,0x2c01},
+{0x1804,0x2c21},
+{0x1805,0x2c41},
+{0x1806,0x2c61},
+{0x1807,0x2c81},
+{0x1808,0x2ca1},
+{0x1809,0x2cc1},
+{0x180a,0x1},
+{0x180b,0x1},
+{0x180c,0x1},
+{0x180d,0x1},
+{0x180e,0x1},
+{0x1810,0x380c1},
+{0x1811,0x382e1},
+{0x1812,0x3a041},
+{0x1813,0x3aec1},
+{0x1814,0x3b641},
+{0x1815,0x3bc01},
+{0x1816,0x3bfe1},
+{0x1817,0x3c301},
+{0x1818,0x3c681},
+{0x1819,0x3c9a1},
+{0x1820,0x98501},
+{0x1821,0x98541},
+{0x1822,0x985a1},
+{0x1823,0x98661},
+{0x1824,0x986a1},
+{0x1825,0x98701},
+{0x1826,0x98741},
+{0x1827,0x987a1},
+{0x1828,0x987c1},
+{0x1829,0x987e1},
+{0x182a,0x98881},
+{0x182b,0x988c1},
+{0x182c,0x98921},
+{0x182d,0x98961},
+{0x182e,0x98a01},
+{0x182f,0x98a41},
+{0x1830,0x98a61},
+{0x1831,0x98a81},
+{0x1832,0x98b61},
+{0x1833,0x98bc1},
+{0x1834,0x98c21},
+{0x1835,0x98cc1},
+{0x1836,0x98d41},
+{0x1837,0x98da1},
+{0x1838,0x98de1},
+{0x1839,0x98e21},
+{0x183a,0x98e81},
+{0x183b,0x98f21},
+{0x183c,0x98f41},
+{0x183d,0x98fa1},
+{0x183e,0x99021},
+{0x183f,0x99081},
+{0x1840,0x990a1},
+{0x1841,0x990c1},
+{0x1842,0x990e1},
+{0x1843,0x984e1},
+{0x1844,0x98561},
+{0x1845,0x985c1},
+{0x1846,0x98681},
+{0x1847,0x986c1},
+{0x1848,0x98721},
+{0x1849,0x98761},
+{0x184a,0x98801},
+{0x184b,0x988a1},
+{0x184c,0x988e1},
+{0x184d,0x98941},
+{0x184e,0x98981},
+{0x184f,0x98a21},
+{0x1850,0x98b81},
+{0x1851,0x98be1},
+{0x1852,0x98c41},
+{0x1853,0x98ce1},
+{0x1854,0x98f61},
+{0x1855,0x98d61},
+{0x1856,0x98e01},
+{0x1857,0x98ea1},
+{0x1858,0x98fe1},
+{0x1859,0x99041},
+{0x185a,0x99101},
+{0x185b,0x99121},
+{0x185c,0x98c81},
+{0x185d,0x98581},
+{0x185e,0x985e1},
+{0x185f,0x98641},
+{0x1860,0x98781},
+{0x1861,0x986e1},
+{0x1862,0x98821},
+{0x1863,0x98ec1},
+{0x1864,0x989a1},
+{0x1865,0x989e1},
+{0x1866,0x98901},
+{0x1867,0x98aa1},
+{0x1868,0x98ba1},
+{0x1869,0x98c01},
+{0x186a,0x98d01},
+{0x186b,0x98e41},
+{0x186c,0x99001},
+{0x186d,0x99061},
+{0x186e,0x98f81},
+{0x186f,0x98fc1},
+{0x1870,0x99141},
+{0x1871,0x98c61},
+{0x1872,0x98d81},
+{0x1873,0x98601},
+{0x1874,0x98ee1},
+{0x1875,0x98dc1},
+{0x1876,0x98e61},
+{0x1877,0x98d21},
+{0x1880,0x98401},
+{0x1881,0x98421},
+{0x1882,0x98441},
+{0x1883,0x98461},
+{0x1884,0x98481},
+{0x1885,0x984a1},
+{0x1886,0x984c1},
+{0x1887,0x98521},
+{0x1888,0x98621},
+{0x1889,0x98f01},
+{0x188a,0x98841},
+{0x188b,0x98ca1},
+{0x188c,0x99161},
+{0x188d,0x991a1},
+{0x188e,0x991c1},
+{0x188f,0x99201},
+{0x1890,0x99221},
+{0x1891,0x99281},
+{0x1892,0x992c1},
+{0x1893,0x992e1},
+{0x1894,0x99321},
+{0x1895,0x99361},
+{0x1896,0x993a1},
+{0x1897,0x993c1},
+{0x1898,0x99241},
+{0x1899,0x99381},
+{0x189a,0x989c1},
+{0x189b,0x98861},
+{0x189c,0x98ac1},
+{0x189d,0x98ae1},
+{0x189e,0x99181},
+{0x189f,0x991e1},
+{0x18a0,0x99261},
+{0x18a1,0x992a1},
+{0x18a2,0x98b01},
+{0x18a3,0x99341},
+{0x18a4,0x98b21},
+{0x18a5,0x98b41},
+{0x18a6,0x993e1},
+{0x18a7,0x99401},
+{0x18a8,0x99301},
+{0x18a9,0x99441},
+{0x18aa,0x99421},
+{0x18b0,0x9fe01},
+{0x18b1,0x9fe21},
+{0x18b2,0x9fe41},
+{0x18b3,0x9fe61},
+{0x18b4,0x9fe81},
+{0x18b5,0x9fea1},
+{0x18b6,0x9fec1},
+{0x18b7,0x9fee1},
+{0x18b8,0x9ff01},
+{0x18b9,0x9ff21},
+{0x18ba,0x9ff41},
+{0x18bb,0x9ff61},
+{0x18bc,0x9ff81},
+{0x18bd,0x9ffa1},
+{0x18be,0x9ffc1},
+{0x18bf,0x9ffe1},
+{0x18c0,0xa0001},
+{0x18c1,0xa0021},
+{0x18c2,0xa0041},
+{0x18c3,0xa0061},
+{0x18c4,0xa0081},
+{0x18c5,0xa00a1},
+{0x18c6,0xa00c1},
+{0x18c7,0xa00e1},
+{0x18c8,0xa0101},
+{0x18c9,0xa0121},
+{0x18ca,0xa0141},
+{0x18cb,0xa0161},
+{0x18cc,0xa0181},
+{0x18cd,0xa01a1},
+{0x18ce,0xa01c1},
+{0x18cf,0xa01e1},
+{0x18d0,0xa0201},
+{0x18d1,0xa0221},
+{0x18d2,0xa0241},
+{0x18d3,0xa0261},
+{0x18d4,0xa0281},
+{0x18d5,0xa02a1},
+{0x18d6,0xa02c1},
+{0x18d7,0xa02e1},
+{0x18d8,0xa0301},
+{0x18d9,0xa0321},
+{0x18da,0xa0341},
+{0x18db,0xa0361},
+{0x18dc,0xa0381},
+{0x18dd,0xa03a1},
+{0x18de,0xa03c1},
+{0x18df,0xa03e1},
+{0x18e0,0xa0401},
+{0x18e1,0xa0421},
+{0x18e2,0xa0441},
+{0x18e3,0xa0461},
+{0x18e4,0xa0481},
+{0x18e5,0xa04a1},
+{0x18e6,0xa04c1},
+{0x18e7,0xa04e1},
+{0x18e8,0xa0501},
+{0x18e9,0xa0521},
+{0x18ea,0xa0541},
+{0x18eb,0xa0561},
+{0x18ec,0xa0581},
+{0x18ed,0xa05a1},
+{0x18ee,0xa05c1},
+{0x18ef,0xa05e1},
+{0x18f0,0xa0601},
+{0x18f1,0xa0621},
+{0x18f2,0xa0641},
+{0x18f3,0xa0661},
+{0x18f4,0xa0681},
+{0x18f5,0xa06a1},
+{0x1900,0x8dee1},
+{0x1901,0x8df01},
+{0x1902,0x8df21},
+{0x1903,0x8df41},
+{0x1904,0x8df61},
+{0x1905,0x8df81},
+{0x1906,0x8dfa1},
+{0x1907,0x8dfc1},
+{0x1908,0x8dfe1},
+{0x1909,0x8e041},
+{0x190a,0x8e061},
+{0x190b,0x8e081},
+{0x190c,0x8e0e1},
+{0x190d,0x8e101},
+{0x190e,0x8e121},
+{0x190f,0x8e141},
+{0x1910,0x8e161},
+{0x1911,0x8e181},
+{0x1912,0x8e1a1},
+{0x1913,0x8e1c1},
+{0x1914,0x8e1e1},
+{0x1915,0x8e201},
+{0x1916,0x8e221},
+{0x1917,0x8e241},
+{0x1918,0x8e261},
+{0x1919,0x8e281},
+{0x191a,0x8e2a1},
+{0x191b,0x8e2c1},
+{0x191c,0x8e2e1},
+{0x191d,0x8e002},
+{0x191e,0x8e0a2},
+{0x1920,0x8e301},
+{0x1921,0x8e321},
+{0x1922,0x8e341},
+{0x1923,0x8e361},
+{0x1924,0x8e381},
+{0x1925,0x8e3a1},
+{0x1926,0x8e3c1},
+{0x1927,0x8e3e1},
+{0x1928,0x8e401},
+{0x1929,0x8e421},
+{0x192a,0x8e441},
+{0x192b,0x8e461},
+{0x1930,0x8e481},
+{0x1931,0x8e4a1},
+{0x1932,0x8e4c1},
+{0x1933,0x8e4e1},
+{0x1934,0x8e501},
+{0x1935,0x8e521},
+{0x1936,0x8e541},
+{0x1937,0x8e561},
+{0x1938,0x8e581},
+{0x1939,0x37281},
+{0x193a,0x372a1},
+{0x193b,0x372c1},
+{0x1940,0x2ce1},
+{0x1944,0x2d01},
+{0x1945,0x2d21},
+{0x1946,0x380c1},
+{0x1947,0x382e1},
+{0x1948,0x3a041},
+{0x1949,0x3aec1},
+{0x194a,0x3b641},
+{0x194b,0x3bc01},
+{0x194c,0x3bfe1},
+{0x194d,0x3c301},
+{0x194e,0x3c681},
+{0x194f,0x3c9a1},
+{0x1950,0x92701},
+{0x1951,0x92721},
+{0x1952,0x92741},
+{0x1953,0x92761},
+{0x1954,0x92781},
+{0x1955,0x927a1},
+{0x1956,0x927c1},
+{0x1957,0x927e1},
+{0x1958,0x92801},
+{0x1959,0x92821},
+{0x195a,0x92841},
+{0x195b,0x92861},
+{0x195c,0x92881},
+{0x195d,0x928a1},
+{0x195e,0x928c1},
+{0x195f,0x928e1},
+{0x1960,0x92901},
+{0x1961,0x92921},
+{0x1962,0x92941},
+{0x1963,0x92961},
+{0x1964,0x92981},
+{0x1965,0x929a1},
+{0x1966,0x929c1},
+{0x1967,0x929e1},
+{0x1968,0x92a01},
+{0x1969,0x92a21},
+{0x196a,0x92a41},
+{0x196b,0x92a61},
+{0x196c,0x92a81},
+{0x196d,0x92aa1},
+{0x1970,0x92ac1},
+{0x1971,0x92ae1},
+{0x1972,0x92b01},
+{0x1973,0x92b21},
+{0x1974,0x92b41},
+{0x1980,0x92b61},
+{0x1981,0x92c81},
+{0x1982,0x92da1},
+{0x1983,0x92ec1},
+{0x1984,0x92fe1},
+{0x1985,0x93101},
+{0x1986,0x93221},
+{0x1987,0x93341},
+{0x1988,0x93461},
+{0x1989,0x93581},
+{0x198a,0x936a1},
+{0x198b,0x937c1},
+{0x198c,0x938e1},
+{0x198d,0x93a01},
+{0x198e,0x93b21},
+{0x198f,0x93c41},
+{0x1990,0x93d61},
+{0x1991,0x93e81},
+{0x1992,0x93fa1},
+{0x1993,0x940c1},
+{0x1994,0x941e1},
+{0x1995,0x94301},
+{0x1996,0x94421},
+{0x1997,0x94541},
+{0x1998,0x94661},
+{0x1999,0x94781},
+{0x199a,0x948a1},
+{0x199b,0x949c1},
+{0x199c,0x94ae1},
+{0x199d,0x94ca1},
+{0x199e,0x94dc1},
+{0x199f,0x94ee1},
+{0x19a0,0x95001},
+{0x19a1,0x95121},
+{0x19a2,0x95241},
+{0x19a3,0x95361},
+{0x19a4,0x95481},
+{0x19a5,0x955a1},
+{0x19a6,0x956c1},
+{0x19a7,0x957e1},
+{0x19a8,0x95901},
+{0x19a9,0x95a21},
+{0x19aa,0x95b41},
+{0x19ab,0x95c61},
+{0x19b0,0x95d81},
+{0x19b1,0x95da1},
+{0x19b2,0x95dc1},
+{0x19b3,0x95de1},
+{0x19b4,0x95e01},
+{0x19b5,0x95e21},
+{0x19b6,0x95e41},
+{0x19b7,0x95e61},
+{0x19b8,0x95e81},
+{0x19b9,0x95ea1},
+{0x19ba,0x95ec1},
+{0x19bb,0x95ee1},
+{0x19bc,0x95f01},
+{0x19bd,0x95f21},
+{0x19be,0x95f41},
+{0x19bf,0x95f61},
+{0x19c0,0x95f81},
+{0x19c1,0x95fa1},
+{0x19c2,0x95fc1},
+{0x19c3,0x95fe1},
+{0x19c4,0x96001},
+{0x19c5,0x96021},
+{0x19c6,0x96041},
+{0x19c7,0x96061},
+{0x19c8,0x96081},
+{0x19c9,0x960a1},
+{0x19d0,0x380c1},
+{0x19d1,0x382e1},
+{0x19d2,0x3a041},
+{0x19d3,0x3aec1},
+{0x19d4,0x3b641},
+{0x19d5,0x3bc01},
+{0x19d6,0x3bfe1},
+{0x19d7,0x3c301},
+{0x19d8,0x3c681},
+{0x19d9,0x3c9a1},
+{0x19da,0x382e1},
+{0x19de,0x94b82},
+{0x19df,0x94bc3},
+{0x19e0,0x2d41},
+{0x19e1,0x2d61},
+{0x19e2,0x2d81},
+{0x19e3,0x2da1},
+{0x19e4,0x2dc1},
+{0x19e5,0x2de1},
+{0x19e6,0x2e01},
+{0x19e7,0x2e21},
+{0x19e8,0x2e41},
+{0x19e9,0x2e61},
+{0x19ea,0x2e81},
+{0x19eb,0x2ea1},
+{0x19ec,0x2ec1},
+{0x19ed,0x2ee1},
+{0x19ee,0x2f01},
+{0x19ef,0x2f21},
+{0x19f0,0x2f41},
+{0x19f1,0x2f61},
+{0x19f2,0x2f81},
+{0x19f3,0x2fa1},
+{0x19f4,0x2fc1},
+{0x19f5,0x2fe1},
+{0x19f6,0x3001},
+{0x19f7,0x3021},
+{0x19f8,0x3041},
+{0x19f9,0x3061},
+{0x19fa,0x3081},
+{0x19fb,0x30a1},
+{0x19fc,0x30c1},
+{0x19fd,0x30e1},
+{0x19fe,0x3101},
+{0x19ff,0x3121},
+{0x1a00,0x8ef81},
+{0x1a01,0x8efa1},
+{0x1a02,0x8efc1},
+{0x1a03,0x8efe1},
+{0x1a04,0x8f001},
+{0x1a05,0x8f021},
+{0x1a06,0x8f041},
+{0x1a07,0x8f061},
+{0x1a08,0x8f081},
+{0x1a09,0x8f0a1},
+{0x1a0a,0x8f0c1},
+{0x1a0b,0x8f0e1},
+{0x1a0c,0x8f101},
+{0x1a0d,0x8f121},
+{0x1a0e,0x8f141},
+{0x1a0f,0x8f161},
+{0x1a10,0x8f181},
+{0x1a11,0x8f1a1},
+{0x1a12,0x8f1c1},
+{0x1a13,0x8f1e1},
+{0x1a14,0x8f201},
+{0x1a15,0x8f221},
+{0x1a16,0x8f241},
+{0x1a17,0x8f261},
+{0x1a18,0x8f281},
+{0x1a19,0x8f2a1},
+{0x1a1a,0x8f2c1},
+{0x1a1b,0x8f2e1},
+{0x1a1e,0x3141},
+{0x1a1f,0x3161},
+{0x1a20,0x960c1},
+{0x1a21,0x960e1},
+{0x1a22,0x96101},
+{0x1a23,0x96121},
+{0x1a24,0x96141},
+{0x1a25,0x96161},
+{0x1a26,0x96181},
+{0x1a27,0x961c1},
+{0x1a28,0x961e1},
+{0x1a29,0x96201},
+{0x1a2a,0x96221},
+{0x1a2b,0x96241},
+{0x1a2c,0x96261},
+{0x1a2d,0x96281},
+{0x1a2e,0x962a1},
+{0x1a2f,0x962c1},
+{0x1a30,0x962e1},
+{0x1a31,0x96301},
+{0x1a32,0x96321},
+{0x1a33,0x96341},
+{0x1a34,0x96361},
+{0x1a35,0x96381},
+{0x1a36,0x963a1},
+{0x1a37,0x963c1},
+{0x1a38,0x963e1},
+{0x1a39,0x96401},
+{0x1a3a,0x96421},
+{0x1a3b,0x96441},
+{0x1a3c,0x96481},
+{0x1a3d,0x964a1},
+{0x1a3e,0x964c1},
+{0x1a3f,0x964e1},
+{0x1a40,0x96501},
+{0x1a41,0x96521},
+{0x1a42,0x96541},
+{0x1a43,0x96561},
+{0x1a44,0x96581},
+{0x1a45,0x965a1},
+{0x1a46,0x965c1},
+{0x1a47,0x96641},
+{0x1a48,0x96661},
+{0x1a49,0x96681},
+{0x1a4a,0x966a1},
+{0x1a4b,0x966c1},
+{0x1a4c,0x966e1},
+{0x1a4d,0x96801},
+{0x1a4e,0x96821},
+{0x1a4f,0x96841},
+{0x1a50,0x96861},
+{0x1a51,0x96881},
+{0x1a52,0x968a1},
+{0x1a53,0x96701},
+{0x1a54,0x965e3},
+{0x1a55,0x96741},
+{0x1a56,0x96761},
+{0x1a57,0x96781},
+{0x1a58,0x961a1},
+{0x1a59,0x961a1},
+{0x1a5a,0x96461},
+{0x1a5b,0x96461},
+{0x1a5c,0x967a1},
+{0x1a5d,0x967c1},
+{0x1a5e,0x967e1},
+{0x1a60,0x96b01},
+{0x1a61,0x968c1},
+{0x1a62,0x96901},
+{0x1a63,0x96921},
+{0x1a64,0x96941},
+{0x1a65,0x96961},
+{0x1a66,0x96981},
+{0x1a67,0x969a1},
+{0x1a68,0x969c1},
+{0x1a69,0x969e1},
+{0x1a6a,0x96a01},
+{0x1a6b,0x96721},
+{0x1a6c,0x968e1},
+{0x1a6d,0x96ae1},
+{0x1a6e,0x96a21},
+{0x1a6f,0x96a41},
+{0x1a70,0x96a81},
+{0x1a71,0x96aa1},
+{0x1a72,0x96ac1},
+{0x1a73,0x96a61},
+{0x1a74,0x36cc1},
+{0x1a75,0x37181},
+{0x1a76,0x371a1},
+{0x1a77,0x371c1},
+{0x1a78,0x371e1},
+{0x1a79,0x37201},
+{0x1a7a,0x37221},
+{0x1a7b,0x37241},
+{0x1a7c,0x37261},
+{0x1a7f,0x1},
+{0x1a80,0x380c1},
+{0x1a81,0x382e1},
+{0x1a82,0x3a041},
+{0x1a83,0x3aec1},
+{0x1a84,0x3b641},
+{0x1a85,0x3bc01},
+{0x1a86,0x3bfe1},
+{0x1a87,0x3c301},
+{0x1a88,0x3c681},
+{0x1a89,0x3c9a1},
+{0x1a90,0x380c1},
+{0x1a91,0x382e1},
+{0x1a92,0x3a041},
+{0x1a93,0x3aec1},
+{0x1a94,0x3b641},
+{0x1a95,0x3bc01},
+{0x1a96,0x3bfe1},
+{0x1a97,0x3c301},
+{0x1a98,0x3c681},
+{0x1a99,0x3c9a1},
+{0x1aa0,0x3181},
+{0x1aa1,0x31a1},
+{0x1aa2,0x31c1},
+{0x1aa3,0x31e1},
+{0x1aa4,0x3201},
+{0x1aa5,0x3221},
+{0x1aa6,0x3241},
+{0x1aa7,0x37721},
+{0x1aa8,0x3261},
+{0x1aa9,0x3281},
+{0x1aaa,0x32a1},
+{0x1aab,0x32c1},
+{0x1aac,0x32e1},
+{0x1aad,0x3301},
+{0x1ab0,0x35701},
+{0x1ab1,0x35701},
+{0x1ab2,0x35701},
+{0x1ab3,0x35701},
+{0x1ab4,0x35701},
+{0x1ab5,0x35721},
+{0x1ab6,0x35721},
+{0x1ab7,0x35721},
+{0x1ab8,0x35721},
+{0x1ab9,0x35721},
+{0x1aba,0x35721},
+{0x1abb,0x35701},
+{0x1abc,0x35701},
+{0x1abd,0x35721},
+{0x1abe,0x35761},
+{0x1b00,0x36ca1},
+{0x1b01,0x36ca1},
+{0x1b02,0x36cc1},
+{0x1b03,0x36d61},
+{0x1b04,0x36ce1},
+{0x1b05,0x973c1},
+{0x1b06,0x973e1},
+{0x1b07,0x97401},
+{0x1b08,0x97421},
+{0x1b09,0x97441},
+{0x1b0a,0x97461},
+{0x1b0b,0x97481},
+{0x1b0c,0x974a1},
+{0x1b0d,0x974c1},
+{0x1b0e,0x974e1},
+{0x1b0f,0x97501},
+{0x1b10,0x97521},
+{0x1b11,0x97541},
+{0x1b12,0x97561},
+{0x1b13,0x97581},
+{0x1b14,0x975e1},
+{0x1b15,0x97601},
+{0x1b16,0x97621},
+{0x1b17,0x97641},
+{0x1b18,0x97661},
+{0x1b19,0x97681},
+{0x1b1a,0x976a1},
+{0x1b1b,0x976c1},
+{0x1b1c,0x976e1},
+{0x1b1d,0x97701},
+{0x1b1e,0x97721},
+{0x1b1f,0x97741},
+{0x1b20,0x97761},
+{0x1b21,0x97781},
+{0x1b22,0x977a1},
+{0x1b23,0x977e1},
+{0x1b24,0x97801},
+{0x1b25,0x97821},
+{0x1b26,0x97841},
+{0x1b27,0x97861},
+{0x1b28,0x978a1},
+{0x1b29,0x978c1},
+{0x1b2a,0x978e1},
+{0x1b2b,0x97901},
+{0x1b2c,0x97921},
+{0x1b2d,0x97941},
+{0x1b2e,0x97961},
+{0x1b2f,0x97981},
+{0x1b30,0x979c1},
+{0x1b31,0x979e1},
+{0x1b32,0x97a01},
+{0x1b33,0x97a61},
+{0x1b34,0x36c81},
+{0x1b35,0x97a81},
+{0x1b36,0x97aa1},
+{0x1b37,0x97ac1},
+{0x1b38,0x97ae1},
+{0x1b39,0x97b01},
+{0x1b3a,0x97b21},
+{0x1b3b,0x97b41},
+{0x1b3c,0x97b61},
+{0x1b3d,0x97b81},
+{0x1b3e,0x97ba1},
+{0x1b3f,0x97bc1},
+{0x1b40,0x97be1},
+{0x1b41,0x97c01},
+{0x1b42,0x97c21},
+{0x1b43,0x97c41},
+{0x1b44,0x97c61},
+{0x1b45,0x975a1},
+{0x1b46,0x975c1},
+{0x1b47,0x977c1},
+{0x1b48,0x97881},
+{0x1b49,0x979a1},
+{0x1b4a,0x97a21},
+{0x1b4b,0x97a41},
+{0x1b50,0x380c1},
+{0x1b51,0x382e1},
+{0x1b52,0x3a041},
+{0x1b53,0x3aec1},
+{0x1b54,0x3b641},
+{0x1b55,0x3bc01},
+{0x1b56,0x3bfe1},
+{0x1b57,0x3c301},
+{0x1b58,0x3c681},
+{0x1b59,0x3c9a1},
+{0x1b5a,0x3321},
+{0x1b5b,0x3341},
+{0x1b5c,0x3361},
+{0x1b5d,0x3381},
+{0x1b5e,0x33a1},
+{0x1b5f,0x33c1},
+{0x1b60,0x33e1},
+{0x1b61,0x3401},
+{0x1b62,0x3421},
+{0x1b63,0x3441},
+{0x1b64,0x3461},
+{0x1b65,0x3481},
+{0x1b66,0x34a1},
+{0x1b67,0x34c1},
+{0x1b68,0x34e1},
+{0x1b69,0x3501},
+{0x1b6a,0x3521},
+{0x1b6b,0x1},
+{0x1b6c,0x1},
+{0x1b6d,0x1},
+{0x1b6e,0x1},
+{0x1b6f,0x1},
+{0x1b70,0x1},
+{0x1b71,0x1},
+{0x1b72,0x1},
+{0x1b73,0x1},
+{0x1b74,0x3541},
+{0x1b75,0x3561},
+{0x1b76,0x3581},
+{0x1b77,0x35a1},
+{0x1b78,0x35c1},
+{0x1b79,0x35e1},
+{0x1b7a,0x3601},
+{0x1b7b,0x3621},
+{0x1b7c,0x3641},
+{0x1b80,0x36cc1},
+{0x1b81,0x36da1},
+{0x1b82,0x36ce1},
+{0x1b83,0x7f821},
+{0x1b84,0x7f861},
+{0x1b85,0x7f881},
+{0x1b86,0x7f8a1},
+{0x1b87,0x7f8c1},
+{0x1b88,0x7f8e1},
+{0x1b89,0x7f901},
+{0x1b8a,0x7f921},
+{0x1b8b,0x7f981},
+{0x1b8c,0x7f9a1},
+{0x1b8d,0x7f9c1},
+{0x1b8e,0x7f9e1},
+{0x1b8f,0x7fa01},
+{0x1b90,0x7fa21},
+{0x1b91,0x7fa41},
+{0x1b92,0x7fa61},
+{0x1b93,0x7fa81},
+{0x1b94,0x7faa1},
+{0x1b95,0x7fac1},
+{0x1b96,0x7fae1},
+{0x1b97,0x7fb01},
+{0x1b98,0x7fb21},
+{0x1b99,0x7fb61},
+{0x1b9a,0x7fbc1},
+{0x1b9b,0x7fc01},
+{0x1b9c,0x7fc61},
+{0x1b9d,0x7fcc1},
+{0x1b9e,0x7fd01},
+{0x1b9f,0x7fd21},
+{0x1ba0,0x7fd61},
+{0x1ba1,0x7fbe1},
+{0x1ba2,0x7fc21},
+{0x1ba3,0x7fc81},
+{0x1ba4,0x7fd81},
+{0x1ba5,0x7fda1},
+{0x1ba6,0x7fdc1},
+{0x1ba7,0x7fde1},
+{0x1ba8,0x7fe01},
+{0x1ba9,0x7fe21},
+{0x1baa,0x7fe41},
+{0x1bab,0x7fe61},
+{0x1bac,0x7fba1},
+{0x1bad,0x7fce1},
+{0x1bae,0x7f961},
+{0x1baf,0x7fd41},
+{0x1bb0,0x380c1},
+{0x1bb1,0x382e1},
+{0x1bb2,0x3a041},
+{0x1bb3,0x3aec1},
+{0x1bb4,0x3b641},
+{0x1bb5,0x3bc01},
+{0x1bb6,0x3bfe1},
+{0x1bb7,0x3c301},
+{0x1bb8,0x3c681},
+{0x1bb9,0x3c9a1},
+{0x1bba,0x7f841},
+{0x1bbb,0x7fc41},
+{0x1bbc,0x7fca1},
+{0x1bbd,0x7fb41},
+{0x1bbe,0x7f941},
+{0x1bbf,0x7fb81},
+{0x1bc0,0x8f301},
+{0x1bc1,0x8f321},
+{0x1bc2,0x8f341},
+{0x1bc3,0x8f361},
+{0x1bc4,0x8f361},
+{0x1bc5,0x8f381},
+{0x1bc6,0x8f3a1},
+{0x1bc7,0x8f3c1},
+{0x1bc8,0x8f3e1},
+{0x1bc9,0x8f401},
+{0x1bca,0x8f421},
+{0x1bcb,0x8f441},
+{0x1bcc,0x8f461},
+{0x1bcd,0x8f461},
+{0x1bce,0x8f481},
+{0x1bcf,0x8f4a1},
+{0x1bd0,0x8f4c1},
+{0x1bd1,0x8f4e1},
+{0x1bd2,0x8f501},
+{0x1bd3,0x8f521},
+{0x1bd4,0x8f541},
+{0x1bd5,0x8f561},
+{0x1bd6,0x8f581},
+{0x1bd7,0x8f5a1},
+{0x1bd8,0x8f5c1},
+{0x1bd9,0x8f5e1},
+{0x1bda,0x8f5e1},
+{0x1bdb,0x8f601},
+{0x1bdc,0x8f621},
+{0x1bdd,0x8f641},
+{0x1bde,0x8f661},
+{0x1bdf,0x8f681},
+{0x1be0,0x8f6a1},
+{0x1be1,0x8f6c1},
+{0x1be2,0x8f6e1},
+{0x1be3,0x8f701},
+{0x1be4,0x8f721},
+{0x1be5,0x8f741},
+{0x1be6,0x36c81},
+{0x1be7,0x8f761},
+{0x1be8,0x8f781},
+{0x1be9,0x8f7a1},
+{0x1bea,0x8f7c1},
+{0x1beb,0x8f7e1},
+{0x1bec,0x8f801},
+{0x1bed,0x8f821},
+{0x1bee,0x8f841},
+{0x1bef,0x8f861},
+{0x1bf0,0x8f881},
+{0x1bf1,0x8f8a1},
+{0x1bf2,0x8f8c1},
+{0x1bf3,0x8f8e1},
+{0x1bfc,0x3661},
+{0x1bfd,0x3681},
+{0x1bfe,0x36a1},
+{0x1bff,0x36c1},
+{0x1c00,0x8d121},
+{0x1c01,0x8d141},
+{0x1c02,0x8d161},
+{0x1c03,0x8d181},
+{0x1c04,0x8d1a1},
+{0x1c05,0x8d1c1},
+{0x1c06,0x8d1e1},
+{0x1c07,0x8d201},
+{0x1c08,0x8d221},
+{0x1c09,0x8d241},
+{0x1c0a,0x8d2c1},
+{0x1c0b,0x8d2e1},
+{0x1c0c,0x8d301},
+{0x1c0d,0x8d321},
+{0x1c0e,0x8d341},
+{0x1c0f,0x8d361},
+{0x1c10,0x8d381},
+{0x1c11,0x8d3a1},
+{0x1c12,0x8d3c1},
+{0x1c13,0x8d3e1},
+{0x1c14,0x8d401},
+{0x1c15,0x8d421},
+{0x1c16,0x8d441},
+{0x1c17,0x8d461},
+{0x1c18,0x8d481},
+{0x1c19,0x8d4a1},
+{0x1c1a,0x8d4c1},
+{0x1c1b,0x8d501},
+{0x1c1c,0x8d541},
+{0x1c1d,0x8d561},
+{0x1c1e,0x8d581},
+{0x1c1f,0x8d5a1},
+{0x1c20,0x8d5c1},
+{0x1c21,0x8d5e1},
+{0x1c22,0x8d601},
+{0x1c23,0x8d621},
+{0x1c24,0x8d4e1},
+{0x1c25,0x8d521},
+{0x1c26,0x8d661},
+{0x1c27,0x8d681},
+{0x1c28,0x8d6a1},
+{0x1c29,0x8d6c1},
+{0x1c2a,0x8d6e1},
+{0x1c2b,0x8d701},
+{0x1c2c,0x8d721},
+{0x1c2d,0x8d741},
+{0x1c2e,0x8d761},
+{0x1c2f,0x8d781},
+{0x1c30,0x8d7a1},
+{0x1c31,0x8d7c1},
+{0x1c32,0x8d7e1},
+{0x1c33,0x8d801},
+{0x1c34,0x8d821},
+{0x1c35,0x8d841},
+{0x1c36,0x8d641},
+{0x1c37,0x36c81},
+{0x1c3b,0x36e1},
+{0x1c3c,0x3701},
+{0x1c3d,0x3721},
+{0x1c3e,0x3741},
+{0x1c3f,0x3761},
+{0x1c40,0x380c1},
+{0x1c41,0x382e1},
+{0x1c42,0x3a041},
+{0x1c43,0x3aec1},
+{0x1c44,0x3b641},
+{0x1c45,0x3bc01},
+{0x1c46,0x3bfe1},
+{0x1c47,0x3c301},
+{0x1c48,0x3c681},
+{0x1c49,0x3c9a1},
+{0x1c4d,0x8d261},
+{0x1c4e,0x8d281},
+{0x1c4f,0x8d2a1},
+{0x1c50,0x380c1},
+{0x1c51,0x382e1},
+{0x1c52,0x3a041},
+{0x1c53,0x3aec1},
+{0x1c54,0x3b641},
+{0x1c55,0x3bc01},
+{0x1c56,0x3bfe1},
+{0x1c57,0x3c301},
+{0x1c58,0x3c681},
+{0x1c59,0x3c9a1},
+{0x1c5a,0x99461},
+{0x1c5b,0x99481},
+{0x1c5c,0x994a1},
+{0x1c5d,0x994c1},
+{0x1c5e,0x994e1},
+{0x1c5f,0x99501},
+{0x1c60,0x99521},
+{0x1c61,0x99541},
+{0x1c62,0x99561},
+{0x1c63,0x99581},
+{0x1c64,0x995a1},
+{0x1c65,0x995c1},
+{0x1c66,0x995e1},
+{0x1c67,0x99601},
+{0x1c68,0x99621},
+{0x1c69,0x99641},
+{0x1c6a,0x99661},
+{0x1c6b,0x99681},
+{0x1c6c,0x996a1},
+{0x1c6d,0x996c1},
+{0x1c6e,0x996e1},
+{0x1c6f,0x99701},
+{0x1c70,0x99721},
+{0x1c71,0x99741},
+{0x1c72,0x99761},
+{0x1c73,0x99781},
+{0x1c74,0x997a1},
+{0x1c75,0x997c1},
+{0x1c76,0x997e1},
+{0x1c77,0x99801},
+{0x1c78,0x99821},
+{0x1c79,0x99841},
+{0x1c7a,0x99861},
+{0x1c7b,0x99881},
+{0x1c7c,0x998a1},
+{0x1c7d,0x998c1},
+{0x1c7e,0x3781},
+{0x1c7f,0x37a1},
+{0x1cc0,0x37c1},
+{0x1cc1,0x37e1},
+{0x1cc2,0x3801},
+{0x1cc3,0x3821},
+{0x1cc4,0x3841},
+{0x1cc5,0x3861},
+{0x1cc6,0x3881},
+{0x1cc7,0x38a1},
+{0x1cd0,0x1},
+{0x1cd1,0x1},
+{0x1cd2,0x1},
+{0x1cd3,0x1},
+{0x1cd4,0x1},
+{0x1cd5,0x1},
+{0x1cd6,0x1},
+{0x1cd7,0x1},
+{0x1cd8,0x1},
+{0x1cd9,0x1},
+{0x1cda,0x1},
+{0x1cdb,0x1},
+{0x1cdc,0x1},
+{0x1cdd,0x1},
+{0x1cde,0x1},
+{0x1cdf,0x1},
+{0x1ce0,0x1},
+{0x1ce1,0x1},
+{0x1ce2,0x1},
+{0x1ce3,0x1},
+{0x1ce4,0x1},
+{0x1ce5,0x1},
+{0x1ce6,0x1},
+{0x1ce7,0x1},
+{0x1ce8,0x1},
+{0x1ce9,0x73ac1},
+{0x1cea,0x73ae1},
+{0x1ceb,0x73ae1},
+{0x1cec,0x73ae1},
+{0x1ced,0x36cc1},
+{0x1cee,0x73ae1},
+{0x1cef,0x73ae1},
+{0x1cf0,0x73ae1},
+{0x1cf1,0x73ae1},
+{0x1cf2,0x36ce1},
+{0x1cf3,0x36ce1},
+{0x1cf4,0x1},
+{0x1cf5,0x73b01},
+{0x1cf6,0x73b21},
+{0x1cf8,0x1},
+{0x1cf9,0x1},
+{0x1d00,0x3ea61},
+{0x1d01,0x3eae1},
+{0x1d02,0x3eb01},
+{0x1d03,0x3f1c1},
+{0x1d04,0x3fdc1},
+{0x1d05,0x40b21},
+{0x1d06,0x40b41},
+{0x1d07,0x41e41},
+{0x1d08,0x421e1},
+{0x1d09,0x44e61},
+{0x1d0a,0x45301},
+{0x1d0b,0x45e21},
+{0x1d0c,0x46ae1},
+{0x1d0d,0x47981},
+{0x1d0e,0x485c1},
+{0x1d0f,0x4a401},
+{0x1d10,0x4a5e1},
+{0x1d11,0x4a421},
+{0x1d12,0x4a601},
+{0x1d13,0x4a541},
+{0x1d14,0x4a481},
+{0x1d15,0x4a8c1},
+{0x1d16,0x4a6c1},
+{0x1d17,0x4a701},
+{0x1d18,0x4b041},
+{0x1d19,0x4c081},
+{0x1d1a,0x4c141},
+{0x1d1b,0x4dcc1},
+{0x1d1c,0x4f3e1},
+{0x1d1d,0x4f441},
+{0x1d1e,0x4f481},
+{0x1d1f,0x4f721},
+{0x1d20,0x4fec1},
+{0x1d21,0x506a1},
+{0x1d22,0x51a41},
+{0x1d23,0x51d41},
+{0x1d24,0x524a1},
+{0x1d25,0x524c1},
+{0x1d26,0x539a1},
+{0x1d27,0x55f21},
+{0x1d28,0x56901},
+{0x1d29,0x56b61},
+{0x1d2a,0x57901},
+{0x1d2b,0x5b021},
+{0x1d2c,0x3cea1},
+{0x1d2d,0x3e323},
+{0x1d2e,0x3ef01},
+{0x1d2f,0x3f1a1},
+{0x1d30,0x401a1},
+{0x1d31,0x40f01},
+{0x1d32,0x41f81},
+{0x1d33,0x42c41},
+{0x1d34,0x43721},
+{0x1d35,0x441c1},
+{0x1d36,0x451e1},
+{0x1d37,0x45641},
+{0x1d38,0x46221},
+{0x1d39,0x470c1},
+{0x1d3a,0x47d01},
+{0x1d3b,0x485a1},
+{0x1d3c,0x48a41},
+{0x1d3d,0x4a8a1},
+{0x1d3e,0x4ab01},
+{0x1d3f,0x4b7a1},
+{0x1d40,0x4d5c1},
+{0x1d41,0x4e0e1},
+{0x1d42,0x50281},
+{0x1d43,0x3ce61},
+{0x1d44,0x3eba1},
+{0x1d45,0x3ec21},
+{0x1d46,0x3eb21},
+{0x1d47,0x3eee1},
+{0x1d48,0x40181},
+{0x1d49,0x40ec1},
+{0x1d4a,0x42021},
+{0x1d4b,0x420e1},
+{0x1d4c,0x42201},
+{0x1d4d,0x42c21},
+{0x1d4e,0x44e81},
+{0x1d4f,0x45601},
+{0x1d50,0x47081},
+{0x1d51,0x487e1},
+{0x1d52,0x48a01},
+{0x1d53,0x4a5c1},
+{0x1d54,0x4a6e1},
+{0x1d55,0x4a721},
+{0x1d56,0x4aac1},
+{0x1d57,0x4d581},
+{0x1d58,0x4e0a1},
+{0x1d59,0x4f461},
+{0x1d5a,0x4f6e1},
+{0x1d5b,0x4fa01},
+{0x1d5c,0x524e1},
+{0x1d5d,0x538a1},
+{0x1d5e,0x53961},
+{0x1d5f,0x53a41},
+{0x1d60,0x57781},
+{0x1d61,0x57841},
+{0x1d62,0x441a1},
+{0x1d63,0x4b781},
+{0x1d64,0x4e0c1},
+{0x1d65,0x4fa21},
+{0x1d66,0x538c1},
+{0x1d67,0x53981},
+{0x1d68,0x56a81},
+{0x1d69,0x577a1},
+{0x1d6a,0x57861},
+{0x1d6b,0x4f4a1},
+{0x1d6c,0x3f1e1},
+{0x1d6d,0x40b61},
+{0x1d6e,0x42961},
+{0x1d6f,0x479c1},
+{0x1d70,0x485e1},
+{0x1d71,0x4b0e1},
+{0x1d72,0x4c0e1},
+{0x1d73,0x4c2a1},
+{0x1d74,0x4d161},
+{0x1d75,0x4dd61},
+{0x1d76,0x51aa1},
+{0x1d77,0x43401},
+{0x1d78,0x5b381},
+{0x1d79,0x43062},
+{0x1d7a,0x4dac3},
+{0x1d7b,0x44f01},
+{0x1d7c,0x44fc1},
+{0x1d7d,0x4b061},
+{0x1d7e,0x4f581},
+{0x1d7f,0x4f7e1},
+{0x1d80,0x3f241},
+{0x1d81,0x40b81},
+{0x1d82,0x42981},
+{0x1d83,0x43381},
+{0x1d84,0x45e41},
+{0x1d85,0x46d01},
+{0x1d86,0x479e1},
+{0x1d87,0x486e1},
+{0x1d88,0x4b101},
+{0x1d89,0x4c181},
+{0x1d8a,0x4d181},
+{0x1d8b,0x4d301},
+{0x1d8c,0x4ff21},
+{0x1d8d,0x50bc1},
+{0x1d8e,0x51ac1},
+{0x1d8f,0x3eac1},
+{0x1d90,0x3ec61},
+{0x1d91,0x40c21},
+{0x1d92,0x41ee1},
+{0x1d93,0x42101},
+{0x1d94,0x421c1},
+{0x1d95,0x42061},
+{0x1d96,0x44f41},
+{0x1d97,0x4a641},
+{0x1d98,0x4d361},
+{0x1d99,0x4f5a1},
+{0x1d9a,0x51da1},
+{0x1d9b,0x3ecc1},
+{0x1d9c,0x3f581},
+{0x1d9d,0x3fee1},
+{0x1d9e,0x405c2},
+{0x1d9f,0x421a1},
+{0x1da0,0x424c1},
+{0x1da1,0x453e1},
+{0x1da2,0x432c1},
+{0x1da3,0x4f641},
+{0x1da4,0x44ee1},
+{0x1da5,0x44fa1},
+{0x1da6,0x44e01},
+{0x1da7,0x44f21},
+{0x1da8,0x453a1},
+{0x1da9,0x46d61},
+{0x1daa,0x46d21},
+{0x1dab,0x46a81},
+{0x1dac,0x47a41},
+{0x1dad,0x4f761},
+{0x1dae,0x48641},
+{0x1daf,0x48721},
+{0x1db0,0x48581},
+{0x1db1,0x4a7a1},
+{0x1db2,0x4b221},
+{0x1db3,0x4d1c1},
+{0x1db4,0x4d2c1},
+{0x1db5,0x4dda1},
+{0x1db6,0x4f541},
+{0x1db7,0x4f7c1},
+{0x1db8,0x4f401},
+{0x1db9,0x4ff81},
+{0x1dba,0x50061},
+{0x1dbb,0x516c1},
+{0x1dbc,0x51b41},
+{0x1dbd,0x51b81},
+{0x1dbe,0x51ca1},
+{0x1dbf,0x552e1},
+{0x1dc0,0x35701},
+{0x1dc1,0x35701},
+{0x1dc2,0x35721},
+{0x1dc3,0x35701},
+{0x1dc4,0x35701},
+{0x1dc5,0x35701},
+{0x1dc6,0x35701},
+{0x1dc7,0x35701},
+{0x1dc8,0x35701},
+{0x1dc9,0x35701},
+{0x1dca,0x4b5c1},
+{0x1dcb,0x35701},
+{0x1dcc,0x35701},
+{0x1dcd,0x35701},
+{0x1dce,0x35701},
+{0x1dcf,0x35721},
+{0x1dd0,0x35721},
+{0x1dd1,0x35701},
+{0x1dd2,0x52041},
+{0x1dd3,0x3e102},
+{0x1dd4,0x3e263},
+{0x1dd5,0x3e662},
+{0x1dd6,0x3e862},
+{0x1dd7,0x3f802},
+{0x1dd8,0x40602},
+{0x1dd9,0x40542},
+{0x1dda,0x42a81},
+{0x1ddb,0x43321},
+{0x1ddc,0x45461},
+{0x1ddd,0x46021},
+{0x1dde,0x46a61},
+{0x1ddf,0x479a1},
+{0x1de0,0x47b21},
+{0x1de1,0x48561},
+{0x1de2,0x4bfc1},
+{0x1de3,0x4c041},
+{0x1de4,0x4c481},
+{0x1de5,0x4cd22},
+{0x1de6,0x51521},
+{0x1de7,0x3ebe1},
+{0x1de8,0x3ed41},
+{0x1de9,0x3f301},
+{0x1dea,0x41fe1},
+{0x1deb,0x422e1},
+{0x1dec,0x46c41},
+{0x1ded,0x49aa2},
+{0x1dee,0x4a921},
+{0x1def,0x4d281},
+{0x1df0,0x4eb82},
+{0x1df1,0x500c1},
+{0x1df2,0x3d8c2},
+{0x1df3,0x49022},
+{0x1df4,0x4e442},
+{0x1df5,0x35701},
+{0x1dfc,0x35721},
+{0x1dfd,0x35721},
+{0x1dfe,0x35701},
+{0x1dff,0x35721},
+{0x1e00,0x3e0c2},
+{0x1e01,0x3e082},
+{0x1e02,0x3ef62},
+{0x1e03,0x3ef22},
+{0x1e04,0x3efe2},
+{0x1e05,0x3efa2},
+{0x1e06,0x3f062},
+{0x1e07,0x3f022},
+{0x1e08,0x3f8e3},
+{0x1e09,0x3f883},
+{0x1e0a,0x40282},
+{0x1e0b,0x40242},
+{0x1e0c,0x40402},
+{0x1e0d,0x403c2},
+{0x1e0e,0x40502},
+{0x1e0f,0x404c2},
+{0x1e10,0x40302},
+{0x1e11,0x402c2},
+{0x1e12,0x40482},
+{0x1e13,0x40442},
+{0x1e14,0x41983},
+{0x1e15,0x41923},
+{0x1e16,0x418c3},
+{0x1e17,0x41863},
+{0x1e18,0x41ce2},
+{0x1e19,0x41ca2},
+{0x1e1a,0x41d62},
+{0x1e1b,0x41d22},
+{0x1e1c,0x41703},
+{0x1e1d,0x416a3},
+{0x1e1e,0x42542},
+{0x1e1f,0x42502},
+{0x1e20,0x42fa2},
+{0x1e21,0x42f62},
+{0x1e22,0x43902},
+{0x1e23,0x438c2},
+{0x1e24,0x43ac2},
+{0x1e25,0x43a82},
+{0x1e26,0x43882},
+{0x1e27,0x43842},
+{0x1e28,0x43982},
+{0x1e29,0x43942},
+{0x1e2a,0x43b42},
+{0x1e2b,0x43b02},
+{0x1e2c,0x449a2},
+{0x1e2d,0x44962},
+{0x1e2e,0x44543},
+{0x1e2f,0x444e3},
+{0x1e30,0x456a2},
+{0x1e31,0x45662},
+{0x1e32,0x458a2},
+{0x1e33,0x45862},
+{0x1e34,0x45922},
+{0x1e35,0x458e2},
+{0x1e36,0x46482},
+{0x1e37,0x46442},
+{0x1e38,0x46523},
+{0x1e39,0x464c3},
+{0x1e3a,0x46642},
+{0x1e3b,0x46602},
+{0x1e3c,0x465c2},
+{0x1e3d,0x46582},
+{0x1e3e,0x47122},
+{0x1e3f,0x470e2},
+{0x1e40,0x471a2},
+{0x1e41,0x47162},
+{0x1e42,0x47222},
+{0x1e43,0x471e2},
+{0x1e44,0x47f62},
+{0x1e45,0x47f22},
+{0x1e46,0x480e2},
+{0x1e47,0x480a2},
+{0x1e48,0x481e2},
+{0x1e49,0x481a2},
+{0x1e4a,0x48162},
+{0x1e4b,0x48122},
+{0x1e4c,0x49303},
+{0x1e4d,0x492a3},
+{0x1e4e,0x493c3},
+{0x1e4f,0x49363},
+{0x1e50,0x49a43},
+{0x1e51,0x499e3},
+{0x1e52,0x49983},
+{0x1e53,0x49923},
+{0x1e54,0x4ab62},
+{0x1e55,0x4ab22},
+{0x1e56,0x4abe2},
+{0x1e57,0x4aba2},
+{0x1e58,0x4b902},
+{0x1e59,0x4b8c2},
+{0x1e5a,0x4bb82},
+{0x1e5b,0x4bb42},
+{0x1e5c,0x4bc23},
+{0x1e5d,0x4bbc3},
+{0x1e5e,0x4bcc2},
+{0x1e5f,0x4bc82},
+{0x1e60,0x4ca22},
+{0x1e61,0x4c9e2},
+{0x1e62,0x4cba2},
+{0x1e63,0x4cb62},
+{0x1e64,0x4c7c3},
+{0x1e65,0x4c763},
+{0x1e66,0x4c983},
+{0x1e67,0x4c923},
+{0x1e68,0x4cc43},
+{0x1e69,0x4cbe3},
+{0x1e6a,0x4d6e2},
+{0x1e6b,0x4d6a2},
+{0x1e6c,0x4d7e2},
+{0x1e6d,0x4d7a2},
+{0x1e6e,0x4d962},
+{0x1e6f,0x4d922},
+{0x1e70,0x4d8e2},
+{0x1e71,0x4d8a2},
+{0x1e72,0x4f242},
+{0x1e73,0x4f202},
+{0x1e74,0x4f342},
+{0x1e75,0x4f302},
+{0x1e76,0x4f2c2},
+{0x1e77,0x4f282},
+{0x1e78,0x4e963},
+{0x1e79,0x4e903},
+{0x1e7a,0x4eb23},
+{0x1e7b,0x4eac3},
+{0x1e7c,0x4faa2},
+{0x1e7d,0x4fa62},
+{0x1e7e,0x4fb22},
+{0x1e7f,0x4fae2},
+{0x1e80,0x50362},
+{0x1e81,0x50322},
+{0x1e82,0x502e2},
+{0x1e83,0x502a2},
+{0x1e84,0x504a2},
+{0x1e85,0x50462},
+{0x1e86,0x50522},
+{0x1e87,0x504e2},
+{0x1e88,0x505a2},
+{0x1e89,0x50562},
+{0x1e8a,0x50a42},
+{0x1e8b,0x50a02},
+{0x1e8c,0x509c2},
+{0x1e8d,0x50982},
+{0x1e8e,0x511e2},
+{0x1e8f,0x511a2},
+{0x1e90,0x517c2},
+{0x1e91,0x51782},
+{0x1e92,0x51942},
+{0x1e93,0x51902},
+{0x1e94,0x519c2},
+{0x1e95,0x51982},
+{0x1e96,0x43b82},
+{0x1e97,0x4d662},
+{0x1e98,0x50422},
+{0x1e99,0x51062},
+{0x1e9a,0x3ea22},
+{0x1e9b,0x4cda3},
+{0x1e9c,0x4d221},
+{0x1e9d,0x4d241},
+{0x1e9e,0x4d003},
+{0x1e9f,0x40cc1},
+{0x1ea0,0x3dec2},
+{0x1ea1,0x3de82},
+{0x1ea2,0x3dd42},
+{0x1ea3,0x3dd02},
+{0x1ea4,0x3d423},
+{0x1ea5,0x3d3c3},
+{0x1ea6,0x3d4e3},
+{0x1ea7,0x3d483},
+{0x1ea8,0x3d663},
+{0x1ea9,0x3d603},
+{0x1eaa,0x3d5a3},
+{0x1eab,0x3d543},
+{0x1eac,0x3e023},
+{0x1ead,0x3dfc3},
+{0x1eae,0x3d0a3},
+{0x1eaf,0x3d043},
+{0x1eb0,0x3d163},
+{0x1eb1,0x3d103},
+{0x1eb2,0x3d2e3},
+{0x1eb3,0x3d283},
+{0x1eb4,0x3d223},
+{0x1eb5,0x3d1c3},
+{0x1eb6,0x3df63},
+{0x1eb7,0x3df03},
+{0x1eb8,0x41ba2},
+{0x1eb9,0x41b62},
+{0x1eba,0x41a22},
+{0x1ebb,0x419e2},
+{0x1ebc,0x41562},
+{0x1ebd,0x41522},
+{0x1ebe,0x41183},
+{0x1ebf,0x41123},
+{0x1ec0,0x41243},
+{0x1ec1,0x411e3},
+{0x1ec2,0x413c3},
+{0x1ec3,0x41363},
+{0x1ec4,0x41303},
+{0x1ec5,0x412a3},
+{0x1ec6,0x41c43},
+{0x1ec7,0x41be3},
+{0x1ec8,0x447a2},
+{0x1ec9,0x44762},
+{0x1eca,0x44922},
+{0x1ecb,0x448e2},
+{0x1ecc,0x4a0e2},
+{0x1ecd,0x4a0a2},
+{0x1ece,0x49b22},
+{0x1ecf,0x49ae2},
+{0x1ed0,0x48cc3},
+{0x1ed1,0x48c63},
+{0x1ed2,0x48d83},
+{0x1ed3,0x48d23},
+{0x1ed4,0x48f03},
+{0x1ed5,0x48ea3},
+{0x1ed6,0x48e43},
+{0x1ed7,0x48de3},
+{0x1ed8,0x4a183},
+{0x1ed9,0x4a123},
+{0x1eda,0x49d43},
+{0x1edb,0x49ce3},
+{0x1edc,0x49e03},
+{0x1edd,0x49da3},
+{0x1ede,0x49f83},
+{0x1edf,0x49f23},
+{0x1ee0,0x49ec3},
+{0x1ee1,0x49e63},
+{0x1ee2,0x4a043},
+{0x1ee3,0x49fe3},
+{0x1ee4,0x4f1c2},
+{0x1ee5,0x4f182},
+{0x1ee6,0x4ec02},
+{0x1ee7,0x4ebc2},
+{0x1ee8,0x4ee23},
+{0x1ee9,0x4edc3},
+{0x1eea,0x4eee3},
+{0x1eeb,0x4ee83},
+{0x1eec,0x4f063},
+{0x1eed,0x4f003},
+{0x1eee,0x4efa3},
+{0x1eef,0x4ef43},
+{0x1ef0,0x4f123},
+{0x1ef1,0x4f0c3},
+{0x1ef2,0x50fa2},
+{0x1ef3,0x50f62},
+{0x1ef4,0x51362},
+{0x1ef5,0x51322},
+{0x1ef6,0x512e2},
+{0x1ef7,0x512a2},
+{0x1ef8,0x51162},
+{0x1ef9,0x51122},
+{0x1efa,0x46802},
+{0x1efb,0x467c2},
+{0x1efc,0x50001},
+{0x1efd,0x4ffe1},
+{0x1efe,0x51461},
+{0x1eff,0x51441},
+{0x1f00,0x52722},
+{0x1f01,0x52da2},
+{0x1f02,0x52963},
+{0x1f03,0x52fe3},
+{0x1f04,0x527a3},
+{0x1f05,0x52e23},
+{0x1f06,0x52b23},
+{0x1f07,0x531a3},
+{0x1f08,0x52762},
+{0x1f09,0x52de2},
+{0x1f0a,0x529c3},
+{0x1f0b,0x53043},
+{0x1f0c,0x52803},
+{0x1f0d,0x52e83},
+{0x1f0e,0x52b83},
+{0x1f0f,0x53203},
+{0x1f10,0x53b02},
+{0x1f11,0x53d02},
+{0x1f12,0x53c43},
+{0x1f13,0x53e43},
+{0x1f14,0x53b83},
+{0x1f15,0x53d83},
+{0x1f18,0x53b42},
+{0x1f19,0x53d42},
+{0x1f1a,0x53ca3},
+{0x1f1b,0x53ea3},
+{0x1f1c,0x53be3},
+{0x1f1d,0x53de3},
+{0x1f20,0x54242},
+{0x1f21,0x548c2},
+{0x1f22,0x54483},
+{0x1f23,0x54b03},
+{0x1f24,0x542c3},
+{0x1f25,0x54943},
+{0x1f26,0x54643},
+{0x1f27,0x54cc3},
+{0x1f28,0x54282},
+{0x1f29,0x54902},
+{0x1f2a,0x544e3},
+{0x1f2b,0x54b63},
+{0x1f2c,0x54323},
+{0x1f2d,0x549a3},
+{0x1f2e,0x546a3},
+{0x1f2f,0x54d23},
+{0x1f30,0x553a2},
+{0x1f31,0x55662},
+{0x1f32,0x554e3},
+{0x1f33,0x557a3},
+{0x1f34,0x55423},
+{0x1f35,0x556e3},
+{0x1f36,0x555a3},
+{0x1f37,0x55863},
+{0x1f38,0x553e2},
+{0x1f39,0x556a2},
+{0x1f3a,0x55543},
+{0x1f3b,0x55803},
+{0x1f3c,0x55483},
+{0x1f3d,0x55743},
+{0x1f3e,0x55603},
+{0x1f3f,0x558c3},
+{0x1f40,0x56362},
+{0x1f41,0x56562},
+{0x1f42,0x564a3},
+{0x1f43,0x566a3},
+{0x1f44,0x563e3},
+{0x1f45,0x565e3},
+{0x1f48,0x563a2},
+{0x1f49,0x565a2},
+{0x1f4a,0x56503},
+{0x1f4b,0x56703},
+{0x1f4c,0x56443},
+{0x1f4d,0x56643},
+{0x1f50,0x56e62},
+{0x1f51,0x56fc2},
+{0x1f52,0x56f03},
+{0x1f53,0x57103},
+{0x1f54,0x56ea3},
+{0x1f55,0x57043},
+{0x1f56,0x56f63},
+{0x1f57,0x571c3},
+{0x1f59,0x57002},
+{0x1f5b,0x57163},
+{0x1f5d,0x570a3},
+{0x1f5f,0x57223},
+{0x1f60,0x579a2},
+{0x1f61,0x58022},
+{0x1f62,0x57be3},
+{0x1f63,0x58263},
+{0x1f64,0x57a23},
+{0x1f65,0x580a3},
+{0x1f66,0x57da3},
+{0x1f67,0x58423},
+{0x1f68,0x579e2},
+{0x1f69,0x58062},
+{0x1f6a,0x57c43},
+{0x1f6b,0x582c3},
+{0x1f6c,0x57a83},
+{0x1f6d,0x58103},
+{0x1f6e,0x57e03},
+{0x1f6f,0x58483},
+{0x1f70,0x53502},
+{0x1f71,0x53422},
+{0x1f72,0x53f82},
+{0x1f73,0x53f02},
+{0x1f74,0x55022},
+{0x1f75,0x54f42},
+{0x1f76,0x559a2},
+{0x1f77,0x55922},
+{0x1f78,0x567e2},
+{0x1f79,0x56762},
+{0x1f7a,0x57342},
+{0x1f7b,0x57282},
+{0x1f7c,0x58782},
+{0x1f7d,0x586a2},
+{0x1f80,0x52ce3},
+{0x1f81,0x53363},
+{0x1f82,0x52a24},
+{0x1f83,0x530a4},
+{0x1f84,0x52864},
+{0x1f85,0x52ee4},
+{0x1f86,0x52be4},
+{0x1f87,0x53264},
+{0x1f88,0x52d43},
+{0x1f89,0x533c3},
+{0x1f8a,0x52aa4},
+{0x1f8b,0x53124},
+{0x1f8c,0x528e4},
+{0x1f8d,0x52f64},
+{0x1f8e,0x52c64},
+{0x1f8f,0x532e4},
+{0x1f90,0x54803},
+{0x1f91,0x54e83},
+{0x1f92,0x54544},
+{0x1f93,0x54bc4},
+{0x1f94,0x54384},
+{0x1f95,0x54a04},
+{0x1f96,0x54704},
+{0x1f97,0x54d84},
+{0x1f98,0x54863},
+{0x1f99,0x54ee3},
+{0x1f9a,0x545c4},
+{0x1f9b,0x54c44},
+{0x1f9c,0x54404},
+{0x1f9d,0x54a84},
+{0x1f9e,0x54784},
+{0x1f9f,0x54e04},
+{0x1fa0,0x57f63},
+{0x1fa1,0x585e3},
+{0x1fa2,0x57ca4},
+{0x1fa3,0x58324},
+{0x1fa4,0x57ae4},
+{0x1fa5,0x58164},
+{0x1fa6,0x57e64},
+{0x1fa7,0x584e4},
+{0x1fa8,0x57fc3},
+{0x1fa9,0x58643},
+{0x1faa,0x57d24},
+{0x1fab,0x583a4},
+{0x1fac,0x57b64},
+{0x1fad,0x581e4},
+{0x1fae,0x57ee4},
+{0x1faf,0x58564},
+{0x1fb0,0x535e2},
+{0x1fb1,0x53702},
+{0x1fb2,0x53583},
+{0x1fb3,0x53782},
+{0x1fb4,0x534a3},
+{0x1fb6,0x53662},
+{0x1fb7,0x536a3},
+{0x1fb8,0x53622},
+{0x1fb9,0x53742},
+{0x1fba,0x53542},
+{0x1fbb,0x53462},
+{0x1fbc,0x537c2},
+{0x1fbd,0x38c1},
+{0x1fbe,0x55301},
+{0x1fbf,0x38c1},
+{0x1fc0,0x38e1},
+{0x1fc1,0x3902},
+{0x1fc2,0x550a3},
+{0x1fc3,0x551a2},
+{0x1fc4,0x54fc3},
+{0x1fc6,0x55102},
+{0x1fc7,0x55143},
+{0x1fc8,0x53fc2},
+{0x1fc9,0x53f42},
+{0x1fca,0x55062},
+{0x1fcb,0x54f82},
+{0x1fcc,0x551e2},
+{0x1fcd,0x3942},
+{0x1fce,0x3982},
+{0x1fcf,0x39c2},
+{0x1fd0,0x55a22},
+{0x1fd1,0x55c82},
+{0x1fd2,0x55bc3},
+{0x1fd3,0x55b63},
+{0x1fd6,0x55aa2},
+{0x1fd7,0x55c23},
+{0x1fd8,0x55a62},
+{0x1fd9,0x55cc2},
+{0x1fda,0x559e2},
+{0x1fdb,0x55962},
+{0x1fdd,0x3a02},
+{0x1fde,0x3a42},
+{0x1fdf,0x3a82},
+{0x1fe0,0x573c2},
+{0x1fe1,0x57662},
+{0x1fe2,0x575a3},
+{0x1fe3,0x57543},
+{0x1fe4,0x56aa2},
+{0x1fe5,0x56ae2},
+{0x1fe6,0x57442},
+{0x1fe7,0x57603},
+{0x1fe8,0x57402},
+{0x1fe9,0x576a2},
+{0x1fea,0x57382},
+{0x1feb,0x572c2},
+{0x1fec,0x56b22},
+{0x1fed,0x3ac2},
+{0x1fee,0xe82},
+{0x1fef,0x421},
+{0x1ff2,0x58803},
+{0x1ff3,0x58902},
+{0x1ff4,0x58723},
+{0x1ff6,0x58862},
+{0x1ff7,0x588a3},
+{0x1ff8,0x56822},
+{0x1ff9,0x567a2},
+{0x1ffa,0x587c2},
+{0x1ffb,0x586e2},
+{0x1ffc,0x58942},
+{0x1ffd,0x661},
+{0x1ffe,0x3b01},
+{0x2000,0x29e1},
+{0x2001,0x29e1},
+{0x2002,0x29e1},
+{0x2003,0x29e1},
+{0x2004,0x29e1},
+{0x2005,0x29e1},
+{0x2006,0x29e1},
+{0x2007,0x4e1},
+{0x2008,0x29e1},
+{0x2009,0x29e1},
+{0x200a,0x29e1},
+{0x200b,0x1},
+{0x200c,0x1},
+{0x200d,0x1},
+{0x200e,0x1},
+{0x200f,0x1},
+{0x2010,0x3b21},
+{0x2011,0x3b41},
+{0x2012,0x3b61},
+{0x2013,0x3b81},
+{0x2014,0x3ba1},
+{0x2015,0x3bc1},
+{0x2016,0x3be1},
+{0x2017,0x3c01},
+{0x2018,0x3c21},
+{0x2019,0x3c41},
+{0x201a,0x3c61},
+{0x201b,0x3c81},
+{0x201c,0x3ca1},
+{0x201d,0x3cc1},
+{0x201e,0x3ce1},
+{0x201f,0x3d01},
+{0x2020,0x3d21},
+{0x2021,0x3d41},
+{0x2022,0x3d61},
+{0x2023,0x3d81},
+{0x2024,0x3da1},
+{0x2025,0x3dc2},
+{0x2026,0x3e03},
+{0x2027,0x3e61},
+{0x2028,0x3e81},
+{0x2029,0x3ea1},
+{0x202a,0x1},
+{0x202b,0x1},
+{0x202c,0x1},
+{0x202d,0x1},
+{0x202e,0x1},
+{0x202f,0x4e1},
+{0x2030,0x3ec1},
+{0x2031,0x3ee1},
+{0x2032,0x3f01},
+{0x2033,0x3f22},
+{0x2034,0x3f63},
+{0x2035,0x3fc1},
+{0x2036,0x3fe2},
+{0x2037,0x4023},
+{0x2038,0x4081},
+{0x2039,0x40a1},
+{0x203a,0x40c1},
+{0x203b,0x40e1},
+{0x203c,0x4102},
+{0x203d,0x4141},
+{0x203e,0x4161},
+{0x203f,0x4181},
+{0x2040,0x41a1},
+{0x2041,0x41c1},
+{0x2042,0x41e1},
+{0x2043,0x4201},
+{0x2044,0x4221},
+{0x2045,0x4241},
+{0x2046,0x4261},
+{0x2047,0x4282},
+{0x2048,0x42c2},
+{0x2049,0x4302},
+{0x204a,0x4341},
+{0x204b,0x4361},
+{0x204c,0x4381},
+{0x204d,0x43a1},
+{0x204e,0x43c1},
+{0x204f,0x43e1},
+{0x2050,0x4401},
+{0x2051,0x4421},
+{0x2052,0x4441},
+{0x2053,0x4461},
+{0x2054,0x4481},
+{0x2055,0x44a1},
+{0x2056,0x44c1},
+{0x2057,0x44e4},
+{0x2058,0x4561},
+{0x2059,0x4581},
+{0x205a,0x45a1},
+{0x205b,0x45c1},
+{0x205c,0x45e1},
+{0x205d,0x4601},
+{0x205e,0x4621},
+{0x205f,0x29e1},
+{0x2060,0x1},
+{0x2061,0x1},
+{0x2062,0x1},
+{0x2063,0x1},
+{0x2064,0x1},
+{0x2066,0x1},
+{0x2067,0x1},
+{0x2068,0x1},
+{0x2069,0x1},
+{0x206a,0x1},
+{0x206b,0x1},
+{0x206c,0x1},
+{0x206d,0x1},
+{0x206e,0x1},
+{0x206f,0x1},
+{0x2070,0x381e1},
+{0x2071,0x44181},
+{0x2074,0x3b7c1},
+{0x2075,0x3bd81},
+{0x2076,0x3c161},
+{0x2077,0x3c481},
+{0x2078,0x3c801},
+{0x2079,0x3cb21},
+{0x207a,0x4641},
+{0x207b,0x4661},
+{0x207c,0x4681},
+{0x207d,0x46a1},
+{0x207e,0x46c1},
+{0x207f,0x47cc1},
+{0x2080,0x38201},
+{0x2081,0x38481},
+{0x2082,0x3a1e1},
+{0x2083,0x3b061},
+{0x2084,0x3b7e1},
+{0x2085,0x3bda1},
+{0x2086,0x3c181},
+{0x2087,0x3c4a1},
+{0x2088,0x3c821},
+{0x2089,0x3cb41},
+{0x208a,0x46e1},
+{0x208b,0x4701},
+{0x208c,0x4721},
+{0x208d,0x4741},
+{0x208e,0x4761},
+{0x2090,0x3ce81},
+{0x2091,0x40ee1},
+{0x2092,0x48a21},
+{0x2093,0x50941},
+{0x2094,0x42041},
+{0x2095,0x43701},
+{0x2096,0x45621},
+{0x2097,0x46201},
+{0x2098,0x470a1},
+{0x2099,0x47ce1},
+{0x209a,0x4aae1},
+{0x209b,0x4c6a1},
+{0x209c,0x4d5a1},
+{0x20a0,0x37ce1},
+{0x20a1,0x37d01},
+{0x20a2,0x37d21},
+{0x20a3,0x37d41},
+{0x20a4,0x37d61},
+{0x20a5,0x37d81},
+{0x20a6,0x37da1},
+{0x20a7,0x37dc1},
+{0x20a8,0x4bf42},
+{0x20a9,0x37de1},
+{0x20aa,0x37e21},
+{0x20ab,0x37e41},
+{0x20ac,0x37e61},
+{0x20ad,0x37e81},
+{0x20ae,0x37ea1},
+{0x20af,0x37ec1},
+{0x20b0,0x37ee1},
+{0x20b1,0x37f01},
+{0x20b2,0x37f21},
+{0x20b3,0x37f41},
+{0x20b4,0x37f61},
+{0x20b5,0x37f81},
+{0x20b6,0x37fa1},
+{0x20b7,0x37fc1},
+{0x20b8,0x37fe1},
+{0x20b9,0x38001},
+{0x20ba,0x38021},
+{0x20bb,0x38041},
+{0x20bc,0x38061},
+{0x20bd,0x38081},
+{0x20be,0x380a1},
+{0x20d0,0x37481},
+{0x20d1,0x374a1},
+{0x20d2,0x374c1},
+{0x20d3,0x374c1},
+{0x20d4,0x374e1},
+{0x20d5,0x37501},
+{0x20d6,0x37521},
+{0x20d7,0x37541},
+{0x20d8,0x35741},
+{0x20d9,0x35741},
+{0x20da,0x35741},
+{0x20db,0x37561},
+{0x20dc,0x37581},
+{0x20dd,0x35761},
+{0x20de,0x35761},
+{0x20df,0x35761},
+{0x20e0,0x35761},
+{0x20e1,0x375a1},
+{0x20e2,0x35761},
+{0x20e3,0x35761},
+{0x20e4,0x35761},
+{0x20e5,0x35741},
+{0x20e6,0x375c1},
+{0x20e7,0x375e1},
+{0x20e8,0x37601},
+{0x20e9,0x37621},
+{0x20ea,0x35741},
+{0x20eb,0x35741},
+{0x20ec,0x35721},
+{0x20ed,0x35721},
+{0x20ee,0x35721},
+{0x20ef,0x35721},
+{0x20f0,0x35701},
+{0x2100,0x3e203},
+{0x2101,0x3e6e3},
+{0x2102,0x3f541},
+{0x2103,0x3f482},
+{0x2104,0x4781},
+{0x2105,0x3fc23},
+{0x2106,0x3fd63},
+{0x2107,0x420c1},
+{0x2108,0x47a1},
+{0x2109,0x423e2},
+{0x210a,0x42b01},
+{0x210b,0x436a1},
+{0x210c,0x436a1},
+{0x210d,0x436a1},
+{0x210e,0x435c1},
+{0x210f,0x439c2},
+{0x2110,0x44141},
+{0x2111,0x44141},
+{0x2112,0x461a1},
+{0x2113,0x460a1},
+{0x2114,0x47c1},
+{0x2115,0x47c81},
+{0x2116,0x48442},
+{0x2117,0x47e1},
+{0x2118,0x4801},
+{0x2119,0x4aa81},
+{0x211a,0x4b3e1},
+{0x211b,0x4b721},
+{0x211c,0x4b721},
+{0x211d,0x4b721},
+{0x211e,0x4821},
+{0x211f,0x4841},
+{0x2120,0x4ce82},
+{0x2121,0x4da63},
+{0x2122,0x4db82},
+{0x2123,0x4861},
+{0x2124,0x51681},
+{0x2125,0x4881},
+{0x2126,0x57961},
+{0x2127,0x48a1},
+{0x2128,0x51681},
+{0x2129,0x48c1},
+{0x212a,0x45521},
+{0x212b,0x3d782},
+{0x212c,0x3eea1},
+{0x212d,0x3f541},
+{0x212e,0x48e1},
+{0x212f,0x40da1},
+{0x2130,0x40e81},
+{0x2131,0x42481},
+{0x2132,0x42a01},
+{0x2133,0x47041},
+{0x2134,0x488e1},
+{0x2135,0x5ffe1},
+{0x2136,0x60141},
+{0x2137,0x60201},
+{0x2138,0x60281},
+{0x2139,0x44041},
+{0x213a,0x4901},
+{0x213b,0x42603},
+{0x213c,0x568a1},
+{0x213d,0x53901},
+{0x213e,0x53941},
+{0x213f,0x568e1},
+{0x2140,0x4921},
+{0x2141,0x4941},
+{0x2142,0x4961},
+{0x2143,0x4981},
+{0x2144,0x49a1},
+{0x2145,0x40141},
+{0x2146,0x40041},
+{0x2147,0x40da1},
+{0x2148,0x44041},
+{0x2149,0x45081},
+{0x214a,0x49c1},
+{0x214b,0x49e1},
+{0x214c,0x4a01},
+{0x214d,0x3e743},
+{0x214e,0x429e1},
+{0x214f,0x4a21},
+{0x2150,0x398c3},
+{0x2151,0x39dc3},
+{0x2152,0x388a4},
+{0x2153,0x38ec3},
+{0x2154,0x3a6e3},
+{0x2155,0x393c3},
+{0x2156,0x3a9c3},
+{0x2157,0x3b363},
+{0x2158,0x3b983},
+{0x2159,0x39643},
+{0x215a,0x3be03},
+{0x215b,0x39b43},
+{0x215c,0x3b483},
+{0x215d,0x3be63},
+{0x215e,0x3c503},
+{0x215f,0x384a2},
+{0x2160,0x440c1},
+{0x2161,0x44aa2},
+{0x2162,0x44b43},
+{0x2163,0x44ce2},
+{0x2164,0x4f941},
+{0x2165,0x4fba2},
+{0x2166,0x4fc43},
+{0x2167,0x4fd24},
+{0x2168,0x44d62},
+{0x2169,0x50861},
+{0x216a,0x50ac2},
+{0x216b,0x50b63},
+{0x216c,0x46121},
+{0x216d,0x3f4c1},
+{0x216e,0x400c1},
+{0x216f,0x46fc1},
+{0x2170,0x43fc1},
+{0x2171,0x44a62},
+{0x2172,0x44ae3},
+{0x2173,0x44ca2},
+{0x2174,0x4f841},
+{0x2175,0x4fb62},
+{0x2176,0x4fbe3},
+{0x2177,0x4fca4},
+{0x2178,0x44d22},
+{0x2179,0x50761},
+{0x217a,0x50a82},
+{0x217b,0x50b03},
+{0x217c,0x46021},
+{0x217d,0x3f381},
+{0x217e,0x3ffc1},
+{0x217f,0x46ec1},
+{0x2180,0x4a41},
+{0x2181,0x4a61},
+{0x2182,0x4a81},
+{0x2183,0x3ff21},
+{0x2184,0x3ff01},
+{0x2185,0x3bfe1},
+{0x2186,0x4aa1},
+{0x2187,0x4ac1},
+{0x2188,0x4ae1},
+{0x2189,0x38223},
+{0x218a,0x4b01},
+{0x218b,0x4b21},
+{0x2190,0x4b41},
+{0x2191,0x4b61},
+{0x2192,0x4b81},
+{0x2193,0x4ba1},
+{0x2194,0x4bc1},
+{0x2195,0x4be1},
+{0x2196,0x4c01},
+{0x2197,0x4c21},
+{0x2198,0x4c41},
+{0x2199,0x4c61},
+{0x219a,0x4c82},
+{0x219b,0x4cc2},
+{0x219c,0x4d01},
+{0x219d,0x4d21},
+{0x219e,0x4d41},
+{0x219f,0x4d61},
+{0x21a0,0x4d81},
+{0x21a1,0x4da1},
+{0x21a2,0x4dc1},
+{0x21a3,0x4de1},
+{0x21a4,0x4e01},
+{0x21a5,0x4e21},
+{0x21a6,0x4e41},
+{0x21a7,0x4e61},
+{0x21a8,0x4e81},
+{0x21a9,0x4ea1},
+{0x21aa,0x4ec1},
+{0x21ab,0x4ee1},
+{0x21ac,0x4f01},
+{0x21ad,0x4f21},
+{0x21ae,0x4f42},
+{0x21af,0x4f81},
+{0x21b0,0x4fa1},
+{0x21b1,0x4fc1},
+{0x21b2,0x4fe1},
+{0x21b3,0x5001},
+{0x21b4,0x5021},
+{0x21b5,0x5041},
+{0x21b6,0x5061},
+{0x21b7,0x5081},
+{0x21b8,0x50a1},
+{0x21b9,0x50c1},
+{0x21ba,0x50e1},
+{0x21bb,0x5101},
+{0x21bc,0x5121},
+{0x21bd,0x5141},
+{0x21be,0x5161},
+{0x21bf,0x5181},
+{0x21c0,0x51a1},
+{0x21c1,0x51c1},
+{0x21c2,0x51e1},
+{0x21c3,0x5201},
+{0x21c4,0x5221},
+{0x21c5,0x5241},
+{0x21c6,0x5261},
+{0x21c7,0x5281},
+{0x21c8,0x52a1},
+{0x21c9,0x52c1},
+{0x21ca,0x52e1},
+{0x21cb,0x5301},
+{0x21cc,0x5321},
+{0x21cd,0x5342},
+{0x21ce,0x5382},
+{0x21cf,0x53c2},
+{0x21d0,0x5401},
+{0x21d1,0x5421},
+{0x21d2,0x5441},
+{0x21d3,0x5461},
+{0x21d4,0x5481},
+{0x21d5,0x54a1},
+{0x21d6,0x54c1},
+{0x21d7,0x54e1},
+{0x21d8,0x5501},
+{0x21d9,0x5521},
+{0x21da,0x5541},
+{0x21db,0x5561},
+{0x21dc,0x5581},
+{0x21dd,0x55a1},
+{0x21de,0x55c1},
+{0x21df,0x55e1},
+{0x21e0,0x5601},
+{0x21e1,0x5621},
+{0x21e2,0x5641},
+{0x21e3,0x5661},
+{0x21e4,0x5681},
+{0x21e5,0x56a1},
+{0x21e6,0x56c1},
+{0x21e7,0x56e1},
+{0x21e8,0x5701},
+{0x21e9,0x5721},
+{0x21ea,0x5741},
+{0x21eb,0x5761},
+{0x21ec,0x5781},
+{0x21ed,0x57a1},
+{0x21ee,0x57c1},
+{0x21ef,0x57e1},
+{0x21f0,0x5801},
+{0x21f1,0x5821},
+{0x21f2,0x5841},
+{0x21f3,0x5861},
+{0x21f4,0x5881},
+{0x21f5,0x58a1},
+{0x21f6,0x58c1},
+{0x21f7,0x58e1},
+{0x21f8,0x5901},
+{0x21f9,0x5921},
+{0x21fa,0x5941},
+{0x21fb,0x5961},
+{0x21fc,0x5981},
+{0x21fd,0x59a1},
+{0x21fe,0x59c1},
+{0x21ff,0x59e1},
+{0x2200,0x5a01},
+{0x2201,0x5a21},
+{0x2202,0x5a41},
+{0x2203,0x5a61},
+{0x2204,0x5a82},
+{0x2205,0x5ac1},
+{0x2206,0x5ae1},
+{0x2207,0x5b01},
+{0x2208,0x5b21},
+{0x2209,0x5b42},
+{0x220a,0x5b81},
+{0x220b,0x5ba1},
+{0x220c,0x5bc2},
+{0x220d,0x5c01},
+{0x220e,0x5c21},
+{0x220f,0x5c41},
+{0x2210,0x5c61},
+{0x2211,0x5c81},
+{0x2212,0x5ca1},
+{0x2213,0x5cc1},
+{0x2214,0x5ce1},
+{0x2215,0x5d01},
+{0x2216,0x5d21},
+{0x2217,0x5d41},
+{0x2218,0x5d61},
+{0x2219,0x5d81},
+{0x221a,0x5da1},
+{0x221b,0x5dc1},
+{0x221c,0x5de1},
+{0x221d,0x5e01},
+{0x221e,0x5e21},
+{0x221f,0x5e41},
+{0x2220,0x5e61},
+{0x2221,0x5e81},
+{0x2222,0x5ea1},
+{0x2223,0x5ec1},
+{0x2224,0x5ee2},
+{0x2225,0x5f21},
+{0x2226,0x5f42},
+{0x2227,0x5f81},
+{0x2228,0x5fa1},
+{0x2229,0x5fc1},
+{0x222a,0x5fe1},
+{0x222b,0x6001},
+{0x222c,0x6022},
+{0x222d,0x6063},
+{0x222e,0x60c1},
+{0x222f,0x60e2},
+{0x2230,0x6123},
+{0x2231,0x6181},
+{0x2232,0x61a1},
+{0x2233,0x61c1},
+{0x2234,0x61e1},
+{0x2235,0x6201},
+{0x2236,0x6221},
+{0x2237,0x6241},
+{0x2238,0x6261},
+{0x2239,0x6281},
+{0x223a,0x62a1},
+{0x223b,0x62c1},
+{0x223c,0x62e1},
+{0x223d,0x6301},
+{0x223e,0x6321},
+{0x223f,0x6341},
+{0x2240,0x6361},
+{0x2241,0x6382},
+{0x2242,0x63c1},
+{0x2243,0x63e1},
+{0x2244,0x6402},
+{0x2245,0x6441},
+{0x2246,0x6461},
+{0x2247,0x6482},
+{0x2248,0x64c1},
+{0x2249,0x64e2},
+{0x224a,0x6521},
+{0x224b,0x6541},
+{0x224c,0x6561},
+{0x224d,0x6581},
+{0x224e,0x65a1},
+{0x224f,0x65c1},
+{0x2250,0x65e1},
+{0x2251,0x6601},
+{0x2252,0x6621},
+{0x2253,0x6641},
+{0x2254,0x6661},
+{0x2255,0x6681},
+{0x2256,0x66a1},
+{0x2257,0x66c1},
+{0x2258,0x66e1},
+{0x2259,0x6701},
+{0x225a,0x6721},
+{0x225b,0x6741},
+{0x225c,0x6761},
+{0x225d,0x6781},
+{0x225e,0x67a1},
+{0x225f,0x67c1},
+{0x2260,0x67e2},
+{0x2261,0x6821},
+{0x2262,0x6842},
+{0x2263,0x6881},
+{0x2264,0x68a1},
+{0x2265,0x68c1},
+{0x2266,0x68e1},
+{0x2267,0x6901},
+{0x2268,0x6921},
+{0x2269,0x6941},
+{0x226a,0x6961},
+{0x226b,0x6981},
+{0x226c,0x69a1},
+{0x226d,0x69c2},
+{0x226e,0x6a02},
+{0x226f,0x6a42},
+{0x2270,0x6a82},
+{0x2271,0x6ac2},
+{0x2272,0x6b01},
+{0x2273,0x6b21},
+{0x2274,0x6b42},
+{0x2275,0x6b82},
+{0x2276,0x6bc1},
+{0x2277,0x6be1},
+{0x2278,0x6c02},
+{0x2279,0x6c42},
+{0x227a,0x6c81},
+{0x227b,0x6ca1},
+{0x227c,0x6cc1},
+{0x227d,0x6ce1},
+{0x227e,0x6d01},
+{0x227f,0x6d21},
+{0x2280,0x6d42},
+{0x2281,0x6d82},
+{0x2282,0x6dc1},
+{0x2283,0x6de1},
+{0x2284,0x6e02},
+{0x2285,0x6e42},
+{0x2286,0x6e81},
+{0x2287,0x6ea1},
+{0x2288,0x6ec2},
+{0x2289,0x6f02},
+{0x228a,0x6f41},
+{0x228b,0x6f61},
+{0x228c,0x6f81},
+{0x228d,0x6fa1},
+{0x228e,0x6fc1},
+{0x228f,0x6fe1},
+{0x2290,0x7001},
+{0x2291,0x7021},
+{0x2292,0x7041},
+{0x2293,0x7061},
+{0x2294,0x7081},
+{0x2295,0x70a1},
+{0x2296,0x70c1},
+{0x2297,0x70e1},
+{0x2298,0x7101},
+{0x2299,0x7121},
+{0x229a,0x7141},
+{0x229b,0x7161},
+{0x229c,0x7181},
+{0x229d,0x71a1},
+{0x229e,0x71c1},
+{0x229f,0x71e1},
+{0x22a0,0x7201},
+{0x22a1,0x7221},
+{0x22a2,0x7241},
+{0x22a3,0x7261},
+{0x22a4,0x7281},
+{0x22a5,0x72a1},
+{0x22a6,0x72c1},
+{0x22a7,0x72e1},
+{0x22a8,0x7301},
+{0x22a9,0x7321},
+{0x22aa,0x7341},
+{0x22ab,0x7361},
+{0x22ac,0x7382},
+{0x22ad,0x73c2},
+{0x22ae,0x7402},
+{0x22af,0x7442},
+{0x22b0,0x7481},
+{0x22b1,0x74a1},
+{0x22b2,0x74c1},
+{0x22b3,0x74e1},
+{0x22b4,0x7501},
+{0x22b5,0x7521},
+{0x22b6,0x7541},
+{0x22b7,0x7561},
+{0x22b8,0x7581},
+{0x22b9,0x75a1},
+{0x22ba,0x75c1},
+{0x22bb,0x75e1},
+{0x22bc,0x7601},
+{0x22bd,0x7621},
+{0x22be,0x7641},
+{0x22bf,0x7661},
+{0x22c0,0x7681},
+{0x22c1,0x76a1},
+{0x22c2,0x76c1},
+{0x22c3,0x76e1},
+{0x22c4,0x7701},
+{0x22c5,0x7721},
+{0x22c6,0x7741},
+{0x22c7,0x7761},
+{0x22c8,0x7781},
+{0x22c9,0x77a1},
+{0x22ca,0x77c1},
+{0x22cb,0x77e1},
+{0x22cc,0x7801},
+{0x22cd,0x7821},
+{0x22ce,0x7841},
+{0x22cf,0x7861},
+{0x22d0,0x7881},
+{0x22d1,0x78a1},
+{0x22d2,0x78c1},
+{0x22d3,0x78e1},
+{0x22d4,0x7901},
+{0x22d5,0x7921},
+{0x22d6,0x7941},
+{0x22d7,0x7961},
+{0x22d8,0x7981},
+{0x22d9,0x79a1},
+{0x22da,0x79c1},
+{0x22db,0x79e1},
+{0x22dc,0x7a01},
+{0x22dd,0x7a21},
+{0x22de,0x7a41},
+{0x22df,0x7a61},
+{0x22e0,0x7a82},
+{0x22e1,0x7ac2},
+{0x22e2,0x7b02},
+{0x22e3,0x7b42},
+{0x22e4,0x7b81},
+{0x22e5,0x7ba1},
+{0x22e6,0x7bc1},
+{0x22e7,0x7be1},
+{0x22e8,0x7c01},
+{0x22e9,0x7c21},
+{0x22ea,0x7c42},
+{0x22eb,0x7c82},
+{0x22ec,0x7cc2},
+{0x22ed,0x7d02},
+{0x22ee,0x7d41},
+{0x22ef,0x7d61},
+{0x22f0,0x7d81},
+{0x22f1,0x7da1},
+{0x22f2,0x7dc1},
+{0x22f3,0x7de1},
+{0x22f4,0x7e01},
+{0x22f5,0x7e21},
+{0x22f6,0x7e41},
+{0x22f7,0x7e61},
+{0x22f8,0x7e81},
+{0x22f9,0x7ea1},
+{0x22fa,0x7ec1},
+{0x22fb,0x7ee1},
+{0x22fc,0x7f01},
+{0x22fd,0x7f21},
+{0x22fe,0x7f41},
+{0x22ff,0x7f61},
+{0x2300,0x7f81},
+{0x2301,0x7fa1},
+{0x2302,0x7fc1},
+{0x2303,0x7fe1},
+{0x2304,0x8001},
+{0x2305,0x8021},
+{0x2306,0x8041},
+{0x2307,0x8061},
+{0x2308,0x8081},
+{0x2309,0x80a1},
+{0x230a,0x80c1},
+{0x230b,0x80e1},
+{0x230c,0x8101},
+{0x230d,0x8121},
+{0x230e,0x8141},
+{0x230f,0x8161},
+{0x2310,0x8181},
+{0x2311,0x81a1},
+{0x2312,0x81c1},
+{0x2313,0x81e1},
+{0x2314,0x8201},
+{0x2315,0x8221},
+{0x2316,0x8241},
+{0x2317,0x8261},
+{0x2318,0x8281},
+{0x2319,0x82a1},
+{0x231a,0x82c1},
+{0x231b,0x82e1},
+{0x231c,0x8301},
+{0x231d,0x8321},
+{0x231e,0x8341},
+{0x231f,0x8361},
+{0x2320,0x8381},
+{0x2321,0x83a1},
+{0x2322,0x83c1},
+{0x2323,0x83e1},
+{0x2324,0x8401},
+{0x2325,0x8421},
+{0x2326,0x8441},
+{0x2327,0x8461},
+{0x2328,0x8481},
+{0x2329,0x84a1},
+{0x232a,0x84c1},
+{0x232b,0x84e1},
+{0x232c,0x8501},
+{0x232d,0x8521},
+{0x232e,0x8541},
+{0x232f,0x8561},
+{0x2330,0x8581},
+{0x2331,0x85a1},
+{0x2332,0x85c1},
+{0x2333,0x85e1},
+{0x2334,0x8601},
+{0x2335,0x8621},
+{0x2336,0x8641},
+{0x2337,0x8661},
+{0x2338,0x8681},
+{0x2339,0x86a1},
+{0x233a,0x86c1},
+{0x233b,0x86e1},
+{0x233c,0x8701},
+{0x233d,0x8721},
+{0x233e,0x8741},
+{0x233f,0x8761},
+{0x2340,0x8781},
+{0x2341,0x87a1},
+{0x2342,0x87c1},
+{0x2343,0x87e1},
+{0x2344,0x8801},
+{0x2345,0x8821},
+{0x2346,0x8841},
+{0x2347,0x8861},
+{0x2348,0x8881},
+{0x2349,0x88a1},
+{0x234a,0x88c1},
+{0x234b,0x88e1},
+{0x234c,0x8901},
+{0x234d,0x8921},
+{0x234e,0x8941},
+{0x234f,0x8961},
+{0x2350,0x8981},
+{0x2351,0x89a1},
+{0x2352,0x89c1},
+{0x2353,0x89e1},
+{0x2354,0x8a01},
+{0x2355,0x8a21},
+{0x2356,0x8a41},
+{0x2357,0x8a61},
+{0x2358,0x8a81},
+{0x2359,0x8aa1},
+{0x235a,0x8ac1},
+{0x235b,0x8ae1},
+{0x235c,0x8b01},
+{0x235d,0x8b21},
+{0x235e,0x8b41},
+{0x235f,0x8b61},
+{0x2360,0x8b81},
+{0x2361,0x8ba1},
+{0x2362,0x8bc1},
+{0x2363,0x8be1},
+{0x2364,0x8c01},
+{0x2365,0x8c21},
+{0x2366,0x8c41},
+{0x2367,0x8c61},
+{0x2368,0x8c81},
+{0x2369,0x8ca1},
+{0x236a,0x8cc1},
+{0x236b,0x8ce1},
+{0x236c,0x8d01},
+{0x236d,0x8d21},
+{0x236e,0x8d41},
+{0x236f,0x8d61},
+{0x2370,0x8d81},
+{0x2371,0x8da1},
+{0x2372,0x8dc1},
+{0x2373,0x8de1},
+{0x2374,0x8e01},
+{0x2375,0x8e21},
+{0x2376,0x8e41},
+{0x2377,0x8e61},
+{0x2378,0x8e81},
+{0x2379,0x8ea1},
+{0x237a,0x8ec1},
+{0x237b,0x8ee1},
+{0x237c,0x8f01},
+{0x237d,0x8f21},
+{0x237e,0x8f41},
+{0x237f,0x8f61},
+{0x2380,0x8f81},
+{0x2381,0x8fa1},
+{0x2382,0x8fc1},
+{0x2383,0x8fe1},
+{0x2384,0x9001},
+{0x2385,0x9021},
+{0x2386,0x9041},
+{0x2387,0x9061},
+{0x2388,0x9081},
+{0x2389,0x90a1},
+{0x238a,0x90c1},
+{0x238b,0x90e1},
+{0x238c,0x9101},
+{0x238d,0x9121},
+{0x238e,0x9141},
+{0x238f,0x9161},
+{0x2390,0x9181},
+{0x2391,0x91a1},
+{0x2392,0x91c1},
+{0x2393,0x91e1},
+{0x2394,0x9201},
+{0x2395,0x9221},
+{0x2396,0x9241},
+{0x2397,0x9261},
+{0x2398,0x9281},
+{0x2399,0x92a1},
+{0x239a,0x92c1},
+{0x239b,0x92e1},
+{0x239c,0x9301},
+{0x239d,0x9321},
+{0x239e,0x9341},
+{0x239f,0x9361},
+{0x23a0,0x9381},
+{0x23a1,0x93a1},
+{0x23a2,0x93c1},
+{0x23a3,0x93e1},
+{0x23a4,0x9401},
+{0x23a5,0x9421},
+{0x23a6,0x9441},
+{0x23a7,0x9461},
+{0x23a8,0x9481},
+{0x23a9,0x94a1},
+{0x23aa,0x94c1},
+{0x23ab,0x94e1},
+{0x23ac,0x9501},
+{0x23ad,0x9521},
+{0x23ae,0x9541},
+{0x23af,0x9561},
+{0x23b0,0x9581},
+{0x23b1,0x95a1},
+{0x23b2,0x95c1},
+{0x23b3,0x95e1},
+{0x23b4,0x9601},
+{0x23b5,0x9621},
+{0x23b6,0x9641},
+{0x23b7,0x9661},
+{0x23b8,0x9681},
+{0x23b9,0x96a1},
+{0x23ba,0x96c1},
+{0x23bb,0x96e1},
+{0x23bc,0x9701},
+{0x23bd,0x9721},
+{0x23be,0x9741},
+{0x23bf,0x9761},
+{0x23c0,0x9781},
+{0x23c1,0x97a1},
+{0x23c2,0x97c1},
+{0x23c3,0x97e1},
+{0x23c4,0x9801},
+{0x23c5,0x9821},
+{0x23c6,0x9841},
+{0x23c7,0x9861},
+{0x23c8,0x9881},
+{0x23c9,0x98a1},
+{0x23ca,0x98c1},
+{0x23cb,0x98e1},
+{0x23cc,0x9901},
+{0x23cd,0x9921},
+{0x23ce,0x9941},
+{0x23cf,0x9961},
+{0x23d0,0x9981},
+{0x23d1,0x99a1},
+{0x23d2,0x99c1},
+{0x23d3,0x99e1},
+{0x23d4,0x9a01},
+{0x23d5,0x9a21},
+{0x23d6,0x9a41},
+{0x23d7,0x9a61},
+{0x23d8,0x9a81},
+{0x23d9,0x9aa1},
+{0x23da,0x9ac1},
+{0x23db,0x9ae1},
+{0x23dc,0x9b01},
+{0x23dd,0x9b21},
+{0x23de,0x9b41},
+{0x23df,0x9b61},
+{0x23e0,0x9b81},
+{0x23e1,0x9ba1},
+{0x23e2,0x9bc1},
+{0x23e3,0x9be1},
+{0x23e4,0x9c01},
+{0x23e5,0x9c21},
+{0x23e6,0x9c41},
+{0x23e7,0x9c61},
+{0x23e8,0x9c81},
+{0x23e9,0x9ca1},
+{0x23ea,0x9cc1},
+{0x23eb,0x9ce1},
+{0x23ec,0x9d01},
+{0x23ed,0x9d21},
+{0x23ee,0x9d41},
+{0x23ef,0x9d61},
+{0x23f0,0x9d81},
+{0x23f1,0x9da1},
+{0x23f2,0x9dc1},
+{0x23f3,0x9de1},
+{0x23f4,0x9e01},
+{0x23f5,0x9e21},
+{0x23f6,0x9e41},
+{0x23f7,0x9e61},
+{0x23f8,0x9e81},
+{0x23f9,0x9ea1},
+{0x23fa,0x9ec1},
+{0x2400,0x9ee1},
+{0x2401,0x9f01},
+{0x2402,0x9f21},
+{0x2403,0x9f41},
+{0x2404,0x9f61},
+{0x2405,0x9f81},
+{0x2406,0x9fa1},
+{0x2407,0x9fc1},
+{0x2408,0x9fe1},
+{0x2409,0xa001},
+{0x240a,0xa021},
+{0x240b,0xa041},
+{0x240c,0xa061},
+{0x240d,0xa081},
+{0x240e,0xa0a1},
+{0x240f,0xa0c1},
+{0x2410,0xa0e1},
+{0x2411,0xa101},
+{0x2412,0xa121},
+{0x2413,0xa141},
+{0x2414,0xa161},
+{0x2415,0xa181},
+{0x2416,0xa1a1},
+{0x2417,0xa1c1},
+{0x2418,0xa1e1},
+{0x2419,0xa201},
+{0x241a,0xa221},
+{0x241b,0xa241},
+{0x241c,0xa261},
+{0x241d,0xa281},
+{0x241e,0xa2a1},
+{0x241f,0xa2c1},
+{0x2420,0xa2e1},
+{0x2421,0xa301},
+{0x2422,0xa321},
+{0x2423,0xa341},
+{0x2424,0xa361},
+{0x2425,0xa381},
+{0x2426,0xa3a1},
+{0x2440,0xa3c1},
+{0x2441,0xa3e1},
+{0x2442,0xa401},
+{0x2443,0xa421},
+{0x2444,0xa441},
+{0x2445,0xa461},
+{0x2446,0xa481},
+{0x2447,0xa4a1},
+{0x2448,0xa4c1},
+{0x2449,0xa4e1},
+{0x244a,0xa501},
+{0x2460,0x38441},
+{0x2461,0x3a1a1},
+{0x2462,0x3b021},
+{0x2463,0x3b7a1},
+{0x2464,0x3bd61},
+{0x2465,0x3c141},
+{0x2466,0x3c461},
+{0x2467,0x3c7e1},
+{0x2468,0x3cb01},
+{0x2469,0x385c2},
+{0x246a,0x38862},
+{0x246b,0x38b82},
+{0x246c,0x38e82},
+{0x246d,0x39102},
+{0x246e,0x39382},
+{0x246f,0x39602},
+{0x2470,0x39882},
+{0x2471,0x39b02},
+{0x2472,0x39d82},
+{0x2473,0x3a2e2},
+{0x2474,0x38343},
+{0x2475,0x3a0a3},
+{0x2476,0x3af23},
+{0x2477,0x3b6a3},
+{0x2478,0x3bc63},
+{0x2479,0x3c043},
+{0x247a,0x3c363},
+{0x247b,0x3c6e3},
+{0x247c,0x3ca03},
+{0x247d,0x384e4},
+{0x247e,0x38784},
+{0x247f,0x38aa4},
+{0x2480,0x38da4},
+{0x2481,0x39024},
+{0x2482,0x392a4},
+{0x2483,0x39524},
+{0x2484,0x397a4},
+{0x2485,0x39a24},
+{0x2486,0x39ca4},
+{0x2487,0x3a204},
+{0x2488,0x383a2},
+{0x2489,0x3a102},
+{0x248a,0x3af82},
+{0x248b,0x3b702},
+{0x248c,0x3bcc2},
+{0x248d,0x3c0a2},
+{0x248e,0x3c3c2},
+{0x248f,0x3c742},
+{0x2490,0x3ca62},
+{0x2491,0x38563},
+{0x2492,0x38803},
+{0x2493,0x38b23},
+{0x2494,0x38e23},
+{0x2495,0x390a3},
+{0x2496,0x39323},
+{0x2497,0x395a3},
+{0x2498,0x39823},
+{0x2499,0x39aa3},
+{0x249a,0x39d23},
+{0x249b,0x3a283},
+{0x249c,0x3cce3},
+{0x249d,0x3ed63},
+{0x249e,0x3f3a3},
+{0x249f,0x3ffe3},
+{0x24a0,0x40d43},
+{0x24a1,0x42303},
+{0x24a2,0x42aa3},
+{0x24a3,0x43563},
+{0x24a4,0x43fe3},
+{0x24a5,0x45023},
+{0x24a6,0x45483},
+{0x24a7,0x46043},
+{0x24a8,0x46ee3},
+{0x24a9,0x47b43},
+{0x24aa,0x48883},
+{0x24ab,0x4a943},
+{0x24ac,0x4b2a3},
+{0x24ad,0x4b5e3},
+{0x24ae,0x4c4a3},
+{0x24af,0x4d403},
+{0x24b0,0x4df23},
+{0x24b1,0x4f863},
+{0x24b2,0x500e3},
+{0x24b3,0x50783},
+{0x24b4,0x50d23},
+{0x24b5,0x51543},
+{0x24b6,0x3ce41},
+{0x24b7,0x3eec1},
+{0x24b8,0x3f561},
+{0x24b9,0x40161},
+{0x24ba,0x40ea1},
+{0x24bb,0x424a1},
+{0x24bc,0x42c01},
+{0x24bd,0x436c1},
+{0x24be,0x44161},
+{0x24bf,0x45181},
+{0x24c0,0x455e1},
+{0x24c1,0x461c1},
+{0x24c2,0x47061},
+{0x24c3,0x47ca1},
+{0x24c4,0x489e1},
+{0x24c5,0x4aaa1},
+{0x24c6,0x4b401},
+{0x24c7,0x4b741},
+{0x24c8,0x4c661},
+{0x24c9,0x4d561},
+{0x24ca,0x4e081},
+{0x24cb,0x4f9e1},
+{0x24cc,0x50241},
+{0x24cd,0x50901},
+{0x24ce,0x50e81},
+{0x24cf,0x516a1},
+{0x24d0,0x3cd61},
+{0x24d1,0x3ede1},
+{0x24d2,0x3f421},
+{0x24d3,0x40061},
+{0x24d4,0x40dc1},
+{0x24d5,0x42381},
+{0x24d6,0x42b21},
+{0x24d7,0x435e1},
+{0x24d8,0x44061},
+{0x24d9,0x450a1},
+{0x24da,0x45501},
+{0x24db,0x460c1},
+{0x24dc,0x46f61},
+{0x24dd,0x47bc1},
+{0x24de,0x48901},
+{0x24df,0x4a9c1},
+{0x24e0,0x4b321},
+{0x24e1,0x4b661},
+{0x24e2,0x4c521},
+{0x24e3,0x4d481},
+{0x24e4,0x4dfa1},
+{0x24e5,0x4f8e1},
+{0x24e6,0x50161},
+{0x24e7,0x50801},
+{0x24e8,0x50da1},
+{0x24e9,0x515c1},
+{0x24ea,0x381c1},
+{0x24eb,0x38862},
+{0x24ec,0x38b82},
+{0x24ed,0x38e82},
+{0x24ee,0x39102},
+{0x24ef,0x39382},
+{0x24f0,0x39602},
+{0x24f1,0x39882},
+{0x24f2,0x39b02},
+{0x24f3,0x39d82},
+{0x24f4,0x3a2e2},
+{0x24f5,0x38441},
+{0x24f6,0x3a1a1},
+{0x24f7,0x3b021},
+{0x24f8,0x3b7a1},
+{0x24f9,0x3bd61},
+{0x24fa,0x3c141},
+{0x24fb,0x3c461},
+{0x24fc,0x3c7e1},
+{0x24fd,0x3cb01},
+{0x24fe,0x385c2},
+{0x24ff,0x381c1},
+{0x2500,0xa521},
+{0x2501,0xa541},
+{0x2502,0xa561},
+{0x2503,0xa581},
+{0x2504,0xa5a1},
+{0x2505,0xa5c1},
+{0x2506,0xa5e1},
+{0x2507,0xa601},
+{0x2508,0xa621},
+{0x2509,0xa641},
+{0x250a,0xa661},
+{0x250b,0xa681},
+{0x250c,0xa6a1},
+{0x250d,0xa6c1},
+{0x250e,0xa6e1},
+{0x250f,0xa701},
+{0x2510,0xa721},
+{0x2511,0xa741},
+{0x2512,0xa761},
+{0x2513,0xa781},
+{0x2514,0xa7a1},
+{0x2515,0xa7c1},
+{0x2516,0xa7e1},
+{0x2517,0xa801},
+{0x2518,0xa821},
+{0x2519,0xa841},
+{0x251a,0xa861},
+{0x251b,0xa881},
+{0x251c,0xa8a1},
+{0x251d,0xa8c1},
+{0x251e,0xa8e1},
+{0x251f,0xa901},
+{0x2520,0xa921},
+{0x2521,0xa941},
+{0x2522,0xa961},
+{0x2523,0xa981},
+{0x2524,0xa9a1},
+{0x2525,0xa9c1},
+{0x2526,0xa9e1},
+{0x2527,0xaa01},
+{0x2528,0xaa21},
+{0x2529,0xaa41},
+{0x252a,0xaa61},
+{0x252b,0xaa81},
+{0x252c,0xaaa1},
+{0x252d,0xaac1},
+{0x252e,0xaae1},
+{0x252f,0xab01},
+{0x2530,0xab21},
+{0x2531,0xab41},
+{0x2532,0xab61},
+{0x2533,0xab81},
+{0x2534,0xaba1},
+{0x2535,0xabc1},
+{0x2536,0xabe1},
+{0x2537,0xac01},
+{0x2538,0xac21},
+{0x2539,0xac41},
+{0x253a,0xac61},
+{0x253b,0xac81},
+{0x253c,0xaca1},
+{0x253d,0xacc1},
+{0x253e,0xace1},
+{0x253f,0xad01},
+{0x2540,0xad21},
+{0x2541,0xad41},
+{0x2542,0xad61},
+{0x2543,0xad81},
+{0x2544,0xada1},
+{0x2545,0xadc1},
+{0x2546,0xade1},
+{0x2547,0xae01},
+{0x2548,0xae21},
+{0x2549,0xae41},
+{0x254a,0xae61},
+{0x254b,0xae81},
+{0x254c,0xaea1},
+{0x254d,0xaec1},
+{0x254e,0xaee1},
+{0x254f,0xaf01},
+{0x2550,0xaf21},
+{0x2551,0xaf41},
+{0x2552,0xaf61},
+{0x2553,0xaf81},
+{0x2554,0xafa1},
+{0x2555,0xafc1},
+{0x2556,0xafe1},
+{0x2557,0xb001},
+{0x2558,0xb021},
+{0x2559,0xb041},
+{0x255a,0xb061},
+{0x255b,0xb081},
+{0x255c,0xb0a1},
+{0x255d,0xb0c1},
+{0x255e,0xb0e1},
+{0x255f,0xb101},
+{0x2560,0xb121},
+{0x2561,0xb141},
+{0x2562,0xb161},
+{0x2563,0xb181},
+{0x2564,0xb1a1},
+{0x2565,0xb1c1},
+{0x2566,0xb1e1},
+{0x2567,0xb201},
+{0x2568,0xb221},
+{0x2569,0xb241},
+{0x256a,0xb261},
+{0x256b,0xb281},
+{0x256c,0xb2a1},
+{0x256d,0xb2c1},
+{0x256e,0xb2e1},
+{0x256f,0xb301},
+{0x2570,0xb321},
+{0x2571,0xb341},
+{0x2572,0xb361},
+{0x2573,0xb381},
+{0x2574,0xb3a1},
+{0x2575,0xb3c1},
+{0x2576,0xb3e1},
+{0x2577,0xb401},
+{0x2578,0xb421},
+{0x2579,0xb441},
+{0x257a,0xb461},
+{0x257b,0xb481},
+{0x257c,0xb4a1},
+{0x257d,0xb4c1},
+{0x257e,0xb4e1},
+{0x257f,0xb501},
+{0x2580,0xb521},
+{0x2581,0xb541},
+{0x2582,0xb561},
+{0x2583,0xb581},
+{0x2584,0xb5a1},
+{0x2585,0xb5c1},
+{0x2586,0xb5e1},
+{0x2587,0xb601},
+{0x2588,0xb621},
+{0x2589,0xb641},
+{0x258a,0xb661},
+{0x258b,0xb681},
+{0x258c,0xb6a1},
+{0x258d,0xb6c1},
+{0x258e,0xb6e1},
+{0x258f,0xb701},
+{0x2590,0xb721},
+{0x2591,0xb741},
+{0x2592,0xb761},
+{0x2593,0xb781},
+{0x2594,0xb7a1},
+{0x2595,0xb7c1},
+{0x2596,0xb7e1},
+{0x2597,0xb801},
+{0x2598,0xb821},
+{0x2599,0xb841},
+{0x259a,0xb861},
+{0x259b,0xb881},
+{0x259c,0xb8a1},
+{0x259d,0xb8c1},
+{0x259e,0xb8e1},
+{0x259f,0xb901},
+{0x25a0,0xb921},
+{0x25a1,0xb941},
+{0x25a2,0xb961},
+{0x25a3,0xb981},
+{0x25a4,0xb9a1},
+{0x25a5,0xb9c1},
+{0x25a6,0xb9e1},
+{0x25a7,0xba01},
+{0x25a8,0xba21},
+{0x25a9,0xba41},
+{0x25aa,0xba61},
+{0x25ab,0xba81},
+{0x25ac,0xbaa1},
+{0x25ad,0xbac1},
+{0x25ae,0xbae1},
+{0x25af,0xbb01},
+{0x25b0,0xbb21},
+{0x25b1,0xbb41},
+{0x25b2,0xbb61},
+{0x25b3,0xbb81},
+{0x25b4,0xbba1},
+{0x25b5,0xbbc1},
+{0x25b6,0xbbe1},
+{0x25b7,0xbc01},
+{0x25b8,0xbc21},
+{0x25b9,0xbc41},
+{0x25ba,0xbc61},
+{0x25bb,0xbc81},
+{0x25bc,0xbca1},
+{0x25bd,0xbcc1},
+{0x25be,0xbce1},
+{0x25bf,0xbd01},
+{0x25c0,0xbd21},
+{0x25c1,0xbd41},
+{0x25c2,0xbd61},
+{0x25c3,0xbd81},
+{0x25c4,0xbda1},
+{0x25c5,0xbdc1},
+{0x25c6,0xbde1},
+{0x25c7,0xbe01},
+{0x25c8,0xbe21},
+{0x25c9,0xbe41},
+{0x25ca,0xbe61},
+{0x25cb,0xbe81},
+{0x25cc,0xbea1},
+{0x25cd,0xbec1},
+{0x25ce,0xbee1},
+{0x25cf,0xbf01},
+{0x25d0,0xbf21},
+{0x25d1,0xbf41},
+{0x25d2,0xbf61},
+{0x25d3,0xbf81},
+{0x25d4,0xbfa1},
+{0x25d5,0xbfc1},
+{0x25d6,0xbfe1},
+{0x25d7,0xc001},
+{0x25d8,0xc021},
+{0x25d9,0xc041},
+{0x25da,0xc061},
+{0x25db,0xc081},
+{0x25dc,0xc0a1},
+{0x25dd,0xc0c1},
+{0x25de,0xc0e1},
+{0x25df,0xc101},
+{0x25e0,0xc121},
+{0x25e1,0xc141},
+{0x25e2,0xc161},
+{0x25e3,0xc181},
+{0x25e4,0xc1a1},
+{0x25e5,0xc1c1},
+{0x25e6,0xc1e1},
+{0x25e7,0xc201},
+{0x25e8,0xc221},
+{0x25e9,0xc241},
+{0x25ea,0xc261},
+{0x25eb,0xc281},
+{0x25ec,0xc2a1},
+{0x25ed,0xc2c1},
+{0x25ee,0xc2e1},
+{0x25ef,0xc301},
+{0x25f0,0xc321},
+{0x25f1,0xc341},
+{0x25f2,0xc361},
+{0x25f3,0xc381},
+{0x25f4,0xc3a1},
+{0x25f5,0xc3c1},
+{0x25f6,0xc3e1},
+{0x25f7,0xc401},
+{0x25f8,0xc421},
+{0x25f9,0xc441},
+{0x25fa,0xc461},
+{0x25fb,0xc481},
+{0x25fc,0xc4a1},
+{0x25fd,0xc4c1},
+{0x25fe,0xc4e1},
+{0x25ff,0xc501},
+{0x2600,0xc521},
+{0x2601,0xc541},
+{0x2602,0xc561},
+{0x2603,0xc581},
+{0x2604,0xc5a1},
+{0x2605,0xc5c1},
+{0x2606,0xc5e1},
+{0x2607,0xc601},
+{0x2608,0xc621},
+{0x2609,0xc641},
+{0x260a,0xc661},
+{0x260b,0xc681},
+{0x260c,0xc6a1},
+{0x260d,0xc6c1},
+{0x260e,0xc6e1},
+{0x260f,0xc701},
+{0x2610,0xc721},
+{0x2611,0xc741},
+{0x2612,0xc761},
+{0x2613,0xc781},
+{0x2614,0xc7a1},
+{0x2615,0xc7c1},
+{0x2616,0xc7e1},
+{0x2617,0xc801},
+{0x2618,0xc821},
+{0x2619,0xc841},
+{0x261a,0xc861},
+{0x261b,0xc881},
+{0x261c,0xc8a1},
+{0x261d,0xc8c1},
+{0x261e,0xc8e1},
+{0x261f,0xc901},
+{0x2620,0xc921},
+{0x2621,0xc941},
+{0x2622,0xc961},
+{0x2623,0xc981},
+{0x2624,0xc9a1},
+{0x2625,0xc9c1},
+{0x2626,0xc9e1},
+{0x2627,0xca01},
+{0x2628,0xca21},
+{0x2629,0xca41},
+{0x262a,0xca61},
+{0x262b,0xca81},
+{0x262c,0xcaa1},
+{0x262d,0xcac1},
+{0x262e,0xcae1},
+{0x262f,0xcb01},
+{0x2630,0xcb21},
+{0x2631,0xcb41},
+{0x2632,0xcb61},
+{0x2633,0xcb81},
+{0x2634,0xcba1},
+{0x2635,0xcbc1},
+{0x2636,0xcbe1},
+{0x2637,0xcc01},
+{0x2638,0xcc21},
+{0x2639,0xcc41},
+{0x263a,0xcc61},
+{0x263b,0xcc81},
+{0x263c,0xcca1},
+{0x263d,0xccc1},
+{0x263e,0xcce1},
+{0x263f,0xcd01},
+{0x2640,0xcd21},
+{0x2641,0xcd41},
+{0x2642,0xcd61},
+{0x2643,0xcd81},
+{0x2644,0xcda1},
+{0x2645,0xcdc1},
+{0x2646,0xcde1},
+{0x2647,0xce01},
+{0x2648,0xce21},
+{0x2649,0xce41},
+{0x264a,0xce61},
+{0x264b,0xce81},
+{0x264c,0xcea1},
+{0x264d,0xcec1},
+{0x264e,0xcee1},
+{0x264f,0xcf01},
+{0x2650,0xcf21},
+{0x2651,0xcf41},
+{0x2652,0xcf61},
+{0x2653,0xcf81},
+{0x2654,0xcfa1},
+{0x2655,0xcfc1},
+{0x2656,0xcfe1},
+{0x2657,0xd001},
+{0x2658,0xd021},
+{0x2659,0xd041},
+{0x265a,0xd061},
+{0x265b,0xd081},
+{0x265c,0xd0a1},
+{0x265d,0xd0c1},
+{0x265e,0xd0e1},
+{0x265f,0xd101},
+{0x2660,0xd121},
+{0x2661,0xd141},
+{0x2662,0xd161},
+{0x2663,0xd181},
+{0x2664,0xd1a1},
+{0x2665,0xd1c1},
+{0x2666,0xd1e1},
+{0x2667,0xd201},
+{0x2668,0xd221},
+{0x2669,0xd241},
+{0x266a,0xd261},
+{0x266b,0xd281},
+{0x266c,0xd2a1},
+{0x266d,0xd2c1},
+{0x266e,0xd2e1},
+{0x266f,0xd301},
+{0x2670,0xd321},
+{0x2671,0xd341},
+{0x2672,0xd361},
+{0x2673,0xd381},
+{0x2674,0xd3a1},
+{0x2675,0xd3c1},
+{0x2676,0xd3e1},
+{0x2677,0xd401},
+{0x2678,0xd421},
+{0x2679,0xd441},
+{0x267a,0xd461},
+{0x267b,0xd481},
+{0x267c,0xd4a1},
+{0x267d,0xd4c1},
+{0x267e,0xd4e1},
+{0x267f,0xd501},
+{0x2680,0xd521},
+{0x2681,0xd541},
+{0x2682,0xd561},
+{0x2683,0xd581},
+{0x2684,0xd5a1},
+{0x2685,0xd5c1},
+{0x2686,0xd5e1},
+{0x2687,0xd601},
+{0x2688,0xd621},
+{0x2689,0xd641},
+{0x268a,0xd661},
+{0x268b,0xd681},
+{0x268c,0xd6a1},
+{0x268d,0xd6c1},
+{0x268e,0xd6e1},
+{0x268f,0xd701},
+{0x2690,0xd721},
+{0x2691,0xd741},
+{0x2692,0xd761},
+{0x2693,0xd781},
+{0x2694,0xd7a1},
+{0x2695,0xd7c1},
+{0x2696,0xd7e1},
+{0x2697,0xd801},
+{0x2698,0xd821},
+{0x2699,0xd841},
+{0x269a,0xd861},
+{0x269b,0xd881},
+{0x269c,0xd8a1},
+{0x269d,0xd8c1},
+{0x269e,0xd8e1},
+{0x269f,0xd901},
+{0x26a0,0xd921},
+{0x26a1,0xd941},
+{0x26a2,0xd961},
+{0x26a3,0xd981},
+{0x26a4,0xd9a1},
+{0x26a5,0xd9c1},
+{0x26a6,0xd9e1},
+{0x26a7,0xda01},
+{0x26a8,0xda21},
+{0x26a9,0xda41},
+{0x26aa,0xda61},
+{0x26ab,0xda81},
+{0x26ac,0xdaa1},
+{0x26ad,0xdac1},
+{0x26ae,0xdae1},
+{0x26af,0xdb01},
+{0x26b0,0xdb21},
+{0x26b1,0xdb41},
+{0x26b2,0xdb61},
+{0x26b3,0xdb81},
+{0x26b4,0xdba1},
+{0x26b5,0xdbc1},
+{0x26b6,0xdbe1},
+{0x26b7,0xdc01},
+{0x26b8,0xdc21},
+{0x26b9,0xdc41},
+{0x26ba,0xdc61},
+{0x26bb,0xdc81},
+{0x26bc,0xdca1},
+{0x26bd,0xdcc1},
+{0x26be,0xdce1},
+{0x26bf,0xdd01},
+{0x26c0,0xdd21},
+{0x26c1,0xdd41},
+{0x26c2,0xdd61},
+{0x26c3,0xdd81},
+{0x26c4,0xdda1},
+{0x26c5,0xddc1},
+{0x26c6,0xdde1},
+{0x26c7,0xde01},
+{0x26c8,0xde21},
+{0x26c9,0xde41},
+{0x26ca,0xde61},
+{0x26cb,0xde81},
+{0x26cc,0xdea1},
+{0x26cd,0xdec1},
+{0x26ce,0xdee1},
+{0x26cf,0xdf01},
+{0x26d0,0xdf21},
+{0x26d1,0xdf41},
+{0x26d2,0xdf61},
+{0x26d3,0xdf81},
+{0x26d4,0xdfa1},
+{0x26d5,0xdfc1},
+{0x26d6,0xdfe1},
+{0x26d7,0xe001},
+{0x26d8,0xe021},
+{0x26d9,0xe041},
+{0x26da,0xe061},
+{0x26db,0xe081},
+{0x26dc,0xe0a1},
+{0x26dd,0xe0c1},
+{0x26de,0xe0e1},
+{0x26df,0xe101},
+{0x26e0,0xe121},
+{0x26e1,0xe141},
+{0x26e2,0xe161},
+{0x26e3,0xe181},
+{0x26e4,0xe1a1},
+{0x26e5,0xe1c1},
+{0x26e6,0xe1e1},
+{0x26e7,0xe201},
+{0x26e8,0xe221},
+{0x26e9,0xe241},
+{0x26ea,0xe261},
+{0x26eb,0xe281},
+{0x26ec,0xe2a1},
+{0x26ed,0xe2c1},
+{0x26ee,0xe2e1},
+{0x26ef,0xe301},
+{0x26f0,0xe321},
+{0x26f1,0xe341},
+{0x26f2,0xe361},
+{0x26f3,0xe381},
+{0x26f4,0xe3a1},
+{0x26f5,0xe3c1},
+{0x26f6,0xe3e1},
+{0x26f7,0xe401},
+{0x26f8,0xe421},
+{0x26f9,0xe441},
+{0x26fa,0xe461},
+{0x26fb,0xe481},
+{0x26fc,0xe4a1},
+{0x26fd,0xe4c1},
+{0x26fe,0xe4e1},
+{0x26ff,0xe501},
+{0x2700,0xe521},
+{0x2701,0xe541},
+{0x2702,0xe561},
+{0x2703,0xe581},
+{0x2704,0xe5a1},
+{0x2705,0xe5c1},
+{0x2706,0xe5e1},
+{0x2707,0xe601},
+{0x2708,0xe621},
+{0x2709,0xe641},
+{0x270a,0xe661},
+{0x270b,0xe681},
+{0x270c,0xe6a1},
+{0x270d,0xe6c1},
+{0x270e,0xe6e1},
+{0x270f,0xe701},
+{0x2710,0xe721},
+{0x2711,0xe741},
+{0x2712,0xe761},
+{0x2713,0xe781},
+{0x2714,0xe7a1},
+{0x2715,0xe7c1},
+{0x2716,0xe7e1},
+{0x2717,0xe801},
+{0x2718,0xe821},
+{0x2719,0xe841},
+{0x271a,0xe861},
+{0x271b,0xe881},
+{0x271c,0xe8a1},
+{0x271d,0xe8c1},
+{0x271e,0xe8e1},
+{0x271f,0xe901},
+{0x2720,0xe921},
+{0x2721,0xe941},
+{0x2722,0xe961},
+{0x2723,0xe981},
+{0x2724,0xe9a1},
+{0x2725,0xe9c1},
+{0x2726,0xe9e1},
+{0x2727,0xea01},
+{0x2728,0xea21},
+{0x2729,0xea41},
+{0x272a,0xea61},
+{0x272b,0xea81},
+{0x272c,0xeaa1},
+{0x272d,0xeac1},
+{0x272e,0xeae1},
+{0x272f,0xeb01},
+{0x2730,0xeb21},
+{0x2731,0xeb41},
+{0x2732,0xeb61},
+{0x2733,0xeb81},
+{0x2734,0xeba1},
+{0x2735,0xebc1},
+{0x2736,0xebe1},
+{0x2737,0xec01},
+{0x2738,0xec21},
+{0x2739,0xec41},
+{0x273a,0xec61},
+{0x273b,0xec81},
+{0x273c,0xeca1},
+{0x273d,0xecc1},
+{0x273e,0xece1},
+{0x273f,0xed01},
+{0x2740,0xed21},
+{0x2741,0xed41},
+{0x2742,0xed61},
+{0x2743,0xed81},
+{0x2744,0xeda1},
+{0x2745,0xedc1},
+{0x2746,0xede1},
+{0x2747,0xee01},
+{0x2748,0xee21},
+{0x2749,0xee41},
+{0x274a,0xee61},
+{0x274b,0xee81},
+{0x274c,0xeea1},
+{0x274d,0xeec1},
+{0x274e,0xeee1},
+{0x274f,0xef01},
+{0x2750,0xef21},
+{0x2751,0xef41},
+{0x2752,0xef61},
+{0x2753,0xef81},
+{0x2754,0xefa1},
+{0x2755,0xefc1},
+{0x2756,0xefe1},
+{0x2757,0xf001},
+{0x2758,0xf021},
+{0x2759,0xf041},
+{0x275a,0xf061},
+{0x275b,0xf081},
+{0x275c,0xf0a1},
+{0x275d,0xf0c1},
+{0x275e,0xf0e1},
+{0x275f,0xf101},
+{0x2760,0xf121},
+{0x2761,0xf141},
+{0x2762,0xf161},
+{0x2763,0xf181},
+{0x2764,0xf1a1},
+{0x2765,0xf1c1},
+{0x2766,0xf1e1},
+{0x2767,0xf201},
+{0x2768,0xf221},
+{0x2769,0xf241},
+{0x276a,0xf261},
+{0x276b,0xf281},
+{0x276c,0xf2a1},
+{0x276d,0xf2c1},
+{0x276e,0xf2e1},
+{0x276f,0xf301},
+{0x2770,0xf321},
+{0x2771,0xf341},
+{0x2772,0xf361},
+{0x2773,0xf381},
+{0x2774,0xf3a1},
+{0x2775,0xf3c1},
+{0x2776,0x38441},
+{0x2777,0x3a1a1},
+{0x2778,0x3b021},
+{0x2779,0x3b7a1},
+{0x277a,0x3bd61},
+{0x277b,0x3c141},
+{0x277c,0x3c461},
+{0x277d,0x3c7e1},
+{0x277e,0x3cb01},
+{0x277f,0x385c2},
+{0x2780,0x38441},
+{0x2781,0x3a1a1},
+{0x2782,0x3b021},
+{0x2783,0x3b7a1},
+{0x2784,0x3bd61},
+{0x2785,0x3c141},
+{0x2786,0x3c461},
+{0x2787,0x3c7e1},
+{0x2788,0x3cb01},
+{0x2789,0x385c2},
+{0x278a,0x38441},
+{0x278b,0x3a1a1},
+{0x278c,0x3b021},
+{0x278d,0x3b7a1},
+{0x278e,0x3bd61},
+{0x278f,0x3c141},
+{0x2790,0x3c461},
+{0x2791,0x3c7e1},
+{0x2792,0x3cb01},
+{0x2793,0x385c2},
+{0x2794,0xf3e1},
+{0x2795,0xf401},
+{0x2796,0xf421},
+{0x2797,0xf441},
+{0x2798,0xf461},
+{0x2799,0xf481},
+{0x279a,0xf4a1},
+{0x279b,0xf4c1},
+{0x279c,0xf4e1},
+{0x279d,0xf501},
+{0x279e,0xf521},
+{0x279f,0xf541},
+{0x27a0,0xf561},
+{0x27a1,0xf581},
+{0x27a2,0xf5a1},
+{0x27a3,0xf5c1},
+{0x27a4,0xf5e1},
+{0x27a5,0xf601},
+{0x27a6,0xf621},
+{0x27a7,0xf641},
+{0x27a8,0xf661},
+{0x27a9,0xf681},
+{0x27aa,0xf6a1},
+{0x27ab,0xf6c1},
+{0x27ac,0xf6e1},
+{0x27ad,0xf701},
+{0x27ae,0xf721},
+{0x27af,0xf741},
+{0x27b0,0xf761},
+{0x27b1,0xf781},
+{0x27b2,0xf7a1},
+{0x27b3,0xf7c1},
+{0x27b4,0xf7e1},
+{0x27b5,0xf801},
+{0x27b6,0xf821},
+{0x27b7,0xf841},
+{0x27b8,0xf861},
+{0x27b9,0xf881},
+{0x27ba,0xf8a1},
+{0x27bb,0xf8c1},
+{0x27bc,0xf8e1},
+{0x27bd,0xf901},
+{0x27be,0xf921},
+{0x27bf,0xf941},
+{0x27c0,0xf961},
+{0x27c1,0xf981},
+{0x27c2,0xf9a1},
+{0x27c3,0xf9c1},
+{0x27c4,0xf9e1},
+{0x27c5,0xfa01},
+{0x27c6,0xfa21},
+{0x27c7,0xfa41},
+{0x27c8,0xfa61},
+{0x27c9,0xfa81},
+{0x27ca,0xfaa1},
+{0x27cb,0xfac1},
+{0x27cc,0xfae1},
+{0x27cd,0xfb01},
+{0x27ce,0xfb21},
+{0x27cf,0xfb41},
+{0x27d0,0xfb61},
+{0x27d1,0xfb81},
+{0x27d2,0xfba1},
+{0x27d3,0xfbc1},
+{0x27d4,0xfbe1},
+{0x27d5,0xfc01},
+{0x27d6,0xfc21},
+{0x27d7,0xfc41},
+{0x27d8,0xfc61},
+{0x27d9,0xfc81},
+{0x27da,0xfca1},
+{0x27db,0xfcc1},
+{0x27dc,0xfce1},
+{0x27dd,0xfd01},
+{0x27de,0xfd21},
+{0x27df,0xfd41},
+{0x27e0,0xfd61},
+{0x27e1,0xfd81},
+{0x27e2,0xfda1},
+{0x27e3,0xfdc1},
+{0x27e4,0xfde1},
+{0x27e5,0xfe01},
+{0x27e6,0xfe21},
+{0x27e7,0xfe41},
+{0x27e8,0xfe61},
+{0x27e9,0xfe81},
+{0x27ea,0xfea1},
+{0x27eb,0xfec1},
+{0x27ec,0xfee1},
+{0x27ed,0xff01},
+{0x27ee,0xff21},
+{0x27ef,0xff41},
+{0x27f0,0xff61},
+{0x27f1,0xff81},
+{0x27f2,0xffa1},
+{0x27f3,0xffc1},
+{0x27f4,0xffe1},
+{0x27f5,0x10001},
+{0x27f6,0x10021},
+{0x27f7,0x10041},
+{0x27f8,0x10061},
+{0x27f9,0x10081},
+{0x27fa,0x100a1},
+{0x27fb,0x100c1},
+{0x27fc,0x100e1},
+{0x27fd,0x10101},
+{0x27fe,0x10121},
+{0x27ff,0x10141},
+{0x2800,0x10161},
+{0x2801,0x10181},
+{0x2802,0x101a1},
+{0x2803,0x101c1},
+{0x2804,0x101e1},
+{0x2805,0x10201},
+{0x2806,0x10221},
+{0x2807,0x10241},
+{0x2808,0x10261},
+{0x2809,0x10281},
+{0x280a,0x102a1},
+{0x280b,0x102c1},
+{0x280c,0x102e1},
+{0x280d,0x10301},
+{0x280e,0x10321},
+{0x280f,0x10341},
+{0x2810,0x10361},
+{0x2811,0x10381},
+{0x2812,0x103a1},
+{0x2813,0x103c1},
+{0x2814,0x103e1},
+{0x2815,0x10401},
+{0x2816,0x10421},
+{0x2817,0x10441},
+{0x2818,0x10461},
+{0x2819,0x10481},
+{0x281a,0x104a1},
+{0x281b,0x104c1},
+{0x281c,0x104e1},
+{0x281d,0x10501},
+{0x281e,0x10521},
+{0x281f,0x10541},
+{0x2820,0x10561},
+{0x2821,0x10581},
+{0x2822,0x105a1},
+{0x2823,0x105c1},
+{0x2824,0x105e1},
+{0x2825,0x10601},
+{0x2826,0x10621},
+{0x2827,0x10641},
+{0x2828,0x10661},
+{0x2829,0x10681},
+{0x282a,0x106a1},
+{0x282b,0x106c1},
+{0x282c,0x106e1},
+{0x282d,0x10701},
+{0x282e,0x10721},
+{0x282f,0x10741},
+{0x2830,0x10761},
+{0x2831,0x10781},
+{0x2832,0x107a1},
+{0x2833,0x107c1},
+{0x2834,0x107e1},
+{0x2835,0x10801},
+{0x2836,0x10821},
+{0x2837,0x10841},
+{0x2838,0x10861},
+{0x2839,0x10881},
+{0x283a,0x108a1},
+{0x283b,0x108c1},
+{0x283c,0x108e1},
+{0x283d,0x10901},
+{0x283e,0x10921},
+{0x283f,0x10941},
+{0x2840,0x10961},
+{0x2841,0x10981},
+{0x2842,0x109a1},
+{0x2843,0x109c1},
+{0x2844,0x109e1},
+{0x2845,0x10a01},
+{0x2846,0x10a21},
+{0x2847,0x10a41},
+{0x2848,0x10a61},
+{0x2849,0x10a81},
+{0x284a,0x10aa1},
+{0x284b,0x10ac1},
+{0x284c,0x10ae1},
+{0x284d,0x10b01},
+{0x284e,0x10b21},
+{0x284f,0x10b41},
+{0x2850,0x10b61},
+{0x2851,0x10b81},
+{0x2852,0x10ba1},
+{0x2853,0x10bc1},
+{0x2854,0x10be1},
+{0x2855,0x10c01},
+{0x2856,0x10c21},
+{0x2857,0x10c41},
+{0x2858,0x10c61},
+{0x2859,0x10c81},
+{0x285a,0x10ca1},
+{0x285b,0x10cc1},
+{0x285c,0x10ce1},
+{0x285d,0x10d01},
+{0x285e,0x10d21},
+{0x285f,0x10d41},
+{0x2860,0x10d61},
+{0x2861,0x10d81},
+{0x2862,0x10da1},
+{0x2863,0x10dc1},
+{0x2864,0x10de1},
+{0x2865,0x10e01},
+{0x2866,0x10e21},
+{0x2867,0x10e41},
+{0x2868,0x10e61},
+{0x2869,0x10e81},
+{0x286a,0x10ea1},
+{0x286b,0x10ec1},
+{0x286c,0x10ee1},
+{0x286d,0x10f01},
+{0x286e,0x10f21},
+{0x286f,0x10f41},
+{0x2870,0x10f61},
+{0x2871,0x10f81},
+{0x2872,0x10fa1},
+{0x2873,0x10fc1},
+{0x2874,0x10fe1},
+{0x2875,0x11001},
+{0x2876,0x11021},
+{0x2877,0x11041},
+{0x2878,0x11061},
+{0x2879,0x11081},
+{0x287a,0x110a1},
+{0x287b,0x110c1},
+{0x287c,0x110e1},
+{0x287d,0x11101},
+{0x287e,0x11121},
+{0x287f,0x11141},
+{0x2880,0x11161},
+{0x2881,0x11181},
+{0x2882,0x111a1},
+{0x2883,0x111c1},
+{0x2884,0x111e1},
+{0x2885,0x11201},
+{0x2886,0x11221},
+{0x2887,0x11241},
+{0x2888,0x11261},
+{0x2889,0x11281},
+{0x288a,0x112a1},
+{0x288b,0x112c1},
+{0x288c,0x112e1},
+{0x288d,0x11301},
+{0x288e,0x11321},
+{0x288f,0x11341},
+{0x2890,0x11361},
+{0x2891,0x11381},
+{0x2892,0x113a1},
+{0x2893,0x113c1},
+{0x2894,0x113e1},
+{0x2895,0x11401},
+{0x2896,0x11421},
+{0x2897,0x11441},
+{0x2898,0x11461},
+{0x2899,0x11481},
+{0x289a,0x114a1},
+{0x289b,0x114c1},
+{0x289c,0x114e1},
+{0x289d,0x11501},
+{0x289e,0x11521},
+{0x289f,0x11541},
+{0x28a0,0x11561},
+{0x28a1,0x11581},
+{0x28a2,0x115a1},
+{0x28a3,0x115c1},
+{0x28a4,0x115e1},
+{0x28a5,0x11601},
+{0x28a6,0x11621},
+{0x28a7,0x11641},
+{0x28a8,0x11661},
+{0x28a9,0x11681},
+{0x28aa,0x116a1},
+{0x28ab,0x116c1},
+{0x28ac,0x116e1},
+{0x28ad,0x11701},
+{0x28ae,0x11721},
+{0x28af,0x11741},
+{0x28b0,0x11761},
+{0x28b1,0x11781},
+{0x28b2,0x117a1},
+{0x28b3,0x117c1},
+{0x28b4,0x117e1},
+{0x28b5,0x11801},
+{0x28b6,0x11821},
+{0x28b7,0x11841},
+{0x28b8,0x11861},
+{0x28b9,0x11881},
+{0x28ba,0x118a1},
+{0x28bb,0x118c1},
+{0x28bc,0x118e1},
+{0x28bd,0x11901},
+{0x28be,0x11921},
+{0x28bf,0x11941},
+{0x28c0,0x11961},
+{0x28c1,0x11981},
+{0x28c2,0x119a1},
+{0x28c3,0x119c1},
+{0x28c4,0x119e1},
+{0x28c5,0x11a01},
+{0x28c6,0x11a21},
+{0x28c7,0x11a41},
+{0x28c8,0x11a61},
+{0x28c9,0x11a81},
+{0x28ca,0x11aa1},
+{0x28cb,0x11ac1},
+{0x28cc,0x11ae1},
+{0x28cd,0x11b01},
+{0x28ce,0x11b21},
+{0x28cf,0x11b41},
+{0x28d0,0x11b61},
+{0x28d1,0x11b81},
+{0x28d2,0x11ba1},
+{0x28d3,0x11bc1},
+{0x28d4,0x11be1},
+{0x28d5,0x11c01},
+{0x28d6,0x11c21},
+{0x28d7,0x11c41},
+{0x28d8,0x11c61},
+{0x28d9,0x11c81},
+{0x28da,0x11ca1},
+{0x28db,0x11cc1},
+{0x28dc,0x11ce1},
+{0x28dd,0x11d01},
+{0x28de,0x11d21},
+{0x28df,0x11d41},
+{0x28e0,0x11d61},
+{0x28e1,0x11d81},
+{0x28e2,0x11da1},
+{0x28e3,0x11dc1},
+{0x28e4,0x11de1},
+{0x28e5,0x11e01},
+{0x28e6,0x11e21},
+{0x28e7,0x11e41},
+{0x28e8,0x11e61},
+{0x28e9,0x11e81},
+{0x28ea,0x11ea1},
+{0x28eb,0x11ec1},
+{0x28ec,0x11ee1},
+{0x28ed,0x11f01},
+{0x28ee,0x11f21},
+{0x28ef,0x11f41},
+{0x28f0,0x11f61},
+{0x28f1,0x11f81},
+{0x28f2,0x11fa1},
+{0x28f3,0x11fc1},
+{0x28f4,0x11fe1},
+{0x28f5,0x12001},
+{0x28f6,0x12021},
+{0x28f7,0x12041},
+{0x28f8,0x12061},
+{0x28f9,0x12081},
+{0x28fa,0x120a1},
+{0x28fb,0x120c1},
+{0x28fc,0x120e1},
+{0x28fd,0x12101},
+{0x28fe,0x12121},
+{0x28ff,0x12141},
+{0x2900,0x12161},
+{0x2901,0x12181},
+{0x2902,0x121a1},
+{0x2903,0x121c1},
+{0x2904,0x121e1},
+{0x2905,0x12201},
+{0x2906,0x12221},
+{0x2907,0x12241},
+{0x2908,0x12261},
+{0x2909,0x12281},
+{0x290a,0x122a1},
+{0x290b,0x122c1},
+{0x290c,0x122e1},
+{0x290d,0x12301},
+{0x290e,0x12321},
+{0x290f,0x12341},
+{0x2910,0x12361},
+{0x2911,0x12381},
+{0x2912,0x123a1},
+{0x2913,0x123c1},
+{0x2914,0x123e1},
+{0x2915,0x12401},
+{0x2916,0x12421},
+{0x2917,0x12441},
+{0x2918,0x12461},
+{0x2919,0x12481},
+{0x291a,0x124a1},
+{0x291b,0x124c1},
+{0x291c,0x124e1},
+{0x291d,0x12501},
+{0x291e,0x12521},
+{0x291f,0x12541},
+{0x2920,0x12561},
+{0x2921,0x12581},
+{0x2922,0x125a1},
+{0x2923,0x125c1},
+{0x2924,0x125e1},
+{0x2925,0x12601},
+{0x2926,0x12621},
+{0x2927,0x12641},
+{0x2928,0x12661},
+{0x2929,0x12681},
+{0x292a,0x126a1},
+{0x292b,0x126c1},
+{0x292c,0x126e1},
+{0x292d,0x12701},
+{0x292e,0x12721},
+{0x292f,0x12741},
+{0x2930,0x12761},
+{0x2931,0x12781},
+{0x2932,0x127a1},
+{0x2933,0x127c1},
+{0x2934,0x127e1},
+{0x2935,0x12801},
+{0x2936,0x12821},
+{0x2937,0x12841},
+{0x2938,0x12861},
+{0x2939,0x12881},
+{0x293a,0x128a1},
+{0x293b,0x128c1},
+{0x293c,0x128e1},
+{0x293d,0x12901},
+{0x293e,0x12921},
+{0x293f,0x12941},
+{0x2940,0x12961},
+{0x2941,0x12981},
+{0x2942,0x129a1},
+{0x2943,0x129c1},
+{0x2944,0x129e1},
+{0x2945,0x12a01},
+{0x2946,0x12a21},
+{0x2947,0x12a41},
+{0x2948,0x12a61},
+{0x2949,0x12a81},
+{0x294a,0x12aa1},
+{0x294b,0x12ac1},
+{0x294c,0x12ae1},
+{0x294d,0x12b01},
+{0x294e,0x12b21},
+{0x294f,0x12b41},
+{0x2950,0x12b61},
+{0x2951,0x12b81},
+{0x2952,0x12ba1},
+{0x2953,0x12bc1},
+{0x2954,0x12be1},
+{0x2955,0x12c01},
+{0x2956,0x12c21},
+{0x2957,0x12c41},
+{0x2958,0x12c61},
+{0x2959,0x12c81},
+{0x295a,0x12ca1},
+{0x295b,0x12cc1},
+{0x295c,0x12ce1},
+{0x295d,0x12d01},
+{0x295e,0x12d21},
+{0x295f,0x12d41},
+{0x2960,0x12d61},
+{0x2961,0x12d81},
+{0x2962,0x12da1},
+{0x2963,0x12dc1},
+{0x2964,0x12de1},
+{0x2965,0x12e01},
+{0x2966,0x12e21},
+{0x2967,0x12e41},
+{0x2968,0x12e61},
+{0x2969,0x12e81},
+{0x296a,0x12ea1},
+{0x296b,0x12ec1},
+{0x296c,0x12ee1},
+{0x296d,0x12f01},
+{0x296e,0x12f21},
+{0x296f,0x12f41},
+{0x2970,0x12f61},
+{0x2971,0x12f81},
+{0x2972,0x12fa1},
+{0x2973,0x12fc1},
+{0x2974,0x12fe1},
+{0x2975,0x13001},
+{0x2976,0x13021},
+{0x2977,0x13041},
+{0x2978,0x13061},
+{0x2979,0x13081},
+{0x297a,0x130a1},
+{0x297b,0x130c1},
+{0x297c,0x130e1},
+{0x297d,0x13101},
+{0x297e,0x13121},
+{0x297f,0x13141},
+{0x2980,0x13161},
+{0x2981,0x13181},
+{0x2982,0x131a1},
+{0x2983,0x131c1},
+{0x2984,0x131e1},
+{0x2985,0x13201},
+{0x2986,0x13221},
+{0x2987,0x13241},
+{0x2988,0x13261},
+{0x2989,0x13281},
+{0x298a,0x132a1},
+{0x298b,0x132c1},
+{0x298c,0x132e1},
+{0x298d,0x13301},
+{0x298e,0x13321},
+{0x298f,0x13341},
+{0x2990,0x13361},
+{0x2991,0x13381},
+{0x2992,0x133a1},
+{0x2993,0x133c1},
+{0x2994,0x133e1},
+{0x2995,0x13401},
+{0x2996,0x13421},
+{0x2997,0x13441},
+{0x2998,0x13461},
+{0x2999,0x13481},
+{0x299a,0x134a1},
+{0x299b,0x134c1},
+{0x299c,0x134e1},
+{0x299d,0x13501},
+{0x299e,0x13521},
+{0x299f,0x13541},
+{0x29a0,0x13561},
+{0x29a1,0x13581},
+{0x29a2,0x135a1},
+{0x29a3,0x135c1},
+{0x29a4,0x135e1},
+{0x29a5,0x13601},
+{0x29a6,0x13621},
+{0x29a7,0x13641},
+{0x29a8,0x13661},
+{0x29a9,0x13681},
+{0x29aa,0x136a1},
+{0x29ab,0x136c1},
+{0x29ac,0x136e1},
+{0x29ad,0x13701},
+{0x29ae,0x13721},
+{0x29af,0x13741},
+{0x29b0,0x13761},
+{0x29b1,0x13781},
+{0x29b2,0x137a1},
+{0x29b3,0x137c1},
+{0x29b4,0x137e1},
+{0x29b5,0x13801},
+{0x29b6,0x13821},
+{0x29b7,0x13841},
+{0x29b8,0x13861},
+{0x29b9,0x13881},
+{0x29ba,0x138a1},
+{0x29bb,0x138c1},
+{0x29bc,0x138e1},
+{0x29bd,0x13901},
+{0x29be,0x13921},
+{0x29bf,0x13941},
+{0x29c0,0x13961},
+{0x29c1,0x13981},
+{0x29c2,0x139a1},
+{0x29c3,0x139c1},
+{0x29c4,0x139e1},
+{0x29c5,0x13a01},
+{0x29c6,0x13a21},
+{0x29c7,0x13a41},
+{0x29c8,0x13a61},
+{0x29c9,0x13a81},
+{0x29ca,0x13aa1},
+{0x29cb,0x13ac1},
+{0x29cc,0x13ae1},
+{0x29cd,0x13b01},
+{0x29ce,0x13b21},
+{0x29cf,0x13b41},
+{0x29d0,0x13b61},
+{0x29d1,0x13b81},
+{0x29d2,0x13ba1},
+{0x29d3,0x13bc1},
+{0x29d4,0x13be1},
+{0x29d5,0x13c01},
+{0x29d6,0x13c21},
+{0x29d7,0x13c41},
+{0x29d8,0x13c61},
+{0x29d9,0x13c81},
+{0x29da,0x13ca1},
+{0x29db,0x13cc1},
+{0x29dc,0x13ce1},
+{0x29dd,0x13d01},
+{0x29de,0x13d21},
+{0x29df,0x13d41},
+{0x29e0,0x13d61},
+{0x29e1,0x13d81},
+{0x29e2,0x13da1},
+{0x29e3,0x13dc1},
+{0x29e4,0x13de1},
+{0x29e5,0x13e01},
+{0x29e6,0x13e21},
+{0x29e7,0x13e41},
+{0x29e8,0x13e61},
+{0x29e9,0x13e81},
+{0x29ea,0x13ea1},
+{0x29eb,0x13ec1},
+{0x29ec,0x13ee1},
+{0x29ed,0x13f01},
+{0x29ee,0x13f21},
+{0x29ef,0x13f41},
+{0x29f0,0x13f61},
+{0x29f1,0x13f81},
+{0x29f2,0x13fa1},
+{0x29f3,0x13fc1},
+{0x29f4,0x13fe1},
+{0x29f5,0x14001},
+{0x29f6,0x14021},
+{0x29f7,0x14041},
+{0x29f8,0x14061},
+{0x29f9,0x14081},
+{0x29fa,0x140a1},
+{0x29fb,0x140c1},
+{0x29fc,0x140e1},
+{0x29fd,0x14101},
+{0x29fe,0x14121},
+{0x29ff,0x14141},
+{0x2a00,0x14161},
+{0x2a01,0x14181},
+{0x2a02,0x141a1},
+{0x2a03,0x141c1},
+{0x2a04,0x141e1},
+{0x2a05,0x14201},
+{0x2a06,0x14221},
+{0x2a07,0x14241},
+{0x2a08,0x14261},
+{0x2a09,0x14281},
+{0x2a0a,0x142a1},
+{0x2a0b,0x142c1},
+{0x2a0c,0x142e4},
+{0x2a0d,0x14361},
+{0x2a0e,0x14381},
+{0x2a0f,0x143a1},
+{0x2a10,0x143c1},
+{0x2a11,0x143e1},
+{0x2a12,0x14401},
+{0x2a13,0x14421},
+{0x2a14,0x14441},
+{0x2a15,0x14461},
+{0x2a16,0x14481},
+{0x2a17,0x144a1},
+{0x2a18,0x144c1},
+{0x2a19,0x144e1},
+{0x2a1a,0x14501},
+{0x2a1b,0x14521},
+{0x2a1c,0x14541},
+{0x2a1d,0x14561},
+{0x2a1e,0x14581},
+{0x2a1f,0x145a1},
+{0x2a20,0x145c1},
+{0x2a21,0x145e1},
+{0x2a22,0x14601},
+{0x2a23,0x14621},
+{0x2a24,0x14641},
+{0x2a25,0x14661},
+{0x2a26,0x14681},
+{0x2a27,0x146a1},
+{0x2a28,0x146c1},
+{0x2a29,0x146e1},
+{0x2a2a,0x14701},
+{0x2a2b,0x14721},
+{0x2a2c,0x14741},
+{0x2a2d,0x14761},
+{0x2a2e,0x14781},
+{0x2a2f,0x147a1},
+{0x2a30,0x147c1},
+{0x2a31,0x147e1},
+{0x2a32,0x14801},
+{0x2a33,0x14821},
+{0x2a34,0x14841},
+{0x2a35,0x14861},
+{0x2a36,0x14881},
+{0x2a37,0x148a1},
+{0x2a38,0x148c1},
+{0x2a39,0x148e1},
+{0x2a3a,0x14901},
+{0x2a3b,0x14921},
+{0x2a3c,0x14941},
+{0x2a3d,0x14961},
+{0x2a3e,0x14981},
+{0x2a3f,0x149a1},
+{0x2a40,0x149c1},
+{0x2a41,0x149e1},
+{0x2a42,0x14a01},
+{0x2a43,0x14a21},
+{0x2a44,0x14a41},
+{0x2a45,0x14a61},
+{0x2a46,0x14a81},
+{0x2a47,0x14aa1},
+{0x2a48,0x14ac1},
+{0x2a49,0x14ae1},
+{0x2a4a,0x14b01},
+{0x2a4b,0x14b21},
+{0x2a4c,0x14b41},
+{0x2a4d,0x14b61},
+{0x2a4e,0x14b81},
+{0x2a4f,0x14ba1},
+{0x2a50,0x14bc1},
+{0x2a51,0x14be1},
+{0x2a52,0x14c01},
+{0x2a53,0x14c21},
+{0x2a54,0x14c41},
+{0x2a55,0x14c61},
+{0x2a56,0x14c81},
+{0x2a57,0x14ca1},
+{0x2a58,0x14cc1},
+{0x2a59,0x14ce1},
+{0x2a5a,0x14d01},
+{0x2a5b,0x14d21},
+{0x2a5c,0x14d41},
+{0x2a5d,0x14d61},
+{0x2a5e,0x14d81},
+{0x2a5f,0x14da1},
+{0x2a60,0x14dc1},
+{0x2a61,0x14de1},
+{0x2a62,0x14e01},
+{0x2a63,0x14e21},
+{0x2a64,0x14e41},
+{0x2a65,0x14e61},
+{0x2a66,0x14e81},
+{0x2a67,0x14ea1},
+{0x2a68,0x14ec1},
+{0x2a69,0x14ee1},
+{0x2a6a,0x14f01},
+{0x2a6b,0x14f21},
+{0x2a6c,0x14f41},
+{0x2a6d,0x14f61},
+{0x2a6e,0x14f81},
+{0x2a6f,0x14fa1},
+{0x2a70,0x14fc1},
+{0x2a71,0x14fe1},
+{0x2a72,0x15001},
+{0x2a73,0x15021},
+{0x2a74,0x15043},
+{0x2a75,0x150a2},
+{0x2a76,0x150e3},
+{0x2a77,0x15141},
+{0x2a78,0x15161},
+{0x2a79,0x15181},
+{0x2a7a,0x151a1},
+{0x2a7b,0x151c1},
+{0x2a7c,0x151e1},
+{0x2a7d,0x15201},
+{0x2a7e,0x15221},
+{0x2a7f,0x15241},
+{0x2a80,0x15261},
+{0x2a81,0x15281},
+{0x2a82,0x152a1},
+{0x2a83,0x152c1},
+{0x2a84,0x152e1},
+{0x2a85,0x15301},
+{0x2a86,0x15321},
+{0x2a87,0x15341},
+{0x2a88,0x15361},
+{0x2a89,0x15381},
+{0x2a8a,0x153a1},
+{0x2a8b,0x153c1},
+{0x2a8c,0x153e1},
+{0x2a8d,0x15401},
+{0x2a8e,0x15421},
+{0x2a8f,0x15441},
+{0x2a90,0x15461},
+{0x2a91,0x15481},
+{0x2a92,0x154a1},
+{0x2a93,0x154c1},
+{0x2a94,0x154e1},
+{0x2a95,0x15501},
+{0x2a96,0x15521},
+{0x2a97,0x15541},
+{0x2a98,0x15561},
+{0x2a99,0x15581},
+{0x2a9a,0x155a1},
+{0x2a9b,0x155c1},
+{0x2a9c,0x155e1},
+{0x2a9d,0x15601},
+{0x2a9e,0x15621},
+{0x2a9f,0x15641},
+{0x2aa0,0x15661},
+{0x2aa1,0x15681},
+{0x2aa2,0x156a1},
+{0x2aa3,0x156c1},
+{0x2aa4,0x156e1},
+{0x2aa5,0x15701},
+{0x2aa6,0x15721},
+{0x2aa7,0x15741},
+{0x2aa8,0x15761},
+{0x2aa9,0x15781},
+{0x2aaa,0x157a1},
+{0x2aab,0x157c1},
+{0x2aac,0x157e1},
+{0x2aad,0x15801},
+{0x2aae,0x15821},
+{0x2aaf,0x15841},
+{0x2ab0,0x15861},
+{0x2ab1,0x15881},
+{0x2ab2,0x158a1},
+{0x2ab3,0x158c1},
+{0x2ab4,0x158e1},
+{0x2ab5,0x15901},
+{0x2ab6,0x15921},
+{0x2ab7,0x15941},
+{0x2ab8,0x15961},
+{0x2ab9,0x15981},
+{0x2aba,0x159a1},
+{0x2abb,0x159c1},
+{0x2abc,0x159e1},
+{0x2abd,0x15a01},
+{0x2abe,0x15a21},
+{0x2abf,0x15a41},
+{0x2ac0,0x15a61},
+{0x2ac1,0x15a81},
+{0x2ac2,0x15aa1},
+{0x2ac3,0x15ac1},
+{0x2ac4,0x15ae1},
+{0x2ac5,0x15b01},
+{0x2ac6,0x15b21},
+{0x2ac7,0x15b41},
+{0x2ac8,0x15b61},
+{0x2ac9,0x15b81},
+{0x2aca,0x15ba1},
+{0x2acb,0x15bc1},
+{0x2acc,0x15be1},
+{0x2acd,0x15c01},
+{0x2ace,0x15c21},
+{0x2acf,0x15c41},
+{0x2ad0,0x15c61},
+{0x2ad1,0x15c81},
+{0x2ad2,0x15ca1},
+{0x2ad3,0x15cc1},
+{0x2ad4,0x15ce1},
+{0x2ad5,0x15d01},
+{0x2ad6,0x15d21},
+{0x2ad7,0x15d41},
+{0x2ad8,0x15d61},
+{0x2ad9,0x15d81},
+{0x2ada,0x15da1},
+{0x2adb,0x15dc1},
+{0x2adc,0x15de2},
+{0x2add,0x15e21},
+{0x2ade,0x15e41},
+{0x2adf,0x15e61},
+{0x2ae0,0x15e81},
+{0x2ae1,0x15ea1},
+{0x2ae2,0x15ec1},
+{0x2ae3,0x15ee1},
+{0x2ae4,0x15f01},
+{0x2ae5,0x15f21},
+{0x2ae6,0x15f41},
+{0x2ae7,0x15f61},
+{0x2ae8,0x15f81},
+{0x2ae9,0x15fa1},
+{0x2aea,0x15fc1},
+{0x2aeb,0x15fe1},
+{0x2aec,0x16001},
+{0x2aed,0x16021},
+{0x2aee,0x16041},
+{0x2aef,0x16061},
+{0x2af0,0x16081},
+{0x2af1,0x160a1},
+{0x2af2,0x160c1},
+{0x2af3,0x160e1},
+{0x2af4,0x16101},
+{0x2af5,0x16121},
+{0x2af6,0x16141},
+{0x2af7,0x16161},
+{0x2af8,0x16181},
+{0x2af9,0x161a1},
+{0x2afa,0x161c1},
+{0x2afb,0x161e1},
+{0x2afc,0x16201},
+{0x2afd,0x16221},
+{0x2afe,0x16241},
+{0x2aff,0x16261},
+{0x2b00,0x16281},
+{0x2b01,0x162a1},
+{0x2b02,0x162c1},
+{0x2b03,0x162e1},
+{0x2b04,0x16301},
+{0x2b05,0x16321},
+{0x2b06,0x16341},
+{0x2b07,0x16361},
+{0x2b08,0x16381},
+{0x2b09,0x163a1},
+{0x2b0a,0x163c1},
+{0x2b0b,0x163e1},
+{0x2b0c,0x16401},
+{0x2b0d,0x16421},
+{0x2b0e,0x16441},
+{0x2b0f,0x16461},
+{0x2b10,0x16481},
+{0x2b11,0x164a1},
+{0x2b12,0x164c1},
+{0x2b13,0x164e1},
+{0x2b14,0x16501},
+{0x2b15,0x16521},
+{0x2b16,0x16541},
+{0x2b17,0x16561},
+{0x2b18,0x16581},
+{0x2b19,0x165a1},
+{0x2b1a,0x165c1},
+{0x2b1b,0x165e1},
+{0x2b1c,0x16601},
+{0x2b1d,0x16621},
+{0x2b1e,0x16641},
+{0x2b1f,0x16661},
+{0x2b20,0x16681},
+{0x2b21,0x166a1},
+{0x2b22,0x166c1},
+{0x2b23,0x166e1},
+{0x2b24,0x16701},
+{0x2b25,0x16721},
+{0x2b26,0x16741},
+{0x2b27,0x16761},
+{0x2b28,0x16781},
+{0x2b29,0x167a1},
+{0x2b2a,0x167c1},
+{0x2b2b,0x167e1},
+{0x2b2c,0x16801},
+{0x2b2d,0x16821},
+{0x2b2e,0x16841},
+{0x2b2f,0x16861},
+{0x2b30,0x16881},
+{0x2b31,0x168a1},
+{0x2b32,0x168c1},
+{0x2b33,0x168e1},
+{0x2b34,0x16901},
+{0x2b35,0x16921},
+{0x2b36,0x16941},
+{0x2b37,0x16961},
+{0x2b38,0x16981},
+{0x2b39,0x169a1},
+{0x2b3a,0x169c1},
+{0x2b3b,0x169e1},
+{0x2b3c,0x16a01},
+{0x2b3d,0x16a21},
+{0x2b3e,0x16a41},
+{0x2b3f,0x16a61},
+{0x2b40,0x16a81},
+{0x2b41,0x16aa1},
+{0x2b42,0x16ac1},
+{0x2b43,0x16ae1},
+{0x2b44,0x16b01},
+{0x2b45,0x16b21},
+{0x2b46,0x16b41},
+{0x2b47,0x16b61},
+{0x2b48,0x16b81},
+{0x2b49,0x16ba1},
+{0x2b4a,0x16bc1},
+{0x2b4b,0x16be1},
+{0x2b4c,0x16c01},
+{0x2b4d,0x16c21},
+{0x2b4e,0x16c41},
+{0x2b4f,0x16c61},
+{0x2b50,0x16c81},
+{0x2b51,0x16ca1},
+{0x2b52,0x16cc1},
+{0x2b53,0x16ce1},
+{0x2b54,0x16d01},
+{0x2b55,0x16d21},
+{0x2b56,0x16d41},
+{0x2b57,0x16d61},
+{0x2b58,0x16d81},
+{0x2b59,0x16da1},
+{0x2b5a,0x16dc1},
+{0x2b5b,0x16de1},
+{0x2b5c,0x16e01},
+{0x2b5d,0x16e21},
+{0x2b5e,0x16e41},
+{0x2b5f,0x16e61},
+{0x2b60,0x16e81},
+{0x2b61,0x16ea1},
+{0x2b62,0x16ec1},
+{0x2b63,0x16ee1},
+{0x2b64,0x16f01},
+{0x2b65,0x16f21},
+{0x2b66,0x16f41},
+{0x2b67,0x16f61},
+{0x2b68,0x16f81},
+{0x2b69,0x16fa1},
+{0x2b6a,0x16fc1},
+{0x2b6b,0x16fe1},
+{0x2b6c,0x17001},
+{0x2b6d,0x17021},
+{0x2b6e,0x17041},
+{0x2b6f,0x17061},
+{0x2b70,0x17081},
+{0x2b71,0x170a1},
+{0x2b72,0x170c1},
+{0x2b73,0x170e1},
+{0x2b76,0x17101},
+{0x2b77,0x17121},
+{0x2b78,0x17141},
+{0x2b79,0x17161},
+{0x2b7a,0x17181},
+{0x2b7b,0x171a1},
+{0x2b7c,0x171c1},
+{0x2b7d,0x171e1},
+{0x2b7e,0x17201},
+{0x2b7f,0x17221},
+{0x2b80,0x17241},
+{0x2b81,0x17261},
+{0x2b82,0x17281},
+{0x2b83,0x172a1},
+{0x2b84,0x172c1},
+{0x2b85,0x172e1},
+{0x2b86,0x17301},
+{0x2b87,0x17321},
+{0x2b88,0x17341},
+{0x2b89,0x17361},
+{0x2b8a,0x17381},
+{0x2b8b,0x173a1},
+{0x2b8c,0x173c1},
+{0x2b8d,0x173e1},
+{0x2b8e,0x17401},
+{0x2b8f,0x17421},
+{0x2b90,0x17441},
+{0x2b91,0x17461},
+{0x2b92,0x17481},
+{0x2b93,0x174a1},
+{0x2b94,0x174c1},
+{0x2b95,0x174e1},
+{0x2b98,0x17501},
+{0x2b99,0x17521},
+{0x2b9a,0x17541},
+{0x2b9b,0x17561},
+{0x2b9c,0x17581},
+{0x2b9d,0x175a1},
+{0x2b9e,0x175c1},
+{0x2b9f,0x175e1},
+{0x2ba0,0x17601},
+{0x2ba1,0x17621},
+{0x2ba2,0x17641},
+{0x2ba3,0x17661},
+{0x2ba4,0x17681},
+{0x2ba5,0x176a1},
+{0x2ba6,0x176c1},
+{0x2ba7,0x176e1},
+{0x2ba8,0x17701},
+{0x2ba9,0x17721},
+{0x2baa,0x17741},
+{0x2bab,0x17761},
+{0x2bac,0x17781},
+{0x2bad,0x177a1},
+{0x2bae,0x177c1},
+{0x2baf,0x177e1},
+{0x2bb0,0x17801},
+{0x2bb1,0x17821},
+{0x2bb2,0x17841},
+{0x2bb3,0x17861},
+{0x2bb4,0x17881},
+{0x2bb5,0x178a1},
+{0x2bb6,0x178c1},
+{0x2bb7,0x178e1},
+{0x2bb8,0x17901},
+{0x2bb9,0x17921},
+{0x2bbd,0x17941},
+{0x2bbe,0x17961},
+{0x2bbf,0x17981},
+{0x2bc0,0x179a1},
+{0x2bc1,0x179c1},
+{0x2bc2,0x179e1},
+{0x2bc3,0x17a01},
+{0x2bc4,0x17a21},
+{0x2bc5,0x17a41},
+{0x2bc6,0x17a61},
+{0x2bc7,0x17a81},
+{0x2bc8,0x17aa1},
+{0x2bca,0x17ac1},
+{0x2bcb,0x17ae1},
+{0x2bcc,0x17b01},
+{0x2bcd,0x17b21},
+{0x2bce,0x17b41},
+{0x2bcf,0x17b61},
+{0x2bd0,0x17b81},
+{0x2bd1,0x17ba1},
+{0x2bec,0x17bc1},
+{0x2bed,0x17be1},
+{0x2bee,0x17c01},
+{0x2bef,0x17c21},
+{0x2c00,0x5d3c1},
+{0x2c01,0x5d401},
+{0x2c02,0x5d441},
+{0x2c03,0x5d481},
+{0x2c04,0x5d4c1},
+{0x2c05,0x5d501},
+{0x2c06,0x5d541},
+{0x2c07,0x5d581},
+{0x2c08,0x5d5c1},
+{0x2c09,0x5d601},
+{0x2c0a,0x5d641},
+{0x2c0b,0x5d681},
+{0x2c0c,0x5d6c1},
+{0x2c0d,0x5d701},
+{0x2c0e,0x5d741},
+{0x2c0f,0x5d781},
+{0x2c10,0x5d7c1},
+{0x2c11,0x5d801},
+{0x2c12,0x5d841},
+{0x2c13,0x5d881},
+{0x2c14,0x5d8c1},
+{0x2c15,0x5d901},
+{0x2c16,0x5d941},
+{0x2c17,0x5d981},
+{0x2c18,0x5d9c1},
+{0x2c19,0x5da01},
+{0x2c1a,0x5da41},
+{0x2c1b,0x5da81},
+{0x2c1c,0x5dac1},
+{0x2c1d,0x5db01},
+{0x2c1e,0x5db41},
+{0x2c1f,0x5db81},
+{0x2c20,0x5dbc1},
+{0x2c21,0x5dc01},
+{0x2c22,0x5dc41},
+{0x2c23,0x5dc81},
+{0x2c24,0x5dcc1},
+{0x2c25,0x5dd01},
+{0x2c26,0x5dd41},
+{0x2c27,0x5dd81},
+{0x2c28,0x5ddc1},
+{0x2c29,0x5de01},
+{0x2c2a,0x5de41},
+{0x2c2b,0x5de81},
+{0x2c2c,0x5dec1},
+{0x2c2d,0x5df01},
+{0x2c2e,0x5df41},
+{0x2c30,0x5d3a1},
+{0x2c31,0x5d3e1},
+{0x2c32,0x5d421},
+{0x2c33,0x5d461},
+{0x2c34,0x5d4a1},
+{0x2c35,0x5d4e1},
+{0x2c36,0x5d521},
+{0x2c37,0x5d561},
+{0x2c38,0x5d5a1},
+{0x2c39,0x5d5e1},
+{0x2c3a,0x5d621},
+{0x2c3b,0x5d661},
+{0x2c3c,0x5d6a1},
+{0x2c3d,0x5d6e1},
+{0x2c3e,0x5d721},
+{0x2c3f,0x5d761},
+{0x2c40,0x5d7a1},
+{0x2c41,0x5d7e1},
+{0x2c42,0x5d821},
+{0x2c43,0x5d861},
+{0x2c44,0x5d8a1},
+{0x2c45,0x5d8e1},
+{0x2c46,0x5d921},
+{0x2c47,0x5d961},
+{0x2c48,0x5d9a1},
+{0x2c49,0x5d9e1},
+{0x2c4a,0x5da21},
+{0x2c4b,0x5da61},
+{0x2c4c,0x5daa1},
+{0x2c4d,0x5dae1},
+{0x2c4e,0x5db21},
+{0x2c4f,0x5db61},
+{0x2c50,0x5dba1},
+{0x2c51,0x5dbe1},
+{0x2c52,0x5dc21},
+{0x2c53,0x5dc61},
+{0x2c54,0x5dca1},
+{0x2c55,0x5dce1},
+{0x2c56,0x5dd21},
+{0x2c57,0x5dd61},
+{0x2c58,0x5dda1},
+{0x2c59,0x5dde1},
+{0x2c5a,0x5de21},
+{0x2c5b,0x5de61},
+{0x2c5c,0x5dea1},
+{0x2c5d,0x5dee1},
+{0x2c5e,0x5df21},
+{0x2c60,0x46ba1},
+{0x2c61,0x46b81},
+{0x2c62,0x46be1},
+{0x2c63,0x4b081},
+{0x2c64,0x4c241},
+{0x2c65,0x3ea81},
+{0x2c66,0x4dd21},
+{0x2c67,0x43e61},
+{0x2c68,0x43e41},
+{0x2c69,0x45ec1},
+{0x2c6a,0x45ea1},
+{0x2c6b,0x51c01},
+{0x2c6c,0x51be1},
+{0x2c6d,0x3ec01},
+{0x2c6e,0x47a21},
+{0x2c6f,0x3eb81},
+{0x2c70,0x3eca1},
+{0x2c71,0x4ffa1},
+{0x2c72,0x506e1},
+{0x2c73,0x506c1},
+{0x2c74,0x4ffc1},
+{0x2c75,0x43ea1},
+{0x2c76,0x43e81},
+{0x2c77,0x4b241},
+{0x2c78,0x41f21},
+{0x2c79,0x4c1e1},
+{0x2c7a,0x4a741},
+{0x2c7b,0x41fa1},
+{0x2c7c,0x451c1},
+{0x2c7d,0x4fa41},
+{0x2c7e,0x4d201},
+{0x2c7f,0x51bc1},
+{0x2c80,0x58a81},
+{0x2c81,0x58a61},
+{0x2c82,0x58ac1},
+{0x2c83,0x58aa1},
+{0x2c84,0x58b01},
+{0x2c85,0x58ae1},
+{0x2c86,0x58b41},
+{0x2c87,0x58b21},
+{0x2c88,0x58b81},
+{0x2c89,0x58b61},
+{0x2c8a,0x58c01},
+{0x2c8b,0x58be1},
+{0x2c8c,0x58c41},
+{0x2c8d,0x58c21},
+{0x2c8e,0x58c81},
+{0x2c8f,0x58c61},
+{0x2c90,0x58cc1},
+{0x2c91,0x58ca1},
+{0x2c92,0x58d01},
+{0x2c93,0x58ce1},
+{0x2c94,0x58d41},
+{0x2c95,0x58d21},
+{0x2c96,0x58e21},
+{0x2c97,0x58e01},
+{0x2c98,0x58e61},
+{0x2c99,0x58e41},
+{0x2c9a,0x58ea1},
+{0x2c9b,0x58e81},
+{0x2c9c,0x58f61},
+{0x2c9d,0x58f41},
+{0x2c9e,0x58fa1},
+{0x2c9f,0x58f81},
+{0x2ca0,0x58fe1},
+{0x2ca1,0x58fc1},
+{0x2ca2,0x59021},
+{0x2ca3,0x59001},
+{0x2ca4,0x59061},
+{0x2ca5,0x59041},
+{0x2ca6,0x590a1},
+{0x2ca7,0x59081},
+{0x2ca8,0x590e1},
+{0x2ca9,0x590c1},
+{0x2caa,0x59121},
+{0x2cab,0x59101},
+{0x2cac,0x59161},
+{0x2cad,0x59141},
+{0x2cae,0x591a1},
+{0x2caf,0x59181},
+{0x2cb0,0x591e1},
+{0x2cb1,0x591c1},
+{0x2cb2,0x598a1},
+{0x2cb3,0x59881},
+{0x2cb4,0x598e1},
+{0x2cb5,0x598c1},
+{0x2cb6,0x58bc1},
+{0x2cb7,0x58ba1},
+{0x2cb8,0x58de1},
+{0x2cb9,0x58dc1},
+{0x2cba,0x58ee1},
+{0x2cbb,0x58ec1},
+{0x2cbc,0x58f21},
+{0x2cbd,0x58f01},
+{0x2cbe,0x59221},
+{0x2cbf,0x59201},
+{0x2cc0,0x59261},
+{0x2cc1,0x59241},
+{0x2cc2,0x59321},
+{0x2cc3,0x59301},
+{0x2cc4,0x59361},
+{0x2cc5,0x59341},
+{0x2cc6,0x593a1},
+{0x2cc7,0x59381},
+{0x2cc8,0x594a1},
+{0x2cc9,0x59481},
+{0x2cca,0x59521},
+{0x2ccb,0x59501},
+{0x2ccc,0x59561},
+{0x2ccd,0x59541},
+{0x2cce,0x595a1},
+{0x2ccf,0x59581},
+{0x2cd0,0x595e1},
+{0x2cd1,0x595c1},
+{0x2cd2,0x59621},
+{0x2cd3,0x59601},
+{0x2cd4,0x59661},
+{0x2cd5,0x59641},
+{0x2cd6,0x59721},
+{0x2cd7,0x59701},
+{0x2cd8,0x597a1},
+{0x2cd9,0x59781},
+{0x2cda,0x597e1},
+{0x2cdb,0x597c1},
+{0x2cdc,0x59821},
+{0x2cdd,0x59801},
+{0x2cde,0x59921},
+{0x2cdf,0x59901},
+{0x2ce0,0x59961},
+{0x2ce1,0x59941},
+{0x2ce2,0x599a1},
+{0x2ce3,0x59981},
+{0x2ce4,0x58d63},
+{0x2ce5,0x17c41},
+{0x2ce6,0x17c61},
+{0x2ce7,0x17c81},
+{0x2ce8,0x17ca1},
+{0x2ce9,0x17cc1},
+{0x2cea,0x17ce1},
+{0x2ceb,0x592e1},
+{0x2cec,0x592c1},
+{0x2ced,0x596e1},
+{0x2cee,0x596c1},
+{0x2cef,0x35701},
+{0x2cf0,0x354c1},
+{0x2cf1,0x354a1},
+{0x2cf2,0x59461},
+{0x2cf3,0x59441},
+{0x2cf9,0x17d01},
+{0x2cfa,0x17d21},
+{0x2cfb,0x17d41},
+{0x2cfc,0x17d61},
+{0x2cfd,0x17d81},
+{0x2cfe,0x17da1},
+{0x2cff,0x17dc1},
+{0x2d00,0x5e4e1},
+{0x2d01,0x5e541},
+{0x2d02,0x5e5a1},
+{0x2d03,0x5e601},
+{0x2d04,0x5e661},
+{0x2d05,0x5e6c1},
+{0x2d06,0x5e721},
+{0x2d07,0x5e7e1},
+{0x2d08,0x5e841},
+{0x2d09,0x5e8a1},
+{0x2d0a,0x5e901},
+{0x2d0b,0x5e961},
+{0x2d0c,0x5e9e1},
+{0x2d0d,0x5eaa1},
+{0x2d0e,0x5eb01},
+{0x2d0f,0x5eb61},
+{0x2d10,0x5ebc1},
+{0x2d11,0x5ec21},
+{0x2d12,0x5ec81},
+{0x2d13,0x5ed41},
+{0x2d14,0x5eda1},
+{0x2d15,0x5ee01},
+{0x2d16,0x5ee61},
+{0x2d17,0x5eec1},
+{0x2d18,0x5ef21},
+{0x2d19,0x5ef81},
+{0x2d1a,0x5efe1},
+{0x2d1b,0x5f041},
+{0x2d1c,0x5f0a1},
+{0x2d1d,0x5f101},
+{0x2d1e,0x5f161},
+{0x2d1f,0x5f221},
+{0x2d20,0x5f281},
+{0x2d21,0x5e781},
+{0x2d22,0x5ea41},
+{0x2d23,0x5ece1},
+{0x2d24,0x5f1c1},
+{0x2d25,0x5f2e1},
+{0x2d27,0x5f361},
+{0x2d2d,0x5f421},
+{0x2d30,0x6ef81},
+{0x2d31,0x6efa1},
+{0x2d32,0x6efc1},
+{0x2d33,0x6efe1},
+{0x2d34,0x6f001},
+{0x2d35,0x6f021},
+{0x2d36,0x6f041},
+{0x2d37,0x6f061},
+{0x2d38,0x6f081},
+{0x2d39,0x6f0a1},
+{0x2d3a,0x6f0c1},
+{0x2d3b,0x6f0e1},
+{0x2d3c,0x6f121},
+{0x2d3d,0x6f141},
+{0x2d3e,0x6f161},
+{0x2d3f,0x6f181},
+{0x2d40,0x6f1a1},
+{0x2d41,0x6f1c1},
+{0x2d42,0x6f1e1},
+{0x2d43,0x6f201},
+{0x2d44,0x6f221},
+{0x2d45,0x6f241},
+{0x2d46,0x6f261},
+{0x2d47,0x6f281},
+{0x2d48,0x6f2a1},
+{0x2d49,0x6f2c1},
+{0x2d4a,0x6f2e1},
+{0x2d4b,0x6f301},
+{0x2d4c,0x6f321},
+{0x2d4d,0x6f341},
+{0x2d4e,0x6f361},
+{0x2d4f,0x6f381},
+{0x2d50,0x6f3a1},
+{0x2d51,0x6f3c1},
+{0x2d52,0x6f3e1},
+{0x2d53,0x6f401},
+{0x2d54,0x6f441},
+{0x2d55,0x6f461},
+{0x2d56,0x6f481},
+{0x2d57,0x6f4a1},
+{0x2d58,0x6f4c1},
+{0x2d59,0x6f4e1},
+{0x2d5a,0x6f501},
+{0x2d5b,0x6f521},
+{0x2d5c,0x6f541},
+{0x2d5d,0x6f561},
+{0x2d5e,0x6f581},
+{0x2d5f,0x6f5a1},
+{0x2d60,0x6f5c1},
+{0x2d61,0x6f5e1},
+{0x2d62,0x6f601},
+{0x2d63,0x6f621},
+{0x2d64,0x6f641},
+{0x2d65,0x6f661},
+{0x2d66,0x6f101},
+{0x2d67,0x6f421},
+{0x2d6f,0x6f681},
+{0x2d70,0x17de1},
+{0x2d7f,0x1},
+{0x2d80,0x6f8a1},
+{0x2d81,0x6fb41},
+{0x2d82,0x6fd61},
+{0x2d83,0x6fe81},
+{0x2d84,0x70061},
+{0x2d85,0x70521},
+{0x2d86,0x70741},
+{0x2d87,0x70861},
+{0x2d88,0x70b21},
+{0x2d89,0x70c41},
+{0x2d8a,0x70d61},
+{0x2d8b,0x71381},
+{0x2d8c,0x71761},
+{0x2d8d,0x71941},
+{0x2d8e,0x71a61},
+{0x2d8f,0x71ea1},
+{0x2d90,0x71fc1},
+{0x2d91,0x721c1},
+{0x2d92,0x727c1},
+{0x2d93,0x71d21},
+{0x2d94,0x71d41},
+{0x2d95,0x71d61},
+{0x2d96,0x71d81},
+{0x2da0,0x72841},
+{0x2da1,0x72861},
+{0x2da2,0x72881},
+{0x2da3,0x728a1},
+{0x2da4,0x728c1},
+{0x2da5,0x728e1},
+{0x2da6,0x72901},
+{0x2da8,0x72921},
+{0x2da9,0x72941},
+{0x2daa,0x72961},
+{0x2dab,0x72981},
+{0x2dac,0x729a1},
+{0x2dad,0x729c1},
+{0x2dae,0x729e1},
+{0x2db0,0x72a01},
+{0x2db1,0x72a21},
+{0x2db2,0x72a41},
+{0x2db3,0x72a61},
+{0x2db4,0x72a81},
+{0x2db5,0x72aa1},
+{0x2db6,0x72ac1},
+{0x2db8,0x72ae1},
+{0x2db9,0x72b01},
+{0x2dba,0x72b21},
+{0x2dbb,0x72b41},
+{0x2dbc,0x72b61},
+{0x2dbd,0x72b81},
+{0x2dbe,0x72ba1},
+{0x2dc0,0x72bc1},
+{0x2dc1,0x72be1},
+{0x2dc2,0x72c01},
+{0x2dc3,0x72c21},
+{0x2dc4,0x72c41},
+{0x2dc5,0x72c61},
+{0x2dc6,0x72c81},
+{0x2dc8,0x72ca1},
+{0x2dc9,0x72cc1},
+{0x2dca,0x72ce1},
+{0x2dcb,0x72d01},
+{0x2dcc,0x72d21},
+{0x2dcd,0x72d41},
+{0x2dce,0x72d61},
+{0x2dd0,0x72d81},
+{0x2dd1,0x72da1},
+{0x2dd2,0x72dc1},
+{0x2dd3,0x72de1},
+{0x2dd4,0x72e01},
+{0x2dd5,0x72e21},
+{0x2dd6,0x72e41},
+{0x2dd8,0x72e61},
+{0x2dd9,0x72e81},
+{0x2dda,0x72ea1},
+{0x2ddb,0x72ec1},
+{0x2ddc,0x72ee1},
+{0x2ddd,0x72f01},
+{0x2dde,0x72f21},
+{0x2de0,0x59c41},
+{0x2de1,0x59ca1},
+{0x2de2,0x59d01},
+{0x2de3,0x59f61},
+{0x2de4,0x5a381},
+{0x2de5,0x5a5a1},
+{0x2de6,0x5ad41},
+{0x2de7,0x5afe1},
+{0x2de8,0x5b261},
+{0x2de9,0x5b341},
+{0x2dea,0x5b5c1},
+{0x2deb,0x5b781},
+{0x2dec,0x5b8a1},
+{0x2ded,0x5b981},
+{0x2dee,0x5baa1},
+{0x2def,0x5c021},
+{0x2df0,0x5c361},
+{0x2df1,0x5c4c1},
+{0x2df2,0x5c7e1},
+{0x2df3,0x5c881},
+{0x2df4,0x5d1a1},
+{0x2df5,0x5b9c2},
+{0x2df6,0x599e1},
+{0x2df7,0x5a141},
+{0x2df8,0x5ace1},
+{0x2df9,0x5bf21},
+{0x2dfa,0x5cbc1},
+{0x2dfb,0x5cd21},
+{0x2dfc,0x5cdc1},
+{0x2dfd,0x5cf01},
+{0x2dfe,0x5cfa1},
+{0x2dff,0x5d0c1},
+{0x2e00,0x17e01},
+{0x2e01,0x17e21},
+{0x2e02,0x17e41},
+{0x2e03,0x17e61},
+{0x2e04,0x17e81},
+{0x2e05,0x17ea1},
+{0x2e06,0x17ec1},
+{0x2e07,0x17ee1},
+{0x2e08,0x17f01},
+{0x2e09,0x17f21},
+{0x2e0a,0x17f41},
+{0x2e0b,0x17f61},
+{0x2e0c,0x17f81},
+{0x2e0d,0x17fa1},
+{0x2e0e,0x17fc1},
+{0x2e0f,0x17fe1},
+{0x2e10,0x18001},
+{0x2e11,0x18021},
+{0x2e12,0x18041},
+{0x2e13,0x18061},
+{0x2e14,0x18081},
+{0x2e15,0x180a1},
+{0x2e16,0x180c1},
+{0x2e17,0x180e1},
+{0x2e18,0x18101},
+{0x2e19,0x18121},
+{0x2e1a,0x18141},
+{0x2e1b,0x18161},
+{0x2e1c,0x18181},
+{0x2e1d,0x181a1},
+{0x2e1e,0x181c1},
+{0x2e1f,0x181e1},
+{0x2e20,0x18201},
+{0x2e21,0x18221},
+{0x2e22,0x18241},
+{0x2e23,0x18261},
+{0x2e24,0x18281},
+{0x2e25,0x182a1},
+{0x2e26,0x182c1},
+{0x2e27,0x182e1},
+{0x2e28,0x18301},
+{0x2e29,0x18321},
+{0x2e2a,0x18341},
+{0x2e2b,0x18361},
+{0x2e2c,0x18381},
+{0x2e2d,0x183a1},
+{0x2e2e,0x183c1},
+{0x2e2f,0x5c901},
+{0x2e30,0x183e1},
+{0x2e31,0x18401},
+{0x2e32,0x18421},
+{0x2e33,0x18441},
+{0x2e34,0x18461},
+{0x2e35,0x18481},
+{0x2e36,0x184a1},
+{0x2e37,0x184c1},
+{0x2e38,0x184e1},
+{0x2e39,0x18501},
+{0x2e3a,0x18521},
+{0x2e3b,0x18541},
+{0x2e3c,0x18561},
+{0x2e3d,0x18581},
+{0x2e3e,0x185a1},
+{0x2e3f,0x185c1},
+{0x2e40,0x185e1},
+{0x2e41,0x18601},
+{0x2e42,0x18621},
+{0x2e80,0xe77a3},
+{0x2e81,0xea1c3},
+{0x2e82,0xe7a62},
+{0x2e83,0xe7a22},
+{0x2e84,0xe79c3},
+{0x2e85,0xe8022},
+{0x2e86,0xe8c23},
+{0x2e87,0xe90c3},
+{0x2e88,0xe91e3},
+{0x2e89,0xe9242},
+{0x2e8a,0xe9f43},
+{0x2e8b,0xe9fe3},
+{0x2e8c,0xec323},
+{0x2e8d,0xec383},
+{0x2e8e,0xec463},
+{0x2e8f,0xec4c2},
+{0x2e90,0xec422},
+{0x2e91,0xec503},
+{0x2e92,0xecbe2},
+{0x2e93,0xece62},
+{0x2e94,0xed402},
+{0x2e95,0xed3a3},
+{0x2e96,0xed7e2},
+{0x2e97,0xed783},
+{0x2e98,0xee162},
+{0x2e99,0xeea62},
+{0x2e9b,0xeeea2},
+{0x2e9c,0xef063},
+{0x2e9d,0xef643},
+{0x2e9e,0xf0463},
+{0x2e9f,0xf0642},
+{0x2ea0,0xf0742},
+{0x2ea1,0xf08c2},
+{0x2ea2,0xf0902},
+{0x2ea3,0xf1582},
+{0x2ea4,0xf1b02},
+{0x2ea5,0xf1b43},
+{0x2ea6,0xe7622},
+{0x2ea7,0xf1da3},
+{0x2ea8,0xf1fc2},
+{0x2ea9,0xf2283},
+{0x2eaa,0xf2ae3},
+{0x2eab,0xf3043},
+{0x2eac,0xf35a3},
+{0x2ead,0xf3602},
+{0x2eae,0xf4043},
+{0x2eaf,0xf44e2},
+{0x2eb0,0xf4922},
+{0x2eb1,0xf4ac2},
+{0x2eb2,0xf4a22},
+{0x2eb3,0xf4b03},
+{0x2eb4,0xf4b63},
+{0x2eb5,0xf4a63},
+{0x2eb6,0xf4d03},
+{0x2eb7,0xf4d63},
+{0x2eb8,0xf4dc2},
+{0x2eb9,0xf4fc2},
+{0x2eba,0xf52e2},
+{0x2ebb,0xf5283},
+{0x2ebc,0xf5363},
+{0x2ebd,0xf57c3},
+{0x2ebe,0xf5ae2},
+{0x2ebf,0xf5b23},
+{0x2ec0,0xf5b83},
+{0x2ec1,0xf65a2},
+{0x2ec2,0xf6ba2},
+{0x2ec3,0xf6ee2},
+{0x2ec4,0xf6ea2},
+{0x2ec5,0xf7022},
+{0x2ec6,0xf7062},
+{0x2ec7,0xf70a3},
+{0x2ec8,0xf7502},
+{0x2ec9,0xf7a82},
+{0x2eca,0xf7c03},
+{0x2ecb,0xf7fa2},
+{0x2ecc,0xf8162},
+{0x2ecd,0xf81a3},
+{0x2ece,0xf8203},
+{0x2ecf,0xf8463},
+{0x2ed0,0xf8c42},
+{0x2ed1,0xf8c82},
+{0x2ed2,0xf8cc2},
+{0x2ed3,0xf8d02},
+{0x2ed4,0xf8e42},
+{0x2ed5,0xf8ec3},
+{0x2ed6,0xf8f22},
+{0x2ed7,0xf9363},
+{0x2ed8,0xf9542},
+{0x2ed9,0xf9742},
+{0x2eda,0xf9a02},
+{0x2edb,0xf9a82},
+{0x2edc,0xf9b02},
+{0x2edd,0xf9b42},
+{0x2ede,0xf9bc3},
+{0x2edf,0xf9b82},
+{0x2ee0,0xf9d62},
+{0x2ee1,0xf9de3},
+{0x2ee2,0xfa002},
+{0x2ee3,0xfa083},
+{0x2ee4,0xfa2a3},
+{0x2ee5,0xfa402},
+{0x2ee6,0xfa5c2},
+{0x2ee7,0xfa643},
+{0x2ee8,0xfa7e2},
+{0x2ee9,0xfa8e2},
+{0x2eea,0xfaae2},
+{0x2eeb,0xfada3},
+{0x2eec,0xfae02},
+{0x2eed,0xfae83},
+{0x2eee,0xfaee2},
+{0x2eef,0xfafa3},
+{0x2ef0,0xfb042},
+{0x2ef1,0xfb103},
+{0x2ef2,0xfb163},
+{0x2ef3,0xfb1c2},
+{0x2f00,0xe6fe2},
+{0x2f01,0xe75e2},
+{0x2f02,0xe7762},
+{0x2f03,0xe78c2},
+{0x2f04,0xe7942},
+{0x2f05,0xe7ba2},
+{0x2f06,0xe7c22},
+{0x2f07,0xe7ee2},
+{0x2f08,0xe7fa2},
+{0x2f09,0xe86e2},
+{0x2f0a,0xe8862},
+{0x2f0b,0xe8962},
+{0x2f0c,0xe8be2},
+{0x2f0d,0xe8d82},
+{0x2f0e,0xe8e82},
+{0x2f0f,0xe9082},
+{0x2f10,0xe9162},
+{0x2f11,0xe91a2},
+{0x2f12,0xe9602},
+{0x2f13,0xe9982},
+{0x2f14,0xe9a82},
+{0x2f15,0xe9b02},
+{0x2f16,0xe9b42},
+{0x2f17,0xe9c02},
+{0x2f18,0xe9f02},
+{0x2f19,0xe9fa2},
+{0x2f1a,0xea182},
+{0x2f1b,0xea222},
+{0x2f1c,0xea2a2},
+{0x2f1d,0xea3a2},
+{0x2f1e,0xeaea2},
+{0x2f1f,0xeb0a2},
+{0x2f20,0xeb562},
+{0x2f21,0xeb6a2},
+{0x2f22,0xeb722},
+{0x2f23,0xeb762},
+{0x2f24,0xeb8a2},
+{0x2f25,0xebb62},
+{0x2f26,0xebe62},
+{0x2f27,0xebfa2},
+{0x2f28,0xec222},
+{0x2f29,0xec2e2},
+{0x2f2a,0xec422},
+{0x2f2b,0xec562},
+{0x2f2c,0xec722},
+{0x2f2d,0xec762},
+{0x2f2e,0xeca22},
+{0x2f2f,0xecae2},
+{0x2f30,0xecba2},
+{0x2f31,0xecc62},
+{0x2f32,0xecd62},
+{0x2f33,0xece62},
+{0x2f34,0xecee2},
+{0x2f35,0xed1a2},
+{0x2f36,0xed222},
+{0x2f37,0xed2a2},
+{0x2f38,0xed2e2},
+{0x2f39,0xed362},
+{0x2f3a,0xed482},
+{0x2f3b,0xed582},
+{0x2f3c,0xed742},
+{0x2f3d,0xedf62},
+{0x2f3e,0xee0a2},
+{0x2f3f,0xee0e2},
+{0x2f40,0xee9e2},
+{0x2f41,0xeea22},
+{0x2f42,0xeec22},
+{0x2f43,0xeeca2},
+{0x2f44,0xeed62},
+{0x2f45,0xeede2},
+{0x2f46,0xeee62},
+{0x2f47,0xeef62},
+{0x2f48,0xef402},
+{0x2f49,0xef502},
+{0x2f4a,0xef862},
+{0x2f4b,0xf0222},
+{0x2f4c,0xf02e2},
+{0x2f4d,0xf0422},
+{0x2f4e,0xf0542},
+{0x2f4f,0xf0602},
+{0x2f50,0xf0682},
+{0x2f51,0xf06c2},
+{0x2f52,0xf0702},
+{0x2f53,0xf0782},
+{0x2f54,0xf07c2},
+{0x2f55,0xf1482},
+{0x2f56,0xf1a82},
+{0x2f57,0xf1be2},
+{0x2f58,0xf1c22},
+{0x2f59,0xf1c62},
+{0x2f5a,0xf1ca2},
+{0x2f5b,0xf1d22},
+{0x2f5c,0xf1d62},
+{0x2f5d,0xf1f82},
+{0x2f5e,0xf2182},
+{0x2f5f,0xf2202},
+{0x2f60,0xf2662},
+{0x2f61,0xf26a2},
+{0x2f62,0xf2722},
+{0x2f63,0xf2762},
+{0x2f64,0xf2822},
+{0x2f65,0xf2862},
+{0x2f66,0xf2aa2},
+{0x2f67,0xf2b42},
+{0x2f68,0xf2d02},
+{0x2f69,0xf2d42},
+{0x2f6a,0xf2d82},
+{0x2f6b,0xf2dc2},
+{0x2f6c,0xf3002},
+{0x2f6d,0xf32a2},
+{0x2f6e,0xf32e2},
+{0x2f6f,0xf3322},
+{0x2f70,0xf3562},
+{0x2f71,0xf3c02},
+{0x2f72,0xf3c42},
+{0x2f73,0xf3e42},
+{0x2f74,0xf3f82},
+{0x2f75,0xf4002},
+{0x2f76,0xf4262},
+{0x2f77,0xf44a2},
+{0x2f78,0xf4962},
+{0x2f79,0xf49e2},
+{0x2f7a,0xf4cc2},
+{0x2f7b,0xf4ec2},
+{0x2f7c,0xf4f82},
+{0x2f7d,0xf5042},
+{0x2f7e,0xf5082},
+{0x2f7f,0xf50c2},
+{0x2f80,0xf5242},
+{0x2f81,0xf5322},
+{0x2f82,0xf5542},
+{0x2f83,0xf55c2},
+{0x2f84,0xf56c2},
+{0x2f85,0xf5782},
+{0x2f86,0xf58a2},
+{0x2f87,0xf5922},
+{0x2f88,0xf5962},
+{0x2f89,0xf59a2},
+{0x2f8a,0xf5a22},
+{0x2f8b,0xf5a62},
+{0x2f8c,0xf6562},
+{0x2f8d,0xf66e2},
+{0x2f8e,0xf6a22},
+{0x2f8f,0xf6aa2},
+{0x2f90,0xf6b62},
+{0x2f91,0xf6e62},
+{0x2f92,0xf6fa2},
+{0x2f93,0xf7062},
+{0x2f94,0xf7142},
+{0x2f95,0xf7542},
+{0x2f96,0xf7582},
+{0x2f97,0xf7642},
+{0x2f98,0xf7682},
+{0x2f99,0xf76c2},
+{0x2f9a,0xf7ac2},
+{0x2f9b,0xf7b02},
+{0x2f9c,0xf7bc2},
+{0x2f9d,0xf7d62},
+{0x2f9e,0xf7de2},
+{0x2f9f,0xf7fe2},
+{0x2fa0,0xf80a2},
+{0x2fa1,0xf80e2},
+{0x2fa2,0xf8422},
+{0x2fa3,0xf8682},
+{0x2fa4,0xf8782},
+{0x2fa5,0xf8802},
+{0x2fa6,0xf88c2},
+{0x2fa7,0xf8c82},
+{0x2fa8,0xf8d42},
+{0x2fa9,0xf8e82},
+{0x2faa,0xf9162},
+{0x2fab,0xf9222},
+{0x2fac,0xf9322},
+{0x2fad,0xf9502},
+{0x2fae,0xf95c2},
+{0x2faf,0xf9602},
+{0x2fb0,0xf9642},
+{0x2fb1,0xf9682},
+{0x2fb2,0xf9782},
+{0x2fb3,0xf97c2},
+{0x2fb4,0xf9842},
+{0x2fb5,0xf9a42},
+{0x2fb6,0xf9ac2},
+{0x2fb7,0xf9b42},
+{0x2fb8,0xf9da2},
+{0x2fb9,0xf9e42},
+{0x2fba,0xf9ec2},
+{0x2fbb,0xfa042},
+{0x2fbc,0xfa0e2},
+{0x2fbd,0xfa122},
+{0x2fbe,0xfa1a2},
+{0x2fbf,0xfa1e2},
+{0x2fc0,0xfa222},
+{0x2fc1,0xfa262},
+{0x2fc2,0xfa302},
+{0x2fc3,0xfa442},
+{0x2fc4,0xfa602},
+{0x2fc5,0xfa6e2},
+{0x2fc6,0xfa7a2},
+{0x2fc7,0xfa862},
+{0x2fc8,0xfa8a2},
+{0x2fc9,0xfa922},
+{0x2fca,0xfa9a2},
+{0x2fcb,0xfaa22},
+{0x2fcc,0xfaa62},
+{0x2fcd,0xfab62},
+{0x2fce,0xfabe2},
+{0x2fcf,0xfac62},
+{0x2fd0,0xface2},
+{0x2fd1,0xfad62},
+{0x2fd2,0xfae42},
+{0x2fd3,0xfaf62},
+{0x2fd4,0xfb0c2},
+{0x2fd5,0xfb202},
+{0x2ff0,0x18641},
+{0x2ff1,0x18661},
+{0x2ff2,0x18681},
+{0x2ff3,0x186a1},
+{0x2ff4,0x186c1},
+{0x2ff5,0x186e1},
+{0x2ff6,0x18701},
+{0x2ff7,0x18721},
+{0x2ff8,0x18741},
+{0x2ff9,0x18761},
+{0x2ffa,0x18781},
+{0x2ffb,0x187a1},
+{0x3000,0x187c1},
+{0x3001,0x187e1},
+{0x3002,0x18801},
+{0x3003,0x18821},
+{0x3004,0x18841},
+{0x3005,0x37841},
+{0x3006,0xb3b82},
+{0x3007,0x380c1},
+{0x3008,0x84a1},
+{0x3009,0x84c1},
+{0x300a,0x18861},
+{0x300b,0x18881},
+{0x300c,0x188a1},
+{0x300d,0x188c1},
+{0x300e,0x188e1},
+{0x300f,0x18901},
+{0x3010,0x18921},
+{0x3011,0x18941},
+{0x3012,0x18961},
+{0x3013,0x18981},
+{0x3014,0x189a1},
+{0x3015,0x189c1},
+{0x3016,0x189e1},
+{0x3017,0x18a01},
+{0x3018,0x18a21},
+{0x3019,0x18a41},
+{0x301a,0x18a61},
+{0x301b,0x18a81},
+{0x301c,0x18aa1},
+{0x301d,0x18ac1},
+{0x301e,0x18ae1},
+{0x301f,0x18b01},
+{0x3020,0x18b21},
+{0x3021,0x382e1},
+{0x3022,0x3a041},
+{0x3023,0x3aec1},
+{0x3024,0x3b641},
+{0x3025,0x3bc01},
+{0x3026,0x3bfe1},
+{0x3027,0x3c301},
+{0x3028,0x3c681},
+{0x3029,0x3c9a1},
+{0x302a,0x373c1},
+{0x302b,0x373e1},
+{0x302c,0x37401},
+{0x302d,0x37421},
+{0x302e,0x37441},
+{0x302f,0x37461},
+{0x3030,0x18b41},
+{0x3031,0x37881},
+{0x3032,0x378a2},
+{0x3033,0x378e1},
+{0x3034,0x37902},
+{0x3035,0x37941},
+{0x3036,0x18b61},
+{0x3037,0x18b81},
+{0x3038,0xe9c02},
+{0x3039,0xe9d02},
+{0x303a,0xe9d42},
+{0x303b,0x37861},
+{0x303c,0xb6162},
+{0x303d,0x18ba1},
+{0x303e,0x18bc1},
+{0x303f,0x18be1},
+{0x3041,0xb1cc1},
+{0x3042,0xb1ce1},
+{0x3043,0xb1fc1},
+{0x3044,0xb1fe1},
+{0x3045,0xb21a1},
+{0x3046,0xb21c1},
+{0x3047,0xb2381},
+{0x3048,0xb23a1},
+{0x3049,0xb25a1},
+{0x304a,0xb25c1},
+{0x304b,0xb2761},
+{0x304c,0xb2802},
+{0x304d,0xb2ae1},
+{0x304e,0xb2b62},
+{0x304f,0xb3081},
+{0x3050,0xb3122},
+{0x3051,0xb3441},
+{0x3052,0xb34e2},
+{0x3053,0xb35c1},
+{0x3054,0xb3642},
+{0x3055,0xb3821},
+{0x3056,0xb38c2},
+{0x3057,0xb3a61},
+{0x3058,0xb3b02},
+{0x3059,0xb3c61},
+{0x305a,0xb3d02},
+{0x305b,0xb3d81},
+{0x305c,0xb3e02},
+{0x305d,0xb3f41},
+{0x305e,0xb3fc2},
+{0x305f,0xb4041},
+{0x3060,0xb40c2},
+{0x3061,0xb41c1},
+{0x3062,0xb4242},
+{0x3063,0xb42c1},
+{0x3064,0xb42e1},
+{0x3065,0xb43a2},
+{0x3066,0xb4421},
+{0x3067,0xb44a2},
+{0x3068,0xb45c1},
+{0x3069,0xb4662},
+{0x306a,0xb4781},
+{0x306b,0xb4841},
+{0x306c,0xb48c1},
+{0x306d,0xb4961},
+{0x306e,0xb49e1},
+{0x306f,0xb4ac1},
+{0x3070,0xb4b62},
+{0x3071,0xb4be2},
+{0x3072,0xb4ea1},
+{0x3073,0xb4f42},
+{0x3074,0xb4fc2},
+{0x3075,0xb5241},
+{0x3076,0xb52e2},
+{0x3077,0xb5362},
+{0x3078,0xb5641},
+{0x3079,0xb56e2},
+{0x307a,0xb5762},
+{0x307b,0xb5b61},
+{0x307c,0xb5c02},
+{0x307d,0xb5c82},
+{0x307e,0xb6001},
+{0x307f,0xb6301},
+{0x3080,0xb6501},
+{0x3081,0xb65a1},
+{0x3082,0xb67a1},
+{0x3083,0xb6821},
+{0x3084,0xb6841},
+{0x3085,0xb69e1},
+{0x3086,0xb6a01},
+{0x3087,0xb6b21},
+{0x3088,0xb6b41},
+{0x3089,0xb6c41},
+{0x308a,0xb6ce1},
+{0x308b,0xb6e41},
+{0x308c,0xb7001},
+{0x308d,0xb71a1},
+{0x308e,0xb7241},
+{0x308f,0xb7261},
+{0x3090,0xb73a1},
+{0x3091,0xb7441},
+{0x3092,0xb74e1},
+{0x3093,0xb75a1},
+{0x3094,0xb2282},
+{0x3095,0xb2741},
+{0x3096,0xb3421},
+{0x3099,0x35781},
+{0x309a,0x357c1},
+{0x309b,0x18c01},
+{0x309c,0x18c21},
+{0x309d,0x37961},
+{0x309e,0x37982},
+{0x309f,0xb6c02},
+{0x30a0,0x18c41},
+{0x30a1,0xb1d01},
+{0x30a2,0xb1d41},
+{0x30a3,0xb2001},
+{0x30a4,0xb2041},
+{0x30a5,0xb21e1},
+{0x30a6,0xb2221},
+{0x30a7,0xb23c1},
+{0x30a8,0xb2401},
+{0x30a9,0xb25e1},
+{0x30aa,0xb2621},
+{0x30ab,0xb27a1},
+{0x30ac,0xb2842},
+{0x30ad,0xb2b01},
+{0x30ae,0xb2ba2},
+{0x30af,0xb30c1},
+{0x30b0,0xb3162},
+{0x30b1,0xb3481},
+{0x30b2,0xb3522},
+{0x30b3,0xb35e1},
+{0x30b4,0xb3682},
+{0x30b5,0xb3841},
+{0x30b6,0xb3902},
+{0x30b7,0xb3aa1},
+{0x30b8,0xb3b42},
+{0x30b9,0xb3ca1},
+{0x30ba,0xb3d42},
+{0x30bb,0xb3da1},
+{0x30bc,0xb3e42},
+{0x30bd,0xb3f61},
+{0x30be,0xb4002},
+{0x30bf,0xb4061},
+{0x30c0,0xb4102},
+{0x30c1,0xb41e1},
+{0x30c2,0xb4282},
+{0x30c3,0xb4301},
+{0x30c4,0xb4341},
+{0x30c5,0xb43e2},
+{0x30c6,0xb4441},
+{0x30c7,0xb44e2},
+{0x30c8,0xb4601},
+{0x30c9,0xb46a2},
+{0x30ca,0xb47a1},
+{0x30cb,0xb4861},
+{0x30cc,0xb4901},
+{0x30cd,0xb4981},
+{0x30ce,0xb4a01},
+{0x30cf,0xb4b01},
+{0x30d0,0xb4ba2},
+{0x30d1,0xb4c22},
+{0x30d2,0xb4ee1},
+{0x30d3,0xb4f82},
+{0x30d4,0xb5002},
+{0x30d5,0xb5281},
+{0x30d6,0xb5322},
+{0x30d7,0xb53a2},
+{0x30d8,0xb5681},
+{0x30d9,0xb5722},
+{0x30da,0xb57a2},
+{0x30db,0xb5ba1},
+{0x30dc,0xb5c42},
+{0x30dd,0xb5cc2},
+{0x30de,0xb6021},
+{0x30df,0xb6321},
+{0x30e0,0xb6541},
+{0x30e1,0xb65c1},
+{0x30e2,0xb67c1},
+{0x30e3,0xb6861},
+{0x30e4,0xb68a1},
+{0x30e5,0xb6a21},
+{0x30e6,0xb6a61},
+{0x30e7,0xb6b61},
+{0x30e8,0xb6ba1},
+{0x30e9,0xb6c81},
+{0x30ea,0xb6d21},
+{0x30eb,0xb6e81},
+{0x30ec,0xb7041},
+{0x30ed,0xb71e1},
+{0x30ee,0xb7281},
+{0x30ef,0xb72a1},
+{0x30f0,0xb73c1},
+{0x30f1,0xb7461},
+{0x30f2,0xb7501},
+{0x30f3,0xb75c1},
+{0x30f4,0xb22c2},
+{0x30f5,0xb2781},
+{0x30f6,0xb3461},
+{0x30f7,0xb7302},
+{0x30f8,0xb7402},
+{0x30f9,0xb74a2},
+{0x30fa,0xb7562},
+{0x30fb,0x18c61},
+{0x30fc,0x379c1},
+{0x30fd,0x37a01},
+{0x30fe,0x37a22},
+{0x30ff,0xb3782},
+{0x3105,0xb7621},
+{0x3106,0xb7681},
+{0x3107,0xb76c1},
+{0x3108,0xb7701},
+{0x3109,0xb7741},
+{0x310a,0xb7761},
+{0x310b,0xb77a1},
+{0x310c,0xb77c1},
+{0x310d,0xb77e1},
+{0x310e,0xb7841},
+{0x310f,0xb78c1},
+{0x3110,0xb7901},
+{0x3111,0xb7961},
+{0x3112,0xb7981},
+{0x3113,0xb79c1},
+{0x3114,0xb79e1},
+{0x3115,0xb7a01},
+{0x3116,0xb7a21},
+{0x3117,0xb7a41},
+{0x3118,0xb7aa1},
+{0x3119,0xb7ac1},
+{0x311a,0xb7b41},
+{0x311b,0xb7ba1},
+{0x311c,0xb7c21},
+{0x311d,0xb7c41},
+{0x311e,0xb7cc1},
+{0x311f,0xb7d21},
+{0x3120,0xb7d41},
+{0x3121,0xb7da1},
+{0x3122,0xb7dc1},
+{0x3123,0xb7de1},
+{0x3124,0xb7e01},
+{0x3125,0xb7e41},
+{0x3126,0xb7ea1},
+{0x3127,0xb7ec1},
+{0x3128,0xb7f61},
+{0x3129,0xb8001},
+{0x312a,0xb7721},
+{0x312b,0xb7881},
+{0x312c,0xb79a1},
+{0x312d,0xb8021},
+{0x3131,0xac901},
+{0x3132,0xacaa1},
+{0x3133,0xb0861},
+{0x3134,0xacb01},
+{0x3135,0xb08e1},
+{0x3136,0xb0941},
+{0x3137,0xacca1},
+{0x3138,0xace41},
+{0x3139,0xacea1},
+{0x313a,0xb09e1},
+{0x313b,0xb0a41},
+{0x313c,0xb0aa1},
+{0x313d,0xb0b01},
+{0x313e,0xb0b61},
+{0x313f,0xb0bc1},
+{0x3140,0xae641},
+{0x3141,0xad041},
+{0x3142,0xad1e1},
+{0x3143,0xad381},
+{0x3144,0xae7e1},
+{0x3145,0xad3e1},
+{0x3146,0xad581},
+{0x3147,0xad5e1},
+{0x3148,0xad961},
+{0x3149,0xadc01},
+{0x314a,0xadc61},
+{0x314b,0xadea1},
+{0x314c,0xae041},
+{0x314d,0xae1e1},
+{0x314e,0xae381},
+{0x314f,0xaf621},
+{0x3150,0xaf681},
+{0x3151,0xaf6e1},
+{0x3152,0xaf741},
+{0x3153,0xaf7a1},
+{0x3154,0xaf801},
+{0x3155,0xaf861},
+{0x3156,0xaf8c1},
+{0x3157,0xaf921},
+{0x3158,0xaf981},
+{0x3159,0xaf9e1},
+{0x315a,0xafa41},
+{0x315b,0xafaa1},
+{0x315c,0xafb01},
+{0x315d,0xafb61},
+{0x315e,0xafbc1},
+{0x315f,0xafc21},
+{0x3160,0xafc81},
+{0x3161,0xafce1},
+{0x3162,0xafd41},
+{0x3163,0xafda1},
+{0x3164,0xaf5c1},
+{0x3165,0xae541},
+{0x3166,0xae581},
+{0x3167,0xb0e41},
+{0x3168,0xb0e81},
+{0x3169,0xb0f21},
+{0x316a,0xb0f81},
+{0x316b,0xb1041},
+{0x316c,0xb10e1},
+{0x316d,0xb1141},
+{0x316e,0xae6c1},
+{0x316f,0xb11e1},
+{0x3170,0xb1241},
+{0x3171,0xae701},
+{0x3172,0xae741},
+{0x3173,0xae7a1},
+{0x3174,0xae841},
+{0x3175,0xae881},
+{0x3176,0xae921},
+{0x3177,0xae981},
+{0x3178,0xae9e1},
+{0x3179,0xaea21},
+{0x317a,0xaea61},
+{0x317b,0xaeaa1},
+{0x317c,0xaeae1},
+{0x317d,0xaeb61},
+{0x317e,0xaec01},
+{0x317f,0xaed61},
+{0x3180,0xaee61},
+{0x3181,0xaef21},
+{0x3182,0xb14a1},
+{0x3183,0xb14e1},
+{0x3184,0xaf0a1},
+{0x3185,0xaf0e1},
+{0x3186,0xaf121},
+{0x3187,0xaffc1},
+{0x3188,0xb0001},
+{0x3189,0xb0081},
+{0x318a,0xb01c1},
+{0x318b,0xb0201},
+{0x318c,0xb0261},
+{0x318d,0xb03c1},
+{0x318e,0xb0441},
+{0x3190,0x18c81},
+{0x3191,0x18ca1},
+{0x3192,0xe70e2},
+{0x3193,0xe7da2},
+{0x3194,0xe73a2},
+{0x3195,0xeafa2},
+{0x3196,0xe7462},
+{0x3197,0xe76a2},
+{0x3198,0xe74e2},
+{0x3199,0xf28a2},
+{0x319a,0xe7982},
+{0x319b,0xe7562},
+{0x319c,0xe7162},
+{0x319d,0xeb962},
+{0x319e,0xeb1a2},
+{0x319f,0xe7fe2},
+{0x31a0,0xb7642},
+{0x31a1,0xb7a62},
+{0x31a2,0xb7922},
+{0x31a3,0xb7802},
+{0x31a4,0xb7c61},
+{0x31a5,0xb7c82},
+{0x31a6,0xb7c01},
+{0x31a7,0xb7bc2},
+{0x31a8,0xb7fc2},
+{0x31a9,0xb7b62},
+{0x31aa,0xb7ee2},
+{0x31ab,0xb7f82},
+{0x31ac,0xb76e1},
+{0x31ad,0xb78a1},
+{0x31ae,0xb7ce2},
+{0x31af,0xb7d62},
+{0x31b0,0xb7e61},
+{0x31b1,0xb7e81},
+{0x31b2,0xb7e21},
+{0x31b3,0xb7f22},
+{0x31b4,0xb76a1},
+{0x31b5,0xb7781},
+{0x31b6,0xb7861},
+{0x31b7,0xb78e1},
+{0x31b8,0xb7ae1},
+{0x31b9,0xb7b01},
+{0x31ba,0xb7b21},
+{0x31c0,0x18cc1},
+{0x31c1,0x18ce1},
+{0x31c2,0x18d01},
+{0x31c3,0x18d21},
+{0x31c4,0x18d41},
+{0x31c5,0x18d61},
+{0x31c6,0x18d81},
+{0x31c7,0x18da1},
+{0x31c8,0x18dc1},
+{0x31c9,0x18de1},
+{0x31ca,0x18e01},
+{0x31cb,0x18e21},
+{0x31cc,0x18e41},
+{0x31cd,0x18e61},
+{0x31ce,0x18e81},
+{0x31cf,0x18ea1},
+{0x31d0,0x18ec1},
+{0x31d1,0x18ee1},
+{0x31d2,0x18f01},
+{0x31d3,0x18f21},
+{0x31d4,0x18f41},
+{0x31d5,0x18f61},
+{0x31d6,0x18f81},
+{0x31d7,0x18fa1},
+{0x31d8,0x18fc1},
+{0x31d9,0x18fe1},
+{0x31da,0x19001},
+{0x31db,0x19021},
+{0x31dc,0x19041},
+{0x31dd,0x19061},
+{0x31de,0x19081},
+{0x31df,0x190a1},
+{0x31e0,0x190c1},
+{0x31e1,0x190e1},
+{0x31e2,0x19101},
+{0x31e3,0x19121},
+{0x31f0,0xb30a1},
+{0x31f1,0xb3a81},
+{0x31f2,0xb3c81},
+{0x31f3,0xb45e1},
+{0x31f4,0xb48e1},
+{0x31f5,0xb4ae1},
+{0x31f6,0xb4ec1},
+{0x31f7,0xb5261},
+{0x31f8,0xb5661},
+{0x31f9,0xb5b81},
+{0x31fa,0xb6521},
+{0x31fb,0xb6c61},
+{0x31fc,0xb6d01},
+{0x31fd,0xb6e61},
+{0x31fe,0xb7021},
+{0x31ff,0xb71c1},
+{0x3200,0xac923},
+{0x3201,0xacb23},
+{0x3202,0xaccc3},
+{0x3203,0xacec3},
+{0x3204,0xad063},
+{0x3205,0xad203},
+{0x3206,0xad403},
+{0x3207,0xad603},
+{0x3208,0xad983},
+{0x3209,0xadc83},
+{0x320a,0xadec3},
+{0x320b,0xae063},
+{0x320c,0xae203},
+{0x320d,0xae3a3},
+{0x320e,0xac9c4},
+{0x320f,0xacbc4},
+{0x3210,0xacd64},
+{0x3211,0xacf64},
+{0x3212,0xad104},
+{0x3213,0xad2a4},
+{0x3214,0xad4a4},
+{0x3215,0xad6a4},
+{0x3216,0xada24},
+{0x3217,0xadd24},
+{0x3218,0xadf64},
+{0x3219,0xae104},
+{0x321a,0xae2a4},
+{0x321b,0xae444},
+{0x321c,0xadae4},
+{0x321d,0xad767},
+{0x321e,0xad846},
+{0x3220,0xe7024},
+{0x3221,0xe7c64},
+{0x3222,0xe7264},
+{0x3223,0xeaee4},
+{0x3224,0xe7e24},
+{0x3225,0xe8aa4},
+{0x3226,0xe71a4},
+{0x3227,0xe89a4},
+{0x3228,0xe7aa4},
+{0x3229,0xe9c44},
+{0x322a,0xef544},
+{0x322b,0xf14c4},
+{0x322c,0xf0804},
+{0x322d,0xef8a4},
+{0x322e,0xf8904},
+{0x322f,0xeb0e4},
+{0x3230,0xeefa4},
+{0x3231,0xefca4},
+{0x3232,0xef6a4},
+{0x3233,0xf36c4},
+{0x3234,0xea5e4},
+{0x3235,0xf1e44},
+{0x3236,0xf7704},
+{0x3237,0xf38c4},
+{0x3238,0xe96c4},
+{0x3239,0xe80e4},
+{0x323a,0xea864},
+{0x323b,0xebee4},
+{0x323c,0xf2f04},
+{0x323d,0xe81a4},
+{0x323e,0xf78c4},
+{0x323f,0xe9e04},
+{0x3240,0xf3a04},
+{0x3241,0xe8264},
+{0x3242,0xf5604},
+{0x3243,0xf5704},
+{0x3244,0xeaa22},
+{0x3245,0xecea2},
+{0x3246,0xeec62},
+{0x3247,0xf40e2},
+{0x3248,0x385c2},
+{0x3249,0x3a2e2},
+{0x324a,0x3b082},
+{0x324b,0x3b802},
+{0x324c,0x3bdc2},
+{0x324d,0x3c1a2},
+{0x324e,0x3c4c2},
+{0x324f,0x3c842},
+{0x3250,0x4af63},
+{0x3251,0x3a422},
+{0x3252,0x3a562},
+{0x3253,0x3a6a2},
+{0x3254,0x3a842},
+{0x3255,0x3a982},
+{0x3256,0x3aaa2},
+{0x3257,0x3ab62},
+{0x3258,0x3ac22},
+{0x3259,0x3ace2},
+{0x325a,0x3b082},
+{0x325b,0x3b142},
+{0x325c,0x3b202},
+{0x325d,0x3b242},
+{0x325e,0x3b282},
+{0x325f,0x3b322},
+{0x3260,0xac981},
+{0x3261,0xacb81},
+{0x3262,0xacd21},
+{0x3263,0xacf21},
+{0x3264,0xad0c1},
+{0x3265,0xad261},
+{0x3266,0xad461},
+{0x3267,0xad661},
+{0x3268,0xad9e1},
+{0x3269,0xadce1},
+{0x326a,0xadf21},
+{0x326b,0xae0c1},
+{0x326c,0xae261},
+{0x326d,0xae401},
+{0x326e,0xaca42},
+{0x326f,0xacc42},
+{0x3270,0xacde2},
+{0x3271,0xacfe2},
+{0x3272,0xad182},
+{0x3273,0xad322},
+{0x3274,0xad522},
+{0x3275,0xad722},
+{0x3276,0xadaa2},
+{0x3277,0xadda2},
+{0x3278,0xadfe2},
+{0x3279,0xae182},
+{0x327a,0xae322},
+{0x327b,0xae4c2},
+{0x327c,0xadde5},
+{0x327d,0xadb64},
+{0x327e,0xad902},
+{0x327f,0x19141},
+{0x3280,0xe70a2},
+{0x3281,0xe7d62},
+{0x3282,0xe7362},
+{0x3283,0xeaf62},
+{0x3284,0xe7ea2},
+{0x3285,0xe8b22},
+{0x3286,0xe7222},
+{0x3287,0xe8a22},
+{0x3288,0xe7b22},
+{0x3289,0xe9cc2},
+{0x328a,0xef5c2},
+{0x328b,0xf1542},
+{0x328c,0xf0882},
+{0x328d,0xef922},
+{0x328e,0xf8982},
+{0x328f,0xeb162},
+{0x3290,0xef022},
+{0x3291,0xefd22},
+{0x3292,0xef722},
+{0x3293,0xf3742},
+{0x3294,0xea662},
+{0x3295,0xf1ec2},
+{0x3296,0xf7782},
+{0x3297,0xf3942},
+{0x3298,0xe9742},
+{0x3299,0xf3cc2},
+{0x329a,0xf2922},
+{0x329b,0xebba2},
+{0x329c,0xf8322},
+{0x329d,0xe86a2},
+{0x329e,0xea042},
+{0x329f,0xf0b02},
+{0x32a0,0xf9882},
+{0x32a1,0xe82e2},
+{0x32a2,0xe8e02},
+{0x32a3,0xf0322},
+{0x32a4,0xe7422},
+{0x32a5,0xe7662},
+{0x32a6,0xe74a2},
+{0x32a7,0xecb22},
+{0x32a8,0xea4e2},
+{0x32a9,0xe9b82},
+{0x32aa,0xec0a2},
+{0x32ab,0xebf62},
+{0x32ac,0xf2f82},
+{0x32ad,0xe8222},
+{0x32ae,0xf7942},
+{0x32af,0xe9e82},
+{0x32b0,0xeb822},
+{0x32b1,0x3b3c2},
+{0x32b2,0x3b402},
+{0x32b3,0x3b442},
+{0x32b4,0x3b4e2},
+{0x32b5,0x3b802},
+{0x32b6,0x3b842},
+{0x32b7,0x3b882},
+{0x32b8,0x3b8c2},
+{0x32b9,0x3b902},
+{0x32ba,0x3b942},
+{0x32bb,0x3b9e2},
+{0x32bc,0x3ba22},
+{0x32bd,0x3ba62},
+{0x32be,0x3baa2},
+{0x32bf,0x3bdc2},
+{0x32c0,0x39f83},
+{0x32c1,0x3ae03},
+{0x32c2,0x3b583},
+{0x32c3,0x3bb43},
+{0x32c4,0x3bf23},
+{0x32c5,0x3c243},
+{0x32c6,0x3c5c3},
+{0x32c7,0x3c8e3},
+{0x32c8,0x3cbc3},
+{0x32c9,0x38684},
+{0x32ca,0x389a4},
+{0x32cb,0x38ca4},
+{0x32cc,0x43c02},
+{0x32cd,0x41da3},
+{0x32ce,0x41e02},
+{0x32cf,0x46963},
+{0x32d0,0xb1d81},
+{0x32d1,0xb2081},
+{0x32d2,0xb2261},
+{0x32d3,0xb2441},
+{0x32d4,0xb2661},
+{0x32d5,0xb27e1},
+{0x32d6,0xb2b41},
+{0x32d7,0xb3101},
+{0x32d8,0xb34c1},
+{0x32d9,0xb3621},
+{0x32da,0xb3881},
+{0x32db,0xb3ae1},
+{0x32dc,0xb3ce1},
+{0x32dd,0xb3de1},
+{0x32de,0xb3fa1},
+{0x32df,0xb40a1},
+{0x32e0,0xb4221},
+{0x32e1,0xb4381},
+{0x32e2,0xb4481},
+{0x32e3,0xb4641},
+{0x32e4,0xb47e1},
+{0x32e5,0xb48a1},
+{0x32e6,0xb4941},
+{0x32e7,0xb49c1},
+{0x32e8,0xb4a41},
+{0x32e9,0xb4b41},
+{0x32ea,0xb4f21},
+{0x32eb,0xb52c1},
+{0x32ec,0xb56c1},
+{0x32ed,0xb5be1},
+{0x32ee,0xb6061},
+{0x32ef,0xb6361},
+{0x32f0,0xb6581},
+{0x32f1,0xb6601},
+{0x32f2,0xb6801},
+{0x32f3,0xb68e1},
+{0x32f4,0xb6aa1},
+{0x32f5,0xb6be1},
+{0x32f6,0xb6cc1},
+{0x32f7,0xb6d61},
+{0x32f8,0xb6ec1},
+{0x32f9,0xb7081},
+{0x32fa,0xb7221},
+{0x32fb,0xb72e1},
+{0x32fc,0xb73e1},
+{0x32fd,0xb7481},
+{0x32fe,0xb7541},
+{0x3300,0xb1e05},
+{0x3301,0xb1ea4},
+{0x3302,0xb1f25},
+{0x3303,0xb1da3},
+{0x3304,0xb20a5},
+{0x3305,0xb2143},
+{0x3306,0xb2303},
+{0x3307,0xb24e6},
+{0x3308,0xb2464},
+{0x3309,0xb26e3},
+{0x330a,0xb2683},
+{0x330b,0xb2883},
+{0x330c,0xb28e4},
+{0x330d,0xb2964},
+{0x330e,0xb29e4},
+{0x330f,0xb2a64},
+{0x3310,0xb2be4},
+{0x3311,0xb2c64},
+{0x3312,0xb2ce4},
+{0x3313,0xb2d66},
+{0x3314,0xb2e22},
+{0x3315,0xb2e66},
+{0x3316,0xb2f26},
+{0x3317,0xb2fe5},
+{0x3318,0xb31a4},
+{0x3319,0xb3226},
+{0x331a,0xb32e6},
+{0x331b,0xb33a4},
+{0x331c,0xb3563},
+{0x331d,0xb37c3},
+{0x331e,0xb36c4},
+{0x331f,0xb3944},
+{0x3320,0xb39c5},
+{0x3321,0xb3bc5},
+{0x3322,0xb3e83},
+{0x3323,0xb3ee3},
+{0x3324,0xb4144},
+{0x3325,0xb4563},
+{0x3326,0xb46e3},
+{0x3327,0xb4742},
+{0x3328,0xb4802},
+{0x3329,0xb4a63},
+{0x332a,0xb4e43},
+{0x332b,0xb4c66},
+{0x332c,0xb4d24},
+{0x332d,0xb4da5},
+{0x332e,0xb5046},
+{0x332f,0xb5104},
+{0x3330,0xb5183},
+{0x3331,0xb51e3},
+{0x3332,0xb53e6},
+{0x3333,0xb54a4},
+{0x3334,0xb5526},
+{0x3335,0xb55e3},
+{0x3336,0xb5905},
+{0x3337,0xb59a3},
+{0x3338,0xb5a04},
+{0x3339,0xb5a83},
+{0x333a,0xb5ae4},
+{0x333b,0xb57e5},
+{0x333c,0xb5884},
+{0x333d,0xb5dc5},
+{0x333e,0xb5ea4},
+{0x333f,0xb5f22},
+{0x3340,0xb5f65},
+{0x3341,0xb5d03},
+{0x3342,0xb5d63},
+{0x3343,0xb6084},
+{0x3344,0xb6103},
+{0x3345,0xb61a3},
+{0x3346,0xb6203},
+{0x3347,0xb6265},
+{0x3348,0xb6384},
+{0x3349,0xb6402},
+{0x334a,0xb6446},
+{0x334b,0xb66a3},
+{0x334c,0xb6705},
+{0x334d,0xb6624},
+{0x334e,0xb6904},
+{0x334f,0xb6983},
+{0x3350,0xb6ac3},
+{0x3351,0xb6d84},
+{0x3352,0xb6e02},
+{0x3353,0xb6f84},
+{0x3354,0xb6ee5},
+{0x3355,0xb70a2},
+{0x3356,0xb70e6},
+{0x3357,0xb7343},
+{0x3358,0x38283},
+{0x3359,0x39fe3},
+{0x335a,0x3ae63},
+{0x335b,0x3b5e3},
+{0x335c,0x3bba3},
+{0x335d,0x3bf83},
+{0x335e,0x3c2a3},
+{0x335f,0x3c623},
+{0x3360,0x3c943},
+{0x3361,0x3cc23},
+{0x3362,0x38704},
+{0x3363,0x38a24},
+{0x3364,0x38d24},
+{0x3365,0x38fa4},
+{0x3366,0x39224},
+{0x3367,0x394a4},
+{0x3368,0x39724},
+{0x3369,0x399a4},
+{0x336a,0x39c24},
+{0x336b,0x39ea4},
+{0x336c,0x3a3a4},
+{0x336d,0x3a4e4},
+{0x336e,0x3a624},
+{0x336f,0x3a7c4},
+{0x3370,0x3a904},
+{0x3371,0x43c83},
+{0x3372,0x40682},
+{0x3373,0x3e822},
+{0x3374,0x3f0a3},
+{0x3375,0x4a3c2},
+{0x3376,0x4ace2},
+{0x3377,0x407c2},
+{0x3378,0x40803},
+{0x3379,0x40863},
+{0x337a,0x44c62},
+{0x337b,0xecda4},
+{0x337c,0xef1c4},
+{0x337d,0xeb8e4},
+{0x337e,0xef0c4},
+{0x337f,0xefd68},
+{0x3380,0x4ac22},
+{0x3381,0x48222},
+{0x3382,0x55fe2},
+{0x3383,0x472e2},
+{0x3384,0x45962},
+{0x3385,0x459a2},
+{0x3386,0x47362},
+{0x3387,0x43142},
+{0x3388,0x3f943},
+{0x3389,0x459e4},
+{0x338a,0x4ad22},
+{0x338b,0x482c2},
+{0x338c,0x56022},
+{0x338d,0x56062},
+{0x338e,0x47422},
+{0x338f,0x45a62},
+{0x3390,0x43d22},
+{0x3391,0x45aa3},
+{0x3392,0x47463},
+{0x3393,0x43183},
+{0x3394,0x4db23},
+{0x3395,0x560a2},
+{0x3396,0x47522},
+{0x3397,0x40782},
+{0x3398,0x45b42},
+{0x3399,0x427e2},
+{0x339a,0x48402},
+{0x339b,0x560e2},
+{0x339c,0x47562},
+{0x339d,0x3fb22},
+{0x339e,0x45b82},
+{0x339f,0x475a3},
+{0x33a0,0x3fb63},
+{0x33a1,0x47262},
+{0x33a2,0x45c03},
+{0x33a3,0x47603},
+{0x33a4,0x3fbc3},
+{0x33a5,0x472a2},
+{0x33a6,0x45c63},
+{0x33a7,0x47723},
+{0x33a8,0x477c4},
+{0x33a9,0x4ac62},
+{0x33aa,0x45cc3},
+{0x33ab,0x476c3},
+{0x33ac,0x431e3},
+{0x33ad,0x4bd83},
+{0x33ae,0x4bde5},
+{0x33af,0x4be86},
+{0x33b0,0x4af22},
+{0x33b1,0x48482},
+{0x33b2,0x56122},
+{0x33b3,0x47782},
+{0x33b4,0x4afc2},
+{0x33b5,0x484c2},
+{0x33b6,0x56162},
+{0x33b7,0x47842},
+{0x33b8,0x45d62},
+{0x33b9,0x47882},
+{0x33ba,0x4b002},
+{0x33bb,0x48502},
+{0x33bc,0x561a2},
+{0x33bd,0x478c2},
+{0x33be,0x45da2},
+{0x33bf,0x47902},
+{0x33c0,0x45de2},
+{0x33c1,0x47942},
+{0x33c2,0x3e584},
+{0x33c3,0x3f102},
+{0x33c4,0x3f9a2},
+{0x33c5,0x3fa22},
+{0x33c6,0x3fa64},
+{0x33c7,0x3fc83},
+{0x33c8,0x40702},
+{0x33c9,0x43242},
+{0x33ca,0x43bc2},
+{0x33cb,0x43c42},
+{0x33cc,0x44c22},
+{0x33cd,0x45b02},
+{0x33ce,0x45bc2},
+{0x33cf,0x45d22},
+{0x33d0,0x46842},
+{0x33d1,0x46882},
+{0x33d2,0x468c3},
+{0x33d3,0x469c2},
+{0x33d4,0x47322},
+{0x33d5,0x474c3},
+{0x33d6,0x47663},
+{0x33d7,0x4ad62},
+{0x33d8,0x4ada4},
+{0x33d9,0x4ae23},
+{0x33da,0x4aee2},
+{0x33db,0x4cf22},
+{0x33dc,0x4d102},
+{0x33dd,0x505e2},
+{0x33de,0x4fda3},
+{0x33df,0x3e603},
+{0x33e0,0x39f23},
+{0x33e1,0x3ada3},
+{0x33e2,0x3b523},
+{0x33e3,0x3bae3},
+{0x33e4,0x3bec3},
+{0x33e5,0x3c1e3},
+{0x33e6,0x3c563},
+{0x33e7,0x3c883},
+{0x33e8,0x3cb63},
+{0x33e9,0x38604},
+{0x33ea,0x38924},
+{0x33eb,0x38c24},
+{0x33ec,0x38f24},
+{0x33ed,0x391a4},
+{0x33ee,0x39424},
+{0x33ef,0x396a4},
+{0x33f0,0x39924},
+{0x33f1,0x39ba4},
+{0x33f2,0x39e24},
+{0x33f3,0x3a324},
+{0x33f4,0x3a464},
+{0x33f5,0x3a5a4},
+{0x33f6,0x3a744},
+{0x33f7,0x3a884},
+{0x33f8,0x3aa24},
+{0x33f9,0x3aae4},
+{0x33fa,0x3aba4},
+{0x33fb,0x3ac64},
+{0x33fc,0x3ad24},
+{0x33fd,0x3b0c4},
+{0x33fe,0x3b184},
+{0x33ff,0x430e3},
+{0x4dc0,0x19161},
+{0x4dc1,0x19181},
+{0x4dc2,0x191a1},
+{0x4dc3,0x191c1},
+{0x4dc4,0x191e1},
+{0x4dc5,0x19201},
+{0x4dc6,0x19221},
+{0x4dc7,0x19241},
+{0x4dc8,0x19261},
+{0x4dc9,0x19281},
+{0x4dca,0x192a1},
+{0x4dcb,0x192c1},
+{0x4dcc,0x192e1},
+{0x4dcd,0x19301},
+{0x4dce,0x19321},
+{0x4dcf,0x19341},
+{0x4dd0,0x19361},
+{0x4dd1,0x19381},
+{0x4dd2,0x193a1},
+{0x4dd3,0x193c1},
+{0x4dd4,0x193e1},
+{0x4dd5,0x19401},
+{0x4dd6,0x19421},
+{0x4dd7,0x19441},
+{0x4dd8,0x19461},
+{0x4dd9,0x19481},
+{0x4dda,0x194a1},
+{0x4ddb,0x194c1},
+{0x4ddc,0x194e1},
+{0x4ddd,0x19501},
+{0x4dde,0x19521},
+{0x4ddf,0x19541},
+{0x4de0,0x19561},
+{0x4de1,0x19581},
+{0x4de2,0x195a1},
+{0x4de3,0x195c1},
+{0x4de4,0x195e1},
+{0x4de5,0x19601},
+{0x4de6,0x19621},
+{0x4de7,0x19641},
+{0x4de8,0x19661},
+{0x4de9,0x19681},
+{0x4dea,0x196a1},
+{0x4deb,0x196c1},
+{0x4dec,0x196e1},
+{0x4ded,0x19701},
+{0x4dee,0x19721},
+{0x4def,0x19741},
+{0x4df0,0x19761},
+{0x4df1,0x19781},
+{0x4df2,0x197a1},
+{0x4df3,0x197c1},
+{0x4df4,0x197e1},
+{0x4df5,0x19801},
+{0x4df6,0x19821},
+{0x4df7,0x19841},
+{0x4df8,0x19861},
+{0x4df9,0x19881},
+{0x4dfa,0x198a1},
+{0x4dfb,0x198c1},
+{0x4dfc,0x198e1},
+{0x4dfd,0x19901},
+{0x4dfe,0x19921},
+{0x4dff,0x19941},
+{0xa000,0xb8041},
+{0xa001,0xb8061},
+{0xa002,0xb8081},
+{0xa003,0xb80a1},
+{0xa004,0xb80c1},
+{0xa005,0xb80e1},
+{0xa006,0xb8101},
+{0xa007,0xb8121},
+{0xa008,0xb8141},
+{0xa009,0xb8161},
+{0xa00a,0xb8181},
+{0xa00b,0xb81a1},
+{0xa00c,0xb81c1},
+{0xa00d,0xb81e1},
+{0xa00e,0xb8201},
+{0xa00f,0xb8221},
+{0xa010,0xb8241},
+{0xa011,0xb8261},
+{0xa012,0xb8281},
+{0xa013,0xb82a1},
+{0xa014,0xb82c1},
+{0xa015,0xb82e1},
+{0xa016,0xb8301},
+{0xa017,0xb8321},
+{0xa018,0xb8341},
+{0xa019,0xb8361},
+{0xa01a,0xb8381},
+{0xa01b,0xb83a1},
+{0xa01c,0xb83c1},
+{0xa01d,0xb83e1},
+{0xa01e,0xb8401},
+{0xa01f,0xb8421},
+{0xa020,0xb8441},
+{0xa021,0xb8461},
+{0xa022,0xb8481},
+{0xa023,0xb84a1},
+{0xa024,0xb84c1},
+{0xa025,0xb84e1},
+{0xa026,0xb8501},
+{0xa027,0xb8521},
+{0xa028,0xb8541},
+{0xa029,0xb8561},
+{0xa02a,0xb8581},
+{0xa02b,0xb85a1},
+{0xa02c,0xb85c1},
+{0xa02d,0xb85e1},
+{0xa02e,0xb8601},
+{0xa02f,0xb8621},
+{0xa030,0xb8641},
+{0xa031,0xb8661},
+{0xa032,0xb8681},
+{0xa033,0xb86a1},
+{0xa034,0xb86c1},
+{0xa035,0xb86e1},
+{0xa036,0xb8701},
+{0xa037,0xb8721},
+{0xa038,0xb8741},
+{0xa039,0xb8761},
+{0xa03a,0xb8781},
+{0xa03b,0xb87a1},
+{0xa03c,0xb87c1},
+{0xa03d,0xb87e1},
+{0xa03e,0xb8801},
+{0xa03f,0xb8821},
+{0xa040,0xb8841},
+{0xa041,0xb8861},
+{0xa042,0xb8881},
+{0xa043,0xb88a1},
+{0xa044,0xb88c1},
+{0xa045,0xb88e1},
+{0xa046,0xb8901},
+{0xa047,0xb8921},
+{0xa048,0xb8941},
+{0xa049,0xb8961},
+{0xa04a,0xb8981},
+{0xa04b,0xb89a1},
+{0xa04c,0xb89c1},
+{0xa04d,0xb89e1},
+{0xa04e,0xb8a01},
+{0xa04f,0xb8a21},
+{0xa050,0xb8a41},
+{0xa051,0xb8a61},
+{0xa052,0xb8a81},
+{0xa053,0xb8aa1},
+{0xa054,0xb8ac1},
+{0xa055,0xb8ae1},
+{0xa056,0xb8b01},
+{0xa057,0xb8b21},
+{0xa058,0xb8b41},
+{0xa059,0xb8b61},
+{0xa05a,0xb8b81},
+{0xa05b,0xb8ba1},
+{0xa05c,0xb8bc1},
+{0xa05d,0xb8be1},
+{0xa05e,0xb8c01},
+{0xa05f,0xb8c21},
+{0xa060,0xb8c41},
+{0xa061,0xb8c61},
+{0xa062,0xb8c81},
+{0xa063,0xb8ca1},
+{0xa064,0xb8cc1},
+{0xa065,0xb8ce1},
+{0xa066,0xb8d01},
+{0xa067,0xb8d21},
+{0xa068,0xb8d41},
+{0xa069,0xb8d61},
+{0xa06a,0xb8d81},
+{0xa06b,0xb8da1},
+{0xa06c,0xb8dc1},
+{0xa06d,0xb8de1},
+{0xa06e,0xb8e01},
+{0xa06f,0xb8e21},
+{0xa070,0xb8e41},
+{0xa071,0xb8e61},
+{0xa072,0xb8e81},
+{0xa073,0xb8ea1},
+{0xa074,0xb8ec1},
+{0xa075,0xb8ee1},
+{0xa076,0xb8f01},
+{0xa077,0xb8f21},
+{0xa078,0xb8f41},
+{0xa079,0xb8f61},
+{0xa07a,0xb8f81},
+{0xa07b,0xb8fa1},
+{0xa07c,0xb8fc1},
+{0xa07d,0xb8fe1},
+{0xa07e,0xb9001},
+{0xa07f,0xb9021},
+{0xa080,0xb9041},
+{0xa081,0xb9061},
+{0xa082,0xb9081},
+{0xa083,0xb90a1},
+{0xa084,0xb90c1},
+{0xa085,0xb90e1},
+{0xa086,0xb9101},
+{0xa087,0xb9121},
+{0xa088,0xb9141},
+{0xa089,0xb9161},
+{0xa08a,0xb9181},
+{0xa08b,0xb91a1},
+{0xa08c,0xb91c1},
+{0xa08d,0xb91e1},
+{0xa08e,0xb9201},
+{0xa08f,0xb9221},
+{0xa090,0xb9241},
+{0xa091,0xb9261},
+{0xa092,0xb9281},
+{0xa093,0xb92a1},
+{0xa094,0xb92c1},
+{0xa095,0xb92e1},
+{0xa096,0xb9301},
+{0xa097,0xb9321},
+{0xa098,0xb9341},
+{0xa099,0xb9361},
+{0xa09a,0xb9381},
+{0xa09b,0xb93a1},
+{0xa09c,0xb93c1},
+{0xa09d,0xb93e1},
+{0xa09e,0xb9401},
+{0xa09f,0xb9421},
+{0xa0a0,0xb9441},
+{0xa0a1,0xb9461},
+{0xa0a2,0xb9481},
+{0xa0a3,0xb94a1},
+{0xa0a4,0xb94c1},
+{0xa0a5,0xb94e1},
+{0xa0a6,0xb9501},
+{0xa0a7,0xb9521},
+{0xa0a8,0xb9541},
+{0xa0a9,0xb9561},
+{0xa0aa,0xb9581},
+{0xa0ab,0xb95a1},
+{0xa0ac,0xb95c1},
+{0xa0ad,0xb95e1},
+{0xa0ae,0xb9601},
+{0xa0af,0xb9621},
+{0xa0b0,0xb9641},
+{0xa0b1,0xb9661},
+{0xa0b2,0xb9681},
+{0xa0b3,0xb96a1},
+{0xa0b4,0xb96c1},
+{0xa0b5,0xb96e1},
+{0xa0b6,0xb9701},
+{0xa0b7,0xb9721},
+{0xa0b8,0xb9741},
+{0xa0b9,0xb9761},
+{0xa0ba,0xb9781},
+{0xa0bb,0xb97a1},
+{0xa0bc,0xb97c1},
+{0xa0bd,0xb97e1},
+{0xa0be,0xb9801},
+{0xa0bf,0xb9821},
+{0xa0c0,0xb9841},
+{0xa0c1,0xb9861},
+{0xa0c2,0xb9881},
+{0xa0c3,0xb98a1},
+{0xa0c4,0xb98c1},
+{0xa0c5,0xb98e1},
+{0xa0c6,0xb9901},
+{0xa0c7,0xb9921},
+{0xa0c8,0xb9941},
+{0xa0c9,0xb9961},
+{0xa0ca,0xb9981},
+{0xa0cb,0xb99a1},
+{0xa0cc,0xb99c1},
+{0xa0cd,0xb99e1},
+{0xa0ce,0xb9a01},
+{0xa0cf,0xb9a21},
+{0xa0d0,0xb9a41},
+{0xa0d1,0xb9a61},
+{0xa0d2,0xb9a81},
+{0xa0d3,0xb9aa1},
+{0xa0d4,0xb9ac1},
+{0xa0d5,0xb9ae1},
+{0xa0d6,0xb9b01},
+{0xa0d7,0xb9b21},
+{0xa0d8,0xb9b41},
+{0xa0d9,0xb9b61},
+{0xa0da,0xb9b81},
+{0xa0db,0xb9ba1},
+{0xa0dc,0xb9bc1},
+{0xa0dd,0xb9be1},
+{0xa0de,0xb9c01},
+{0xa0df,0xb9c21},
+{0xa0e0,0xb9c41},
+{0xa0e1,0xb9c61},
+{0xa0e2,0xb9c81},
+{0xa0e3,0xb9ca1},
+{0xa0e4,0xb9cc1},
+{0xa0e5,0xb9ce1},
+{0xa0e6,0xb9d01},
+{0xa0e7,0xb9d21},
+{0xa0e8,0xb9d41},
+{0xa0e9,0xb9d61},
+{0xa0ea,0xb9d81},
+{0xa0eb,0xb9da1},
+{0xa0ec,0xb9dc1},
+{0xa0ed,0xb9de1},
+{0xa0ee,0xb9e01},
+{0xa0ef,0xb9e21},
+{0xa0f0,0xb9e41},
+{0xa0f1,0xb9e61},
+{0xa0f2,0xb9e81},
+{0xa0f3,0xb9ea1},
+{0xa0f4,0xb9ec1},
+{0xa0f5,0xb9ee1},
+{0xa0f6,0xb9f01},
+{0xa0f7,0xb9f21},
+{0xa0f8,0xb9f41},
+{0xa0f9,0xb9f61},
+{0xa0fa,0xb9f81},
+{0xa0fb,0xb9fa1},
+{0xa0fc,0xb9fc1},
+{0xa0fd,0xb9fe1},
+{0xa0fe,0xba001},
+{0xa0ff,0xba021},
+{0xa100,0xba041},
+{0xa101,0xba061},
+{0xa102,0xba081},
+{0xa103,0xba0a1},
+{0xa104,0xba0c1},
+{0xa105,0xba0e1},
+{0xa106,0xba101},
+{0xa107,0xba121},
+{0xa108,0xba141},
+{0xa109,0xba161},
+{0xa10a,0xba181},
+{0xa10b,0xba1a1},
+{0xa10c,0xba1c1},
+{0xa10d,0xba1e1},
+{0xa10e,0xba201},
+{0xa10f,0xba221},
+{0xa110,0xba241},
+{0xa111,0xba261},
+{0xa112,0xba281},
+{0xa113,0xba2a1},
+{0xa114,0xba2c1},
+{0xa115,0xba2e1},
+{0xa116,0xba301},
+{0xa117,0xba321},
+{0xa118,0xba341},
+{0xa119,0xba361},
+{0xa11a,0xba381},
+{0xa11b,0xba3a1},
+{0xa11c,0xba3c1},
+{0xa11d,0xba3e1},
+{0xa11e,0xba401},
+{0xa11f,0xba421},
+{0xa120,0xba441},
+{0xa121,0xba461},
+{0xa122,0xba481},
+{0xa123,0xba4a1},
+{0xa124,0xba4c1},
+{0xa125,0xba4e1},
+{0xa126,0xba501},
+{0xa127,0xba521},
+{0xa128,0xba541},
+{0xa129,0xba561},
+{0xa12a,0xba581},
+{0xa12b,0xba5a1},
+{0xa12c,0xba5c1},
+{0xa12d,0xba5e1},
+{0xa12e,0xba601},
+{0xa12f,0xba621},
+{0xa130,0xba641},
+{0xa131,0xba661},
+{0xa132,0xba681},
+{0xa133,0xba6a1},
+{0xa134,0xba6c1},
+{0xa135,0xba6e1},
+{0xa136,0xba701},
+{0xa137,0xba721},
+{0xa138,0xba741},
+{0xa139,0xba761},
+{0xa13a,0xba781},
+{0xa13b,0xba7a1},
+{0xa13c,0xba7c1},
+{0xa13d,0xba7e1},
+{0xa13e,0xba801},
+{0xa13f,0xba821},
+{0xa140,0xba841},
+{0xa141,0xba861},
+{0xa142,0xba881},
+{0xa143,0xba8a1},
+{0xa144,0xba8c1},
+{0xa145,0xba8e1},
+{0xa146,0xba901},
+{0xa147,0xba921},
+{0xa148,0xba941},
+{0xa149,0xba961},
+{0xa14a,0xba981},
+{0xa14b,0xba9a1},
+{0xa14c,0xba9c1},
+{0xa14d,0xba9e1},
+{0xa14e,0xbaa01},
+{0xa14f,0xbaa21},
+{0xa150,0xbaa41},
+{0xa151,0xbaa61},
+{0xa152,0xbaa81},
+{0xa153,0xbaaa1},
+{0xa154,0xbaac1},
+{0xa155,0xbaae1},
+{0xa156,0xbab01},
+{0xa157,0xbab21},
+{0xa158,0xbab41},
+{0xa159,0xbab61},
+{0xa15a,0xbab81},
+{0xa15b,0xbaba1},
+{0xa15c,0xbabc1},
+{0xa15d,0xbabe1},
+{0xa15e,0xbac01},
+{0xa15f,0xbac21},
+{0xa160,0xbac41},
+{0xa161,0xbac61},
+{0xa162,0xbac81},
+{0xa163,0xbaca1},
+{0xa164,0xbacc1},
+{0xa165,0xbace1},
+{0xa166,0xbad01},
+{0xa167,0xbad21},
+{0xa168,0xbad41},
+{0xa169,0xbad61},
+{0xa16a,0xbad81},
+{0xa16b,0xbada1},
+{0xa16c,0xbadc1},
+{0xa16d,0xbade1},
+{0xa16e,0xbae01},
+{0xa16f,0xbae21},
+{0xa170,0xbae41},
+{0xa171,0xbae61},
+{0xa172,0xbae81},
+{0xa173,0xbaea1},
+{0xa174,0xbaec1},
+{0xa175,0xbaee1},
+{0xa176,0xbaf01},
+{0xa177,0xbaf21},
+{0xa178,0xbaf41},
+{0xa179,0xbaf61},
+{0xa17a,0xbaf81},
+{0xa17b,0xbafa1},
+{0xa17c,0xbafc1},
+{0xa17d,0xbafe1},
+{0xa17e,0xbb001},
+{0xa17f,0xbb021},
+{0xa180,0xbb041},
+{0xa181,0xbb061},
+{0xa182,0xbb081},
+{0xa183,0xbb0a1},
+{0xa184,0xbb0c1},
+{0xa185,0xbb0e1},
+{0xa186,0xbb101},
+{0xa187,0xbb121},
+{0xa188,0xbb141},
+{0xa189,0xbb161},
+{0xa18a,0xbb181},
+{0xa18b,0xbb1a1},
+{0xa18c,0xbb1c1},
+{0xa18d,0xbb1e1},
+{0xa18e,0xbb201},
+{0xa18f,0xbb221},
+{0xa190,0xbb241},
+{0xa191,0xbb261},
+{0xa192,0xbb281},
+{0xa193,0xbb2a1},
+{0xa194,0xbb2c1},
+{0xa195,0xbb2e1},
+{0xa196,0xbb301},
+{0xa197,0xbb321},
+{0xa198,0xbb341},
+{0xa199,0xbb361},
+{0xa19a,0xbb381},
+{0xa19b,0xbb3a1},
+{0xa19c,0xbb3c1},
+{0xa19d,0xbb3e1},
+{0xa19e,0xbb401},
+{0xa19f,0xbb421},
+{0xa1a0,0xbb441},
+{0xa1a1,0xbb461},
+{0xa1a2,0xbb481},
+{0xa1a3,0xbb4a1},
+{0xa1a4,0xbb4c1},
+{0xa1a5,0xbb4e1},
+{0xa1a6,0xbb501},
+{0xa1a7,0xbb521},
+{0xa1a8,0xbb541},
+{0xa1a9,0xbb561},
+{0xa1aa,0xbb581},
+{0xa1ab,0xbb5a1},
+{0xa1ac,0xbb5c1},
+{0xa1ad,0xbb5e1},
+{0xa1ae,0xbb601},
+{0xa1af,0xbb621},
+{0xa1b0,0xbb641},
+{0xa1b1,0xbb661},
+{0xa1b2,0xbb681},
+{0xa1b3,0xbb6a1},
+{0xa1b4,0xbb6c1},
+{0xa1b5,0xbb6e1},
+{0xa1b6,0xbb701},
+{0xa1b7,0xbb721},
+{0xa1b8,0xbb741},
+{0xa1b9,0xbb761},
+{0xa1ba,0xbb781},
+{0xa1bb,0xbb7a1},
+{0xa1bc,0xbb7c1},
+{0xa1bd,0xbb7e1},
+{0xa1be,0xbb801},
+{0xa1bf,0xbb821},
+{0xa1c0,0xbb841},
+{0xa1c1,0xbb861},
+{0xa1c2,0xbb881},
+{0xa1c3,0xbb8a1},
+{0xa1c4,0xbb8c1},
+{0xa1c5,0xbb8e1},
+{0xa1c6,0xbb901},
+{0xa1c7,0xbb921},
+{0xa1c8,0xbb941},
+{0xa1c9,0xbb961},
+{0xa1ca,0xbb981},
+{0xa1cb,0xbb9a1},
+{0xa1cc,0xbb9c1},
+{0xa1cd,0xbb9e1},
+{0xa1ce,0xbba01},
+{0xa1cf,0xbba21},
+{0xa1d0,0xbba41},
+{0xa1d1,0xbba61},
+{0xa1d2,0xbba81},
+{0xa1d3,0xbbaa1},
+{0xa1d4,0xbbac1},
+{0xa1d5,0xbbae1},
+{0xa1d6,0xbbb01},
+{0xa1d7,0xbbb21},
+{0xa1d8,0xbbb41},
+{0xa1d9,0xbbb61},
+{0xa1da,0xbbb81},
+{0xa1db,0xbbba1},
+{0xa1dc,0xbbbc1},
+{0xa1dd,0xbbbe1},
+{0xa1de,0xbbc01},
+{0xa1df,0xbbc21},
+{0xa1e0,0xbbc41},
+{0xa1e1,0xbbc61},
+{0xa1e2,0xbbc81},
+{0xa1e3,0xbbca1},
+{0xa1e4,0xbbcc1},
+{0xa1e5,0xbbce1},
+{0xa1e6,0xbbd01},
+{0xa1e7,0xbbd21},
+{0xa1e8,0xbbd41},
+{0xa1e9,0xbbd61},
+{0xa1ea,0xbbd81},
+{0xa1eb,0xbbda1},
+{0xa1ec,0xbbdc1},
+{0xa1ed,0xbbde1},
+{0xa1ee,0xbbe01},
+{0xa1ef,0xbbe21},
+{0xa1f0,0xbbe41},
+{0xa1f1,0xbbe61},
+{0xa1f2,0xbbe81},
+{0xa1f3,0xbbea1},
+{0xa1f4,0xbbec1},
+{0xa1f5,0xbbee1},
+{0xa1f6,0xbbf01},
+{0xa1f7,0xbbf21},
+{0xa1f8,0xbbf41},
+{0xa1f9,0xbbf61},
+{0xa1fa,0xbbf81},
+{0xa1fb,0xbbfa1},
+{0xa1fc,0xbbfc1},
+{0xa1fd,0xbbfe1},
+{0xa1fe,0xbc001},
+{0xa1ff,0xbc021},
+{0xa200,0xbc041},
+{0xa201,0xbc061},
+{0xa202,0xbc081},
+{0xa203,0xbc0a1},
+{0xa204,0xbc0c1},
+{0xa205,0xbc0e1},
+{0xa206,0xbc101},
+{0xa207,0xbc121},
+{0xa208,0xbc141},
+{0xa209,0xbc161},
+{0xa20a,0xbc181},
+{0xa20b,0xbc1a1},
+{0xa20c,0xbc1c1},
+{0xa20d,0xbc1e1},
+{0xa20e,0xbc201},
+{0xa20f,0xbc221},
+{0xa210,0xbc241},
+{0xa211,0xbc261},
+{0xa212,0xbc281},
+{0xa213,0xbc2a1},
+{0xa214,0xbc2c1},
+{0xa215,0xbc2e1},
+{0xa216,0xbc301},
+{0xa217,0xbc321},
+{0xa218,0xbc341},
+{0xa219,0xbc361},
+{0xa21a,0xbc381},
+{0xa21b,0xbc3a1},
+{0xa21c,0xbc3c1},
+{0xa21d,0xbc3e1},
+{0xa21e,0xbc401},
+{0xa21f,0xbc421},
+{0xa220,0xbc441},
+{0xa221,0xbc461},
+{0xa222,0xbc481},
+{0xa223,0xbc4a1},
+{0xa224,0xbc4c1},
+{0xa225,0xbc4e1},
+{0xa226,0xbc501},
+{0xa227,0xbc521},
+{0xa228,0xbc541},
+{0xa229,0xbc561},
+{0xa22a,0xbc581},
+{0xa22b,0xbc5a1},
+{0xa22c,0xbc5c1},
+{0xa22d,0xbc5e1},
+{0xa22e,0xbc601},
+{0xa22f,0xbc621},
+{0xa230,0xbc641},
+{0xa231,0xbc661},
+{0xa232,0xbc681},
+{0xa233,0xbc6a1},
+{0xa234,0xbc6c1},
+{0xa235,0xbc6e1},
+{0xa236,0xbc701},
+{0xa237,0xbc721},
+{0xa238,0xbc741},
+{0xa239,0xbc761},
+{0xa23a,0xbc781},
+{0xa23b,0xbc7a1},
+{0xa23c,0xbc7c1},
+{0xa23d,0xbc7e1},
+{0xa23e,0xbc801},
+{0xa23f,0xbc821},
+{0xa240,0xbc841},
+{0xa241,0xbc861},
+{0xa242,0xbc881},
+{0xa243,0xbc8a1},
+{0xa244,0xbc8c1},
+{0xa245,0xbc8e1},
+{0xa246,0xbc901},
+{0xa247,0xbc921},
+{0xa248,0xbc941},
+{0xa249,0xbc961},
+{0xa24a,0xbc981},
+{0xa24b,0xbc9a1},
+{0xa24c,0xbc9c1},
+{0xa24d,0xbc9e1},
+{0xa24e,0xbca01},
+{0xa24f,0xbca21},
+{0xa250,0xbca41},
+{0xa251,0xbca61},
+{0xa252,0xbca81},
+{0xa253,0xbcaa1},
+{0xa254,0xbcac1},
+{0xa255,0xbcae1},
+{0xa256,0xbcb01},
+{0xa257,0xbcb21},
+{0xa258,0xbcb41},
+{0xa259,0xbcb61},
+{0xa25a,0xbcb81},
+{0xa25b,0xbcba1},
+{0xa25c,0xbcbc1},
+{0xa25d,0xbcbe1},
+{0xa25e,0xbcc01},
+{0xa25f,0xbcc21},
+{0xa260,0xbcc41},
+{0xa261,0xbcc61},
+{0xa262,0xbcc81},
+{0xa263,0xbcca1},
+{0xa264,0xbccc1},
+{0xa265,0xbcce1},
+{0xa266,0xbcd01},
+{0xa267,0xbcd21},
+{0xa268,0xbcd41},
+{0xa269,0xbcd61},
+{0xa26a,0xbcd81},
+{0xa26b,0xbcda1},
+{0xa26c,0xbcdc1},
+{0xa26d,0xbcde1},
+{0xa26e,0xbce01},
+{0xa26f,0xbce21},
+{0xa270,0xbce41},
+{0xa271,0xbce61},
+{0xa272,0xbce81},
+{0xa273,0xbcea1},
+{0xa274,0xbcec1},
+{0xa275,0xbcee1},
+{0xa276,0xbcf01},
+{0xa277,0xbcf21},
+{0xa278,0xbcf41},
+{0xa279,0xbcf61},
+{0xa27a,0xbcf81},
+{0xa27b,0xbcfa1},
+{0xa27c,0xbcfc1},
+{0xa27d,0xbcfe1},
+{0xa27e,0xbd001},
+{0xa27f,0xbd021},
+{0xa280,0xbd041},
+{0xa281,0xbd061},
+{0xa282,0xbd081},
+{0xa283,0xbd0a1},
+{0xa284,0xbd0c1},
+{0xa285,0xbd0e1},
+{0xa286,0xbd101},
+{0xa287,0xbd121},
+{0xa288,0xbd141},
+{0xa289,0xbd161},
+{0xa28a,0xbd181},
+{0xa28b,0xbd1a1},
+{0xa28c,0xbd1c1},
+{0xa28d,0xbd1e1},
+{0xa28e,0xbd201},
+{0xa28f,0xbd221},
+{0xa290,0xbd241},
+{0xa291,0xbd261},
+{0xa292,0xbd281},
+{0xa293,0xbd2a1},
+{0xa294,0xbd2c1},
+{0xa295,0xbd2e1},
+{0xa296,0xbd301},
+{0xa297,0xbd321},
+{0xa298,0xbd341},
+{0xa299,0xbd361},
+{0xa29a,0xbd381},
+{0xa29b,0xbd3a1},
+{0xa29c,0xbd3c1},
+{0xa29d,0xbd3e1},
+{0xa29e,0xbd401},
+{0xa29f,0xbd421},
+{0xa2a0,0xbd441},
+{0xa2a1,0xbd461},
+{0xa2a2,0xbd481},
+{0xa2a3,0xbd4a1},
+{0xa2a4,0xbd4c1},
+{0xa2a5,0xbd4e1},
+{0xa2a6,0xbd501},
+{0xa2a7,0xbd521},
+{0xa2a8,0xbd541},
+{0xa2a9,0xbd561},
+{0xa2aa,0xbd581},
+{0xa2ab,0xbd5a1},
+{0xa2ac,0xbd5c1},
+{0xa2ad,0xbd5e1},
+{0xa2ae,0xbd601},
+{0xa2af,0xbd621},
+{0xa2b0,0xbd641},
+{0xa2b1,0xbd661},
+{0xa2b2,0xbd681},
+{0xa2b3,0xbd6a1},
+{0xa2b4,0xbd6c1},
+{0xa2b5,0xbd6e1},
+{0xa2b6,0xbd701},
+{0xa2b7,0xbd721},
+{0xa2b8,0xbd741},
+{0xa2b9,0xbd761},
+{0xa2ba,0xbd781},
+{0xa2bb,0xbd7a1},
+{0xa2bc,0xbd7c1},
+{0xa2bd,0xbd7e1},
+{0xa2be,0xbd801},
+{0xa2bf,0xbd821},
+{0xa2c0,0xbd841},
+{0xa2c1,0xbd861},
+{0xa2c2,0xbd881},
+{0xa2c3,0xbd8a1},
+{0xa2c4,0xbd8c1},
+{0xa2c5,0xbd8e1},
+{0xa2c6,0xbd901},
+{0xa2c7,0xbd921},
+{0xa2c8,0xbd941},
+{0xa2c9,0xbd961},
+{0xa2ca,0xbd981},
+{0xa2cb,0xbd9a1},
+{0xa2cc,0xbd9c1},
+{0xa2cd,0xbd9e1},
+{0xa2ce,0xbda01},
+{0xa2cf,0xbda21},
+{0xa2d0,0xbda41},
+{0xa2d1,0xbda61},
+{0xa2d2,0xbda81},
+{0xa2d3,0xbdaa1},
+{0xa2d4,0xbdac1},
+{0xa2d5,0xbdae1},
+{0xa2d6,0xbdb01},
+{0xa2d7,0xbdb21},
+{0xa2d8,0xbdb41},
+{0xa2d9,0xbdb61},
+{0xa2da,0xbdb81},
+{0xa2db,0xbdba1},
+{0xa2dc,0xbdbc1},
+{0xa2dd,0xbdbe1},
+{0xa2de,0xbdc01},
+{0xa2df,0xbdc21},
+{0xa2e0,0xbdc41},
+{0xa2e1,0xbdc61},
+{0xa2e2,0xbdc81},
+{0xa2e3,0xbdca1},
+{0xa2e4,0xbdcc1},
+{0xa2e5,0xbdce1},
+{0xa2e6,0xbdd01},
+{0xa2e7,0xbdd21},
+{0xa2e8,0xbdd41},
+{0xa2e9,0xbdd61},
+{0xa2ea,0xbdd81},
+{0xa2eb,0xbdda1},
+{0xa2ec,0xbddc1},
+{0xa2ed,0xbdde1},
+{0xa2ee,0xbde01},
+{0xa2ef,0xbde21},
+{0xa2f0,0xbde41},
+{0xa2f1,0xbde61},
+{0xa2f2,0xbde81},
+{0xa2f3,0xbdea1},
+{0xa2f4,0xbdec1},
+{0xa2f5,0xbdee1},
+{0xa2f6,0xbdf01},
+{0xa2f7,0xbdf21},
+{0xa2f8,0xbdf41},
+{0xa2f9,0xbdf61},
+{0xa2fa,0xbdf81},
+{0xa2fb,0xbdfa1},
+{0xa2fc,0xbdfc1},
+{0xa2fd,0xbdfe1},
+{0xa2fe,0xbe001},
+{0xa2ff,0xbe021},
+{0xa300,0xbe041},
+{0xa301,0xbe061},
+{0xa302,0xbe081},
+{0xa303,0xbe0a1},
+{0xa304,0xbe0c1},
+{0xa305,0xbe0e1},
+{0xa306,0xbe101},
+{0xa307,0xbe121},
+{0xa308,0xbe141},
+{0xa309,0xbe161},
+{0xa30a,0xbe181},
+{0xa30b,0xbe1a1},
+{0xa30c,0xbe1c1},
+{0xa30d,0xbe1e1},
+{0xa30e,0xbe201},
+{0xa30f,0xbe221},
+{0xa310,0xbe241},
+{0xa311,0xbe261},
+{0xa312,0xbe281},
+{0xa313,0xbe2a1},
+{0xa314,0xbe2c1},
+{0xa315,0xbe2e1},
+{0xa316,0xbe301},
+{0xa317,0xbe321},
+{0xa318,0xbe341},
+{0xa319,0xbe361},
+{0xa31a,0xbe381},
+{0xa31b,0xbe3a1},
+{0xa31c,0xbe3c1},
+{0xa31d,0xbe3e1},
+{0xa31e,0xbe401},
+{0xa31f,0xbe421},
+{0xa320,0xbe441},
+{0xa321,0xbe461},
+{0xa322,0xbe481},
+{0xa323,0xbe4a1},
+{0xa324,0xbe4c1},
+{0xa325,0xbe4e1},
+{0xa326,0xbe501},
+{0xa327,0xbe521},
+{0xa328,0xbe541},
+{0xa329,0xbe561},
+{0xa32a,0xbe581},
+{0xa32b,0xbe5a1},
+{0xa32c,0xbe5c1},
+{0xa32d,0xbe5e1},
+{0xa32e,0xbe601},
+{0xa32f,0xbe621},
+{0xa330,0xbe641},
+{0xa331,0xbe661},
+{0xa332,0xbe681},
+{0xa333,0xbe6a1},
+{0xa334,0xbe6c1},
+{0xa335,0xbe6e1},
+{0xa336,0xbe701},
+{0xa337,0xbe721},
+{0xa338,0xbe741},
+{0xa339,0xbe761},
+{0xa33a,0xbe781},
+{0xa33b,0xbe7a1},
+{0xa33c,0xbe7c1},
+{0xa33d,0xbe7e1},
+{0xa33e,0xbe801},
+{0xa33f,0xbe821},
+{0xa340,0xbe841},
+{0xa341,0xbe861},
+{0xa342,0xbe881},
+{0xa343,0xbe8a1},
+{0xa344,0xbe8c1},
+{0xa345,0xbe8e1},
+{0xa346,0xbe901},
+{0xa347,0xbe921},
+{0xa348,0xbe941},
+{0xa349,0xbe961},
+{0xa34a,0xbe981},
+{0xa34b,0xbe9a1},
+{0xa34c,0xbe9c1},
+{0xa34d,0xbe9e1},
+{0xa34e,0xbea01},
+{0xa34f,0xbea21},
+{0xa350,0xbea41},
+{0xa351,0xbea61},
+{0xa352,0xbea81},
+{0xa353,0xbeaa1},
+{0xa354,0xbeac1},
+{0xa355,0xbeae1},
+{0xa356,0xbeb01},
+{0xa357,0xbeb21},
+{0xa358,0xbeb41},
+{0xa359,0xbeb61},
+{0xa35a,0xbeb81},
+{0xa35b,0xbeba1},
+{0xa35c,0xbebc1},
+{0xa35d,0xbebe1},
+{0xa35e,0xbec01},
+{0xa35f,0xbec21},
+{0xa360,0xbec41},
+{0xa361,0xbec61},
+{0xa362,0xbec81},
+{0xa363,0xbeca1},
+{0xa364,0xbecc1},
+{0xa365,0xbece1},
+{0xa366,0xbed01},
+{0xa367,0xbed21},
+{0xa368,0xbed41},
+{0xa369,0xbed61},
+{0xa36a,0xbed81},
+{0xa36b,0xbeda1},
+{0xa36c,0xbedc1},
+{0xa36d,0xbede1},
+{0xa36e,0xbee01},
+{0xa36f,0xbee21},
+{0xa370,0xbee41},
+{0xa371,0xbee61},
+{0xa372,0xbee81},
+{0xa373,0xbeea1},
+{0xa374,0xbeec1},
+{0xa375,0xbeee1},
+{0xa376,0xbef01},
+{0xa377,0xbef21},
+{0xa378,0xbef41},
+{0xa379,0xbef61},
+{0xa37a,0xbef81},
+{0xa37b,0xbefa1},
+{0xa37c,0xbefc1},
+{0xa37d,0xbefe1},
+{0xa37e,0xbf001},
+{0xa37f,0xbf021},
+{0xa380,0xbf041},
+{0xa381,0xbf061},
+{0xa382,0xbf081},
+{0xa383,0xbf0a1},
+{0xa384,0xbf0c1},
+{0xa385,0xbf0e1},
+{0xa386,0xbf101},
+{0xa387,0xbf121},
+{0xa388,0xbf141},
+{0xa389,0xbf161},
+{0xa38a,0xbf181},
+{0xa38b,0xbf1a1},
+{0xa38c,0xbf1c1},
+{0xa38d,0xbf1e1},
+{0xa38e,0xbf201},
+{0xa38f,0xbf221},
+{0xa390,0xbf241},
+{0xa391,0xbf261},
+{0xa392,0xbf281},
+{0xa393,0xbf2a1},
+{0xa394,0xbf2c1},
+{0xa395,0xbf2e1},
+{0xa396,0xbf301},
+{0xa397,0xbf321},
+{0xa398,0xbf341},
+{0xa399,0xbf361},
+{0xa39a,0xbf381},
+{0xa39b,0xbf3a1},
+{0xa39c,0xbf3c1},
+{0xa39d,0xbf3e1},
+{0xa39e,0xbf401},
+{0xa39f,0xbf421},
+{0xa3a0,0xbf441},
+{0xa3a1,0xbf461},
+{0xa3a2,0xbf481},
+{0xa3a3,0xbf4a1},
+{0xa3a4,0xbf4c1},
+{0xa3a5,0xbf4e1},
+{0xa3a6,0xbf501},
+{0xa3a7,0xbf521},
+{0xa3a8,0xbf541},
+{0xa3a9,0xbf561},
+{0xa3aa,0xbf581},
+{0xa3ab,0xbf5a1},
+{0xa3ac,0xbf5c1},
+{0xa3ad,0xbf5e1},
+{0xa3ae,0xbf601},
+{0xa3af,0xbf621},
+{0xa3b0,0xbf641},
+{0xa3b1,0xbf661},
+{0xa3b2,0xbf681},
+{0xa3b3,0xbf6a1},
+{0xa3b4,0xbf6c1},
+{0xa3b5,0xbf6e1},
+{0xa3b6,0xbf701},
+{0xa3b7,0xbf721},
+{0xa3b8,0xbf741},
+{0xa3b9,0xbf761},
+{0xa3ba,0xbf781},
+{0xa3bb,0xbf7a1},
+{0xa3bc,0xbf7c1},
+{0xa3bd,0xbf7e1},
+{0xa3be,0xbf801},
+{0xa3bf,0xbf821},
+{0xa3c0,0xbf841},
+{0xa3c1,0xbf861},
+{0xa3c2,0xbf881},
+{0xa3c3,0xbf8a1},
+{0xa3c4,0xbf8c1},
+{0xa3c5,0xbf8e1},
+{0xa3c6,0xbf901},
+{0xa3c7,0xbf921},
+{0xa3c8,0xbf941},
+{0xa3c9,0xbf961},
+{0xa3ca,0xbf981},
+{0xa3cb,0xbf9a1},
+{0xa3cc,0xbf9c1},
+{0xa3cd,0xbf9e1},
+{0xa3ce,0xbfa01},
+{0xa3cf,0xbfa21},
+{0xa3d0,0xbfa41},
+{0xa3d1,0xbfa61},
+{0xa3d2,0xbfa81},
+{0xa3d3,0xbfaa1},
+{0xa3d4,0xbfac1},
+{0xa3d5,0xbfae1},
+{0xa3d6,0xbfb01},
+{0xa3d7,0xbfb21},
+{0xa3d8,0xbfb41},
+{0xa3d9,0xbfb61},
+{0xa3da,0xbfb81},
+{0xa3db,0xbfba1},
+{0xa3dc,0xbfbc1},
+{0xa3dd,0xbfbe1},
+{0xa3de,0xbfc01},
+{0xa3df,0xbfc21},
+{0xa3e0,0xbfc41},
+{0xa3e1,0xbfc61},
+{0xa3e2,0xbfc81},
+{0xa3e3,0xbfca1},
+{0xa3e4,0xbfcc1},
+{0xa3e5,0xbfce1},
+{0xa3e6,0xbfd01},
+{0xa3e7,0xbfd21},
+{0xa3e8,0xbfd41},
+{0xa3e9,0xbfd61},
+{0xa3ea,0xbfd81},
+{0xa3eb,0xbfda1},
+{0xa3ec,0xbfdc1},
+{0xa3ed,0xbfde1},
+{0xa3ee,0xbfe01},
+{0xa3ef,0xbfe21},
+{0xa3f0,0xbfe41},
+{0xa3f1,0xbfe61},
+{0xa3f2,0xbfe81},
+{0xa3f3,0xbfea1},
+{0xa3f4,0xbfec1},
+{0xa3f5,0xbfee1},
+{0xa3f6,0xbff01},
+{0xa3f7,0xbff21},
+{0xa3f8,0xbff41},
+{0xa3f9,0xbff61},
+{0xa3fa,0xbff81},
+{0xa3fb,0xbffa1},
+{0xa3fc,0xbffc1},
+{0xa3fd,0xbffe1},
+{0xa3fe,0xc0001},
+{0xa3ff,0xc0021},
+{0xa400,0xc0041},
+{0xa401,0xc0061},
+{0xa402,0xc0081},
+{0xa403,0xc00a1},
+{0xa404,0xc00c1},
+{0xa405,0xc00e1},
+{0xa406,0xc0101},
+{0xa407,0xc0121},
+{0xa408,0xc0141},
+{0xa409,0xc0161},
+{0xa40a,0xc0181},
+{0xa40b,0xc01a1},
+{0xa40c,0xc01c1},
+{0xa40d,0xc01e1},
+{0xa40e,0xc0201},
+{0xa40f,0xc0221},
+{0xa410,0xc0241},
+{0xa411,0xc0261},
+{0xa412,0xc0281},
+{0xa413,0xc02a1},
+{0xa414,0xc02c1},
+{0xa415,0xc02e1},
+{0xa416,0xc0301},
+{0xa417,0xc0321},
+{0xa418,0xc0341},
+{0xa419,0xc0361},
+{0xa41a,0xc0381},
+{0xa41b,0xc03a1},
+{0xa41c,0xc03c1},
+{0xa41d,0xc03e1},
+{0xa41e,0xc0401},
+{0xa41f,0xc0421},
+{0xa420,0xc0441},
+{0xa421,0xc0461},
+{0xa422,0xc0481},
+{0xa423,0xc04a1},
+{0xa424,0xc04c1},
+{0xa425,0xc04e1},
+{0xa426,0xc0501},
+{0xa427,0xc0521},
+{0xa428,0xc0541},
+{0xa429,0xc0561},
+{0xa42a,0xc0581},
+{0xa42b,0xc05a1},
+{0xa42c,0xc05c1},
+{0xa42d,0xc05e1},
+{0xa42e,0xc0601},
+{0xa42f,0xc0621},
+{0xa430,0xc0641},
+{0xa431,0xc0661},
+{0xa432,0xc0681},
+{0xa433,0xc06a1},
+{0xa434,0xc06c1},
+{0xa435,0xc06e1},
+{0xa436,0xc0701},
+{0xa437,0xc0721},
+{0xa438,0xc0741},
+{0xa439,0xc0761},
+{0xa43a,0xc0781},
+{0xa43b,0xc07a1},
+{0xa43c,0xc07c1},
+{0xa43d,0xc07e1},
+{0xa43e,0xc0801},
+{0xa43f,0xc0821},
+{0xa440,0xc0841},
+{0xa441,0xc0861},
+{0xa442,0xc0881},
+{0xa443,0xc08a1},
+{0xa444,0xc08c1},
+{0xa445,0xc08e1},
+{0xa446,0xc0901},
+{0xa447,0xc0921},
+{0xa448,0xc0941},
+{0xa449,0xc0961},
+{0xa44a,0xc0981},
+{0xa44b,0xc09a1},
+{0xa44c,0xc09c1},
+{0xa44d,0xc09e1},
+{0xa44e,0xc0a01},
+{0xa44f,0xc0a21},
+{0xa450,0xc0a41},
+{0xa451,0xc0a61},
+{0xa452,0xc0a81},
+{0xa453,0xc0aa1},
+{0xa454,0xc0ac1},
+{0xa455,0xc0ae1},
+{0xa456,0xc0b01},
+{0xa457,0xc0b21},
+{0xa458,0xc0b41},
+{0xa459,0xc0b61},
+{0xa45a,0xc0b81},
+{0xa45b,0xc0ba1},
+{0xa45c,0xc0bc1},
+{0xa45d,0xc0be1},
+{0xa45e,0xc0c01},
+{0xa45f,0xc0c21},
+{0xa460,0xc0c41},
+{0xa461,0xc0c61},
+{0xa462,0xc0c81},
+{0xa463,0xc0ca1},
+{0xa464,0xc0cc1},
+{0xa465,0xc0ce1},
+{0xa466,0xc0d01},
+{0xa467,0xc0d21},
+{0xa468,0xc0d41},
+{0xa469,0xc0d61},
+{0xa46a,0xc0d81},
+{0xa46b,0xc0da1},
+{0xa46c,0xc0dc1},
+{0xa46d,0xc0de1},
+{0xa46e,0xc0e01},
+{0xa46f,0xc0e21},
+{0xa470,0xc0e41},
+{0xa471,0xc0e61},
+{0xa472,0xc0e81},
+{0xa473,0xc0ea1},
+{0xa474,0xc0ec1},
+{0xa475,0xc0ee1},
+{0xa476,0xc0f01},
+{0xa477,0xc0f21},
+{0xa478,0xc0f41},
+{0xa479,0xc0f61},
+{0xa47a,0xc0f81},
+{0xa47b,0xc0fa1},
+{0xa47c,0xc0fc1},
+{0xa47d,0xc0fe1},
+{0xa47e,0xc1001},
+{0xa47f,0xc1021},
+{0xa480,0xc1041},
+{0xa481,0xc1061},
+{0xa482,0xc1081},
+{0xa483,0xc10a1},
+{0xa484,0xc10c1},
+{0xa485,0xc10e1},
+{0xa486,0xc1101},
+{0xa487,0xc1121},
+{0xa488,0xc1141},
+{0xa489,0xc1161},
+{0xa48a,0xc1181},
+{0xa48b,0xc11a1},
+{0xa48c,0xc11c1},
+{0xa490,0x19961},
+{0xa491,0x19981},
+{0xa492,0x199a1},
+{0xa493,0x199c1},
+{0xa494,0x199e1},
+{0xa495,0x19a01},
+{0xa496,0x19a21},
+{0xa497,0x19a41},
+{0xa498,0x19a61},
+{0xa499,0x19a81},
+{0xa49a,0x19aa1},
+{0xa49b,0x19ac1},
+{0xa49c,0x19ae1},
+{0xa49d,0x19b01},
+{0xa49e,0x19b21},
+{0xa49f,0x19b41},
+{0xa4a0,0x19b61},
+{0xa4a1,0x19b81},
+{0xa4a2,0x19ba1},
+{0xa4a3,0x19bc1},
+{0xa4a4,0x19be1},
+{0xa4a5,0x19c01},
+{0xa4a6,0x19c21},
+{0xa4a7,0x19c41},
+{0xa4a8,0x19c61},
+{0xa4a9,0x19c81},
+{0xa4aa,0x19ca1},
+{0xa4ab,0x19cc1},
+{0xa4ac,0x19ce1},
+{0xa4ad,0x19d01},
+{0xa4ae,0x19d21},
+{0xa4af,0x19d41},
+{0xa4b0,0x19d61},
+{0xa4b1,0x19d81},
+{0xa4b2,0x19da1},
+{0xa4b3,0x19dc1},
+{0xa4b4,0x19de1},
+{0xa4b5,0x19e01},
+{0xa4b6,0x19e21},
+{0xa4b7,0x19e41},
+{0xa4b8,0x19e61},
+{0xa4b9,0x19e81},
+{0xa4ba,0x19ea1},
+{0xa4bb,0x19ec1},
+{0xa4bc,0x19ee1},
+{0xa4bd,0x19f01},
+{0xa4be,0x19f21},
+{0xa4bf,0x19f41},
+{0xa4c0,0x19f61},
+{0xa4c1,0x19f81},
+{0xa4c2,0x19fa1},
+{0xa4c3,0x19fc1},
+{0xa4c4,0x19fe1},
+{0xa4c5,0x1a001},
+{0xa4c6,0x1a021},
+{0xa4d0,0xc12a1},
+{0xa4d1,0xc12c1},
+{0xa4d2,0xc12e1},
+{0xa4d3,0xc1301},
+{0xa4d4,0xc1321},
+{0xa4d5,0xc1341},
+{0xa4d6,0xc1361},
+{0xa4d7,0xc1381},
+{0xa4d8,0xc13a1},
+{0xa4d9,0xc13c1},
+{0xa4da,0xc13e1},
+{0xa4db,0xc1401},
+{0xa4dc,0xc1421},
+{0xa4dd,0xc1441},
+{0xa4de,0xc1461},
+{0xa4df,0xc1481},
+{0xa4e0,0xc14a1},
+{0xa4e1,0xc14c1},
+{0xa4e2,0xc14e1},
+{0xa4e3,0xc1501},
+{0xa4e4,0xc1521},
+{0xa4e5,0xc1541},
+{0xa4e6,0xc1561},
+{0xa4e7,0xc1581},
+{0xa4e8,0xc15a1},
+{0xa4e9,0xc15c1},
+{0xa4ea,0xc1621},
+{0xa4eb,0xc15e1},
+{0xa4ec,0xc1641},
+{0xa4ed,0xc1601},
+{0xa4ee,0xc1661},
+{0xa4ef,0xc1681},
+{0xa4f0,0xc16a1},
+{0xa4f1,0xc16c1},
+{0xa4f2,0xc16e1},
+{0xa4f3,0xc1701},
+{0xa4f4,0xc1721},
+{0xa4f5,0xc1741},
+{0xa4f6,0xc1761},
+{0xa4f7,0xc1781},
+{0xa4f8,0xc11e1},
+{0xa4f9,0xc1201},
+{0xa4fa,0xc1221},
+{0xa4fb,0xc1241},
+{0xa4fc,0xc1281},
+{0xa4fd,0xc1261},
+{0xa4fe,0x1a041},
+{0xa4ff,0x1a061},
+{0xa500,0xa35e1},
+{0xa501,0xa3601},
+{0xa502,0xa3621},
+{0xa503,0xa3641},
+{0xa504,0xa3661},
+{0xa505,0xa3681},
+{0xa506,0xa36a1},
+{0xa507,0xa36c1},
+{0xa508,0xa36e1},
+{0xa509,0xa3701},
+{0xa50a,0xa3721},
+{0xa50b,0xa3741},
+{0xa50c,0xa3761},
+{0xa50d,0xa37c1},
+{0xa50e,0xa37e1},
+{0xa50f,0xa3801},
+{0xa510,0xa3821},
+{0xa511,0xa3841},
+{0xa512,0xa3861},
+{0xa513,0xa3881},
+{0xa514,0xa38a1},
+{0xa515,0xa38c1},
+{0xa516,0xa38e1},
+{0xa517,0xa3901},
+{0xa518,0xa3921},
+{0xa519,0xa3941},
+{0xa51a,0xa3961},
+{0xa51b,0xa3981},
+{0xa51c,0xa39a1},
+{0xa51d,0xa39c1},
+{0xa51e,0xa39e1},
+{0xa51f,0xa3a41},
+{0xa520,0xa3a61},
+{0xa521,0xa3a81},
+{0xa522,0xa3aa1},
+{0xa523,0xa3ac1},
+{0xa524,0xa3ae1},
+{0xa525,0xa3b01},
+{0xa526,0xa3b21},
+{0xa527,0xa3b41},
+{0xa528,0xa3b61},
+{0xa529,0xa3b81},
+{0xa52a,0xa3ba1},
+{0xa52b,0xa3bc1},
+{0xa52c,0xa3be1},
+{0xa52d,0xa3c01},
+{0xa52e,0xa3c21},
+{0xa52f,0xa3c41},
+{0xa530,0xa3c61},
+{0xa531,0xa3c81},
+{0xa532,0xa3ca1},
+{0xa533,0xa3cc1},
+{0xa534,0xa3d21},
+{0xa535,0xa3d41},
+{0xa536,0xa3d61},
+{0xa537,0xa3d81},
+{0xa538,0xa3da1},
+{0xa539,0xa3dc1},
+{0xa53a,0xa3de1},
+{0xa53b,0xa3e01},
+{0xa53c,0xa3e21},
+{0xa53d,0xa3e41},
+{0xa53e,0xa3e61},
+{0xa53f,0xa3e81},
+{0xa540,0xa3ea1},
+{0xa541,0xa3ec1},
+{0xa542,0xa3ee1},
+{0xa543,0xa3f01},
+{0xa544,0xa3f21},
+{0xa545,0xa3f41},
+{0xa546,0xa3f61},
+{0xa547,0xa3f81},
+{0xa548,0xa3fe1},
+{0xa549,0xa4001},
+{0xa54a,0xa4021},
+{0xa54b,0xa4041},
+{0xa54c,0xa4061},
+{0xa54d,0xa4081},
+{0xa54e,0xa40a1},
+{0xa54f,0xa40c1},
+{0xa550,0xa40e1},
+{0xa551,0xa4101},
+{0xa552,0xa4121},
+{0xa553,0xa4181},
+{0xa554,0xa41a1},
+{0xa555,0xa41c1},
+{0xa556,0xa41e1},
+{0xa557,0xa4201},
+{0xa558,0xa4221},
+{0xa559,0xa42a1},
+{0xa55a,0xa42c1},
+{0xa55b,0xa4321},
+{0xa55c,0xa4341},
+{0xa55d,0xa4361},
+{0xa55e,0xa4381},
+{0xa55f,0xa43a1},
+{0xa560,0xa43c1},
+{0xa561,0xa4421},
+{0xa562,0xa4441},
+{0xa563,0xa4461},
+{0xa564,0xa4481},
+{0xa565,0xa44a1},
+{0xa566,0xa44c1},
+{0xa567,0xa44e1},
+{0xa568,0xa4501},
+{0xa569,0xa4521},
+{0xa56a,0xa4541},
+{0xa56b,0xa4581},
+{0xa56c,0xa45a1},
+{0xa56d,0xa45c1},
+{0xa56e,0xa45e1},
+{0xa56f,0xa4621},
+{0xa570,0xa4641},
+{0xa571,0xa4661},
+{0xa572,0xa4681},
+{0xa573,0xa46a1},
+{0xa574,0xa46c1},
+{0xa575,0xa46e1},
+{0xa576,0xa4701},
+{0xa577,0xa4721},
+{0xa578,0xa4741},
+{0xa579,0xa4761},
+{0xa57a,0xa4781},
+{0xa57b,0xa47a1},
+{0xa57c,0xa47c1},
+{0xa57d,0xa47e1},
+{0xa57e,0xa4801},
+{0xa57f,0xa4821},
+{0xa580,0xa4841},
+{0xa581,0xa4861},
+{0xa582,0xa4881},
+{0xa583,0xa48a1},
+{0xa584,0xa48c1},
+{0xa585,0xa48e1},
+{0xa586,0xa4941},
+{0xa587,0xa4961},
+{0xa588,0xa49a1},
+{0xa589,0xa49c1},
+{0xa58a,0xa49e1},
+{0xa58b,0xa4a01},
+{0xa58c,0xa4a21},
+{0xa58d,0xa4a41},
+{0xa58e,0xa4a61},
+{0xa58f,0xa4a81},
+{0xa590,0xa4aa1},
+{0xa591,0xa4ac1},
+{0xa592,0xa4ae1},
+{0xa593,0xa4b01},
+{0xa594,0xa4b21},
+{0xa595,0xa4b41},
+{0xa596,0xa4b61},
+{0xa597,0xa4b81},
+{0xa598,0xa4ba1},
+{0xa599,0xa4bc1},
+{0xa59a,0xa4be1},
+{0xa59b,0xa4c01},
+{0xa59c,0xa4c21},
+{0xa59d,0xa4c41},
+{0xa59e,0xa4c61},
+{0xa59f,0xa4c81},
+{0xa5a0,0xa4ca1},
+{0xa5a1,0xa4cc1},
+{0xa5a2,0xa4ce1},
+{0xa5a3,0xa4d01},
+{0xa5a4,0xa4d21},
+{0xa5a5,0xa4d41},
+{0xa5a6,0xa4d61},
+{0xa5a7,0xa4d81},
+{0xa5a8,0xa4da1},
+{0xa5a9,0xa4dc1},
+{0xa5aa,0xa4de1},
+{0xa5ab,0xa4e01},
+{0xa5ac,0xa4e21},
+{0xa5ad,0xa4e41},
+{0xa5ae,0xa4e61},
+{0xa5af,0xa4e81},
+{0xa5b0,0xa4ea1},
+{0xa5b1,0xa4ec1},
+{0xa5b2,0xa4ee1},
+{0xa5b3,0xa4f01},
+{0xa5b4,0xa4f21},
+{0xa5b5,0xa4f81},
+{0xa5b6,0xa4fa1},
+{0xa5b7,0xa4fc1},
+{0xa5b8,0xa4fe1},
+{0xa5b9,0xa5001},
+{0xa5ba,0xa5021},
+{0xa5bb,0xa5041},
+{0xa5bc,0xa5061},
+{0xa5bd,0xa5081},
+{0xa5be,0xa50a1},
+{0xa5bf,0xa50c1},
+{0xa5c0,0xa50e1},
+{0xa5c1,0xa5101},
+{0xa5c2,0xa5121},
+{0xa5c3,0xa5141},
+{0xa5c4,0xa5161},
+{0xa5c5,0xa5181},
+{0xa5c6,0xa51a1},
+{0xa5c7,0xa51c1},
+{0xa5c8,0xa51e1},
+{0xa5c9,0xa5201},
+{0xa5ca,0xa5221},
+{0xa5cb,0xa5241},
+{0xa5cc,0xa52a1},
+{0xa5cd,0xa52c1},
+{0xa5ce,0xa52e1},
+{0xa5cf,0xa5301},
+{0xa5d0,0xa5321},
+{0xa5d1,0xa5341},
+{0xa5d2,0xa53c1},
+{0xa5d3,0xa53e1},
+{0xa5d4,0xa5401},
+{0xa5d5,0xa5421},
+{0xa5d6,0xa5441},
+{0xa5d7,0xa5461},
+{0xa5d8,0xa5481},
+{0xa5d9,0xa54e1},
+{0xa5da,0xa5501},
+{0xa5db,0xa5521},
+{0xa5dc,0xa5541},
+{0xa5dd,0xa5561},
+{0xa5de,0xa5581},
+{0xa5df,0xa55a1},
+{0xa5e0,0xa55c1},
+{0xa5e1,0xa55e1},
+{0xa5e2,0xa5601},
+{0xa5e3,0xa5621},
+{0xa5e4,0xa5641},
+{0xa5e5,0xa5661},
+{0xa5e6,0xa5681},
+{0xa5e7,0xa56a1},
+{0xa5e8,0xa56c1},
+{0xa5e9,0xa56e1},
+{0xa5ea,0xa5701},
+{0xa5eb,0xa5721},
+{0xa5ec,0xa5741},
+{0xa5ed,0xa5761},
+{0xa5ee,0xa5781},
+{0xa5ef,0xa57a1},
+{0xa5f0,0xa57c1},
+{0xa5f1,0xa57e1},
+{0xa5f2,0xa5801},
+{0xa5f3,0xa5821},
+{0xa5f4,0xa5841},
+{0xa5f5,0xa5861},
+{0xa5f6,0xa5881},
+{0xa5f7,0xa58a1},
+{0xa5f8,0xa58c1},
+{0xa5f9,0xa58e1},
+{0xa5fa,0xa5901},
+{0xa5fb,0xa5921},
+{0xa5fc,0xa5941},
+{0xa5fd,0xa5961},
+{0xa5fe,0xa5981},
+{0xa5ff,0xa59a1},
+{0xa600,0xa59c1},
+{0xa601,0xa59e1},
+{0xa602,0xa5a01},
+{0xa603,0xa5a21},
+{0xa604,0xa5a41},
+{0xa605,0xa5a61},
+{0xa606,0xa5a81},
+{0xa607,0xa5aa1},
+{0xa608,0xa5ac1},
+{0xa609,0xa5ae1},
+{0xa60a,0xa5b01},
+{0xa60b,0xa5b21},
+{0xa60c,0xa5b41},
+{0xa60d,0x1a081},
+{0xa60e,0x1a0a1},
+{0xa60f,0x1a0c1},
+{0xa610,0xa4241},
+{0xa611,0xa4561},
+{0xa612,0xa4981},
+{0xa613,0xa3782},
+{0xa614,0xa3a02},
+{0xa615,0xa3ce2},
+{0xa616,0xa3fa2},
+{0xa617,0xa4142},
+{0xa618,0xa4262},
+{0xa619,0xa42e2},
+{0xa61a,0xa43e2},
+{0xa61b,0xa4902},
+{0xa61c,0xa4f42},
+{0xa61d,0xa5262},
+{0xa61e,0xa5382},
+{0xa61f,0xa54a2},
+{0xa620,0x380c1},
+{0xa621,0x382e1},
+{0xa622,0x3a041},
+{0xa623,0x3aec1},
+{0xa624,0x3b641},
+{0xa625,0x3bc01},
+{0xa626,0x3bfe1},
+{0xa627,0x3c301},
+{0xa628,0x3c681},
+{0xa629,0x3c9a1},
+{0xa62a,0xa4601},
+{0xa62b,0xa5361},
+{0xa640,0x5a681},
+{0xa641,0x5a661},
+{0xa642,0x5a741},
+{0xa643,0x5a721},
+{0xa644,0x5a7c1},
+{0xa645,0x5a7a1},
+{0xa646,0x5ac21},
+{0xa647,0x5ac01},
+{0xa648,0x5ad01},
+{0xa649,0x5acc1},
+{0xa64a,0x5bf41},
+{0xa64b,0x5bf01},
+{0xa64c,0x5c2a1},
+{0xa64d,0x5c281},
+{0xa64e,0x5c8e1},
+{0xa64f,0x5c8c1},
+{0xa650,0x5c9e1},
+{0xa651,0x5c9c1},
+{0xa652,0x5cc21},
+{0xa653,0x5cc01},
+{0xa654,0x5cd81},
+{0xa655,0x5cd61},
+{0xa656,0x5cde1},
+{0xa657,0x5cda1},
+{0xa658,0x5cf61},
+{0xa659,0x5cf41},
+{0xa65a,0x5d001},
+{0xa65b,0x5cfe1},
+{0xa65c,0x5d081},
+{0xa65d,0x5d061},
+{0xa65e,0x5d2c1},
+{0xa65f,0x5d2a1},
+{0xa660,0x5c3c1},
+{0xa661,0x5c3a1},
+{0xa662,0x5a081},
+{0xa663,0x5a061},
+{0xa664,0x5b1a1},
+{0xa665,0x5b181},
+{0xa666,0x5b301},
+{0xa667,0x5b2e1},
+{0xa668,0x5b601},
+{0xa669,0x5b5c1},
+{0xa66a,0x5b601},
+{0xa66b,0x5b5c1},
+{0xa66c,0x5b601},
+{0xa66d,0x5b5c1},
+{0xa66e,0x5b5c1},
+{0xa66f,0x35b01},
+{0xa670,0x1},
+{0xa671,0x1},
+{0xa672,0x1},
+{0xa673,0x1a0e1},
+{0xa674,0x5a321},
+{0xa675,0x5a901},
+{0xa676,0x5ab82},
+{0xa677,0x5bc41},
+{0xa678,0x5c961},
+{0xa679,0x5ca21},
+{0xa67a,0x5cb01},
+{0xa67b,0x5c201},
+{0xa67c,0x35701},
+{0xa67d,0x35701},
+{0xa67e,0x1a101},
+{0xa67f,0x5c921},
+{0xa680,0x5a001},
+{0xa681,0x59fe1},
+{0xa682,0x5a8c1},
+{0xa683,0x5a8a1},
+{0xa684,0x5a521},
+{0xa685,0x5a501},
+{0xa686,0x5c6e1},
+{0xa687,0x5c6c1},
+{0xa688,0x5a841},
+{0xa689,0x5a821},
+{0xa68a,0x5bbc1},
+{0xa68b,0x5bba1},
+{0xa68c,0x5bb01},
+{0xa68d,0x5bae1},
+{0xa68e,0x5c401},
+{0xa68f,0x5c3e1},
+{0xa690,0x5c481},
+{0xa691,0x5c461},
+{0xa692,0x5c5e1},
+{0xa693,0x5c5c1},
+{0xa694,0x5c1c1},
+{0xa695,0x5c1a1},
+{0xa696,0x5c841},
+{0xa697,0x5c821},
+{0xa698,0x5b601},
+{0xa699,0x5b5c1},
+{0xa69a,0x5b601},
+{0xa69b,0x5b5c1},
+{0xa69c,0x5c9a1},
+{0xa69d,0x5cb41},
+{0xa69e,0x5bfc1},
+{0xa69f,0x5cea1},
+{0xa6a0,0xa5b61},
+{0xa6a1,0xa5b81},
+{0xa6a2,0xa5ba1},
+{0xa6a3,0xa5bc1},
+{0xa6a4,0xa5be1},
+{0xa6a5,0xa5c01},
+{0xa6a6,0xa5c21},
+{0xa6a7,0xa5c41},
+{0xa6a8,0xa5c61},
+{0xa6a9,0xa5c81},
+{0xa6aa,0xa5ca1},
+{0xa6ab,0xa5cc1},
+{0xa6ac,0xa5ce1},
+{0xa6ad,0xa5d01},
+{0xa6ae,0xa5d21},
+{0xa6af,0xa5d41},
+{0xa6b0,0xa5d61},
+{0xa6b1,0xa5d81},
+{0xa6b2,0xa5da1},
+{0xa6b3,0xa5dc1},
+{0xa6b4,0xa5de1},
+{0xa6b5,0xa5e01},
+{0xa6b6,0xa5e21},
+{0xa6b7,0xa5e41},
+{0xa6b8,0xa5e61},
+{0xa6b9,0xa5e81},
+{0xa6ba,0xa5ea1},
+{0xa6bb,0xa5ec1},
+{0xa6bc,0xa5ee1},
+{0xa6bd,0xa5f01},
+{0xa6be,0xa5f21},
+{0xa6bf,0xa5f41},
+{0xa6c0,0xa5f61},
+{0xa6c1,0xa5f81},
+{0xa6c2,0xa5fa1},
+{0xa6c3,0xa5fc1},
+{0xa6c4,0xa5fe1},
+{0xa6c5,0xa6001},
+{0xa6c6,0xa6021},
+{0xa6c7,0xa6041},
+{0xa6c8,0xa6061},
+{0xa6c9,0xa6081},
+{0xa6ca,0xa60a1},
+{0xa6cb,0xa60c1},
+{0xa6cc,0xa60e1},
+{0xa6cd,0xa6101},
+{0xa6ce,0xa6121},
+{0xa6cf,0xa6141},
+{0xa6d0,0xa6161},
+{0xa6d1,0xa6181},
+{0xa6d2,0xa61a1},
+{0xa6d3,0xa61c1},
+{0xa6d4,0xa61e1},
+{0xa6d5,0xa6201},
+{0xa6d6,0xa6221},
+{0xa6d7,0xa6241},
+{0xa6d8,0xa6261},
+{0xa6d9,0xa6281},
+{0xa6da,0xa62a1},
+{0xa6db,0xa62c1},
+{0xa6dc,0xa62e1},
+{0xa6dd,0xa6301},
+{0xa6de,0xa6321},
+{0xa6df,0xa6341},
+{0xa6e0,0xa6361},
+{0xa6e1,0xa6381},
+{0xa6e2,0xa63a1},
+{0xa6e3,0xa63c1},
+{0xa6e4,0xa63e1},
+{0xa6e5,0xa6401},
+{0xa6e6,0xa6421},
+{0xa6e7,0xa6441},
+{0xa6e8,0xa6461},
+{0xa6e9,0xa6481},
+{0xa6ea,0xa64a1},
+{0xa6eb,0xa64c1},
+{0xa6ec,0xa64e1},
+{0xa6ed,0xa6501},
+{0xa6ee,0xa6521},
+{0xa6ef,0xa6541},
+{0xa6f0,0x36ba1},
+{0xa6f1,0x36bc1},
+{0xa6f2,0x1a121},
+{0xa6f3,0x1a141},
+{0xa6f4,0x1a161},
+{0xa6f5,0x1a181},
+{0xa6f6,0x1a1a1},
+{0xa6f7,0x1a1c1},
+{0xa700,0x1a1e1},
+{0xa701,0x1a201},
+{0xa702,0x1a221},
+{0xa703,0x1a241},
+{0xa704,0x1a261},
+{0xa705,0x1a281},
+{0xa706,0x1a2a1},
+{0xa707,0x1a2c1},
+{0xa708,0x1a2e1},
+{0xa709,0x1a301},
+{0xa70a,0x1a321},
+{0xa70b,0x1a341},
+{0xa70c,0x1a361},
+{0xa70d,0x1a381},
+{0xa70e,0x1a3a1},
+{0xa70f,0x1a3c1},
+{0xa710,0x1a3e1},
+{0xa711,0x1a401},
+{0xa712,0x1a421},
+{0xa713,0x1a441},
+{0xa714,0x1a461},
+{0xa715,0x1a481},
+{0xa716,0x1a4a1},
+{0xa717,0x1a4c1},
+{0xa718,0x1a4e1},
+{0xa719,0x1a501},
+{0xa71a,0x1a521},
+{0xa71b,0x1a541},
+{0xa71c,0x1a561},
+{0xa71d,0x1a581},
+{0xa71e,0x1a5a1},
+{0xa71f,0x1a5c1},
+{0xa720,0x1a5e1},
+{0xa721,0x1a601},
+{0xa722,0x523a1},
+{0xa723,0x52381},
+{0xa724,0x52521},
+{0xa725,0x52501},
+{0xa726,0x43ee1},
+{0xa727,0x43ec1},
+{0xa728,0x4dc82},
+{0xa729,0x4dc42},
+{0xa72a,0x52101},
+{0xa72b,0x520e1},
+{0xa72c,0x52141},
+{0xa72d,0x52121},
+{0xa72e,0x52181},
+{0xa72f,0x52161},
+{0xa730,0x428e1},
+{0xa731,0x4d141},
+{0xa732,0x3e182},
+{0xa733,0x3e142},
+{0xa734,0x3e6a2},
+{0xa735,0x3e662},
+{0xa736,0x3e7e2},
+{0xa737,0x3e7a2},
+{0xa738,0x3e8a2},
+{0xa739,0x3e862},
+{0xa73a,0x3e943},
+{0xa73b,0x3e8e3},
+{0xa73c,0x3e9e2},
+{0xa73d,0x3e9a2},
+{0xa73e,0x3ff61},
+{0xa73f,0x3ff41},
+{0xa740,0x45f01},
+{0xa741,0x45ee1},
+{0xa742,0x45f41},
+{0xa743,0x45f21},
+{0xa744,0x45f81},
+{0xa745,0x45f61},
+{0xa746,0x46ac1},
+{0xa747,0x46aa1},
+{0xa748,0x46b21},
+{0xa749,0x46b01},
+{0xa74a,0x4a7e1},
+{0xa74b,0x4a7c1},
+{0xa74c,0x4a6a1},
+{0xa74d,0x4a681},
+{0xa74e,0x4a382},
+{0xa74f,0x4a342},
+{0xa750,0x4b0c1},
+{0xa751,0x4b0a1},
+{0xa752,0x4b181},
+{0xa753,0x4b161},
+{0xa754,0x4b1c1},
+{0xa755,0x4b1a1},
+{0xa756,0x4b4a1},
+{0xa757,0x4b481},
+{0xa758,0x4b4e1},
+{0xa759,0x4b4c1},
+{0xa75a,0x4c061},
+{0xa75b,0x4c021},
+{0xa75c,0x4c421},
+{0xa75d,0x4c401},
+{0xa75e,0x4ff01},
+{0xa75f,0x4fee1},
+{0xa760,0x4fe82},
+{0xa761,0x4fe42},
+{0xa762,0x51c41},
+{0xa763,0x51c21},
+{0xa764,0x51e61},
+{0xa765,0x51e41},
+{0xa766,0x51ea1},
+{0xa767,0x51e81},
+{0xa768,0x51f21},
+{0xa769,0x51f01},
+{0xa76a,0x51fc1},
+{0xa76b,0x51fa1},
+{0xa76c,0x52001},
+{0xa76d,0x51fe1},
+{0xa76e,0x52061},
+{0xa76f,0x52021},
+{0xa770,0x52081},
+{0xa771,0x40ca1},
+{0xa772,0x46dc1},
+{0xa773,0x47ac1},
+{0xa774,0x48781},
+{0xa775,0x4c3c1},
+{0xa776,0x4c3e1},
+{0xa777,0x4de61},
+{0xa778,0x520a1},
+{0xa779,0x40642},
+{0xa77a,0x40602},
+{0xa77b,0x425c2},
+{0xa77c,0x42582},
+{0xa77d,0x430a2},
+{0xa77e,0x43441},
+{0xa77f,0x43421},
+{0xa780,0x46e21},
+{0xa781,0x46e01},
+{0xa782,0x4bd42},
+{0xa783,0x4bd02},
+{0xa784,0x4cd62},
+{0xa785,0x4cd22},
+{0xa786,0x4d9e2},
+{0xa787,0x4d9a2},
+{0xa788,0x1a621},
+{0xa789,0x1a641},
+{0xa78a,0x1a661},
+{0xa78b,0x523e1},
+{0xa78c,0x523c1},
+{0xa78d,0x4f621},
+{0xa78e,0x46d81},
+{0xa78f,0x52401},
+{0xa790,0x486c1},
+{0xa791,0x486a1},
+{0xa792,0x3fe41},
+{0xa793,0x3fe21},
+{0xa794,0x3fe61},
+{0xa795,0x43dc1},
+{0xa796,0x3f221},
+{0xa797,0x3f201},
+{0xa798,0x42941},
+{0xa799,0x42921},
+{0xa79a,0x3d942},
+{0xa79b,0x3d8c2},
+{0xa79c,0x490a2},
+{0xa79d,0x49022},
+{0xa79e,0x4e4c2},
+{0xa79f,0x4e442},
+{0xa7a0,0x43022},
+{0xa7a1,0x42fe2},
+{0xa7a2,0x45822},
+{0xa7a3,0x457e2},
+{0xa7a4,0x48062},
+{0xa7a5,0x48022},
+{0xa7a6,0x4ba02},
+{0xa7a7,0x4b9c2},
+{0xa7a8,0x4cb22},
+{0xa7a9,0x4cae2},
+{0xa7aa,0x43e01},
+{0xa7ab,0x42181},
+{0xa7ac,0x432a1},
+{0xa7ad,0x46ca1},
+{0xa7b0,0x45fc1},
+{0xa7b1,0x4dea1},
+{0xa7b2,0x45381},
+{0xa7b3,0x50c81},
+{0xa7b4,0x3f321},
+{0xa7b5,0x3f2e1},
+{0xa7b6,0x4a841},
+{0xa7b7,0x4a821},
+{0xa7f7,0x44e41},
+{0xa7f8,0x43a42},
+{0xa7f9,0x4a2a3},
+{0xa7fa,0x4f701},
+{0xa7fb,0x42a21},
+{0xa7fc,0x4b1e1},
+{0xa7fd,0x47a81},
+{0xa7fe,0x44e21},
+{0xa7ff,0x47aa1},
+{0xa800,0x796c1},
+{0xa801,0x796e1},
+{0xa802,0x79701},
+{0xa803,0x79721},
+{0xa804,0x79741},
+{0xa805,0x79761},
+{0xa806,0x79781},
+{0xa807,0x797a1},
+{0xa808,0x797c1},
+{0xa809,0x797e1},
+{0xa80a,0x79801},
+{0xa80b,0x36cc1},
+{0xa80c,0x79821},
+{0xa80d,0x79841},
+{0xa80e,0x79861},
+{0xa80f,0x79881},
+{0xa810,0x798a1},
+{0xa811,0x798c1},
+{0xa812,0x798e1},
+{0xa813,0x79901},
+{0xa814,0x79921},
+{0xa815,0x79941},
+{0xa816,0x79961},
+{0xa817,0x79981},
+{0xa818,0x799a1},
+{0xa819,0x799c1},
+{0xa81a,0x799e1},
+{0xa81b,0x79a01},
+{0xa81c,0x79a21},
+{0xa81d,0x79a41},
+{0xa81e,0x79a61},
+{0xa81f,0x79a81},
+{0xa820,0x79aa1},
+{0xa821,0x79ac1},
+{0xa822,0x79ae1},
+{0xa823,0x79b01},
+{0xa824,0x79b21},
+{0xa825,0x79b41},
+{0xa826,0x79b61},
+{0xa827,0x79b81},
+{0xa828,0x1a681},
+{0xa829,0x1a6a1},
+{0xa82a,0x1a6c1},
+{0xa82b,0x1a6e1},
+{0xa830,0x1a701},
+{0xa831,0x1a721},
+{0xa832,0x1a741},
+{0xa833,0x1a761},
+{0xa834,0x1a781},
+{0xa835,0x1a7a1},
+{0xa836,0x1a7c1},
+{0xa837,0x1a7e1},
+{0xa838,0x37c61},
+{0xa839,0x1a801},
+{0xa840,0x8d861},
+{0xa841,0x8d881},
+{0xa842,0x8d8a1},
+{0xa843,0x8d8c1},
+{0xa844,0x8d8e1},
+{0xa845,0x8d901},
+{0xa846,0x8d921},
+{0xa847,0x8d941},
+{0xa848,0x8d9e1},
+{0xa849,0x8da01},
+{0xa84a,0x8da21},
+{0xa84b,0x8da41},
+{0xa84c,0x8da61},
+{0xa84d,0x8da81},
+{0xa84e,0x8daa1},
+{0xa84f,0x8dac1},
+{0xa850,0x8dae1},
+{0xa851,0x8db01},
+{0xa852,0x8db21},
+{0xa853,0x8db41},
+{0xa854,0x8db81},
+{0xa855,0x8dba1},
+{0xa856,0x8dbc1},
+{0xa857,0x8dbe1},
+{0xa858,0x8dc41},
+{0xa859,0x8dca1},
+{0xa85a,0x8dcc1},
+{0xa85b,0x8dd01},
+{0xa85c,0x8dd21},
+{0xa85d,0x8dd81},
+{0xa85e,0x8de21},
+{0xa85f,0x8de41},
+{0xa860,0x8de61},
+{0xa861,0x8de81},
+{0xa862,0x8dda1},
+{0xa863,0x8ddc1},
+{0xa864,0x8dde1},
+{0xa865,0x8de01},
+{0xa866,0x8dea1},
+{0xa867,0x8db61},
+{0xa868,0x8dc01},
+{0xa869,0x8d961},
+{0xa86a,0x8d981},
+{0xa86b,0x8d9a1},
+{0xa86c,0x8d9c1},
+{0xa86d,0x8dc21},
+{0xa86e,0x8dce1},
+{0xa86f,0x8dd41},
+{0xa870,0x8dd61},
+{0xa871,0x8dc61},
+{0xa872,0x8dc81},
+{0xa873,0x8dec1},
+{0xa874,0x1a821},
+{0xa875,0x1a841},
+{0xa876,0x1a861},
+{0xa877,0x1a881},
+{0xa880,0x36cc1},
+{0xa881,0x36ce1},
+{0xa882,0x79ba1},
+{0xa883,0x79bc1},
+{0xa884,0x79be1},
+{0xa885,0x79c01},
+{0xa886,0x79c21},
+{0xa887,0x79c41},
+{0xa888,0x79c61},
+{0xa889,0x79c81},
+{0xa88a,0x79ca1},
+{0xa88b,0x79cc1},
+{0xa88c,0x79ce1},
+{0xa88d,0x79d01},
+{0xa88e,0x79d21},
+{0xa88f,0x79d41},
+{0xa890,0x79d61},
+{0xa891,0x79d81},
+{0xa892,0x79da1},
+{0xa893,0x79dc1},
+{0xa894,0x79de1},
+{0xa895,0x79e01},
+{0xa896,0x79e21},
+{0xa897,0x79e41},
+{0xa898,0x79e61},
+{0xa899,0x79e81},
+{0xa89a,0x79ea1},
+{0xa89b,0x79ec1},
+{0xa89c,0x79ee1},
+{0xa89d,0x79f01},
+{0xa89e,0x79f21},
+{0xa89f,0x79f41},
+{0xa8a0,0x79f61},
+{0xa8a1,0x79f81},
+{0xa8a2,0x79fa1},
+{0xa8a3,0x79fc1},
+{0xa8a4,0x79fe1},
+{0xa8a5,0x7a001},
+{0xa8a6,0x7a021},
+{0xa8a7,0x7a041},
+{0xa8a8,0x7a061},
+{0xa8a9,0x7a081},
+{0xa8aa,0x7a0a1},
+{0xa8ab,0x7a0c1},
+{0xa8ac,0x7a0e1},
+{0xa8ad,0x7a101},
+{0xa8ae,0x7a121},
+{0xa8af,0x7a141},
+{0xa8b0,0x7a161},
+{0xa8b1,0x7a181},
+{0xa8b2,0x7a1a1},
+{0xa8b3,0x7a1c1},
+{0xa8b4,0x7a1e1},
+{0xa8b5,0x7a201},
+{0xa8b6,0x7a221},
+{0xa8b7,0x7a241},
+{0xa8b8,0x7a261},
+{0xa8b9,0x7a281},
+{0xa8ba,0x7a2a1},
+{0xa8bb,0x7a2c1},
+{0xa8bc,0x7a2e1},
+{0xa8bd,0x7a301},
+{0xa8be,0x7a321},
+{0xa8bf,0x7a341},
+{0xa8c0,0x7a361},
+{0xa8c1,0x7a381},
+{0xa8c2,0x7a3a1},
+{0xa8c3,0x7a3c1},
+{0xa8c4,0x7a3e1},
+{0xa8ce,0x1a8a1},
+{0xa8cf,0x1a8c1},
+{0xa8d0,0x380c1},
+{0xa8d1,0x382e1},
+{0xa8d2,0x3a041},
+{0xa8d3,0x3aec1},
+{0xa8d4,0x3b641},
+{0xa8d5,0x3bc01},
+{0xa8d6,0x3bfe1},
+{0xa8d7,0x3c301},
+{0xa8d8,0x3c681},
+{0xa8d9,0x3c9a1},
+{0xa8e0,0x1},
+{0xa8e1,0x1},
+{0xa8e2,0x1},
+{0xa8e3,0x1},
+{0xa8e4,0x1},
+{0xa8e5,0x1},
+{0xa8e6,0x1},
+{0xa8e7,0x1},
+{0xa8e8,0x1},
+{0xa8e9,0x1},
+{0xa8ea,0x1},
+{0xa8eb,0x1},
+{0xa8ec,0x1},
+{0xa8ed,0x1},
+{0xa8ee,0x1},
+{0xa8ef,0x1},
+{0xa8f0,0x1},
+{0xa8f1,0x1},
+{0xa8f2,0x73b41},
+{0xa8f3,0x73b61},
+{0xa8f4,0x73b61},
+{0xa8f5,0x73b61},
+{0xa8f6,0x73b61},
+{0xa8f7,0x73b61},
+{0xa8f8,0x1a8e1},
+{0xa8f9,0x1a901},
+{0xa8fa,0x1a921},
+{0xa8fb,0x73b81},
+{0xa8fc,0x1a941},
+{0xa8fd,0x72f61},
+{0xa900,0x380c1},
+{0xa901,0x382e1},
+{0xa902,0x3a041},
+{0xa903,0x3aec1},
+{0xa904,0x3b641},
+{0xa905,0x3bc01},
+{0xa906,0x3bfe1},
+{0xa907,0x3c301},
+{0xa908,0x3c681},
+{0xa909,0x3c9a1},
+{0xa90a,0x8fd81},
+{0xa90b,0x8fda1},
+{0xa90c,0x8fdc1},
+{0xa90d,0x8fde1},
+{0xa90e,0x8fe01},
+{0xa90f,0x8fe21},
+{0xa910,0x8fe41},
+{0xa911,0x8fe61},
+{0xa912,0x8fe81},
+{0xa913,0x8fea1},
+{0xa914,0x8fec1},
+{0xa915,0x8fee1},
+{0xa916,0x8ff01},
+{0xa917,0x8ff21},
+{0xa918,0x8ff41},
+{0xa919,0x8ff61},
+{0xa91a,0x8ff81},
+{0xa91b,0x8ffa1},
+{0xa91c,0x8ffc1},
+{0xa91d,0x8ffe1},
+{0xa91e,0x90001},
+{0xa91f,0x90021},
+{0xa920,0x90041},
+{0xa921,0x90061},
+{0xa922,0x90081},
+{0xa923,0x900a1},
+{0xa924,0x900c1},
+{0xa925,0x900e1},
+{0xa926,0x90101},
+{0xa927,0x90121},
+{0xa928,0x90141},
+{0xa929,0x90161},
+{0xa92a,0x90181},
+{0xa92b,0x370a1},
+{0xa92c,0x370c1},
+{0xa92d,0x370e1},
+{0xa92e,0x1a961},
+{0xa92f,0x1a981},
+{0xa930,0x8f901},
+{0xa931,0x8f921},
+{0xa932,0x8f941},
+{0xa933,0x8f961},
+{0xa934,0x8f981},
+{0xa935,0x8f9a1},
+{0xa936,0x8f9c1},
+{0xa937,0x8f9e1},
+{0xa938,0x8fa01},
+{0xa939,0x8fa21},
+{0xa93a,0x8fa41},
+{0xa93b,0x8fa61},
+{0xa93c,0x8fa81},
+{0xa93d,0x8faa1},
+{0xa93e,0x8fac1},
+{0xa93f,0x8fae1},
+{0xa940,0x8fb01},
+{0xa941,0x8fb21},
+{0xa942,0x8fb41},
+{0xa943,0x8fb61},
+{0xa944,0x8fb81},
+{0xa945,0x8fba1},
+{0xa946,0x8fbc1},
+{0xa947,0x8fbe1},
+{0xa948,0x8fc01},
+{0xa949,0x8fc21},
+{0xa94a,0x8fc41},
+{0xa94b,0x8fc61},
+{0xa94c,0x8fc81},
+{0xa94d,0x8fca1},
+{0xa94e,0x8fcc1},
+{0xa94f,0x8fce1},
+{0xa950,0x8fd01},
+{0xa951,0x8fd21},
+{0xa952,0x8fd41},
+{0xa953,0x8fd61},
+{0xa95f,0x1a9a1},
+{0xa960,0xaf1e1},
+{0xa961,0xaf201},
+{0xa962,0xaf221},
+{0xa963,0xaf241},
+{0xa964,0xaf261},
+{0xa965,0xaf281},
+{0xa966,0xaf2a1},
+{0xa967,0xaf2c1},
+{0xa968,0xaf2e1},
+{0xa969,0xaf301},
+{0xa96a,0xaf321},
+{0xa96b,0xaf341},
+{0xa96c,0xaf361},
+{0xa96d,0xaf381},
+{0xa96e,0xaf3a1},
+{0xa96f,0xaf3c1},
+{0xa970,0xaf3e1},
+{0xa971,0xaf401},
+{0xa972,0xaf421},
+{0xa973,0xaf441},
+{0xa974,0xaf461},
+{0xa975,0xaf481},
+{0xa976,0xaf4a1},
+{0xa977,0xaf4c1},
+{0xa978,0xaf4e1},
+{0xa979,0xaf501},
+{0xa97a,0xaf521},
+{0xa97b,0xaf541},
+{0xa97c,0xaf561},
+{0xa980,0x36ca1},
+{0xa981,0x36cc1},
+{0xa982,0x36d81},
+{0xa983,0x36ce1},
+{0xa984,0x97c81},
+{0xa985,0x97ca1},
+{0xa986,0x97cc1},
+{0xa987,0x97ce1},
+{0xa988,0x97d01},
+{0xa989,0x97d21},
+{0xa98a,0x97d41},
+{0xa98b,0x97d61},
+{0xa98c,0x97d81},
+{0xa98d,0x97da1},
+{0xa98e,0x97dc1},
+{0xa98f,0x97de1},
+{0xa990,0x97e01},
+{0xa991,0x97e21},
+{0xa992,0x97e41},
+{0xa993,0x97e61},
+{0xa994,0x97e81},
+{0xa995,0x97ea1},
+{0xa996,0x97ec1},
+{0xa997,0x97ee1},
+{0xa998,0x97f01},
+{0xa999,0x97f21},
+{0xa99a,0x97f41},
+{0xa99b,0x97f61},
+{0xa99c,0x97f81},
+{0xa99d,0x97fa1},
+{0xa99e,0x97fc1},
+{0xa99f,0x97fe1},
+{0xa9a0,0x98001},
+{0xa9a1,0x98021},
+{0xa9a2,0x98041},
+{0xa9a3,0x98061},
+{0xa9a4,0x98081},
+{0xa9a5,0x980a1},
+{0xa9a6,0x980c1},
+{0xa9a7,0x980e1},
+{0xa9a8,0x98101},
+{0xa9a9,0x98121},
+{0xa9aa,0x98141},
+{0xa9ab,0x98181},
+{0xa9ac,0x981a1},
+{0xa9ad,0x981e1},
+{0xa9ae,0x98201},
+{0xa9af,0x98221},
+{0xa9b0,0x98241},
+{0xa9b1,0x98261},
+{0xa9b2,0x98281},
+{0xa9b3,0x36c81},
+{0xa9b4,0x982a1},
+{0xa9b5,0x982c1},
+{0xa9b6,0x98301},
+{0xa9b7,0x98321},
+{0xa9b8,0x98341},
+{0xa9b9,0x98361},
+{0xa9ba,0x983a1},
+{0xa9bb,0x983c1},
+{0xa9bc,0x982e1},
+{0xa9bd,0x98381},
+{0xa9be,0x98161},
+{0xa9bf,0x981c1},
+{0xa9c0,0x983e1},
+{0xa9c1,0x1a9c1},
+{0xa9c2,0x1a9e1},
+{0xa9c3,0x1aa01},
+{0xa9c4,0x1aa21},
+{0xa9c5,0x1aa41},
+{0xa9c6,0x1aa61},
+{0xa9c7,0x1aa81},
+{0xa9c8,0x1aaa1},
+{0xa9c9,0x1aac1},
+{0xa9ca,0x1aae1},
+{0xa9cb,0x1ab01},
+{0xa9cc,0x1ab21},
+{0xa9cd,0x1ab41},
+{0xa9cf,0x37741},
+{0xa9d0,0x380c1},
+{0xa9d1,0x382e1},
+{0xa9d2,0x3a041},
+{0xa9d3,0x3aec1},
+{0xa9d4,0x3b641},
+{0xa9d5,0x3bc01},
+{0xa9d6,0x3bfe1},
+{0xa9d7,0x3c301},
+{0xa9d8,0x3c681},
+{0xa9d9,0x3c9a1},
+{0xa9de,0x1ab61},
+{0xa9df,0x1ab81},
+{0xa9e0,0x902c1},
+{0xa9e1,0x903c1},
+{0xa9e2,0x90501},
+{0xa9e3,0x907c1},
+{0xa9e4,0x90ae1},
+{0xa9e5,0x914a1},
+{0xa9e6,0x37761},
+{0xa9e7,0x90601},
+{0xa9e8,0x90a41},
+{0xa9e9,0x90281},
+{0xa9ea,0x902e1},
+{0xa9eb,0x90461},
+{0xa9ec,0x90541},
+{0xa9ed,0x90701},
+{0xa9ee,0x90761},
+{0xa9ef,0x907e1},
+{0xa9f0,0x380c1},
+{0xa9f1,0x382e1},
+{0xa9f2,0x3a041},
+{0xa9f3,0x3aec1},
+{0xa9f4,0x3b641},
+{0xa9f5,0x3bc01},
+{0xa9f6,0x3bfe1},
+{0xa9f7,0x3c301},
+{0xa9f8,0x3c681},
+{0xa9f9,0x3c9a1},
+{0xa9fa,0x90ec1},
+{0xa9fb,0x90881},
+{0xa9fc,0x908e1},
+{0xa9fd,0x90aa1},
+{0xa9fe,0x90b01},
+{0xaa00,0x96b21},
+{0xaa01,0x96b41},
+{0xaa02,0x96b61},
+{0xaa03,0x96b81},
+{0xaa04,0x96ba1},
+{0xaa05,0x96bc1},
+{0xaa06,0x96be1},
+{0xaa07,0x96c01},
+{0xaa08,0x96c21},
+{0xaa09,0x96c41},
+{0xaa0a,0x96c61},
+{0xaa0b,0x96c81},
+{0xaa0c,0x96ca1},
+{0xaa0d,0x96cc1},
+{0xaa0e,0x96ce1},
+{0xaa0f,0x96d01},
+{0xaa10,0x96d21},
+{0xaa11,0x96d41},
+{0xaa12,0x96d61},
+{0xaa13,0x96d81},
+{0xaa14,0x96da1},
+{0xaa15,0x96dc1},
+{0xaa16,0x96de1},
+{0xaa17,0x96e01},
+{0xaa18,0x96e21},
+{0xaa19,0x96e41},
+{0xaa1a,0x96e61},
+{0xaa1b,0x96e81},
+{0xaa1c,0x96ea1},
+{0xaa1d,0x96ec1},
+{0xaa1e,0x96ee1},
+{0xaa1f,0x96f01},
+{0xaa20,0x96f21},
+{0xaa21,0x96f41},
+{0xaa22,0x96f61},
+{0xaa23,0x96f81},
+{0xaa24,0x96fa1},
+{0xaa25,0x96fc1},
+{0xaa26,0x96fe1},
+{0xaa27,0x97001},
+{0xaa28,0x97021},
+{0xaa29,0x970c1},
+{0xaa2a,0x970e1},
+{0xaa2b,0x97101},
+{0xaa2c,0x97121},
+{0xaa2d,0x97141},
+{0xaa2e,0x97161},
+{0xaa2f,0x97181},
+{0xaa30,0x971a1},
+{0xaa31,0x971c1},
+{0xaa32,0x971e1},
+{0xaa33,0x97041},
+{0xaa34,0x97061},
+{0xaa35,0x97081},
+{0xaa36,0x970a1},
+{0xaa40,0x97201},
+{0xaa41,0x97221},
+{0xaa42,0x97241},
+{0xaa43,0x97261},
+{0xaa44,0x97281},
+{0xaa45,0x972a1},
+{0xaa46,0x972c1},
+{0xaa47,0x972e1},
+{0xaa48,0x97301},
+{0xaa49,0x97321},
+{0xaa4a,0x97341},
+{0xaa4b,0x97361},
+{0xaa4c,0x97381},
+{0xaa4d,0x973a1},
+{0xaa50,0x380c1},
+{0xaa51,0x382e1},
+{0xaa52,0x3a041},
+{0xaa53,0x3aec1},
+{0xaa54,0x3b641},
+{0xaa55,0x3bc01},
+{0xaa56,0x3bfe1},
+{0xaa57,0x3c301},
+{0xaa58,0x3c681},
+{0xaa59,0x3c9a1},
+{0xaa5c,0x1aba1},
+{0xaa5d,0x1abc1},
+{0xaa5e,0x1abe1},
+{0xaa5f,0x1ac01},
+{0xaa60,0x90261},
+{0xaa61,0x90381},
+{0xaa62,0x903e1},
+{0xaa63,0x90441},
+{0xaa64,0x90521},
+{0xaa65,0x905e1},
+{0xaa66,0x90661},
+{0xaa67,0x906a1},
+{0xaa68,0x906e1},
+{0xaa69,0x90741},
+{0xaa6a,0x908c1},
+{0xaa6b,0x90941},
+{0xaa6c,0x90dc1},
+{0xaa6d,0x90e21},
+{0xaa6e,0x90e61},
+{0xaa6f,0x90a01},
+{0xaa70,0x37781},
+{0xaa71,0x90e81},
+{0xaa72,0x904a1},
+{0xaa73,0x90bc1},
+{0xaa74,0x917a1},
+{0xaa75,0x917c1},
+{0xaa76,0x917e1},
+{0xaa77,0x1ac21},
+{0xaa78,0x1ac41},
+{0xaa79,0x1ac61},
+{0xaa7a,0x90be1},
+{0xaa7b,0x91741},
+{0xaa7c,0x91761},
+{0xaa7d,0x91781},
+{0xaa7e,0x90401},
+{0xaa7f,0x90581},
+{0xaa80,0x87c61},
+{0xaa81,0x87dc1},
+{0xaa82,0x87f21},
+{0xaa83,0x88081},
+{0xaa84,0x881e1},
+{0xaa85,0x88341},
+{0xaa86,0x884a1},
+{0xaa87,0x88601},
+{0xaa88,0x88761},
+{0xaa89,0x888c1},
+{0xaa8a,0x88a21},
+{0xaa8b,0x88b81},
+{0xaa8c,0x88ce1},
+{0xaa8d,0x88e41},
+{0xaa8e,0x88fa1},
+{0xaa8f,0x89101},
+{0xaa90,0x89261},
+{0xaa91,0x893c1},
+{0xaa92,0x89521},
+{0xaa93,0x89681},
+{0xaa94,0x897e1},
+{0xaa95,0x89941},
+{0xaa96,0x89aa1},
+{0xaa97,0x89c01},
+{0xaa98,0x89d61},
+{0xaa99,0x89ec1},
+{0xaa9a,0x8a021},
+{0xaa9b,0x8a181},
+{0xaa9c,0x8a2e1},
+{0xaa9d,0x8a441},
+{0xaa9e,0x8a5a1},
+{0xaa9f,0x8a701},
+{0xaaa0,0x8a861},
+{0xaaa1,0x8a9c1},
+{0xaaa2,0x8ab21},
+{0xaaa3,0x8ac81},
+{0xaaa4,0x8ade1},
+{0xaaa5,0x8af41},
+{0xaaa6,0x8b0a1},
+{0xaaa7,0x8b201},
+{0xaaa8,0x8b361},
+{0xaaa9,0x8b4c1},
+{0xaaaa,0x8b621},
+{0xaaab,0x8b781},
+{0xaaac,0x8b8e1},
+{0xaaad,0x8ba41},
+{0xaaae,0x8bba1},
+{0xaaaf,0x8bd01},
+{0xaab0,0x8be61},
+{0xaab1,0x8be81},
+{0xaab2,0x8bea1},
+{0xaab3,0x8bec1},
+{0xaab4,0x8bee1},
+{0xaab5,0x8bf01},
+{0xaab6,0x8bf21},
+{0xaab7,0x8bf41},
+{0xaab8,0x8bf61},
+{0xaab9,0x8bf81},
+{0xaaba,0x8bfa1},
+{0xaabb,0x8bfc1},
+{0xaabc,0x8bfe1},
+{0xaabd,0x8c001},
+{0xaabe,0x8c021},
+{0xaabf,0x37041},
+{0xaac0,0x8c041},
+{0xaac1,0x37061},
+{0xaac2,0x8c061},
+{0xaadb,0x8c081},
+{0xaadc,0x8c0a1},
+{0xaadd,0x377a1},
+{0xaade,0x1ac81},
+{0xaadf,0x1aca1},
+{0xaae0,0x79261},
+{0xaae1,0x79281},
+{0xaae2,0x792a1},
+{0xaae3,0x792c1},
+{0xaae4,0x792e1},
+{0xaae5,0x79301},
+{0xaae6,0x79321},
+{0xaae7,0x79341},
+{0xaae8,0x79361},
+{0xaae9,0x79381},
+{0xaaea,0x793a1},
+{0xaaeb,0x794c1},
+{0xaaec,0x794e1},
+{0xaaed,0x79501},
+{0xaaee,0x79521},
+{0xaaef,0x79541},
+{0xaaf0,0x1acc1},
+{0xaaf1,0x1ace1},
+{0xaaf2,0x78ee1},
+{0xaaf3,0x377c1},
+{0xaaf4,0x377e1},
+{0xaaf5,0x79561},
+{0xaaf6,0x796a1},
+{0xab01,0x6fea1},
+{0xab02,0x6fec1},
+{0xab03,0x6fee1},
+{0xab04,0x6ff01},
+{0xab05,0x6ff21},
+{0xab06,0x6ff41},
+{0xab09,0x71781},
+{0xab0a,0x717a1},
+{0xab0b,0x717c1},
+{0xab0c,0x717e1},
+{0xab0d,0x71801},
+{0xab0e,0x71821},
+{0xab11,0x713a1},
+{0xab12,0x713c1},
+{0xab13,0x713e1},
+{0xab14,0x71401},
+{0xab15,0x71421},
+{0xab16,0x71441},
+{0xab20,0x71fe1},
+{0xab21,0x72001},
+{0xab22,0x72021},
+{0xab23,0x72041},
+{0xab24,0x72061},
+{0xab25,0x72081},
+{0xab26,0x720a1},
+{0xab28,0x722e1},
+{0xab29,0x72301},
+{0xab2a,0x72321},
+{0xab2b,0x72341},
+{0xab2c,0x72361},
+{0xab2d,0x72381},
+{0xab2e,0x723a1},
+{0xab30,0x3ec41},
+{0xab31,0x3eb41},
+{0xab32,0x41e61},
+{0xab33,0x41e81},
+{0xab34,0x41f01},
+{0xab35,0x42901},
+{0xab36,0x432e1},
+{0xab37,0x46cc1},
+{0xab38,0x46c21},
+{0xab39,0x46c61},
+{0xab3a,0x47a61},
+{0xab3b,0x48761},
+{0xab3c,0x48801},
+{0xab3d,0x4a441},
+{0xab3e,0x4a561},
+{0xab3f,0x4a621},
+{0xab40,0x4a4e1},
+{0xab41,0x4a4a1},
+{0xab42,0x4a4c1},
+{0xab43,0x4a501},
+{0xab44,0x4a521},
+{0xab45,0x4bf81},
+{0xab46,0x4c001},
+{0xab47,0x4c2e1},
+{0xab48,0x4c301},
+{0xab49,0x4c261},
+{0xab4a,0x4c321},
+{0xab4b,0x4c341},
+{0xab4c,0x4c361},
+{0xab4d,0x4d2e1},
+{0xab4e,0x4f421},
+{0xab4f,0x4f561},
+{0xab50,0x4f4c1},
+{0xab51,0x4f4e1},
+{0xab52,0x4f5c1},
+{0xab53,0x50c61},
+{0xab54,0x50ca1},
+{0xab55,0x50cc1},
+{0xab56,0x50be1},
+{0xab57,0x50c01},
+{0xab58,0x50c21},
+{0xab59,0x50c41},
+{0xab5a,0x51481},
+{0xab5b,0x1ad01},
+{0xab5c,0x43f01},
+{0xab5d,0x46ce1},
+{0xab5e,0x46c01},
+{0xab5f,0x4f5e1},
+{0xab60,0x51f41},
+{0xab61,0x51f61},
+{0xab62,0x4a661},
+{0xab63,0x51f81},
+{0xab64,0x3ece1},
+{0xab65,0x58981},
+{0xab70,0x998e1},
+{0xab71,0x99921},
+{0xab72,0x99961},
+{0xab73,0x999a1},
+{0xab74,0x999e1},
+{0xab75,0x99a21},
+{0xab76,0x99a61},
+{0xab77,0x99aa1},
+{0xab78,0x99ae1},
+{0xab79,0x99b21},
+{0xab7a,0x99b61},
+{0xab7b,0x99ba1},
+{0xab7c,0x99be1},
+{0xab7d,0x99c21},
+{0xab7e,0x99c61},
+{0xab7f,0x99ca1},
+{0xab80,0x99ce1},
+{0xab81,0x99d21},
+{0xab82,0x99d61},
+{0xab83,0x99da1},
+{0xab84,0x99de1},
+{0xab85,0x99e21},
+{0xab86,0x99e61},
+{0xab87,0x99ea1},
+{0xab88,0x99ee1},
+{0xab89,0x99f21},
+{0xab8a,0x99f61},
+{0xab8b,0x99fa1},
+{0xab8c,0x99fe1},
+{0xab8d,0x9a021},
+{0xab8e,0x9a061},
+{0xab8f,0x9a0a1},
+{0xab90,0x9a0e1},
+{0xab91,0x9a121},
+{0xab92,0x9a161},
+{0xab93,0x9a1a1},
+{0xab94,0x9a1e1},
+{0xab95,0x9a221},
+{0xab96,0x9a261},
+{0xab97,0x9a2a1},
+{0xab98,0x9a2e1},
+{0xab99,0x9a321},
+{0xab9a,0x9a361},
+{0xab9b,0x9a3a1},
+{0xab9c,0x9a3e1},
+{0xab9d,0x9a421},
+{0xab9e,0x9a461},
+{0xab9f,0x9a4a1},
+{0xaba0,0x9a4e1},
+{0xaba1,0x9a521},
+{0xaba2,0x9a561},
+{0xaba3,0x9a5a1},
+{0xaba4,0x9a5e1},
+{0xaba5,0x9a621},
+{0xaba6,0x9a661},
+{0xaba7,0x9a6a1},
+{0xaba8,0x9a6e1},
+{0xaba9,0x9a721},
+{0xabaa,0x9a761},
+{0xabab,0x9a7a1},
+{0xabac,0x9a7e1},
+{0xabad,0x9a821},
+{0xabae,0x9a861},
+{0xabaf,0x9a8a1},
+{0xabb0,0x9a8e1},
+{0xabb1,0x9a921},
+{0xabb2,0x9a961},
+{0xabb3,0x9a9a1},
+{0xabb4,0x9a9e1},
+{0xabb5,0x9aa21},
+{0xabb6,0x9aa61},
+{0xabb7,0x9aaa1},
+{0xabb8,0x9aae1},
+{0xabb9,0x9ab21},
+{0xabba,0x9ab61},
+{0xabbb,0x9aba1},
+{0xabbc,0x9abe1},
+{0xabbd,0x9ac21},
+{0xabbe,0x9ac61},
+{0xabbf,0x9aca1},
+{0xabc0,0x78f01},
+{0xabc1,0x78f21},
+{0xabc2,0x78f41},
+{0xabc3,0x78f61},
+{0xabc4,0x78f81},
+{0xabc5,0x78fa1},
+{0xabc6,0x78fc1},
+{0xabc7,0x78fe1},
+{0xabc8,0x79001},
+{0xabc9,0x79021},
+{0xabca,0x79041},
+{0xabcb,0x79061},
+{0xabcc,0x79081},
+{0xabcd,0x790a1},
+{0xabce,0x790c1},
+{0xabcf,0x790e1},
+{0xabd0,0x79101},
+{0xabd1,0x79121},
+{0xabd2,0x79141},
+{0xabd3,0x79161},
+{0xabd4,0x79181},
+{0xabd5,0x791a1},
+{0xabd6,0x791c1},
+{0xabd7,0x791e1},
+{0xabd8,0x79201},
+{0xabd9,0x79221},
+{0xabda,0x79241},
+{0xabdb,0x79581},
+{0xabdc,0x795a1},
+{0xabdd,0x795c1},
+{0xabde,0x795e1},
+{0xabdf,0x79601},
+{0xabe0,0x79621},
+{0xabe1,0x79641},
+{0xabe2,0x79661},
+{0xabe3,0x793c1},
+{0xabe4,0x793e1},
+{0xabe5,0x79401},
+{0xabe6,0x79421},
+{0xabe7,0x79441},
+{0xabe8,0x79461},
+{0xabe9,0x79481},
+{0xabea,0x794a1},
+{0xabeb,0x1ad21},
+{0xabec,0x36dc1},
+{0xabed,0x79681},
+{0xabf0,0x380c1},
+{0xabf1,0x382e1},
+{0xabf2,0x3a041},
+{0xabf3,0x3aec1},
+{0xabf4,0x3b641},
+{0xabf5,0x3bc01},
+{0xabf6,0x3bfe1},
+{0xabf7,0x3c301},
+{0xabf8,0x3c681},
+{0xabf9,0x3c9a1},
+{0xd7b0,0xb0521},
+{0xd7b1,0xb0541},
+{0xd7b2,0xb0561},
+{0xd7b3,0xb0581},
+{0xd7b4,0xb05a1},
+{0xd7b5,0xb05c1},
+{0xd7b6,0xb05e1},
+{0xd7b7,0xb0601},
+{0xd7b8,0xb0621},
+{0xd7b9,0xb0641},
+{0xd7ba,0xb0661},
+{0xd7bb,0xb0681},
+{0xd7bc,0xb06a1},
+{0xd7bd,0xb06c1},
+{0xd7be,0xb06e1},
+{0xd7bf,0xb0701},
+{0xd7c0,0xb0721},
+{0xd7c1,0xb0741},
+{0xd7c2,0xb0761},
+{0xd7c3,0xb0781},
+{0xd7c4,0xb07a1},
+{0xd7c5,0xb07c1},
+{0xd7c6,0xb07e1},
+{0xd7cb,0xb16a1},
+{0xd7cc,0xb16c1},
+{0xd7cd,0xb16e1},
+{0xd7ce,0xb1701},
+{0xd7cf,0xb1721},
+{0xd7d0,0xb1741},
+{0xd7d1,0xb1761},
+{0xd7d2,0xb1781},
+{0xd7d3,0xb17a1},
+{0xd7d4,0xb17c1},
+{0xd7d5,0xb17e1},
+{0xd7d6,0xb1801},
+{0xd7d7,0xb1821},
+{0xd7d8,0xb1841},
+{0xd7d9,0xb1861},
+{0xd7da,0xb1881},
+{0xd7db,0xb18a1},
+{0xd7dc,0xb18c1},
+{0xd7dd,0xb18e1},
+{0xd7de,0xb1901},
+{0xd7df,0xb1921},
+{0xd7e0,0xb1941},
+{0xd7e1,0xb1961},
+{0xd7e2,0xb1981},
+{0xd7e3,0xb19a1},
+{0xd7e4,0xb19c1},
+{0xd7e5,0xb19e1},
+{0xd7e6,0xb1a01},
+{0xd7e7,0xb1a21},
+{0xd7e8,0xb1a41},
+{0xd7e9,0xb1a61},
+{0xd7ea,0xb1a81},
+{0xd7eb,0xb1aa1},
+{0xd7ec,0xb1ac1},
+{0xd7ed,0xb1ae1},
+{0xd7ee,0xb1b01},
+{0xd7ef,0xb1b21},
+{0xd7f0,0xb1b41},
+{0xd7f1,0xb1b61},
+{0xd7f2,0xb1b81},
+{0xd7f3,0xb1ba1},
+{0xd7f4,0xb1bc1},
+{0xd7f5,0xb1be1},
+{0xd7f6,0xb1c01},
+{0xd7f7,0xb1c21},
+{0xd7f8,0xb1c41},
+{0xd7f9,0xb1c61},
+{0xd7fa,0xb1c81},
+{0xd7fb,0xb1ca1},
+{0xf900,0xf75c2},
+{0xf901,0xef442},
+{0xf902,0xf7da2},
+{0xf903,0xf7982},
+{0xf904,0xf1102},
+{0xf905,0xe7722},
+{0xf906,0xea3e2},
+{0xf907,0xfb082},
+{0xf908,0xfb082},
+{0xf909,0xeba62},
+{0xf90a,0xf8882},
+{0xf90b,0xeab62},
+{0xf90c,0xeba22},
+{0xf90d,0xedee2},
+{0xf90e,0xf2cc2},
+{0xf90f,0xf4c82},
+{0xf910,0xf6522},
+{0xf911,0xf6922},
+{0xf912,0xf6d22},
+{0xf913,0xf83e2},
+{0xf914,0xf00a2},
+{0xf915,0xf0b82},
+{0xf916,0xf17c2},
+{0xf917,0xf2362},
+{0xf918,0xf61a2},
+{0xf919,0xf86c2},
+{0xf91a,0xf9f42},
+{0xf91b,0xe7b62},
+{0xf91c,0xea0c2},
+{0xf91d,0xf01e2},
+{0xf91e,0xf1a02},
+{0xf91f,0xf64e2},
+{0xf920,0xfa582},
+{0xf921,0xec8a2},
+{0xf922,0xf1302},
+{0xf923,0xf63e2},
+{0xf924,0xf6e22},
+{0xf925,0xee322},
+{0xf926,0xf5502},
+{0xf927,0xf69e2},
+{0xf928,0xed062},
+{0xf929,0xef7a2},
+{0xf92a,0xf0d02},
+{0xf92b,0xf2082},
+{0xf92c,0xf8502},
+{0xf92d,0xe83a2},
+{0xf92e,0xe8f42},
+{0xf92f,0xe98c2},
+{0xf930,0xee9a2},
+{0xf931,0xf0162},
+{0xf932,0xf19c2},
+{0xf933,0xf2fc2},
+{0xf934,0xf4f42},
+{0xf935,0xf6462},
+{0xf936,0xf6622},
+{0xf937,0xf7ce2},
+{0xf938,0xf9482},
+{0xf939,0xfa342},
+{0xf93a,0xfa542},
+{0xf93b,0xf33e2},
+{0xf93c,0xf3a82},
+{0xf93d,0xf46e2},
+{0xf93e,0xf5fe2},
+{0xf93f,0xf8b42},
+{0xf940,0xfa6a2},
+{0xf941,0xf72c2},
+{0xf942,0xeb522},
+{0xf943,0xed262},
+{0xf944,0xf4222},
+{0xf945,0xf5202},
+{0xf946,0xf1e02},
+{0xf947,0xf3462},
+{0xf948,0xf7882},
+{0xf949,0xf9402},
+{0xf94a,0xeb4e2},
+{0xf94b,0xec622},
+{0xf94c,0xf00e2},
+{0xf94d,0xf0e42},
+{0xf94e,0xf1182},
+{0xf94f,0xf45e2},
+{0xf950,0xf4862},
+{0xf951,0xf8fa2},
+{0xf952,0xe9802},
+{0xf953,0xf53c2},
+{0xf954,0xe9002},
+{0xf955,0xe8fc2},
+{0xf956,0xf3d42},
+{0xf957,0xf4722},
+{0xf958,0xf6162},
+{0xf959,0xf9022},
+{0xf95a,0xf7482},
+{0xf95b,0xee362},
+{0xf95c,0xf00a2},
+{0xf95d,0xf7382},
+{0xf95e,0xe7842},
+{0xf95f,0xec162},
+{0xf960,0xed922},
+{0xf961,0xf21c2},
+{0xf962,0xf2a62},
+{0xf963,0xe9ac2},
+{0xf964,0xf34e2},
+{0xf965,0xe84a2},
+{0xf966,0xed6c2},
+{0xf967,0xe7522},
+{0xf968,0xf0a42},
+{0xf969,0xeebe2},
+{0xf96a,0xf45a2},
+{0xf96b,0xea262},
+{0xf96c,0xeb3e2},
+{0xf96d,0xf30e2},
+{0xf96e,0xf61e2},
+{0xf96f,0xf71c2},
+{0xf970,0xf0582},
+{0xf971,0xf8062},
+{0xf972,0xf09c2},
+{0xf973,0xee462},
+{0xf974,0xf5d62},
+{0xf975,0xee662},
+{0xf976,0xf2a22},
+{0xf977,0xe7f62},
+{0xf978,0xe8922},
+{0xf979,0xe8f82},
+{0xf97a,0xefea2},
+{0xf97b,0xf4422},
+{0xf97c,0xf59e2},
+{0xf97d,0xf7282},
+{0xf97e,0xf8842},
+{0xf97f,0xe9942},
+{0xf980,0xea7a2},
+{0xf981,0xebb22},
+{0xf982,0xed162},
+{0xf983,0xeee22},
+{0xf984,0xf1342},
+{0xf985,0xf3522},
+{0xf986,0xf8dc2},
+{0xf987,0xf9fc2},
+{0xf988,0xfa722},
+{0xf989,0xfa962},
+{0xf98a,0xe95c2},
+{0xf98b,0xef3c2},
+{0xf98c,0xf03a2},
+{0xf98d,0xf7f62},
+{0xf98e,0xece22},
+{0xf98f,0xedd62},
+{0xf990,0xedf22},
+{0xf991,0xee922},
+{0xf992,0xf1242},
+{0xf993,0xf1882},
+{0xf994,0xf25a2},
+{0xf995,0xf3c82},
+{0xf996,0xf47a2},
+{0xf997,0xf5182},
+{0xf998,0xf7e62},
+{0xf999,0xf6262},
+{0xf99a,0xf8262},
+{0xf99b,0xf8b82},
+{0xf99c,0xe9302},
+{0xf99d,0xe9642},
+{0xf99e,0xea962},
+{0xf99f,0xf1782},
+{0xf9a0,0xf6be2},
+{0xf9a1,0xf71c2},
+{0xf9a2,0xed022},
+{0xf9a3,0xed8a2},
+{0xf9a4,0xee5e2},
+{0xf9a5,0xf0502},
+{0xf9a6,0xf41e2},
+{0xf9a7,0xf2102},
+{0xf9a8,0xe8162},
+{0xf9a9,0xeafe2},
+{0xf9aa,0xec162},
+{0xf9ab,0xec9e2},
+{0xf9ac,0xed962},
+{0xf9ad,0xf2322},
+{0xf9ae,0xf24e2},
+{0xf9af,0xf4e42},
+{0xf9b0,0xf5102},
+{0xf9b1,0xf89c2},
+{0xf9b2,0xf93c2},
+{0xf9b3,0xf94c2},
+{0xf9b4,0xf9902},
+{0xf9b5,0xe83e2},
+{0xf9b6,0xf3bc2},
+{0xf9b7,0xf8742},
+{0xf9b8,0xf91e2},
+{0xf9b9,0xedae2},
+{0xf9ba,0xe7be2},
+{0xf9bb,0xe8622},
+{0xf9bc,0xec1a2},
+{0xf9bd,0xec5a2},
+{0xf9be,0xeece2},
+{0xf9bf,0xf00a2},
+{0xf9c0,0xf1942},
+{0xf9c1,0xf2c82},
+{0xf9c2,0xf6322},
+{0xf9c3,0xf83a2},
+{0xf9c4,0xfaf22},
+{0xf9c5,0xef2c2},
+{0xf9c6,0xf8f62},
+{0xf9c7,0xe9582},
+{0xf9c8,0xefae2},
+{0xf9c9,0xefba2},
+{0xf9ca,0xf0c82},
+{0xf9cb,0xf1002},
+{0xf9cc,0xf23e2},
+{0xf9cd,0xf29e2},
+{0xf9ce,0xf33a2},
+{0xf9cf,0xf4562},
+{0xf9d0,0xf99c2},
+{0xf9d1,0xe8a62},
+{0xf9d2,0xee022},
+{0xf9d3,0xf9062},
+{0xf9d4,0xe8522},
+{0xf9d5,0xec822},
+{0xf9d6,0xf0e82},
+{0xf9d7,0xf7ea2},
+{0xf9d8,0xed5c2},
+{0xf9d9,0xedb62},
+{0xf9da,0xefc22},
+{0xf9db,0xf21c2},
+{0xf9dc,0xf90e2},
+{0xf9dd,0xe9382},
+{0xf9de,0xea6a2},
+{0xf9df,0xec6a2},
+{0xf9e0,0xef142},
+{0xf9e1,0xef9e2},
+{0xf9e2,0xeff62},
+{0xf9e3,0xf0ac2},
+{0xf9e4,0xf23a2},
+{0xf9e5,0xf2b82},
+{0xf9e6,0xf4c02},
+{0xf9e7,0xf6c22},
+{0xf9e8,0xf6ce2},
+{0xf9e9,0xf87c2},
+{0xf9ea,0xf92a2},
+{0xf9eb,0xe9bc2},
+{0xf9ec,0xf1042},
+{0xf9ed,0xea6e2},
+{0xf9ee,0xf1982},
+{0xf9ef,0xf25e2},
+{0xf9f0,0xf6422},
+{0xf9f1,0xf9122},
+{0xf9f2,0xfa3c2},
+{0xf9f3,0xfa762},
+{0xf9f4,0xefb62},
+{0xf9f5,0xf0e02},
+{0xf9f6,0xf5582},
+{0xf9f7,0xf3f42},
+{0xf9f8,0xf40a2},
+{0xf9f9,0xf42e2},
+{0xf9fa,0xf2042},
+{0xf9fb,0xf1682},
+{0xf9fc,0xf7442},
+{0xf9fd,0xe8062},
+{0xf9fe,0xf5e62},
+{0xf9ff,0xe93c2},
+{0xfa00,0xe92c2},
+{0xfa01,0xecf22},
+{0xfa02,0xee3a2},
+{0xfa03,0xf43a2},
+{0xfa04,0xebfe2},
+{0xfa05,0xf0bc2},
+{0xfa06,0xef382},
+{0xfa07,0xf7f22},
+{0xfa08,0xf6a62},
+{0xfa09,0xf8fe2},
+{0xfa0a,0xf6f62},
+{0xfa0b,0xed0e2},
+{0xfa0c,0xe8722},
+{0xfa0d,0xeace2},
+{0xfa0e,0xfb242},
+{0xfa0f,0xfb282},
+{0xfa10,0xeb3a2},
+{0xfa11,0xfb2c2},
+{0xfa12,0xef282},
+{0xfa13,0xfb302},
+{0xfa14,0xfb342},
+{0xfa15,0xe9042},
+{0xfa16,0xf20c2},
+{0xfa17,0xf2e02},
+{0xfa18,0xf3642},
+{0xfa19,0xf3982},
+{0xfa1a,0xf39c2},
+{0xfa1b,0xf3b82},
+{0xfa1c,0xf9582},
+{0xfa1d,0xf4322},
+{0xfa1e,0xf4e82},
+{0xfa1f,0xfb382},
+{0xfa20,0xf64a2},
+{0xfa21,0xfb3c2},
+{0xfa22,0xf7342},
+{0xfa23,0xfb402},
+{0xfa24,0xfb442},
+{0xfa25,0xf82a2},
+{0xfa26,0xf85c2},
+{0xfa27,0xfb482},
+{0xfa28,0xfb4c2},
+{0xfa29,0xfb502},
+{0xfa2a,0xf9c62},
+{0xfa2b,0xf9ca2},
+{0xfa2c,0xf9ce2},
+{0xfa2d,0xfa502},
+{0xfa2e,0xf8542},
+{0xfa2f,0xf91a2},
+{0xfa30,0xe8422},
+{0xfa31,0xe8662},
+{0xfa32,0xe87a2},
+{0xfa33,0xe97c2},
+{0xfa34,0xe9902},
+{0xfa35,0xe9dc2},
+{0xfa36,0xeabe2},
+{0xfa37,0xeada2},
+{0xfa38,0xeae22},
+{0xfa39,0xeb362},
+{0xfa3a,0xeb422},
+{0xfa3b,0xec662},
+{0xfa3c,0xec6e2},
+{0xfa3d,0xeda22},
+{0xfa3e,0xedca2},
+{0xfa3f,0xedd22},
+{0xfa40,0xedea2},
+{0xfa41,0xeeaa2},
+{0xfa42,0xeeee2},
+{0xfa43,0xef302},
+{0xfa44,0xefee2},
+{0xfa45,0xf0d42},
+{0xfa46,0xf0f02},
+{0xfa47,0xf1202},
+{0xfa48,0xf18c2},
+{0xfa49,0xf1ac2},
+{0xfa4a,0xf2422},
+{0xfa4b,0xf3422},
+{0xfa4c,0xf3682},
+{0xfa4d,0xf37c2},
+{0xfa4e,0xf3782},
+{0xfa4f,0xf3802},
+{0xfa50,0xf3842},
+{0xfa51,0xf3882},
+{0xfa52,0xf3b02},
+{0xfa53,0xf3b42},
+{0xfa54,0xf3d82},
+{0xfa55,0xf3ec2},
+{0xfa56,0xf4122},
+{0xfa57,0xf47a2},
+{0xfa58,0xf4822},
+{0xfa59,0xf48a2},
+{0xfa5a,0xf4bc2},
+{0xfa5b,0xf5002},
+{0xfa5c,0xf5682},
+{0xfa5d,0xf5aa2},
+{0xfa5e,0xf5aa2},
+{0xfa5f,0xf6222},
+{0xfa60,0xf6da2},
+{0xfa61,0xf6fe2},
+{0xfa62,0xf73c2},
+{0xfa63,0xf7402},
+{0xfa64,0xf79c2},
+{0xfa65,0xf7a02},
+{0xfa66,0xf8122},
+{0xfa67,0xf82a2},
+{0xfa68,0xf92e2},
+{0xfa69,0xf9802},
+{0xfa6a,0xf9982},
+{0xfa6b,0xed9a2},
+{0xfa6c,0xfd0c2},
+{0xfa6d,0xf58e2},
+{0xfa70,0xe75a2},
+{0xfa71,0xe8f02},
+{0xfa72,0xe88e2},
+{0xfa73,0xe8362},
+{0xfa74,0xe8762},
+{0xfa75,0xe8ba2},
+{0xfa76,0xe9782},
+{0xfa77,0xe99c2},
+{0xfa78,0xeabe2},
+{0xfa79,0xeaaa2},
+{0xfa7a,0xeaba2},
+{0xfa7b,0xead62},
+{0xfa7c,0xeb3a2},
+{0xfa7d,0xeb4a2},
+{0xfa7e,0xeb9e2},
+{0xfa7f,0xebaa2},
+{0xfa80,0xebce2},
+{0xfa81,0xebde2},
+{0xfa82,0xed0a2},
+{0xfa83,0xed122},
+{0xfa84,0xed502},
+{0xfa85,0xed702},
+{0xfa86,0xedaa2},
+{0xfa87,0xedc22},
+{0xfa88,0xedb22},
+{0xfa89,0xedd22},
+{0xfa8a,0xedc62},
+{0xfa8b,0xedea2},
+{0xfa8c,0xee062},
+{0xfa8d,0xee6e2},
+{0xfa8e,0xee7a2},
+{0xfa8f,0xee822},
+{0xfa90,0xeeae2},
+{0xfa91,0xef282},
+{0xfa92,0xef7a2},
+{0xfa93,0xef7e2},
+{0xfa94,0xefa62},
+{0xfa95,0xf03e2},
+{0xfa96,0xf0582},
+{0xfa97,0xf0c82},
+{0xfa98,0xf1142},
+{0xfa99,0xf10c2},
+{0xfa9a,0xf1202},
+{0xfa9b,0xf13c2},
+{0xfa9c,0xf18c2},
+{0xfa9d,0xf3262},
+{0xfa9e,0xf1ba2},
+{0xfa9f,0xf2002},
+{0xfaa0,0xf20c2},
+{0xfaa1,0xf2522},
+{0xfaa2,0xf26e2},
+{0xfaa3,0xf2962},
+{0xfaa4,0xf2c02},
+{0xfaa5,0xf2c42},
+{0xfaa6,0xf2e02},
+{0xfaa7,0xf2ec2},
+{0xfaa8,0xf30a2},
+{0xfaa9,0xf31e2},
+{0xfaaa,0xf31a2},
+{0xfaab,0xf34a2},
+{0xfaac,0xf3f02},
+{0xfaad,0xf4122},
+{0xfaae,0xf42a2},
+{0xfaaf,0xf4662},
+{0xfab0,0xf47a2},
+{0xfab1,0xf49a2},
+{0xfab2,0xf5002},
+{0xfab3,0xf5ea2},
+{0xfab4,0xf6122},
+{0xfab5,0xf68a2},
+{0xfab6,0xf6de2},
+{0xfab7,0xf6f22},
+{0xfab8,0xf6fe2},
+{0xfab9,0xf7202},
+{0xfaba,0xf7342},
+{0xfabb,0xf7242},
+{0xfabc,0xf73c2},
+{0xfabd,0xf7382},
+{0xfabe,0xf7302},
+{0xfabf,0xf7402},
+{0xfac0,0xf74c2},
+{0xfac1,0xf7a02},
+{0xfac2,0xf7ee2},
+{0xfac3,0xf8362},
+{0xfac4,0xf8702},
+{0xfac5,0xf8a42},
+{0xfac6,0xf90a2},
+{0xfac7,0xf92e2},
+{0xfac8,0xf9582},
+{0xfac9,0xf96c2},
+{0xfaca,0xf9802},
+{0xfacb,0xf98c2},
+{0xfacc,0xf9982},
+{0xfacd,0xfa162},
+{0xface,0xfb082},
+{0xfacf,0xfcb82},
+{0xfad0,0xfcb42},
+{0xfad1,0xfcdc2},
+{0xfad2,0xfba82},
+{0xfad3,0xfbd02},
+{0xfad4,0xfbd42},
+{0xfad5,0xfd442},
+{0xfad6,0xfd682},
+{0xfad7,0xfdc82},
+{0xfad8,0xfad22},
+{0xfad9,0xfb002},
+{0xfb00,0x42662},
+{0xfb01,0x42762},
+{0xfb02,0x427a2},
+{0xfb03,0x426a3},
+{0xfb04,0x42703},
+{0xfb05,0x4d0a3},
+{0xfb06,0x4d062},
+{0xfb13,0x5faa2},
+{0xfb14,0x5f9e2},
+{0xfb15,0x5fa22},
+{0xfb16,0x5fd62},
+{0xfb17,0x5fa62},
+{0xfb1d,0x605a2},
+{0xfb1e,0x35d01},
+{0xfb1f,0x60663},
+{0xfb20,0x60a01},
+{0xfb21,0x60001},
+{0xfb22,0x602a1},
+{0xfb23,0x60321},
+{0xfb24,0x606e1},
+{0xfb25,0x60801},
+{0xfb26,0x60881},
+{0xfb27,0x60c21},
+{0xfb28,0x60e41},
+{0xfb29,0x1ad41},
+{0xfb2a,0x60ce2},
+{0xfb2b,0x60ca2},
+{0xfb2c,0x60dc3},
+{0xfb2d,0x60d63},
+{0xfb2e,0x60022},
+{0xfb2f,0x60062},
+{0xfb30,0x600a2},
+{0xfb31,0x60162},
+{0xfb32,0x60222},
+{0xfb33,0x602c2},
+{0xfb34,0x60342},
+{0xfb35,0x603e2},
+{0xfb36,0x604c2},
+{0xfb38,0x60542},
+{0xfb39,0x605e2},
+{0xfb3a,0x60762},
+{0xfb3b,0x60722},
+{0xfb3c,0x60822},
+{0xfb3e,0x608c2},
+{0xfb40,0x60942},
+{0xfb41,0x609a2},
+{0xfb43,0x60aa2},
+{0xfb44,0x60a62},
+{0xfb46,0x60b62},
+{0xfb47,0x60bc2},
+{0xfb48,0x60c42},
+{0xfb49,0x60d22},
+{0xfb4a,0x60e62},
+{0xfb4b,0x603a2},
+{0xfb4c,0x601a2},
+{0xfb4d,0x607a2},
+{0xfb4e,0x60ae2},
+{0xfb4f,0x600e2},
+{0xfb50,0x61661},
+{0xfb51,0x61641},
+{0xfb52,0x62a81},
+{0xfb53,0x62a61},
+{0xfb54,0x62a21},
+{0xfb55,0x62a41},
+{0xfb56,0x62b21},
+{0xfb57,0x62b01},
+{0xfb58,0x62ac1},
+{0xfb59,0x62ae1},
+{0xfb5a,0x62bc1},
+{0xfb5b,0x62ba1},
+{0xfb5c,0x62b61},
+{0xfb5d,0x62b81},
+{0xfb5e,0x63d41},
+{0xfb5f,0x63d21},
+{0xfb60,0x63ce1},
+{0xfb61,0x63d01},
+{0xfb62,0x63e21},
+{0xfb63,0x63e01},
+{0xfb64,0x63dc1},
+{0xfb65,0x63de1},
+{0xfb66,0x63ca1},
+{0xfb67,0x63c81},
+{0xfb68,0x63c41},
+{0xfb69,0x63c61},
+{0xfb6a,0x69161},
+{0xfb6b,0x69141},
+{0xfb6c,0x69101},
+{0xfb6d,0x69121},
+{0xfb6e,0x69241},
+{0xfb6f,0x69221},
+{0xfb70,0x691e1},
+{0xfb71,0x69201},
+{0xfb72,0x64561},
+{0xfb73,0x64541},
+{0xfb74,0x64501},
+{0xfb75,0x64521},
+{0xfb76,0x644c1},
+{0xfb77,0x644a1},
+{0xfb78,0x64461},
+{0xfb79,0x64481},
+{0xfb7a,0x64601},
+{0xfb7b,0x645e1},
+{0xfb7c,0x645a1},
+{0xfb7d,0x645c1},
+{0xfb7e,0x646c1},
+{0xfb7f,0x646a1},
+{0xfb80,0x64661},
+{0xfb81,0x64681},
+{0xfb82,0x651a1},
+{0xfb83,0x65181},
+{0xfb84,0x65141},
+{0xfb85,0x65121},
+{0xfb86,0x65221},
+{0xfb87,0x65201},
+{0xfb88,0x65081},
+{0xfb89,0x65061},
+{0xfb8a,0x65681},
+{0xfb8b,0x65661},
+{0xfb8c,0x65561},
+{0xfb8d,0x65541},
+{0xfb8e,0x69f41},
+{0xfb8f,0x69f21},
+{0xfb90,0x69ee1},
+{0xfb91,0x69f01},
+{0xfb92,0x6a141},
+{0xfb93,0x6a121},
+{0xfb94,0x6a0e1},
+{0xfb95,0x6a101},
+{0xfb96,0x6a2e1},
+{0xfb97,0x6a2c1},
+{0xfb98,0x6a281},
+{0xfb99,0x6a2a1},
+{0xfb9a,0x6a221},
+{0xfb9b,0x6a201},
+{0xfb9c,0x6a1c1},
+{0xfb9d,0x6a1e1},
+{0xfb9e,0x6c341},
+{0xfb9f,0x6c321},
+{0xfba0,0x6c3e1},
+{0xfba1,0x6c3c1},
+{0xfba2,0x6c381},
+{0xfba3,0x6c3a1},
+{0xfba4,0x6ca62},
+{0xfba5,0x6ca22},
+{0xfba6,0x6c921},
+{0xfba7,0x6c901},
+{0xfba8,0x6c8c1},
+{0xfba9,0x6c8e1},
+{0xfbaa,0x6c881},
+{0xfbab,0x6c861},
+{0xfbac,0x6c821},
+{0xfbad,0x6c841},
+{0xfbae,0x6db41},
+{0xfbaf,0x6db21},
+{0xfbb0,0x6dbe2},
+{0xfbb1,0x6dba2},
+{0xfbb2,0x1ad61},
+{0xfbb3,0x1ad81},
+{0xfbb4,0x1ada1},
+{0xfbb5,0x1adc1},
+{0xfbb6,0x1ade1},
+{0xfbb7,0x1ae01},
+{0xfbb8,0x1ae21},
+{0xfbb9,0x1ae41},
+{0xfbba,0x1ae61},
+{0xfbbb,0x1ae81},
+{0xfbbc,0x1aea1},
+{0xfbbd,0x1aec1},
+{0xfbbe,0x1aee1},
+{0xfbbf,0x1af01},
+{0xfbc0,0x1af21},
+{0xfbc1,0x1af41},
+{0xfbd3,0x6a061},
+{0xfbd4,0x6a041},
+{0xfbd5,0x6a001},
+{0xfbd6,0x6a021},
+{0xfbd7,0x6cd21},
+{0xfbd8,0x6cd01},
+{0xfbd9,0x6ccc1},
+{0xfbda,0x6cca1},
+{0xfbdb,0x6ce01},
+{0xfbdc,0x6cde1},
+{0xfbdd,0x6cd82},
+{0xfbde,0x6cee1},
+{0xfbdf,0x6cec1},
+{0xfbe0,0x6cc61},
+{0xfbe1,0x6cc41},
+{0xfbe2,0x6ce61},
+{0xfbe3,0x6ce41},
+{0xfbe4,0x6d9e1},
+{0xfbe5,0x6d9c1},
+{0xfbe6,0x6d981},
+{0xfbe7,0x6d9a1},
+{0xfbe8,0x6cfc1},
+{0xfbe9,0x6cfe1},
+{0xfbea,0x61882},
+{0xfbeb,0x61842},
+{0xfbec,0x61c82},
+{0xfbed,0x61c42},
+{0xfbee,0x61d02},
+{0xfbef,0x61cc2},
+{0xfbf0,0x61e02},
+{0xfbf1,0x61dc2},
+{0xfbf2,0x61d82},
+{0xfbf3,0x61d42},
+{0xfbf4,0x61e82},
+{0xfbf5,0x61e42},
+{0xfbf6,0x62082},
+{0xfbf7,0x62042},
+{0xfbf8,0x62002},
+{0xfbf9,0x61f42},
+{0xfbfa,0x61f02},
+{0xfbfb,0x61ec2},
+{0xfbfc,0x6d901},
+{0xfbfd,0x6d8e1},
+{0xfbfe,0x6d8a1},
+{0xfbff,0x6d8c1},
+{0xfc00,0x61902},
+{0xfc01,0x61982},
+{0xfc02,0x61b42},
+{0xfc03,0x61f42},
+{0xfc04,0x61fc2},
+{0xfc05,0x624c2},
+{0xfc06,0x62542},
+{0xfc07,0x62622},
+{0xfc08,0x62802},
+{0xfc09,0x62942},
+{0xfc0a,0x629c2},
+{0xfc0b,0x62e62},
+{0xfc0c,0x63002},
+{0xfc0d,0x631a2},
+{0xfc0e,0x63442},
+{0xfc0f,0x63762},
+{0xfc10,0x637e2},
+{0xfc11,0x638e2},
+{0xfc12,0x63a62},
+{0xfc13,0x63b62},
+{0xfc14,0x63be2},
+{0xfc15,0x63f42},
+{0xfc16,0x64182},
+{0xfc17,0x64802},
+{0xfc18,0x648e2},
+{0xfc19,0x64be2},
+{0xfc1a,0x64c22},
+{0xfc1b,0x64ca2},
+{0xfc1c,0x658e2},
+{0xfc1d,0x65a62},
+{0xfc1e,0x65b82},
+{0xfc1f,0x65d82},
+{0xfc20,0x66d02},
+{0xfc21,0x672e2},
+{0xfc22,0x675e2},
+{0xfc23,0x67662},
+{0xfc24,0x677a2},
+{0xfc25,0x67962},
+{0xfc26,0x67c22},
+{0xfc27,0x67ce2},
+{0xfc28,0x680e2},
+{0xfc29,0x68262},
+{0xfc2a,0x68422},
+{0xfc2b,0x687e2},
+{0xfc2c,0x68862},
+{0xfc2d,0x68c82},
+{0xfc2e,0x68d02},
+{0xfc2f,0x68d82},
+{0xfc30,0x68ec2},
+{0xfc31,0x68fa2},
+{0xfc32,0x69022},
+{0xfc33,0x693e2},
+{0xfc34,0x694c2},
+{0xfc35,0x696c2},
+{0xfc36,0x69742},
+{0xfc37,0x698e2},
+{0xfc38,0x69962},
+{0xfc39,0x699e2},
+{0xfc3a,0x69a62},
+{0xfc3b,0x69b62},
+{0xfc3c,0x69c62},
+{0xfc3d,0x69e02},
+{0xfc3e,0x69e82},
+{0xfc3f,0x6a6c2},
+{0xfc40,0x6a922},
+{0xfc41,0x6ab22},
+{0xfc42,0x6ace2},
+{0xfc43,0x6aec2},
+{0xfc44,0x6af42},
+{0xfc45,0x6b1c2},
+{0xfc46,0x6b3c2},
+{0xfc47,0x6b5e2},
+{0xfc48,0x6b7c2},
+{0xfc49,0x6b862},
+{0xfc4a,0x6b8a2},
+{0xfc4b,0x6ba42},
+{0xfc4c,0x6bd02},
+{0xfc4d,0x6bea2},
+{0xfc4e,0x6c022},
+{0xfc4f,0x6c222},
+{0xfc50,0x6c2a2},
+{0xfc51,0x6c602},
+{0xfc52,0x6c682},
+{0xfc53,0x6c782},
+{0xfc54,0x6c7c2},
+{0xfc55,0x6d222},
+{0xfc56,0x6d302},
+{0xfc57,0x6d3e2},
+{0xfc58,0x6d562},
+{0xfc59,0x6d7c2},
+{0xfc5a,0x6d842},
+{0xfc5b,0x65002},
+{0xfc5c,0x65362},
+{0xfc5d,0x6d082},
+{0xfc5e,0x35f62},
+{0xfc5f,0x36022},
+{0xfc60,0x36142},
+{0xfc61,0x36282},
+{0xfc62,0x363a2},
+{0xfc63,0x36482},
+{0xfc64,0x61a02},
+{0xfc65,0x61a42},
+{0xfc66,0x61b02},
+{0xfc67,0x61b82},
+{0xfc68,0x61f02},
+{0xfc69,0x61f82},
+{0xfc6a,0x626c2},
+{0xfc6b,0x62702},
+{0xfc6c,0x627c2},
+{0xfc6d,0x62842},
+{0xfc6e,0x62902},
+{0xfc6f,0x62982},
+{0xfc70,0x63302},
+{0xfc71,0x63342},
+{0xfc72,0x63402},
+{0xfc73,0x63662},
+{0xfc74,0x63722},
+{0xfc75,0x637a2},
+{0xfc76,0x63922},
+{0xfc77,0x63962},
+{0xfc78,0x63a22},
+{0xfc79,0x63aa2},
+{0xfc7a,0x63b22},
+{0xfc7b,0x63ba2},
+{0xfc7c,0x68f62},
+{0xfc7d,0x68fe2},
+{0xfc7e,0x69682},
+{0xfc7f,0x69702},
+{0xfc80,0x698a2},
+{0xfc81,0x69b22},
+{0xfc82,0x69c22},
+{0xfc83,0x69dc2},
+{0xfc84,0x69e42},
+{0xfc85,0x6aca2},
+{0xfc86,0x6ae82},
+{0xfc87,0x6af02},
+{0xfc88,0x6b142},
+{0xfc89,0x6b782},
+{0xfc8a,0x6bee2},
+{0xfc8b,0x6bf22},
+{0xfc8c,0x6bfe2},
+{0xfc8d,0x6c122},
+{0xfc8e,0x6c1e2},
+{0xfc8f,0x6c262},
+{0xfc90,0x6d042},
+{0xfc91,0x6d422},
+{0xfc92,0x6d462},
+{0xfc93,0x6d522},
+{0xfc94,0x6d6c2},
+{0xfc95,0x6d782},
+{0xfc96,0x6d802},
+{0xfc97,0x618c2},
+{0xfc98,0x61942},
+{0xfc99,0x619c2},
+{0xfc9a,0x61a82},
+{0xfc9b,0x61bc2},
+{0xfc9c,0x62482},
+{0xfc9d,0x62502},
+{0xfc9e,0x625e2},
+{0xfc9f,0x62742},
+{0xfca0,0x62882},
+{0xfca1,0x62e22},
+{0xfca2,0x62fc2},
+{0xfca3,0x63162},
+{0xfca4,0x63382},
+{0xfca5,0x636a2},
+{0xfca6,0x639a2},
+{0xfca7,0x63f02},
+{0xfca8,0x64142},
+{0xfca9,0x647c2},
+{0xfcaa,0x648a2},
+{0xfcab,0x64ba2},
+{0xfcac,0x64c62},
+{0xfcad,0x65862},
+{0xfcae,0x659e2},
+{0xfcaf,0x65b02},
+{0xfcb0,0x65d02},
+{0xfcb1,0x66cc2},
+{0xfcb2,0x66e62},
+{0xfcb3,0x672a2},
+{0xfcb4,0x675a2},
+{0xfcb5,0x67622},
+{0xfcb6,0x67762},
+{0xfcb7,0x67922},
+{0xfcb8,0x67be2},
+{0xfcb9,0x68062},
+{0xfcba,0x68222},
+{0xfcbb,0x683e2},
+{0xfcbc,0x687a2},
+{0xfcbd,0x68822},
+{0xfcbe,0x68c42},
+{0xfcbf,0x68cc2},
+{0xfcc0,0x68d42},
+{0xfcc1,0x68e82},
+{0xfcc2,0x693a2},
+{0xfcc3,0x69482},
+{0xfcc4,0x69922},
+{0xfcc5,0x699a2},
+{0xfcc6,0x69a22},
+{0xfcc7,0x69aa2},
+{0xfcc8,0x69ba2},
+{0xfcc9,0x6a682},
+{0xfcca,0x6a8e2},
+{0xfccb,0x6aae2},
+{0xfccc,0x6ac22},
+{0xfccd,0x6ae42},
+{0xfcce,0x6b182},
+{0xfccf,0x6b382},
+{0xfcd0,0x6b5a2},
+{0xfcd1,0x6b742},
+{0xfcd2,0x6ba02},
+{0xfcd3,0x6bcc2},
+{0xfcd4,0x6be62},
+{0xfcd5,0x6bf62},
+{0xfcd6,0x6c162},
+{0xfcd7,0x6c5c2},
+{0xfcd8,0x6c642},
+{0xfcd9,0x6c582},
+{0xfcda,0x6d1e2},
+{0xfcdb,0x6d2c2},
+{0xfcdc,0x6d3a2},
+{0xfcdd,0x6d4a2},
+{0xfcde,0x6d702},
+{0xfcdf,0x61ac2},
+{0xfce0,0x61c02},
+{0xfce1,0x62782},
+{0xfce2,0x628c2},
+{0xfce3,0x633c2},
+{0xfce4,0x636e2},
+{0xfce5,0x639e2},
+{0xfce6,0x63ae2},
+{0xfce7,0x65d42},
+{0xfce8,0x65fe2},
+{0xfce9,0x66722},
+{0xfcea,0x669a2},
+{0xfceb,0x69ae2},
+{0xfcec,0x69be2},
+{0xfced,0x6ac62},
+{0xfcee,0x6bfa2},
+{0xfcef,0x6c1a2},
+{0xfcf0,0x6d4e2},
+{0xfcf1,0x6d742},
+{0xfcf2,0x36102},
+{0xfcf3,0x36242},
+{0xfcf4,0x36362},
+{0xfcf5,0x67ee2},
+{0xfcf6,0x67f62},
+{0xfcf7,0x68622},
+{0xfcf8,0x686a2},
+{0xfcf9,0x68a02},
+{0xfcfa,0x68a82},
+{0xfcfb,0x66062},
+{0xfcfc,0x660e2},
+{0xfcfd,0x66a22},
+{0xfcfe,0x66aa2},
+{0xfcff,0x64a22},
+{0xfd00,0x64aa2},
+{0xfd01,0x64382},
+{0xfd02,0x64402},
+{0xfd03,0x64d22},
+{0xfd04,0x64da2},
+{0xfd05,0x67422},
+{0xfd06,0x674a2},
+{0xfd07,0x679e2},
+{0xfd08,0x67a62},
+{0xfd09,0x662a2},
+{0xfd0a,0x66402},
+{0xfd0b,0x66622},
+{0xfd0c,0x667a2},
+{0xfd0d,0x666a2},
+{0xfd0e,0x65cc2},
+{0xfd0f,0x66ee2},
+{0xfd10,0x678e2},
+{0xfd11,0x67ea2},
+{0xfd12,0x67f22},
+{0xfd13,0x685e2},
+{0xfd14,0x68662},
+{0xfd15,0x689c2},
+{0xfd16,0x68a42},
+{0xfd17,0x66022},
+{0xfd18,0x660a2},
+{0xfd19,0x669e2},
+{0xfd1a,0x66a62},
+{0xfd1b,0x649e2},
+{0xfd1c,0x64a62},
+{0xfd1d,0x64342},
+{0xfd1e,0x643c2},
+{0xfd1f,0x64ce2},
+{0xfd20,0x64d62},
+{0xfd21,0x673e2},
+{0xfd22,0x67462},
+{0xfd23,0x679a2},
+{0xfd24,0x67a22},
+{0xfd25,0x66262},
+{0xfd26,0x663c2},
+{0xfd27,0x665e2},
+{0xfd28,0x66762},
+{0xfd29,0x66662},
+{0xfd2a,0x65c82},
+{0xfd2b,0x66ea2},
+{0xfd2c,0x678a2},
+{0xfd2d,0x661e2},
+{0xfd2e,0x66342},
+{0xfd2f,0x66562},
+{0xfd30,0x666e2},
+{0xfd31,0x65fa2},
+{0xfd32,0x66962},
+{0xfd33,0x67c62},
+{0xfd34,0x658a2},
+{0xfd35,0x65a22},
+{0xfd36,0x65b42},
+{0xfd37,0x66222},
+{0xfd38,0x66382},
+{0xfd39,0x665a2},
+{0xfd3a,0x67ca2},
+{0xfd3b,0x680a2},
+{0xfd3c,0x621c2},
+{0xfd3d,0x62202},
+{0xfd3e,0x1af61},
+{0xfd3f,0x1af81},
+{0xfd50,0x62ea3},
+{0xfd51,0x630a3},
+{0xfd52,0x63043},
+{0xfd53,0x63103},
+{0xfd54,0x631e3},
+{0xfd55,0x63483},
+{0xfd56,0x634e3},
+{0xfd57,0x63543},
+{0xfd58,0x64223},
+{0xfd59,0x641c3},
+{0xfd5a,0x64983},
+{0xfd5b,0x64923},
+{0xfd5c,0x65aa3},
+{0xfd5d,0x65923},
+{0xfd5e,0x65983},
+{0xfd5f,0x65e83},
+{0xfd60,0x65e23},
+{0xfd61,0x65dc3},
+{0xfd62,0x65f43},
+{0xfd63,0x65ee3},
+{0xfd64,0x66da3},
+{0xfd65,0x66d43},
+{0xfd66,0x67383},
+{0xfd67,0x664a3},
+{0xfd68,0x66443},
+{0xfd69,0x662e3},
+{0xfd6a,0x66843},
+{0xfd6b,0x667e3},
+{0xfd6c,0x66903},
+{0xfd6d,0x668a3},
+{0xfd6e,0x676a3},
+{0xfd6f,0x67843},
+{0xfd70,0x677e3},
+{0xfd71,0x67d83},
+{0xfd72,0x67d23},
+{0xfd73,0x67de3},
+{0xfd74,0x67e43},
+{0xfd75,0x68303},
+{0xfd76,0x684c3},
+{0xfd77,0x68463},
+{0xfd78,0x68523},
+{0xfd79,0x688a3},
+{0xfd7a,0x68963},
+{0xfd7b,0x68903},
+{0xfd7c,0x68e23},
+{0xfd7d,0x68dc3},
+{0xfd7e,0x69563},
+{0xfd7f,0x695c3},
+{0xfd80,0x6a9c3},
+{0xfd81,0x6aa83},
+{0xfd82,0x6aa23},
+{0xfd83,0x6a703},
+{0xfd84,0x6a763},
+{0xfd85,0x6abc3},
+{0xfd86,0x6ab63},
+{0xfd87,0x6ad83},
+{0xfd88,0x6ad23},
+{0xfd89,0x6b403},
+{0xfd8a,0x6b463},
+{0xfd8b,0x6b543},
+{0xfd8c,0x6b203},
+{0xfd8d,0x6b2c3},
+{0xfd8e,0x6b623},
+{0xfd8f,0x6b683},
+{0xfd92,0x6b263},
+{0xfd93,0x6c6c3},
+{0xfd94,0x6c723},
+{0xfd95,0x6bd43},
+{0xfd96,0x6bda3},
+{0xfd97,0x6bba3},
+{0xfd98,0x6bb43},
+{0xfd99,0x6bc03},
+{0xfd9a,0x6c0c3},
+{0xfd9b,0x6c063},
+{0xfd9c,0x6d603},
+{0xfd9d,0x6d5a3},
+{0xfd9e,0x62663},
+{0xfd9f,0x62f63},
+{0xfda0,0x62f03},
+{0xfda1,0x632a3},
+{0xfda2,0x63243},
+{0xfda3,0x63603},
+{0xfda4,0x635a3},
+{0xfda5,0x642e3},
+{0xfda6,0x63f83},
+{0xfda7,0x64283},
+{0xfda8,0x65bc3},
+{0xfda9,0x66e03},
+{0xfdaa,0x66503},
+{0xfdab,0x67703},
+{0xfdac,0x6a883},
+{0xfdad,0x6ade3},
+{0xfdae,0x6d343},
+{0xfdaf,0x6d263},
+{0xfdb0,0x6d663},
+{0xfdb1,0x6b803},
+{0xfdb2,0x69623},
+{0xfdb3,0x6be03},
+{0xfdb4,0x69503},
+{0xfdb5,0x6a963},
+{0xfdb6,0x68583},
+{0xfdb7,0x69d63},
+{0xfdb8,0x6ba83},
+{0xfdb9,0x6b6e3},
+{0xfdba,0x6a7c3},
+{0xfdbb,0x69d03},
+{0xfdbc,0x6a823},
+{0xfdbd,0x6bae3},
+{0xfdbe,0x63fe3},
+{0xfdbf,0x64843},
+{0xfdc0,0x6b323},
+{0xfdc1,0x68f03},
+{0xfdc2,0x62583},
+{0xfdc3,0x69ca3},
+{0xfdc4,0x682a3},
+{0xfdc5,0x67323},
+{0xfdc6,0x65c23},
+{0xfdc7,0x6bc63},
+{0xfdf0,0x67243},
+{0xfdf1,0x69423},
+{0xfdf2,0x62304},
+{0xfdf3,0x62284},
+{0xfdf4,0x6b4c4},
+{0xfdf5,0x66f24},
+{0xfdf6,0x653a4},
+{0xfdf7,0x68364},
+{0xfdf8,0x6cb84},
+{0xfdf9,0x66fa3},
+{0xfdfa,0x67012},
+{0xfdfb,0x64048},
+{0xfdfc,0x65424},
+{0xfdfd,0x1afa1},
+{0xfe00,0x1},
+{0xfe01,0x1},
+{0xfe02,0x1},
+{0xfe03,0x1},
+{0xfe04,0x1},
+{0xfe05,0x1},
+{0xfe06,0x1},
+{0xfe07,0x1},
+{0xfe08,0x1},
+{0xfe09,0x1},
+{0xfe0a,0x1},
+{0xfe0b,0x1},
+{0xfe0c,0x1},
+{0xfe0d,0x1},
+{0xfe0e,0x1},
+{0xfe0f,0x1},
+{0xfe10,0x1afc1},
+{0xfe11,0x1afe1},
+{0xfe12,0x1b001},
+{0xfe13,0x1b021},
+{0xfe14,0x1b041},
+{0xfe15,0x1b061},
+{0xfe16,0x1b081},
+{0xfe17,0x1b0a1},
+{0xfe18,0x1b0c1},
+{0xfe19,0x1b0e3},
+{0xfe20,0x35ac1},
+{0xfe21,0x1},
+{0xfe22,0x35aa1},
+{0xfe23,0x1},
+{0xfe24,0x1},
+{0xfe25,0x1},
+{0xfe26,0x1},
+{0xfe27,0x35721},
+{0xfe28,0x1},
+{0xfe29,0x35aa1},
+{0xfe2a,0x1},
+{0xfe2b,0x1},
+{0xfe2c,0x1},
+{0xfe2d,0x1},
+{0xfe2e,0x35ae1},
+{0xfe2f,0x1},
+{0xfe30,0x1b142},
+{0xfe31,0x1b181},
+{0xfe32,0x1b1a1},
+{0xfe33,0x1b1c1},
+{0xfe34,0x1b1c1},
+{0xfe35,0x1b1e1},
+{0xfe36,0x1b201},
+{0xfe37,0x1b221},
+{0xfe38,0x1b241},
+{0xfe39,0x1b261},
+{0xfe3a,0x1b281},
+{0xfe3b,0x1b2a1},
+{0xfe3c,0x1b2c1},
+{0xfe3d,0x1b2e1},
+{0xfe3e,0x1b301},
+{0xfe3f,0x1b321},
+{0xfe40,0x1b341},
+{0xfe41,0x1b361},
+{0xfe42,0x1b381},
+{0xfe43,0x1b3a1},
+{0xfe44,0x1b3c1},
+{0xfe45,0x1b3e1},
+{0xfe46,0x1b401},
+{0xfe47,0x1b421},
+{0xfe48,0x1b441},
+{0xfe49,0x1b461},
+{0xfe4a,0x1b461},
+{0xfe4b,0x1b461},
+{0xfe4c,0x1b461},
+{0xfe4d,0x1b481},
+{0xfe4e,0x1b481},
+{0xfe4f,0x1b481},
+{0xfe50,0x1b4a1},
+{0xfe51,0x1b4c1},
+{0xfe52,0x1b4e1},
+{0xfe54,0x1b501},
+{0xfe55,0x1b521},
+{0xfe56,0x1b541},
+{0xfe57,0x1b561},
+{0xfe58,0x1b581},
+{0xfe59,0x1b5a1},
+{0xfe5a,0x1b5c1},
+{0xfe5b,0x1b5e1},
+{0xfe5c,0x1b601},
+{0xfe5d,0x1b621},
+{0xfe5e,0x1b641},
+{0xfe5f,0x1b661},
+{0xfe60,0x1b681},
+{0xfe61,0x1b6a1},
+{0xfe62,0x1b6c1},
+{0xfe63,0x1b6e1},
+{0xfe64,0x1b701},
+{0xfe65,0x1b721},
+{0xfe66,0x1b741},
+{0xfe68,0x1b761},
+{0xfe69,0x37b01},
+{0xfe6a,0x1b781},
+{0xfe6b,0x1b7a1},
+{0xfe70,0x35ec1},
+{0xfe71,0x35ea1},
+{0xfe72,0x35f41},
+{0xfe73,0x1},
+{0xfe74,0x36001},
+{0xfe76,0x360e1},
+{0xfe77,0x360c1},
+{0xfe78,0x36221},
+{0xfe79,0x36201},
+{0xfe7a,0x36341},
+{0xfe7b,0x36321},
+{0xfe7c,0x36461},
+{0xfe7d,0x36441},
+{0xfe7e,0x36501},
+{0xfe7f,0x364e1},
+{0xfe80,0x614e1},
+{0xfe81,0x61581},
+{0xfe82,0x61561},
+{0xfe83,0x615e1},
+{0xfe84,0x615c1},
+{0xfe85,0x616c1},
+{0xfe86,0x616a1},
+{0xfe87,0x61721},
+{0xfe88,0x61701},
+{0xfe89,0x61821},
+{0xfe8a,0x61801},
+{0xfe8b,0x617c1},
+{0xfe8c,0x617e1},
+{0xfe8d,0x621a1},
+{0xfe8e,0x62181},
+{0xfe8f,0x62461},
+{0xfe90,0x62441},
+{0xfe91,0x62401},
+{0xfe92,0x62421},
+{0xfe93,0x62d41},
+{0xfe94,0x62d21},
+{0xfe95,0x62e01},
+{0xfe96,0x62de1},
+{0xfe97,0x62da1},
+{0xfe98,0x62dc1},
+{0xfe99,0x638c1},
+{0xfe9a,0x638a1},
+{0xfe9b,0x63861},
+{0xfe9c,0x63881},
+{0xfe9d,0x63ee1},
+{0xfe9e,0x63ec1},
+{0xfe9f,0x63e81},
+{0xfea0,0x63ea1},
+{0xfea1,0x647a1},
+{0xfea2,0x64781},
+{0xfea3,0x64741},
+{0xfea4,0x64761},
+{0xfea5,0x64b81},
+{0xfea6,0x64b61},
+{0xfea7,0x64b21},
+{0xfea8,0x64b41},
+{0xfea9,0x64f61},
+{0xfeaa,0x64f41},
+{0xfeab,0x64fe1},
+{0xfeac,0x64fc1},
+{0xfead,0x65341},
+{0xfeae,0x65321},
+{0xfeaf,0x65501},
+{0xfeb0,0x654e1},
+{0xfeb1,0x65841},
+{0xfeb2,0x65821},
+{0xfeb3,0x657e1},
+{0xfeb4,0x65801},
+{0xfeb5,0x661c1},
+{0xfeb6,0x661a1},
+{0xfeb7,0x66161},
+{0xfeb8,0x66181},
+{0xfeb9,0x66ca1},
+{0xfeba,0x66c81},
+{0xfebb,0x66c41},
+{0xfebc,0x66c61},
+{0xfebd,0x67581},
+{0xfebe,0x67561},
+{0xfebf,0x67521},
+{0xfec0,0x67541},
+{0xfec1,0x67bc1},
+{0xfec2,0x67ba1},
+{0xfec3,0x67b61},
+{0xfec4,0x67b81},
+{0xfec5,0x68041},
+{0xfec6,0x68021},
+{0xfec7,0x67fe1},
+{0xfec8,0x68001},
+{0xfec9,0x68201},
+{0xfeca,0x681e1},
+{0xfecb,0x681a1},
+{0xfecc,0x681c1},
+{0xfecd,0x68781},
+{0xfece,0x68761},
+{0xfecf,0x68721},
+{0xfed0,0x68741},
+{0xfed1,0x68c21},
+{0xfed2,0x68c01},
+{0xfed3,0x68bc1},
+{0xfed4,0x68be1},
+{0xfed5,0x69381},
+{0xfed6,0x69361},
+{0xfed7,0x69321},
+{0xfed8,0x69341},
+{0xfed9,0x69881},
+{0xfeda,0x69861},
+{0xfedb,0x69821},
+{0xfedc,0x69841},
+{0xfedd,0x6a461},
+{0xfede,0x6a441},
+{0xfedf,0x6a401},
+{0xfee0,0x6a421},
+{0xfee1,0x6b0e1},
+{0xfee2,0x6b0c1},
+{0xfee3,0x6b081},
+{0xfee4,0x6b0a1},
+{0xfee5,0x6b9e1},
+{0xfee6,0x6b9c1},
+{0xfee7,0x6b981},
+{0xfee8,0x6b9a1},
+{0xfee9,0x6c561},
+{0xfeea,0x6c541},
+{0xfeeb,0x6c501},
+{0xfeec,0x6c521},
+{0xfeed,0x6cb21},
+{0xfeee,0x6cb01},
+{0xfeef,0x6d021},
+{0xfef0,0x6d001},
+{0xfef1,0x6d181},
+{0xfef2,0x6d161},
+{0xfef3,0x6d121},
+{0xfef4,0x6d141},
+{0xfef5,0x6a4c2},
+{0xfef6,0x6a482},
+{0xfef7,0x6a542},
+{0xfef8,0x6a502},
+{0xfef9,0x6a5c2},
+{0xfefa,0x6a582},
+{0xfefb,0x6a642},
+{0xfefc,0x6a602},
+{0xfeff,0x1},
+{0xff01,0x1b7c1},
+{0xff02,0x1b7e1},
+{0xff03,0x1b801},
+{0xff04,0x37ae1},
+{0xff05,0x1b821},
+{0xff06,0x1b841},
+{0xff07,0x1b861},
+{0xff08,0x1b881},
+{0xff09,0x1b8a1},
+{0xff0a,0x1b8c1},
+{0xff0b,0x1b8e1},
+{0xff0c,0x1b901},
+{0xff0d,0x1b921},
+{0xff0e,0x1b941},
+{0xff0f,0x1b961},
+{0xff10,0x380e1},
+{0xff11,0x38301},
+{0xff12,0x3a061},
+{0xff13,0x3aee1},
+{0xff14,0x3b661},
+{0xff15,0x3bc21},
+{0xff16,0x3c001},
+{0xff17,0x3c321},
+{0xff18,0x3c6a1},
+{0xff19,0x3c9c1},
+{0xff1a,0x1b981},
+{0xff1b,0x1b9a1},
+{0xff1c,0x1b9c1},
+{0xff1d,0x1b9e1},
+{0xff1e,0x1ba01},
+{0xff1f,0x1ba21},
+{0xff20,0x1ba41},
+{0xff21,0x3cda1},
+{0xff22,0x3ee21},
+{0xff23,0x3f461},
+{0xff24,0x400a1},
+{0xff25,0x40e01},
+{0xff26,0x423c1},
+{0xff27,0x42b61},
+{0xff28,0x43621},
+{0xff29,0x440a1},
+{0xff2a,0x450e1},
+{0xff2b,0x45541},
+{0xff2c,0x46101},
+{0xff2d,0x46fa1},
+{0xff2e,0x47c01},
+{0xff2f,0x48941},
+{0xff30,0x4aa01},
+{0xff31,0x4b361},
+{0xff32,0x4b6a1},
+{0xff33,0x4c561},
+{0xff34,0x4d4c1},
+{0xff35,0x4dfe1},
+{0xff36,0x4f921},
+{0xff37,0x501a1},
+{0xff38,0x50841},
+{0xff39,0x50de1},
+{0xff3a,0x51601},
+{0xff3b,0x1ba61},
+{0xff3c,0x1ba81},
+{0xff3d,0x1baa1},
+{0xff3e,0x1bac1},
+{0xff3f,0x1bae1},
+{0xff40,0x1bb01},
+{0xff41,0x3cca1},
+{0xff42,0x3ed21},
+{0xff43,0x3f361},
+{0xff44,0x3ffa1},
+{0xff45,0x40d01},
+{0xff46,0x422c1},
+{0xff47,0x42a61},
+{0xff48,0x43521},
+{0xff49,0x43fa1},
+{0xff4a,0x45001},
+{0xff4b,0x45441},
+{0xff4c,0x46001},
+{0xff4d,0x46ea1},
+{0xff4e,0x47b01},
+{0xff4f,0x48841},
+{0xff50,0x4a901},
+{0xff51,0x4b281},
+{0xff52,0x4b5a1},
+{0xff53,0x4c461},
+{0xff54,0x4d3c1},
+{0xff55,0x4dee1},
+{0xff56,0x4f821},
+{0xff57,0x500a1},
+{0xff58,0x50741},
+{0xff59,0x50d01},
+{0xff5a,0x51501},
+{0xff5b,0x1bb21},
+{0xff5c,0x1bb41},
+{0xff5d,0x1bb61},
+{0xff5e,0x1bb81},
+{0xff5f,0x1bba1},
+{0xff60,0x1bbc1},
+{0xff61,0x1bbe1},
+{0xff62,0x1bc01},
+{0xff63,0x1bc21},
+{0xff64,0x1bc41},
+{0xff65,0x1bc61},
+{0xff66,0xb7521},
+{0xff67,0xb1d21},
+{0xff68,0xb2021},
+{0xff69,0xb2201},
+{0xff6a,0xb23e1},
+{0xff6b,0xb2601},
+{0xff6c,0xb6881},
+{0xff6d,0xb6a41},
+{0xff6e,0xb6b81},
+{0xff6f,0xb4321},
+{0xff70,0x379e1},
+{0xff71,0xb1d61},
+{0xff72,0xb2061},
+{0xff73,0xb2241},
+{0xff74,0xb2421},
+{0xff75,0xb2641},
+{0xff76,0xb27c1},
+{0xff77,0xb2b21},
+{0xff78,0xb30e1},
+{0xff79,0xb34a1},
+{0xff7a,0xb3601},
+{0xff7b,0xb3861},
+{0xff7c,0xb3ac1},
+{0xff7d,0xb3cc1},
+{0xff7e,0xb3dc1},
+{0xff7f,0xb3f81},
+{0xff80,0xb4081},
+{0xff81,0xb4201},
+{0xff82,0xb4361},
+{0xff83,0xb4461},
+{0xff84,0xb4621},
+{0xff85,0xb47c1},
+{0xff86,0xb4881},
+{0xff87,0xb4921},
+{0xff88,0xb49a1},
+{0xff89,0xb4a21},
+{0xff8a,0xb4b21},
+{0xff8b,0xb4f01},
+{0xff8c,0xb52a1},
+{0xff8d,0xb56a1},
+{0xff8e,0xb5bc1},
+{0xff8f,0xb6041},
+{0xff90,0xb6341},
+{0xff91,0xb6561},
+{0xff92,0xb65e1},
+{0xff93,0xb67e1},
+{0xff94,0xb68c1},
+{0xff95,0xb6a81},
+{0xff96,0xb6bc1},
+{0xff97,0xb6ca1},
+{0xff98,0xb6d41},
+{0xff99,0xb6ea1},
+{0xff9a,0xb7061},
+{0xff9b,0xb7201},
+{0xff9c,0xb72c1},
+{0xff9d,0xb75e1},
+{0xff9e,0x357a1},
+{0xff9f,0x357e1},
+{0xffa0,0xaf5e1},
+{0xffa1,0xac9a1},
+{0xffa2,0xacac1},
+{0xffa3,0xb0881},
+{0xffa4,0xacba1},
+{0xffa5,0xb0901},
+{0xffa6,0xb0961},
+{0xffa7,0xacd41},
+{0xffa8,0xace61},
+{0xffa9,0xacf41},
+{0xffaa,0xb0a01},
+{0xffab,0xb0a61},
+{0xffac,0xb0ac1},
+{0xffad,0xb0b21},
+{0xffae,0xb0b81},
+{0xffaf,0xb0be1},
+{0xffb0,0xae661},
+{0xffb1,0xad0e1},
+{0xffb2,0xad281},
+{0xffb3,0xad3a1},
+{0xffb4,0xae801},
+{0xffb5,0xad481},
+{0xffb6,0xad5a1},
+{0xffb7,0xad681},
+{0xffb8,0xada01},
+{0xffb9,0xadc21},
+{0xffba,0xadd01},
+{0xffbb,0xadf41},
+{0xffbc,0xae0e1},
+{0xffbd,0xae281},
+{0xffbe,0xae421},
+{0xffc2,0xaf641},
+{0xffc3,0xaf6a1},
+{0xffc4,0xaf701},
+{0xffc5,0xaf761},
+{0xffc6,0xaf7c1},
+{0xffc7,0xaf821},
+{0xffca,0xaf881},
+{0xffcb,0xaf8e1},
+{0xffcc,0xaf941},
+{0xffcd,0xaf9a1},
+{0xffce,0xafa01},
+{0xffcf,0xafa61},
+{0xffd2,0xafac1},
+{0xffd3,0xafb21},
+{0xffd4,0xafb81},
+{0xffd5,0xafbe1},
+{0xffd6,0xafc41},
+{0xffd7,0xafca1},
+{0xffda,0xafd01},
+{0xffdb,0xafd61},
+{0xffdc,0xafdc1},
+{0xffe0,0x37aa1},
+{0xffe1,0x37b41},
+{0xffe2,0x1bc81},
+{0xffe3,0x1bca1},
+{0xffe4,0x1bcc1},
+{0xffe5,0x37b81},
+{0xffe6,0x37e01},
+{0xffe8,0x1bce1},
+{0xffe9,0x1bd01},
+{0xffea,0x1bd21},
+{0xffeb,0x1bd41},
+{0xffec,0x1bd61},
+{0xffed,0x1bd81},
+{0xffee,0x1bda1},
+{0xfff9,0x1},
+{0xfffa,0x1},
+{0xfffb,0x1},
+{0xfffc,0x1bdc1},
+{0xfffd,0xfe181},
+{0x10000,0xc8ec1},
+{0x10001,0xc8ee1},
+{0x10002,0xc8f01},
+{0x10003,0xc8f21},
+{0x10004,0xc8f41},
+{0x10005,0xc8f61},
+{0x10006,0xc8f81},
+{0x10007,0xc8fa1},
+{0x10008,0xc8fc1},
+{0x10009,0xc8fe1},
+{0x1000a,0xc9001},
+{0x1000b,0xc9021},
+{0x1000d,0xc9041},
+{0x1000e,0xc9061},
+{0x1000f,0xc9081},
+{0x10010,0xc90a1},
+{0x10011,0xc90c1},
+{0x10012,0xc90e1},
+{0x10013,0xc9101},
+{0x10014,0xc9121},
+{0x10015,0xc9141},
+{0x10016,0xc9161},
+{0x10017,0xc9181},
+{0x10018,0xc91a1},
+{0x10019,0xc91c1},
+{0x1001a,0xc91e1},
+{0x1001b,0xc9201},
+{0x1001c,0xc9221},
+{0x1001d,0xc9241},
+{0x1001e,0xc9261},
+{0x1001f,0xc9281},
+{0x10020,0xc92a1},
+{0x10021,0xc92c1},
+{0x10022,0xc92e1},
+{0x10023,0xc9301},
+{0x10024,0xc9321},
+{0x10025,0xc9341},
+{0x10026,0xc9361},
+{0x10028,0xc9381},
+{0x10029,0xc93a1},
+{0x1002a,0xc93c1},
+{0x1002b,0xc93e1},
+{0x1002c,0xc9401},
+{0x1002d,0xc9421},
+{0x1002e,0xc9441},
+{0x1002f,0xc9461},
+{0x10030,0xc9481},
+{0x10031,0xc94a1},
+{0x10032,0xc94c1},
+{0x10033,0xc94e1},
+{0x10034,0xc9501},
+{0x10035,0xc9521},
+{0x10036,0xc9541},
+{0x10037,0xc9561},
+{0x10038,0xc9581},
+{0x10039,0xc95a1},
+{0x1003a,0xc95c1},
+{0x1003c,0xc95e1},
+{0x1003d,0xc9601},
+{0x1003f,0xc9621},
+{0x10040,0xc9641},
+{0x10041,0xc9661},
+{0x10042,0xc9681},
+{0x10043,0xc96a1},
+{0x10044,0xc96c1},
+{0x10045,0xc96e1},
+{0x10046,0xc9701},
+{0x10047,0xc9721},
+{0x10048,0xc9741},
+{0x10049,0xc9761},
+{0x1004a,0xc9781},
+{0x1004b,0xc97a1},
+{0x1004c,0xc97c1},
+{0x1004d,0xc97e1},
+{0x10050,0xc9801},
+{0x10051,0xc9821},
+{0x10052,0xc9841},
+{0x10053,0xc9861},
+{0x10054,0xc9881},
+{0x10055,0xc98a1},
+{0x10056,0xc98c1},
+{0x10057,0xc98e1},
+{0x10058,0xc9901},
+{0x10059,0xc9921},
+{0x1005a,0xc9941},
+{0x1005b,0xc9961},
+{0x1005c,0xc9981},
+{0x1005d,0xc99a1},
+{0x10080,0xc99c1},
+{0x10081,0xc99e1},
+{0x10082,0xc9a01},
+{0x10083,0xc9a21},
+{0x10084,0xc9a41},
+{0x10085,0xc9a61},
+{0x10086,0xc9a81},
+{0x10087,0xc9aa1},
+{0x10088,0xc9ac1},
+{0x10089,0xc9ae1},
+{0x1008a,0xc9b01},
+{0x1008b,0xc9b21},
+{0x1008c,0xc9b41},
+{0x1008d,0xc9b61},
+{0x1008e,0xc9b81},
+{0x1008f,0xc9ba1},
+{0x10090,0xc9bc1},
+{0x10091,0xc9be1},
+{0x10092,0xc9c01},
+{0x10093,0xc9c21},
+{0x10094,0xc9c41},
+{0x10095,0xc9c61},
+{0x10096,0xc9c81},
+{0x10097,0xc9ca1},
+{0x10098,0xc9cc1},
+{0x10099,0xc9ce1},
+{0x1009a,0xc9d01},
+{0x1009b,0xc9d21},
+{0x1009c,0xc9d41},
+{0x1009d,0xc9d61},
+{0x1009e,0xc9d81},
+{0x1009f,0xc9da1},
+{0x100a0,0xc9dc1},
+{0x100a1,0xc9de1},
+{0x100a2,0xc9e01},
+{0x100a3,0xc9e21},
+{0x100a4,0xc9e41},
+{0x100a5,0xc9e61},
+{0x100a6,0xc9e81},
+{0x100a7,0xc9ea1},
+{0x100a8,0xc9ec1},
+{0x100a9,0xc9ee1},
+{0x100aa,0xc9f01},
+{0x100ab,0xc9f21},
+{0x100ac,0xc9f41},
+{0x100ad,0xc9f61},
+{0x100ae,0xc9f81},
+{0x100af,0xc9fa1},
+{0x100b0,0xc9fc1},
+{0x100b1,0xc9fe1},
+{0x100b2,0xca001},
+{0x100b3,0xca021},
+{0x100b4,0xca041},
+{0x100b5,0xca061},
+{0x100b6,0xca081},
+{0x100b7,0xca0a1},
+{0x100b8,0xca0c1},
+{0x100b9,0xca0e1},
+{0x100ba,0xca101},
+{0x100bb,0xca121},
+{0x100bc,0xca141},
+{0x100bd,0xca161},
+{0x100be,0xca181},
+{0x100bf,0xca1a1},
+{0x100c0,0xca1c1},
+{0x100c1,0xca1e1},
+{0x100c2,0xca201},
+{0x100c3,0xca221},
+{0x100c4,0xca241},
+{0x100c5,0xca261},
+{0x100c6,0xca281},
+{0x100c7,0xca2a1},
+{0x100c8,0xca2c1},
+{0x100c9,0xca2e1},
+{0x100ca,0xca301},
+{0x100cb,0xca321},
+{0x100cc,0xca341},
+{0x100cd,0xca361},
+{0x100ce,0xca381},
+{0x100cf,0xca3a1},
+{0x100d0,0xca3c1},
+{0x100d1,0xca3e1},
+{0x100d2,0xca401},
+{0x100d3,0xca421},
+{0x100d4,0xca441},
+{0x100d5,0xca461},
+{0x100d6,0xca481},
+{0x100d7,0xca4a1},
+{0x100d8,0xca4c1},
+{0x100d9,0xca4e1},
+{0x100da,0xca501},
+{0x100db,0xca521},
+{0x100dc,0xca541},
+{0x100dd,0xca561},
+{0x100de,0xca581},
+{0x100df,0xca5a1},
+{0x100e0,0xca5c1},
+{0x100e1,0xca5e1},
+{0x100e2,0xca601},
+{0x100e3,0xca621},
+{0x100e4,0xca641},
+{0x100e5,0xca661},
+{0x100e6,0xca681},
+{0x100e7,0xca6a1},
+{0x100e8,0xca6c1},
+{0x100e9,0xca6e1},
+{0x100ea,0xca701},
+{0x100eb,0xca721},
+{0x100ec,0xca741},
+{0x100ed,0xca761},
+{0x100ee,0xca781},
+{0x100ef,0xca7a1},
+{0x100f0,0xca7c1},
+{0x100f1,0xca7e1},
+{0x100f2,0xca801},
+{0x100f3,0xca821},
+{0x100f4,0xca841},
+{0x100f5,0xca861},
+{0x100f6,0xca881},
+{0x100f7,0xca8a1},
+{0x100f8,0xca8c1},
+{0x100f9,0xca8e1},
+{0x100fa,0xca901},
+{0x10100,0x1bde1},
+{0x10101,0x1be01},
+{0x10102,0x1be21},
+{0x10107,0x382e1},
+{0x10108,0x3a041},
+{0x10109,0x3aec1},
+{0x1010a,0x3b641},
+{0x1010b,0x3bc01},
+{0x1010c,0x3bfe1},
+{0x1010d,0x3c301},
+{0x1010e,0x3c681},
+{0x1010f,0x3c9a1},
+{0x10110,0x1be41},
+{0x10111,0x1be61},
+{0x10112,0x1be81},
+{0x10113,0x1bea1},
+{0x10114,0x1bec1},
+{0x10115,0x1bee1},
+{0x10116,0x1bf01},
+{0x10117,0x1bf21},
+{0x10118,0x1bf41},
+{0x10119,0x1bf61},
+{0x1011a,0x1bf81},
+{0x1011b,0x1bfa1},
+{0x1011c,0x1bfc1},
+{0x1011d,0x1bfe1},
+{0x1011e,0x1c001},
+{0x1011f,0x1c021},
+{0x10120,0x1c041},
+{0x10121,0x1c061},
+{0x10122,0x1c081},
+{0x10123,0x1c0a1},
+{0x10124,0x1c0c1},
+{0x10125,0x1c0e1},
+{0x10126,0x1c101},
+{0x10127,0x1c121},
+{0x10128,0x1c141},
+{0x10129,0x1c161},
+{0x1012a,0x1c181},
+{0x1012b,0x1c1a1},
+{0x1012c,0x1c1c1},
+{0x1012d,0x1c1e1},
+{0x1012e,0x1c201},
+{0x1012f,0x1c221},
+{0x10130,0x1c241},
+{0x10131,0x1c261},
+{0x10132,0x1c281},
+{0x10133,0x1c2a1},
+{0x10137,0x1c2c1},
+{0x10138,0x1c2e1},
+{0x10139,0x1c301},
+{0x1013a,0x1c321},
+{0x1013b,0x1c341},
+{0x1013c,0x1c361},
+{0x1013d,0x1c381},
+{0x1013e,0x1c3a1},
+{0x1013f,0x1c3c1},
+{0x10140,0x1c3e1},
+{0x10141,0x1c401},
+{0x10142,0x382e1},
+{0x10143,0x3bc01},
+{0x10144,0x1c421},
+{0x10145,0x1c441},
+{0x10146,0x1c461},
+{0x10147,0x1c481},
+{0x10148,0x3bc01},
+{0x10149,0x1c4a1},
+{0x1014a,0x1c4c1},
+{0x1014b,0x1c4e1},
+{0x1014c,0x1c501},
+{0x1014d,0x1c521},
+{0x1014e,0x1c541},
+{0x1014f,0x3bc01},
+{0x10150,0x1c561},
+{0x10151,0x1c581},
+{0x10152,0x1c5a1},
+{0x10153,0x1c5c1},
+{0x10154,0x1c5e1},
+{0x10155,0x1c601},
+{0x10156,0x1c621},
+{0x10157,0x1c641},
+{0x10158,0x382e1},
+{0x10159,0x382e1},
+{0x1015a,0x382e1},
+{0x1015b,0x3a041},
+{0x1015c,0x3a041},
+{0x1015d,0x3a041},
+{0x1015e,0x3a041},
+{0x1015f,0x3bc01},
+{0x10160,0x1c661},
+{0x10161,0x1c681},
+{0x10162,0x1c6a1},
+{0x10163,0x1c6c1},
+{0x10164,0x1c6e1},
+{0x10165,0x1c701},
+{0x10166,0x1c721},
+{0x10167,0x1c741},
+{0x10168,0x1c761},
+{0x10169,0x1c781},
+{0x1016a,0x1c7a1},
+{0x1016b,0x1c7c1},
+{0x1016c,0x1c7e1},
+{0x1016d,0x1c801},
+{0x1016e,0x1c821},
+{0x1016f,0x1c841},
+{0x10170,0x1c861},
+{0x10171,0x1c881},
+{0x10172,0x1c8a1},
+{0x10173,0x3bc01},
+{0x10174,0x1c8c1},
+{0x10175,0x1c8e1},
+{0x10176,0x1c901},
+{0x10177,0x1c921},
+{0x10178,0x1c941},
+{0x10179,0x1c961},
+{0x1017a,0x1c981},
+{0x1017b,0x1c9a1},
+{0x1017c,0x1c9c1},
+{0x1017d,0x1c9e1},
+{0x1017e,0x1ca01},
+{0x1017f,0x1ca21},
+{0x10180,0x1ca41},
+{0x10181,0x1ca61},
+{0x10182,0x1ca81},
+{0x10183,0x1caa1},
+{0x10184,0x1cac1},
+{0x10185,0x1cae1},
+{0x10186,0x1cb01},
+{0x10187,0x1cb21},
+{0x10188,0x1cb41},
+{0x10189,0x1cb61},
+{0x1018a,0x380c1},
+{0x1018b,0x1cb81},
+{0x1018c,0x1cba1},
+{0x10190,0x1cbc1},
+{0x10191,0x1cbe1},
+{0x10192,0x1cc01},
+{0x10193,0x1cc21},
+{0x10194,0x1cc41},
+{0x10195,0x1cc61},
+{0x10196,0x1cc81},
+{0x10197,0x1cca1},
+{0x10198,0x1ccc1},
+{0x10199,0x1cce1},
+{0x1019a,0x1cd01},
+{0x1019b,0x1cd21},
+{0x101a0,0x1cd41},
+{0x101d0,0x1cd61},
+{0x101d1,0x1cd81},
+{0x101d2,0x1cda1},
+{0x101d3,0x1cdc1},
+{0x101d4,0x1cde1},
+{0x101d5,0x1ce01},
+{0x101d6,0x1ce21},
+{0x101d7,0x1ce41},
+{0x101d8,0x1ce61},
+{0x101d9,0x1ce81},
+{0x101da,0x1cea1},
+{0x101db,0x1cec1},
+{0x101dc,0x1cee1},
+{0x101dd,0x1cf01},
+{0x101de,0x1cf21},
+{0x101df,0x1cf41},
+{0x101e0,0x1cf61},
+{0x101e1,0x1cf81},
+{0x101e2,0x1cfa1},
+{0x101e3,0x1cfc1},
+{0x101e4,0x1cfe1},
+{0x101e5,0x1d001},
+{0x101e6,0x1d021},
+{0x101e7,0x1d041},
+{0x101e8,0x1d061},
+{0x101e9,0x1d081},
+{0x101ea,0x1d0a1},
+{0x101eb,0x1d0c1},
+{0x101ec,0x1d0e1},
+{0x101ed,0x1d101},
+{0x101ee,0x1d121},
+{0x101ef,0x1d141},
+{0x101f0,0x1d161},
+{0x101f1,0x1d181},
+{0x101f2,0x1d1a1},
+{0x101f3,0x1d1c1},
+{0x101f4,0x1d1e1},
+{0x101f5,0x1d201},
+{0x101f6,0x1d221},
+{0x101f7,0x1d241},
+{0x101f8,0x1d261},
+{0x101f9,0x1d281},
+{0x101fa,0x1d2a1},
+{0x101fb,0x1d2c1},
+{0x101fc,0x1d2e1},
+{0x101fd,0x37641},
+{0x10280,0xc42c1},
+{0x10281,0xc42e1},
+{0x10282,0xc4301},
+{0x10283,0xc4321},
+{0x10284,0xc4341},
+{0x10285,0xc4361},
+{0x10286,0xc4381},
+{0x10287,0xc43a1},
+{0x10288,0xc43c1},
+{0x10289,0xc43e1},
+{0x1028a,0xc4401},
+{0x1028b,0xc4421},
+{0x1028c,0xc4441},
+{0x1028d,0xc4461},
+{0x1028e,0xc4481},
+{0x1028f,0xc44a1},
+{0x10290,0xc44c1},
+{0x10291,0xc44e1},
+{0x10292,0xc4501},
+{0x10293,0xc4521},
+{0x10294,0xc4541},
+{0x10295,0xc4561},
+{0x10296,0xc4581},
+{0x10297,0xc45a1},
+{0x10298,0xc45c1},
+{0x10299,0xc45e1},
+{0x1029a,0xc4601},
+{0x1029b,0xc4621},
+{0x1029c,0xc4641},
+{0x102a0,0xc4661},
+{0x102a1,0xc4681},
+{0x102a2,0xc46a1},
+{0x102a3,0xc46c1},
+{0x102a4,0xc46e1},
+{0x102a5,0xc4701},
+{0x102a6,0xc4721},
+{0x102a7,0xc4741},
+{0x102a8,0xc4761},
+{0x102a9,0xc4781},
+{0x102aa,0xc47a1},
+{0x102ab,0xc47c1},
+{0x102ac,0xc47e1},
+{0x102ad,0xc4801},
+{0x102ae,0xc4821},
+{0x102af,0xc4841},
+{0x102b0,0xc4861},
+{0x102b1,0xc4881},
+{0x102b2,0xc48a1},
+{0x102b3,0xc48c1},
+{0x102b4,0xc48e1},
+{0x102b5,0xc4901},
+{0x102b6,0xc4921},
+{0x102b7,0xc4941},
+{0x102b8,0xc4961},
+{0x102b9,0xc4981},
+{0x102ba,0xc49a1},
+{0x102bb,0xc49c1},
+{0x102bc,0xc49e1},
+{0x102bd,0xc4a01},
+{0x102be,0xc4a21},
+{0x102bf,0xc4a41},
+{0x102c0,0xc4a61},
+{0x102c1,0xc4a81},
+{0x102c2,0xc4aa1},
+{0x102c3,0xc4ac1},
+{0x102c4,0xc4ae1},
+{0x102c5,0xc4b01},
+{0x102c6,0xc4b21},
+{0x102c7,0xc4b41},
+{0x102c8,0xc4b61},
+{0x102c9,0xc4b81},
+{0x102ca,0xc4ba1},
+{0x102cb,0xc4bc1},
+{0x102cc,0xc4be1},
+{0x102cd,0xc4c01},
+{0x102ce,0xc4c21},
+{0x102cf,0xc4c41},
+{0x102d0,0xc4c61},
+{0x102e0,0x1},
+{0x102e1,0x382e1},
+{0x102e2,0x3a041},
+{0x102e3,0x3aec1},
+{0x102e4,0x3b641},
+{0x102e5,0x3bc01},
+{0x102e6,0x3bfe1},
+{0x102e7,0x3c301},
+{0x102e8,0x3c681},
+{0x102e9,0x3c9a1},
+{0x102ea,0x1d301},
+{0x102eb,0x1d321},
+{0x102ec,0x1d341},
+{0x102ed,0x1d361},
+{0x102ee,0x1d381},
+{0x102ef,0x1d3a1},
+{0x102f0,0x1d3c1},
+{0x102f1,0x1d3e1},
+{0x102f2,0x1d401},
+{0x102f3,0x1d421},
+{0x102f4,0x1d441},
+{0x102f5,0x1d461},
+{0x102f6,0x1d481},
+{0x102f7,0x1d4a1},
+{0x102f8,0x1d4c1},
+{0x102f9,0x1d4e1},
+{0x102fa,0x1d501},
+{0x102fb,0x1d521},
+{0x10300,0xc4fc1},
+{0x10301,0xc4fe1},
+{0x10302,0xc5001},
+{0x10303,0xc5021},
+{0x10304,0xc5041},
+{0x10305,0xc5061},
+{0x10306,0xc5081},
+{0x10307,0xc50a1},
+{0x10308,0xc50c1},
+{0x10309,0xc50e1},
+{0x1030a,0xc5101},
+{0x1030b,0xc5121},
+{0x1030c,0xc5141},
+{0x1030d,0xc5161},
+{0x1030e,0xc5181},
+{0x1030f,0xc51c1},
+{0x10310,0xc51e1},
+{0x10311,0xc5201},
+{0x10312,0xc5221},
+{0x10313,0xc5241},
+{0x10314,0xc5261},
+{0x10315,0xc5281},
+{0x10316,0xc52a1},
+{0x10317,0xc52c1},
+{0x10318,0xc52e1},
+{0x10319,0xc5301},
+{0x1031a,0xc5321},
+{0x1031b,0xc5341},
+{0x1031c,0xc5361},
+{0x1031d,0xc5381},
+{0x1031e,0xc53a1},
+{0x1031f,0xc51a1},
+{0x10320,0x382e1},
+{0x10321,0x3bc01},
+{0x10322,0x1d541},
+{0x10323,0x1d561},
+{0x10330,0xc53c1},
+{0x10331,0xc53e1},
+{0x10332,0xc5401},
+{0x10333,0xc5421},
+{0x10334,0xc5441},
+{0x10335,0xc5461},
+{0x10336,0xc5481},
+{0x10337,0xc54a1},
+{0x10338,0xc54c1},
+{0x10339,0xc54e1},
+{0x1033a,0xc5501},
+{0x1033b,0xc5521},
+{0x1033c,0xc5541},
+{0x1033d,0xc5561},
+{0x1033e,0xc5581},
+{0x1033f,0xc55a1},
+{0x10340,0xc55c1},
+{0x10341,0xc55e1},
+{0x10342,0xc5601},
+{0x10343,0xc5621},
+{0x10344,0xc5641},
+{0x10345,0xc5661},
+{0x10346,0xc5681},
+{0x10347,0xc56a1},
+{0x10348,0xc56c1},
+{0x10349,0xc56e1},
+{0x1034a,0xc5701},
+{0x10350,0x5df61},
+{0x10351,0x5dfa1},
+{0x10352,0x5dfc1},
+{0x10353,0x5dfe1},
+{0x10354,0x5e021},
+{0x10355,0x5e041},
+{0x10356,0x5e061},
+{0x10357,0x5e081},
+{0x10358,0x5e0c1},
+{0x10359,0x5e0e1},
+{0x1035a,0x5e101},
+{0x1035b,0x5e121},
+{0x1035c,0x5e141},
+{0x1035d,0x5e161},
+{0x1035e,0x5e1a1},
+{0x1035f,0x5e1c1},
+{0x10360,0x5e1e1},
+{0x10361,0x5e201},
+{0x10362,0x5e241},
+{0x10363,0x5e261},
+{0x10364,0x5e281},
+{0x10365,0x5e2a1},
+{0x10366,0x5e2c1},
+{0x10367,0x5e2e1},
+{0x10368,0x5e301},
+{0x10369,0x5e321},
+{0x1036a,0x5e341},
+{0x1036b,0x5e361},
+{0x1036c,0x5e381},
+{0x1036d,0x5e3a1},
+{0x1036e,0x5e3c1},
+{0x1036f,0x5e3e1},
+{0x10370,0x5e401},
+{0x10371,0x5e421},
+{0x10372,0x5e441},
+{0x10373,0x5e461},
+{0x10374,0x5e481},
+{0x10375,0x5e4a1},
+{0x10376,0x5df81},
+{0x10377,0x5e001},
+{0x10378,0x5e0a1},
+{0x10379,0x5e181},
+{0x1037a,0x5e221},
+{0x10380,0xd0101},
+{0x10381,0xd0121},
+{0x10382,0xd0141},
+{0x10383,0xd0161},
+{0x10384,0xd0181},
+{0x10385,0xd01a1},
+{0x10386,0xd01c1},
+{0x10387,0xd01e1},
+{0x10388,0xd0201},
+{0x10389,0xd0221},
+{0x1038a,0xd0241},
+{0x1038b,0xd0261},
+{0x1038c,0xd0281},
+{0x1038d,0xd02a1},
+{0x1038e,0xd02c1},
+{0x1038f,0xd02e1},
+{0x10390,0xd0301},
+{0x10391,0xd0321},
+{0x10392,0xd0341},
+{0x10393,0xd0361},
+{0x10394,0xd0381},
+{0x10395,0xd03a1},
+{0x10396,0xd03c1},
+{0x10397,0xd03e1},
+{0x10398,0xd0401},
+{0x10399,0xd0421},
+{0x1039a,0xd0441},
+{0x1039b,0xd0461},
+{0x1039c,0xd0481},
+{0x1039d,0xd04a1},
+{0x1039f,0x1d581},
+{0x103a0,0xd04c1},
+{0x103a1,0xd04e1},
+{0x103a2,0xd0501},
+{0x103a3,0xd0521},
+{0x103a4,0xd0541},
+{0x103a5,0xd0561},
+{0x103a6,0xd0581},
+{0x103a7,0xd05a1},
+{0x103a8,0xd05c1},
+{0x103a9,0xd05e1},
+{0x103aa,0xd0601},
+{0x103ab,0xd0621},
+{0x103ac,0xd0641},
+{0x103ad,0xd0661},
+{0x103ae,0xd0681},
+{0x103af,0xd06a1},
+{0x103b0,0xd06c1},
+{0x103b1,0xd06e1},
+{0x103b2,0xd0701},
+{0x103b3,0xd0721},
+{0x103b4,0xd0741},
+{0x103b5,0xd0761},
+{0x103b6,0xd0781},
+{0x103b7,0xd07a1},
+{0x103b8,0xd07c1},
+{0x103b9,0xd07e1},
+{0x103ba,0xd0801},
+{0x103bb,0xd0821},
+{0x103bc,0xd0841},
+{0x103bd,0xd0861},
+{0x103be,0xd0881},
+{0x103bf,0xd08a1},
+{0x103c0,0xd08c1},
+{0x103c1,0xd08e1},
+{0x103c2,0xd0901},
+{0x103c3,0xd0921},
+{0x103c8,0xd0941},
+{0x103c9,0xd0961},
+{0x103ca,0xd0981},
+{0x103cb,0xd09a1},
+{0x103cc,0xd09c1},
+{0x103cd,0xd09e1},
+{0x103ce,0xd0a01},
+{0x103cf,0xd0a21},
+{0x103d0,0x1d5a1},
+{0x103d1,0x382e1},
+{0x103d2,0x3a041},
+{0x103d3,0x1d5c1},
+{0x103d4,0x1d5e1},
+{0x103d5,0x1d601},
+{0x10400,0xc5741},
+{0x10401,0xc5781},
+{0x10402,0xc57c1},
+{0x10403,0xc5801},
+{0x10404,0xc5841},
+{0x10405,0xc5881},
+{0x10406,0xc58c1},
+{0x10407,0xc5901},
+{0x10408,0xc5941},
+{0x10409,0xc5981},
+{0x1040a,0xc59c1},
+{0x1040b,0xc5a01},
+{0x1040c,0xc5a41},
+{0x1040d,0xc5a81},
+{0x1040e,0xc5ac1},
+{0x1040f,0xc5b01},
+{0x10410,0xc5b41},
+{0x10411,0xc5b81},
+{0x10412,0xc5bc1},
+{0x10413,0xc5c01},
+{0x10414,0xc5c41},
+{0x10415,0xc5c81},
+{0x10416,0xc5cc1},
+{0x10417,0xc5d01},
+{0x10418,0xc5d41},
+{0x10419,0xc5d81},
+{0x1041a,0xc5dc1},
+{0x1041b,0xc5e01},
+{0x1041c,0xc5e41},
+{0x1041d,0xc5e81},
+{0x1041e,0xc5ec1},
+{0x1041f,0xc5f01},
+{0x10420,0xc5f41},
+{0x10421,0xc5f81},
+{0x10422,0xc5fc1},
+{0x10423,0xc6001},
+{0x10424,0xc6041},
+{0x10425,0xc6081},
+{0x10426,0xc60c1},
+{0x10427,0xc6101},
+{0x10428,0xc5721},
+{0x10429,0xc5761},
+{0x1042a,0xc57a1},
+{0x1042b,0xc57e1},
+{0x1042c,0xc5821},
+{0x1042d,0xc5861},
+{0x1042e,0xc58a1},
+{0x1042f,0xc58e1},
+{0x10430,0xc5921},
+{0x10431,0xc5961},
+{0x10432,0xc59a1},
+{0x10433,0xc59e1},
+{0x10434,0xc5a21},
+{0x10435,0xc5a61},
+{0x10436,0xc5aa1},
+{0x10437,0xc5ae1},
+{0x10438,0xc5b21},
+{0x10439,0xc5b61},
+{0x1043a,0xc5ba1},
+{0x1043b,0xc5be1},
+{0x1043c,0xc5c21},
+{0x1043d,0xc5c61},
+{0x1043e,0xc5ca1},
+{0x1043f,0xc5ce1},
+{0x10440,0xc5d21},
+{0x10441,0xc5d61},
+{0x10442,0xc5da1},
+{0x10443,0xc5de1},
+{0x10444,0xc5e21},
+{0x10445,0xc5e61},
+{0x10446,0xc5ea1},
+{0x10447,0xc5ee1},
+{0x10448,0xc5f21},
+{0x10449,0xc5f61},
+{0x1044a,0xc5fa1},
+{0x1044b,0xc5fe1},
+{0x1044c,0xc6021},
+{0x1044d,0xc6061},
+{0x1044e,0xc60a1},
+{0x1044f,0xc60e1},
+{0x10450,0xc6121},
+{0x10451,0xc6141},
+{0x10452,0xc6161},
+{0x10453,0xc6181},
+{0x10454,0xc61a1},
+{0x10455,0xc61c1},
+{0x10456,0xc61e1},
+{0x10457,0xc6201},
+{0x10458,0xc6221},
+{0x10459,0xc6241},
+{0x1045a,0xc6261},
+{0x1045b,0xc6281},
+{0x1045c,0xc62a1},
+{0x1045d,0xc62c1},
+{0x1045e,0xc62e1},
+{0x1045f,0xc6301},
+{0x10460,0xc6321},
+{0x10461,0xc6341},
+{0x10462,0xc6361},
+{0x10463,0xc6381},
+{0x10464,0xc63a1},
+{0x10465,0xc63c1},
+{0x10466,0xc63e1},
+{0x10467,0xc6401},
+{0x10468,0xc6421},
+{0x10469,0xc6441},
+{0x1046a,0xc6461},
+{0x1046b,0xc6481},
+{0x1046c,0xc64a1},
+{0x1046d,0xc64c1},
+{0x1046e,0xc64e1},
+{0x1046f,0xc6501},
+{0x10470,0xc6521},
+{0x10471,0xc6541},
+{0x10472,0xc6561},
+{0x10473,0xc6581},
+{0x10474,0xc65a1},
+{0x10475,0xc65c1},
+{0x10476,0xc65e1},
+{0x10477,0xc6601},
+{0x10478,0xc6621},
+{0x10479,0xc6641},
+{0x1047a,0xc6661},
+{0x1047b,0xc6681},
+{0x1047c,0xc66a1},
+{0x1047d,0xc66c1},
+{0x1047e,0xc66e1},
+{0x1047f,0xc6701},
+{0x10480,0xc7881},
+{0x10481,0xc78a1},
+{0x10482,0xc78c1},
+{0x10483,0xc78e1},
+{0x10484,0xc7901},
+{0x10485,0xc7921},
+{0x10486,0xc7941},
+{0x10487,0xc7961},
+{0x10488,0xc7981},
+{0x10489,0xc79a1},
+{0x1048a,0xc79c1},
+{0x1048b,0xc79e1},
+{0x1048c,0xc7a01},
+{0x1048d,0xc7a21},
+{0x1048e,0xc7a41},
+{0x1048f,0xc7a61},
+{0x10490,0xc7a81},
+{0x10491,0xc7aa1},
+{0x10492,0xc7ac1},
+{0x10493,0xc7ae1},
+{0x10494,0xc7b01},
+{0x10495,0xc7b21},
+{0x10496,0xc7b41},
+{0x10497,0xc7b61},
+{0x10498,0xc7b81},
+{0x10499,0xc7ba1},
+{0x1049a,0xc7bc1},
+{0x1049b,0xc7be1},
+{0x1049c,0xc7c01},
+{0x1049d,0xc7c21},
+{0x104a0,0x380c1},
+{0x104a1,0x382e1},
+{0x104a2,0x3a041},
+{0x104a3,0x3aec1},
+{0x104a4,0x3b641},
+{0x104a5,0x3bc01},
+{0x104a6,0x3bfe1},
+{0x104a7,0x3c301},
+{0x104a8,0x3c681},
+{0x104a9,0x3c9a1},
+{0x10500,0xc7c41},
+{0x10501,0xc7c61},
+{0x10502,0xc7c81},
+{0x10503,0xc7ca1},
+{0x10504,0xc7cc1},
+{0x10505,0xc7ce1},
+{0x10506,0xc7d01},
+{0x10507,0xc7d21},
+{0x10508,0xc7d41},
+{0x10509,0xc7d61},
+{0x1050a,0xc7d81},
+{0x1050b,0xc7da1},
+{0x1050c,0xc7dc1},
+{0x1050d,0xc7de1},
+{0x1050e,0xc7e01},
+{0x1050f,0xc7e21},
+{0x10510,0xc7e41},
+{0x10511,0xc7e61},
+{0x10512,0xc7e81},
+{0x10513,0xc7ea1},
+{0x10514,0xc7ec1},
+{0x10515,0xc7ee1},
+{0x10516,0xc7f01},
+{0x10517,0xc7f21},
+{0x10518,0xc7f41},
+{0x10519,0xc7f61},
+{0x1051a,0xc7f81},
+{0x1051b,0xc7fa1},
+{0x1051c,0xc7fc1},
+{0x1051d,0xc7fe1},
+{0x1051e,0xc8001},
+{0x1051f,0xc8021},
+{0x10520,0xc8041},
+{0x10521,0xc8061},
+{0x10522,0xc8081},
+{0x10523,0xc80a1},
+{0x10524,0xc80c1},
+{0x10525,0xc80e1},
+{0x10526,0xc8101},
+{0x10527,0xc8121},
+{0x10530,0xc8141},
+{0x10531,0xc8161},
+{0x10532,0xc8181},
+{0x10533,0xc81a1},
+{0x10534,0xc81c1},
+{0x10535,0xc81e1},
+{0x10536,0xc8201},
+{0x10537,0xc8221},
+{0x10538,0xc8241},
+{0x10539,0xc8261},
+{0x1053a,0xc8281},
+{0x1053b,0xc82a1},
+{0x1053c,0xc82c1},
+{0x1053d,0xc82e1},
+{0x1053e,0xc8301},
+{0x1053f,0xc8321},
+{0x10540,0xc8341},
+{0x10541,0xc8361},
+{0x10542,0xc8381},
+{0x10543,0xc83a1},
+{0x10544,0xc83c1},
+{0x10545,0xc83e1},
+{0x10546,0xc8401},
+{0x10547,0xc8421},
+{0x10548,0xc8441},
+{0x10549,0xc8461},
+{0x1054a,0xc8481},
+{0x1054b,0xc84a1},
+{0x1054c,0xc84c1},
+{0x1054d,0xc84e1},
+{0x1054e,0xc8501},
+{0x1054f,0xc8521},
+{0x10550,0xc8541},
+{0x10551,0xc8561},
+{0x10552,0xc8581},
+{0x10553,0xc85a1},
+{0x10554,0xc85c1},
+{0x10555,0xc85e1},
+{0x10556,0xc8601},
+{0x10557,0xc8621},
+{0x10558,0xc8641},
+{0x10559,0xc8661},
+{0x1055a,0xc8681},
+{0x1055b,0xc86a1},
+{0x1055c,0xc86c1},
+{0x1055d,0xc86e1},
+{0x1055e,0xc8701},
+{0x1055f,0xc8721},
+{0x10560,0xc8741},
+{0x10561,0xc8761},
+{0x10562,0xc8781},
+{0x10563,0xc87a1},
+{0x1056f,0x1d621},
+{0x10600,0xca921},
+{0x10601,0xca941},
+{0x10602,0xca961},
+{0x10603,0xca981},
+{0x10604,0xca9a1},
+{0x10605,0xca9c1},
+{0x10606,0xca9e1},
+{0x10607,0xcaa01},
+{0x10608,0xcaa21},
+{0x10609,0xcaa41},
+{0x1060a,0xcaa61},
+{0x1060b,0xcaa81},
+{0x1060c,0xcaaa1},
+{0x1060d,0xcaac1},
+{0x1060e,0xcaae1},
+{0x1060f,0xcab01},
+{0x10610,0xcab21},
+{0x10611,0xcab41},
+{0x10612,0xcab61},
+{0x10613,0xcab81},
+{0x10614,0xcaba1},
+{0x10615,0xcabc1},
+{0x10616,0xcabe1},
+{0x10617,0xcac01},
+{0x10618,0xcac21},
+{0x10619,0xcac41},
+{0x1061a,0xcac61},
+{0x1061b,0xcac81},
+{0x1061c,0xcaca1},
+{0x1061d,0xcacc1},
+{0x1061e,0xcace1},
+{0x1061f,0xcad01},
+{0x10620,0xcad21},
+{0x10621,0xcad41},
+{0x10622,0xcad61},
+{0x10623,0xcad81},
+{0x10624,0xcada1},
+{0x10625,0xcadc1},
+{0x10626,0xcade1},
+{0x10627,0xcae01},
+{0x10628,0xcae21},
+{0x10629,0xcae41},
+{0x1062a,0xcae61},
+{0x1062b,0xcae81},
+{0x1062c,0xcaea1},
+{0x1062d,0xcaec1},
+{0x1062e,0xcaee1},
+{0x1062f,0xcaf01},
+{0x10630,0xcaf21},
+{0x10631,0xcaf41},
+{0x10632,0xcaf61},
+{0x10633,0xcaf81},
+{0x10634,0xcafa1},
+{0x10635,0xcafc1},
+{0x10636,0xcafe1},
+{0x10637,0xcb001},
+{0x10638,0xcb021},
+{0x10639,0xcb041},
+{0x1063a,0xcb061},
+{0x1063b,0xcb081},
+{0x1063c,0xcb0a1},
+{0x1063d,0xcb0c1},
+{0x1063e,0xcb0e1},
+{0x1063f,0xcb101},
+{0x10640,0xcb121},
+{0x10641,0xcb141},
+{0x10642,0xcb161},
+{0x10643,0xcb181},
+{0x10644,0xcb1a1},
+{0x10645,0xcb1c1},
+{0x10646,0xcb1e1},
+{0x10647,0xcb201},
+{0x10648,0xcb221},
+{0x10649,0xcb241},
+{0x1064a,0xcb261},
+{0x1064b,0xcb281},
+{0x1064c,0xcb2a1},
+{0x1064d,0xcb2c1},
+{0x1064e,0xcb2e1},
+{0x1064f,0xcb301},
+{0x10650,0xcb321},
+{0x10651,0xcb341},
+{0x10652,0xcb361},
+{0x10653,0xcb381},
+{0x10654,0xcb3a1},
+{0x10655,0xcb3c1},
+{0x10656,0xcb3e1},
+{0x10657,0xcb401},
+{0x10658,0xcb421},
+{0x10659,0xcb441},
+{0x1065a,0xcb461},
+{0x1065b,0xcb481},
+{0x1065c,0xcb4a1},
+{0x1065d,0xcb4c1},
+{0x1065e,0xcb4e1},
+{0x1065f,0xcb501},
+{0x10660,0xcb521},
+{0x10661,0xcb541},
+{0x10662,0xcb561},
+{0x10663,0xcb581},
+{0x10664,0xcb5a1},
+{0x10665,0xcb5c1},
+{0x10666,0xcb5e1},
+{0x10667,0xcb601},
+{0x10668,0xcb621},
+{0x10669,0xcb641},
+{0x1066a,0xcb661},
+{0x1066b,0xcb681},
+{0x1066c,0xcb6a1},
+{0x1066d,0xcb6c1},
+{0x1066e,0xcb6e1},
+{0x1066f,0xcb701},
+{0x10670,0xcb721},
+{0x10671,0xcb741},
+{0x10672,0xcb761},
+{0x10673,0xcb781},
+{0x10674,0xcb7a1},
+{0x10675,0xcb7c1},
+{0x10676,0xcb7e1},
+{0x10677,0xcb801},
+{0x10678,0xcb821},
+{0x10679,0xcb841},
+{0x1067a,0xcb861},
+{0x1067b,0xcb881},
+{0x1067c,0xcb8a1},
+{0x1067d,0xcb8c1},
+{0x1067e,0xcb8e1},
+{0x1067f,0xcb901},
+{0x10680,0xcb921},
+{0x10681,0xcb941},
+{0x10682,0xcb961},
+{0x10683,0xcb981},
+{0x10684,0xcb9a1},
+{0x10685,0xcb9c1},
+{0x10686,0xcb9e1},
+{0x10687,0xcba01},
+{0x10688,0xcba21},
+{0x10689,0xcba41},
+{0x1068a,0xcba61},
+{0x1068b,0xcba81},
+{0x1068c,0xcbaa1},
+{0x1068d,0xcbac1},
+{0x1068e,0xcbae1},
+{0x1068f,0xcbb01},
+{0x10690,0xcbb21},
+{0x10691,0xcbb41},
+{0x10692,0xcbb61},
+{0x10693,0xcbb81},
+{0x10694,0xcbba1},
+{0x10695,0xcbbc1},
+{0x10696,0xcbbe1},
+{0x10697,0xcbc01},
+{0x10698,0xcbc21},
+{0x10699,0xcbc41},
+{0x1069a,0xcbc61},
+{0x1069b,0xcbc81},
+{0x1069c,0xcbca1},
+{0x1069d,0xcbcc1},
+{0x1069e,0xcbce1},
+{0x1069f,0xcbd01},
+{0x106a0,0xcbd21},
+{0x106a1,0xcbd41},
+{0x106a2,0xcbd61},
+{0x106a3,0xcbd81},
+{0x106a4,0xcbda1},
+{0x106a5,0xcbdc1},
+{0x106a6,0xcbde1},
+{0x106a7,0xcbe01},
+{0x106a8,0xcbe21},
+{0x106a9,0xcbe41},
+{0x106aa,0xcbe61},
+{0x106ab,0xcbe81},
+{0x106ac,0xcbea1},
+{0x106ad,0xcbec1},
+{0x106ae,0xcbee1},
+{0x106af,0xcbf01},
+{0x106b0,0xcbf21},
+{0x106b1,0xcbf41},
+{0x106b2,0xcbf61},
+{0x106b3,0xcbf81},
+{0x106b4,0xcbfa1},
+{0x106b5,0xcbfc1},
+{0x106b6,0xcbfe1},
+{0x106b7,0xcc001},
+{0x106b8,0xcc021},
+{0x106b9,0xcc041},
+{0x106ba,0xcc061},
+{0x106bb,0xcc081},
+{0x106bc,0xcc0a1},
+{0x106bd,0xcc0c1},
+{0x106be,0xcc0e1},
+{0x106bf,0xcc101},
+{0x106c0,0xcc121},
+{0x106c1,0xcc141},
+{0x106c2,0xcc161},
+{0x106c3,0xcc181},
+{0x106c4,0xcc1a1},
+{0x106c5,0xcc1c1},
+{0x106c6,0xcc1e1},
+{0x106c7,0xcc201},
+{0x106c8,0xcc221},
+{0x106c9,0xcc241},
+{0x106ca,0xcc261},
+{0x106cb,0xcc281},
+{0x106cc,0xcc2a1},
+{0x106cd,0xcc2c1},
+{0x106ce,0xcc2e1},
+{0x106cf,0xcc301},
+{0x106d0,0xcc321},
+{0x106d1,0xcc341},
+{0x106d2,0xcc361},
+{0x106d3,0xcc381},
+{0x106d4,0xcc3a1},
+{0x106d5,0xcc3c1},
+{0x106d6,0xcc3e1},
+{0x106d7,0xcc401},
+{0x106d8,0xcc421},
+{0x106d9,0xcc441},
+{0x106da,0xcc461},
+{0x106db,0xcc481},
+{0x106dc,0xcc4a1},
+{0x106dd,0xcc4c1},
+{0x106de,0xcc4e1},
+{0x106df,0xcc501},
+{0x106e0,0xcc521},
+{0x106e1,0xcc541},
+{0x106e2,0xcc561},
+{0x106e3,0xcc581},
+{0x106e4,0xcc5a1},
+{0x106e5,0xcc5c1},
+{0x106e6,0xcc5e1},
+{0x106e7,0xcc601},
+{0x106e8,0xcc621},
+{0x106e9,0xcc641},
+{0x106ea,0xcc661},
+{0x106eb,0xcc681},
+{0x106ec,0xcc6a1},
+{0x106ed,0xcc6c1},
+{0x106ee,0xcc6e1},
+{0x106ef,0xcc701},
+{0x106f0,0xcc721},
+{0x106f1,0xcc741},
+{0x106f2,0xcc761},
+{0x106f3,0xcc781},
+{0x106f4,0xcc7a1},
+{0x106f5,0xcc7c1},
+{0x106f6,0xcc7e1},
+{0x106f7,0xcc801},
+{0x106f8,0xcc821},
+{0x106f9,0xcc841},
+{0x106fa,0xcc861},
+{0x106fb,0xcc881},
+{0x106fc,0xcc8a1},
+{0x106fd,0xcc8c1},
+{0x106fe,0xcc8e1},
+{0x106ff,0xcc901},
+{0x10700,0xcc921},
+{0x10701,0xcc941},
+{0x10702,0xcc961},
+{0x10703,0xcc981},
+{0x10704,0xcc9a1},
+{0x10705,0xcc9c1},
+{0x10706,0xcc9e1},
+{0x10707,0xcca01},
+{0x10708,0xcca21},
+{0x10709,0xcca41},
+{0x1070a,0xcca61},
+{0x1070b,0xcca81},
+{0x1070c,0xccaa1},
+{0x1070d,0xccac1},
+{0x1070e,0xccae1},
+{0x1070f,0xccb01},
+{0x10710,0xccb21},
+{0x10711,0xccb41},
+{0x10712,0xccb61},
+{0x10713,0xccb81},
+{0x10714,0xccba1},
+{0x10715,0xccbc1},
+{0x10716,0xccbe1},
+{0x10717,0xccc01},
+{0x10718,0xccc21},
+{0x10719,0xccc41},
+{0x1071a,0xccc61},
+{0x1071b,0xccc81},
+{0x1071c,0xccca1},
+{0x1071d,0xcccc1},
+{0x1071e,0xccce1},
+{0x1071f,0xccd01},
+{0x10720,0xccd21},
+{0x10721,0xccd41},
+{0x10722,0xccd61},
+{0x10723,0xccd81},
+{0x10724,0xccda1},
+{0x10725,0xccdc1},
+{0x10726,0xccde1},
+{0x10727,0xcce01},
+{0x10728,0xcce21},
+{0x10729,0xcce41},
+{0x1072a,0xcce61},
+{0x1072b,0xcce81},
+{0x1072c,0xccea1},
+{0x1072d,0xccec1},
+{0x1072e,0xccee1},
+{0x1072f,0xccf01},
+{0x10730,0xccf21},
+{0x10731,0xccf41},
+{0x10732,0xccf61},
+{0x10733,0xccf81},
+{0x10734,0xccfa1},
+{0x10735,0xccfc1},
+{0x10736,0xccfe1},
+{0x10740,0xcd001},
+{0x10741,0xcd021},
+{0x10742,0xcd041},
+{0x10743,0xcd061},
+{0x10744,0xcd081},
+{0x10745,0xcd0a1},
+{0x10746,0xcd0c1},
+{0x10747,0xcd0e1},
+{0x10748,0xcd101},
+{0x10749,0xcd121},
+{0x1074a,0xcd141},
+{0x1074b,0xcd161},
+{0x1074c,0xcd181},
+{0x1074d,0xcd1a1},
+{0x1074e,0xcd1c1},
+{0x1074f,0xcd1e1},
+{0x10750,0xcd201},
+{0x10751,0xcd221},
+{0x10752,0xcd241},
+{0x10753,0xcd261},
+{0x10754,0xcd281},
+{0x10755,0xcd2a1},
+{0x10760,0xcd2c1},
+{0x10761,0xcd2e1},
+{0x10762,0xcd301},
+{0x10763,0xcd321},
+{0x10764,0xcd341},
+{0x10765,0xcd361},
+{0x10766,0xcd381},
+{0x10767,0xcd3a1},
+{0x10800,0xcd3c1},
+{0x10801,0xcd3e1},
+{0x10802,0xcd401},
+{0x10803,0xcd421},
+{0x10804,0xcd441},
+{0x10805,0xcd461},
+{0x10808,0xcd481},
+{0x1080a,0xcd4a1},
+{0x1080b,0xcd4c1},
+{0x1080c,0xcd4e1},
+{0x1080d,0xcd501},
+{0x1080e,0xcd521},
+{0x1080f,0xcd541},
+{0x10810,0xcd561},
+{0x10811,0xcd581},
+{0x10812,0xcd5a1},
+{0x10813,0xcd5c1},
+{0x10814,0xcd5e1},
+{0x10815,0xcd601},
+{0x10816,0xcd621},
+{0x10817,0xcd641},
+{0x10818,0xcd661},
+{0x10819,0xcd681},
+{0x1081a,0xcd6a1},
+{0x1081b,0xcd6c1},
+{0x1081c,0xcd6e1},
+{0x1081d,0xcd701},
+{0x1081e,0xcd721},
+{0x1081f,0xcd741},
+{0x10820,0xcd761},
+{0x10821,0xcd781},
+{0x10822,0xcd7a1},
+{0x10823,0xcd7c1},
+{0x10824,0xcd7e1},
+{0x10825,0xcd801},
+{0x10826,0xcd821},
+{0x10827,0xcd841},
+{0x10828,0xcd861},
+{0x10829,0xcd881},
+{0x1082a,0xcd8a1},
+{0x1082b,0xcd8c1},
+{0x1082c,0xcd8e1},
+{0x1082d,0xcd901},
+{0x1082e,0xcd921},
+{0x1082f,0xcd941},
+{0x10830,0xcd961},
+{0x10831,0xcd981},
+{0x10832,0xcd9a1},
+{0x10833,0xcd9c1},
+{0x10834,0xcd9e1},
+{0x10835,0xcda01},
+{0x10837,0xcda21},
+{0x10838,0xcda41},
+{0x1083c,0xcda61},
+{0x1083f,0xcda81},
+{0x10840,0xcf221},
+{0x10841,0xcf241},
+{0x10842,0xcf261},
+{0x10843,0xcf281},
+{0x10844,0xcf2a1},
+{0x10845,0xcf2c1},
+{0x10846,0xcf2e1},
+{0x10847,0xcf301},
+{0x10848,0xcf321},
+{0x10849,0xcf341},
+{0x1084a,0xcf361},
+{0x1084b,0xcf381},
+{0x1084c,0xcf3a1},
+{0x1084d,0xcf3c1},
+{0x1084e,0xcf3e1},
+{0x1084f,0xcf401},
+{0x10850,0xcf421},
+{0x10851,0xcf441},
+{0x10852,0xcf461},
+{0x10853,0xcf481},
+{0x10854,0xcf4a1},
+{0x10855,0xcf4c1},
+{0x10857,0x1d641},
+{0x10858,0x382e1},
+{0x10859,0x3a041},
+{0x1085a,0x3aec1},
+{0x1085b,0x1d661},
+{0x1085c,0x1d681},
+{0x1085d,0x1d6a1},
+{0x1085e,0x1d6c1},
+{0x1085f,0x1d6e1},
+{0x10860,0xce8c1},
+{0x10861,0xce8e1},
+{0x10862,0xce901},
+{0x10863,0xce921},
+{0x10864,0xce941},
+{0x10865,0xce961},
+{0x10866,0xce981},
+{0x10867,0xce9a1},
+{0x10868,0xce9c1},
+{0x10869,0xce9e1},
+{0x1086a,0xcea01},
+{0x1086b,0xcea21},
+{0x1086c,0xcea41},
+{0x1086d,0xcea81},
+{0x1086e,0xcea61},
+{0x1086f,0xceaa1},
+{0x10870,0xceac1},
+{0x10871,0xceae1},
+{0x10872,0xceb01},
+{0x10873,0xceb21},
+{0x10874,0xceb41},
+{0x10875,0xceb61},
+{0x10876,0xceb81},
+{0x10877,0x1d701},
+{0x10878,0x1d721},
+{0x10879,0x382e1},
+{0x1087a,0x3a041},
+{0x1087b,0x3aec1},
+{0x1087c,0x3b641},
+{0x1087d,0x3bc01},
+{0x1087e,0x1d741},
+{0x1087f,0x1d761},
+{0x10880,0xcebc1},
+{0x10881,0xceba1},
+{0x10882,0xcec01},
+{0x10883,0xcebe1},
+{0x10884,0xcec21},
+{0x10885,0xcec41},
+{0x10886,0xcec81},
+{0x10887,0xcec61},
+{0x10888,0xceca1},
+{0x10889,0xcecc1},
+{0x1088a,0xcece1},
+{0x1088b,0xced01},
+{0x1088c,0xced41},
+{0x1088d,0xced21},
+{0x1088e,0xced81},
+{0x1088f,0xced61},
+{0x10890,0xcedc1},
+{0x10891,0xceda1},
+{0x10892,0xcee01},
+{0x10893,0xcede1},
+{0x10894,0xcee41},
+{0x10895,0xcee21},
+{0x10896,0xcee61},
+{0x10897,0xcee81},
+{0x10898,0xceea1},
+{0x10899,0xceec1},
+{0x1089a,0xceee1},
+{0x1089b,0xcef01},
+{0x1089c,0xcef41},
+{0x1089d,0xcef21},
+{0x1089e,0xcef61},
+{0x108a7,0x382e1},
+{0x108a8,0x3a041},
+{0x108a9,0x3aec1},
+{0x108aa,0x3b641},
+{0x108ab,0x3b641},
+{0x108ac,0x3bc01},
+{0x108ad,0x1d781},
+{0x108ae,0x1d7a1},
+{0x108af,0x1d7c1},
+{0x108e0,0xcef81},
+{0x108e1,0xcefa1},
+{0x108e2,0xcefc1},
+{0x108e3,0xcefe1},
+{0x108e4,0xcf001},
+{0x108e5,0xcf021},
+{0x108e6,0xcf041},
+{0x108e7,0xcf061},
+{0x108e8,0xcf081},
+{0x108e9,0xcf0a1},
+{0x108ea,0xcf0c1},
+{0x108eb,0xcf0e1},
+{0x108ec,0xcf101},
+{0x108ed,0xcf121},
+{0x108ee,0xcf141},
+{0x108ef,0xcf161},
+{0x108f0,0xcf181},
+{0x108f1,0xcf1a1},
+{0x108f2,0xcf1c1},
+{0x108f4,0xcf1e1},
+{0x108f5,0xcf201},
+{0x108fb,0x382e1},
+{0x108fc,0x3bc01},
+{0x108fd,0x1d7e1},
+{0x108fe,0x1d801},
+{0x108ff,0x1d821},
+{0x10900,0x60ea1},
+{0x10901,0x60ec1},
+{0x10902,0x60ee1},
+{0x10903,0x60f01},
+{0x10904,0x60f21},
+{0x10905,0x60f41},
+{0x10906,0x60f61},
+{0x10907,0x60f81},
+{0x10908,0x60fa1},
+{0x10909,0x60fc1},
+{0x1090a,0x60fe1},
+{0x1090b,0x61001},
+{0x1090c,0x61021},
+{0x1090d,0x61041},
+{0x1090e,0x61061},
+{0x1090f,0x61081},
+{0x10910,0x610a1},
+{0x10911,0x610c1},
+{0x10912,0x610e1},
+{0x10913,0x61101},
+{0x10914,0x61121},
+{0x10915,0x61141},
+{0x10916,0x382e1},
+{0x10917,0x1d841},
+{0x10918,0x1d861},
+{0x10919,0x1d881},
+{0x1091a,0x3a041},
+{0x1091b,0x3aec1},
+{0x1091f,0x1d8a1},
+{0x10920,0xc4c81},
+{0x10921,0xc4ca1},
+{0x10922,0xc4cc1},
+{0x10923,0xc4ce1},
+{0x10924,0xc4d01},
+{0x10925,0xc4d21},
+{0x10926,0xc4d41},
+{0x10927,0xc4d61},
+{0x10928,0xc4d81},
+{0x10929,0xc4da1},
+{0x1092a,0xc4dc1},
+{0x1092b,0xc4de1},
+{0x1092c,0xc4e01},
+{0x1092d,0xc4e21},
+{0x1092e,0xc4e41},
+{0x1092f,0xc4e61},
+{0x10930,0xc4e81},
+{0x10931,0xc4ea1},
+{0x10932,0xc4ec1},
+{0x10933,0xc4ee1},
+{0x10934,0xc4f01},
+{0x10935,0xc4f21},
+{0x10936,0xc4f41},
+{0x10937,0xc4f61},
+{0x10938,0xc4f81},
+{0x10939,0xc4fa1},
+{0x1093f,0x1d8c1},
+{0x10980,0xe1c02},
+{0x10981,0xe1c62},
+{0x10982,0xe1cc2},
+{0x10983,0xe1d22},
+{0x10984,0xe1d82},
+{0x10985,0xe1de2},
+{0x10986,0xe1e42},
+{0x10987,0xe1e82},
+{0x10988,0xe1ee2},
+{0x10989,0xe1f42},
+{0x1098a,0xe1fa2},
+{0x1098b,0xe1fe2},
+{0x1098c,0xe2042},
+{0x1098d,0xe2082},
+{0x1098e,0xe20e2},
+{0x1098f,0xe2122},
+{0x10990,0xe2182},
+{0x10991,0xe21e2},
+{0x10992,0xe2242},
+{0x10993,0xe22e2},
+{0x10994,0xe2322},
+{0x10995,0xe2382},
+{0x10996,0xe23e2},
+{0x10997,0xe2442},
+{0x10998,0xe24a2},
+{0x10999,0xe24e2},
+{0x1099a,0xe2542},
+{0x1099b,0xe2582},
+{0x1099c,0xe25e2},
+{0x1099d,0xe2642},
+{0x1099e,0xe26c1},
+{0x1099f,0xe26e1},
+{0x109a0,0xe1be1},
+{0x109a1,0xe1c41},
+{0x109a2,0xe1ca1},
+{0x109a3,0xe1d01},
+{0x109a4,0xe1d61},
+{0x109a5,0xe1dc1},
+{0x109a6,0xe1e21},
+{0x109a7,0xe1ec1},
+{0x109a8,0xe1f21},
+{0x109a9,0xe1f81},
+{0x109aa,0xe2021},
+{0x109ab,0xe20c1},
+{0x109ac,0xe2161},
+{0x109ad,0xe21c1},
+{0x109ae,0xe2221},
+{0x109af,0xe2281},
+{0x109b0,0xe22a2},
+{0x109b1,0xe2361},
+{0x109b2,0xe23c1},
+{0x109b3,0xe2421},
+{0x109b4,0xe2481},
+{0x109b5,0xe2521},
+{0x109b6,0xe25c1},
+{0x109b7,0xe2621},
+{0x109bc,0x1d8e1},
+{0x109bd,0x1d901},
+{0x109be,0xe2681},
+{0x109bf,0xe26a1},
+{0x109c0,0x382e1},
+{0x109c1,0x3a041},
+{0x109c2,0x3aec1},
+{0x109c3,0x3b641},
+{0x109c4,0x3bc01},
+{0x109c5,0x3bfe1},
+{0x109c6,0x3c301},
+{0x109c7,0x3c681},
+{0x109c8,0x3c9a1},
+{0x109c9,0x1d921},
+{0x109ca,0x1d941},
+{0x109cb,0x1d961},
+{0x109cc,0x1d981},
+{0x109cd,0x1d9a1},
+{0x109ce,0x1d9c1},
+{0x109cf,0x1d9e1},
+{0x109d2,0x1da01},
+{0x109d3,0x1da21},
+{0x109d4,0x1da41},
+{0x109d5,0x1da61},
+{0x109d6,0x1da81},
+{0x109d7,0x1daa1},
+{0x109d8,0x1dac1},
+{0x109d9,0x1dae1},
+{0x109da,0x1db01},
+{0x109db,0x1db21},
+{0x109dc,0x1db41},
+{0x109dd,0x1db61},
+{0x109de,0x1db81},
+{0x109df,0x1dba1},
+{0x109e0,0x1dbc1},
+{0x109e1,0x1dbe1},
+{0x109e2,0x1dc01},
+{0x109e3,0x1dc21},
+{0x109e4,0x1dc41},
+{0x109e5,0x1dc61},
+{0x109e6,0x1dc81},
+{0x109e7,0x1dca1},
+{0x109e8,0x1dcc1},
+{0x109e9,0x1dce1},
+{0x109ea,0x1dd01},
+{0x109eb,0x1dd21},
+{0x109ec,0x1dd41},
+{0x109ed,0x1dd61},
+{0x109ee,0x1dd81},
+{0x109ef,0x1dda1},
+{0x109f0,0x1ddc1},
+{0x109f1,0x1dde1},
+{0x109f2,0x1de01},
+{0x109f3,0x1de21},
+{0x109f4,0x1de41},
+{0x109f5,0x1de61},
+{0x109f6,0x1de81},
+{0x109f7,0x1dea1},
+{0x109f8,0x1dec1},
+{0x109f9,0x1dee1},
+{0x109fa,0x1df01},
+{0x109fb,0x1df21},
+{0x109fc,0x1df41},
+{0x109fd,0x1df61},
+{0x109fe,0x1df81},
+{0x109ff,0x1dfa1},
+{0x10a00,0x80721},
+{0x10a01,0x80741},
+{0x10a02,0x80761},
+{0x10a03,0x80781},
+{0x10a05,0x807a1},
+{0x10a06,0x807c1},
+{0x10a0c,0x807e1},
+{0x10a0d,0x35721},
+{0x10a0e,0x36cc1},
+{0x10a0f,0x36ce1},
+{0x10a10,0x80801},
+{0x10a11,0x80841},
+{0x10a12,0x80861},
+{0x10a13,0x80881},
+{0x10a15,0x808a1},
+{0x10a16,0x808c1},
+{0x10a17,0x808e1},
+{0x10a19,0x80901},
+{0x10a1a,0x80921},
+{0x10a1b,0x80941},
+{0x10a1c,0x80981},
+{0x10a1d,0x809a1},
+{0x10a1e,0x809c1},
+{0x10a1f,0x809e1},
+{0x10a20,0x80a01},
+{0x10a21,0x80a21},
+{0x10a22,0x80a41},
+{0x10a23,0x80a61},
+{0x10a24,0x80a81},
+{0x10a25,0x80aa1},
+{0x10a26,0x80ac1},
+{0x10a27,0x80ae1},
+{0x10a28,0x80b01},
+{0x10a29,0x80b21},
+{0x10a2a,0x80b41},
+{0x10a2b,0x80b61},
+{0x10a2c,0x80b81},
+{0x10a2d,0x80ba1},
+{0x10a2e,0x80bc1},
+{0x10a2f,0x80be1},
+{0x10a30,0x80c01},
+{0x10a31,0x80c21},
+{0x10a32,0x80821},
+{0x10a33,0x80961},
+{0x10a38,0x36de1},
+{0x10a39,0x36e01},
+{0x10a3a,0x36e21},
+{0x10a3f,0x80c41},
+{0x10a40,0x382e1},
+{0x10a41,0x3a041},
+{0x10a42,0x3aec1},
+{0x10a43,0x3b641},
+{0x10a44,0x1dfc1},
+{0x10a45,0x1dfe1},
+{0x10a46,0x1e001},
+{0x10a47,0x1e021},
+{0x10a50,0x1e041},
+{0x10a51,0x1e061},
+{0x10a52,0x1e081},
+{0x10a53,0x1e0a1},
+{0x10a54,0x1e0c1},
+{0x10a55,0x1e0e1},
+{0x10a56,0x1e101},
+{0x10a57,0x1e121},
+{0x10a58,0x1e141},
+{0x10a60,0xcdaa1},
+{0x10a61,0xcdac1},
+{0x10a62,0xcdae1},
+{0x10a63,0xcdb01},
+{0x10a64,0xcdb21},
+{0x10a65,0xcdb41},
+{0x10a66,0xcdb61},
+{0x10a67,0xcdb81},
+{0x10a68,0xcdba1},
+{0x10a69,0xcdbc1},
+{0x10a6a,0xcdbe1},
+{0x10a6b,0xcdc01},
+{0x10a6c,0xcdc21},
+{0x10a6d,0xcdc41},
+{0x10a6e,0xcdc61},
+{0x10a6f,0xcdc81},
+{0x10a70,0xcdca1},
+{0x10a71,0xcdcc1},
+{0x10a72,0xcdce1},
+{0x10a73,0xcdd01},
+{0x10a74,0xcdd21},
+{0x10a75,0xcdd41},
+{0x10a76,0xcdd61},
+{0x10a77,0xcdd81},
+{0x10a78,0xcdda1},
+{0x10a79,0xcddc1},
+{0x10a7a,0xcdde1},
+{0x10a7b,0xcde01},
+{0x10a7c,0xcde21},
+{0x10a7d,0x382e1},
+{0x10a7e,0x1e161},
+{0x10a7f,0x1e181},
+{0x10a80,0xcde41},
+{0x10a81,0xcde61},
+{0x10a82,0xcde81},
+{0x10a83,0xcdea1},
+{0x10a84,0xcdec1},
+{0x10a85,0xcdee1},
+{0x10a86,0xcdf01},
+{0x10a87,0xcdf21},
+{0x10a88,0xcdf41},
+{0x10a89,0xcdf61},
+{0x10a8a,0xcdf81},
+{0x10a8b,0xcdfa1},
+{0x10a8c,0xcdfc1},
+{0x10a8d,0xcdfe1},
+{0x10a8e,0xce001},
+{0x10a8f,0xce021},
+{0x10a90,0xce041},
+{0x10a91,0xce061},
+{0x10a92,0xce081},
+{0x10a93,0xce0a1},
+{0x10a94,0xce0c1},
+{0x10a95,0xce0e1},
+{0x10a96,0xce101},
+{0x10a97,0xce121},
+{0x10a98,0xce141},
+{0x10a99,0xce161},
+{0x10a9a,0xce181},
+{0x10a9b,0xce1a1},
+{0x10a9c,0xce1c1},
+{0x10a9d,0x382e1},
+{0x10a9e,0x1e1a1},
+{0x10a9f,0x1e1c1},
+{0x10ac0,0xcfc41},
+{0x10ac1,0xcfc61},
+{0x10ac2,0xcfc81},
+{0x10ac3,0xcfca1},
+{0x10ac4,0xcfcc1},
+{0x10ac5,0xcfce1},
+{0x10ac6,0xcfd01},
+{0x10ac7,0xcfd21},
+{0x10ac8,0xcfd42},
+{0x10ac9,0xcfd81},
+{0x10aca,0xcfda1},
+{0x10acb,0xcfdc1},
+{0x10acc,0xcfde1},
+{0x10acd,0xcfe01},
+{0x10ace,0xcfe21},
+{0x10acf,0xcfe41},
+{0x10ad0,0xcfe61},
+{0x10ad1,0xcfe81},
+{0x10ad2,0xcfea1},
+{0x10ad3,0xcfec1},
+{0x10ad4,0xcfee1},
+{0x10ad5,0xcff01},
+{0x10ad6,0xcff21},
+{0x10ad7,0xcff41},
+{0x10ad8,0xcff61},
+{0x10ad9,0xcff81},
+{0x10ada,0xcffa1},
+{0x10adb,0xcffc1},
+{0x10adc,0xcffe1},
+{0x10add,0xd0001},
+{0x10ade,0xd0021},
+{0x10adf,0xd0041},
+{0x10ae0,0xd0061},
+{0x10ae1,0xd0081},
+{0x10ae2,0xd00a1},
+{0x10ae3,0xd00c1},
+{0x10ae4,0xd00e1},
+{0x10ae5,0x35701},
+{0x10ae6,0x35721},
+{0x10aeb,0x382e1},
+{0x10aec,0x3bc01},
+{0x10aed,0x1e1e1},
+{0x10aee,0x1e201},
+{0x10aef,0x1e221},
+{0x10af0,0x1e241},
+{0x10af1,0x1e261},
+{0x10af2,0x1e281},
+{0x10af3,0x1e2a1},
+{0x10af4,0x1e2c1},
+{0x10af5,0x1e2e1},
+{0x10af6,0x1e301},
+{0x10b00,0xce1e1},
+{0x10b01,0xce201},
+{0x10b02,0xce221},
+{0x10b03,0xce241},
+{0x10b04,0xce261},
+{0x10b05,0xce281},
+{0x10b06,0xce2a1},
+{0x10b07,0xce2c1},
+{0x10b08,0xce2e1},
+{0x10b09,0xce301},
+{0x10b0a,0xce321},
+{0x10b0b,0xce341},
+{0x10b0c,0xce361},
+{0x10b0d,0xce381},
+{0x10b0e,0xce3a1},
+{0x10b0f,0xce3c1},
+{0x10b10,0xce3e1},
+{0x10b11,0xce401},
+{0x10b12,0xce421},
+{0x10b13,0xce441},
+{0x10b14,0xce461},
+{0x10b15,0xce481},
+{0x10b16,0xce4a1},
+{0x10b17,0xce4c1},
+{0x10b18,0xce4e1},
+{0x10b19,0xce501},
+{0x10b1a,0xce521},
+{0x10b1b,0xce541},
+{0x10b1c,0xce561},
+{0x10b1d,0xce581},
+{0x10b1e,0xce5a1},
+{0x10b1f,0xce5c1},
+{0x10b20,0xce5e1},
+{0x10b21,0xce601},
+{0x10b22,0xce621},
+{0x10b23,0xce641},
+{0x10b24,0xce661},
+{0x10b25,0xce681},
+{0x10b26,0xce6a1},
+{0x10b27,0xce6c1},
+{0x10b28,0xce6e1},
+{0x10b29,0xce701},
+{0x10b2a,0xce721},
+{0x10b2b,0xce741},
+{0x10b2c,0xce761},
+{0x10b2d,0xce781},
+{0x10b2e,0xce7a2},
+{0x10b2f,0xce7e1},
+{0x10b30,0xce801},
+{0x10b31,0xce821},
+{0x10b32,0xce841},
+{0x10b33,0xce861},
+{0x10b34,0xce881},
+{0x10b35,0xce8a1},
+{0x10b39,0x1e321},
+{0x10b3a,0x1e341},
+{0x10b3b,0x1e361},
+{0x10b3c,0x1e381},
+{0x10b3d,0x1e3a1},
+{0x10b3e,0x1e3c1},
+{0x10b3f,0x1e3e1},
+{0x10b40,0xcf4e1},
+{0x10b41,0xcf501},
+{0x10b42,0xcf521},
+{0x10b43,0xcf541},
+{0x10b44,0xcf561},
+{0x10b45,0xcf581},
+{0x10b46,0xcf5a1},
+{0x10b47,0xcf5c1},
+{0x10b48,0xcf5e1},
+{0x10b49,0xcf601},
+{0x10b4a,0xcf621},
+{0x10b4b,0xcf641},
+{0x10b4c,0xcf661},
+{0x10b4d,0xcf681},
+{0x10b4e,0xcf6a1},
+{0x10b4f,0xcf6c1},
+{0x10b50,0xcf6e1},
+{0x10b51,0xcf701},
+{0x10b52,0xcf721},
+{0x10b53,0xcf741},
+{0x10b54,0xcf761},
+{0x10b55,0xcf781},
+{0x10b58,0x382e1},
+{0x10b59,0x3a041},
+{0x10b5a,0x3aec1},
+{0x10b5b,0x3b641},
+{0x10b5c,0x1e401},
+{0x10b5d,0x1e421},
+{0x10b5e,0x1e441},
+{0x10b5f,0x1e461},
+{0x10b60,0xcf7a1},
+{0x10b61,0xcf7c1},
+{0x10b62,0xcf7e1},
+{0x10b63,0xcf801},
+{0x10b64,0xcf821},
+{0x10b65,0xcf841},
+{0x10b66,0xcf861},
+{0x10b67,0xcf881},
+{0x10b68,0xcf8a1},
+{0x10b69,0xcf8c1},
+{0x10b6a,0xcf8e1},
+{0x10b6b,0xcf901},
+{0x10b6c,0xcf921},
+{0x10b6d,0xcf941},
+{0x10b6e,0xcf961},
+{0x10b6f,0xcf981},
+{0x10b70,0xcf9a1},
+{0x10b71,0xcf9c1},
+{0x10b72,0xcf9e1},
+{0x10b78,0x382e1},
+{0x10b79,0x3a041},
+{0x10b7a,0x3aec1},
+{0x10b7b,0x3b641},
+{0x10b7c,0x1e481},
+{0x10b7d,0x1e4a1},
+{0x10b7e,0x1e4c1},
+{0x10b7f,0x1e4e1},
+{0x10b80,0xcfa01},
+{0x10b81,0xcfa21},
+{0x10b82,0xcfa41},
+{0x10b83,0xcfa61},
+{0x10b84,0xcfa81},
+{0x10b85,0xcfaa1},
+{0x10b86,0xcfac1},
+{0x10b87,0xcfae1},
+{0x10b88,0xcfb01},
+{0x10b89,0xcfb21},
+{0x10b8a,0xcfb41},
+{0x10b8b,0xcfb61},
+{0x10b8c,0xcfb81},
+{0x10b8d,0xcfba1},
+{0x10b8e,0xcfbc1},
+{0x10b8f,0xcfbe1},
+{0x10b90,0xcfc01},
+{0x10b91,0xcfc21},
+{0x10b99,0x1e501},
+{0x10b9a,0x1e521},
+{0x10b9b,0x1e541},
+{0x10b9c,0x1e561},
+{0x10ba9,0x382e1},
+{0x10baa,0x3a041},
+{0x10bab,0x3aec1},
+{0x10bac,0x3b641},
+{0x10bad,0x1e581},
+{0x10bae,0x1e5a1},
+{0x10baf,0x1e5c1},
+{0x10c00,0xa2941},
+{0x10c01,0xa2962},
+{0x10c02,0xa29a1},
+{0x10c03,0xa29c1},
+{0x10c04,0xa29e2},
+{0x10c05,0xa2a21},
+{0x10c06,0xa2a41},
+{0x10c07,0xa2a61},
+{0x10c08,0xa2a82},
+{0x10c09,0xa2ac1},
+{0x10c0a,0xa2ae2},
+{0x10c0b,0xa2b21},
+{0x10c0c,0xa2b42},
+{0x10c0d,0xa2b81},
+{0x10c0e,0xa2ba2},
+{0x10c0f,0xa2be1},
+{0x10c10,0xa2c02},
+{0x10c11,0xa2c41},
+{0x10c12,0xa2c62},
+{0x10c13,0xa2ca1},
+{0x10c14,0xa2cc1},
+{0x10c15,0xa2ce2},
+{0x10c16,0xa2d21},
+{0x10c17,0xa2d42},
+{0x10c18,0xa2d81},
+{0x10c19,0xa2da2},
+{0x10c1a,0xa2de1},
+{0x10c1b,0xa2e02},
+{0x10c1c,0xa2e41},
+{0x10c1d,0xa2e62},
+{0x10c1e,0xa2ea1},
+{0x10c1f,0xa2ec2},
+{0x10c20,0xa2f01},
+{0x10c21,0xa2f21},
+{0x10c22,0xa2f41},
+{0x10c23,0xa2f61},
+{0x10c24,0xa2f81},
+{0x10c25,0xa2fa2},
+{0x10c26,0xa2fe1},
+{0x10c27,0xa3002},
+{0x10c28,0xa3041},
+{0x10c29,0xa3062},
+{0x10c2a,0xa30a1},
+{0x10c2b,0xa30c2},
+{0x10c2c,0xa3101},
+{0x10c2d,0xa3121},
+{0x10c2e,0xa3142},
+{0x10c2f,0xa3181},
+{0x10c30,0xa31a1},
+{0x10c31,0xa31c1},
+{0x10c32,0xa31e1},
+{0x10c33,0xa3202},
+{0x10c34,0xa3241},
+{0x10c35,0xa3262},
+{0x10c36,0xa32a1},
+{0x10c37,0xa32c2},
+{0x10c38,0xa3301},
+{0x10c39,0xa3322},
+{0x10c3a,0xa3361},
+{0x10c3b,0xa3382},
+{0x10c3c,0xa33c1},
+{0x10c3d,0xa33e1},
+{0x10c3e,0xa3401},
+{0x10c3f,0xa3421},
+{0x10c40,0xa3442},
+{0x10c41,0xa3481},
+{0x10c42,0xa34a2},
+{0x10c43,0xa34e1},
+{0x10c44,0xa3502},
+{0x10c45,0xa3541},
+{0x10c46,0xa3562},
+{0x10c47,0xa35a1},
+{0x10c48,0xa35c1},
+{0x10c80,0xa1a21},
+{0x10c81,0xa1a82},
+{0x10c82,0xa1ae1},
+{0x10c83,0xa1b21},
+{0x10c84,0xa1b61},
+{0x10c85,0xa1ba1},
+{0x10c86,0xa1be1},
+{0x10c87,0xa1c21},
+{0x10c88,0xa1c61},
+{0x10c89,0xa1ca1},
+{0x10c8a,0xa1d02},
+{0x10c8b,0xa1d82},
+{0x10c8c,0xa1de1},
+{0x10c8d,0xa1e21},
+{0x10c8e,0xa1e61},
+{0x10c8f,0xa1ea1},
+{0x10c90,0xa1ee1},
+{0x10c91,0xa1f42},
+{0x10c92,0xa1fa1},
+{0x10c93,0xa1fe1},
+{0x10c94,0xa2021},
+{0x10c95,0xa2061},
+{0x10c96,0xa20a1},
+{0x10c97,0xa20e1},
+{0x10c98,0xa2121},
+{0x10c99,0xa2161},
+{0x10c9a,0xa21a1},
+{0x10c9b,0xa21e1},
+{0x10c9c,0xa2242},
+{0x10c9d,0xa22a1},
+{0x10c9e,0xa2302},
+{0x10c9f,0xa2382},
+{0x10ca0,0xa23e1},
+{0x10ca1,0xa2421},
+{0x10ca2,0xa2461},
+{0x10ca3,0xa24c2},
+{0x10ca4,0xa2521},
+{0x10ca5,0xa2561},
+{0x10ca6,0xa25a1},
+{0x10ca7,0xa25e1},
+{0x10ca8,0xa2621},
+{0x10ca9,0xa2661},
+{0x10caa,0xa26a1},
+{0x10cab,0xa2702},
+{0x10cac,0xa2761},
+{0x10cad,0xa27c2},
+{0x10cae,0xa2821},
+{0x10caf,0xa2861},
+{0x10cb0,0xa28a1},
+{0x10cb1,0xa28e1},
+{0x10cb2,0xa2921},
+{0x10cc0,0xa1a01},
+{0x10cc1,0xa1a42},
+{0x10cc2,0xa1ac1},
+{0x10cc3,0xa1b01},
+{0x10cc4,0xa1b41},
+{0x10cc5,0xa1b81},
+{0x10cc6,0xa1bc1},
+{0x10cc7,0xa1c01},
+{0x10cc8,0xa1c41},
+{0x10cc9,0xa1c81},
+{0x10cca,0xa1cc2},
+{0x10ccb,0xa1d42},
+{0x10ccc,0xa1dc1},
+{0x10ccd,0xa1e01},
+{0x10cce,0xa1e41},
+{0x10ccf,0xa1e81},
+{0x10cd0,0xa1ec1},
+{0x10cd1,0xa1f02},
+{0x10cd2,0xa1f81},
+{0x10cd3,0xa1fc1},
+{0x10cd4,0xa2001},
+{0x10cd5,0xa2041},
+{0x10cd6,0xa2081},
+{0x10cd7,0xa20c1},
+{0x10cd8,0xa2101},
+{0x10cd9,0xa2141},
+{0x10cda,0xa2181},
+{0x10cdb,0xa21c1},
+{0x10cdc,0xa2202},
+{0x10cdd,0xa2281},
+{0x10cde,0xa22c2},
+{0x10cdf,0xa2342},
+{0x10ce0,0xa23c1},
+{0x10ce1,0xa2401},
+{0x10ce2,0xa2441},
+{0x10ce3,0xa2482},
+{0x10ce4,0xa2501},
+{0x10ce5,0xa2541},
+{0x10ce6,0xa2581},
+{0x10ce7,0xa25c1},
+{0x10ce8,0xa2601},
+{0x10ce9,0xa2641},
+{0x10cea,0xa2681},
+{0x10ceb,0xa26c2},
+{0x10cec,0xa2741},
+{0x10ced,0xa2782},
+{0x10cee,0xa2801},
+{0x10cef,0xa2841},
+{0x10cf0,0xa2881},
+{0x10cf1,0xa28c1},
+{0x10cf2,0xa2901},
+{0x10cfa,0x382e1},
+{0x10cfb,0x3bc01},
+{0x10cfc,0x1e5e1},
+{0x10cfd,0x1e601},
+{0x10cfe,0x1e621},
+{0x10cff,0x1e641},
+{0x10e60,0x382e1},
+{0x10e61,0x3a041},
+{0x10e62,0x3aec1},
+{0x10e63,0x3b641},
+{0x10e64,0x3bc01},
+{0x10e65,0x3bfe1},
+{0x10e66,0x3c301},
+{0x10e67,0x3c681},
+{0x10e68,0x3c9a1},
+{0x10e69,0x1e661},
+{0x10e6a,0x1e681},
+{0x10e6b,0x1e6a1},
+{0x10e6c,0x1e6c1},
+{0x10e6d,0x1e6e1},
+{0x10e6e,0x1e701},
+{0x10e6f,0x1e721},
+{0x10e70,0x1e741},
+{0x10e71,0x1e761},
+{0x10e72,0x1e781},
+{0x10e73,0x1e7a1},
+{0x10e74,0x1e7c1},
+{0x10e75,0x1e7e1},
+{0x10e76,0x1e801},
+{0x10e77,0x1e821},
+{0x10e78,0x1e841},
+{0x10e79,0x1e861},
+{0x10e7a,0x1e881},
+{0x10e7b,0x1e8a1},
+{0x10e7c,0x1e8c1},
+{0x10e7d,0x1e8e1},
+{0x10e7e,0x1e901},
+{0x11000,0x36ca1},
+{0x11001,0x36cc1},
+{0x11002,0x36ce1},
+{0x11003,0x80461},
+{0x11004,0x80481},
+{0x11005,0x7fe81},
+{0x11006,0x7fea1},
+{0x11007,0x7fec1},
+{0x11008,0x7fee1},
+{0x11009,0x7ff01},
+{0x1100a,0x7ff21},
+{0x1100b,0x7ff41},
+{0x1100c,0x7ff61},
+{0x1100d,0x7ff81},
+{0x1100e,0x7ffa1},
+{0x1100f,0x7ffc1},
+{0x11010,0x7ffe1},
+{0x11011,0x80001},
+{0x11012,0x80021},
+{0x11013,0x80041},
+{0x11014,0x80061},
+{0x11015,0x80081},
+{0x11016,0x800a1},
+{0x11017,0x800c1},
+{0x11018,0x800e1},
+{0x11019,0x80101},
+{0x1101a,0x80121},
+{0x1101b,0x80141},
+{0x1101c,0x80161},
+{0x1101d,0x80181},
+{0x1101e,0x801a1},
+{0x1101f,0x801c1},
+{0x11020,0x801e1},
+{0x11021,0x80201},
+{0x11022,0x80221},
+{0x11023,0x80241},
+{0x11024,0x80261},
+{0x11025,0x80281},
+{0x11026,0x802a1},
+{0x11027,0x802c1},
+{0x11028,0x802e1},
+{0x11029,0x80301},
+{0x1102a,0x80321},
+{0x1102b,0x80341},
+{0x1102c,0x80361},
+{0x1102d,0x80381},
+{0x1102e,0x803a1},
+{0x1102f,0x803c1},
+{0x11030,0x803e1},
+{0x11031,0x80401},
+{0x11032,0x80421},
+{0x11033,0x80441},
+{0x11034,0x804a1},
+{0x11035,0x804c1},
+{0x11036,0x804e1},
+{0x11037,0x80501},
+{0x11038,0x80521},
+{0x11039,0x80541},
+{0x1103a,0x80561},
+{0x1103b,0x80581},
+{0x1103c,0x805a1},
+{0x1103d,0x805c1},
+{0x1103e,0x805e1},
+{0x1103f,0x80601},
+{0x11040,0x80621},
+{0x11041,0x80641},
+{0x11042,0x80661},
+{0x11043,0x80681},
+{0x11044,0x806a1},
+{0x11045,0x806c1},
+{0x11046,0x806e1},
+{0x11047,0x1e921},
+{0x11048,0x1e941},
+{0x11049,0x1e961},
+{0x1104a,0x1e981},
+{0x1104b,0x1e9a1},
+{0x1104c,0x1e9c1},
+{0x1104d,0x1e9e1},
+{0x11052,0x382e1},
+{0x11053,0x3a041},
+{0x11054,0x3aec1},
+{0x11055,0x3b641},
+{0x11056,0x3bc01},
+{0x11057,0x3bfe1},
+{0x11058,0x3c301},
+{0x11059,0x3c681},
+{0x1105a,0x3c9a1},
+{0x1105b,0x1ea01},
+{0x1105c,0x1ea21},
+{0x1105d,0x1ea41},
+{0x1105e,0x1ea61},
+{0x1105f,0x1ea81},
+{0x11060,0x1eaa1},
+{0x11061,0x1eac1},
+{0x11062,0x1eae1},
+{0x11063,0x1eb01},
+{0x11064,0x1eb21},
+{0x11065,0x1eb41},
+{0x11066,0x380c1},
+{0x11067,0x382e1},
+{0x11068,0x3a041},
+{0x11069,0x3aec1},
+{0x1106a,0x3b641},
+{0x1106b,0x3bc01},
+{0x1106c,0x3bfe1},
+{0x1106d,0x3c301},
+{0x1106e,0x3c681},
+{0x1106f,0x3c9a1},
+{0x1107f,0x80701},
+{0x11080,0x36ca1},
+{0x11081,0x36cc1},
+{0x11082,0x36ce1},
+{0x11083,0x7a401},
+{0x11084,0x7a421},
+{0x11085,0x7a441},
+{0x11086,0x7a461},
+{0x11087,0x7a481},
+{0x11088,0x7a4a1},
+{0x11089,0x7a4c1},
+{0x1108a,0x7a4e1},
+{0x1108b,0x7a501},
+{0x1108c,0x7a521},
+{0x1108d,0x7a541},
+{0x1108e,0x7a561},
+{0x1108f,0x7a581},
+{0x11090,0x7a5a1},
+{0x11091,0x7a5c1},
+{0x11092,0x7a5e1},
+{0x11093,0x7a601},
+{0x11094,0x7a621},
+{0x11095,0x7a641},
+{0x11096,0x7a661},
+{0x11097,0x7a681},
+{0x11098,0x7a6a1},
+{0x11099,0x7a6c1},
+{0x1109a,0x7a6e2},
+{0x1109b,0x7a721},
+{0x1109c,0x7a742},
+{0x1109d,0x7a781},
+{0x1109e,0x7a7a1},
+{0x1109f,0x7a7c1},
+{0x110a0,0x7a7e1},
+{0x110a1,0x7a801},
+{0x110a2,0x7a821},
+{0x110a3,0x7a841},
+{0x110a4,0x7a861},
+{0x110a5,0x7a881},
+{0x110a6,0x7a8e1},
+{0x110a7,0x7a901},
+{0x110a8,0x7a921},
+{0x110a9,0x7a941},
+{0x110aa,0x7a961},
+{0x110ab,0x7a8a2},
+{0x110ac,0x7a981},
+{0x110ad,0x7a9a1},
+{0x110ae,0x7a9c1},
+{0x110af,0x7a9e1},
+{0x110b0,0x7aa01},
+{0x110b1,0x7aa21},
+{0x110b2,0x7aa41},
+{0x110b3,0x7aa61},
+{0x110b4,0x7aa81},
+{0x110b5,0x7aaa1},
+{0x110b6,0x7aac1},
+{0x110b7,0x7aae1},
+{0x110b8,0x7ab01},
+{0x110b9,0x7ab21},
+{0x110ba,0x36c81},
+{0x110bb,0x1eb61},
+{0x110bc,0x1eb81},
+{0x110bd,0x1},
+{0x110be,0x1eba1},
+{0x110bf,0x1ebc1},
+{0x110c0,0x1ebe1},
+{0x110c1,0x1ec01},
+{0x110d0,0xc87c1},
+{0x110d1,0xc87e1},
+{0x110d2,0xc8801},
+{0x110d3,0xc8821},
+{0x110d4,0xc8841},
+{0x110d5,0xc8861},
+{0x110d6,0xc8881},
+{0x110d7,0xc88a1},
+{0x110d8,0xc88c1},
+{0x110d9,0xc88e1},
+{0x110da,0xc8901},
+{0x110db,0xc8921},
+{0x110dc,0xc8941},
+{0x110dd,0xc8961},
+{0x110de,0xc8981},
+{0x110df,0xc89a1},
+{0x110e0,0xc89c1},
+{0x110e1,0xc89e1},
+{0x110e2,0xc8a01},
+{0x110e3,0xc8a21},
+{0x110e4,0xc8a41},
+{0x110e5,0xc8a61},
+{0x110e6,0xc8a81},
+{0x110e7,0xc8aa1},
+{0x110e8,0xc8ac1},
+{0x110f0,0x380c1},
+{0x110f1,0x382e1},
+{0x110f2,0x3a041},
+{0x110f3,0x3aec1},
+{0x110f4,0x3b641},
+{0x110f5,0x3bc01},
+{0x110f6,0x3bfe1},
+{0x110f7,0x3c301},
+{0x110f8,0x3c681},
+{0x110f9,0x3c9a1},
+{0x11100,0x36ca1},
+{0x11101,0x36cc1},
+{0x11102,0x36ce1},
+{0x11103,0x91801},
+{0x11104,0x91821},
+{0x11105,0x91841},
+{0x11106,0x91861},
+{0x11107,0x91881},
+{0x11108,0x918a1},
+{0x11109,0x918c1},
+{0x1110a,0x918e1},
+{0x1110b,0x91901},
+{0x1110c,0x91921},
+{0x1110d,0x91941},
+{0x1110e,0x91961},
+{0x1110f,0x91981},
+{0x11110,0x919a1},
+{0x11111,0x919c1},
+{0x11112,0x919e1},
+{0x11113,0x91a01},
+{0x11114,0x91a21},
+{0x11115,0x91a41},
+{0x11116,0x91a61},
+{0x11117,0x91a81},
+{0x11118,0x91aa1},
+{0x11119,0x91ac1},
+{0x1111a,0x91ae1},
+{0x1111b,0x91b01},
+{0x1111c,0x91b21},
+{0x1111d,0x91b41},
+{0x1111e,0x91b61},
+{0x1111f,0x91b81},
+{0x11120,0x91ba1},
+{0x11121,0x91bc1},
+{0x11122,0x91be1},
+{0x11123,0x91c01},
+{0x11124,0x91c21},
+{0x11125,0x91c41},
+{0x11126,0x91c61},
+{0x11127,0x91c81},
+{0x11128,0x91ca1},
+{0x11129,0x91cc1},
+{0x1112a,0x91ce1},
+{0x1112b,0x91d01},
+{0x1112c,0x91d21},
+{0x1112d,0x91d41},
+{0x1112e,0x91d61},
+{0x1112f,0x91d81},
+{0x11130,0x91da1},
+{0x11131,0x91dc1},
+{0x11132,0x91de1},
+{0x11133,0x91e01},
+{0x11134,0x91e21},
+{0x11136,0x380c1},
+{0x11137,0x382e1},
+{0x11138,0x3a041},
+{0x11139,0x3aec1},
+{0x1113a,0x3b641},
+{0x1113b,0x3bc01},
+{0x1113c,0x3bfe1},
+{0x1113d,0x3c301},
+{0x1113e,0x3c681},
+{0x1113f,0x3c9a1},
+{0x11140,0x1ec21},
+{0x11141,0x1ec41},
+{0x11142,0x1ec61},
+{0x11143,0x1ec81},
+{0x11150,0x7ab41},
+{0x11151,0x7ab61},
+{0x11152,0x7ab81},
+{0x11153,0x7aba1},
+{0x11154,0x7abc1},
+{0x11155,0x7abe1},
+{0x11156,0x7ac01},
+{0x11157,0x7ac21},
+{0x11158,0x7ac41},
+{0x11159,0x7ac61},
+{0x1115a,0x7ac81},
+{0x1115b,0x7aca1},
+{0x1115c,0x7acc1},
+{0x1115d,0x7ace1},
+{0x1115e,0x7ad01},
+{0x1115f,0x7ad21},
+{0x11160,0x7ad41},
+{0x11161,0x7ad61},
+{0x11162,0x7ad81},
+{0x11163,0x7ada1},
+{0x11164,0x7adc1},
+{0x11165,0x7ade1},
+{0x11166,0x7ae01},
+{0x11167,0x7ae21},
+{0x11168,0x7ae41},
+{0x11169,0x7ae61},
+{0x1116a,0x7ae81},
+{0x1116b,0x7aea1},
+{0x1116c,0x7aec1},
+{0x1116d,0x7aee1},
+{0x1116e,0x7af01},
+{0x1116f,0x7af21},
+{0x11170,0x7af61},
+{0x11171,0x7af81},
+{0x11172,0x7afa1},
+{0x11173,0x36c81},
+{0x11174,0x1eca1},
+{0x11175,0x1ecc1},
+{0x11176,0x7af41},
+{0x11180,0x36ca1},
+{0x11181,0x36cc1},
+{0x11182,0x36ce1},
+{0x11183,0x7b001},
+{0x11184,0x7b021},
+{0x11185,0x7b041},
+{0x11186,0x7b061},
+{0x11187,0x7b081},
+{0x11188,0x7b0a1},
+{0x11189,0x7b0c1},
+{0x1118a,0x7b0e1},
+{0x1118b,0x7b101},
+{0x1118c,0x7b121},
+{0x1118d,0x7b141},
+{0x1118e,0x7b161},
+{0x1118f,0x7b181},
+{0x11190,0x7b1a1},
+{0x11191,0x7b1c1},
+{0x11192,0x7b1e1},
+{0x11193,0x7b201},
+{0x11194,0x7b221},
+{0x11195,0x7b241},
+{0x11196,0x7b261},
+{0x11197,0x7b281},
+{0x11198,0x7b2a1},
+{0x11199,0x7b2c1},
+{0x1119a,0x7b2e1},
+{0x1119b,0x7b301},
+{0x1119c,0x7b321},
+{0x1119d,0x7b341},
+{0x1119e,0x7b361},
+{0x1119f,0x7b381},
+{0x111a0,0x7b3a1},
+{0x111a1,0x7b3c1},
+{0x111a2,0x7b3e1},
+{0x111a3,0x7b401},
+{0x111a4,0x7b421},
+{0x111a5,0x7b441},
+{0x111a6,0x7b461},
+{0x111a7,0x7b481},
+{0x111a8,0x7b4a1},
+{0x111a9,0x7b4c1},
+{0x111aa,0x7b4e1},
+{0x111ab,0x7b501},
+{0x111ac,0x7b521},
+{0x111ad,0x7b541},
+{0x111ae,0x7b561},
+{0x111af,0x7b581},
+{0x111b0,0x7b5a1},
+{0x111b1,0x7b5c1},
+{0x111b2,0x7b5e1},
+{0x111b3,0x7b681},
+{0x111b4,0x7b6a1},
+{0x111b5,0x7b6c1},
+{0x111b6,0x7b6e1},
+{0x111b7,0x7b701},
+{0x111b8,0x7b721},
+{0x111b9,0x7b741},
+{0x111ba,0x7b761},
+{0x111bb,0x7b781},
+{0x111bc,0x7b7a1},
+{0x111bd,0x7b7c1},
+{0x111be,0x7b7e1},
+{0x111bf,0x7b801},
+{0x111c0,0x7b821},
+{0x111c1,0x7b601},
+{0x111c2,0x7b621},
+{0x111c3,0x7b641},
+{0x111c4,0x7afc1},
+{0x111c5,0x1ece1},
+{0x111c6,0x1ed01},
+{0x111c7,0x1ed21},
+{0x111c8,0x1ed41},
+{0x111c9,0x36d01},
+{0x111ca,0x36c81},
+{0x111cb,0x36e41},
+{0x111cc,0x36e61},
+{0x111cd,0x1ed61},
+{0x111d0,0x380c1},
+{0x111d1,0x382e1},
+{0x111d2,0x3a041},
+{0x111d3,0x3aec1},
+{0x111d4,0x3b641},
+{0x111d5,0x3bc01},
+{0x111d6,0x3bfe1},
+{0x111d7,0x3c301},
+{0x111d8,0x3c681},
+{0x111d9,0x3c9a1},
+{0x111da,0x7afe1},
+{0x111db,0x1ed81},
+{0x111dc,0x7b661},
+{0x111dd,0x1eda1},
+{0x111de,0x1edc1},
+{0x111df,0x1ede1},
+{0x111e1,0x382e1},
+{0x111e2,0x3a041},
+{0x111e3,0x3aec1},
+{0x111e4,0x3b641},
+{0x111e5,0x3bc01},
+{0x111e6,0x3bfe1},
+{0x111e7,0x3c301},
+{0x111e8,0x3c681},
+{0x111e9,0x3c9a1},
+{0x111ea,0x1ee01},
+{0x111eb,0x1ee21},
+{0x111ec,0x1ee41},
+{0x111ed,0x1ee61},
+{0x111ee,0x1ee81},
+{0x111ef,0x1eea1},
+{0x111f0,0x1eec1},
+{0x111f1,0x1eee1},
+{0x111f2,0x1ef01},
+{0x111f3,0x1ef21},
+{0x111f4,0x1ef41},
+{0x11200,0x7b841},
+{0x11201,0x7b861},
+{0x11202,0x7b881},
+{0x11203,0x7b8a1},
+{0x11204,0x7b8c1},
+{0x11205,0x7b8e1},
+{0x11206,0x7b901},
+{0x11207,0x7b921},
+{0x11208,0x7b941},
+{0x11209,0x7b961},
+{0x1120a,0x7b981},
+{0x1120b,0x7b9a1},
+{0x1120c,0x7b9c1},
+{0x1120d,0x7b9e1},
+{0x1120e,0x7ba01},
+{0x1120f,0x7ba21},
+{0x11210,0x7ba41},
+{0x11211,0x7ba61},
+{0x11213,0x7ba81},
+{0x11214,0x7baa1},
+{0x11215,0x7bac1},
+{0x11216,0x7bae1},
+{0x11217,0x7bb01},
+{0x11218,0x7bb21},
+{0x11219,0x7bb41},
+{0x1121a,0x7bb61},
+{0x1121b,0x7bb81},
+{0x1121c,0x7bba1},
+{0x1121d,0x7bbc1},
+{0x1121e,0x7bbe1},
+{0x1121f,0x7bc01},
+{0x11220,0x7bc21},
+{0x11221,0x7bc41},
+{0x11222,0x7bc61},
+{0x11223,0x7bc81},
+{0x11224,0x7bca1},
+{0x11225,0x7bcc1},
+{0x11226,0x7bce1},
+{0x11227,0x7bd01},
+{0x11228,0x7bd21},
+{0x11229,0x7bd41},
+{0x1122a,0x7bd61},
+{0x1122b,0x7bd81},
+{0x1122c,0x7bda1},
+{0x1122d,0x7bdc1},
+{0x1122e,0x7bde1},
+{0x1122f,0x7be01},
+{0x11230,0x7be21},
+{0x11231,0x7be41},
+{0x11232,0x7be61},
+{0x11233,0x7be81},
+{0x11234,0x36cc1},
+{0x11235,0x7bea1},
+{0x11236,0x36c81},
+{0x11237,0x36421},
+{0x11238,0x1ef61},
+{0x11239,0x1ef81},
+{0x1123a,0x1efa1},
+{0x1123b,0x1efc1},
+{0x1123c,0x1efe1},
+{0x1123d,0x1f001},
+{0x11280,0x7c5e1},
+{0x11281,0x7c601},
+{0x11282,0x7c621},
+{0x11283,0x7c641},
+{0x11284,0x7c6a1},
+{0x11285,0x7c6c1},
+{0x11286,0x7c6e1},
+{0x11288,0x7c701},
+{0x1128a,0x7c721},
+{0x1128b,0x7c741},
+{0x1128c,0x7c761},
+{0x1128d,0x7c781},
+{0x1128f,0x7c7a1},
+{0x11290,0x7c7c1},
+{0x11291,0x7c7e1},
+{0x11292,0x7c801},
+{0x11293,0x7c821},
+{0x11294,0x7c841},
+{0x11295,0x7c861},
+{0x11296,0x7c881},
+{0x11297,0x7c8a1},
+{0x11298,0x7c8c1},
+{0x11299,0x7c8e1},
+{0x1129a,0x7c901},
+{0x1129b,0x7c921},
+{0x1129c,0x7c941},
+{0x1129d,0x7c961},
+{0x1129f,0x7c981},
+{0x112a0,0x7c9a1},
+{0x112a1,0x7c9c1},
+{0x112a2,0x7c9e1},
+{0x112a3,0x7ca01},
+{0x112a4,0x7ca21},
+{0x112a5,0x7c661},
+{0x112a6,0x7c681},
+{0x112a7,0x7ca41},
+{0x112a8,0x7ca61},
+{0x112a9,0x1f021},
+{0x112b0,0x7bec1},
+{0x112b1,0x7bee1},
+{0x112b2,0x7bf01},
+{0x112b3,0x7bf21},
+{0x112b4,0x7bf41},
+{0x112b5,0x7bf61},
+{0x112b6,0x7bf81},
+{0x112b7,0x7bfa1},
+{0x112b8,0x7bfc1},
+{0x112b9,0x7bfe1},
+{0x112ba,0x7c001},
+{0x112bb,0x7c021},
+{0x112bc,0x7c041},
+{0x112bd,0x7c061},
+{0x112be,0x7c081},
+{0x112bf,0x7c0a1},
+{0x112c0,0x7c0c1},
+{0x112c1,0x7c0e1},
+{0x112c2,0x7c101},
+{0x112c3,0x7c121},
+{0x112c4,0x7c141},
+{0x112c5,0x7c161},
+{0x112c6,0x7c181},
+{0x112c7,0x7c1a1},
+{0x112c8,0x7c1c1},
+{0x112c9,0x7c1e1},
+{0x112ca,0x7c201},
+{0x112cb,0x7c221},
+{0x112cc,0x7c241},
+{0x112cd,0x7c261},
+{0x112ce,0x7c281},
+{0x112cf,0x7c2a1},
+{0x112d0,0x7c2c1},
+{0x112d1,0x7c2e1},
+{0x112d2,0x7c301},
+{0x112d3,0x7c321},
+{0x112d4,0x7c341},
+{0x112d5,0x7c361},
+{0x112d6,0x7c381},
+{0x112d7,0x7c3a1},
+{0x112d8,0x7c3c1},
+{0x112d9,0x7c3e1},
+{0x112da,0x7c401},
+{0x112db,0x7c421},
+{0x112dc,0x7c441},
+{0x112dd,0x7c461},
+{0x112de,0x7c481},
+{0x112df,0x36cc1},
+{0x112e0,0x7c4a1},
+{0x112e1,0x7c4c1},
+{0x112e2,0x7c4e1},
+{0x112e3,0x7c501},
+{0x112e4,0x7c521},
+{0x112e5,0x7c541},
+{0x112e6,0x7c561},
+{0x112e7,0x7c581},
+{0x112e8,0x7c5a1},
+{0x112e9,0x36c81},
+{0x112ea,0x7c5c1},
+{0x112f0,0x380c1},
+{0x112f1,0x382e1},
+{0x112f2,0x3a041},
+{0x112f3,0x3aec1},
+{0x112f4,0x3b641},
+{0x112f5,0x3bc01},
+{0x112f6,0x3bfe1},
+{0x112f7,0x3c301},
+{0x112f8,0x3c681},
+{0x112f9,0x3c9a1},
+{0x11300,0x36cc1},
+{0x11301,0x36ca1},
+{0x11302,0x36cc1},
+{0x11303,0x36ce1},
+{0x11305,0x7caa1},
+{0x11306,0x7cac1},
+{0x11307,0x7cae1},
+{0x11308,0x7cb01},
+{0x11309,0x7cb21},
+{0x1130a,0x7cb41},
+{0x1130b,0x7cb61},
+{0x1130c,0x7cba1},
+{0x1130f,0x7cbe1},
+{0x11310,0x7cc01},
+{0x11313,0x7cc21},
+{0x11314,0x7cc41},
+{0x11315,0x7cc61},
+{0x11316,0x7cc81},
+{0x11317,0x7cca1},
+{0x11318,0x7ccc1},
+{0x11319,0x7cce1},
+{0x1131a,0x7cd01},
+{0x1131b,0x7cd21},
+{0x1131c,0x7cd41},
+{0x1131d,0x7cd61},
+{0x1131e,0x7cd81},
+{0x1131f,0x7cda1},
+{0x11320,0x7cdc1},
+{0x11321,0x7cde1},
+{0x11322,0x7ce01},
+{0x11323,0x7ce21},
+{0x11324,0x7ce41},
+{0x11325,0x7ce61},
+{0x11326,0x7ce81},
+{0x11327,0x7cea1},
+{0x11328,0x7cec1},
+{0x1132a,0x7cee1},
+{0x1132b,0x7cf01},
+{0x1132c,0x7cf21},
+{0x1132d,0x7cf41},
+{0x1132e,0x7cf61},
+{0x1132f,0x7cf81},
+{0x11330,0x7cfa1},
+{0x11332,0x7cfc1},
+{0x11333,0x7cfe1},
+{0x11335,0x7d001},
+{0x11336,0x7d021},
+{0x11337,0x7d041},
+{0x11338,0x7d061},
+{0x11339,0x7d081},
+{0x1133c,0x36c81},
+{0x1133d,0x7d0a1},
+{0x1133e,0x7d101},
+{0x1133f,0x7d121},
+{0x11340,0x7d141},
+{0x11341,0x7d161},
+{0x11342,0x7d181},
+{0x11343,0x7d1a1},
+{0x11344,0x7d1c1},
+{0x11347,0x7d221},
+{0x11348,0x7d241},
+{0x1134b,0x7d261},
+{0x1134c,0x7d281},
+{0x1134d,0x7d2a1},
+{0x11350,0x7ca81},
+{0x11357,0x7d2c1},
+{0x1135d,0x7d2e1},
+{0x1135e,0x7d0c1},
+{0x1135f,0x7d0e1},
+{0x11360,0x7cb81},
+{0x11361,0x7cbc1},
+{0x11362,0x7d1e1},
+{0x11363,0x7d201},
+{0x11366,0x1},
+{0x11367,0x1},
+{0x11368,0x1},
+{0x11369,0x1},
+{0x1136a,0x1},
+{0x1136b,0x1},
+{0x1136c,0x1},
+{0x11370,0x1},
+{0x11371,0x1},
+{0x11372,0x1},
+{0x11373,0x1},
+{0x11374,0x1},
+{0x11480,0x7d321},
+{0x11481,0x7d341},
+{0x11482,0x7d361},
+{0x11483,0x7d381},
+{0x11484,0x7d3a1},
+{0x11485,0x7d3c1},
+{0x11486,0x7d3e1},
+{0x11487,0x7d401},
+{0x11488,0x7d421},
+{0x11489,0x7d441},
+{0x1148a,0x7d461},
+{0x1148b,0x7d481},
+{0x1148c,0x7d4a1},
+{0x1148d,0x7d4c1},
+{0x1148e,0x7d4e1},
+{0x1148f,0x7d501},
+{0x11490,0x7d521},
+{0x11491,0x7d541},
+{0x11492,0x7d561},
+{0x11493,0x7d581},
+{0x11494,0x7d5a1},
+{0x11495,0x7d5c1},
+{0x11496,0x7d5e1},
+{0x11497,0x7d601},
+{0x11498,0x7d621},
+{0x11499,0x7d641},
+{0x1149a,0x7d661},
+{0x1149b,0x7d681},
+{0x1149c,0x7d6a1},
+{0x1149d,0x7d6c1},
+{0x1149e,0x7d6e1},
+{0x1149f,0x7d701},
+{0x114a0,0x7d721},
+{0x114a1,0x7d741},
+{0x114a2,0x7d761},
+{0x114a3,0x7d781},
+{0x114a4,0x7d7a1},
+{0x114a5,0x7d7c1},
+{0x114a6,0x7d7e1},
+{0x114a7,0x7d801},
+{0x114a8,0x7d821},
+{0x114a9,0x7d841},
+{0x114aa,0x7d861},
+{0x114ab,0x7d881},
+{0x114ac,0x7d8a1},
+{0x114ad,0x7d8c1},
+{0x114ae,0x7d8e1},
+{0x114af,0x7d901},
+{0x114b0,0x7d961},
+{0x114b1,0x7d981},
+{0x114b2,0x7d9a1},
+{0x114b3,0x7d9c1},
+{0x114b4,0x7d9e1},
+{0x114b5,0x7da01},
+{0x114b6,0x7da21},
+{0x114b7,0x7da41},
+{0x114b8,0x7da61},
+{0x114b9,0x7da81},
+{0x114ba,0x7daa1},
+{0x114bb,0x7dac1},
+{0x114bc,0x7dae1},
+{0x114bd,0x7db01},
+{0x114be,0x7db21},
+{0x114bf,0x36ca1},
+{0x114c0,0x36cc1},
+{0x114c1,0x36ce1},
+{0x114c2,0x7db41},
+{0x114c3,0x36c81},
+{0x114c4,0x7d921},
+{0x114c5,0x7d941},
+{0x114c6,0x1f041},
+{0x114c7,0x7d301},
+{0x114d0,0x380c1},
+{0x114d1,0x382e1},
+{0x114d2,0x3a041},
+{0x114d3,0x3aec1},
+{0x114d4,0x3b641},
+{0x114d5,0x3bc01},
+{0x114d6,0x3bfe1},
+{0x114d7,0x3c301},
+{0x114d8,0x3c681},
+{0x114d9,0x3c9a1},
+{0x11580,0x7db61},
+{0x11581,0x7db81},
+{0x11582,0x7dba1},
+{0x11583,0x7dc41},
+{0x11584,0x7dca1},
+{0x11585,0x7dd01},
+{0x11586,0x7dd21},
+{0x11587,0x7dd41},
+{0x11588,0x7dd61},
+{0x11589,0x7dd81},
+{0x1158a,0x7dda1},
+{0x1158b,0x7ddc1},
+{0x1158c,0x7dde1},
+{0x1158d,0x7de01},
+{0x1158e,0x7de21},
+{0x1158f,0x7de41},
+{0x11590,0x7de61},
+{0x11591,0x7de81},
+{0x11592,0x7dea1},
+{0x11593,0x7dec1},
+{0x11594,0x7dee1},
+{0x11595,0x7df01},
+{0x11596,0x7df21},
+{0x11597,0x7df41},
+{0x11598,0x7df61},
+{0x11599,0x7df81},
+{0x1159a,0x7dfa1},
+{0x1159b,0x7dfc1},
+{0x1159c,0x7dfe1},
+{0x1159d,0x7e001},
+{0x1159e,0x7e021},
+{0x1159f,0x7e041},
+{0x115a0,0x7e061},
+{0x115a1,0x7e081},
+{0x115a2,0x7e0a1},
+{0x115a3,0x7e0c1},
+{0x115a4,0x7e0e1},
+{0x115a5,0x7e101},
+{0x115a6,0x7e121},
+{0x115a7,0x7e141},
+{0x115a8,0x7e161},
+{0x115a9,0x7e181},
+{0x115aa,0x7e1a1},
+{0x115ab,0x7e1c1},
+{0x115ac,0x7e1e1},
+{0x115ad,0x7e201},
+{0x115ae,0x7e221},
+{0x115af,0x7e241},
+{0x115b0,0x7e261},
+{0x115b1,0x7e281},
+{0x115b2,0x7e2a1},
+{0x115b3,0x7e301},
+{0x115b4,0x7e361},
+{0x115b5,0x7e381},
+{0x115b8,0x7e3a1},
+{0x115b9,0x7e3c1},
+{0x115ba,0x7e3e1},
+{0x115bb,0x7e401},
+{0x115bc,0x36ca1},
+{0x115bd,0x36cc1},
+{0x115be,0x36ce1},
+{0x115bf,0x7e421},
+{0x115c0,0x36c81},
+{0x115c1,0x1f061},
+{0x115c2,0x1f081},
+{0x115c3,0x1f0a1},
+{0x115c4,0x1f0c1},
+{0x115c5,0x1f0e1},
+{0x115c6,0x1f101},
+{0x115c7,0x1f121},
+{0x115c8,0x1f141},
+{0x115c9,0x1f161},
+{0x115ca,0x1f181},
+{0x115cb,0x1f1a1},
+{0x115cc,0x1f1c1},
+{0x115cd,0x1f1e1},
+{0x115ce,0x1f201},
+{0x115cf,0x1f221},
+{0x115d0,0x1f241},
+{0x115d1,0x1f261},
+{0x115d2,0x1f281},
+{0x115d3,0x1f2a1},
+{0x115d4,0x1f2c1},
+{0x115d5,0x1f2e1},
+{0x115d6,0x1f301},
+{0x115d7,0x1f321},
+{0x115d8,0x7dbc2},
+{0x115d9,0x7dc02},
+{0x115da,0x7dc62},
+{0x115db,0x7dcc2},
+{0x115dc,0x7e2c2},
+{0x115dd,0x7e322},
+{0x11600,0x7e441},
+{0x11601,0x7e461},
+{0x11602,0x7e481},
+{0x11603,0x7e4a1},
+{0x11604,0x7e4c1},
+{0x11605,0x7e4e1},
+{0x11606,0x7e501},
+{0x11607,0x7e521},
+{0x11608,0x7e541},
+{0x11609,0x7e561},
+{0x1160a,0x7e581},
+{0x1160b,0x7e5a1},
+{0x1160c,0x7e5c1},
+{0x1160d,0x7e5e1},
+{0x1160e,0x7e601},
+{0x1160f,0x7e621},
+{0x11610,0x7e641},
+{0x11611,0x7e661},
+{0x11612,0x7e681},
+{0x11613,0x7e6a1},
+{0x11614,0x7e6c1},
+{0x11615,0x7e6e1},
+{0x11616,0x7e701},
+{0x11617,0x7e721},
+{0x11618,0x7e741},
+{0x11619,0x7e761},
+{0x1161a,0x7e781},
+{0x1161b,0x7e7a1},
+{0x1161c,0x7e7c1},
+{0x1161d,0x7e7e1},
+{0x1161e,0x7e801},
+{0x1161f,0x7e821},
+{0x11620,0x7e841},
+{0x11621,0x7e861},
+{0x11622,0x7e881},
+{0x11623,0x7e8a1},
+{0x11624,0x7e8c1},
+{0x11625,0x7e8e1},
+{0x11626,0x7e901},
+{0x11627,0x7e921},
+{0x11628,0x7e941},
+{0x11629,0x7e961},
+{0x1162a,0x7e981},
+{0x1162b,0x7e9a1},
+{0x1162c,0x7e9c1},
+{0x1162d,0x7e9e1},
+{0x1162e,0x7ea01},
+{0x1162f,0x7ea21},
+{0x11630,0x7ea41},
+{0x11631,0x7ea61},
+{0x11632,0x7ea81},
+{0x11633,0x7eaa1},
+{0x11634,0x7eac1},
+{0x11635,0x7eae1},
+{0x11636,0x7eb01},
+{0x11637,0x7eb21},
+{0x11638,0x7eb41},
+{0x11639,0x7eb61},
+{0x1163a,0x7eb81},
+{0x1163b,0x7eba1},
+{0x1163c,0x7ebc1},
+{0x1163d,0x36cc1},
+{0x1163e,0x36ce1},
+{0x1163f,0x7ebe1},
+{0x11640,0x36ca1},
+{0x11641,0x1f341},
+{0x11642,0x1f361},
+{0x11643,0x1f381},
+{0x11644,0x7ec01},
+{0x11650,0x380c1},
+{0x11651,0x382e1},
+{0x11652,0x3a041},
+{0x11653,0x3aec1},
+{0x11654,0x3b641},
+{0x11655,0x3bc01},
+{0x11656,0x3bfe1},
+{0x11657,0x3c301},
+{0x11658,0x3c681},
+{0x11659,0x3c9a1},
+{0x11680,0x7ec21},
+{0x11681,0x7ec41},
+{0x11682,0x7ec61},
+{0x11683,0x7ec81},
+{0x11684,0x7eca1},
+{0x11685,0x7ecc1},
+{0x11686,0x7ece1},
+{0x11687,0x7ed01},
+{0x11688,0x7ed21},
+{0x11689,0x7ed41},
+{0x1168a,0x7edc1},
+{0x1168b,0x7ede1},
+{0x1168c,0x7ee01},
+{0x1168d,0x7ee21},
+{0x1168e,0x7ee41},
+{0x1168f,0x7ee61},
+{0x11690,0x7ee81},
+{0x11691,0x7eea1},
+{0x11692,0x7eec1},
+{0x11693,0x7eee1},
+{0x11694,0x7ef01},
+{0x11695,0x7ef21},
+{0x11696,0x7ef41},
+{0x11697,0x7ef61},
+{0x11698,0x7ef81},
+{0x11699,0x7efa1},
+{0x1169a,0x7efc1},
+{0x1169b,0x7efe1},
+{0x1169c,0x7f001},
+{0x1169d,0x7f021},
+{0x1169e,0x7f041},
+{0x1169f,0x7f061},
+{0x116a0,0x7f081},
+{0x116a1,0x7f0a1},
+{0x116a2,0x7f0c1},
+{0x116a3,0x7f0e1},
+{0x116a4,0x7f101},
+{0x116a5,0x7f121},
+{0x116a6,0x7f141},
+{0x116a7,0x7ed81},
+{0x116a8,0x7ed61},
+{0x116a9,0x7eda1},
+{0x116aa,0x7f161},
+{0x116ab,0x36cc1},
+{0x116ac,0x36ce1},
+{0x116ad,0x7f181},
+{0x116ae,0x7f1a1},
+{0x116af,0x7f1c1},
+{0x116b0,0x7f1e1},
+{0x116b1,0x7f201},
+{0x116b2,0x7f221},
+{0x116b3,0x7f241},
+{0x116b4,0x7f261},
+{0x116b5,0x7f281},
+{0x116b6,0x7f2a1},
+{0x116b7,0x36c81},
+{0x116c0,0x380c1},
+{0x116c1,0x382e1},
+{0x116c2,0x3a041},
+{0x116c3,0x3aec1},
+{0x116c4,0x3b641},
+{0x116c5,0x3bc01},
+{0x116c6,0x3bfe1},
+{0x116c7,0x3c301},
+{0x116c8,0x3c681},
+{0x116c9,0x3c9a1},
+{0x11700,0x7f2c1},
+{0x11701,0x7f2e1},
+{0x11702,0x7f301},
+{0x11703,0x7f321},
+{0x11704,0x7f341},
+{0x11705,0x7f362},
+{0x11706,0x7f3a1},
+{0x11707,0x7f3c1},
+{0x11708,0x7f3e1},
+{0x11709,0x7f401},
+{0x1170a,0x7f421},
+{0x1170b,0x7f441},
+{0x1170c,0x7f461},
+{0x1170d,0x7f481},
+{0x1170e,0x7f4a1},
+{0x1170f,0x7f4c1},
+{0x11710,0x7f4e1},
+{0x11711,0x7f501},
+{0x11712,0x7f521},
+{0x11713,0x7f541},
+{0x11714,0x7f561},
+{0x11715,0x7f581},
+{0x11716,0x7f5a2},
+{0x11717,0x7f5e1},
+{0x11718,0x7f601},
+{0x11719,0x7f621},
+{0x1171d,0x7f7c1},
+{0x1171e,0x7f7e1},
+{0x1171f,0x7f801},
+{0x11720,0x7f641},
+{0x11721,0x7f661},
+{0x11722,0x7f681},
+{0x11723,0x7f6a1},
+{0x11724,0x7f6c1},
+{0x11725,0x7f6e1},
+{0x11726,0x7f701},
+{0x11727,0x7f721},
+{0x11728,0x7f741},
+{0x11729,0x7f761},
+{0x1172a,0x7f781},
+{0x1172b,0x7f7a1},
+{0x11730,0x380c1},
+{0x11731,0x382e1},
+{0x11732,0x3a041},
+{0x11733,0x3aec1},
+{0x11734,0x3b641},
+{0x11735,0x3bc01},
+{0x11736,0x3bfe1},
+{0x11737,0x3c301},
+{0x11738,0x3c681},
+{0x11739,0x3c9a1},
+{0x1173a,0x1f3a1},
+{0x1173b,0x1f3c1},
+{0x1173c,0x1f3e1},
+{0x1173d,0x1f401},
+{0x1173e,0x1f421},
+{0x1173f,0x1f441},
+{0x118a0,0xc2881},
+{0x118a1,0xc28c1},
+{0x118a2,0xc2901},
+{0x118a3,0xc2941},
+{0x118a4,0xc2981},
+{0x118a5,0xc29c1},
+{0x118a6,0xc2a01},
+{0x118a7,0xc2a41},
+{0x118a8,0xc2a81},
+{0x118a9,0xc2ac1},
+{0x118aa,0xc2b01},
+{0x118ab,0xc2b41},
+{0x118ac,0xc2b81},
+{0x118ad,0xc2bc1},
+{0x118ae,0xc2c01},
+{0x118af,0xc2c41},
+{0x118b0,0xc2c81},
+{0x118b1,0xc2cc1},
+{0x118b2,0xc2d01},
+{0x118b3,0xc2d41},
+{0x118b4,0xc2d81},
+{0x118b5,0xc2dc1},
+{0x118b6,0xc2e01},
+{0x118b7,0xc2e41},
+{0x118b8,0xc2e81},
+{0x118b9,0xc2ec1},
+{0x118ba,0xc2f01},
+{0x118bb,0xc2f41},
+{0x118bc,0xc2f81},
+{0x118bd,0xc2fc1},
+{0x118be,0xc3001},
+{0x118bf,0xc3041},
+{0x118c0,0xc2861},
+{0x118c1,0xc28a1},
+{0x118c2,0xc28e1},
+{0x118c3,0xc2921},
+{0x118c4,0xc2961},
+{0x118c5,0xc29a1},
+{0x118c6,0xc29e1},
+{0x118c7,0xc2a21},
+{0x118c8,0xc2a61},
+{0x118c9,0xc2aa1},
+{0x118ca,0xc2ae1},
+{0x118cb,0xc2b21},
+{0x118cc,0xc2b61},
+{0x118cd,0xc2ba1},
+{0x118ce,0xc2be1},
+{0x118cf,0xc2c21},
+{0x118d0,0xc2c61},
+{0x118d1,0xc2ca1},
+{0x118d2,0xc2ce1},
+{0x118d3,0xc2d21},
+{0x118d4,0xc2d61},
+{0x118d5,0xc2da1},
+{0x118d6,0xc2de1},
+{0x118d7,0xc2e21},
+{0x118d8,0xc2e61},
+{0x118d9,0xc2ea1},
+{0x118da,0xc2ee1},
+{0x118db,0xc2f21},
+{0x118dc,0xc2f61},
+{0x118dd,0xc2fa1},
+{0x118de,0xc2fe1},
+{0x118df,0xc3021},
+{0x118e0,0x380c1},
+{0x118e1,0x382e1},
+{0x118e2,0x3a041},
+{0x118e3,0x3aec1},
+{0x118e4,0x3b641},
+{0x118e5,0x3bc01},
+{0x118e6,0x3bfe1},
+{0x118e7,0x3c301},
+{0x118e8,0x3c681},
+{0x118e9,0x3c9a1},
+{0x118ea,0x1f461},
+{0x118eb,0x1f481},
+{0x118ec,0x1f4a1},
+{0x118ed,0x1f4c1},
+{0x118ee,0x1f4e1},
+{0x118ef,0x1f501},
+{0x118f0,0x1f521},
+{0x118f1,0x1f541},
+{0x118f2,0x1f561},
+{0x118ff,0xc2841},
+{0x11ac0,0xc3141},
+{0x11ac1,0xc3161},
+{0x11ac2,0xc3181},
+{0x11ac3,0xc31a1},
+{0x11ac4,0xc31c1},
+{0x11ac5,0xc31e1},
+{0x11ac6,0xc3201},
+{0x11ac7,0xc3221},
+{0x11ac8,0xc3241},
+{0x11ac9,0xc3261},
+{0x11aca,0xc3281},
+{0x11acb,0xc32a1},
+{0x11acc,0xc32c1},
+{0x11acd,0xc32e1},
+{0x11ace,0xc3301},
+{0x11acf,0xc3321},
+{0x11ad0,0xc3341},
+{0x11ad1,0xc3361},
+{0x11ad2,0xc3381},
+{0x11ad3,0xc33a1},
+{0x11ad4,0xc33c1},
+{0x11ad5,0xc3061},
+{0x11ad6,0xc3081},
+{0x11ad7,0xc30a1},
+{0x11ad8,0xc30c1},
+{0x11ad9,0xc30e1},
+{0x11ada,0xc3101},
+{0x11adb,0xc3121},
+{0x11adc,0xc33e1},
+{0x11add,0xc3401},
+{0x11ade,0xc34c1},
+{0x11adf,0xc3421},
+{0x11ae0,0xc3441},
+{0x11ae1,0xc3461},
+{0x11ae2,0xc3481},
+{0x11ae3,0xc34a1},
+{0x11ae4,0xc34e1},
+{0x11ae5,0xc35a1},
+{0x11ae6,0xc3561},
+{0x11ae7,0xc3721},
+{0x11ae8,0xc35c1},
+{0x11ae9,0xc3581},
+{0x11aea,0xc3741},
+{0x11aeb,0xc36a1},
+{0x11aec,0xc3661},
+{0x11aed,0xc36c1},
+{0x11aee,0xc3681},
+{0x11aef,0xc3501},
+{0x11af0,0xc3761},
+{0x11af1,0xc3541},
+{0x11af2,0xc3521},
+{0x11af3,0xc3621},
+{0x11af4,0xc35e1},
+{0x11af5,0xc36e1},
+{0x11af6,0xc3641},
+{0x11af7,0xc3601},
+{0x11af8,0xc3701},
+{0x12000,0xd0a41},
+{0x12001,0xd0a61},
+{0x12002,0xd0a81},
+{0x12003,0xd0aa1},
+{0x12004,0xd0ac1},
+{0x12005,0xd0ae1},
+{0x12006,0xd0b01},
+{0x12007,0xd0b21},
+{0x12008,0xd0b41},
+{0x12009,0xd0b61},
+{0x1200a,0xd0b81},
+{0x1200b,0xd0ba1},
+{0x1200c,0xd0bc1},
+{0x1200d,0xd0be1},
+{0x1200e,0xd0c01},
+{0x1200f,0xd0c21},
+{0x12010,0xd0c41},
+{0x12011,0xd0c61},
+{0x12012,0xd0c81},
+{0x12013,0xd0ca1},
+{0x12014,0xd0cc1},
+{0x12015,0xd0ce1},
+{0x12016,0xd0d01},
+{0x12017,0xd0d21},
+{0x12018,0xd0d41},
+{0x12019,0xd0d61},
+{0x1201a,0xd0d81},
+{0x1201b,0xd0da1},
+{0x1201c,0xd0dc1},
+{0x1201d,0xd0de1},
+{0x1201e,0xd0e01},
+{0x1201f,0xd0e21},
+{0x12020,0xd0e41},
+{0x12021,0xd0e61},
+{0x12022,0xd0e81},
+{0x12023,0xd0ea1},
+{0x12024,0xd0ec1},
+{0x12025,0xd0ee1},
+{0x12026,0xd0f01},
+{0x12027,0xd0f21},
+{0x12028,0xd0f41},
+{0x12029,0xd0f61},
+{0x1202a,0xd0f81},
+{0x1202b,0xd0fa1},
+{0x1202c,0xd0fc1},
+{0x1202d,0xd0fe1},
+{0x1202e,0xd1001},
+{0x1202f,0xd1021},
+{0x12030,0xd1041},
+{0x12031,0xd1061},
+{0x12032,0xd1081},
+{0x12033,0xd10a1},
+{0x12034,0xd10c1},
+{0x12035,0xd10e1},
+{0x12036,0xd1101},
+{0x12037,0xd1121},
+{0x12038,0xd1141},
+{0x12039,0xd1161},
+{0x1203a,0xd1181},
+{0x1203b,0xd11a1},
+{0x1203c,0xd11c1},
+{0x1203d,0xd11e1},
+{0x1203e,0xd1201},
+{0x1203f,0xd1221},
+{0x12040,0xd1241},
+{0x12041,0xd1261},
+{0x12042,0xd1281},
+{0x12043,0xd12a1},
+{0x12044,0xd12c1},
+{0x12045,0xd12e1},
+{0x12046,0xd1301},
+{0x12047,0xd1321},
+{0x12048,0xd1341},
+{0x12049,0xd1361},
+{0x1204a,0xd1381},
+{0x1204b,0xd13a1},
+{0x1204c,0xd13c1},
+{0x1204d,0xd13e1},
+{0x1204e,0xd1401},
+{0x1204f,0xd1421},
+{0x12050,0xd1441},
+{0x12051,0xd1461},
+{0x12052,0xd1481},
+{0x12053,0xd14a1},
+{0x12054,0xd14c1},
+{0x12055,0xd14e1},
+{0x12056,0xd1501},
+{0x12057,0xd1521},
+{0x12058,0xd1541},
+{0x12059,0xd1561},
+{0x1205a,0xd1581},
+{0x1205b,0xd15a1},
+{0x1205c,0xd15c1},
+{0x1205d,0xd15e1},
+{0x1205e,0xd1601},
+{0x1205f,0xd1621},
+{0x12060,0xd1641},
+{0x12061,0xd1661},
+{0x12062,0xd1681},
+{0x12063,0xd16a1},
+{0x12064,0xd16c1},
+{0x12065,0xd16e1},
+{0x12066,0xd1701},
+{0x12067,0xd1721},
+{0x12068,0xd1741},
+{0x12069,0xd1761},
+{0x1206a,0xd1781},
+{0x1206b,0xd17a1},
+{0x1206c,0xd17c1},
+{0x1206d,0xd17e1},
+{0x1206e,0xd1801},
+{0x1206f,0xd1821},
+{0x12070,0xd1841},
+{0x12071,0xd1861},
+{0x12072,0xd1881},
+{0x12073,0xd18a1},
+{0x12074,0xd18c1},
+{0x12075,0xd18e1},
+{0x12076,0xd1901},
+{0x12077,0xd1921},
+{0x12078,0xd1941},
+{0x12079,0xd1961},
+{0x1207a,0xd1981},
+{0x1207b,0xd19a1},
+{0x1207c,0xd19c1},
+{0x1207d,0xd19e1},
+{0x1207e,0xd1a01},
+{0x1207f,0xd1a21},
+{0x12080,0xd1a41},
+{0x12081,0xd1a61},
+{0x12082,0xd1a81},
+{0x12083,0xd1aa1},
+{0x12084,0xd1ac1},
+{0x12085,0xd1ae1},
+{0x12086,0xd1b01},
+{0x12087,0xd1b21},
+{0x12088,0xd1b41},
+{0x12089,0xd1b61},
+{0x1208a,0xd1b81},
+{0x1208b,0xd1ba1},
+{0x1208c,0xd1bc1},
+{0x1208d,0xd1be1},
+{0x1208e,0xd1c01},
+{0x1208f,0xd1c21},
+{0x12090,0xd1c41},
+{0x12091,0xd1c61},
+{0x12092,0xd1c81},
+{0x12093,0xd1ca1},
+{0x12094,0xd1cc1},
+{0x12095,0xd1ce1},
+{0x12096,0xd1d01},
+{0x12097,0xd1d21},
+{0x12098,0xd1d41},
+{0x12099,0xd1d61},
+{0x1209a,0xd1d81},
+{0x1209b,0xd1da1},
+{0x1209c,0xd1dc1},
+{0x1209d,0xd1de1},
+{0x1209e,0xd1e01},
+{0x1209f,0xd1e21},
+{0x120a0,0xd1e41},
+{0x120a1,0xd1e61},
+{0x120a2,0xd1e81},
+{0x120a3,0xd1ea1},
+{0x120a4,0xd1ec1},
+{0x120a5,0xd1ee1},
+{0x120a6,0xd1f01},
+{0x120a7,0xd1f21},
+{0x120a8,0xd1f41},
+{0x120a9,0xd1f61},
+{0x120aa,0xd1f81},
+{0x120ab,0xd1fa1},
+{0x120ac,0xd1fc1},
+{0x120ad,0xd1fe1},
+{0x120ae,0xd2001},
+{0x120af,0xd2021},
+{0x120b0,0xd2041},
+{0x120b1,0xd2061},
+{0x120b2,0xd2081},
+{0x120b3,0xd20a1},
+{0x120b4,0xd20c1},
+{0x120b5,0xd20e1},
+{0x120b6,0xd2101},
+{0x120b7,0xd2121},
+{0x120b8,0xd2141},
+{0x120b9,0xd2161},
+{0x120ba,0xd2181},
+{0x120bb,0xd21a1},
+{0x120bc,0xd21c1},
+{0x120bd,0xd21e1},
+{0x120be,0xd2201},
+{0x120bf,0xd2221},
+{0x120c0,0xd2241},
+{0x120c1,0xd2261},
+{0x120c2,0xd2281},
+{0x120c3,0xd22a1},
+{0x120c4,0xd22c1},
+{0x120c5,0xd22e1},
+{0x120c6,0xd2301},
+{0x120c7,0xd2321},
+{0x120c8,0xd2341},
+{0x120c9,0xd2361},
+{0x120ca,0xd2381},
+{0x120cb,0xd23a1},
+{0x120cc,0xd23c1},
+{0x120cd,0xd23e1},
+{0x120ce,0xd2401},
+{0x120cf,0xd2421},
+{0x120d0,0xd2441},
+{0x120d1,0xd2461},
+{0x120d2,0xd2481},
+{0x120d3,0xd24a1},
+{0x120d4,0xd24c1},
+{0x120d5,0xd24e1},
+{0x120d6,0xd2501},
+{0x120d7,0xd2521},
+{0x120d8,0xd2541},
+{0x120d9,0xd2561},
+{0x120da,0xd2581},
+{0x120db,0xd25a1},
+{0x120dc,0xd25c1},
+{0x120dd,0xd25e1},
+{0x120de,0xd2601},
+{0x120df,0xd2621},
+{0x120e0,0xd2641},
+{0x120e1,0xd2661},
+{0x120e2,0xd2681},
+{0x120e3,0xd26a1},
+{0x120e4,0xd26c1},
+{0x120e5,0xd26e1},
+{0x120e6,0xd2701},
+{0x120e7,0xd2721},
+{0x120e8,0xd2741},
+{0x120e9,0xd2761},
+{0x120ea,0xd2781},
+{0x120eb,0xd27a1},
+{0x120ec,0xd27c1},
+{0x120ed,0xd27e1},
+{0x120ee,0xd2801},
+{0x120ef,0xd2821},
+{0x120f0,0xd2841},
+{0x120f1,0xd2861},
+{0x120f2,0xd2881},
+{0x120f3,0xd28a1},
+{0x120f4,0xd28c1},
+{0x120f5,0xd28e1},
+{0x120f6,0xd2901},
+{0x120f7,0xd2921},
+{0x120f8,0xd2941},
+{0x120f9,0xd2961},
+{0x120fa,0xd2981},
+{0x120fb,0xd29a1},
+{0x120fc,0xd29c1},
+{0x120fd,0xd29e1},
+{0x120fe,0xd2a01},
+{0x120ff,0xd2a21},
+{0x12100,0xd2a41},
+{0x12101,0xd2a61},
+{0x12102,0xd2a81},
+{0x12103,0xd2aa1},
+{0x12104,0xd2ac1},
+{0x12105,0xd2ae1},
+{0x12106,0xd2b01},
+{0x12107,0xd2b21},
+{0x12108,0xd2b41},
+{0x12109,0xd2b61},
+{0x1210a,0xd2b81},
+{0x1210b,0xd2ba1},
+{0x1210c,0xd2bc1},
+{0x1210d,0xd2be1},
+{0x1210e,0xd2c01},
+{0x1210f,0xd2c21},
+{0x12110,0xd2c41},
+{0x12111,0xd2c61},
+{0x12112,0xd2c81},
+{0x12113,0xd2ca1},
+{0x12114,0xd2cc1},
+{0x12115,0xd2ce1},
+{0x12116,0xd2d01},
+{0x12117,0xd2d21},
+{0x12118,0xd2d41},
+{0x12119,0xd2d61},
+{0x1211a,0xd2d81},
+{0x1211b,0xd2da1},
+{0x1211c,0xd2dc1},
+{0x1211d,0xd2de1},
+{0x1211e,0xd2e01},
+{0x1211f,0xd2e21},
+{0x12120,0xd2e41},
+{0x12121,0xd2e61},
+{0x12122,0xd2e81},
+{0x12123,0xd2ea1},
+{0x12124,0xd2ec1},
+{0x12125,0xd2ee1},
+{0x12126,0xd2f01},
+{0x12127,0xd2f21},
+{0x12128,0xd2f41},
+{0x12129,0xd2f61},
+{0x1212a,0xd2f81},
+{0x1212b,0xd2fa1},
+{0x1212c,0xd2fc1},
+{0x1212d,0xd2fe1},
+{0x1212e,0xd3001},
+{0x1212f,0xd3021},
+{0x12130,0xd3041},
+{0x12131,0xd3061},
+{0x12132,0xd3081},
+{0x12133,0xd30a1},
+{0x12134,0xd30c1},
+{0x12135,0xd30e1},
+{0x12136,0xd3101},
+{0x12137,0xd3121},
+{0x12138,0xd3141},
+{0x12139,0xd3161},
+{0x1213a,0xd3181},
+{0x1213b,0xd31a1},
+{0x1213c,0xd31c1},
+{0x1213d,0xd31e1},
+{0x1213e,0xd3201},
+{0x1213f,0xd3221},
+{0x12140,0xd3241},
+{0x12141,0xd3261},
+{0x12142,0xd3281},
+{0x12143,0xd32a1},
+{0x12144,0xd32c1},
+{0x12145,0xd32e1},
+{0x12146,0xd3301},
+{0x12147,0xd3321},
+{0x12148,0xd3341},
+{0x12149,0xd3361},
+{0x1214a,0xd3381},
+{0x1214b,0xd33a1},
+{0x1214c,0xd33c1},
+{0x1214d,0xd33e1},
+{0x1214e,0xd3401},
+{0x1214f,0xd3421},
+{0x12150,0xd3441},
+{0x12151,0xd3461},
+{0x12152,0xd3481},
+{0x12153,0xd34a1},
+{0x12154,0xd34c1},
+{0x12155,0xd34e1},
+{0x12156,0xd3501},
+{0x12157,0xd3521},
+{0x12158,0xd3541},
+{0x12159,0xd3561},
+{0x1215a,0xd3581},
+{0x1215b,0xd35a1},
+{0x1215c,0xd35c1},
+{0x1215d,0xd35e1},
+{0x1215e,0xd3601},
+{0x1215f,0xd3621},
+{0x12160,0xd3641},
+{0x12161,0xd3661},
+{0x12162,0xd3681},
+{0x12163,0xd36a1},
+{0x12164,0xd36c1},
+{0x12165,0xd36e1},
+{0x12166,0xd3701},
+{0x12167,0xd3721},
+{0x12168,0xd3741},
+{0x12169,0xd3761},
+{0x1216a,0xd3781},
+{0x1216b,0xd37a1},
+{0x1216c,0xd37c1},
+{0x1216d,0xd37e1},
+{0x1216e,0xd3801},
+{0x1216f,0xd3821},
+{0x12170,0xd3841},
+{0x12171,0xd3861},
+{0x12172,0xd3881},
+{0x12173,0xd38a1},
+{0x12174,0xd38c1},
+{0x12175,0xd38e1},
+{0x12176,0xd3901},
+{0x12177,0xd3921},
+{0x12178,0xd3941},
+{0x12179,0xd3961},
+{0x1217a,0xd3981},
+{0x1217b,0xd39a1},
+{0x1217c,0xd39c1},
+{0x1217d,0xd39e1},
+{0x1217e,0xd3a01},
+{0x1217f,0xd3a21},
+{0x12180,0xd3a41},
+{0x12181,0xd3a61},
+{0x12182,0xd3a81},
+{0x12183,0xd3aa1},
+{0x12184,0xd3ac1},
+{0x12185,0xd3ae1},
+{0x12186,0xd3b01},
+{0x12187,0xd3b21},
+{0x12188,0xd3b41},
+{0x12189,0xd3b61},
+{0x1218a,0xd3b81},
+{0x1218b,0xd3ba1},
+{0x1218c,0xd3bc1},
+{0x1218d,0xd3be1},
+{0x1218e,0xd3c01},
+{0x1218f,0xd3c21},
+{0x12190,0xd3c41},
+{0x12191,0xd3c61},
+{0x12192,0xd3c81},
+{0x12193,0xd3ca1},
+{0x12194,0xd3cc1},
+{0x12195,0xd3ce1},
+{0x12196,0xd3d01},
+{0x12197,0xd3d21},
+{0x12198,0xd3d41},
+{0x12199,0xd3d61},
+{0x1219a,0xd3d81},
+{0x1219b,0xd3da1},
+{0x1219c,0xd3dc1},
+{0x1219d,0xd3de1},
+{0x1219e,0xd3e01},
+{0x1219f,0xd3e21},
+{0x121a0,0xd3e41},
+{0x121a1,0xd3e61},
+{0x121a2,0xd3e81},
+{0x121a3,0xd3ea1},
+{0x121a4,0xd3ec1},
+{0x121a5,0xd3ee1},
+{0x121a6,0xd3f01},
+{0x121a7,0xd3f21},
+{0x121a8,0xd3f41},
+{0x121a9,0xd3f61},
+{0x121aa,0xd3f81},
+{0x121ab,0xd3fa1},
+{0x121ac,0xd3fc1},
+{0x121ad,0xd3fe1},
+{0x121ae,0xd4001},
+{0x121af,0xd4021},
+{0x121b0,0xd4041},
+{0x121b1,0xd4061},
+{0x121b2,0xd4081},
+{0x121b3,0xd40a1},
+{0x121b4,0xd40c1},
+{0x121b5,0xd40e1},
+{0x121b6,0xd4101},
+{0x121b7,0xd4121},
+{0x121b8,0xd4141},
+{0x121b9,0xd4161},
+{0x121ba,0xd4181},
+{0x121bb,0xd41a1},
+{0x121bc,0xd41c1},
+{0x121bd,0xd41e1},
+{0x121be,0xd4201},
+{0x121bf,0xd4221},
+{0x121c0,0xd4241},
+{0x121c1,0xd4261},
+{0x121c2,0xd4281},
+{0x121c3,0xd42a1},
+{0x121c4,0xd42c1},
+{0x121c5,0xd42e1},
+{0x121c6,0xd4301},
+{0x121c7,0xd4321},
+{0x121c8,0xd4341},
+{0x121c9,0xd4361},
+{0x121ca,0xd4381},
+{0x121cb,0xd43a1},
+{0x121cc,0xd43c1},
+{0x121cd,0xd43e1},
+{0x121ce,0xd4401},
+{0x121cf,0xd4421},
+{0x121d0,0xd4441},
+{0x121d1,0xd4461},
+{0x121d2,0xd4481},
+{0x121d3,0xd44a1},
+{0x121d4,0xd44c1},
+{0x121d5,0xd44e1},
+{0x121d6,0xd4501},
+{0x121d7,0xd4521},
+{0x121d8,0xd4541},
+{0x121d9,0xd4561},
+{0x121da,0xd4581},
+{0x121db,0xd45a1},
+{0x121dc,0xd45c1},
+{0x121dd,0xd45e1},
+{0x121de,0xd4601},
+{0x121df,0xd4621},
+{0x121e0,0xd4641},
+{0x121e1,0xd4661},
+{0x121e2,0xd4681},
+{0x121e3,0xd46a1},
+{0x121e4,0xd46c1},
+{0x121e5,0xd46e1},
+{0x121e6,0xd4701},
+{0x121e7,0xd4721},
+{0x121e8,0xd4741},
+{0x121e9,0xd4761},
+{0x121ea,0xd4781},
+{0x121eb,0xd47a1},
+{0x121ec,0xd47c1},
+{0x121ed,0xd47e1},
+{0x121ee,0xd4801},
+{0x121ef,0xd4821},
+{0x121f0,0xd4841},
+{0x121f1,0xd4861},
+{0x121f2,0xd4881},
+{0x121f3,0xd48a1},
+{0x121f4,0xd48c1},
+{0x121f5,0xd48e1},
+{0x121f6,0xd4901},
+{0x121f7,0xd4921},
+{0x121f8,0xd4941},
+{0x121f9,0xd4961},
+{0x121fa,0xd4981},
+{0x121fb,0xd49a1},
+{0x121fc,0xd49c1},
+{0x121fd,0xd49e1},
+{0x121fe,0xd4a01},
+{0x121ff,0xd4a21},
+{0x12200,0xd4a41},
+{0x12201,0xd4a61},
+{0x12202,0xd4a81},
+{0x12203,0xd4aa1},
+{0x12204,0xd4ac1},
+{0x12205,0xd4ae1},
+{0x12206,0xd4b01},
+{0x12207,0xd4b21},
+{0x12208,0xd4b41},
+{0x12209,0xd4b61},
+{0x1220a,0xd4b81},
+{0x1220b,0xd4ba1},
+{0x1220c,0xd4bc1},
+{0x1220d,0xd4be1},
+{0x1220e,0xd4c01},
+{0x1220f,0xd4c21},
+{0x12210,0xd4c41},
+{0x12211,0xd4c61},
+{0x12212,0xd4c81},
+{0x12213,0xd4ca1},
+{0x12214,0xd4cc1},
+{0x12215,0xd4ce1},
+{0x12216,0xd4d01},
+{0x12217,0xd4d21},
+{0x12218,0xd4d41},
+{0x12219,0xd4d61},
+{0x1221a,0xd4d81},
+{0x1221b,0xd4da1},
+{0x1221c,0xd4dc1},
+{0x1221d,0xd4de1},
+{0x1221e,0xd4e01},
+{0x1221f,0xd4e21},
+{0x12220,0xd4e41},
+{0x12221,0xd4e61},
+{0x12222,0xd4e81},
+{0x12223,0xd4ea1},
+{0x12224,0xd4ec1},
+{0x12225,0xd4ee1},
+{0x12226,0xd4f01},
+{0x12227,0xd4f21},
+{0x12228,0xd4f41},
+{0x12229,0xd4f61},
+{0x1222a,0xd4f81},
+{0x1222b,0xd4fa1},
+{0x1222c,0xd4fc1},
+{0x1222d,0xd4fe1},
+{0x1222e,0xd5001},
+{0x1222f,0xd5021},
+{0x12230,0xd5041},
+{0x12231,0xd5061},
+{0x12232,0xd5081},
+{0x12233,0xd50a1},
+{0x12234,0xd50c1},
+{0x12235,0xd50e1},
+{0x12236,0xd5101},
+{0x12237,0xd5121},
+{0x12238,0xd5141},
+{0x12239,0xd5161},
+{0x1223a,0xd5181},
+{0x1223b,0xd51a1},
+{0x1223c,0xd51c1},
+{0x1223d,0xd51e1},
+{0x1223e,0xd5201},
+{0x1223f,0xd5221},
+{0x12240,0xd5241},
+{0x12241,0xd5261},
+{0x12242,0xd5281},
+{0x12243,0xd52a1},
+{0x12244,0xd52c1},
+{0x12245,0xd52e1},
+{0x12246,0xd5301},
+{0x12247,0xd5321},
+{0x12248,0xd5341},
+{0x12249,0xd5361},
+{0x1224a,0xd5381},
+{0x1224b,0xd53a1},
+{0x1224c,0xd53c1},
+{0x1224d,0xd53e1},
+{0x1224e,0xd5401},
+{0x1224f,0xd5421},
+{0x12250,0xd5441},
+{0x12251,0xd5461},
+{0x12252,0xd5481},
+{0x12253,0xd54a1},
+{0x12254,0xd54c1},
+{0x12255,0xd54e1},
+{0x12256,0xd5501},
+{0x12257,0xd5521},
+{0x12258,0xd5541},
+{0x12259,0xd5561},
+{0x1225a,0xd5581},
+{0x1225b,0xd55a1},
+{0x1225c,0xd55c1},
+{0x1225d,0xd55e1},
+{0x1225e,0xd5601},
+{0x1225f,0xd5621},
+{0x12260,0xd5641},
+{0x12261,0xd5661},
+{0x12262,0xd5681},
+{0x12263,0xd56e1},
+{0x12264,0xd5701},
+{0x12265,0xd5721},
+{0x12266,0xd5741},
+{0x12267,0xd5761},
+{0x12268,0xd5781},
+{0x12269,0xd57a1},
+{0x1226a,0xd57c1},
+{0x1226b,0xd57e1},
+{0x1226c,0xd5801},
+{0x1226d,0xd5821},
+{0x1226e,0xd5841},
+{0x1226f,0xd5861},
+{0x12270,0xd5881},
+{0x12271,0xd58a1},
+{0x12272,0xd58c1},
+{0x12273,0xd58e1},
+{0x12274,0xd5901},
+{0x12275,0xd5921},
+{0x12276,0xd5941},
+{0x12277,0xd5961},
+{0x12278,0xd5981},
+{0x12279,0xd59a1},
+{0x1227a,0xd59c1},
+{0x1227b,0xd59e1},
+{0x1227c,0xd5a01},
+{0x1227d,0xd5a21},
+{0x1227e,0xd5a41},
+{0x1227f,0xd5a61},
+{0x12280,0xd5a81},
+{0x12281,0xd5aa1},
+{0x12282,0xd5ac1},
+{0x12283,0xd5ae1},
+{0x12284,0xd5b01},
+{0x12285,0xd5b21},
+{0x12286,0xd5b41},
+{0x12287,0xd5b61},
+{0x12288,0xd5b81},
+{0x12289,0xd5ba1},
+{0x1228a,0xd5bc1},
+{0x1228b,0xd5be1},
+{0x1228c,0xd5c01},
+{0x1228d,0xd5c21},
+{0x1228e,0xd5c41},
+{0x1228f,0xd5c61},
+{0x12290,0xd5c81},
+{0x12291,0xd5ca1},
+{0x12292,0xd5cc1},
+{0x12293,0xd5ce1},
+{0x12294,0xd5d01},
+{0x12295,0xd5d21},
+{0x12296,0xd5d41},
+{0x12297,0xd5d61},
+{0x12298,0xd5d81},
+{0x12299,0xd5da1},
+{0x1229a,0xd5dc1},
+{0x1229b,0xd5de1},
+{0x1229c,0xd5e01},
+{0x1229d,0xd5e21},
+{0x1229e,0xd5e41},
+{0x1229f,0xd5e61},
+{0x122a0,0xd5e81},
+{0x122a1,0xd5ea1},
+{0x122a2,0xd5ec1},
+{0x122a3,0xd5ee1},
+{0x122a4,0xd5f01},
+{0x122a5,0xd5f21},
+{0x122a6,0xd5f41},
+{0x122a7,0xd5f61},
+{0x122a8,0xd5f81},
+{0x122a9,0xd5fa1},
+{0x122aa,0xd5fc1},
+{0x122ab,0xd5fe1},
+{0x122ac,0xd6001},
+{0x122ad,0xd6021},
+{0x122ae,0xd6041},
+{0x122af,0xd6061},
+{0x122b0,0xd6081},
+{0x122b1,0xd60a1},
+{0x122b2,0xd60c1},
+{0x122b3,0xd60e1},
+{0x122b4,0xd6101},
+{0x122b5,0xd6121},
+{0x122b6,0xd6141},
+{0x122b7,0xd6161},
+{0x122b8,0xd6181},
+{0x122b9,0xd61a1},
+{0x122ba,0xd61c1},
+{0x122bb,0xd61e1},
+{0x122bc,0xd6201},
+{0x122bd,0xd6221},
+{0x122be,0xd6241},
+{0x122bf,0xd6261},
+{0x122c0,0xd6281},
+{0x122c1,0xd62a1},
+{0x122c2,0xd62c1},
+{0x122c3,0xd62e1},
+{0x122c4,0xd6301},
+{0x122c5,0xd6321},
+{0x122c6,0xd6341},
+{0x122c7,0xd6361},
+{0x122c8,0xd6381},
+{0x122c9,0xd63a1},
+{0x122ca,0xd63c1},
+{0x122cb,0xd63e1},
+{0x122cc,0xd6401},
+{0x122cd,0xd6421},
+{0x122ce,0xd6441},
+{0x122cf,0xd6461},
+{0x122d0,0xd6481},
+{0x122d1,0xd64a1},
+{0x122d2,0xd64c1},
+{0x122d3,0xd64e1},
+{0x122d4,0xd56a1},
+{0x122d5,0xd56c1},
+{0x122d6,0xd6501},
+{0x122d7,0xd6521},
+{0x122d8,0xd6541},
+{0x122d9,0xd6561},
+{0x122da,0xd6581},
+{0x122db,0xd65a1},
+{0x122dc,0xd65c1},
+{0x122dd,0xd65e1},
+{0x122de,0xd6601},
+{0x122df,0xd6621},
+{0x122e0,0xd6641},
+{0x122e1,0xd6661},
+{0x122e2,0xd6681},
+{0x122e3,0xd66a1},
+{0x122e4,0xd66c1},
+{0x122e5,0xd66e1},
+{0x122e6,0xd6701},
+{0x122e7,0xd6721},
+{0x122e8,0xd6741},
+{0x122e9,0xd6761},
+{0x122ea,0xd6781},
+{0x122eb,0xd67a1},
+{0x122ec,0xd67c1},
+{0x122ed,0xd67e1},
+{0x122ee,0xd6801},
+{0x122ef,0xd6821},
+{0x122f0,0xd6841},
+{0x122f1,0xd6861},
+{0x122f2,0xd6881},
+{0x122f3,0xd68a1},
+{0x122f4,0xd68c1},
+{0x122f5,0xd68e1},
+{0x122f6,0xd6901},
+{0x122f7,0xd6921},
+{0x122f8,0xd6941},
+{0x122f9,0xd6961},
+{0x122fa,0xd6981},
+{0x122fb,0xd69a1},
+{0x122fc,0xd69c1},
+{0x122fd,0xd69e1},
+{0x122fe,0xd6a01},
+{0x122ff,0xd6a21},
+{0x12300,0xd6a41},
+{0x12301,0xd6a61},
+{0x12302,0xd6a81},
+{0x12303,0xd6aa1},
+{0x12304,0xd6ac1},
+{0x12305,0xd6ae1},
+{0x12306,0xd6b01},
+{0x12307,0xd6b21},
+{0x12308,0xd6b41},
+{0x12309,0xd6b61},
+{0x1230a,0xd6b81},
+{0x1230b,0xd6ba1},
+{0x1230c,0xd6bc1},
+{0x1230d,0xd6be1},
+{0x1230e,0xd6c01},
+{0x1230f,0xd6c21},
+{0x12310,0xd6c41},
+{0x12311,0xd6c61},
+{0x12312,0xd6c81},
+{0x12313,0xd6ca1},
+{0x12314,0xd6cc1},
+{0x12315,0xd6ce1},
+{0x12316,0xd6d01},
+{0x12317,0xd6d21},
+{0x12318,0xd6d41},
+{0x12319,0xd6d61},
+{0x1231a,0xd6d81},
+{0x1231b,0xd6da1},
+{0x1231c,0xd6dc1},
+{0x1231d,0xd6de1},
+{0x1231e,0xd6e01},
+{0x1231f,0xd6e21},
+{0x12320,0xd6e41},
+{0x12321,0xd6e61},
+{0x12322,0xd6e81},
+{0x12323,0xd6ea1},
+{0x12324,0xd6ec1},
+{0x12325,0xd6ee1},
+{0x12326,0xd6f01},
+{0x12327,0xd6f21},
+{0x12328,0xd6f41},
+{0x12329,0xd6f61},
+{0x1232a,0xd6f81},
+{0x1232b,0xd6fa1},
+{0x1232c,0xd6fc1},
+{0x1232d,0xd6fe1},
+{0x1232e,0xd7001},
+{0x1232f,0xd7021},
+{0x12330,0xd7041},
+{0x12331,0xd7061},
+{0x12332,0xd7081},
+{0x12333,0xd70a1},
+{0x12334,0xd70c1},
+{0x12335,0xd70e1},
+{0x12336,0xd7101},
+{0x12337,0xd7121},
+{0x12338,0xd7141},
+{0x12339,0xd7161},
+{0x1233a,0xd7181},
+{0x1233b,0xd71a1},
+{0x1233c,0xd71c1},
+{0x1233d,0xd71e1},
+{0x1233e,0xd7201},
+{0x1233f,0xd7221},
+{0x12340,0xd7241},
+{0x12341,0xd7261},
+{0x12342,0xd7281},
+{0x12343,0xd72a1},
+{0x12344,0xd72c1},
+{0x12345,0xd72e1},
+{0x12346,0xd7301},
+{0x12347,0xd7321},
+{0x12348,0xd7341},
+{0x12349,0xd7361},
+{0x1234a,0xd7381},
+{0x1234b,0xd73a1},
+{0x1234c,0xd73c1},
+{0x1234d,0xd73e1},
+{0x1234e,0xd7401},
+{0x1234f,0xd7421},
+{0x12350,0xd7441},
+{0x12351,0xd7461},
+{0x12352,0xd7481},
+{0x12353,0xd74a1},
+{0x12354,0xd74c1},
+{0x12355,0xd74e1},
+{0x12356,0xd7501},
+{0x12357,0xd7521},
+{0x12358,0xd7541},
+{0x12359,0xd7561},
+{0x1235a,0xd7581},
+{0x1235b,0xd75a1},
+{0x1235c,0xd75c1},
+{0x1235d,0xd75e1},
+{0x1235e,0xd7601},
+{0x1235f,0xd7621},
+{0x12360,0xd7641},
+{0x12361,0xd7661},
+{0x12362,0xd7681},
+{0x12363,0xd76a1},
+{0x12364,0xd76c1},
+{0x12365,0xd76e1},
+{0x12366,0xd7701},
+{0x12367,0xd7721},
+{0x12368,0xd7741},
+{0x12369,0xd7761},
+{0x1236a,0xd7781},
+{0x1236b,0xd77a1},
+{0x1236c,0xd77c1},
+{0x1236d,0xd77e1},
+{0x1236e,0xd7801},
+{0x1236f,0xd7821},
+{0x12370,0xd7841},
+{0x12371,0xd7861},
+{0x12372,0xd7881},
+{0x12373,0xd78a1},
+{0x12374,0xd78c1},
+{0x12375,0xd78e1},
+{0x12376,0xd7901},
+{0x12377,0xd7921},
+{0x12378,0xd7941},
+{0x12379,0xd7961},
+{0x1237a,0xd7981},
+{0x1237b,0xd79a1},
+{0x1237c,0xd79c1},
+{0x1237d,0xd79e1},
+{0x1237e,0xd7a01},
+{0x1237f,0xd7a21},
+{0x12380,0xd7a41},
+{0x12381,0xd7a61},
+{0x12382,0xd7a81},
+{0x12383,0xd7aa1},
+{0x12384,0xd7ac1},
+{0x12385,0xd7ae1},
+{0x12386,0xd7b01},
+{0x12387,0xd7b21},
+{0x12388,0xd7b41},
+{0x12389,0xd7b61},
+{0x1238a,0xd7b81},
+{0x1238b,0xd7ba1},
+{0x1238c,0xd7bc1},
+{0x1238d,0xd7be1},
+{0x1238e,0xd7c01},
+{0x1238f,0xd7c21},
+{0x12390,0xd7c41},
+{0x12391,0xd7c61},
+{0x12392,0xd7c81},
+{0x12393,0xd7ca1},
+{0x12394,0xd7cc1},
+{0x12395,0xd7ce1},
+{0x12396,0xd7d01},
+{0x12397,0xd7d21},
+{0x12398,0xd7d41},
+{0x12399,0xd7d61},
+{0x12400,0x3a041},
+{0x12401,0x3aec1},
+{0x12402,0x3b641},
+{0x12403,0x3bc01},
+{0x12404,0x3bfe1},
+{0x12405,0x3c301},
+{0x12406,0x3c681},
+{0x12407,0x3c9a1},
+{0x12408,0x3aec1},
+{0x12409,0x3b641},
+{0x1240a,0x3bc01},
+{0x1240b,0x3bfe1},
+{0x1240c,0x3c301},
+{0x1240d,0x3c681},
+{0x1240e,0x3c9a1},
+{0x1240f,0x3b641},
+{0x12410,0x3bc01},
+{0x12411,0x3bfe1},
+{0x12412,0x3c301},
+{0x12413,0x3c681},
+{0x12414,0x3c9a1},
+{0x12415,0x382e1},
+{0x12416,0x3a041},
+{0x12417,0x3aec1},
+{0x12418,0x3b641},
+{0x12419,0x3bc01},
+{0x1241a,0x3bfe1},
+{0x1241b,0x3c301},
+{0x1241c,0x3c681},
+{0x1241d,0x3c9a1},
+{0x1241e,0x382e1},
+{0x1241f,0x3a041},
+{0x12420,0x3aec1},
+{0x12421,0x3b641},
+{0x12422,0x3bc01},
+{0x12423,0x3a041},
+{0x12424,0x3aec1},
+{0x12425,0x3aec1},
+{0x12426,0x3b641},
+{0x12427,0x3bc01},
+{0x12428,0x3bfe1},
+{0x12429,0x3c301},
+{0x1242a,0x3c681},
+{0x1242b,0x3c9a1},
+{0x1242c,0x382e1},
+{0x1242d,0x3a041},
+{0x1242e,0x3aec1},
+{0x1242f,0x3aec1},
+{0x12430,0x3b641},
+{0x12431,0x3bc01},
+{0x12432,0x1f581},
+{0x12433,0x1f5a1},
+{0x12434,0x382e1},
+{0x12435,0x3a041},
+{0x12436,0x3aec1},
+{0x12437,0x3aec1},
+{0x12438,0x3b641},
+{0x12439,0x3bc01},
+{0x1243a,0x3aec1},
+{0x1243b,0x3aec1},
+{0x1243c,0x3b641},
+{0x1243d,0x3b641},
+{0x1243e,0x3b641},
+{0x1243f,0x3b641},
+{0x12440,0x3bfe1},
+{0x12441,0x3c301},
+{0x12442,0x3c301},
+{0x12443,0x3c301},
+{0x12444,0x3c681},
+{0x12445,0x3c681},
+{0x12446,0x3c9a1},
+{0x12447,0x3c9a1},
+{0x12448,0x3c9a1},
+{0x12449,0x3c9a1},
+{0x1244a,0x3a041},
+{0x1244b,0x3aec1},
+{0x1244c,0x3b641},
+{0x1244d,0x3bc01},
+{0x1244e,0x3bfe1},
+{0x1244f,0x382e1},
+{0x12450,0x3a041},
+{0x12451,0x3aec1},
+{0x12452,0x3b641},
+{0x12453,0x3b641},
+{0x12454,0x3bc01},
+{0x12455,0x3bc01},
+{0x12456,0x3a041},
+{0x12457,0x3aec1},
+{0x12458,0x382e1},
+{0x12459,0x3a041},
+{0x1245a,0x1f5c1},
+{0x1245b,0x1f5e1},
+{0x1245c,0x1f601},
+{0x1245d,0x1f621},
+{0x1245e,0x1f641},
+{0x1245f,0x1f661},
+{0x12460,0x1f681},
+{0x12461,0x1f6a1},
+{0x12462,0x1f6c1},
+{0x12463,0x1f6e1},
+{0x12464,0x1f701},
+{0x12465,0x1f721},
+{0x12466,0x1f741},
+{0x12467,0x1f761},
+{0x12468,0x1f781},
+{0x12469,0x3b641},
+{0x1246a,0x3bc01},
+{0x1246b,0x3bfe1},
+{0x1246c,0x3c301},
+{0x1246d,0x3c681},
+{0x1246e,0x3c9a1},
+{0x12470,0x1f7a1},
+{0x12471,0x1f7c1},
+{0x12472,0x1f7e1},
+{0x12473,0x1f801},
+{0x12474,0x1f821},
+{0x12480,0xd7d81},
+{0x12481,0xd7da1},
+{0x12482,0xd7dc1},
+{0x12483,0xd7de1},
+{0x12484,0xd7e01},
+{0x12485,0xd7e21},
+{0x12486,0xd7e41},
+{0x12487,0xd7e61},
+{0x12488,0xd7e81},
+{0x12489,0xd7ea1},
+{0x1248a,0xd7ec1},
+{0x1248b,0xd7ee1},
+{0x1248c,0xd7f01},
+{0x1248d,0xd7f21},
+{0x1248e,0xd7f41},
+{0x1248f,0xd7f61},
+{0x12490,0xd7f81},
+{0x12491,0xd7fa1},
+{0x12492,0xd7fc1},
+{0x12493,0xd7fe1},
+{0x12494,0xd8001},
+{0x12495,0xd8021},
+{0x12496,0xd8041},
+{0x12497,0xd8061},
+{0x12498,0xd8081},
+{0x12499,0xd80a1},
+{0x1249a,0xd80c1},
+{0x1249b,0xd80e1},
+{0x1249c,0xd8101},
+{0x1249d,0xd8121},
+{0x1249e,0xd8141},
+{0x1249f,0xd8161},
+{0x124a0,0xd8181},
+{0x124a1,0xd81a1},
+{0x124a2,0xd81c1},
+{0x124a3,0xd81e1},
+{0x124a4,0xd8201},
+{0x124a5,0xd8221},
+{0x124a6,0xd8241},
+{0x124a7,0xd8261},
+{0x124a8,0xd8281},
+{0x124a9,0xd82a1},
+{0x124aa,0xd82c1},
+{0x124ab,0xd82e1},
+{0x124ac,0xd8301},
+{0x124ad,0xd8321},
+{0x124ae,0xd8341},
+{0x124af,0xd8361},
+{0x124b0,0xd8381},
+{0x124b1,0xd83a1},
+{0x124b2,0xd83c1},
+{0x124b3,0xd83e1},
+{0x124b4,0xd8401},
+{0x124b5,0xd8421},
+{0x124b6,0xd8441},
+{0x124b7,0xd8461},
+{0x124b8,0xd8481},
+{0x124b9,0xd84a1},
+{0x124ba,0xd84c1},
+{0x124bb,0xd84e1},
+{0x124bc,0xd8501},
+{0x124bd,0xd8521},
+{0x124be,0xd8541},
+{0x124bf,0xd8561},
+{0x124c0,0xd8581},
+{0x124c1,0xd85a1},
+{0x124c2,0xd85c1},
+{0x124c3,0xd85e1},
+{0x124c4,0xd8601},
+{0x124c5,0xd8621},
+{0x124c6,0xd8641},
+{0x124c7,0xd8661},
+{0x124c8,0xd8681},
+{0x124c9,0xd86a1},
+{0x124ca,0xd86c1},
+{0x124cb,0xd86e1},
+{0x124cc,0xd8701},
+{0x124cd,0xd8721},
+{0x124ce,0xd8741},
+{0x124cf,0xd8761},
+{0x124d0,0xd8781},
+{0x124d1,0xd87a1},
+{0x124d2,0xd87c1},
+{0x124d3,0xd87e1},
+{0x124d4,0xd8801},
+{0x124d5,0xd8821},
+{0x124d6,0xd8841},
+{0x124d7,0xd8861},
+{0x124d8,0xd8881},
+{0x124d9,0xd88a1},
+{0x124da,0xd88c1},
+{0x124db,0xd88e1},
+{0x124dc,0xd8901},
+{0x124dd,0xd8921},
+{0x124de,0xd8941},
+{0x124df,0xd8961},
+{0x124e0,0xd8981},
+{0x124e1,0xd89a1},
+{0x124e2,0xd89c1},
+{0x124e3,0xd89e1},
+{0x124e4,0xd8a01},
+{0x124e5,0xd8a21},
+{0x124e6,0xd8a41},
+{0x124e7,0xd8a61},
+{0x124e8,0xd8a81},
+{0x124e9,0xd8aa1},
+{0x124ea,0xd8ac1},
+{0x124eb,0xd8ae1},
+{0x124ec,0xd8b01},
+{0x124ed,0xd8b21},
+{0x124ee,0xd8b41},
+{0x124ef,0xd8b61},
+{0x124f0,0xd8b81},
+{0x124f1,0xd8ba1},
+{0x124f2,0xd8bc1},
+{0x124f3,0xd8be1},
+{0x124f4,0xd8c01},
+{0x124f5,0xd8c21},
+{0x124f6,0xd8c41},
+{0x124f7,0xd8c61},
+{0x124f8,0xd8c81},
+{0x124f9,0xd8ca1},
+{0x124fa,0xd8cc1},
+{0x124fb,0xd8ce1},
+{0x124fc,0xd8d01},
+{0x124fd,0xd8d21},
+{0x124fe,0xd8d41},
+{0x124ff,0xd8d61},
+{0x12500,0xd8d81},
+{0x12501,0xd8da1},
+{0x12502,0xd8dc1},
+{0x12503,0xd8de1},
+{0x12504,0xd8e01},
+{0x12505,0xd8e21},
+{0x12506,0xd8e41},
+{0x12507,0xd8e61},
+{0x12508,0xd8e81},
+{0x12509,0xd8ea1},
+{0x1250a,0xd8ec1},
+{0x1250b,0xd8ee1},
+{0x1250c,0xd8f01},
+{0x1250d,0xd8f21},
+{0x1250e,0xd8f41},
+{0x1250f,0xd8f61},
+{0x12510,0xd8f81},
+{0x12511,0xd8fa1},
+{0x12512,0xd8fc1},
+{0x12513,0xd8fe1},
+{0x12514,0xd9001},
+{0x12515,0xd9021},
+{0x12516,0xd9041},
+{0x12517,0xd9061},
+{0x12518,0xd9081},
+{0x12519,0xd90a1},
+{0x1251a,0xd90c1},
+{0x1251b,0xd90e1},
+{0x1251c,0xd9101},
+{0x1251d,0xd9121},
+{0x1251e,0xd9141},
+{0x1251f,0xd9161},
+{0x12520,0xd9181},
+{0x12521,0xd91a1},
+{0x12522,0xd91c1},
+{0x12523,0xd91e1},
+{0x12524,0xd9201},
+{0x12525,0xd9221},
+{0x12526,0xd9241},
+{0x12527,0xd9261},
+{0x12528,0xd9281},
+{0x12529,0xd92a1},
+{0x1252a,0xd92c1},
+{0x1252b,0xd92e1},
+{0x1252c,0xd9301},
+{0x1252d,0xd9321},
+{0x1252e,0xd9341},
+{0x1252f,0xd9361},
+{0x12530,0xd9381},
+{0x12531,0xd93a1},
+{0x12532,0xd93c1},
+{0x12533,0xd93e1},
+{0x12534,0xd9401},
+{0x12535,0xd9421},
+{0x12536,0xd9441},
+{0x12537,0xd9461},
+{0x12538,0xd9481},
+{0x12539,0xd94a1},
+{0x1253a,0xd94c1},
+{0x1253b,0xd94e1},
+{0x1253c,0xd9501},
+{0x1253d,0xd9521},
+{0x1253e,0xd9541},
+{0x1253f,0xd9561},
+{0x12540,0xd9581},
+{0x12541,0xd95a1},
+{0x12542,0xd95c1},
+{0x12543,0xd95e1},
+{0x13000,0xd9601},
+{0x13001,0xd9621},
+{0x13002,0xd9641},
+{0x13003,0xd9661},
+{0x13004,0xd9681},
+{0x13005,0xd96a1},
+{0x13006,0xd96c1},
+{0x13007,0xd96e1},
+{0x13008,0xd9701},
+{0x13009,0xd9721},
+{0x1300a,0xd9741},
+{0x1300b,0xd9761},
+{0x1300c,0xd9781},
+{0x1300d,0xd97a1},
+{0x1300e,0xd97c1},
+{0x1300f,0xd97e1},
+{0x13010,0xd9801},
+{0x13011,0xd9821},
+{0x13012,0xd9841},
+{0x13013,0xd9861},
+{0x13014,0xd9881},
+{0x13015,0xd98a1},
+{0x13016,0xd98c1},
+{0x13017,0xd98e1},
+{0x13018,0xd9901},
+{0x13019,0xd9921},
+{0x1301a,0xd9941},
+{0x1301b,0xd9961},
+{0x1301c,0xd9981},
+{0x1301d,0xd99a1},
+{0x1301e,0xd99c1},
+{0x1301f,0xd99e1},
+{0x13020,0xd9a01},
+{0x13021,0xd9a21},
+{0x13022,0xd9a41},
+{0x13023,0xd9a61},
+{0x13024,0xd9a81},
+{0x13025,0xd9aa1},
+{0x13026,0xd9ac1},
+{0x13027,0xd9ae1},
+{0x13028,0xd9b01},
+{0x13029,0xd9b21},
+{0x1302a,0xd9b41},
+{0x1302b,0xd9b61},
+{0x1302c,0xd9b81},
+{0x1302d,0xd9ba1},
+{0x1302e,0xd9bc1},
+{0x1302f,0xd9be1},
+{0x13030,0xd9c01},
+{0x13031,0xd9c21},
+{0x13032,0xd9c41},
+{0x13033,0xd9c61},
+{0x13034,0xd9c81},
+{0x13035,0xd9ca1},
+{0x13036,0xd9cc1},
+{0x13037,0xd9ce1},
+{0x13038,0xd9d01},
+{0x13039,0xd9d21},
+{0x1303a,0xd9d41},
+{0x1303b,0xd9d61},
+{0x1303c,0xd9d81},
+{0x1303d,0xd9da1},
+{0x1303e,0xd9dc1},
+{0x1303f,0xd9de1},
+{0x13040,0xd9e01},
+{0x13041,0xd9e21},
+{0x13042,0xd9e41},
+{0x13043,0xd9e61},
+{0x13044,0xd9e81},
+{0x13045,0xd9ea1},
+{0x13046,0xd9ec1},
+{0x13047,0xd9ee1},
+{0x13048,0xd9f01},
+{0x13049,0xd9f21},
+{0x1304a,0xd9f41},
+{0x1304b,0xd9f61},
+{0x1304c,0xd9f81},
+{0x1304d,0xd9fa1},
+{0x1304e,0xd9fc1},
+{0x1304f,0xd9fe1},
+{0x13050,0xda001},
+{0x13051,0xda021},
+{0x13052,0xda041},
+{0x13053,0xda061},
+{0x13054,0xda081},
+{0x13055,0xda0a1},
+{0x13056,0xda0c1},
+{0x13057,0xda0e1},
+{0x13058,0xda101},
+{0x13059,0xda121},
+{0x1305a,0xda141},
+{0x1305b,0xda161},
+{0x1305c,0xda181},
+{0x1305d,0xda1a1},
+{0x1305e,0xda1c1},
+{0x1305f,0xda1e1},
+{0x13060,0xda201},
+{0x13061,0xda221},
+{0x13062,0xda241},
+{0x13063,0xda261},
+{0x13064,0xda281},
+{0x13065,0xda2a1},
+{0x13066,0xda2c1},
+{0x13067,0xda2e1},
+{0x13068,0xda301},
+{0x13069,0xda321},
+{0x1306a,0xda341},
+{0x1306b,0xda361},
+{0x1306c,0xda381},
+{0x1306d,0xda3a1},
+{0x1306e,0xda3c1},
+{0x1306f,0xda3e1},
+{0x13070,0xda401},
+{0x13071,0xda421},
+{0x13072,0xda441},
+{0x13073,0xda461},
+{0x13074,0xda481},
+{0x13075,0xda4a1},
+{0x13076,0xda4c1},
+{0x13077,0xda4e1},
+{0x13078,0xda501},
+{0x13079,0xda521},
+{0x1307a,0xda541},
+{0x1307b,0xda561},
+{0x1307c,0xda581},
+{0x1307d,0xda5a1},
+{0x1307e,0xda5c1},
+{0x1307f,0xda5e1},
+{0x13080,0xda601},
+{0x13081,0xda621},
+{0x13082,0xda641},
+{0x13083,0xda661},
+{0x13084,0xda681},
+{0x13085,0xda6a1},
+{0x13086,0xda6c1},
+{0x13087,0xda6e1},
+{0x13088,0xda701},
+{0x13089,0xda721},
+{0x1308a,0xda741},
+{0x1308b,0xda761},
+{0x1308c,0xda781},
+{0x1308d,0xda7a1},
+{0x1308e,0xda7c1},
+{0x1308f,0xda7e1},
+{0x13090,0xda801},
+{0x13091,0xda821},
+{0x13092,0xda841},
+{0x13093,0xda861},
+{0x13094,0xda881},
+{0x13095,0xda8a1},
+{0x13096,0xda8c1},
+{0x13097,0xda8e1},
+{0x13098,0xda901},
+{0x13099,0xda921},
+{0x1309a,0xda941},
+{0x1309b,0xda961},
+{0x1309c,0xda981},
+{0x1309d,0xda9a1},
+{0x1309e,0xda9c1},
+{0x1309f,0xda9e1},
+{0x130a0,0xdaa01},
+{0x130a1,0xdaa21},
+{0x130a2,0xdaa41},
+{0x130a3,0xdaa61},
+{0x130a4,0xdaa81},
+{0x130a5,0xdaaa1},
+{0x130a6,0xdaac1},
+{0x130a7,0xdaae1},
+{0x130a8,0xdab01},
+{0x130a9,0xdab21},
+{0x130aa,0xdab41},
+{0x130ab,0xdab61},
+{0x130ac,0xdab81},
+{0x130ad,0xdaba1},
+{0x130ae,0xdabc1},
+{0x130af,0xdabe1},
+{0x130b0,0xdac01},
+{0x130b1,0xdac21},
+{0x130b2,0xdac41},
+{0x130b3,0xdac61},
+{0x130b4,0xdac81},
+{0x130b5,0xdaca1},
+{0x130b6,0xdacc1},
+{0x130b7,0xdace1},
+{0x130b8,0xdad01},
+{0x130b9,0xdad21},
+{0x130ba,0xdad41},
+{0x130bb,0xdad61},
+{0x130bc,0xdad81},
+{0x130bd,0xdada1},
+{0x130be,0xdadc1},
+{0x130bf,0xdade1},
+{0x130c0,0xdae01},
+{0x130c1,0xdae21},
+{0x130c2,0xdae41},
+{0x130c3,0xdae61},
+{0x130c4,0xdae81},
+{0x130c5,0xdaea1},
+{0x130c6,0xdaec1},
+{0x130c7,0xdaee1},
+{0x130c8,0xdaf01},
+{0x130c9,0xdaf21},
+{0x130ca,0xdaf41},
+{0x130cb,0xdaf61},
+{0x130cc,0xdaf81},
+{0x130cd,0xdafa1},
+{0x130ce,0xdafc1},
+{0x130cf,0xdafe1},
+{0x130d0,0xdb001},
+{0x130d1,0xdb021},
+{0x130d2,0xdb041},
+{0x130d3,0xdb061},
+{0x130d4,0xdb081},
+{0x130d5,0xdb0a1},
+{0x130d6,0xdb0c1},
+{0x130d7,0xdb0e1},
+{0x130d8,0xdb101},
+{0x130d9,0xdb121},
+{0x130da,0xdb141},
+{0x130db,0xdb161},
+{0x130dc,0xdb181},
+{0x130dd,0xdb1a1},
+{0x130de,0xdb1c1},
+{0x130df,0xdb1e1},
+{0x130e0,0xdb201},
+{0x130e1,0xdb221},
+{0x130e2,0xdb241},
+{0x130e3,0xdb261},
+{0x130e4,0xdb281},
+{0x130e5,0xdb2a1},
+{0x130e6,0xdb2c1},
+{0x130e7,0xdb2e1},
+{0x130e8,0xdb301},
+{0x130e9,0xdb321},
+{0x130ea,0xdb341},
+{0x130eb,0xdb361},
+{0x130ec,0xdb381},
+{0x130ed,0xdb3a1},
+{0x130ee,0xdb3c1},
+{0x130ef,0xdb3e1},
+{0x130f0,0xdb401},
+{0x130f1,0xdb421},
+{0x130f2,0xdb441},
+{0x130f3,0xdb461},
+{0x130f4,0xdb481},
+{0x130f5,0xdb4a1},
+{0x130f6,0xdb4c1},
+{0x130f7,0xdb4e1},
+{0x130f8,0xdb501},
+{0x130f9,0xdb521},
+{0x130fa,0xdb541},
+{0x130fb,0xdb561},
+{0x130fc,0xdb581},
+{0x130fd,0xdb5a1},
+{0x130fe,0xdb5c1},
+{0x130ff,0xdb5e1},
+{0x13100,0xdb601},
+{0x13101,0xdb621},
+{0x13102,0xdb641},
+{0x13103,0xdb661},
+{0x13104,0xdb681},
+{0x13105,0xdb6a1},
+{0x13106,0xdb6c1},
+{0x13107,0xdb6e1},
+{0x13108,0xdb701},
+{0x13109,0xdb721},
+{0x1310a,0xdb741},
+{0x1310b,0xdb761},
+{0x1310c,0xdb781},
+{0x1310d,0xdb7a1},
+{0x1310e,0xdb7c1},
+{0x1310f,0xdb7e1},
+{0x13110,0xdb801},
+{0x13111,0xdb821},
+{0x13112,0xdb841},
+{0x13113,0xdb861},
+{0x13114,0xdb881},
+{0x13115,0xdb8a1},
+{0x13116,0xdb8c1},
+{0x13117,0xdb8e1},
+{0x13118,0xdb901},
+{0x13119,0xdb921},
+{0x1311a,0xdb941},
+{0x1311b,0xdb961},
+{0x1311c,0xdb981},
+{0x1311d,0xdb9a1},
+{0x1311e,0xdb9c1},
+{0x1311f,0xdb9e1},
+{0x13120,0xdba01},
+{0x13121,0xdba21},
+{0x13122,0xdba41},
+{0x13123,0xdba61},
+{0x13124,0xdba81},
+{0x13125,0xdbaa1},
+{0x13126,0xdbac1},
+{0x13127,0xdbae1},
+{0x13128,0xdbb01},
+{0x13129,0xdbb21},
+{0x1312a,0xdbb41},
+{0x1312b,0xdbb61},
+{0x1312c,0xdbb81},
+{0x1312d,0xdbba1},
+{0x1312e,0xdbbc1},
+{0x1312f,0xdbbe1},
+{0x13130,0xdbc01},
+{0x13131,0xdbc21},
+{0x13132,0xdbc41},
+{0x13133,0xdbc61},
+{0x13134,0xdbc81},
+{0x13135,0xdbca1},
+{0x13136,0xdbcc1},
+{0x13137,0xdbce1},
+{0x13138,0xdbd01},
+{0x13139,0xdbd21},
+{0x1313a,0xdbd41},
+{0x1313b,0xdbd61},
+{0x1313c,0xdbd81},
+{0x1313d,0xdbda1},
+{0x1313e,0xdbdc1},
+{0x1313f,0xdbde1},
+{0x13140,0xdbe01},
+{0x13141,0xdbe21},
+{0x13142,0xdbe41},
+{0x13143,0xdbe61},
+{0x13144,0xdbe81},
+{0x13145,0xdbea1},
+{0x13146,0xdbec1},
+{0x13147,0xdbee1},
+{0x13148,0xdbf01},
+{0x13149,0xdbf21},
+{0x1314a,0xdbf41},
+{0x1314b,0xdbf61},
+{0x1314c,0xdbf81},
+{0x1314d,0xdbfa1},
+{0x1314e,0xdbfc1},
+{0x1314f,0xdbfe1},
+{0x13150,0xdc001},
+{0x13151,0xdc021},
+{0x13152,0xdc041},
+{0x13153,0xdc061},
+{0x13154,0xdc081},
+{0x13155,0xdc0a1},
+{0x13156,0xdc0c1},
+{0x13157,0xdc0e1},
+{0x13158,0xdc101},
+{0x13159,0xdc121},
+{0x1315a,0xdc141},
+{0x1315b,0xdc161},
+{0x1315c,0xdc181},
+{0x1315d,0xdc1a1},
+{0x1315e,0xdc1c1},
+{0x1315f,0xdc1e1},
+{0x13160,0xdc201},
+{0x13161,0xdc221},
+{0x13162,0xdc241},
+{0x13163,0xdc261},
+{0x13164,0xdc281},
+{0x13165,0xdc2a1},
+{0x13166,0xdc2c1},
+{0x13167,0xdc2e1},
+{0x13168,0xdc301},
+{0x13169,0xdc321},
+{0x1316a,0xdc341},
+{0x1316b,0xdc361},
+{0x1316c,0xdc381},
+{0x1316d,0xdc3a1},
+{0x1316e,0xdc3c1},
+{0x1316f,0xdc3e1},
+{0x13170,0xdc401},
+{0x13171,0xdc421},
+{0x13172,0xdc441},
+{0x13173,0xdc461},
+{0x13174,0xdc481},
+{0x13175,0xdc4a1},
+{0x13176,0xdc4c1},
+{0x13177,0xdc4e1},
+{0x13178,0xdc501},
+{0x13179,0xdc521},
+{0x1317a,0xdc541},
+{0x1317b,0xdc561},
+{0x1317c,0xdc581},
+{0x1317d,0xdc5a1},
+{0x1317e,0xdc5c1},
+{0x1317f,0xdc5e1},
+{0x13180,0xdc601},
+{0x13181,0xdc621},
+{0x13182,0xdc641},
+{0x13183,0xdc661},
+{0x13184,0xdc681},
+{0x13185,0xdc6a1},
+{0x13186,0xdc6c1},
+{0x13187,0xdc6e1},
+{0x13188,0xdc701},
+{0x13189,0xdc721},
+{0x1318a,0xdc741},
+{0x1318b,0xdc761},
+{0x1318c,0xdc781},
+{0x1318d,0xdc7a1},
+{0x1318e,0xdc7c1},
+{0x1318f,0xdc7e1},
+{0x13190,0xdc801},
+{0x13191,0xdc821},
+{0x13192,0xdc841},
+{0x13193,0xdc861},
+{0x13194,0xdc881},
+{0x13195,0xdc8a1},
+{0x13196,0xdc8c1},
+{0x13197,0xdc8e1},
+{0x13198,0xdc901},
+{0x13199,0xdc921},
+{0x1319a,0xdc941},
+{0x1319b,0xdc961},
+{0x1319c,0xdc981},
+{0x1319d,0xdc9a1},
+{0x1319e,0xdc9c1},
+{0x1319f,0xdc9e1},
+{0x131a0,0xdca01},
+{0x131a1,0xdca21},
+{0x131a2,0xdca41},
+{0x131a3,0xdca61},
+{0x131a4,0xdca81},
+{0x131a5,0xdcaa1},
+{0x131a6,0xdcac1},
+{0x131a7,0xdcae1},
+{0x131a8,0xdcb01},
+{0x131a9,0xdcb21},
+{0x131aa,0xdcb41},
+{0x131ab,0xdcb61},
+{0x131ac,0xdcb81},
+{0x131ad,0xdcba1},
+{0x131ae,0xdcbc1},
+{0x131af,0xdcbe1},
+{0x131b0,0xdcc01},
+{0x131b1,0xdcc21},
+{0x131b2,0xdcc41},
+{0x131b3,0xdcc61},
+{0x131b4,0xdcc81},
+{0x131b5,0xdcca1},
+{0x131b6,0xdccc1},
+{0x131b7,0xdcce1},
+{0x131b8,0xdcd01},
+{0x131b9,0xdcd21},
+{0x131ba,0xdcd41},
+{0x131bb,0xdcd61},
+{0x131bc,0xdcd81},
+{0x131bd,0xdcda1},
+{0x131be,0xdcdc1},
+{0x131bf,0xdcde1},
+{0x131c0,0xdce01},
+{0x131c1,0xdce21},
+{0x131c2,0xdce41},
+{0x131c3,0xdce61},
+{0x131c4,0xdce81},
+{0x131c5,0xdcea1},
+{0x131c6,0xdcec1},
+{0x131c7,0xdcee1},
+{0x131c8,0xdcf01},
+{0x131c9,0xdcf21},
+{0x131ca,0xdcf41},
+{0x131cb,0xdcf61},
+{0x131cc,0xdcf81},
+{0x131cd,0xdcfa1},
+{0x131ce,0xdcfc1},
+{0x131cf,0xdcfe1},
+{0x131d0,0xdd001},
+{0x131d1,0xdd021},
+{0x131d2,0xdd041},
+{0x131d3,0xdd061},
+{0x131d4,0xdd081},
+{0x131d5,0xdd0a1},
+{0x131d6,0xdd0c1},
+{0x131d7,0xdd0e1},
+{0x131d8,0xdd101},
+{0x131d9,0xdd121},
+{0x131da,0xdd141},
+{0x131db,0xdd161},
+{0x131dc,0xdd181},
+{0x131dd,0xdd1a1},
+{0x131de,0xdd1c1},
+{0x131df,0xdd1e1},
+{0x131e0,0xdd201},
+{0x131e1,0xdd221},
+{0x131e2,0xdd241},
+{0x131e3,0xdd261},
+{0x131e4,0xdd281},
+{0x131e5,0xdd2a1},
+{0x131e6,0xdd2c1},
+{0x131e7,0xdd2e1},
+{0x131e8,0xdd301},
+{0x131e9,0xdd321},
+{0x131ea,0xdd341},
+{0x131eb,0xdd361},
+{0x131ec,0xdd381},
+{0x131ed,0xdd3a1},
+{0x131ee,0xdd3c1},
+{0x131ef,0xdd3e1},
+{0x131f0,0xdd401},
+{0x131f1,0xdd421},
+{0x131f2,0xdd441},
+{0x131f3,0xdd461},
+{0x131f4,0xdd481},
+{0x131f5,0xdd4a1},
+{0x131f6,0xdd4c1},
+{0x131f7,0xdd4e1},
+{0x131f8,0xdd501},
+{0x131f9,0xdd521},
+{0x131fa,0xdd541},
+{0x131fb,0xdd561},
+{0x131fc,0xdd581},
+{0x131fd,0xdd5a1},
+{0x131fe,0xdd5c1},
+{0x131ff,0xdd5e1},
+{0x13200,0xdd601},
+{0x13201,0xdd621},
+{0x13202,0xdd641},
+{0x13203,0xdd661},
+{0x13204,0xdd681},
+{0x13205,0xdd6a1},
+{0x13206,0xdd6c1},
+{0x13207,0xdd6e1},
+{0x13208,0xdd701},
+{0x13209,0xdd721},
+{0x1320a,0xdd741},
+{0x1320b,0xdd761},
+{0x1320c,0xdd781},
+{0x1320d,0xdd7a1},
+{0x1320e,0xdd7c1},
+{0x1320f,0xdd7e1},
+{0x13210,0xdd801},
+{0x13211,0xdd821},
+{0x13212,0xdd841},
+{0x13213,0xdd861},
+{0x13214,0xdd881},
+{0x13215,0xdd8a1},
+{0x13216,0xdd8c1},
+{0x13217,0xdd8e1},
+{0x13218,0xdd901},
+{0x13219,0xdd921},
+{0x1321a,0xdd941},
+{0x1321b,0xdd961},
+{0x1321c,0xdd981},
+{0x1321d,0xdd9a1},
+{0x1321e,0xdd9c1},
+{0x1321f,0xdd9e1},
+{0x13220,0xdda01},
+{0x13221,0xdda21},
+{0x13222,0xdda41},
+{0x13223,0xdda61},
+{0x13224,0xdda81},
+{0x13225,0xddaa1},
+{0x13226,0xddac1},
+{0x13227,0xddae1},
+{0x13228,0xddb01},
+{0x13229,0xddb21},
+{0x1322a,0xddb41},
+{0x1322b,0xddb61},
+{0x1322c,0xddb81},
+{0x1322d,0xddba1},
+{0x1322e,0xddbc1},
+{0x1322f,0xddbe1},
+{0x13230,0xddc01},
+{0x13231,0xddc21},
+{0x13232,0xddc41},
+{0x13233,0xddc61},
+{0x13234,0xddc81},
+{0x13235,0xddca1},
+{0x13236,0xddcc1},
+{0x13237,0xddce1},
+{0x13238,0xddd01},
+{0x13239,0xddd21},
+{0x1323a,0xddd41},
+{0x1323b,0xddd61},
+{0x1323c,0xddd81},
+{0x1323d,0xddda1},
+{0x1323e,0xdddc1},
+{0x1323f,0xddde1},
+{0x13240,0xdde01},
+{0x13241,0xdde21},
+{0x13242,0xdde41},
+{0x13243,0xdde61},
+{0x13244,0xdde81},
+{0x13245,0xddea1},
+{0x13246,0xddec1},
+{0x13247,0xddee1},
+{0x13248,0xddf01},
+{0x13249,0xddf21},
+{0x1324a,0xddf41},
+{0x1324b,0xddf61},
+{0x1324c,0xddf81},
+{0x1324d,0xddfa1},
+{0x1324e,0xddfc1},
+{0x1324f,0xddfe1},
+{0x13250,0xde001},
+{0x13251,0xde021},
+{0x13252,0xde041},
+{0x13253,0xde061},
+{0x13254,0xde081},
+{0x13255,0xde0a1},
+{0x13256,0xde0c1},
+{0x13257,0xde0e1},
+{0x13258,0xde101},
+{0x13259,0xde121},
+{0x1325a,0xde141},
+{0x1325b,0xde161},
+{0x1325c,0xde181},
+{0x1325d,0xde1a1},
+{0x1325e,0xde1c1},
+{0x1325f,0xde1e1},
+{0x13260,0xde201},
+{0x13261,0xde221},
+{0x13262,0xde241},
+{0x13263,0xde261},
+{0x13264,0xde281},
+{0x13265,0xde2a1},
+{0x13266,0xde2c1},
+{0x13267,0xde2e1},
+{0x13268,0xde301},
+{0x13269,0xde321},
+{0x1326a,0xde341},
+{0x1326b,0xde361},
+{0x1326c,0xde381},
+{0x1326d,0xde3a1},
+{0x1326e,0xde3c1},
+{0x1326f,0xde3e1},
+{0x13270,0xde401},
+{0x13271,0xde421},
+{0x13272,0xde441},
+{0x13273,0xde461},
+{0x13274,0xde481},
+{0x13275,0xde4a1},
+{0x13276,0xde4c1},
+{0x13277,0xde4e1},
+{0x13278,0xde501},
+{0x13279,0xde521},
+{0x1327a,0xde541},
+{0x1327b,0xde561},
+{0x1327c,0xde581},
+{0x1327d,0xde5a1},
+{0x1327e,0xde5c1},
+{0x1327f,0xde5e1},
+{0x13280,0xde601},
+{0x13281,0xde621},
+{0x13282,0xde641},
+{0x13283,0xde661},
+{0x13284,0xde681},
+{0x13285,0xde6a1},
+{0x13286,0xde6c1},
+{0x13287,0xde6e1},
+{0x13288,0xde701},
+{0x13289,0xde721},
+{0x1328a,0xde741},
+{0x1328b,0xde761},
+{0x1328c,0xde781},
+{0x1328d,0xde7a1},
+{0x1328e,0xde7c1},
+{0x1328f,0xde7e1},
+{0x13290,0xde801},
+{0x13291,0xde821},
+{0x13292,0xde841},
+{0x13293,0xde861},
+{0x13294,0xde881},
+{0x13295,0xde8a1},
+{0x13296,0xde8c1},
+{0x13297,0xde8e1},
+{0x13298,0xde901},
+{0x13299,0xde921},
+{0x1329a,0xde941},
+{0x1329b,0xde961},
+{0x1329c,0xde981},
+{0x1329d,0xde9a1},
+{0x1329e,0xde9c1},
+{0x1329f,0xde9e1},
+{0x132a0,0xdea01},
+{0x132a1,0xdea21},
+{0x132a2,0xdea41},
+{0x132a3,0xdea61},
+{0x132a4,0xdea81},
+{0x132a5,0xdeaa1},
+{0x132a6,0xdeac1},
+{0x132a7,0xdeae1},
+{0x132a8,0xdeb01},
+{0x132a9,0xdeb21},
+{0x132aa,0xdeb41},
+{0x132ab,0xdeb61},
+{0x132ac,0xdeb81},
+{0x132ad,0xdeba1},
+{0x132ae,0xdebc1},
+{0x132af,0xdebe1},
+{0x132b0,0xdec01},
+{0x132b1,0xdec21},
+{0x132b2,0xdec41},
+{0x132b3,0xdec61},
+{0x132b4,0xdec81},
+{0x132b5,0xdeca1},
+{0x132b6,0xdecc1},
+{0x132b7,0xdece1},
+{0x132b8,0xded01},
+{0x132b9,0xded21},
+{0x132ba,0xded41},
+{0x132bb,0xded61},
+{0x132bc,0xded81},
+{0x132bd,0xdeda1},
+{0x132be,0xdedc1},
+{0x132bf,0xdede1},
+{0x132c0,0xdee01},
+{0x132c1,0xdee21},
+{0x132c2,0xdee41},
+{0x132c3,0xdee61},
+{0x132c4,0xdee81},
+{0x132c5,0xdeea1},
+{0x132c6,0xdeec1},
+{0x132c7,0xdeee1},
+{0x132c8,0xdef01},
+{0x132c9,0xdef21},
+{0x132ca,0xdef41},
+{0x132cb,0xdef61},
+{0x132cc,0xdef81},
+{0x132cd,0xdefa1},
+{0x132ce,0xdefc1},
+{0x132cf,0xdefe1},
+{0x132d0,0xdf001},
+{0x132d1,0xdf021},
+{0x132d2,0xdf041},
+{0x132d3,0xdf061},
+{0x132d4,0xdf081},
+{0x132d5,0xdf0a1},
+{0x132d6,0xdf0c1},
+{0x132d7,0xdf0e1},
+{0x132d8,0xdf101},
+{0x132d9,0xdf121},
+{0x132da,0xdf141},
+{0x132db,0xdf161},
+{0x132dc,0xdf181},
+{0x132dd,0xdf1a1},
+{0x132de,0xdf1c1},
+{0x132df,0xdf1e1},
+{0x132e0,0xdf201},
+{0x132e1,0xdf221},
+{0x132e2,0xdf241},
+{0x132e3,0xdf261},
+{0x132e4,0xdf281},
+{0x132e5,0xdf2a1},
+{0x132e6,0xdf2c1},
+{0x132e7,0xdf2e1},
+{0x132e8,0xdf301},
+{0x132e9,0xdf321},
+{0x132ea,0xdf341},
+{0x132eb,0xdf361},
+{0x132ec,0xdf381},
+{0x132ed,0xdf3a1},
+{0x132ee,0xdf3c1},
+{0x132ef,0xdf3e1},
+{0x132f0,0xdf401},
+{0x132f1,0xdf421},
+{0x132f2,0xdf441},
+{0x132f3,0xdf461},
+{0x132f4,0xdf481},
+{0x132f5,0xdf4a1},
+{0x132f6,0xdf4c1},
+{0x132f7,0xdf4e1},
+{0x132f8,0xdf501},
+{0x132f9,0xdf521},
+{0x132fa,0xdf541},
+{0x132fb,0xdf561},
+{0x132fc,0xdf581},
+{0x132fd,0xdf5a1},
+{0x132fe,0xdf5c1},
+{0x132ff,0xdf5e1},
+{0x13300,0xdf601},
+{0x13301,0xdf621},
+{0x13302,0xdf641},
+{0x13303,0xdf661},
+{0x13304,0xdf681},
+{0x13305,0xdf6a1},
+{0x13306,0xdf6c1},
+{0x13307,0xdf6e1},
+{0x13308,0xdf701},
+{0x13309,0xdf721},
+{0x1330a,0xdf741},
+{0x1330b,0xdf761},
+{0x1330c,0xdf781},
+{0x1330d,0xdf7a1},
+{0x1330e,0xdf7c1},
+{0x1330f,0xdf7e1},
+{0x13310,0xdf801},
+{0x13311,0xdf821},
+{0x13312,0xdf841},
+{0x13313,0xdf861},
+{0x13314,0xdf881},
+{0x13315,0xdf8a1},
+{0x13316,0xdf8c1},
+{0x13317,0xdf8e1},
+{0x13318,0xdf901},
+{0x13319,0xdf921},
+{0x1331a,0xdf941},
+{0x1331b,0xdf961},
+{0x1331c,0xdf981},
+{0x1331d,0xdf9a1},
+{0x1331e,0xdf9c1},
+{0x1331f,0xdf9e1},
+{0x13320,0xdfa01},
+{0x13321,0xdfa21},
+{0x13322,0xdfa41},
+{0x13323,0xdfa61},
+{0x13324,0xdfa81},
+{0x13325,0xdfaa1},
+{0x13326,0xdfac1},
+{0x13327,0xdfae1},
+{0x13328,0xdfb01},
+{0x13329,0xdfb21},
+{0x1332a,0xdfb41},
+{0x1332b,0xdfb61},
+{0x1332c,0xdfb81},
+{0x1332d,0xdfba1},
+{0x1332e,0xdfbc1},
+{0x1332f,0xdfbe1},
+{0x13330,0xdfc01},
+{0x13331,0xdfc21},
+{0x13332,0xdfc41},
+{0x13333,0xdfc61},
+{0x13334,0xdfc81},
+{0x13335,0xdfca1},
+{0x13336,0xdfcc1},
+{0x13337,0xdfce1},
+{0x13338,0xdfd01},
+{0x13339,0xdfd21},
+{0x1333a,0xdfd41},
+{0x1333b,0xdfd61},
+{0x1333c,0xdfd81},
+{0x1333d,0xdfda1},
+{0x1333e,0xdfdc1},
+{0x1333f,0xdfde1},
+{0x13340,0xdfe01},
+{0x13341,0xdfe21},
+{0x13342,0xdfe41},
+{0x13343,0xdfe61},
+{0x13344,0xdfe81},
+{0x13345,0xdfea1},
+{0x13346,0xdfec1},
+{0x13347,0xdfee1},
+{0x13348,0xdff01},
+{0x13349,0xdff21},
+{0x1334a,0xdff41},
+{0x1334b,0xdff61},
+{0x1334c,0xdff81},
+{0x1334d,0xdffa1},
+{0x1334e,0xdffc1},
+{0x1334f,0xdffe1},
+{0x13350,0xe0001},
+{0x13351,0xe0021},
+{0x13352,0xe0041},
+{0x13353,0xe0061},
+{0x13354,0xe0081},
+{0x13355,0xe00a1},
+{0x13356,0xe00c1},
+{0x13357,0xe00e1},
+{0x13358,0xe0101},
+{0x13359,0xe0121},
+{0x1335a,0xe0141},
+{0x1335b,0xe0161},
+{0x1335c,0xe0181},
+{0x1335d,0xe01a1},
+{0x1335e,0xe01c1},
+{0x1335f,0xe01e1},
+{0x13360,0xe0201},
+{0x13361,0xe0221},
+{0x13362,0xe0241},
+{0x13363,0xe0261},
+{0x13364,0xe0281},
+{0x13365,0xe02a1},
+{0x13366,0xe02c1},
+{0x13367,0xe02e1},
+{0x13368,0xe0301},
+{0x13369,0xe0321},
+{0x1336a,0xe0341},
+{0x1336b,0xe0361},
+{0x1336c,0xe0381},
+{0x1336d,0xe03a1},
+{0x1336e,0xe03c1},
+{0x1336f,0xe03e1},
+{0x13370,0xe0401},
+{0x13371,0xe0421},
+{0x13372,0xe0441},
+{0x13373,0xe0461},
+{0x13374,0xe0481},
+{0x13375,0xe04a1},
+{0x13376,0xe04c1},
+{0x13377,0xe04e1},
+{0x13378,0xe0501},
+{0x13379,0xe0521},
+{0x1337a,0xe0541},
+{0x1337b,0xe0561},
+{0x1337c,0xe0581},
+{0x1337d,0xe05a1},
+{0x1337e,0xe05c1},
+{0x1337f,0xe05e1},
+{0x13380,0xe0601},
+{0x13381,0xe0621},
+{0x13382,0xe0641},
+{0x13383,0xe0661},
+{0x13384,0xe0681},
+{0x13385,0xe06a1},
+{0x13386,0xe06c1},
+{0x13387,0xe06e1},
+{0x13388,0xe0701},
+{0x13389,0xe0721},
+{0x1338a,0xe0741},
+{0x1338b,0xe0761},
+{0x1338c,0xe0781},
+{0x1338d,0xe07a1},
+{0x1338e,0xe07c1},
+{0x1338f,0xe07e1},
+{0x13390,0xe0801},
+{0x13391,0xe0821},
+{0x13392,0xe0841},
+{0x13393,0xe0861},
+{0x13394,0xe0881},
+{0x13395,0xe08a1},
+{0x13396,0xe08c1},
+{0x13397,0xe08e1},
+{0x13398,0xe0901},
+{0x13399,0xe0921},
+{0x1339a,0xe0941},
+{0x1339b,0xe0961},
+{0x1339c,0xe0981},
+{0x1339d,0xe09a1},
+{0x1339e,0xe09c1},
+{0x1339f,0xe09e1},
+{0x133a0,0xe0a01},
+{0x133a1,0xe0a21},
+{0x133a2,0xe0a41},
+{0x133a3,0xe0a61},
+{0x133a4,0xe0a81},
+{0x133a5,0xe0aa1},
+{0x133a6,0xe0ac1},
+{0x133a7,0xe0ae1},
+{0x133a8,0xe0b01},
+{0x133a9,0xe0b21},
+{0x133aa,0xe0b41},
+{0x133ab,0xe0b61},
+{0x133ac,0xe0b81},
+{0x133ad,0xe0ba1},
+{0x133ae,0xe0bc1},
+{0x133af,0xe0be1},
+{0x133b0,0xe0c01},
+{0x133b1,0xe0c21},
+{0x133b2,0xe0c41},
+{0x133b3,0xe0c61},
+{0x133b4,0xe0c81},
+{0x133b5,0xe0ca1},
+{0x133b6,0xe0cc1},
+{0x133b7,0xe0ce1},
+{0x133b8,0xe0d01},
+{0x133b9,0xe0d21},
+{0x133ba,0xe0d41},
+{0x133bb,0xe0d61},
+{0x133bc,0xe0d81},
+{0x133bd,0xe0da1},
+{0x133be,0xe0dc1},
+{0x133bf,0xe0de1},
+{0x133c0,0xe0e01},
+{0x133c1,0xe0e21},
+{0x133c2,0xe0e41},
+{0x133c3,0xe0e61},
+{0x133c4,0xe0e81},
+{0x133c5,0xe0ea1},
+{0x133c6,0xe0ec1},
+{0x133c7,0xe0ee1},
+{0x133c8,0xe0f01},
+{0x133c9,0xe0f21},
+{0x133ca,0xe0f41},
+{0x133cb,0xe0f61},
+{0x133cc,0xe0f81},
+{0x133cd,0xe0fa1},
+{0x133ce,0xe0fc1},
+{0x133cf,0xe0fe1},
+{0x133d0,0xe1001},
+{0x133d1,0xe1021},
+{0x133d2,0xe1041},
+{0x133d3,0xe1061},
+{0x133d4,0xe1081},
+{0x133d5,0xe10a1},
+{0x133d6,0xe10c1},
+{0x133d7,0xe10e1},
+{0x133d8,0xe1101},
+{0x133d9,0xe1121},
+{0x133da,0xe1141},
+{0x133db,0xe1161},
+{0x133dc,0xe1181},
+{0x133dd,0xe11a1},
+{0x133de,0xe11c1},
+{0x133df,0xe11e1},
+{0x133e0,0xe1201},
+{0x133e1,0xe1221},
+{0x133e2,0xe1241},
+{0x133e3,0xe1261},
+{0x133e4,0xe1281},
+{0x133e5,0xe12a1},
+{0x133e6,0xe12c1},
+{0x133e7,0xe12e1},
+{0x133e8,0xe1301},
+{0x133e9,0xe1321},
+{0x133ea,0xe1341},
+{0x133eb,0xe1361},
+{0x133ec,0xe1381},
+{0x133ed,0xe13a1},
+{0x133ee,0xe13c1},
+{0x133ef,0xe13e1},
+{0x133f0,0xe1401},
+{0x133f1,0xe1421},
+{0x133f2,0xe1441},
+{0x133f3,0xe1461},
+{0x133f4,0xe1481},
+{0x133f5,0xe14a1},
+{0x133f6,0xe14c1},
+{0x133f7,0xe14e1},
+{0x133f8,0xe1501},
+{0x133f9,0xe1521},
+{0x133fa,0xe1541},
+{0x133fb,0xe1561},
+{0x133fc,0xe1581},
+{0x133fd,0xe15a1},
+{0x133fe,0xe15c1},
+{0x133ff,0xe15e1},
+{0x13400,0xe1601},
+{0x13401,0xe1621},
+{0x13402,0xe1641},
+{0x13403,0xe1661},
+{0x13404,0xe1681},
+{0x13405,0xe16a1},
+{0x13406,0xe16c1},
+{0x13407,0xe16e1},
+{0x13408,0xe1701},
+{0x13409,0xe1721},
+{0x1340a,0xe1741},
+{0x1340b,0xe1761},
+{0x1340c,0xe1781},
+{0x1340d,0xe17a1},
+{0x1340e,0xe17c1},
+{0x1340f,0xe17e1},
+{0x13410,0xe1801},
+{0x13411,0xe1821},
+{0x13412,0xe1841},
+{0x13413,0xe1861},
+{0x13414,0xe1881},
+{0x13415,0xe18a1},
+{0x13416,0xe18c1},
+{0x13417,0xe18e1},
+{0x13418,0xe1901},
+{0x13419,0xe1921},
+{0x1341a,0xe1941},
+{0x1341b,0xe1961},
+{0x1341c,0xe1981},
+{0x1341d,0xe19a1},
+{0x1341e,0xe19c1},
+{0x1341f,0xe19e1},
+{0x13420,0xe1a01},
+{0x13421,0xe1a21},
+{0x13422,0xe1a41},
+{0x13423,0xe1a61},
+{0x13424,0xe1a81},
+{0x13425,0xe1aa1},
+{0x13426,0xe1ac1},
+{0x13427,0xe1ae1},
+{0x13428,0xe1b01},
+{0x13429,0xe1b21},
+{0x1342a,0xe1b41},
+{0x1342b,0xe1b61},
+{0x1342c,0xe1b81},
+{0x1342d,0xe1ba1},
+{0x1342e,0xe1bc1},
+{0x14400,0xe2701},
+{0x14401,0xe2721},
+{0x14402,0xe2741},
+{0x14403,0xe2761},
+{0x14404,0xe2781},
+{0x14405,0xe27a1},
+{0x14406,0xe27c1},
+{0x14407,0xe27e1},
+{0x14408,0xe2801},
+{0x14409,0xe2821},
+{0x1440a,0xe2841},
+{0x1440b,0xe2861},
+{0x1440c,0xe2881},
+{0x1440d,0xe28a1},
+{0x1440e,0xe28c1},
+{0x1440f,0xe28e1},
+{0x14410,0xe2901},
+{0x14411,0xe2921},
+{0x14412,0xe2941},
+{0x14413,0xe2961},
+{0x14414,0xe2981},
+{0x14415,0xe29a1},
+{0x14416,0xe29c1},
+{0x14417,0xe29e1},
+{0x14418,0xe2a01},
+{0x14419,0xe2a21},
+{0x1441a,0xe2a41},
+{0x1441b,0xe2a61},
+{0x1441c,0xe2a81},
+{0x1441d,0xe2aa1},
+{0x1441e,0xe2ac1},
+{0x1441f,0xe2ae1},
+{0x14420,0xe2b01},
+{0x14421,0xe2b21},
+{0x14422,0xe2b41},
+{0x14423,0xe2b61},
+{0x14424,0xe2b81},
+{0x14425,0xe2ba1},
+{0x14426,0xe2bc1},
+{0x14427,0xe2be1},
+{0x14428,0xe2c01},
+{0x14429,0xe2c21},
+{0x1442a,0xe2c41},
+{0x1442b,0xe2c61},
+{0x1442c,0xe2c81},
+{0x1442d,0xe2ca1},
+{0x1442e,0xe2cc1},
+{0x1442f,0xe2ce1},
+{0x14430,0xe2d01},
+{0x14431,0xe2d21},
+{0x14432,0xe2d41},
+{0x14433,0xe2d61},
+{0x14434,0xe2d81},
+{0x14435,0xe2da1},
+{0x14436,0xe2dc1},
+{0x14437,0xe2de1},
+{0x14438,0xe2e01},
+{0x14439,0xe2e21},
+{0x1443a,0xe2e41},
+{0x1443b,0xe2e61},
+{0x1443c,0xe2e81},
+{0x1443d,0xe2ea1},
+{0x1443e,0xe2ec1},
+{0x1443f,0xe2ee1},
+{0x14440,0xe2f01},
+{0x14441,0xe2f21},
+{0x14442,0xe2f41},
+{0x14443,0xe2f61},
+{0x14444,0xe2f81},
+{0x14445,0xe2fa1},
+{0x14446,0xe2fc1},
+{0x14447,0xe2fe1},
+{0x14448,0xe3001},
+{0x14449,0xe3021},
+{0x1444a,0xe3041},
+{0x1444b,0xe3061},
+{0x1444c,0xe3081},
+{0x1444d,0xe30a1},
+{0x1444e,0xe30c1},
+{0x1444f,0xe30e1},
+{0x14450,0xe3101},
+{0x14451,0xe3121},
+{0x14452,0xe3141},
+{0x14453,0xe3161},
+{0x14454,0xe3181},
+{0x14455,0xe31a1},
+{0x14456,0xe31c1},
+{0x14457,0xe31e1},
+{0x14458,0xe3201},
+{0x14459,0xe3221},
+{0x1445a,0xe3241},
+{0x1445b,0xe3261},
+{0x1445c,0xe3281},
+{0x1445d,0xe32a1},
+{0x1445e,0xe32c1},
+{0x1445f,0xe32e1},
+{0x14460,0xe3301},
+{0x14461,0xe3321},
+{0x14462,0xe3341},
+{0x14463,0xe3361},
+{0x14464,0xe3381},
+{0x14465,0xe33a1},
+{0x14466,0xe33c1},
+{0x14467,0xe33e1},
+{0x14468,0xe3401},
+{0x14469,0xe3421},
+{0x1446a,0xe3441},
+{0x1446b,0xe3461},
+{0x1446c,0xe3481},
+{0x1446d,0xe34a1},
+{0x1446e,0xe34c1},
+{0x1446f,0xe34e1},
+{0x14470,0xe3501},
+{0x14471,0xe3521},
+{0x14472,0xe3541},
+{0x14473,0xe3561},
+{0x14474,0xe3581},
+{0x14475,0xe35a1},
+{0x14476,0xe35c1},
+{0x14477,0xe35e1},
+{0x14478,0xe3601},
+{0x14479,0xe3621},
+{0x1447a,0xe3641},
+{0x1447b,0xe3661},
+{0x1447c,0xe3681},
+{0x1447d,0xe36a1},
+{0x1447e,0xe36c1},
+{0x1447f,0xe36e1},
+{0x14480,0xe3701},
+{0x14481,0xe3721},
+{0x14482,0xe3741},
+{0x14483,0xe3761},
+{0x14484,0xe3781},
+{0x14485,0xe37a1},
+{0x14486,0xe37c1},
+{0x14487,0xe37e1},
+{0x14488,0xe3801},
+{0x14489,0xe3821},
+{0x1448a,0xe3841},
+{0x1448b,0xe3861},
+{0x1448c,0xe3881},
+{0x1448d,0xe38a1},
+{0x1448e,0xe38c1},
+{0x1448f,0xe38e1},
+{0x14490,0xe3901},
+{0x14491,0xe3921},
+{0x14492,0xe3941},
+{0x14493,0xe3961},
+{0x14494,0xe3981},
+{0x14495,0xe39a1},
+{0x14496,0xe39c1},
+{0x14497,0xe39e1},
+{0x14498,0xe3a01},
+{0x14499,0xe3a21},
+{0x1449a,0xe3a41},
+{0x1449b,0xe3a61},
+{0x1449c,0xe3a81},
+{0x1449d,0xe3aa1},
+{0x1449e,0xe3ac1},
+{0x1449f,0xe3ae1},
+{0x144a0,0xe3b01},
+{0x144a1,0xe3b21},
+{0x144a2,0xe3b41},
+{0x144a3,0xe3b61},
+{0x144a4,0xe3b81},
+{0x144a5,0xe3ba1},
+{0x144a6,0xe3bc1},
+{0x144a7,0xe3be1},
+{0x144a8,0xe3c01},
+{0x144a9,0xe3c21},
+{0x144aa,0xe3c41},
+{0x144ab,0xe3c61},
+{0x144ac,0xe3c81},
+{0x144ad,0xe3ca1},
+{0x144ae,0xe3cc1},
+{0x144af,0xe3ce1},
+{0x144b0,0xe3d01},
+{0x144b1,0xe3d21},
+{0x144b2,0xe3d41},
+{0x144b3,0xe3d61},
+{0x144b4,0xe3d81},
+{0x144b5,0xe3da1},
+{0x144b6,0xe3dc1},
+{0x144b7,0xe3de1},
+{0x144b8,0xe3e01},
+{0x144b9,0xe3e21},
+{0x144ba,0xe3e41},
+{0x144bb,0xe3e61},
+{0x144bc,0xe3e81},
+{0x144bd,0xe3ea1},
+{0x144be,0xe3ec1},
+{0x144bf,0xe3ee1},
+{0x144c0,0xe3f01},
+{0x144c1,0xe3f21},
+{0x144c2,0xe3f41},
+{0x144c3,0xe3f61},
+{0x144c4,0xe3f81},
+{0x144c5,0xe3fa1},
+{0x144c6,0xe3fc1},
+{0x144c7,0xe3fe1},
+{0x144c8,0xe4001},
+{0x144c9,0xe4021},
+{0x144ca,0xe4041},
+{0x144cb,0xe4061},
+{0x144cc,0xe4081},
+{0x144cd,0xe40a1},
+{0x144ce,0xe40c1},
+{0x144cf,0xe40e1},
+{0x144d0,0xe4101},
+{0x144d1,0xe4121},
+{0x144d2,0xe4141},
+{0x144d3,0xe4161},
+{0x144d4,0xe4181},
+{0x144d5,0xe41a1},
+{0x144d6,0xe41c1},
+{0x144d7,0xe41e1},
+{0x144d8,0xe4201},
+{0x144d9,0xe4221},
+{0x144da,0xe4241},
+{0x144db,0xe4261},
+{0x144dc,0xe4281},
+{0x144dd,0xe42a1},
+{0x144de,0xe42c1},
+{0x144df,0xe42e1},
+{0x144e0,0xe4301},
+{0x144e1,0xe4321},
+{0x144e2,0xe4341},
+{0x144e3,0xe4361},
+{0x144e4,0xe4381},
+{0x144e5,0xe43a1},
+{0x144e6,0xe43c1},
+{0x144e7,0xe43e1},
+{0x144e8,0xe4401},
+{0x144e9,0xe4421},
+{0x144ea,0xe4441},
+{0x144eb,0xe4461},
+{0x144ec,0xe4481},
+{0x144ed,0xe44a1},
+{0x144ee,0xe44c1},
+{0x144ef,0xe44e1},
+{0x144f0,0xe4501},
+{0x144f1,0xe4521},
+{0x144f2,0xe4541},
+{0x144f3,0xe4561},
+{0x144f4,0xe4581},
+{0x144f5,0xe45a1},
+{0x144f6,0xe45c1},
+{0x144f7,0xe45e1},
+{0x144f8,0xe4601},
+{0x144f9,0xe4621},
+{0x144fa,0xe4641},
+{0x144fb,0xe4661},
+{0x144fc,0xe4681},
+{0x144fd,0xe46a1},
+{0x144fe,0xe46c1},
+{0x144ff,0xe46e1},
+{0x14500,0xe4701},
+{0x14501,0xe4721},
+{0x14502,0xe4741},
+{0x14503,0xe4761},
+{0x14504,0xe4781},
+{0x14505,0xe47a1},
+{0x14506,0xe47c1},
+{0x14507,0xe47e1},
+{0x14508,0xe4801},
+{0x14509,0xe4821},
+{0x1450a,0xe4841},
+{0x1450b,0xe4861},
+{0x1450c,0xe4881},
+{0x1450d,0xe48a1},
+{0x1450e,0xe48c1},
+{0x1450f,0xe48e1},
+{0x14510,0xe4901},
+{0x14511,0xe4921},
+{0x14512,0xe4941},
+{0x14513,0xe4961},
+{0x14514,0xe4981},
+{0x14515,0xe49a1},
+{0x14516,0xe49c1},
+{0x14517,0xe49e1},
+{0x14518,0xe4a01},
+{0x14519,0xe4a21},
+{0x1451a,0xe4a41},
+{0x1451b,0xe4a61},
+{0x1451c,0xe4a81},
+{0x1451d,0xe4aa1},
+{0x1451e,0xe4ac1},
+{0x1451f,0xe4ae1},
+{0x14520,0xe4b01},
+{0x14521,0xe4b21},
+{0x14522,0xe4b41},
+{0x14523,0xe4b61},
+{0x14524,0xe4b81},
+{0x14525,0xe4ba1},
+{0x14526,0xe4bc1},
+{0x14527,0xe4be1},
+{0x14528,0xe4c01},
+{0x14529,0xe4c21},
+{0x1452a,0xe4c41},
+{0x1452b,0xe4c61},
+{0x1452c,0xe4c81},
+{0x1452d,0xe4ca1},
+{0x1452e,0xe4cc1},
+{0x1452f,0xe4ce1},
+{0x14530,0xe4d01},
+{0x14531,0xe4d21},
+{0x14532,0xe4d41},
+{0x14533,0xe4d61},
+{0x14534,0xe4d81},
+{0x14535,0xe4da1},
+{0x14536,0xe4dc1},
+{0x14537,0xe4de1},
+{0x14538,0xe4e01},
+{0x14539,0xe4e21},
+{0x1453a,0xe4e41},
+{0x1453b,0xe4e61},
+{0x1453c,0xe4e81},
+{0x1453d,0xe4ea1},
+{0x1453e,0xe4ec1},
+{0x1453f,0xe4ee1},
+{0x14540,0xe4f01},
+{0x14541,0xe4f21},
+{0x14542,0xe4f41},
+{0x14543,0xe4f61},
+{0x14544,0xe4f81},
+{0x14545,0xe4fa1},
+{0x14546,0xe4fc1},
+{0x14547,0xe4fe1},
+{0x14548,0xe5001},
+{0x14549,0xe5021},
+{0x1454a,0xe5041},
+{0x1454b,0xe5061},
+{0x1454c,0xe5081},
+{0x1454d,0xe50a1},
+{0x1454e,0xe50c1},
+{0x1454f,0xe50e1},
+{0x14550,0xe5101},
+{0x14551,0xe5121},
+{0x14552,0xe5141},
+{0x14553,0xe5161},
+{0x14554,0xe5181},
+{0x14555,0xe51a1},
+{0x14556,0xe51c1},
+{0x14557,0xe51e1},
+{0x14558,0xe5201},
+{0x14559,0xe5221},
+{0x1455a,0xe5241},
+{0x1455b,0xe5261},
+{0x1455c,0xe5281},
+{0x1455d,0xe52a1},
+{0x1455e,0xe52c1},
+{0x1455f,0xe52e1},
+{0x14560,0xe5301},
+{0x14561,0xe5321},
+{0x14562,0xe5341},
+{0x14563,0xe5361},
+{0x14564,0xe5381},
+{0x14565,0xe53a1},
+{0x14566,0xe53c1},
+{0x14567,0xe53e1},
+{0x14568,0xe5401},
+{0x14569,0xe5421},
+{0x1456a,0xe5441},
+{0x1456b,0xe5461},
+{0x1456c,0xe5481},
+{0x1456d,0xe54a1},
+{0x1456e,0xe54c1},
+{0x1456f,0xe54e1},
+{0x14570,0xe5501},
+{0x14571,0xe5521},
+{0x14572,0xe5541},
+{0x14573,0xe5561},
+{0x14574,0xe5581},
+{0x14575,0xe55a1},
+{0x14576,0xe55c1},
+{0x14577,0xe55e1},
+{0x14578,0xe5601},
+{0x14579,0xe5621},
+{0x1457a,0xe5641},
+{0x1457b,0xe5661},
+{0x1457c,0xe5681},
+{0x1457d,0xe56a1},
+{0x1457e,0xe56c1},
+{0x1457f,0xe56e1},
+{0x14580,0xe5701},
+{0x14581,0xe5721},
+{0x14582,0xe5741},
+{0x14583,0xe5761},
+{0x14584,0xe5781},
+{0x14585,0xe57a1},
+{0x14586,0xe57c1},
+{0x14587,0xe57e1},
+{0x14588,0xe5801},
+{0x14589,0xe5821},
+{0x1458a,0xe5841},
+{0x1458b,0xe5861},
+{0x1458c,0xe5881},
+{0x1458d,0xe58a1},
+{0x1458e,0xe58c1},
+{0x1458f,0xe58e1},
+{0x14590,0xe5901},
+{0x14591,0xe5921},
+{0x14592,0xe5941},
+{0x14593,0xe5961},
+{0x14594,0xe5981},
+{0x14595,0xe59a1},
+{0x14596,0xe59c1},
+{0x14597,0xe59e1},
+{0x14598,0xe5a01},
+{0x14599,0xe5a21},
+{0x1459a,0xe5a41},
+{0x1459b,0xe5a61},
+{0x1459c,0xe5a81},
+{0x1459d,0xe5aa1},
+{0x1459e,0xe5ac1},
+{0x1459f,0xe5ae1},
+{0x145a0,0xe5b01},
+{0x145a1,0xe5b21},
+{0x145a2,0xe5b41},
+{0x145a3,0xe5b61},
+{0x145a4,0xe5b81},
+{0x145a5,0xe5ba1},
+{0x145a6,0xe5bc1},
+{0x145a7,0xe5be1},
+{0x145a8,0xe5c01},
+{0x145a9,0xe5c21},
+{0x145aa,0xe5c41},
+{0x145ab,0xe5c61},
+{0x145ac,0xe5c81},
+{0x145ad,0xe5ca1},
+{0x145ae,0xe5cc1},
+{0x145af,0xe5ce1},
+{0x145b0,0xe5d01},
+{0x145b1,0xe5d21},
+{0x145b2,0xe5d41},
+{0x145b3,0xe5d61},
+{0x145b4,0xe5d81},
+{0x145b5,0xe5da1},
+{0x145b6,0xe5dc1},
+{0x145b7,0xe5de1},
+{0x145b8,0xe5e01},
+{0x145b9,0xe5e21},
+{0x145ba,0xe5e41},
+{0x145bb,0xe5e61},
+{0x145bc,0xe5e81},
+{0x145bd,0xe5ea1},
+{0x145be,0xe5ec1},
+{0x145bf,0xe5ee1},
+{0x145c0,0xe5f01},
+{0x145c1,0xe5f21},
+{0x145c2,0xe5f41},
+{0x145c3,0xe5f61},
+{0x145c4,0xe5f81},
+{0x145c5,0xe5fa1},
+{0x145c6,0xe5fc1},
+{0x145c7,0xe5fe1},
+{0x145c8,0xe6001},
+{0x145c9,0xe6021},
+{0x145ca,0xe6041},
+{0x145cb,0xe6061},
+{0x145cc,0xe6081},
+{0x145cd,0xe60a1},
+{0x145ce,0xe60c1},
+{0x145cf,0xe60e1},
+{0x145d0,0xe6101},
+{0x145d1,0xe6121},
+{0x145d2,0xe6141},
+{0x145d3,0xe6161},
+{0x145d4,0xe6181},
+{0x145d5,0xe61a1},
+{0x145d6,0xe61c1},
+{0x145d7,0xe61e1},
+{0x145d8,0xe6201},
+{0x145d9,0xe6221},
+{0x145da,0xe6241},
+{0x145db,0xe6261},
+{0x145dc,0xe6281},
+{0x145dd,0xe62a1},
+{0x145de,0xe62c1},
+{0x145df,0xe62e1},
+{0x145e0,0xe6301},
+{0x145e1,0xe6321},
+{0x145e2,0xe6341},
+{0x145e3,0xe6361},
+{0x145e4,0xe6381},
+{0x145e5,0xe63a1},
+{0x145e6,0xe63c1},
+{0x145e7,0xe63e1},
+{0x145e8,0xe6401},
+{0x145e9,0xe6421},
+{0x145ea,0xe6441},
+{0x145eb,0xe6461},
+{0x145ec,0xe6481},
+{0x145ed,0xe64a1},
+{0x145ee,0xe64c1},
+{0x145ef,0xe64e1},
+{0x145f0,0xe6501},
+{0x145f1,0xe6521},
+{0x145f2,0xe6541},
+{0x145f3,0xe6561},
+{0x145f4,0xe6581},
+{0x145f5,0xe65a1},
+{0x145f6,0xe65c1},
+{0x145f7,0xe65e1},
+{0x145f8,0xe6601},
+{0x145f9,0xe6621},
+{0x145fa,0xe6641},
+{0x145fb,0xe6661},
+{0x145fc,0xe6681},
+{0x145fd,0xe66a1},
+{0x145fe,0xe66c1},
+{0x145ff,0xe66e1},
+{0x14600,0xe6701},
+{0x14601,0xe6721},
+{0x14602,0xe6741},
+{0x14603,0xe6761},
+{0x14604,0xe6781},
+{0x14605,0xe67a1},
+{0x14606,0xe67c1},
+{0x14607,0xe67e1},
+{0x14608,0xe6801},
+{0x14609,0xe6821},
+{0x1460a,0xe6841},
+{0x1460b,0xe6861},
+{0x1460c,0xe6881},
+{0x1460d,0xe68a1},
+{0x1460e,0xe68c1},
+{0x1460f,0xe68e1},
+{0x14610,0xe6901},
+{0x14611,0xe6921},
+{0x14612,0xe6941},
+{0x14613,0xe6961},
+{0x14614,0xe6981},
+{0x14615,0xe69a1},
+{0x14616,0xe69c1},
+{0x14617,0xe69e1},
+{0x14618,0xe6a01},
+{0x14619,0xe6a21},
+{0x1461a,0xe6a41},
+{0x1461b,0xe6a61},
+{0x1461c,0xe6a81},
+{0x1461d,0xe6aa1},
+{0x1461e,0xe6ac1},
+{0x1461f,0xe6ae1},
+{0x14620,0xe6b01},
+{0x14621,0xe6b21},
+{0x14622,0xe6b41},
+{0x14623,0xe6b61},
+{0x14624,0xe6b81},
+{0x14625,0xe6ba1},
+{0x14626,0xe6bc1},
+{0x14627,0xe6be1},
+{0x14628,0xe6c01},
+{0x14629,0xe6c21},
+{0x1462a,0xe6c41},
+{0x1462b,0xe6c61},
+{0x1462c,0xe6c81},
+{0x1462d,0xe6ca1},
+{0x1462e,0xe6cc1},
+{0x1462f,0xe6ce1},
+{0x14630,0xe6d01},
+{0x14631,0xe6d21},
+{0x14632,0xe6d41},
+{0x14633,0xe6d61},
+{0x14634,0xe6d81},
+{0x14635,0xe6da1},
+{0x14636,0xe6dc1},
+{0x14637,0xe6de1},
+{0x14638,0xe6e01},
+{0x14639,0xe6e21},
+{0x1463a,0xe6e41},
+{0x1463b,0xe6e61},
+{0x1463c,0xe6e81},
+{0x1463d,0xe6ea1},
+{0x1463e,0xe6ec1},
+{0x1463f,0xe6ee1},
+{0x14640,0xe6f01},
+{0x14641,0xe6f21},
+{0x14642,0xe6f41},
+{0x14643,0xe6f61},
+{0x14644,0xe6f81},
+{0x14645,0xe6fa1},
+{0x14646,0xe6fc1},
+{0x16800,0xa6561},
+{0x16801,0xa6581},
+{0x16802,0xa65a1},
+{0x16803,0xa65c1},
+{0x16804,0xa65e1},
+{0x16805,0xa6601},
+{0x16806,0xa6621},
+{0x16807,0xa6641},
+{0x16808,0xa6661},
+{0x16809,0xa6681},
+{0x1680a,0xa66a1},
+{0x1680b,0xa66c1},
+{0x1680c,0xa66e1},
+{0x1680d,0xa6701},
+{0x1680e,0xa6721},
+{0x1680f,0xa6741},
+{0x16810,0xa6761},
+{0x16811,0xa6781},
+{0x16812,0xa67a1},
+{0x16813,0xa67c1},
+{0x16814,0xa67e1},
+{0x16815,0xa6801},
+{0x16816,0xa6821},
+{0x16817,0xa6841},
+{0x16818,0xa6861},
+{0x16819,0xa6881},
+{0x1681a,0xa68a1},
+{0x1681b,0xa68c1},
+{0x1681c,0xa68e1},
+{0x1681d,0xa6901},
+{0x1681e,0xa6921},
+{0x1681f,0xa6941},
+{0x16820,0xa6961},
+{0x16821,0xa6981},
+{0x16822,0xa69a1},
+{0x16823,0xa69c1},
+{0x16824,0xa69e1},
+{0x16825,0xa6a01},
+{0x16826,0xa6a21},
+{0x16827,0xa6a41},
+{0x16828,0xa6a61},
+{0x16829,0xa6a81},
+{0x1682a,0xa6aa1},
+{0x1682b,0xa6ac1},
+{0x1682c,0xa6ae1},
+{0x1682d,0xa6b01},
+{0x1682e,0xa6b21},
+{0x1682f,0xa6b41},
+{0x16830,0xa6b61},
+{0x16831,0xa6b81},
+{0x16832,0xa6ba1},
+{0x16833,0xa6bc1},
+{0x16834,0xa6be1},
+{0x16835,0xa6c01},
+{0x16836,0xa6c21},
+{0x16837,0xa6c41},
+{0x16838,0xa6c61},
+{0x16839,0xa6c81},
+{0x1683a,0xa6ca1},
+{0x1683b,0xa6cc1},
+{0x1683c,0xa6ce1},
+{0x1683d,0xa6d01},
+{0x1683e,0xa6d21},
+{0x1683f,0xa6d41},
+{0x16840,0xa6d61},
+{0x16841,0xa6d81},
+{0x16842,0xa6da1},
+{0x16843,0xa6dc1},
+{0x16844,0xa6de1},
+{0x16845,0xa6e01},
+{0x16846,0xa6e21},
+{0x16847,0xa6e41},
+{0x16848,0xa6e61},
+{0x16849,0xa6e81},
+{0x1684a,0xa6ea1},
+{0x1684b,0xa6ec1},
+{0x1684c,0xa6ee1},
+{0x1684d,0xa6f01},
+{0x1684e,0xa6f21},
+{0x1684f,0xa6f41},
+{0x16850,0xa6f61},
+{0x16851,0xa6f81},
+{0x16852,0xa6fa1},
+{0x16853,0xa6fc1},
+{0x16854,0xa6fe1},
+{0x16855,0xa7001},
+{0x16856,0xa7021},
+{0x16857,0xa7041},
+{0x16858,0xa7061},
+{0x16859,0xa7081},
+{0x1685a,0xa70a1},
+{0x1685b,0xa70c1},
+{0x1685c,0xa70e1},
+{0x1685d,0xa7101},
+{0x1685e,0xa7121},
+{0x1685f,0xa7141},
+{0x16860,0xa7161},
+{0x16861,0xa7181},
+{0x16862,0xa71a1},
+{0x16863,0xa71c1},
+{0x16864,0xa71e1},
+{0x16865,0xa7201},
+{0x16866,0xa7221},
+{0x16867,0xa7241},
+{0x16868,0xa7261},
+{0x16869,0xa7281},
+{0x1686a,0xa72a1},
+{0x1686b,0xa72c1},
+{0x1686c,0xa72e1},
+{0x1686d,0xa7301},
+{0x1686e,0xa7321},
+{0x1686f,0xa7341},
+{0x16870,0xa7361},
+{0x16871,0xa7381},
+{0x16872,0xa73a1},
+{0x16873,0xa73c1},
+{0x16874,0xa73e1},
+{0x16875,0xa7401},
+{0x16876,0xa7421},
+{0x16877,0xa7441},
+{0x16878,0xa7461},
+{0x16879,0xa7481},
+{0x1687a,0xa74a1},
+{0x1687b,0xa74c1},
+{0x1687c,0xa74e1},
+{0x1687d,0xa7501},
+{0x1687e,0xa7521},
+{0x1687f,0xa7541},
+{0x16880,0xa7561},
+{0x16881,0xa7581},
+{0x16882,0xa75a1},
+{0x16883,0xa75c1},
+{0x16884,0xa75e1},
+{0x16885,0xa7601},
+{0x16886,0xa7621},
+{0x16887,0xa7641},
+{0x16888,0xa7661},
+{0x16889,0xa7681},
+{0x1688a,0xa76a1},
+{0x1688b,0xa76c1},
+{0x1688c,0xa76e1},
+{0x1688d,0xa7701},
+{0x1688e,0xa7721},
+{0x1688f,0xa7741},
+{0x16890,0xa7761},
+{0x16891,0xa7781},
+{0x16892,0xa77a1},
+{0x16893,0xa77c1},
+{0x16894,0xa77e1},
+{0x16895,0xa7801},
+{0x16896,0xa7821},
+{0x16897,0xa7841},
+{0x16898,0xa7861},
+{0x16899,0xa7881},
+{0x1689a,0xa78a1},
+{0x1689b,0xa78c1},
+{0x1689c,0xa78e1},
+{0x1689d,0xa7901},
+{0x1689e,0xa7921},
+{0x1689f,0xa7941},
+{0x168a0,0xa7961},
+{0x168a1,0xa7981},
+{0x168a2,0xa79a1},
+{0x168a3,0xa79c1},
+{0x168a4,0xa79e1},
+{0x168a5,0xa7a01},
+{0x168a6,0xa7a21},
+{0x168a7,0xa7a41},
+{0x168a8,0xa7a61},
+{0x168a9,0xa7a81},
+{0x168aa,0xa7aa1},
+{0x168ab,0xa7ac1},
+{0x168ac,0xa7ae1},
+{0x168ad,0xa7b01},
+{0x168ae,0xa7b21},
+{0x168af,0xa7b41},
+{0x168b0,0xa7b61},
+{0x168b1,0xa7b81},
+{0x168b2,0xa7ba1},
+{0x168b3,0xa7bc1},
+{0x168b4,0xa7be1},
+{0x168b5,0xa7c01},
+{0x168b6,0xa7c21},
+{0x168b7,0xa7c41},
+{0x168b8,0xa7c61},
+{0x168b9,0xa7c81},
+{0x168ba,0xa7ca1},
+{0x168bb,0xa7cc1},
+{0x168bc,0xa7ce1},
+{0x168bd,0xa7d01},
+{0x168be,0xa7d21},
+{0x168bf,0xa7d41},
+{0x168c0,0xa7d61},
+{0x168c1,0xa7d81},
+{0x168c2,0xa7da1},
+{0x168c3,0xa7dc1},
+{0x168c4,0xa7de1},
+{0x168c5,0xa7e01},
+{0x168c6,0xa7e21},
+{0x168c7,0xa7e41},
+{0x168c8,0xa7e61},
+{0x168c9,0xa7e81},
+{0x168ca,0xa7ea1},
+{0x168cb,0xa7ec1},
+{0x168cc,0xa7ee1},
+{0x168cd,0xa7f01},
+{0x168ce,0xa7f21},
+{0x168cf,0xa7f41},
+{0x168d0,0xa7f61},
+{0x168d1,0xa7f81},
+{0x168d2,0xa7fa1},
+{0x168d3,0xa7fc1},
+{0x168d4,0xa7fe1},
+{0x168d5,0xa8001},
+{0x168d6,0xa8021},
+{0x168d7,0xa8041},
+{0x168d8,0xa8061},
+{0x168d9,0xa8081},
+{0x168da,0xa80a1},
+{0x168db,0xa80c1},
+{0x168dc,0xa80e1},
+{0x168dd,0xa8101},
+{0x168de,0xa8121},
+{0x168df,0xa8141},
+{0x168e0,0xa8161},
+{0x168e1,0xa8181},
+{0x168e2,0xa81a1},
+{0x168e3,0xa81c1},
+{0x168e4,0xa81e1},
+{0x168e5,0xa8201},
+{0x168e6,0xa8221},
+{0x168e7,0xa8241},
+{0x168e8,0xa8261},
+{0x168e9,0xa8281},
+{0x168ea,0xa82a1},
+{0x168eb,0xa82c1},
+{0x168ec,0xa82e1},
+{0x168ed,0xa8301},
+{0x168ee,0xa8321},
+{0x168ef,0xa8341},
+{0x168f0,0xa8361},
+{0x168f1,0xa8381},
+{0x168f2,0xa83a1},
+{0x168f3,0xa83c1},
+{0x168f4,0xa83e1},
+{0x168f5,0xa8401},
+{0x168f6,0xa8421},
+{0x168f7,0xa8441},
+{0x168f8,0xa8461},
+{0x168f9,0xa8481},
+{0x168fa,0xa84a1},
+{0x168fb,0xa84c1},
+{0x168fc,0xa84e1},
+{0x168fd,0xa8501},
+{0x168fe,0xa8521},
+{0x168ff,0xa8541},
+{0x16900,0xa8561},
+{0x16901,0xa8581},
+{0x16902,0xa85a1},
+{0x16903,0xa85c1},
+{0x16904,0xa85e1},
+{0x16905,0xa8601},
+{0x16906,0xa8621},
+{0x16907,0xa8641},
+{0x16908,0xa8661},
+{0x16909,0xa8681},
+{0x1690a,0xa86a1},
+{0x1690b,0xa86c1},
+{0x1690c,0xa86e1},
+{0x1690d,0xa8701},
+{0x1690e,0xa8721},
+{0x1690f,0xa8741},
+{0x16910,0xa8761},
+{0x16911,0xa8781},
+{0x16912,0xa87a1},
+{0x16913,0xa87c1},
+{0x16914,0xa87e1},
+{0x16915,0xa8801},
+{0x16916,0xa8821},
+{0x16917,0xa8841},
+{0x16918,0xa8861},
+{0x16919,0xa8881},
+{0x1691a,0xa88a1},
+{0x1691b,0xa88c1},
+{0x1691c,0xa88e1},
+{0x1691d,0xa8901},
+{0x1691e,0xa8921},
+{0x1691f,0xa8941},
+{0x16920,0xa8961},
+{0x16921,0xa8981},
+{0x16922,0xa89a1},
+{0x16923,0xa89c1},
+{0x16924,0xa89e1},
+{0x16925,0xa8a01},
+{0x16926,0xa8a21},
+{0x16927,0xa8a41},
+{0x16928,0xa8a61},
+{0x16929,0xa8a81},
+{0x1692a,0xa8aa1},
+{0x1692b,0xa8ac1},
+{0x1692c,0xa8ae1},
+{0x1692d,0xa8b01},
+{0x1692e,0xa8b21},
+{0x1692f,0xa8b41},
+{0x16930,0xa8b61},
+{0x16931,0xa8b81},
+{0x16932,0xa8ba1},
+{0x16933,0xa8bc1},
+{0x16934,0xa8be1},
+{0x16935,0xa8c01},
+{0x16936,0xa8c21},
+{0x16937,0xa8c41},
+{0x16938,0xa8c61},
+{0x16939,0xa8c81},
+{0x1693a,0xa8ca1},
+{0x1693b,0xa8cc1},
+{0x1693c,0xa8ce1},
+{0x1693d,0xa8d01},
+{0x1693e,0xa8d21},
+{0x1693f,0xa8d41},
+{0x16940,0xa8d61},
+{0x16941,0xa8d81},
+{0x16942,0xa8da1},
+{0x16943,0xa8dc1},
+{0x16944,0xa8de1},
+{0x16945,0xa8e01},
+{0x16946,0xa8e21},
+{0x16947,0xa8e41},
+{0x16948,0xa8e61},
+{0x16949,0xa8e81},
+{0x1694a,0xa8ea1},
+{0x1694b,0xa8ec1},
+{0x1694c,0xa8ee1},
+{0x1694d,0xa8f01},
+{0x1694e,0xa8f21},
+{0x1694f,0xa8f41},
+{0x16950,0xa8f61},
+{0x16951,0xa8f81},
+{0x16952,0xa8fa1},
+{0x16953,0xa8fc1},
+{0x16954,0xa8fe1},
+{0x16955,0xa9001},
+{0x16956,0xa9021},
+{0x16957,0xa9041},
+{0x16958,0xa9061},
+{0x16959,0xa9081},
+{0x1695a,0xa90a1},
+{0x1695b,0xa90c1},
+{0x1695c,0xa90e1},
+{0x1695d,0xa9101},
+{0x1695e,0xa9121},
+{0x1695f,0xa9141},
+{0x16960,0xa9161},
+{0x16961,0xa9181},
+{0x16962,0xa91a1},
+{0x16963,0xa91c1},
+{0x16964,0xa91e1},
+{0x16965,0xa9201},
+{0x16966,0xa9221},
+{0x16967,0xa9241},
+{0x16968,0xa9261},
+{0x16969,0xa9281},
+{0x1696a,0xa92a1},
+{0x1696b,0xa92c1},
+{0x1696c,0xa92e1},
+{0x1696d,0xa9301},
+{0x1696e,0xa9321},
+{0x1696f,0xa9341},
+{0x16970,0xa9361},
+{0x16971,0xa9381},
+{0x16972,0xa93a1},
+{0x16973,0xa93c1},
+{0x16974,0xa93e1},
+{0x16975,0xa9401},
+{0x16976,0xa9421},
+{0x16977,0xa9441},
+{0x16978,0xa9461},
+{0x16979,0xa9481},
+{0x1697a,0xa94a1},
+{0x1697b,0xa94c1},
+{0x1697c,0xa94e1},
+{0x1697d,0xa9501},
+{0x1697e,0xa9521},
+{0x1697f,0xa9541},
+{0x16980,0xa9561},
+{0x16981,0xa9581},
+{0x16982,0xa95a1},
+{0x16983,0xa95c1},
+{0x16984,0xa95e1},
+{0x16985,0xa9601},
+{0x16986,0xa9621},
+{0x16987,0xa9641},
+{0x16988,0xa9661},
+{0x16989,0xa9681},
+{0x1698a,0xa96a1},
+{0x1698b,0xa96c1},
+{0x1698c,0xa96e1},
+{0x1698d,0xa9701},
+{0x1698e,0xa9721},
+{0x1698f,0xa9741},
+{0x16990,0xa9761},
+{0x16991,0xa9781},
+{0x16992,0xa97a1},
+{0x16993,0xa97c1},
+{0x16994,0xa97e1},
+{0x16995,0xa9801},
+{0x16996,0xa9821},
+{0x16997,0xa9841},
+{0x16998,0xa9861},
+{0x16999,0xa9881},
+{0x1699a,0xa98a1},
+{0x1699b,0xa98c1},
+{0x1699c,0xa98e1},
+{0x1699d,0xa9901},
+{0x1699e,0xa9921},
+{0x1699f,0xa9941},
+{0x169a0,0xa9961},
+{0x169a1,0xa9981},
+{0x169a2,0xa99a1},
+{0x169a3,0xa99c1},
+{0x169a4,0xa99e1},
+{0x169a5,0xa9a01},
+{0x169a6,0xa9a21},
+{0x169a7,0xa9a41},
+{0x169a8,0xa9a61},
+{0x169a9,0xa9a81},
+{0x169aa,0xa9aa1},
+{0x169ab,0xa9ac1},
+{0x169ac,0xa9ae1},
+{0x169ad,0xa9b01},
+{0x169ae,0xa9b21},
+{0x169af,0xa9b41},
+{0x169b0,0xa9b61},
+{0x169b1,0xa9b81},
+{0x169b2,0xa9ba1},
+{0x169b3,0xa9bc1},
+{0x169b4,0xa9be1},
+{0x169b5,0xa9c01},
+{0x169b6,0xa9c21},
+{0x169b7,0xa9c41},
+{0x169b8,0xa9c61},
+{0x169b9,0xa9c81},
+{0x169ba,0xa9ca1},
+{0x169bb,0xa9cc1},
+{0x169bc,0xa9ce1},
+{0x169bd,0xa9d01},
+{0x169be,0xa9d21},
+{0x169bf,0xa9d41},
+{0x169c0,0xa9d61},
+{0x169c1,0xa9d81},
+{0x169c2,0xa9da1},
+{0x169c3,0xa9dc1},
+{0x169c4,0xa9de1},
+{0x169c5,0xa9e01},
+{0x169c6,0xa9e21},
+{0x169c7,0xa9e41},
+{0x169c8,0xa9e61},
+{0x169c9,0xa9e81},
+{0x169ca,0xa9ea1},
+{0x169cb,0xa9ec1},
+{0x169cc,0xa9ee1},
+{0x169cd,0xa9f01},
+{0x169ce,0xa9f21},
+{0x169cf,0xa9f41},
+{0x169d0,0xa9f61},
+{0x169d1,0xa9f81},
+{0x169d2,0xa9fa1},
+{0x169d3,0xa9fc1},
+{0x169d4,0xa9fe1},
+{0x169d5,0xaa001},
+{0x169d6,0xaa021},
+{0x169d7,0xaa041},
+{0x169d8,0xaa061},
+{0x169d9,0xaa081},
+{0x169da,0xaa0a1},
+{0x169db,0xaa0c1},
+{0x169dc,0xaa0e1},
+{0x169dd,0xaa101},
+{0x169de,0xaa121},
+{0x169df,0xaa141},
+{0x169e0,0xaa161},
+{0x169e1,0xaa181},
+{0x169e2,0xaa1a1},
+{0x169e3,0xaa1c1},
+{0x169e4,0xaa1e1},
+{0x169e5,0xaa201},
+{0x169e6,0xaa221},
+{0x169e7,0xaa241},
+{0x169e8,0xaa261},
+{0x169e9,0xaa281},
+{0x169ea,0xaa2a1},
+{0x169eb,0xaa2c1},
+{0x169ec,0xaa2e1},
+{0x169ed,0xaa301},
+{0x169ee,0xaa321},
+{0x169ef,0xaa341},
+{0x169f0,0xaa361},
+{0x169f1,0xaa381},
+{0x169f2,0xaa3a1},
+{0x169f3,0xaa3c1},
+{0x169f4,0xaa3e1},
+{0x169f5,0xaa401},
+{0x169f6,0xaa421},
+{0x169f7,0xaa441},
+{0x169f8,0xaa461},
+{0x169f9,0xaa481},
+{0x169fa,0xaa4a1},
+{0x169fb,0xaa4c1},
+{0x169fc,0xaa4e1},
+{0x169fd,0xaa501},
+{0x169fe,0xaa521},
+{0x169ff,0xaa541},
+{0x16a00,0xaa561},
+{0x16a01,0xaa581},
+{0x16a02,0xaa5a1},
+{0x16a03,0xaa5c1},
+{0x16a04,0xaa5e1},
+{0x16a05,0xaa601},
+{0x16a06,0xaa621},
+{0x16a07,0xaa641},
+{0x16a08,0xaa661},
+{0x16a09,0xaa681},
+{0x16a0a,0xaa6a1},
+{0x16a0b,0xaa6c1},
+{0x16a0c,0xaa6e1},
+{0x16a0d,0xaa701},
+{0x16a0e,0xaa721},
+{0x16a0f,0xaa741},
+{0x16a10,0xaa761},
+{0x16a11,0xaa781},
+{0x16a12,0xaa7a1},
+{0x16a13,0xaa7c1},
+{0x16a14,0xaa7e1},
+{0x16a15,0xaa801},
+{0x16a16,0xaa821},
+{0x16a17,0xaa841},
+{0x16a18,0xaa861},
+{0x16a19,0xaa881},
+{0x16a1a,0xaa8a1},
+{0x16a1b,0xaa8c1},
+{0x16a1c,0xaa8e1},
+{0x16a1d,0xaa901},
+{0x16a1e,0xaa921},
+{0x16a1f,0xaa941},
+{0x16a20,0xaa961},
+{0x16a21,0xaa981},
+{0x16a22,0xaa9a1},
+{0x16a23,0xaa9c1},
+{0x16a24,0xaa9e1},
+{0x16a25,0xaaa01},
+{0x16a26,0xaaa21},
+{0x16a27,0xaaa41},
+{0x16a28,0xaaa61},
+{0x16a29,0xaaa81},
+{0x16a2a,0xaaaa1},
+{0x16a2b,0xaaac1},
+{0x16a2c,0xaaae1},
+{0x16a2d,0xaab01},
+{0x16a2e,0xaab21},
+{0x16a2f,0xaab41},
+{0x16a30,0xaab61},
+{0x16a31,0xaab81},
+{0x16a32,0xaaba1},
+{0x16a33,0xaabc1},
+{0x16a34,0xaabe1},
+{0x16a35,0xaac01},
+{0x16a36,0xaac21},
+{0x16a37,0xaac41},
+{0x16a38,0xaac61},
+{0x16a40,0xc8ae1},
+{0x16a41,0xc8b01},
+{0x16a42,0xc8b21},
+{0x16a43,0xc8b41},
+{0x16a44,0xc8b61},
+{0x16a45,0xc8b81},
+{0x16a46,0xc8ba1},
+{0x16a47,0xc8bc1},
+{0x16a48,0xc8be1},
+{0x16a49,0xc8c01},
+{0x16a4a,0xc8c21},
+{0x16a4b,0xc8c41},
+{0x16a4c,0xc8c61},
+{0x16a4d,0xc8c81},
+{0x16a4e,0xc8ca1},
+{0x16a4f,0xc8cc1},
+{0x16a50,0xc8ce1},
+{0x16a51,0xc8d01},
+{0x16a52,0xc8d21},
+{0x16a53,0xc8d41},
+{0x16a54,0xc8d61},
+{0x16a55,0xc8d81},
+{0x16a56,0xc8da1},
+{0x16a57,0xc8dc1},
+{0x16a58,0xc8de1},
+{0x16a59,0xc8e01},
+{0x16a5a,0xc8e21},
+{0x16a5b,0xc8e41},
+{0x16a5c,0xc8e61},
+{0x16a5d,0xc8e81},
+{0x16a5e,0xc8ea1},
+{0x16a60,0x380c1},
+{0x16a61,0x382e1},
+{0x16a62,0x3a041},
+{0x16a63,0x3aec1},
+{0x16a64,0x3b641},
+{0x16a65,0x3bc01},
+{0x16a66,0x3bfe1},
+{0x16a67,0x3c301},
+{0x16a68,0x3c681},
+{0x16a69,0x3c9a1},
+{0x16a6e,0x1f841},
+{0x16a6f,0x1f861},
+{0x16ad0,0xaac81},
+{0x16ad1,0xaaca1},
+{0x16ad2,0xaacc1},
+{0x16ad3,0xaace1},
+{0x16ad4,0xaad01},
+{0x16ad5,0xaad21},
+{0x16ad6,0xaad41},
+{0x16ad7,0xaad61},
+{0x16ad8,0xaad81},
+{0x16ad9,0xaada1},
+{0x16ada,0xaadc1},
+{0x16adb,0xaade1},
+{0x16adc,0xaae01},
+{0x16add,0xaae21},
+{0x16ade,0xaae41},
+{0x16adf,0xaae61},
+{0x16ae0,0xaae81},
+{0x16ae1,0xaaea1},
+{0x16ae2,0xaaec1},
+{0x16ae3,0xaaee1},
+{0x16ae4,0xaaf01},
+{0x16ae5,0xaaf21},
+{0x16ae6,0xaaf41},
+{0x16ae7,0xaaf61},
+{0x16ae8,0xaaf81},
+{0x16ae9,0xaafa1},
+{0x16aea,0xaafc1},
+{0x16aeb,0xaafe1},
+{0x16aec,0xab001},
+{0x16aed,0xab021},
+{0x16af0,0x36be1},
+{0x16af1,0x36c01},
+{0x16af2,0x36c21},
+{0x16af3,0x36c41},
+{0x16af4,0x36c61},
+{0x16af5,0x1f881},
+{0x16b00,0xc3781},
+{0x16b01,0xc37a1},
+{0x16b02,0xc37c1},
+{0x16b03,0xc37e1},
+{0x16b04,0xc3801},
+{0x16b05,0xc3821},
+{0x16b06,0xc3841},
+{0x16b07,0xc3861},
+{0x16b08,0xc3881},
+{0x16b09,0xc38a1},
+{0x16b0a,0xc38c1},
+{0x16b0b,0xc38e1},
+{0x16b0c,0xc3901},
+{0x16b0d,0xc3921},
+{0x16b0e,0xc3941},
+{0x16b0f,0xc3961},
+{0x16b10,0xc3981},
+{0x16b11,0xc39a1},
+{0x16b12,0xc39c1},
+{0x16b13,0xc39e1},
+{0x16b14,0xc3a01},
+{0x16b15,0xc3a21},
+{0x16b16,0xc3a41},
+{0x16b17,0xc3a61},
+{0x16b18,0xc3a81},
+{0x16b19,0xc3aa1},
+{0x16b1a,0xc3ac1},
+{0x16b1b,0xc3ae1},
+{0x16b1c,0xc3b01},
+{0x16b1d,0xc3b21},
+{0x16b1e,0xc3b41},
+{0x16b1f,0xc3b61},
+{0x16b20,0xc3b81},
+{0x16b21,0xc3ba1},
+{0x16b22,0xc3bc1},
+{0x16b23,0xc3be1},
+{0x16b24,0xc3c01},
+{0x16b25,0xc3c21},
+{0x16b26,0xc3c41},
+{0x16b27,0xc3c61},
+{0x16b28,0xc3c81},
+{0x16b29,0xc3ca1},
+{0x16b2a,0xc3cc1},
+{0x16b2b,0xc3ce1},
+{0x16b2c,0xc3d01},
+{0x16b2d,0xc3d21},
+{0x16b2e,0xc3d41},
+{0x16b2f,0xc3d61},
+{0x16b30,0x372e1},
+{0x16b31,0x37301},
+{0x16b32,0x37321},
+{0x16b33,0x37341},
+{0x16b34,0x37361},
+{0x16b35,0x37381},
+{0x16b36,0x373a1},
+{0x16b37,0x1f8a1},
+{0x16b38,0x1f8c1},
+{0x16b39,0x1f8e1},
+{0x16b3a,0x1f901},
+{0x16b3b,0x1f921},
+{0x16b3c,0x1f941},
+{0x16b3d,0x1f961},
+{0x16b3e,0x1f981},
+{0x16b3f,0x1f9a1},
+{0x16b40,0xc3d81},
+{0x16b41,0xc3da1},
+{0x16b42,0x37801},
+{0x16b43,0x37821},
+{0x16b44,0x1f9c1},
+{0x16b45,0x1f9e1},
+{0x16b50,0x380c1},
+{0x16b51,0x382e1},
+{0x16b52,0x3a041},
+{0x16b53,0x3aec1},
+{0x16b54,0x3b641},
+{0x16b55,0x3bc01},
+{0x16b56,0x3bfe1},
+{0x16b57,0x3c301},
+{0x16b58,0x3c681},
+{0x16b59,0x3c9a1},
+{0x16b5b,0x1fa01},
+{0x16b5c,0x1fa21},
+{0x16b5d,0x1fa41},
+{0x16b5e,0x1fa61},
+{0x16b5f,0x1fa81},
+{0x16b60,0x1faa1},
+{0x16b61,0x1fac1},
+{0x16b63,0xc3dc1},
+{0x16b64,0xc3de1},
+{0x16b65,0xc3e01},
+{0x16b66,0xc3e21},
+{0x16b67,0xc3e41},
+{0x16b68,0xc3e61},
+{0x16b69,0xc3e81},
+{0x16b6a,0xc3ea1},
+{0x16b6b,0xc3ec1},
+{0x16b6c,0xc3ee1},
+{0x16b6d,0xc3f01},
+{0x16b6e,0xc3f21},
+{0x16b6f,0xc3f41},
+{0x16b70,0xc3f61},
+{0x16b71,0xc3f81},
+{0x16b72,0xc3fa1},
+{0x16b73,0xc3fc1},
+{0x16b74,0xc3fe1},
+{0x16b75,0xc4001},
+{0x16b76,0xc4021},
+{0x16b77,0xc4041},
+{0x16b7d,0xc4061},
+{0x16b7e,0xc4081},
+{0x16b7f,0xc40a1},
+{0x16b80,0xc40c1},
+{0x16b81,0xc40e1},
+{0x16b82,0xc4101},
+{0x16b83,0xc4121},
+{0x16b84,0xc4141},
+{0x16b85,0xc4161},
+{0x16b86,0xc4181},
+{0x16b87,0xc41a1},
+{0x16b88,0xc41c1},
+{0x16b89,0xc41e1},
+{0x16b8a,0xc4201},
+{0x16b8b,0xc4221},
+{0x16b8c,0xc4241},
+{0x16b8d,0xc4261},
+{0x16b8e,0xc4281},
+{0x16b8f,0xc42a1},
+{0x16f00,0xc17a1},
+{0x16f01,0xc17c1},
+{0x16f02,0xc17e1},
+{0x16f03,0xc1801},
+{0x16f04,0xc1821},
+{0x16f05,0xc1861},
+{0x16f06,0xc1841},
+{0x16f07,0xc1881},
+{0x16f08,0xc18a1},
+{0x16f09,0xc18c1},
+{0x16f0a,0xc18e1},
+{0x16f0b,0xc1901},
+{0x16f0c,0xc1921},
+{0x16f0d,0xc1941},
+{0x16f0e,0xc1961},
+{0x16f0f,0xc1981},
+{0x16f10,0xc19a1},
+{0x16f11,0xc19e1},
+{0x16f12,0xc1a01},
+{0x16f13,0xc19c1},
+{0x16f14,0xc1a21},
+{0x16f15,0xc1a41},
+{0x16f16,0xc1a61},
+{0x16f17,0xc1a81},
+{0x16f18,0xc1aa1},
+{0x16f19,0xc1ac1},
+{0x16f1a,0xc1ae1},
+{0x16f1b,0xc1b01},
+{0x16f1c,0xc1b21},
+{0x16f1d,0xc1b41},
+{0x16f1e,0xc1b61},
+{0x16f1f,0xc1b81},
+{0x16f20,0xc1ba1},
+{0x16f21,0xc1bc1},
+{0x16f22,0xc1be1},
+{0x16f23,0xc1c01},
+{0x16f24,0xc1c41},
+{0x16f25,0xc1c21},
+{0x16f26,0xc1c61},
+{0x16f27,0xc1c81},
+{0x16f28,0xc1ca1},
+{0x16f29,0xc1cc1},
+{0x16f2a,0xc1ce1},
+{0x16f2b,0xc1d01},
+{0x16f2c,0xc1d21},
+{0x16f2d,0xc1d41},
+{0x16f2e,0xc1d61},
+{0x16f2f,0xc1d81},
+{0x16f30,0xc1da1},
+{0x16f31,0xc1dc1},
+{0x16f32,0xc1de1},
+{0x16f33,0xc1e01},
+{0x16f34,0xc1e21},
+{0x16f35,0xc1e41},
+{0x16f36,0xc1e61},
+{0x16f37,0xc1e81},
+{0x16f38,0xc1ea1},
+{0x16f39,0xc1ec1},
+{0x16f3a,0xc1ee1},
+{0x16f3b,0xc1f01},
+{0x16f3c,0xc1f21},
+{0x16f3d,0xc1f41},
+{0x16f3e,0xc1f81},
+{0x16f3f,0xc1f61},
+{0x16f40,0xc1fa1},
+{0x16f41,0xc1fc1},
+{0x16f42,0xc1fe1},
+{0x16f43,0xc2001},
+{0x16f44,0xc2021},
+{0x16f50,0xc2041},
+{0x16f51,0xc2061},
+{0x16f52,0xc2081},
+{0x16f53,0xc20a1},
+{0x16f54,0xc20c1},
+{0x16f55,0xc20e1},
+{0x16f56,0xc2101},
+{0x16f57,0xc2121},
+{0x16f58,0xc2141},
+{0x16f59,0xc2161},
+{0x16f5a,0xc2181},
+{0x16f5b,0xc21a1},
+{0x16f5c,0xc21c1},
+{0x16f5d,0xc21e1},
+{0x16f5e,0xc2201},
+{0x16f5f,0xc2221},
+{0x16f60,0xc2241},
+{0x16f61,0xc2261},
+{0x16f62,0xc2281},
+{0x16f63,0xc22a1},
+{0x16f64,0xc22c1},
+{0x16f65,0xc22e1},
+{0x16f66,0xc2301},
+{0x16f67,0xc2321},
+{0x16f68,0xc2341},
+{0x16f69,0xc2361},
+{0x16f6a,0xc2381},
+{0x16f6b,0xc23a1},
+{0x16f6c,0xc23c1},
+{0x16f6d,0xc23e1},
+{0x16f6e,0xc2401},
+{0x16f6f,0xc2421},
+{0x16f70,0xc2441},
+{0x16f71,0xc2461},
+{0x16f72,0xc2481},
+{0x16f73,0xc24a1},
+{0x16f74,0xc24c1},
+{0x16f75,0xc24e1},
+{0x16f76,0xc2501},
+{0x16f77,0xc2521},
+{0x16f78,0xc2541},
+{0x16f79,0xc2561},
+{0x16f7a,0xc2581},
+{0x16f7b,0xc25a1},
+{0x16f7c,0xc25c1},
+{0x16f7d,0xc25e1},
+{0x16f7e,0xc2601},
+{0x16f8f,0xc2621},
+{0x16f90,0xc2641},
+{0x16f91,0xc2661},
+{0x16f92,0xc2681},
+{0x16f93,0xc26a1},
+{0x16f94,0xc26c1},
+{0x16f95,0xc26e1},
+{0x16f96,0xc2701},
+{0x16f97,0xc2721},
+{0x16f98,0xc2741},
+{0x16f99,0xc2761},
+{0x16f9a,0xc2781},
+{0x16f9b,0xc27a1},
+{0x16f9c,0xc27c1},
+{0x16f9d,0xc27e1},
+{0x16f9e,0xc2801},
+{0x16f9f,0xc2821},
+{0x1b000,0xb2361},
+{0x1b001,0xb7601},
+{0x1bc00,0xc6721},
+{0x1bc01,0xc6741},
+{0x1bc02,0xc6761},
+{0x1bc03,0xc6781},
+{0x1bc04,0xc67a1},
+{0x1bc05,0xc67c1},
+{0x1bc06,0xc67e1},
+{0x1bc07,0xc6801},
+{0x1bc08,0xc6821},
+{0x1bc09,0xc6841},
+{0x1bc0a,0xc6861},
+{0x1bc0b,0xc6881},
+{0x1bc0c,0xc68a1},
+{0x1bc0d,0xc68c1},
+{0x1bc0e,0xc68e1},
+{0x1bc0f,0xc6901},
+{0x1bc10,0xc6921},
+{0x1bc11,0xc6941},
+{0x1bc12,0xc6961},
+{0x1bc13,0xc6981},
+{0x1bc14,0xc69a1},
+{0x1bc15,0xc69c1},
+{0x1bc16,0xc69e1},
+{0x1bc17,0xc6a01},
+{0x1bc18,0xc6a21},
+{0x1bc19,0xc6a41},
+{0x1bc1a,0xc6a61},
+{0x1bc1b,0xc6a81},
+{0x1bc1c,0xc6aa1},
+{0x1bc1d,0xc6ac1},
+{0x1bc1e,0xc6ae1},
+{0x1bc1f,0xc6b01},
+{0x1bc20,0xc6b21},
+{0x1bc21,0xc6b41},
+{0x1bc22,0xc6b61},
+{0x1bc23,0xc6b81},
+{0x1bc24,0xc6ba1},
+{0x1bc25,0xc6bc1},
+{0x1bc26,0xc6be1},
+{0x1bc27,0xc6c01},
+{0x1bc28,0xc6c21},
+{0x1bc29,0xc6c41},
+{0x1bc2a,0xc6c61},
+{0x1bc2b,0xc6c81},
+{0x1bc2c,0xc6ca1},
+{0x1bc2d,0xc6cc1},
+{0x1bc2e,0xc6ce1},
+{0x1bc2f,0xc6d01},
+{0x1bc30,0xc6d21},
+{0x1bc31,0xc6d41},
+{0x1bc32,0xc6d61},
+{0x1bc33,0xc6d81},
+{0x1bc34,0xc6da1},
+{0x1bc35,0xc6dc1},
+{0x1bc36,0xc6de1},
+{0x1bc37,0xc6e01},
+{0x1bc38,0xc6e21},
+{0x1bc39,0xc6e41},
+{0x1bc3a,0xc6e61},
+{0x1bc3b,0xc6e81},
+{0x1bc3c,0xc6ea1},
+{0x1bc3d,0xc6ec1},
+{0x1bc3e,0xc6ee1},
+{0x1bc3f,0xc6f01},
+{0x1bc40,0xc6f21},
+{0x1bc41,0xc6f41},
+{0x1bc42,0xc6f61},
+{0x1bc43,0xc6f81},
+{0x1bc44,0xc6fa1},
+{0x1bc45,0xc6fc1},
+{0x1bc46,0xc6fe1},
+{0x1bc47,0xc7001},
+{0x1bc48,0xc7021},
+{0x1bc49,0xc7041},
+{0x1bc4a,0xc7061},
+{0x1bc4b,0xc7081},
+{0x1bc4c,0xc70a1},
+{0x1bc4d,0xc70c1},
+{0x1bc4e,0xc70e1},
+{0x1bc4f,0xc7101},
+{0x1bc50,0xc7121},
+{0x1bc51,0xc7141},
+{0x1bc52,0xc7161},
+{0x1bc53,0xc7181},
+{0x1bc54,0xc71a1},
+{0x1bc55,0xc71c1},
+{0x1bc56,0xc71e1},
+{0x1bc57,0xc7201},
+{0x1bc58,0xc7221},
+{0x1bc59,0xc7241},
+{0x1bc5a,0xc7261},
+{0x1bc5b,0xc7281},
+{0x1bc5c,0xc72a1},
+{0x1bc5d,0xc72c1},
+{0x1bc5e,0xc72e1},
+{0x1bc5f,0xc7301},
+{0x1bc60,0xc7321},
+{0x1bc61,0xc7341},
+{0x1bc62,0xc7361},
+{0x1bc63,0xc7381},
+{0x1bc64,0xc73a1},
+{0x1bc65,0xc73c1},
+{0x1bc66,0xc73e1},
+{0x1bc67,0xc7401},
+{0x1bc68,0xc7421},
+{0x1bc69,0xc7441},
+{0x1bc6a,0xc7461},
+{0x1bc70,0xc7481},
+{0x1bc71,0xc74a1},
+{0x1bc72,0xc74c1},
+{0x1bc73,0xc74e1},
+{0x1bc74,0xc7501},
+{0x1bc75,0xc7521},
+{0x1bc76,0xc7541},
+{0x1bc77,0xc7561},
+{0x1bc78,0xc7581},
+{0x1bc79,0xc75a1},
+{0x1bc7a,0xc75c1},
+{0x1bc7b,0xc75e1},
+{0x1bc7c,0xc7601},
+{0x1bc80,0xc7621},
+{0x1bc81,0xc7641},
+{0x1bc82,0xc7661},
+{0x1bc83,0xc7681},
+{0x1bc84,0xc76a1},
+{0x1bc85,0xc76c1},
+{0x1bc86,0xc76e1},
+{0x1bc87,0xc7701},
+{0x1bc88,0xc7721},
+{0x1bc90,0xc7741},
+{0x1bc91,0xc7761},
+{0x1bc92,0xc7781},
+{0x1bc93,0xc77a1},
+{0x1bc94,0xc77c1},
+{0x1bc95,0xc77e1},
+{0x1bc96,0xc7801},
+{0x1bc97,0xc7821},
+{0x1bc98,0xc7841},
+{0x1bc99,0xc7861},
+{0x1bc9c,0x1fae1},
+{0x1bc9d,0x35701},
+{0x1bc9e,0x35741},
+{0x1bc9f,0x1fb01},
+{0x1bca0,0x1},
+{0x1bca1,0x1},
+{0x1bca2,0x1},
+{0x1bca3,0x1},
+{0x1d000,0x1fb21},
+{0x1d001,0x1fb41},
+{0x1d002,0x1fb61},
+{0x1d003,0x1fb81},
+{0x1d004,0x1fba1},
+{0x1d005,0x1fbc1},
+{0x1d006,0x1fbe1},
+{0x1d007,0x1fc01},
+{0x1d008,0x1fc21},
+{0x1d009,0x1fc41},
+{0x1d00a,0x1fc61},
+{0x1d00b,0x1fc81},
+{0x1d00c,0x1fca1},
+{0x1d00d,0x1fcc1},
+{0x1d00e,0x1fce1},
+{0x1d00f,0x1fd01},
+{0x1d010,0x1fd21},
+{0x1d011,0x1fd41},
+{0x1d012,0x1fd61},
+{0x1d013,0x1fd81},
+{0x1d014,0x1fda1},
+{0x1d015,0x1fdc1},
+{0x1d016,0x1fde1},
+{0x1d017,0x1fe01},
+{0x1d018,0x1fe21},
+{0x1d019,0x1fe41},
+{0x1d01a,0x1fe61},
+{0x1d01b,0x1fe81},
+{0x1d01c,0x1fea1},
+{0x1d01d,0x1fec1},
+{0x1d01e,0x1fee1},
+{0x1d01f,0x1ff01},
+{0x1d020,0x1ff21},
+{0x1d021,0x1ff41},
+{0x1d022,0x1ff61},
+{0x1d023,0x1ff81},
+{0x1d024,0x1ffa1},
+{0x1d025,0x1ffc1},
+{0x1d026,0x1ffe1},
+{0x1d027,0x20001},
+{0x1d028,0x20021},
+{0x1d029,0x20041},
+{0x1d02a,0x20061},
+{0x1d02b,0x20081},
+{0x1d02c,0x200a1},
+{0x1d02d,0x200c1},
+{0x1d02e,0x200e1},
+{0x1d02f,0x20101},
+{0x1d030,0x20121},
+{0x1d031,0x20141},
+{0x1d032,0x20161},
+{0x1d033,0x20181},
+{0x1d034,0x201a1},
+{0x1d035,0x201c1},
+{0x1d036,0x201e1},
+{0x1d037,0x20201},
+{0x1d038,0x20221},
+{0x1d039,0x20241},
+{0x1d03a,0x20261},
+{0x1d03b,0x20281},
+{0x1d03c,0x202a1},
+{0x1d03d,0x202c1},
+{0x1d03e,0x202e1},
+{0x1d03f,0x20301},
+{0x1d040,0x20321},
+{0x1d041,0x20341},
+{0x1d042,0x20361},
+{0x1d043,0x20381},
+{0x1d044,0x203a1},
+{0x1d045,0x203c1},
+{0x1d046,0x203e1},
+{0x1d047,0x20401},
+{0x1d048,0x20421},
+{0x1d049,0x20441},
+{0x1d04a,0x20461},
+{0x1d04b,0x20481},
+{0x1d04c,0x204a1},
+{0x1d04d,0x204c1},
+{0x1d04e,0x204e1},
+{0x1d04f,0x20501},
+{0x1d050,0x20521},
+{0x1d051,0x20541},
+{0x1d052,0x20561},
+{0x1d053,0x20581},
+{0x1d054,0x205a1},
+{0x1d055,0x205c1},
+{0x1d056,0x205e1},
+{0x1d057,0x20601},
+{0x1d058,0x20621},
+{0x1d059,0x20641},
+{0x1d05a,0x20661},
+{0x1d05b,0x20681},
+{0x1d05c,0x206a1},
+{0x1d05d,0x206c1},
+{0x1d05e,0x206e1},
+{0x1d05f,0x20701},
+{0x1d060,0x20721},
+{0x1d061,0x20741},
+{0x1d062,0x20761},
+{0x1d063,0x20781},
+{0x1d064,0x207a1},
+{0x1d065,0x207c1},
+{0x1d066,0x207e1},
+{0x1d067,0x20801},
+{0x1d068,0x20821},
+{0x1d069,0x20841},
+{0x1d06a,0x20861},
+{0x1d06b,0x20881},
+{0x1d06c,0x208a1},
+{0x1d06d,0x208c1},
+{0x1d06e,0x208e1},
+{0x1d06f,0x20901},
+{0x1d070,0x20921},
+{0x1d071,0x20941},
+{0x1d072,0x20961},
+{0x1d073,0x20981},
+{0x1d074,0x209a1},
+{0x1d075,0x209c1},
+{0x1d076,0x209e1},
+{0x1d077,0x20a01},
+{0x1d078,0x20a21},
+{0x1d079,0x20a41},
+{0x1d07a,0x20a61},
+{0x1d07b,0x20a81},
+{0x1d07c,0x20aa1},
+{0x1d07d,0x20ac1},
+{0x1d07e,0x20ae1},
+{0x1d07f,0x20b01},
+{0x1d080,0x20b21},
+{0x1d081,0x20b41},
+{0x1d082,0x20b61},
+{0x1d083,0x20b81},
+{0x1d084,0x20ba1},
+{0x1d085,0x20bc1},
+{0x1d086,0x20be1},
+{0x1d087,0x20c01},
+{0x1d088,0x20c21},
+{0x1d089,0x20c41},
+{0x1d08a,0x20c61},
+{0x1d08b,0x20c81},
+{0x1d08c,0x20ca1},
+{0x1d08d,0x20cc1},
+{0x1d08e,0x20ce1},
+{0x1d08f,0x20d01},
+{0x1d090,0x20d21},
+{0x1d091,0x20d41},
+{0x1d092,0x20d61},
+{0x1d093,0x20d81},
+{0x1d094,0x20da1},
+{0x1d095,0x20dc1},
+{0x1d096,0x20de1},
+{0x1d097,0x20e01},
+{0x1d098,0x20e21},
+{0x1d099,0x20e41},
+{0x1d09a,0x20e61},
+{0x1d09b,0x20e81},
+{0x1d09c,0x20ea1},
+{0x1d09d,0x20ec1},
+{0x1d09e,0x20ee1},
+{0x1d09f,0x20f01},
+{0x1d0a0,0x20f21},
+{0x1d0a1,0x20f41},
+{0x1d0a2,0x20f61},
+{0x1d0a3,0x20f81},
+{0x1d0a4,0x20fa1},
+{0x1d0a5,0x20fc1},
+{0x1d0a6,0x20fe1},
+{0x1d0a7,0x21001},
+{0x1d0a8,0x21021},
+{0x1d0a9,0x21041},
+{0x1d0aa,0x21061},
+{0x1d0ab,0x21081},
+{0x1d0ac,0x210a1},
+{0x1d0ad,0x210c1},
+{0x1d0ae,0x210e1},
+{0x1d0af,0x21101},
+{0x1d0b0,0x21121},
+{0x1d0b1,0x21141},
+{0x1d0b2,0x21161},
+{0x1d0b3,0x21181},
+{0x1d0b4,0x211a1},
+{0x1d0b5,0x211c1},
+{0x1d0b6,0x211e1},
+{0x1d0b7,0x21201},
+{0x1d0b8,0x21221},
+{0x1d0b9,0x21241},
+{0x1d0ba,0x21261},
+{0x1d0bb,0x21281},
+{0x1d0bc,0x212a1},
+{0x1d0bd,0x212c1},
+{0x1d0be,0x212e1},
+{0x1d0bf,0x21301},
+{0x1d0c0,0x21321},
+{0x1d0c1,0x21341},
+{0x1d0c2,0x21361},
+{0x1d0c3,0x21381},
+{0x1d0c4,0x213a1},
+{0x1d0c5,0x213c1},
+{0x1d0c6,0x213e1},
+{0x1d0c7,0x21401},
+{0x1d0c8,0x21421},
+{0x1d0c9,0x21441},
+{0x1d0ca,0x21461},
+{0x1d0cb,0x21481},
+{0x1d0cc,0x214a1},
+{0x1d0cd,0x214c1},
+{0x1d0ce,0x214e1},
+{0x1d0cf,0x21501},
+{0x1d0d0,0x21521},
+{0x1d0d1,0x21541},
+{0x1d0d2,0x21561},
+{0x1d0d3,0x21581},
+{0x1d0d4,0x215a1},
+{0x1d0d5,0x215c1},
+{0x1d0d6,0x215e1},
+{0x1d0d7,0x21601},
+{0x1d0d8,0x21621},
+{0x1d0d9,0x21641},
+{0x1d0da,0x21661},
+{0x1d0db,0x21681},
+{0x1d0dc,0x216a1},
+{0x1d0dd,0x216c1},
+{0x1d0de,0x216e1},
+{0x1d0df,0x21701},
+{0x1d0e0,0x21721},
+{0x1d0e1,0x21741},
+{0x1d0e2,0x21761},
+{0x1d0e3,0x21781},
+{0x1d0e4,0x217a1},
+{0x1d0e5,0x217c1},
+{0x1d0e6,0x217e1},
+{0x1d0e7,0x21801},
+{0x1d0e8,0x21821},
+{0x1d0e9,0x21841},
+{0x1d0ea,0x21861},
+{0x1d0eb,0x21881},
+{0x1d0ec,0x218a1},
+{0x1d0ed,0x218c1},
+{0x1d0ee,0x218e1},
+{0x1d0ef,0x21901},
+{0x1d0f0,0x21921},
+{0x1d0f1,0x21941},
+{0x1d0f2,0x21961},
+{0x1d0f3,0x21981},
+{0x1d0f4,0x219a1},
+{0x1d0f5,0x219c1},
+{0x1d100,0x219e1},
+{0x1d101,0x21a01},
+{0x1d102,0x21a21},
+{0x1d103,0x21a41},
+{0x1d104,0x21a61},
+{0x1d105,0x21a81},
+{0x1d106,0x21aa1},
+{0x1d107,0x21ac1},
+{0x1d108,0x21ae1},
+{0x1d109,0x21b01},
+{0x1d10a,0x21b21},
+{0x1d10b,0x21b41},
+{0x1d10c,0x21b61},
+{0x1d10d,0x21b81},
+{0x1d10e,0x21ba1},
+{0x1d10f,0x21bc1},
+{0x1d110,0x21be1},
+{0x1d111,0x21c01},
+{0x1d112,0x21c21},
+{0x1d113,0x21c41},
+{0x1d114,0x21c61},
+{0x1d115,0x21c81},
+{0x1d116,0x21ca1},
+{0x1d117,0x21cc1},
+{0x1d118,0x21ce1},
+{0x1d119,0x21d01},
+{0x1d11a,0x21d21},
+{0x1d11b,0x21d41},
+{0x1d11c,0x21d61},
+{0x1d11d,0x21d81},
+{0x1d11e,0x21da1},
+{0x1d11f,0x21dc1},
+{0x1d120,0x21de1},
+{0x1d121,0x21e01},
+{0x1d122,0x21e21},
+{0x1d123,0x21e41},
+{0x1d124,0x21e61},
+{0x1d125,0x21e81},
+{0x1d126,0x21ea1},
+{0x1d129,0x21ec1},
+{0x1d12a,0x21ee1},
+{0x1d12b,0x21f01},
+{0x1d12c,0x21f21},
+{0x1d12d,0x21f41},
+{0x1d12e,0x21f61},
+{0x1d12f,0x21f81},
+{0x1d130,0x21fa1},
+{0x1d131,0x21fc1},
+{0x1d132,0x21fe1},
+{0x1d133,0x22001},
+{0x1d134,0x22021},
+{0x1d135,0x22041},
+{0x1d136,0x22061},
+{0x1d137,0x22081},
+{0x1d138,0x220a1},
+{0x1d139,0x220c1},
+{0x1d13a,0x220e1},
+{0x1d13b,0x22101},
+{0x1d13c,0x22121},
+{0x1d13d,0x22141},
+{0x1d13e,0x22161},
+{0x1d13f,0x22181},
+{0x1d140,0x221a1},
+{0x1d141,0x221c1},
+{0x1d142,0x221e1},
+{0x1d143,0x22201},
+{0x1d144,0x22221},
+{0x1d145,0x22241},
+{0x1d146,0x22261},
+{0x1d147,0x22281},
+{0x1d148,0x222a1},
+{0x1d149,0x222c1},
+{0x1d14a,0x222e1},
+{0x1d14b,0x22301},
+{0x1d14c,0x22321},
+{0x1d14d,0x22341},
+{0x1d14e,0x22361},
+{0x1d14f,0x22381},
+{0x1d150,0x223a1},
+{0x1d151,0x223c1},
+{0x1d152,0x223e1},
+{0x1d153,0x22401},
+{0x1d154,0x22421},
+{0x1d155,0x22441},
+{0x1d156,0x22461},
+{0x1d157,0x22481},
+{0x1d158,0x224a1},
+{0x1d159,0x224c1},
+{0x1d15a,0x224e1},
+{0x1d15b,0x22501},
+{0x1d15c,0x22521},
+{0x1d15d,0x22541},
+{0x1d15e,0x22562},
+{0x1d15f,0x225a2},
+{0x1d160,0x225e3},
+{0x1d161,0x225e3},
+{0x1d162,0x225e3},
+{0x1d163,0x225e3},
+{0x1d164,0x225e3},
+{0x1d165,0x1},
+{0x1d166,0x1},
+{0x1d167,0x1},
+{0x1d168,0x1},
+{0x1d169,0x1},
+{0x1d16a,0x22641},
+{0x1d16b,0x22661},
+{0x1d16c,0x22681},
+{0x1d16d,0x1},
+{0x1d16e,0x1},
+{0x1d16f,0x1},
+{0x1d170,0x1},
+{0x1d171,0x1},
+{0x1d172,0x1},
+{0x1d173,0x1},
+{0x1d174,0x1},
+{0x1d175,0x1},
+{0x1d176,0x1},
+{0x1d177,0x1},
+{0x1d178,0x1},
+{0x1d179,0x1},
+{0x1d17a,0x1},
+{0x1d17b,0x1},
+{0x1d17c,0x1},
+{0x1d17d,0x1},
+{0x1d17e,0x1},
+{0x1d17f,0x1},
+{0x1d180,0x1},
+{0x1d181,0x1},
+{0x1d182,0x1},
+{0x1d183,0x226a1},
+{0x1d184,0x226c1},
+{0x1d185,0x1},
+{0x1d186,0x1},
+{0x1d187,0x1},
+{0x1d188,0x1},
+{0x1d189,0x1},
+{0x1d18a,0x1},
+{0x1d18b,0x1},
+{0x1d18c,0x226e1},
+{0x1d18d,0x22701},
+{0x1d18e,0x22721},
+{0x1d18f,0x22741},
+{0x1d190,0x22761},
+{0x1d191,0x22781},
+{0x1d192,0x227a1},
+{0x1d193,0x227c1},
+{0x1d194,0x227e1},
+{0x1d195,0x22801},
+{0x1d196,0x22821},
+{0x1d197,0x22841},
+{0x1d198,0x22861},
+{0x1d199,0x22881},
+{0x1d19a,0x228a1},
+{0x1d19b,0x228c1},
+{0x1d19c,0x228e1},
+{0x1d19d,0x22901},
+{0x1d19e,0x22921},
+{0x1d19f,0x22941},
+{0x1d1a0,0x22961},
+{0x1d1a1,0x22981},
+{0x1d1a2,0x229a1},
+{0x1d1a3,0x229c1},
+{0x1d1a4,0x229e1},
+{0x1d1a5,0x22a01},
+{0x1d1a6,0x22a21},
+{0x1d1a7,0x22a41},
+{0x1d1a8,0x22a61},
+{0x1d1a9,0x22a81},
+{0x1d1aa,0x1},
+{0x1d1ab,0x1},
+{0x1d1ac,0x1},
+{0x1d1ad,0x1},
+{0x1d1ae,0x22aa1},
+{0x1d1af,0x22ac1},
+{0x1d1b0,0x22ae1},
+{0x1d1b1,0x22b01},
+{0x1d1b2,0x22b21},
+{0x1d1b3,0x22b41},
+{0x1d1b4,0x22b61},
+{0x1d1b5,0x22b81},
+{0x1d1b6,0x22ba1},
+{0x1d1b7,0x22bc1},
+{0x1d1b8,0x22be1},
+{0x1d1b9,0x22c01},
+{0x1d1ba,0x22c21},
+{0x1d1bb,0x22c42},
+{0x1d1bc,0x22c82},
+{0x1d1bd,0x22cc3},
+{0x1d1be,0x22d23},
+{0x1d1bf,0x22cc3},
+{0x1d1c0,0x22d23},
+{0x1d1c1,0x22d81},
+{0x1d1c2,0x22da1},
+{0x1d1c3,0x22dc1},
+{0x1d1c4,0x22de1},
+{0x1d1c5,0x22e01},
+{0x1d1c6,0x22e21},
+{0x1d1c7,0x22e41},
+{0x1d1c8,0x22e61},
+{0x1d1c9,0x22e81},
+{0x1d1ca,0x22ea1},
+{0x1d1cb,0x22ec1},
+{0x1d1cc,0x22ee1},
+{0x1d1cd,0x22f01},
+{0x1d1ce,0x22f21},
+{0x1d1cf,0x22f41},
+{0x1d1d0,0x22f61},
+{0x1d1d1,0x22f81},
+{0x1d1d2,0x22fa1},
+{0x1d1d3,0x22fc1},
+{0x1d1d4,0x22fe1},
+{0x1d1d5,0x23001},
+{0x1d1d6,0x23021},
+{0x1d1d7,0x23041},
+{0x1d1d8,0x23061},
+{0x1d1d9,0x23081},
+{0x1d1da,0x230a1},
+{0x1d1db,0x230c1},
+{0x1d1dc,0x230e1},
+{0x1d1dd,0x23101},
+{0x1d1de,0x23121},
+{0x1d1df,0x23141},
+{0x1d1e0,0x23161},
+{0x1d1e1,0x23181},
+{0x1d1e2,0x231a1},
+{0x1d1e3,0x231c1},
+{0x1d1e4,0x231e1},
+{0x1d1e5,0x23201},
+{0x1d1e6,0x23221},
+{0x1d1e7,0x23241},
+{0x1d1e8,0x23261},
+{0x1d200,0x23281},
+{0x1d201,0x232a1},
+{0x1d202,0x232c1},
+{0x1d203,0x232e1},
+{0x1d204,0x23301},
+{0x1d205,0x23321},
+{0x1d206,0x23341},
+{0x1d207,0x23361},
+{0x1d208,0x23381},
+{0x1d209,0x233a1},
+{0x1d20a,0x233c1},
+{0x1d20b,0x233e1},
+{0x1d20c,0x23401},
+{0x1d20d,0x23421},
+{0x1d20e,0x23441},
+{0x1d20f,0x23461},
+{0x1d210,0x23481},
+{0x1d211,0x234a1},
+{0x1d212,0x234c1},
+{0x1d213,0x234e1},
+{0x1d214,0x23501},
+{0x1d215,0x23521},
+{0x1d216,0x23541},
+{0x1d217,0x23561},
+{0x1d218,0x23581},
+{0x1d219,0x235a1},
+{0x1d21a,0x235c1},
+{0x1d21b,0x235e1},
+{0x1d21c,0x23601},
+{0x1d21d,0x23621},
+{0x1d21e,0x23641},
+{0x1d21f,0x23661},
+{0x1d220,0x23681},
+{0x1d221,0x236a1},
+{0x1d222,0x236c1},
+{0x1d223,0x236e1},
+{0x1d224,0x23701},
+{0x1d225,0x23721},
+{0x1d226,0x23741},
+{0x1d227,0x23761},
+{0x1d228,0x23781},
+{0x1d229,0x237a1},
+{0x1d22a,0x237c1},
+{0x1d22b,0x237e1},
+{0x1d22c,0x23801},
+{0x1d22d,0x23821},
+{0x1d22e,0x23841},
+{0x1d22f,0x23861},
+{0x1d230,0x23881},
+{0x1d231,0x238a1},
+{0x1d232,0x238c1},
+{0x1d233,0x238e1},
+{0x1d234,0x23901},
+{0x1d235,0x23921},
+{0x1d236,0x23941},
+{0x1d237,0x23961},
+{0x1d238,0x23981},
+{0x1d239,0x239a1},
+{0x1d23a,0x239c1},
+{0x1d23b,0x239e1},
+{0x1d23c,0x23a01},
+{0x1d23d,0x23a21},
+{0x1d23e,0x23a41},
+{0x1d23f,0x23a61},
+{0x1d240,0x23a81},
+{0x1d241,0x23aa1},
+{0x1d242,0x1},
+{0x1d243,0x1},
+{0x1d244,0x1},
+{0x1d245,0x23ac1},
+{0x1d300,0x23ae1},
+{0x1d301,0x23b01},
+{0x1d302,0x23b21},
+{0x1d303,0x23b41},
+{0x1d304,0x23b61},
+{0x1d305,0x23b81},
+{0x1d306,0x23ba1},
+{0x1d307,0x23bc1},
+{0x1d308,0x23be1},
+{0x1d309,0x23c01},
+{0x1d30a,0x23c21},
+{0x1d30b,0x23c41},
+{0x1d30c,0x23c61},
+{0x1d30d,0x23c81},
+{0x1d30e,0x23ca1},
+{0x1d30f,0x23cc1},
+{0x1d310,0x23ce1},
+{0x1d311,0x23d01},
+{0x1d312,0x23d21},
+{0x1d313,0x23d41},
+{0x1d314,0x23d61},
+{0x1d315,0x23d81},
+{0x1d316,0x23da1},
+{0x1d317,0x23dc1},
+{0x1d318,0x23de1},
+{0x1d319,0x23e01},
+{0x1d31a,0x23e21},
+{0x1d31b,0x23e41},
+{0x1d31c,0x23e61},
+{0x1d31d,0x23e81},
+{0x1d31e,0x23ea1},
+{0x1d31f,0x23ec1},
+{0x1d320,0x23ee1},
+{0x1d321,0x23f01},
+{0x1d322,0x23f21},
+{0x1d323,0x23f41},
+{0x1d324,0x23f61},
+{0x1d325,0x23f81},
+{0x1d326,0x23fa1},
+{0x1d327,0x23fc1},
+{0x1d328,0x23fe1},
+{0x1d329,0x24001},
+{0x1d32a,0x24021},
+{0x1d32b,0x24041},
+{0x1d32c,0x24061},
+{0x1d32d,0x24081},
+{0x1d32e,0x240a1},
+{0x1d32f,0x240c1},
+{0x1d330,0x240e1},
+{0x1d331,0x24101},
+{0x1d332,0x24121},
+{0x1d333,0x24141},
+{0x1d334,0x24161},
+{0x1d335,0x24181},
+{0x1d336,0x241a1},
+{0x1d337,0x241c1},
+{0x1d338,0x241e1},
+{0x1d339,0x24201},
+{0x1d33a,0x24221},
+{0x1d33b,0x24241},
+{0x1d33c,0x24261},
+{0x1d33d,0x24281},
+{0x1d33e,0x242a1},
+{0x1d33f,0x242c1},
+{0x1d340,0x242e1},
+{0x1d341,0x24301},
+{0x1d342,0x24321},
+{0x1d343,0x24341},
+{0x1d344,0x24361},
+{0x1d345,0x24381},
+{0x1d346,0x243a1},
+{0x1d347,0x243c1},
+{0x1d348,0x243e1},
+{0x1d349,0x24401},
+{0x1d34a,0x24421},
+{0x1d34b,0x24441},
+{0x1d34c,0x24461},
+{0x1d34d,0x24481},
+{0x1d34e,0x244a1},
+{0x1d34f,0x244c1},
+{0x1d350,0x244e1},
+{0x1d351,0x24501},
+{0x1d352,0x24521},
+{0x1d353,0x24541},
+{0x1d354,0x24561},
+{0x1d355,0x24581},
+{0x1d356,0x245a1},
+{0x1d360,0x382e1},
+{0x1d361,0x3a041},
+{0x1d362,0x3aec1},
+{0x1d363,0x3b641},
+{0x1d364,0x3bc01},
+{0x1d365,0x3bfe1},
+{0x1d366,0x3c301},
+{0x1d367,0x3c681},
+{0x1d368,0x3c9a1},
+{0x1d369,0x245c1},
+{0x1d36a,0x245e1},
+{0x1d36b,0x24601},
+{0x1d36c,0x24621},
+{0x1d36d,0x24641},
+{0x1d36e,0x24661},
+{0x1d36f,0x24681},
+{0x1d370,0x246a1},
+{0x1d371,0x246c1},
+{0x1d400,0x3ce21},
+{0x1d401,0x3eea1},
+{0x1d402,0x3f541},
+{0x1d403,0x40141},
+{0x1d404,0x40e81},
+{0x1d405,0x42481},
+{0x1d406,0x42be1},
+{0x1d407,0x436a1},
+{0x1d408,0x44141},
+{0x1d409,0x45161},
+{0x1d40a,0x455c1},
+{0x1d40b,0x461a1},
+{0x1d40c,0x47041},
+{0x1d40d,0x47c81},
+{0x1d40e,0x489c1},
+{0x1d40f,0x4aa81},
+{0x1d410,0x4b3e1},
+{0x1d411,0x4b721},
+{0x1d412,0x4c641},
+{0x1d413,0x4d541},
+{0x1d414,0x4e061},
+{0x1d415,0x4f9c1},
+{0x1d416,0x50221},
+{0x1d417,0x508e1},
+{0x1d418,0x50e61},
+{0x1d419,0x51681},
+{0x1d41a,0x3cd41},
+{0x1d41b,0x3edc1},
+{0x1d41c,0x3f401},
+{0x1d41d,0x40041},
+{0x1d41e,0x40da1},
+{0x1d41f,0x42361},
+{0x1d420,0x42b01},
+{0x1d421,0x435c1},
+{0x1d422,0x44041},
+{0x1d423,0x45081},
+{0x1d424,0x454e1},
+{0x1d425,0x460a1},
+{0x1d426,0x46f41},
+{0x1d427,0x47ba1},
+{0x1d428,0x488e1},
+{0x1d429,0x4a9a1},
+{0x1d42a,0x4b301},
+{0x1d42b,0x4b641},
+{0x1d42c,0x4c501},
+{0x1d42d,0x4d461},
+{0x1d42e,0x4df81},
+{0x1d42f,0x4f8c1},
+{0x1d430,0x50141},
+{0x1d431,0x507e1},
+{0x1d432,0x50d81},
+{0x1d433,0x515a1},
+{0x1d434,0x3ce21},
+{0x1d435,0x3eea1},
+{0x1d436,0x3f541},
+{0x1d437,0x40141},
+{0x1d438,0x40e81},
+{0x1d439,0x42481},
+{0x1d43a,0x42be1},
+{0x1d43b,0x436a1},
+{0x1d43c,0x44141},
+{0x1d43d,0x45161},
+{0x1d43e,0x455c1},
+{0x1d43f,0x461a1},
+{0x1d440,0x47041},
+{0x1d441,0x47c81},
+{0x1d442,0x489c1},
+{0x1d443,0x4aa81},
+{0x1d444,0x4b3e1},
+{0x1d445,0x4b721},
+{0x1d446,0x4c641},
+{0x1d447,0x4d541},
+{0x1d448,0x4e061},
+{0x1d449,0x4f9c1},
+{0x1d44a,0x50221},
+{0x1d44b,0x508e1},
+{0x1d44c,0x50e61},
+{0x1d44d,0x51681},
+{0x1d44e,0x3cd41},
+{0x1d44f,0x3edc1},
+{0x1d450,0x3f401},
+{0x1d451,0x40041},
+{0x1d452,0x40da1},
+{0x1d453,0x42361},
+{0x1d454,0x42b01},
+{0x1d456,0x44041},
+{0x1d457,0x45081},
+{0x1d458,0x454e1},
+{0x1d459,0x460a1},
+{0x1d45a,0x46f41},
+{0x1d45b,0x47ba1},
+{0x1d45c,0x488e1},
+{0x1d45d,0x4a9a1},
+{0x1d45e,0x4b301},
+{0x1d45f,0x4b641},
+{0x1d460,0x4c501},
+{0x1d461,0x4d461},
+{0x1d462,0x4df81},
+{0x1d463,0x4f8c1},
+{0x1d464,0x50141},
+{0x1d465,0x507e1},
+{0x1d466,0x50d81},
+{0x1d467,0x515a1},
+{0x1d468,0x3ce21},
+{0x1d469,0x3eea1},
+{0x1d46a,0x3f541},
+{0x1d46b,0x40141},
+{0x1d46c,0x40e81},
+{0x1d46d,0x42481},
+{0x1d46e,0x42be1},
+{0x1d46f,0x436a1},
+{0x1d470,0x44141},
+{0x1d471,0x45161},
+{0x1d472,0x455c1},
+{0x1d473,0x461a1},
+{0x1d474,0x47041},
+{0x1d475,0x47c81},
+{0x1d476,0x489c1},
+{0x1d477,0x4aa81},
+{0x1d478,0x4b3e1},
+{0x1d479,0x4b721},
+{0x1d47a,0x4c641},
+{0x1d47b,0x4d541},
+{0x1d47c,0x4e061},
+{0x1d47d,0x4f9c1},
+{0x1d47e,0x50221},
+{0x1d47f,0x508e1},
+{0x1d480,0x50e61},
+{0x1d481,0x51681},
+{0x1d482,0x3cd41},
+{0x1d483,0x3edc1},
+{0x1d484,0x3f401},
+{0x1d485,0x40041},
+{0x1d486,0x40da1},
+{0x1d487,0x42361},
+{0x1d488,0x42b01},
+{0x1d489,0x435c1},
+{0x1d48a,0x44041},
+{0x1d48b,0x45081},
+{0x1d48c,0x454e1},
+{0x1d48d,0x460a1},
+{0x1d48e,0x46f41},
+{0x1d48f,0x47ba1},
+{0x1d490,0x488e1},
+{0x1d491,0x4a9a1},
+{0x1d492,0x4b301},
+{0x1d493,0x4b641},
+{0x1d494,0x4c501},
+{0x1d495,0x4d461},
+{0x1d496,0x4df81},
+{0x1d497,0x4f8c1},
+{0x1d498,0x50141},
+{0x1d499,0x507e1},
+{0x1d49a,0x50d81},
+{0x1d49b,0x515a1},
+{0x1d49c,0x3ce21},
+{0x1d49e,0x3f541},
+{0x1d49f,0x40141},
+{0x1d4a2,0x42be1},
+{0x1d4a5,0x45161},
+{0x1d4a6,0x455c1},
+{0x1d4a9,0x47c81},
+{0x1d4aa,0x489c1},
+{0x1d4ab,0x4aa81},
+{0x1d4ac,0x4b3e1},
+{0x1d4ae,0x4c641},
+{0x1d4af,0x4d541},
+{0x1d4b0,0x4e061},
+{0x1d4b1,0x4f9c1},
+{0x1d4b2,0x50221},
+{0x1d4b3,0x508e1},
+{0x1d4b4,0x50e61},
+{0x1d4b5,0x51681},
+{0x1d4b6,0x3cd41},
+{0x1d4b7,0x3edc1},
+{0x1d4b8,0x3f401},
+{0x1d4b9,0x40041},
+{0x1d4bb,0x42361},
+{0x1d4bd,0x435c1},
+{0x1d4be,0x44041},
+{0x1d4bf,0x45081},
+{0x1d4c0,0x454e1},
+{0x1d4c1,0x460a1},
+{0x1d4c2,0x46f41},
+{0x1d4c3,0x47ba1},
+{0x1d4c5,0x4a9a1},
+{0x1d4c6,0x4b301},
+{0x1d4c7,0x4b641},
+{0x1d4c8,0x4c501},
+{0x1d4c9,0x4d461},
+{0x1d4ca,0x4df81},
+{0x1d4cb,0x4f8c1},
+{0x1d4cc,0x50141},
+{0x1d4cd,0x507e1},
+{0x1d4ce,0x50d81},
+{0x1d4cf,0x515a1},
+{0x1d4d0,0x3ce21},
+{0x1d4d1,0x3eea1},
+{0x1d4d2,0x3f541},
+{0x1d4d3,0x40141},
+{0x1d4d4,0x40e81},
+{0x1d4d5,0x42481},
+{0x1d4d6,0x42be1},
+{0x1d4d7,0x436a1},
+{0x1d4d8,0x44141},
+{0x1d4d9,0x45161},
+{0x1d4da,0x455c1},
+{0x1d4db,0x461a1},
+{0x1d4dc,0x47041},
+{0x1d4dd,0x47c81},
+{0x1d4de,0x489c1},
+{0x1d4df,0x4aa81},
+{0x1d4e0,0x4b3e1},
+{0x1d4e1,0x4b721},
+{0x1d4e2,0x4c641},
+{0x1d4e3,0x4d541},
+{0x1d4e4,0x4e061},
+{0x1d4e5,0x4f9c1},
+{0x1d4e6,0x50221},
+{0x1d4e7,0x508e1},
+{0x1d4e8,0x50e61},
+{0x1d4e9,0x51681},
+{0x1d4ea,0x3cd41},
+{0x1d4eb,0x3edc1},
+{0x1d4ec,0x3f401},
+{0x1d4ed,0x40041},
+{0x1d4ee,0x40da1},
+{0x1d4ef,0x42361},
+{0x1d4f0,0x42b01},
+{0x1d4f1,0x435c1},
+{0x1d4f2,0x44041},
+{0x1d4f3,0x45081},
+{0x1d4f4,0x454e1},
+{0x1d4f5,0x460a1},
+{0x1d4f6,0x46f41},
+{0x1d4f7,0x47ba1},
+{0x1d4f8,0x488e1},
+{0x1d4f9,0x4a9a1},
+{0x1d4fa,0x4b301},
+{0x1d4fb,0x4b641},
+{0x1d4fc,0x4c501},
+{0x1d4fd,0x4d461},
+{0x1d4fe,0x4df81},
+{0x1d4ff,0x4f8c1},
+{0x1d500,0x50141},
+{0x1d501,0x507e1},
+{0x1d502,0x50d81},
+{0x1d503,0x515a1},
+{0x1d504,0x3ce21},
+{0x1d505,0x3eea1},
+{0x1d507,0x40141},
+{0x1d508,0x40e81},
+{0x1d509,0x42481},
+{0x1d50a,0x42be1},
+{0x1d50d,0x45161},
+{0x1d50e,0x455c1},
+{0x1d50f,0x461a1},
+{0x1d510,0x47041},
+{0x1d511,0x47c81},
+{0x1d512,0x489c1},
+{0x1d513,0x4aa81},
+{0x1d514,0x4b3e1},
+{0x1d516,0x4c641},
+{0x1d517,0x4d541},
+{0x1d518,0x4e061},
+{0x1d519,0x4f9c1},
+{0x1d51a,0x50221},
+{0x1d51b,0x508e1},
+{0x1d51c,0x50e61},
+{0x1d51e,0x3cd41},
+{0x1d51f,0x3edc1},
+{0x1d520,0x3f401},
+{0x1d521,0x40041},
+{0x1d522,0x40da1},
+{0x1d523,0x42361},
+{0x1d524,0x42b01},
+{0x1d525,0x435c1},
+{0x1d526,0x44041},
+{0x1d527,0x45081},
+{0x1d528,0x454e1},
+{0x1d529,0x460a1},
+{0x1d52a,0x46f41},
+{0x1d52b,0x47ba1},
+{0x1d52c,0x488e1},
+{0x1d52d,0x4a9a1},
+{0x1d52e,0x4b301},
+{0x1d52f,0x4b641},
+{0x1d530,0x4c501},
+{0x1d531,0x4d461},
+{0x1d532,0x4df81},
+{0x1d533,0x4f8c1},
+{0x1d534,0x50141},
+{0x1d535,0x507e1},
+{0x1d536,0x50d81},
+{0x1d537,0x515a1},
+{0x1d538,0x3ce21},
+{0x1d539,0x3eea1},
+{0x1d53b,0x40141},
+{0x1d53c,0x40e81},
+{0x1d53d,0x42481},
+{0x1d53e,0x42be1},
+{0x1d540,0x44141},
+{0x1d541,0x45161},
+{0x1d542,0x455c1},
+{0x1d543,0x461a1},
+{0x1d544,0x47041},
+{0x1d546,0x489c1},
+{0x1d54a,0x4c641},
+{0x1d54b,0x4d541},
+{0x1d54c,0x4e061},
+{0x1d54d,0x4f9c1},
+{0x1d54e,0x50221},
+{0x1d54f,0x508e1},
+{0x1d550,0x50e61},
+{0x1d552,0x3cd41},
+{0x1d553,0x3edc1},
+{0x1d554,0x3f401},
+{0x1d555,0x40041},
+{0x1d556,0x40da1},
+{0x1d557,0x42361},
+{0x1d558,0x42b01},
+{0x1d559,0x435c1},
+{0x1d55a,0x44041},
+{0x1d55b,0x45081},
+{0x1d55c,0x454e1},
+{0x1d55d,0x460a1},
+{0x1d55e,0x46f41},
+{0x1d55f,0x47ba1},
+{0x1d560,0x488e1},
+{0x1d561,0x4a9a1},
+{0x1d562,0x4b301},
+{0x1d563,0x4b641},
+{0x1d564,0x4c501},
+{0x1d565,0x4d461},
+{0x1d566,0x4df81},
+{0x1d567,0x4f8c1},
+{0x1d568,0x50141},
+{0x1d569,0x507e1},
+{0x1d56a,0x50d81},
+{0x1d56b,0x515a1},
+{0x1d56c,0x3ce21},
+{0x1d56d,0x3eea1},
+{0x1d56e,0x3f541},
+{0x1d56f,0x40141},
+{0x1d570,0x40e81},
+{0x1d571,0x42481},
+{0x1d572,0x42be1},
+{0x1d573,0x436a1},
+{0x1d574,0x44141},
+{0x1d575,0x45161},
+{0x1d576,0x455c1},
+{0x1d577,0x461a1},
+{0x1d578,0x47041},
+{0x1d579,0x47c81},
+{0x1d57a,0x489c1},
+{0x1d57b,0x4aa81},
+{0x1d57c,0x4b3e1},
+{0x1d57d,0x4b721},
+{0x1d57e,0x4c641},
+{0x1d57f,0x4d541},
+{0x1d580,0x4e061},
+{0x1d581,0x4f9c1},
+{0x1d582,0x50221},
+{0x1d583,0x508e1},
+{0x1d584,0x50e61},
+{0x1d585,0x51681},
+{0x1d586,0x3cd41},
+{0x1d587,0x3edc1},
+{0x1d588,0x3f401},
+{0x1d589,0x40041},
+{0x1d58a,0x40da1},
+{0x1d58b,0x42361},
+{0x1d58c,0x42b01},
+{0x1d58d,0x435c1},
+{0x1d58e,0x44041},
+{0x1d58f,0x45081},
+{0x1d590,0x454e1},
+{0x1d591,0x460a1},
+{0x1d592,0x46f41},
+{0x1d593,0x47ba1},
+{0x1d594,0x488e1},
+{0x1d595,0x4a9a1},
+{0x1d596,0x4b301},
+{0x1d597,0x4b641},
+{0x1d598,0x4c501},
+{0x1d599,0x4d461},
+{0x1d59a,0x4df81},
+{0x1d59b,0x4f8c1},
+{0x1d59c,0x50141},
+{0x1d59d,0x507e1},
+{0x1d59e,0x50d81},
+{0x1d59f,0x515a1},
+{0x1d5a0,0x3ce21},
+{0x1d5a1,0x3eea1},
+{0x1d5a2,0x3f541},
+{0x1d5a3,0x40141},
+{0x1d5a4,0x40e81},
+{0x1d5a5,0x42481},
+{0x1d5a6,0x42be1},
+{0x1d5a7,0x436a1},
+{0x1d5a8,0x44141},
+{0x1d5a9,0x45161},
+{0x1d5aa,0x455c1},
+{0x1d5ab,0x461a1},
+{0x1d5ac,0x47041},
+{0x1d5ad,0x47c81},
+{0x1d5ae,0x489c1},
+{0x1d5af,0x4aa81},
+{0x1d5b0,0x4b3e1},
+{0x1d5b1,0x4b721},
+{0x1d5b2,0x4c641},
+{0x1d5b3,0x4d541},
+{0x1d5b4,0x4e061},
+{0x1d5b5,0x4f9c1},
+{0x1d5b6,0x50221},
+{0x1d5b7,0x508e1},
+{0x1d5b8,0x50e61},
+{0x1d5b9,0x51681},
+{0x1d5ba,0x3cd41},
+{0x1d5bb,0x3edc1},
+{0x1d5bc,0x3f401},
+{0x1d5bd,0x40041},
+{0x1d5be,0x40da1},
+{0x1d5bf,0x42361},
+{0x1d5c0,0x42b01},
+{0x1d5c1,0x435c1},
+{0x1d5c2,0x44041},
+{0x1d5c3,0x45081},
+{0x1d5c4,0x454e1},
+{0x1d5c5,0x460a1},
+{0x1d5c6,0x46f41},
+{0x1d5c7,0x47ba1},
+{0x1d5c8,0x488e1},
+{0x1d5c9,0x4a9a1},
+{0x1d5ca,0x4b301},
+{0x1d5cb,0x4b641},
+{0x1d5cc,0x4c501},
+{0x1d5cd,0x4d461},
+{0x1d5ce,0x4df81},
+{0x1d5cf,0x4f8c1},
+{0x1d5d0,0x50141},
+{0x1d5d1,0x507e1},
+{0x1d5d2,0x50d81},
+{0x1d5d3,0x515a1},
+{0x1d5d4,0x3ce21},
+{0x1d5d5,0x3eea1},
+{0x1d5d6,0x3f541},
+{0x1d5d7,0x40141},
+{0x1d5d8,0x40e81},
+{0x1d5d9,0x42481},
+{0x1d5da,0x42be1},
+{0x1d5db,0x436a1},
+{0x1d5dc,0x44141},
+{0x1d5dd,0x45161},
+{0x1d5de,0x455c1},
+{0x1d5df,0x461a1},
+{0x1d5e0,0x47041},
+{0x1d5e1,0x47c81},
+{0x1d5e2,0x489c1},
+{0x1d5e3,0x4aa81},
+{0x1d5e4,0x4b3e1},
+{0x1d5e5,0x4b721},
+{0x1d5e6,0x4c641},
+{0x1d5e7,0x4d541},
+{0x1d5e8,0x4e061},
+{0x1d5e9,0x4f9c1},
+{0x1d5ea,0x50221},
+{0x1d5eb,0x508e1},
+{0x1d5ec,0x50e61},
+{0x1d5ed,0x51681},
+{0x1d5ee,0x3cd41},
+{0x1d5ef,0x3edc1},
+{0x1d5f0,0x3f401},
+{0x1d5f1,0x40041},
+{0x1d5f2,0x40da1},
+{0x1d5f3,0x42361},
+{0x1d5f4,0x42b01},
+{0x1d5f5,0x435c1},
+{0x1d5f6,0x44041},
+{0x1d5f7,0x45081},
+{0x1d5f8,0x454e1},
+{0x1d5f9,0x460a1},
+{0x1d5fa,0x46f41},
+{0x1d5fb,0x47ba1},
+{0x1d5fc,0x488e1},
+{0x1d5fd,0x4a9a1},
+{0x1d5fe,0x4b301},
+{0x1d5ff,0x4b641},
+{0x1d600,0x4c501},
+{0x1d601,0x4d461},
+{0x1d602,0x4df81},
+{0x1d603,0x4f8c1},
+{0x1d604,0x50141},
+{0x1d605,0x507e1},
+{0x1d606,0x50d81},
+{0x1d607,0x515a1},
+{0x1d608,0x3ce21},
+{0x1d609,0x3eea1},
+{0x1d60a,0x3f541},
+{0x1d60b,0x40141},
+{0x1d60c,0x40e81},
+{0x1d60d,0x42481},
+{0x1d60e,0x42be1},
+{0x1d60f,0x436a1},
+{0x1d610,0x44141},
+{0x1d611,0x45161},
+{0x1d612,0x455c1},
+{0x1d613,0x461a1},
+{0x1d614,0x47041},
+{0x1d615,0x47c81},
+{0x1d616,0x489c1},
+{0x1d617,0x4aa81},
+{0x1d618,0x4b3e1},
+{0x1d619,0x4b721},
+{0x1d61a,0x4c641},
+{0x1d61b,0x4d541},
+{0x1d61c,0x4e061},
+{0x1d61d,0x4f9c1},
+{0x1d61e,0x50221},
+{0x1d61f,0x508e1},
+{0x1d620,0x50e61},
+{0x1d621,0x51681},
+{0x1d622,0x3cd41},
+{0x1d623,0x3edc1},
+{0x1d624,0x3f401},
+{0x1d625,0x40041},
+{0x1d626,0x40da1},
+{0x1d627,0x42361},
+{0x1d628,0x42b01},
+{0x1d629,0x435c1},
+{0x1d62a,0x44041},
+{0x1d62b,0x45081},
+{0x1d62c,0x454e1},
+{0x1d62d,0x460a1},
+{0x1d62e,0x46f41},
+{0x1d62f,0x47ba1},
+{0x1d630,0x488e1},
+{0x1d631,0x4a9a1},
+{0x1d632,0x4b301},
+{0x1d633,0x4b641},
+{0x1d634,0x4c501},
+{0x1d635,0x4d461},
+{0x1d636,0x4df81},
+{0x1d637,0x4f8c1},
+{0x1d638,0x50141},
+{0x1d639,0x507e1},
+{0x1d63a,0x50d81},
+{0x1d63b,0x515a1},
+{0x1d63c,0x3ce21},
+{0x1d63d,0x3eea1},
+{0x1d63e,0x3f541},
+{0x1d63f,0x40141},
+{0x1d640,0x40e81},
+{0x1d641,0x42481},
+{0x1d642,0x42be1},
+{0x1d643,0x436a1},
+{0x1d644,0x44141},
+{0x1d645,0x45161},
+{0x1d646,0x455c1},
+{0x1d647,0x461a1},
+{0x1d648,0x47041},
+{0x1d649,0x47c81},
+{0x1d64a,0x489c1},
+{0x1d64b,0x4aa81},
+{0x1d64c,0x4b3e1},
+{0x1d64d,0x4b721},
+{0x1d64e,0x4c641},
+{0x1d64f,0x4d541},
+{0x1d650,0x4e061},
+{0x1d651,0x4f9c1},
+{0x1d652,0x50221},
+{0x1d653,0x508e1},
+{0x1d654,0x50e61},
+{0x1d655,0x51681},
+{0x1d656,0x3cd41},
+{0x1d657,0x3edc1},
+{0x1d658,0x3f401},
+{0x1d659,0x40041},
+{0x1d65a,0x40da1},
+{0x1d65b,0x42361},
+{0x1d65c,0x42b01},
+{0x1d65d,0x435c1},
+{0x1d65e,0x44041},
+{0x1d65f,0x45081},
+{0x1d660,0x454e1},
+{0x1d661,0x460a1},
+{0x1d662,0x46f41},
+{0x1d663,0x47ba1},
+{0x1d664,0x488e1},
+{0x1d665,0x4a9a1},
+{0x1d666,0x4b301},
+{0x1d667,0x4b641},
+{0x1d668,0x4c501},
+{0x1d669,0x4d461},
+{0x1d66a,0x4df81},
+{0x1d66b,0x4f8c1},
+{0x1d66c,0x50141},
+{0x1d66d,0x507e1},
+{0x1d66e,0x50d81},
+{0x1d66f,0x515a1},
+{0x1d670,0x3ce21},
+{0x1d671,0x3eea1},
+{0x1d672,0x3f541},
+{0x1d673,0x40141},
+{0x1d674,0x40e81},
+{0x1d675,0x42481},
+{0x1d676,0x42be1},
+{0x1d677,0x436a1},
+{0x1d678,0x44141},
+{0x1d679,0x45161},
+{0x1d67a,0x455c1},
+{0x1d67b,0x461a1},
+{0x1d67c,0x47041},
+{0x1d67d,0x47c81},
+{0x1d67e,0x489c1},
+{0x1d67f,0x4aa81},
+{0x1d680,0x4b3e1},
+{0x1d681,0x4b721},
+{0x1d682,0x4c641},
+{0x1d683,0x4d541},
+{0x1d684,0x4e061},
+{0x1d685,0x4f9c1},
+{0x1d686,0x50221},
+{0x1d687,0x508e1},
+{0x1d688,0x50e61},
+{0x1d689,0x51681},
+{0x1d68a,0x3cd41},
+{0x1d68b,0x3edc1},
+{0x1d68c,0x3f401},
+{0x1d68d,0x40041},
+{0x1d68e,0x40da1},
+{0x1d68f,0x42361},
+{0x1d690,0x42b01},
+{0x1d691,0x435c1},
+{0x1d692,0x44041},
+{0x1d693,0x45081},
+{0x1d694,0x454e1},
+{0x1d695,0x460a1},
+{0x1d696,0x46f41},
+{0x1d697,0x47ba1},
+{0x1d698,0x488e1},
+{0x1d699,0x4a9a1},
+{0x1d69a,0x4b301},
+{0x1d69b,0x4b641},
+{0x1d69c,0x4c501},
+{0x1d69d,0x4d461},
+{0x1d69e,0x4df81},
+{0x1d69f,0x4f8c1},
+{0x1d6a0,0x50141},
+{0x1d6a1,0x507e1},
+{0x1d6a2,0x50d81},
+{0x1d6a3,0x515a1},
+{0x1d6a4,0x44dc1},
+{0x1d6a5,0x452e1},
+{0x1d6a8,0x52701},
+{0x1d6a9,0x53881},
+{0x1d6aa,0x53941},
+{0x1d6ab,0x53a21},
+{0x1d6ac,0x53ae1},
+{0x1d6ad,0x54161},
+{0x1d6ae,0x54221},
+{0x1d6af,0x552c1},
+{0x1d6b0,0x55381},
+{0x1d6b1,0x55dc1},
+{0x1d6b2,0x55f01},
+{0x1d6b3,0x55fc1},
+{0x1d6b4,0x56241},
+{0x1d6b5,0x562c1},
+{0x1d6b6,0x56341},
+{0x1d6b7,0x568e1},
+{0x1d6b8,0x56a61},
+{0x1d6b9,0x552c1},
+{0x1d6ba,0x56c41},
+{0x1d6bb,0x56da1},
+{0x1d6bc,0x56e41},
+{0x1d6bd,0x57761},
+{0x1d6be,0x57821},
+{0x1d6bf,0x578e1},
+{0x1d6c0,0x57981},
+{0x1d6c1,0x246e1},
+{0x1d6c2,0x526c1},
+{0x1d6c3,0x53841},
+{0x1d6c4,0x53901},
+{0x1d6c5,0x539e1},
+{0x1d6c6,0x53aa1},
+{0x1d6c7,0x54121},
+{0x1d6c8,0x541e1},
+{0x1d6c9,0x55261},
+{0x1d6ca,0x55341},
+{0x1d6cb,0x55d81},
+{0x1d6cc,0x55ec1},
+{0x1d6cd,0x55f81},
+{0x1d6ce,0x56201},
+{0x1d6cf,0x56281},
+{0x1d6d0,0x56301},
+{0x1d6d1,0x568a1},
+{0x1d6d2,0x56a21},
+{0x1d6d3,0x56be1},
+{0x1d6d4,0x56be1},
+{0x1d6d5,0x56d61},
+{0x1d6d6,0x56de1},
+{0x1d6d7,0x57721},
+{0x1d6d8,0x577e1},
+{0x1d6d9,0x578a1},
+{0x1d6da,0x57941},
+{0x1d6db,0x24701},
+{0x1d6dc,0x53aa1},
+{0x1d6dd,0x55261},
+{0x1d6de,0x55d81},
+{0x1d6df,0x57721},
+{0x1d6e0,0x56a21},
+{0x1d6e1,0x568a1},
+{0x1d6e2,0x52701},
+{0x1d6e3,0x53881},
+{0x1d6e4,0x53941},
+{0x1d6e5,0x53a21},
+{0x1d6e6,0x53ae1},
+{0x1d6e7,0x54161},
+{0x1d6e8,0x54221},
+{0x1d6e9,0x552c1},
+{0x1d6ea,0x55381},
+{0x1d6eb,0x55dc1},
+{0x1d6ec,0x55f01},
+{0x1d6ed,0x55fc1},
+{0x1d6ee,0x56241},
+{0x1d6ef,0x562c1},
+{0x1d6f0,0x56341},
+{0x1d6f1,0x568e1},
+{0x1d6f2,0x56a61},
+{0x1d6f3,0x552c1},
+{0x1d6f4,0x56c41},
+{0x1d6f5,0x56da1},
+{0x1d6f6,0x56e41},
+{0x1d6f7,0x57761},
+{0x1d6f8,0x57821},
+{0x1d6f9,0x578e1},
+{0x1d6fa,0x57981},
+{0x1d6fb,0x246e1},
+{0x1d6fc,0x526c1},
+{0x1d6fd,0x53841},
+{0x1d6fe,0x53901},
+{0x1d6ff,0x539e1},
+{0x1d700,0x53aa1},
+{0x1d701,0x54121},
+{0x1d702,0x541e1},
+{0x1d703,0x55261},
+{0x1d704,0x55341},
+{0x1d705,0x55d81},
+{0x1d706,0x55ec1},
+{0x1d707,0x55f81},
+{0x1d708,0x56201},
+{0x1d709,0x56281},
+{0x1d70a,0x56301},
+{0x1d70b,0x568a1},
+{0x1d70c,0x56a21},
+{0x1d70d,0x56be1},
+{0x1d70e,0x56be1},
+{0x1d70f,0x56d61},
+{0x1d710,0x56de1},
+{0x1d711,0x57721},
+{0x1d712,0x577e1},
+{0x1d713,0x578a1},
+{0x1d714,0x57941},
+{0x1d715,0x24701},
+{0x1d716,0x53aa1},
+{0x1d717,0x55261},
+{0x1d718,0x55d81},
+{0x1d719,0x57721},
+{0x1d71a,0x56a21},
+{0x1d71b,0x568a1},
+{0x1d71c,0x52701},
+{0x1d71d,0x53881},
+{0x1d71e,0x53941},
+{0x1d71f,0x53a21},
+{0x1d720,0x53ae1},
+{0x1d721,0x54161},
+{0x1d722,0x54221},
+{0x1d723,0x552c1},
+{0x1d724,0x55381},
+{0x1d725,0x55dc1},
+{0x1d726,0x55f01},
+{0x1d727,0x55fc1},
+{0x1d728,0x56241},
+{0x1d729,0x562c1},
+{0x1d72a,0x56341},
+{0x1d72b,0x568e1},
+{0x1d72c,0x56a61},
+{0x1d72d,0x552c1},
+{0x1d72e,0x56c41},
+{0x1d72f,0x56da1},
+{0x1d730,0x56e41},
+{0x1d731,0x57761},
+{0x1d732,0x57821},
+{0x1d733,0x578e1},
+{0x1d734,0x57981},
+{0x1d735,0x246e1},
+{0x1d736,0x526c1},
+{0x1d737,0x53841},
+{0x1d738,0x53901},
+{0x1d739,0x539e1},
+{0x1d73a,0x53aa1},
+{0x1d73b,0x54121},
+{0x1d73c,0x541e1},
+{0x1d73d,0x55261},
+{0x1d73e,0x55341},
+{0x1d73f,0x55d81},
+{0x1d740,0x55ec1},
+{0x1d741,0x55f81},
+{0x1d742,0x56201},
+{0x1d743,0x56281},
+{0x1d744,0x56301},
+{0x1d745,0x568a1},
+{0x1d746,0x56a21},
+{0x1d747,0x56be1},
+{0x1d748,0x56be1},
+{0x1d749,0x56d61},
+{0x1d74a,0x56de1},
+{0x1d74b,0x57721},
+{0x1d74c,0x577e1},
+{0x1d74d,0x578a1},
+{0x1d74e,0x57941},
+{0x1d74f,0x24701},
+{0x1d750,0x53aa1},
+{0x1d751,0x55261},
+{0x1d752,0x55d81},
+{0x1d753,0x57721},
+{0x1d754,0x56a21},
+{0x1d755,0x568a1},
+{0x1d756,0x52701},
+{0x1d757,0x53881},
+{0x1d758,0x53941},
+{0x1d759,0x53a21},
+{0x1d75a,0x53ae1},
+{0x1d75b,0x54161},
+{0x1d75c,0x54221},
+{0x1d75d,0x552c1},
+{0x1d75e,0x55381},
+{0x1d75f,0x55dc1},
+{0x1d760,0x55f01},
+{0x1d761,0x55fc1},
+{0x1d762,0x56241},
+{0x1d763,0x562c1},
+{0x1d764,0x56341},
+{0x1d765,0x568e1},
+{0x1d766,0x56a61},
+{0x1d767,0x552c1},
+{0x1d768,0x56c41},
+{0x1d769,0x56da1},
+{0x1d76a,0x56e41},
+{0x1d76b,0x57761},
+{0x1d76c,0x57821},
+{0x1d76d,0x578e1},
+{0x1d76e,0x57981},
+{0x1d76f,0x246e1},
+{0x1d770,0x526c1},
+{0x1d771,0x53841},
+{0x1d772,0x53901},
+{0x1d773,0x539e1},
+{0x1d774,0x53aa1},
+{0x1d775,0x54121},
+{0x1d776,0x541e1},
+{0x1d777,0x55261},
+{0x1d778,0x55341},
+{0x1d779,0x55d81},
+{0x1d77a,0x55ec1},
+{0x1d77b,0x55f81},
+{0x1d77c,0x56201},
+{0x1d77d,0x56281},
+{0x1d77e,0x56301},
+{0x1d77f,0x568a1},
+{0x1d780,0x56a21},
+{0x1d781,0x56be1},
+{0x1d782,0x56be1},
+{0x1d783,0x56d61},
+{0x1d784,0x56de1},
+{0x1d785,0x57721},
+{0x1d786,0x577e1},
+{0x1d787,0x578a1},
+{0x1d788,0x57941},
+{0x1d789,0x24701},
+{0x1d78a,0x53aa1},
+{0x1d78b,0x55261},
+{0x1d78c,0x55d81},
+{0x1d78d,0x57721},
+{0x1d78e,0x56a21},
+{0x1d78f,0x568a1},
+{0x1d790,0x52701},
+{0x1d791,0x53881},
+{0x1d792,0x53941},
+{0x1d793,0x53a21},
+{0x1d794,0x53ae1},
+{0x1d795,0x54161},
+{0x1d796,0x54221},
+{0x1d797,0x552c1},
+{0x1d798,0x55381},
+{0x1d799,0x55dc1},
+{0x1d79a,0x55f01},
+{0x1d79b,0x55fc1},
+{0x1d79c,0x56241},
+{0x1d79d,0x562c1},
+{0x1d79e,0x56341},
+{0x1d79f,0x568e1},
+{0x1d7a0,0x56a61},
+{0x1d7a1,0x552c1},
+{0x1d7a2,0x56c41},
+{0x1d7a3,0x56da1},
+{0x1d7a4,0x56e41},
+{0x1d7a5,0x57761},
+{0x1d7a6,0x57821},
+{0x1d7a7,0x578e1},
+{0x1d7a8,0x57981},
+{0x1d7a9,0x246e1},
+{0x1d7aa,0x526c1},
+{0x1d7ab,0x53841},
+{0x1d7ac,0x53901},
+{0x1d7ad,0x539e1},
+{0x1d7ae,0x53aa1},
+{0x1d7af,0x54121},
+{0x1d7b0,0x541e1},
+{0x1d7b1,0x55261},
+{0x1d7b2,0x55341},
+{0x1d7b3,0x55d81},
+{0x1d7b4,0x55ec1},
+{0x1d7b5,0x55f81},
+{0x1d7b6,0x56201},
+{0x1d7b7,0x56281},
+{0x1d7b8,0x56301},
+{0x1d7b9,0x568a1},
+{0x1d7ba,0x56a21},
+{0x1d7bb,0x56be1},
+{0x1d7bc,0x56be1},
+{0x1d7bd,0x56d61},
+{0x1d7be,0x56de1},
+{0x1d7bf,0x57721},
+{0x1d7c0,0x577e1},
+{0x1d7c1,0x578a1},
+{0x1d7c2,0x57941},
+{0x1d7c3,0x24701},
+{0x1d7c4,0x53aa1},
+{0x1d7c5,0x55261},
+{0x1d7c6,0x55d81},
+{0x1d7c7,0x57721},
+{0x1d7c8,0x56a21},
+{0x1d7c9,0x568a1},
+{0x1d7ca,0x54061},
+{0x1d7cb,0x54021},
+{0x1d7ce,0x381a1},
+{0x1d7cf,0x38421},
+{0x1d7d0,0x3a181},
+{0x1d7d1,0x3b001},
+{0x1d7d2,0x3b781},
+{0x1d7d3,0x3bd41},
+{0x1d7d4,0x3c121},
+{0x1d7d5,0x3c441},
+{0x1d7d6,0x3c7c1},
+{0x1d7d7,0x3cae1},
+{0x1d7d8,0x381a1},
+{0x1d7d9,0x38421},
+{0x1d7da,0x3a181},
+{0x1d7db,0x3b001},
+{0x1d7dc,0x3b781},
+{0x1d7dd,0x3bd41},
+{0x1d7de,0x3c121},
+{0x1d7df,0x3c441},
+{0x1d7e0,0x3c7c1},
+{0x1d7e1,0x3cae1},
+{0x1d7e2,0x381a1},
+{0x1d7e3,0x38421},
+{0x1d7e4,0x3a181},
+{0x1d7e5,0x3b001},
+{0x1d7e6,0x3b781},
+{0x1d7e7,0x3bd41},
+{0x1d7e8,0x3c121},
+{0x1d7e9,0x3c441},
+{0x1d7ea,0x3c7c1},
+{0x1d7eb,0x3cae1},
+{0x1d7ec,0x381a1},
+{0x1d7ed,0x38421},
+{0x1d7ee,0x3a181},
+{0x1d7ef,0x3b001},
+{0x1d7f0,0x3b781},
+{0x1d7f1,0x3bd41},
+{0x1d7f2,0x3c121},
+{0x1d7f3,0x3c441},
+{0x1d7f4,0x3c7c1},
+{0x1d7f5,0x3cae1},
+{0x1d7f6,0x381a1},
+{0x1d7f7,0x38421},
+{0x1d7f8,0x3a181},
+{0x1d7f9,0x3b001},
+{0x1d7fa,0x3b781},
+{0x1d7fb,0x3bd41},
+{0x1d7fc,0x3c121},
+{0x1d7fd,0x3c441},
+{0x1d7fe,0x3c7c1},
+{0x1d7ff,0x3cae1},
+{0x1d800,0x24721},
+{0x1d801,0x24741},
+{0x1d802,0x24761},
+{0x1d803,0x24781},
+{0x1d804,0x247a1},
+{0x1d805,0x247c1},
+{0x1d806,0x247e1},
+{0x1d807,0x24801},
+{0x1d808,0x24821},
+{0x1d809,0x24841},
+{0x1d80a,0x24861},
+{0x1d80b,0x24881},
+{0x1d80c,0x248a1},
+{0x1d80d,0x248c1},
+{0x1d80e,0x248e1},
+{0x1d80f,0x24901},
+{0x1d810,0x24921},
+{0x1d811,0x24941},
+{0x1d812,0x24961},
+{0x1d813,0x24981},
+{0x1d814,0x249a1},
+{0x1d815,0x249c1},
+{0x1d816,0x249e1},
+{0x1d817,0x24a01},
+{0x1d818,0x24a21},
+{0x1d819,0x24a41},
+{0x1d81a,0x24a61},
+{0x1d81b,0x24a81},
+{0x1d81c,0x24aa1},
+{0x1d81d,0x24ac1},
+{0x1d81e,0x24ae1},
+{0x1d81f,0x24b01},
+{0x1d820,0x24b21},
+{0x1d821,0x24b41},
+{0x1d822,0x24b61},
+{0x1d823,0x24b81},
+{0x1d824,0x24ba1},
+{0x1d825,0x24bc1},
+{0x1d826,0x24be1},
+{0x1d827,0x24c01},
+{0x1d828,0x24c21},
+{0x1d829,0x24c41},
+{0x1d82a,0x24c61},
+{0x1d82b,0x24c81},
+{0x1d82c,0x24ca1},
+{0x1d82d,0x24cc1},
+{0x1d82e,0x24ce1},
+{0x1d82f,0x24d01},
+{0x1d830,0x24d21},
+{0x1d831,0x24d41},
+{0x1d832,0x24d61},
+{0x1d833,0x24d81},
+{0x1d834,0x24da1},
+{0x1d835,0x24dc1},
+{0x1d836,0x24de1},
+{0x1d837,0x24e01},
+{0x1d838,0x24e21},
+{0x1d839,0x24e41},
+{0x1d83a,0x24e61},
+{0x1d83b,0x24e81},
+{0x1d83c,0x24ea1},
+{0x1d83d,0x24ec1},
+{0x1d83e,0x24ee1},
+{0x1d83f,0x24f01},
+{0x1d840,0x24f21},
+{0x1d841,0x24f41},
+{0x1d842,0x24f61},
+{0x1d843,0x24f81},
+{0x1d844,0x24fa1},
+{0x1d845,0x24fc1},
+{0x1d846,0x24fe1},
+{0x1d847,0x25001},
+{0x1d848,0x25021},
+{0x1d849,0x25041},
+{0x1d84a,0x25061},
+{0x1d84b,0x25081},
+{0x1d84c,0x250a1},
+{0x1d84d,0x250c1},
+{0x1d84e,0x250e1},
+{0x1d84f,0x25101},
+{0x1d850,0x25121},
+{0x1d851,0x25141},
+{0x1d852,0x25161},
+{0x1d853,0x25181},
+{0x1d854,0x251a1},
+{0x1d855,0x251c1},
+{0x1d856,0x251e1},
+{0x1d857,0x25201},
+{0x1d858,0x25221},
+{0x1d859,0x25241},
+{0x1d85a,0x25261},
+{0x1d85b,0x25281},
+{0x1d85c,0x252a1},
+{0x1d85d,0x252c1},
+{0x1d85e,0x252e1},
+{0x1d85f,0x25301},
+{0x1d860,0x25321},
+{0x1d861,0x25341},
+{0x1d862,0x25361},
+{0x1d863,0x25381},
+{0x1d864,0x253a1},
+{0x1d865,0x253c1},
+{0x1d866,0x253e1},
+{0x1d867,0x25401},
+{0x1d868,0x25421},
+{0x1d869,0x25441},
+{0x1d86a,0x25461},
+{0x1d86b,0x25481},
+{0x1d86c,0x254a1},
+{0x1d86d,0x254c1},
+{0x1d86e,0x254e1},
+{0x1d86f,0x25501},
+{0x1d870,0x25521},
+{0x1d871,0x25541},
+{0x1d872,0x25561},
+{0x1d873,0x25581},
+{0x1d874,0x255a1},
+{0x1d875,0x255c1},
+{0x1d876,0x255e1},
+{0x1d877,0x25601},
+{0x1d878,0x25621},
+{0x1d879,0x25641},
+{0x1d87a,0x25661},
+{0x1d87b,0x25681},
+{0x1d87c,0x256a1},
+{0x1d87d,0x256c1},
+{0x1d87e,0x256e1},
+{0x1d87f,0x25701},
+{0x1d880,0x25721},
+{0x1d881,0x25741},
+{0x1d882,0x25761},
+{0x1d883,0x25781},
+{0x1d884,0x257a1},
+{0x1d885,0x257c1},
+{0x1d886,0x257e1},
+{0x1d887,0x25801},
+{0x1d888,0x25821},
+{0x1d889,0x25841},
+{0x1d88a,0x25861},
+{0x1d88b,0x25881},
+{0x1d88c,0x258a1},
+{0x1d88d,0x258c1},
+{0x1d88e,0x258e1},
+{0x1d88f,0x25901},
+{0x1d890,0x25921},
+{0x1d891,0x25941},
+{0x1d892,0x25961},
+{0x1d893,0x25981},
+{0x1d894,0x259a1},
+{0x1d895,0x259c1},
+{0x1d896,0x259e1},
+{0x1d897,0x25a01},
+{0x1d898,0x25a21},
+{0x1d899,0x25a41},
+{0x1d89a,0x25a61},
+{0x1d89b,0x25a81},
+{0x1d89c,0x25aa1},
+{0x1d89d,0x25ac1},
+{0x1d89e,0x25ae1},
+{0x1d89f,0x25b01},
+{0x1d8a0,0x25b21},
+{0x1d8a1,0x25b41},
+{0x1d8a2,0x25b61},
+{0x1d8a3,0x25b81},
+{0x1d8a4,0x25ba1},
+{0x1d8a5,0x25bc1},
+{0x1d8a6,0x25be1},
+{0x1d8a7,0x25c01},
+{0x1d8a8,0x25c21},
+{0x1d8a9,0x25c41},
+{0x1d8aa,0x25c61},
+{0x1d8ab,0x25c81},
+{0x1d8ac,0x25ca1},
+{0x1d8ad,0x25cc1},
+{0x1d8ae,0x25ce1},
+{0x1d8af,0x25d01},
+{0x1d8b0,0x25d21},
+{0x1d8b1,0x25d41},
+{0x1d8b2,0x25d61},
+{0x1d8b3,0x25d81},
+{0x1d8b4,0x25da1},
+{0x1d8b5,0x25dc1},
+{0x1d8b6,0x25de1},
+{0x1d8b7,0x25e01},
+{0x1d8b8,0x25e21},
+{0x1d8b9,0x25e41},
+{0x1d8ba,0x25e61},
+{0x1d8bb,0x25e81},
+{0x1d8bc,0x25ea1},
+{0x1d8bd,0x25ec1},
+{0x1d8be,0x25ee1},
+{0x1d8bf,0x25f01},
+{0x1d8c0,0x25f21},
+{0x1d8c1,0x25f41},
+{0x1d8c2,0x25f61},
+{0x1d8c3,0x25f81},
+{0x1d8c4,0x25fa1},
+{0x1d8c5,0x25fc1},
+{0x1d8c6,0x25fe1},
+{0x1d8c7,0x26001},
+{0x1d8c8,0x26021},
+{0x1d8c9,0x26041},
+{0x1d8ca,0x26061},
+{0x1d8cb,0x26081},
+{0x1d8cc,0x260a1},
+{0x1d8cd,0x260c1},
+{0x1d8ce,0x260e1},
+{0x1d8cf,0x26101},
+{0x1d8d0,0x26121},
+{0x1d8d1,0x26141},
+{0x1d8d2,0x26161},
+{0x1d8d3,0x26181},
+{0x1d8d4,0x261a1},
+{0x1d8d5,0x261c1},
+{0x1d8d6,0x261e1},
+{0x1d8d7,0x26201},
+{0x1d8d8,0x26221},
+{0x1d8d9,0x26241},
+{0x1d8da,0x26261},
+{0x1d8db,0x26281},
+{0x1d8dc,0x262a1},
+{0x1d8dd,0x262c1},
+{0x1d8de,0x262e1},
+{0x1d8df,0x26301},
+{0x1d8e0,0x26321},
+{0x1d8e1,0x26341},
+{0x1d8e2,0x26361},
+{0x1d8e3,0x26381},
+{0x1d8e4,0x263a1},
+{0x1d8e5,0x263c1},
+{0x1d8e6,0x263e1},
+{0x1d8e7,0x26401},
+{0x1d8e8,0x26421},
+{0x1d8e9,0x26441},
+{0x1d8ea,0x26461},
+{0x1d8eb,0x26481},
+{0x1d8ec,0x264a1},
+{0x1d8ed,0x264c1},
+{0x1d8ee,0x264e1},
+{0x1d8ef,0x26501},
+{0x1d8f0,0x26521},
+{0x1d8f1,0x26541},
+{0x1d8f2,0x26561},
+{0x1d8f3,0x26581},
+{0x1d8f4,0x265a1},
+{0x1d8f5,0x265c1},
+{0x1d8f6,0x265e1},
+{0x1d8f7,0x26601},
+{0x1d8f8,0x26621},
+{0x1d8f9,0x26641},
+{0x1d8fa,0x26661},
+{0x1d8fb,0x26681},
+{0x1d8fc,0x266a1},
+{0x1d8fd,0x266c1},
+{0x1d8fe,0x266e1},
+{0x1d8ff,0x26701},
+{0x1d900,0x26721},
+{0x1d901,0x26741},
+{0x1d902,0x26761},
+{0x1d903,0x26781},
+{0x1d904,0x267a1},
+{0x1d905,0x267c1},
+{0x1d906,0x267e1},
+{0x1d907,0x26801},
+{0x1d908,0x26821},
+{0x1d909,0x26841},
+{0x1d90a,0x26861},
+{0x1d90b,0x26881},
+{0x1d90c,0x268a1},
+{0x1d90d,0x268c1},
+{0x1d90e,0x268e1},
+{0x1d90f,0x26901},
+{0x1d910,0x26921},
+{0x1d911,0x26941},
+{0x1d912,0x26961},
+{0x1d913,0x26981},
+{0x1d914,0x269a1},
+{0x1d915,0x269c1},
+{0x1d916,0x269e1},
+{0x1d917,0x26a01},
+{0x1d918,0x26a21},
+{0x1d919,0x26a41},
+{0x1d91a,0x26a61},
+{0x1d91b,0x26a81},
+{0x1d91c,0x26aa1},
+{0x1d91d,0x26ac1},
+{0x1d91e,0x26ae1},
+{0x1d91f,0x26b01},
+{0x1d920,0x26b21},
+{0x1d921,0x26b41},
+{0x1d922,0x26b61},
+{0x1d923,0x26b81},
+{0x1d924,0x26ba1},
+{0x1d925,0x26bc1},
+{0x1d926,0x26be1},
+{0x1d927,0x26c01},
+{0x1d928,0x26c21},
+{0x1d929,0x26c41},
+{0x1d92a,0x26c61},
+{0x1d92b,0x26c81},
+{0x1d92c,0x26ca1},
+{0x1d92d,0x26cc1},
+{0x1d92e,0x26ce1},
+{0x1d92f,0x26d01},
+{0x1d930,0x26d21},
+{0x1d931,0x26d41},
+{0x1d932,0x26d61},
+{0x1d933,0x26d81},
+{0x1d934,0x26da1},
+{0x1d935,0x26dc1},
+{0x1d936,0x26de1},
+{0x1d937,0x26e01},
+{0x1d938,0x26e21},
+{0x1d939,0x26e41},
+{0x1d93a,0x26e61},
+{0x1d93b,0x26e81},
+{0x1d93c,0x26ea1},
+{0x1d93d,0x26ec1},
+{0x1d93e,0x26ee1},
+{0x1d93f,0x26f01},
+{0x1d940,0x26f21},
+{0x1d941,0x26f41},
+{0x1d942,0x26f61},
+{0x1d943,0x26f81},
+{0x1d944,0x26fa1},
+{0x1d945,0x26fc1},
+{0x1d946,0x26fe1},
+{0x1d947,0x27001},
+{0x1d948,0x27021},
+{0x1d949,0x27041},
+{0x1d94a,0x27061},
+{0x1d94b,0x27081},
+{0x1d94c,0x270a1},
+{0x1d94d,0x270c1},
+{0x1d94e,0x270e1},
+{0x1d94f,0x27101},
+{0x1d950,0x27121},
+{0x1d951,0x27141},
+{0x1d952,0x27161},
+{0x1d953,0x27181},
+{0x1d954,0x271a1},
+{0x1d955,0x271c1},
+{0x1d956,0x271e1},
+{0x1d957,0x27201},
+{0x1d958,0x27221},
+{0x1d959,0x27241},
+{0x1d95a,0x27261},
+{0x1d95b,0x27281},
+{0x1d95c,0x272a1},
+{0x1d95d,0x272c1},
+{0x1d95e,0x272e1},
+{0x1d95f,0x27301},
+{0x1d960,0x27321},
+{0x1d961,0x27341},
+{0x1d962,0x27361},
+{0x1d963,0x27381},
+{0x1d964,0x273a1},
+{0x1d965,0x273c1},
+{0x1d966,0x273e1},
+{0x1d967,0x27401},
+{0x1d968,0x27421},
+{0x1d969,0x27441},
+{0x1d96a,0x27461},
+{0x1d96b,0x27481},
+{0x1d96c,0x274a1},
+{0x1d96d,0x274c1},
+{0x1d96e,0x274e1},
+{0x1d96f,0x27501},
+{0x1d970,0x27521},
+{0x1d971,0x27541},
+{0x1d972,0x27561},
+{0x1d973,0x27581},
+{0x1d974,0x275a1},
+{0x1d975,0x275c1},
+{0x1d976,0x275e1},
+{0x1d977,0x27601},
+{0x1d978,0x27621},
+{0x1d979,0x27641},
+{0x1d97a,0x27661},
+{0x1d97b,0x27681},
+{0x1d97c,0x276a1},
+{0x1d97d,0x276c1},
+{0x1d97e,0x276e1},
+{0x1d97f,0x27701},
+{0x1d980,0x27721},
+{0x1d981,0x27741},
+{0x1d982,0x27761},
+{0x1d983,0x27781},
+{0x1d984,0x277a1},
+{0x1d985,0x277c1},
+{0x1d986,0x277e1},
+{0x1d987,0x27801},
+{0x1d988,0x27821},
+{0x1d989,0x27841},
+{0x1d98a,0x27861},
+{0x1d98b,0x27881},
+{0x1d98c,0x278a1},
+{0x1d98d,0x278c1},
+{0x1d98e,0x278e1},
+{0x1d98f,0x27901},
+{0x1d990,0x27921},
+{0x1d991,0x27941},
+{0x1d992,0x27961},
+{0x1d993,0x27981},
+{0x1d994,0x279a1},
+{0x1d995,0x279c1},
+{0x1d996,0x279e1},
+{0x1d997,0x27a01},
+{0x1d998,0x27a21},
+{0x1d999,0x27a41},
+{0x1d99a,0x27a61},
+{0x1d99b,0x27a81},
+{0x1d99c,0x27aa1},
+{0x1d99d,0x27ac1},
+{0x1d99e,0x27ae1},
+{0x1d99f,0x27b01},
+{0x1d9a0,0x27b21},
+{0x1d9a1,0x27b41},
+{0x1d9a2,0x27b61},
+{0x1d9a3,0x27b81},
+{0x1d9a4,0x27ba1},
+{0x1d9a5,0x27bc1},
+{0x1d9a6,0x27be1},
+{0x1d9a7,0x27c01},
+{0x1d9a8,0x27c21},
+{0x1d9a9,0x27c41},
+{0x1d9aa,0x27c61},
+{0x1d9ab,0x27c81},
+{0x1d9ac,0x27ca1},
+{0x1d9ad,0x27cc1},
+{0x1d9ae,0x27ce1},
+{0x1d9af,0x27d01},
+{0x1d9b0,0x27d21},
+{0x1d9b1,0x27d41},
+{0x1d9b2,0x27d61},
+{0x1d9b3,0x27d81},
+{0x1d9b4,0x27da1},
+{0x1d9b5,0x27dc1},
+{0x1d9b6,0x27de1},
+{0x1d9b7,0x27e01},
+{0x1d9b8,0x27e21},
+{0x1d9b9,0x27e41},
+{0x1d9ba,0x27e61},
+{0x1d9bb,0x27e81},
+{0x1d9bc,0x27ea1},
+{0x1d9bd,0x27ec1},
+{0x1d9be,0x27ee1},
+{0x1d9bf,0x27f01},
+{0x1d9c0,0x27f21},
+{0x1d9c1,0x27f41},
+{0x1d9c2,0x27f61},
+{0x1d9c3,0x27f81},
+{0x1d9c4,0x27fa1},
+{0x1d9c5,0x27fc1},
+{0x1d9c6,0x27fe1},
+{0x1d9c7,0x28001},
+{0x1d9c8,0x28021},
+{0x1d9c9,0x28041},
+{0x1d9ca,0x28061},
+{0x1d9cb,0x28081},
+{0x1d9cc,0x280a1},
+{0x1d9cd,0x280c1},
+{0x1d9ce,0x280e1},
+{0x1d9cf,0x28101},
+{0x1d9d0,0x28121},
+{0x1d9d1,0x28141},
+{0x1d9d2,0x28161},
+{0x1d9d3,0x28181},
+{0x1d9d4,0x281a1},
+{0x1d9d5,0x281c1},
+{0x1d9d6,0x281e1},
+{0x1d9d7,0x28201},
+{0x1d9d8,0x28221},
+{0x1d9d9,0x28241},
+{0x1d9da,0x28261},
+{0x1d9db,0x28281},
+{0x1d9dc,0x282a1},
+{0x1d9dd,0x282c1},
+{0x1d9de,0x282e1},
+{0x1d9df,0x28301},
+{0x1d9e0,0x28321},
+{0x1d9e1,0x28341},
+{0x1d9e2,0x28361},
+{0x1d9e3,0x28381},
+{0x1d9e4,0x283a1},
+{0x1d9e5,0x283c1},
+{0x1d9e6,0x283e1},
+{0x1d9e7,0x28401},
+{0x1d9e8,0x28421},
+{0x1d9e9,0x28441},
+{0x1d9ea,0x28461},
+{0x1d9eb,0x28481},
+{0x1d9ec,0x284a1},
+{0x1d9ed,0x284c1},
+{0x1d9ee,0x284e1},
+{0x1d9ef,0x28501},
+{0x1d9f0,0x28521},
+{0x1d9f1,0x28541},
+{0x1d9f2,0x28561},
+{0x1d9f3,0x28581},
+{0x1d9f4,0x285a1},
+{0x1d9f5,0x285c1},
+{0x1d9f6,0x285e1},
+{0x1d9f7,0x28601},
+{0x1d9f8,0x28621},
+{0x1d9f9,0x28641},
+{0x1d9fa,0x28661},
+{0x1d9fb,0x28681},
+{0x1d9fc,0x286a1},
+{0x1d9fd,0x286c1},
+{0x1d9fe,0x286e1},
+{0x1d9ff,0x28701},
+{0x1da00,0x1},
+{0x1da01,0x1},
+{0x1da02,0x1},
+{0x1da03,0x1},
+{0x1da04,0x1},
+{0x1da05,0x1},
+{0x1da06,0x1},
+{0x1da07,0x1},
+{0x1da08,0x1},
+{0x1da09,0x1},
+{0x1da0a,0x1},
+{0x1da0b,0x1},
+{0x1da0c,0x1},
+{0x1da0d,0x1},
+{0x1da0e,0x1},
+{0x1da0f,0x1},
+{0x1da10,0x1},
+{0x1da11,0x1},
+{0x1da12,0x1},
+{0x1da13,0x1},
+{0x1da14,0x1},
+{0x1da15,0x1},
+{0x1da16,0x1},
+{0x1da17,0x1},
+{0x1da18,0x1},
+{0x1da19,0x1},
+{0x1da1a,0x1},
+{0x1da1b,0x1},
+{0x1da1c,0x1},
+{0x1da1d,0x1},
+{0x1da1e,0x1},
+{0x1da1f,0x1},
+{0x1da20,0x1},
+{0x1da21,0x1},
+{0x1da22,0x1},
+{0x1da23,0x1},
+{0x1da24,0x1},
+{0x1da25,0x1},
+{0x1da26,0x1},
+{0x1da27,0x1},
+{0x1da28,0x1},
+{0x1da29,0x1},
+{0x1da2a,0x1},
+{0x1da2b,0x1},
+{0x1da2c,0x1},
+{0x1da2d,0x1},
+{0x1da2e,0x1},
+{0x1da2f,0x1},
+{0x1da30,0x1},
+{0x1da31,0x1},
+{0x1da32,0x1},
+{0x1da33,0x1},
+{0x1da34,0x1},
+{0x1da35,0x1},
+{0x1da36,0x1},
+{0x1da37,0x28721},
+{0x1da38,0x28741},
+{0x1da39,0x28761},
+{0x1da3a,0x28781},
+{0x1da3b,0x1},
+{0x1da3c,0x1},
+{0x1da3d,0x1},
+{0x1da3e,0x1},
+{0x1da3f,0x1},
+{0x1da40,0x1},
+{0x1da41,0x1},
+{0x1da42,0x1},
+{0x1da43,0x1},
+{0x1da44,0x1},
+{0x1da45,0x1},
+{0x1da46,0x1},
+{0x1da47,0x1},
+{0x1da48,0x1},
+{0x1da49,0x1},
+{0x1da4a,0x1},
+{0x1da4b,0x1},
+{0x1da4c,0x1},
+{0x1da4d,0x1},
+{0x1da4e,0x1},
+{0x1da4f,0x1},
+{0x1da50,0x1},
+{0x1da51,0x1},
+{0x1da52,0x1},
+{0x1da53,0x1},
+{0x1da54,0x1},
+{0x1da55,0x1},
+{0x1da56,0x1},
+{0x1da57,0x1},
+{0x1da58,0x1},
+{0x1da59,0x1},
+{0x1da5a,0x1},
+{0x1da5b,0x1},
+{0x1da5c,0x1},
+{0x1da5d,0x1},
+{0x1da5e,0x1},
+{0x1da5f,0x1},
+{0x1da60,0x1},
+{0x1da61,0x1},
+{0x1da62,0x1},
+{0x1da63,0x1},
+{0x1da64,0x1},
+{0x1da65,0x1},
+{0x1da66,0x1},
+{0x1da67,0x1},
+{0x1da68,0x1},
+{0x1da69,0x1},
+{0x1da6a,0x1},
+{0x1da6b,0x1},
+{0x1da6c,0x1},
+{0x1da6d,0x287a1},
+{0x1da6e,0x287c1},
+{0x1da6f,0x287e1},
+{0x1da70,0x28801},
+{0x1da71,0x28821},
+{0x1da72,0x28841},
+{0x1da73,0x28861},
+{0x1da74,0x28881},
+{0x1da75,0x1},
+{0x1da76,0x288a1},
+{0x1da77,0x288c1},
+{0x1da78,0x288e1},
+{0x1da79,0x28901},
+{0x1da7a,0x28921},
+{0x1da7b,0x28941},
+{0x1da7c,0x28961},
+{0x1da7d,0x28981},
+{0x1da7e,0x289a1},
+{0x1da7f,0x289c1},
+{0x1da80,0x289e1},
+{0x1da81,0x28a01},
+{0x1da82,0x28a21},
+{0x1da83,0x28a41},
+{0x1da84,0x1},
+{0x1da85,0x28a61},
+{0x1da86,0x28a81},
+{0x1da87,0x28aa1},
+{0x1da88,0x28ac1},
+{0x1da89,0x28ae1},
+{0x1da8a,0x28b01},
+{0x1da8b,0x28b21},
+{0x1da9b,0x1},
+{0x1da9c,0x1},
+{0x1da9d,0x1},
+{0x1da9e,0x1},
+{0x1da9f,0x1},
+{0x1daa1,0x1},
+{0x1daa2,0x1},
+{0x1daa3,0x1},
+{0x1daa4,0x1},
+{0x1daa5,0x1},
+{0x1daa6,0x1},
+{0x1daa7,0x1},
+{0x1daa8,0x1},
+{0x1daa9,0x1},
+{0x1daaa,0x1},
+{0x1daab,0x1},
+{0x1daac,0x1},
+{0x1daad,0x1},
+{0x1daae,0x1},
+{0x1daaf,0x1},
+{0x1e800,0xab041},
+{0x1e801,0xab061},
+{0x1e802,0xab081},
+{0x1e803,0xab0a1},
+{0x1e804,0xab0c1},
+{0x1e805,0xab0e1},
+{0x1e806,0xab101},
+{0x1e807,0xab121},
+{0x1e808,0xab141},
+{0x1e809,0xab161},
+{0x1e80a,0xab181},
+{0x1e80b,0xab1a1},
+{0x1e80c,0xab1c1},
+{0x1e80d,0xab1e1},
+{0x1e80e,0xab201},
+{0x1e80f,0xab221},
+{0x1e810,0xab241},
+{0x1e811,0xab261},
+{0x1e812,0xab281},
+{0x1e813,0xab2a1},
+{0x1e814,0xab2c1},
+{0x1e815,0xab2e1},
+{0x1e816,0xab301},
+{0x1e817,0xab321},
+{0x1e818,0xab341},
+{0x1e819,0xab361},
+{0x1e81a,0xab381},
+{0x1e81b,0xab3a1},
+{0x1e81c,0xab3c1},
+{0x1e81d,0xab3e1},
+{0x1e81e,0xab401},
+{0x1e81f,0xab421},
+{0x1e820,0xab441},
+{0x1e821,0xab461},
+{0x1e822,0xab481},
+{0x1e823,0xab4a1},
+{0x1e824,0xab4c1},
+{0x1e825,0xab4e1},
+{0x1e826,0xab501},
+{0x1e827,0xab521},
+{0x1e828,0xab541},
+{0x1e829,0xab561},
+{0x1e82a,0xab581},
+{0x1e82b,0xab5a1},
+{0x1e82c,0xab5c1},
+{0x1e82d,0xab5e1},
+{0x1e82e,0xab601},
+{0x1e82f,0xab621},
+{0x1e830,0xab641},
+{0x1e831,0xab661},
+{0x1e832,0xab681},
+{0x1e833,0xab6a1},
+{0x1e834,0xab6c1},
+{0x1e835,0xab6e1},
+{0x1e836,0xab701},
+{0x1e837,0xab721},
+{0x1e838,0xab741},
+{0x1e839,0xab761},
+{0x1e83a,0xab781},
+{0x1e83b,0xab7a1},
+{0x1e83c,0xab7c1},
+{0x1e83d,0xab7e1},
+{0x1e83e,0xab801},
+{0x1e83f,0xab821},
+{0x1e840,0xab841},
+{0x1e841,0xab861},
+{0x1e842,0xab881},
+{0x1e843,0xab8a1},
+{0x1e844,0xab8c1},
+{0x1e845,0xab8e1},
+{0x1e846,0xab901},
+{0x1e847,0xab921},
+{0x1e848,0xab941},
+{0x1e849,0xab961},
+{0x1e84a,0xab981},
+{0x1e84b,0xab9a1},
+{0x1e84c,0xab9c1},
+{0x1e84d,0xab9e1},
+{0x1e84e,0xaba01},
+{0x1e84f,0xaba21},
+{0x1e850,0xaba41},
+{0x1e851,0xaba61},
+{0x1e852,0xaba81},
+{0x1e853,0xabaa1},
+{0x1e854,0xabac1},
+{0x1e855,0xabae1},
+{0x1e856,0xabb01},
+{0x1e857,0xabb21},
+{0x1e858,0xabb41},
+{0x1e859,0xabb61},
+{0x1e85a,0xabb81},
+{0x1e85b,0xabba1},
+{0x1e85c,0xabbc1},
+{0x1e85d,0xabbe1},
+{0x1e85e,0xabc01},
+{0x1e85f,0xabc21},
+{0x1e860,0xabc41},
+{0x1e861,0xabc61},
+{0x1e862,0xabc81},
+{0x1e863,0xabca1},
+{0x1e864,0xabcc1},
+{0x1e865,0xabce1},
+{0x1e866,0xabd01},
+{0x1e867,0xabd21},
+{0x1e868,0xabd41},
+{0x1e869,0xabd61},
+{0x1e86a,0xabd81},
+{0x1e86b,0xabda1},
+{0x1e86c,0xabdc1},
+{0x1e86d,0xabde1},
+{0x1e86e,0xabe01},
+{0x1e86f,0xabe21},
+{0x1e870,0xabe41},
+{0x1e871,0xabe61},
+{0x1e872,0xabe81},
+{0x1e873,0xabea1},
+{0x1e874,0xabec1},
+{0x1e875,0xabee1},
+{0x1e876,0xabf01},
+{0x1e877,0xabf21},
+{0x1e878,0xabf41},
+{0x1e879,0xabf61},
+{0x1e87a,0xabf81},
+{0x1e87b,0xabfa1},
+{0x1e87c,0xabfc1},
+{0x1e87d,0xabfe1},
+{0x1e87e,0xac001},
+{0x1e87f,0xac021},
+{0x1e880,0xac041},
+{0x1e881,0xac061},
+{0x1e882,0xac081},
+{0x1e883,0xac0a1},
+{0x1e884,0xac0c1},
+{0x1e885,0xac0e1},
+{0x1e886,0xac101},
+{0x1e887,0xac121},
+{0x1e888,0xac141},
+{0x1e889,0xac161},
+{0x1e88a,0xac181},
+{0x1e88b,0xac1a1},
+{0x1e88c,0xac1c1},
+{0x1e88d,0xac1e1},
+{0x1e88e,0xac201},
+{0x1e88f,0xac221},
+{0x1e890,0xac241},
+{0x1e891,0xac261},
+{0x1e892,0xac281},
+{0x1e893,0xac2a1},
+{0x1e894,0xac2c1},
+{0x1e895,0xac2e1},
+{0x1e896,0xac301},
+{0x1e897,0xac321},
+{0x1e898,0xac341},
+{0x1e899,0xac361},
+{0x1e89a,0xac381},
+{0x1e89b,0xac3a1},
+{0x1e89c,0xac3c1},
+{0x1e89d,0xac3e1},
+{0x1e89e,0xac401},
+{0x1e89f,0xac421},
+{0x1e8a0,0xac441},
+{0x1e8a1,0xac461},
+{0x1e8a2,0xac481},
+{0x1e8a3,0xac4a1},
+{0x1e8a4,0xac4c1},
+{0x1e8a5,0xac4e1},
+{0x1e8a6,0xac501},
+{0x1e8a7,0xac521},
+{0x1e8a8,0xac541},
+{0x1e8a9,0xac561},
+{0x1e8aa,0xac581},
+{0x1e8ab,0xac5a1},
+{0x1e8ac,0xac5c1},
+{0x1e8ad,0xac5e1},
+{0x1e8ae,0xac601},
+{0x1e8af,0xac621},
+{0x1e8b0,0xac641},
+{0x1e8b1,0xac661},
+{0x1e8b2,0xac681},
+{0x1e8b3,0xac6a1},
+{0x1e8b4,0xac6c1},
+{0x1e8b5,0xac6e1},
+{0x1e8b6,0xac701},
+{0x1e8b7,0xac721},
+{0x1e8b8,0xac741},
+{0x1e8b9,0xac761},
+{0x1e8ba,0xac781},
+{0x1e8bb,0xac7a1},
+{0x1e8bc,0xac7c1},
+{0x1e8bd,0xac7e1},
+{0x1e8be,0xac801},
+{0x1e8bf,0xac821},
+{0x1e8c0,0xac841},
+{0x1e8c1,0xac861},
+{0x1e8c2,0xac881},
+{0x1e8c3,0xac8a1},
+{0x1e8c4,0xac8c1},
+{0x1e8c7,0x382e1},
+{0x1e8c8,0x3a041},
+{0x1e8c9,0x3aec1},
+{0x1e8ca,0x3b641},
+{0x1e8cb,0x3bc01},
+{0x1e8cc,0x3bfe1},
+{0x1e8cd,0x3c301},
+{0x1e8ce,0x3c681},
+{0x1e8cf,0x3c9a1},
+{0x1e8d0,0x1},
+{0x1e8d1,0x1},
+{0x1e8d2,0x1},
+{0x1e8d3,0x1},
+{0x1e8d4,0x1},
+{0x1e8d5,0x1},
+{0x1e8d6,0x1},
+{0x1ee00,0x62161},
+{0x1ee01,0x623e1},
+{0x1ee02,0x63e61},
+{0x1ee03,0x64f21},
+{0x1ee05,0x6cae1},
+{0x1ee06,0x654c1},
+{0x1ee07,0x64721},
+{0x1ee08,0x67b41},
+{0x1ee09,0x6d101},
+{0x1ee0a,0x69801},
+{0x1ee0b,0x6a3e1},
+{0x1ee0c,0x6b061},
+{0x1ee0d,0x6b961},
+{0x1ee0e,0x657c1},
+{0x1ee0f,0x68181},
+{0x1ee10,0x68ba1},
+{0x1ee11,0x66c21},
+{0x1ee12,0x69301},
+{0x1ee13,0x65301},
+{0x1ee14,0x66141},
+{0x1ee15,0x62d81},
+{0x1ee16,0x63841},
+{0x1ee17,0x64b01},
+{0x1ee18,0x64fa1},
+{0x1ee19,0x67501},
+{0x1ee1a,0x67fc1},
+{0x1ee1b,0x68701},
+{0x1ee1c,0x623a1},
+{0x1ee1d,0x6c301},
+{0x1ee1e,0x69081},
+{0x1ee1f,0x692c1},
+{0x1ee21,0x623e1},
+{0x1ee22,0x63e61},
+{0x1ee24,0x6c4e1},
+{0x1ee27,0x64721},
+{0x1ee29,0x6d101},
+{0x1ee2a,0x69801},
+{0x1ee2b,0x6a3e1},
+{0x1ee2c,0x6b061},
+{0x1ee2d,0x6b961},
+{0x1ee2e,0x657c1},
+{0x1ee2f,0x68181},
+{0x1ee30,0x68ba1},
+{0x1ee31,0x66c21},
+{0x1ee32,0x69301},
+{0x1ee34,0x66141},
+{0x1ee35,0x62d81},
+{0x1ee36,0x63841},
+{0x1ee37,0x64b01},
+{0x1ee39,0x67501},
+{0x1ee3b,0x68701},
+{0x1ee42,0x63e61},
+{0x1ee47,0x64721},
+{0x1ee49,0x6d101},
+{0x1ee4b,0x6a3e1},
+{0x1ee4d,0x6b961},
+{0x1ee4e,0x657c1},
+{0x1ee4f,0x68181},
+{0x1ee51,0x66c21},
+{0x1ee52,0x69301},
+{0x1ee54,0x66141},
+{0x1ee57,0x64b01},
+{0x1ee59,0x67501},
+{0x1ee5b,0x68701},
+{0x1ee5d,0x6c301},
+{0x1ee5f,0x692c1},
+{0x1ee61,0x623e1},
+{0x1ee62,0x63e61},
+{0x1ee64,0x6c4e1},
+{0x1ee67,0x64721},
+{0x1ee68,0x67b41},
+{0x1ee69,0x6d101},
+{0x1ee6a,0x69801},
+{0x1ee6c,0x6b061},
+{0x1ee6d,0x6b961},
+{0x1ee6e,0x657c1},
+{0x1ee6f,0x68181},
+{0x1ee70,0x68ba1},
+{0x1ee71,0x66c21},
+{0x1ee72,0x69301},
+{0x1ee74,0x66141},
+{0x1ee75,0x62d81},
+{0x1ee76,0x63841},
+{0x1ee77,0x64b01},
+{0x1ee79,0x67501},
+{0x1ee7a,0x67fc1},
+{0x1ee7b,0x68701},
+{0x1ee7c,0x623a1},
+{0x1ee7e,0x69081},
+{0x1ee80,0x62161},
+{0x1ee81,0x623e1},
+{0x1ee82,0x63e61},
+{0x1ee83,0x64f21},
+{0x1ee84,0x6c4e1},
+{0x1ee85,0x6cae1},
+{0x1ee86,0x654c1},
+{0x1ee87,0x64721},
+{0x1ee88,0x67b41},
+{0x1ee89,0x6d101},
+{0x1ee8b,0x6a3e1},
+{0x1ee8c,0x6b061},
+{0x1ee8d,0x6b961},
+{0x1ee8e,0x657c1},
+{0x1ee8f,0x68181},
+{0x1ee90,0x68ba1},
+{0x1ee91,0x66c21},
+{0x1ee92,0x69301},
+{0x1ee93,0x65301},
+{0x1ee94,0x66141},
+{0x1ee95,0x62d81},
+{0x1ee96,0x63841},
+{0x1ee97,0x64b01},
+{0x1ee98,0x64fa1},
+{0x1ee99,0x67501},
+{0x1ee9a,0x67fc1},
+{0x1ee9b,0x68701},
+{0x1eea1,0x623e1},
+{0x1eea2,0x63e61},
+{0x1eea3,0x64f21},
+{0x1eea5,0x6cae1},
+{0x1eea6,0x654c1},
+{0x1eea7,0x64721},
+{0x1eea8,0x67b41},
+{0x1eea9,0x6d101},
+{0x1eeab,0x6a3e1},
+{0x1eeac,0x6b061},
+{0x1eead,0x6b961},
+{0x1eeae,0x657c1},
+{0x1eeaf,0x68181},
+{0x1eeb0,0x68ba1},
+{0x1eeb1,0x66c21},
+{0x1eeb2,0x69301},
+{0x1eeb3,0x65301},
+{0x1eeb4,0x66141},
+{0x1eeb5,0x62d81},
+{0x1eeb6,0x63841},
+{0x1eeb7,0x64b01},
+{0x1eeb8,0x64fa1},
+{0x1eeb9,0x67501},
+{0x1eeba,0x67fc1},
+{0x1eebb,0x68701},
+{0x1eef0,0x28b41},
+{0x1eef1,0x28b61},
+{0x1f000,0x28b81},
+{0x1f001,0x28ba1},
+{0x1f002,0x28bc1},
+{0x1f003,0x28be1},
+{0x1f004,0x28c01},
+{0x1f005,0x28c21},
+{0x1f006,0x28c41},
+{0x1f007,0x28c61},
+{0x1f008,0x28c81},
+{0x1f009,0x28ca1},
+{0x1f00a,0x28cc1},
+{0x1f00b,0x28ce1},
+{0x1f00c,0x28d01},
+{0x1f00d,0x28d21},
+{0x1f00e,0x28d41},
+{0x1f00f,0x28d61},
+{0x1f010,0x28d81},
+{0x1f011,0x28da1},
+{0x1f012,0x28dc1},
+{0x1f013,0x28de1},
+{0x1f014,0x28e01},
+{0x1f015,0x28e21},
+{0x1f016,0x28e41},
+{0x1f017,0x28e61},
+{0x1f018,0x28e81},
+{0x1f019,0x28ea1},
+{0x1f01a,0x28ec1},
+{0x1f01b,0x28ee1},
+{0x1f01c,0x28f01},
+{0x1f01d,0x28f21},
+{0x1f01e,0x28f41},
+{0x1f01f,0x28f61},
+{0x1f020,0x28f81},
+{0x1f021,0x28fa1},
+{0x1f022,0x28fc1},
+{0x1f023,0x28fe1},
+{0x1f024,0x29001},
+{0x1f025,0x29021},
+{0x1f026,0x29041},
+{0x1f027,0x29061},
+{0x1f028,0x29081},
+{0x1f029,0x290a1},
+{0x1f02a,0x290c1},
+{0x1f02b,0x290e1},
+{0x1f030,0x29101},
+{0x1f031,0x29121},
+{0x1f032,0x29141},
+{0x1f033,0x29161},
+{0x1f034,0x29181},
+{0x1f035,0x291a1},
+{0x1f036,0x291c1},
+{0x1f037,0x291e1},
+{0x1f038,0x29201},
+{0x1f039,0x29221},
+{0x1f03a,0x29241},
+{0x1f03b,0x29261},
+{0x1f03c,0x29281},
+{0x1f03d,0x292a1},
+{0x1f03e,0x292c1},
+{0x1f03f,0x292e1},
+{0x1f040,0x29301},
+{0x1f041,0x29321},
+{0x1f042,0x29341},
+{0x1f043,0x29361},
+{0x1f044,0x29381},
+{0x1f045,0x293a1},
+{0x1f046,0x293c1},
+{0x1f047,0x293e1},
+{0x1f048,0x29401},
+{0x1f049,0x29421},
+{0x1f04a,0x29441},
+{0x1f04b,0x29461},
+{0x1f04c,0x29481},
+{0x1f04d,0x294a1},
+{0x1f04e,0x294c1},
+{0x1f04f,0x294e1},
+{0x1f050,0x29501},
+{0x1f051,0x29521},
+{0x1f052,0x29541},
+{0x1f053,0x29561},
+{0x1f054,0x29581},
+{0x1f055,0x295a1},
+{0x1f056,0x295c1},
+{0x1f057,0x295e1},
+{0x1f058,0x29601},
+{0x1f059,0x29621},
+{0x1f05a,0x29641},
+{0x1f05b,0x29661},
+{0x1f05c,0x29681},
+{0x1f05d,0x296a1},
+{0x1f05e,0x296c1},
+{0x1f05f,0x296e1},
+{0x1f060,0x29701},
+{0x1f061,0x29721},
+{0x1f062,0x29741},
+{0x1f063,0x29761},
+{0x1f064,0x29781},
+{0x1f065,0x297a1},
+{0x1f066,0x297c1},
+{0x1f067,0x297e1},
+{0x1f068,0x29801},
+{0x1f069,0x29821},
+{0x1f06a,0x29841},
+{0x1f06b,0x29861},
+{0x1f06c,0x29881},
+{0x1f06d,0x298a1},
+{0x1f06e,0x298c1},
+{0x1f06f,0x298e1},
+{0x1f070,0x29901},
+{0x1f071,0x29921},
+{0x1f072,0x29941},
+{0x1f073,0x29961},
+{0x1f074,0x29981},
+{0x1f075,0x299a1},
+{0x1f076,0x299c1},
+{0x1f077,0x299e1},
+{0x1f078,0x29a01},
+{0x1f079,0x29a21},
+{0x1f07a,0x29a41},
+{0x1f07b,0x29a61},
+{0x1f07c,0x29a81},
+{0x1f07d,0x29aa1},
+{0x1f07e,0x29ac1},
+{0x1f07f,0x29ae1},
+{0x1f080,0x29b01},
+{0x1f081,0x29b21},
+{0x1f082,0x29b41},
+{0x1f083,0x29b61},
+{0x1f084,0x29b81},
+{0x1f085,0x29ba1},
+{0x1f086,0x29bc1},
+{0x1f087,0x29be1},
+{0x1f088,0x29c01},
+{0x1f089,0x29c21},
+{0x1f08a,0x29c41},
+{0x1f08b,0x29c61},
+{0x1f08c,0x29c81},
+{0x1f08d,0x29ca1},
+{0x1f08e,0x29cc1},
+{0x1f08f,0x29ce1},
+{0x1f090,0x29d01},
+{0x1f091,0x29d21},
+{0x1f092,0x29d41},
+{0x1f093,0x29d61},
+{0x1f0a0,0x29d81},
+{0x1f0a1,0x29da1},
+{0x1f0a2,0x29dc1},
+{0x1f0a3,0x29de1},
+{0x1f0a4,0x29e01},
+{0x1f0a5,0x29e21},
+{0x1f0a6,0x29e41},
+{0x1f0a7,0x29e61},
+{0x1f0a8,0x29e81},
+{0x1f0a9,0x29ea1},
+{0x1f0aa,0x29ec1},
+{0x1f0ab,0x29ee1},
+{0x1f0ac,0x29f01},
+{0x1f0ad,0x29f21},
+{0x1f0ae,0x29f41},
+{0x1f0b1,0x29f61},
+{0x1f0b2,0x29f81},
+{0x1f0b3,0x29fa1},
+{0x1f0b4,0x29fc1},
+{0x1f0b5,0x29fe1},
+{0x1f0b6,0x2a001},
+{0x1f0b7,0x2a021},
+{0x1f0b8,0x2a041},
+{0x1f0b9,0x2a061},
+{0x1f0ba,0x2a081},
+{0x1f0bb,0x2a0a1},
+{0x1f0bc,0x2a0c1},
+{0x1f0bd,0x2a0e1},
+{0x1f0be,0x2a101},
+{0x1f0bf,0x2a121},
+{0x1f0c1,0x2a141},
+{0x1f0c2,0x2a161},
+{0x1f0c3,0x2a181},
+{0x1f0c4,0x2a1a1},
+{0x1f0c5,0x2a1c1},
+{0x1f0c6,0x2a1e1},
+{0x1f0c7,0x2a201},
+{0x1f0c8,0x2a221},
+{0x1f0c9,0x2a241},
+{0x1f0ca,0x2a261},
+{0x1f0cb,0x2a281},
+{0x1f0cc,0x2a2a1},
+{0x1f0cd,0x2a2c1},
+{0x1f0ce,0x2a2e1},
+{0x1f0cf,0x2a301},
+{0x1f0d1,0x2a321},
+{0x1f0d2,0x2a341},
+{0x1f0d3,0x2a361},
+{0x1f0d4,0x2a381},
+{0x1f0d5,0x2a3a1},
+{0x1f0d6,0x2a3c1},
+{0x1f0d7,0x2a3e1},
+{0x1f0d8,0x2a401},
+{0x1f0d9,0x2a421},
+{0x1f0da,0x2a441},
+{0x1f0db,0x2a461},
+{0x1f0dc,0x2a481},
+{0x1f0dd,0x2a4a1},
+{0x1f0de,0x2a4c1},
+{0x1f0df,0x2a4e1},
+{0x1f0e0,0x2a501},
+{0x1f0e1,0x2a521},
+{0x1f0e2,0x2a541},
+{0x1f0e3,0x2a561},
+{0x1f0e4,0x2a581},
+{0x1f0e5,0x2a5a1},
+{0x1f0e6,0x2a5c1},
+{0x1f0e7,0x2a5e1},
+{0x1f0e8,0x2a601},
+{0x1f0e9,0x2a621},
+{0x1f0ea,0x2a641},
+{0x1f0eb,0x2a661},
+{0x1f0ec,0x2a681},
+{0x1f0ed,0x2a6a1},
+{0x1f0ee,0x2a6c1},
+{0x1f0ef,0x2a6e1},
+{0x1f0f0,0x2a701},
+{0x1f0f1,0x2a721},
+{0x1f0f2,0x2a741},
+{0x1f0f3,0x2a761},
+{0x1f0f4,0x2a781},
+{0x1f0f5,0x2a7a1},
+{0x1f100,0x38122},
+{0x1f101,0x38162},
+{0x1f102,0x383e2},
+{0x1f103,0x3a142},
+{0x1f104,0x3afc2},
+{0x1f105,0x3b742},
+{0x1f106,0x3bd02},
+{0x1f107,0x3c0e2},
+{0x1f108,0x3c402},
+{0x1f109,0x3c782},
+{0x1f10a,0x3caa2},
+{0x1f10b,0x381c1},
+{0x1f10c,0x381c1},
+{0x1f110,0x3cdc3},
+{0x1f111,0x3ee43},
+{0x1f112,0x3f4e3},
+{0x1f113,0x400e3},
+{0x1f114,0x40e23},
+{0x1f115,0x42423},
+{0x1f116,0x42b83},
+{0x1f117,0x43643},
+{0x1f118,0x440e3},
+{0x1f119,0x45103},
+{0x1f11a,0x45563},
+{0x1f11b,0x46143},
+{0x1f11c,0x46fe3},
+{0x1f11d,0x47c23},
+{0x1f11e,0x48963},
+{0x1f11f,0x4aa23},
+{0x1f120,0x4b383},
+{0x1f121,0x4b6c3},
+{0x1f122,0x4c583},
+{0x1f123,0x4d4e3},
+{0x1f124,0x4e003},
+{0x1f125,0x4f963},
+{0x1f126,0x501c3},
+{0x1f127,0x50883},
+{0x1f128,0x50e03},
+{0x1f129,0x51623},
+{0x1f12a,0x4c5e3},
+{0x1f12b,0x3f561},
+{0x1f12c,0x4b741},
+{0x1f12d,0x3f9e2},
+{0x1f12e,0x50662},
+{0x1f130,0x3cea1},
+{0x1f131,0x3ef01},
+{0x1f132,0x3f5a1},
+{0x1f133,0x401a1},
+{0x1f134,0x40f01},
+{0x1f135,0x424e1},
+{0x1f136,0x42c41},
+{0x1f137,0x43721},
+{0x1f138,0x441c1},
+{0x1f139,0x451e1},
+{0x1f13a,0x45641},
+{0x1f13b,0x46221},
+{0x1f13c,0x470c1},
+{0x1f13d,0x47d01},
+{0x1f13e,0x48a41},
+{0x1f13f,0x4ab01},
+{0x1f140,0x4b421},
+{0x1f141,0x4b7a1},
+{0x1f142,0x4c6c1},
+{0x1f143,0x4d5c1},
+{0x1f144,0x4e0e1},
+{0x1f145,0x4fa41},
+{0x1f146,0x50281},
+{0x1f147,0x50961},
+{0x1f148,0x50ec1},
+{0x1f149,0x516e1},
+{0x1f14a,0x43ce2},
+{0x1f14b,0x47882},
+{0x1f14c,0x4ce42},
+{0x1f14d,0x4cf62},
+{0x1f14e,0x4ae83},
+{0x1f14f,0x50622},
+{0x1f150,0x3ce41},
+{0x1f151,0x3eec1},
+{0x1f152,0x3f561},
+{0x1f153,0x40161},
+{0x1f154,0x40ea1},
+{0x1f155,0x424a1},
+{0x1f156,0x42c01},
+{0x1f157,0x436c1},
+{0x1f158,0x44161},
+{0x1f159,0x45181},
+{0x1f15a,0x455e1},
+{0x1f15b,0x461c1},
+{0x1f15c,0x47061},
+{0x1f15d,0x47ca1},
+{0x1f15e,0x489e1},
+{0x1f15f,0x4aaa1},
+{0x1f160,0x4b401},
+{0x1f161,0x4b741},
+{0x1f162,0x4c661},
+{0x1f163,0x4d561},
+{0x1f164,0x4e081},
+{0x1f165,0x4f9e1},
+{0x1f166,0x50241},
+{0x1f167,0x50901},
+{0x1f168,0x50e81},
+{0x1f169,0x516a1},
+{0x1f16a,0x473a2},
+{0x1f16b,0x473e2},
+{0x1f170,0x3cea1},
+{0x1f171,0x3ef01},
+{0x1f172,0x3f5a1},
+{0x1f173,0x401a1},
+{0x1f174,0x40f01},
+{0x1f175,0x424e1},
+{0x1f176,0x42c41},
+{0x1f177,0x43721},
+{0x1f178,0x441c1},
+{0x1f179,0x451e1},
+{0x1f17a,0x45641},
+{0x1f17b,0x46221},
+{0x1f17c,0x470c1},
+{0x1f17d,0x47d01},
+{0x1f17e,0x48a41},
+{0x1f17f,0x4ab01},
+{0x1f180,0x4b421},
+{0x1f181,0x4b7a1},
+{0x1f182,0x4c6c1},
+{0x1f183,0x4d5c1},
+{0x1f184,0x4e0e1},
+{0x1f185,0x4fa41},
+{0x1f186,0x50281},
+{0x1f187,0x50961},
+{0x1f188,0x50ec1},
+{0x1f189,0x516e1},
+{0x1f18a,0x4ab01},
+{0x1f18b,0x449e2},
+{0x1f18c,0x4aca2},
+{0x1f18d,0x4ce02},
+{0x1f18e,0x3e1c2},
+{0x1f18f,0x50622},
+{0x1f190,0x40742},
+{0x1f191,0x3fae2},
+{0x1f192,0x3fce4},
+{0x1f193,0x42864},
+{0x1f194,0x44a22},
+{0x1f195,0x48263},
+{0x1f196,0x48302},
+{0x1f197,0x4a302},
+{0x1f198,0x4cec3},
+{0x1f199,0x4f383},
+{0x1f19a,0x4fe02},
+{0x1f1e6,0x2a7c1},
+{0x1f1e7,0x2a7e1},
+{0x1f1e8,0x2a801},
+{0x1f1e9,0x2a821},
+{0x1f1ea,0x2a841},
+{0x1f1eb,0x2a861},
+{0x1f1ec,0x2a881},
+{0x1f1ed,0x2a8a1},
+{0x1f1ee,0x2a8c1},
+{0x1f1ef,0x2a8e1},
+{0x1f1f0,0x2a901},
+{0x1f1f1,0x2a921},
+{0x1f1f2,0x2a941},
+{0x1f1f3,0x2a961},
+{0x1f1f4,0x2a981},
+{0x1f1f5,0x2a9a1},
+{0x1f1f6,0x2a9c1},
+{0x1f1f7,0x2a9e1},
+{0x1f1f8,0x2aa01},
+{0x1f1f9,0x2aa21},
+{0x1f1fa,0x2aa41},
+{0x1f1fb,0x2aa61},
+{0x1f1fc,0x2aa81},
+{0x1f1fd,0x2aaa1},
+{0x1f1fe,0x2aac1},
+{0x1f1ff,0x2aae1},
+{0x1f200,0xb5e62},
+{0x1f201,0xb3742},
+{0x1f202,0xb38a1},
+{0x1f210,0xee122},
+{0x1f211,0xebea2},
+{0x1f212,0xea322},
+{0x1f213,0xb4522},
+{0x1f214,0xe7de2},
+{0x1f215,0xeb7e2},
+{0x1f216,0xf7102},
+{0x1f217,0xeb9a2},
+{0x1f218,0xe7f22},
+{0x1f219,0xef182},
+{0x1f21a,0xf1802},
+{0x1f21b,0xeed22},
+{0x1f21c,0xe9482},
+{0x1f21d,0xed602},
+{0x1f21e,0xe8cc2},
+{0x1f21f,0xeeda2},
+{0x1f220,0xe9342},
+{0x1f221,0xf4622},
+{0x1f222,0xf27a2},
+{0x1f223,0xf77c2},
+{0x1f224,0xeb5e2},
+{0x1f225,0xea762},
+{0x1f226,0xf11c2},
+{0x1f227,0xee2a2},
+{0x1f228,0xee562},
+{0x1f229,0xe7122},
+{0x1f22a,0xe73e2},
+{0x1f22b,0xf82e2},
+{0x1f22c,0xecb62},
+{0x1f22d,0xe76e2},
+{0x1f22e,0xea522},
+{0x1f22f,0xee4a2},
+{0x1f230,0xf7b42},
+{0x1f231,0xee222},
+{0x1f232,0xf3ac2},
+{0x1f233,0xf3e82},
+{0x1f234,0xea5a2},
+{0x1f235,0xf0fc2},
+{0x1f236,0xef762},
+{0x1f237,0xef602},
+{0x1f238,0xf28e2},
+{0x1f239,0xe9502},
+{0x1f23a,0xeaca2},
+{0x1f240,0xef964},
+{0x1f241,0xe72e4},
+{0x1f242,0xe7ce4},
+{0x1f243,0xec024},
+{0x1f244,0xf1704},
+{0x1f245,0xee1a4},
+{0x1f246,0xf2e44},
+{0x1f247,0xe9844},
+{0x1f248,0xeeb24},
+{0x1f250,0xed642},
+{0x1f251,0xea462},
+{0x1f300,0x2ab01},
+{0x1f301,0x2ab21},
+{0x1f302,0x2ab41},
+{0x1f303,0x2ab61},
+{0x1f304,0x2ab81},
+{0x1f305,0x2aba1},
+{0x1f306,0x2abc1},
+{0x1f307,0x2abe1},
+{0x1f308,0x2ac01},
+{0x1f309,0x2ac21},
+{0x1f30a,0x2ac41},
+{0x1f30b,0x2ac61},
+{0x1f30c,0x2ac81},
+{0x1f30d,0x2aca1},
+{0x1f30e,0x2acc1},
+{0x1f30f,0x2ace1},
+{0x1f310,0x2ad01},
+{0x1f311,0x2ad21},
+{0x1f312,0x2ad41},
+{0x1f313,0x2ad61},
+{0x1f314,0x2ad81},
+{0x1f315,0x2ada1},
+{0x1f316,0x2adc1},
+{0x1f317,0x2ade1},
+{0x1f318,0x2ae01},
+{0x1f319,0x2ae21},
+{0x1f31a,0x2ae41},
+{0x1f31b,0x2ae61},
+{0x1f31c,0x2ae81},
+{0x1f31d,0x2aea1},
+{0x1f31e,0x2aec1},
+{0x1f31f,0x2aee1},
+{0x1f320,0x2af01},
+{0x1f321,0x2af21},
+{0x1f322,0x2af41},
+{0x1f323,0x2af61},
+{0x1f324,0x2af81},
+{0x1f325,0x2afa1},
+{0x1f326,0x2afc1},
+{0x1f327,0x2afe1},
+{0x1f328,0x2b001},
+{0x1f329,0x2b021},
+{0x1f32a,0x2b041},
+{0x1f32b,0x2b061},
+{0x1f32c,0x2b081},
+{0x1f32d,0x2b0a1},
+{0x1f32e,0x2b0c1},
+{0x1f32f,0x2b0e1},
+{0x1f330,0x2b101},
+{0x1f331,0x2b121},
+{0x1f332,0x2b141},
+{0x1f333,0x2b161},
+{0x1f334,0x2b181},
+{0x1f335,0x2b1a1},
+{0x1f336,0x2b1c1},
+{0x1f337,0x2b1e1},
+{0x1f338,0x2b201},
+{0x1f339,0x2b221},
+{0x1f33a,0x2b241},
+{0x1f33b,0x2b261},
+{0x1f33c,0x2b281},
+{0x1f33d,0x2b2a1},
+{0x1f33e,0x2b2c1},
+{0x1f33f,0x2b2e1},
+{0x1f340,0x2b301},
+{0x1f341,0x2b321},
+{0x1f342,0x2b341},
+{0x1f343,0x2b361},
+{0x1f344,0x2b381},
+{0x1f345,0x2b3a1},
+{0x1f346,0x2b3c1},
+{0x1f347,0x2b3e1},
+{0x1f348,0x2b401},
+{0x1f349,0x2b421},
+{0x1f34a,0x2b441},
+{0x1f34b,0x2b461},
+{0x1f34c,0x2b481},
+{0x1f34d,0x2b4a1},
+{0x1f34e,0x2b4c1},
+{0x1f34f,0x2b4e1},
+{0x1f350,0x2b501},
+{0x1f351,0x2b521},
+{0x1f352,0x2b541},
+{0x1f353,0x2b561},
+{0x1f354,0x2b581},
+{0x1f355,0x2b5a1},
+{0x1f356,0x2b5c1},
+{0x1f357,0x2b5e1},
+{0x1f358,0x2b601},
+{0x1f359,0x2b621},
+{0x1f35a,0x2b641},
+{0x1f35b,0x2b661},
+{0x1f35c,0x2b681},
+{0x1f35d,0x2b6a1},
+{0x1f35e,0x2b6c1},
+{0x1f35f,0x2b6e1},
+{0x1f360,0x2b701},
+{0x1f361,0x2b721},
+{0x1f362,0x2b741},
+{0x1f363,0x2b761},
+{0x1f364,0x2b781},
+{0x1f365,0x2b7a1},
+{0x1f366,0x2b7c1},
+{0x1f367,0x2b7e1},
+{0x1f368,0x2b801},
+{0x1f369,0x2b821},
+{0x1f36a,0x2b841},
+{0x1f36b,0x2b861},
+{0x1f36c,0x2b881},
+{0x1f36d,0x2b8a1},
+{0x1f36e,0x2b8c1},
+{0x1f36f,0x2b8e1},
+{0x1f370,0x2b901},
+{0x1f371,0x2b921},
+{0x1f372,0x2b941},
+{0x1f373,0x2b961},
+{0x1f374,0x2b981},
+{0x1f375,0x2b9a1},
+{0x1f376,0x2b9c1},
+{0x1f377,0x2b9e1},
+{0x1f378,0x2ba01},
+{0x1f379,0x2ba21},
+{0x1f37a,0x2ba41},
+{0x1f37b,0x2ba61},
+{0x1f37c,0x2ba81},
+{0x1f37d,0x2baa1},
+{0x1f37e,0x2bac1},
+{0x1f37f,0x2bae1},
+{0x1f380,0x2bb01},
+{0x1f381,0x2bb21},
+{0x1f382,0x2bb41},
+{0x1f383,0x2bb61},
+{0x1f384,0x2bb81},
+{0x1f385,0x2bba1},
+{0x1f386,0x2bbc1},
+{0x1f387,0x2bbe1},
+{0x1f388,0x2bc01},
+{0x1f389,0x2bc21},
+{0x1f38a,0x2bc41},
+{0x1f38b,0x2bc61},
+{0x1f38c,0x2bc81},
+{0x1f38d,0x2bca1},
+{0x1f38e,0x2bcc1},
+{0x1f38f,0x2bce1},
+{0x1f390,0x2bd01},
+{0x1f391,0x2bd21},
+{0x1f392,0x2bd41},
+{0x1f393,0x2bd61},
+{0x1f394,0x2bd81},
+{0x1f395,0x2bda1},
+{0x1f396,0x2bdc1},
+{0x1f397,0x2bde1},
+{0x1f398,0x2be01},
+{0x1f399,0x2be21},
+{0x1f39a,0x2be41},
+{0x1f39b,0x2be61},
+{0x1f39c,0x2be81},
+{0x1f39d,0x2bea1},
+{0x1f39e,0x2bec1},
+{0x1f39f,0x2bee1},
+{0x1f3a0,0x2bf01},
+{0x1f3a1,0x2bf21},
+{0x1f3a2,0x2bf41},
+{0x1f3a3,0x2bf61},
+{0x1f3a4,0x2bf81},
+{0x1f3a5,0x2bfa1},
+{0x1f3a6,0x2bfc1},
+{0x1f3a7,0x2bfe1},
+{0x1f3a8,0x2c001},
+{0x1f3a9,0x2c021},
+{0x1f3aa,0x2c041},
+{0x1f3ab,0x2c061},
+{0x1f3ac,0x2c081},
+{0x1f3ad,0x2c0a1},
+{0x1f3ae,0x2c0c1},
+{0x1f3af,0x2c0e1},
+{0x1f3b0,0x2c101},
+{0x1f3b1,0x2c121},
+{0x1f3b2,0x2c141},
+{0x1f3b3,0x2c161},
+{0x1f3b4,0x2c181},
+{0x1f3b5,0x2c1a1},
+{0x1f3b6,0x2c1c1},
+{0x1f3b7,0x2c1e1},
+{0x1f3b8,0x2c201},
+{0x1f3b9,0x2c221},
+{0x1f3ba,0x2c241},
+{0x1f3bb,0x2c261},
+{0x1f3bc,0x2c281},
+{0x1f3bd,0x2c2a1},
+{0x1f3be,0x2c2c1},
+{0x1f3bf,0x2c2e1},
+{0x1f3c0,0x2c301},
+{0x1f3c1,0x2c321},
+{0x1f3c2,0x2c341},
+{0x1f3c3,0x2c361},
+{0x1f3c4,0x2c381},
+{0x1f3c5,0x2c3a1},
+{0x1f3c6,0x2c3c1},
+{0x1f3c7,0x2c3e1},
+{0x1f3c8,0x2c401},
+{0x1f3c9,0x2c421},
+{0x1f3ca,0x2c441},
+{0x1f3cb,0x2c461},
+{0x1f3cc,0x2c481},
+{0x1f3cd,0x2c4a1},
+{0x1f3ce,0x2c4c1},
+{0x1f3cf,0x2c4e1},
+{0x1f3d0,0x2c501},
+{0x1f3d1,0x2c521},
+{0x1f3d2,0x2c541},
+{0x1f3d3,0x2c561},
+{0x1f3d4,0x2c581},
+{0x1f3d5,0x2c5a1},
+{0x1f3d6,0x2c5c1},
+{0x1f3d7,0x2c5e1},
+{0x1f3d8,0x2c601},
+{0x1f3d9,0x2c621},
+{0x1f3da,0x2c641},
+{0x1f3db,0x2c661},
+{0x1f3dc,0x2c681},
+{0x1f3dd,0x2c6a1},
+{0x1f3de,0x2c6c1},
+{0x1f3df,0x2c6e1},
+{0x1f3e0,0x2c701},
+{0x1f3e1,0x2c721},
+{0x1f3e2,0x2c741},
+{0x1f3e3,0x2c761},
+{0x1f3e4,0x2c781},
+{0x1f3e5,0x2c7a1},
+{0x1f3e6,0x2c7c1},
+{0x1f3e7,0x2c7e1},
+{0x1f3e8,0x2c801},
+{0x1f3e9,0x2c821},
+{0x1f3ea,0x2c841},
+{0x1f3eb,0x2c861},
+{0x1f3ec,0x2c881},
+{0x1f3ed,0x2c8a1},
+{0x1f3ee,0x2c8c1},
+{0x1f3ef,0x2c8e1},
+{0x1f3f0,0x2c901},
+{0x1f3f1,0x2c921},
+{0x1f3f2,0x2c941},
+{0x1f3f3,0x2c961},
+{0x1f3f4,0x2c981},
+{0x1f3f5,0x2c9a1},
+{0x1f3f6,0x2c9c1},
+{0x1f3f7,0x2c9e1},
+{0x1f3f8,0x2ca01},
+{0x1f3f9,0x2ca21},
+{0x1f3fa,0x2ca41},
+{0x1f3fb,0x2ca61},
+{0x1f3fc,0x2ca81},
+{0x1f3fd,0x2caa1},
+{0x1f3fe,0x2cac1},
+{0x1f3ff,0x2cae1},
+{0x1f400,0x2cb01},
+{0x1f401,0x2cb21},
+{0x1f402,0x2cb41},
+{0x1f403,0x2cb61},
+{0x1f404,0x2cb81},
+{0x1f405,0x2cba1},
+{0x1f406,0x2cbc1},
+{0x1f407,0x2cbe1},
+{0x1f408,0x2cc01},
+{0x1f409,0x2cc21},
+{0x1f40a,0x2cc41},
+{0x1f40b,0x2cc61},
+{0x1f40c,0x2cc81},
+{0x1f40d,0x2cca1},
+{0x1f40e,0x2ccc1},
+{0x1f40f,0x2cce1},
+{0x1f410,0x2cd01},
+{0x1f411,0x2cd21},
+{0x1f412,0x2cd41},
+{0x1f413,0x2cd61},
+{0x1f414,0x2cd81},
+{0x1f415,0x2cda1},
+{0x1f416,0x2cdc1},
+{0x1f417,0x2cde1},
+{0x1f418,0x2ce01},
+{0x1f419,0x2ce21},
+{0x1f41a,0x2ce41},
+{0x1f41b,0x2ce61},
+{0x1f41c,0x2ce81},
+{0x1f41d,0x2cea1},
+{0x1f41e,0x2cec1},
+{0x1f41f,0x2cee1},
+{0x1f420,0x2cf01},
+{0x1f421,0x2cf21},
+{0x1f422,0x2cf41},
+{0x1f423,0x2cf61},
+{0x1f424,0x2cf81},
+{0x1f425,0x2cfa1},
+{0x1f426,0x2cfc1},
+{0x1f427,0x2cfe1},
+{0x1f428,0x2d001},
+{0x1f429,0x2d021},
+{0x1f42a,0x2d041},
+{0x1f42b,0x2d061},
+{0x1f42c,0x2d081},
+{0x1f42d,0x2d0a1},
+{0x1f42e,0x2d0c1},
+{0x1f42f,0x2d0e1},
+{0x1f430,0x2d101},
+{0x1f431,0x2d121},
+{0x1f432,0x2d141},
+{0x1f433,0x2d161},
+{0x1f434,0x2d181},
+{0x1f435,0x2d1a1},
+{0x1f436,0x2d1c1},
+{0x1f437,0x2d1e1},
+{0x1f438,0x2d201},
+{0x1f439,0x2d221},
+{0x1f43a,0x2d241},
+{0x1f43b,0x2d261},
+{0x1f43c,0x2d281},
+{0x1f43d,0x2d2a1},
+{0x1f43e,0x2d2c1},
+{0x1f43f,0x2d2e1},
+{0x1f440,0x2d301},
+{0x1f441,0x2d321},
+{0x1f442,0x2d341},
+{0x1f443,0x2d361},
+{0x1f444,0x2d381},
+{0x1f445,0x2d3a1},
+{0x1f446,0x2d3c1},
+{0x1f447,0x2d3e1},
+{0x1f448,0x2d401},
+{0x1f449,0x2d421},
+{0x1f44a,0x2d441},
+{0x1f44b,0x2d461},
+{0x1f44c,0x2d481},
+{0x1f44d,0x2d4a1},
+{0x1f44e,0x2d4c1},
+{0x1f44f,0x2d4e1},
+{0x1f450,0x2d501},
+{0x1f451,0x2d521},
+{0x1f452,0x2d541},
+{0x1f453,0x2d561},
+{0x1f454,0x2d581},
+{0x1f455,0x2d5a1},
+{0x1f456,0x2d5c1},
+{0x1f457,0x2d5e1},
+{0x1f458,0x2d601},
+{0x1f459,0x2d621},
+{0x1f45a,0x2d641},
+{0x1f45b,0x2d661},
+{0x1f45c,0x2d681},
+{0x1f45d,0x2d6a1},
+{0x1f45e,0x2d6c1},
+{0x1f45f,0x2d6e1},
+{0x1f460,0x2d701},
+{0x1f461,0x2d721},
+{0x1f462,0x2d741},
+{0x1f463,0x2d761},
+{0x1f464,0x2d781},
+{0x1f465,0x2d7a1},
+{0x1f466,0x2d7c1},
+{0x1f467,0x2d7e1},
+{0x1f468,0x2d801},
+{0x1f469,0x2d821},
+{0x1f46a,0x2d841},
+{0x1f46b,0x2d861},
+{0x1f46c,0x2d881},
+{0x1f46d,0x2d8a1},
+{0x1f46e,0x2d8c1},
+{0x1f46f,0x2d8e1},
+{0x1f470,0x2d901},
+{0x1f471,0x2d921},
+{0x1f472,0x2d941},
+{0x1f473,0x2d961},
+{0x1f474,0x2d981},
+{0x1f475,0x2d9a1},
+{0x1f476,0x2d9c1},
+{0x1f477,0x2d9e1},
+{0x1f478,0x2da01},
+{0x1f479,0x2da21},
+{0x1f47a,0x2da41},
+{0x1f47b,0x2da61},
+{0x1f47c,0x2da81},
+{0x1f47d,0x2daa1},
+{0x1f47e,0x2dac1},
+{0x1f47f,0x2dae1},
+{0x1f480,0x2db01},
+{0x1f481,0x2db21},
+{0x1f482,0x2db41},
+{0x1f483,0x2db61},
+{0x1f484,0x2db81},
+{0x1f485,0x2dba1},
+{0x1f486,0x2dbc1},
+{0x1f487,0x2dbe1},
+{0x1f488,0x2dc01},
+{0x1f489,0x2dc21},
+{0x1f48a,0x2dc41},
+{0x1f48b,0x2dc61},
+{0x1f48c,0x2dc81},
+{0x1f48d,0x2dca1},
+{0x1f48e,0x2dcc1},
+{0x1f48f,0x2dce1},
+{0x1f490,0x2dd01},
+{0x1f491,0x2dd21},
+{0x1f492,0x2dd41},
+{0x1f493,0x2dd61},
+{0x1f494,0x2dd81},
+{0x1f495,0x2dda1},
+{0x1f496,0x2ddc1},
+{0x1f497,0x2dde1},
+{0x1f498,0x2de01},
+{0x1f499,0x2de21},
+{0x1f49a,0x2de41},
+{0x1f49b,0x2de61},
+{0x1f49c,0x2de81},
+{0x1f49d,0x2dea1},
+{0x1f49e,0x2dec1},
+{0x1f49f,0x2dee1},
+{0x1f4a0,0x2df01},
+{0x1f4a1,0x2df21},
+{0x1f4a2,0x2df41},
+{0x1f4a3,0x2df61},
+{0x1f4a4,0x2df81},
+{0x1f4a5,0x2dfa1},
+{0x1f4a6,0x2dfc1},
+{0x1f4a7,0x2dfe1},
+{0x1f4a8,0x2e001},
+{0x1f4a9,0x2e021},
+{0x1f4aa,0x2e041},
+{0x1f4ab,0x2e061},
+{0x1f4ac,0x2e081},
+{0x1f4ad,0x2e0a1},
+{0x1f4ae,0x2e0c1},
+{0x1f4af,0x2e0e1},
+{0x1f4b0,0x2e101},
+{0x1f4b1,0x2e121},
+{0x1f4b2,0x2e141},
+{0x1f4b3,0x2e161},
+{0x1f4b4,0x2e181},
+{0x1f4b5,0x2e1a1},
+{0x1f4b6,0x2e1c1},
+{0x1f4b7,0x2e1e1},
+{0x1f4b8,0x2e201},
+{0x1f4b9,0x2e221},
+{0x1f4ba,0x2e241},
+{0x1f4bb,0x2e261},
+{0x1f4bc,0x2e281},
+{0x1f4bd,0x2e2a1},
+{0x1f4be,0x2e2c1},
+{0x1f4bf,0x2e2e1},
+{0x1f4c0,0x2e301},
+{0x1f4c1,0x2e321},
+{0x1f4c2,0x2e341},
+{0x1f4c3,0x2e361},
+{0x1f4c4,0x2e381},
+{0x1f4c5,0x2e3a1},
+{0x1f4c6,0x2e3c1},
+{0x1f4c7,0x2e3e1},
+{0x1f4c8,0x2e401},
+{0x1f4c9,0x2e421},
+{0x1f4ca,0x2e441},
+{0x1f4cb,0x2e461},
+{0x1f4cc,0x2e481},
+{0x1f4cd,0x2e4a1},
+{0x1f4ce,0x2e4c1},
+{0x1f4cf,0x2e4e1},
+{0x1f4d0,0x2e501},
+{0x1f4d1,0x2e521},
+{0x1f4d2,0x2e541},
+{0x1f4d3,0x2e561},
+{0x1f4d4,0x2e581},
+{0x1f4d5,0x2e5a1},
+{0x1f4d6,0x2e5c1},
+{0x1f4d7,0x2e5e1},
+{0x1f4d8,0x2e601},
+{0x1f4d9,0x2e621},
+{0x1f4da,0x2e641},
+{0x1f4db,0x2e661},
+{0x1f4dc,0x2e681},
+{0x1f4dd,0x2e6a1},
+{0x1f4de,0x2e6c1},
+{0x1f4df,0x2e6e1},
+{0x1f4e0,0x2e701},
+{0x1f4e1,0x2e721},
+{0x1f4e2,0x2e741},
+{0x1f4e3,0x2e761},
+{0x1f4e4,0x2e781},
+{0x1f4e5,0x2e7a1},
+{0x1f4e6,0x2e7c1},
+{0x1f4e7,0x2e7e1},
+{0x1f4e8,0x2e801},
+{0x1f4e9,0x2e821},
+{0x1f4ea,0x2e841},
+{0x1f4eb,0x2e861},
+{0x1f4ec,0x2e881},
+{0x1f4ed,0x2e8a1},
+{0x1f4ee,0x2e8c1},
+{0x1f4ef,0x2e8e1},
+{0x1f4f0,0x2e901},
+{0x1f4f1,0x2e921},
+{0x1f4f2,0x2e941},
+{0x1f4f3,0x2e961},
+{0x1f4f4,0x2e981},
+{0x1f4f5,0x2e9a1},
+{0x1f4f6,0x2e9c1},
+{0x1f4f7,0x2e9e1},
+{0x1f4f8,0x2ea01},
+{0x1f4f9,0x2ea21},
+{0x1f4fa,0x2ea41},
+{0x1f4fb,0x2ea61},
+{0x1f4fc,0x2ea81},
+{0x1f4fd,0x2eaa1},
+{0x1f4fe,0x2eac1},
+{0x1f4ff,0x2eae1},
+{0x1f500,0x2eb01},
+{0x1f501,0x2eb21},
+{0x1f502,0x2eb41},
+{0x1f503,0x2eb61},
+{0x1f504,0x2eb81},
+{0x1f505,0x2eba1},
+{0x1f506,0x2ebc1},
+{0x1f507,0x2ebe1},
+{0x1f508,0x2ec01},
+{0x1f509,0x2ec21},
+{0x1f50a,0x2ec41},
+{0x1f50b,0x2ec61},
+{0x1f50c,0x2ec81},
+{0x1f50d,0x2eca1},
+{0x1f50e,0x2ecc1},
+{0x1f50f,0x2ece1},
+{0x1f510,0x2ed01},
+{0x1f511,0x2ed21},
+{0x1f512,0x2ed41},
+{0x1f513,0x2ed61},
+{0x1f514,0x2ed81},
+{0x1f515,0x2eda1},
+{0x1f516,0x2edc1},
+{0x1f517,0x2ede1},
+{0x1f518,0x2ee01},
+{0x1f519,0x2ee21},
+{0x1f51a,0x2ee41},
+{0x1f51b,0x2ee61},
+{0x1f51c,0x2ee81},
+{0x1f51d,0x2eea1},
+{0x1f51e,0x2eec1},
+{0x1f51f,0x2eee1},
+{0x1f520,0x2ef01},
+{0x1f521,0x2ef21},
+{0x1f522,0x2ef41},
+{0x1f523,0x2ef61},
+{0x1f524,0x2ef81},
+{0x1f525,0x2efa1},
+{0x1f526,0x2efc1},
+{0x1f527,0x2efe1},
+{0x1f528,0x2f001},
+{0x1f529,0x2f021},
+{0x1f52a,0x2f041},
+{0x1f52b,0x2f061},
+{0x1f52c,0x2f081},
+{0x1f52d,0x2f0a1},
+{0x1f52e,0x2f0c1},
+{0x1f52f,0x2f0e1},
+{0x1f530,0x2f101},
+{0x1f531,0x2f121},
+{0x1f532,0x2f141},
+{0x1f533,0x2f161},
+{0x1f534,0x2f181},
+{0x1f535,0x2f1a1},
+{0x1f536,0x2f1c1},
+{0x1f537,0x2f1e1},
+{0x1f538,0x2f201},
+{0x1f539,0x2f221},
+{0x1f53a,0x2f241},
+{0x1f53b,0x2f261},
+{0x1f53c,0x2f281},
+{0x1f53d,0x2f2a1},
+{0x1f53e,0x2f2c1},
+{0x1f53f,0x2f2e1},
+{0x1f540,0x2f301},
+{0x1f541,0x2f321},
+{0x1f542,0x2f341},
+{0x1f543,0x2f361},
+{0x1f544,0x2f381},
+{0x1f545,0x2f3a1},
+{0x1f546,0x2f3c1},
+{0x1f547,0x2f3e1},
+{0x1f548,0x2f401},
+{0x1f549,0x2f421},
+{0x1f54a,0x2f441},
+{0x1f54b,0x2f461},
+{0x1f54c,0x2f481},
+{0x1f54d,0x2f4a1},
+{0x1f54e,0x2f4c1},
+{0x1f54f,0x2f4e1},
+{0x1f550,0x2f501},
+{0x1f551,0x2f521},
+{0x1f552,0x2f541},
+{0x1f553,0x2f561},
+{0x1f554,0x2f581},
+{0x1f555,0x2f5a1},
+{0x1f556,0x2f5c1},
+{0x1f557,0x2f5e1},
+{0x1f558,0x2f601},
+{0x1f559,0x2f621},
+{0x1f55a,0x2f641},
+{0x1f55b,0x2f661},
+{0x1f55c,0x2f681},
+{0x1f55d,0x2f6a1},
+{0x1f55e,0x2f6c1},
+{0x1f55f,0x2f6e1},
+{0x1f560,0x2f701},
+{0x1f561,0x2f721},
+{0x1f562,0x2f741},
+{0x1f563,0x2f761},
+{0x1f564,0x2f781},
+{0x1f565,0x2f7a1},
+{0x1f566,0x2f7c1},
+{0x1f567,0x2f7e1},
+{0x1f568,0x2f801},
+{0x1f569,0x2f821},
+{0x1f56a,0x2f841},
+{0x1f56b,0x2f861},
+{0x1f56c,0x2f881},
+{0x1f56d,0x2f8a1},
+{0x1f56e,0x2f8c1},
+{0x1f56f,0x2f8e1},
+{0x1f570,0x2f901},
+{0x1f571,0x2f921},
+{0x1f572,0x2f941},
+{0x1f573,0x2f961},
+{0x1f574,0x2f981},
+{0x1f575,0x2f9a1},
+{0x1f576,0x2f9c1},
+{0x1f577,0x2f9e1},
+{0x1f578,0x2fa01},
+{0x1f579,0x2fa21},
+{0x1f57b,0x2fa41},
+{0x1f57c,0x2fa61},
+{0x1f57d,0x2fa81},
+{0x1f57e,0x2faa1},
+{0x1f57f,0x2fac1},
+{0x1f580,0x2fae1},
+{0x1f581,0x2fb01},
+{0x1f582,0x2fb21},
+{0x1f583,0x2fb41},
+{0x1f584,0x2fb61},
+{0x1f585,0x2fb81},
+{0x1f586,0x2fba1},
+{0x1f587,0x2fbc1},
+{0x1f588,0x2fbe1},
+{0x1f589,0x2fc01},
+{0x1f58a,0x2fc21},
+{0x1f58b,0x2fc41},
+{0x1f58c,0x2fc61},
+{0x1f58d,0x2fc81},
+{0x1f58e,0x2fca1},
+{0x1f58f,0x2fcc1},
+{0x1f590,0x2fce1},
+{0x1f591,0x2fd01},
+{0x1f592,0x2fd21},
+{0x1f593,0x2fd41},
+{0x1f594,0x2fd61},
+{0x1f595,0x2fd81},
+{0x1f596,0x2fda1},
+{0x1f597,0x2fdc1},
+{0x1f598,0x2fde1},
+{0x1f599,0x2fe01},
+{0x1f59a,0x2fe21},
+{0x1f59b,0x2fe41},
+{0x1f59c,0x2fe61},
+{0x1f59d,0x2fe81},
+{0x1f59e,0x2fea1},
+{0x1f59f,0x2fec1},
+{0x1f5a0,0x2fee1},
+{0x1f5a1,0x2ff01},
+{0x1f5a2,0x2ff21},
+{0x1f5a3,0x2ff41},
+{0x1f5a5,0x2ff61},
+{0x1f5a6,0x2ff81},
+{0x1f5a7,0x2ffa1},
+{0x1f5a8,0x2ffc1},
+{0x1f5a9,0x2ffe1},
+{0x1f5aa,0x30001},
+{0x1f5ab,0x30021},
+{0x1f5ac,0x30041},
+{0x1f5ad,0x30061},
+{0x1f5ae,0x30081},
+{0x1f5af,0x300a1},
+{0x1f5b0,0x300c1},
+{0x1f5b1,0x300e1},
+{0x1f5b2,0x30101},
+{0x1f5b3,0x30121},
+{0x1f5b4,0x30141},
+{0x1f5b5,0x30161},
+{0x1f5b6,0x30181},
+{0x1f5b7,0x301a1},
+{0x1f5b8,0x301c1},
+{0x1f5b9,0x301e1},
+{0x1f5ba,0x30201},
+{0x1f5bb,0x30221},
+{0x1f5bc,0x30241},
+{0x1f5bd,0x30261},
+{0x1f5be,0x30281},
+{0x1f5bf,0x302a1},
+{0x1f5c0,0x302c1},
+{0x1f5c1,0x302e1},
+{0x1f5c2,0x30301},
+{0x1f5c3,0x30321},
+{0x1f5c4,0x30341},
+{0x1f5c5,0x30361},
+{0x1f5c6,0x30381},
+{0x1f5c7,0x303a1},
+{0x1f5c8,0x303c1},
+{0x1f5c9,0x303e1},
+{0x1f5ca,0x30401},
+{0x1f5cb,0x30421},
+{0x1f5cc,0x30441},
+{0x1f5cd,0x30461},
+{0x1f5ce,0x30481},
+{0x1f5cf,0x304a1},
+{0x1f5d0,0x304c1},
+{0x1f5d1,0x304e1},
+{0x1f5d2,0x30501},
+{0x1f5d3,0x30521},
+{0x1f5d4,0x30541},
+{0x1f5d5,0x30561},
+{0x1f5d6,0x30581},
+{0x1f5d7,0x305a1},
+{0x1f5d8,0x305c1},
+{0x1f5d9,0x305e1},
+{0x1f5da,0x30601},
+{0x1f5db,0x30621},
+{0x1f5dc,0x30641},
+{0x1f5dd,0x30661},
+{0x1f5de,0x30681},
+{0x1f5df,0x306a1},
+{0x1f5e0,0x306c1},
+{0x1f5e1,0x306e1},
+{0x1f5e2,0x30701},
+{0x1f5e3,0x30721},
+{0x1f5e4,0x30741},
+{0x1f5e5,0x30761},
+{0x1f5e6,0x30781},
+{0x1f5e7,0x307a1},
+{0x1f5e8,0x307c1},
+{0x1f5e9,0x307e1},
+{0x1f5ea,0x30801},
+{0x1f5eb,0x30821},
+{0x1f5ec,0x30841},
+{0x1f5ed,0x30861},
+{0x1f5ee,0x30881},
+{0x1f5ef,0x308a1},
+{0x1f5f0,0x308c1},
+{0x1f5f1,0x308e1},
+{0x1f5f2,0x30901},
+{0x1f5f3,0x30921},
+{0x1f5f4,0x30941},
+{0x1f5f5,0x30961},
+{0x1f5f6,0x30981},
+{0x1f5f7,0x309a1},
+{0x1f5f8,0x309c1},
+{0x1f5f9,0x309e1},
+{0x1f5fa,0x30a01},
+{0x1f5fb,0x30a21},
+{0x1f5fc,0x30a41},
+{0x1f5fd,0x30a61},
+{0x1f5fe,0x30a81},
+{0x1f5ff,0x30aa1},
+{0x1f600,0x30ac1},
+{0x1f601,0x30ae1},
+{0x1f602,0x30b01},
+{0x1f603,0x30b21},
+{0x1f604,0x30b41},
+{0x1f605,0x30b61},
+{0x1f606,0x30b81},
+{0x1f607,0x30ba1},
+{0x1f608,0x30bc1},
+{0x1f609,0x30be1},
+{0x1f60a,0x30c01},
+{0x1f60b,0x30c21},
+{0x1f60c,0x30c41},
+{0x1f60d,0x30c61},
+{0x1f60e,0x30c81},
+{0x1f60f,0x30ca1},
+{0x1f610,0x30cc1},
+{0x1f611,0x30ce1},
+{0x1f612,0x30d01},
+{0x1f613,0x30d21},
+{0x1f614,0x30d41},
+{0x1f615,0x30d61},
+{0x1f616,0x30d81},
+{0x1f617,0x30da1},
+{0x1f618,0x30dc1},
+{0x1f619,0x30de1},
+{0x1f61a,0x30e01},
+{0x1f61b,0x30e21},
+{0x1f61c,0x30e41},
+{0x1f61d,0x30e61},
+{0x1f61e,0x30e81},
+{0x1f61f,0x30ea1},
+{0x1f620,0x30ec1},
+{0x1f621,0x30ee1},
+{0x1f622,0x30f01},
+{0x1f623,0x30f21},
+{0x1f624,0x30f41},
+{0x1f625,0x30f61},
+{0x1f626,0x30f81},
+{0x1f627,0x30fa1},
+{0x1f628,0x30fc1},
+{0x1f629,0x30fe1},
+{0x1f62a,0x31001},
+{0x1f62b,0x31021},
+{0x1f62c,0x31041},
+{0x1f62d,0x31061},
+{0x1f62e,0x31081},
+{0x1f62f,0x310a1},
+{0x1f630,0x310c1},
+{0x1f631,0x310e1},
+{0x1f632,0x31101},
+{0x1f633,0x31121},
+{0x1f634,0x31141},
+{0x1f635,0x31161},
+{0x1f636,0x31181},
+{0x1f637,0x311a1},
+{0x1f638,0x311c1},
+{0x1f639,0x311e1},
+{0x1f63a,0x31201},
+{0x1f63b,0x31221},
+{0x1f63c,0x31241},
+{0x1f63d,0x31261},
+{0x1f63e,0x31281},
+{0x1f63f,0x312a1},
+{0x1f640,0x312c1},
+{0x1f641,0x312e1},
+{0x1f642,0x31301},
+{0x1f643,0x31321},
+{0x1f644,0x31341},
+{0x1f645,0x31361},
+{0x1f646,0x31381},
+{0x1f647,0x313a1},
+{0x1f648,0x313c1},
+{0x1f649,0x313e1},
+{0x1f64a,0x31401},
+{0x1f64b,0x31421},
+{0x1f64c,0x31441},
+{0x1f64d,0x31461},
+{0x1f64e,0x31481},
+{0x1f64f,0x314a1},
+{0x1f650,0x314c1},
+{0x1f651,0x314e1},
+{0x1f652,0x31501},
+{0x1f653,0x31521},
+{0x1f654,0x31541},
+{0x1f655,0x31561},
+{0x1f656,0x31581},
+{0x1f657,0x315a1},
+{0x1f658,0x315c1},
+{0x1f659,0x315e1},
+{0x1f65a,0x31601},
+{0x1f65b,0x31621},
+{0x1f65c,0x31641},
+{0x1f65d,0x31661},
+{0x1f65e,0x31681},
+{0x1f65f,0x316a1},
+{0x1f660,0x316c1},
+{0x1f661,0x316e1},
+{0x1f662,0x31701},
+{0x1f663,0x31721},
+{0x1f664,0x31741},
+{0x1f665,0x31761},
+{0x1f666,0x31781},
+{0x1f667,0x317a1},
+{0x1f668,0x317c1},
+{0x1f669,0x317e1},
+{0x1f66a,0x31801},
+{0x1f66b,0x31821},
+{0x1f66c,0x31841},
+{0x1f66d,0x31861},
+{0x1f66e,0x31881},
+{0x1f66f,0x318a1},
+{0x1f670,0x318c1},
+{0x1f671,0x318e1},
+{0x1f672,0x31901},
+{0x1f673,0x31921},
+{0x1f674,0x31941},
+{0x1f675,0x31961},
+{0x1f676,0x31981},
+{0x1f677,0x319a1},
+{0x1f678,0x319c1},
+{0x1f679,0x319e1},
+{0x1f67a,0x31a01},
+{0x1f67b,0x31a21},
+{0x1f67c,0x31a41},
+{0x1f67d,0x31a61},
+{0x1f67e,0x31a81},
+{0x1f67f,0x31aa1},
+{0x1f680,0x31ac1},
+{0x1f681,0x31ae1},
+{0x1f682,0x31b01},
+{0x1f683,0x31b21},
+{0x1f684,0x31b41},
+{0x1f685,0x31b61},
+{0x1f686,0x31b81},
+{0x1f687,0x31ba1},
+{0x1f688,0x31bc1},
+{0x1f689,0x31be1},
+{0x1f68a,0x31c01},
+{0x1f68b,0x31c21},
+{0x1f68c,0x31c41},
+{0x1f68d,0x31c61},
+{0x1f68e,0x31c81},
+{0x1f68f,0x31ca1},
+{0x1f690,0x31cc1},
+{0x1f691,0x31ce1},
+{0x1f692,0x31d01},
+{0x1f693,0x31d21},
+{0x1f694,0x31d41},
+{0x1f695,0x31d61},
+{0x1f696,0x31d81},
+{0x1f697,0x31da1},
+{0x1f698,0x31dc1},
+{0x1f699,0x31de1},
+{0x1f69a,0x31e01},
+{0x1f69b,0x31e21},
+{0x1f69c,0x31e41},
+{0x1f69d,0x31e61},
+{0x1f69e,0x31e81},
+{0x1f69f,0x31ea1},
+{0x1f6a0,0x31ec1},
+{0x1f6a1,0x31ee1},
+{0x1f6a2,0x31f01},
+{0x1f6a3,0x31f21},
+{0x1f6a4,0x31f41},
+{0x1f6a5,0x31f61},
+{0x1f6a6,0x31f81},
+{0x1f6a7,0x31fa1},
+{0x1f6a8,0x31fc1},
+{0x1f6a9,0x31fe1},
+{0x1f6aa,0x32001},
+{0x1f6ab,0x32021},
+{0x1f6ac,0x32041},
+{0x1f6ad,0x32061},
+{0x1f6ae,0x32081},
+{0x1f6af,0x320a1},
+{0x1f6b0,0x320c1},
+{0x1f6b1,0x320e1},
+{0x1f6b2,0x32101},
+{0x1f6b3,0x32121},
+{0x1f6b4,0x32141},
+{0x1f6b5,0x32161},
+{0x1f6b6,0x32181},
+{0x1f6b7,0x321a1},
+{0x1f6b8,0x321c1},
+{0x1f6b9,0x321e1},
+{0x1f6ba,0x32201},
+{0x1f6bb,0x32221},
+{0x1f6bc,0x32241},
+{0x1f6bd,0x32261},
+{0x1f6be,0x32281},
+{0x1f6bf,0x322a1},
+{0x1f6c0,0x322c1},
+{0x1f6c1,0x322e1},
+{0x1f6c2,0x32301},
+{0x1f6c3,0x32321},
+{0x1f6c4,0x32341},
+{0x1f6c5,0x32361},
+{0x1f6c6,0x32381},
+{0x1f6c7,0x323a1},
+{0x1f6c8,0x323c1},
+{0x1f6c9,0x323e1},
+{0x1f6ca,0x32401},
+{0x1f6cb,0x32421},
+{0x1f6cc,0x32441},
+{0x1f6cd,0x32461},
+{0x1f6ce,0x32481},
+{0x1f6cf,0x324a1},
+{0x1f6d0,0x324c1},
+{0x1f6e0,0x324e1},
+{0x1f6e1,0x32501},
+{0x1f6e2,0x32521},
+{0x1f6e3,0x32541},
+{0x1f6e4,0x32561},
+{0x1f6e5,0x32581},
+{0x1f6e6,0x325a1},
+{0x1f6e7,0x325c1},
+{0x1f6e8,0x325e1},
+{0x1f6e9,0x32601},
+{0x1f6ea,0x32621},
+{0x1f6eb,0x32641},
+{0x1f6ec,0x32661},
+{0x1f6f0,0x32681},
+{0x1f6f1,0x326a1},
+{0x1f6f2,0x326c1},
+{0x1f6f3,0x326e1},
+{0x1f700,0x32701},
+{0x1f701,0x32721},
+{0x1f702,0x32741},
+{0x1f703,0x32761},
+{0x1f704,0x32781},
+{0x1f705,0x327a1},
+{0x1f706,0x327c1},
+{0x1f707,0x327e1},
+{0x1f708,0x32801},
+{0x1f709,0x32821},
+{0x1f70a,0x32841},
+{0x1f70b,0x32861},
+{0x1f70c,0x32881},
+{0x1f70d,0x328a1},
+{0x1f70e,0x328c1},
+{0x1f70f,0x328e1},
+{0x1f710,0x32901},
+{0x1f711,0x32921},
+{0x1f712,0x32941},
+{0x1f713,0x32961},
+{0x1f714,0x32981},
+{0x1f715,0x329a1},
+{0x1f716,0x329c1},
+{0x1f717,0x329e1},
+{0x1f718,0x32a01},
+{0x1f719,0x32a21},
+{0x1f71a,0x32a41},
+{0x1f71b,0x32a61},
+{0x1f71c,0x32a81},
+{0x1f71d,0x32aa1},
+{0x1f71e,0x32ac1},
+{0x1f71f,0x32ae1},
+{0x1f720,0x32b01},
+{0x1f721,0x32b21},
+{0x1f722,0x32b41},
+{0x1f723,0x32b61},
+{0x1f724,0x32b81},
+{0x1f725,0x32ba1},
+{0x1f726,0x32bc1},
+{0x1f727,0x32be1},
+{0x1f728,0x32c01},
+{0x1f729,0x32c21},
+{0x1f72a,0x32c41},
+{0x1f72b,0x32c61},
+{0x1f72c,0x32c81},
+{0x1f72d,0x32ca1},
+{0x1f72e,0x32cc1},
+{0x1f72f,0x32ce1},
+{0x1f730,0x32d01},
+{0x1f731,0x32d21},
+{0x1f732,0x32d41},
+{0x1f733,0x32d61},
+{0x1f734,0x32d81},
+{0x1f735,0x32da1},
+{0x1f736,0x32dc1},
+{0x1f737,0x32de1},
+{0x1f738,0x32e01},
+{0x1f739,0x32e21},
+{0x1f73a,0x32e41},
+{0x1f73b,0x32e61},
+{0x1f73c,0x32e81},
+{0x1f73d,0x32ea1},
+{0x1f73e,0x32ec1},
+{0x1f73f,0x32ee1},
+{0x1f740,0x32f01},
+{0x1f741,0x32f21},
+{0x1f742,0x32f41},
+{0x1f743,0x32f61},
+{0x1f744,0x32f81},
+{0x1f745,0x32fa1},
+{0x1f746,0x32fc1},
+{0x1f747,0x32fe1},
+{0x1f748,0x33001},
+{0x1f749,0x33021},
+{0x1f74a,0x33041},
+{0x1f74b,0x33061},
+{0x1f74c,0x33081},
+{0x1f74d,0x330a1},
+{0x1f74e,0x330c1},
+{0x1f74f,0x330e1},
+{0x1f750,0x33101},
+{0x1f751,0x33121},
+{0x1f752,0x33141},
+{0x1f753,0x33161},
+{0x1f754,0x33181},
+{0x1f755,0x331a1},
+{0x1f756,0x331c1},
+{0x1f757,0x331e1},
+{0x1f758,0x33201},
+{0x1f759,0x33221},
+{0x1f75a,0x33241},
+{0x1f75b,0x33261},
+{0x1f75c,0x33281},
+{0x1f75d,0x332a1},
+{0x1f75e,0x332c1},
+{0x1f75f,0x332e1},
+{0x1f760,0x33301},
+{0x1f761,0x33321},
+{0x1f762,0x33341},
+{0x1f763,0x33361},
+{0x1f764,0x33381},
+{0x1f765,0x333a1},
+{0x1f766,0x333c1},
+{0x1f767,0x333e1},
+{0x1f768,0x33401},
+{0x1f769,0x33421},
+{0x1f76a,0x33441},
+{0x1f76b,0x33461},
+{0x1f76c,0x33481},
+{0x1f76d,0x334a1},
+{0x1f76e,0x334c1},
+{0x1f76f,0x334e1},
+{0x1f770,0x33501},
+{0x1f771,0x33521},
+{0x1f772,0x33541},
+{0x1f773,0x33561},
+{0x1f780,0x33581},
+{0x1f781,0x335a1},
+{0x1f782,0x335c1},
+{0x1f783,0x335e1},
+{0x1f784,0x33601},
+{0x1f785,0x33621},
+{0x1f786,0x33641},
+{0x1f787,0x33661},
+{0x1f788,0x33681},
+{0x1f789,0x336a1},
+{0x1f78a,0x336c1},
+{0x1f78b,0x336e1},
+{0x1f78c,0x33701},
+{0x1f78d,0x33721},
+{0x1f78e,0x33741},
+{0x1f78f,0x33761},
+{0x1f790,0x33781},
+{0x1f791,0x337a1},
+{0x1f792,0x337c1},
+{0x1f793,0x337e1},
+{0x1f794,0x33801},
+{0x1f795,0x33821},
+{0x1f796,0x33841},
+{0x1f797,0x33861},
+{0x1f798,0x33881},
+{0x1f799,0x338a1},
+{0x1f79a,0x338c1},
+{0x1f79b,0x338e1},
+{0x1f79c,0x33901},
+{0x1f79d,0x33921},
+{0x1f79e,0x33941},
+{0x1f79f,0x33961},
+{0x1f7a0,0x33981},
+{0x1f7a1,0x339a1},
+{0x1f7a2,0x339c1},
+{0x1f7a3,0x339e1},
+{0x1f7a4,0x33a01},
+{0x1f7a5,0x33a21},
+{0x1f7a6,0x33a41},
+{0x1f7a7,0x33a61},
+{0x1f7a8,0x33a81},
+{0x1f7a9,0x33aa1},
+{0x1f7aa,0x33ac1},
+{0x1f7ab,0x33ae1},
+{0x1f7ac,0x33b01},
+{0x1f7ad,0x33b21},
+{0x1f7ae,0x33b41},
+{0x1f7af,0x33b61},
+{0x1f7b0,0x33b81},
+{0x1f7b1,0x33ba1},
+{0x1f7b2,0x33bc1},
+{0x1f7b3,0x33be1},
+{0x1f7b4,0x33c01},
+{0x1f7b5,0x33c21},
+{0x1f7b6,0x33c41},
+{0x1f7b7,0x33c61},
+{0x1f7b8,0x33c81},
+{0x1f7b9,0x33ca1},
+{0x1f7ba,0x33cc1},
+{0x1f7bb,0x33ce1},
+{0x1f7bc,0x33d01},
+{0x1f7bd,0x33d21},
+{0x1f7be,0x33d41},
+{0x1f7bf,0x33d61},
+{0x1f7c0,0x33d81},
+{0x1f7c1,0x33da1},
+{0x1f7c2,0x33dc1},
+{0x1f7c3,0x33de1},
+{0x1f7c4,0x33e01},
+{0x1f7c5,0x33e21},
+{0x1f7c6,0x33e41},
+{0x1f7c7,0x33e61},
+{0x1f7c8,0x33e81},
+{0x1f7c9,0x33ea1},
+{0x1f7ca,0x33ec1},
+{0x1f7cb,0x33ee1},
+{0x1f7cc,0x33f01},
+{0x1f7cd,0x33f21},
+{0x1f7ce,0x33f41},
+{0x1f7cf,0x33f61},
+{0x1f7d0,0x33f81},
+{0x1f7d1,0x33fa1},
+{0x1f7d2,0x33fc1},
+{0x1f7d3,0x33fe1},
+{0x1f7d4,0x34001},
+{0x1f800,0x34021},
+{0x1f801,0x34041},
+{0x1f802,0x34061},
+{0x1f803,0x34081},
+{0x1f804,0x340a1},
+{0x1f805,0x340c1},
+{0x1f806,0x340e1},
+{0x1f807,0x34101},
+{0x1f808,0x34121},
+{0x1f809,0x34141},
+{0x1f80a,0x34161},
+{0x1f80b,0x34181},
+{0x1f810,0x341a1},
+{0x1f811,0x341c1},
+{0x1f812,0x341e1},
+{0x1f813,0x34201},
+{0x1f814,0x34221},
+{0x1f815,0x34241},
+{0x1f816,0x34261},
+{0x1f817,0x34281},
+{0x1f818,0x342a1},
+{0x1f819,0x342c1},
+{0x1f81a,0x342e1},
+{0x1f81b,0x34301},
+{0x1f81c,0x34321},
+{0x1f81d,0x34341},
+{0x1f81e,0x34361},
+{0x1f81f,0x34381},
+{0x1f820,0x343a1},
+{0x1f821,0x343c1},
+{0x1f822,0x343e1},
+{0x1f823,0x34401},
+{0x1f824,0x34421},
+{0x1f825,0x34441},
+{0x1f826,0x34461},
+{0x1f827,0x34481},
+{0x1f828,0x344a1},
+{0x1f829,0x344c1},
+{0x1f82a,0x344e1},
+{0x1f82b,0x34501},
+{0x1f82c,0x34521},
+{0x1f82d,0x34541},
+{0x1f82e,0x34561},
+{0x1f82f,0x34581},
+{0x1f830,0x345a1},
+{0x1f831,0x345c1},
+{0x1f832,0x345e1},
+{0x1f833,0x34601},
+{0x1f834,0x34621},
+{0x1f835,0x34641},
+{0x1f836,0x34661},
+{0x1f837,0x34681},
+{0x1f838,0x346a1},
+{0x1f839,0x346c1},
+{0x1f83a,0x346e1},
+{0x1f83b,0x34701},
+{0x1f83c,0x34721},
+{0x1f83d,0x34741},
+{0x1f83e,0x34761},
+{0x1f83f,0x34781},
+{0x1f840,0x347a1},
+{0x1f841,0x347c1},
+{0x1f842,0x347e1},
+{0x1f843,0x34801},
+{0x1f844,0x34821},
+{0x1f845,0x34841},
+{0x1f846,0x34861},
+{0x1f847,0x34881},
+{0x1f850,0x348a1},
+{0x1f851,0x348c1},
+{0x1f852,0x348e1},
+{0x1f853,0x34901},
+{0x1f854,0x34921},
+{0x1f855,0x34941},
+{0x1f856,0x34961},
+{0x1f857,0x34981},
+{0x1f858,0x349a1},
+{0x1f859,0x349c1},
+{0x1f860,0x349e1},
+{0x1f861,0x34a01},
+{0x1f862,0x34a21},
+{0x1f863,0x34a41},
+{0x1f864,0x34a61},
+{0x1f865,0x34a81},
+{0x1f866,0x34aa1},
+{0x1f867,0x34ac1},
+{0x1f868,0x34ae1},
+{0x1f869,0x34b01},
+{0x1f86a,0x34b21},
+{0x1f86b,0x34b41},
+{0x1f86c,0x34b61},
+{0x1f86d,0x34b81},
+{0x1f86e,0x34ba1},
+{0x1f86f,0x34bc1},
+{0x1f870,0x34be1},
+{0x1f871,0x34c01},
+{0x1f872,0x34c21},
+{0x1f873,0x34c41},
+{0x1f874,0x34c61},
+{0x1f875,0x34c81},
+{0x1f876,0x34ca1},
+{0x1f877,0x34cc1},
+{0x1f878,0x34ce1},
+{0x1f879,0x34d01},
+{0x1f87a,0x34d21},
+{0x1f87b,0x34d41},
+{0x1f87c,0x34d61},
+{0x1f87d,0x34d81},
+{0x1f87e,0x34da1},
+{0x1f87f,0x34dc1},
+{0x1f880,0x34de1},
+{0x1f881,0x34e01},
+{0x1f882,0x34e21},
+{0x1f883,0x34e41},
+{0x1f884,0x34e61},
+{0x1f885,0x34e81},
+{0x1f886,0x34ea1},
+{0x1f887,0x34ec1},
+{0x1f890,0x34ee1},
+{0x1f891,0x34f01},
+{0x1f892,0x34f21},
+{0x1f893,0x34f41},
+{0x1f894,0x34f61},
+{0x1f895,0x34f81},
+{0x1f896,0x34fa1},
+{0x1f897,0x34fc1},
+{0x1f898,0x34fe1},
+{0x1f899,0x35001},
+{0x1f89a,0x35021},
+{0x1f89b,0x35041},
+{0x1f89c,0x35061},
+{0x1f89d,0x35081},
+{0x1f89e,0x350a1},
+{0x1f89f,0x350c1},
+{0x1f8a0,0x350e1},
+{0x1f8a1,0x35101},
+{0x1f8a2,0x35121},
+{0x1f8a3,0x35141},
+{0x1f8a4,0x35161},
+{0x1f8a5,0x35181},
+{0x1f8a6,0x351a1},
+{0x1f8a7,0x351c1},
+{0x1f8a8,0x351e1},
+{0x1f8a9,0x35201},
+{0x1f8aa,0x35221},
+{0x1f8ab,0x35241},
+{0x1f8ac,0x35261},
+{0x1f8ad,0x35281},
+{0x1f910,0x352a1},
+{0x1f911,0x352c1},
+{0x1f912,0x352e1},
+{0x1f913,0x35301},
+{0x1f914,0x35321},
+{0x1f915,0x35341},
+{0x1f916,0x35361},
+{0x1f917,0x35381},
+{0x1f918,0x353a1},
+{0x1f980,0x353c1},
+{0x1f981,0x353e1},
+{0x1f982,0x35401},
+{0x1f983,0x35421},
+{0x1f984,0x35441},
+{0x1f9c0,0x35461},
+{0x2f800,0xe7882},
+{0x2f801,0xe7802},
+{0x2f802,0xe7902},
+{0x2f803,0xfc602},
+{0x2f804,0xe8322},
+{0x2f805,0xe8422},
+{0x2f806,0xe8462},
+{0x2f807,0xe84e2},
+{0x2f808,0xe8562},
+{0x2f809,0xe85a2},
+{0x2f80a,0xe8662},
+{0x2f80b,0xe85e2},
+{0x2f80c,0xfb542},
+{0x2f80d,0xfc702},
+{0x2f80e,0xe87a2},
+{0x2f80f,0xe87e2},
+{0x2f810,0xe8822},
+{0x2f811,0xe8b62},
+{0x2f812,0xfc642},
+{0x2f813,0xfb582},
+{0x2f814,0xe88a2},
+{0x2f815,0xe8c82},
+{0x2f816,0xfc6c2},
+{0x2f817,0xe8dc2},
+{0x2f818,0xe8e42},
+{0x2f819,0xe80a2},
+{0x2f81a,0xe8ec2},
+{0x2f81b,0xe8f02},
+{0x2f81c,0xfde82},
+{0x2f81d,0xe9122},
+{0x2f81e,0xe9282},
+{0x2f81f,0xfb602},
+{0x2f820,0xe9402},
+{0x2f821,0xe9442},
+{0x2f822,0xe94c2},
+{0x2f823,0xe9542},
+{0x2f824,0xfb642},
+{0x2f825,0xe9782},
+{0x2f826,0xe97c2},
+{0x2f827,0xe9902},
+{0x2f828,0xe99c2},
+{0x2f829,0xe9a02},
+{0x2f82a,0xe9a42},
+{0x2f82b,0xe9ac2},
+{0x2f82c,0xe9d82},
+{0x2f82d,0xe9dc2},
+{0x2f82e,0xe9ec2},
+{0x2f82f,0xea082},
+{0x2f830,0xea102},
+{0x2f831,0xea142},
+{0x2f832,0xea142},
+{0x2f833,0xea142},
+{0x2f834,0xfc7c2},
+{0x2f835,0xf15c2},
+{0x2f836,0xea2e2},
+{0x2f837,0xea362},
+{0x2f838,0xfc802},
+{0x2f839,0xea422},
+{0x2f83a,0xea4a2},
+{0x2f83b,0xea562},
+{0x2f83c,0xea8e2},
+{0x2f83d,0xea722},
+{0x2f83e,0xea7e2},
+{0x2f83f,0xea822},
+{0x2f840,0xea922},
+{0x2f841,0xea9a2},
+{0x2f842,0xea9e2},
+{0x2f843,0xeaa62},
+{0x2f844,0xeaae2},
+{0x2f845,0xeab22},
+{0x2f846,0xeab22},
+{0x2f847,0xeaba2},
+{0x2f848,0xeac22},
+{0x2f849,0xeac62},
+{0x2f84a,0xead22},
+{0x2f84b,0xeb022},
+{0x2f84c,0xeada2},
+{0x2f84d,0xeb062},
+{0x2f84e,0xeade2},
+{0x2f84f,0xeae62},
+{0x2f850,0xe92c2},
+{0x2f851,0xeb5a2},
+{0x2f852,0xeb222},
+{0x2f853,0xeb262},
+{0x2f854,0xeb2a2},
+{0x2f855,0xeb1e2},
+{0x2f856,0xeb322},
+{0x2f857,0xeb2e2},
+{0x2f858,0xeb462},
+{0x2f859,0xfc842},
+{0x2f85a,0xeb622},
+{0x2f85b,0xeb662},
+{0x2f85c,0xeb6e2},
+{0x2f85d,0xeb7a2},
+{0x2f85e,0xeb862},
+{0x2f85f,0xebae2},
+{0x2f860,0xfc882},
+{0x2f861,0xfc8c2},
+{0x2f862,0xebc22},
+{0x2f863,0xebc62},
+{0x2f864,0xebca2},
+{0x2f865,0xebbe2},
+{0x2f866,0xebd22},
+{0x2f867,0xfb682},
+{0x2f868,0xfb6c2},
+{0x2f869,0xebda2},
+{0x2f86a,0xebe22},
+{0x2f86b,0xebe22},
+{0x2f86c,0xfc902},
+{0x2f86d,0xec0e2},
+{0x2f86e,0xec122},
+{0x2f86f,0xec162},
+{0x2f870,0xec1e2},
+{0x2f871,0xfc942},
+{0x2f872,0xec262},
+{0x2f873,0xec2a2},
+{0x2f874,0xed442},
+{0x2f875,0xec3e2},
+{0x2f876,0xfb702},
+{0x2f877,0xec5e2},
+{0x2f878,0xec6e2},
+{0x2f879,0xec7e2},
+{0x2f87a,0xec7a2},
+{0x2f87b,0xfc9c2},
+{0x2f87c,0xec862},
+{0x2f87d,0xfca02},
+{0x2f87e,0xec922},
+{0x2f87f,0xec8e2},
+{0x2f880,0xec962},
+{0x2f881,0xeca62},
+{0x2f882,0xecaa2},
+{0x2f883,0xfb742},
+{0x2f884,0xecc22},
+{0x2f885,0xecca2},
+{0x2f886,0xecce2},
+{0x2f887,0xecd22},
+{0x2f888,0xfb782},
+{0x2f889,0xfca42},
+{0x2f88a,0xfb7c2},
+{0x2f88b,0xecf62},
+{0x2f88c,0xecfa2},
+{0x2f88d,0xecfe2},
+{0x2f88e,0xed062},
+{0x2f88f,0xfe102},
+{0x2f890,0xed1e2},
+{0x2f891,0xfcac2},
+{0x2f892,0xfcac2},
+{0x2f893,0xf5822},
+{0x2f894,0xed322},
+{0x2f895,0xed322},
+{0x2f896,0xfb802},
+{0x2f897,0xfcc82},
+{0x2f898,0xfd702},
+{0x2f899,0xed4c2},
+{0x2f89a,0xed542},
+{0x2f89b,0xfb842},
+{0x2f89c,0xed682},
+{0x2f89d,0xed822},
+{0x2f89e,0xed862},
+{0x2f89f,0xed8e2},
+{0x2f8a0,0xed9e2},
+{0x2f8a1,0xfb8c2},
+{0x2f8a2,0xfb882},
+{0x2f8a3,0xeda22},
+{0x2f8a4,0xfcb02},
+{0x2f8a5,0xeda62},
+{0x2f8a6,0xedba2},
+{0x2f8a7,0xedbe2},
+{0x2f8a8,0xedc22},
+{0x2f8a9,0xedbe2},
+{0x2f8aa,0xedce2},
+{0x2f8ab,0xedd22},
+{0x2f8ac,0xede22},
+{0x2f8ad,0xedda2},
+{0x2f8ae,0xedde2},
+{0x2f8af,0xede62},
+{0x2f8b0,0xedea2},
+{0x2f8b1,0xedee2},
+{0x2f8b2,0xedfa2},
+{0x2f8b3,0xedfe2},
+{0x2f8b4,0xee262},
+{0x2f8b5,0xee2e2},
+{0x2f8b6,0xee3e2},
+{0x2f8b7,0xee522},
+{0x2f8b8,0xfcbc2},
+{0x2f8b9,0xee4e2},
+{0x2f8ba,0xee422},
+{0x2f8bb,0xee5a2},
+{0x2f8bc,0xee622},
+{0x2f8bd,0xee762},
+{0x2f8be,0xfcc02},
+{0x2f8bf,0xee7e2},
+{0x2f8c0,0xee722},
+{0x2f8c1,0xee6a2},
+{0x2f8c2,0xfb902},
+{0x2f8c3,0xee862},
+{0x2f8c4,0xee8e2},
+{0x2f8c5,0xee962},
+{0x2f8c6,0xee8a2},
+{0x2f8c7,0xfb942},
+{0x2f8c8,0xeeaa2},
+{0x2f8c9,0xeeba2},
+{0x2f8ca,0xfcc42},
+{0x2f8cb,0xeef22},
+{0x2f8cc,0xef482},
+{0x2f8cd,0xef242},
+{0x2f8ce,0xfba02},
+{0x2f8cf,0xef302},
+{0x2f8d0,0xfb9c2},
+{0x2f8d1,0xfb982},
+{0x2f8d2,0xe8d02},
+{0x2f8d3,0xe8d42},
+{0x2f8d4,0xef4c2},
+{0x2f8d5,0xef342},
+{0x2f8d6,0xf5402},
+{0x2f8d7,0xfc042},
+{0x2f8d8,0xef7a2},
+{0x2f8d9,0xef7e2},
+{0x2f8da,0xef822},
+{0x2f8db,0xefaa2},
+{0x2f8dc,0xefa22},
+{0x2f8dd,0xfcd82},
+{0x2f8de,0xfba42},
+{0x2f8df,0xefbe2},
+{0x2f8e0,0xefb22},
+{0x2f8e1,0xefe62},
+{0x2f8e2,0xefee2},
+{0x2f8e3,0xfce02},
+{0x2f8e4,0xeff22},
+{0x2f8e5,0xefc62},
+{0x2f8e6,0xeffa2},
+{0x2f8e7,0xfba82},
+{0x2f8e8,0xeffe2},
+{0x2f8e9,0xf0022},
+{0x2f8ea,0xf0062},
+{0x2f8eb,0xf0122},
+{0x2f8ec,0xfce42},
+{0x2f8ed,0xf01a2},
+{0x2f8ee,0xfbac2},
+{0x2f8ef,0xf0262},
+{0x2f8f0,0xfce82},
+{0x2f8f1,0xf02a2},
+{0x2f8f2,0xfbb02},
+{0x2f8f3,0xf0362},
+{0x2f8f4,0xf04c2},
+{0x2f8f5,0xf0582},
+{0x2f8f6,0xf05c2},
+{0x2f8f7,0xfcec2},
+{0x2f8f8,0xfc982},
+{0x2f8f9,0xfcf02},
+{0x2f8fa,0xf0942},
+{0x2f8fb,0xfcf42},
+{0x2f8fc,0xf0a02},
+{0x2f8fd,0xf0a82},
+{0x2f8fe,0xf0982},
+{0x2f8ff,0xf0b42},
+{0x2f900,0xf0c42},
+{0x2f901,0xf0d42},
+{0x2f902,0xf0c82},
+{0x2f903,0xf0cc2},
+{0x2f904,0xf0d82},
+{0x2f905,0xf0dc2},
+{0x2f906,0xfcf82},
+{0x2f907,0xf0c02},
+{0x2f908,0xf0f42},
+{0x2f909,0xf0f82},
+{0x2f90a,0xfbb42},
+{0x2f90b,0xf10c2},
+{0x2f90c,0xf1082},
+{0x2f90d,0xfcfc2},
+{0x2f90e,0xf0ec2},
+{0x2f90f,0xf1282},
+{0x2f910,0xfd002},
+{0x2f911,0xfd042},
+{0x2f912,0xf12c2},
+{0x2f913,0xf1402},
+{0x2f914,0xf13c2},
+{0x2f915,0xf1382},
+{0x2f916,0xfbb82},
+{0x2f917,0xf1442},
+{0x2f918,0xf1642},
+{0x2f919,0xf1602},
+{0x2f91a,0xf16c2},
+{0x2f91b,0xfc682},
+{0x2f91c,0xf1842},
+{0x2f91d,0xfd082},
+{0x2f91e,0xf1902},
+{0x2f91f,0xfd102},
+{0x2f920,0xf1a42},
+{0x2f921,0xf1ba2},
+{0x2f922,0xf1ce2},
+{0x2f923,0xfd142},
+{0x2f924,0xf1f02},
+{0x2f925,0xf1f42},
+{0x2f926,0xfd182},
+{0x2f927,0xfd1c2},
+{0x2f928,0xf2142},
+{0x2f929,0xf2242},
+{0x2f92a,0xfbbc2},
+{0x2f92b,0xf22e2},
+{0x2f92c,0xfbc02},
+{0x2f92d,0xfbc02},
+{0x2f92e,0xf2462},
+{0x2f92f,0xf24a2},
+{0x2f930,0xf2522},
+{0x2f931,0xf2562},
+{0x2f932,0xf2622},
+{0x2f933,0xfbc42},
+{0x2f934,0xf27e2},
+{0x2f935,0xfd202},
+{0x2f936,0xf29a2},
+{0x2f937,0xfd242},
+{0x2f938,0xf2a62},
+{0x2f939,0xfca82},
+{0x2f93a,0xf2bc2},
+{0x2f93b,0xfd282},
+{0x2f93c,0xfd2c2},
+{0x2f93d,0xfd302},
+{0x2f93e,0xfbc82},
+{0x2f93f,0xfbcc2},
+{0x2f940,0xf30a2},
+{0x2f941,0xfd382},
+{0x2f942,0xfd342},
+{0x2f943,0xfd3c2},
+{0x2f944,0xfd402},
+{0x2f945,0xf3122},
+{0x2f946,0xf3162},
+{0x2f947,0xf3162},
+{0x2f948,0xf31e2},
+{0x2f949,0xfbd42},
+{0x2f94a,0xf3222},
+{0x2f94b,0xfbd82},
+{0x2f94c,0xfbdc2},
+{0x2f94d,0xfd482},
+{0x2f94e,0xf3362},
+{0x2f94f,0xf33e2},
+{0x2f950,0xf34a2},
+{0x2f951,0xfbe02},
+{0x2f952,0xfd4c2},
+{0x2f953,0xf3842},
+{0x2f954,0xfd502},
+{0x2f955,0xfd542},
+{0x2f956,0xf3b82},
+{0x2f957,0xf3d02},
+{0x2f958,0xfbe42},
+{0x2f959,0xf3d82},
+{0x2f95a,0xf3dc2},
+{0x2f95b,0xf3e02},
+{0x2f95c,0xfd582},
+{0x2f95d,0xfd5c2},
+{0x2f95e,0xfd5c2},
+{0x2f95f,0xf3fc2},
+{0x2f960,0xfbe82},
+{0x2f961,0xfd602},
+{0x2f962,0xf4162},
+{0x2f963,0xf41a2},
+{0x2f964,0xfbec2},
+{0x2f965,0xfd642},
+{0x2f966,0xf4362},
+{0x2f967,0xfbf02},
+{0x2f968,0xf4462},
+{0x2f969,0xf43e2},
+{0x2f96a,0xf4522},
+{0x2f96b,0xfd6c2},
+{0x2f96c,0xf46a2},
+{0x2f96d,0xfbf42},
+{0x2f96e,0xf4762},
+{0x2f96f,0xf47e2},
+{0x2f970,0xf48e2},
+{0x2f971,0xfbf82},
+{0x2f972,0xfd742},
+{0x2f973,0xfd782},
+{0x2f974,0xfbfc2},
+{0x2f975,0xfd7c2},
+{0x2f976,0xf4c42},
+{0x2f977,0xfd802},
+{0x2f978,0xf4e02},
+{0x2f979,0xf4f02},
+{0x2f97a,0xf5002},
+{0x2f97b,0xfd842},
+{0x2f97c,0xfd882},
+{0x2f97d,0xf5142},
+{0x2f97e,0xfd8c2},
+{0x2f97f,0xf51c2},
+{0x2f980,0xfccc2},
+{0x2f981,0xfc002},
+{0x2f982,0xf5442},
+{0x2f983,0xf5482},
+{0x2f984,0xfc082},
+{0x2f985,0xf54c2},
+{0x2f986,0xebd62},
+{0x2f987,0xfd902},
+{0x2f988,0xfd942},
+{0x2f989,0xfcd02},
+{0x2f98a,0xfcd42},
+{0x2f98b,0xf5822},
+{0x2f98c,0xf5862},
+{0x2f98d,0xf8022},
+{0x2f98e,0xfc0c2},
+{0x2f98f,0xf5c22},
+{0x2f990,0xf5be2},
+{0x2f991,0xf5c62},
+{0x2f992,0xe9682},
+{0x2f993,0xf5ca2},
+{0x2f994,0xf5ce2},
+{0x2f995,0xf5d22},
+{0x2f996,0xf5da2},
+{0x2f997,0xfd982},
+{0x2f998,0xf5d62},
+{0x2f999,0xf5de2},
+{0x2f99a,0xf5f22},
+{0x2f99b,0xf5f62},
+{0x2f99c,0xf5e22},
+{0x2f99d,0xf5fa2},
+{0x2f99e,0xf60e2},
+{0x2f99f,0xf6222},
+{0x2f9a0,0xf5ee2},
+{0x2f9a1,0xf6022},
+{0x2f9a2,0xf6062},
+{0x2f9a3,0xf60a2},
+{0x2f9a4,0xfd9c2},
+{0x2f9a5,0xfda42},
+{0x2f9a6,0xfda02},
+{0x2f9a7,0xfc102},
+{0x2f9a8,0xf62a2},
+{0x2f9a9,0xf62e2},
+{0x2f9aa,0xf6362},
+{0x2f9ab,0xfdb42},
+{0x2f9ac,0xf63a2},
+{0x2f9ad,0xfda82},
+{0x2f9ae,0xfc142},
+{0x2f9af,0xfc182},
+{0x2f9b0,0xfdac2},
+{0x2f9b1,0xfdb02},
+{0x2f9b2,0xfc1c2},
+{0x2f9b3,0xf65e2},
+{0x2f9b4,0xf6622},
+{0x2f9b5,0xf6662},
+{0x2f9b6,0xf66a2},
+{0x2f9b7,0xf6762},
+{0x2f9b8,0xf6722},
+{0x2f9b9,0xf67e2},
+{0x2f9ba,0xf67a2},
+{0x2f9bb,0xf68a2},
+{0x2f9bc,0xf6822},
+{0x2f9bd,0xf6862},
+{0x2f9be,0xf68e2},
+{0x2f9bf,0xfc202},
+{0x2f9c0,0xf6962},
+{0x2f9c1,0xf69a2},
+{0x2f9c2,0xfc242},
+{0x2f9c3,0xf6ae2},
+{0x2f9c4,0xf6b22},
+{0x2f9c5,0xfdb82},
+{0x2f9c6,0xf6c62},
+{0x2f9c7,0xf6ca2},
+{0x2f9c8,0xfc282},
+{0x2f9c9,0xf6d62},
+{0x2f9ca,0xfb5c2},
+{0x2f9cb,0xfdbc2},
+{0x2f9cc,0xfdc02},
+{0x2f9cd,0xfc2c2},
+{0x2f9ce,0xfc302},
+{0x2f9cf,0xf7182},
+{0x2f9d0,0xf7302},
+{0x2f9d1,0xf74c2},
+{0x2f9d2,0xf7602},
+{0x2f9d3,0xfdc42},
+{0x2f9d4,0xf7802},
+{0x2f9d5,0xf7842},
+{0x2f9d6,0xf7a42},
+{0x2f9d7,0xf7b82},
+{0x2f9d8,0xfdcc2},
+{0x2f9d9,0xfc742},
+{0x2f9da,0xf7ca2},
+{0x2f9db,0xf7c62},
+{0x2f9dc,0xf7d22},
+{0x2f9dd,0xfc782},
+{0x2f9de,0xf7e22},
+{0x2f9df,0xf7ee2},
+{0x2f9e0,0xfdd02},
+{0x2f9e1,0xfdd42},
+{0x2f9e2,0xf84c2},
+{0x2f9e3,0xf8582},
+{0x2f9e4,0xf8602},
+{0x2f9e5,0xfdd82},
+{0x2f9e6,0xf8642},
+{0x2f9e7,0xf8a02},
+{0x2f9e8,0xf8ac2},
+{0x2f9e9,0xf8b02},
+{0x2f9ea,0xf8a82},
+{0x2f9eb,0xf8bc2},
+{0x2f9ec,0xf8c02},
+{0x2f9ed,0xfddc2},
+{0x2f9ee,0xf8d82},
+{0x2f9ef,0xfc342},
+{0x2f9f0,0xf8e02},
+{0x2f9f1,0xfde02},
+{0x2f9f2,0xfc382},
+{0x2f9f3,0xf9262},
+{0x2f9f4,0xec9a2},
+{0x2f9f5,0xf9442},
+{0x2f9f6,0xfde42},
+{0x2f9f7,0xfdec2},
+{0x2f9f8,0xfc3c2},
+{0x2f9f9,0xfc402},
+{0x2f9fa,0xf9702},
+{0x2f9fb,0xfdf02},
+{0x2f9fc,0xfc442},
+{0x2f9fd,0xfdf42},
+{0x2f9fe,0xf98c2},
+{0x2f9ff,0xf98c2},
+{0x2fa00,0xf9942},
+{0x2fa01,0xfdf82},
+{0x2fa02,0xf9c22},
+{0x2fa03,0xfc482},
+{0x2fa04,0xf9d22},
+{0x2fa05,0xf9e82},
+{0x2fa06,0xf9f02},
+{0x2fa07,0xf9f82},
+{0x2fa08,0xfc4c2},
+{0x2fa09,0xfdfc2},
+{0x2fa0a,0xfa162},
+{0x2fa0b,0xfa382},
+{0x2fa0c,0xfa482},
+{0x2fa0d,0xfc502},
+{0x2fa0e,0xfc542},
+{0x2fa0f,0xfa4c2},
+{0x2fa10,0xfe002},
+{0x2fa11,0xfc582},
+{0x2fa12,0xfe042},
+{0x2fa13,0xfe082},
+{0x2fa14,0xfe0c2},
+{0x2fa15,0xfa822},
+{0x2fa16,0xfc5c2},
+{0x2fa17,0xfa9e2},
+{0x2fa18,0xfaaa2},
+{0x2fa19,0xfab22},
+{0x2fa1a,0xfaba2},
+{0x2fa1b,0xfac22},
+{0x2fa1c,0xfaca2},
+{0x2fa1d,0xfe142},
+{0xe0001,0x1},
+{0xe0020,0x1},
+{0xe0021,0x1},
+{0xe0022,0x1},
+{0xe0023,0x1},
+{0xe0024,0x1},
+{0xe0025,0x1},
+{0xe0026,0x1},
+{0xe0027,0x1},
+{0xe0028,0x1},
+{0xe0029,0x1},
+{0xe002a,0x1},
+{0xe002b,0x1},
+{0xe002c,0x1},
+{0xe002d,0x1},
+{0xe002e,0x1},
+{0xe002f,0x1},
+{0xe0030,0x1},
+{0xe0031,0x1},
+{0xe0032,0x1},
+{0xe0033,0x1},
+{0xe0034,0x1},
+{0xe0035,0x1},
+{0xe0036,0x1},
+{0xe0037,0x1},
+{0xe0038,0x1},
+{0xe0039,0x1},
+{0xe003a,0x1},
+{0xe003b,0x1},
+{0xe003c,0x1},
+{0xe003d,0x1},
+{0xe003e,0x1},
+{0xe003f,0x1},
+{0xe0040,0x1},
+{0xe0041,0x1},
+{0xe0042,0x1},
+{0xe0043,0x1},
+{0xe0044,0x1},
+{0xe0045,0x1},
+{0xe0046,0x1},
+{0xe0047,0x1},
+{0xe0048,0x1},
+{0xe0049,0x1},
+{0xe004a,0x1},
+{0xe004b,0x1},
+{0xe004c,0x1},
+{0xe004d,0x1},
+{0xe004e,0x1},
+{0xe004f,0x1},
+{0xe0050,0x1},
+{0xe0051,0x1},
+{0xe0052,0x1},
+{0xe0053,0x1},
+{0xe0054,0x1},
+{0xe0055,0x1},
+{0xe0056,0x1},
+{0xe0057,0x1},
+{0xe0058,0x1},
+{0xe0059,0x1},
+{0xe005a,0x1},
+{0xe005b,0x1},
+{0xe005c,0x1},
+{0xe005d,0x1},
+{0xe005e,0x1},
+{0xe005f,0x1},
+{0xe0060,0x1},
+{0xe0061,0x1},
+{0xe0062,0x1},
+{0xe0063,0x1},
+{0xe0064,0x1},
+{0xe0065,0x1},
+{0xe0066,0x1},
+{0xe0067,0x1},
+{0xe0068,0x1},
+{0xe0069,0x1},
+{0xe006a,0x1},
+{0xe006b,0x1},
+{0xe006c,0x1},
+{0xe006d,0x1},
+{0xe006e,0x1},
+{0xe006f,0x1},
+{0xe0070,0x1},
+{0xe0071,0x1},
+{0xe0072,0x1},
+{0xe0073,0x1},
+{0xe0074,0x1},
+{0xe0075,0x1},
+{0xe0076,0x1},
+{0xe0077,0x1},
+{0xe0078,0x1},
+{0xe0079,0x1},
+{0xe007a,0x1},
+{0xe007b,0x1},
+{0xe007c,0x1},
+{0xe007d,0x1},
+{0xe007e,0x1},
+{0xe007f,0x1},
+{0xe0100,0x1},
+{0xe0101,0x1},
+{0xe0102,0x1},
+{0xe0103,0x1},
+{0xe0104,0x1},
+{0xe0105,0x1},
+{0xe0106,0x1},
+{0xe0107,0x1},
+{0xe0108,0x1},
+{0xe0109,0x1},
+{0xe010a,0x1},
+{0xe010b,0x1},
+{0xe010c,0x1},
+{0xe010d,0x1},
+{0xe010e,0x1},
+{0xe010f,0x1},
+{0xe0110,0x1},
+{0xe0111,0x1},
+{0xe0112,0x1},
+{0xe0113,0x1},
+{0xe0114,0x1},
+{0xe0115,0x1},
+{0xe0116,0x1},
+{0xe0117,0x1},
+{0xe0118,0x1},
+{0xe0119,0x1},
+{0xe011a,0x1},
+{0xe011b,0x1},
+{0xe011c,0x1},
+{0xe011d,0x1},
+{0xe011e,0x1},
+{0xe011f,0x1},
+{0xe0120,0x1},
+{0xe0121,0x1},
+{0xe0122,0x1},
+{0xe0123,0x1},
+{0xe0124,0x1},
+{0xe0125,0x1},
+{0xe0126,0x1},
+{0xe0127,0x1},
+{0xe0128,0x1},
+{0xe0129,0x1},
+{0xe012a,0x1},
+{0xe012b,0x1},
+{0xe012c,0x1},
+{0xe012d,0x1},
+{0xe012e,0x1},
+{0xe012f,0x1},
+{0xe0130,0x1},
+{0xe0131,0x1},
+{0xe0132,0x1},
+{0xe0133,0x1},
+{0xe0134,0x1},
+{0xe0135,0x1},
+{0xe0136,0x1},
+{0xe0137,0x1},
+{0xe0138,0x1},
+{0xe0139,0x1},
+{0xe013a,0x1},
+{0xe013b,0x1},
+{0xe013c,0x1},
+{0xe013d,0x1},
+{0xe013e,0x1},
+{0xe013f,0x1},
+{0xe0140,0x1},
+{0xe0141,0x1},
+{0xe0142,0x1},
+{0xe0143,0x1},
+{0xe0144,0x1},
+{0xe0145,0x1},
+{0xe0146,0x1},
+{0xe0147,0x1},
+{0xe0148,0x1},
+{0xe0149,0x1},
+{0xe014a,0x1},
+{0xe014b,0x1},
+{0xe014c,0x1},
+{0xe014d,0x1},
+{0xe014e,0x1},
+{0xe014f,0x1},
+{0xe0150,0x1},
+{0xe0151,0x1},
+{0xe0152,0x1},
+{0xe0153,0x1},
+{0xe0154,0x1},
+{0xe0155,0x1},
+{0xe0156,0x1},
+{0xe0157,0x1},
+{0xe0158,0x1},
+{0xe0159,0x1},
+{0xe015a,0x1},
+{0xe015b,0x1},
+{0xe015c,0x1},
+{0xe015d,0x1},
+{0xe015e,0x1},
+{0xe015f,0x1},
+{0xe0160,0x1},
+{0xe0161,0x1},
+{0xe0162,0x1},
+{0xe0163,0x1},
+{0xe0164,0x1},
+{0xe0165,0x1},
+{0xe0166,0x1},
+{0xe0167,0x1},
+{0xe0168,0x1},
+{0xe0169,0x1},
+{0xe016a,0x1},
+{0xe016b,0x1},
+{0xe016c,0x1},
+{0xe016d,0x1},
+{0xe016e,0x1},
+{0xe016f,0x1},
+{0xe0170,0x1},
+{0xe0171,0x1},
+{0xe0172,0x1},
+{0xe0173,0x1},
+{0xe0174,0x1},
+{0xe0175,0x1},
+{0xe0176,0x1},
+{0xe0177,0x1},
+{0xe0178,0x1},
+{0xe0179,0x1},
+{0xe017a,0x1},
+{0xe017b,0x1},
+{0xe017c,0x1},
+{0xe017d,0x1},
+{0xe017e,0x1},
+{0xe017f,0x1},
+{0xe0180,0x1},
+{0xe0181,0x1},
+{0xe0182,0x1},
+{0xe0183,0x1},
+{0xe0184,0x1},
+{0xe0185,0x1},
+{0xe0186,0x1},
+{0xe0187,0x1},
+{0xe0188,0x1},
+{0xe0189,0x1},
+{0xe018a,0x1},
+{0xe018b,0x1},
+{0xe018c,0x1},
+{0xe018d,0x1},
+{0xe018e,0x1},
+{0xe018f,0x1},
+{0xe0190,0x1},
+{0xe0191,0x1},
+{0xe0192,0x1},
+{0xe0193,0x1},
+{0xe0194,0x1},
+{0xe0195,0x1},
+{0xe0196,0x1},
+{0xe0197,0x1},
+{0xe0198,0x1},
+{0xe0199,0x1},
+{0xe019a,0x1},
+{0xe019b,0x1},
+{0xe019c,0x1},
+{0xe019d,0x1},
+{0xe019e,0x1},
+{0xe019f,0x1},
+{0xe01a0,0x1},
+{0xe01a1,0x1},
+{0xe01a2,0x1},
+{0xe01a3,0x1},
+{0xe01a4,0x1},
+{0xe01a5,0x1},
+{0xe01a6,0x1},
+{0xe01a7,0x1},
+{0xe01a8,0x1},
+{0xe01a9,0x1},
+{0xe01aa,0x1},
+{0xe01ab,0x1},
+{0xe01ac,0x1},
+{0xe01ad,0x1},
+{0xe01ae,0x1},
+{0xe01af,0x1},
+{0xe01b0,0x1},
+{0xe01b1,0x1},
+{0xe01b2,0x1},
+{0xe01b3,0x1},
+{0xe01b4,0x1},
+{0xe01b5,0x1},
+{0xe01b6,0x1},
+{0xe01b7,0x1},
+{0xe01b8,0x1},
+{0xe01b9,0x1},
+{0xe01ba,0x1},
+{0xe01bb,0x1},
+{0xe01bc,0x1},
+{0xe01bd,0x1},
+{0xe01be,0x1},
+{0xe01bf,0x1},
+{0xe01c0,0x1},
+{0xe01c1,0x1},
+{0xe01c2,0x1},
+{0xe01c3,0x1},
+{0xe01c4,0x1},
+{0xe01c5,0x1},
+{0xe01c6,0x1},
+{0xe01c7,0x1},
+{0xe01c8,0x1},
+{0xe01c9,0x1},
+{0xe01ca,0x1},
+{0xe01cb,0x1},
+{0xe01cc,0x1},
+{0xe01cd,0x1},
+{0xe01ce,0x1},
+{0xe01cf,0x1},
+{0xe01d0,0x1},
+{0xe01d1,0x1},
+{0xe01d2,0x1},
+{0xe01d3,0x1},
+{0xe01d4,0x1},
+{0xe01d5,0x1},
+{0xe01d6,0x1},
+{0xe01d7,0x1},
+{0xe01d8,0x1},
+{0xe01d9,0x1},
+{0xe01da,0x1},
+{0xe01db,0x1},
+{0xe01dc,0x1},
+{0xe01dd,0x1},
+{0xe01de,0x1},
+{0xe01df,0x1},
+{0xe01e0,0x1},
+{0xe01e1,0x1},
+{0xe01e2,0x1},
+{0xe01e3,0x1},
+{0xe01e4,0x1},
+{0xe01e5,0x1},
+{0xe01e6,0x1},
+{0xe01e7,0x1},
+{0xe01e8,0x1},
+{0xe01e9,0x1},
+{0xe01ea,0x1},
+{0xe01eb,0x1},
+{0xe01ec,0x1},
+{0xe01ed,0x1},
+{0xe01ee,0x1},
+{0xe01ef,0x1},
+};
+
+const TableView<char32_t, char32_t> collation_single_table {std::begin(collation_single_array), std::end(collation_single_array)};
+
+const KeyValue<std::array<char32_t, 3>, char32_t> collation_multiple_array[] {
+{{{0x4c,0xb7,0x0}},0x466c2},
+{{{0x4c,0x387,0x0}},0x466c2},
+{{{0x6c,0xb7,0x0}},0x46682},
+{{{0x6c,0x387,0x0}},0x46682},
+{{{0x418,0x306,0x0}},0x5ac61},
+{{{0x438,0x306,0x0}},0x5ac41},
+{{{0x627,0x653,0x0}},0x61541},
+{{{0x627,0x654,0x0}},0x615a1},
+{{{0x627,0x655,0x0}},0x616e1},
+{{{0x648,0x654,0x0}},0x61681},
+{{{0x64a,0x654,0x0}},0x617a1},
+{{{0x9c7,0x9be,0x0}},0x74761},
+{{{0x9c7,0x9d7,0x0}},0x74781},
+{{{0xb47,0xb3e,0x0}},0x76161},
+{{{0xb47,0xb56,0x0}},0x76141},
+{{{0xb47,0xb57,0x0}},0x76181},
+{{{0xb92,0xbd7,0x0}},0x76381},
+{{{0xbc6,0xbbe,0x0}},0x767a1},
+{{{0xbc6,0xbd7,0x0}},0x767e1},
+{{{0xbc7,0xbbe,0x0}},0x767c1},
+{{{0xc46,0xc56,0x0}},0x770a1},
+{{{0xcbf,0xcd5,0x0}},0x778a1},
+{{{0xcc6,0xcc2,0x0}},0x779e1},
+{{{0xcc6,0xcc2,0xcd5}},0x77a01},
+{{{0xcc6,0xcd5,0x0}},0x779a1},
+{{{0xcc6,0xcd6,0x0}},0x779c1},
+{{{0xcca,0xcd5,0x0}},0x77a01},
+{{{0xd46,0xd3e,0x0}},0x784a1},
+{{{0xd46,0xd57,0x0}},0x784e1},
+{{{0xd47,0xd3e,0x0}},0x784c1},
+{{{0xdd9,0xdca,0x0}},0x78e21},
+{{{0xdd9,0xdcf,0x0}},0x78e61},
+{{{0xdd9,0xdcf,0xdca}},0x78e81},
+{{{0xdd9,0xddf,0x0}},0x78ea1},
+{{{0xddc,0xdca,0x0}},0x78e81},
+{{{0xe40,0xe01,0x0}},0x80c82},
+{{{0xe40,0xe02,0x0}},0x80de2},
+{{{0xe40,0xe03,0x0}},0x80f42},
+{{{0xe40,0xe04,0x0}},0x810a2},
+{{{0xe40,0xe05,0x0}},0x81202},
+{{{0xe40,0xe06,0x0}},0x81362},
+{{{0xe40,0xe07,0x0}},0x814c2},
+{{{0xe40,0xe08,0x0}},0x81622},
+{{{0xe40,0xe09,0x0}},0x81782},
+{{{0xe40,0xe0a,0x0}},0x818e2},
+{{{0xe40,0xe0b,0x0}},0x81a42},
+{{{0xe40,0xe0c,0x0}},0x81ba2},
+{{{0xe40,0xe0d,0x0}},0x81d02},
+{{{0xe40,0xe0e,0x0}},0x81e62},
+{{{0xe40,0xe0f,0x0}},0x81fc2},
+{{{0xe40,0xe10,0x0}},0x82122},
+{{{0xe40,0xe11,0x0}},0x82282},
+{{{0xe40,0xe12,0x0}},0x823e2},
+{{{0xe40,0xe13,0x0}},0x82542},
+{{{0xe40,0xe14,0x0}},0x826a2},
+{{{0xe40,0xe15,0x0}},0x82802},
+{{{0xe40,0xe16,0x0}},0x82962},
+{{{0xe40,0xe17,0x0}},0x82ac2},
+{{{0xe40,0xe18,0x0}},0x82c22},
+{{{0xe40,0xe19,0x0}},0x82d82},
+{{{0xe40,0xe1a,0x0}},0x82ee2},
+{{{0xe40,0xe1b,0x0}},0x83042},
+{{{0xe40,0xe1c,0x0}},0x831a2},
+{{{0xe40,0xe1d,0x0}},0x83302},
+{{{0xe40,0xe1e,0x0}},0x83462},
+{{{0xe40,0xe1f,0x0}},0x835c2},
+{{{0xe40,0xe20,0x0}},0x83722},
+{{{0xe40,0xe21,0x0}},0x83882},
+{{{0xe40,0xe22,0x0}},0x839e2},
+{{{0xe40,0xe23,0x0}},0x83b42},
+{{{0xe40,0xe24,0x0}},0x83ca2},
+{{{0xe40,0xe25,0x0}},0x83e02},
+{{{0xe40,0xe26,0x0}},0x83f62},
+{{{0xe40,0xe27,0x0}},0x840c2},
+{{{0xe40,0xe28,0x0}},0x84222},
+{{{0xe40,0xe29,0x0}},0x84382},
+{{{0xe40,0xe2a,0x0}},0x844e2},
+{{{0xe40,0xe2b,0x0}},0x84642},
+{{{0xe40,0xe2c,0x0}},0x847a2},
+{{{0xe40,0xe2d,0x0}},0x84902},
+{{{0xe40,0xe2e,0x0}},0x84a62},
+{{{0xe41,0xe01,0x0}},0x80cc2},
+{{{0xe41,0xe02,0x0}},0x80e22},
+{{{0xe41,0xe03,0x0}},0x80f82},
+{{{0xe41,0xe04,0x0}},0x810e2},
+{{{0xe41,0xe05,0x0}},0x81242},
+{{{0xe41,0xe06,0x0}},0x813a2},
+{{{0xe41,0xe07,0x0}},0x81502},
+{{{0xe41,0xe08,0x0}},0x81662},
+{{{0xe41,0xe09,0x0}},0x817c2},
+{{{0xe41,0xe0a,0x0}},0x81922},
+{{{0xe41,0xe0b,0x0}},0x81a82},
+{{{0xe41,0xe0c,0x0}},0x81be2},
+{{{0xe41,0xe0d,0x0}},0x81d42},
+{{{0xe41,0xe0e,0x0}},0x81ea2},
+{{{0xe41,0xe0f,0x0}},0x82002},
+{{{0xe41,0xe10,0x0}},0x82162},
+{{{0xe41,0xe11,0x0}},0x822c2},
+{{{0xe41,0xe12,0x0}},0x82422},
+{{{0xe41,0xe13,0x0}},0x82582},
+{{{0xe41,0xe14,0x0}},0x826e2},
+{{{0xe41,0xe15,0x0}},0x82842},
+{{{0xe41,0xe16,0x0}},0x829a2},
+{{{0xe41,0xe17,0x0}},0x82b02},
+{{{0xe41,0xe18,0x0}},0x82c62},
+{{{0xe41,0xe19,0x0}},0x82dc2},
+{{{0xe41,0xe1a,0x0}},0x82f22},
+{{{0xe41,0xe1b,0x0}},0x83082},
+{{{0xe41,0xe1c,0x0}},0x831e2},
+{{{0xe41,0xe1d,0x0}},0x83342},
+{{{0xe41,0xe1e,0x0}},0x834a2},
+{{{0xe41,0xe1f,0x0}},0x83602},
+{{{0xe41,0xe20,0x0}},0x83762},
+{{{0xe41,0xe21,0x0}},0x838c2},
+{{{0xe41,0xe22,0x0}},0x83a22},
+{{{0xe41,0xe23,0x0}},0x83b82},
+{{{0xe41,0xe24,0x0}},0x83ce2},
+{{{0xe41,0xe25,0x0}},0x83e42},
+{{{0xe41,0xe26,0x0}},0x83fa2},
+{{{0xe41,0xe27,0x0}},0x84102},
+{{{0xe41,0xe28,0x0}},0x84262},
+{{{0xe41,0xe29,0x0}},0x843c2},
+{{{0xe41,0xe2a,0x0}},0x84522},
+{{{0xe41,0xe2b,0x0}},0x84682},
+{{{0xe41,0xe2c,0x0}},0x847e2},
+{{{0xe41,0xe2d,0x0}},0x84942},
+{{{0xe41,0xe2e,0x0}},0x84aa2},
+{{{0xe42,0xe01,0x0}},0x80d02},
+{{{0xe42,0xe02,0x0}},0x80e62},
+{{{0xe42,0xe03,0x0}},0x80fc2},
+{{{0xe42,0xe04,0x0}},0x81122},
+{{{0xe42,0xe05,0x0}},0x81282},
+{{{0xe42,0xe06,0x0}},0x813e2},
+{{{0xe42,0xe07,0x0}},0x81542},
+{{{0xe42,0xe08,0x0}},0x816a2},
+{{{0xe42,0xe09,0x0}},0x81802},
+{{{0xe42,0xe0a,0x0}},0x81962},
+{{{0xe42,0xe0b,0x0}},0x81ac2},
+{{{0xe42,0xe0c,0x0}},0x81c22},
+{{{0xe42,0xe0d,0x0}},0x81d82},
+{{{0xe42,0xe0e,0x0}},0x81ee2},
+{{{0xe42,0xe0f,0x0}},0x82042},
+{{{0xe42,0xe10,0x0}},0x821a2},
+{{{0xe42,0xe11,0x0}},0x82302},
+{{{0xe42,0xe12,0x0}},0x82462},
+{{{0xe42,0xe13,0x0}},0x825c2},
+{{{0xe42,0xe14,0x0}},0x82722},
+{{{0xe42,0xe15,0x0}},0x82882},
+{{{0xe42,0xe16,0x0}},0x829e2},
+{{{0xe42,0xe17,0x0}},0x82b42},
+{{{0xe42,0xe18,0x0}},0x82ca2},
+{{{0xe42,0xe19,0x0}},0x82e02},
+{{{0xe42,0xe1a,0x0}},0x82f62},
+{{{0xe42,0xe1b,0x0}},0x830c2},
+{{{0xe42,0xe1c,0x0}},0x83222},
+{{{0xe42,0xe1d,0x0}},0x83382},
+{{{0xe42,0xe1e,0x0}},0x834e2},
+{{{0xe42,0xe1f,0x0}},0x83642},
+{{{0xe42,0xe20,0x0}},0x837a2},
+{{{0xe42,0xe21,0x0}},0x83902},
+{{{0xe42,0xe22,0x0}},0x83a62},
+{{{0xe42,0xe23,0x0}},0x83bc2},
+{{{0xe42,0xe24,0x0}},0x83d22},
+{{{0xe42,0xe25,0x0}},0x83e82},
+{{{0xe42,0xe26,0x0}},0x83fe2},
+{{{0xe42,0xe27,0x0}},0x84142},
+{{{0xe42,0xe28,0x0}},0x842a2},
+{{{0xe42,0xe29,0x0}},0x84402},
+{{{0xe42,0xe2a,0x0}},0x84562},
+{{{0xe42,0xe2b,0x0}},0x846c2},
+{{{0xe42,0xe2c,0x0}},0x84822},
+{{{0xe42,0xe2d,0x0}},0x84982},
+{{{0xe42,0xe2e,0x0}},0x84ae2},
+{{{0xe43,0xe01,0x0}},0x80d42},
+{{{0xe43,0xe02,0x0}},0x80ea2},
+{{{0xe43,0xe03,0x0}},0x81002},
+{{{0xe43,0xe04,0x0}},0x81162},
+{{{0xe43,0xe05,0x0}},0x812c2},
+{{{0xe43,0xe06,0x0}},0x81422},
+{{{0xe43,0xe07,0x0}},0x81582},
+{{{0xe43,0xe08,0x0}},0x816e2},
+{{{0xe43,0xe09,0x0}},0x81842},
+{{{0xe43,0xe0a,0x0}},0x819a2},
+{{{0xe43,0xe0b,0x0}},0x81b02},
+{{{0xe43,0xe0c,0x0}},0x81c62},
+{{{0xe43,0xe0d,0x0}},0x81dc2},
+{{{0xe43,0xe0e,0x0}},0x81f22},
+{{{0xe43,0xe0f,0x0}},0x82082},
+{{{0xe43,0xe10,0x0}},0x821e2},
+{{{0xe43,0xe11,0x0}},0x82342},
+{{{0xe43,0xe12,0x0}},0x824a2},
+{{{0xe43,0xe13,0x0}},0x82602},
+{{{0xe43,0xe14,0x0}},0x82762},
+{{{0xe43,0xe15,0x0}},0x828c2},
+{{{0xe43,0xe16,0x0}},0x82a22},
+{{{0xe43,0xe17,0x0}},0x82b82},
+{{{0xe43,0xe18,0x0}},0x82ce2},
+{{{0xe43,0xe19,0x0}},0x82e42},
+{{{0xe43,0xe1a,0x0}},0x82fa2},
+{{{0xe43,0xe1b,0x0}},0x83102},
+{{{0xe43,0xe1c,0x0}},0x83262},
+{{{0xe43,0xe1d,0x0}},0x833c2},
+{{{0xe43,0xe1e,0x0}},0x83522},
+{{{0xe43,0xe1f,0x0}},0x83682},
+{{{0xe43,0xe20,0x0}},0x837e2},
+{{{0xe43,0xe21,0x0}},0x83942},
+{{{0xe43,0xe22,0x0}},0x83aa2},
+{{{0xe43,0xe23,0x0}},0x83c02},
+{{{0xe43,0xe24,0x0}},0x83d62},
+{{{0xe43,0xe25,0x0}},0x83ec2},
+{{{0xe43,0xe26,0x0}},0x84022},
+{{{0xe43,0xe27,0x0}},0x84182},
+{{{0xe43,0xe28,0x0}},0x842e2},
+{{{0xe43,0xe29,0x0}},0x84442},
+{{{0xe43,0xe2a,0x0}},0x845a2},
+{{{0xe43,0xe2b,0x0}},0x84702},
+{{{0xe43,0xe2c,0x0}},0x84862},
+{{{0xe43,0xe2d,0x0}},0x849c2},
+{{{0xe43,0xe2e,0x0}},0x84b22},
+{{{0xe44,0xe01,0x0}},0x80d82},
+{{{0xe44,0xe02,0x0}},0x80ee2},
+{{{0xe44,0xe03,0x0}},0x81042},
+{{{0xe44,0xe04,0x0}},0x811a2},
+{{{0xe44,0xe05,0x0}},0x81302},
+{{{0xe44,0xe06,0x0}},0x81462},
+{{{0xe44,0xe07,0x0}},0x815c2},
+{{{0xe44,0xe08,0x0}},0x81722},
+{{{0xe44,0xe09,0x0}},0x81882},
+{{{0xe44,0xe0a,0x0}},0x819e2},
+{{{0xe44,0xe0b,0x0}},0x81b42},
+{{{0xe44,0xe0c,0x0}},0x81ca2},
+{{{0xe44,0xe0d,0x0}},0x81e02},
+{{{0xe44,0xe0e,0x0}},0x81f62},
+{{{0xe44,0xe0f,0x0}},0x820c2},
+{{{0xe44,0xe10,0x0}},0x82222},
+{{{0xe44,0xe11,0x0}},0x82382},
+{{{0xe44,0xe12,0x0}},0x824e2},
+{{{0xe44,0xe13,0x0}},0x82642},
+{{{0xe44,0xe14,0x0}},0x827a2},
+{{{0xe44,0xe15,0x0}},0x82902},
+{{{0xe44,0xe16,0x0}},0x82a62},
+{{{0xe44,0xe17,0x0}},0x82bc2},
+{{{0xe44,0xe18,0x0}},0x82d22},
+{{{0xe44,0xe19,0x0}},0x82e82},
+{{{0xe44,0xe1a,0x0}},0x82fe2},
+{{{0xe44,0xe1b,0x0}},0x83142},
+{{{0xe44,0xe1c,0x0}},0x832a2},
+{{{0xe44,0xe1d,0x0}},0x83402},
+{{{0xe44,0xe1e,0x0}},0x83562},
+{{{0xe44,0xe1f,0x0}},0x836c2},
+{{{0xe44,0xe20,0x0}},0x83822},
+{{{0xe44,0xe21,0x0}},0x83982},
+{{{0xe44,0xe22,0x0}},0x83ae2},
+{{{0xe44,0xe23,0x0}},0x83c42},
+{{{0xe44,0xe24,0x0}},0x83da2},
+{{{0xe44,0xe25,0x0}},0x83f02},
+{{{0xe44,0xe26,0x0}},0x84062},
+{{{0xe44,0xe27,0x0}},0x841c2},
+{{{0xe44,0xe28,0x0}},0x84322},
+{{{0xe44,0xe29,0x0}},0x84482},
+{{{0xe44,0xe2a,0x0}},0x845e2},
+{{{0xe44,0xe2b,0x0}},0x84742},
+{{{0xe44,0xe2c,0x0}},0x848a2},
+{{{0xe44,0xe2d,0x0}},0x84a02},
+{{{0xe44,0xe2e,0x0}},0x84b62},
+{{{0xe4d,0xe32,0x0}},0x84c21},
+{{{0xec0,0xe81,0x0}},0x84f62},
+{{{0xec0,0xe82,0x0}},0x850c2},
+{{{0xec0,0xe84,0x0}},0x85222},
+{{{0xec0,0xe87,0x0}},0x85382},
+{{{0xec0,0xe88,0x0}},0x854e2},
+{{{0xec0,0xe8a,0x0}},0x857a2},
+{{{0xec0,0xe8d,0x0}},0x85a62},
+{{{0xec0,0xe94,0x0}},0x85bc2},
+{{{0xec0,0xe95,0x0}},0x85d22},
+{{{0xec0,0xe96,0x0}},0x85e82},
+{{{0xec0,0xe97,0x0}},0x85fe2},
+{{{0xec0,0xe99,0x0}},0x86142},
+{{{0xec0,0xe9a,0x0}},0x862a2},
+{{{0xec0,0xe9b,0x0}},0x86402},
+{{{0xec0,0xe9c,0x0}},0x86562},
+{{{0xec0,0xe9d,0x0}},0x866c2},
+{{{0xec0,0xe9e,0x0}},0x86822},
+{{{0xec0,0xe9f,0x0}},0x86982},
+{{{0xec0,0xea1,0x0}},0x86ae2},
+{{{0xec0,0xea2,0x0}},0x86c42},
+{{{0xec0,0xea3,0x0}},0x86da2},
+{{{0xec0,0xea5,0x0}},0x86f02},
+{{{0xec0,0xea7,0x0}},0x87062},
+{{{0xec0,0xeaa,0x0}},0x85642},
+{{{0xec0,0xeab,0x0}},0x87602},
+{{{0xec0,0xead,0x0}},0x87762},
+{{{0xec0,0xeae,0x0}},0x878c2},
+{{{0xec0,0xedc,0x0}},0x87203},
+{{{0xec0,0xedd,0x0}},0x87423},
+{{{0xec0,0xede,0x0}},0x84e02},
+{{{0xec0,0xedf,0x0}},0x85902},
+{{{0xec1,0xe81,0x0}},0x84fa2},
+{{{0xec1,0xe82,0x0}},0x85102},
+{{{0xec1,0xe84,0x0}},0x85262},
+{{{0xec1,0xe87,0x0}},0x853c2},
+{{{0xec1,0xe88,0x0}},0x85522},
+{{{0xec1,0xe8a,0x0}},0x857e2},
+{{{0xec1,0xe8d,0x0}},0x85aa2},
+{{{0xec1,0xe94,0x0}},0x85c02},
+{{{0xec1,0xe95,0x0}},0x85d62},
+{{{0xec1,0xe96,0x0}},0x85ec2},
+{{{0xec1,0xe97,0x0}},0x86022},
+{{{0xec1,0xe99,0x0}},0x86182},
+{{{0xec1,0xe9a,0x0}},0x862e2},
+{{{0xec1,0xe9b,0x0}},0x86442},
+{{{0xec1,0xe9c,0x0}},0x865a2},
+{{{0xec1,0xe9d,0x0}},0x86702},
+{{{0xec1,0xe9e,0x0}},0x86862},
+{{{0xec1,0xe9f,0x0}},0x869c2},
+{{{0xec1,0xea1,0x0}},0x86b22},
+{{{0xec1,0xea2,0x0}},0x86c82},
+{{{0xec1,0xea3,0x0}},0x86de2},
+{{{0xec1,0xea5,0x0}},0x86f42},
+{{{0xec1,0xea7,0x0}},0x870a2},
+{{{0xec1,0xeaa,0x0}},0x85682},
+{{{0xec1,0xeab,0x0}},0x87642},
+{{{0xec1,0xead,0x0}},0x877a2},
+{{{0xec1,0xeae,0x0}},0x87902},
+{{{0xec1,0xedc,0x0}},0x87263},
+{{{0xec1,0xedd,0x0}},0x87483},
+{{{0xec1,0xede,0x0}},0x84e42},
+{{{0xec1,0xedf,0x0}},0x85942},
+{{{0xec2,0xe81,0x0}},0x84fe2},
+{{{0xec2,0xe82,0x0}},0x85142},
+{{{0xec2,0xe84,0x0}},0x852a2},
+{{{0xec2,0xe87,0x0}},0x85402},
+{{{0xec2,0xe88,0x0}},0x85562},
+{{{0xec2,0xe8a,0x0}},0x85822},
+{{{0xec2,0xe8d,0x0}},0x85ae2},
+{{{0xec2,0xe94,0x0}},0x85c42},
+{{{0xec2,0xe95,0x0}},0x85da2},
+{{{0xec2,0xe96,0x0}},0x85f02},
+{{{0xec2,0xe97,0x0}},0x86062},
+{{{0xec2,0xe99,0x0}},0x861c2},
+{{{0xec2,0xe9a,0x0}},0x86322},
+{{{0xec2,0xe9b,0x0}},0x86482},
+{{{0xec2,0xe9c,0x0}},0x865e2},
+{{{0xec2,0xe9d,0x0}},0x86742},
+{{{0xec2,0xe9e,0x0}},0x868a2},
+{{{0xec2,0xe9f,0x0}},0x86a02},
+{{{0xec2,0xea1,0x0}},0x86b62},
+{{{0xec2,0xea2,0x0}},0x86cc2},
+{{{0xec2,0xea3,0x0}},0x86e22},
+{{{0xec2,0xea5,0x0}},0x86f82},
+{{{0xec2,0xea7,0x0}},0x870e2},
+{{{0xec2,0xeaa,0x0}},0x856c2},
+{{{0xec2,0xeab,0x0}},0x87682},
+{{{0xec2,0xead,0x0}},0x877e2},
+{{{0xec2,0xeae,0x0}},0x87942},
+{{{0xec2,0xedc,0x0}},0x872c3},
+{{{0xec2,0xedd,0x0}},0x874e3},
+{{{0xec2,0xede,0x0}},0x84e82},
+{{{0xec2,0xedf,0x0}},0x85982},
+{{{0xec3,0xe81,0x0}},0x85022},
+{{{0xec3,0xe82,0x0}},0x85182},
+{{{0xec3,0xe84,0x0}},0x852e2},
+{{{0xec3,0xe87,0x0}},0x85442},
+{{{0xec3,0xe88,0x0}},0x855a2},
+{{{0xec3,0xe8a,0x0}},0x85862},
+{{{0xec3,0xe8d,0x0}},0x85b22},
+{{{0xec3,0xe94,0x0}},0x85c82},
+{{{0xec3,0xe95,0x0}},0x85de2},
+{{{0xec3,0xe96,0x0}},0x85f42},
+{{{0xec3,0xe97,0x0}},0x860a2},
+{{{0xec3,0xe99,0x0}},0x86202},
+{{{0xec3,0xe9a,0x0}},0x86362},
+{{{0xec3,0xe9b,0x0}},0x864c2},
+{{{0xec3,0xe9c,0x0}},0x86622},
+{{{0xec3,0xe9d,0x0}},0x86782},
+{{{0xec3,0xe9e,0x0}},0x868e2},
+{{{0xec3,0xe9f,0x0}},0x86a42},
+{{{0xec3,0xea1,0x0}},0x86ba2},
+{{{0xec3,0xea2,0x0}},0x86d02},
+{{{0xec3,0xea3,0x0}},0x86e62},
+{{{0xec3,0xea5,0x0}},0x86fc2},
+{{{0xec3,0xea7,0x0}},0x87122},
+{{{0xec3,0xeaa,0x0}},0x85702},
+{{{0xec3,0xeab,0x0}},0x876c2},
+{{{0xec3,0xead,0x0}},0x87822},
+{{{0xec3,0xeae,0x0}},0x87982},
+{{{0xec3,0xedc,0x0}},0x87323},
+{{{0xec3,0xedd,0x0}},0x87543},
+{{{0xec3,0xede,0x0}},0x84ec2},
+{{{0xec3,0xedf,0x0}},0x859c2},
+{{{0xec4,0xe81,0x0}},0x85062},
+{{{0xec4,0xe82,0x0}},0x851c2},
+{{{0xec4,0xe84,0x0}},0x85322},
+{{{0xec4,0xe87,0x0}},0x85482},
+{{{0xec4,0xe88,0x0}},0x855e2},
+{{{0xec4,0xe8a,0x0}},0x858a2},
+{{{0xec4,0xe8d,0x0}},0x85b62},
+{{{0xec4,0xe94,0x0}},0x85cc2},
+{{{0xec4,0xe95,0x0}},0x85e22},
+{{{0xec4,0xe96,0x0}},0x85f82},
+{{{0xec4,0xe97,0x0}},0x860e2},
+{{{0xec4,0xe99,0x0}},0x86242},
+{{{0xec4,0xe9a,0x0}},0x863a2},
+{{{0xec4,0xe9b,0x0}},0x86502},
+{{{0xec4,0xe9c,0x0}},0x86662},
+{{{0xec4,0xe9d,0x0}},0x867c2},
+{{{0xec4,0xe9e,0x0}},0x86922},
+{{{0xec4,0xe9f,0x0}},0x86a82},
+{{{0xec4,0xea1,0x0}},0x86be2},
+{{{0xec4,0xea2,0x0}},0x86d42},
+{{{0xec4,0xea3,0x0}},0x86ea2},
+{{{0xec4,0xea5,0x0}},0x87002},
+{{{0xec4,0xea7,0x0}},0x87162},
+{{{0xec4,0xeaa,0x0}},0x85742},
+{{{0xec4,0xeab,0x0}},0x87702},
+{{{0xec4,0xead,0x0}},0x87862},
+{{{0xec4,0xeae,0x0}},0x879c2},
+{{{0xec4,0xedc,0x0}},0x87383},
+{{{0xec4,0xedd,0x0}},0x875a3},
+{{{0xec4,0xede,0x0}},0x84f02},
+{{{0xec4,0xedf,0x0}},0x85a02},
+{{{0xecd,0xeb2,0x0}},0x87a81},
+{{{0xf71,0xf72,0x0}},0x8cf61},
+{{{0xf71,0xf74,0x0}},0x8cfe1},
+{{{0xf71,0xf80,0x0}},0x8cfa1},
+{{{0xfb2,0xf71,0xf80}},0x8d021},
+{{{0xfb2,0xf80,0x0}},0x8d001},
+{{{0xfb2,0xf81,0x0}},0x8d021},
+{{{0xfb3,0xf71,0xf80}},0x8d061},
+{{{0xfb3,0xf80,0x0}},0x8d041},
+{{{0xfb3,0xf81,0x0}},0x8d061},
+{{{0x1025,0x102e,0x0}},0x91021},
+{{{0x19b5,0x1980,0x0}},0x92b82},
+{{{0x19b5,0x1981,0x0}},0x92ca2},
+{{{0x19b5,0x1982,0x0}},0x92dc2},
+{{{0x19b5,0x1983,0x0}},0x92ee2},
+{{{0x19b5,0x1984,0x0}},0x93002},
+{{{0x19b5,0x1985,0x0}},0x93122},
+{{{0x19b5,0x1986,0x0}},0x93242},
+{{{0x19b5,0x1987,0x0}},0x93362},
+{{{0x19b5,0x1988,0x0}},0x93482},
+{{{0x19b5,0x1989,0x0}},0x935a2},
+{{{0x19b5,0x198a,0x0}},0x936c2},
+{{{0x19b5,0x198b,0x0}},0x937e2},
+{{{0x19b5,0x198c,0x0}},0x93902},
+{{{0x19b5,0x198d,0x0}},0x93a22},
+{{{0x19b5,0x198e,0x0}},0x93b42},
+{{{0x19b5,0x198f,0x0}},0x93c62},
+{{{0x19b5,0x1990,0x0}},0x93d82},
+{{{0x19b5,0x1991,0x0}},0x93ea2},
+{{{0x19b5,0x1992,0x0}},0x93fc2},
+{{{0x19b5,0x1993,0x0}},0x940e2},
+{{{0x19b5,0x1994,0x0}},0x94202},
+{{{0x19b5,0x1995,0x0}},0x94322},
+{{{0x19b5,0x1996,0x0}},0x94442},
+{{{0x19b5,0x1997,0x0}},0x94562},
+{{{0x19b5,0x1998,0x0}},0x94682},
+{{{0x19b5,0x1999,0x0}},0x947a2},
+{{{0x19b5,0x199a,0x0}},0x948c2},
+{{{0x19b5,0x199b,0x0}},0x949e2},
+{{{0x19b5,0x199c,0x0}},0x94b02},
+{{{0x19b5,0x199d,0x0}},0x94cc2},
+{{{0x19b5,0x199e,0x0}},0x94de2},
+{{{0x19b5,0x199f,0x0}},0x94f02},
+{{{0x19b5,0x19a0,0x0}},0x95022},
+{{{0x19b5,0x19a1,0x0}},0x95142},
+{{{0x19b5,0x19a2,0x0}},0x95262},
+{{{0x19b5,0x19a3,0x0}},0x95382},
+{{{0x19b5,0x19a4,0x0}},0x954a2},
+{{{0x19b5,0x19a5,0x0}},0x955c2},
+{{{0x19b5,0x19a6,0x0}},0x956e2},
+{{{0x19b5,0x19a7,0x0}},0x95802},
+{{{0x19b5,0x19a8,0x0}},0x95922},
+{{{0x19b5,0x19a9,0x0}},0x95a42},
+{{{0x19b5,0x19aa,0x0}},0x95b62},
+{{{0x19b5,0x19ab,0x0}},0x95c82},
+{{{0x19b6,0x1980,0x0}},0x92bc2},
+{{{0x19b6,0x1981,0x0}},0x92ce2},
+{{{0x19b6,0x1982,0x0}},0x92e02},
+{{{0x19b6,0x1983,0x0}},0x92f22},
+{{{0x19b6,0x1984,0x0}},0x93042},
+{{{0x19b6,0x1985,0x0}},0x93162},
+{{{0x19b6,0x1986,0x0}},0x93282},
+{{{0x19b6,0x1987,0x0}},0x933a2},
+{{{0x19b6,0x1988,0x0}},0x934c2},
+{{{0x19b6,0x1989,0x0}},0x935e2},
+{{{0x19b6,0x198a,0x0}},0x93702},
+{{{0x19b6,0x198b,0x0}},0x93822},
+{{{0x19b6,0x198c,0x0}},0x93942},
+{{{0x19b6,0x198d,0x0}},0x93a62},
+{{{0x19b6,0x198e,0x0}},0x93b82},
+{{{0x19b6,0x198f,0x0}},0x93ca2},
+{{{0x19b6,0x1990,0x0}},0x93dc2},
+{{{0x19b6,0x1991,0x0}},0x93ee2},
+{{{0x19b6,0x1992,0x0}},0x94002},
+{{{0x19b6,0x1993,0x0}},0x94122},
+{{{0x19b6,0x1994,0x0}},0x94242},
+{{{0x19b6,0x1995,0x0}},0x94362},
+{{{0x19b6,0x1996,0x0}},0x94482},
+{{{0x19b6,0x1997,0x0}},0x945a2},
+{{{0x19b6,0x1998,0x0}},0x946c2},
+{{{0x19b6,0x1999,0x0}},0x947e2},
+{{{0x19b6,0x199a,0x0}},0x94902},
+{{{0x19b6,0x199b,0x0}},0x94a22},
+{{{0x19b6,0x199c,0x0}},0x94b42},
+{{{0x19b6,0x199d,0x0}},0x94d02},
+{{{0x19b6,0x199e,0x0}},0x94e22},
+{{{0x19b6,0x199f,0x0}},0x94f42},
+{{{0x19b6,0x19a0,0x0}},0x95062},
+{{{0x19b6,0x19a1,0x0}},0x95182},
+{{{0x19b6,0x19a2,0x0}},0x952a2},
+{{{0x19b6,0x19a3,0x0}},0x953c2},
+{{{0x19b6,0x19a4,0x0}},0x954e2},
+{{{0x19b6,0x19a5,0x0}},0x95602},
+{{{0x19b6,0x19a6,0x0}},0x95722},
+{{{0x19b6,0x19a7,0x0}},0x95842},
+{{{0x19b6,0x19a8,0x0}},0x95962},
+{{{0x19b6,0x19a9,0x0}},0x95a82},
+{{{0x19b6,0x19aa,0x0}},0x95ba2},
+{{{0x19b6,0x19ab,0x0}},0x95cc2},
+{{{0x19b7,0x1980,0x0}},0x92c02},
+{{{0x19b7,0x1981,0x0}},0x92d22},
+{{{0x19b7,0x1982,0x0}},0x92e42},
+{{{0x19b7,0x1983,0x0}},0x92f62},
+{{{0x19b7,0x1984,0x0}},0x93082},
+{{{0x19b7,0x1985,0x0}},0x931a2},
+{{{0x19b7,0x1986,0x0}},0x932c2},
+{{{0x19b7,0x1987,0x0}},0x933e2},
+{{{0x19b7,0x1988,0x0}},0x93502},
+{{{0x19b7,0x1989,0x0}},0x93622},
+{{{0x19b7,0x198a,0x0}},0x93742},
+{{{0x19b7,0x198b,0x0}},0x93862},
+{{{0x19b7,0x198c,0x0}},0x93982},
+{{{0x19b7,0x198d,0x0}},0x93aa2},
+{{{0x19b7,0x198e,0x0}},0x93bc2},
+{{{0x19b7,0x198f,0x0}},0x93ce2},
+{{{0x19b7,0x1990,0x0}},0x93e02},
+{{{0x19b7,0x1991,0x0}},0x93f22},
+{{{0x19b7,0x1992,0x0}},0x94042},
+{{{0x19b7,0x1993,0x0}},0x94162},
+{{{0x19b7,0x1994,0x0}},0x94282},
+{{{0x19b7,0x1995,0x0}},0x943a2},
+{{{0x19b7,0x1996,0x0}},0x944c2},
+{{{0x19b7,0x1997,0x0}},0x945e2},
+{{{0x19b7,0x1998,0x0}},0x94702},
+{{{0x19b7,0x1999,0x0}},0x94822},
+{{{0x19b7,0x199a,0x0}},0x94942},
+{{{0x19b7,0x199b,0x0}},0x94a62},
+{{{0x19b7,0x199c,0x0}},0x94c22},
+{{{0x19b7,0x199d,0x0}},0x94d42},
+{{{0x19b7,0x199e,0x0}},0x94e62},
+{{{0x19b7,0x199f,0x0}},0x94f82},
+{{{0x19b7,0x19a0,0x0}},0x950a2},
+{{{0x19b7,0x19a1,0x0}},0x951c2},
+{{{0x19b7,0x19a2,0x0}},0x952e2},
+{{{0x19b7,0x19a3,0x0}},0x95402},
+{{{0x19b7,0x19a4,0x0}},0x95522},
+{{{0x19b7,0x19a5,0x0}},0x95642},
+{{{0x19b7,0x19a6,0x0}},0x95762},
+{{{0x19b7,0x19a7,0x0}},0x95882},
+{{{0x19b7,0x19a8,0x0}},0x959a2},
+{{{0x19b7,0x19a9,0x0}},0x95ac2},
+{{{0x19b7,0x19aa,0x0}},0x95be2},
+{{{0x19b7,0x19ab,0x0}},0x95d02},
+{{{0x19ba,0x1980,0x0}},0x92c42},
+{{{0x19ba,0x1981,0x0}},0x92d62},
+{{{0x19ba,0x1982,0x0}},0x92e82},
+{{{0x19ba,0x1983,0x0}},0x92fa2},
+{{{0x19ba,0x1984,0x0}},0x930c2},
+{{{0x19ba,0x1985,0x0}},0x931e2},
+{{{0x19ba,0x1986,0x0}},0x93302},
+{{{0x19ba,0x1987,0x0}},0x93422},
+{{{0x19ba,0x1988,0x0}},0x93542},
+{{{0x19ba,0x1989,0x0}},0x93662},
+{{{0x19ba,0x198a,0x0}},0x93782},
+{{{0x19ba,0x198b,0x0}},0x938a2},
+{{{0x19ba,0x198c,0x0}},0x939c2},
+{{{0x19ba,0x198d,0x0}},0x93ae2},
+{{{0x19ba,0x198e,0x0}},0x93c02},
+{{{0x19ba,0x198f,0x0}},0x93d22},
+{{{0x19ba,0x1990,0x0}},0x93e42},
+{{{0x19ba,0x1991,0x0}},0x93f62},
+{{{0x19ba,0x1992,0x0}},0x94082},
+{{{0x19ba,0x1993,0x0}},0x941a2},
+{{{0x19ba,0x1994,0x0}},0x942c2},
+{{{0x19ba,0x1995,0x0}},0x943e2},
+{{{0x19ba,0x1996,0x0}},0x94502},
+{{{0x19ba,0x1997,0x0}},0x94622},
+{{{0x19ba,0x1998,0x0}},0x94742},
+{{{0x19ba,0x1999,0x0}},0x94862},
+{{{0x19ba,0x199a,0x0}},0x94982},
+{{{0x19ba,0x199b,0x0}},0x94aa2},
+{{{0x19ba,0x199c,0x0}},0x94c62},
+{{{0x19ba,0x199d,0x0}},0x94d82},
+{{{0x19ba,0x199e,0x0}},0x94ea2},
+{{{0x19ba,0x199f,0x0}},0x94fc2},
+{{{0x19ba,0x19a0,0x0}},0x950e2},
+{{{0x19ba,0x19a1,0x0}},0x95202},
+{{{0x19ba,0x19a2,0x0}},0x95322},
+{{{0x19ba,0x19a3,0x0}},0x95442},
+{{{0x19ba,0x19a4,0x0}},0x95562},
+{{{0x19ba,0x19a5,0x0}},0x95682},
+{{{0x19ba,0x19a6,0x0}},0x957a2},
+{{{0x19ba,0x19a7,0x0}},0x958c2},
+{{{0x19ba,0x19a8,0x0}},0x959e2},
+{{{0x19ba,0x19a9,0x0}},0x95b02},
+{{{0x19ba,0x19aa,0x0}},0x95c22},
+{{{0x19ba,0x19ab,0x0}},0x95d42},
+{{{0x1b05,0x1b35,0x0}},0x973e1},
+{{{0x1b07,0x1b35,0x0}},0x97421},
+{{{0x1b09,0x1b35,0x0}},0x97461},
+{{{0x1b0b,0x1b35,0x0}},0x974a1},
+{{{0x1b0d,0x1b35,0x0}},0x974e1},
+{{{0x1b11,0x1b35,0x0}},0x97561},
+{{{0x1b3a,0x1b35,0x0}},0x97b41},
+{{{0x1b3c,0x1b35,0x0}},0x97b81},
+{{{0x1b3e,0x1b35,0x0}},0x97be1},
+{{{0x1b3f,0x1b35,0x0}},0x97c01},
+{{{0x1b42,0x1b35,0x0}},0x97c41},
+{{{0xaab5,0xaa80,0x0}},0x87c82},
+{{{0xaab5,0xaa81,0x0}},0x87de2},
+{{{0xaab5,0xaa82,0x0}},0x87f42},
+{{{0xaab5,0xaa83,0x0}},0x880a2},
+{{{0xaab5,0xaa84,0x0}},0x88202},
+{{{0xaab5,0xaa85,0x0}},0x88362},
+{{{0xaab5,0xaa86,0x0}},0x884c2},
+{{{0xaab5,0xaa87,0x0}},0x88622},
+{{{0xaab5,0xaa88,0x0}},0x88782},
+{{{0xaab5,0xaa89,0x0}},0x888e2},
+{{{0xaab5,0xaa8a,0x0}},0x88a42},
+{{{0xaab5,0xaa8b,0x0}},0x88ba2},
+{{{0xaab5,0xaa8c,0x0}},0x88d02},
+{{{0xaab5,0xaa8d,0x0}},0x88e62},
+{{{0xaab5,0xaa8e,0x0}},0x88fc2},
+{{{0xaab5,0xaa8f,0x0}},0x89122},
+{{{0xaab5,0xaa90,0x0}},0x89282},
+{{{0xaab5,0xaa91,0x0}},0x893e2},
+{{{0xaab5,0xaa92,0x0}},0x89542},
+{{{0xaab5,0xaa93,0x0}},0x896a2},
+{{{0xaab5,0xaa94,0x0}},0x89802},
+{{{0xaab5,0xaa95,0x0}},0x89962},
+{{{0xaab5,0xaa96,0x0}},0x89ac2},
+{{{0xaab5,0xaa97,0x0}},0x89c22},
+{{{0xaab5,0xaa98,0x0}},0x89d82},
+{{{0xaab5,0xaa99,0x0}},0x89ee2},
+{{{0xaab5,0xaa9a,0x0}},0x8a042},
+{{{0xaab5,0xaa9b,0x0}},0x8a1a2},
+{{{0xaab5,0xaa9c,0x0}},0x8a302},
+{{{0xaab5,0xaa9d,0x0}},0x8a462},
+{{{0xaab5,0xaa9e,0x0}},0x8a5c2},
+{{{0xaab5,0xaa9f,0x0}},0x8a722},
+{{{0xaab5,0xaaa0,0x0}},0x8a882},
+{{{0xaab5,0xaaa1,0x0}},0x8a9e2},
+{{{0xaab5,0xaaa2,0x0}},0x8ab42},
+{{{0xaab5,0xaaa3,0x0}},0x8aca2},
+{{{0xaab5,0xaaa4,0x0}},0x8ae02},
+{{{0xaab5,0xaaa5,0x0}},0x8af62},
+{{{0xaab5,0xaaa6,0x0}},0x8b0c2},
+{{{0xaab5,0xaaa7,0x0}},0x8b222},
+{{{0xaab5,0xaaa8,0x0}},0x8b382},
+{{{0xaab5,0xaaa9,0x0}},0x8b4e2},
+{{{0xaab5,0xaaaa,0x0}},0x8b642},
+{{{0xaab5,0xaaab,0x0}},0x8b7a2},
+{{{0xaab5,0xaaac,0x0}},0x8b902},
+{{{0xaab5,0xaaad,0x0}},0x8ba62},
+{{{0xaab5,0xaaae,0x0}},0x8bbc2},
+{{{0xaab5,0xaaaf,0x0}},0x8bd22},
+{{{0xaab6,0xaa80,0x0}},0x87cc2},
+{{{0xaab6,0xaa81,0x0}},0x87e22},
+{{{0xaab6,0xaa82,0x0}},0x87f82},
+{{{0xaab6,0xaa83,0x0}},0x880e2},
+{{{0xaab6,0xaa84,0x0}},0x88242},
+{{{0xaab6,0xaa85,0x0}},0x883a2},
+{{{0xaab6,0xaa86,0x0}},0x88502},
+{{{0xaab6,0xaa87,0x0}},0x88662},
+{{{0xaab6,0xaa88,0x0}},0x887c2},
+{{{0xaab6,0xaa89,0x0}},0x88922},
+{{{0xaab6,0xaa8a,0x0}},0x88a82},
+{{{0xaab6,0xaa8b,0x0}},0x88be2},
+{{{0xaab6,0xaa8c,0x0}},0x88d42},
+{{{0xaab6,0xaa8d,0x0}},0x88ea2},
+{{{0xaab6,0xaa8e,0x0}},0x89002},
+{{{0xaab6,0xaa8f,0x0}},0x89162},
+{{{0xaab6,0xaa90,0x0}},0x892c2},
+{{{0xaab6,0xaa91,0x0}},0x89422},
+{{{0xaab6,0xaa92,0x0}},0x89582},
+{{{0xaab6,0xaa93,0x0}},0x896e2},
+{{{0xaab6,0xaa94,0x0}},0x89842},
+{{{0xaab6,0xaa95,0x0}},0x899a2},
+{{{0xaab6,0xaa96,0x0}},0x89b02},
+{{{0xaab6,0xaa97,0x0}},0x89c62},
+{{{0xaab6,0xaa98,0x0}},0x89dc2},
+{{{0xaab6,0xaa99,0x0}},0x89f22},
+{{{0xaab6,0xaa9a,0x0}},0x8a082},
+{{{0xaab6,0xaa9b,0x0}},0x8a1e2},
+{{{0xaab6,0xaa9c,0x0}},0x8a342},
+{{{0xaab6,0xaa9d,0x0}},0x8a4a2},
+{{{0xaab6,0xaa9e,0x0}},0x8a602},
+{{{0xaab6,0xaa9f,0x0}},0x8a762},
+{{{0xaab6,0xaaa0,0x0}},0x8a8c2},
+{{{0xaab6,0xaaa1,0x0}},0x8aa22},
+{{{0xaab6,0xaaa2,0x0}},0x8ab82},
+{{{0xaab6,0xaaa3,0x0}},0x8ace2},
+{{{0xaab6,0xaaa4,0x0}},0x8ae42},
+{{{0xaab6,0xaaa5,0x0}},0x8afa2},
+{{{0xaab6,0xaaa6,0x0}},0x8b102},
+{{{0xaab6,0xaaa7,0x0}},0x8b262},
+{{{0xaab6,0xaaa8,0x0}},0x8b3c2},
+{{{0xaab6,0xaaa9,0x0}},0x8b522},
+{{{0xaab6,0xaaaa,0x0}},0x8b682},
+{{{0xaab6,0xaaab,0x0}},0x8b7e2},
+{{{0xaab6,0xaaac,0x0}},0x8b942},
+{{{0xaab6,0xaaad,0x0}},0x8baa2},
+{{{0xaab6,0xaaae,0x0}},0x8bc02},
+{{{0xaab6,0xaaaf,0x0}},0x8bd62},
+{{{0xaab9,0xaa80,0x0}},0x87d02},
+{{{0xaab9,0xaa81,0x0}},0x87e62},
+{{{0xaab9,0xaa82,0x0}},0x87fc2},
+{{{0xaab9,0xaa83,0x0}},0x88122},
+{{{0xaab9,0xaa84,0x0}},0x88282},
+{{{0xaab9,0xaa85,0x0}},0x883e2},
+{{{0xaab9,0xaa86,0x0}},0x88542},
+{{{0xaab9,0xaa87,0x0}},0x886a2},
+{{{0xaab9,0xaa88,0x0}},0x88802},
+{{{0xaab9,0xaa89,0x0}},0x88962},
+{{{0xaab9,0xaa8a,0x0}},0x88ac2},
+{{{0xaab9,0xaa8b,0x0}},0x88c22},
+{{{0xaab9,0xaa8c,0x0}},0x88d82},
+{{{0xaab9,0xaa8d,0x0}},0x88ee2},
+{{{0xaab9,0xaa8e,0x0}},0x89042},
+{{{0xaab9,0xaa8f,0x0}},0x891a2},
+{{{0xaab9,0xaa90,0x0}},0x89302},
+{{{0xaab9,0xaa91,0x0}},0x89462},
+{{{0xaab9,0xaa92,0x0}},0x895c2},
+{{{0xaab9,0xaa93,0x0}},0x89722},
+{{{0xaab9,0xaa94,0x0}},0x89882},
+{{{0xaab9,0xaa95,0x0}},0x899e2},
+{{{0xaab9,0xaa96,0x0}},0x89b42},
+{{{0xaab9,0xaa97,0x0}},0x89ca2},
+{{{0xaab9,0xaa98,0x0}},0x89e02},
+{{{0xaab9,0xaa99,0x0}},0x89f62},
+{{{0xaab9,0xaa9a,0x0}},0x8a0c2},
+{{{0xaab9,0xaa9b,0x0}},0x8a222},
+{{{0xaab9,0xaa9c,0x0}},0x8a382},
+{{{0xaab9,0xaa9d,0x0}},0x8a4e2},
+{{{0xaab9,0xaa9e,0x0}},0x8a642},
+{{{0xaab9,0xaa9f,0x0}},0x8a7a2},
+{{{0xaab9,0xaaa0,0x0}},0x8a902},
+{{{0xaab9,0xaaa1,0x0}},0x8aa62},
+{{{0xaab9,0xaaa2,0x0}},0x8abc2},
+{{{0xaab9,0xaaa3,0x0}},0x8ad22},
+{{{0xaab9,0xaaa4,0x0}},0x8ae82},
+{{{0xaab9,0xaaa5,0x0}},0x8afe2},
+{{{0xaab9,0xaaa6,0x0}},0x8b142},
+{{{0xaab9,0xaaa7,0x0}},0x8b2a2},
+{{{0xaab9,0xaaa8,0x0}},0x8b402},
+{{{0xaab9,0xaaa9,0x0}},0x8b562},
+{{{0xaab9,0xaaaa,0x0}},0x8b6c2},
+{{{0xaab9,0xaaab,0x0}},0x8b822},
+{{{0xaab9,0xaaac,0x0}},0x8b982},
+{{{0xaab9,0xaaad,0x0}},0x8bae2},
+{{{0xaab9,0xaaae,0x0}},0x8bc42},
+{{{0xaab9,0xaaaf,0x0}},0x8bda2},
+{{{0xaabb,0xaa80,0x0}},0x87d42},
+{{{0xaabb,0xaa81,0x0}},0x87ea2},
+{{{0xaabb,0xaa82,0x0}},0x88002},
+{{{0xaabb,0xaa83,0x0}},0x88162},
+{{{0xaabb,0xaa84,0x0}},0x882c2},
+{{{0xaabb,0xaa85,0x0}},0x88422},
+{{{0xaabb,0xaa86,0x0}},0x88582},
+{{{0xaabb,0xaa87,0x0}},0x886e2},
+{{{0xaabb,0xaa88,0x0}},0x88842},
+{{{0xaabb,0xaa89,0x0}},0x889a2},
+{{{0xaabb,0xaa8a,0x0}},0x88b02},
+{{{0xaabb,0xaa8b,0x0}},0x88c62},
+{{{0xaabb,0xaa8c,0x0}},0x88dc2},
+{{{0xaabb,0xaa8d,0x0}},0x88f22},
+{{{0xaabb,0xaa8e,0x0}},0x89082},
+{{{0xaabb,0xaa8f,0x0}},0x891e2},
+{{{0xaabb,0xaa90,0x0}},0x89342},
+{{{0xaabb,0xaa91,0x0}},0x894a2},
+{{{0xaabb,0xaa92,0x0}},0x89602},
+{{{0xaabb,0xaa93,0x0}},0x89762},
+{{{0xaabb,0xaa94,0x0}},0x898c2},
+{{{0xaabb,0xaa95,0x0}},0x89a22},
+{{{0xaabb,0xaa96,0x0}},0x89b82},
+{{{0xaabb,0xaa97,0x0}},0x89ce2},
+{{{0xaabb,0xaa98,0x0}},0x89e42},
+{{{0xaabb,0xaa99,0x0}},0x89fa2},
+{{{0xaabb,0xaa9a,0x0}},0x8a102},
+{{{0xaabb,0xaa9b,0x0}},0x8a262},
+{{{0xaabb,0xaa9c,0x0}},0x8a3c2},
+{{{0xaabb,0xaa9d,0x0}},0x8a522},
+{{{0xaabb,0xaa9e,0x0}},0x8a682},
+{{{0xaabb,0xaa9f,0x0}},0x8a7e2},
+{{{0xaabb,0xaaa0,0x0}},0x8a942},
+{{{0xaabb,0xaaa1,0x0}},0x8aaa2},
+{{{0xaabb,0xaaa2,0x0}},0x8ac02},
+{{{0xaabb,0xaaa3,0x0}},0x8ad62},
+{{{0xaabb,0xaaa4,0x0}},0x8aec2},
+{{{0xaabb,0xaaa5,0x0}},0x8b022},
+{{{0xaabb,0xaaa6,0x0}},0x8b182},
+{{{0xaabb,0xaaa7,0x0}},0x8b2e2},
+{{{0xaabb,0xaaa8,0x0}},0x8b442},
+{{{0xaabb,0xaaa9,0x0}},0x8b5a2},
+{{{0xaabb,0xaaaa,0x0}},0x8b702},
+{{{0xaabb,0xaaab,0x0}},0x8b862},
+{{{0xaabb,0xaaac,0x0}},0x8b9c2},
+{{{0xaabb,0xaaad,0x0}},0x8bb22},
+{{{0xaabb,0xaaae,0x0}},0x8bc82},
+{{{0xaabb,0xaaaf,0x0}},0x8bde2},
+{{{0xaabc,0xaa80,0x0}},0x87d82},
+{{{0xaabc,0xaa81,0x0}},0x87ee2},
+{{{0xaabc,0xaa82,0x0}},0x88042},
+{{{0xaabc,0xaa83,0x0}},0x881a2},
+{{{0xaabc,0xaa84,0x0}},0x88302},
+{{{0xaabc,0xaa85,0x0}},0x88462},
+{{{0xaabc,0xaa86,0x0}},0x885c2},
+{{{0xaabc,0xaa87,0x0}},0x88722},
+{{{0xaabc,0xaa88,0x0}},0x88882},
+{{{0xaabc,0xaa89,0x0}},0x889e2},
+{{{0xaabc,0xaa8a,0x0}},0x88b42},
+{{{0xaabc,0xaa8b,0x0}},0x88ca2},
+{{{0xaabc,0xaa8c,0x0}},0x88e02},
+{{{0xaabc,0xaa8d,0x0}},0x88f62},
+{{{0xaabc,0xaa8e,0x0}},0x890c2},
+{{{0xaabc,0xaa8f,0x0}},0x89222},
+{{{0xaabc,0xaa90,0x0}},0x89382},
+{{{0xaabc,0xaa91,0x0}},0x894e2},
+{{{0xaabc,0xaa92,0x0}},0x89642},
+{{{0xaabc,0xaa93,0x0}},0x897a2},
+{{{0xaabc,0xaa94,0x0}},0x89902},
+{{{0xaabc,0xaa95,0x0}},0x89a62},
+{{{0xaabc,0xaa96,0x0}},0x89bc2},
+{{{0xaabc,0xaa97,0x0}},0x89d22},
+{{{0xaabc,0xaa98,0x0}},0x89e82},
+{{{0xaabc,0xaa99,0x0}},0x89fe2},
+{{{0xaabc,0xaa9a,0x0}},0x8a142},
+{{{0xaabc,0xaa9b,0x0}},0x8a2a2},
+{{{0xaabc,0xaa9c,0x0}},0x8a402},
+{{{0xaabc,0xaa9d,0x0}},0x8a562},
+{{{0xaabc,0xaa9e,0x0}},0x8a6c2},
+{{{0xaabc,0xaa9f,0x0}},0x8a822},
+{{{0xaabc,0xaaa0,0x0}},0x8a982},
+{{{0xaabc,0xaaa1,0x0}},0x8aae2},
+{{{0xaabc,0xaaa2,0x0}},0x8ac42},
+{{{0xaabc,0xaaa3,0x0}},0x8ada2},
+{{{0xaabc,0xaaa4,0x0}},0x8af02},
+{{{0xaabc,0xaaa5,0x0}},0x8b062},
+{{{0xaabc,0xaaa6,0x0}},0x8b1c2},
+{{{0xaabc,0xaaa7,0x0}},0x8b322},
+{{{0xaabc,0xaaa8,0x0}},0x8b482},
+{{{0xaabc,0xaaa9,0x0}},0x8b5e2},
+{{{0xaabc,0xaaaa,0x0}},0x8b742},
+{{{0xaabc,0xaaab,0x0}},0x8b8a2},
+{{{0xaabc,0xaaac,0x0}},0x8ba02},
+{{{0xaabc,0xaaad,0x0}},0x8bb62},
+{{{0xaabc,0xaaae,0x0}},0x8bcc2},
+{{{0xaabc,0xaaaf,0x0}},0x8be22},
+{{{0x11131,0x11127,0x0}},0x91d61},
+{{{0x11132,0x11127,0x0}},0x91d81},
+{{{0x11347,0x1133e,0x0}},0x7d261},
+{{{0x11347,0x11357,0x0}},0x7d281},
+{{{0x114b9,0x114b0,0x0}},0x7dae1},
+{{{0x114b9,0x114ba,0x0}},0x7dac1},
+{{{0x114b9,0x114bd,0x0}},0x7db21},
+{{{0x115b8,0x115af,0x0}},0x7e3e1},
+{{{0x115b9,0x115af,0x0}},0x7e401},
+};
+
+const TableView<std::array<char32_t, 3>, char32_t> collation_multiple_table {std::begin(collation_multiple_array), std::end(collation_multiple_array)};
+
+std::array<char32_t, 4> const collation_implicit_array[] {
+{{0x17000,0x18aff,0xfb00,0x17000}},
+{{0x18b00,0x18cff,0xfb02,0x18b00}},
+{{0x18d00,0x18d8f,0xfb00,0x17000}},
+{{0x1b170,0x1b2ff,0xfb01,0x1b170}},
+};
+
+const Irange<std::array<char32_t, 4> const*> collation_implicit_table {std::begin(collation_implicit_array), std::end(collation_implicit_array)};
+
+const KeyValue<char32_t, char32_t> unified_ideograph_array[] {
+{0x3400,0x4db5},
+{0x4e00,0x9fd5},
+{0xfa0e,0xfa0f},
+{0xfa11,0xfa11},
+{0xfa13,0xfa14},
+{0xfa1f,0xfa1f},
+{0xfa21,0xfa21},
+{0xfa23,0xfa24},
+{0xfa27,0xfa29},
+{0x20000,0x2a6d6},
+{0x2a700,0x2b734},
+{0x2b740,0x2b81d},
+{0x2b820,0x2cea1},
+};
+
+const TableView<char32_t, char32_t> unified_ideograph_table {std::begin(unified_ideograph_array), std::end(unified_ideograph_array)};
+
+}
+}
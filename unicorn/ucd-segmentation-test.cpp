@@ -2412,5 +2412,6643 @@ char const* const sentence_break_test_array[] {
 
 const Irange<char const* const*> sentence_break_test_table {std::begin(sentence_break_test_array), std::end(sentence_break_test_array)};
 
+char const* const line_break_test_array[] {
+/*1*/ "00A7 00A7",
+/*2*/ "00A7 0020/00A7",
+/*3*/ "00A7 0300 00A7",
+/*4*/ "00A7 0300 0020/00A7",
+/*5*/ "00A7 0023",
+/*6*/ "00A7 0020/0023",
+/*7*/ "00A7 0300 0023",
+/*8*/ "00A7 0300 0020/0023",
+/*9*/ "00A7/2014",
+/*10*/ "00A7 0020/2014",
+/*11*/ "00A7 0300/2014",
+/*12*/ "00A7 0300 0020/2014",
+/*13*/ "00A7 007C",
+/*14*/ "00A7 0020/007C",
+/*15*/ "00A7 0300 007C",
+/*16*/ "00A7 0300 0020/007C",
+/*17*/ "00A7/00B4",
+/*18*/ "00A7 0020/00B4",
+/*19*/ "00A7 0300/00B4",
+/*20*/ "00A7 0300 0020/00B4",
+/*21*/ "00A7 2028",
+/*22*/ "00A7 0020 2028",
+/*23*/ "00A7 0300 2028",
+/*24*/ "00A7 0300 0020 2028",
+/*25*/ "00A7/FFFC",
+/*26*/ "00A7 0020/FFFC",
+/*27*/ "00A7 0300/FFFC",
+/*28*/ "00A7 0300 0020/FFFC",
+/*29*/ "00A7 3041",
+/*30*/ "00A7 0020/3041",
+/*31*/ "00A7 0300 3041",
+/*32*/ "00A7 0300 0020/3041",
+/*33*/ "00A7 007D",
+/*34*/ "00A7 0020 007D",
+/*35*/ "00A7 0300 007D",
+/*36*/ "00A7 0300 0020 007D",
+/*37*/ "00A7 0300",
+/*38*/ "00A7 0020/0300",
+/*39*/ "00A7 0300 0300",
+/*40*/ "00A7 0300 0020/0300",
+/*41*/ "00A7 0029",
+/*42*/ "00A7 0020 0029",
+/*43*/ "00A7 0300 0029",
+/*44*/ "00A7 0300 0020 0029",
+/*45*/ "00A7 000D",
+/*46*/ "00A7 0020 000D",
+/*47*/ "00A7 0300 000D",
+/*48*/ "00A7 0300 0020 000D",
+/*49*/ "00A7 0021",
+/*50*/ "00A7 0020 0021",
+/*51*/ "00A7 0300 0021",
+/*52*/ "00A7 0300 0020 0021",
+/*53*/ "00A7 00A0",
+/*54*/ "00A7 0020/00A0",
+/*55*/ "00A7 0300 00A0",
+/*56*/ "00A7 0300 0020/00A0",
+/*57*/ "00A7/AC00",
+/*58*/ "00A7 0020/AC00",
+/*59*/ "00A7 0300/AC00",
+/*60*/ "00A7 0300 0020/AC00",
+/*61*/ "00A7/AC01",
+/*62*/ "00A7 0020/AC01",
+/*63*/ "00A7 0300/AC01",
+/*64*/ "00A7 0300 0020/AC01",
+/*65*/ "00A7 05D0",
+/*66*/ "00A7 0020/05D0",
+/*67*/ "00A7 0300 05D0",
+/*68*/ "00A7 0300 0020/05D0",
+/*69*/ "00A7 002D",
+/*70*/ "00A7 0020/002D",
+/*71*/ "00A7 0300 002D",
+/*72*/ "00A7 0300 0020/002D",
+/*73*/ "00A7/231A",
+/*74*/ "00A7 0020/231A",
+/*75*/ "00A7 0300/231A",
+/*76*/ "00A7 0300 0020/231A",
+/*77*/ "00A7 2024",
+/*78*/ "00A7 0020/2024",
+/*79*/ "00A7 0300 2024",
+/*80*/ "00A7 0300 0020/2024",
+/*81*/ "00A7 002C",
+/*82*/ "00A7 0020 002C",
+/*83*/ "00A7 0300 002C",
+/*84*/ "00A7 0300 0020 002C",
+/*85*/ "00A7/1100",
+/*86*/ "00A7 0020/1100",
+/*87*/ "00A7 0300/1100",
+/*88*/ "00A7 0300 0020/1100",
+/*89*/ "00A7/11A8",
+/*90*/ "00A7 0020/11A8",
+/*91*/ "00A7 0300/11A8",
+/*92*/ "00A7 0300 0020/11A8",
+/*93*/ "00A7/1160",
+/*94*/ "00A7 0020/1160",
+/*95*/ "00A7 0300/1160",
+/*96*/ "00A7 0300 0020/1160",
+/*97*/ "00A7 000A",
+/*98*/ "00A7 0020 000A",
+/*99*/ "00A7 0300 000A",
+/*100*/ "00A7 0300 0020 000A",
+/*101*/ "00A7 0085",
+/*102*/ "00A7 0020 0085",
+/*103*/ "00A7 0300 0085",
+/*104*/ "00A7 0300 0020 0085",
+/*105*/ "00A7 17D6",
+/*106*/ "00A7 0020/17D6",
+/*107*/ "00A7 0300 17D6",
+/*108*/ "00A7 0300 0020/17D6",
+/*109*/ "00A7 0030",
+/*110*/ "00A7 0020/0030",
+/*111*/ "00A7 0300 0030",
+/*112*/ "00A7 0300 0020/0030",
+/*113*/ "00A7 0028",
+/*114*/ "00A7 0020/0028",
+/*115*/ "00A7 0300 0028",
+/*116*/ "00A7 0300 0020/0028",
+/*117*/ "00A7/0025",
+/*118*/ "00A7 0020/0025",
+/*119*/ "00A7 0300/0025",
+/*120*/ "00A7 0300 0020/0025",
+/*121*/ "00A7/0024",
+/*122*/ "00A7 0020/0024",
+/*123*/ "00A7 0300/0024",
+/*124*/ "00A7 0300 0020/0024",
+/*125*/ "00A7 0022",
+/*126*/ "00A7 0020/0022",
+/*127*/ "00A7 0300 0022",
+/*128*/ "00A7 0300 0020/0022",
+/*129*/ "00A7/1F1E6",
+/*130*/ "00A7 0020/1F1E6",
+/*131*/ "00A7 0300/1F1E6",
+/*132*/ "00A7 0300 0020/1F1E6",
+/*133*/ "00A7 0E01",
+/*134*/ "00A7 0020/0E01",
+/*135*/ "00A7 0300 0E01",
+/*136*/ "00A7 0300 0020/0E01",
+/*137*/ "00A7 0E31",
+/*138*/ "00A7 0020/0E31",
+/*139*/ "00A7 0300 0E31",
+/*140*/ "00A7 0300 0020/0E31",
+/*141*/ "00A7 0020",
+/*142*/ "00A7 0020 0020",
+/*143*/ "00A7 0300 0020",
+/*144*/ "00A7 0300 0020 0020",
+/*145*/ "00A7 002F",
+/*146*/ "00A7 0020 002F",
+/*147*/ "00A7 0300 002F",
+/*148*/ "00A7 0300 0020 002F",
+/*149*/ "00A7 2060",
+/*150*/ "00A7 0020 2060",
+/*151*/ "00A7 0300 2060",
+/*152*/ "00A7 0300 0020 2060",
+/*153*/ "00A7 200B",
+/*154*/ "00A7 0020 200B",
+/*155*/ "00A7 0300 200B",
+/*156*/ "00A7 0300 0020 200B",
+/*157*/ "0023 00A7",
+/*158*/ "0023 0020/00A7",
+/*159*/ "0023 0300 00A7",
+/*160*/ "0023 0300 0020/00A7",
+/*161*/ "0023 0023",
+/*162*/ "0023 0020/0023",
+/*163*/ "0023 0300 0023",
+/*164*/ "0023 0300 0020/0023",
+/*165*/ "0023/2014",
+/*166*/ "0023 0020/2014",
+/*167*/ "0023 0300/2014",
+/*168*/ "0023 0300 0020/2014",
+/*169*/ "0023 007C",
+/*170*/ "0023 0020/007C",
+/*171*/ "0023 0300 007C",
+/*172*/ "0023 0300 0020/007C",
+/*173*/ "0023/00B4",
+/*174*/ "0023 0020/00B4",
+/*175*/ "0023 0300/00B4",
+/*176*/ "0023 0300 0020/00B4",
+/*177*/ "0023 2028",
+/*178*/ "0023 0020 2028",
+/*179*/ "0023 0300 2028",
+/*180*/ "0023 0300 0020 2028",
+/*181*/ "0023/FFFC",
+/*182*/ "0023 0020/FFFC",
+/*183*/ "0023 0300/FFFC",
+/*184*/ "0023 0300 0020/FFFC",
+/*185*/ "0023 3041",
+/*186*/ "0023 0020/3041",
+/*187*/ "0023 0300 3041",
+/*188*/ "0023 0300 0020/3041",
+/*189*/ "0023 007D",
+/*190*/ "0023 0020 007D",
+/*191*/ "0023 0300 007D",
+/*192*/ "0023 0300 0020 007D",
+/*193*/ "0023 0300",
+/*194*/ "0023 0020/0300",
+/*195*/ "0023 0300 0300",
+/*196*/ "0023 0300 0020/0300",
+/*197*/ "0023 0029",
+/*198*/ "0023 0020 0029",
+/*199*/ "0023 0300 0029",
+/*200*/ "0023 0300 0020 0029",
+/*201*/ "0023 000D",
+/*202*/ "0023 0020 000D",
+/*203*/ "0023 0300 000D",
+/*204*/ "0023 0300 0020 000D",
+/*205*/ "0023 0021",
+/*206*/ "0023 0020 0021",
+/*207*/ "0023 0300 0021",
+/*208*/ "0023 0300 0020 0021",
+/*209*/ "0023 00A0",
+/*210*/ "0023 0020/00A0",
+/*211*/ "0023 0300 00A0",
+/*212*/ "0023 0300 0020/00A0",
+/*213*/ "0023/AC00",
+/*214*/ "0023 0020/AC00",
+/*215*/ "0023 0300/AC00",
+/*216*/ "0023 0300 0020/AC00",
+/*217*/ "0023/AC01",
+/*218*/ "0023 0020/AC01",
+/*219*/ "0023 0300/AC01",
+/*220*/ "0023 0300 0020/AC01",
+/*221*/ "0023 05D0",
+/*222*/ "0023 0020/05D0",
+/*223*/ "0023 0300 05D0",
+/*224*/ "0023 0300 0020/05D0",
+/*225*/ "0023 002D",
+/*226*/ "0023 0020/002D",
+/*227*/ "0023 0300 002D",
+/*228*/ "0023 0300 0020/002D",
+/*229*/ "0023/231A",
+/*230*/ "0023 0020/231A",
+/*231*/ "0023 0300/231A",
+/*232*/ "0023 0300 0020/231A",
+/*233*/ "0023 2024",
+/*234*/ "0023 0020/2024",
+/*235*/ "0023 0300 2024",
+/*236*/ "0023 0300 0020/2024",
+/*237*/ "0023 002C",
+/*238*/ "0023 0020 002C",
+/*239*/ "0023 0300 002C",
+/*240*/ "0023 0300 0020 002C",
+/*241*/ "0023/1100",
+/*242*/ "0023 0020/1100",
+/*243*/ "0023 0300/1100",
+/*244*/ "0023 0300 0020/1100",
+/*245*/ "0023/11A8",
+/*246*/ "0023 0020/11A8",
+/*247*/ "0023 0300/11A8",
+/*248*/ "0023 0300 0020/11A8",
+/*249*/ "0023/1160",
+/*250*/ "0023 0020/1160",
+/*251*/ "0023 0300/1160",
+/*252*/ "0023 0300 0020/1160",
+/*253*/ "0023 000A",
+/*254*/ "0023 0020 000A",
+/*255*/ "0023 0300 000A",
+/*256*/ "0023 0300 0020 000A",
+/*257*/ "0023 0085",
+/*258*/ "0023 0020 0085",
+/*259*/ "0023 0300 0085",
+/*260*/ "0023 0300 0020 0085",
+/*261*/ "0023 17D6",
+/*262*/ "0023 0020/17D6",
+/*263*/ "0023 0300 17D6",
+/*264*/ "0023 0300 0020/17D6",
+/*265*/ "0023 0030",
+/*266*/ "0023 0020/0030",
+/*267*/ "0023 0300 0030",
+/*268*/ "0023 0300 0020/0030",
+/*269*/ "0023 0028",
+/*270*/ "0023 0020/0028",
+/*271*/ "0023 0300 0028",
+/*272*/ "0023 0300 0020/0028",
+/*273*/ "0023/0025",
+/*274*/ "0023 0020/0025",
+/*275*/ "0023 0300/0025",
+/*276*/ "0023 0300 0020/0025",
+/*277*/ "0023/0024",
+/*278*/ "0023 0020/0024",
+/*279*/ "0023 0300/0024",
+/*280*/ "0023 0300 0020/0024",
+/*281*/ "0023 0022",
+/*282*/ "0023 0020/0022",
+/*283*/ "0023 0300 0022",
+/*284*/ "0023 0300 0020/0022",
+/*285*/ "0023/1F1E6",
+/*286*/ "0023 0020/1F1E6",
+/*287*/ "0023 0300/1F1E6",
+/*288*/ "0023 0300 0020/1F1E6",
+/*289*/ "0023 0E01",
+/*290*/ "0023 0020/0E01",
+/*291*/ "0023 0300 0E01",
+/*292*/ "0023 0300 0020/0E01",
+/*293*/ "0023 0E31",
+/*294*/ "0023 0020/0E31",
+/*295*/ "0023 0300 0E31",
+/*296*/ "0023 0300 0020/0E31",
+/*297*/ "0023 0020",
+/*298*/ "0023 0020 0020",
+/*299*/ "0023 0300 0020",
+/*300*/ "0023 0300 0020 0020",
+/*301*/ "0023 002F",
+/*302*/ "0023 0020 002F",
+/*303*/ "0023 0300 002F",
+/*304*/ "0023 0300 0020 002F",
+/*305*/ "0023 2060",
+/*306*/ "0023 0020 2060",
+/*307*/ "0023 0300 2060",
+/*308*/ "0023 0300 0020 2060",
+/*309*/ "0023 200B",
+/*310*/ "0023 0020 200B",
+/*311*/ "0023 0300 200B",
+/*312*/ "0023 0300 0020 200B",
+/*313*/ "2014/00A7",
+/*314*/ "2014 0020/00A7",
+/*315*/ "2014 0300/00A7",
+/*316*/ "2014 0300 0020/00A7",
+/*317*/ "2014/0023",
+/*318*/ "2014 0020/0023",
+/*319*/ "2014 0300/0023",
+/*320*/ "2014 0300 0020/0023",
+/*321*/ "2014 2014",
+/*322*/ "2014 0020 2014",
+/*323*/ "2014 0300 2014",
+/*324*/ "2014 0300 0020 2014",
+/*325*/ "2014 007C",
+/*326*/ "2014 0020/007C",
+/*327*/ "2014 0300 007C",
+/*328*/ "2014 0300 0020/007C",
+/*329*/ "2014/00B4",
+/*330*/ "2014 0020/00B4",
+/*331*/ "2014 0300/00B4",
+/*332*/ "2014 0300 0020/00B4",
+/*333*/ "2014 2028",
+/*334*/ "2014 0020 2028",
+/*335*/ "2014 0300 2028",
+/*336*/ "2014 0300 0020 2028",
+/*337*/ "2014/FFFC",
+/*338*/ "2014 0020/FFFC",
+/*339*/ "2014 0300/FFFC",
+/*340*/ "2014 0300 0020/FFFC",
+/*341*/ "2014 3041",
+/*342*/ "2014 0020/3041",
+/*343*/ "2014 0300 3041",
+/*344*/ "2014 0300 0020/3041",
+/*345*/ "2014 007D",
+/*346*/ "2014 0020 007D",
+/*347*/ "2014 0300 007D",
+/*348*/ "2014 0300 0020 007D",
+/*349*/ "2014 0300",
+/*350*/ "2014 0020/0300",
+/*351*/ "2014 0300 0300",
+/*352*/ "2014 0300 0020/0300",
+/*353*/ "2014 0029",
+/*354*/ "2014 0020 0029",
+/*355*/ "2014 0300 0029",
+/*356*/ "2014 0300 0020 0029",
+/*357*/ "2014 000D",
+/*358*/ "2014 0020 000D",
+/*359*/ "2014 0300 000D",
+/*360*/ "2014 0300 0020 000D",
+/*361*/ "2014 0021",
+/*362*/ "2014 0020 0021",
+/*363*/ "2014 0300 0021",
+/*364*/ "2014 0300 0020 0021",
+/*365*/ "2014 00A0",
+/*366*/ "2014 0020/00A0",
+/*367*/ "2014 0300 00A0",
+/*368*/ "2014 0300 0020/00A0",
+/*369*/ "2014/AC00",
+/*370*/ "2014 0020/AC00",
+/*371*/ "2014 0300/AC00",
+/*372*/ "2014 0300 0020/AC00",
+/*373*/ "2014/AC01",
+/*374*/ "2014 0020/AC01",
+/*375*/ "2014 0300/AC01",
+/*376*/ "2014 0300 0020/AC01",
+/*377*/ "2014/05D0",
+/*378*/ "2014 0020/05D0",
+/*379*/ "2014 0300/05D0",
+/*380*/ "2014 0300 0020/05D0",
+/*381*/ "2014 002D",
+/*382*/ "2014 0020/002D",
+/*383*/ "2014 0300 002D",
+/*384*/ "2014 0300 0020/002D",
+/*385*/ "2014/231A",
+/*386*/ "2014 0020/231A",
+/*387*/ "2014 0300/231A",
+/*388*/ "2014 0300 0020/231A",
+/*389*/ "2014/2024",
+/*390*/ "2014 0020/2024",
+/*391*/ "2014 0300/2024",
+/*392*/ "2014 0300 0020/2024",
+/*393*/ "2014 002C",
+/*394*/ "2014 0020 002C",
+/*395*/ "2014 0300 002C",
+/*396*/ "2014 0300 0020 002C",
+/*397*/ "2014/1100",
+/*398*/ "2014 0020/1100",
+/*399*/ "2014 0300/1100",
+/*400*/ "2014 0300 0020/1100",
+/*401*/ "2014/11A8",
+/*402*/ "2014 0020/11A8",
+/*403*/ "2014 0300/11A8",
+/*404*/ "2014 0300 0020/11A8",
+/*405*/ "2014/1160",
+/*406*/ "2014 0020/1160",
+/*407*/ "2014 0300/1160",
+/*408*/ "2014 0300 0020/1160",
+/*409*/ "2014 000A",
+/*410*/ "2014 0020 000A",
+/*411*/ "2014 0300 000A",
+/*412*/ "2014 0300 0020 000A",
+/*413*/ "2014 0085",
+/*414*/ "2014 0020 0085",
+/*415*/ "2014 0300 0085",
+/*416*/ "2014 0300 0020 0085",
+/*417*/ "2014 17D6",
+/*418*/ "2014 0020/17D6",
+/*419*/ "2014 0300 17D6",
+/*420*/ "2014 0300 0020/17D6",
+/*421*/ "2014/0030",
+/*422*/ "2014 0020/0030",
+/*423*/ "2014 0300/0030",
+/*424*/ "2014 0300 0020/0030",
+/*425*/ "2014/0028",
+/*426*/ "2014 0020/0028",
+/*427*/ "2014 0300/0028",
+/*428*/ "2014 0300 0020/0028",
+/*429*/ "2014/0025",
+/*430*/ "2014 0020/0025",
+/*431*/ "2014 0300/0025",
+/*432*/ "2014 0300 0020/0025",
+/*433*/ "2014/0024",
+/*434*/ "2014 0020/0024",
+/*435*/ "2014 0300/0024",
+/*436*/ "2014 0300 0020/0024",
+/*437*/ "2014 0022",
+/*438*/ "2014 0020/0022",
+/*439*/ "2014 0300 0022",
+/*440*/ "2014 0300 0020/0022",
+/*441*/ "2014/1F1E6",
+/*442*/ "2014 0020/1F1E6",
+/*443*/ "2014 0300/1F1E6",
+/*444*/ "2014 0300 0020/1F1E6",
+/*445*/ "2014/0E01",
+/*446*/ "2014 0020/0E01",
+/*447*/ "2014 0300/0E01",
+/*448*/ "2014 0300 0020/0E01",
+/*449*/ "2014 0E31",
+/*450*/ "2014 0020/0E31",
+/*451*/ "2014 0300 0E31",
+/*452*/ "2014 0300 0020/0E31",
+/*453*/ "2014 0020",
+/*454*/ "2014 0020 0020",
+/*455*/ "2014 0300 0020",
+/*456*/ "2014 0300 0020 0020",
+/*457*/ "2014 002F",
+/*458*/ "2014 0020 002F",
+/*459*/ "2014 0300 002F",
+/*460*/ "2014 0300 0020 002F",
+/*461*/ "2014 2060",
+/*462*/ "2014 0020 2060",
+/*463*/ "2014 0300 2060",
+/*464*/ "2014 0300 0020 2060",
+/*465*/ "2014 200B",
+/*466*/ "2014 0020 200B",
+/*467*/ "2014 0300 200B",
+/*468*/ "2014 0300 0020 200B",
+/*469*/ "007C/00A7",
+/*470*/ "007C 0020/00A7",
+/*471*/ "007C 0300/00A7",
+/*472*/ "007C 0300 0020/00A7",
+/*473*/ "007C/0023",
+/*474*/ "007C 0020/0023",
+/*475*/ "007C 0300/0023",
+/*476*/ "007C 0300 0020/0023",
+/*477*/ "007C/2014",
+/*478*/ "007C 0020/2014",
+/*479*/ "007C 0300/2014",
+/*480*/ "007C 0300 0020/2014",
+/*481*/ "007C 007C",
+/*482*/ "007C 0020/007C",
+/*483*/ "007C 0300 007C",
+/*484*/ "007C 0300 0020/007C",
+/*485*/ "007C/00B4",
+/*486*/ "007C 0020/00B4",
+/*487*/ "007C 0300/00B4",
+/*488*/ "007C 0300 0020/00B4",
+/*489*/ "007C 2028",
+/*490*/ "007C 0020 2028",
+/*491*/ "007C 0300 2028",
+/*492*/ "007C 0300 0020 2028",
+/*493*/ "007C/FFFC",
+/*494*/ "007C 0020/FFFC",
+/*495*/ "007C 0300/FFFC",
+/*496*/ "007C 0300 0020/FFFC",
+/*497*/ "007C 3041",
+/*498*/ "007C 0020/3041",
+/*499*/ "007C 0300 3041",
+/*500*/ "007C 0300 0020/3041",
+/*501*/ "007C 007D",
+/*502*/ "007C 0020 007D",
+/*503*/ "007C 0300 007D",
+/*504*/ "007C 0300 0020 007D",
+/*505*/ "007C 0300",
+/*506*/ "007C 0020/0300",
+/*507*/ "007C 0300 0300",
+/*508*/ "007C 0300 0020/0300",
+/*509*/ "007C 0029",
+/*510*/ "007C 0020 0029",
+/*511*/ "007C 0300 0029",
+/*512*/ "007C 0300 0020 0029",
+/*513*/ "007C 000D",
+/*514*/ "007C 0020 000D",
+/*515*/ "007C 0300 000D",
+/*516*/ "007C 0300 0020 000D",
+/*517*/ "007C 0021",
+/*518*/ "007C 0020 0021",
+/*519*/ "007C 0300 0021",
+/*520*/ "007C 0300 0020 0021",
+/*521*/ "007C/00A0",
+/*522*/ "007C 0020/00A0",
+/*523*/ "007C 0300/00A0",
+/*524*/ "007C 0300 0020/00A0",
+/*525*/ "007C/AC00",
+/*526*/ "007C 0020/AC00",
+/*527*/ "007C 0300/AC00",
+/*528*/ "007C 0300 0020/AC00",
+/*529*/ "007C/AC01",
+/*530*/ "007C 0020/AC01",
+/*531*/ "007C 0300/AC01",
+/*532*/ "007C 0300 0020/AC01",
+/*533*/ "007C/05D0",
+/*534*/ "007C 0020/05D0",
+/*535*/ "007C 0300/05D0",
+/*536*/ "007C 0300 0020/05D0",
+/*537*/ "007C 002D",
+/*538*/ "007C 0020/002D",
+/*539*/ "007C 0300 002D",
+/*540*/ "007C 0300 0020/002D",
+/*541*/ "007C/231A",
+/*542*/ "007C 0020/231A",
+/*543*/ "007C 0300/231A",
+/*544*/ "007C 0300 0020/231A",
+/*545*/ "007C/2024",
+/*546*/ "007C 0020/2024",
+/*547*/ "007C 0300/2024",
+/*548*/ "007C 0300 0020/2024",
+/*549*/ "007C 002C",
+/*550*/ "007C 0020 002C",
+/*551*/ "007C 0300 002C",
+/*552*/ "007C 0300 0020 002C",
+/*553*/ "007C/1100",
+/*554*/ "007C 0020/1100",
+/*555*/ "007C 0300/1100",
+/*556*/ "007C 0300 0020/1100",
+/*557*/ "007C/11A8",
+/*558*/ "007C 0020/11A8",
+/*559*/ "007C 0300/11A8",
+/*560*/ "007C 0300 0020/11A8",
+/*561*/ "007C/1160",
+/*562*/ "007C 0020/1160",
+/*563*/ "007C 0300/1160",
+/*564*/ "007C 0300 0020/1160",
+/*565*/ "007C 000A",
+/*566*/ "007C 0020 000A",
+/*567*/ "007C 0300 000A",
+/*568*/ "007C 0300 0020 000A",
+/*569*/ "007C 0085",
+/*570*/ "007C 0020 0085",
+/*571*/ "007C 0300 0085",
+/*572*/ "007C 0300 0020 0085",
+/*573*/ "007C 17D6",
+/*574*/ "007C 0020/17D6",
+/*575*/ "007C 0300 17D6",
+/*576*/ "007C 0300 0020/17D6",
+/*577*/ "007C/0030",
+/*578*/ "007C 0020/0030",
+/*579*/ "007C 0300/0030",
+/*580*/ "007C 0300 0020/0030",
+/*581*/ "007C/0028",
+/*582*/ "007C 0020/0028",
+/*583*/ "007C 0300/0028",
+/*584*/ "007C 0300 0020/0028",
+/*585*/ "007C/0025",
+/*586*/ "007C 0020/0025",
+/*587*/ "007C 0300/0025",
+/*588*/ "007C 0300 0020/0025",
+/*589*/ "007C/0024",
+/*590*/ "007C 0020/0024",
+/*591*/ "007C 0300/0024",
+/*592*/ "007C 0300 0020/0024",
+/*593*/ "007C 0022",
+/*594*/ "007C 0020/0022",
+/*595*/ "007C 0300 0022",
+/*596*/ "007C 0300 0020/0022",
+/*597*/ "007C/1F1E6",
+/*598*/ "007C 0020/1F1E6",
+/*599*/ "007C 0300/1F1E6",
+/*600*/ "007C 0300 0020/1F1E6",
+/*601*/ "007C/0E01",
+/*602*/ "007C 0020/0E01",
+/*603*/ "007C 0300/0E01",
+/*604*/ "007C 0300 0020/0E01",
+/*605*/ "007C 0E31",
+/*606*/ "007C 0020/0E31",
+/*607*/ "007C 0300 0E31",
+/*608*/ "007C 0300 0020/0E31",
+/*609*/ "007C 0020",
+/*610*/ "007C 0020 0020",
+/*611*/ "007C 0300 0020",
+/*612*/ "007C 0300 0020 0020",
+/*613*/ "007C 002F",
+/*614*/ "007C 0020 002F",
+/*615*/ "007C 0300 002F",
+/*616*/ "007C 0300 0020 002F",
+/*617*/ "007C 2060",
+/*618*/ "007C 0020 2060",
+/*619*/ "007C 0300 2060",
+/*620*/ "007C 0300 0020 2060",
+/*621*/ "007C 200B",
+/*622*/ "007C 0020 200B",
+/*623*/ "007C 0300 200B",
+/*624*/ "007C 0300 0020 200B",
+/*625*/ "00B4 00A7",
+/*626*/ "00B4 0020/00A7",
+/*627*/ "00B4 0300 00A7",
+/*628*/ "00B4 0300 0020/00A7",
+/*629*/ "00B4 0023",
+/*630*/ "00B4 0020/0023",
+/*631*/ "00B4 0300 0023",
+/*632*/ "00B4 0300 0020/0023",
+/*633*/ "00B4 2014",
+/*634*/ "00B4 0020/2014",
+/*635*/ "00B4 0300 2014",
+/*636*/ "00B4 0300 0020/2014",
+/*637*/ "00B4 007C",
+/*638*/ "00B4 0020/007C",
+/*639*/ "00B4 0300 007C",
+/*640*/ "00B4 0300 0020/007C",
+/*641*/ "00B4 00B4",
+/*642*/ "00B4 0020/00B4",
+/*643*/ "00B4 0300 00B4",
+/*644*/ "00B4 0300 0020/00B4",
+/*645*/ "00B4 2028",
+/*646*/ "00B4 0020 2028",
+/*647*/ "00B4 0300 2028",
+/*648*/ "00B4 0300 0020 2028",
+/*649*/ "00B4/FFFC",
+/*650*/ "00B4 0020/FFFC",
+/*651*/ "00B4 0300/FFFC",
+/*652*/ "00B4 0300 0020/FFFC",
+/*653*/ "00B4 3041",
+/*654*/ "00B4 0020/3041",
+/*655*/ "00B4 0300 3041",
+/*656*/ "00B4 0300 0020/3041",
+/*657*/ "00B4 007D",
+/*658*/ "00B4 0020 007D",
+/*659*/ "00B4 0300 007D",
+/*660*/ "00B4 0300 0020 007D",
+/*661*/ "00B4 0300",
+/*662*/ "00B4 0020/0300",
+/*663*/ "00B4 0300 0300",
+/*664*/ "00B4 0300 0020/0300",
+/*665*/ "00B4 0029",
+/*666*/ "00B4 0020 0029",
+/*667*/ "00B4 0300 0029",
+/*668*/ "00B4 0300 0020 0029",
+/*669*/ "00B4 000D",
+/*670*/ "00B4 0020 000D",
+/*671*/ "00B4 0300 000D",
+/*672*/ "00B4 0300 0020 000D",
+/*673*/ "00B4 0021",
+/*674*/ "00B4 0020 0021",
+/*675*/ "00B4 0300 0021",
+/*676*/ "00B4 0300 0020 0021",
+/*677*/ "00B4 00A0",
+/*678*/ "00B4 0020/00A0",
+/*679*/ "00B4 0300 00A0",
+/*680*/ "00B4 0300 0020/00A0",
+/*681*/ "00B4 AC00",
+/*682*/ "00B4 0020/AC00",
+/*683*/ "00B4 0300 AC00",
+/*684*/ "00B4 0300 0020/AC00",
+/*685*/ "00B4 AC01",
+/*686*/ "00B4 0020/AC01",
+/*687*/ "00B4 0300 AC01",
+/*688*/ "00B4 0300 0020/AC01",
+/*689*/ "00B4 05D0",
+/*690*/ "00B4 0020/05D0",
+/*691*/ "00B4 0300 05D0",
+/*692*/ "00B4 0300 0020/05D0",
+/*693*/ "00B4 002D",
+/*694*/ "00B4 0020/002D",
+/*695*/ "00B4 0300 002D",
+/*696*/ "00B4 0300 0020/002D",
+/*697*/ "00B4 231A",
+/*698*/ "00B4 0020/231A",
+/*699*/ "00B4 0300 231A",
+/*700*/ "00B4 0300 0020/231A",
+/*701*/ "00B4 2024",
+/*702*/ "00B4 0020/2024",
+/*703*/ "00B4 0300 2024",
+/*704*/ "00B4 0300 0020/2024",
+/*705*/ "00B4 002C",
+/*706*/ "00B4 0020 002C",
+/*707*/ "00B4 0300 002C",
+/*708*/ "00B4 0300 0020 002C",
+/*709*/ "00B4 1100",
+/*710*/ "00B4 0020/1100",
+/*711*/ "00B4 0300 1100",
+/*712*/ "00B4 0300 0020/1100",
+/*713*/ "00B4 11A8",
+/*714*/ "00B4 0020/11A8",
+/*715*/ "00B4 0300 11A8",
+/*716*/ "00B4 0300 0020/11A8",
+/*717*/ "00B4 1160",
+/*718*/ "00B4 0020/1160",
+/*719*/ "00B4 0300 1160",
+/*720*/ "00B4 0300 0020/1160",
+/*721*/ "00B4 000A",
+/*722*/ "00B4 0020 000A",
+/*723*/ "00B4 0300 000A",
+/*724*/ "00B4 0300 0020 000A",
+/*725*/ "00B4 0085",
+/*726*/ "00B4 0020 0085",
+/*727*/ "00B4 0300 0085",
+/*728*/ "00B4 0300 0020 0085",
+/*729*/ "00B4 17D6",
+/*730*/ "00B4 0020/17D6",
+/*731*/ "00B4 0300 17D6",
+/*732*/ "00B4 0300 0020/17D6",
+/*733*/ "00B4 0030",
+/*734*/ "00B4 0020/0030",
+/*735*/ "00B4 0300 0030",
+/*736*/ "00B4 0300 0020/0030",
+/*737*/ "00B4 0028",
+/*738*/ "00B4 0020/0028",
+/*739*/ "00B4 0300 0028",
+/*740*/ "00B4 0300 0020/0028",
+/*741*/ "00B4 0025",
+/*742*/ "00B4 0020/0025",
+/*743*/ "00B4 0300 0025",
+/*744*/ "00B4 0300 0020/0025",
+/*745*/ "00B4 0024",
+/*746*/ "00B4 0020/0024",
+/*747*/ "00B4 0300 0024",
+/*748*/ "00B4 0300 0020/0024",
+/*749*/ "00B4 0022",
+/*750*/ "00B4 0020/0022",
+/*751*/ "00B4 0300 0022",
+/*752*/ "00B4 0300 0020/0022",
+/*753*/ "00B4 1F1E6",
+/*754*/ "00B4 0020/1F1E6",
+/*755*/ "00B4 0300 1F1E6",
+/*756*/ "00B4 0300 0020/1F1E6",
+/*757*/ "00B4 0E01",
+/*758*/ "00B4 0020/0E01",
+/*759*/ "00B4 0300 0E01",
+/*760*/ "00B4 0300 0020/0E01",
+/*761*/ "00B4 0E31",
+/*762*/ "00B4 0020/0E31",
+/*763*/ "00B4 0300 0E31",
+/*764*/ "00B4 0300 0020/0E31",
+/*765*/ "00B4 0020",
+/*766*/ "00B4 0020 0020",
+/*767*/ "00B4 0300 0020",
+/*768*/ "00B4 0300 0020 0020",
+/*769*/ "00B4 002F",
+/*770*/ "00B4 0020 002F",
+/*771*/ "00B4 0300 002F",
+/*772*/ "00B4 0300 0020 002F",
+/*773*/ "00B4 2060",
+/*774*/ "00B4 0020 2060",
+/*775*/ "00B4 0300 2060",
+/*776*/ "00B4 0300 0020 2060",
+/*777*/ "00B4 200B",
+/*778*/ "00B4 0020 200B",
+/*779*/ "00B4 0300 200B",
+/*780*/ "00B4 0300 0020 200B",
+/*781*/ "2028/00A7",
+/*782*/ "2028/0020/00A7",
+/*783*/ "2028/0300 00A7",
+/*784*/ "2028/0300 0020/00A7",
+/*785*/ "2028/0023",
+/*786*/ "2028/0020/0023",
+/*787*/ "2028/0300 0023",
+/*788*/ "2028/0300 0020/0023",
+/*789*/ "2028/2014",
+/*790*/ "2028/0020/2014",
+/*791*/ "2028/0300/2014",
+/*792*/ "2028/0300 0020/2014",
+/*793*/ "2028/007C",
+/*794*/ "2028/0020/007C",
+/*795*/ "2028/0300 007C",
+/*796*/ "2028/0300 0020/007C",
+/*797*/ "2028/00B4",
+/*798*/ "2028/0020/00B4",
+/*799*/ "2028/0300/00B4",
+/*800*/ "2028/0300 0020/00B4",
+/*801*/ "2028/2028",
+/*802*/ "2028/0020 2028",
+/*803*/ "2028/0300 2028",
+/*804*/ "2028/0300 0020 2028",
+/*805*/ "2028/FFFC",
+/*806*/ "2028/0020/FFFC",
+/*807*/ "2028/0300/FFFC",
+/*808*/ "2028/0300 0020/FFFC",
+/*809*/ "2028/3041",
+/*810*/ "2028/0020/3041",
+/*811*/ "2028/0300 3041",
+/*812*/ "2028/0300 0020/3041",
+/*813*/ "2028/007D",
+/*814*/ "2028/0020 007D",
+/*815*/ "2028/0300 007D",
+/*816*/ "2028/0300 0020 007D",
+/*817*/ "2028/0300",
+/*818*/ "2028/0020/0300",
+/*819*/ "2028/0300 0300",
+/*820*/ "2028/0300 0020/0300",
+/*821*/ "2028/0029",
+/*822*/ "2028/0020 0029",
+/*823*/ "2028/0300 0029",
+/*824*/ "2028/0300 0020 0029",
+/*825*/ "2028/000D",
+/*826*/ "2028/0020 000D",
+/*827*/ "2028/0300 000D",
+/*828*/ "2028/0300 0020 000D",
+/*829*/ "2028/0021",
+/*830*/ "2028/0020 0021",
+/*831*/ "2028/0300 0021",
+/*832*/ "2028/0300 0020 0021",
+/*833*/ "2028/00A0",
+/*834*/ "2028/0020/00A0",
+/*835*/ "2028/0300 00A0",
+/*836*/ "2028/0300 0020/00A0",
+/*837*/ "2028/AC00",
+/*838*/ "2028/0020/AC00",
+/*839*/ "2028/0300/AC00",
+/*840*/ "2028/0300 0020/AC00",
+/*841*/ "2028/AC01",
+/*842*/ "2028/0020/AC01",
+/*843*/ "2028/0300/AC01",
+/*844*/ "2028/0300 0020/AC01",
+/*845*/ "2028/05D0",
+/*846*/ "2028/0020/05D0",
+/*847*/ "2028/0300 05D0",
+/*848*/ "2028/0300 0020/05D0",
+/*849*/ "2028/002D",
+/*850*/ "2028/0020/002D",
+/*851*/ "2028/0300 002D",
+/*852*/ "2028/0300 0020/002D",
+/*853*/ "2028/231A",
+/*854*/ "2028/0020/231A",
+/*855*/ "2028/0300/231A",
+/*856*/ "2028/0300 0020/231A",
+/*857*/ "2028/2024",
+/*858*/ "2028/0020/2024",
+/*859*/ "2028/0300 2024",
+/*860*/ "2028/0300 0020/2024",
+/*861*/ "2028/002C",
+/*862*/ "2028/0020 002C",
+/*863*/ "2028/0300 002C",
+/*864*/ "2028/0300 0020 002C",
+/*865*/ "2028/1100",
+/*866*/ "2028/0020/1100",
+/*867*/ "2028/0300/1100",
+/*868*/ "2028/0300 0020/1100",
+/*869*/ "2028/11A8",
+/*870*/ "2028/0020/11A8",
+/*871*/ "2028/0300/11A8",
+/*872*/ "2028/0300 0020/11A8",
+/*873*/ "2028/1160",
+/*874*/ "2028/0020/1160",
+/*875*/ "2028/0300/1160",
+/*876*/ "2028/0300 0020/1160",
+/*877*/ "2028/000A",
+/*878*/ "2028/0020 000A",
+/*879*/ "2028/0300 000A",
+/*880*/ "2028/0300 0020 000A",
+/*881*/ "2028/0085",
+/*882*/ "2028/0020 0085",
+/*883*/ "2028/0300 0085",
+/*884*/ "2028/0300 0020 0085",
+/*885*/ "2028/17D6",
+/*886*/ "2028/0020/17D6",
+/*887*/ "2028/0300 17D6",
+/*888*/ "2028/0300 0020/17D6",
+/*889*/ "2028/0030",
+/*890*/ "2028/0020/0030",
+/*891*/ "2028/0300 0030",
+/*892*/ "2028/0300 0020/0030",
+/*893*/ "2028/0028",
+/*894*/ "2028/0020/0028",
+/*895*/ "2028/0300 0028",
+/*896*/ "2028/0300 0020/0028",
+/*897*/ "2028/0025",
+/*898*/ "2028/0020/0025",
+/*899*/ "2028/0300/0025",
+/*900*/ "2028/0300 0020/0025",
+/*901*/ "2028/0024",
+/*902*/ "2028/0020/0024",
+/*903*/ "2028/0300/0024",
+/*904*/ "2028/0300 0020/0024",
+/*905*/ "2028/0022",
+/*906*/ "2028/0020/0022",
+/*907*/ "2028/0300 0022",
+/*908*/ "2028/0300 0020/0022",
+/*909*/ "2028/1F1E6",
+/*910*/ "2028/0020/1F1E6",
+/*911*/ "2028/0300/1F1E6",
+/*912*/ "2028/0300 0020/1F1E6",
+/*913*/ "2028/0E01",
+/*914*/ "2028/0020/0E01",
+/*915*/ "2028/0300 0E01",
+/*916*/ "2028/0300 0020/0E01",
+/*917*/ "2028/0E31",
+/*918*/ "2028/0020/0E31",
+/*919*/ "2028/0300 0E31",
+/*920*/ "2028/0300 0020/0E31",
+/*921*/ "2028/0020",
+/*922*/ "2028/0020 0020",
+/*923*/ "2028/0300 0020",
+/*924*/ "2028/0300 0020 0020",
+/*925*/ "2028/002F",
+/*926*/ "2028/0020 002F",
+/*927*/ "2028/0300 002F",
+/*928*/ "2028/0300 0020 002F",
+/*929*/ "2028/2060",
+/*930*/ "2028/0020 2060",
+/*931*/ "2028/0300 2060",
+/*932*/ "2028/0300 0020 2060",
+/*933*/ "2028/200B",
+/*934*/ "2028/0020 200B",
+/*935*/ "2028/0300 200B",
+/*936*/ "2028/0300 0020 200B",
+/*937*/ "FFFC/00A7",
+/*938*/ "FFFC 0020/00A7",
+/*939*/ "FFFC 0300/00A7",
+/*940*/ "FFFC 0300 0020/00A7",
+/*941*/ "FFFC/0023",
+/*942*/ "FFFC 0020/0023",
+/*943*/ "FFFC 0300/0023",
+/*944*/ "FFFC 0300 0020/0023",
+/*945*/ "FFFC/2014",
+/*946*/ "FFFC 0020/2014",
+/*947*/ "FFFC 0300/2014",
+/*948*/ "FFFC 0300 0020/2014",
+/*949*/ "FFFC/007C",
+/*950*/ "FFFC 0020/007C",
+/*951*/ "FFFC 0300/007C",
+/*952*/ "FFFC 0300 0020/007C",
+/*953*/ "FFFC/00B4",
+/*954*/ "FFFC 0020/00B4",
+/*955*/ "FFFC 0300/00B4",
+/*956*/ "FFFC 0300 0020/00B4",
+/*957*/ "FFFC 2028",
+/*958*/ "FFFC 0020 2028",
+/*959*/ "FFFC 0300 2028",
+/*960*/ "FFFC 0300 0020 2028",
+/*961*/ "FFFC/FFFC",
+/*962*/ "FFFC 0020/FFFC",
+/*963*/ "FFFC 0300/FFFC",
+/*964*/ "FFFC 0300 0020/FFFC",
+/*965*/ "FFFC/3041",
+/*966*/ "FFFC 0020/3041",
+/*967*/ "FFFC 0300/3041",
+/*968*/ "FFFC 0300 0020/3041",
+/*969*/ "FFFC 007D",
+/*970*/ "FFFC 0020 007D",
+/*971*/ "FFFC 0300 007D",
+/*972*/ "FFFC 0300 0020 007D",
+/*973*/ "FFFC 0300",
+/*974*/ "FFFC 0020/0300",
+/*975*/ "FFFC 0300 0300",
+/*976*/ "FFFC 0300 0020/0300",
+/*977*/ "FFFC 0029",
+/*978*/ "FFFC 0020 0029",
+/*979*/ "FFFC 0300 0029",
+/*980*/ "FFFC 0300 0020 0029",
+/*981*/ "FFFC 000D",
+/*982*/ "FFFC 0020 000D",
+/*983*/ "FFFC 0300 000D",
+/*984*/ "FFFC 0300 0020 000D",
+/*985*/ "FFFC 0021",
+/*986*/ "FFFC 0020 0021",
+/*987*/ "FFFC 0300 0021",
+/*988*/ "FFFC 0300 0020 0021",
+/*989*/ "FFFC 00A0",
+/*990*/ "FFFC 0020/00A0",
+/*991*/ "FFFC 0300 00A0",
+/*992*/ "FFFC 0300 0020/00A0",
+/*993*/ "FFFC/AC00",
+/*994*/ "FFFC 0020/AC00",
+/*995*/ "FFFC 0300/AC00",
+/*996*/ "FFFC 0300 0020/AC00",
+/*997*/ "FFFC/AC01",
+/*998*/ "FFFC 0020/AC01",
+/*999*/ "FFFC 0300/AC01",
+/*1000*/ "FFFC 0300 0020/AC01",
+/*1001*/ "FFFC/05D0",
+/*1002*/ "FFFC 0020/05D0",
+/*1003*/ "FFFC 0300/05D0",
+/*1004*/ "FFFC 0300 0020/05D0",
+/*1005*/ "FFFC/002D",
+/*1006*/ "FFFC 0020/002D",
+/*1007*/ "FFFC 0300/002D",
+/*1008*/ "FFFC 0300 0020/002D",
+/*1009*/ "FFFC/231A",
+/*1010*/ "FFFC 0020/231A",
+/*1011*/ "FFFC 0300/231A",
+/*1012*/ "FFFC 0300 0020/231A",
+/*1013*/ "FFFC/2024",
+/*1014*/ "FFFC 0020/2024",
+/*1015*/ "FFFC 0300/2024",
+/*1016*/ "FFFC 0300 0020/2024",
+/*1017*/ "FFFC 002C",
+/*1018*/ "FFFC 0020 002C",
+/*1019*/ "FFFC 0300 002C",
+/*1020*/ "FFFC 0300 0020 002C",
+/*1021*/ "FFFC/1100",
+/*1022*/ "FFFC 0020/1100",
+/*1023*/ "FFFC 0300/1100",
+/*1024*/ "FFFC 0300 0020/1100",
+/*1025*/ "FFFC/11A8",
+/*1026*/ "FFFC 0020/11A8",
+/*1027*/ "FFFC 0300/11A8",
+/*1028*/ "FFFC 0300 0020/11A8",
+/*1029*/ "FFFC/1160",
+/*1030*/ "FFFC 0020/1160",
+/*1031*/ "FFFC 0300/1160",
+/*1032*/ "FFFC 0300 0020/1160",
+/*1033*/ "FFFC 000A",
+/*1034*/ "FFFC 0020 000A",
+/*1035*/ "FFFC 0300 000A",
+/*1036*/ "FFFC 0300 0020 000A",
+/*1037*/ "FFFC 0085",
+/*1038*/ "FFFC 0020 0085",
+/*1039*/ "FFFC 0300 0085",
+/*1040*/ "FFFC 0300 0020 0085",
+/*1041*/ "FFFC/17D6",
+/*1042*/ "FFFC 0020/17D6",
+/*1043*/ "FFFC 0300/17D6",
+/*1044*/ "FFFC 0300 0020/17D6",
+/*1045*/ "FFFC/0030",
+/*1046*/ "FFFC 0020/0030",
+/*1047*/ "FFFC 0300/0030",
+/*1048*/ "FFFC 0300 0020/0030",
+/*1049*/ "FFFC/0028",
+/*1050*/ "FFFC 0020/0028",
+/*1051*/ "FFFC 0300/0028",
+/*1052*/ "FFFC 0300 0020/0028",
+/*1053*/ "FFFC/0025",
+/*1054*/ "FFFC 0020/0025",
+/*1055*/ "FFFC 0300/0025",
+/*1056*/ "FFFC 0300 0020/0025",
+/*1057*/ "FFFC/0024",
+/*1058*/ "FFFC 0020/0024",
+/*1059*/ "FFFC 0300/0024",
+/*1060*/ "FFFC 0300 0020/0024",
+/*1061*/ "FFFC 0022",
+/*1062*/ "FFFC 0020/0022",
+/*1063*/ "FFFC 0300 0022",
+/*1064*/ "FFFC 0300 0020/0022",
+/*1065*/ "FFFC/1F1E6",
+/*1066*/ "FFFC 0020/1F1E6",
+/*1067*/ "FFFC 0300/1F1E6",
+/*1068*/ "FFFC 0300 0020/1F1E6",
+/*1069*/ "FFFC/0E01",
+/*1070*/ "FFFC 0020/0E01",
+/*1071*/ "FFFC 0300/0E01",
+/*1072*/ "FFFC 0300 0020/0E01",
+/*1073*/ "FFFC 0E31",
+/*1074*/ "FFFC 0020/0E31",
+/*1075*/ "FFFC 0300 0E31",
+/*1076*/ "FFFC 0300 0020/0E31",
+/*1077*/ "FFFC 0020",
+/*1078*/ "FFFC 0020 0020",
+/*1079*/ "FFFC 0300 0020",
+/*1080*/ "FFFC 0300 0020 0020",
+/*1081*/ "FFFC 002F",
+/*1082*/ "FFFC 0020 002F",
+/*1083*/ "FFFC 0300 002F",
+/*1084*/ "FFFC 0300 0020 002F",
+/*1085*/ "FFFC 2060",
+/*1086*/ "FFFC 0020 2060",
+/*1087*/ "FFFC 0300 2060",
+/*1088*/ "FFFC 0300 0020 2060",
+/*1089*/ "FFFC 200B",
+/*1090*/ "FFFC 0020 200B",
+/*1091*/ "FFFC 0300 200B",
+/*1092*/ "FFFC 0300 0020 200B",
+/*1093*/ "3041/00A7",
+/*1094*/ "3041 0020/00A7",
+/*1095*/ "3041 0300/00A7",
+/*1096*/ "3041 0300 0020/00A7",
+/*1097*/ "3041/0023",
+/*1098*/ "3041 0020/0023",
+/*1099*/ "3041 0300/0023",
+/*1100*/ "3041 0300 0020/0023",
+/*1101*/ "3041/2014",
+/*1102*/ "3041 0020/2014",
+/*1103*/ "3041 0300/2014",
+/*1104*/ "3041 0300 0020/2014",
+/*1105*/ "3041 007C",
+/*1106*/ "3041 0020/007C",
+/*1107*/ "3041 0300 007C",
+/*1108*/ "3041 0300 0020/007C",
+/*1109*/ "3041/00B4",
+/*1110*/ "3041 0020/00B4",
+/*1111*/ "3041 0300/00B4",
+/*1112*/ "3041 0300 0020/00B4",
+/*1113*/ "3041 2028",
+/*1114*/ "3041 0020 2028",
+/*1115*/ "3041 0300 2028",
+/*1116*/ "3041 0300 0020 2028",
+/*1117*/ "3041/FFFC",
+/*1118*/ "3041 0020/FFFC",
+/*1119*/ "3041 0300/FFFC",
+/*1120*/ "3041 0300 0020/FFFC",
+/*1121*/ "3041 3041",
+/*1122*/ "3041 0020/3041",
+/*1123*/ "3041 0300 3041",
+/*1124*/ "3041 0300 0020/3041",
+/*1125*/ "3041 007D",
+/*1126*/ "3041 0020 007D",
+/*1127*/ "3041 0300 007D",
+/*1128*/ "3041 0300 0020 007D",
+/*1129*/ "3041 0300",
+/*1130*/ "3041 0020/0300",
+/*1131*/ "3041 0300 0300",
+/*1132*/ "3041 0300 0020/0300",
+/*1133*/ "3041 0029",
+/*1134*/ "3041 0020 0029",
+/*1135*/ "3041 0300 0029",
+/*1136*/ "3041 0300 0020 0029",
+/*1137*/ "3041 000D",
+/*1138*/ "3041 0020 000D",
+/*1139*/ "3041 0300 000D",
+/*1140*/ "3041 0300 0020 000D",
+/*1141*/ "3041 0021",
+/*1142*/ "3041 0020 0021",
+/*1143*/ "3041 0300 0021",
+/*1144*/ "3041 0300 0020 0021",
+/*1145*/ "3041 00A0",
+/*1146*/ "3041 0020/00A0",
+/*1147*/ "3041 0300 00A0",
+/*1148*/ "3041 0300 0020/00A0",
+/*1149*/ "3041/AC00",
+/*1150*/ "3041 0020/AC00",
+/*1151*/ "3041 0300/AC00",
+/*1152*/ "3041 0300 0020/AC00",
+/*1153*/ "3041/AC01",
+/*1154*/ "3041 0020/AC01",
+/*1155*/ "3041 0300/AC01",
+/*1156*/ "3041 0300 0020/AC01",
+/*1157*/ "3041/05D0",
+/*1158*/ "3041 0020/05D0",
+/*1159*/ "3041 0300/05D0",
+/*1160*/ "3041 0300 0020/05D0",
+/*1161*/ "3041 002D",
+/*1162*/ "3041 0020/002D",
+/*1163*/ "3041 0300 002D",
+/*1164*/ "3041 0300 0020/002D",
+/*1165*/ "3041/231A",
+/*1166*/ "3041 0020/231A",
+/*1167*/ "3041 0300/231A",
+/*1168*/ "3041 0300 0020/231A",
+/*1169*/ "3041/2024",
+/*1170*/ "3041 0020/2024",
+/*1171*/ "3041 0300/2024",
+/*1172*/ "3041 0300 0020/2024",
+/*1173*/ "3041 002C",
+/*1174*/ "3041 0020 002C",
+/*1175*/ "3041 0300 002C",
+/*1176*/ "3041 0300 0020 002C",
+/*1177*/ "3041/1100",
+/*1178*/ "3041 0020/1100",
+/*1179*/ "3041 0300/1100",
+/*1180*/ "3041 0300 0020/1100",
+/*1181*/ "3041/11A8",
+/*1182*/ "3041 0020/11A8",
+/*1183*/ "3041 0300/11A8",
+/*1184*/ "3041 0300 0020/11A8",
+/*1185*/ "3041/1160",
+/*1186*/ "3041 0020/1160",
+/*1187*/ "3041 0300/1160",
+/*1188*/ "3041 0300 0020/1160",
+/*1189*/ "3041 000A",
+/*1190*/ "3041 0020 000A",
+/*1191*/ "3041 0300 000A",
+/*1192*/ "3041 0300 0020 000A",
+/*1193*/ "3041 0085",
+/*1194*/ "3041 0020 0085",
+/*1195*/ "3041 0300 0085",
+/*1196*/ "3041 0300 0020 0085",
+/*1197*/ "3041 17D6",
+/*1198*/ "3041 0020/17D6",
+/*1199*/ "3041 0300 17D6",
+/*1200*/ "3041 0300 0020/17D6",
+/*1201*/ "3041/0030",
+/*1202*/ "3041 0020/0030",
+/*1203*/ "3041 0300/0030",
+/*1204*/ "3041 0300 0020/0030",
+/*1205*/ "3041/0028",
+/*1206*/ "3041 0020/0028",
+/*1207*/ "3041 0300/0028",
+/*1208*/ "3041 0300 0020/0028",
+/*1209*/ "3041/0025",
+/*1210*/ "3041 0020/0025",
+/*1211*/ "3041 0300/0025",
+/*1212*/ "3041 0300 0020/0025",
+/*1213*/ "3041/0024",
+/*1214*/ "3041 0020/0024",
+/*1215*/ "3041 0300/0024",
+/*1216*/ "3041 0300 0020/0024",
+/*1217*/ "3041 0022",
+/*1218*/ "3041 0020/0022",
+/*1219*/ "3041 0300 0022",
+/*1220*/ "3041 0300 0020/0022",
+/*1221*/ "3041/1F1E6",
+/*1222*/ "3041 0020/1F1E6",
+/*1223*/ "3041 0300/1F1E6",
+/*1224*/ "3041 0300 0020/1F1E6",
+/*1225*/ "3041/0E01",
+/*1226*/ "3041 0020/0E01",
+/*1227*/ "3041 0300/0E01",
+/*1228*/ "3041 0300 0020/0E01",
+/*1229*/ "3041 0E31",
+/*1230*/ "3041 0020/0E31",
+/*1231*/ "3041 0300 0E31",
+/*1232*/ "3041 0300 0020/0E31",
+/*1233*/ "3041 0020",
+/*1234*/ "3041 0020 0020",
+/*1235*/ "3041 0300 0020",
+/*1236*/ "3041 0300 0020 0020",
+/*1237*/ "3041 002F",
+/*1238*/ "3041 0020 002F",
+/*1239*/ "3041 0300 002F",
+/*1240*/ "3041 0300 0020 002F",
+/*1241*/ "3041 2060",
+/*1242*/ "3041 0020 2060",
+/*1243*/ "3041 0300 2060",
+/*1244*/ "3041 0300 0020 2060",
+/*1245*/ "3041 200B",
+/*1246*/ "3041 0020 200B",
+/*1247*/ "3041 0300 200B",
+/*1248*/ "3041 0300 0020 200B",
+/*1249*/ "007D/00A7",
+/*1250*/ "007D 0020/00A7",
+/*1251*/ "007D 0300/00A7",
+/*1252*/ "007D 0300 0020/00A7",
+/*1253*/ "007D/0023",
+/*1254*/ "007D 0020/0023",
+/*1255*/ "007D 0300/0023",
+/*1256*/ "007D 0300 0020/0023",
+/*1257*/ "007D/2014",
+/*1258*/ "007D 0020/2014",
+/*1259*/ "007D 0300/2014",
+/*1260*/ "007D 0300 0020/2014",
+/*1261*/ "007D 007C",
+/*1262*/ "007D 0020/007C",
+/*1263*/ "007D 0300 007C",
+/*1264*/ "007D 0300 0020/007C",
+/*1265*/ "007D/00B4",
+/*1266*/ "007D 0020/00B4",
+/*1267*/ "007D 0300/00B4",
+/*1268*/ "007D 0300 0020/00B4",
+/*1269*/ "007D 2028",
+/*1270*/ "007D 0020 2028",
+/*1271*/ "007D 0300 2028",
+/*1272*/ "007D 0300 0020 2028",
+/*1273*/ "007D/FFFC",
+/*1274*/ "007D 0020/FFFC",
+/*1275*/ "007D 0300/FFFC",
+/*1276*/ "007D 0300 0020/FFFC",
+/*1277*/ "007D 3041",
+/*1278*/ "007D 0020 3041",
+/*1279*/ "007D 0300 3041",
+/*1280*/ "007D 0300 0020 3041",
+/*1281*/ "007D 007D",
+/*1282*/ "007D 0020 007D",
+/*1283*/ "007D 0300 007D",
+/*1284*/ "007D 0300 0020 007D",
+/*1285*/ "007D 0300",
+/*1286*/ "007D 0020/0300",
+/*1287*/ "007D 0300 0300",
+/*1288*/ "007D 0300 0020/0300",
+/*1289*/ "007D 0029",
+/*1290*/ "007D 0020 0029",
+/*1291*/ "007D 0300 0029",
+/*1292*/ "007D 0300 0020 0029",
+/*1293*/ "007D 000D",
+/*1294*/ "007D 0020 000D",
+/*1295*/ "007D 0300 000D",
+/*1296*/ "007D 0300 0020 000D",
+/*1297*/ "007D 0021",
+/*1298*/ "007D 0020 0021",
+/*1299*/ "007D 0300 0021",
+/*1300*/ "007D 0300 0020 0021",
+/*1301*/ "007D 00A0",
+/*1302*/ "007D 0020/00A0",
+/*1303*/ "007D 0300 00A0",
+/*1304*/ "007D 0300 0020/00A0",
+/*1305*/ "007D/AC00",
+/*1306*/ "007D 0020/AC00",
+/*1307*/ "007D 0300/AC00",
+/*1308*/ "007D 0300 0020/AC00",
+/*1309*/ "007D/AC01",
+/*1310*/ "007D 0020/AC01",
+/*1311*/ "007D 0300/AC01",
+/*1312*/ "007D 0300 0020/AC01",
+/*1313*/ "007D/05D0",
+/*1314*/ "007D 0020/05D0",
+/*1315*/ "007D 0300/05D0",
+/*1316*/ "007D 0300 0020/05D0",
+/*1317*/ "007D 002D",
+/*1318*/ "007D 0020/002D",
+/*1319*/ "007D 0300 002D",
+/*1320*/ "007D 0300 0020/002D",
+/*1321*/ "007D/231A",
+/*1322*/ "007D 0020/231A",
+/*1323*/ "007D 0300/231A",
+/*1324*/ "007D 0300 0020/231A",
+/*1325*/ "007D/2024",
+/*1326*/ "007D 0020/2024",
+/*1327*/ "007D 0300/2024",
+/*1328*/ "007D 0300 0020/2024",
+/*1329*/ "007D 002C",
+/*1330*/ "007D 0020 002C",
+/*1331*/ "007D 0300 002C",
+/*1332*/ "007D 0300 0020 002C",
+/*1333*/ "007D/1100",
+/*1334*/ "007D 0020/1100",
+/*1335*/ "007D 0300/1100",
+/*1336*/ "007D 0300 0020/1100",
+/*1337*/ "007D/11A8",
+/*1338*/ "007D 0020/11A8",
+/*1339*/ "007D 0300/11A8",
+/*1340*/ "007D 0300 0020/11A8",
+/*1341*/ "007D/1160",
+/*1342*/ "007D 0020/1160",
+/*1343*/ "007D 0300/1160",
+/*1344*/ "007D 0300 0020/1160",
+/*1345*/ "007D 000A",
+/*1346*/ "007D 0020 000A",
+/*1347*/ "007D 0300 000A",
+/*1348*/ "007D 0300 0020 000A",
+/*1349*/ "007D 0085",
+/*1350*/ "007D 0020 0085",
+/*1351*/ "007D 0300 0085",
+/*1352*/ "007D 0300 0020 0085",
+/*1353*/ "007D 17D6",
+/*1354*/ "007D 0020 17D6",
+/*1355*/ "007D 0300 17D6",
+/*1356*/ "007D 0300 0020 17D6",
+/*1357*/ "007D/0030",
+/*1358*/ "007D 0020/0030",
+/*1359*/ "007D 0300/0030",
+/*1360*/ "007D 0300 0020/0030",
+/*1361*/ "007D/0028",
+/*1362*/ "007D 0020/0028",
+/*1363*/ "007D 0300/0028",
+/*1364*/ "007D 0300 0020/0028",
+/*1365*/ "007D 0025",
+/*1366*/ "007D 0020/0025",
+/*1367*/ "007D 0300 0025",
+/*1368*/ "007D 0300 0020/0025",
+/*1369*/ "007D 0024",
+/*1370*/ "007D 0020/0024",
+/*1371*/ "007D 0300 0024",
+/*1372*/ "007D 0300 0020/0024",
+/*1373*/ "007D 0022",
+/*1374*/ "007D 0020/0022",
+/*1375*/ "007D 0300 0022",
+/*1376*/ "007D 0300 0020/0022",
+/*1377*/ "007D/1F1E6",
+/*1378*/ "007D 0020/1F1E6",
+/*1379*/ "007D 0300/1F1E6",
+/*1380*/ "007D 0300 0020/1F1E6",
+/*1381*/ "007D/0E01",
+/*1382*/ "007D 0020/0E01",
+/*1383*/ "007D 0300/0E01",
+/*1384*/ "007D 0300 0020/0E01",
+/*1385*/ "007D 0E31",
+/*1386*/ "007D 0020/0E31",
+/*1387*/ "007D 0300 0E31",
+/*1388*/ "007D 0300 0020/0E31",
+/*1389*/ "007D 0020",
+/*1390*/ "007D 0020 0020",
+/*1391*/ "007D 0300 0020",
+/*1392*/ "007D 0300 0020 0020",
+/*1393*/ "007D 002F",
+/*1394*/ "007D 0020 002F",
+/*1395*/ "007D 0300 002F",
+/*1396*/ "007D 0300 0020 002F",
+/*1397*/ "007D 2060",
+/*1398*/ "007D 0020 2060",
+/*1399*/ "007D 0300 2060",
+/*1400*/ "007D 0300 0020 2060",
+/*1401*/ "007D 200B",
+/*1402*/ "007D 0020 200B",
+/*1403*/ "007D 0300 200B",
+/*1404*/ "007D 0300 0020 200B",
+/*1405*/ "0300 00A7",
+/*1406*/ "0300 0020/00A7",
+/*1407*/ "0300 0300 00A7",
+/*1408*/ "0300 0300 0020/00A7",
+/*1409*/ "0300 0023",
+/*1410*/ "0300 0020/0023",
+/*1411*/ "0300 0300 0023",
+/*1412*/ "0300 0300 0020/0023",
+/*1413*/ "0300/2014",
+/*1414*/ "0300 0020/2014",
+/*1415*/ "0300 0300/2014",
+/*1416*/ "0300 0300 0020/2014",
+/*1417*/ "0300 007C",
+/*1418*/ "0300 0020/007C",
+/*1419*/ "0300 0300 007C",
+/*1420*/ "0300 0300 0020/007C",
+/*1421*/ "0300/00B4",
+/*1422*/ "0300 0020/00B4",
+/*1423*/ "0300 0300/00B4",
+/*1424*/ "0300 0300 0020/00B4",
+/*1425*/ "0300 2028",
+/*1426*/ "0300 0020 2028",
+/*1427*/ "0300 0300 2028",
+/*1428*/ "0300 0300 0020 2028",
+/*1429*/ "0300/FFFC",
+/*1430*/ "0300 0020/FFFC",
+/*1431*/ "0300 0300/FFFC",
+/*1432*/ "0300 0300 0020/FFFC",
+/*1433*/ "0300 3041",
+/*1434*/ "0300 0020/3041",
+/*1435*/ "0300 0300 3041",
+/*1436*/ "0300 0300 0020/3041",
+/*1437*/ "0300 007D",
+/*1438*/ "0300 0020 007D",
+/*1439*/ "0300 0300 007D",
+/*1440*/ "0300 0300 0020 007D",
+/*1441*/ "0300 0300",
+/*1442*/ "0300 0020/0300",
+/*1443*/ "0300 0300 0300",
+/*1444*/ "0300 0300 0020/0300",
+/*1445*/ "0300 0029",
+/*1446*/ "0300 0020 0029",
+/*1447*/ "0300 0300 0029",
+/*1448*/ "0300 0300 0020 0029",
+/*1449*/ "0300 000D",
+/*1450*/ "0300 0020 000D",
+/*1451*/ "0300 0300 000D",
+/*1452*/ "0300 0300 0020 000D",
+/*1453*/ "0300 0021",
+/*1454*/ "0300 0020 0021",
+/*1455*/ "0300 0300 0021",
+/*1456*/ "0300 0300 0020 0021",
+/*1457*/ "0300 00A0",
+/*1458*/ "0300 0020/00A0",
+/*1459*/ "0300 0300 00A0",
+/*1460*/ "0300 0300 0020/00A0",
+/*1461*/ "0300/AC00",
+/*1462*/ "0300 0020/AC00",
+/*1463*/ "0300 0300/AC00",
+/*1464*/ "0300 0300 0020/AC00",
+/*1465*/ "0300/AC01",
+/*1466*/ "0300 0020/AC01",
+/*1467*/ "0300 0300/AC01",
+/*1468*/ "0300 0300 0020/AC01",
+/*1469*/ "0300 05D0",
+/*1470*/ "0300 0020/05D0",
+/*1471*/ "0300 0300 05D0",
+/*1472*/ "0300 0300 0020/05D0",
+/*1473*/ "0300 002D",
+/*1474*/ "0300 0020/002D",
+/*1475*/ "0300 0300 002D",
+/*1476*/ "0300 0300 0020/002D",
+/*1477*/ "0300/231A",
+/*1478*/ "0300 0020/231A",
+/*1479*/ "0300 0300/231A",
+/*1480*/ "0300 0300 0020/231A",
+/*1481*/ "0300 2024",
+/*1482*/ "0300 0020/2024",
+/*1483*/ "0300 0300 2024",
+/*1484*/ "0300 0300 0020/2024",
+/*1485*/ "0300 002C",
+/*1486*/ "0300 0020 002C",
+/*1487*/ "0300 0300 002C",
+/*1488*/ "0300 0300 0020 002C",
+/*1489*/ "0300/1100",
+/*1490*/ "0300 0020/1100",
+/*1491*/ "0300 0300/1100",
+/*1492*/ "0300 0300 0020/1100",
+/*1493*/ "0300/11A8",
+/*1494*/ "0300 0020/11A8",
+/*1495*/ "0300 0300/11A8",
+/*1496*/ "0300 0300 0020/11A8",
+/*1497*/ "0300/1160",
+/*1498*/ "0300 0020/1160",
+/*1499*/ "0300 0300/1160",
+/*1500*/ "0300 0300 0020/1160",
+/*1501*/ "0300 000A",
+/*1502*/ "0300 0020 000A",
+/*1503*/ "0300 0300 000A",
+/*1504*/ "0300 0300 0020 000A",
+/*1505*/ "0300 0085",
+/*1506*/ "0300 0020 0085",
+/*1507*/ "0300 0300 0085",
+/*1508*/ "0300 0300 0020 0085",
+/*1509*/ "0300 17D6",
+/*1510*/ "0300 0020/17D6",
+/*1511*/ "0300 0300 17D6",
+/*1512*/ "0300 0300 0020/17D6",
+/*1513*/ "0300 0030",
+/*1514*/ "0300 0020/0030",
+/*1515*/ "0300 0300 0030",
+/*1516*/ "0300 0300 0020/0030",
+/*1517*/ "0300 0028",
+/*1518*/ "0300 0020/0028",
+/*1519*/ "0300 0300 0028",
+/*1520*/ "0300 0300 0020/0028",
+/*1521*/ "0300/0025",
+/*1522*/ "0300 0020/0025",
+/*1523*/ "0300 0300/0025",
+/*1524*/ "0300 0300 0020/0025",
+/*1525*/ "0300/0024",
+/*1526*/ "0300 0020/0024",
+/*1527*/ "0300 0300/0024",
+/*1528*/ "0300 0300 0020/0024",
+/*1529*/ "0300 0022",
+/*1530*/ "0300 0020/0022",
+/*1531*/ "0300 0300 0022",
+/*1532*/ "0300 0300 0020/0022",
+/*1533*/ "0300/1F1E6",
+/*1534*/ "0300 0020/1F1E6",
+/*1535*/ "0300 0300/1F1E6",
+/*1536*/ "0300 0300 0020/1F1E6",
+/*1537*/ "0300 0E01",
+/*1538*/ "0300 0020/0E01",
+/*1539*/ "0300 0300 0E01",
+/*1540*/ "0300 0300 0020/0E01",
+/*1541*/ "0300 0E31",
+/*1542*/ "0300 0020/0E31",
+/*1543*/ "0300 0300 0E31",
+/*1544*/ "0300 0300 0020/0E31",
+/*1545*/ "0300 0020",
+/*1546*/ "0300 0020 0020",
+/*1547*/ "0300 0300 0020",
+/*1548*/ "0300 0300 0020 0020",
+/*1549*/ "0300 002F",
+/*1550*/ "0300 0020 002F",
+/*1551*/ "0300 0300 002F",
+/*1552*/ "0300 0300 0020 002F",
+/*1553*/ "0300 2060",
+/*1554*/ "0300 0020 2060",
+/*1555*/ "0300 0300 2060",
+/*1556*/ "0300 0300 0020 2060",
+/*1557*/ "0300 200B",
+/*1558*/ "0300 0020 200B",
+/*1559*/ "0300 0300 200B",
+/*1560*/ "0300 0300 0020 200B",
+/*1561*/ "0029 00A7",
+/*1562*/ "0029 0020/00A7",
+/*1563*/ "0029 0300 00A7",
+/*1564*/ "0029 0300 0020/00A7",
+/*1565*/ "0029 0023",
+/*1566*/ "0029 0020/0023",
+/*1567*/ "0029 0300 0023",
+/*1568*/ "0029 0300 0020/0023",
+/*1569*/ "0029/2014",
+/*1570*/ "0029 0020/2014",
+/*1571*/ "0029 0300/2014",
+/*1572*/ "0029 0300 0020/2014",
+/*1573*/ "0029 007C",
+/*1574*/ "0029 0020/007C",
+/*1575*/ "0029 0300 007C",
+/*1576*/ "0029 0300 0020/007C",
+/*1577*/ "0029/00B4",
+/*1578*/ "0029 0020/00B4",
+/*1579*/ "0029 0300/00B4",
+/*1580*/ "0029 0300 0020/00B4",
+/*1581*/ "0029 2028",
+/*1582*/ "0029 0020 2028",
+/*1583*/ "0029 0300 2028",
+/*1584*/ "0029 0300 0020 2028",
+/*1585*/ "0029/FFFC",
+/*1586*/ "0029 0020/FFFC",
+/*1587*/ "0029 0300/FFFC",
+/*1588*/ "0029 0300 0020/FFFC",
+/*1589*/ "0029 3041",
+/*1590*/ "0029 0020 3041",
+/*1591*/ "0029 0300 3041",
+/*1592*/ "0029 0300 0020 3041",
+/*1593*/ "0029 007D",
+/*1594*/ "0029 0020 007D",
+/*1595*/ "0029 0300 007D",
+/*1596*/ "0029 0300 0020 007D",
+/*1597*/ "0029 0300",
+/*1598*/ "0029 0020/0300",
+/*1599*/ "0029 0300 0300",
+/*1600*/ "0029 0300 0020/0300",
+/*1601*/ "0029 0029",
+/*1602*/ "0029 0020 0029",
+/*1603*/ "0029 0300 0029",
+/*1604*/ "0029 0300 0020 0029",
+/*1605*/ "0029 000D",
+/*1606*/ "0029 0020 000D",
+/*1607*/ "0029 0300 000D",
+/*1608*/ "0029 0300 0020 000D",
+/*1609*/ "0029 0021",
+/*1610*/ "0029 0020 0021",
+/*1611*/ "0029 0300 0021",
+/*1612*/ "0029 0300 0020 0021",
+/*1613*/ "0029 00A0",
+/*1614*/ "0029 0020/00A0",
+/*1615*/ "0029 0300 00A0",
+/*1616*/ "0029 0300 0020/00A0",
+/*1617*/ "0029/AC00",
+/*1618*/ "0029 0020/AC00",
+/*1619*/ "0029 0300/AC00",
+/*1620*/ "0029 0300 0020/AC00",
+/*1621*/ "0029/AC01",
+/*1622*/ "0029 0020/AC01",
+/*1623*/ "0029 0300/AC01",
+/*1624*/ "0029 0300 0020/AC01",
+/*1625*/ "0029 05D0",
+/*1626*/ "0029 0020/05D0",
+/*1627*/ "0029 0300 05D0",
+/*1628*/ "0029 0300 0020/05D0",
+/*1629*/ "0029 002D",
+/*1630*/ "0029 0020/002D",
+/*1631*/ "0029 0300 002D",
+/*1632*/ "0029 0300 0020/002D",
+/*1633*/ "0029/231A",
+/*1634*/ "0029 0020/231A",
+/*1635*/ "0029 0300/231A",
+/*1636*/ "0029 0300 0020/231A",
+/*1637*/ "0029/2024",
+/*1638*/ "0029 0020/2024",
+/*1639*/ "0029 0300/2024",
+/*1640*/ "0029 0300 0020/2024",
+/*1641*/ "0029 002C",
+/*1642*/ "0029 0020 002C",
+/*1643*/ "0029 0300 002C",
+/*1644*/ "0029 0300 0020 002C",
+/*1645*/ "0029/1100",
+/*1646*/ "0029 0020/1100",
+/*1647*/ "0029 0300/1100",
+/*1648*/ "0029 0300 0020/1100",
+/*1649*/ "0029/11A8",
+/*1650*/ "0029 0020/11A8",
+/*1651*/ "0029 0300/11A8",
+/*1652*/ "0029 0300 0020/11A8",
+/*1653*/ "0029/1160",
+/*1654*/ "0029 0020/1160",
+/*1655*/ "0029 0300/1160",
+/*1656*/ "0029 0300 0020/1160",
+/*1657*/ "0029 000A",
+/*1658*/ "0029 0020 000A",
+/*1659*/ "0029 0300 000A",
+/*1660*/ "0029 0300 0020 000A",
+/*1661*/ "0029 0085",
+/*1662*/ "0029 0020 0085",
+/*1663*/ "0029 0300 0085",
+/*1664*/ "0029 0300 0020 0085",
+/*1665*/ "0029 17D6",
+/*1666*/ "0029 0020 17D6",
+/*1667*/ "0029 0300 17D6",
+/*1668*/ "0029 0300 0020 17D6",
+/*1669*/ "0029 0030",
+/*1670*/ "0029 0020/0030",
+/*1671*/ "0029 0300 0030",
+/*1672*/ "0029 0300 0020/0030",
+/*1673*/ "0029/0028",
+/*1674*/ "0029 0020/0028",
+/*1675*/ "0029 0300/0028",
+/*1676*/ "0029 0300 0020/0028",
+/*1677*/ "0029 0025",
+/*1678*/ "0029 0020/0025",
+/*1679*/ "0029 0300 0025",
+/*1680*/ "0029 0300 0020/0025",
+/*1681*/ "0029 0024",
+/*1682*/ "0029 0020/0024",
+/*1683*/ "0029 0300 0024",
+/*1684*/ "0029 0300 0020/0024",
+/*1685*/ "0029 0022",
+/*1686*/ "0029 0020/0022",
+/*1687*/ "0029 0300 0022",
+/*1688*/ "0029 0300 0020/0022",
+/*1689*/ "0029/1F1E6",
+/*1690*/ "0029 0020/1F1E6",
+/*1691*/ "0029 0300/1F1E6",
+/*1692*/ "0029 0300 0020/1F1E6",
+/*1693*/ "0029 0E01",
+/*1694*/ "0029 0020/0E01",
+/*1695*/ "0029 0300 0E01",
+/*1696*/ "0029 0300 0020/0E01",
+/*1697*/ "0029 0E31",
+/*1698*/ "0029 0020/0E31",
+/*1699*/ "0029 0300 0E31",
+/*1700*/ "0029 0300 0020/0E31",
+/*1701*/ "0029 0020",
+/*1702*/ "0029 0020 0020",
+/*1703*/ "0029 0300 0020",
+/*1704*/ "0029 0300 0020 0020",
+/*1705*/ "0029 002F",
+/*1706*/ "0029 0020 002F",
+/*1707*/ "0029 0300 002F",
+/*1708*/ "0029 0300 0020 002F",
+/*1709*/ "0029 2060",
+/*1710*/ "0029 0020 2060",
+/*1711*/ "0029 0300 2060",
+/*1712*/ "0029 0300 0020 2060",
+/*1713*/ "0029 200B",
+/*1714*/ "0029 0020 200B",
+/*1715*/ "0029 0300 200B",
+/*1716*/ "0029 0300 0020 200B",
+/*1717*/ "000D/00A7",
+/*1718*/ "000D/0020/00A7",
+/*1719*/ "000D/0300 00A7",
+/*1720*/ "000D/0300 0020/00A7",
+/*1721*/ "000D/0023",
+/*1722*/ "000D/0020/0023",
+/*1723*/ "000D/0300 0023",
+/*1724*/ "000D/0300 0020/0023",
+/*1725*/ "000D/2014",
+/*1726*/ "000D/0020/2014",
+/*1727*/ "000D/0300/2014",
+/*1728*/ "000D/0300 0020/2014",
+/*1729*/ "000D/007C",
+/*1730*/ "000D/0020/007C",
+/*1731*/ "000D/0300 007C",
+/*1732*/ "000D/0300 0020/007C",
+/*1733*/ "000D/00B4",
+/*1734*/ "000D/0020/00B4",
+/*1735*/ "000D/0300/00B4",
+/*1736*/ "000D/0300 0020/00B4",
+/*1737*/ "000D/2028",
+/*1738*/ "000D/0020 2028",
+/*1739*/ "000D/0300 2028",
+/*1740*/ "000D/0300 0020 2028",
+/*1741*/ "000D/FFFC",
+/*1742*/ "000D/0020/FFFC",
+/*1743*/ "000D/0300/FFFC",
+/*1744*/ "000D/0300 0020/FFFC",
+/*1745*/ "000D/3041",
+/*1746*/ "000D/0020/3041",
+/*1747*/ "000D/0300 3041",
+/*1748*/ "000D/0300 0020/3041",
+/*1749*/ "000D/007D",
+/*1750*/ "000D/0020 007D",
+/*1751*/ "000D/0300 007D",
+/*1752*/ "000D/0300 0020 007D",
+/*1753*/ "000D/0300",
+/*1754*/ "000D/0020/0300",
+/*1755*/ "000D/0300 0300",
+/*1756*/ "000D/0300 0020/0300",
+/*1757*/ "000D/0029",
+/*1758*/ "000D/0020 0029",
+/*1759*/ "000D/0300 0029",
+/*1760*/ "000D/0300 0020 0029",
+/*1761*/ "000D/000D",
+/*1762*/ "000D/0020 000D",
+/*1763*/ "000D/0300 000D",
+/*1764*/ "000D/0300 0020 000D",
+/*1765*/ "000D/0021",
+/*1766*/ "000D/0020 0021",
+/*1767*/ "000D/0300 0021",
+/*1768*/ "000D/0300 0020 0021",
+/*1769*/ "000D/00A0",
+/*1770*/ "000D/0020/00A0",
+/*1771*/ "000D/0300 00A0",
+/*1772*/ "000D/0300 0020/00A0",
+/*1773*/ "000D/AC00",
+/*1774*/ "000D/0020/AC00",
+/*1775*/ "000D/0300/AC00",
+/*1776*/ "000D/0300 0020/AC00",
+/*1777*/ "000D/AC01",
+/*1778*/ "000D/0020/AC01",
+/*1779*/ "000D/0300/AC01",
+/*1780*/ "000D/0300 0020/AC01",
+/*1781*/ "000D/05D0",
+/*1782*/ "000D/0020/05D0",
+/*1783*/ "000D/0300 05D0",
+/*1784*/ "000D/0300 0020/05D0",
+/*1785*/ "000D/002D",
+/*1786*/ "000D/0020/002D",
+/*1787*/ "000D/0300 002D",
+/*1788*/ "000D/0300 0020/002D",
+/*1789*/ "000D/231A",
+/*1790*/ "000D/0020/231A",
+/*1791*/ "000D/0300/231A",
+/*1792*/ "000D/0300 0020/231A",
+/*1793*/ "000D/2024",
+/*1794*/ "000D/0020/2024",
+/*1795*/ "000D/0300 2024",
+/*1796*/ "000D/0300 0020/2024",
+/*1797*/ "000D/002C",
+/*1798*/ "000D/0020 002C",
+/*1799*/ "000D/0300 002C",
+/*1800*/ "000D/0300 0020 002C",
+/*1801*/ "000D/1100",
+/*1802*/ "000D/0020/1100",
+/*1803*/ "000D/0300/1100",
+/*1804*/ "000D/0300 0020/1100",
+/*1805*/ "000D/11A8",
+/*1806*/ "000D/0020/11A8",
+/*1807*/ "000D/0300/11A8",
+/*1808*/ "000D/0300 0020/11A8",
+/*1809*/ "000D/1160",
+/*1810*/ "000D/0020/1160",
+/*1811*/ "000D/0300/1160",
+/*1812*/ "000D/0300 0020/1160",
+/*1813*/ "000D 000A",
+/*1814*/ "000D/0020 000A",
+/*1815*/ "000D/0300 000A",
+/*1816*/ "000D/0300 0020 000A",
+/*1817*/ "000D/0085",
+/*1818*/ "000D/0020 0085",
+/*1819*/ "000D/0300 0085",
+/*1820*/ "000D/0300 0020 0085",
+/*1821*/ "000D/17D6",
+/*1822*/ "000D/0020/17D6",
+/*1823*/ "000D/0300 17D6",
+/*1824*/ "000D/0300 0020/17D6",
+/*1825*/ "000D/0030",
+/*1826*/ "000D/0020/0030",
+/*1827*/ "000D/0300 0030",
+/*1828*/ "000D/0300 0020/0030",
+/*1829*/ "000D/0028",
+/*1830*/ "000D/0020/0028",
+/*1831*/ "000D/0300 0028",
+/*1832*/ "000D/0300 0020/0028",
+/*1833*/ "000D/0025",
+/*1834*/ "000D/0020/0025",
+/*1835*/ "000D/0300/0025",
+/*1836*/ "000D/0300 0020/0025",
+/*1837*/ "000D/0024",
+/*1838*/ "000D/0020/0024",
+/*1839*/ "000D/0300/0024",
+/*1840*/ "000D/0300 0020/0024",
+/*1841*/ "000D/0022",
+/*1842*/ "000D/0020/0022",
+/*1843*/ "000D/0300 0022",
+/*1844*/ "000D/0300 0020/0022",
+/*1845*/ "000D/1F1E6",
+/*1846*/ "000D/0020/1F1E6",
+/*1847*/ "000D/0300/1F1E6",
+/*1848*/ "000D/0300 0020/1F1E6",
+/*1849*/ "000D/0E01",
+/*1850*/ "000D/0020/0E01",
+/*1851*/ "000D/0300 0E01",
+/*1852*/ "000D/0300 0020/0E01",
+/*1853*/ "000D/0E31",
+/*1854*/ "000D/0020/0E31",
+/*1855*/ "000D/0300 0E31",
+/*1856*/ "000D/0300 0020/0E31",
+/*1857*/ "000D/0020",
+/*1858*/ "000D/0020 0020",
+/*1859*/ "000D/0300 0020",
+/*1860*/ "000D/0300 0020 0020",
+/*1861*/ "000D/002F",
+/*1862*/ "000D/0020 002F",
+/*1863*/ "000D/0300 002F",
+/*1864*/ "000D/0300 0020 002F",
+/*1865*/ "000D/2060",
+/*1866*/ "000D/0020 2060",
+/*1867*/ "000D/0300 2060",
+/*1868*/ "000D/0300 0020 2060",
+/*1869*/ "000D/200B",
+/*1870*/ "000D/0020 200B",
+/*1871*/ "000D/0300 200B",
+/*1872*/ "000D/0300 0020 200B",
+/*1873*/ "0021/00A7",
+/*1874*/ "0021 0020/00A7",
+/*1875*/ "0021 0300/00A7",
+/*1876*/ "0021 0300 0020/00A7",
+/*1877*/ "0021/0023",
+/*1878*/ "0021 0020/0023",
+/*1879*/ "0021 0300/0023",
+/*1880*/ "0021 0300 0020/0023",
+/*1881*/ "0021/2014",
+/*1882*/ "0021 0020/2014",
+/*1883*/ "0021 0300/2014",
+/*1884*/ "0021 0300 0020/2014",
+/*1885*/ "0021 007C",
+/*1886*/ "0021 0020/007C",
+/*1887*/ "0021 0300 007C",
+/*1888*/ "0021 0300 0020/007C",
+/*1889*/ "0021/00B4",
+/*1890*/ "0021 0020/00B4",
+/*1891*/ "0021 0300/00B4",
+/*1892*/ "0021 0300 0020/00B4",
+/*1893*/ "0021 2028",
+/*1894*/ "0021 0020 2028",
+/*1895*/ "0021 0300 2028",
+/*1896*/ "0021 0300 0020 2028",
+/*1897*/ "0021/FFFC",
+/*1898*/ "0021 0020/FFFC",
+/*1899*/ "0021 0300/FFFC",
+/*1900*/ "0021 0300 0020/FFFC",
+/*1901*/ "0021 3041",
+/*1902*/ "0021 0020/3041",
+/*1903*/ "0021 0300 3041",
+/*1904*/ "0021 0300 0020/3041",
+/*1905*/ "0021 007D",
+/*1906*/ "0021 0020 007D",
+/*1907*/ "0021 0300 007D",
+/*1908*/ "0021 0300 0020 007D",
+/*1909*/ "0021 0300",
+/*1910*/ "0021 0020/0300",
+/*1911*/ "0021 0300 0300",
+/*1912*/ "0021 0300 0020/0300",
+/*1913*/ "0021 0029",
+/*1914*/ "0021 0020 0029",
+/*1915*/ "0021 0300 0029",
+/*1916*/ "0021 0300 0020 0029",
+/*1917*/ "0021 000D",
+/*1918*/ "0021 0020 000D",
+/*1919*/ "0021 0300 000D",
+/*1920*/ "0021 0300 0020 000D",
+/*1921*/ "0021 0021",
+/*1922*/ "0021 0020 0021",
+/*1923*/ "0021 0300 0021",
+/*1924*/ "0021 0300 0020 0021",
+/*1925*/ "0021 00A0",
+/*1926*/ "0021 0020/00A0",
+/*1927*/ "0021 0300 00A0",
+/*1928*/ "0021 0300 0020/00A0",
+/*1929*/ "0021/AC00",
+/*1930*/ "0021 0020/AC00",
+/*1931*/ "0021 0300/AC00",
+/*1932*/ "0021 0300 0020/AC00",
+/*1933*/ "0021/AC01",
+/*1934*/ "0021 0020/AC01",
+/*1935*/ "0021 0300/AC01",
+/*1936*/ "0021 0300 0020/AC01",
+/*1937*/ "0021/05D0",
+/*1938*/ "0021 0020/05D0",
+/*1939*/ "0021 0300/05D0",
+/*1940*/ "0021 0300 0020/05D0",
+/*1941*/ "0021 002D",
+/*1942*/ "0021 0020/002D",
+/*1943*/ "0021 0300 002D",
+/*1944*/ "0021 0300 0020/002D",
+/*1945*/ "0021/231A",
+/*1946*/ "0021 0020/231A",
+/*1947*/ "0021 0300/231A",
+/*1948*/ "0021 0300 0020/231A",
+/*1949*/ "0021 2024",
+/*1950*/ "0021 0020/2024",
+/*1951*/ "0021 0300 2024",
+/*1952*/ "0021 0300 0020/2024",
+/*1953*/ "0021 002C",
+/*1954*/ "0021 0020 002C",
+/*1955*/ "0021 0300 002C",
+/*1956*/ "0021 0300 0020 002C",
+/*1957*/ "0021/1100",
+/*1958*/ "0021 0020/1100",
+/*1959*/ "0021 0300/1100",
+/*1960*/ "0021 0300 0020/1100",
+/*1961*/ "0021/11A8",
+/*1962*/ "0021 0020/11A8",
+/*1963*/ "0021 0300/11A8",
+/*1964*/ "0021 0300 0020/11A8",
+/*1965*/ "0021/1160",
+/*1966*/ "0021 0020/1160",
+/*1967*/ "0021 0300/1160",
+/*1968*/ "0021 0300 0020/1160",
+/*1969*/ "0021 000A",
+/*1970*/ "0021 0020 000A",
+/*1971*/ "0021 0300 000A",
+/*1972*/ "0021 0300 0020 000A",
+/*1973*/ "0021 0085",
+/*1974*/ "0021 0020 0085",
+/*1975*/ "0021 0300 0085",
+/*1976*/ "0021 0300 0020 0085",
+/*1977*/ "0021 17D6",
+/*1978*/ "0021 0020/17D6",
+/*1979*/ "0021 0300 17D6",
+/*1980*/ "0021 0300 0020/17D6",
+/*1981*/ "0021/0030",
+/*1982*/ "0021 0020/0030",
+/*1983*/ "0021 0300/0030",
+/*1984*/ "0021 0300 0020/0030",
+/*1985*/ "0021/0028",
+/*1986*/ "0021 0020/0028",
+/*1987*/ "0021 0300/0028",
+/*1988*/ "0021 0300 0020/0028",
+/*1989*/ "0021/0025",
+/*1990*/ "0021 0020/0025",
+/*1991*/ "0021 0300/0025",
+/*1992*/ "0021 0300 0020/0025",
+/*1993*/ "0021/0024",
+/*1994*/ "0021 0020/0024",
+/*1995*/ "0021 0300/0024",
+/*1996*/ "0021 0300 0020/0024",
+/*1997*/ "0021 0022",
+/*1998*/ "0021 0020/0022",
+/*1999*/ "0021 0300 0022",
+/*2000*/ "0021 0300 0020/0022",
+/*2001*/ "0021/1F1E6",
+/*2002*/ "0021 0020/1F1E6",
+/*2003*/ "0021 0300/1F1E6",
+/*2004*/ "0021 0300 0020/1F1E6",
+/*2005*/ "0021/0E01",
+/*2006*/ "0021 0020/0E01",
+/*2007*/ "0021 0300/0E01",
+/*2008*/ "0021 0300 0020/0E01",
+/*2009*/ "0021 0E31",
+/*2010*/ "0021 0020/0E31",
+/*2011*/ "0021 0300 0E31",
+/*2012*/ "0021 0300 0020/0E31",
+/*2013*/ "0021 0020",
+/*2014*/ "0021 0020 0020",
+/*2015*/ "0021 0300 0020",
+/*2016*/ "0021 0300 0020 0020",
+/*2017*/ "0021 002F",
+/*2018*/ "0021 0020 002F",
+/*2019*/ "0021 0300 002F",
+/*2020*/ "0021 0300 0020 002F",
+/*2021*/ "0021 2060",
+/*2022*/ "0021 0020 2060",
+/*2023*/ "0021 0300 2060",
+/*2024*/ "0021 0300 0020 2060",
+/*2025*/ "0021 200B",
+/*2026*/ "0021 0020 200B",
+/*2027*/ "0021 0300 200B",
+/*2028*/ "0021 0300 0020 200B",
+/*2029*/ "00A0 00A7",
+/*2030*/ "00A0 0020/00A7",
+/*2031*/ "00A0 0300 00A7",
+/*2032*/ "00A0 0300 0020/00A7",
+/*2033*/ "00A0 0023",
+/*2034*/ "00A0 0020/0023",
+/*2035*/ "00A0 0300 0023",
+/*2036*/ "00A0 0300 0020/0023",
+/*2037*/ "00A0 2014",
+/*2038*/ "00A0 0020/2014",
+/*2039*/ "00A0 0300 2014",
+/*2040*/ "00A0 0300 0020/2014",
+/*2041*/ "00A0 007C",
+/*2042*/ "00A0 0020/007C",
+/*2043*/ "00A0 0300 007C",
+/*2044*/ "00A0 0300 0020/007C",
+/*2045*/ "00A0 00B4",
+/*2046*/ "00A0 0020/00B4",
+/*2047*/ "00A0 0300 00B4",
+/*2048*/ "00A0 0300 0020/00B4",
+/*2049*/ "00A0 2028",
+/*2050*/ "00A0 0020 2028",
+/*2051*/ "00A0 0300 2028",
+/*2052*/ "00A0 0300 0020 2028",
+/*2053*/ "00A0 FFFC",
+/*2054*/ "00A0 0020/FFFC",
+/*2055*/ "00A0 0300 FFFC",
+/*2056*/ "00A0 0300 0020/FFFC",
+/*2057*/ "00A0 3041",
+/*2058*/ "00A0 0020/3041",
+/*2059*/ "00A0 0300 3041",
+/*2060*/ "00A0 0300 0020/3041",
+/*2061*/ "00A0 007D",
+/*2062*/ "00A0 0020 007D",
+/*2063*/ "00A0 0300 007D",
+/*2064*/ "00A0 0300 0020 007D",
+/*2065*/ "00A0 0300",
+/*2066*/ "00A0 0020/0300",
+/*2067*/ "00A0 0300 0300",
+/*2068*/ "00A0 0300 0020/0300",
+/*2069*/ "00A0 0029",
+/*2070*/ "00A0 0020 0029",
+/*2071*/ "00A0 0300 0029",
+/*2072*/ "00A0 0300 0020 0029",
+/*2073*/ "00A0 000D",
+/*2074*/ "00A0 0020 000D",
+/*2075*/ "00A0 0300 000D",
+/*2076*/ "00A0 0300 0020 000D",
+/*2077*/ "00A0 0021",
+/*2078*/ "00A0 0020 0021",
+/*2079*/ "00A0 0300 0021",
+/*2080*/ "00A0 0300 0020 0021",
+/*2081*/ "00A0 00A0",
+/*2082*/ "00A0 0020/00A0",
+/*2083*/ "00A0 0300 00A0",
+/*2084*/ "00A0 0300 0020/00A0",
+/*2085*/ "00A0 AC00",
+/*2086*/ "00A0 0020/AC00",
+/*2087*/ "00A0 0300 AC00",
+/*2088*/ "00A0 0300 0020/AC00",
+/*2089*/ "00A0 AC01",
+/*2090*/ "00A0 0020/AC01",
+/*2091*/ "00A0 0300 AC01",
+/*2092*/ "00A0 0300 0020/AC01",
+/*2093*/ "00A0 05D0",
+/*2094*/ "00A0 0020/05D0",
+/*2095*/ "00A0 0300 05D0",
+/*2096*/ "00A0 0300 0020/05D0",
+/*2097*/ "00A0 002D",
+/*2098*/ "00A0 0020/002D",
+/*2099*/ "00A0 0300 002D",
+/*2100*/ "00A0 0300 0020/002D",
+/*2101*/ "00A0 231A",
+/*2102*/ "00A0 0020/231A",
+/*2103*/ "00A0 0300 231A",
+/*2104*/ "00A0 0300 0020/231A",
+/*2105*/ "00A0 2024",
+/*2106*/ "00A0 0020/2024",
+/*2107*/ "00A0 0300 2024",
+/*2108*/ "00A0 0300 0020/2024",
+/*2109*/ "00A0 002C",
+/*2110*/ "00A0 0020 002C",
+/*2111*/ "00A0 0300 002C",
+/*2112*/ "00A0 0300 0020 002C",
+/*2113*/ "00A0 1100",
+/*2114*/ "00A0 0020/1100",
+/*2115*/ "00A0 0300 1100",
+/*2116*/ "00A0 0300 0020/1100",
+/*2117*/ "00A0 11A8",
+/*2118*/ "00A0 0020/11A8",
+/*2119*/ "00A0 0300 11A8",
+/*2120*/ "00A0 0300 0020/11A8",
+/*2121*/ "00A0 1160",
+/*2122*/ "00A0 0020/1160",
+/*2123*/ "00A0 0300 1160",
+/*2124*/ "00A0 0300 0020/1160",
+/*2125*/ "00A0 000A",
+/*2126*/ "00A0 0020 000A",
+/*2127*/ "00A0 0300 000A",
+/*2128*/ "00A0 0300 0020 000A",
+/*2129*/ "00A0 0085",
+/*2130*/ "00A0 0020 0085",
+/*2131*/ "00A0 0300 0085",
+/*2132*/ "00A0 0300 0020 0085",
+/*2133*/ "00A0 17D6",
+/*2134*/ "00A0 0020/17D6",
+/*2135*/ "00A0 0300 17D6",
+/*2136*/ "00A0 0300 0020/17D6",
+/*2137*/ "00A0 0030",
+/*2138*/ "00A0 0020/0030",
+/*2139*/ "00A0 0300 0030",
+/*2140*/ "00A0 0300 0020/0030",
+/*2141*/ "00A0 0028",
+/*2142*/ "00A0 0020/0028",
+/*2143*/ "00A0 0300 0028",
+/*2144*/ "00A0 0300 0020/0028",
+/*2145*/ "00A0 0025",
+/*2146*/ "00A0 0020/0025",
+/*2147*/ "00A0 0300 0025",
+/*2148*/ "00A0 0300 0020/0025",
+/*2149*/ "00A0 0024",
+/*2150*/ "00A0 0020/0024",
+/*2151*/ "00A0 0300 0024",
+/*2152*/ "00A0 0300 0020/0024",
+/*2153*/ "00A0 0022",
+/*2154*/ "00A0 0020/0022",
+/*2155*/ "00A0 0300 0022",
+/*2156*/ "00A0 0300 0020/0022",
+/*2157*/ "00A0 1F1E6",
+/*2158*/ "00A0 0020/1F1E6",
+/*2159*/ "00A0 0300 1F1E6",
+/*2160*/ "00A0 0300 0020/1F1E6",
+/*2161*/ "00A0 0E01",
+/*2162*/ "00A0 0020/0E01",
+/*2163*/ "00A0 0300 0E01",
+/*2164*/ "00A0 0300 0020/0E01",
+/*2165*/ "00A0 0E31",
+/*2166*/ "00A0 0020/0E31",
+/*2167*/ "00A0 0300 0E31",
+/*2168*/ "00A0 0300 0020/0E31",
+/*2169*/ "00A0 0020",
+/*2170*/ "00A0 0020 0020",
+/*2171*/ "00A0 0300 0020",
+/*2172*/ "00A0 0300 0020 0020",
+/*2173*/ "00A0 002F",
+/*2174*/ "00A0 0020 002F",
+/*2175*/ "00A0 0300 002F",
+/*2176*/ "00A0 0300 0020 002F",
+/*2177*/ "00A0 2060",
+/*2178*/ "00A0 0020 2060",
+/*2179*/ "00A0 0300 2060",
+/*2180*/ "00A0 0300 0020 2060",
+/*2181*/ "00A0 200B",
+/*2182*/ "00A0 0020 200B",
+/*2183*/ "00A0 0300 200B",
+/*2184*/ "00A0 0300 0020 200B",
+/*2185*/ "AC00/00A7",
+/*2186*/ "AC00 0020/00A7",
+/*2187*/ "AC00 0300/00A7",
+/*2188*/ "AC00 0300 0020/00A7",
+/*2189*/ "AC00/0023",
+/*2190*/ "AC00 0020/0023",
+/*2191*/ "AC00 0300/0023",
+/*2192*/ "AC00 0300 0020/0023",
+/*2193*/ "AC00/2014",
+/*2194*/ "AC00 0020/2014",
+/*2195*/ "AC00 0300/2014",
+/*2196*/ "AC00 0300 0020/2014",
+/*2197*/ "AC00 007C",
+/*2198*/ "AC00 0020/007C",
+/*2199*/ "AC00 0300 007C",
+/*2200*/ "AC00 0300 0020/007C",
+/*2201*/ "AC00/00B4",
+/*2202*/ "AC00 0020/00B4",
+/*2203*/ "AC00 0300/00B4",
+/*2204*/ "AC00 0300 0020/00B4",
+/*2205*/ "AC00 2028",
+/*2206*/ "AC00 0020 2028",
+/*2207*/ "AC00 0300 2028",
+/*2208*/ "AC00 0300 0020 2028",
+/*2209*/ "AC00/FFFC",
+/*2210*/ "AC00 0020/FFFC",
+/*2211*/ "AC00 0300/FFFC",
+/*2212*/ "AC00 0300 0020/FFFC",
+/*2213*/ "AC00 3041",
+/*2214*/ "AC00 0020/3041",
+/*2215*/ "AC00 0300 3041",
+/*2216*/ "AC00 0300 0020/3041",
+/*2217*/ "AC00 007D",
+/*2218*/ "AC00 0020 007D",
+/*2219*/ "AC00 0300 007D",
+/*2220*/ "AC00 0300 0020 007D",
+/*2221*/ "AC00 0300",
+/*2222*/ "AC00 0020/0300",
+/*2223*/ "AC00 0300 0300",
+/*2224*/ "AC00 0300 0020/0300",
+/*2225*/ "AC00 0029",
+/*2226*/ "AC00 0020 0029",
+/*2227*/ "AC00 0300 0029",
+/*2228*/ "AC00 0300 0020 0029",
+/*2229*/ "AC00 000D",
+/*2230*/ "AC00 0020 000D",
+/*2231*/ "AC00 0300 000D",
+/*2232*/ "AC00 0300 0020 000D",
+/*2233*/ "AC00 0021",
+/*2234*/ "AC00 0020 0021",
+/*2235*/ "AC00 0300 0021",
+/*2236*/ "AC00 0300 0020 0021",
+/*2237*/ "AC00 00A0",
+/*2238*/ "AC00 0020/00A0",
+/*2239*/ "AC00 0300 00A0",
+/*2240*/ "AC00 0300 0020/00A0",
+/*2241*/ "AC00/AC00",
+/*2242*/ "AC00 0020/AC00",
+/*2243*/ "AC00 0300/AC00",
+/*2244*/ "AC00 0300 0020/AC00",
+/*2245*/ "AC00/AC01",
+/*2246*/ "AC00 0020/AC01",
+/*2247*/ "AC00 0300/AC01",
+/*2248*/ "AC00 0300 0020/AC01",
+/*2249*/ "AC00/05D0",
+/*2250*/ "AC00 0020/05D0",
+/*2251*/ "AC00 0300/05D0",
+/*2252*/ "AC00 0300 0020/05D0",
+/*2253*/ "AC00 002D",
+/*2254*/ "AC00 0020/002D",
+/*2255*/ "AC00 0300 002D",
+/*2256*/ "AC00 0300 0020/002D",
+/*2257*/ "AC00/231A",
+/*2258*/ "AC00 0020/231A",
+/*2259*/ "AC00 0300/231A",
+/*2260*/ "AC00 0300 0020/231A",
+/*2261*/ "AC00 2024",
+/*2262*/ "AC00 0020/2024",
+/*2263*/ "AC00 0300 2024",
+/*2264*/ "AC00 0300 0020/2024",
+/*2265*/ "AC00 002C",
+/*2266*/ "AC00 0020 002C",
+/*2267*/ "AC00 0300 002C",
+/*2268*/ "AC00 0300 0020 002C",
+/*2269*/ "AC00/1100",
+/*2270*/ "AC00 0020/1100",
+/*2271*/ "AC00 0300/1100",
+/*2272*/ "AC00 0300 0020/1100",
+/*2273*/ "AC00 11A8",
+/*2274*/ "AC00 0020/11A8",
+/*2275*/ "AC00 0300 11A8",
+/*2276*/ "AC00 0300 0020/11A8",
+/*2277*/ "AC00 1160",
+/*2278*/ "AC00 0020/1160",
+/*2279*/ "AC00 0300 1160",
+/*2280*/ "AC00 0300 0020/1160",
+/*2281*/ "AC00 000A",
+/*2282*/ "AC00 0020 000A",
+/*2283*/ "AC00 0300 000A",
+/*2284*/ "AC00 0300 0020 000A",
+/*2285*/ "AC00 0085",
+/*2286*/ "AC00 0020 0085",
+/*2287*/ "AC00 0300 0085",
+/*2288*/ "AC00 0300 0020 0085",
+/*2289*/ "AC00 17D6",
+/*2290*/ "AC00 0020/17D6",
+/*2291*/ "AC00 0300 17D6",
+/*2292*/ "AC00 0300 0020/17D6",
+/*2293*/ "AC00/0030",
+/*2294*/ "AC00 0020/0030",
+/*2295*/ "AC00 0300/0030",
+/*2296*/ "AC00 0300 0020/0030",
+/*2297*/ "AC00/0028",
+/*2298*/ "AC00 0020/0028",
+/*2299*/ "AC00 0300/0028",
+/*2300*/ "AC00 0300 0020/0028",
+/*2301*/ "AC00 0025",
+/*2302*/ "AC00 0020/0025",
+/*2303*/ "AC00 0300 0025",
+/*2304*/ "AC00 0300 0020/0025",
+/*2305*/ "AC00/0024",
+/*2306*/ "AC00 0020/0024",
+/*2307*/ "AC00 0300/0024",
+/*2308*/ "AC00 0300 0020/0024",
+/*2309*/ "AC00 0022",
+/*2310*/ "AC00 0020/0022",
+/*2311*/ "AC00 0300 0022",
+/*2312*/ "AC00 0300 0020/0022",
+/*2313*/ "AC00/1F1E6",
+/*2314*/ "AC00 0020/1F1E6",
+/*2315*/ "AC00 0300/1F1E6",
+/*2316*/ "AC00 0300 0020/1F1E6",
+/*2317*/ "AC00/0E01",
+/*2318*/ "AC00 0020/0E01",
+/*2319*/ "AC00 0300/0E01",
+/*2320*/ "AC00 0300 0020/0E01",
+/*2321*/ "AC00 0E31",
+/*2322*/ "AC00 0020/0E31",
+/*2323*/ "AC00 0300 0E31",
+/*2324*/ "AC00 0300 0020/0E31",
+/*2325*/ "AC00 0020",
+/*2326*/ "AC00 0020 0020",
+/*2327*/ "AC00 0300 0020",
+/*2328*/ "AC00 0300 0020 0020",
+/*2329*/ "AC00 002F",
+/*2330*/ "AC00 0020 002F",
+/*2331*/ "AC00 0300 002F",
+/*2332*/ "AC00 0300 0020 002F",
+/*2333*/ "AC00 2060",
+/*2334*/ "AC00 0020 2060",
+/*2335*/ "AC00 0300 2060",
+/*2336*/ "AC00 0300 0020 2060",
+/*2337*/ "AC00 200B",
+/*2338*/ "AC00 0020 200B",
+/*2339*/ "AC00 0300 200B",
+/*2340*/ "AC00 0300 0020 200B",
+/*2341*/ "AC01/00A7",
+/*2342*/ "AC01 0020/00A7",
+/*2343*/ "AC01 0300/00A7",
+/*2344*/ "AC01 0300 0020/00A7",
+/*2345*/ "AC01/0023",
+/*2346*/ "AC01 0020/0023",
+/*2347*/ "AC01 0300/0023",
+/*2348*/ "AC01 0300 0020/0023",
+/*2349*/ "AC01/2014",
+/*2350*/ "AC01 0020/2014",
+/*2351*/ "AC01 0300/2014",
+/*2352*/ "AC01 0300 0020/2014",
+/*2353*/ "AC01 007C",
+/*2354*/ "AC01 0020/007C",
+/*2355*/ "AC01 0300 007C",
+/*2356*/ "AC01 0300 0020/007C",
+/*2357*/ "AC01/00B4",
+/*2358*/ "AC01 0020/00B4",
+/*2359*/ "AC01 0300/00B4",
+/*2360*/ "AC01 0300 0020/00B4",
+/*2361*/ "AC01 2028",
+/*2362*/ "AC01 0020 2028",
+/*2363*/ "AC01 0300 2028",
+/*2364*/ "AC01 0300 0020 2028",
+/*2365*/ "AC01/FFFC",
+/*2366*/ "AC01 0020/FFFC",
+/*2367*/ "AC01 0300/FFFC",
+/*2368*/ "AC01 0300 0020/FFFC",
+/*2369*/ "AC01 3041",
+/*2370*/ "AC01 0020/3041",
+/*2371*/ "AC01 0300 3041",
+/*2372*/ "AC01 0300 0020/3041",
+/*2373*/ "AC01 007D",
+/*2374*/ "AC01 0020 007D",
+/*2375*/ "AC01 0300 007D",
+/*2376*/ "AC01 0300 0020 007D",
+/*2377*/ "AC01 0300",
+/*2378*/ "AC01 0020/0300",
+/*2379*/ "AC01 0300 0300",
+/*2380*/ "AC01 0300 0020/0300",
+/*2381*/ "AC01 0029",
+/*2382*/ "AC01 0020 0029",
+/*2383*/ "AC01 0300 0029",
+/*2384*/ "AC01 0300 0020 0029",
+/*2385*/ "AC01 000D",
+/*2386*/ "AC01 0020 000D",
+/*2387*/ "AC01 0300 000D",
+/*2388*/ "AC01 0300 0020 000D",
+/*2389*/ "AC01 0021",
+/*2390*/ "AC01 0020 0021",
+/*2391*/ "AC01 0300 0021",
+/*2392*/ "AC01 0300 0020 0021",
+/*2393*/ "AC01 00A0",
+/*2394*/ "AC01 0020/00A0",
+/*2395*/ "AC01 0300 00A0",
+/*2396*/ "AC01 0300 0020/00A0",
+/*2397*/ "AC01/AC00",
+/*2398*/ "AC01 0020/AC00",
+/*2399*/ "AC01 0300/AC00",
+/*2400*/ "AC01 0300 0020/AC00",
+/*2401*/ "AC01/AC01",
+/*2402*/ "AC01 0020/AC01",
+/*2403*/ "AC01 0300/AC01",
+/*2404*/ "AC01 0300 0020/AC01",
+/*2405*/ "AC01/05D0",
+/*2406*/ "AC01 0020/05D0",
+/*2407*/ "AC01 0300/05D0",
+/*2408*/ "AC01 0300 0020/05D0",
+/*2409*/ "AC01 002D",
+/*2410*/ "AC01 0020/002D",
+/*2411*/ "AC01 0300 002D",
+/*2412*/ "AC01 0300 0020/002D",
+/*2413*/ "AC01/231A",
+/*2414*/ "AC01 0020/231A",
+/*2415*/ "AC01 0300/231A",
+/*2416*/ "AC01 0300 0020/231A",
+/*2417*/ "AC01 2024",
+/*2418*/ "AC01 0020/2024",
+/*2419*/ "AC01 0300 2024",
+/*2420*/ "AC01 0300 0020/2024",
+/*2421*/ "AC01 002C",
+/*2422*/ "AC01 0020 002C",
+/*2423*/ "AC01 0300 002C",
+/*2424*/ "AC01 0300 0020 002C",
+/*2425*/ "AC01/1100",
+/*2426*/ "AC01 0020/1100",
+/*2427*/ "AC01 0300/1100",
+/*2428*/ "AC01 0300 0020/1100",
+/*2429*/ "AC01 11A8",
+/*2430*/ "AC01 0020/11A8",
+/*2431*/ "AC01 0300 11A8",
+/*2432*/ "AC01 0300 0020/11A8",
+/*2433*/ "AC01/1160",
+/*2434*/ "AC01 0020/1160",
+/*2435*/ "AC01 0300/1160",
+/*2436*/ "AC01 0300 0020/1160",
+/*2437*/ "AC01 000A",
+/*2438*/ "AC01 0020 000A",
+/*2439*/ "AC01 0300 000A",
+/*2440*/ "AC01 0300 0020 000A",
+/*2441*/ "AC01 0085",
+/*2442*/ "AC01 0020 0085",
+/*2443*/ "AC01 0300 0085",
+/*2444*/ "AC01 0300 0020 0085",
+/*2445*/ "AC01 17D6",
+/*2446*/ "AC01 0020/17D6",
+/*2447*/ "AC01 0300 17D6",
+/*2448*/ "AC01 0300 0020/17D6",
+/*2449*/ "AC01/0030",
+/*2450*/ "AC01 0020/0030",
+/*2451*/ "AC01 0300/0030",
+/*2452*/ "AC01 0300 0020/0030",
+/*2453*/ "AC01/0028",
+/*2454*/ "AC01 0020/0028",
+/*2455*/ "AC01 0300/0028",
+/*2456*/ "AC01 0300 0020/0028",
+/*2457*/ "AC01 0025",
+/*2458*/ "AC01 0020/0025",
+/*2459*/ "AC01 0300 0025",
+/*2460*/ "AC01 0300 0020/0025",
+/*2461*/ "AC01/0024",
+/*2462*/ "AC01 0020/0024",
+/*2463*/ "AC01 0300/0024",
+/*2464*/ "AC01 0300 0020/0024",
+/*2465*/ "AC01 0022",
+/*2466*/ "AC01 0020/0022",
+/*2467*/ "AC01 0300 0022",
+/*2468*/ "AC01 0300 0020/0022",
+/*2469*/ "AC01/1F1E6",
+/*2470*/ "AC01 0020/1F1E6",
+/*2471*/ "AC01 0300/1F1E6",
+/*2472*/ "AC01 0300 0020/1F1E6",
+/*2473*/ "AC01/0E01",
+/*2474*/ "AC01 0020/0E01",
+/*2475*/ "AC01 0300/0E01",
+/*2476*/ "AC01 0300 0020/0E01",
+/*2477*/ "AC01 0E31",
+/*2478*/ "AC01 0020/0E31",
+/*2479*/ "AC01 0300 0E31",
+/*2480*/ "AC01 0300 0020/0E31",
+/*2481*/ "AC01 0020",
+/*2482*/ "AC01 0020 0020",
+/*2483*/ "AC01 0300 0020",
+/*2484*/ "AC01 0300 0020 0020",
+/*2485*/ "AC01 002F",
+/*2486*/ "AC01 0020 002F",
+/*2487*/ "AC01 0300 002F",
+/*2488*/ "AC01 0300 0020 002F",
+/*2489*/ "AC01 2060",
+/*2490*/ "AC01 0020 2060",
+/*2491*/ "AC01 0300 2060",
+/*2492*/ "AC01 0300 0020 2060",
+/*2493*/ "AC01 200B",
+/*2494*/ "AC01 0020 200B",
+/*2495*/ "AC01 0300 200B",
+/*2496*/ "AC01 0300 0020 200B",
+/*2497*/ "05D0 00A7",
+/*2498*/ "05D0 0020/00A7",
+/*2499*/ "05D0 0300 00A7",
+/*2500*/ "05D0 0300 0020/00A7",
+/*2501*/ "05D0 0023",
+/*2502*/ "05D0 0020/0023",
+/*2503*/ "05D0 0300 0023",
+/*2504*/ "05D0 0300 0020/0023",
+/*2505*/ "05D0/2014",
+/*2506*/ "05D0 0020/2014",
+/*2507*/ "05D0 0300/2014",
+/*2508*/ "05D0 0300 0020/2014",
+/*2509*/ "05D0 007C",
+/*2510*/ "05D0 0020/007C",
+/*2511*/ "05D0 0300 007C",
+/*2512*/ "05D0 0300 0020/007C",
+/*2513*/ "05D0/00B4",
+/*2514*/ "05D0 0020/00B4",
+/*2515*/ "05D0 0300/00B4",
+/*2516*/ "05D0 0300 0020/00B4",
+/*2517*/ "05D0 2028",
+/*2518*/ "05D0 0020 2028",
+/*2519*/ "05D0 0300 2028",
+/*2520*/ "05D0 0300 0020 2028",
+/*2521*/ "05D0/FFFC",
+/*2522*/ "05D0 0020/FFFC",
+/*2523*/ "05D0 0300/FFFC",
+/*2524*/ "05D0 0300 0020/FFFC",
+/*2525*/ "05D0 3041",
+/*2526*/ "05D0 0020/3041",
+/*2527*/ "05D0 0300 3041",
+/*2528*/ "05D0 0300 0020/3041",
+/*2529*/ "05D0 007D",
+/*2530*/ "05D0 0020 007D",
+/*2531*/ "05D0 0300 007D",
+/*2532*/ "05D0 0300 0020 007D",
+/*2533*/ "05D0 0300",
+/*2534*/ "05D0 0020/0300",
+/*2535*/ "05D0 0300 0300",
+/*2536*/ "05D0 0300 0020/0300",
+/*2537*/ "05D0 0029",
+/*2538*/ "05D0 0020 0029",
+/*2539*/ "05D0 0300 0029",
+/*2540*/ "05D0 0300 0020 0029",
+/*2541*/ "05D0 000D",
+/*2542*/ "05D0 0020 000D",
+/*2543*/ "05D0 0300 000D",
+/*2544*/ "05D0 0300 0020 000D",
+/*2545*/ "05D0 0021",
+/*2546*/ "05D0 0020 0021",
+/*2547*/ "05D0 0300 0021",
+/*2548*/ "05D0 0300 0020 0021",
+/*2549*/ "05D0 00A0",
+/*2550*/ "05D0 0020/00A0",
+/*2551*/ "05D0 0300 00A0",
+/*2552*/ "05D0 0300 0020/00A0",
+/*2553*/ "05D0/AC00",
+/*2554*/ "05D0 0020/AC00",
+/*2555*/ "05D0 0300/AC00",
+/*2556*/ "05D0 0300 0020/AC00",
+/*2557*/ "05D0/AC01",
+/*2558*/ "05D0 0020/AC01",
+/*2559*/ "05D0 0300/AC01",
+/*2560*/ "05D0 0300 0020/AC01",
+/*2561*/ "05D0 05D0",
+/*2562*/ "05D0 0020/05D0",
+/*2563*/ "05D0 0300 05D0",
+/*2564*/ "05D0 0300 0020/05D0",
+/*2565*/ "05D0 002D",
+/*2566*/ "05D0 0020/002D",
+/*2567*/ "05D0 0300 002D",
+/*2568*/ "05D0 0300 0020/002D",
+/*2569*/ "05D0/231A",
+/*2570*/ "05D0 0020/231A",
+/*2571*/ "05D0 0300/231A",
+/*2572*/ "05D0 0300 0020/231A",
+/*2573*/ "05D0 2024",
+/*2574*/ "05D0 0020/2024",
+/*2575*/ "05D0 0300 2024",
+/*2576*/ "05D0 0300 0020/2024",
+/*2577*/ "05D0 002C",
+/*2578*/ "05D0 0020 002C",
+/*2579*/ "05D0 0300 002C",
+/*2580*/ "05D0 0300 0020 002C",
+/*2581*/ "05D0/1100",
+/*2582*/ "05D0 0020/1100",
+/*2583*/ "05D0 0300/1100",
+/*2584*/ "05D0 0300 0020/1100",
+/*2585*/ "05D0/11A8",
+/*2586*/ "05D0 0020/11A8",
+/*2587*/ "05D0 0300/11A8",
+/*2588*/ "05D0 0300 0020/11A8",
+/*2589*/ "05D0/1160",
+/*2590*/ "05D0 0020/1160",
+/*2591*/ "05D0 0300/1160",
+/*2592*/ "05D0 0300 0020/1160",
+/*2593*/ "05D0 000A",
+/*2594*/ "05D0 0020 000A",
+/*2595*/ "05D0 0300 000A",
+/*2596*/ "05D0 0300 0020 000A",
+/*2597*/ "05D0 0085",
+/*2598*/ "05D0 0020 0085",
+/*2599*/ "05D0 0300 0085",
+/*2600*/ "05D0 0300 0020 0085",
+/*2601*/ "05D0 17D6",
+/*2602*/ "05D0 0020/17D6",
+/*2603*/ "05D0 0300 17D6",
+/*2604*/ "05D0 0300 0020/17D6",
+/*2605*/ "05D0 0030",
+/*2606*/ "05D0 0020/0030",
+/*2607*/ "05D0 0300 0030",
+/*2608*/ "05D0 0300 0020/0030",
+/*2609*/ "05D0 0028",
+/*2610*/ "05D0 0020/0028",
+/*2611*/ "05D0 0300 0028",
+/*2612*/ "05D0 0300 0020/0028",
+/*2613*/ "05D0/0025",
+/*2614*/ "05D0 0020/0025",
+/*2615*/ "05D0 0300/0025",
+/*2616*/ "05D0 0300 0020/0025",
+/*2617*/ "05D0/0024",
+/*2618*/ "05D0 0020/0024",
+/*2619*/ "05D0 0300/0024",
+/*2620*/ "05D0 0300 0020/0024",
+/*2621*/ "05D0 0022",
+/*2622*/ "05D0 0020/0022",
+/*2623*/ "05D0 0300 0022",
+/*2624*/ "05D0 0300 0020/0022",
+/*2625*/ "05D0/1F1E6",
+/*2626*/ "05D0 0020/1F1E6",
+/*2627*/ "05D0 0300/1F1E6",
+/*2628*/ "05D0 0300 0020/1F1E6",
+/*2629*/ "05D0 0E01",
+/*2630*/ "05D0 0020/0E01",
+/*2631*/ "05D0 0300 0E01",
+/*2632*/ "05D0 0300 0020/0E01",
+/*2633*/ "05D0 0E31",
+/*2634*/ "05D0 0020/0E31",
+/*2635*/ "05D0 0300 0E31",
+/*2636*/ "05D0 0300 0020/0E31",
+/*2637*/ "05D0 0020",
+/*2638*/ "05D0 0020 0020",
+/*2639*/ "05D0 0300 0020",
+/*2640*/ "05D0 0300 0020 0020",
+/*2641*/ "05D0 002F",
+/*2642*/ "05D0 0020 002F",
+/*2643*/ "05D0 0300 002F",
+/*2644*/ "05D0 0300 0020 002F",
+/*2645*/ "05D0 2060",
+/*2646*/ "05D0 0020 2060",
+/*2647*/ "05D0 0300 2060",
+/*2648*/ "05D0 0300 0020 2060",
+/*2649*/ "05D0 200B",
+/*2650*/ "05D0 0020 200B",
+/*2651*/ "05D0 0300 200B",
+/*2652*/ "05D0 0300 0020 200B",
+/*2653*/ "002D/00A7",
+/*2654*/ "002D 0020/00A7",
+/*2655*/ "002D 0300/00A7",
+/*2656*/ "002D 0300 0020/00A7",
+/*2657*/ "002D/0023",
+/*2658*/ "002D 0020/0023",
+/*2659*/ "002D 0300/0023",
+/*2660*/ "002D 0300 0020/0023",
+/*2661*/ "002D/2014",
+/*2662*/ "002D 0020/2014",
+/*2663*/ "002D 0300/2014",
+/*2664*/ "002D 0300 0020/2014",
+/*2665*/ "002D 007C",
+/*2666*/ "002D 0020/007C",
+/*2667*/ "002D 0300 007C",
+/*2668*/ "002D 0300 0020/007C",
+/*2669*/ "002D/00B4",
+/*2670*/ "002D 0020/00B4",
+/*2671*/ "002D 0300/00B4",
+/*2672*/ "002D 0300 0020/00B4",
+/*2673*/ "002D 2028",
+/*2674*/ "002D 0020 2028",
+/*2675*/ "002D 0300 2028",
+/*2676*/ "002D 0300 0020 2028",
+/*2677*/ "002D/FFFC",
+/*2678*/ "002D 0020/FFFC",
+/*2679*/ "002D 0300/FFFC",
+/*2680*/ "002D 0300 0020/FFFC",
+/*2681*/ "002D 3041",
+/*2682*/ "002D 0020/3041",
+/*2683*/ "002D 0300 3041",
+/*2684*/ "002D 0300 0020/3041",
+/*2685*/ "002D 007D",
+/*2686*/ "002D 0020 007D",
+/*2687*/ "002D 0300 007D",
+/*2688*/ "002D 0300 0020 007D",
+/*2689*/ "002D 0300",
+/*2690*/ "002D 0020/0300",
+/*2691*/ "002D 0300 0300",
+/*2692*/ "002D 0300 0020/0300",
+/*2693*/ "002D 0029",
+/*2694*/ "002D 0020 0029",
+/*2695*/ "002D 0300 0029",
+/*2696*/ "002D 0300 0020 0029",
+/*2697*/ "002D 000D",
+/*2698*/ "002D 0020 000D",
+/*2699*/ "002D 0300 000D",
+/*2700*/ "002D 0300 0020 000D",
+/*2701*/ "002D 0021",
+/*2702*/ "002D 0020 0021",
+/*2703*/ "002D 0300 0021",
+/*2704*/ "002D 0300 0020 0021",
+/*2705*/ "002D/00A0",
+/*2706*/ "002D 0020/00A0",
+/*2707*/ "002D 0300/00A0",
+/*2708*/ "002D 0300 0020/00A0",
+/*2709*/ "002D/AC00",
+/*2710*/ "002D 0020/AC00",
+/*2711*/ "002D 0300/AC00",
+/*2712*/ "002D 0300 0020/AC00",
+/*2713*/ "002D/AC01",
+/*2714*/ "002D 0020/AC01",
+/*2715*/ "002D 0300/AC01",
+/*2716*/ "002D 0300 0020/AC01",
+/*2717*/ "002D/05D0",
+/*2718*/ "002D 0020/05D0",
+/*2719*/ "002D 0300/05D0",
+/*2720*/ "002D 0300 0020/05D0",
+/*2721*/ "002D 002D",
+/*2722*/ "002D 0020/002D",
+/*2723*/ "002D 0300 002D",
+/*2724*/ "002D 0300 0020/002D",
+/*2725*/ "002D/231A",
+/*2726*/ "002D 0020/231A",
+/*2727*/ "002D 0300/231A",
+/*2728*/ "002D 0300 0020/231A",
+/*2729*/ "002D/2024",
+/*2730*/ "002D 0020/2024",
+/*2731*/ "002D 0300/2024",
+/*2732*/ "002D 0300 0020/2024",
+/*2733*/ "002D 002C",
+/*2734*/ "002D 0020 002C",
+/*2735*/ "002D 0300 002C",
+/*2736*/ "002D 0300 0020 002C",
+/*2737*/ "002D/1100",
+/*2738*/ "002D 0020/1100",
+/*2739*/ "002D 0300/1100",
+/*2740*/ "002D 0300 0020/1100",
+/*2741*/ "002D/11A8",
+/*2742*/ "002D 0020/11A8",
+/*2743*/ "002D 0300/11A8",
+/*2744*/ "002D 0300 0020/11A8",
+/*2745*/ "002D/1160",
+/*2746*/ "002D 0020/1160",
+/*2747*/ "002D 0300/1160",
+/*2748*/ "002D 0300 0020/1160",
+/*2749*/ "002D 000A",
+/*2750*/ "002D 0020 000A",
+/*2751*/ "002D 0300 000A",
+/*2752*/ "002D 0300 0020 000A",
+/*2753*/ "002D 0085",
+/*2754*/ "002D 0020 0085",
+/*2755*/ "002D 0300 0085",
+/*2756*/ "002D 0300 0020 0085",
+/*2757*/ "002D 17D6",
+/*2758*/ "002D 0020/17D6",
+/*2759*/ "002D 0300 17D6",
+/*2760*/ "002D 0300 0020/17D6",
+/*2761*/ "002D 0030",
+/*2762*/ "002D 0020/0030",
+/*2763*/ "002D 0300 0030",
+/*2764*/ "002D 0300 0020/0030",
+/*2765*/ "002D/0028",
+/*2766*/ "002D 0020/0028",
+/*2767*/ "002D 0300/0028",
+/*2768*/ "002D 0300 0020/0028",
+/*2769*/ "002D/0025",
+/*2770*/ "002D 0020/0025",
+/*2771*/ "002D 0300/0025",
+/*2772*/ "002D 0300 0020/0025",
+/*2773*/ "002D/0024",
+/*2774*/ "002D 0020/0024",
+/*2775*/ "002D 0300/0024",
+/*2776*/ "002D 0300 0020/0024",
+/*2777*/ "002D 0022",
+/*2778*/ "002D 0020/0022",
+/*2779*/ "002D 0300 0022",
+/*2780*/ "002D 0300 0020/0022",
+/*2781*/ "002D/1F1E6",
+/*2782*/ "002D 0020/1F1E6",
+/*2783*/ "002D 0300/1F1E6",
+/*2784*/ "002D 0300 0020/1F1E6",
+/*2785*/ "002D/0E01",
+/*2786*/ "002D 0020/0E01",
+/*2787*/ "002D 0300/0E01",
+/*2788*/ "002D 0300 0020/0E01",
+/*2789*/ "002D 0E31",
+/*2790*/ "002D 0020/0E31",
+/*2791*/ "002D 0300 0E31",
+/*2792*/ "002D 0300 0020/0E31",
+/*2793*/ "002D 0020",
+/*2794*/ "002D 0020 0020",
+/*2795*/ "002D 0300 0020",
+/*2796*/ "002D 0300 0020 0020",
+/*2797*/ "002D 002F",
+/*2798*/ "002D 0020 002F",
+/*2799*/ "002D 0300 002F",
+/*2800*/ "002D 0300 0020 002F",
+/*2801*/ "002D 2060",
+/*2802*/ "002D 0020 2060",
+/*2803*/ "002D 0300 2060",
+/*2804*/ "002D 0300 0020 2060",
+/*2805*/ "002D 200B",
+/*2806*/ "002D 0020 200B",
+/*2807*/ "002D 0300 200B",
+/*2808*/ "002D 0300 0020 200B",
+/*2809*/ "231A/00A7",
+/*2810*/ "231A 0020/00A7",
+/*2811*/ "231A 0300/00A7",
+/*2812*/ "231A 0300 0020/00A7",
+/*2813*/ "231A/0023",
+/*2814*/ "231A 0020/0023",
+/*2815*/ "231A 0300/0023",
+/*2816*/ "231A 0300 0020/0023",
+/*2817*/ "231A/2014",
+/*2818*/ "231A 0020/2014",
+/*2819*/ "231A 0300/2014",
+/*2820*/ "231A 0300 0020/2014",
+/*2821*/ "231A 007C",
+/*2822*/ "231A 0020/007C",
+/*2823*/ "231A 0300 007C",
+/*2824*/ "231A 0300 0020/007C",
+/*2825*/ "231A/00B4",
+/*2826*/ "231A 0020/00B4",
+/*2827*/ "231A 0300/00B4",
+/*2828*/ "231A 0300 0020/00B4",
+/*2829*/ "231A 2028",
+/*2830*/ "231A 0020 2028",
+/*2831*/ "231A 0300 2028",
+/*2832*/ "231A 0300 0020 2028",
+/*2833*/ "231A/FFFC",
+/*2834*/ "231A 0020/FFFC",
+/*2835*/ "231A 0300/FFFC",
+/*2836*/ "231A 0300 0020/FFFC",
+/*2837*/ "231A 3041",
+/*2838*/ "231A 0020/3041",
+/*2839*/ "231A 0300 3041",
+/*2840*/ "231A 0300 0020/3041",
+/*2841*/ "231A 007D",
+/*2842*/ "231A 0020 007D",
+/*2843*/ "231A 0300 007D",
+/*2844*/ "231A 0300 0020 007D",
+/*2845*/ "231A 0300",
+/*2846*/ "231A 0020/0300",
+/*2847*/ "231A 0300 0300",
+/*2848*/ "231A 0300 0020/0300",
+/*2849*/ "231A 0029",
+/*2850*/ "231A 0020 0029",
+/*2851*/ "231A 0300 0029",
+/*2852*/ "231A 0300 0020 0029",
+/*2853*/ "231A 000D",
+/*2854*/ "231A 0020 000D",
+/*2855*/ "231A 0300 000D",
+/*2856*/ "231A 0300 0020 000D",
+/*2857*/ "231A 0021",
+/*2858*/ "231A 0020 0021",
+/*2859*/ "231A 0300 0021",
+/*2860*/ "231A 0300 0020 0021",
+/*2861*/ "231A 00A0",
+/*2862*/ "231A 0020/00A0",
+/*2863*/ "231A 0300 00A0",
+/*2864*/ "231A 0300 0020/00A0",
+/*2865*/ "231A/AC00",
+/*2866*/ "231A 0020/AC00",
+/*2867*/ "231A 0300/AC00",
+/*2868*/ "231A 0300 0020/AC00",
+/*2869*/ "231A/AC01",
+/*2870*/ "231A 0020/AC01",
+/*2871*/ "231A 0300/AC01",
+/*2872*/ "231A 0300 0020/AC01",
+/*2873*/ "231A/05D0",
+/*2874*/ "231A 0020/05D0",
+/*2875*/ "231A 0300/05D0",
+/*2876*/ "231A 0300 0020/05D0",
+/*2877*/ "231A 002D",
+/*2878*/ "231A 0020/002D",
+/*2879*/ "231A 0300 002D",
+/*2880*/ "231A 0300 0020/002D",
+/*2881*/ "231A/231A",
+/*2882*/ "231A 0020/231A",
+/*2883*/ "231A 0300/231A",
+/*2884*/ "231A 0300 0020/231A",
+/*2885*/ "231A 2024",
+/*2886*/ "231A 0020/2024",
+/*2887*/ "231A 0300 2024",
+/*2888*/ "231A 0300 0020/2024",
+/*2889*/ "231A 002C",
+/*2890*/ "231A 0020 002C",
+/*2891*/ "231A 0300 002C",
+/*2892*/ "231A 0300 0020 002C",
+/*2893*/ "231A/1100",
+/*2894*/ "231A 0020/1100",
+/*2895*/ "231A 0300/1100",
+/*2896*/ "231A 0300 0020/1100",
+/*2897*/ "231A/11A8",
+/*2898*/ "231A 0020/11A8",
+/*2899*/ "231A 0300/11A8",
+/*2900*/ "231A 0300 0020/11A8",
+/*2901*/ "231A/1160",
+/*2902*/ "231A 0020/1160",
+/*2903*/ "231A 0300/1160",
+/*2904*/ "231A 0300 0020/1160",
+/*2905*/ "231A 000A",
+/*2906*/ "231A 0020 000A",
+/*2907*/ "231A 0300 000A",
+/*2908*/ "231A 0300 0020 000A",
+/*2909*/ "231A 0085",
+/*2910*/ "231A 0020 0085",
+/*2911*/ "231A 0300 0085",
+/*2912*/ "231A 0300 0020 0085",
+/*2913*/ "231A 17D6",
+/*2914*/ "231A 0020/17D6",
+/*2915*/ "231A 0300 17D6",
+/*2916*/ "231A 0300 0020/17D6",
+/*2917*/ "231A/0030",
+/*2918*/ "231A 0020/0030",
+/*2919*/ "231A 0300/0030",
+/*2920*/ "231A 0300 0020/0030",
+/*2921*/ "231A/0028",
+/*2922*/ "231A 0020/0028",
+/*2923*/ "231A 0300/0028",
+/*2924*/ "231A 0300 0020/0028",
+/*2925*/ "231A 0025",
+/*2926*/ "231A 0020/0025",
+/*2927*/ "231A 0300 0025",
+/*2928*/ "231A 0300 0020/0025",
+/*2929*/ "231A/0024",
+/*2930*/ "231A 0020/0024",
+/*2931*/ "231A 0300/0024",
+/*2932*/ "231A 0300 0020/0024",
+/*2933*/ "231A 0022",
+/*2934*/ "231A 0020/0022",
+/*2935*/ "231A 0300 0022",
+/*2936*/ "231A 0300 0020/0022",
+/*2937*/ "231A/1F1E6",
+/*2938*/ "231A 0020/1F1E6",
+/*2939*/ "231A 0300/1F1E6",
+/*2940*/ "231A 0300 0020/1F1E6",
+/*2941*/ "231A/0E01",
+/*2942*/ "231A 0020/0E01",
+/*2943*/ "231A 0300/0E01",
+/*2944*/ "231A 0300 0020/0E01",
+/*2945*/ "231A 0E31",
+/*2946*/ "231A 0020/0E31",
+/*2947*/ "231A 0300 0E31",
+/*2948*/ "231A 0300 0020/0E31",
+/*2949*/ "231A 0020",
+/*2950*/ "231A 0020 0020",
+/*2951*/ "231A 0300 0020",
+/*2952*/ "231A 0300 0020 0020",
+/*2953*/ "231A 002F",
+/*2954*/ "231A 0020 002F",
+/*2955*/ "231A 0300 002F",
+/*2956*/ "231A 0300 0020 002F",
+/*2957*/ "231A 2060",
+/*2958*/ "231A 0020 2060",
+/*2959*/ "231A 0300 2060",
+/*2960*/ "231A 0300 0020 2060",
+/*2961*/ "231A 200B",
+/*2962*/ "231A 0020 200B",
+/*2963*/ "231A 0300 200B",
+/*2964*/ "231A 0300 0020 200B",
+/*2965*/ "2024/00A7",
+/*2966*/ "2024 0020/00A7",
+/*2967*/ "2024 0300/00A7",
+/*2968*/ "2024 0300 0020/00A7",
+/*2969*/ "2024/0023",
+/*2970*/ "2024 0020/0023",
+/*2971*/ "2024 0300/0023",
+/*2972*/ "2024 0300 0020/0023",
+/*2973*/ "2024/2014",
+/*2974*/ "2024 0020/2014",
+/*2975*/ "2024 0300/2014",
+/*2976*/ "2024 0300 0020/2014",
+/*2977*/ "2024 007C",
+/*2978*/ "2024 0020/007C",
+/*2979*/ "2024 0300 007C",
+/*2980*/ "2024 0300 0020/007C",
+/*2981*/ "2024/00B4",
+/*2982*/ "2024 0020/00B4",
+/*2983*/ "2024 0300/00B4",
+/*2984*/ "2024 0300 0020/00B4",
+/*2985*/ "2024 2028",
+/*2986*/ "2024 0020 2028",
+/*2987*/ "2024 0300 2028",
+/*2988*/ "2024 0300 0020 2028",
+/*2989*/ "2024/FFFC",
+/*2990*/ "2024 0020/FFFC",
+/*2991*/ "2024 0300/FFFC",
+/*2992*/ "2024 0300 0020/FFFC",
+/*2993*/ "2024 3041",
+/*2994*/ "2024 0020/3041",
+/*2995*/ "2024 0300 3041",
+/*2996*/ "2024 0300 0020/3041",
+/*2997*/ "2024 007D",
+/*2998*/ "2024 0020 007D",
+/*2999*/ "2024 0300 007D",
+/*3000*/ "2024 0300 0020 007D",
+/*3001*/ "2024 0300",
+/*3002*/ "2024 0020/0300",
+/*3003*/ "2024 0300 0300",
+/*3004*/ "2024 0300 0020/0300",
+/*3005*/ "2024 0029",
+/*3006*/ "2024 0020 0029",
+/*3007*/ "2024 0300 0029",
+/*3008*/ "2024 0300 0020 0029",
+/*3009*/ "2024 000D",
+/*3010*/ "2024 0020 000D",
+/*3011*/ "2024 0300 000D",
+/*3012*/ "2024 0300 0020 000D",
+/*3013*/ "2024 0021",
+/*3014*/ "2024 0020 0021",
+/*3015*/ "2024 0300 0021",
+/*3016*/ "2024 0300 0020 0021",
+/*3017*/ "2024 00A0",
+/*3018*/ "2024 0020/00A0",
+/*3019*/ "2024 0300 00A0",
+/*3020*/ "2024 0300 0020/00A0",
+/*3021*/ "2024/AC00",
+/*3022*/ "2024 0020/AC00",
+/*3023*/ "2024 0300/AC00",
+/*3024*/ "2024 0300 0020/AC00",
+/*3025*/ "2024/AC01",
+/*3026*/ "2024 0020/AC01",
+/*3027*/ "2024 0300/AC01",
+/*3028*/ "2024 0300 0020/AC01",
+/*3029*/ "2024/05D0",
+/*3030*/ "2024 0020/05D0",
+/*3031*/ "2024 0300/05D0",
+/*3032*/ "2024 0300 0020/05D0",
+/*3033*/ "2024 002D",
+/*3034*/ "2024 0020/002D",
+/*3035*/ "2024 0300 002D",
+/*3036*/ "2024 0300 0020/002D",
+/*3037*/ "2024/231A",
+/*3038*/ "2024 0020/231A",
+/*3039*/ "2024 0300/231A",
+/*3040*/ "2024 0300 0020/231A",
+/*3041*/ "2024 2024",
+/*3042*/ "2024 0020/2024",
+/*3043*/ "2024 0300 2024",
+/*3044*/ "2024 0300 0020/2024",
+/*3045*/ "2024 002C",
+/*3046*/ "2024 0020 002C",
+/*3047*/ "2024 0300 002C",
+/*3048*/ "2024 0300 0020 002C",
+/*3049*/ "2024/1100",
+/*3050*/ "2024 0020/1100",
+/*3051*/ "2024 0300/1100",
+/*3052*/ "2024 0300 0020/1100",
+/*3053*/ "2024/11A8",
+/*3054*/ "2024 0020/11A8",
+/*3055*/ "2024 0300/11A8",
+/*3056*/ "2024 0300 0020/11A8",
+/*3057*/ "2024/1160",
+/*3058*/ "2024 0020/1160",
+/*3059*/ "2024 0300/1160",
+/*3060*/ "2024 0300 0020/1160",
+/*3061*/ "2024 000A",
+/*3062*/ "2024 0020 000A",
+/*3063*/ "2024 0300 000A",
+/*3064*/ "2024 0300 0020 000A",
+/*3065*/ "2024 0085",
+/*3066*/ "2024 0020 0085",
+/*3067*/ "2024 0300 0085",
+/*3068*/ "2024 0300 0020 0085",
+/*3069*/ "2024 17D6",
+/*3070*/ "2024 0020/17D6",
+/*3071*/ "2024 0300 17D6",
+/*3072*/ "2024 0300 0020/17D6",
+/*3073*/ "2024/0030",
+/*3074*/ "2024 0020/0030",
+/*3075*/ "2024 0300/0030",
+/*3076*/ "2024 0300 0020/0030",
+/*3077*/ "2024/0028",
+/*3078*/ "2024 0020/0028",
+/*3079*/ "2024 0300/0028",
+/*3080*/ "2024 0300 0020/0028",
+/*3081*/ "2024/0025",
+/*3082*/ "2024 0020/0025",
+/*3083*/ "2024 0300/0025",
+/*3084*/ "2024 0300 0020/0025",
+/*3085*/ "2024/0024",
+/*3086*/ "2024 0020/0024",
+/*3087*/ "2024 0300/0024",
+/*3088*/ "2024 0300 0020/0024",
+/*3089*/ "2024 0022",
+/*3090*/ "2024 0020/0022",
+/*3091*/ "2024 0300 0022",
+/*3092*/ "2024 0300 0020/0022",
+/*3093*/ "2024/1F1E6",
+/*3094*/ "2024 0020/1F1E6",
+/*3095*/ "2024 0300/1F1E6",
+/*3096*/ "2024 0300 0020/1F1E6",
+/*3097*/ "2024/0E01",
+/*3098*/ "2024 0020/0E01",
+/*3099*/ "2024 0300/0E01",
+/*3100*/ "2024 0300 0020/0E01",
+/*3101*/ "2024 0E31",
+/*3102*/ "2024 0020/0E31",
+/*3103*/ "2024 0300 0E31",
+/*3104*/ "2024 0300 0020/0E31",
+/*3105*/ "2024 0020",
+/*3106*/ "2024 0020 0020",
+/*3107*/ "2024 0300 0020",
+/*3108*/ "2024 0300 0020 0020",
+/*3109*/ "2024 002F",
+/*3110*/ "2024 0020 002F",
+/*3111*/ "2024 0300 002F",
+/*3112*/ "2024 0300 0020 002F",
+/*3113*/ "2024 2060",
+/*3114*/ "2024 0020 2060",
+/*3115*/ "2024 0300 2060",
+/*3116*/ "2024 0300 0020 2060",
+/*3117*/ "2024 200B",
+/*3118*/ "2024 0020 200B",
+/*3119*/ "2024 0300 200B",
+/*3120*/ "2024 0300 0020 200B",
+/*3121*/ "002C 00A7",
+/*3122*/ "002C 0020/00A7",
+/*3123*/ "002C 0300 00A7",
+/*3124*/ "002C 0300 0020/00A7",
+/*3125*/ "002C 0023",
+/*3126*/ "002C 0020/0023",
+/*3127*/ "002C 0300 0023",
+/*3128*/ "002C 0300 0020/0023",
+/*3129*/ "002C/2014",
+/*3130*/ "002C 0020/2014",
+/*3131*/ "002C 0300/2014",
+/*3132*/ "002C 0300 0020/2014",
+/*3133*/ "002C 007C",
+/*3134*/ "002C 0020/007C",
+/*3135*/ "002C 0300 007C",
+/*3136*/ "002C 0300 0020/007C",
+/*3137*/ "002C/00B4",
+/*3138*/ "002C 0020/00B4",
+/*3139*/ "002C 0300/00B4",
+/*3140*/ "002C 0300 0020/00B4",
+/*3141*/ "002C 2028",
+/*3142*/ "002C 0020 2028",
+/*3143*/ "002C 0300 2028",
+/*3144*/ "002C 0300 0020 2028",
+/*3145*/ "002C/FFFC",
+/*3146*/ "002C 0020/FFFC",
+/*3147*/ "002C 0300/FFFC",
+/*3148*/ "002C 0300 0020/FFFC",
+/*3149*/ "002C 3041",
+/*3150*/ "002C 0020/3041",
+/*3151*/ "002C 0300 3041",
+/*3152*/ "002C 0300 0020/3041",
+/*3153*/ "002C 007D",
+/*3154*/ "002C 0020 007D",
+/*3155*/ "002C 0300 007D",
+/*3156*/ "002C 0300 0020 007D",
+/*3157*/ "002C 0300",
+/*3158*/ "002C 0020/0300",
+/*3159*/ "002C 0300 0300",
+/*3160*/ "002C 0300 0020/0300",
+/*3161*/ "002C 0029",
+/*3162*/ "002C 0020 0029",
+/*3163*/ "002C 0300 0029",
+/*3164*/ "002C 0300 0020 0029",
+/*3165*/ "002C 000D",
+/*3166*/ "002C 0020 000D",
+/*3167*/ "002C 0300 000D",
+/*3168*/ "002C 0300 0020 000D",
+/*3169*/ "002C 0021",
+/*3170*/ "002C 0020 0021",
+/*3171*/ "002C 0300 0021",
+/*3172*/ "002C 0300 0020 0021",
+/*3173*/ "002C 00A0",
+/*3174*/ "002C 0020/00A0",
+/*3175*/ "002C 0300 00A0",
+/*3176*/ "002C 0300 0020/00A0",
+/*3177*/ "002C/AC00",
+/*3178*/ "002C 0020/AC00",
+/*3179*/ "002C 0300/AC00",
+/*3180*/ "002C 0300 0020/AC00",
+/*3181*/ "002C/AC01",
+/*3182*/ "002C 0020/AC01",
+/*3183*/ "002C 0300/AC01",
+/*3184*/ "002C 0300 0020/AC01",
+/*3185*/ "002C 05D0",
+/*3186*/ "002C 0020/05D0",
+/*3187*/ "002C 0300 05D0",
+/*3188*/ "002C 0300 0020/05D0",
+/*3189*/ "002C 002D",
+/*3190*/ "002C 0020/002D",
+/*3191*/ "002C 0300 002D",
+/*3192*/ "002C 0300 0020/002D",
+/*3193*/ "002C/231A",
+/*3194*/ "002C 0020/231A",
+/*3195*/ "002C 0300/231A",
+/*3196*/ "002C 0300 0020/231A",
+/*3197*/ "002C/2024",
+/*3198*/ "002C 0020/2024",
+/*3199*/ "002C 0300/2024",
+/*3200*/ "002C 0300 0020/2024",
+/*3201*/ "002C 002C",
+/*3202*/ "002C 0020 002C",
+/*3203*/ "002C 0300 002C",
+/*3204*/ "002C 0300 0020 002C",
+/*3205*/ "002C/1100",
+/*3206*/ "002C 0020/1100",
+/*3207*/ "002C 0300/1100",
+/*3208*/ "002C 0300 0020/1100",
+/*3209*/ "002C/11A8",
+/*3210*/ "002C 0020/11A8",
+/*3211*/ "002C 0300/11A8",
+/*3212*/ "002C 0300 0020/11A8",
+/*3213*/ "002C/1160",
+/*3214*/ "002C 0020/1160",
+/*3215*/ "002C 0300/1160",
+/*3216*/ "002C 0300 0020/1160",
+/*3217*/ "002C 000A",
+/*3218*/ "002C 0020 000A",
+/*3219*/ "002C 0300 000A",
+/*3220*/ "002C 0300 0020 000A",
+/*3221*/ "002C 0085",
+/*3222*/ "002C 0020 0085",
+/*3223*/ "002C 0300 0085",
+/*3224*/ "002C 0300 0020 0085",
+/*3225*/ "002C 17D6",
+/*3226*/ "002C 0020/17D6",
+/*3227*/ "002C 0300 17D6",
+/*3228*/ "002C 0300 0020/17D6",
+/*3229*/ "002C 0030",
+/*3230*/ "002C 0020/0030",
+/*3231*/ "002C 0300 0030",
+/*3232*/ "002C 0300 0020/0030",
+/*3233*/ "002C/0028",
+/*3234*/ "002C 0020/0028",
+/*3235*/ "002C 0300/0028",
+/*3236*/ "002C 0300 0020/0028",
+/*3237*/ "002C/0025",
+/*3238*/ "002C 0020/0025",
+/*3239*/ "002C 0300/0025",
+/*3240*/ "002C 0300 0020/0025",
+/*3241*/ "002C/0024",
+/*3242*/ "002C 0020/0024",
+/*3243*/ "002C 0300/0024",
+/*3244*/ "002C 0300 0020/0024",
+/*3245*/ "002C 0022",
+/*3246*/ "002C 0020/0022",
+/*3247*/ "002C 0300 0022",
+/*3248*/ "002C 0300 0020/0022",
+/*3249*/ "002C/1F1E6",
+/*3250*/ "002C 0020/1F1E6",
+/*3251*/ "002C 0300/1F1E6",
+/*3252*/ "002C 0300 0020/1F1E6",
+/*3253*/ "002C 0E01",
+/*3254*/ "002C 0020/0E01",
+/*3255*/ "002C 0300 0E01",
+/*3256*/ "002C 0300 0020/0E01",
+/*3257*/ "002C 0E31",
+/*3258*/ "002C 0020/0E31",
+/*3259*/ "002C 0300 0E31",
+/*3260*/ "002C 0300 0020/0E31",
+/*3261*/ "002C 0020",
+/*3262*/ "002C 0020 0020",
+/*3263*/ "002C 0300 0020",
+/*3264*/ "002C 0300 0020 0020",
+/*3265*/ "002C 002F",
+/*3266*/ "002C 0020 002F",
+/*3267*/ "002C 0300 002F",
+/*3268*/ "002C 0300 0020 002F",
+/*3269*/ "002C 2060",
+/*3270*/ "002C 0020 2060",
+/*3271*/ "002C 0300 2060",
+/*3272*/ "002C 0300 0020 2060",
+/*3273*/ "002C 200B",
+/*3274*/ "002C 0020 200B",
+/*3275*/ "002C 0300 200B",
+/*3276*/ "002C 0300 0020 200B",
+/*3277*/ "1100/00A7",
+/*3278*/ "1100 0020/00A7",
+/*3279*/ "1100 0300/00A7",
+/*3280*/ "1100 0300 0020/00A7",
+/*3281*/ "1100/0023",
+/*3282*/ "1100 0020/0023",
+/*3283*/ "1100 0300/0023",
+/*3284*/ "1100 0300 0020/0023",
+/*3285*/ "1100/2014",
+/*3286*/ "1100 0020/2014",
+/*3287*/ "1100 0300/2014",
+/*3288*/ "1100 0300 0020/2014",
+/*3289*/ "1100 007C",
+/*3290*/ "1100 0020/007C",
+/*3291*/ "1100 0300 007C",
+/*3292*/ "1100 0300 0020/007C",
+/*3293*/ "1100/00B4",
+/*3294*/ "1100 0020/00B4",
+/*3295*/ "1100 0300/00B4",
+/*3296*/ "1100 0300 0020/00B4",
+/*3297*/ "1100 2028",
+/*3298*/ "1100 0020 2028",
+/*3299*/ "1100 0300 2028",
+/*3300*/ "1100 0300 0020 2028",
+/*3301*/ "1100/FFFC",
+/*3302*/ "1100 0020/FFFC",
+/*3303*/ "1100 0300/FFFC",
+/*3304*/ "1100 0300 0020/FFFC",
+/*3305*/ "1100 3041",
+/*3306*/ "1100 0020/3041",
+/*3307*/ "1100 0300 3041",
+/*3308*/ "1100 0300 0020/3041",
+/*3309*/ "1100 007D",
+/*3310*/ "1100 0020 007D",
+/*3311*/ "1100 0300 007D",
+/*3312*/ "1100 0300 0020 007D",
+/*3313*/ "1100 0300",
+/*3314*/ "1100 0020/0300",
+/*3315*/ "1100 0300 0300",
+/*3316*/ "1100 0300 0020/0300",
+/*3317*/ "1100 0029",
+/*3318*/ "1100 0020 0029",
+/*3319*/ "1100 0300 0029",
+/*3320*/ "1100 0300 0020 0029",
+/*3321*/ "1100 000D",
+/*3322*/ "1100 0020 000D",
+/*3323*/ "1100 0300 000D",
+/*3324*/ "1100 0300 0020 000D",
+/*3325*/ "1100 0021",
+/*3326*/ "1100 0020 0021",
+/*3327*/ "1100 0300 0021",
+/*3328*/ "1100 0300 0020 0021",
+/*3329*/ "1100 00A0",
+/*3330*/ "1100 0020/00A0",
+/*3331*/ "1100 0300 00A0",
+/*3332*/ "1100 0300 0020/00A0",
+/*3333*/ "1100 AC00",
+/*3334*/ "1100 0020/AC00",
+/*3335*/ "1100 0300 AC00",
+/*3336*/ "1100 0300 0020/AC00",
+/*3337*/ "1100 AC01",
+/*3338*/ "1100 0020/AC01",
+/*3339*/ "1100 0300 AC01",
+/*3340*/ "1100 0300 0020/AC01",
+/*3341*/ "1100/05D0",
+/*3342*/ "1100 0020/05D0",
+/*3343*/ "1100 0300/05D0",
+/*3344*/ "1100 0300 0020/05D0",
+/*3345*/ "1100 002D",
+/*3346*/ "1100 0020/002D",
+/*3347*/ "1100 0300 002D",
+/*3348*/ "1100 0300 0020/002D",
+/*3349*/ "1100/231A",
+/*3350*/ "1100 0020/231A",
+/*3351*/ "1100 0300/231A",
+/*3352*/ "1100 0300 0020/231A",
+/*3353*/ "1100 2024",
+/*3354*/ "1100 0020/2024",
+/*3355*/ "1100 0300 2024",
+/*3356*/ "1100 0300 0020/2024",
+/*3357*/ "1100 002C",
+/*3358*/ "1100 0020 002C",
+/*3359*/ "1100 0300 002C",
+/*3360*/ "1100 0300 0020 002C",
+/*3361*/ "1100 1100",
+/*3362*/ "1100 0020/1100",
+/*3363*/ "1100 0300 1100",
+/*3364*/ "1100 0300 0020/1100",
+/*3365*/ "1100/11A8",
+/*3366*/ "1100 0020/11A8",
+/*3367*/ "1100 0300/11A8",
+/*3368*/ "1100 0300 0020/11A8",
+/*3369*/ "1100 1160",
+/*3370*/ "1100 0020/1160",
+/*3371*/ "1100 0300 1160",
+/*3372*/ "1100 0300 0020/1160",
+/*3373*/ "1100 000A",
+/*3374*/ "1100 0020 000A",
+/*3375*/ "1100 0300 000A",
+/*3376*/ "1100 0300 0020 000A",
+/*3377*/ "1100 0085",
+/*3378*/ "1100 0020 0085",
+/*3379*/ "1100 0300 0085",
+/*3380*/ "1100 0300 0020 0085",
+/*3381*/ "1100 17D6",
+/*3382*/ "1100 0020/17D6",
+/*3383*/ "1100 0300 17D6",
+/*3384*/ "1100 0300 0020/17D6",
+/*3385*/ "1100/0030",
+/*3386*/ "1100 0020/0030",
+/*3387*/ "1100 0300/0030",
+/*3388*/ "1100 0300 0020/0030",
+/*3389*/ "1100/0028",
+/*3390*/ "1100 0020/0028",
+/*3391*/ "1100 0300/0028",
+/*3392*/ "1100 0300 0020/0028",
+/*3393*/ "1100 0025",
+/*3394*/ "1100 0020/0025",
+/*3395*/ "1100 0300 0025",
+/*3396*/ "1100 0300 0020/0025",
+/*3397*/ "1100/0024",
+/*3398*/ "1100 0020/0024",
+/*3399*/ "1100 0300/0024",
+/*3400*/ "1100 0300 0020/0024",
+/*3401*/ "1100 0022",
+/*3402*/ "1100 0020/0022",
+/*3403*/ "1100 0300 0022",
+/*3404*/ "1100 0300 0020/0022",
+/*3405*/ "1100/1F1E6",
+/*3406*/ "1100 0020/1F1E6",
+/*3407*/ "1100 0300/1F1E6",
+/*3408*/ "1100 0300 0020/1F1E6",
+/*3409*/ "1100/0E01",
+/*3410*/ "1100 0020/0E01",
+/*3411*/ "1100 0300/0E01",
+/*3412*/ "1100 0300 0020/0E01",
+/*3413*/ "1100 0E31",
+/*3414*/ "1100 0020/0E31",
+/*3415*/ "1100 0300 0E31",
+/*3416*/ "1100 0300 0020/0E31",
+/*3417*/ "1100 0020",
+/*3418*/ "1100 0020 0020",
+/*3419*/ "1100 0300 0020",
+/*3420*/ "1100 0300 0020 0020",
+/*3421*/ "1100 002F",
+/*3422*/ "1100 0020 002F",
+/*3423*/ "1100 0300 002F",
+/*3424*/ "1100 0300 0020 002F",
+/*3425*/ "1100 2060",
+/*3426*/ "1100 0020 2060",
+/*3427*/ "1100 0300 2060",
+/*3428*/ "1100 0300 0020 2060",
+/*3429*/ "1100 200B",
+/*3430*/ "1100 0020 200B",
+/*3431*/ "1100 0300 200B",
+/*3432*/ "1100 0300 0020 200B",
+/*3433*/ "11A8/00A7",
+/*3434*/ "11A8 0020/00A7",
+/*3435*/ "11A8 0300/00A7",
+/*3436*/ "11A8 0300 0020/00A7",
+/*3437*/ "11A8/0023",
+/*3438*/ "11A8 0020/0023",
+/*3439*/ "11A8 0300/0023",
+/*3440*/ "11A8 0300 0020/0023",
+/*3441*/ "11A8/2014",
+/*3442*/ "11A8 0020/2014",
+/*3443*/ "11A8 0300/2014",
+/*3444*/ "11A8 0300 0020/2014",
+/*3445*/ "11A8 007C",
+/*3446*/ "11A8 0020/007C",
+/*3447*/ "11A8 0300 007C",
+/*3448*/ "11A8 0300 0020/007C",
+/*3449*/ "11A8/00B4",
+/*3450*/ "11A8 0020/00B4",
+/*3451*/ "11A8 0300/00B4",
+/*3452*/ "11A8 0300 0020/00B4",
+/*3453*/ "11A8 2028",
+/*3454*/ "11A8 0020 2028",
+/*3455*/ "11A8 0300 2028",
+/*3456*/ "11A8 0300 0020 2028",
+/*3457*/ "11A8/FFFC",
+/*3458*/ "11A8 0020/FFFC",
+/*3459*/ "11A8 0300/FFFC",
+/*3460*/ "11A8 0300 0020/FFFC",
+/*3461*/ "11A8 3041",
+/*3462*/ "11A8 0020/3041",
+/*3463*/ "11A8 0300 3041",
+/*3464*/ "11A8 0300 0020/3041",
+/*3465*/ "11A8 007D",
+/*3466*/ "11A8 0020 007D",
+/*3467*/ "11A8 0300 007D",
+/*3468*/ "11A8 0300 0020 007D",
+/*3469*/ "11A8 0300",
+/*3470*/ "11A8 0020/0300",
+/*3471*/ "11A8 0300 0300",
+/*3472*/ "11A8 0300 0020/0300",
+/*3473*/ "11A8 0029",
+/*3474*/ "11A8 0020 0029",
+/*3475*/ "11A8 0300 0029",
+/*3476*/ "11A8 0300 0020 0029",
+/*3477*/ "11A8 000D",
+/*3478*/ "11A8 0020 000D",
+/*3479*/ "11A8 0300 000D",
+/*3480*/ "11A8 0300 0020 000D",
+/*3481*/ "11A8 0021",
+/*3482*/ "11A8 0020 0021",
+/*3483*/ "11A8 0300 0021",
+/*3484*/ "11A8 0300 0020 0021",
+/*3485*/ "11A8 00A0",
+/*3486*/ "11A8 0020/00A0",
+/*3487*/ "11A8 0300 00A0",
+/*3488*/ "11A8 0300 0020/00A0",
+/*3489*/ "11A8/AC00",
+/*3490*/ "11A8 0020/AC00",
+/*3491*/ "11A8 0300/AC00",
+/*3492*/ "11A8 0300 0020/AC00",
+/*3493*/ "11A8/AC01",
+/*3494*/ "11A8 0020/AC01",
+/*3495*/ "11A8 0300/AC01",
+/*3496*/ "11A8 0300 0020/AC01",
+/*3497*/ "11A8/05D0",
+/*3498*/ "11A8 0020/05D0",
+/*3499*/ "11A8 0300/05D0",
+/*3500*/ "11A8 0300 0020/05D0",
+/*3501*/ "11A8 002D",
+/*3502*/ "11A8 0020/002D",
+/*3503*/ "11A8 0300 002D",
+/*3504*/ "11A8 0300 0020/002D",
+/*3505*/ "11A8/231A",
+/*3506*/ "11A8 0020/231A",
+/*3507*/ "11A8 0300/231A",
+/*3508*/ "11A8 0300 0020/231A",
+/*3509*/ "11A8 2024",
+/*3510*/ "11A8 0020/2024",
+/*3511*/ "11A8 0300 2024",
+/*3512*/ "11A8 0300 0020/2024",
+/*3513*/ "11A8 002C",
+/*3514*/ "11A8 0020 002C",
+/*3515*/ "11A8 0300 002C",
+/*3516*/ "11A8 0300 0020 002C",
+/*3517*/ "11A8/1100",
+/*3518*/ "11A8 0020/1100",
+/*3519*/ "11A8 0300/1100",
+/*3520*/ "11A8 0300 0020/1100",
+/*3521*/ "11A8 11A8",
+/*3522*/ "11A8 0020/11A8",
+/*3523*/ "11A8 0300 11A8",
+/*3524*/ "11A8 0300 0020/11A8",
+/*3525*/ "11A8/1160",
+/*3526*/ "11A8 0020/1160",
+/*3527*/ "11A8 0300/1160",
+/*3528*/ "11A8 0300 0020/1160",
+/*3529*/ "11A8 000A",
+/*3530*/ "11A8 0020 000A",
+/*3531*/ "11A8 0300 000A",
+/*3532*/ "11A8 0300 0020 000A",
+/*3533*/ "11A8 0085",
+/*3534*/ "11A8 0020 0085",
+/*3535*/ "11A8 0300 0085",
+/*3536*/ "11A8 0300 0020 0085",
+/*3537*/ "11A8 17D6",
+/*3538*/ "11A8 0020/17D6",
+/*3539*/ "11A8 0300 17D6",
+/*3540*/ "11A8 0300 0020/17D6",
+/*3541*/ "11A8/0030",
+/*3542*/ "11A8 0020/0030",
+/*3543*/ "11A8 0300/0030",
+/*3544*/ "11A8 0300 0020/0030",
+/*3545*/ "11A8/0028",
+/*3546*/ "11A8 0020/0028",
+/*3547*/ "11A8 0300/0028",
+/*3548*/ "11A8 0300 0020/0028",
+/*3549*/ "11A8 0025",
+/*3550*/ "11A8 0020/0025",
+/*3551*/ "11A8 0300 0025",
+/*3552*/ "11A8 0300 0020/0025",
+/*3553*/ "11A8/0024",
+/*3554*/ "11A8 0020/0024",
+/*3555*/ "11A8 0300/0024",
+/*3556*/ "11A8 0300 0020/0024",
+/*3557*/ "11A8 0022",
+/*3558*/ "11A8 0020/0022",
+/*3559*/ "11A8 0300 0022",
+/*3560*/ "11A8 0300 0020/0022",
+/*3561*/ "11A8/1F1E6",
+/*3562*/ "11A8 0020/1F1E6",
+/*3563*/ "11A8 0300/1F1E6",
+/*3564*/ "11A8 0300 0020/1F1E6",
+/*3565*/ "11A8/0E01",
+/*3566*/ "11A8 0020/0E01",
+/*3567*/ "11A8 0300/0E01",
+/*3568*/ "11A8 0300 0020/0E01",
+/*3569*/ "11A8 0E31",
+/*3570*/ "11A8 0020/0E31",
+/*3571*/ "11A8 0300 0E31",
+/*3572*/ "11A8 0300 0020/0E31",
+/*3573*/ "11A8 0020",
+/*3574*/ "11A8 0020 0020",
+/*3575*/ "11A8 0300 0020",
+/*3576*/ "11A8 0300 0020 0020",
+/*3577*/ "11A8 002F",
+/*3578*/ "11A8 0020 002F",
+/*3579*/ "11A8 0300 002F",
+/*3580*/ "11A8 0300 0020 002F",
+/*3581*/ "11A8 2060",
+/*3582*/ "11A8 0020 2060",
+/*3583*/ "11A8 0300 2060",
+/*3584*/ "11A8 0300 0020 2060",
+/*3585*/ "11A8 200B",
+/*3586*/ "11A8 0020 200B",
+/*3587*/ "11A8 0300 200B",
+/*3588*/ "11A8 0300 0020 200B",
+/*3589*/ "1160/00A7",
+/*3590*/ "1160 0020/00A7",
+/*3591*/ "1160 0300/00A7",
+/*3592*/ "1160 0300 0020/00A7",
+/*3593*/ "1160/0023",
+/*3594*/ "1160 0020/0023",
+/*3595*/ "1160 0300/0023",
+/*3596*/ "1160 0300 0020/0023",
+/*3597*/ "1160/2014",
+/*3598*/ "1160 0020/2014",
+/*3599*/ "1160 0300/2014",
+/*3600*/ "1160 0300 0020/2014",
+/*3601*/ "1160 007C",
+/*3602*/ "1160 0020/007C",
+/*3603*/ "1160 0300 007C",
+/*3604*/ "1160 0300 0020/007C",
+/*3605*/ "1160/00B4",
+/*3606*/ "1160 0020/00B4",
+/*3607*/ "1160 0300/00B4",
+/*3608*/ "1160 0300 0020/00B4",
+/*3609*/ "1160 2028",
+/*3610*/ "1160 0020 2028",
+/*3611*/ "1160 0300 2028",
+/*3612*/ "1160 0300 0020 2028",
+/*3613*/ "1160/FFFC",
+/*3614*/ "1160 0020/FFFC",
+/*3615*/ "1160 0300/FFFC",
+/*3616*/ "1160 0300 0020/FFFC",
+/*3617*/ "1160 3041",
+/*3618*/ "1160 0020/3041",
+/*3619*/ "1160 0300 3041",
+/*3620*/ "1160 0300 0020/3041",
+/*3621*/ "1160 007D",
+/*3622*/ "1160 0020 007D",
+/*3623*/ "1160 0300 007D",
+/*3624*/ "1160 0300 0020 007D",
+/*3625*/ "1160 0300",
+/*3626*/ "1160 0020/0300",
+/*3627*/ "1160 0300 0300",
+/*3628*/ "1160 0300 0020/0300",
+/*3629*/ "1160 0029",
+/*3630*/ "1160 0020 0029",
+/*3631*/ "1160 0300 0029",
+/*3632*/ "1160 0300 0020 0029",
+/*3633*/ "1160 000D",
+/*3634*/ "1160 0020 000D",
+/*3635*/ "1160 0300 000D",
+/*3636*/ "1160 0300 0020 000D",
+/*3637*/ "1160 0021",
+/*3638*/ "1160 0020 0021",
+/*3639*/ "1160 0300 0021",
+/*3640*/ "1160 0300 0020 0021",
+/*3641*/ "1160 00A0",
+/*3642*/ "1160 0020/00A0",
+/*3643*/ "1160 0300 00A0",
+/*3644*/ "1160 0300 0020/00A0",
+/*3645*/ "1160/AC00",
+/*3646*/ "1160 0020/AC00",
+/*3647*/ "1160 0300/AC00",
+/*3648*/ "1160 0300 0020/AC00",
+/*3649*/ "1160/AC01",
+/*3650*/ "1160 0020/AC01",
+/*3651*/ "1160 0300/AC01",
+/*3652*/ "1160 0300 0020/AC01",
+/*3653*/ "1160/05D0",
+/*3654*/ "1160 0020/05D0",
+/*3655*/ "1160 0300/05D0",
+/*3656*/ "1160 0300 0020/05D0",
+/*3657*/ "1160 002D",
+/*3658*/ "1160 0020/002D",
+/*3659*/ "1160 0300 002D",
+/*3660*/ "1160 0300 0020/002D",
+/*3661*/ "1160/231A",
+/*3662*/ "1160 0020/231A",
+/*3663*/ "1160 0300/231A",
+/*3664*/ "1160 0300 0020/231A",
+/*3665*/ "1160 2024",
+/*3666*/ "1160 0020/2024",
+/*3667*/ "1160 0300 2024",
+/*3668*/ "1160 0300 0020/2024",
+/*3669*/ "1160 002C",
+/*3670*/ "1160 0020 002C",
+/*3671*/ "1160 0300 002C",
+/*3672*/ "1160 0300 0020 002C",
+/*3673*/ "1160/1100",
+/*3674*/ "1160 0020/1100",
+/*3675*/ "1160 0300/1100",
+/*3676*/ "1160 0300 0020/1100",
+/*3677*/ "1160 11A8",
+/*3678*/ "1160 0020/11A8",
+/*3679*/ "1160 0300 11A8",
+/*3680*/ "1160 0300 0020/11A8",
+/*3681*/ "1160 1160",
+/*3682*/ "1160 0020/1160",
+/*3683*/ "1160 0300 1160",
+/*3684*/ "1160 0300 0020/1160",
+/*3685*/ "1160 000A",
+/*3686*/ "1160 0020 000A",
+/*3687*/ "1160 0300 000A",
+/*3688*/ "1160 0300 0020 000A",
+/*3689*/ "1160 0085",
+/*3690*/ "1160 0020 0085",
+/*3691*/ "1160 0300 0085",
+/*3692*/ "1160 0300 0020 0085",
+/*3693*/ "1160 17D6",
+/*3694*/ "1160 0020/17D6",
+/*3695*/ "1160 0300 17D6",
+/*3696*/ "1160 0300 0020/17D6",
+/*3697*/ "1160/0030",
+/*3698*/ "1160 0020/0030",
+/*3699*/ "1160 0300/0030",
+/*3700*/ "1160 0300 0020/0030",
+/*3701*/ "1160/0028",
+/*3702*/ "1160 0020/0028",
+/*3703*/ "1160 0300/0028",
+/*3704*/ "1160 0300 0020/0028",
+/*3705*/ "1160 0025",
+/*3706*/ "1160 0020/0025",
+/*3707*/ "1160 0300 0025",
+/*3708*/ "1160 0300 0020/0025",
+/*3709*/ "1160/0024",
+/*3710*/ "1160 0020/0024",
+/*3711*/ "1160 0300/0024",
+/*3712*/ "1160 0300 0020/0024",
+/*3713*/ "1160 0022",
+/*3714*/ "1160 0020/0022",
+/*3715*/ "1160 0300 0022",
+/*3716*/ "1160 0300 0020/0022",
+/*3717*/ "1160/1F1E6",
+/*3718*/ "1160 0020/1F1E6",
+/*3719*/ "1160 0300/1F1E6",
+/*3720*/ "1160 0300 0020/1F1E6",
+/*3721*/ "1160/0E01",
+/*3722*/ "1160 0020/0E01",
+/*3723*/ "1160 0300/0E01",
+/*3724*/ "1160 0300 0020/0E01",
+/*3725*/ "1160 0E31",
+/*3726*/ "1160 0020/0E31",
+/*3727*/ "1160 0300 0E31",
+/*3728*/ "1160 0300 0020/0E31",
+/*3729*/ "1160 0020",
+/*3730*/ "1160 0020 0020",
+/*3731*/ "1160 0300 0020",
+/*3732*/ "1160 0300 0020 0020",
+/*3733*/ "1160 002F",
+/*3734*/ "1160 0020 002F",
+/*3735*/ "1160 0300 002F",
+/*3736*/ "1160 0300 0020 002F",
+/*3737*/ "1160 2060",
+/*3738*/ "1160 0020 2060",
+/*3739*/ "1160 0300 2060",
+/*3740*/ "1160 0300 0020 2060",
+/*3741*/ "1160 200B",
+/*3742*/ "1160 0020 200B",
+/*3743*/ "1160 0300 200B",
+/*3744*/ "1160 0300 0020 200B",
+/*3745*/ "000A/00A7",
+/*3746*/ "000A/0020/00A7",
+/*3747*/ "000A/0300 00A7",
+/*3748*/ "000A/0300 0020/00A7",
+/*3749*/ "000A/0023",
+/*3750*/ "000A/0020/0023",
+/*3751*/ "000A/0300 0023",
+/*3752*/ "000A/0300 0020/0023",
+/*3753*/ "000A/2014",
+/*3754*/ "000A/0020/2014",
+/*3755*/ "000A/0300/2014",
+/*3756*/ "000A/0300 0020/2014",
+/*3757*/ "000A/007C",
+/*3758*/ "000A/0020/007C",
+/*3759*/ "000A/0300 007C",
+/*3760*/ "000A/0300 0020/007C",
+/*3761*/ "000A/00B4",
+/*3762*/ "000A/0020/00B4",
+/*3763*/ "000A/0300/00B4",
+/*3764*/ "000A/0300 0020/00B4",
+/*3765*/ "000A/2028",
+/*3766*/ "000A/0020 2028",
+/*3767*/ "000A/0300 2028",
+/*3768*/ "000A/0300 0020 2028",
+/*3769*/ "000A/FFFC",
+/*3770*/ "000A/0020/FFFC",
+/*3771*/ "000A/0300/FFFC",
+/*3772*/ "000A/0300 0020/FFFC",
+/*3773*/ "000A/3041",
+/*3774*/ "000A/0020/3041",
+/*3775*/ "000A/0300 3041",
+/*3776*/ "000A/0300 0020/3041",
+/*3777*/ "000A/007D",
+/*3778*/ "000A/0020 007D",
+/*3779*/ "000A/0300 007D",
+/*3780*/ "000A/0300 0020 007D",
+/*3781*/ "000A/0300",
+/*3782*/ "000A/0020/0300",
+/*3783*/ "000A/0300 0300",
+/*3784*/ "000A/0300 0020/0300",
+/*3785*/ "000A/0029",
+/*3786*/ "000A/0020 0029",
+/*3787*/ "000A/0300 0029",
+/*3788*/ "000A/0300 0020 0029",
+/*3789*/ "000A/000D",
+/*3790*/ "000A/0020 000D",
+/*3791*/ "000A/0300 000D",
+/*3792*/ "000A/0300 0020 000D",
+/*3793*/ "000A/0021",
+/*3794*/ "000A/0020 0021",
+/*3795*/ "000A/0300 0021",
+/*3796*/ "000A/0300 0020 0021",
+/*3797*/ "000A/00A0",
+/*3798*/ "000A/0020/00A0",
+/*3799*/ "000A/0300 00A0",
+/*3800*/ "000A/0300 0020/00A0",
+/*3801*/ "000A/AC00",
+/*3802*/ "000A/0020/AC00",
+/*3803*/ "000A/0300/AC00",
+/*3804*/ "000A/0300 0020/AC00",
+/*3805*/ "000A/AC01",
+/*3806*/ "000A/0020/AC01",
+/*3807*/ "000A/0300/AC01",
+/*3808*/ "000A/0300 0020/AC01",
+/*3809*/ "000A/05D0",
+/*3810*/ "000A/0020/05D0",
+/*3811*/ "000A/0300 05D0",
+/*3812*/ "000A/0300 0020/05D0",
+/*3813*/ "000A/002D",
+/*3814*/ "000A/0020/002D",
+/*3815*/ "000A/0300 002D",
+/*3816*/ "000A/0300 0020/002D",
+/*3817*/ "000A/231A",
+/*3818*/ "000A/0020/231A",
+/*3819*/ "000A/0300/231A",
+/*3820*/ "000A/0300 0020/231A",
+/*3821*/ "000A/2024",
+/*3822*/ "000A/0020/2024",
+/*3823*/ "000A/0300 2024",
+/*3824*/ "000A/0300 0020/2024",
+/*3825*/ "000A/002C",
+/*3826*/ "000A/0020 002C",
+/*3827*/ "000A/0300 002C",
+/*3828*/ "000A/0300 0020 002C",
+/*3829*/ "000A/1100",
+/*3830*/ "000A/0020/1100",
+/*3831*/ "000A/0300/1100",
+/*3832*/ "000A/0300 0020/1100",
+/*3833*/ "000A/11A8",
+/*3834*/ "000A/0020/11A8",
+/*3835*/ "000A/0300/11A8",
+/*3836*/ "000A/0300 0020/11A8",
+/*3837*/ "000A/1160",
+/*3838*/ "000A/0020/1160",
+/*3839*/ "000A/0300/1160",
+/*3840*/ "000A/0300 0020/1160",
+/*3841*/ "000A/000A",
+/*3842*/ "000A/0020 000A",
+/*3843*/ "000A/0300 000A",
+/*3844*/ "000A/0300 0020 000A",
+/*3845*/ "000A/0085",
+/*3846*/ "000A/0020 0085",
+/*3847*/ "000A/0300 0085",
+/*3848*/ "000A/0300 0020 0085",
+/*3849*/ "000A/17D6",
+/*3850*/ "000A/0020/17D6",
+/*3851*/ "000A/0300 17D6",
+/*3852*/ "000A/0300 0020/17D6",
+/*3853*/ "000A/0030",
+/*3854*/ "000A/0020/0030",
+/*3855*/ "000A/0300 0030",
+/*3856*/ "000A/0300 0020/0030",
+/*3857*/ "000A/0028",
+/*3858*/ "000A/0020/0028",
+/*3859*/ "000A/0300 0028",
+/*3860*/ "000A/0300 0020/0028",
+/*3861*/ "000A/0025",
+/*3862*/ "000A/0020/0025",
+/*3863*/ "000A/0300/0025",
+/*3864*/ "000A/0300 0020/0025",
+/*3865*/ "000A/0024",
+/*3866*/ "000A/0020/0024",
+/*3867*/ "000A/0300/0024",
+/*3868*/ "000A/0300 0020/0024",
+/*3869*/ "000A/0022",
+/*3870*/ "000A/0020/0022",
+/*3871*/ "000A/0300 0022",
+/*3872*/ "000A/0300 0020/0022",
+/*3873*/ "000A/1F1E6",
+/*3874*/ "000A/0020/1F1E6",
+/*3875*/ "000A/0300/1F1E6",
+/*3876*/ "000A/0300 0020/1F1E6",
+/*3877*/ "000A/0E01",
+/*3878*/ "000A/0020/0E01",
+/*3879*/ "000A/0300 0E01",
+/*3880*/ "000A/0300 0020/0E01",
+/*3881*/ "000A/0E31",
+/*3882*/ "000A/0020/0E31",
+/*3883*/ "000A/0300 0E31",
+/*3884*/ "000A/0300 0020/0E31",
+/*3885*/ "000A/0020",
+/*3886*/ "000A/0020 0020",
+/*3887*/ "000A/0300 0020",
+/*3888*/ "000A/0300 0020 0020",
+/*3889*/ "000A/002F",
+/*3890*/ "000A/0020 002F",
+/*3891*/ "000A/0300 002F",
+/*3892*/ "000A/0300 0020 002F",
+/*3893*/ "000A/2060",
+/*3894*/ "000A/0020 2060",
+/*3895*/ "000A/0300 2060",
+/*3896*/ "000A/0300 0020 2060",
+/*3897*/ "000A/200B",
+/*3898*/ "000A/0020 200B",
+/*3899*/ "000A/0300 200B",
+/*3900*/ "000A/0300 0020 200B",
+/*3901*/ "0085/00A7",
+/*3902*/ "0085/0020/00A7",
+/*3903*/ "0085/0300 00A7",
+/*3904*/ "0085/0300 0020/00A7",
+/*3905*/ "0085/0023",
+/*3906*/ "0085/0020/0023",
+/*3907*/ "0085/0300 0023",
+/*3908*/ "0085/0300 0020/0023",
+/*3909*/ "0085/2014",
+/*3910*/ "0085/0020/2014",
+/*3911*/ "0085/0300/2014",
+/*3912*/ "0085/0300 0020/2014",
+/*3913*/ "0085/007C",
+/*3914*/ "0085/0020/007C",
+/*3915*/ "0085/0300 007C",
+/*3916*/ "0085/0300 0020/007C",
+/*3917*/ "0085/00B4",
+/*3918*/ "0085/0020/00B4",
+/*3919*/ "0085/0300/00B4",
+/*3920*/ "0085/0300 0020/00B4",
+/*3921*/ "0085/2028",
+/*3922*/ "0085/0020 2028",
+/*3923*/ "0085/0300 2028",
+/*3924*/ "0085/0300 0020 2028",
+/*3925*/ "0085/FFFC",
+/*3926*/ "0085/0020/FFFC",
+/*3927*/ "0085/0300/FFFC",
+/*3928*/ "0085/0300 0020/FFFC",
+/*3929*/ "0085/3041",
+/*3930*/ "0085/0020/3041",
+/*3931*/ "0085/0300 3041",
+/*3932*/ "0085/0300 0020/3041",
+/*3933*/ "0085/007D",
+/*3934*/ "0085/0020 007D",
+/*3935*/ "0085/0300 007D",
+/*3936*/ "0085/0300 0020 007D",
+/*3937*/ "0085/0300",
+/*3938*/ "0085/0020/0300",
+/*3939*/ "0085/0300 0300",
+/*3940*/ "0085/0300 0020/0300",
+/*3941*/ "0085/0029",
+/*3942*/ "0085/0020 0029",
+/*3943*/ "0085/0300 0029",
+/*3944*/ "0085/0300 0020 0029",
+/*3945*/ "0085/000D",
+/*3946*/ "0085/0020 000D",
+/*3947*/ "0085/0300 000D",
+/*3948*/ "0085/0300 0020 000D",
+/*3949*/ "0085/0021",
+/*3950*/ "0085/0020 0021",
+/*3951*/ "0085/0300 0021",
+/*3952*/ "0085/0300 0020 0021",
+/*3953*/ "0085/00A0",
+/*3954*/ "0085/0020/00A0",
+/*3955*/ "0085/0300 00A0",
+/*3956*/ "0085/0300 0020/00A0",
+/*3957*/ "0085/AC00",
+/*3958*/ "0085/0020/AC00",
+/*3959*/ "0085/0300/AC00",
+/*3960*/ "0085/0300 0020/AC00",
+/*3961*/ "0085/AC01",
+/*3962*/ "0085/0020/AC01",
+/*3963*/ "0085/0300/AC01",
+/*3964*/ "0085/0300 0020/AC01",
+/*3965*/ "0085/05D0",
+/*3966*/ "0085/0020/05D0",
+/*3967*/ "0085/0300 05D0",
+/*3968*/ "0085/0300 0020/05D0",
+/*3969*/ "0085/002D",
+/*3970*/ "0085/0020/002D",
+/*3971*/ "0085/0300 002D",
+/*3972*/ "0085/0300 0020/002D",
+/*3973*/ "0085/231A",
+/*3974*/ "0085/0020/231A",
+/*3975*/ "0085/0300/231A",
+/*3976*/ "0085/0300 0020/231A",
+/*3977*/ "0085/2024",
+/*3978*/ "0085/0020/2024",
+/*3979*/ "0085/0300 2024",
+/*3980*/ "0085/0300 0020/2024",
+/*3981*/ "0085/002C",
+/*3982*/ "0085/0020 002C",
+/*3983*/ "0085/0300 002C",
+/*3984*/ "0085/0300 0020 002C",
+/*3985*/ "0085/1100",
+/*3986*/ "0085/0020/1100",
+/*3987*/ "0085/0300/1100",
+/*3988*/ "0085/0300 0020/1100",
+/*3989*/ "0085/11A8",
+/*3990*/ "0085/0020/11A8",
+/*3991*/ "0085/0300/11A8",
+/*3992*/ "0085/0300 0020/11A8",
+/*3993*/ "0085/1160",
+/*3994*/ "0085/0020/1160",
+/*3995*/ "0085/0300/1160",
+/*3996*/ "0085/0300 0020/1160",
+/*3997*/ "0085/000A",
+/*3998*/ "0085/0020 000A",
+/*3999*/ "0085/0300 000A",
+/*4000*/ "0085/0300 0020 000A",
+/*4001*/ "0085/0085",
+/*4002*/ "0085/0020 0085",
+/*4003*/ "0085/0300 0085",
+/*4004*/ "0085/0300 0020 0085",
+/*4005*/ "0085/17D6",
+/*4006*/ "0085/0020/17D6",
+/*4007*/ "0085/0300 17D6",
+/*4008*/ "0085/0300 0020/17D6",
+/*4009*/ "0085/0030",
+/*4010*/ "0085/0020/0030",
+/*4011*/ "0085/0300 0030",
+/*4012*/ "0085/0300 0020/0030",
+/*4013*/ "0085/0028",
+/*4014*/ "0085/0020/0028",
+/*4015*/ "0085/0300 0028",
+/*4016*/ "0085/0300 0020/0028",
+/*4017*/ "0085/0025",
+/*4018*/ "0085/0020/0025",
+/*4019*/ "0085/0300/0025",
+/*4020*/ "0085/0300 0020/0025",
+/*4021*/ "0085/0024",
+/*4022*/ "0085/0020/0024",
+/*4023*/ "0085/0300/0024",
+/*4024*/ "0085/0300 0020/0024",
+/*4025*/ "0085/0022",
+/*4026*/ "0085/0020/0022",
+/*4027*/ "0085/0300 0022",
+/*4028*/ "0085/0300 0020/0022",
+/*4029*/ "0085/1F1E6",
+/*4030*/ "0085/0020/1F1E6",
+/*4031*/ "0085/0300/1F1E6",
+/*4032*/ "0085/0300 0020/1F1E6",
+/*4033*/ "0085/0E01",
+/*4034*/ "0085/0020/0E01",
+/*4035*/ "0085/0300 0E01",
+/*4036*/ "0085/0300 0020/0E01",
+/*4037*/ "0085/0E31",
+/*4038*/ "0085/0020/0E31",
+/*4039*/ "0085/0300 0E31",
+/*4040*/ "0085/0300 0020/0E31",
+/*4041*/ "0085/0020",
+/*4042*/ "0085/0020 0020",
+/*4043*/ "0085/0300 0020",
+/*4044*/ "0085/0300 0020 0020",
+/*4045*/ "0085/002F",
+/*4046*/ "0085/0020 002F",
+/*4047*/ "0085/0300 002F",
+/*4048*/ "0085/0300 0020 002F",
+/*4049*/ "0085/2060",
+/*4050*/ "0085/0020 2060",
+/*4051*/ "0085/0300 2060",
+/*4052*/ "0085/0300 0020 2060",
+/*4053*/ "0085/200B",
+/*4054*/ "0085/0020 200B",
+/*4055*/ "0085/0300 200B",
+/*4056*/ "0085/0300 0020 200B",
+/*4057*/ "17D6/00A7",
+/*4058*/ "17D6 0020/00A7",
+/*4059*/ "17D6 0300/00A7",
+/*4060*/ "17D6 0300 0020/00A7",
+/*4061*/ "17D6/0023",
+/*4062*/ "17D6 0020/0023",
+/*4063*/ "17D6 0300/0023",
+/*4064*/ "17D6 0300 0020/0023",
+/*4065*/ "17D6/2014",
+/*4066*/ "17D6 0020/2014",
+/*4067*/ "17D6 0300/2014",
+/*4068*/ "17D6 0300 0020/2014",
+/*4069*/ "17D6 007C",
+/*4070*/ "17D6 0020/007C",
+/*4071*/ "17D6 0300 007C",
+/*4072*/ "17D6 0300 0020/007C",
+/*4073*/ "17D6/00B4",
+/*4074*/ "17D6 0020/00B4",
+/*4075*/ "17D6 0300/00B4",
+/*4076*/ "17D6 0300 0020/00B4",
+/*4077*/ "17D6 2028",
+/*4078*/ "17D6 0020 2028",
+/*4079*/ "17D6 0300 2028",
+/*4080*/ "17D6 0300 0020 2028",
+/*4081*/ "17D6/FFFC",
+/*4082*/ "17D6 0020/FFFC",
+/*4083*/ "17D6 0300/FFFC",
+/*4084*/ "17D6 0300 0020/FFFC",
+/*4085*/ "17D6 3041",
+/*4086*/ "17D6 0020/3041",
+/*4087*/ "17D6 0300 3041",
+/*4088*/ "17D6 0300 0020/3041",
+/*4089*/ "17D6 007D",
+/*4090*/ "17D6 0020 007D",
+/*4091*/ "17D6 0300 007D",
+/*4092*/ "17D6 0300 0020 007D",
+/*4093*/ "17D6 0300",
+/*4094*/ "17D6 0020/0300",
+/*4095*/ "17D6 0300 0300",
+/*4096*/ "17D6 0300 0020/0300",
+/*4097*/ "17D6 0029",
+/*4098*/ "17D6 0020 0029",
+/*4099*/ "17D6 0300 0029",
+/*4100*/ "17D6 0300 0020 0029",
+/*4101*/ "17D6 000D",
+/*4102*/ "17D6 0020 000D",
+/*4103*/ "17D6 0300 000D",
+/*4104*/ "17D6 0300 0020 000D",
+/*4105*/ "17D6 0021",
+/*4106*/ "17D6 0020 0021",
+/*4107*/ "17D6 0300 0021",
+/*4108*/ "17D6 0300 0020 0021",
+/*4109*/ "17D6 00A0",
+/*4110*/ "17D6 0020/00A0",
+/*4111*/ "17D6 0300 00A0",
+/*4112*/ "17D6 0300 0020/00A0",
+/*4113*/ "17D6/AC00",
+/*4114*/ "17D6 0020/AC00",
+/*4115*/ "17D6 0300/AC00",
+/*4116*/ "17D6 0300 0020/AC00",
+/*4117*/ "17D6/AC01",
+/*4118*/ "17D6 0020/AC01",
+/*4119*/ "17D6 0300/AC01",
+/*4120*/ "17D6 0300 0020/AC01",
+/*4121*/ "17D6/05D0",
+/*4122*/ "17D6 0020/05D0",
+/*4123*/ "17D6 0300/05D0",
+/*4124*/ "17D6 0300 0020/05D0",
+/*4125*/ "17D6 002D",
+/*4126*/ "17D6 0020/002D",
+/*4127*/ "17D6 0300 002D",
+/*4128*/ "17D6 0300 0020/002D",
+/*4129*/ "17D6/231A",
+/*4130*/ "17D6 0020/231A",
+/*4131*/ "17D6 0300/231A",
+/*4132*/ "17D6 0300 0020/231A",
+/*4133*/ "17D6/2024",
+/*4134*/ "17D6 0020/2024",
+/*4135*/ "17D6 0300/2024",
+/*4136*/ "17D6 0300 0020/2024",
+/*4137*/ "17D6 002C",
+/*4138*/ "17D6 0020 002C",
+/*4139*/ "17D6 0300 002C",
+/*4140*/ "17D6 0300 0020 002C",
+/*4141*/ "17D6/1100",
+/*4142*/ "17D6 0020/1100",
+/*4143*/ "17D6 0300/1100",
+/*4144*/ "17D6 0300 0020/1100",
+/*4145*/ "17D6/11A8",
+/*4146*/ "17D6 0020/11A8",
+/*4147*/ "17D6 0300/11A8",
+/*4148*/ "17D6 0300 0020/11A8",
+/*4149*/ "17D6/1160",
+/*4150*/ "17D6 0020/1160",
+/*4151*/ "17D6 0300/1160",
+/*4152*/ "17D6 0300 0020/1160",
+/*4153*/ "17D6 000A",
+/*4154*/ "17D6 0020 000A",
+/*4155*/ "17D6 0300 000A",
+/*4156*/ "17D6 0300 0020 000A",
+/*4157*/ "17D6 0085",
+/*4158*/ "17D6 0020 0085",
+/*4159*/ "17D6 0300 0085",
+/*4160*/ "17D6 0300 0020 0085",
+/*4161*/ "17D6 17D6",
+/*4162*/ "17D6 0020/17D6",
+/*4163*/ "17D6 0300 17D6",
+/*4164*/ "17D6 0300 0020/17D6",
+/*4165*/ "17D6/0030",
+/*4166*/ "17D6 0020/0030",
+/*4167*/ "17D6 0300/0030",
+/*4168*/ "17D6 0300 0020/0030",
+/*4169*/ "17D6/0028",
+/*4170*/ "17D6 0020/0028",
+/*4171*/ "17D6 0300/0028",
+/*4172*/ "17D6 0300 0020/0028",
+/*4173*/ "17D6/0025",
+/*4174*/ "17D6 0020/0025",
+/*4175*/ "17D6 0300/0025",
+/*4176*/ "17D6 0300 0020/0025",
+/*4177*/ "17D6/0024",
+/*4178*/ "17D6 0020/0024",
+/*4179*/ "17D6 0300/0024",
+/*4180*/ "17D6 0300 0020/0024",
+/*4181*/ "17D6 0022",
+/*4182*/ "17D6 0020/0022",
+/*4183*/ "17D6 0300 0022",
+/*4184*/ "17D6 0300 0020/0022",
+/*4185*/ "17D6/1F1E6",
+/*4186*/ "17D6 0020/1F1E6",
+/*4187*/ "17D6 0300/1F1E6",
+/*4188*/ "17D6 0300 0020/1F1E6",
+/*4189*/ "17D6/0E01",
+/*4190*/ "17D6 0020/0E01",
+/*4191*/ "17D6 0300/0E01",
+/*4192*/ "17D6 0300 0020/0E01",
+/*4193*/ "17D6 0E31",
+/*4194*/ "17D6 0020/0E31",
+/*4195*/ "17D6 0300 0E31",
+/*4196*/ "17D6 0300 0020/0E31",
+/*4197*/ "17D6 0020",
+/*4198*/ "17D6 0020 0020",
+/*4199*/ "17D6 0300 0020",
+/*4200*/ "17D6 0300 0020 0020",
+/*4201*/ "17D6 002F",
+/*4202*/ "17D6 0020 002F",
+/*4203*/ "17D6 0300 002F",
+/*4204*/ "17D6 0300 0020 002F",
+/*4205*/ "17D6 2060",
+/*4206*/ "17D6 0020 2060",
+/*4207*/ "17D6 0300 2060",
+/*4208*/ "17D6 0300 0020 2060",
+/*4209*/ "17D6 200B",
+/*4210*/ "17D6 0020 200B",
+/*4211*/ "17D6 0300 200B",
+/*4212*/ "17D6 0300 0020 200B",
+/*4213*/ "0030 00A7",
+/*4214*/ "0030 0020/00A7",
+/*4215*/ "0030 0300 00A7",
+/*4216*/ "0030 0300 0020/00A7",
+/*4217*/ "0030 0023",
+/*4218*/ "0030 0020/0023",
+/*4219*/ "0030 0300 0023",
+/*4220*/ "0030 0300 0020/0023",
+/*4221*/ "0030/2014",
+/*4222*/ "0030 0020/2014",
+/*4223*/ "0030 0300/2014",
+/*4224*/ "0030 0300 0020/2014",
+/*4225*/ "0030 007C",
+/*4226*/ "0030 0020/007C",
+/*4227*/ "0030 0300 007C",
+/*4228*/ "0030 0300 0020/007C",
+/*4229*/ "0030/00B4",
+/*4230*/ "0030 0020/00B4",
+/*4231*/ "0030 0300/00B4",
+/*4232*/ "0030 0300 0020/00B4",
+/*4233*/ "0030 2028",
+/*4234*/ "0030 0020 2028",
+/*4235*/ "0030 0300 2028",
+/*4236*/ "0030 0300 0020 2028",
+/*4237*/ "0030/FFFC",
+/*4238*/ "0030 0020/FFFC",
+/*4239*/ "0030 0300/FFFC",
+/*4240*/ "0030 0300 0020/FFFC",
+/*4241*/ "0030 3041",
+/*4242*/ "0030 0020/3041",
+/*4243*/ "0030 0300 3041",
+/*4244*/ "0030 0300 0020/3041",
+/*4245*/ "0030 007D",
+/*4246*/ "0030 0020 007D",
+/*4247*/ "0030 0300 007D",
+/*4248*/ "0030 0300 0020 007D",
+/*4249*/ "0030 0300",
+/*4250*/ "0030 0020/0300",
+/*4251*/ "0030 0300 0300",
+/*4252*/ "0030 0300 0020/0300",
+/*4253*/ "0030 0029",
+/*4254*/ "0030 0020 0029",
+/*4255*/ "0030 0300 0029",
+/*4256*/ "0030 0300 0020 0029",
+/*4257*/ "0030 000D",
+/*4258*/ "0030 0020 000D",
+/*4259*/ "0030 0300 000D",
+/*4260*/ "0030 0300 0020 000D",
+/*4261*/ "0030 0021",
+/*4262*/ "0030 0020 0021",
+/*4263*/ "0030 0300 0021",
+/*4264*/ "0030 0300 0020 0021",
+/*4265*/ "0030 00A0",
+/*4266*/ "0030 0020/00A0",
+/*4267*/ "0030 0300 00A0",
+/*4268*/ "0030 0300 0020/00A0",
+/*4269*/ "0030/AC00",
+/*4270*/ "0030 0020/AC00",
+/*4271*/ "0030 0300/AC00",
+/*4272*/ "0030 0300 0020/AC00",
+/*4273*/ "0030/AC01",
+/*4274*/ "0030 0020/AC01",
+/*4275*/ "0030 0300/AC01",
+/*4276*/ "0030 0300 0020/AC01",
+/*4277*/ "0030 05D0",
+/*4278*/ "0030 0020/05D0",
+/*4279*/ "0030 0300 05D0",
+/*4280*/ "0030 0300 0020/05D0",
+/*4281*/ "0030 002D",
+/*4282*/ "0030 0020/002D",
+/*4283*/ "0030 0300 002D",
+/*4284*/ "0030 0300 0020/002D",
+/*4285*/ "0030/231A",
+/*4286*/ "0030 0020/231A",
+/*4287*/ "0030 0300/231A",
+/*4288*/ "0030 0300 0020/231A",
+/*4289*/ "0030 2024",
+/*4290*/ "0030 0020/2024",
+/*4291*/ "0030 0300 2024",
+/*4292*/ "0030 0300 0020/2024",
+/*4293*/ "0030 002C",
+/*4294*/ "0030 0020 002C",
+/*4295*/ "0030 0300 002C",
+/*4296*/ "0030 0300 0020 002C",
+/*4297*/ "0030/1100",
+/*4298*/ "0030 0020/1100",
+/*4299*/ "0030 0300/1100",
+/*4300*/ "0030 0300 0020/1100",
+/*4301*/ "0030/11A8",
+/*4302*/ "0030 0020/11A8",
+/*4303*/ "0030 0300/11A8",
+/*4304*/ "0030 0300 0020/11A8",
+/*4305*/ "0030/1160",
+/*4306*/ "0030 0020/1160",
+/*4307*/ "0030 0300/1160",
+/*4308*/ "0030 0300 0020/1160",
+/*4309*/ "0030 000A",
+/*4310*/ "0030 0020 000A",
+/*4311*/ "0030 0300 000A",
+/*4312*/ "0030 0300 0020 000A",
+/*4313*/ "0030 0085",
+/*4314*/ "0030 0020 0085",
+/*4315*/ "0030 0300 0085",
+/*4316*/ "0030 0300 0020 0085",
+/*4317*/ "0030 17D6",
+/*4318*/ "0030 0020/17D6",
+/*4319*/ "0030 0300 17D6",
+/*4320*/ "0030 0300 0020/17D6",
+/*4321*/ "0030 0030",
+/*4322*/ "0030 0020/0030",
+/*4323*/ "0030 0300 0030",
+/*4324*/ "0030 0300 0020/0030",
+/*4325*/ "0030 0028",
+/*4326*/ "0030 0020/0028",
+/*4327*/ "0030 0300 0028",
+/*4328*/ "0030 0300 0020/0028",
+/*4329*/ "0030 0025",
+/*4330*/ "0030 0020/0025",
+/*4331*/ "0030 0300 0025",
+/*4332*/ "0030 0300 0020/0025",
+/*4333*/ "0030 0024",
+/*4334*/ "0030 0020/0024",
+/*4335*/ "0030 0300 0024",
+/*4336*/ "0030 0300 0020/0024",
+/*4337*/ "0030 0022",
+/*4338*/ "0030 0020/0022",
+/*4339*/ "0030 0300 0022",
+/*4340*/ "0030 0300 0020/0022",
+/*4341*/ "0030/1F1E6",
+/*4342*/ "0030 0020/1F1E6",
+/*4343*/ "0030 0300/1F1E6",
+/*4344*/ "0030 0300 0020/1F1E6",
+/*4345*/ "0030 0E01",
+/*4346*/ "0030 0020/0E01",
+/*4347*/ "0030 0300 0E01",
+/*4348*/ "0030 0300 0020/0E01",
+/*4349*/ "0030 0E31",
+/*4350*/ "0030 0020/0E31",
+/*4351*/ "0030 0300 0E31",
+/*4352*/ "0030 0300 0020/0E31",
+/*4353*/ "0030 0020",
+/*4354*/ "0030 0020 0020",
+/*4355*/ "0030 0300 0020",
+/*4356*/ "0030 0300 0020 0020",
+/*4357*/ "0030 002F",
+/*4358*/ "0030 0020 002F",
+/*4359*/ "0030 0300 002F",
+/*4360*/ "0030 0300 0020 002F",
+/*4361*/ "0030 2060",
+/*4362*/ "0030 0020 2060",
+/*4363*/ "0030 0300 2060",
+/*4364*/ "0030 0300 0020 2060",
+/*4365*/ "0030 200B",
+/*4366*/ "0030 0020 200B",
+/*4367*/ "0030 0300 200B",
+/*4368*/ "0030 0300 0020 200B",
+/*4369*/ "0028 00A7",
+/*4370*/ "0028 0020 00A7",
+/*4371*/ "0028 0300 00A7",
+/*4372*/ "0028 0300 0020 00A7",
+/*4373*/ "0028 0023",
+/*4374*/ "0028 0020 0023",
+/*4375*/ "0028 0300 0023",
+/*4376*/ "0028 0300 0020 0023",
+/*4377*/ "0028 2014",
+/*4378*/ "0028 0020 2014",
+/*4379*/ "0028 0300 2014",
+/*4380*/ "0028 0300 0020 2014",
+/*4381*/ "0028 007C",
+/*4382*/ "0028 0020 007C",
+/*4383*/ "0028 0300 007C",
+/*4384*/ "0028 0300 0020 007C",
+/*4385*/ "0028 00B4",
+/*4386*/ "0028 0020 00B4",
+/*4387*/ "0028 0300 00B4",
+/*4388*/ "0028 0300 0020 00B4",
+/*4389*/ "0028 2028",
+/*4390*/ "0028 0020 2028",
+/*4391*/ "0028 0300 2028",
+/*4392*/ "0028 0300 0020 2028",
+/*4393*/ "0028 FFFC",
+/*4394*/ "0028 0020 FFFC",
+/*4395*/ "0028 0300 FFFC",
+/*4396*/ "0028 0300 0020 FFFC",
+/*4397*/ "0028 3041",
+/*4398*/ "0028 0020 3041",
+/*4399*/ "0028 0300 3041",
+/*4400*/ "0028 0300 0020 3041",
+/*4401*/ "0028 007D",
+/*4402*/ "0028 0020 007D",
+/*4403*/ "0028 0300 007D",
+/*4404*/ "0028 0300 0020 007D",
+/*4405*/ "0028 0300",
+/*4406*/ "0028 0020 0300",
+/*4407*/ "0028 0300 0300",
+/*4408*/ "0028 0300 0020 0300",
+/*4409*/ "0028 0029",
+/*4410*/ "0028 0020 0029",
+/*4411*/ "0028 0300 0029",
+/*4412*/ "0028 0300 0020 0029",
+/*4413*/ "0028 000D",
+/*4414*/ "0028 0020 000D",
+/*4415*/ "0028 0300 000D",
+/*4416*/ "0028 0300 0020 000D",
+/*4417*/ "0028 0021",
+/*4418*/ "0028 0020 0021",
+/*4419*/ "0028 0300 0021",
+/*4420*/ "0028 0300 0020 0021",
+/*4421*/ "0028 00A0",
+/*4422*/ "0028 0020 00A0",
+/*4423*/ "0028 0300 00A0",
+/*4424*/ "0028 0300 0020 00A0",
+/*4425*/ "0028 AC00",
+/*4426*/ "0028 0020 AC00",
+/*4427*/ "0028 0300 AC00",
+/*4428*/ "0028 0300 0020 AC00",
+/*4429*/ "0028 AC01",
+/*4430*/ "0028 0020 AC01",
+/*4431*/ "0028 0300 AC01",
+/*4432*/ "0028 0300 0020 AC01",
+/*4433*/ "0028 05D0",
+/*4434*/ "0028 0020 05D0",
+/*4435*/ "0028 0300 05D0",
+/*4436*/ "0028 0300 0020 05D0",
+/*4437*/ "0028 002D",
+/*4438*/ "0028 0020 002D",
+/*4439*/ "0028 0300 002D",
+/*4440*/ "0028 0300 0020 002D",
+/*4441*/ "0028 231A",
+/*4442*/ "0028 0020 231A",
+/*4443*/ "0028 0300 231A",
+/*4444*/ "0028 0300 0020 231A",
+/*4445*/ "0028 2024",
+/*4446*/ "0028 0020 2024",
+/*4447*/ "0028 0300 2024",
+/*4448*/ "0028 0300 0020 2024",
+/*4449*/ "0028 002C",
+/*4450*/ "0028 0020 002C",
+/*4451*/ "0028 0300 002C",
+/*4452*/ "0028 0300 0020 002C",
+/*4453*/ "0028 1100",
+/*4454*/ "0028 0020 1100",
+/*4455*/ "0028 0300 1100",
+/*4456*/ "0028 0300 0020 1100",
+/*4457*/ "0028 11A8",
+/*4458*/ "0028 0020 11A8",
+/*4459*/ "0028 0300 11A8",
+/*4460*/ "0028 0300 0020 11A8",
+/*4461*/ "0028 1160",
+/*4462*/ "0028 0020 1160",
+/*4463*/ "0028 0300 1160",
+/*4464*/ "0028 0300 0020 1160",
+/*4465*/ "0028 000A",
+/*4466*/ "0028 0020 000A",
+/*4467*/ "0028 0300 000A",
+/*4468*/ "0028 0300 0020 000A",
+/*4469*/ "0028 0085",
+/*4470*/ "0028 0020 0085",
+/*4471*/ "0028 0300 0085",
+/*4472*/ "0028 0300 0020 0085",
+/*4473*/ "0028 17D6",
+/*4474*/ "0028 0020 17D6",
+/*4475*/ "0028 0300 17D6",
+/*4476*/ "0028 0300 0020 17D6",
+/*4477*/ "0028 0030",
+/*4478*/ "0028 0020 0030",
+/*4479*/ "0028 0300 0030",
+/*4480*/ "0028 0300 0020 0030",
+/*4481*/ "0028 0028",
+/*4482*/ "0028 0020 0028",
+/*4483*/ "0028 0300 0028",
+/*4484*/ "0028 0300 0020 0028",
+/*4485*/ "0028 0025",
+/*4486*/ "0028 0020 0025",
+/*4487*/ "0028 0300 0025",
+/*4488*/ "0028 0300 0020 0025",
+/*4489*/ "0028 0024",
+/*4490*/ "0028 0020 0024",
+/*4491*/ "0028 0300 0024",
+/*4492*/ "0028 0300 0020 0024",
+/*4493*/ "0028 0022",
+/*4494*/ "0028 0020 0022",
+/*4495*/ "0028 0300 0022",
+/*4496*/ "0028 0300 0020 0022",
+/*4497*/ "0028 1F1E6",
+/*4498*/ "0028 0020 1F1E6",
+/*4499*/ "0028 0300 1F1E6",
+/*4500*/ "0028 0300 0020 1F1E6",
+/*4501*/ "0028 0E01",
+/*4502*/ "0028 0020 0E01",
+/*4503*/ "0028 0300 0E01",
+/*4504*/ "0028 0300 0020 0E01",
+/*4505*/ "0028 0E31",
+/*4506*/ "0028 0020 0E31",
+/*4507*/ "0028 0300 0E31",
+/*4508*/ "0028 0300 0020 0E31",
+/*4509*/ "0028 0020",
+/*4510*/ "0028 0020 0020",
+/*4511*/ "0028 0300 0020",
+/*4512*/ "0028 0300 0020 0020",
+/*4513*/ "0028 002F",
+/*4514*/ "0028 0020 002F",
+/*4515*/ "0028 0300 002F",
+/*4516*/ "0028 0300 0020 002F",
+/*4517*/ "0028 2060",
+/*4518*/ "0028 0020 2060",
+/*4519*/ "0028 0300 2060",
+/*4520*/ "0028 0300 0020 2060",
+/*4521*/ "0028 200B",
+/*4522*/ "0028 0020 200B",
+/*4523*/ "0028 0300 200B",
+/*4524*/ "0028 0300 0020 200B",
+/*4525*/ "0025 00A7",
+/*4526*/ "0025 0020/00A7",
+/*4527*/ "0025 0300 00A7",
+/*4528*/ "0025 0300 0020/00A7",
+/*4529*/ "0025 0023",
+/*4530*/ "0025 0020/0023",
+/*4531*/ "0025 0300 0023",
+/*4532*/ "0025 0300 0020/0023",
+/*4533*/ "0025/2014",
+/*4534*/ "0025 0020/2014",
+/*4535*/ "0025 0300/2014",
+/*4536*/ "0025 0300 0020/2014",
+/*4537*/ "0025 007C",
+/*4538*/ "0025 0020/007C",
+/*4539*/ "0025 0300 007C",
+/*4540*/ "0025 0300 0020/007C",
+/*4541*/ "0025/00B4",
+/*4542*/ "0025 0020/00B4",
+/*4543*/ "0025 0300/00B4",
+/*4544*/ "0025 0300 0020/00B4",
+/*4545*/ "0025 2028",
+/*4546*/ "0025 0020 2028",
+/*4547*/ "0025 0300 2028",
+/*4548*/ "0025 0300 0020 2028",
+/*4549*/ "0025/FFFC",
+/*4550*/ "0025 0020/FFFC",
+/*4551*/ "0025 0300/FFFC",
+/*4552*/ "0025 0300 0020/FFFC",
+/*4553*/ "0025 3041",
+/*4554*/ "0025 0020/3041",
+/*4555*/ "0025 0300 3041",
+/*4556*/ "0025 0300 0020/3041",
+/*4557*/ "0025 007D",
+/*4558*/ "0025 0020 007D",
+/*4559*/ "0025 0300 007D",
+/*4560*/ "0025 0300 0020 007D",
+/*4561*/ "0025 0300",
+/*4562*/ "0025 0020/0300",
+/*4563*/ "0025 0300 0300",
+/*4564*/ "0025 0300 0020/0300",
+/*4565*/ "0025 0029",
+/*4566*/ "0025 0020 0029",
+/*4567*/ "0025 0300 0029",
+/*4568*/ "0025 0300 0020 0029",
+/*4569*/ "0025 000D",
+/*4570*/ "0025 0020 000D",
+/*4571*/ "0025 0300 000D",
+/*4572*/ "0025 0300 0020 000D",
+/*4573*/ "0025 0021",
+/*4574*/ "0025 0020 0021",
+/*4575*/ "0025 0300 0021",
+/*4576*/ "0025 0300 0020 0021",
+/*4577*/ "0025 00A0",
+/*4578*/ "0025 0020/00A0",
+/*4579*/ "0025 0300 00A0",
+/*4580*/ "0025 0300 0020/00A0",
+/*4581*/ "0025/AC00",
+/*4582*/ "0025 0020/AC00",
+/*4583*/ "0025 0300/AC00",
+/*4584*/ "0025 0300 0020/AC00",
+/*4585*/ "0025/AC01",
+/*4586*/ "0025 0020/AC01",
+/*4587*/ "0025 0300/AC01",
+/*4588*/ "0025 0300 0020/AC01",
+/*4589*/ "0025 05D0",
+/*4590*/ "0025 0020/05D0",
+/*4591*/ "0025 0300 05D0",
+/*4592*/ "0025 0300 0020/05D0",
+/*4593*/ "0025 002D",
+/*4594*/ "0025 0020/002D",
+/*4595*/ "0025 0300 002D",
+/*4596*/ "0025 0300 0020/002D",
+/*4597*/ "0025/231A",
+/*4598*/ "0025 0020/231A",
+/*4599*/ "0025 0300/231A",
+/*4600*/ "0025 0300 0020/231A",
+/*4601*/ "0025/2024",
+/*4602*/ "0025 0020/2024",
+/*4603*/ "0025 0300/2024",
+/*4604*/ "0025 0300 0020/2024",
+/*4605*/ "0025 002C",
+/*4606*/ "0025 0020 002C",
+/*4607*/ "0025 0300 002C",
+/*4608*/ "0025 0300 0020 002C",
+/*4609*/ "0025/1100",
+/*4610*/ "0025 0020/1100",
+/*4611*/ "0025 0300/1100",
+/*4612*/ "0025 0300 0020/1100",
+/*4613*/ "0025/11A8",
+/*4614*/ "0025 0020/11A8",
+/*4615*/ "0025 0300/11A8",
+/*4616*/ "0025 0300 0020/11A8",
+/*4617*/ "0025/1160",
+/*4618*/ "0025 0020/1160",
+/*4619*/ "0025 0300/1160",
+/*4620*/ "0025 0300 0020/1160",
+/*4621*/ "0025 000A",
+/*4622*/ "0025 0020 000A",
+/*4623*/ "0025 0300 000A",
+/*4624*/ "0025 0300 0020 000A",
+/*4625*/ "0025 0085",
+/*4626*/ "0025 0020 0085",
+/*4627*/ "0025 0300 0085",
+/*4628*/ "0025 0300 0020 0085",
+/*4629*/ "0025 17D6",
+/*4630*/ "0025 0020/17D6",
+/*4631*/ "0025 0300 17D6",
+/*4632*/ "0025 0300 0020/17D6",
+/*4633*/ "0025 0030",
+/*4634*/ "0025 0020/0030",
+/*4635*/ "0025 0300 0030",
+/*4636*/ "0025 0300 0020/0030",
+/*4637*/ "0025 0028",
+/*4638*/ "0025 0020/0028",
+/*4639*/ "0025 0300 0028",
+/*4640*/ "0025 0300 0020/0028",
+/*4641*/ "0025/0025",
+/*4642*/ "0025 0020/0025",
+/*4643*/ "0025 0300/0025",
+/*4644*/ "0025 0300 0020/0025",
+/*4645*/ "0025/0024",
+/*4646*/ "0025 0020/0024",
+/*4647*/ "0025 0300/0024",
+/*4648*/ "0025 0300 0020/0024",
+/*4649*/ "0025 0022",
+/*4650*/ "0025 0020/0022",
+/*4651*/ "0025 0300 0022",
+/*4652*/ "0025 0300 0020/0022",
+/*4653*/ "0025/1F1E6",
+/*4654*/ "0025 0020/1F1E6",
+/*4655*/ "0025 0300/1F1E6",
+/*4656*/ "0025 0300 0020/1F1E6",
+/*4657*/ "0025 0E01",
+/*4658*/ "0025 0020/0E01",
+/*4659*/ "0025 0300 0E01",
+/*4660*/ "0025 0300 0020/0E01",
+/*4661*/ "0025 0E31",
+/*4662*/ "0025 0020/0E31",
+/*4663*/ "0025 0300 0E31",
+/*4664*/ "0025 0300 0020/0E31",
+/*4665*/ "0025 0020",
+/*4666*/ "0025 0020 0020",
+/*4667*/ "0025 0300 0020",
+/*4668*/ "0025 0300 0020 0020",
+/*4669*/ "0025 002F",
+/*4670*/ "0025 0020 002F",
+/*4671*/ "0025 0300 002F",
+/*4672*/ "0025 0300 0020 002F",
+/*4673*/ "0025 2060",
+/*4674*/ "0025 0020 2060",
+/*4675*/ "0025 0300 2060",
+/*4676*/ "0025 0300 0020 2060",
+/*4677*/ "0025 200B",
+/*4678*/ "0025 0020 200B",
+/*4679*/ "0025 0300 200B",
+/*4680*/ "0025 0300 0020 200B",
+/*4681*/ "0024 00A7",
+/*4682*/ "0024 0020/00A7",
+/*4683*/ "0024 0300 00A7",
+/*4684*/ "0024 0300 0020/00A7",
+/*4685*/ "0024 0023",
+/*4686*/ "0024 0020/0023",
+/*4687*/ "0024 0300 0023",
+/*4688*/ "0024 0300 0020/0023",
+/*4689*/ "0024/2014",
+/*4690*/ "0024 0020/2014",
+/*4691*/ "0024 0300/2014",
+/*4692*/ "0024 0300 0020/2014",
+/*4693*/ "0024 007C",
+/*4694*/ "0024 0020/007C",
+/*4695*/ "0024 0300 007C",
+/*4696*/ "0024 0300 0020/007C",
+/*4697*/ "0024/00B4",
+/*4698*/ "0024 0020/00B4",
+/*4699*/ "0024 0300/00B4",
+/*4700*/ "0024 0300 0020/00B4",
+/*4701*/ "0024 2028",
+/*4702*/ "0024 0020 2028",
+/*4703*/ "0024 0300 2028",
+/*4704*/ "0024 0300 0020 2028",
+/*4705*/ "0024/FFFC",
+/*4706*/ "0024 0020/FFFC",
+/*4707*/ "0024 0300/FFFC",
+/*4708*/ "0024 0300 0020/FFFC",
+/*4709*/ "0024 3041",
+/*4710*/ "0024 0020/3041",
+/*4711*/ "0024 0300 3041",
+/*4712*/ "0024 0300 0020/3041",
+/*4713*/ "0024 007D",
+/*4714*/ "0024 0020 007D",
+/*4715*/ "0024 0300 007D",
+/*4716*/ "0024 0300 0020 007D",
+/*4717*/ "0024 0300",
+/*4718*/ "0024 0020/0300",
+/*4719*/ "0024 0300 0300",
+/*4720*/ "0024 0300 0020/0300",
+/*4721*/ "0024 0029",
+/*4722*/ "0024 0020 0029",
+/*4723*/ "0024 0300 0029",
+/*4724*/ "0024 0300 0020 0029",
+/*4725*/ "0024 000D",
+/*4726*/ "0024 0020 000D",
+/*4727*/ "0024 0300 000D",
+/*4728*/ "0024 0300 0020 000D",
+/*4729*/ "0024 0021",
+/*4730*/ "0024 0020 0021",
+/*4731*/ "0024 0300 0021",
+/*4732*/ "0024 0300 0020 0021",
+/*4733*/ "0024 00A0",
+/*4734*/ "0024 0020/00A0",
+/*4735*/ "0024 0300 00A0",
+/*4736*/ "0024 0300 0020/00A0",
+/*4737*/ "0024 AC00",
+/*4738*/ "0024 0020/AC00",
+/*4739*/ "0024 0300 AC00",
+/*4740*/ "0024 0300 0020/AC00",
+/*4741*/ "0024 AC01",
+/*4742*/ "0024 0020/AC01",
+/*4743*/ "0024 0300 AC01",
+/*4744*/ "0024 0300 0020/AC01",
+/*4745*/ "0024 05D0",
+/*4746*/ "0024 0020/05D0",
+/*4747*/ "0024 0300 05D0",
+/*4748*/ "0024 0300 0020/05D0",
+/*4749*/ "0024 002D",
+/*4750*/ "0024 0020/002D",
+/*4751*/ "0024 0300 002D",
+/*4752*/ "0024 0300 0020/002D",
+/*4753*/ "0024 231A",
+/*4754*/ "0024 0020/231A",
+/*4755*/ "0024 0300 231A",
+/*4756*/ "0024 0300 0020/231A",
+/*4757*/ "0024/2024",
+/*4758*/ "0024 0020/2024",
+/*4759*/ "0024 0300/2024",
+/*4760*/ "0024 0300 0020/2024",
+/*4761*/ "0024 002C",
+/*4762*/ "0024 0020 002C",
+/*4763*/ "0024 0300 002C",
+/*4764*/ "0024 0300 0020 002C",
+/*4765*/ "0024 1100",
+/*4766*/ "0024 0020/1100",
+/*4767*/ "0024 0300 1100",
+/*4768*/ "0024 0300 0020/1100",
+/*4769*/ "0024 11A8",
+/*4770*/ "0024 0020/11A8",
+/*4771*/ "0024 0300 11A8",
+/*4772*/ "0024 0300 0020/11A8",
+/*4773*/ "0024 1160",
+/*4774*/ "0024 0020/1160",
+/*4775*/ "0024 0300 1160",
+/*4776*/ "0024 0300 0020/1160",
+/*4777*/ "0024 000A",
+/*4778*/ "0024 0020 000A",
+/*4779*/ "0024 0300 000A",
+/*4780*/ "0024 0300 0020 000A",
+/*4781*/ "0024 0085",
+/*4782*/ "0024 0020 0085",
+/*4783*/ "0024 0300 0085",
+/*4784*/ "0024 0300 0020 0085",
+/*4785*/ "0024 17D6",
+/*4786*/ "0024 0020/17D6",
+/*4787*/ "0024 0300 17D6",
+/*4788*/ "0024 0300 0020/17D6",
+/*4789*/ "0024 0030",
+/*4790*/ "0024 0020/0030",
+/*4791*/ "0024 0300 0030",
+/*4792*/ "0024 0300 0020/0030",
+/*4793*/ "0024 0028",
+/*4794*/ "0024 0020/0028",
+/*4795*/ "0024 0300 0028",
+/*4796*/ "0024 0300 0020/0028",
+/*4797*/ "0024/0025",
+/*4798*/ "0024 0020/0025",
+/*4799*/ "0024 0300/0025",
+/*4800*/ "0024 0300 0020/0025",
+/*4801*/ "0024/0024",
+/*4802*/ "0024 0020/0024",
+/*4803*/ "0024 0300/0024",
+/*4804*/ "0024 0300 0020/0024",
+/*4805*/ "0024 0022",
+/*4806*/ "0024 0020/0022",
+/*4807*/ "0024 0300 0022",
+/*4808*/ "0024 0300 0020/0022",
+/*4809*/ "0024/1F1E6",
+/*4810*/ "0024 0020/1F1E6",
+/*4811*/ "0024 0300/1F1E6",
+/*4812*/ "0024 0300 0020/1F1E6",
+/*4813*/ "0024 0E01",
+/*4814*/ "0024 0020/0E01",
+/*4815*/ "0024 0300 0E01",
+/*4816*/ "0024 0300 0020/0E01",
+/*4817*/ "0024 0E31",
+/*4818*/ "0024 0020/0E31",
+/*4819*/ "0024 0300 0E31",
+/*4820*/ "0024 0300 0020/0E31",
+/*4821*/ "0024 0020",
+/*4822*/ "0024 0020 0020",
+/*4823*/ "0024 0300 0020",
+/*4824*/ "0024 0300 0020 0020",
+/*4825*/ "0024 002F",
+/*4826*/ "0024 0020 002F",
+/*4827*/ "0024 0300 002F",
+/*4828*/ "0024 0300 0020 002F",
+/*4829*/ "0024 2060",
+/*4830*/ "0024 0020 2060",
+/*4831*/ "0024 0300 2060",
+/*4832*/ "0024 0300 0020 2060",
+/*4833*/ "0024 200B",
+/*4834*/ "0024 0020 200B",
+/*4835*/ "0024 0300 200B",
+/*4836*/ "0024 0300 0020 200B",
+/*4837*/ "0022 00A7",
+/*4838*/ "0022 0020/00A7",
+/*4839*/ "0022 0300 00A7",
+/*4840*/ "0022 0300 0020/00A7",
+/*4841*/ "0022 0023",
+/*4842*/ "0022 0020/0023",
+/*4843*/ "0022 0300 0023",
+/*4844*/ "0022 0300 0020/0023",
+/*4845*/ "0022 2014",
+/*4846*/ "0022 0020/2014",
+/*4847*/ "0022 0300 2014",
+/*4848*/ "0022 0300 0020/2014",
+/*4849*/ "0022 007C",
+/*4850*/ "0022 0020/007C",
+/*4851*/ "0022 0300 007C",
+/*4852*/ "0022 0300 0020/007C",
+/*4853*/ "0022 00B4",
+/*4854*/ "0022 0020/00B4",
+/*4855*/ "0022 0300 00B4",
+/*4856*/ "0022 0300 0020/00B4",
+/*4857*/ "0022 2028",
+/*4858*/ "0022 0020 2028",
+/*4859*/ "0022 0300 2028",
+/*4860*/ "0022 0300 0020 2028",
+/*4861*/ "0022 FFFC",
+/*4862*/ "0022 0020/FFFC",
+/*4863*/ "0022 0300 FFFC",
+/*4864*/ "0022 0300 0020/FFFC",
+/*4865*/ "0022 3041",
+/*4866*/ "0022 0020/3041",
+/*4867*/ "0022 0300 3041",
+/*4868*/ "0022 0300 0020/3041",
+/*4869*/ "0022 007D",
+/*4870*/ "0022 0020 007D",
+/*4871*/ "0022 0300 007D",
+/*4872*/ "0022 0300 0020 007D",
+/*4873*/ "0022 0300",
+/*4874*/ "0022 0020/0300",
+/*4875*/ "0022 0300 0300",
+/*4876*/ "0022 0300 0020/0300",
+/*4877*/ "0022 0029",
+/*4878*/ "0022 0020 0029",
+/*4879*/ "0022 0300 0029",
+/*4880*/ "0022 0300 0020 0029",
+/*4881*/ "0022 000D",
+/*4882*/ "0022 0020 000D",
+/*4883*/ "0022 0300 000D",
+/*4884*/ "0022 0300 0020 000D",
+/*4885*/ "0022 0021",
+/*4886*/ "0022 0020 0021",
+/*4887*/ "0022 0300 0021",
+/*4888*/ "0022 0300 0020 0021",
+/*4889*/ "0022 00A0",
+/*4890*/ "0022 0020/00A0",
+/*4891*/ "0022 0300 00A0",
+/*4892*/ "0022 0300 0020/00A0",
+/*4893*/ "0022 AC00",
+/*4894*/ "0022 0020/AC00",
+/*4895*/ "0022 0300 AC00",
+/*4896*/ "0022 0300 0020/AC00",
+/*4897*/ "0022 AC01",
+/*4898*/ "0022 0020/AC01",
+/*4899*/ "0022 0300 AC01",
+/*4900*/ "0022 0300 0020/AC01",
+/*4901*/ "0022 05D0",
+/*4902*/ "0022 0020/05D0",
+/*4903*/ "0022 0300 05D0",
+/*4904*/ "0022 0300 0020/05D0",
+/*4905*/ "0022 002D",
+/*4906*/ "0022 0020/002D",
+/*4907*/ "0022 0300 002D",
+/*4908*/ "0022 0300 0020/002D",
+/*4909*/ "0022 231A",
+/*4910*/ "0022 0020/231A",
+/*4911*/ "0022 0300 231A",
+/*4912*/ "0022 0300 0020/231A",
+/*4913*/ "0022 2024",
+/*4914*/ "0022 0020/2024",
+/*4915*/ "0022 0300 2024",
+/*4916*/ "0022 0300 0020/2024",
+/*4917*/ "0022 002C",
+/*4918*/ "0022 0020 002C",
+/*4919*/ "0022 0300 002C",
+/*4920*/ "0022 0300 0020 002C",
+/*4921*/ "0022 1100",
+/*4922*/ "0022 0020/1100",
+/*4923*/ "0022 0300 1100",
+/*4924*/ "0022 0300 0020/1100",
+/*4925*/ "0022 11A8",
+/*4926*/ "0022 0020/11A8",
+/*4927*/ "0022 0300 11A8",
+/*4928*/ "0022 0300 0020/11A8",
+/*4929*/ "0022 1160",
+/*4930*/ "0022 0020/1160",
+/*4931*/ "0022 0300 1160",
+/*4932*/ "0022 0300 0020/1160",
+/*4933*/ "0022 000A",
+/*4934*/ "0022 0020 000A",
+/*4935*/ "0022 0300 000A",
+/*4936*/ "0022 0300 0020 000A",
+/*4937*/ "0022 0085",
+/*4938*/ "0022 0020 0085",
+/*4939*/ "0022 0300 0085",
+/*4940*/ "0022 0300 0020 0085",
+/*4941*/ "0022 17D6",
+/*4942*/ "0022 0020/17D6",
+/*4943*/ "0022 0300 17D6",
+/*4944*/ "0022 0300 0020/17D6",
+/*4945*/ "0022 0030",
+/*4946*/ "0022 0020/0030",
+/*4947*/ "0022 0300 0030",
+/*4948*/ "0022 0300 0020/0030",
+/*4949*/ "0022 0028",
+/*4950*/ "0022 0020 0028",
+/*4951*/ "0022 0300 0028",
+/*4952*/ "0022 0300 0020 0028",
+/*4953*/ "0022 0025",
+/*4954*/ "0022 0020/0025",
+/*4955*/ "0022 0300 0025",
+/*4956*/ "0022 0300 0020/0025",
+/*4957*/ "0022 0024",
+/*4958*/ "0022 0020/0024",
+/*4959*/ "0022 0300 0024",
+/*4960*/ "0022 0300 0020/0024",
+/*4961*/ "0022 0022",
+/*4962*/ "0022 0020/0022",
+/*4963*/ "0022 0300 0022",
+/*4964*/ "0022 0300 0020/0022",
+/*4965*/ "0022 1F1E6",
+/*4966*/ "0022 0020/1F1E6",
+/*4967*/ "0022 0300 1F1E6",
+/*4968*/ "0022 0300 0020/1F1E6",
+/*4969*/ "0022 0E01",
+/*4970*/ "0022 0020/0E01",
+/*4971*/ "0022 0300 0E01",
+/*4972*/ "0022 0300 0020/0E01",
+/*4973*/ "0022 0E31",
+/*4974*/ "0022 0020/0E31",
+/*4975*/ "0022 0300 0E31",
+/*4976*/ "0022 0300 0020/0E31",
+/*4977*/ "0022 0020",
+/*4978*/ "0022 0020 0020",
+/*4979*/ "0022 0300 0020",
+/*4980*/ "0022 0300 0020 0020",
+/*4981*/ "0022 002F",
+/*4982*/ "0022 0020 002F",
+/*4983*/ "0022 0300 002F",
+/*4984*/ "0022 0300 0020 002F",
+/*4985*/ "0022 2060",
+/*4986*/ "0022 0020 2060",
+/*4987*/ "0022 0300 2060",
+/*4988*/ "0022 0300 0020 2060",
+/*4989*/ "0022 200B",
+/*4990*/ "0022 0020 200B",
+/*4991*/ "0022 0300 200B",
+/*4992*/ "0022 0300 0020 200B",
+/*4993*/ "1F1E6/00A7",
+/*4994*/ "1F1E6 0020/00A7",
+/*4995*/ "1F1E6 0300/00A7",
+/*4996*/ "1F1E6 0300 0020/00A7",
+/*4997*/ "1F1E6/0023",
+/*4998*/ "1F1E6 0020/0023",
+/*4999*/ "1F1E6 0300/0023",
+/*5000*/ "1F1E6 0300 0020/0023",
+/*5001*/ "1F1E6/2014",
+/*5002*/ "1F1E6 0020/2014",
+/*5003*/ "1F1E6 0300/2014",
+/*5004*/ "1F1E6 0300 0020/2014",
+/*5005*/ "1F1E6 007C",
+/*5006*/ "1F1E6 0020/007C",
+/*5007*/ "1F1E6 0300 007C",
+/*5008*/ "1F1E6 0300 0020/007C",
+/*5009*/ "1F1E6/00B4",
+/*5010*/ "1F1E6 0020/00B4",
+/*5011*/ "1F1E6 0300/00B4",
+/*5012*/ "1F1E6 0300 0020/00B4",
+/*5013*/ "1F1E6 2028",
+/*5014*/ "1F1E6 0020 2028",
+/*5015*/ "1F1E6 0300 2028",
+/*5016*/ "1F1E6 0300 0020 2028",
+/*5017*/ "1F1E6/FFFC",
+/*5018*/ "1F1E6 0020/FFFC",
+/*5019*/ "1F1E6 0300/FFFC",
+/*5020*/ "1F1E6 0300 0020/FFFC",
+/*5021*/ "1F1E6 3041",
+/*5022*/ "1F1E6 0020/3041",
+/*5023*/ "1F1E6 0300 3041",
+/*5024*/ "1F1E6 0300 0020/3041",
+/*5025*/ "1F1E6 007D",
+/*5026*/ "1F1E6 0020 007D",
+/*5027*/ "1F1E6 0300 007D",
+/*5028*/ "1F1E6 0300 0020 007D",
+/*5029*/ "1F1E6 0300",
+/*5030*/ "1F1E6 0020/0300",
+/*5031*/ "1F1E6 0300 0300",
+/*5032*/ "1F1E6 0300 0020/0300",
+/*5033*/ "1F1E6 0029",
+/*5034*/ "1F1E6 0020 0029",
+/*5035*/ "1F1E6 0300 0029",
+/*5036*/ "1F1E6 0300 0020 0029",
+/*5037*/ "1F1E6 000D",
+/*5038*/ "1F1E6 0020 000D",
+/*5039*/ "1F1E6 0300 000D",
+/*5040*/ "1F1E6 0300 0020 000D",
+/*5041*/ "1F1E6 0021",
+/*5042*/ "1F1E6 0020 0021",
+/*5043*/ "1F1E6 0300 0021",
+/*5044*/ "1F1E6 0300 0020 0021",
+/*5045*/ "1F1E6 00A0",
+/*5046*/ "1F1E6 0020/00A0",
+/*5047*/ "1F1E6 0300 00A0",
+/*5048*/ "1F1E6 0300 0020/00A0",
+/*5049*/ "1F1E6/AC00",
+/*5050*/ "1F1E6 0020/AC00",
+/*5051*/ "1F1E6 0300/AC00",
+/*5052*/ "1F1E6 0300 0020/AC00",
+/*5053*/ "1F1E6/AC01",
+/*5054*/ "1F1E6 0020/AC01",
+/*5055*/ "1F1E6 0300/AC01",
+/*5056*/ "1F1E6 0300 0020/AC01",
+/*5057*/ "1F1E6/05D0",
+/*5058*/ "1F1E6 0020/05D0",
+/*5059*/ "1F1E6 0300/05D0",
+/*5060*/ "1F1E6 0300 0020/05D0",
+/*5061*/ "1F1E6 002D",
+/*5062*/ "1F1E6 0020/002D",
+/*5063*/ "1F1E6 0300 002D",
+/*5064*/ "1F1E6 0300 0020/002D",
+/*5065*/ "1F1E6/231A",
+/*5066*/ "1F1E6 0020/231A",
+/*5067*/ "1F1E6 0300/231A",
+/*5068*/ "1F1E6 0300 0020/231A",
+/*5069*/ "1F1E6/2024",
+/*5070*/ "1F1E6 0020/2024",
+/*5071*/ "1F1E6 0300/2024",
+/*5072*/ "1F1E6 0300 0020/2024",
+/*5073*/ "1F1E6 002C",
+/*5074*/ "1F1E6 0020 002C",
+/*5075*/ "1F1E6 0300 002C",
+/*5076*/ "1F1E6 0300 0020 002C",
+/*5077*/ "1F1E6/1100",
+/*5078*/ "1F1E6 0020/1100",
+/*5079*/ "1F1E6 0300/1100",
+/*5080*/ "1F1E6 0300 0020/1100",
+/*5081*/ "1F1E6/11A8",
+/*5082*/ "1F1E6 0020/11A8",
+/*5083*/ "1F1E6 0300/11A8",
+/*5084*/ "1F1E6 0300 0020/11A8",
+/*5085*/ "1F1E6/1160",
+/*5086*/ "1F1E6 0020/1160",
+/*5087*/ "1F1E6 0300/1160",
+/*5088*/ "1F1E6 0300 0020/1160",
+/*5089*/ "1F1E6 000A",
+/*5090*/ "1F1E6 0020 000A",
+/*5091*/ "1F1E6 0300 000A",
+/*5092*/ "1F1E6 0300 0020 000A",
+/*5093*/ "1F1E6 0085",
+/*5094*/ "1F1E6 0020 0085",
+/*5095*/ "1F1E6 0300 0085",
+/*5096*/ "1F1E6 0300 0020 0085",
+/*5097*/ "1F1E6 17D6",
+/*5098*/ "1F1E6 0020/17D6",
+/*5099*/ "1F1E6 0300 17D6",
+/*5100*/ "1F1E6 0300 0020/17D6",
+/*5101*/ "1F1E6/0030",
+/*5102*/ "1F1E6 0020/0030",
+/*5103*/ "1F1E6 0300/0030",
+/*5104*/ "1F1E6 0300 0020/0030",
+/*5105*/ "1F1E6/0028",
+/*5106*/ "1F1E6 0020/0028",
+/*5107*/ "1F1E6 0300/0028",
+/*5108*/ "1F1E6 0300 0020/0028",
+/*5109*/ "1F1E6/0025",
+/*5110*/ "1F1E6 0020/0025",
+/*5111*/ "1F1E6 0300/0025",
+/*5112*/ "1F1E6 0300 0020/0025",
+/*5113*/ "1F1E6/0024",
+/*5114*/ "1F1E6 0020/0024",
+/*5115*/ "1F1E6 0300/0024",
+/*5116*/ "1F1E6 0300 0020/0024",
+/*5117*/ "1F1E6 0022",
+/*5118*/ "1F1E6 0020/0022",
+/*5119*/ "1F1E6 0300 0022",
+/*5120*/ "1F1E6 0300 0020/0022",
+/*5121*/ "1F1E6 1F1E6",
+/*5122*/ "1F1E6 0020/1F1E6",
+/*5123*/ "1F1E6 0300 1F1E6",
+/*5124*/ "1F1E6 0300 0020/1F1E6",
+/*5125*/ "1F1E6/0E01",
+/*5126*/ "1F1E6 0020/0E01",
+/*5127*/ "1F1E6 0300/0E01",
+/*5128*/ "1F1E6 0300 0020/0E01",
+/*5129*/ "1F1E6 0E31",
+/*5130*/ "1F1E6 0020/0E31",
+/*5131*/ "1F1E6 0300 0E31",
+/*5132*/ "1F1E6 0300 0020/0E31",
+/*5133*/ "1F1E6 0020",
+/*5134*/ "1F1E6 0020 0020",
+/*5135*/ "1F1E6 0300 0020",
+/*5136*/ "1F1E6 0300 0020 0020",
+/*5137*/ "1F1E6 002F",
+/*5138*/ "1F1E6 0020 002F",
+/*5139*/ "1F1E6 0300 002F",
+/*5140*/ "1F1E6 0300 0020 002F",
+/*5141*/ "1F1E6 2060",
+/*5142*/ "1F1E6 0020 2060",
+/*5143*/ "1F1E6 0300 2060",
+/*5144*/ "1F1E6 0300 0020 2060",
+/*5145*/ "1F1E6 200B",
+/*5146*/ "1F1E6 0020 200B",
+/*5147*/ "1F1E6 0300 200B",
+/*5148*/ "1F1E6 0300 0020 200B",
+/*5149*/ "0E01 00A7",
+/*5150*/ "0E01 0020/00A7",
+/*5151*/ "0E01 0300 00A7",
+/*5152*/ "0E01 0300 0020/00A7",
+/*5153*/ "0E01 0023",
+/*5154*/ "0E01 0020/0023",
+/*5155*/ "0E01 0300 0023",
+/*5156*/ "0E01 0300 0020/0023",
+/*5157*/ "0E01/2014",
+/*5158*/ "0E01 0020/2014",
+/*5159*/ "0E01 0300/2014",
+/*5160*/ "0E01 0300 0020/2014",
+/*5161*/ "0E01 007C",
+/*5162*/ "0E01 0020/007C",
+/*5163*/ "0E01 0300 007C",
+/*5164*/ "0E01 0300 0020/007C",
+/*5165*/ "0E01/00B4",
+/*5166*/ "0E01 0020/00B4",
+/*5167*/ "0E01 0300/00B4",
+/*5168*/ "0E01 0300 0020/00B4",
+/*5169*/ "0E01 2028",
+/*5170*/ "0E01 0020 2028",
+/*5171*/ "0E01 0300 2028",
+/*5172*/ "0E01 0300 0020 2028",
+/*5173*/ "0E01/FFFC",
+/*5174*/ "0E01 0020/FFFC",
+/*5175*/ "0E01 0300/FFFC",
+/*5176*/ "0E01 0300 0020/FFFC",
+/*5177*/ "0E01 3041",
+/*5178*/ "0E01 0020/3041",
+/*5179*/ "0E01 0300 3041",
+/*5180*/ "0E01 0300 0020/3041",
+/*5181*/ "0E01 007D",
+/*5182*/ "0E01 0020 007D",
+/*5183*/ "0E01 0300 007D",
+/*5184*/ "0E01 0300 0020 007D",
+/*5185*/ "0E01 0300",
+/*5186*/ "0E01 0020/0300",
+/*5187*/ "0E01 0300 0300",
+/*5188*/ "0E01 0300 0020/0300",
+/*5189*/ "0E01 0029",
+/*5190*/ "0E01 0020 0029",
+/*5191*/ "0E01 0300 0029",
+/*5192*/ "0E01 0300 0020 0029",
+/*5193*/ "0E01 000D",
+/*5194*/ "0E01 0020 000D",
+/*5195*/ "0E01 0300 000D",
+/*5196*/ "0E01 0300 0020 000D",
+/*5197*/ "0E01 0021",
+/*5198*/ "0E01 0020 0021",
+/*5199*/ "0E01 0300 0021",
+/*5200*/ "0E01 0300 0020 0021",
+/*5201*/ "0E01 00A0",
+/*5202*/ "0E01 0020/00A0",
+/*5203*/ "0E01 0300 00A0",
+/*5204*/ "0E01 0300 0020/00A0",
+/*5205*/ "0E01/AC00",
+/*5206*/ "0E01 0020/AC00",
+/*5207*/ "0E01 0300/AC00",
+/*5208*/ "0E01 0300 0020/AC00",
+/*5209*/ "0E01/AC01",
+/*5210*/ "0E01 0020/AC01",
+/*5211*/ "0E01 0300/AC01",
+/*5212*/ "0E01 0300 0020/AC01",
+/*5213*/ "0E01 05D0",
+/*5214*/ "0E01 0020/05D0",
+/*5215*/ "0E01 0300 05D0",
+/*5216*/ "0E01 0300 0020/05D0",
+/*5217*/ "0E01 002D",
+/*5218*/ "0E01 0020/002D",
+/*5219*/ "0E01 0300 002D",
+/*5220*/ "0E01 0300 0020/002D",
+/*5221*/ "0E01/231A",
+/*5222*/ "0E01 0020/231A",
+/*5223*/ "0E01 0300/231A",
+/*5224*/ "0E01 0300 0020/231A",
+/*5225*/ "0E01 2024",
+/*5226*/ "0E01 0020/2024",
+/*5227*/ "0E01 0300 2024",
+/*5228*/ "0E01 0300 0020/2024",
+/*5229*/ "0E01 002C",
+/*5230*/ "0E01 0020 002C",
+/*5231*/ "0E01 0300 002C",
+/*5232*/ "0E01 0300 0020 002C",
+/*5233*/ "0E01/1100",
+/*5234*/ "0E01 0020/1100",
+/*5235*/ "0E01 0300/1100",
+/*5236*/ "0E01 0300 0020/1100",
+/*5237*/ "0E01/11A8",
+/*5238*/ "0E01 0020/11A8",
+/*5239*/ "0E01 0300/11A8",
+/*5240*/ "0E01 0300 0020/11A8",
+/*5241*/ "0E01/1160",
+/*5242*/ "0E01 0020/1160",
+/*5243*/ "0E01 0300/1160",
+/*5244*/ "0E01 0300 0020/1160",
+/*5245*/ "0E01 000A",
+/*5246*/ "0E01 0020 000A",
+/*5247*/ "0E01 0300 000A",
+/*5248*/ "0E01 0300 0020 000A",
+/*5249*/ "0E01 0085",
+/*5250*/ "0E01 0020 0085",
+/*5251*/ "0E01 0300 0085",
+/*5252*/ "0E01 0300 0020 0085",
+/*5253*/ "0E01 17D6",
+/*5254*/ "0E01 0020/17D6",
+/*5255*/ "0E01 0300 17D6",
+/*5256*/ "0E01 0300 0020/17D6",
+/*5257*/ "0E01 0030",
+/*5258*/ "0E01 0020/0030",
+/*5259*/ "0E01 0300 0030",
+/*5260*/ "0E01 0300 0020/0030",
+/*5261*/ "0E01 0028",
+/*5262*/ "0E01 0020/0028",
+/*5263*/ "0E01 0300 0028",
+/*5264*/ "0E01 0300 0020/0028",
+/*5265*/ "0E01/0025",
+/*5266*/ "0E01 0020/0025",
+/*5267*/ "0E01 0300/0025",
+/*5268*/ "0E01 0300 0020/0025",
+/*5269*/ "0E01/0024",
+/*5270*/ "0E01 0020/0024",
+/*5271*/ "0E01 0300/0024",
+/*5272*/ "0E01 0300 0020/0024",
+/*5273*/ "0E01 0022",
+/*5274*/ "0E01 0020/0022",
+/*5275*/ "0E01 0300 0022",
+/*5276*/ "0E01 0300 0020/0022",
+/*5277*/ "0E01/1F1E6",
+/*5278*/ "0E01 0020/1F1E6",
+/*5279*/ "0E01 0300/1F1E6",
+/*5280*/ "0E01 0300 0020/1F1E6",
+/*5281*/ "0E01 0E01",
+/*5282*/ "0E01 0020/0E01",
+/*5283*/ "0E01 0300 0E01",
+/*5284*/ "0E01 0300 0020/0E01",
+/*5285*/ "0E01 0E31",
+/*5286*/ "0E01 0020/0E31",
+/*5287*/ "0E01 0300 0E31",
+/*5288*/ "0E01 0300 0020/0E31",
+/*5289*/ "0E01 0020",
+/*5290*/ "0E01 0020 0020",
+/*5291*/ "0E01 0300 0020",
+/*5292*/ "0E01 0300 0020 0020",
+/*5293*/ "0E01 002F",
+/*5294*/ "0E01 0020 002F",
+/*5295*/ "0E01 0300 002F",
+/*5296*/ "0E01 0300 0020 002F",
+/*5297*/ "0E01 2060",
+/*5298*/ "0E01 0020 2060",
+/*5299*/ "0E01 0300 2060",
+/*5300*/ "0E01 0300 0020 2060",
+/*5301*/ "0E01 200B",
+/*5302*/ "0E01 0020 200B",
+/*5303*/ "0E01 0300 200B",
+/*5304*/ "0E01 0300 0020 200B",
+/*5305*/ "0E31 00A7",
+/*5306*/ "0E31 0020/00A7",
+/*5307*/ "0E31 0300 00A7",
+/*5308*/ "0E31 0300 0020/00A7",
+/*5309*/ "0E31 0023",
+/*5310*/ "0E31 0020/0023",
+/*5311*/ "0E31 0300 0023",
+/*5312*/ "0E31 0300 0020/0023",
+/*5313*/ "0E31/2014",
+/*5314*/ "0E31 0020/2014",
+/*5315*/ "0E31 0300/2014",
+/*5316*/ "0E31 0300 0020/2014",
+/*5317*/ "0E31 007C",
+/*5318*/ "0E31 0020/007C",
+/*5319*/ "0E31 0300 007C",
+/*5320*/ "0E31 0300 0020/007C",
+/*5321*/ "0E31/00B4",
+/*5322*/ "0E31 0020/00B4",
+/*5323*/ "0E31 0300/00B4",
+/*5324*/ "0E31 0300 0020/00B4",
+/*5325*/ "0E31 2028",
+/*5326*/ "0E31 0020 2028",
+/*5327*/ "0E31 0300 2028",
+/*5328*/ "0E31 0300 0020 2028",
+/*5329*/ "0E31/FFFC",
+/*5330*/ "0E31 0020/FFFC",
+/*5331*/ "0E31 0300/FFFC",
+/*5332*/ "0E31 0300 0020/FFFC",
+/*5333*/ "0E31 3041",
+/*5334*/ "0E31 0020/3041",
+/*5335*/ "0E31 0300 3041",
+/*5336*/ "0E31 0300 0020/3041",
+/*5337*/ "0E31 007D",
+/*5338*/ "0E31 0020 007D",
+/*5339*/ "0E31 0300 007D",
+/*5340*/ "0E31 0300 0020 007D",
+/*5341*/ "0E31 0300",
+/*5342*/ "0E31 0020/0300",
+/*5343*/ "0E31 0300 0300",
+/*5344*/ "0E31 0300 0020/0300",
+/*5345*/ "0E31 0029",
+/*5346*/ "0E31 0020 0029",
+/*5347*/ "0E31 0300 0029",
+/*5348*/ "0E31 0300 0020 0029",
+/*5349*/ "0E31 000D",
+/*5350*/ "0E31 0020 000D",
+/*5351*/ "0E31 0300 000D",
+/*5352*/ "0E31 0300 0020 000D",
+/*5353*/ "0E31 0021",
+/*5354*/ "0E31 0020 0021",
+/*5355*/ "0E31 0300 0021",
+/*5356*/ "0E31 0300 0020 0021",
+/*5357*/ "0E31 00A0",
+/*5358*/ "0E31 0020/00A0",
+/*5359*/ "0E31 0300 00A0",
+/*5360*/ "0E31 0300 0020/00A0",
+/*5361*/ "0E31/AC00",
+/*5362*/ "0E31 0020/AC00",
+/*5363*/ "0E31 0300/AC00",
+/*5364*/ "0E31 0300 0020/AC00",
+/*5365*/ "0E31/AC01",
+/*5366*/ "0E31 0020/AC01",
+/*5367*/ "0E31 0300/AC01",
+/*5368*/ "0E31 0300 0020/AC01",
+/*5369*/ "0E31 05D0",
+/*5370*/ "0E31 0020/05D0",
+/*5371*/ "0E31 0300 05D0",
+/*5372*/ "0E31 0300 0020/05D0",
+/*5373*/ "0E31 002D",
+/*5374*/ "0E31 0020/002D",
+/*5375*/ "0E31 0300 002D",
+/*5376*/ "0E31 0300 0020/002D",
+/*5377*/ "0E31/231A",
+/*5378*/ "0E31 0020/231A",
+/*5379*/ "0E31 0300/231A",
+/*5380*/ "0E31 0300 0020/231A",
+/*5381*/ "0E31 2024",
+/*5382*/ "0E31 0020/2024",
+/*5383*/ "0E31 0300 2024",
+/*5384*/ "0E31 0300 0020/2024",
+/*5385*/ "0E31 002C",
+/*5386*/ "0E31 0020 002C",
+/*5387*/ "0E31 0300 002C",
+/*5388*/ "0E31 0300 0020 002C",
+/*5389*/ "0E31/1100",
+/*5390*/ "0E31 0020/1100",
+/*5391*/ "0E31 0300/1100",
+/*5392*/ "0E31 0300 0020/1100",
+/*5393*/ "0E31/11A8",
+/*5394*/ "0E31 0020/11A8",
+/*5395*/ "0E31 0300/11A8",
+/*5396*/ "0E31 0300 0020/11A8",
+/*5397*/ "0E31/1160",
+/*5398*/ "0E31 0020/1160",
+/*5399*/ "0E31 0300/1160",
+/*5400*/ "0E31 0300 0020/1160",
+/*5401*/ "0E31 000A",
+/*5402*/ "0E31 0020 000A",
+/*5403*/ "0E31 0300 000A",
+/*5404*/ "0E31 0300 0020 000A",
+/*5405*/ "0E31 0085",
+/*5406*/ "0E31 0020 0085",
+/*5407*/ "0E31 0300 0085",
+/*5408*/ "0E31 0300 0020 0085",
+/*5409*/ "0E31 17D6",
+/*5410*/ "0E31 0020/17D6",
+/*5411*/ "0E31 0300 17D6",
+/*5412*/ "0E31 0300 0020/17D6",
+/*5413*/ "0E31 0030",
+/*5414*/ "0E31 0020/0030",
+/*5415*/ "0E31 0300 0030",
+/*5416*/ "0E31 0300 0020/0030",
+/*5417*/ "0E31 0028",
+/*5418*/ "0E31 0020/0028",
+/*5419*/ "0E31 0300 0028",
+/*5420*/ "0E31 0300 0020/0028",
+/*5421*/ "0E31/0025",
+/*5422*/ "0E31 0020/0025",
+/*5423*/ "0E31 0300/0025",
+/*5424*/ "0E31 0300 0020/0025",
+/*5425*/ "0E31/0024",
+/*5426*/ "0E31 0020/0024",
+/*5427*/ "0E31 0300/0024",
+/*5428*/ "0E31 0300 0020/0024",
+/*5429*/ "0E31 0022",
+/*5430*/ "0E31 0020/0022",
+/*5431*/ "0E31 0300 0022",
+/*5432*/ "0E31 0300 0020/0022",
+/*5433*/ "0E31/1F1E6",
+/*5434*/ "0E31 0020/1F1E6",
+/*5435*/ "0E31 0300/1F1E6",
+/*5436*/ "0E31 0300 0020/1F1E6",
+/*5437*/ "0E31 0E01",
+/*5438*/ "0E31 0020/0E01",
+/*5439*/ "0E31 0300 0E01",
+/*5440*/ "0E31 0300 0020/0E01",
+/*5441*/ "0E31 0E31",
+/*5442*/ "0E31 0020/0E31",
+/*5443*/ "0E31 0300 0E31",
+/*5444*/ "0E31 0300 0020/0E31",
+/*5445*/ "0E31 0020",
+/*5446*/ "0E31 0020 0020",
+/*5447*/ "0E31 0300 0020",
+/*5448*/ "0E31 0300 0020 0020",
+/*5449*/ "0E31 002F",
+/*5450*/ "0E31 0020 002F",
+/*5451*/ "0E31 0300 002F",
+/*5452*/ "0E31 0300 0020 002F",
+/*5453*/ "0E31 2060",
+/*5454*/ "0E31 0020 2060",
+/*5455*/ "0E31 0300 2060",
+/*5456*/ "0E31 0300 0020 2060",
+/*5457*/ "0E31 200B",
+/*5458*/ "0E31 0020 200B",
+/*5459*/ "0E31 0300 200B",
+/*5460*/ "0E31 0300 0020 200B",
+/*5461*/ "0020/00A7",
+/*5462*/ "0020 0020/00A7",
+/*5463*/ "0020/0300 00A7",
+/*5464*/ "0020/0300 0020/00A7",
+/*5465*/ "0020/0023",
+/*5466*/ "0020 0020/0023",
+/*5467*/ "0020/0300 0023",
+/*5468*/ "0020/0300 0020/0023",
+/*5469*/ "0020/2014",
+/*5470*/ "0020 0020/2014",
+/*5471*/ "0020/0300/2014",
+/*5472*/ "0020/0300 0020/2014",
+/*5473*/ "0020/007C",
+/*5474*/ "0020 0020/007C",
+/*5475*/ "0020/0300 007C",
+/*5476*/ "0020/0300 0020/007C",
+/*5477*/ "0020/00B4",
+/*5478*/ "0020 0020/00B4",
+/*5479*/ "0020/0300/00B4",
+/*5480*/ "0020/0300 0020/00B4",
+/*5481*/ "0020 2028",
+/*5482*/ "0020 0020 2028",
+/*5483*/ "0020/0300 2028",
+/*5484*/ "0020/0300 0020 2028",
+/*5485*/ "0020/FFFC",
+/*5486*/ "0020 0020/FFFC",
+/*5487*/ "0020/0300/FFFC",
+/*5488*/ "0020/0300 0020/FFFC",
+/*5489*/ "0020/3041",
+/*5490*/ "0020 0020/3041",
+/*5491*/ "0020/0300 3041",
+/*5492*/ "0020/0300 0020/3041",
+/*5493*/ "0020 007D",
+/*5494*/ "0020 0020 007D",
+/*5495*/ "0020/0300 007D",
+/*5496*/ "0020/0300 0020 007D",
+/*5497*/ "0020/0300",
+/*5498*/ "0020 0020/0300",
+/*5499*/ "0020/0300 0300",
+/*5500*/ "0020/0300 0020/0300",
+/*5501*/ "0020 0029",
+/*5502*/ "0020 0020 0029",
+/*5503*/ "0020/0300 0029",
+/*5504*/ "0020/0300 0020 0029",
+/*5505*/ "0020 000D",
+/*5506*/ "0020 0020 000D",
+/*5507*/ "0020/0300 000D",
+/*5508*/ "0020/0300 0020 000D",
+/*5509*/ "0020 0021",
+/*5510*/ "0020 0020 0021",
+/*5511*/ "0020/0300 0021",
+/*5512*/ "0020/0300 0020 0021",
+/*5513*/ "0020/00A0",
+/*5514*/ "0020 0020/00A0",
+/*5515*/ "0020/0300 00A0",
+/*5516*/ "0020/0300 0020/00A0",
+/*5517*/ "0020/AC00",
+/*5518*/ "0020 0020/AC00",
+/*5519*/ "0020/0300/AC00",
+/*5520*/ "0020/0300 0020/AC00",
+/*5521*/ "0020/AC01",
+/*5522*/ "0020 0020/AC01",
+/*5523*/ "0020/0300/AC01",
+/*5524*/ "0020/0300 0020/AC01",
+/*5525*/ "0020/05D0",
+/*5526*/ "0020 0020/05D0",
+/*5527*/ "0020/0300 05D0",
+/*5528*/ "0020/0300 0020/05D0",
+/*5529*/ "0020/002D",
+/*5530*/ "0020 0020/002D",
+/*5531*/ "0020/0300 002D",
+/*5532*/ "0020/0300 0020/002D",
+/*5533*/ "0020/231A",
+/*5534*/ "0020 0020/231A",
+/*5535*/ "0020/0300/231A",
+/*5536*/ "0020/0300 0020/231A",
+/*5537*/ "0020/2024",
+/*5538*/ "0020 0020/2024",
+/*5539*/ "0020/0300 2024",
+/*5540*/ "0020/0300 0020/2024",
+/*5541*/ "0020 002C",
+/*5542*/ "0020 0020 002C",
+/*5543*/ "0020/0300 002C",
+/*5544*/ "0020/0300 0020 002C",
+/*5545*/ "0020/1100",
+/*5546*/ "0020 0020/1100",
+/*5547*/ "0020/0300/1100",
+/*5548*/ "0020/0300 0020/1100",
+/*5549*/ "0020/11A8",
+/*5550*/ "0020 0020/11A8",
+/*5551*/ "0020/0300/11A8",
+/*5552*/ "0020/0300 0020/11A8",
+/*5553*/ "0020/1160",
+/*5554*/ "0020 0020/1160",
+/*5555*/ "0020/0300/1160",
+/*5556*/ "0020/0300 0020/1160",
+/*5557*/ "0020 000A",
+/*5558*/ "0020 0020 000A",
+/*5559*/ "0020/0300 000A",
+/*5560*/ "0020/0300 0020 000A",
+/*5561*/ "0020 0085",
+/*5562*/ "0020 0020 0085",
+/*5563*/ "0020/0300 0085",
+/*5564*/ "0020/0300 0020 0085",
+/*5565*/ "0020/17D6",
+/*5566*/ "0020 0020/17D6",
+/*5567*/ "0020/0300 17D6",
+/*5568*/ "0020/0300 0020/17D6",
+/*5569*/ "0020/0030",
+/*5570*/ "0020 0020/0030",
+/*5571*/ "0020/0300 0030",
+/*5572*/ "0020/0300 0020/0030",
+/*5573*/ "0020/0028",
+/*5574*/ "0020 0020/0028",
+/*5575*/ "0020/0300 0028",
+/*5576*/ "0020/0300 0020/0028",
+/*5577*/ "0020/0025",
+/*5578*/ "0020 0020/0025",
+/*5579*/ "0020/0300/0025",
+/*5580*/ "0020/0300 0020/0025",
+/*5581*/ "0020/0024",
+/*5582*/ "0020 0020/0024",
+/*5583*/ "0020/0300/0024",
+/*5584*/ "0020/0300 0020/0024",
+/*5585*/ "0020/0022",
+/*5586*/ "0020 0020/0022",
+/*5587*/ "0020/0300 0022",
+/*5588*/ "0020/0300 0020/0022",
+/*5589*/ "0020/1F1E6",
+/*5590*/ "0020 0020/1F1E6",
+/*5591*/ "0020/0300/1F1E6",
+/*5592*/ "0020/0300 0020/1F1E6",
+/*5593*/ "0020/0E01",
+/*5594*/ "0020 0020/0E01",
+/*5595*/ "0020/0300 0E01",
+/*5596*/ "0020/0300 0020/0E01",
+/*5597*/ "0020/0E31",
+/*5598*/ "0020 0020/0E31",
+/*5599*/ "0020/0300 0E31",
+/*5600*/ "0020/0300 0020/0E31",
+/*5601*/ "0020 0020",
+/*5602*/ "0020 0020 0020",
+/*5603*/ "0020/0300 0020",
+/*5604*/ "0020/0300 0020 0020",
+/*5605*/ "0020 002F",
+/*5606*/ "0020 0020 002F",
+/*5607*/ "0020/0300 002F",
+/*5608*/ "0020/0300 0020 002F",
+/*5609*/ "0020 2060",
+/*5610*/ "0020 0020 2060",
+/*5611*/ "0020/0300 2060",
+/*5612*/ "0020/0300 0020 2060",
+/*5613*/ "0020 200B",
+/*5614*/ "0020 0020 200B",
+/*5615*/ "0020/0300 200B",
+/*5616*/ "0020/0300 0020 200B",
+/*5617*/ "002F/00A7",
+/*5618*/ "002F 0020/00A7",
+/*5619*/ "002F 0300/00A7",
+/*5620*/ "002F 0300 0020/00A7",
+/*5621*/ "002F/0023",
+/*5622*/ "002F 0020/0023",
+/*5623*/ "002F 0300/0023",
+/*5624*/ "002F 0300 0020/0023",
+/*5625*/ "002F/2014",
+/*5626*/ "002F 0020/2014",
+/*5627*/ "002F 0300/2014",
+/*5628*/ "002F 0300 0020/2014",
+/*5629*/ "002F 007C",
+/*5630*/ "002F 0020/007C",
+/*5631*/ "002F 0300 007C",
+/*5632*/ "002F 0300 0020/007C",
+/*5633*/ "002F/00B4",
+/*5634*/ "002F 0020/00B4",
+/*5635*/ "002F 0300/00B4",
+/*5636*/ "002F 0300 0020/00B4",
+/*5637*/ "002F 2028",
+/*5638*/ "002F 0020 2028",
+/*5639*/ "002F 0300 2028",
+/*5640*/ "002F 0300 0020 2028",
+/*5641*/ "002F/FFFC",
+/*5642*/ "002F 0020/FFFC",
+/*5643*/ "002F 0300/FFFC",
+/*5644*/ "002F 0300 0020/FFFC",
+/*5645*/ "002F 3041",
+/*5646*/ "002F 0020/3041",
+/*5647*/ "002F 0300 3041",
+/*5648*/ "002F 0300 0020/3041",
+/*5649*/ "002F 007D",
+/*5650*/ "002F 0020 007D",
+/*5651*/ "002F 0300 007D",
+/*5652*/ "002F 0300 0020 007D",
+/*5653*/ "002F 0300",
+/*5654*/ "002F 0020/0300",
+/*5655*/ "002F 0300 0300",
+/*5656*/ "002F 0300 0020/0300",
+/*5657*/ "002F 0029",
+/*5658*/ "002F 0020 0029",
+/*5659*/ "002F 0300 0029",
+/*5660*/ "002F 0300 0020 0029",
+/*5661*/ "002F 000D",
+/*5662*/ "002F 0020 000D",
+/*5663*/ "002F 0300 000D",
+/*5664*/ "002F 0300 0020 000D",
+/*5665*/ "002F 0021",
+/*5666*/ "002F 0020 0021",
+/*5667*/ "002F 0300 0021",
+/*5668*/ "002F 0300 0020 0021",
+/*5669*/ "002F 00A0",
+/*5670*/ "002F 0020/00A0",
+/*5671*/ "002F 0300 00A0",
+/*5672*/ "002F 0300 0020/00A0",
+/*5673*/ "002F/AC00",
+/*5674*/ "002F 0020/AC00",
+/*5675*/ "002F 0300/AC00",
+/*5676*/ "002F 0300 0020/AC00",
+/*5677*/ "002F/AC01",
+/*5678*/ "002F 0020/AC01",
+/*5679*/ "002F 0300/AC01",
+/*5680*/ "002F 0300 0020/AC01",
+/*5681*/ "002F 05D0",
+/*5682*/ "002F 0020/05D0",
+/*5683*/ "002F 0300 05D0",
+/*5684*/ "002F 0300 0020/05D0",
+/*5685*/ "002F 002D",
+/*5686*/ "002F 0020/002D",
+/*5687*/ "002F 0300 002D",
+/*5688*/ "002F 0300 0020/002D",
+/*5689*/ "002F/231A",
+/*5690*/ "002F 0020/231A",
+/*5691*/ "002F 0300/231A",
+/*5692*/ "002F 0300 0020/231A",
+/*5693*/ "002F/2024",
+/*5694*/ "002F 0020/2024",
+/*5695*/ "002F 0300/2024",
+/*5696*/ "002F 0300 0020/2024",
+/*5697*/ "002F 002C",
+/*5698*/ "002F 0020 002C",
+/*5699*/ "002F 0300 002C",
+/*5700*/ "002F 0300 0020 002C",
+/*5701*/ "002F/1100",
+/*5702*/ "002F 0020/1100",
+/*5703*/ "002F 0300/1100",
+/*5704*/ "002F 0300 0020/1100",
+/*5705*/ "002F/11A8",
+/*5706*/ "002F 0020/11A8",
+/*5707*/ "002F 0300/11A8",
+/*5708*/ "002F 0300 0020/11A8",
+/*5709*/ "002F/1160",
+/*5710*/ "002F 0020/1160",
+/*5711*/ "002F 0300/1160",
+/*5712*/ "002F 0300 0020/1160",
+/*5713*/ "002F 000A",
+/*5714*/ "002F 0020 000A",
+/*5715*/ "002F 0300 000A",
+/*5716*/ "002F 0300 0020 000A",
+/*5717*/ "002F 0085",
+/*5718*/ "002F 0020 0085",
+/*5719*/ "002F 0300 0085",
+/*5720*/ "002F 0300 0020 0085",
+/*5721*/ "002F 17D6",
+/*5722*/ "002F 0020/17D6",
+/*5723*/ "002F 0300 17D6",
+/*5724*/ "002F 0300 0020/17D6",
+/*5725*/ "002F 0030",
+/*5726*/ "002F 0020/0030",
+/*5727*/ "002F 0300 0030",
+/*5728*/ "002F 0300 0020/0030",
+/*5729*/ "002F/0028",
+/*5730*/ "002F 0020/0028",
+/*5731*/ "002F 0300/0028",
+/*5732*/ "002F 0300 0020/0028",
+/*5733*/ "002F/0025",
+/*5734*/ "002F 0020/0025",
+/*5735*/ "002F 0300/0025",
+/*5736*/ "002F 0300 0020/0025",
+/*5737*/ "002F/0024",
+/*5738*/ "002F 0020/0024",
+/*5739*/ "002F 0300/0024",
+/*5740*/ "002F 0300 0020/0024",
+/*5741*/ "002F 0022",
+/*5742*/ "002F 0020/0022",
+/*5743*/ "002F 0300 0022",
+/*5744*/ "002F 0300 0020/0022",
+/*5745*/ "002F/1F1E6",
+/*5746*/ "002F 0020/1F1E6",
+/*5747*/ "002F 0300/1F1E6",
+/*5748*/ "002F 0300 0020/1F1E6",
+/*5749*/ "002F/0E01",
+/*5750*/ "002F 0020/0E01",
+/*5751*/ "002F 0300/0E01",
+/*5752*/ "002F 0300 0020/0E01",
+/*5753*/ "002F 0E31",
+/*5754*/ "002F 0020/0E31",
+/*5755*/ "002F 0300 0E31",
+/*5756*/ "002F 0300 0020/0E31",
+/*5757*/ "002F 0020",
+/*5758*/ "002F 0020 0020",
+/*5759*/ "002F 0300 0020",
+/*5760*/ "002F 0300 0020 0020",
+/*5761*/ "002F 002F",
+/*5762*/ "002F 0020 002F",
+/*5763*/ "002F 0300 002F",
+/*5764*/ "002F 0300 0020 002F",
+/*5765*/ "002F 2060",
+/*5766*/ "002F 0020 2060",
+/*5767*/ "002F 0300 2060",
+/*5768*/ "002F 0300 0020 2060",
+/*5769*/ "002F 200B",
+/*5770*/ "002F 0020 200B",
+/*5771*/ "002F 0300 200B",
+/*5772*/ "002F 0300 0020 200B",
+/*5773*/ "2060 00A7",
+/*5774*/ "2060 0020/00A7",
+/*5775*/ "2060 0300 00A7",
+/*5776*/ "2060 0300 0020/00A7",
+/*5777*/ "2060 0023",
+/*5778*/ "2060 0020/0023",
+/*5779*/ "2060 0300 0023",
+/*5780*/ "2060 0300 0020/0023",
+/*5781*/ "2060 2014",
+/*5782*/ "2060 0020/2014",
+/*5783*/ "2060 0300 2014",
+/*5784*/ "2060 0300 0020/2014",
+/*5785*/ "2060 007C",
+/*5786*/ "2060 0020/007C",
+/*5787*/ "2060 0300 007C",
+/*5788*/ "2060 0300 0020/007C",
+/*5789*/ "2060 00B4",
+/*5790*/ "2060 0020/00B4",
+/*5791*/ "2060 0300 00B4",
+/*5792*/ "2060 0300 0020/00B4",
+/*5793*/ "2060 2028",
+/*5794*/ "2060 0020 2028",
+/*5795*/ "2060 0300 2028",
+/*5796*/ "2060 0300 0020 2028",
+/*5797*/ "2060 FFFC",
+/*5798*/ "2060 0020/FFFC",
+/*5799*/ "2060 0300 FFFC",
+/*5800*/ "2060 0300 0020/FFFC",
+/*5801*/ "2060 3041",
+/*5802*/ "2060 0020/3041",
+/*5803*/ "2060 0300 3041",
+/*5804*/ "2060 0300 0020/3041",
+/*5805*/ "2060 007D",
+/*5806*/ "2060 0020 007D",
+/*5807*/ "2060 0300 007D",
+/*5808*/ "2060 0300 0020 007D",
+/*5809*/ "2060 0300",
+/*5810*/ "2060 0020/0300",
+/*5811*/ "2060 0300 0300",
+/*5812*/ "2060 0300 0020/0300",
+/*5813*/ "2060 0029",
+/*5814*/ "2060 0020 0029",
+/*5815*/ "2060 0300 0029",
+/*5816*/ "2060 0300 0020 0029",
+/*5817*/ "2060 000D",
+/*5818*/ "2060 0020 000D",
+/*5819*/ "2060 0300 000D",
+/*5820*/ "2060 0300 0020 000D",
+/*5821*/ "2060 0021",
+/*5822*/ "2060 0020 0021",
+/*5823*/ "2060 0300 0021",
+/*5824*/ "2060 0300 0020 0021",
+/*5825*/ "2060 00A0",
+/*5826*/ "2060 0020/00A0",
+/*5827*/ "2060 0300 00A0",
+/*5828*/ "2060 0300 0020/00A0",
+/*5829*/ "2060 AC00",
+/*5830*/ "2060 0020/AC00",
+/*5831*/ "2060 0300 AC00",
+/*5832*/ "2060 0300 0020/AC00",
+/*5833*/ "2060 AC01",
+/*5834*/ "2060 0020/AC01",
+/*5835*/ "2060 0300 AC01",
+/*5836*/ "2060 0300 0020/AC01",
+/*5837*/ "2060 05D0",
+/*5838*/ "2060 0020/05D0",
+/*5839*/ "2060 0300 05D0",
+/*5840*/ "2060 0300 0020/05D0",
+/*5841*/ "2060 002D",
+/*5842*/ "2060 0020/002D",
+/*5843*/ "2060 0300 002D",
+/*5844*/ "2060 0300 0020/002D",
+/*5845*/ "2060 231A",
+/*5846*/ "2060 0020/231A",
+/*5847*/ "2060 0300 231A",
+/*5848*/ "2060 0300 0020/231A",
+/*5849*/ "2060 2024",
+/*5850*/ "2060 0020/2024",
+/*5851*/ "2060 0300 2024",
+/*5852*/ "2060 0300 0020/2024",
+/*5853*/ "2060 002C",
+/*5854*/ "2060 0020 002C",
+/*5855*/ "2060 0300 002C",
+/*5856*/ "2060 0300 0020 002C",
+/*5857*/ "2060 1100",
+/*5858*/ "2060 0020/1100",
+/*5859*/ "2060 0300 1100",
+/*5860*/ "2060 0300 0020/1100",
+/*5861*/ "2060 11A8",
+/*5862*/ "2060 0020/11A8",
+/*5863*/ "2060 0300 11A8",
+/*5864*/ "2060 0300 0020/11A8",
+/*5865*/ "2060 1160",
+/*5866*/ "2060 0020/1160",
+/*5867*/ "2060 0300 1160",
+/*5868*/ "2060 0300 0020/1160",
+/*5869*/ "2060 000A",
+/*5870*/ "2060 0020 000A",
+/*5871*/ "2060 0300 000A",
+/*5872*/ "2060 0300 0020 000A",
+/*5873*/ "2060 0085",
+/*5874*/ "2060 0020 0085",
+/*5875*/ "2060 0300 0085",
+/*5876*/ "2060 0300 0020 0085",
+/*5877*/ "2060 17D6",
+/*5878*/ "2060 0020/17D6",
+/*5879*/ "2060 0300 17D6",
+/*5880*/ "2060 0300 0020/17D6",
+/*5881*/ "2060 0030",
+/*5882*/ "2060 0020/0030",
+/*5883*/ "2060 0300 0030",
+/*5884*/ "2060 0300 0020/0030",
+/*5885*/ "2060 0028",
+/*5886*/ "2060 0020/0028",
+/*5887*/ "2060 0300 0028",
+/*5888*/ "2060 0300 0020/0028",
+/*5889*/ "2060 0025",
+/*5890*/ "2060 0020/0025",
+/*5891*/ "2060 0300 0025",
+/*5892*/ "2060 0300 0020/0025",
+/*5893*/ "2060 0024",
+/*5894*/ "2060 0020/0024",
+/*5895*/ "2060 0300 0024",
+/*5896*/ "2060 0300 0020/0024",
+/*5897*/ "2060 0022",
+/*5898*/ "2060 0020/0022",
+/*5899*/ "2060 0300 0022",
+/*5900*/ "2060 0300 0020/0022",
+/*5901*/ "2060 1F1E6",
+/*5902*/ "2060 0020/1F1E6",
+/*5903*/ "2060 0300 1F1E6",
+/*5904*/ "2060 0300 0020/1F1E6",
+/*5905*/ "2060 0E01",
+/*5906*/ "2060 0020/0E01",
+/*5907*/ "2060 0300 0E01",
+/*5908*/ "2060 0300 0020/0E01",
+/*5909*/ "2060 0E31",
+/*5910*/ "2060 0020/0E31",
+/*5911*/ "2060 0300 0E31",
+/*5912*/ "2060 0300 0020/0E31",
+/*5913*/ "2060 0020",
+/*5914*/ "2060 0020 0020",
+/*5915*/ "2060 0300 0020",
+/*5916*/ "2060 0300 0020 0020",
+/*5917*/ "2060 002F",
+/*5918*/ "2060 0020 002F",
+/*5919*/ "2060 0300 002F",
+/*5920*/ "2060 0300 0020 002F",
+/*5921*/ "2060 2060",
+/*5922*/ "2060 0020 2060",
+/*5923*/ "2060 0300 2060",
+/*5924*/ "2060 0300 0020 2060",
+/*5925*/ "2060 200B",
+/*5926*/ "2060 0020 200B",
+/*5927*/ "2060 0300 200B",
+/*5928*/ "2060 0300 0020 200B",
+/*5929*/ "200B/00A7",
+/*5930*/ "200B 0020/00A7",
+/*5931*/ "200B/0300 00A7",
+/*5932*/ "200B/0300 0020/00A7",
+/*5933*/ "200B/0023",
+/*5934*/ "200B 0020/0023",
+/*5935*/ "200B/0300 0023",
+/*5936*/ "200B/0300 0020/0023",
+/*5937*/ "200B/2014",
+/*5938*/ "200B 0020/2014",
+/*5939*/ "200B/0300/2014",
+/*5940*/ "200B/0300 0020/2014",
+/*5941*/ "200B/007C",
+/*5942*/ "200B 0020/007C",
+/*5943*/ "200B/0300 007C",
+/*5944*/ "200B/0300 0020/007C",
+/*5945*/ "200B/00B4",
+/*5946*/ "200B 0020/00B4",
+/*5947*/ "200B/0300/00B4",
+/*5948*/ "200B/0300 0020/00B4",
+/*5949*/ "200B 2028",
+/*5950*/ "200B 0020 2028",
+/*5951*/ "200B/0300 2028",
+/*5952*/ "200B/0300 0020 2028",
+/*5953*/ "200B/FFFC",
+/*5954*/ "200B 0020/FFFC",
+/*5955*/ "200B/0300/FFFC",
+/*5956*/ "200B/0300 0020/FFFC",
+/*5957*/ "200B/3041",
+/*5958*/ "200B 0020/3041",
+/*5959*/ "200B/0300 3041",
+/*5960*/ "200B/0300 0020/3041",
+/*5961*/ "200B/007D",
+/*5962*/ "200B 0020/007D",
+/*5963*/ "200B/0300 007D",
+/*5964*/ "200B/0300 0020 007D",
+/*5965*/ "200B/0300",
+/*5966*/ "200B 0020/0300",
+/*5967*/ "200B/0300 0300",
+/*5968*/ "200B/0300 0020/0300",
+/*5969*/ "200B/0029",
+/*5970*/ "200B 0020/0029",
+/*5971*/ "200B/0300 0029",
+/*5972*/ "200B/0300 0020 0029",
+/*5973*/ "200B 000D",
+/*5974*/ "200B 0020 000D",
+/*5975*/ "200B/0300 000D",
+/*5976*/ "200B/0300 0020 000D",
+/*5977*/ "200B/0021",
+/*5978*/ "200B 0020/0021",
+/*5979*/ "200B/0300 0021",
+/*5980*/ "200B/0300 0020 0021",
+/*5981*/ "200B/00A0",
+/*5982*/ "200B 0020/00A0",
+/*5983*/ "200B/0300 00A0",
+/*5984*/ "200B/0300 0020/00A0",
+/*5985*/ "200B/AC00",
+/*5986*/ "200B 0020/AC00",
+/*5987*/ "200B/0300/AC00",
+/*5988*/ "200B/0300 0020/AC00",
+/*5989*/ "200B/AC01",
+/*5990*/ "200B 0020/AC01",
+/*5991*/ "200B/0300/AC01",
+/*5992*/ "200B/0300 0020/AC01",
+/*5993*/ "200B/05D0",
+/*5994*/ "200B 0020/05D0",
+/*5995*/ "200B/0300 05D0",
+/*5996*/ "200B/0300 0020/05D0",
+/*5997*/ "200B/002D",
+/*5998*/ "200B 0020/002D",
+/*5999*/ "200B/0300 002D",
+/*6000*/ "200B/0300 0020/002D",
+/*6001*/ "200B/231A",
+/*6002*/ "200B 0020/231A",
+/*6003*/ "200B/0300/231A",
+/*6004*/ "200B/0300 0020/231A",
+/*6005*/ "200B/2024",
+/*6006*/ "200B 0020/2024",
+/*6007*/ "200B/0300 2024",
+/*6008*/ "200B/0300 0020/2024",
+/*6009*/ "200B/002C",
+/*6010*/ "200B 0020/002C",
+/*6011*/ "200B/0300 002C",
+/*6012*/ "200B/0300 0020 002C",
+/*6013*/ "200B/1100",
+/*6014*/ "200B 0020/1100",
+/*6015*/ "200B/0300/1100",
+/*6016*/ "200B/0300 0020/1100",
+/*6017*/ "200B/11A8",
+/*6018*/ "200B 0020/11A8",
+/*6019*/ "200B/0300/11A8",
+/*6020*/ "200B/0300 0020/11A8",
+/*6021*/ "200B/1160",
+/*6022*/ "200B 0020/1160",
+/*6023*/ "200B/0300/1160",
+/*6024*/ "200B/0300 0020/1160",
+/*6025*/ "200B 000A",
+/*6026*/ "200B 0020 000A",
+/*6027*/ "200B/0300 000A",
+/*6028*/ "200B/0300 0020 000A",
+/*6029*/ "200B 0085",
+/*6030*/ "200B 0020 0085",
+/*6031*/ "200B/0300 0085",
+/*6032*/ "200B/0300 0020 0085",
+/*6033*/ "200B/17D6",
+/*6034*/ "200B 0020/17D6",
+/*6035*/ "200B/0300 17D6",
+/*6036*/ "200B/0300 0020/17D6",
+/*6037*/ "200B/0030",
+/*6038*/ "200B 0020/0030",
+/*6039*/ "200B/0300 0030",
+/*6040*/ "200B/0300 0020/0030",
+/*6041*/ "200B/0028",
+/*6042*/ "200B 0020/0028",
+/*6043*/ "200B/0300 0028",
+/*6044*/ "200B/0300 0020/0028",
+/*6045*/ "200B/0025",
+/*6046*/ "200B 0020/0025",
+/*6047*/ "200B/0300/0025",
+/*6048*/ "200B/0300 0020/0025",
+/*6049*/ "200B/0024",
+/*6050*/ "200B 0020/0024",
+/*6051*/ "200B/0300/0024",
+/*6052*/ "200B/0300 0020/0024",
+/*6053*/ "200B/0022",
+/*6054*/ "200B 0020/0022",
+/*6055*/ "200B/0300 0022",
+/*6056*/ "200B/0300 0020/0022",
+/*6057*/ "200B/1F1E6",
+/*6058*/ "200B 0020/1F1E6",
+/*6059*/ "200B/0300/1F1E6",
+/*6060*/ "200B/0300 0020/1F1E6",
+/*6061*/ "200B/0E01",
+/*6062*/ "200B 0020/0E01",
+/*6063*/ "200B/0300 0E01",
+/*6064*/ "200B/0300 0020/0E01",
+/*6065*/ "200B/0E31",
+/*6066*/ "200B 0020/0E31",
+/*6067*/ "200B/0300 0E31",
+/*6068*/ "200B/0300 0020/0E31",
+/*6069*/ "200B 0020",
+/*6070*/ "200B 0020 0020",
+/*6071*/ "200B/0300 0020",
+/*6072*/ "200B/0300 0020 0020",
+/*6073*/ "200B/002F",
+/*6074*/ "200B 0020/002F",
+/*6075*/ "200B/0300 002F",
+/*6076*/ "200B/0300 0020 002F",
+/*6077*/ "200B/2060",
+/*6078*/ "200B 0020/2060",
+/*6079*/ "200B/0300 2060",
+/*6080*/ "200B/0300 0020 2060",
+/*6081*/ "200B 200B",
+/*6082*/ "200B 0020 200B",
+/*6083*/ "200B/0300 200B",
+/*6084*/ "200B/0300 0020 200B",
+/*6085*/ "0028 0020 0020 00A7",
+/*6086*/ "0028 0020 0020 0023",
+/*6087*/ "0028 0020 0020 2014",
+/*6088*/ "0028 0020 0020 007C",
+/*6089*/ "0028 0020 0020 00B4",
+/*6090*/ "0028 0020 0020 2028",
+/*6091*/ "0028 0020 0020 FFFC",
+/*6092*/ "0028 0020 0020 3041",
+/*6093*/ "0028 0020 0020 007D",
+/*6094*/ "0028 0020 0020 0300",
+/*6095*/ "0028 0020 0020 0029",
+/*6096*/ "0028 0020 0020 000D",
+/*6097*/ "0028 0020 0020 0021",
+/*6098*/ "0028 0020 0020 00A0",
+/*6099*/ "0028 0020 0020 AC00",
+/*6100*/ "0028 0020 0020 AC01",
+/*6101*/ "0028 0020 0020 05D0",
+/*6102*/ "0028 0020 0020 002D",
+/*6103*/ "0028 0020 0020 231A",
+/*6104*/ "0028 0020 0020 2024",
+/*6105*/ "0028 0020 0020 002C",
+/*6106*/ "0028 0020 0020 1100",
+/*6107*/ "0028 0020 0020 11A8",
+/*6108*/ "0028 0020 0020 1160",
+/*6109*/ "0028 0020 0020 000A",
+/*6110*/ "0028 0020 0020 0085",
+/*6111*/ "0028 0020 0020 17D6",
+/*6112*/ "0028 0020 0020 0030",
+/*6113*/ "0028 0020 0020 0028",
+/*6114*/ "0028 0020 0020 0025",
+/*6115*/ "0028 0020 0020 0024",
+/*6116*/ "0028 0020 0020 0022",
+/*6117*/ "0028 0020 0020 1F1E6",
+/*6118*/ "0028 0020 0020 0E01",
+/*6119*/ "0028 0020 0020 0E31",
+/*6120*/ "0028 0020 0020 0020",
+/*6121*/ "0028 0020 0020 002F",
+/*6122*/ "0028 0020 0020 2060",
+/*6123*/ "0028 0020 0020 200B",
+/*6124*/ "0022 0020 0020/00A7",
+/*6125*/ "0022 0020 0020/0023",
+/*6126*/ "0022 0020 0020/2014",
+/*6127*/ "0022 0020 0020/007C",
+/*6128*/ "0022 0020 0020/00B4",
+/*6129*/ "0022 0020 0020 2028",
+/*6130*/ "0022 0020 0020/FFFC",
+/*6131*/ "0022 0020 0020/3041",
+/*6132*/ "0022 0020 0020 007D",
+/*6133*/ "0022 0020 0020/0300",
+/*6134*/ "0022 0020 0020 0029",
+/*6135*/ "0022 0020 0020 000D",
+/*6136*/ "0022 0020 0020 0021",
+/*6137*/ "0022 0020 0020/00A0",
+/*6138*/ "0022 0020 0020/AC00",
+/*6139*/ "0022 0020 0020/AC01",
+/*6140*/ "0022 0020 0020/05D0",
+/*6141*/ "0022 0020 0020/002D",
+/*6142*/ "0022 0020 0020/231A",
+/*6143*/ "0022 0020 0020/2024",
+/*6144*/ "0022 0020 0020 002C",
+/*6145*/ "0022 0020 0020/1100",
+/*6146*/ "0022 0020 0020/11A8",
+/*6147*/ "0022 0020 0020/1160",
+/*6148*/ "0022 0020 0020 000A",
+/*6149*/ "0022 0020 0020 0085",
+/*6150*/ "0022 0020 0020/17D6",
+/*6151*/ "0022 0020 0020/0030",
+/*6152*/ "0022 0020 0020 0028",
+/*6153*/ "0022 0020 0020/0025",
+/*6154*/ "0022 0020 0020/0024",
+/*6155*/ "0022 0020 0020/0022",
+/*6156*/ "0022 0020 0020/1F1E6",
+/*6157*/ "0022 0020 0020/0E01",
+/*6158*/ "0022 0020 0020/0E31",
+/*6159*/ "0022 0020 0020 0020",
+/*6160*/ "0022 0020 0020 002F",
+/*6161*/ "0022 0020 0020 2060",
+/*6162*/ "0022 0020 0020 200B",
+/*6163*/ "007D 0020 0020/00A7",
+/*6164*/ "007D 0020 0020/0023",
+/*6165*/ "007D 0020 0020/2014",
+/*6166*/ "007D 0020 0020/007C",
+/*6167*/ "007D 0020 0020/00B4",
+/*6168*/ "007D 0020 0020 2028",
+/*6169*/ "007D 0020 0020/FFFC",
+/*6170*/ "007D 0020 0020 3041",
+/*6171*/ "007D 0020 0020 007D",
+/*6172*/ "007D 0020 0020/0300",
+/*6173*/ "007D 0020 0020 0029",
+/*6174*/ "007D 0020 0020 000D",
+/*6175*/ "007D 0020 0020 0021",
+/*6176*/ "007D 0020 0020/00A0",
+/*6177*/ "007D 0020 0020/AC00",
+/*6178*/ "007D 0020 0020/AC01",
+/*6179*/ "007D 0020 0020/05D0",
+/*6180*/ "007D 0020 0020/002D",
+/*6181*/ "007D 0020 0020/231A",
+/*6182*/ "007D 0020 0020/2024",
+/*6183*/ "007D 0020 0020 002C",
+/*6184*/ "007D 0020 0020/1100",
+/*6185*/ "007D 0020 0020/11A8",
+/*6186*/ "007D 0020 0020/1160",
+/*6187*/ "007D 0020 0020 000A",
+/*6188*/ "007D 0020 0020 0085",
+/*6189*/ "007D 0020 0020 17D6",
+/*6190*/ "007D 0020 0020/0030",
+/*6191*/ "007D 0020 0020/0028",
+/*6192*/ "007D 0020 0020/0025",
+/*6193*/ "007D 0020 0020/0024",
+/*6194*/ "007D 0020 0020/0022",
+/*6195*/ "007D 0020 0020/1F1E6",
+/*6196*/ "007D 0020 0020/0E01",
+/*6197*/ "007D 0020 0020/0E31",
+/*6198*/ "007D 0020 0020 0020",
+/*6199*/ "007D 0020 0020 002F",
+/*6200*/ "007D 0020 0020 2060",
+/*6201*/ "007D 0020 0020 200B",
+/*6202*/ "0029 0020 0020/00A7",
+/*6203*/ "0029 0020 0020/0023",
+/*6204*/ "0029 0020 0020/2014",
+/*6205*/ "0029 0020 0020/007C",
+/*6206*/ "0029 0020 0020/00B4",
+/*6207*/ "0029 0020 0020 2028",
+/*6208*/ "0029 0020 0020/FFFC",
+/*6209*/ "0029 0020 0020 3041",
+/*6210*/ "0029 0020 0020 007D",
+/*6211*/ "0029 0020 0020/0300",
+/*6212*/ "0029 0020 0020 0029",
+/*6213*/ "0029 0020 0020 000D",
+/*6214*/ "0029 0020 0020 0021",
+/*6215*/ "0029 0020 0020/00A0",
+/*6216*/ "0029 0020 0020/AC00",
+/*6217*/ "0029 0020 0020/AC01",
+/*6218*/ "0029 0020 0020/05D0",
+/*6219*/ "0029 0020 0020/002D",
+/*6220*/ "0029 0020 0020/231A",
+/*6221*/ "0029 0020 0020/2024",
+/*6222*/ "0029 0020 0020 002C",
+/*6223*/ "0029 0020 0020/1100",
+/*6224*/ "0029 0020 0020/11A8",
+/*6225*/ "0029 0020 0020/1160",
+/*6226*/ "0029 0020 0020 000A",
+/*6227*/ "0029 0020 0020 0085",
+/*6228*/ "0029 0020 0020 17D6",
+/*6229*/ "0029 0020 0020/0030",
+/*6230*/ "0029 0020 0020/0028",
+/*6231*/ "0029 0020 0020/0025",
+/*6232*/ "0029 0020 0020/0024",
+/*6233*/ "0029 0020 0020/0022",
+/*6234*/ "0029 0020 0020/1F1E6",
+/*6235*/ "0029 0020 0020/0E01",
+/*6236*/ "0029 0020 0020/0E31",
+/*6237*/ "0029 0020 0020 0020",
+/*6238*/ "0029 0020 0020 002F",
+/*6239*/ "0029 0020 0020 2060",
+/*6240*/ "0029 0020 0020 200B",
+/*6241*/ "2014 0020 0020/00A7",
+/*6242*/ "2014 0020 0020/0023",
+/*6243*/ "2014 0020 0020 2014",
+/*6244*/ "2014 0020 0020/007C",
+/*6245*/ "2014 0020 0020/00B4",
+/*6246*/ "2014 0020 0020 2028",
+/*6247*/ "2014 0020 0020/FFFC",
+/*6248*/ "2014 0020 0020/3041",
+/*6249*/ "2014 0020 0020 007D",
+/*6250*/ "2014 0020 0020/0300",
+/*6251*/ "2014 0020 0020 0029",
+/*6252*/ "2014 0020 0020 000D",
+/*6253*/ "2014 0020 0020 0021",
+/*6254*/ "2014 0020 0020/00A0",
+/*6255*/ "2014 0020 0020/AC00",
+/*6256*/ "2014 0020 0020/AC01",
+/*6257*/ "2014 0020 0020/05D0",
+/*6258*/ "2014 0020 0020/002D",
+/*6259*/ "2014 0020 0020/231A",
+/*6260*/ "2014 0020 0020/2024",
+/*6261*/ "2014 0020 0020 002C",
+/*6262*/ "2014 0020 0020/1100",
+/*6263*/ "2014 0020 0020/11A8",
+/*6264*/ "2014 0020 0020/1160",
+/*6265*/ "2014 0020 0020 000A",
+/*6266*/ "2014 0020 0020 0085",
+/*6267*/ "2014 0020 0020/17D6",
+/*6268*/ "2014 0020 0020/0030",
+/*6269*/ "2014 0020 0020/0028",
+/*6270*/ "2014 0020 0020/0025",
+/*6271*/ "2014 0020 0020/0024",
+/*6272*/ "2014 0020 0020/0022",
+/*6273*/ "2014 0020 0020/1F1E6",
+/*6274*/ "2014 0020 0020/0E01",
+/*6275*/ "2014 0020 0020/0E31",
+/*6276*/ "2014 0020 0020 0020",
+/*6277*/ "2014 0020 0020 002F",
+/*6278*/ "2014 0020 0020 2060",
+/*6279*/ "2014 0020 0020 200B",
+/*6280*/ "200B 0020 0020/00A7",
+/*6281*/ "200B 0020 0020/0023",
+/*6282*/ "200B 0020 0020/2014",
+/*6283*/ "200B 0020 0020/007C",
+/*6284*/ "200B 0020 0020/00B4",
+/*6285*/ "200B 0020 0020 2028",
+/*6286*/ "200B 0020 0020/FFFC",
+/*6287*/ "200B 0020 0020/3041",
+/*6288*/ "200B 0020 0020/007D",
+/*6289*/ "200B 0020 0020/0300",
+/*6290*/ "200B 0020 0020/0029",
+/*6291*/ "200B 0020 0020 000D",
+/*6292*/ "200B 0020 0020/0021",
+/*6293*/ "200B 0020 0020/00A0",
+/*6294*/ "200B 0020 0020/AC00",
+/*6295*/ "200B 0020 0020/AC01",
+/*6296*/ "200B 0020 0020/05D0",
+/*6297*/ "200B 0020 0020/002D",
+/*6298*/ "200B 0020 0020/231A",
+/*6299*/ "200B 0020 0020/2024",
+/*6300*/ "200B 0020 0020/002C",
+/*6301*/ "200B 0020 0020/1100",
+/*6302*/ "200B 0020 0020/11A8",
+/*6303*/ "200B 0020 0020/1160",
+/*6304*/ "200B 0020 0020 000A",
+/*6305*/ "200B 0020 0020 0085",
+/*6306*/ "200B 0020 0020/17D6",
+/*6307*/ "200B 0020 0020/0030",
+/*6308*/ "200B 0020 0020/0028",
+/*6309*/ "200B 0020 0020/0025",
+/*6310*/ "200B 0020 0020/0024",
+/*6311*/ "200B 0020 0020/0022",
+/*6312*/ "200B 0020 0020/1F1E6",
+/*6313*/ "200B 0020 0020/0E01",
+/*6314*/ "200B 0020 0020/0E31",
+/*6315*/ "200B 0020 0020 0020",
+/*6316*/ "200B 0020 0020/002F",
+/*6317*/ "200B 0020 0020/2060",
+/*6318*/ "200B 0020 0020 200B",
+/*6319*/ "05D0 002D 00A7",
+/*6320*/ "05D0 0300 002D 00A7",
+/*6321*/ "05D0 002D 0023",
+/*6322*/ "05D0 0300 002D 0023",
+/*6323*/ "05D0 002D 2014",
+/*6324*/ "05D0 0300 002D 2014",
+/*6325*/ "05D0 002D 007C",
+/*6326*/ "05D0 0300 002D 007C",
+/*6327*/ "05D0 002D 00B4",
+/*6328*/ "05D0 0300 002D 00B4",
+/*6329*/ "05D0 002D 2028",
+/*6330*/ "05D0 0300 002D 2028",
+/*6331*/ "05D0 002D/FFFC",
+/*6332*/ "05D0 0300 002D/FFFC",
+/*6333*/ "05D0 002D 3041",
+/*6334*/ "05D0 0300 002D 3041",
+/*6335*/ "05D0 002D 007D",
+/*6336*/ "05D0 0300 002D 007D",
+/*6337*/ "05D0 002D 0300",
+/*6338*/ "05D0 0300 002D 0300",
+/*6339*/ "05D0 002D 0029",
+/*6340*/ "05D0 0300 002D 0029",
+/*6341*/ "05D0 002D 000D",
+/*6342*/ "05D0 0300 002D 000D",
+/*6343*/ "05D0 002D 0021",
+/*6344*/ "05D0 0300 002D 0021",
+/*6345*/ "05D0 002D 00A0",
+/*6346*/ "05D0 0300 002D 00A0",
+/*6347*/ "05D0 002D AC00",
+/*6348*/ "05D0 0300 002D AC00",
+/*6349*/ "05D0 002D AC01",
+/*6350*/ "05D0 0300 002D AC01",
+/*6351*/ "05D0 002D 05D0",
+/*6352*/ "05D0 0300 002D 05D0",
+/*6353*/ "05D0 002D 002D",
+/*6354*/ "05D0 0300 002D 002D",
+/*6355*/ "05D0 002D 231A",
+/*6356*/ "05D0 0300 002D 231A",
+/*6357*/ "05D0 002D 2024",
+/*6358*/ "05D0 0300 002D 2024",
+/*6359*/ "05D0 002D 002C",
+/*6360*/ "05D0 0300 002D 002C",
+/*6361*/ "05D0 002D 1100",
+/*6362*/ "05D0 0300 002D 1100",
+/*6363*/ "05D0 002D 11A8",
+/*6364*/ "05D0 0300 002D 11A8",
+/*6365*/ "05D0 002D 1160",
+/*6366*/ "05D0 0300 002D 1160",
+/*6367*/ "05D0 002D 000A",
+/*6368*/ "05D0 0300 002D 000A",
+/*6369*/ "05D0 002D 0085",
+/*6370*/ "05D0 0300 002D 0085",
+/*6371*/ "05D0 002D 17D6",
+/*6372*/ "05D0 0300 002D 17D6",
+/*6373*/ "05D0 002D 0030",
+/*6374*/ "05D0 0300 002D 0030",
+/*6375*/ "05D0 002D 0028",
+/*6376*/ "05D0 0300 002D 0028",
+/*6377*/ "05D0 002D 0025",
+/*6378*/ "05D0 0300 002D 0025",
+/*6379*/ "05D0 002D 0024",
+/*6380*/ "05D0 0300 002D 0024",
+/*6381*/ "05D0 002D 0022",
+/*6382*/ "05D0 0300 002D 0022",
+/*6383*/ "05D0 002D 1F1E6",
+/*6384*/ "05D0 0300 002D 1F1E6",
+/*6385*/ "05D0 002D 0E01",
+/*6386*/ "05D0 0300 002D 0E01",
+/*6387*/ "05D0 002D 0E31",
+/*6388*/ "05D0 0300 002D 0E31",
+/*6389*/ "05D0 002D 0020",
+/*6390*/ "05D0 0300 002D 0020",
+/*6391*/ "05D0 002D 002F",
+/*6392*/ "05D0 0300 002D 002F",
+/*6393*/ "05D0 002D 2060",
+/*6394*/ "05D0 0300 002D 2060",
+/*6395*/ "05D0 002D 200B",
+/*6396*/ "05D0 0300 002D 200B",
+/*6397*/ "05D0 007C 00A7",
+/*6398*/ "05D0 0300 007C 00A7",
+/*6399*/ "05D0 007C 0023",
+/*6400*/ "05D0 0300 007C 0023",
+/*6401*/ "05D0 007C 2014",
+/*6402*/ "05D0 0300 007C 2014",
+/*6403*/ "05D0 007C 007C",
+/*6404*/ "05D0 0300 007C 007C",
+/*6405*/ "05D0 007C 00B4",
+/*6406*/ "05D0 0300 007C 00B4",
+/*6407*/ "05D0 007C 2028",
+/*6408*/ "05D0 0300 007C 2028",
+/*6409*/ "05D0 007C/FFFC",
+/*6410*/ "05D0 0300 007C/FFFC",
+/*6411*/ "05D0 007C 3041",
+/*6412*/ "05D0 0300 007C 3041",
+/*6413*/ "05D0 007C 007D",
+/*6414*/ "05D0 0300 007C 007D",
+/*6415*/ "05D0 007C 0300",
+/*6416*/ "05D0 0300 007C 0300",
+/*6417*/ "05D0 007C 0029",
+/*6418*/ "05D0 0300 007C 0029",
+/*6419*/ "05D0 007C 000D",
+/*6420*/ "05D0 0300 007C 000D",
+/*6421*/ "05D0 007C 0021",
+/*6422*/ "05D0 0300 007C 0021",
+/*6423*/ "05D0 007C 00A0",
+/*6424*/ "05D0 0300 007C 00A0",
+/*6425*/ "05D0 007C AC00",
+/*6426*/ "05D0 0300 007C AC00",
+/*6427*/ "05D0 007C AC01",
+/*6428*/ "05D0 0300 007C AC01",
+/*6429*/ "05D0 007C 05D0",
+/*6430*/ "05D0 0300 007C 05D0",
+/*6431*/ "05D0 007C 002D",
+/*6432*/ "05D0 0300 007C 002D",
+/*6433*/ "05D0 007C 231A",
+/*6434*/ "05D0 0300 007C 231A",
+/*6435*/ "05D0 007C 2024",
+/*6436*/ "05D0 0300 007C 2024",
+/*6437*/ "05D0 007C 002C",
+/*6438*/ "05D0 0300 007C 002C",
+/*6439*/ "05D0 007C 1100",
+/*6440*/ "05D0 0300 007C 1100",
+/*6441*/ "05D0 007C 11A8",
+/*6442*/ "05D0 0300 007C 11A8",
+/*6443*/ "05D0 007C 1160",
+/*6444*/ "05D0 0300 007C 1160",
+/*6445*/ "05D0 007C 000A",
+/*6446*/ "05D0 0300 007C 000A",
+/*6447*/ "05D0 007C 0085",
+/*6448*/ "05D0 0300 007C 0085",
+/*6449*/ "05D0 007C 17D6",
+/*6450*/ "05D0 0300 007C 17D6",
+/*6451*/ "05D0 007C 0030",
+/*6452*/ "05D0 0300 007C 0030",
+/*6453*/ "05D0 007C 0028",
+/*6454*/ "05D0 0300 007C 0028",
+/*6455*/ "05D0 007C 0025",
+/*6456*/ "05D0 0300 007C 0025",
+/*6457*/ "05D0 007C 0024",
+/*6458*/ "05D0 0300 007C 0024",
+/*6459*/ "05D0 007C 0022",
+/*6460*/ "05D0 0300 007C 0022",
+/*6461*/ "05D0 007C 1F1E6",
+/*6462*/ "05D0 0300 007C 1F1E6",
+/*6463*/ "05D0 007C 0E01",
+/*6464*/ "05D0 0300 007C 0E01",
+/*6465*/ "05D0 007C 0E31",
+/*6466*/ "05D0 0300 007C 0E31",
+/*6467*/ "05D0 007C 0020",
+/*6468*/ "05D0 0300 007C 0020",
+/*6469*/ "05D0 007C 002F",
+/*6470*/ "05D0 0300 007C 002F",
+/*6471*/ "05D0 007C 2060",
+/*6472*/ "05D0 0300 007C 2060",
+/*6473*/ "05D0 007C 200B",
+/*6474*/ "05D0 0300 007C 200B",
+/*6475*/ "0023 002D/00A7",
+/*6476*/ "0023 0300 002D/00A7",
+/*6477*/ "0023 002D/0023",
+/*6478*/ "0023 0300 002D/0023",
+/*6479*/ "0023 002D/2014",
+/*6480*/ "0023 0300 002D/2014",
+/*6481*/ "0023 002D 007C",
+/*6482*/ "0023 0300 002D 007C",
+/*6483*/ "0023 002D/00B4",
+/*6484*/ "0023 0300 002D/00B4",
+/*6485*/ "0023 002D 2028",
+/*6486*/ "0023 0300 002D 2028",
+/*6487*/ "0023 002D/FFFC",
+/*6488*/ "0023 0300 002D/FFFC",
+/*6489*/ "0023 002D 3041",
+/*6490*/ "0023 0300 002D 3041",
+/*6491*/ "0023 002D 007D",
+/*6492*/ "0023 0300 002D 007D",
+/*6493*/ "0023 002D 0300",
+/*6494*/ "0023 0300 002D 0300",
+/*6495*/ "0023 002D 0029",
+/*6496*/ "0023 0300 002D 0029",
+/*6497*/ "0023 002D 000D",
+/*6498*/ "0023 0300 002D 000D",
+/*6499*/ "0023 002D 0021",
+/*6500*/ "0023 0300 002D 0021",
+/*6501*/ "0023 002D/00A0",
+/*6502*/ "0023 0300 002D/00A0",
+/*6503*/ "0023 002D/AC00",
+/*6504*/ "0023 0300 002D/AC00",
+/*6505*/ "0023 002D/AC01",
+/*6506*/ "0023 0300 002D/AC01",
+/*6507*/ "0023 002D/05D0",
+/*6508*/ "0023 0300 002D/05D0",
+/*6509*/ "0023 002D 002D",
+/*6510*/ "0023 0300 002D 002D",
+/*6511*/ "0023 002D/231A",
+/*6512*/ "0023 0300 002D/231A",
+/*6513*/ "0023 002D/2024",
+/*6514*/ "0023 0300 002D/2024",
+/*6515*/ "0023 002D 002C",
+/*6516*/ "0023 0300 002D 002C",
+/*6517*/ "0023 002D/1100",
+/*6518*/ "0023 0300 002D/1100",
+/*6519*/ "0023 002D/11A8",
+/*6520*/ "0023 0300 002D/11A8",
+/*6521*/ "0023 002D/1160",
+/*6522*/ "0023 0300 002D/1160",
+/*6523*/ "0023 002D 000A",
+/*6524*/ "0023 0300 002D 000A",
+/*6525*/ "0023 002D 0085",
+/*6526*/ "0023 0300 002D 0085",
+/*6527*/ "0023 002D 17D6",
+/*6528*/ "0023 0300 002D 17D6",
+/*6529*/ "0023 002D 0030",
+/*6530*/ "0023 0300 002D 0030",
+/*6531*/ "0023 002D/0028",
+/*6532*/ "0023 0300 002D/0028",
+/*6533*/ "0023 002D/0025",
+/*6534*/ "0023 0300 002D/0025",
+/*6535*/ "0023 002D/0024",
+/*6536*/ "0023 0300 002D/0024",
+/*6537*/ "0023 002D 0022",
+/*6538*/ "0023 0300 002D 0022",
+/*6539*/ "0023 002D/1F1E6",
+/*6540*/ "0023 0300 002D/1F1E6",
+/*6541*/ "0023 002D/0E01",
+/*6542*/ "0023 0300 002D/0E01",
+/*6543*/ "0023 002D 0E31",
+/*6544*/ "0023 0300 002D 0E31",
+/*6545*/ "0023 002D 0020",
+/*6546*/ "0023 0300 002D 0020",
+/*6547*/ "0023 002D 002F",
+/*6548*/ "0023 0300 002D 002F",
+/*6549*/ "0023 002D 2060",
+/*6550*/ "0023 0300 002D 2060",
+/*6551*/ "0023 002D 200B",
+/*6552*/ "0023 0300 002D 200B",
+/*6553*/ "0023 007C/00A7",
+/*6554*/ "0023 0300 007C/00A7",
+/*6555*/ "0023 007C/0023",
+/*6556*/ "0023 0300 007C/0023",
+/*6557*/ "0023 007C/2014",
+/*6558*/ "0023 0300 007C/2014",
+/*6559*/ "0023 007C 007C",
+/*6560*/ "0023 0300 007C 007C",
+/*6561*/ "0023 007C/00B4",
+/*6562*/ "0023 0300 007C/00B4",
+/*6563*/ "0023 007C 2028",
+/*6564*/ "0023 0300 007C 2028",
+/*6565*/ "0023 007C/FFFC",
+/*6566*/ "0023 0300 007C/FFFC",
+/*6567*/ "0023 007C 3041",
+/*6568*/ "0023 0300 007C 3041",
+/*6569*/ "0023 007C 007D",
+/*6570*/ "0023 0300 007C 007D",
+/*6571*/ "0023 007C 0300",
+/*6572*/ "0023 0300 007C 0300",
+/*6573*/ "0023 007C 0029",
+/*6574*/ "0023 0300 007C 0029",
+/*6575*/ "0023 007C 000D",
+/*6576*/ "0023 0300 007C 000D",
+/*6577*/ "0023 007C 0021",
+/*6578*/ "0023 0300 007C 0021",
+/*6579*/ "0023 007C/00A0",
+/*6580*/ "0023 0300 007C/00A0",
+/*6581*/ "0023 007C/AC00",
+/*6582*/ "0023 0300 007C/AC00",
+/*6583*/ "0023 007C/AC01",
+/*6584*/ "0023 0300 007C/AC01",
+/*6585*/ "0023 007C/05D0",
+/*6586*/ "0023 0300 007C/05D0",
+/*6587*/ "0023 007C 002D",
+/*6588*/ "0023 0300 007C 002D",
+/*6589*/ "0023 007C/231A",
+/*6590*/ "0023 0300 007C/231A",
+/*6591*/ "0023 007C/2024",
+/*6592*/ "0023 0300 007C/2024",
+/*6593*/ "0023 007C 002C",
+/*6594*/ "0023 0300 007C 002C",
+/*6595*/ "0023 007C/1100",
+/*6596*/ "0023 0300 007C/1100",
+/*6597*/ "0023 007C/11A8",
+/*6598*/ "0023 0300 007C/11A8",
+/*6599*/ "0023 007C/1160",
+/*6600*/ "0023 0300 007C/1160",
+/*6601*/ "0023 007C 000A",
+/*6602*/ "0023 0300 007C 000A",
+/*6603*/ "0023 007C 0085",
+/*6604*/ "0023 0300 007C 0085",
+/*6605*/ "0023 007C 17D6",
+/*6606*/ "0023 0300 007C 17D6",
+/*6607*/ "0023 007C/0030",
+/*6608*/ "0023 0300 007C/0030",
+/*6609*/ "0023 007C/0028",
+/*6610*/ "0023 0300 007C/0028",
+/*6611*/ "0023 007C/0025",
+/*6612*/ "0023 0300 007C/0025",
+/*6613*/ "0023 007C/0024",
+/*6614*/ "0023 0300 007C/0024",
+/*6615*/ "0023 007C 0022",
+/*6616*/ "0023 0300 007C 0022",
+/*6617*/ "0023 007C/1F1E6",
+/*6618*/ "0023 0300 007C/1F1E6",
+/*6619*/ "0023 007C/0E01",
+/*6620*/ "0023 0300 007C/0E01",
+/*6621*/ "0023 007C 0E31",
+/*6622*/ "0023 0300 007C 0E31",
+/*6623*/ "0023 007C 0020",
+/*6624*/ "0023 0300 007C 0020",
+/*6625*/ "0023 007C 002F",
+/*6626*/ "0023 0300 007C 002F",
+/*6627*/ "0023 007C 2060",
+/*6628*/ "0023 0300 007C 2060",
+/*6629*/ "0023 007C 200B",
+/*6630*/ "0023 0300 007C 200B",
+/*6631*/ "1F1E6 1F1E6 1F1E6",
+/*6632*/ "1F1E6 1F1E6 1F1E6 1F1E6",
+/*6633*/ "1F1E6 0300 1F1E6 1F1E6",
+};
+
+const Irange<char const* const*> line_break_test_table {std::begin(line_break_test_array), std::end(line_break_test_array)};
+
 }
 }
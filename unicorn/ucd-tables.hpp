@@ -151,6 +151,14 @@ namespace Unicorn {
         extern const size_t main_names_expanded;
         extern const TableView<char32_t, char const*> corrected_names_table;
 
+        // Collation tables
+
+        extern const Irange<char32_t const*> collation_elements_table;
+        extern const TableView<char32_t, char32_t> collation_single_table;
+        extern const TableView<std::array<char32_t, 3>, char32_t> collation_multiple_table;
+        extern const Irange<const std::array<char32_t, 4>*> collation_implicit_table;
+        extern const TableView<char32_t, char32_t> unified_ideograph_table;
+
         // Decomposition tables
 
         extern const TableView<char32_t, int> combining_class_table;
@@ -196,6 +204,12 @@ namespace Unicorn {
         extern const Irange<char const* const*> grapheme_break_test_table;
         extern const Irange<char const* const*> word_break_test_table;
         extern const Irange<char const* const*> sentence_break_test_table;
+        extern const Irange<char const* const*> line_break_test_table;
+
+        // Collation test tables
+
+        extern const Irange<char const* const*> collation_non_ignorable_test_table;
+        extern const Irange<char const* const*> collation_shifted_test_table;
 
     }
 
@@ -4,6 +4,7 @@
 #include "unicorn/character.hpp"
 #include <algorithm>
 #include <iterator>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -626,4 +627,56 @@ namespace Unicorn {
         return npos;
     }
 
+    // Parallel processing of long strings
+
+    namespace UnicornDetail {
+
+        // Divide the text into chunks of roughly equal size, one per thread,
+        // for processing that can restart without any context at the
+        // positions where the chunks are cut. The boundary function returns
+        // the first such position at or after the given offset, or npos if
+        // there is none. The result is the list of cut offsets, starting
+        // with zero and ending with the string size; strings too short to
+        // be worth dividing are left in one piece.
+
+        constexpr size_t min_parallel_chunk = 65536;
+
+        template <typename F>
+        vector<size_t> find_parallel_cuts(const u8string& src, size_t threads, F boundary) {
+            if (threads == 0)
+                threads = Thread::cpu_threads();
+            size_t chunk = std::max(src.size() / threads + 1, min_parallel_chunk);
+            vector<size_t> cuts = {0};
+            if (threads >= 2 && src.size() >= 2 * chunk) {
+                size_t pos = chunk;
+                while (pos < src.size()) {
+                    pos = boundary(pos);
+                    if (pos >= src.size())
+                        break;
+                    cuts.push_back(pos);
+                    pos += chunk;
+                }
+            }
+            cuts.push_back(src.size());
+            return cuts;
+        }
+
+        // Call f(part, range) for each chunk; the first chunk is processed on
+        // the calling thread.
+
+        template <typename F>
+        void for_each_parallel_chunk(const u8string& src, const vector<size_t>& cuts, F f) {
+            size_t parts = cuts.size() - 1;
+            vector<shared_ptr<Thread>> workers;
+            for (size_t i = 1; i < parts; ++i) {
+                Irange<Utf8Iterator> range = {utf_iterator(src, cuts[i]), utf_iterator(src, cuts[i + 1])};
+                workers.push_back(make_shared<Thread>([=] { f(i, range); }));
+            }
+            f(0, {utf_iterator(src, 0), utf_iterator(src, cuts[1])});
+            for (auto& w: workers)
+                w->wait();
+        }
+
+    }
+
 }